@@ -0,0 +1,48 @@
+/*!
+    \file algorithms_bloom_filter.cpp
+    \brief Blocked Bloom filter example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/bloom_filter.h"
+#include "cache/filecache.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::FileCache cache;
+    CppCommon::BloomFilter<std::string> filter(1000);
+
+    // Fill the file cache and the Bloom filter in front of it
+    for (int i = 0; i < 1000; i += 10)
+    {
+        std::string key = "/file" + std::to_string(i);
+        cache.insert(key, "content of " + key);
+        filter.Insert(key);
+    }
+
+    // Most misses are answered by the Bloom filter without the cache lookup
+    int lookups = 0;
+    int found = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string key = "/file" + std::to_string(i);
+        if (!filter.Contains(key))
+            continue;
+
+        ++lookups;
+        if (cache.find(key).first)
+            ++found;
+    }
+
+    std::cout << "Keys checked: 1000" << std::endl;
+    std::cout << "Cache lookups: " << lookups << std::endl;
+    std::cout << "Cache hits: " << found << std::endl;
+    std::cout << "Bloom filter size: " << filter.bytes() << " bytes" << std::endl;
+
+    return 0;
+}
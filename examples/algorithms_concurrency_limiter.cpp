@@ -0,0 +1,58 @@
+/*!
+    \file algorithms_concurrency_limiter.cpp
+    \brief Adaptive concurrency limiter example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/concurrency_limiter.h"
+
+#include "threads/thread.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Concurrency limit in range [1, 64] with 5 milliseconds latency threshold
+    CppCommon::ConcurrencyLimiter limiter(8, 1, 64, CppCommon::Timespan::milliseconds(5));
+
+    std::atomic<uint64_t> accepted(0);
+    std::atomic<uint64_t> shed(0);
+
+    // Downstream service latency grows with the count of requests in flight
+    std::vector<std::thread> clients;
+    for (int i = 0; i < 32; ++i)
+    {
+        clients.emplace_back([&]()
+        {
+            for (int j = 0; j < 200; ++j)
+            {
+                if (!limiter.TryAcquire())
+                {
+                    ++shed;
+                    CppCommon::Thread::SleepFor(CppCommon::Timespan::milliseconds(1));
+                    continue;
+                }
+
+                ++accepted;
+                uint64_t start = limiter.now();
+                CppCommon::Thread::SleepFor(CppCommon::Timespan::microseconds(500 * limiter.inflight()));
+                limiter.Release(start);
+            }
+        });
+    }
+
+    for (auto& client : clients)
+        client.join();
+
+    std::cout << "Accepted requests: " << accepted << std::endl;
+    std::cout << "Shed requests: " << shed << std::endl;
+    std::cout << "Concurrency limit: " << limiter.limit() << std::endl;
+    std::cout << "Minimal latency: " << limiter.latency().microseconds() << " us" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/*!
+    \file algorithms_count_min_sketch.cpp
+    \brief Count-Min sketch frequency estimator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/count_min_sketch.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Sketch with 0.1% relative error and 99% confidence
+    auto dimensions = CppCommon::CountMinSketch<std::string>::Dimensions(0.001, 0.01);
+    CppCommon::CountMinSketch<std::string> sketch(dimensions.first, dimensions.second);
+
+    // Count requests per path
+    for (int i = 0; i < 100000; ++i)
+    {
+        sketch.Add("/index.html");
+        if ((i % 10) == 0)
+            sketch.Add("/about.html");
+        sketch.Add("/page" + std::to_string(i));
+    }
+
+    std::cout << "Total requests: " << sketch.total() << std::endl;
+    std::cout << "/index.html: " << sketch.Estimate("/index.html") << std::endl;
+    std::cout << "/about.html: " << sketch.Estimate("/about.html") << std::endl;
+    std::cout << "/page42: " << sketch.Estimate("/page42") << std::endl;
+
+    return 0;
+}
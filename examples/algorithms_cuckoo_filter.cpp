@@ -0,0 +1,34 @@
+/*!
+    \file algorithms_cuckoo_filter.cpp
+    \brief Cuckoo filter example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/cuckoo_filter.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::CuckooFilter<std::string> filter(1000);
+
+    // Insert keys
+    filter.Insert("apple");
+    filter.Insert("banana");
+    filter.Insert("cherry");
+
+    std::cout << "Contains 'banana': " << (filter.Contains("banana") ? "maybe" : "no") << std::endl;
+    std::cout << "Contains 'melon': " << (filter.Contains("melon") ? "maybe" : "no") << std::endl;
+
+    // Erase the key
+    filter.Erase("banana");
+    std::cout << "Contains 'banana' after erase: " << (filter.Contains("banana") ? "maybe" : "no") << std::endl;
+
+    std::cout << "Keys: " << filter.size() << std::endl;
+    std::cout << "Cuckoo filter size: " << filter.bytes() << " bytes" << std::endl;
+
+    return 0;
+}
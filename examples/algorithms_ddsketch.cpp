@@ -0,0 +1,47 @@
+/*!
+    \file algorithms_ddsketch.cpp
+    \brief DDSketch quantile estimator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/ddsketch.h"
+
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Sketch per thread with 1% relative accuracy
+    std::vector<CppCommon::DDSketch> sketches(4, CppCommon::DDSketch(0.01));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < sketches.size(); ++t)
+    {
+        threads.emplace_back([&sketches, t]()
+        {
+            std::mt19937_64 generator(t);
+            std::exponential_distribution<double> distribution(1.0 / 0.002);
+            for (int i = 0; i < 250000; ++i)
+                sketches[t].Add(distribution(generator));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Merge sketches on read
+    CppCommon::DDSketch sketch(0.01);
+    for (const auto& s : sketches)
+        sketch.Merge(s);
+
+    std::cout << "Count: " << sketch.count() << std::endl;
+    std::cout << "Bins: " << sketch.bins() << std::endl;
+    std::cout << "p50: " << sketch.Quantile(0.5) * 1000 << " ms" << std::endl;
+    std::cout << "p99: " << sketch.Quantile(0.99) * 1000 << " ms" << std::endl;
+    std::cout << "p999: " << sketch.Quantile(0.999) * 1000 << " ms" << std::endl;
+
+    return 0;
+}
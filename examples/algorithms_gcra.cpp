@@ -0,0 +1,32 @@
+/*!
+    \file algorithms_gcra.cpp
+    \brief Generic cell rate limit algorithm example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/gcra.h"
+
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Two requests per second with the burst of five requests
+    CppCommon::GCRA gcra(2, 5);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        // Wait until the request is allowed
+        CppCommon::Timespan wait;
+        while ((wait = gcra.TryConsume()) != CppCommon::Timespan::zero())
+            CppCommon::Thread::SleepFor(wait);
+
+        std::cout << (CppCommon::UtcTimestamp().milliseconds() % 60000) << " ms - Request " << i << " allowed" << std::endl;
+    }
+
+    return 0;
+}
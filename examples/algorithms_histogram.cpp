@@ -0,0 +1,54 @@
+/*!
+    \file algorithms_histogram.cpp
+    \brief Log-linear histogram example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/histogram.h"
+
+#include "time/timestamp.h"
+
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Histogram histogram;
+
+    // Record latencies of simulated requests from several threads
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&histogram, t]()
+        {
+            std::mt19937_64 generator(t);
+            std::lognormal_distribution<double> distribution(10.0, 1.0);
+            for (int i = 0; i < 250000; ++i)
+                histogram.Record((uint64_t)distribution(generator));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Merge shards on read
+    CppCommon::HistogramSnapshot snapshot = histogram.Snapshot();
+    std::cout << "Count: " << snapshot.count() << std::endl;
+    std::cout << "Mean: " << (uint64_t)snapshot.mean() << " ns" << std::endl;
+    std::cout << "p50: " << snapshot.Quantile(0.5) << " ns" << std::endl;
+    std::cout << "p99: " << snapshot.Quantile(0.99) << " ns" << std::endl;
+    std::cout << "p999: " << snapshot.Quantile(0.999) << " ns" << std::endl;
+    std::cout << "Max: " << snapshot.max() << " ns" << std::endl;
+
+    // Rolling window is the difference between two snapshots
+    for (int i = 0; i < 1000; ++i)
+        histogram.Record(CppCommon::Timespan::milliseconds(5));
+    CppCommon::HistogramSnapshot window = histogram.Snapshot();
+    window.Subtract(snapshot);
+    std::cout << "Window count: " << window.count() << ", p99: " << window.Quantile(0.99) << " ns" << std::endl;
+
+    return 0;
+}
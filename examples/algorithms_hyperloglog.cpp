@@ -0,0 +1,33 @@
+/*!
+    \file algorithms_hyperloglog.cpp
+    \brief HyperLogLog cardinality estimator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/hyperloglog.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Unique visitors of two servers
+    CppCommon::HyperLogLog<std::string> server1;
+    CppCommon::HyperLogLog<std::string> server2;
+
+    for (int i = 0; i < 100000; ++i)
+        server1.Add("user" + std::to_string(i));
+    for (int i = 50000; i < 200000; ++i)
+        server2.Add("user" + std::to_string(i));
+
+    std::cout << "Server 1 unique visitors: " << (uint64_t)server1.Estimate() << std::endl;
+    std::cout << "Server 2 unique visitors: " << (uint64_t)server2.Estimate() << std::endl;
+
+    // Merge estimators to count unique visitors of both servers
+    server1.Merge(server2);
+    std::cout << "Total unique visitors: " << (uint64_t)server1.Estimate() << " (actual 200000)" << std::endl;
+
+    return 0;
+}
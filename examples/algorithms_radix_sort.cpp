@@ -0,0 +1,40 @@
+/*!
+    \file algorithms_radix_sort.cpp
+    \brief Radix sort algorithms example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/radix_sort.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Order
+{
+    int64_t price;
+    std::string symbol;
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::ThreadPool pool;
+
+    std::vector<Order> orders = { { 105, "MSFT" }, { -3, "EURUSD" }, { 99, "AAPL" }, { 105, "GOOG" }, { 0, "BTCUSD" } };
+
+    // Stable sort by price
+    CppCommon::ParallelRadixSort(pool, orders.begin(), orders.end(), [](const Order& order) { return order.price; });
+    std::cout << "Sorted by price:" << std::endl;
+    for (const auto& order : orders)
+        std::cout << order.price << " " << order.symbol << std::endl;
+
+    // Sort by symbol
+    CppCommon::RadixSort(orders.begin(), orders.end(), [](const Order& order) -> const std::string& { return order.symbol; });
+    std::cout << "Sorted by symbol:" << std::endl;
+    for (const auto& order : orders)
+        std::cout << order.symbol << " " << order.price << std::endl;
+
+    return 0;
+}
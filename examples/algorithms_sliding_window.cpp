@@ -0,0 +1,34 @@
+/*!
+    \file algorithms_sliding_window.cpp
+    \brief Sliding window rate limit algorithm example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/sliding_window.h"
+
+#include "threads/thread.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Five requests per one second window
+    CppCommon::SlidingWindow sw(5, CppCommon::Timespan::seconds(1));
+
+    // Try to send a request every 100 milliseconds
+    for (int i = 0; i < 30; ++i)
+    {
+        uint64_t now = sw.now();
+        CppCommon::Timespan wait = sw.TryConsume(1, now);
+        if (wait == CppCommon::Timespan::zero())
+            std::cout << "Request " << i << " allowed, window count: " << sw.Count(now) << std::endl;
+        else
+            std::cout << "Request " << i << " limited, retry after " << wait.milliseconds() << " ms" << std::endl;
+
+        CppCommon::Thread::SleepFor(CppCommon::Timespan::milliseconds(100));
+    }
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/*!
+    \file algorithms_timing_wheel.cpp
+    \brief Hierarchical timing wheel example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/timing_wheel.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::TimingWheel<std::string> wheel;
+
+    // Register connection timeouts
+    CppCommon::UtcTimestamp now;
+    wheel.insert(now + CppCommon::Timespan::milliseconds(100), "connection 1");
+    wheel.insert(now + CppCommon::Timespan::milliseconds(200), "connection 2");
+    auto handle = wheel.insert(now + CppCommon::Timespan::milliseconds(300), "connection 3");
+
+    // Connection 3 is active, so cancel its timeout
+    wheel.remove(handle);
+
+    // Sleep for a while...
+    CppCommon::Thread::SleepFor(CppCommon::Timespan::milliseconds(500));
+
+    // Expire timeouts
+    wheel.advance(CppCommon::UtcTimestamp(), [](std::string& connection) { std::cout << "Timeout: " << connection << std::endl; });
+
+    return 0;
+}
@@ -11,6 +11,7 @@
 #include "threads/thread.h"
 #include "time/timestamp.h"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 
@@ -26,10 +27,12 @@ int main(int argc, char** argv)
     {
         while (!stop)
         {
-            if (tb.Consume())
+            // Sleep until the next token is available
+            CppCommon::Timespan wait = tb.TryConsume();
+            if (wait == CppCommon::Timespan::zero())
                 std::cout << (CppCommon::UtcTimestamp().seconds() % 60) << " - Token consumed" << std::endl;
             else
-                CppCommon::Thread::Yield();
+                CppCommon::Thread::SleepFor(std::min(wait, CppCommon::Timespan::milliseconds(100)));
         }
     });
 
@@ -0,0 +1,30 @@
+/*!
+    \file algorithms_top_k.cpp
+    \brief Space-Saving top-K heavy hitters estimator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/top_k.h"
+
+#include <iostream>
+#include <random>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::TopK<std::string> topk(100);
+
+    // Zipf-like distribution of accessed keys
+    std::mt19937_64 generator(0);
+    std::geometric_distribution<int> distribution(0.01);
+    for (int i = 0; i < 1000000; ++i)
+        topk.Add("key" + std::to_string(distribution(generator)));
+
+    std::cout << "Top 10 hottest keys:" << std::endl;
+    for (const auto& item : topk.Top(10))
+        std::cout << item.key << ": " << item.count << " (error " << item.error << ")" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/*!
+    \file cache_tiered_cache.cpp
+    \brief Tiered memory / disk cache example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/tiered_cache.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Keep two hot entries in memory and spill the rest into the disk tier
+    CppCommon::TieredCache<std::string, int> cache(CppCommon::Path::temp() / "cache_tiered_cache.log", 2);
+
+    // Fill the tiered cache
+    cache.insert("123", 123);
+    cache.insert("456", 456);
+    cache.insert("789", 789);
+
+    std::cout << "Memory entries: " << cache.memory_size() << std::endl;
+    std::cout << "Disk entries: " << cache.disk_size() << std::endl;
+
+    int result;
+
+    // Get the cold value and promote it into the memory tier
+    if (cache.find("123", result))
+        std::cout << "Found: " << result << std::endl;
+
+    std::cout << "Promotions: " << cache.promotions() << std::endl;
+    std::cout << "Demotions: " << cache.demotions() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+/*!
+    \file common_binary_layout.cpp
+    \brief Zero-copy binary layout example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/binary_layout.h"
+#include "threads/spsc_ring_buffer.h"
+
+#include <iostream>
+#include <string>
+
+enum class Side : uint8_t { Buy, Sell };
+
+// Order message: id, price, quantity, side, symbol
+typedef CppCommon::BinaryLayout<uint64_t, double, int32_t, Side, CppCommon::BinaryString> Order;
+
+int main(int argc, char** argv)
+{
+    CppCommon::SPSCRingBuffer ring(4096);
+
+    // Write the order directly into the ring buffer reservation
+    std::string symbol = "EURUSD";
+    CppCommon::BinaryBuilder<Order> builder(ring.Prepare(Order::Size(symbol.size())));
+    builder.Set<0>(1);
+    builder.Set<1>(1.0825);
+    builder.Set<2>(100);
+    builder.Set<3>(Side::Buy);
+    builder.Set<4>(symbol);
+    ring.Commit(builder.size());
+
+    // Read the order in place from the ring buffer
+    CppCommon::BinaryView<Order> view(ring.Peek());
+    if (view)
+    {
+        std::cout << "Message size: " << view.size() << std::endl;
+        std::cout << "Id: " << view.Get<0>() << std::endl;
+        std::cout << "Price: " << view.Get<1>() << std::endl;
+        std::cout << "Quantity: " << view.Get<2>() << std::endl;
+        std::cout << "Side: " << ((view.Get<3>() == Side::Buy) ? "Buy" : "Sell") << std::endl;
+        std::cout << "Symbol: " << view.Get<4>() << std::endl;
+        ring.Release(view.size());
+    }
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+/*!
+    \file common_buffer_chain.cpp
+    \brief Buffer chain example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/buffer_chain.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::BufferChain chain;
+
+    // Append some content
+    chain.Append("Hello, ", 7);
+    chain.Append("World!", 6);
+    std::cout << "Chain: " << chain.ToString() << " (" << chain.slices().size() << " slices)" << std::endl;
+
+    // Split the front without copying
+    CppCommon::BufferChain front = chain.Split(5);
+    std::cout << "Front: " << front.ToString() << std::endl;
+    std::cout << "Rest: " << chain.ToString() << std::endl;
+
+    // Join chains without copying
+    front.Append(std::move(chain));
+    std::cout << "Joined: " << front.ToString() << " (" << front.slices().size() << " slices)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*!
+    \file common_compressed_stream.cpp
+    \brief Compressing writer and decompressing reader example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/compressed_stream.h"
+#include "filesystem/file.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path path = "example.lz4";
+
+    // Write the compressed file with the seekable index
+    {
+        CppCommon::File file(path);
+        file.Create(false, true);
+
+        CppCommon::CompressedWriterOptions options;
+        options.index = true;
+        CppCommon::CompressedWriter writer(file, options);
+        for (int i = 0; i < 100000; ++i)
+            writer.Write("Line " + std::to_string(i) + "\n");
+        writer.Close();
+
+        std::cout << "Uncompressed size: " << writer.size() << std::endl;
+        std::cout << "Compressed size: " << writer.compressed() << std::endl;
+        std::cout << "Blocks: " << writer.blocks() << std::endl;
+    }
+
+    // Read the compressed file from the middle
+    {
+        CppCommon::File file(path);
+        file.Open(true, false);
+
+        CppCommon::CompressedReader reader(file);
+        reader.Seek(reader.size() / 2);
+
+        char buffer[64];
+        size_t size = reader.Read(buffer, sizeof(buffer));
+        std::cout << "Content from the middle: " << std::string(buffer, size) << std::endl;
+    }
+
+    CppCommon::File::Remove(path);
+
+    return 0;
+}
@@ -9,6 +9,7 @@
 #include "common/function.h"
 
 #include <iostream>
+#include <memory>
 
 int test(int v)
 {
@@ -50,5 +51,10 @@ int main(int argc, char** argv)
     function = lambda;
     std::cout << "lambda(55) = " << function(55) << std::endl;
 
+    // Move-only lambda function call in the cache line sized function
+    auto data = std::make_unique<int>(600);
+    CppCommon::MoveFunction<int (int)> move_function = [data = std::move(data)](int v) { return v + *data; };
+    std::cout << "move_lambda(66) = " << move_function(66) << " (sizeof = " << sizeof(move_function) << ")" << std::endl;
+
     return 0;
 }
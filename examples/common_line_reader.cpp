@@ -0,0 +1,31 @@
+/*!
+    \file common_line_reader.cpp
+    \brief Streaming line reader example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/line_reader.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    std::string text = "id,name\r\n1,Alice\r\n2,Bob\r\n3,Carol";
+
+    // Stream lines without creating a string for each line
+    CppCommon::LineReader lines(text);
+    for (auto line : lines)
+    {
+        // Stream fields of the line
+        CppCommon::LineReader fields(line, ",");
+        for (auto field : fields)
+            std::cout << "[" << field << "]";
+        std::cout << std::endl;
+    }
+
+    std::cout << "Lines: " << lines.lines() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+    \file containers_bplustree.cpp
+    \brief B+ tree container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/bplustree.h"
+
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::BPlusTree<int> bplustree;
+
+    bplustree.insert(6);
+    bplustree.insert(3);
+    bplustree.insert(7);
+    bplustree.insert(2);
+    bplustree.insert(8);
+    bplustree.insert(1);
+    bplustree.insert(4);
+    bplustree.insert(9);
+    bplustree.insert(5);
+
+    std::cout << "bplustree:" << std::endl;
+    for (const auto& item : bplustree)
+        std::cout << item << std::endl;
+
+    // Bulk load sorted items and scan the range [100, 110)
+    std::vector<int> items;
+    for (int i = 0; i < 1000; ++i)
+        items.push_back(i);
+    bplustree.load(items.begin(), items.end());
+
+    std::cout << "range:" << std::endl;
+    for (auto it = bplustree.lower_bound(100); (it != bplustree.end()) && (*it < 110); ++it)
+        std::cout << *it << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/*!
+    \file containers_compressed_sequence.cpp
+    \brief Compressed integer sequence container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/compressed_sequence.h"
+
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Trade timestamps in nanoseconds
+    std::vector<uint64_t> timestamps;
+    uint64_t timestamp = 1700000000000000000ull;
+    for (int i = 0; i < 100000; ++i)
+        timestamps.push_back(timestamp += 1000 + (i % 7) * 250);
+
+    CppCommon::CompressedSequence sequence(timestamps);
+    std::cout << "Values: " << sequence.size() << std::endl;
+    std::cout << "Raw size: " << timestamps.size() * sizeof(uint64_t) << " bytes" << std::endl;
+    std::cout << "Compressed size: " << sequence.data().size() << " bytes" << std::endl;
+
+    // Find trades of the time range
+    size_t first = sequence.lower_bound(1700000000010000000ull);
+    size_t last = sequence.lower_bound(1700000000020000000ull);
+    std::cout << "Trades in range: " << (last - first) << std::endl;
+
+    // Open the flat buffer (e.g. mapped file) without deserialization
+    auto opened = CppCommon::CompressedSequence::Open(sequence.data());
+    std::cout << "Last timestamp: " << opened.back() << std::endl;
+
+    return 0;
+}
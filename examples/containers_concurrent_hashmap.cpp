@@ -0,0 +1,41 @@
+/*!
+    \file containers_concurrent_hashmap.cpp
+    \brief Concurrent hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/concurrent_hashmap.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ConcurrentHashMap<int, int> hashmap(128, -1);
+
+    // Fill the concurrent hash map from several threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&hashmap, thread]()
+        {
+            for (int i = 0; i < 10; ++i)
+                hashmap.insert_or_assign(thread * 10 + i, thread);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "hashmap.size() = " << hashmap.size() << std::endl;
+    for (int key = 0; key < 40; key += 10)
+    {
+        int value;
+        if (hashmap.find(key, value))
+            std::cout << key << " => " << value << std::endl;
+    }
+
+    return 0;
+}
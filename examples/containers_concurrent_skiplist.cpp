@@ -0,0 +1,55 @@
+/*!
+    \file containers_concurrent_skiplist.cpp
+    \brief Intrusive lock-free concurrent skip list container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/concurrent_skiplist.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct MyNode : public CppCommon::ConcurrentSkipList<MyNode>::Node
+{
+    int value;
+
+    MyNode(int v) : value(v) {}
+    friend bool operator<(const MyNode& node1, const MyNode& node2) { return node1.value < node2.value; }
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::ConcurrentSkipList<MyNode> skiplist;
+
+    std::vector<MyNode> nodes;
+    for (int i = 0; i < 40; ++i)
+        nodes.emplace_back(i);
+
+    // Fill the skip list from several threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&skiplist, &nodes, thread]()
+        {
+            for (int i = thread; i < 40; i += 4)
+                skiplist.insert(nodes[i]);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Erase some nodes
+    for (int i = 0; i < 40; i += 3)
+        skiplist.erase(nodes[i]);
+
+    std::cout << "skiplist.size() = " << skiplist.size() << std::endl;
+    std::cout << "skiplist.lower_bound(20) = " << skiplist.lower_bound(MyNode(20))->value << std::endl;
+    for (auto& node : skiplist)
+        std::cout << node.value << " ";
+    std::cout << std::endl;
+
+    return 0;
+}
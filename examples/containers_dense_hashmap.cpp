@@ -0,0 +1,36 @@
+/*!
+    \file containers_dense_hashmap.cpp
+    \brief Dense hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/dense_hashmap.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Table of order quantities
+    CppCommon::DenseHashMap<std::string, int> orders;
+    orders.emplace("EURUSD", 100);
+    orders.emplace("GBPUSD", 200);
+    orders.emplace("USDJPY", 300);
+    orders["EURUSD"] += 50;
+
+    // Erase filled orders (the last order takes the erased position)
+    orders.erase("GBPUSD");
+
+    // Scan orders without walking blank buckets
+    int total = 0;
+    for (const auto& order : orders)
+    {
+        std::cout << order.first << " -> " << order.second << std::endl;
+        total += order.second;
+    }
+    std::cout << "Total: " << total << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*!
+    \file containers_hashtable.cpp
+    \brief Intrusive hash table container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/hashtable.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Order : public CppCommon::HashTableNode<Order, struct OrderById>, public CppCommon::HashTableNode<Order, struct OrderByClient>
+{
+    int id;
+    std::string client;
+
+    Order(int i, const std::string& c) : id(i), client(c) {}
+};
+
+struct OrderById { int operator()(const Order& order) const noexcept { return order.id; } };
+struct OrderByClient { const std::string& operator()(const Order& order) const noexcept { return order.client; } };
+
+int main(int argc, char** argv)
+{
+    // Orders live in the pool and are indexed by id and by client
+    std::vector<Order> pool = { { 1, "alice" }, { 2, "bob" }, { 3, "alice" }, { 4, "carol" } };
+    CppCommon::HashTable<Order, OrderById> by_id;
+    CppCommon::HashTable<Order, OrderByClient> by_client;
+    for (auto& order : pool)
+    {
+        by_id.insert(order);
+        by_client.insert_equal(order);
+    }
+
+    std::cout << "Order 2 client: " << by_id.find(2)->client << std::endl;
+
+    auto range = by_client.equal_range("alice");
+    std::cout << "Orders of alice:";
+    for (auto it = range.first; it != range.second; ++it)
+        std::cout << " " << it->id;
+    std::cout << std::endl;
+
+    // Unlink the order from both indexes
+    by_id.unlink(pool[0]);
+    by_client.unlink(pool[0]);
+    std::cout << "Orders of alice after cancel: " << by_client.count("alice") << std::endl;
+
+    return 0;
+}
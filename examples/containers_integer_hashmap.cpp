@@ -0,0 +1,32 @@
+/*!
+    \file containers_integer_hashmap.cpp
+    \brief Integer keys hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/integer_hashmap.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::IntegerHashMap<uint64_t, uint32_t> hashmap;
+
+    hashmap[6] = 6;
+    hashmap[3] = 3;
+    hashmap[7] = 7;
+    hashmap[2] = 2;
+    hashmap[8] = 8;
+    hashmap[1] = 1;
+    hashmap[4] = 4;
+    hashmap[9] = 9;
+    hashmap[5] = 5;
+
+    std::cout << "hashmap:" << std::endl;
+    for (auto item : hashmap)
+        std::cout << item.first << " => " << item.second << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+/*!
+    \file containers_linked_hashmap.cpp
+    \brief Linked hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/linked_hashmap.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    const size_t capacity = 3;
+
+    // Bounded LRU cache of sessions
+    CppCommon::LinkedHashMap<int, std::string> sessions;
+    for (int id : { 1, 2, 3, 1, 4, 5 })
+    {
+        if (sessions.touch(id) != sessions.end())
+        {
+            std::cout << "Session " << id << " used" << std::endl;
+            continue;
+        }
+
+        if (sessions.size() == capacity)
+            std::cout << "Session " << sessions.pop_oldest().first << " evicted" << std::endl;
+
+        sessions.emplace(id, "session" + std::to_string(id));
+        std::cout << "Session " << id << " created" << std::endl;
+    }
+
+    // Show sessions from the oldest one to the newest one
+    for (const auto& session : sessions)
+        std::cout << session.first << " -> " << session.second << std::endl;
+
+    return 0;
+}
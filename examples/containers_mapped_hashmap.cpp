@@ -0,0 +1,32 @@
+/*!
+    \file containers_mapped_hashmap.cpp
+    \brief Memory-mapped persistent hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/mapped_hashmap.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Build the static lookup table once
+    CppCommon::MappedHashMapBuilder<uint32_t, uint64_t> builder;
+    for (uint32_t i = 0; i < 100; ++i)
+        builder.insert(i, (uint64_t)i * i);
+    builder.Save("squares.hashmap", CppCommon::MappedHashMapLayout::PERFECT);
+
+    // Open the lookup table instantly without parsing
+    CppCommon::MappedHashMap<uint32_t, uint64_t> squares("squares.hashmap");
+    std::cout << "Lookup table size: " << squares.size() << std::endl;
+    std::cout << "7 * 7 = " << squares.at(7) << std::endl;
+    std::cout << "99 * 99 = " << squares.at(99) << std::endl;
+    std::cout << "Contains 100: " << (squares.contains(100) ? "true" : "false") << std::endl;
+    squares.Close();
+
+    CppCommon::File::Remove("squares.hashmap");
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*!
+    \file containers_owning_container.cpp
+    \brief Owning adapter for intrusive containers example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/list.h"
+#include "containers/owning_container.h"
+#include "memory/allocator_arena.h"
+
+#include <iostream>
+
+struct MyListNode : public CppCommon::List<MyListNode>::Node
+{
+    int value;
+    MyListNode(int v) : value(v) {}
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ArenaMemoryManager<CppCommon::DefaultMemoryManager> arena(auxiliary);
+
+    // List nodes are allocated from the arena
+    CppCommon::OwningContainer<CppCommon::List<MyListNode>, CppCommon::ArenaMemoryManager<CppCommon::DefaultMemoryManager>> list(arena);
+    for (int i = 0; i < 10; ++i)
+        list.push_back(*list.create(i));
+
+    std::cout << "list.size() = " << list.size() << std::endl;
+    std::cout << "arena.allocations() = " << arena.allocations() << std::endl;
+
+    // Clear the list and free all nodes at once
+    list.clear();
+
+    std::cout << "list.size() = " << list.size() << std::endl;
+    std::cout << "arena.allocations() = " << arena.allocations() << std::endl;
+
+    return 0;
+}
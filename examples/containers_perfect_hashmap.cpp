@@ -0,0 +1,45 @@
+/*!
+    \file containers_perfect_hashmap.cpp
+    \brief Perfect hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/perfect_hashmap.h"
+#include "filesystem/path.h"
+
+#include <iostream>
+
+enum class Method { Get, Head, Post, Put, Delete };
+
+// Perfect hash map is built at compile time
+constexpr auto methods = CppCommon::MakePerfectHashMap<std::string_view, Method>(
+{
+    { "GET", Method::Get },
+    { "HEAD", Method::Head },
+    { "POST", Method::Post },
+    { "PUT", Method::Put },
+    { "DELETE", Method::Delete }
+});
+
+static_assert(methods.at("POST") == Method::Post);
+
+int main(int argc, char** argv)
+{
+    for (std::string_view request : { "GET", "PUT", "PATCH" })
+    {
+        auto it = methods.find(request);
+        if (it != methods.end())
+            std::cout << request << " -> " << (int)it->second << std::endl;
+        else
+            std::cout << request << " -> unknown method" << std::endl;
+    }
+
+    // Enum strings of the library enums use perfect hash maps
+    std::cout << "File type: " << CppCommon::EnumToString(CppCommon::Path::executable().type()) << std::endl;
+    auto type = CppCommon::EnumFromString<CppCommon::FileType>("DIRECTORY");
+    std::cout << "Parsed file type: " << (type ? CppCommon::EnumToString(*type) : "<unknown>") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*!
+    \file containers_persistent_hashmap.cpp
+    \brief Persistent hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/persistent_hashmap.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    typedef CppCommon::PersistentHashMap<std::string, int> Config;
+
+    // Build the initial configuration with the transient builder
+    auto builder = Config().transient();
+    builder.set("threads", 4);
+    builder.set("timeout", 30);
+    builder.set("retries", 3);
+
+    CppCommon::AtomicPersistentHashMap<std::string, int> config(builder.persistent());
+
+    // Readers take cheap snapshots
+    Config snapshot = config.load();
+
+    // Writers publish new versions
+    config.update([](const Config& current) { return current.set("threads", 8).erase("retries"); });
+
+    std::cout << "Snapshot:" << std::endl;
+    for (const auto& item : snapshot)
+        std::cout << item.first << " = " << item.second << std::endl;
+
+    std::cout << "Current:" << std::endl;
+    for (const auto& item : config.load())
+        std::cout << item.first << " = " << item.second << std::endl;
+
+    return 0;
+}
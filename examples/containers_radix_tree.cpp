@@ -0,0 +1,41 @@
+/*!
+    \file containers_radix_tree.cpp
+    \brief Radix tree container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/radix_tree.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::RadixTree<std::string> routes;
+
+    routes.insert("/", "index");
+    routes.insert("/api", "api");
+    routes.insert("/api/users", "users");
+    routes.insert("/api/orders", "orders");
+    routes.insert("/static/css/main.css", "css");
+    routes.insert("/static/js/main.js", "js");
+
+    // Route URLs with the longest prefix match
+    for (const auto& url : { "/api/users/42", "/api/items", "/about" })
+    {
+        auto route = routes.longest_prefix(url);
+        std::cout << url << " -> " << route.first << " (" << *route.second << ")" << std::endl;
+    }
+
+    // List the virtual directory
+    std::cout << "/static:" << std::endl;
+    routes.walk("/static/", [](std::string_view key, const std::string& value)
+    {
+        std::cout << key << " = " << value << std::endl;
+        return true;
+    });
+
+    return 0;
+}
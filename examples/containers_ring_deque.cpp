@@ -0,0 +1,37 @@
+/*!
+    \file containers_ring_deque.cpp
+    \brief Ring buffer deque container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/ring_deque.h"
+
+#include <iostream>
+
+struct MyMessage
+{
+    int id;
+    double price;
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::RingDeque<MyMessage> deque;
+
+    MyMessage messages[] = { { 1, 10.5 }, { 2, 11.0 }, { 3, 11.5 } };
+    size_t index = deque.push_back(messages, 3);
+    deque.push_front({ 0, 10.0 });
+
+    std::cout << "deque.slot(" << index << ").id = " << deque.slot(index).id << std::endl;
+
+    for (const auto& message : deque)
+        std::cout << "message.id = " << message.id << ", message.price = " << message.price << std::endl;
+
+    MyMessage popped[2];
+    size_t count = deque.pop_front(popped, 2);
+    std::cout << "deque.pop_front() = " << count << ", deque.size() = " << deque.size() << std::endl;
+
+    return 0;
+}
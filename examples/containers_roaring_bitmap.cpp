@@ -0,0 +1,35 @@
+/*!
+    \file containers_roaring_bitmap.cpp
+    \brief Roaring compressed bitmap container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/roaring_bitmap.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::RoaringBitmap bitmap1 = { 1, 2, 3, 100000, 200000 };
+    CppCommon::RoaringBitmap bitmap2;
+    bitmap2.add_range(2, 100000);
+
+    CppCommon::RoaringBitmap intersection = bitmap1 & bitmap2;
+    std::cout << "intersection.cardinality() = " << intersection.cardinality() << std::endl;
+    for (uint32_t value : intersection)
+        std::cout << "value = " << value << std::endl;
+
+    std::cout << "(bitmap1 | bitmap2).cardinality() = " << (bitmap1 | bitmap2).cardinality() << std::endl;
+    std::cout << "(bitmap1 - bitmap2).cardinality() = " << (bitmap1 - bitmap2).cardinality() << std::endl;
+
+    // Query the serialized bitmap without deserialization
+    std::vector<uint8_t> buffer = bitmap2.serialize();
+    CppCommon::RoaringBitmapView view(buffer.data(), buffer.size());
+    std::cout << "buffer.size() = " << buffer.size() << std::endl;
+    std::cout << "view.contains(5000) = " << view.contains(5000) << std::endl;
+    std::cout << "view.contains(200000) = " << view.contains(200000) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*!
+    \file containers_shared_hashmap.cpp
+    \brief Shared memory hash map container example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/shared_hashmap.h"
+
+#include <iostream>
+
+typedef CppCommon::SharedHashMap<int, int> Table;
+
+int main(int argc, char** argv)
+{
+    // Create or open the shared memory heap
+    CppCommon::SharedMemory shared("shared_hashmap_example", 1024 * 1024);
+    CppCommon::SharedMemoryManager manager(shared);
+
+    // Build the lookup table once in the first process
+    Table* table = (Table*)manager.root();
+    if (table == nullptr)
+    {
+        table = CppCommon::SharedAllocator<Table>(manager).Create(manager);
+        for (int i = 0; i < 10; ++i)
+            table->emplace(i, i * i);
+        manager.set_root(table);
+        std::cout << "Shared lookup table created!" << std::endl;
+    }
+    else
+        std::cout << "Shared lookup table opened!" << std::endl;
+
+    // Show the lookup table content
+    for (const auto& item : *table)
+        std::cout << item.first << " -> " << item.second << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+/*!
+    \file containers_small_vector.cpp
+    \brief Small vector and small string containers example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/small_vector.h"
+#include "string/small_string.h"
+#include "string/string_utils.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::SmallVector<int, 4> vector = { 1, 2, 3 };
+    std::cout << "vector.is_inline() = " << vector.is_inline() << std::endl;
+    vector.push_back(4);
+    vector.push_back(5);
+    std::cout << "vector.is_inline() = " << vector.is_inline() << ", vector.capacity() = " << vector.capacity() << std::endl;
+
+    CppCommon::SmallVector<CppCommon::SmallString<16>, 8> tokens;
+    CppCommon::StringUtils::Split("EURUSD,1.1050,1.1052", ',', tokens);
+    for (const auto& token : tokens)
+        std::cout << "token = " << token << ", token.is_inline() = " << token.is_inline() << std::endl;
+
+    CppCommon::SmallString<32> joined;
+    CppCommon::StringUtils::Join(tokens, " | ", joined);
+    std::cout << "joined = " << joined << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*!
+    \file filesystem_append_log.cpp
+    \brief Group-commit durable append log example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/append_log.h"
+#include "filesystem/file.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path path("example.wal");
+
+    // Recover records of the previous run and append new ones
+    CppCommon::AppendLog log;
+    log.Open(path, [](uint64_t offset, std::span<const uint8_t> record)
+    {
+        std::cout << "Recovered record at " << offset << ": " << std::string((const char*)record.data(), record.size()) << std::endl;
+    });
+
+    // Commit records from multiple threads sharing fsync() calls
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&log, thread]()
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                std::string record = "thread " + std::to_string(thread) + " record " + std::to_string(i);
+                log.Commit(record.data(), record.size());
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "Committed groups: " << log.groups() << std::endl;
+    log.Close();
+
+    std::cout << "Log size: " << CppCommon::File(path).size() << std::endl;
+    CppCommon::File::Remove(path);
+    return 0;
+}
@@ -0,0 +1,55 @@
+/*!
+    \file filesystem_async_file_io.cpp
+    \brief Asynchronous file I/O engine example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_file_io.h"
+#include "filesystem/file.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::AsyncFileIO engine;
+    std::cout << "Native asynchronous I/O: " << (engine.native() ? "true" : "false") << std::endl;
+
+    CppCommon::AsyncFileIO::FileId file = engine.Open("example.tmp", true, true, true);
+
+    // Queue a batch of writes at different offsets
+    std::vector<std::string> records;
+    for (int i = 0; i < 10; ++i)
+        records.push_back("record " + std::to_string(i) + "\n");
+    uint64_t offset = 0;
+    for (const auto& record : records)
+    {
+        engine.Write(file, offset, record.data(), record.size(), [](size_t size, int error)
+        {
+            if (error != 0)
+                std::cout << "Write failed with error " << error << std::endl;
+        });
+        offset += record.size();
+    }
+
+    // Submit the batch with a single system call and wait for completions
+    std::cout << "Submitted operations: " << engine.Submit() << std::endl;
+    engine.WaitAll();
+
+    // Flush and read the file back with futures
+    std::future<void> flushed = engine.Fsync(file);
+    engine.WaitAll();
+    flushed.get();
+
+    std::string content(offset, 0);
+    std::future<size_t> read = engine.Read(file, 0, content.data(), content.size());
+    engine.WaitAll();
+    std::cout << "Read " << read.get() << " bytes:" << std::endl << content;
+
+    engine.Close(file);
+    CppCommon::File::Remove("example.tmp");
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+    \file filesystem_mapped_file.cpp
+    \brief Filesystem memory-mapped file example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path path("example.journal");
+
+    // Append records into the journal file through the read-write mapping
+    {
+        CppCommon::File::WriteEmpty(path);
+        CppCommon::MappedFile journal(path, CppCommon::MappedFileMode::READWRITE, 0, 0);
+        for (int i = 0; i < 10; ++i)
+        {
+            std::string record = "record " + std::to_string(i) + "\n";
+            size_t offset = journal.size();
+            journal.Resize(offset + record.size());
+            std::memcpy(journal.span().data() + offset, record.data(), record.size());
+        }
+        journal.Flush();
+    }
+
+    // Scan the journal file sequentially without copying it
+    CppCommon::MappedFile journal(path);
+    journal.Advise(CppCommon::MappedFileAdvice::SEQUENTIAL);
+    std::cout << "Journal size: " << journal.size() << std::endl;
+    std::cout << "Journal records: " << std::count(journal.view().begin(), journal.view().end(), '\n') << std::endl;
+    journal.Unmap();
+
+    CppCommon::File::Remove(path);
+    return 0;
+}
@@ -0,0 +1,32 @@
+/*!
+    \file filesystem_path_stat_cache.cpp
+    \brief Filesystem path metadata cache example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/path_stat_cache.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path current = CppCommon::Path::current().absolute();
+
+    // Cache metadata of the current directory entries for 10 seconds
+    CppCommon::PathStatCache cache(CppCommon::Timespan::seconds(10));
+    cache.Populate(current);
+
+    // Repeated queries are served from the cache
+    for (int i = 0; i < 3; ++i)
+    {
+        CppCommon::PathStatus status = cache.Get(current);
+        std::cout << current << ": " << (status.IsExists() ? "exists" : "not found") << ", modified " << status.modified.seconds() << std::endl;
+    }
+
+    std::cout << "Cached entries: " << cache.size() << std::endl;
+    std::cout << "Cache hits: " << cache.hits() << std::endl;
+    std::cout << "Cache misses: " << cache.misses() << std::endl;
+    return 0;
+}
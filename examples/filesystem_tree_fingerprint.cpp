@@ -0,0 +1,46 @@
+/*!
+    \file filesystem_tree_fingerprint.cpp
+    \brief Filesystem directory tree fingerprint example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/tree_fingerprint.h"
+#include "threads/thread_pool.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path directory = (argc > 1) ? CppCommon::Path(argv[1]) : CppCommon::Path::current();
+    CppCommon::Path cache = directory.filename() + ".fingerprint";
+
+    // Scan the directory tree incrementally with the cache of the previous run
+    CppCommon::ThreadPool pool;
+    CppCommon::TreeFingerprintOptions options;
+    options.pool = &pool;
+
+    CppCommon::TreeFingerprint previous;
+    previous.Load(cache);
+    CppCommon::TreeFingerprint current = previous;
+    current.Scan(directory, options);
+    current.Save(cache);
+
+    std::cout << "Files: " << current.size() << std::endl;
+    std::cout << "Hashed files: " << current.hashed() << std::endl;
+    std::cout << "Reused files: " << current.reused() << std::endl;
+    std::cout << "Read bytes: " << current.bytes() << std::endl;
+    std::cout << "Tree hash: " << current.hash() << std::endl;
+
+    // Show changes since the previous run
+    CppCommon::TreeDifference difference = CppCommon::TreeFingerprint::Compare(previous, current);
+    for (const auto& path : difference.created)
+        std::cout << "Created: " << path << std::endl;
+    for (const auto& path : difference.removed)
+        std::cout << "Removed: " << path << std::endl;
+    for (const auto& path : difference.modified)
+        std::cout << "Modified: " << path << std::endl;
+
+    return 0;
+}
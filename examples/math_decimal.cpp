@@ -0,0 +1,42 @@
+/*!
+    \file math_decimal.cpp
+    \brief Fixed-point decimal example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "math/decimal.h"
+
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    using Price = CppCommon::Decimal<4>;
+
+    Price price = Price::Parse("101.2575");
+    Price quantity = Price::Parse("3.5");
+    std::cout << "Price: " << price << std::endl;
+    std::cout << "Quantity: " << quantity << std::endl;
+    std::cout << "Notional: " << price * quantity << std::endl;
+    std::cout << "Average: " << (price * quantity) / 7 << std::endl;
+    std::cout << "Rounded: " << price.rescale<2>() << std::endl;
+
+    // Batch operations
+    std::vector<Price> prices = { Price::Parse("1.1"), Price::Parse("2.2"), Price::Parse("3.3") };
+    Price::Multiply(prices, Price::Parse("1.05"), prices);
+    std::cout << "Total: " << Price::Sum(prices) << std::endl;
+
+    // Overflow checks
+    try
+    {
+        Price::FromRaw(0x7FFFFFFFFFFFFFFFll) + Price(1);
+    }
+    catch (const CppCommon::DomainException& ex)
+    {
+        std::cout << "Overflow: " << ex.message() << std::endl;
+    }
+
+    return 0;
+}
@@ -26,5 +26,14 @@ int main(int argc, char** argv)
     std::cout << "a[2] = " << a[2] << std::endl;
     alloc.ReleaseArray(a);
 
+    // Drop temporary allocations of the nested phase
+    {
+        CppCommon::ArenaScope<CppCommon::DefaultMemoryManager> scope(manger);
+        int* t = alloc.CreateArray(1000, 0);
+        std::cout << "manger.allocations() = " << manger.allocations() << std::endl;
+        (void)t;
+    }
+    std::cout << "manger.allocations() = " << manger.allocations() << std::endl;
+
     return 0;
 }
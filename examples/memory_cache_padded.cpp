@@ -0,0 +1,40 @@
+/*!
+    \file memory_cache_padded.cpp
+    \brief Cache line padding example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_aligned.h"
+#include "memory/cache_padded.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Per-thread counters in separate cache lines
+static CppCommon::CachePadded<std::atomic<size_t>> counters[4];
+
+int main(int argc, char** argv)
+{
+    std::cout << "Destructive interference size: " << CppCommon::hardware_destructive_interference_size << std::endl;
+    std::cout << "Constructive interference size: " << CppCommon::hardware_constructive_interference_size << std::endl;
+
+    // Increment counters from different threads without false sharing
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i)
+        threads.emplace_back([i]() { for (size_t j = 0; j < 1000000; ++j) counters[i]->fetch_add(1, std::memory_order_relaxed); });
+    for (auto& thread : threads)
+        thread.join();
+
+    for (size_t i = 0; i < 4; ++i)
+        std::cout << "Counter " << i << ": " << counters[i]->load() << std::endl;
+
+    // Cache line aligned buffer
+    std::vector<uint8_t, CppCommon::CacheAlignedAllocator<uint8_t>> buffer(1000);
+    std::cout << "Buffer address: " << (void*)buffer.data() << std::endl;
+
+    return 0;
+}
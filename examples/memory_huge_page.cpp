@@ -0,0 +1,32 @@
+/*!
+    \file memory_huge_page.cpp
+    \brief Huge page memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_arena.h"
+#include "memory/allocator_huge_page.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    size_t page = CppCommon::HugePageMemoryManager::HugePageSize();
+    std::cout << "Huge page size: " << page << std::endl;
+    std::cout << "NUMA nodes: " << CppCommon::HugePageMemoryManager::NumaNodes() << std::endl;
+
+    // Arena pages are backed by huge pages of the first NUMA node
+    CppCommon::HugePageMemoryManager auxiliary(0);
+    CppCommon::ArenaMemoryManager<CppCommon::HugePageMemoryManager> manager(auxiliary, page);
+    CppCommon::ArenaAllocator<int, CppCommon::HugePageMemoryManager> alloc(manager);
+
+    int* a = alloc.CreateArray(3, 123);
+    std::cout << "a[0] = " << a[0] << std::endl;
+    std::cout << "a[1] = " << a[1] << std::endl;
+    std::cout << "a[2] = " << a[2] << std::endl;
+    alloc.ReleaseArray(a);
+
+    return 0;
+}
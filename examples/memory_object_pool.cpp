@@ -0,0 +1,56 @@
+/*!
+    \file memory_object_pool.cpp
+    \brief Typed object pool example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/object_pool.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Message
+{
+    int id;
+    std::string text;
+
+    Message(int i, const std::string& t) : id(i), text(t) {}
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager manager;
+    CppCommon::ObjectPool<Message> pool(manager);
+
+    // Start some threads which create and release messages
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&pool, thread]()
+        {
+            std::vector<Message*> messages;
+            for (int i = 0; i < 1000; ++i)
+            {
+                for (int j = 0; j < 100; ++j)
+                    messages.push_back(pool.Create(j, "Message from thread " + std::to_string(thread)));
+                for (auto message : messages)
+                    pool.Release(message);
+                messages.clear();
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "Messages created: " << (4 * 1000 * 100) << std::endl;
+    std::cout << "Pool capacity: " << pool.capacity() << std::endl;
+    std::cout << "Pool chunks: " << pool.chunks() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*!
+    \file memory_pressure.cpp
+    \brief Memory pressure monitor example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/memcache.h"
+#include "memory/memory_pressure.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::MemCache<std::string, std::string> cache(4, 100000);
+
+    CppCommon::MemoryPressure pressure;
+    std::cout << "cgroup: " << (pressure.cgroup().empty() ? "<host>" : pressure.cgroup()) << std::endl;
+
+    // Shed cold cache entries under the memory pressure
+    pressure.subscribe([&cache](CppCommon::MemoryPressureLevel level, const CppCommon::MemoryPressureStatus& status)
+    {
+        if (level == CppCommon::MemoryPressureLevel::CRITICAL)
+            cache.clear();
+        else if (level == CppCommon::MemoryPressureLevel::MODERATE)
+            cache.evict(cache.size() / 10);
+        std::cout << "Memory pressure: " << level << std::endl;
+    });
+
+    CppCommon::MemoryPressureStatus status = pressure.status();
+    std::cout << "Memory limit: " << status.limit << " bytes" << std::endl;
+    std::cout << "Memory usage: " << status.usage << " bytes" << std::endl;
+    std::cout << "Memory stalls: " << status.some << "%" << std::endl;
+    std::cout << "Memory pressure: " << pressure.update(status) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*!
+    \file memory_profiling.cpp
+    \brief Profiling memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_profiling.h"
+#include "system/stack_trace_manager.h"
+
+#include <iostream>
+#include <list>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::StackTraceManager::Initialize();
+
+    {
+        // Sample allocations with the mean interval of 4096 bytes
+        CppCommon::DefaultMemoryManager auxiliary;
+        CppCommon::ProfilingMemoryManager<CppCommon::DefaultMemoryManager> manager(auxiliary, 4096);
+
+        CppCommon::ProfilingAllocator<int, CppCommon::DefaultMemoryManager> alloc(manager);
+        std::list<int, decltype(alloc)> list(alloc);
+        std::vector<int, decltype(alloc)> vector(alloc);
+        for (int i = 0; i < 100000; ++i)
+        {
+            list.push_back(i);
+            vector.push_back(i);
+        }
+
+        // Show the top allocation callsites
+        std::cout << manager.profiler().report(2);
+    }
+
+    CppCommon::StackTraceManager::Cleanup();
+
+    return 0;
+}
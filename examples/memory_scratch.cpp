@@ -0,0 +1,44 @@
+/*!
+    \file memory_scratch.cpp
+    \brief Thread-local scratch memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/small_vector.h"
+#include "memory/allocator_scratch.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+size_t CountWords(const std::string& text)
+{
+    // Temporary words offsets are allocated from the current thread scratch arena
+    std::vector<size_t, CppCommon::ScratchAllocator<size_t>> offsets;
+    for (size_t i = 0; i < text.size(); ++i)
+        if ((text[i] != ' ') && ((i == 0) || (text[i - 1] == ' ')))
+            offsets.push_back(i);
+    return offsets.size();
+}
+
+int main(int argc, char** argv)
+{
+    for (int request = 0; request < 3; ++request)
+    {
+        // Drop all temporary allocations of the request at once
+        CppCommon::ScratchScope scope;
+
+        CppCommon::SmallVector<int, 4, CppCommon::ScratchAllocator<int>> numbers;
+        for (int i = 0; i < 100; ++i)
+            numbers.push_back(i);
+
+        std::cout << "Request " << request << ": words = " << CountWords("The quick brown fox jumps over the lazy dog");
+        std::cout << ", numbers = " << numbers.size();
+        std::cout << ", scratch allocations = " << scope.arena().allocations() << std::endl;
+    }
+    std::cout << "Scratch allocations after requests = " << CppCommon::ScratchArena::Current().allocations() << std::endl;
+
+    return 0;
+}
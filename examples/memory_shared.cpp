@@ -0,0 +1,34 @@
+/*!
+    \file memory_shared.cpp
+    \brief Shared memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_shared.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Create or open a shared memory heap
+    CppCommon::SharedMemory shared("shared_allocator_example", 1024 * 1024);
+    CppCommon::SharedMemoryManager manager(shared);
+    CppCommon::SharedAllocator<uint64_t> alloc(manager);
+
+    // Root counter is shared between all processes which run this example
+    uint64_t* counter = (uint64_t*)manager.root();
+    if (counter == nullptr)
+    {
+        counter = alloc.Create(0);
+        manager.set_root(counter);
+    }
+    std::cout << "Run counter: " << ++(*counter) << std::endl;
+
+    std::cout << "Shared heap capacity: " << manager.capacity() << std::endl;
+    std::cout << "Shared heap available: " << manager.available() << std::endl;
+    std::cout << "Shared heap allocations: " << manager.allocations() << std::endl;
+
+    return 0;
+}
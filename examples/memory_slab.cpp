@@ -0,0 +1,35 @@
+/*!
+    \file memory_slab.cpp
+    \brief Slab memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_slab.h"
+
+#include <iostream>
+#include <list>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::SlabMemoryManager<CppCommon::DefaultMemoryManager> manager(auxiliary);
+    CppCommon::SlabAllocator<std::string, CppCommon::DefaultMemoryManager> alloc(manager);
+
+    // Nodes of different sizes are served from different size classes
+    std::list<std::string, decltype(alloc)> list(alloc);
+    for (int i = 0; i < 1000; ++i)
+        list.emplace_back("Item " + std::to_string(i));
+
+    std::cout << "manager.allocations() = " << manager.allocations() << std::endl;
+    std::cout << "manager.slabs() = " << manager.slabs() << std::endl;
+
+    list.clear();
+
+    std::cout << "manager.allocations() = " << manager.allocations() << std::endl;
+    std::cout << "manager.slabs() = " << manager.slabs() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*!
+    \file memory_thread_cache.cpp
+    \brief Thread cache memory allocator example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_pool.h"
+#include "memory/allocator_thread_cache.h"
+
+#include <iostream>
+#include <thread>
+
+struct MyMessage
+{
+    int id;
+    double price;
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> pool(auxiliary);
+    CppCommon::ThreadCacheMemoryManager<CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager>> manager(pool);
+    CppCommon::ThreadCacheAllocator<MyMessage, CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager>> alloc(manager);
+
+    // Allocate the message in the producer thread
+    MyMessage* message = nullptr;
+    std::thread producer([&]() { message = alloc.Create(MyMessage{ 1, 10.5 }); });
+    producer.join();
+
+    // Release the message in the consumer thread
+    std::thread consumer([&]()
+    {
+        std::cout << "message.id = " << message->id << ", message.price = " << message->price << std::endl;
+        alloc.Release(message);
+    });
+    consumer.join();
+
+    std::cout << "manager.allocations() = " << manager.allocations() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+    \file string_encoding_stream.cpp
+    \brief Streaming encoding example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/encoding_stream.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::string message = "Streaming Base64 encoding in constant memory";
+
+    // Encode the message by small chunks
+    CppCommon::BaseStreamEncoder encoder(64);
+    std::string encoded;
+    char buffer[64];
+    for (size_t i = 0; i < message.size(); i += 5)
+    {
+        size_t size = std::min<size_t>(5, message.size() - i);
+        encoded.append(buffer, encoder.Update(message.data() + i, size, buffer, sizeof(buffer)));
+    }
+    encoded.append(buffer, encoder.Finish(buffer, sizeof(buffer)));
+    std::cout << "Encoded: " << encoded << std::endl;
+
+    // Decode the encoded message by small chunks
+    CppCommon::BaseStreamDecoder decoder(64);
+    std::string decoded;
+    for (size_t i = 0; i < encoded.size(); i += 7)
+    {
+        size_t size = std::min<size_t>(7, encoded.size() - i);
+        decoded.append(buffer, decoder.Update(encoded.data() + i, size, buffer, sizeof(buffer)));
+    }
+    decoded.append(buffer, decoder.Finish(buffer, sizeof(buffer)));
+    std::cout << "Decoded: " << decoded << std::endl;
+
+    return 0;
+}
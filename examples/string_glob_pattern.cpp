@@ -0,0 +1,23 @@
+/*!
+    \file string_glob_pattern.cpp
+    \brief Compiled glob pattern example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/glob_pattern.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Compile the glob pattern once and match it many times
+    CppCommon::GlobPattern pattern("!*.tmp;*.txt;*.log");
+
+    const char* names[] = { "notes.txt", "error.log", "cache.tmp", "image.png" };
+    for (auto name : names)
+        std::cout << name << ": " << (pattern.Match(name) ? "matched" : "not matched") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+/*!
+    \file string_interner.cpp
+    \brief String interner example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/string_interner.h"
+
+#include <iostream>
+#include <unordered_map>
+
+int main(int argc, char** argv)
+{
+    CppCommon::StringInterner interner;
+
+    // Duplicate keys are stored only once and compared by identity
+    std::unordered_map<CppCommon::InternedString, int> volumes;
+    const char* trades[] = { "EURUSD", "GBPUSD", "EURUSD", "USDJPY", "EURUSD" };
+    for (auto symbol : trades)
+        volumes[interner.Intern(symbol)] += 100;
+
+    for (const auto& [symbol, volume] : volumes)
+        std::cout << symbol << " (id " << symbol.id() << "): " << volume << std::endl;
+
+    std::cout << "Interned strings: " << interner.size() << std::endl;
+    std::cout << "Interned memory: " << interner.memory() << " bytes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,40 @@
+/*!
+    \file string_multi_pattern.cpp
+    \brief Compiled multi-pattern substring matcher example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/multi_pattern.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::MultiPattern secrets({ "password=", "token=", "apikey=" }, true);
+
+    std::string lines[] =
+    {
+        "user login with Password=qwerty",
+        "request completed in 42 ms",
+        "call with token=abc and apikey=xyz"
+    };
+
+    for (auto& line : lines)
+    {
+        std::cout << "Line: " << line << std::endl;
+        if (!secrets.Contains(line))
+            continue;
+
+        // Report all matches
+        for (const auto& match : secrets.FindAll(line))
+            std::cout << "  found '" << secrets.patterns()[match.pattern] << "' at " << match.position << std::endl;
+
+        // Redact all matches
+        secrets.ReplaceAll(line, "<redacted>=");
+        std::cout << "  redacted: " << line << std::endl;
+    }
+
+    return 0;
+}
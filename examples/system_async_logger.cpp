@@ -0,0 +1,47 @@
+/*!
+    \file system_async_logger.cpp
+    \brief Asynchronous low-latency logger example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/file.h"
+#include "system/async_logger.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::AsyncLogger logger;
+
+    // Open the log file rotated every megabyte with two backups
+    logger.Open("example.log", 1048576, 2);
+
+    // Log records from several threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&logger, i]()
+        {
+            std::string name = "Worker " + std::to_string(i);
+            for (int j = 0; j < 5; ++j)
+                logger.Log("{}: order {} filled at {:.2f}", name, j, 100.0 + i + j / 100.0);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Write all logged records and close the log file
+    logger.Close();
+
+    std::cout << CppCommon::File::ReadAllText("example.log");
+    std::cout << "Records: " << logger.records() << std::endl;
+    std::cout << "Dropped: " << logger.dropped() << std::endl;
+
+    CppCommon::File::Remove("example.log");
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*!
+    \file system_console_buffer.cpp
+    \brief Console buffer example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/console.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ConsoleBuffer console;
+
+    console.ClearScreen().HideCursor();
+    console.Flush();
+
+    // Redraw the whole progress dashboard with the single write per frame
+    for (int progress = 0; progress <= 100; progress += 5)
+    {
+        console.MoveTo(0, 0);
+        for (int row = 0; row < 10; ++row)
+        {
+            int value = std::min(100, progress + row * 3);
+            console << CppCommon::Color::WHITE;
+            console.Print("Task {:>2} [", row);
+            console << ((value < 100) ? CppCommon::Color::YELLOW : CppCommon::Color::LIGHTGREEN);
+            console << std::string(value / 5, '#') << std::string(20 - value / 5, '.');
+            console << CppCommon::Color::WHITE;
+            console.Print("] {:>3}%", value);
+            console.ClearLine() << '\n';
+        }
+        console.Flush();
+
+        CppCommon::Thread::Sleep(100);
+    }
+
+    console.ResetColor().ShowCursor();
+    return 0;
+}
@@ -18,5 +18,7 @@ int main(int argc, char** argv)
     std::cout << "CPU physical cores: " << CppCommon::CPU::PhysicalCores() << std::endl;
     std::cout << "CPU clock speed: " << CppCommon::CPU::ClockSpeed() << " Hz" << std::endl;
     std::cout << "CPU Hyper-Threading: " << (CppCommon::CPU::HyperThreading() ? "enabled" : "disabled") << std::endl;
+    std::cout << "CPU features: " << CppCommon::CPU::Features() << std::endl;
+    std::cout << "CPU cache line: " << CppCommon::CPU::Features().cache_line << " bytes" << std::endl;
     return 0;
 }
@@ -0,0 +1,49 @@
+/*!
+    \file system_cpu_profiler.cpp
+    \brief Sampling CPU profiler example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "errors/exceptions_handler.h"
+#include "system/cpu_profiler.h"
+#include "system/stack_trace_manager.h"
+
+#include <cmath>
+#include <iostream>
+
+double Compute(int iterations)
+{
+    double result = 0.0;
+    for (int i = 1; i < iterations; ++i)
+        result += std::sqrt((double)i) / i;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    // Setup exceptions handler before the profiler, so the profiler owns SIGPROF signal
+    CppCommon::ExceptionsHandler::SetupProcess();
+    CppCommon::StackTraceManager::Initialize();
+
+    // Profile the computation with 100 Hz sampling frequency
+    CppCommon::CpuProfiler::Start(100);
+    double result = 0.0;
+    for (int i = 0; i < 10; ++i)
+        result += Compute(50000000);
+    CppCommon::CpuProfiler::Stop();
+
+    std::cout << "Result: " << result << std::endl;
+    std::cout << "Samples: " << CppCommon::CpuProfiler::samples() << std::endl;
+    std::cout << "Dropped: " << CppCommon::CpuProfiler::dropped() << std::endl;
+
+    // Folded stacks could be rendered with 'flamegraph.pl'
+    std::cout << CppCommon::CpuProfiler::Folded();
+
+    // Binary profile could be analyzed with 'pprof <program> example.prof'
+    CppCommon::CpuProfiler::SavePprof("example.prof");
+
+    CppCommon::StackTraceManager::Cleanup();
+    return 0;
+}
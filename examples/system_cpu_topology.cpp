@@ -0,0 +1,51 @@
+/*!
+    \file system_cpu_topology.cpp
+    \brief CPU topology example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/cpu_topology.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    const CppCommon::CPUTopology& topology = CppCommon::CPUTopology::Current();
+
+    std::cout << "Online CPUs: " << topology.online() << std::endl;
+
+    std::cout << "Sockets: " << topology.sockets().size() << std::endl;
+    for (size_t i = 0; i < topology.sockets().size(); ++i)
+        std::cout << "  socket " << i << ": " << topology.sockets()[i] << std::endl;
+
+    std::cout << "NUMA nodes: " << topology.nodes().size() << std::endl;
+    for (size_t i = 0; i < topology.nodes().size(); ++i)
+        std::cout << "  node " << i << ": " << topology.nodes()[i] << std::endl;
+
+    std::cout << "Physical cores: " << topology.cores().size() << std::endl;
+    for (size_t i = 0; i < topology.cores().size(); ++i)
+        std::cout << "  core " << i << ": " << topology.cores()[i] << std::endl;
+
+    std::cout << "Caches: " << topology.caches().size() << std::endl;
+    for (const auto& cache : topology.caches())
+    {
+        const char* type = (cache.type == CppCommon::CPUCacheType::Data) ? "data" : ((cache.type == CppCommon::CPUCacheType::Instruction) ? "instruction" : "unified");
+        std::cout << "  L" << cache.level << " " << type << " " << (cache.size / 1024) << " KiB, line " << cache.line_size << " bytes: " << cache.cpus << std::endl;
+    }
+
+    // Find CPUs sharing L2 cache to place the producer/consumer pair
+    for (const auto& domain : topology.CacheDomains(2))
+    {
+        if (domain.count() >= 2)
+        {
+            int producer = domain.first();
+            int consumer = domain.next(producer);
+            std::cout << "Producer/consumer pair sharing L2 cache: " << producer << ", " << consumer << std::endl;
+            break;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*!
+    \file system_flight_recorder.cpp
+    \brief Crash-safe flight recorder example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "errors/exceptions_handler.h"
+#include "system/flight_recorder.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+enum EventCode : uint32_t
+{
+    Started = 1,
+    Request = 2,
+    Finished = 3
+};
+
+int main(int argc, char** argv)
+{
+    // Setup exceptions handler and flight recorder, recent events will be dumped on crash
+    CppCommon::ExceptionsHandler::SetupProcess();
+    CppCommon::FlightRecorder::Setup("example_flight_recorder");
+
+    CppCommon::FlightRecorder::Record(Started, "Example started");
+
+    // Record events from several worker threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([i]()
+        {
+            for (uint64_t j = 0; j < 10; ++j)
+                CppCommon::FlightRecorder::Record(Request, "Worker request", i * 100 + j);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CppCommon::FlightRecorder::Record(Finished, "Example finished");
+
+    // Dump recent events just like the exceptions handler does on crash
+    CppCommon::FlightRecorder::Dump(std::cout);
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*!
+    \file system_perf_counters.cpp
+    \brief Hardware performance counters example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/perf_counters.h"
+
+#include <iostream>
+#include <vector>
+
+CppCommon::PerfProbe probe("Sum", 100);
+
+uint64_t Sum(const std::vector<uint64_t>& values)
+{
+    PERF_PROBE(probe);
+
+    uint64_t result = 0;
+    for (auto value : values)
+        result += value;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<uint64_t> values(100000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i;
+
+    CppCommon::PerfCounters counters;
+    if (!counters.available())
+        std::cout << "Hardware performance counters are not available!" << std::endl;
+
+    // Measure the scope with performance counters
+    CppCommon::PerfCounterValues result;
+    uint64_t sum = 0;
+    {
+        CppCommon::PerfScope scope(counters, result);
+        for (int i = 0; i < 1000; ++i)
+            sum += Sum(values);
+    }
+
+    std::cout << "Sum: " << sum << std::endl;
+    std::cout << "Cycles: " << result.cycles << std::endl;
+    std::cout << "Instructions: " << result.instructions << std::endl;
+    std::cout << "IPC: " << result.ipc() << std::endl;
+    std::cout << "L1D misses: " << result.l1d_misses << std::endl;
+    std::cout << "LLC misses: " << result.llc_misses << std::endl;
+    std::cout << "Branch misses: " << result.branch_misses << std::endl;
+    std::cout << "Context switches: " << result.context_switches << std::endl;
+
+    // Show the sampled performance probe
+    CppCommon::PerfCounterValues average = probe.average();
+    std::cout << "Probe '" << probe.name() << "' calls: " << probe.calls() << ", samples: " << probe.samples() << std::endl;
+    std::cout << "Probe '" << probe.name() << "' average cycles: " << average.cycles << ", instructions: " << average.instructions << std::endl;
+    return 0;
+}
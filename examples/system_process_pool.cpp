@@ -0,0 +1,38 @@
+/*!
+    \file system_process_pool.cpp
+    \brief Process pool example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/process_pool.h"
+#include "string/string_utils.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Worker process transforms jobs to the upper case
+    if ((argc > 1) && (std::string(argv[1]) == "--worker"))
+    {
+        CppCommon::ProcessPool::Serve([](std::string_view job) { return CppCommon::StringUtils::ToUpper(job); });
+        return 0;
+    }
+
+    // Prespawn worker processes
+    std::vector<std::string> arguments = { "--worker" };
+    CppCommon::ProcessPool pool(argv[0], &arguments, 4);
+    std::cout << "Process pool workers: " << pool.workers() << std::endl;
+
+    // Submit jobs
+    std::vector<std::future<std::string>> results;
+    for (const auto& job : { "first", "second", "third", "fourth", "fifth" })
+        results.emplace_back(pool.Submit(job));
+
+    // Wait for results
+    for (auto& result : results)
+        std::cout << "Result: " << result.get() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/*!
+    \file system_reactor.cpp
+    \brief Reactor example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/process.h"
+#include "system/reactor.h"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Reactor reactor;
+
+    // Execute child processes with output pipes
+    std::vector<std::unique_ptr<CppCommon::Pipe>> pipes;
+    std::vector<CppCommon::Process> children;
+    for (int i = 0; i < 4; ++i)
+    {
+        std::vector<std::string> arguments = { "Child process " + std::to_string(i) };
+        pipes.emplace_back(std::make_unique<CppCommon::Pipe>());
+        children.emplace_back(CppCommon::Process::Execute("echo", &arguments, nullptr, nullptr, nullptr, pipes.back().get(), nullptr));
+    }
+
+    // Multiplex child process outputs in the single thread
+    size_t running = pipes.size();
+    for (auto& pipe : pipes)
+    {
+        CppCommon::Pipe* output = pipe.get();
+        output->SetBlocking(false);
+        reactor.Add(output->reader(), CppCommon::ReactorEvents::READABLE, [&reactor, &running, output](CppCommon::Flags<CppCommon::ReactorEvents> events)
+        {
+            char buffer[1024];
+            size_t size;
+            while ((size = output->Read(buffer, sizeof(buffer))) > 0)
+                std::cout.write(buffer, size);
+            if (output->IsPipeEOF())
+            {
+                reactor.Remove(output->reader());
+                if (--running == 0)
+                    reactor.Stop();
+            }
+        });
+    }
+
+    // Run the reactor until all child processes close their outputs
+    reactor.Run();
+
+    for (auto& child : children)
+        child.Wait();
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+/*!
+    \file system_tracer.cpp
+    \brief In-process event tracer example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/tracer.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+void Work(int iterations)
+{
+    TRACE_SCOPE("Work");
+    for (int i = 0; i < iterations; ++i)
+    {
+        TRACE_SCOPE("Iteration");
+        TRACE_COUNTER("Iteration", i);
+        CppCommon::Thread::Sleep(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Start tracing into Chrome trace event JSON file
+    CppCommon::Tracer::Start("example.trace.json", CppCommon::TraceFormat::Chrome);
+    CppCommon::Tracer::SetThreadName("Main");
+
+    TRACE_INSTANT("Started");
+
+    // Trace several worker threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([i]()
+        {
+            CppCommon::Tracer::SetThreadName("Worker " + std::to_string(i));
+            Work(10);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    TRACE_INSTANT("Finished");
+
+    // Stop tracing and write all recorded events
+    CppCommon::Tracer::Stop();
+
+    std::cout << "Trace file: example.trace.json (open with chrome://tracing or https://ui.perfetto.dev)" << std::endl;
+    std::cout << "Dropped events: " << CppCommon::Tracer::dropped() << std::endl;
+    return 0;
+}
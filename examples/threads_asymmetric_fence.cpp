@@ -0,0 +1,41 @@
+/*!
+    \file threads_asymmetric_fence.cpp
+    \brief Asymmetric memory fence example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/asymmetric_fence.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Heavy fence is supported: " << (CppCommon::AsymmetricFence::Initialize() ? "true" : "false") << std::endl;
+
+    std::atomic<bool> reading(false);
+    std::atomic<bool> writing(false);
+
+    // Reader publishes its flag with the light fence on the fast path
+    std::thread reader([&]()
+    {
+        reading.store(true, std::memory_order_relaxed);
+        CppCommon::AsymmetricFence::Light();
+        if (!writing.load(std::memory_order_relaxed))
+            std::cout << "Reader enters before the writer" << std::endl;
+        reading.store(false, std::memory_order_release);
+    });
+
+    // Writer publishes its flag with the heavy fence on the slow path
+    writing.store(true, std::memory_order_relaxed);
+    CppCommon::AsymmetricFence::Heavy();
+    while (reading.load(std::memory_order_acquire))
+        std::this_thread::yield();
+    std::cout << "Writer has no active readers" << std::endl;
+
+    reader.join();
+    return 0;
+}
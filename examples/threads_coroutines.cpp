@@ -0,0 +1,59 @@
+/*!
+    \file threads_coroutines.cpp
+    \brief Coroutines with awaitable synchronization primitives example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_latch.h"
+#include "threads/async_queue.h"
+#include "threads/coroutine_scheduler.h"
+
+#include <iostream>
+#include <string>
+
+CppCommon::Task<void> Producer(CppCommon::AsyncQueue<std::string>& queue, int id)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        co_await CppCommon::SleepFor(CppCommon::Timespan::milliseconds(100 * (id + 1)));
+        co_await queue.Enqueue("Producer " + std::to_string(id) + " item " + std::to_string(i));
+    }
+}
+
+CppCommon::Task<void> Consumer(CppCommon::AsyncQueue<std::string>& queue, CppCommon::AsyncLatch& latch)
+{
+    std::string item;
+    while (co_await queue.Dequeue(item))
+        std::cout << item << std::endl;
+    latch.CountDown();
+}
+
+CppCommon::Task<void> Main(CppCommon::SingleThreadScheduler& scheduler)
+{
+    CppCommon::AsyncQueue<std::string> queue(2);
+    CppCommon::AsyncLatch latch(1);
+
+    // Spawn the consumer and wait for all producers
+    scheduler.Spawn(Consumer(queue, latch));
+    for (int i = 0; i < 3; ++i)
+        co_await Producer(queue, i);
+
+    // Close the queue and wait for the consumer
+    queue.Close();
+    co_await latch;
+
+    std::cout << "Done!" << std::endl;
+    scheduler.Stop();
+}
+
+int main(int argc, char** argv)
+{
+    // Run all coroutines in the main thread
+    CppCommon::SingleThreadScheduler scheduler;
+    scheduler.Spawn(Main(scheduler));
+    scheduler.Run();
+
+    return 0;
+}
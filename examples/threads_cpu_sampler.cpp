@@ -0,0 +1,46 @@
+/*!
+    \file threads_cpu_sampler.cpp
+    \brief Thread CPU time sampler example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/cpu_sampler.h"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::CpuSampler sampler;
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> workers;
+
+    // Busy and lazy worker threads
+    workers.emplace_back(CppCommon::Thread::Start([&stop]() { volatile uint64_t sum = 0; while (!stop) sum = sum + 1; }));
+    workers.emplace_back(CppCommon::Thread::Start([&stop]() { while (!stop) CppCommon::Thread::Sleep(1); }));
+    sampler.Register(workers[0], "busy");
+    sampler.Register(workers[1], "lazy");
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CppCommon::Thread::Sleep(100);
+
+        CppCommon::CpuSample sample = sampler.Sample();
+        std::cout << "Wall time: " << sample.wall.milliseconds() << " ms, process utilization: " << sample.utilization() << std::endl;
+        for (const auto& thread : sample.threads)
+            std::cout << "  " << thread.name << ": " << thread.cpu.milliseconds() << " ms (" << thread.utilization << ")" << std::endl;
+        std::cout << "  unattributed: " << sample.unattributed().milliseconds() << " ms" << std::endl;
+        std::cout << "  context switches: " << sample.process.voluntary_switches << " voluntary, " << sample.process.involuntary_switches << " involuntary" << std::endl;
+        std::cout << "  RSS: " << sample.process.rss << " bytes" << std::endl;
+    }
+
+    stop = true;
+    for (auto& worker : workers)
+        worker.join();
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+/*!
+    \file threads_flat_combiner.cpp
+    \brief Flat combining synchronization wrapper example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/flat_combiner.h"
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Order book price levels protected by the flat combiner
+    CppCommon::FlatCombiner<std::map<uint64_t, uint64_t>> book;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&book, thread]()
+        {
+            for (uint64_t i = 0; i < 100000; ++i)
+            {
+                uint64_t price = 100 + (i + thread) % 10;
+                book.Execute([price](std::map<uint64_t, uint64_t>& levels) { levels[price] += 10; });
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Get the best price level
+    auto best = book.Execute([](std::map<uint64_t, uint64_t>& levels) { return *levels.begin(); });
+    std::cout << "Best price level: " << best.first << " x " << best.second << std::endl;
+
+    std::cout << "Publication slots: " << book.slots() << std::endl;
+    std::cout << "Combined operations: " << book.operations() << std::endl;
+    std::cout << "Combining batches: " << book.batches() << std::endl;
+    return 0;
+}
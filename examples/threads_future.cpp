@@ -0,0 +1,45 @@
+/*!
+    \file threads_future.cpp
+    \brief Lightweight future and promise example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/future.h"
+#include "threads/thread_pool.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Create the work-stealing thread pool
+    CppCommon::ThreadPool pool(4);
+
+    // Start asynchronous operations which complete their promises
+    std::vector<CppCommon::Promise<int>> promises(4);
+    std::vector<CppCommon::Future<int>> futures;
+    for (auto& promise : promises)
+        futures.emplace_back(promise.GetFuture().Then(pool, [](int value) { return value * value; }));
+    for (int i = 0; i < (int)promises.size(); ++i)
+        pool.Post([&promises, i]() { promises[i].SetValue(i + 1); });
+
+    // Combine all results and continue with their sum
+    auto result = CppCommon::WhenAll(std::move(futures)).Then([](std::vector<int> values)
+    {
+        int sum = 0;
+        for (int value : values)
+            sum += value;
+        return "Sum of squares: " + std::to_string(sum);
+    });
+
+    // Wait for the result
+    std::cout << result.Get() << std::endl;
+
+    // Stop the thread pool
+    pool.Stop();
+
+    return 0;
+}
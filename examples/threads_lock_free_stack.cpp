@@ -0,0 +1,55 @@
+/*!
+    \file threads_lock_free_stack.cpp
+    \brief Lock-free intrusive stack example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/lock_free_stack.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Buffer
+{
+    std::atomic<Buffer*> next;
+    char data[256];
+};
+
+int main(int argc, char** argv)
+{
+    // Shared free-list of preallocated buffers
+    std::vector<Buffer> buffers(16);
+    CppCommon::LockFreeStack<Buffer> freelist;
+    for (auto& buffer : buffers)
+        freelist.Push(buffer);
+
+    // Start some threads which borrow and return buffers
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&freelist, thread]()
+        {
+            int borrowed = 0;
+            for (int i = 0; i < 100000; ++i)
+            {
+                Buffer* buffer = freelist.Pop();
+                if (buffer == nullptr)
+                    continue;
+                buffer->data[0] = (char)thread;
+                freelist.Push(*buffer);
+                ++borrowed;
+            }
+            std::cout << "Thread " << thread << " borrowed " << borrowed << " buffers" << std::endl;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+/*!
+    \file threads_lock_profiler.cpp
+    \brief Lock contention profiler example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/critical_section.h"
+#include "threads/lock_profiler.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::CriticalSection hot;
+    CppCommon::CriticalSection cold;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&hot, &cold]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                {
+                    // Hot lock is held for a long time
+                    PROFILED_LOCKER(hot);
+                    CppCommon::Thread::Sleep(1);
+                }
+                {
+                    // Cold lock is held for a short time
+                    PROFILED_LOCKER(cold);
+                }
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Show the most contended lock sites
+    std::cout << CppCommon::LockProfiler::report(2);
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*!
+    \file threads_low_latency_profile.cpp
+    \brief Low-latency thread profile example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/low_latency_profile.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Isolated CPUs: " << CppCommon::LowLatencyProfile::IsolatedCPUs() << std::endl;
+
+    std::thread thread = CppCommon::Thread::Start([]()
+    {
+        // Apply the low-latency profile to the latency critical thread
+        CppCommon::LowLatencyReport report = CppCommon::LowLatencyProfile::Apply();
+
+        std::cout << "Pinned: " << (report.pinned ? "yes" : "no") << " " << report.cpus << std::endl;
+        std::cout << "Real-time policy: " << (report.realtime ? "yes" : "no") << std::endl;
+        std::cout << "Memory locked: " << (report.memory_locked ? "yes" : "no") << std::endl;
+        std::cout << "Stack prefaulted: " << (report.stack_prefaulted ? "yes" : "no") << std::endl;
+        std::cout << "Malloc trimming disabled: " << (report.malloc_trim_disabled ? "yes" : "no") << std::endl;
+        std::cout << "Timer slack disabled: " << (report.timer_slack_disabled ? "yes" : "no") << std::endl;
+        for (const auto& failure : report.failures)
+            std::cout << "Failure: " << failure << std::endl;
+    });
+    thread.join();
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*!
+    \file threads_memory_reclamation.cpp
+    \brief Safe memory reclamation example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/memory_reclamation.h"
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Config
+{
+    int version;
+    std::string name;
+
+    Config(int v, const std::string& n) : version(v), name(n) {}
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager manager;
+    CppCommon::HazardPointers<> domain(manager);
+
+    std::atomic<Config*> config(domain.Create<Config>(0, "initial"));
+
+    // Start some reader threads
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> readers;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        readers.emplace_back([&domain, &config, &stop]()
+        {
+            uint64_t reads = 0;
+            while (!stop)
+            {
+                // Protect the current config from being freed while reading it
+                CppCommon::HazardPointers<>::Guard guard(domain);
+                Config* current = guard.Protect(0, config);
+                reads += current->name.size();
+            }
+            std::cout << "Reader finished with " << reads << " bytes read" << std::endl;
+        });
+    }
+
+    // Publish new config versions and retire old ones
+    for (int version = 1; version <= 1000; ++version)
+    {
+        Config* previous = config.exchange(domain.Create<Config>(version, "version " + std::to_string(version)));
+        domain.Retire(previous);
+    }
+
+    // Stop readers
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    std::cout << "Retired configs not yet freed: " << domain.retired() << std::endl;
+    domain.Retire(config.exchange(nullptr));
+    domain.Reclaim();
+    std::cout << "Retired configs after reclaim: " << domain.retired() << std::endl;
+
+    return 0;
+}
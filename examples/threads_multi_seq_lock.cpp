@@ -0,0 +1,59 @@
+/*!
+    \file threads_multi_seq_lock.cpp
+    \brief Multi-slot sequential lock synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/multi_seq_lock.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Data
+{
+    int a;
+    int b;
+    int c;
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::MultiSeqLock<Data> lock(Data{ 0, 0, 0 });
+
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&lock, thread]()
+        {
+            for (;;)
+            {
+                // Visit the current data version in place
+                bool stop = lock.Visit([](const Data& data) { return (data.a == 100) && (data.b == 200) && (data.c == 300); });
+                if (stop)
+                {
+                    std::cout << "Thread " << thread << " stopped!" << std::endl;
+                    return;
+                }
+            }
+        });
+    }
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop threads
+    lock = Data{ 100, 200, 300 };
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*!
+    \file threads_multicast_ring.cpp
+    \brief Multicast ring buffer with sequence barriers example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/multicast_ring.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Order
+{
+    int id;
+    double price;
+    bool approved;
+};
+
+int main(int argc, char** argv)
+{
+    const int orders = 10;
+
+    // Pipeline: decoder -> risk -> journal
+    typedef CppCommon::MulticastRing<Order, CppCommon::MulticastClaim::SINGLE, CppCommon::BlockingWaitStrategy> Ring;
+    Ring ring(8);
+    Ring::Consumer decoder(ring);
+    Ring::Consumer risk(ring, { &decoder });
+    Ring::Consumer journal(ring, { &risk });
+
+    std::vector<std::thread> threads;
+
+    // Decoder stage assigns order prices
+    threads.emplace_back([&decoder]()
+    {
+        for (int processed = 0; processed < orders;)
+            processed += (int)decoder.ProcessWait([](Order& order, int64_t sequence, bool end_of_batch) { order.price = 100.0 + order.id; });
+    });
+
+    // Risk stage approves orders which were decoded
+    threads.emplace_back([&risk]()
+    {
+        for (int processed = 0; processed < orders;)
+            processed += (int)risk.ProcessWait([](Order& order, int64_t sequence, bool end_of_batch) { order.approved = (order.price < 105.0); });
+    });
+
+    // Journal stage prints orders checked by the risk stage
+    threads.emplace_back([&journal]()
+    {
+        for (int processed = 0; processed < orders;)
+        {
+            processed += (int)journal.ProcessWait([](Order& order, int64_t sequence, bool end_of_batch)
+            {
+                std::cout << "Order " << order.id << ": price = " << order.price << ", approved = " << order.approved << (end_of_batch ? " (end of batch)" : "") << std::endl;
+            });
+        }
+    });
+
+    // Publish orders
+    for (int i = 0; i < orders; ++i)
+        ring.PublishEvent([i](Order& order, int64_t sequence) { order.id = i; order.price = 0.0; order.approved = false; });
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*!
+    \file threads_named_seq_lock.cpp
+    \brief Named sequential lock synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/named_seq_lock.h"
+
+#include <iostream>
+#include <string>
+
+struct Data
+{
+    int a;
+    int b;
+    int c;
+};
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter '+' to write or '?' to read the named sequential lock data (several processes support). Enter '0' to exit...";
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    // Create named sequential lock
+    CppCommon::NamedSeqLock<Data> lock("named_seq_lock_example");
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "+")
+        {
+            Data data = lock.Read();
+            lock.Write(Data{ data.a + 1, data.b + 2, data.c + 3 });
+            std::cout << "Successfully written data with sequence " << lock.sequence() << std::endl;
+        }
+        else if (line == "?")
+        {
+            Data data = lock.Read();
+            std::cout << "Read data: " << data.a << ", " << data.b << ", " << data.c << std::endl;
+        }
+        else if (line == "0")
+            break;
+        else
+            std::cout << help << std::endl;
+    }
+
+    return 0;
+}
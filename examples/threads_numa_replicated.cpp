@@ -0,0 +1,58 @@
+/*!
+    \file threads_numa_replicated.cpp
+    \brief NUMA-replicated read-mostly data example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/numa_replicated.h"
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::map<std::string, double> Prices;
+
+int main(int argc, char** argv)
+{
+    CppCommon::NumaReplicated<Prices> prices(Prices{ { "EURUSD", 1.10 }, { "GBPUSD", 1.25 } });
+    std::cout << "NUMA replicas: " << prices.replicas() << std::endl;
+
+    // Start some reader threads
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> readers;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        readers.emplace_back([&prices, &stop]()
+        {
+            uint64_t reads = 0;
+            while (!stop)
+            {
+                // Read the replica of the current NUMA node
+                auto guard = prices.Read();
+                if (guard->count("EURUSD") > 0)
+                    ++reads;
+            }
+            std::cout << "Reader finished with " << reads << " reads" << std::endl;
+        });
+    }
+
+    // Update prices in all replicas
+    for (int i = 0; i < 100; ++i)
+    {
+        prices.Update([i](Prices& value) { value["EURUSD"] = 1.10 + i / 10000.0; });
+        CppCommon::Thread::Sleep(1);
+    }
+
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    std::cout << "Published versions: " << prices.version() << std::endl;
+    std::cout << "EURUSD: " << prices.Load().at("EURUSD") << std::endl;
+    return 0;
+}
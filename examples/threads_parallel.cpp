@@ -0,0 +1,42 @@
+/*!
+    \file threads_parallel.cpp
+    \brief Parallel algorithms example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/parallel.h"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::ThreadPool pool;
+
+    // Generate random values in parallel
+    std::vector<uint64_t> values(10000000);
+    CppCommon::ParallelForRange(pool, (size_t)0, values.size(), [&values](size_t begin, size_t end)
+    {
+        std::mt19937_64 random(begin);
+        for (size_t i = begin; i < end; ++i)
+            values[i] = random() % 1000;
+    });
+
+    // Calculate the sum of values
+    uint64_t sum = CppCommon::ParallelReduce(pool, values.begin(), values.end(), (uint64_t)0);
+    std::cout << "Sum: " << sum << std::endl;
+
+    // Sort values
+    CppCommon::ParallelSort(pool, values.begin(), values.end());
+    std::cout << "Min: " << values.front() << ", max: " << values.back() << std::endl;
+
+    // Calculate prefix sums
+    std::vector<uint64_t> prefixes(values.size());
+    CppCommon::ParallelScan(pool, values.begin(), values.end(), prefixes.begin(), (uint64_t)0);
+    std::cout << "Last prefix sum: " << prefixes.back() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*!
+    \file threads_sharded_counter.cpp
+    \brief Per-CPU sharded counter and gauge example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/sharded_counter.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    CppCommon::ShardedCounter requests;
+    CppCommon::ShardedGauge active;
+
+    std::atomic<bool> stop(false);
+
+    // Start some workers threads
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 4; ++worker)
+    {
+        workers.emplace_back([&requests, &active, &stop]()
+        {
+            while (!stop)
+            {
+                // Process the request
+                ++active;
+                requests.Increment();
+                CppCommon::Thread::Yield();
+                --active;
+            }
+        });
+    }
+
+    // Start the monitor thread
+    std::thread monitor([&requests, &active, &stop]()
+    {
+        while (!stop)
+        {
+            std::cout << "Requests: " << requests.value() << ", active: " << active.value() << std::endl;
+            CppCommon::Thread::Sleep(1000);
+        }
+    });
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop the workers and the monitor
+    stop = true;
+
+    // Wait for all threads
+    for (auto& worker : workers)
+        worker.join();
+    monitor.join();
+
+    std::cout << "Total requests: " << requests.value() << std::endl;
+
+    return 0;
+}
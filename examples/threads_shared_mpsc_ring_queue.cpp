@@ -0,0 +1,53 @@
+/*!
+    \file threads_shared_mpsc_ring_queue.cpp
+    \brief Inter-process multiple producers / single consumer wait-free ring queue example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_mpsc_ring_queue.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Create or open the inter-process ring queue
+    CppCommon::SharedMPSCRingQueue<int> queue("shared_mpsc_ring_queue_example", 1024);
+
+    if (queue.owner())
+    {
+        // The first process is the consumer
+        std::cout << "SharedMPSCRingQueue created! Please start several other processes to enter some integer numbers..." << std::endl;
+
+        int item;
+        do
+        {
+            // Dequeue the item with blocking while the ring queue is empty
+            queue.DequeueWait(item);
+
+            // Consume the item
+            std::cout << "Received number: " << item << std::endl;
+        } while (item != 0);
+    }
+    else
+    {
+        // Other processes are producers
+        std::cout << "SharedMPSCRingQueue opened! Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+        std::string line;
+        while (getline(std::cin, line))
+        {
+            int item = std::stoi(line);
+
+            // Enqueue the item with blocking while the ring queue is full
+            queue.EnqueueWait(item);
+
+            if (item == 0)
+                break;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*!
+    \file threads_shared_spsc_ring_buffer.cpp
+    \brief Inter-process single producer / single consumer wait-free ring buffer example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Create or open the inter-process ring buffer
+    CppCommon::SharedSPSCRingBuffer buffer("shared_spsc_ring_buffer_example", 4096);
+
+    if (buffer.owner())
+    {
+        // The first process is the consumer
+        std::cout << "SharedSPSCRingBuffer created! Please start another process to enter some text..." << std::endl;
+
+        std::string text;
+        std::string line;
+        do
+        {
+            // Dequeue the data with blocking while the ring buffer is empty
+            char data[4096];
+            size_t size = sizeof(data);
+            buffer.DequeueWait(data, size);
+            text.append(data, size);
+
+            // Consume all received lines
+            size_t pos;
+            while ((line != "0") && ((pos = text.find('\n')) != std::string::npos))
+            {
+                line = text.substr(0, pos);
+                text.erase(0, pos + 1);
+                std::cout << "Received: " << line << std::endl;
+            }
+        } while (line != "0");
+    }
+    else
+    {
+        // Another process is the producer
+        std::cout << "SharedSPSCRingBuffer opened! Please enter some text. Enter '0' to exit..." << std::endl;
+
+        std::string line;
+        while (getline(std::cin, line))
+        {
+            // Enqueue the line with blocking while the ring buffer is full
+            std::string data = line.substr(0, buffer.capacity() - 1) + '\n';
+            buffer.EnqueueWait(data.data(), data.size());
+
+            if (line == "0")
+                break;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+    \file threads_task_graph.cpp
+    \brief Task graph executor example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/task_graph.h"
+
+#include <atomic>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Create the work-stealing thread pool
+    CppCommon::ThreadPool pool(4);
+
+    std::atomic<int> loaded(0);
+    std::atomic<int> processed(0);
+
+    // Nested subgraph processes loaded items in parallel
+    CppCommon::TaskGraph process;
+    for (int i = 0; i < 4; ++i)
+        process.Add([&processed]() { processed += 1; });
+
+    // Pipeline: load -> process -> report
+    CppCommon::TaskGraph pipeline;
+    size_t load = pipeline.Add([&loaded]() { loaded += 1; });
+    size_t nested = pipeline.Add(process);
+    size_t report = pipeline.Add([&loaded, &processed]() { std::cout << "Loaded: " << loaded << ", processed: " << processed << std::endl; });
+    pipeline.Precede(load, nested);
+    pipeline.Precede(nested, report);
+
+    // Run the same task graph several times
+    for (int i = 0; i < 3; ++i)
+        pipeline.Run(pool);
+
+    // Stop the thread pool
+    pool.Stop();
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*!
+    \file threads_thread_local.cpp
+    \brief Thread local storage object example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_local.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+class Statistics
+{
+public:
+    Statistics() : _retired(0), _requests([]() { return 0; }, [this](std::atomic<uint64_t>& value) { _retired += value; }) {}
+
+    // Increment the counter of the current thread without contention
+    void Request() { _requests->fetch_add(1, std::memory_order_relaxed); }
+
+    // Aggregate counters of all live and exited threads
+    uint64_t Total() const
+    {
+        uint64_t total = _retired;
+        _requests.for_each([&total](const std::atomic<uint64_t>& value) { total += value.load(std::memory_order_relaxed); });
+        return total;
+    }
+
+private:
+    std::atomic<uint64_t> _retired;
+    CppCommon::ThreadLocal<std::atomic<uint64_t>> _requests;
+};
+
+int main(int argc, char** argv)
+{
+    Statistics statistics;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&statistics]()
+        {
+            for (int i = 0; i < 1000000; ++i)
+                statistics.Request();
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "Total requests: " << statistics.Total() << std::endl;
+
+    return 0;
+}
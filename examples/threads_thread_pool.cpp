@@ -0,0 +1,40 @@
+/*!
+    \file threads_thread_pool.cpp
+    \brief Work-stealing thread pool example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Create the work-stealing thread pool with pinned worker threads
+    CppCommon::ThreadPool pool(4, 1024, true);
+
+    std::atomic<int> sum(0);
+
+    // Post tasks with nested fan-out
+    for (int i = 1; i <= 10; ++i)
+    {
+        pool.Post([&pool, &sum, i]()
+        {
+            for (int j = 0; j < i; ++j)
+                pool.Post([&sum]() { sum += 1; });
+        });
+    }
+
+    // Wait for all tasks are completed
+    pool.Wait();
+
+    std::cout << "Executed nested tasks: " << sum << std::endl;
+
+    // Stop the thread pool
+    pool.Stop();
+
+    return 0;
+}
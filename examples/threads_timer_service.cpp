@@ -0,0 +1,44 @@
+/*!
+    \file threads_timer_service.cpp
+    \brief Timer service example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_pool.h"
+#include "threads/timer_service.h"
+
+#include <atomic>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Create the thread pool to execute timer tasks
+    CppCommon::ThreadPool pool(2);
+
+    // Create the timer service which dispatches timer tasks into the thread pool
+    CppCommon::TimerService service([&pool](CppCommon::TimerService::Task task) { pool.Post(std::move(task)); });
+
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Schedule the periodic timer
+    std::atomic<int> ticks(0);
+    auto timer = service.ScheduleEvery(CppCommon::Timespan::seconds(1), [&ticks]() { std::cout << "Tick " << ++ticks << std::endl; });
+
+    // Schedule one-shot timers
+    service.ScheduleAfter(CppCommon::Timespan::milliseconds(1500), []() { std::cout << "One-shot timer after 1.5 seconds" << std::endl; });
+    service.ScheduleAt(CppCommon::UtcTimestamp() + CppCommon::Timespan::seconds(3), []() { std::cout << "One-shot timer at the given timestamp" << std::endl; });
+
+    // Wait for input
+    std::cin.get();
+
+    // Cancel the periodic timer and stop the timer service
+    service.Cancel(timer);
+    service.Stop();
+
+    // Stop the thread pool
+    pool.Stop();
+
+    return 0;
+}
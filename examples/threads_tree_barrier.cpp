@@ -0,0 +1,51 @@
+/*!
+    \file threads_tree_barrier.cpp
+    \brief Combining tree barrier synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread.h"
+#include "threads/tree_barrier.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Pin a thread to each online CPU
+    std::vector<int> cpus = CppCommon::CPUTopology::Current().online().cpus();
+    int concurrency = (int)cpus.size();
+
+    CppCommon::TreeBarrier barrier(cpus);
+    std::cout << "Tree barrier: " << barrier.threads() << " threads, " << barrier.tree().size() << " nodes, depth " << barrier.tree().depth() << std::endl;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&barrier, &cpus, thread]()
+        {
+            CppCommon::Thread::SetAffinity(CppCommon::CPUSet({ cpus[thread] }));
+
+            // Iterate simulation steps
+            for (int step = 0; step < 3; ++step)
+            {
+                // Sleep for a while...
+                CppCommon::Thread::SleepFor(CppCommon::Timespan::milliseconds(thread * 10));
+
+                // Wait for all other threads at the barrier
+                if (barrier.Wait(thread))
+                    std::cout << "Step " << step << " finished by thread " << thread << std::endl;
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
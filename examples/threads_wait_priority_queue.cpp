@@ -0,0 +1,51 @@
+/*!
+    \file threads_wait_priority_queue.cpp
+    \brief Multiple producers / multiple consumers wait priority queue example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/wait_priority_queue.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create multiple producers / multiple consumers wait priority queue
+    CppCommon::WaitPriorityQueue<int> queue;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+        if (item == 0)
+            break;
+
+        // Enqueue the item
+        queue.Enqueue(item);
+    }
+
+    // Close the wait priority queue
+    queue.Close();
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue]()
+    {
+        int item;
+
+        // Dequeue items in the priority order until the queue is empty
+        while (queue.Dequeue(item))
+            std::cout << "Your entered number: " << item << std::endl;
+    });
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+/*!
+    \file threads_wait_strategy.cpp
+    \brief Wait strategies for lock-free data structures example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/spsc_ring_queue.h"
+#include "threads/wait_strategy.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create single producer / single consumer wait-free ring queue with the blocking wait strategy
+    CppCommon::SPSCRingQueue<int, CppCommon::BlockingWaitStrategy> queue(1024);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue]()
+    {
+        int item;
+
+        do
+        {
+            // Dequeue with blocking in the kernel while the ring queue is empty
+            queue.DequeueWait(item);
+
+            // Consume the item
+            std::cout << "Your entered number: " << item << std::endl;
+        } while (item != 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Enqueue with blocking in the kernel while the ring queue is full
+        queue.EnqueueWait(item);
+
+        if (item == 0)
+            break;
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
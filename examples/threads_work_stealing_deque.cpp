@@ -0,0 +1,58 @@
+/*!
+    \file threads_work_stealing_deque.cpp
+    \brief Single owner / multiple thieves lock-free work-stealing deque example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/work_stealing_deque.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    // Create single owner / multiple thieves lock-free work-stealing deque
+    CppCommon::WorkStealingDeque<int> deque(16);
+
+    std::atomic<bool> done(false);
+    std::atomic<int> stolen(0);
+
+    // Start thief thread
+    auto thief = std::thread([&deque, &done, &stolen]()
+    {
+        int item;
+        while (!done || !deque.empty())
+        {
+            // Steal items from the top of the deque using yield waiting strategy
+            if (deque.Steal(item))
+                ++stolen;
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    // Owner pushes items and pops them back in LIFO order
+    int popped = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        deque.Push(i);
+        int item;
+        if (((i % 2) == 0) && deque.Pop(item))
+            ++popped;
+    }
+    int item;
+    while (deque.Pop(item))
+        ++popped;
+    done = true;
+
+    // Wait for the thief thread
+    thief.join();
+
+    std::cout << "Popped items: " << popped << std::endl;
+    std::cout << "Stolen items: " << stolen << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+/*!
+    \file time_time_format.cpp
+    \brief Time format utilities example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/time_format.h"
+#include "time/timezone.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    CppCommon::UtcTimestamp timestamp;
+
+    std::cout << "ISO-8601 UTC: " << CppCommon::TimeFormat::FormatISO8601(timestamp) << std::endl;
+    std::cout << "ISO-8601 UTC (milliseconds): " << CppCommon::TimeFormat::FormatISO8601(timestamp, 3) << std::endl;
+    std::cout << "ISO-8601 local: " << CppCommon::TimeFormat::FormatISO8601(timestamp, CppCommon::Timezone::local().total(), 6) << std::endl;
+
+    // Format into the caller buffer without allocation
+    char buffer[CppCommon::TimeFormat::ISO8601_SIZE];
+    size_t size = CppCommon::TimeFormat::FormatISO8601(timestamp, buffer, sizeof(buffer), 0);
+    std::cout << "ISO-8601 UTC (seconds): " << std::string(buffer, size) << std::endl;
+
+    CppCommon::Timestamp parsed;
+    if (CppCommon::TimeFormat::ParseISO8601("2021-10-01T18:19:56.123456789+05:45", parsed))
+        std::cout << "Parsed timestamp: " << parsed.total() << " = " << CppCommon::TimeFormat::FormatISO8601(parsed) << std::endl;
+
+    return 0;
+}
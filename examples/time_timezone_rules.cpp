@@ -0,0 +1,47 @@
+/*!
+    \file time_timezone_rules.cpp
+    \brief Timezone rules example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/timezone_rules.h"
+
+#include <iostream>
+
+void show(const std::string& name, const CppCommon::UtcTime& utctime)
+{
+    auto rules = CppCommon::TimezoneRules::Find(name);
+    if (rules == nullptr)
+    {
+        std::cout << "Timezone '" << name << "' is not found!" << std::endl << std::endl;
+        return;
+    }
+
+    CppCommon::Timezone timezone = rules->At(utctime.utcstamp());
+    CppCommon::LocalTime localtime = rules->Convert(utctime);
+    std::cout << "TimezoneRules.name() = " << rules->name() << std::endl;
+    std::cout << "TimezoneRules.transitions() = " << rules->transitions() << std::endl;
+    std::cout << "TimezoneRules.rule() = " << rules->rule() << std::endl;
+    std::cout << "Timezone.name() = " << timezone.name() << std::endl;
+    std::cout << "Timezone.offset() = " << timezone.offset().seconds() << std::endl;
+    std::cout << "Timezone.daylight() = " << timezone.daylight().seconds() << std::endl;
+    std::cout << "Local time = " << localtime.year() << "-" << localtime.month() << "-" << localtime.day() << " "
+              << localtime.hour() << ":" << localtime.minute() << ":" << localtime.second() << std::endl;
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    CppCommon::UtcTime utctime;
+
+    std::cout << "Time zone database: " << CppCommon::TimezoneRules::database() << std::endl << std::endl;
+
+    show("UTC", utctime);
+    show("Europe/London", utctime);
+    show("America/New_York", utctime);
+    show("Asia/Kathmandu", utctime);
+
+    return 0;
+}
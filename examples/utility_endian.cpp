@@ -0,0 +1,38 @@
+/*!
+    \file utility_endian.cpp
+    \brief Big/Little-endian utilities example
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "utility/endian.h"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    using CppCommon::Endian;
+
+    std::cout << "Big-endian system: " << (Endian::IsBigEndian() ? "true" : "false") << std::endl;
+    std::cout << "Little-endian system: " << (Endian::IsLittleEndian() ? "true" : "false") << std::endl;
+
+    // Network packet with big-endian fields
+    uint8_t packet[12];
+    Endian::StoreBigEndian(packet, (uint32_t)0xDEADBEEF);
+    Endian::StoreBigEndian(packet + 4, (uint64_t)0x0123456789ABCDEFull);
+    std::cout << std::hex << "Field 1: 0x" << Endian::LoadBigEndian<uint32_t>(packet) << std::endl;
+    std::cout << std::hex << "Field 2: 0x" << Endian::LoadBigEndian<uint64_t>(packet + 4) << std::endl;
+
+    // Batch conversion of the array of big-endian fields
+    std::vector<uint16_t> fields(6);
+    Endian::ReadBigEndian(packet, std::span<uint16_t>(fields));
+    std::cout << "Fields:";
+    for (auto field : fields)
+        std::cout << " 0x" << std::setw(4) << std::setfill('0') << field;
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*!
+    \file bloom_filter.h
+    \brief Blocked Bloom filter definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_BLOOM_FILTER_H
+#define CPPCOMMON_ALGORITHMS_BLOOM_FILTER_H
+
+#include "algorithms/hash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Bloom filter block of 256 bits (eight 32-bit words)
+struct alignas(32) BloomBlock
+{
+    std::atomic<uint32_t> words[8];
+
+    BloomBlock() noexcept { for (auto& word : words) word.store(0, std::memory_order_relaxed); }
+};
+
+static_assert((sizeof(BloomBlock) == 32), "Bloom filter block must be 256 bits!");
+
+// Set the hash bits in the blocks
+void BloomInsert(BloomBlock* blocks, size_t count, uint64_t hash) noexcept;
+// Check the hash bits in the blocks
+bool BloomContains(const BloomBlock* blocks, size_t count, uint64_t hash) noexcept;
+// Check the hash bits in the blocks for many hashes and return the count of positive results
+size_t BloomContainsMany(const BloomBlock* blocks, size_t count, const uint64_t* hashes, size_t size, bool* results) noexcept;
+
+} // namespace Internals
+//! @endcond
+
+//! Blocked Bloom filter
+/*!
+    Bloom filter is a space-efficient probabilistic set. It answers whether
+    the key is definitely not in the set or may be in the set with the given
+    false positive probability. Keys cannot be removed from the Bloom filter
+    (use CuckooFilter if deletion is required).
+
+    Blocked (split block) Bloom filter sets eight bits of each key in a single
+    256-bit block, one bit in every 32-bit word of the block. Insert and probe
+    operations touch a single cache line and batched probe checks the whole
+    block with a couple of SIMD instructions (AVX2 if available).
+
+    Insert operation uses atomic bitwise or, so inserts and probes might be
+    performed concurrently without locks.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Bloom_filter
+*/
+template <typename T, typename THash = FastHasher<T>>
+class BloomFilter
+{
+public:
+    //! Initialize the Bloom filter
+    /*!
+        \param capacity - Expected count of keys
+        \param probability - False positive probability at the expected count of keys (default is 0.01)
+        \param hash - Key hasher (default is THash())
+    */
+    explicit BloomFilter(size_t capacity, double probability = 0.01, const THash& hash = THash());
+    BloomFilter(const BloomFilter&) = delete;
+    BloomFilter(BloomFilter&&) = delete;
+    ~BloomFilter() = default;
+
+    BloomFilter& operator=(const BloomFilter&) = delete;
+    BloomFilter& operator=(BloomFilter&&) = delete;
+
+    //! Get the count of 256-bit blocks
+    size_t blocks() const noexcept { return _blocks.size(); }
+    //! Get the Bloom filter memory size in bytes
+    size_t bytes() const noexcept { return _blocks.size() * sizeof(Internals::BloomBlock); }
+
+    //! Insert the given key
+    void Insert(const T& key) noexcept { InsertHash((uint64_t)_hash(key)); }
+    //! Insert the given key hash
+    void InsertHash(uint64_t hash) noexcept { Internals::BloomInsert(_blocks.data(), _blocks.size(), hash); }
+
+    //! Check if the given key may be in the Bloom filter
+    /*!
+        \param key - Key to check
+        \return 'false' if the key is definitely not in the Bloom filter, 'true' if the key may be in the Bloom filter
+    */
+    bool Contains(const T& key) const noexcept { return ContainsHash((uint64_t)_hash(key)); }
+    //! Check if the given key hash may be in the Bloom filter
+    bool ContainsHash(uint64_t hash) const noexcept { return Internals::BloomContains(_blocks.data(), _blocks.size(), hash); }
+    //! Check if the given key hashes may be in the Bloom filter
+    /*!
+        \param hashes - Key hashes to check
+        \param results - Results array (must be not less than hashes)
+        \return Count of positive results
+    */
+    size_t ContainsHashes(std::span<const uint64_t> hashes, std::span<bool> results) const noexcept;
+
+    //! Merge the given Bloom filter of the same size into the current one
+    void Merge(const BloomFilter& filter) noexcept;
+    //! Clear the Bloom filter
+    void Clear() noexcept;
+
+private:
+    THash _hash;
+    std::vector<Internals::BloomBlock> _blocks;
+};
+
+/*! \example algorithms_bloom_filter.cpp Blocked Bloom filter example */
+
+} // namespace CppCommon
+
+#include "bloom_filter.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_BLOOM_FILTER_H
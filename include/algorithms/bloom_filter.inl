@@ -0,0 +1,52 @@
+/*!
+    \file bloom_filter.inl
+    \brief Blocked Bloom filter inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename THash>
+inline BloomFilter<T, THash>::BloomFilter(size_t capacity, double probability, const THash& hash)
+    : _hash(hash)
+{
+    assert(((probability > 0.0) && (probability < 1.0)) && "Bloom filter false positive probability must be in range (0, 1)!");
+
+    // Count of bits for eight bits per key split into eight words of the block
+    double bits = -8.0 * (double)std::max(capacity, (size_t)1) / std::log(1.0 - std::pow(probability, 1.0 / 8.0));
+    size_t blocks = std::max((size_t)std::ceil(bits / 256.0), (size_t)1);
+    assert((blocks <= 0xFFFFFFFF) && "Bloom filter is too large!");
+
+    _blocks = std::vector<Internals::BloomBlock>(blocks);
+}
+
+template <typename T, typename THash>
+inline size_t BloomFilter<T, THash>::ContainsHashes(std::span<const uint64_t> hashes, std::span<bool> results) const noexcept
+{
+    assert((results.size() >= hashes.size()) && "Bloom filter results array is too small!");
+
+    return Internals::BloomContainsMany(_blocks.data(), _blocks.size(), hashes.data(), hashes.size(), results.data());
+}
+
+template <typename T, typename THash>
+inline void BloomFilter<T, THash>::Merge(const BloomFilter& filter) noexcept
+{
+    assert((_blocks.size() == filter._blocks.size()) && "Bloom filters must have the same size to merge!");
+
+    size_t count = std::min(_blocks.size(), filter._blocks.size());
+    for (size_t i = 0; i < count; ++i)
+        for (size_t j = 0; j < 8; ++j)
+            _blocks[i].words[j].fetch_or(filter._blocks[i].words[j].load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+template <typename T, typename THash>
+inline void BloomFilter<T, THash>::Clear() noexcept
+{
+    for (auto& block : _blocks)
+        for (auto& word : block.words)
+            word.store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,124 @@
+/*!
+    \file concurrency_limiter.h
+    \brief Adaptive concurrency limiter definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_CONCURRENCY_LIMITER_H
+#define CPPCOMMON_ALGORITHMS_CONCURRENCY_LIMITER_H
+
+#include "algorithms/token_bucket.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+namespace CppCommon {
+
+//! Adaptive concurrency limiter algorithm
+enum class ConcurrencyLimiterAlgorithm
+{
+    AIMD,                   //!< Additive increase / multiplicative decrease on latency threshold or drop
+    Gradient                //!< Limit follows the gradient between the minimal and the measured latency
+};
+
+//! Adaptive concurrency limiter
+/*!
+    Adaptive concurrency limiter sheds load before queues grow. It limits the
+    count of requests in flight and adjusts the limit with measured request
+    latency:
+    \li AIMD - limit is increased by one per limit of successful requests with
+        latency under the threshold, and is multiplied by the backoff ratio when
+        request latency exceeds the threshold or the request is dropped;
+    \li Gradient - limit is scaled by the ratio of the minimal observed latency
+        to the measured latency (clamped in range [0.5, 1]) and then increased by
+        the square root of the limit as an allowed queue size. Latency threshold
+        is used as a latency tolerance: latency below it never decreases the limit.
+
+    Acquire and release operations are lock-free. Limit is never increased by
+    requests while the limiter is not saturated (in flight count is less than
+    half of the limit), so idle periods do not inflate it.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Additive_increase/multiplicative_decrease
+*/
+class ConcurrencyLimiter
+{
+public:
+    //! Initialize the adaptive concurrency limiter
+    /*!
+        \param initial - Initial concurrency limit
+        \param minimal - Minimal concurrency limit
+        \param maximal - Maximal concurrency limit
+        \param threshold - Latency threshold (default is 100 milliseconds)
+        \param algorithm - Limiter algorithm (default is ConcurrencyLimiterAlgorithm::AIMD)
+        \param clock - Limiter clock (default is TokenBucketClock::TSC)
+    */
+    ConcurrencyLimiter(uint64_t initial, uint64_t minimal, uint64_t maximal, const Timespan& threshold = Timespan::milliseconds(100), ConcurrencyLimiterAlgorithm algorithm = ConcurrencyLimiterAlgorithm::AIMD, TokenBucketClock clock = TokenBucketClock::TSC);
+    ConcurrencyLimiter(const ConcurrencyLimiter&) = delete;
+    ConcurrencyLimiter(ConcurrencyLimiter&&) = delete;
+    ~ConcurrencyLimiter() = default;
+
+    ConcurrencyLimiter& operator=(const ConcurrencyLimiter&) = delete;
+    ConcurrencyLimiter& operator=(ConcurrencyLimiter&&) = delete;
+
+    //! Get the current concurrency limit
+    uint64_t limit() const noexcept { return (uint64_t)_limit.load(std::memory_order_relaxed); }
+    //! Get the count of requests in flight
+    uint64_t inflight() const noexcept { return _inflight.load(std::memory_order_relaxed); }
+    //! Get the minimal observed latency
+    Timespan latency() const noexcept { return Timespan((int64_t)_min_latency.load(std::memory_order_relaxed)); }
+
+    //! Get the limiter algorithm
+    ConcurrencyLimiterAlgorithm algorithm() const noexcept { return _algorithm; }
+    //! Get the limiter clock
+    TokenBucketClock clock() const noexcept { return _clock; }
+    //! Get the current time of the limiter clock
+    uint64_t now() const { return Internals::TokenBucketNow(_clock); }
+
+    //! Try to acquire the request slot
+    /*!
+        \return 'true' if the request slot was acquired, 'false' if the request should be shed
+    */
+    bool TryAcquire() noexcept;
+
+    //! Release the request slot acquired with TryAcquire()
+    /*!
+        \param latency - Measured request latency
+        \param dropped - Request was dropped, timed out or failed because of overload (default is false)
+    */
+    void Release(const Timespan& latency, bool dropped = false) noexcept;
+    //! Release the request slot acquired with TryAcquire() at the given start time of the limiter clock
+    /*!
+        \param start - Request start time of the limiter clock (see now())
+        \param dropped - Request was dropped, timed out or failed because of overload (default is false)
+    */
+    void Release(uint64_t start, bool dropped = false) { uint64_t time = now(); Release(Timespan((int64_t)((time > start) ? (time - start) : 0)), dropped); }
+
+private:
+    std::atomic<uint64_t> _inflight;
+    std::atomic<double> _limit;
+    std::atomic<uint64_t> _min_latency;
+    double _minimal;
+    double _maximal;
+    uint64_t _threshold;
+    ConcurrencyLimiterAlgorithm _algorithm;
+    TokenBucketClock _clock;
+
+    // Update the limit with the given function
+    template <typename TUpdate>
+    void Update(TUpdate&& update) noexcept;
+};
+
+/*! \example algorithms_concurrency_limiter.cpp Adaptive concurrency limiter example */
+
+} // namespace CppCommon
+
+#include "concurrency_limiter.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_CONCURRENCY_LIMITER_H
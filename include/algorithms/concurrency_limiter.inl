@@ -0,0 +1,53 @@
+/*!
+    \file concurrency_limiter.inl
+    \brief Adaptive concurrency limiter inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline ConcurrencyLimiter::ConcurrencyLimiter(uint64_t initial, uint64_t minimal, uint64_t maximal, const Timespan& threshold, ConcurrencyLimiterAlgorithm algorithm, TokenBucketClock clock)
+    : _inflight(0),
+      _limit((double)initial),
+      _min_latency(std::numeric_limits<uint64_t>::max()),
+      _minimal((double)minimal),
+      _maximal((double)maximal),
+      _threshold((uint64_t)threshold.total()),
+      _algorithm(algorithm),
+      _clock(clock)
+{
+    assert(((minimal > 0) && (minimal <= initial) && (initial <= maximal)) && "Concurrency limits must be ordered as 0 < minimal <= initial <= maximal!");
+}
+
+inline bool ConcurrencyLimiter::TryAcquire() noexcept
+{
+    uint64_t inflight = _inflight.load(std::memory_order_relaxed);
+
+    // Lock-free acquire loop
+    for (;;)
+    {
+        // Concurrency limit is reached... Shed the request.
+        if (inflight >= (uint64_t)_limit.load(std::memory_order_relaxed))
+            return false;
+
+        if (_inflight.compare_exchange_weak(inflight, inflight + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    }
+}
+
+template <typename TUpdate>
+inline void ConcurrencyLimiter::Update(TUpdate&& update) noexcept
+{
+    double limit = _limit.load(std::memory_order_relaxed);
+    double result;
+    do
+    {
+        result = std::clamp(update(limit), _minimal, _maximal);
+        if (result == limit)
+            return;
+    } while (!_limit.compare_exchange_weak(limit, result, std::memory_order_relaxed, std::memory_order_relaxed));
+}
+
+} // namespace CppCommon
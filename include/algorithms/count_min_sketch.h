@@ -0,0 +1,108 @@
+/*!
+    \file count_min_sketch.h
+    \brief Count-Min sketch frequency estimator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_COUNT_MIN_SKETCH_H
+#define CPPCOMMON_ALGORITHMS_COUNT_MIN_SKETCH_H
+
+#include "algorithms/hash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Count-Min sketch frequency estimator
+/*!
+    Count-Min sketch estimates key frequencies with the fixed amount of
+    memory: depth rows of width counters. Estimated frequency is never less
+    than the actual one and exceeds it by more than e / width * total count
+    with the probability of e^-depth.
+
+    Counters are updated with atomic additions, so keys might be added
+    concurrently without locks. Sketches with the same dimensions could be
+    merged by adding their counters.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Count%E2%80%93min_sketch
+*/
+template <typename T, typename THash = FastHasher<T>>
+class CountMinSketch
+{
+public:
+    //! Initialize the Count-Min sketch with the given dimensions
+    /*!
+        \param width - Count of counters in each row
+        \param depth - Count of rows (default is 4)
+        \param hash - Key hasher (default is THash())
+    */
+    explicit CountMinSketch(size_t width, size_t depth = 4, const THash& hash = THash());
+    CountMinSketch(const CountMinSketch&) = delete;
+    CountMinSketch(CountMinSketch&&) = delete;
+    ~CountMinSketch() = default;
+
+    CountMinSketch& operator=(const CountMinSketch&) = delete;
+    CountMinSketch& operator=(CountMinSketch&&) = delete;
+
+    //! Create the Count-Min sketch with the given error bounds
+    /*!
+        \param epsilon - Relative error of the estimation to the total count
+        \param delta - Probability to exceed the relative error
+        \return Count-Min sketch dimensions (width and depth)
+    */
+    static std::pair<size_t, size_t> Dimensions(double epsilon, double delta);
+
+    //! Get the count of counters in each row
+    size_t width() const noexcept { return _width; }
+    //! Get the count of rows
+    size_t depth() const noexcept { return _depth; }
+    //! Get the total count of all added keys
+    uint64_t total() const noexcept { return _total.load(std::memory_order_relaxed); }
+
+    //! Add the given count of the key
+    void Add(const T& key, uint32_t count = 1) noexcept { AddHash((uint64_t)_hash(key), count); }
+    //! Add the given count of the key hash
+    void AddHash(uint64_t hash, uint32_t count = 1) noexcept;
+
+    //! Estimate the frequency of the key
+    uint64_t Estimate(const T& key) const noexcept { return EstimateHash((uint64_t)_hash(key)); }
+    //! Estimate the frequency of the key hash
+    uint64_t EstimateHash(uint64_t hash) const noexcept;
+
+    //! Merge the given sketch with the same dimensions into the current one
+    void Merge(const CountMinSketch& sketch) noexcept;
+    //! Clear the sketch
+    void Clear() noexcept;
+
+private:
+    THash _hash;
+    size_t _width;
+    size_t _depth;
+    std::vector<std::atomic<uint32_t>> _counters;
+    std::atomic<uint64_t> _total;
+
+    // Add the given count to the counter with saturation
+    static void Increment(std::atomic<uint32_t>& counter, uint32_t count) noexcept;
+    // Get the counter index of the given row
+    size_t Index(uint64_t hash1, uint64_t hash2, size_t row) const noexcept
+    { uint64_t upper; Internals::Multiply64(hash1 + row * hash2, _width, upper); return row * _width + (size_t)upper; }
+};
+
+/*! \example algorithms_count_min_sketch.cpp Count-Min sketch frequency estimator example */
+
+} // namespace CppCommon
+
+#include "count_min_sketch.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_COUNT_MIN_SKETCH_H
@@ -0,0 +1,84 @@
+/*!
+    \file count_min_sketch.inl
+    \brief Count-Min sketch frequency estimator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename THash>
+inline CountMinSketch<T, THash>::CountMinSketch(size_t width, size_t depth, const THash& hash)
+    : _hash(hash), _width(width), _depth(depth), _counters(width * depth), _total(0)
+{
+    assert(((width > 0) && (depth > 0)) && "Count-Min sketch dimensions must be positive!");
+
+    Clear();
+}
+
+template <typename T, typename THash>
+inline std::pair<size_t, size_t> CountMinSketch<T, THash>::Dimensions(double epsilon, double delta)
+{
+    assert(((epsilon > 0.0) && (delta > 0.0) && (delta < 1.0)) && "Count-Min sketch error bounds are invalid!");
+
+    size_t width = (size_t)std::ceil(std::exp(1.0) / epsilon);
+    size_t depth = (size_t)std::ceil(std::log(1.0 / delta));
+    return std::make_pair(std::max(width, (size_t)1), std::max(depth, (size_t)1));
+}
+
+template <typename T, typename THash>
+inline void CountMinSketch<T, THash>::Increment(std::atomic<uint32_t>& counter, uint32_t count) noexcept
+{
+    // Saturate the counter instead of the overflow
+    uint32_t value = counter.load(std::memory_order_relaxed);
+    uint32_t result;
+    do
+    {
+        result = (value > (std::numeric_limits<uint32_t>::max() - count)) ? std::numeric_limits<uint32_t>::max() : (value + count);
+    } while ((result != value) && !counter.compare_exchange_weak(value, result, std::memory_order_relaxed, std::memory_order_relaxed));
+}
+
+template <typename T, typename THash>
+inline void CountMinSketch<T, THash>::AddHash(uint64_t hash, uint32_t count) noexcept
+{
+    // Double hashing gives independent row indexes
+    uint64_t hash2 = FastHash::Mix64(hash) | 1;
+    for (size_t row = 0; row < _depth; ++row)
+    {
+        Increment(_counters[Index(hash, hash2, row)], count);
+    }
+    _total.fetch_add(count, std::memory_order_relaxed);
+}
+
+template <typename T, typename THash>
+inline uint64_t CountMinSketch<T, THash>::EstimateHash(uint64_t hash) const noexcept
+{
+    uint64_t hash2 = FastHash::Mix64(hash) | 1;
+    uint32_t result = std::numeric_limits<uint32_t>::max();
+    for (size_t row = 0; row < _depth; ++row)
+        result = std::min(result, _counters[Index(hash, hash2, row)].load(std::memory_order_relaxed));
+    return result;
+}
+
+template <typename T, typename THash>
+inline void CountMinSketch<T, THash>::Merge(const CountMinSketch& sketch) noexcept
+{
+    assert(((_width == sketch._width) && (_depth == sketch._depth)) && "Count-Min sketches must have the same dimensions to merge!");
+    if ((_width != sketch._width) || (_depth != sketch._depth))
+        return;
+
+    for (size_t i = 0; i < _counters.size(); ++i)
+        Increment(_counters[i], sketch._counters[i].load(std::memory_order_relaxed));
+    _total.fetch_add(sketch.total(), std::memory_order_relaxed);
+}
+
+template <typename T, typename THash>
+inline void CountMinSketch<T, THash>::Clear() noexcept
+{
+    for (auto& counter : _counters)
+        counter.store(0, std::memory_order_relaxed);
+    _total.store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,56 @@
+/*!
+    \file crc32c.h
+    \brief CRC32C checksum algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_CRC32C_H
+#define CPPCOMMON_ALGORITHMS_CRC32C_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! CRC32C checksum algorithm
+/*!
+    CRC32C (Castagnoli polynomial 0x1EDC6F41) is the checksum of iSCSI, ext4,
+    Btrfs and many storage formats, because it is computed by the hardware
+    instructions of modern CPUs. Implementation is selected at runtime:
+    \li x86: SSE4.2 CRC32 instruction;
+    \li ARM: ARMv8 CRC32 instructions (if enabled by the compiler);
+    \li Other CPUs: table-driven slicing-by-8 algorithm.
+
+    Checksums of consecutive buffers could be chained:
+    Compute(b, Compute(a)) == Compute(a + b).
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Cyclic_redundancy_check
+*/
+class CRC32C
+{
+public:
+    CRC32C() = delete;
+    CRC32C(const CRC32C&) = delete;
+    CRC32C(CRC32C&&) = delete;
+    ~CRC32C() = delete;
+
+    CRC32C& operator=(const CRC32C&) = delete;
+    CRC32C& operator=(CRC32C&&) = delete;
+
+    //! Compute CRC32C checksum of the given buffer
+    /*!
+        \param buffer - Buffer to checksum
+        \param size - Buffer size
+        \param crc - Checksum of previous buffers to continue (default is 0)
+        \return CRC32C checksum
+    */
+    static uint32_t Compute(const void* buffer, size_t size, uint32_t crc = 0) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_CRC32C_H
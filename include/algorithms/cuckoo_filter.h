@@ -0,0 +1,128 @@
+/*!
+    \file cuckoo_filter.h
+    \brief Cuckoo filter definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_CUCKOO_FILTER_H
+#define CPPCOMMON_ALGORITHMS_CUCKOO_FILTER_H
+
+#include "algorithms/hash.h"
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Cuckoo filter
+/*!
+    Cuckoo filter is a space-efficient probabilistic set which supports key
+    deletion. It keeps 16-bit fingerprints of keys in a cuckoo hash table of
+    buckets with four slots, so each key might be found in one of two buckets.
+    False positive probability is about 8 / 65536 (0.012%) at 95% load.
+
+    Each bucket is a single 64-bit atomic word, so Contains() is lock-free and
+    checks both buckets with a couple of SWAR operations. Insert() and Erase()
+    are serialized with a spin lock. Insert() searches the whole cuckoo path
+    before moving fingerprints and moves them from the end of the path, so
+    concurrent lookups never miss the inserted keys and failed insert (the
+    filter is full) leaves the filter unchanged.
+
+    Erase() must be called only for keys which were inserted before, otherwise
+    another key with the same fingerprint could be erased.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Cuckoo_filter
+*/
+template <typename T, typename THash = FastHasher<T>>
+class CuckooFilter
+{
+public:
+    //! Initialize the cuckoo filter
+    /*!
+        \param capacity - Expected count of keys
+        \param hash - Key hasher (default is THash())
+    */
+    explicit CuckooFilter(size_t capacity, const THash& hash = THash());
+    CuckooFilter(const CuckooFilter&) = delete;
+    CuckooFilter(CuckooFilter&&) = delete;
+    ~CuckooFilter() = default;
+
+    CuckooFilter& operator=(const CuckooFilter&) = delete;
+    CuckooFilter& operator=(CuckooFilter&&) = delete;
+
+    //! Is the cuckoo filter empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get the count of keys in the cuckoo filter
+    size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+    //! Get the cuckoo filter capacity (count of fingerprint slots)
+    size_t capacity() const noexcept { return _buckets.size() * SLOTS; }
+    //! Get the cuckoo filter memory size in bytes
+    size_t bytes() const noexcept { return _buckets.size() * sizeof(uint64_t); }
+
+    //! Insert the given key
+    /*!
+        \param key - Key to insert
+        \return 'true' if the key was inserted, 'false' if the cuckoo filter is full
+    */
+    bool Insert(const T& key) { return InsertHash((uint64_t)_hash(key)); }
+    //! Insert the given key hash
+    bool InsertHash(uint64_t hash);
+
+    //! Check if the given key may be in the cuckoo filter
+    /*!
+        \param key - Key to check
+        \return 'false' if the key is definitely not in the cuckoo filter, 'true' if the key may be in the cuckoo filter
+    */
+    bool Contains(const T& key) const noexcept { return ContainsHash((uint64_t)_hash(key)); }
+    //! Check if the given key hash may be in the cuckoo filter
+    bool ContainsHash(uint64_t hash) const noexcept;
+
+    //! Erase the given key inserted before
+    /*!
+        \param key - Key to erase
+        \return 'true' if the key was erased, 'false' if the key was not found
+    */
+    bool Erase(const T& key) { return EraseHash((uint64_t)_hash(key)); }
+    //! Erase the given key hash inserted before
+    bool EraseHash(uint64_t hash);
+
+    //! Clear the cuckoo filter
+    void Clear();
+
+private:
+    static const size_t SLOTS = 4;
+    static const size_t MAX_KICKS = 500;
+
+    THash _hash;
+    SpinLock _lock;
+    std::vector<std::atomic<uint64_t>> _buckets;
+    std::atomic<size_t> _size;
+    size_t _mask;
+    uint64_t _random;
+
+    static uint16_t Fingerprint(uint64_t hash) noexcept;
+    size_t Alternate(size_t index, uint16_t fingerprint) const noexcept;
+
+    static uint16_t Get(uint64_t bucket, size_t slot) noexcept { return (uint16_t)(bucket >> (slot * 16)); }
+    void Set(size_t index, size_t slot, uint16_t fingerprint) noexcept;
+    static bool Find(uint64_t bucket, uint16_t fingerprint) noexcept;
+    static int Free(uint64_t bucket) noexcept;
+};
+
+/*! \example algorithms_cuckoo_filter.cpp Cuckoo filter example */
+
+} // namespace CppCommon
+
+#include "cuckoo_filter.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_CUCKOO_FILTER_H
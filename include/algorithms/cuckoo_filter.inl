@@ -0,0 +1,180 @@
+/*!
+    \file cuckoo_filter.inl
+    \brief Cuckoo filter inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename THash>
+inline CuckooFilter<T, THash>::CuckooFilter(size_t capacity, const THash& hash)
+    : _hash(hash), _size(0), _random(0x9E3779B97F4A7C15ull)
+{
+    // Count of buckets is the power of two for 95% load at the expected count of keys
+    size_t buckets = 1;
+    while ((buckets * SLOTS * 95) < (capacity * 100))
+        buckets <<= 1;
+
+    _buckets = std::vector<std::atomic<uint64_t>>(buckets);
+    for (auto& bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    _mask = buckets - 1;
+}
+
+template <typename T, typename THash>
+inline uint16_t CuckooFilter<T, THash>::Fingerprint(uint64_t hash) noexcept
+{
+    // Zero fingerprint marks the empty slot
+    uint16_t fingerprint = (uint16_t)(hash >> 48);
+    return (fingerprint != 0) ? fingerprint : 1;
+}
+
+template <typename T, typename THash>
+inline size_t CuckooFilter<T, THash>::Alternate(size_t index, uint16_t fingerprint) const noexcept
+{
+    // Partial-key cuckoo hashing: alternate of the alternate bucket is the original one
+    return (index ^ (size_t)FastHash::Mix64(fingerprint)) & _mask;
+}
+
+template <typename T, typename THash>
+inline void CuckooFilter<T, THash>::Set(size_t index, size_t slot, uint16_t fingerprint) noexcept
+{
+    uint64_t bucket = _buckets[index].load(std::memory_order_relaxed);
+    bucket &= ~(0xFFFFull << (slot * 16));
+    bucket |= ((uint64_t)fingerprint << (slot * 16));
+    _buckets[index].store(bucket, std::memory_order_release);
+}
+
+template <typename T, typename THash>
+inline bool CuckooFilter<T, THash>::Find(uint64_t bucket, uint16_t fingerprint) noexcept
+{
+    // SWAR check for the zero 16-bit lane
+    uint64_t x = bucket ^ (0x0001000100010001ull * fingerprint);
+    return (((x - 0x0001000100010001ull) & ~x & 0x8000800080008000ull) != 0);
+}
+
+template <typename T, typename THash>
+inline int CuckooFilter<T, THash>::Free(uint64_t bucket) noexcept
+{
+    for (size_t slot = 0; slot < SLOTS; ++slot)
+        if (Get(bucket, slot) == 0)
+            return (int)slot;
+    return -1;
+}
+
+template <typename T, typename THash>
+inline bool CuckooFilter<T, THash>::ContainsHash(uint64_t hash) const noexcept
+{
+    uint16_t fingerprint = Fingerprint(hash);
+    size_t index1 = (size_t)hash & _mask;
+    size_t index2 = Alternate(index1, fingerprint);
+    return Find(_buckets[index1].load(std::memory_order_acquire), fingerprint) || Find(_buckets[index2].load(std::memory_order_acquire), fingerprint);
+}
+
+template <typename T, typename THash>
+inline bool CuckooFilter<T, THash>::InsertHash(uint64_t hash)
+{
+    uint16_t fingerprint = Fingerprint(hash);
+    size_t index1 = (size_t)hash & _mask;
+    size_t index2 = Alternate(index1, fingerprint);
+
+    Locker<SpinLock> locker(_lock);
+
+    // Try to insert into the free slot of one of both buckets
+    for (size_t index : { index1, index2 })
+    {
+        int slot = Free(_buckets[index].load(std::memory_order_relaxed));
+        if (slot >= 0)
+        {
+            Set(index, (size_t)slot, fingerprint);
+            _size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Search the cuckoo path of distinct slots that ends with the free slot
+    std::vector<std::pair<size_t, size_t>> path;
+    path.reserve(MAX_KICKS);
+    _random ^= hash;
+    size_t index = ((_random >> 17) & 1) ? index1 : index2;
+    for (size_t kick = 0; kick < MAX_KICKS; ++kick)
+    {
+        // Select the random slot which is not in the path yet
+        _random = FastHash::Mix64(_random);
+        size_t slot = _random % SLOTS;
+        size_t attempt = 0;
+        while ((attempt < SLOTS) && std::find(path.begin(), path.end(), std::make_pair(index, slot)) != path.end())
+        {
+            slot = (slot + 1) % SLOTS;
+            ++attempt;
+        }
+        if (attempt == SLOTS)
+            return false;
+
+        path.emplace_back(index, slot);
+
+        uint16_t victim = Get(_buckets[index].load(std::memory_order_relaxed), slot);
+        size_t alternate = Alternate(index, victim);
+        int free = Free(_buckets[alternate].load(std::memory_order_relaxed));
+        if (free >= 0)
+        {
+            // Move fingerprints from the end of the path, so each one is always present in one of its buckets
+            size_t target = alternate;
+            size_t target_slot = (size_t)free;
+            for (auto it = path.rbegin(); it != path.rend(); ++it)
+            {
+                Set(target, target_slot, Get(_buckets[it->first].load(std::memory_order_relaxed), it->second));
+                target = it->first;
+                target_slot = it->second;
+            }
+            Set(target, target_slot, fingerprint);
+            _size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        index = alternate;
+    }
+
+    // Cuckoo filter is full
+    return false;
+}
+
+template <typename T, typename THash>
+inline bool CuckooFilter<T, THash>::EraseHash(uint64_t hash)
+{
+    uint16_t fingerprint = Fingerprint(hash);
+    size_t index1 = (size_t)hash & _mask;
+    size_t index2 = Alternate(index1, fingerprint);
+
+    Locker<SpinLock> locker(_lock);
+
+    for (size_t index : { index1, index2 })
+    {
+        uint64_t bucket = _buckets[index].load(std::memory_order_relaxed);
+        for (size_t slot = 0; slot < SLOTS; ++slot)
+        {
+            if (Get(bucket, slot) == fingerprint)
+            {
+                Set(index, slot, 0);
+                _size.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+template <typename T, typename THash>
+inline void CuckooFilter<T, THash>::Clear()
+{
+    Locker<SpinLock> locker(_lock);
+
+    for (auto& bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    _size.store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
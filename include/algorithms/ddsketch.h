@@ -0,0 +1,115 @@
+/*!
+    \file ddsketch.h
+    \brief DDSketch quantile estimator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_DDSKETCH_H
+#define CPPCOMMON_ALGORITHMS_DDSKETCH_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace CppCommon {
+
+//! DDSketch quantile estimator
+/*!
+    DDSketch estimates quantiles of non-negative floating point values with
+    the given relative accuracy: the estimated quantile value differs from
+    the actual one by not more than accuracy * value. Values are counted in
+    logarithmic bins with the base gamma = (1 + accuracy) / (1 - accuracy),
+    e.g. 1% accuracy covers the range of [1e-9, 1e9] with ~2100 bins.
+
+    The count of bins is bounded: if the range of values requires more bins
+    the lowest bins are collapsed, so high quantiles (p99, p999) keep their
+    accuracy. Sketches with the same accuracy are fully mergeable, so they
+    could be kept per thread (or per service) and merged on read.
+
+    Not thread-safe.
+
+    https://arxiv.org/abs/1908.10693
+*/
+class DDSketch
+{
+public:
+    //! Initialize the DDSketch
+    /*!
+        \param accuracy - Relative accuracy in range (0, 1) (default is 0.01)
+        \param bins - Maximal count of bins (default is 2048)
+    */
+    explicit DDSketch(double accuracy = 0.01, size_t bins = 2048);
+    DDSketch(const DDSketch&) = default;
+    DDSketch(DDSketch&&) = default;
+    ~DDSketch() = default;
+
+    DDSketch& operator=(const DDSketch&) = default;
+    DDSketch& operator=(DDSketch&&) = default;
+
+    //! Get the relative accuracy
+    double accuracy() const noexcept { return _accuracy; }
+    //! Get the count of used bins
+    size_t bins() const noexcept { return _bins.size(); }
+
+    //! Is the sketch empty?
+    bool empty() const noexcept { return (_count == 0); }
+    //! Get the count of added values
+    uint64_t count() const noexcept { return _count; }
+    //! Get the sum of added values
+    double sum() const noexcept { return _sum; }
+    //! Get the mean of added values
+    double mean() const noexcept { return (_count > 0) ? (_sum / (double)_count) : 0.0; }
+    //! Get the minimal added value
+    double min() const noexcept { return (_count > 0) ? _min : 0.0; }
+    //! Get the maximal added value
+    double max() const noexcept { return (_count > 0) ? _max : 0.0; }
+
+    //! Add the given value
+    /*!
+        \param value - Non-negative value to add
+        \param count - Count of values to add (default is 1)
+    */
+    void Add(double value, uint64_t count = 1);
+
+    //! Get the value at the given quantile
+    /*!
+        \param quantile - Quantile in range [0, 1] (e.g. 0.99 for p99)
+        \return Value at the given quantile (zero if the sketch is empty)
+    */
+    double Quantile(double quantile) const noexcept;
+
+    //! Merge the given sketch with the same accuracy
+    void Merge(const DDSketch& sketch);
+    //! Clear the sketch
+    void Clear() noexcept;
+
+private:
+    double _accuracy;
+    double _gamma;
+    double _log_gamma;
+    size_t _max_bins;
+    std::vector<uint64_t> _bins;
+    int64_t _offset;
+    uint64_t _zero;
+    uint64_t _count;
+    double _sum;
+    double _min;
+    double _max;
+
+    // Get the bin key of the given positive value
+    int64_t Key(double value) const noexcept;
+    // Get the representative value of the given bin key
+    double Value(int64_t key) const noexcept;
+    // Add the given count into the bin with the given key
+    void AddBin(int64_t key, uint64_t count);
+};
+
+/*! \example algorithms_ddsketch.cpp DDSketch quantile estimator example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_DDSKETCH_H
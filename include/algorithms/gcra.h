@@ -0,0 +1,102 @@
+/*!
+    \file gcra.h
+    \brief Generic cell rate limit algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_GCRA_H
+#define CPPCOMMON_ALGORITHMS_GCRA_H
+
+#include "algorithms/token_bucket.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Generic cell rate limit algorithm (GCRA)
+/*!
+    Lock-free implementation of the generic cell rate algorithm. GCRA keeps
+    a single atomic theoretical arrival time (TAT) of the next request. Each
+    request moves the TAT forward by the emission interval (1 / rate) and is
+    allowed while the TAT is not ahead of the current time by more than the
+    burst tolerance.
+
+    GCRA produces the same decisions as the token bucket with the same rate
+    and burst. The wait time hint is exact and the state fits into a single
+    64-bit value, so it is well suited for storing in shared memory or per-key
+    tables.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Generic_cell_rate_algorithm
+*/
+class GCRA
+{
+public:
+    //! Initialize the generic cell rate limiter
+    /*!
+        \param rate - Rate of requests per second
+        \param burst - Maximum of burst requests
+        \param clock - Limiter clock (default is TokenBucketClock::TSC)
+    */
+    GCRA(uint64_t rate, uint64_t burst, TokenBucketClock clock = TokenBucketClock::TSC);
+    GCRA(const GCRA& gcra);
+    GCRA(GCRA&&) = delete;
+    ~GCRA() = default;
+
+    GCRA& operator=(const GCRA& gcra);
+    GCRA& operator=(GCRA&&) = delete;
+
+    //! Get the emission interval in nanoseconds
+    uint64_t interval() const noexcept { return _interval; }
+    //! Get the burst tolerance in nanoseconds
+    uint64_t tolerance() const noexcept { return _tolerance; }
+
+    //! Get the limiter clock
+    TokenBucketClock clock() const noexcept { return _clock; }
+    //! Get the current time of the limiter clock
+    uint64_t now() const { return Internals::TokenBucketNow(_clock); }
+
+    //! Try to consume the given count of requests
+    /*!
+        \param requests - Requests to consume (default is 1)
+        \return 'true' if requests were allowed, 'false' if requests were limited
+    */
+    bool Consume(uint64_t requests = 1) { return (TryConsume(requests, now()) == Timespan::zero()); }
+
+    //! Try to consume the given count of requests and get the wait time hint
+    /*!
+        \param requests - Requests to consume (default is 1)
+        \return Zero timespan if requests were allowed, otherwise time until requests will be allowed
+                (maximal timespan if the count of requests is greater than the burst)
+    */
+    Timespan TryConsume(uint64_t requests = 1) { return TryConsume(requests, now()); }
+    //! Try to consume the given count of requests at the given time and get the wait time hint
+    /*!
+        \param requests - Requests to consume
+        \param now - Current time of the limiter clock (see now())
+        \return Zero timespan if requests were allowed, otherwise time until requests will be allowed
+                (maximal timespan if the count of requests is greater than the burst)
+    */
+    Timespan TryConsume(uint64_t requests, uint64_t now);
+
+    //! Reset the limiter to the full burst
+    void Reset() noexcept { _tat.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> _tat;
+    uint64_t _interval;
+    uint64_t _tolerance;
+    TokenBucketClock _clock;
+};
+
+/*! \example algorithms_gcra.cpp Generic cell rate limit algorithm example */
+
+} // namespace CppCommon
+
+#include "gcra.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_GCRA_H
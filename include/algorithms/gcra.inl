@@ -0,0 +1,36 @@
+/*!
+    \file gcra.inl
+    \brief Generic cell rate limit algorithm inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline GCRA::GCRA(uint64_t rate, uint64_t burst, TokenBucketClock clock)
+    : _tat(0),
+      _interval(1000000000 / rate),
+      _tolerance(burst * _interval),
+      _clock(clock)
+{
+}
+
+inline GCRA::GCRA(const GCRA& gcra)
+    : _tat(gcra._tat.load()),
+      _interval(gcra._interval),
+      _tolerance(gcra._tolerance),
+      _clock(gcra._clock)
+{
+}
+
+inline GCRA& GCRA::operator=(const GCRA& gcra)
+{
+    _tat = gcra._tat.load();
+    _interval = gcra._interval;
+    _tolerance = gcra._tolerance;
+    _clock = gcra._clock;
+    return *this;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,138 @@
+/*!
+    \file hash.h
+    \brief Fast non-cryptographic hash algorithms definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_HASH_H
+#define CPPCOMMON_ALGORITHMS_HASH_H
+
+#include "common/uint128.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace CppCommon {
+
+//! Fast non-cryptographic hash algorithms
+/*!
+    Byte strings are hashed with the wyhash algorithm, which processes 48 bytes
+    per round with 64x64->128 bits multiplications and passes SMHasher quality
+    tests. Short keys (up to 16 bytes) are hashed with a couple of loads and
+    two multiplications, that is several times faster than std::hash.
+
+    Integer mixers are bijective finalizers that spread every input bit into
+    every output bit, so power of two hash tables could use low bits of the
+    result as the bucket index.
+
+    Hash values depend on the CPU byte order and the seed, they are not
+    suitable for persistent formats (use CRC32C checksum instead) and must
+    not be used for cryptographic purposes.
+
+    Thread-safe.
+
+    https://github.com/wangyi-fudan/wyhash
+*/
+class FastHash
+{
+public:
+    FastHash() = delete;
+    FastHash(const FastHash&) = delete;
+    FastHash(FastHash&&) = delete;
+    ~FastHash() = delete;
+
+    FastHash& operator=(const FastHash&) = delete;
+    FastHash& operator=(FastHash&&) = delete;
+
+    //! Compute 64-bit hash of the given buffer
+    /*!
+        \param buffer - Buffer to hash
+        \param size - Buffer size
+        \param seed - Hash seed (default is 0)
+        \return 64-bit hash value
+    */
+    static uint64_t Compute64(const void* buffer, size_t size, uint64_t seed = 0) noexcept;
+    //! Compute 64-bit hash of the given string
+    static uint64_t Compute64(std::string_view str, uint64_t seed = 0) noexcept
+    { return Compute64(str.data(), str.size(), seed); }
+
+    //! Compute 128-bit hash of the given buffer
+    /*!
+        128-bit hash consists of two independently seeded 64-bit hashes, so it
+        is suitable for content fingerprints where 64-bit collisions matter.
+
+        \param buffer - Buffer to hash
+        \param size - Buffer size
+        \param seed - Hash seed (default is 0)
+        \return 128-bit hash value
+    */
+    static uint128_t Compute128(const void* buffer, size_t size, uint64_t seed = 0) noexcept;
+    //! Compute 128-bit hash of the given string
+    static uint128_t Compute128(std::string_view str, uint64_t seed = 0) noexcept
+    { return Compute128(str.data(), str.size(), seed); }
+
+    //! Mix 32-bit integer (murmur3 finalizer)
+    static uint32_t Mix32(uint32_t value) noexcept;
+    //! Mix 64-bit integer (splitmix64 finalizer)
+    static uint64_t Mix64(uint64_t value) noexcept;
+
+private:
+    static void Multiply(uint64_t& a, uint64_t& b) noexcept;
+    static uint64_t Mix(uint64_t a, uint64_t b) noexcept;
+    static uint64_t Read8(const uint8_t* ptr) noexcept;
+    static uint64_t Read4(const uint8_t* ptr) noexcept;
+};
+
+//! Fast hasher function object
+/*!
+    Drop-in replacement of std::hash for hash containers, for example
+    HashMap<std::string, int, FastHasher<std::string>>:
+    \li strings and string views are hashed with FastHash::Compute64();
+    \li integers, enums and pointers are mixed with FastHash::Mix64();
+    \li other types are hashed with std::hash and then mixed.
+
+    String hashers are transparent, so heterogeneous lookup of std::string
+    keys with std::string_view is supported by the containers which allow it.
+*/
+template <typename T>
+struct FastHasher
+{
+    size_t operator()(const T& value) const noexcept;
+};
+
+//! Fast hasher function object (string specialization)
+template <typename TChar, typename TTraits, typename TAllocator>
+struct FastHasher<std::basic_string<TChar, TTraits, TAllocator>>
+{
+    typedef void is_transparent;
+
+    size_t operator()(std::basic_string_view<TChar, TTraits> value) const noexcept
+    { return (size_t)FastHash::Compute64(value.data(), value.size() * sizeof(TChar)); }
+};
+
+//! Fast hasher function object (string view specialization)
+template <typename TChar, typename TTraits>
+struct FastHasher<std::basic_string_view<TChar, TTraits>>
+{
+    typedef void is_transparent;
+
+    size_t operator()(std::basic_string_view<TChar, TTraits> value) const noexcept
+    { return (size_t)FastHash::Compute64(value.data(), value.size() * sizeof(TChar)); }
+};
+
+} // namespace CppCommon
+
+#include "hash.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_HASH_H
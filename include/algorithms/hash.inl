@@ -0,0 +1,152 @@
+/*!
+    \file hash.inl
+    \brief Fast non-cryptographic hash algorithms inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// wyhash secret constants
+constexpr uint64_t WYHASH_SECRET[4] = { 0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull, 0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull };
+
+} // namespace Internals
+//! @endcond
+
+inline void FastHash::Multiply(uint64_t& a, uint64_t& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t result = (__uint128_t)a * b;
+    a = (uint64_t)result;
+    b = (uint64_t)(result >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    a = _umul128(a, b, &b);
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = (t < rl);
+    uint64_t lo = t + (rm1 << 32);
+    c += (lo < t);
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    a = lo;
+    b = hi;
+#endif
+}
+
+inline uint64_t FastHash::Mix(uint64_t a, uint64_t b) noexcept
+{
+    Multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64_t FastHash::Read8(const uint8_t* ptr) noexcept
+{
+    uint64_t result;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+inline uint64_t FastHash::Read4(const uint8_t* ptr) noexcept
+{
+    uint32_t result;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+inline uint64_t FastHash::Compute64(const void* buffer, size_t size, uint64_t seed) noexcept
+{
+    const uint64_t* secret = Internals::WYHASH_SECRET;
+    const uint8_t* ptr = (const uint8_t*)buffer;
+
+    seed ^= Mix(seed ^ secret[0], secret[1]);
+
+    uint64_t a, b;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            a = (Read4(ptr) << 32) | Read4(ptr + ((size >> 3) << 2));
+            b = (Read4(ptr + size - 4) << 32) | Read4(ptr + size - 4 - ((size >> 3) << 2));
+        }
+        else if (size > 0)
+        {
+            a = ((uint64_t)ptr[0] << 16) | ((uint64_t)ptr[size >> 1] << 8) | ptr[size - 1];
+            b = 0;
+        }
+        else
+            a = b = 0;
+    }
+    else
+    {
+        size_t i = size;
+        if (i > 48)
+        {
+            // Three independent lanes per round
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do
+            {
+                seed = Mix(Read8(ptr) ^ secret[1], Read8(ptr + 8) ^ seed);
+                seed1 = Mix(Read8(ptr + 16) ^ secret[2], Read8(ptr + 24) ^ seed1);
+                seed2 = Mix(Read8(ptr + 32) ^ secret[3], Read8(ptr + 40) ^ seed2);
+                ptr += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16)
+        {
+            seed = Mix(Read8(ptr) ^ secret[1], Read8(ptr + 8) ^ seed);
+            i -= 16;
+            ptr += 16;
+        }
+        a = Read8(ptr + i - 16);
+        b = Read8(ptr + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    Multiply(a, b);
+    return Mix(a ^ secret[0] ^ size, b ^ secret[1]);
+}
+
+inline uint128_t FastHash::Compute128(const void* buffer, size_t size, uint64_t seed) noexcept
+{
+    return uint128_t(Compute64(buffer, size, seed ^ Internals::WYHASH_SECRET[2]), Compute64(buffer, size, seed));
+}
+
+inline uint32_t FastHash::Mix32(uint32_t value) noexcept
+{
+    value ^= value >> 16;
+    value *= 0x85EBCA6Bu;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35u;
+    value ^= value >> 16;
+    return value;
+}
+
+inline uint64_t FastHash::Mix64(uint64_t value) noexcept
+{
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return value;
+}
+
+template <typename T>
+inline size_t FastHasher<T>::operator()(const T& value) const noexcept
+{
+    if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+        return (size_t)FastHash::Mix64((uint64_t)value);
+    else if constexpr (std::is_pointer_v<T>)
+        return (size_t)FastHash::Mix64((uint64_t)(uintptr_t)value);
+    else
+        return (size_t)FastHash::Mix64((uint64_t)std::hash<T>()(value));
+}
+
+} // namespace CppCommon
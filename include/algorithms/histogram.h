@@ -0,0 +1,192 @@
+/*!
+    \file histogram.h
+    \brief Log-linear histogram definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_HISTOGRAM_H
+#define CPPCOMMON_ALGORITHMS_HISTOGRAM_H
+
+#include "threads/sharded_counter.h"
+#include "time/timespan.h"
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! Log-linear histogram snapshot
+/*!
+    Histogram snapshot keeps plain counters of log-linear buckets (see
+    Histogram) and answers quantile queries. Snapshots with the same precision
+    could be merged (e.g. from different services) and subtracted, so the
+    difference of two consecutive snapshots of the cumulative histogram gives
+    the histogram of the rolling window between them.
+
+    Not thread-safe.
+*/
+class HistogramSnapshot
+{
+public:
+    //! Initialize the empty histogram snapshot
+    /*!
+        \param precision - Count of significant bits of bucket values (default is 5)
+    */
+    explicit HistogramSnapshot(size_t precision = 5);
+    HistogramSnapshot(const HistogramSnapshot&) = default;
+    HistogramSnapshot(HistogramSnapshot&&) = default;
+    ~HistogramSnapshot() = default;
+
+    HistogramSnapshot& operator=(const HistogramSnapshot&) = default;
+    HistogramSnapshot& operator=(HistogramSnapshot&&) = default;
+
+    //! Get the precision
+    size_t precision() const noexcept { return _precision; }
+    //! Get bucket counters
+    std::span<const uint64_t> counts() const noexcept { return _counts; }
+
+    //! Is the histogram snapshot empty?
+    bool empty() const noexcept { return (_count == 0); }
+    //! Get the count of recorded values
+    uint64_t count() const noexcept { return _count; }
+    //! Get the sum of recorded values
+    uint64_t sum() const noexcept { return _sum; }
+    //! Get the mean of recorded values
+    double mean() const noexcept { return (_count > 0) ? ((double)_sum / (double)_count) : 0.0; }
+    //! Get the lower bound of the minimal recorded value
+    uint64_t min() const noexcept;
+    //! Get the upper bound of the maximal recorded value
+    uint64_t max() const noexcept;
+
+    //! Get the value at the given quantile
+    /*!
+        Value is the upper bound of the bucket which contains the quantile,
+        so it exceeds the actual value by not more than 2^-precision.
+
+        \param quantile - Quantile in range [0, 1] (e.g. 0.99 for p99)
+        \return Value at the given quantile (zero if the histogram snapshot is empty)
+    */
+    uint64_t Quantile(double quantile) const noexcept;
+
+    //! Add the given values into the histogram snapshot
+    void Record(uint64_t value, uint64_t count = 1) noexcept;
+    //! Merge the given histogram snapshot with the same precision
+    void Merge(const HistogramSnapshot& snapshot) noexcept;
+    //! Subtract the given earlier histogram snapshot with the same precision
+    void Subtract(const HistogramSnapshot& snapshot) noexcept;
+    //! Clear the histogram snapshot
+    void Clear() noexcept;
+
+    //! Get the count of buckets for the given precision
+    static size_t Buckets(size_t precision) noexcept { return (65 - precision) << precision; }
+    //! Get the bucket index of the given value
+    static size_t Index(uint64_t value, size_t precision) noexcept;
+    //! Get the lower bound of the given bucket
+    static uint64_t LowerBound(size_t index, size_t precision) noexcept;
+    //! Get the upper bound of the given bucket
+    static uint64_t UpperBound(size_t index, size_t precision) noexcept;
+
+private:
+    size_t _precision;
+    std::vector<uint64_t> _counts;
+    uint64_t _count;
+    uint64_t _sum;
+
+    friend class Histogram;
+};
+
+//! Log-linear histogram
+/*!
+    Log-linear (HDR histogram style) histogram records integer values (e.g.
+    latencies in nanoseconds) into buckets with the fixed relative error.
+    Each power of two range is split into 2^precision linear buckets, so
+    values are recorded with the relative error of 2^-precision (3.1% for
+    the default precision of 5 bits) and values less than 2^precision are
+    recorded exactly. Buckets cover the whole 64-bit range.
+
+    Record operation computes the bucket with a couple of bit operations and
+    performs a relaxed atomic increment in the shard of the current CPU core,
+    so threads on different CPU cores never write the same cache line. Read
+    operation merges all shards into the histogram snapshot which answers
+    quantile queries (p50, p99, p999). Subtracting the previous snapshot from
+    the current one gives the histogram of the rolling window.
+
+    Every shard takes 8 * (65 - precision) * 2^precision bytes (15 KiB for
+    the default precision).
+
+    Thread-safe.
+
+    http://hdrhistogram.org
+*/
+class Histogram
+{
+public:
+    //! Minimal precision
+    static const size_t MIN_PRECISION = 1;
+    //! Maximal precision
+    static const size_t MAX_PRECISION = 10;
+
+    //! Initialize the histogram
+    /*!
+        \param precision - Count of significant bits of bucket values in range [MIN_PRECISION, MAX_PRECISION] (default is 5)
+        \param shards - Count of shards rounded up to the power of two (default is 0 - count of logical CPU cores)
+    */
+    explicit Histogram(size_t precision = 5, size_t shards = 0);
+    Histogram(const Histogram&) = delete;
+    Histogram(Histogram&&) = delete;
+    ~Histogram() = default;
+
+    Histogram& operator=(const Histogram&) = delete;
+    Histogram& operator=(Histogram&&) = delete;
+
+    //! Get the precision
+    size_t precision() const noexcept { return _precision; }
+    //! Get the count of buckets
+    size_t buckets() const noexcept { return _buckets; }
+    //! Get the count of shards
+    size_t shards() const noexcept { return _mask + 1; }
+
+    //! Record the given value
+    /*!
+        \param value - Value to record
+        \param count - Count of values to record (default is 1)
+    */
+    void Record(uint64_t value, uint64_t count = 1) noexcept;
+    //! Record the given timespan in nanoseconds (negative timespans are recorded as zero)
+    void Record(const Timespan& timespan) noexcept { Record((timespan.total() > 0) ? (uint64_t)timespan.total() : 0); }
+
+    //! Take the snapshot of all shards
+    /*!
+        Snapshot could be taken concurrently with records, the result is
+        not a linearizable snapshot.
+    */
+    HistogramSnapshot Snapshot() const;
+
+    //! Reset the histogram
+    /*!
+        Records concurrent with the reset could be lost.
+    */
+    void Reset() noexcept;
+
+private:
+    size_t _precision;
+    size_t _buckets;
+    size_t _stride;
+    size_t _mask;
+    std::unique_ptr<std::atomic<uint64_t>[]> _counters;
+};
+
+/*! \example algorithms_histogram.cpp Log-linear histogram example */
+
+} // namespace CppCommon
+
+#include "histogram.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_HISTOGRAM_H
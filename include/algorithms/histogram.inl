@@ -0,0 +1,58 @@
+/*!
+    \file histogram.inl
+    \brief Log-linear histogram inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline size_t HistogramSnapshot::Index(uint64_t value, size_t precision) noexcept
+{
+    // Values less than 2^precision are recorded exactly
+    if (value < ((uint64_t)1 << precision))
+        return (size_t)value;
+
+    // Power of two group and linear sub-bucket of the value
+    size_t exponent = (size_t)(63 - std::countl_zero(value));
+    size_t group = exponent - precision + 1;
+    size_t sub = (size_t)(value >> (exponent - precision)) - ((size_t)1 << precision);
+    return (group << precision) + sub;
+}
+
+inline uint64_t HistogramSnapshot::LowerBound(size_t index, size_t precision) noexcept
+{
+    size_t group = index >> precision;
+    if (group == 0)
+        return (uint64_t)index;
+
+    size_t sub = index & (((size_t)1 << precision) - 1);
+    return (((uint64_t)1 << precision) + sub) << (group - 1);
+}
+
+inline uint64_t HistogramSnapshot::UpperBound(size_t index, size_t precision) noexcept
+{
+    size_t group = index >> precision;
+    if (group == 0)
+        return (uint64_t)index;
+
+    return LowerBound(index, precision) + (((uint64_t)1 << (group - 1)) - 1);
+}
+
+inline void HistogramSnapshot::Record(uint64_t value, uint64_t count) noexcept
+{
+    _counts[Index(value, _precision)] += count;
+    _count += count;
+    _sum += value * count;
+}
+
+inline void Histogram::Record(uint64_t value, uint64_t count) noexcept
+{
+    std::atomic<uint64_t>* shard = &_counters[(Internals::ShardedSlots::CurrentIndex() & _mask) * _stride];
+    shard[HistogramSnapshot::Index(value, _precision)].fetch_add(count, std::memory_order_relaxed);
+    // Sum of values is kept right after the buckets
+    shard[_buckets].fetch_add(value * count, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,119 @@
+/*!
+    \file hyperloglog.h
+    \brief HyperLogLog cardinality estimator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_HYPERLOGLOG_H
+#define CPPCOMMON_ALGORITHMS_HYPERLOGLOG_H
+
+#include "algorithms/hash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Update the register with the rank of the hash
+void HyperLogLogAdd(std::atomic<uint8_t>* registers, size_t precision, uint64_t hash) noexcept;
+// Estimate the cardinality with the registers
+double HyperLogLogEstimate(const std::atomic<uint8_t>* registers, size_t precision) noexcept;
+
+} // namespace Internals
+//! @endcond
+
+//! HyperLogLog cardinality estimator
+/*!
+    HyperLogLog estimates the count of distinct keys with the fixed amount of
+    memory: 2^precision one byte registers. Standard error of the estimation
+    is about 1.04 / sqrt(2^precision), e.g. 0.81% for the default precision
+    of 14 bits (16 KiB of registers). Small cardinalities are estimated with
+    linear counting.
+
+    Registers are updated with the atomic maximum, so keys might be added
+    concurrently without locks. Estimators with the same precision could be
+    merged (e.g. per-thread or per-node estimators) and their registers could
+    be exported and imported to transfer the estimator.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/HyperLogLog
+*/
+template <typename T, typename THash = FastHasher<T>>
+class HyperLogLog
+{
+public:
+    //! Minimal precision
+    static const size_t MIN_PRECISION = 4;
+    //! Maximal precision
+    static const size_t MAX_PRECISION = 18;
+
+    //! Initialize the HyperLogLog estimator
+    /*!
+        \param precision - Count of index bits in range [MIN_PRECISION, MAX_PRECISION] (default is 14)
+        \param hash - Key hasher (default is THash())
+    */
+    explicit HyperLogLog(size_t precision = 14, const THash& hash = THash());
+    HyperLogLog(const HyperLogLog&) = delete;
+    HyperLogLog(HyperLogLog&&) = delete;
+    ~HyperLogLog() = default;
+
+    HyperLogLog& operator=(const HyperLogLog&) = delete;
+    HyperLogLog& operator=(HyperLogLog&&) = delete;
+
+    //! Get the precision
+    size_t precision() const noexcept { return _precision; }
+    //! Get the count of registers
+    size_t registers() const noexcept { return _registers.size(); }
+
+    //! Add the given key
+    void Add(const T& key) noexcept { AddHash((uint64_t)_hash(key)); }
+    //! Add the given key hash
+    void AddHash(uint64_t hash) noexcept { Internals::HyperLogLogAdd(_registers.data(), _precision, hash); }
+
+    //! Estimate the count of distinct keys
+    double Estimate() const noexcept { return Internals::HyperLogLogEstimate(_registers.data(), _precision); }
+
+    //! Merge the given estimator with the same precision into the current one
+    void Merge(const HyperLogLog& estimator) noexcept;
+
+    //! Export registers into the given buffer
+    /*!
+        \param buffer - Buffer to export (must be not less than registers())
+        \return Count of exported registers
+    */
+    size_t Export(std::span<uint8_t> buffer) const noexcept;
+    //! Merge registers exported from the estimator with the same precision
+    /*!
+        \param buffer - Buffer of exported registers
+        \return 'true' if registers were merged, 'false' if the buffer size does not match the count of registers
+    */
+    bool Import(std::span<const uint8_t> buffer) noexcept;
+
+    //! Clear the estimator
+    void Clear() noexcept;
+
+private:
+    THash _hash;
+    size_t _precision;
+    std::vector<std::atomic<uint8_t>> _registers;
+
+    void MergeRegister(size_t index, uint8_t value) noexcept;
+};
+
+/*! \example algorithms_hyperloglog.cpp HyperLogLog cardinality estimator example */
+
+} // namespace CppCommon
+
+#include "hyperloglog.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_HYPERLOGLOG_H
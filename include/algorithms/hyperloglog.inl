@@ -0,0 +1,65 @@
+/*!
+    \file hyperloglog.inl
+    \brief HyperLogLog cardinality estimator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename THash>
+inline HyperLogLog<T, THash>::HyperLogLog(size_t precision, const THash& hash)
+    : _hash(hash), _precision(precision), _registers((size_t)1 << precision)
+{
+    assert(((precision >= MIN_PRECISION) && (precision <= MAX_PRECISION)) && "HyperLogLog precision must be in range [4, 18]!");
+
+    Clear();
+}
+
+template <typename T, typename THash>
+inline void HyperLogLog<T, THash>::MergeRegister(size_t index, uint8_t value) noexcept
+{
+    uint8_t current = _registers[index].load(std::memory_order_relaxed);
+    while ((value > current) && !_registers[index].compare_exchange_weak(current, value, std::memory_order_relaxed, std::memory_order_relaxed));
+}
+
+template <typename T, typename THash>
+inline void HyperLogLog<T, THash>::Merge(const HyperLogLog& estimator) noexcept
+{
+    assert((_precision == estimator._precision) && "HyperLogLog estimators must have the same precision to merge!");
+    if (_precision != estimator._precision)
+        return;
+
+    for (size_t i = 0; i < _registers.size(); ++i)
+        MergeRegister(i, estimator._registers[i].load(std::memory_order_relaxed));
+}
+
+template <typename T, typename THash>
+inline size_t HyperLogLog<T, THash>::Export(std::span<uint8_t> buffer) const noexcept
+{
+    size_t count = std::min(buffer.size(), _registers.size());
+    for (size_t i = 0; i < count; ++i)
+        buffer[i] = _registers[i].load(std::memory_order_relaxed);
+    return count;
+}
+
+template <typename T, typename THash>
+inline bool HyperLogLog<T, THash>::Import(std::span<const uint8_t> buffer) noexcept
+{
+    if (buffer.size() != _registers.size())
+        return false;
+
+    for (size_t i = 0; i < _registers.size(); ++i)
+        MergeRegister(i, buffer[i]);
+    return true;
+}
+
+template <typename T, typename THash>
+inline void HyperLogLog<T, THash>::Clear() noexcept
+{
+    for (auto& reg : _registers)
+        reg.store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,74 @@
+/*!
+    \file lz4.h
+    \brief LZ4 block compression algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_LZ4_H
+#define CPPCOMMON_ALGORITHMS_LZ4_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! LZ4 block compression algorithm
+/*!
+    LZ4 is a byte-oriented LZ77 compression algorithm with a very fast
+    decoder. Compressed blocks use the standard LZ4 block format, so they
+    could be decompressed by any LZ4 implementation.
+
+    Optional dictionary is a shared content (e.g. common parts of JSON or
+    HTML documents) which is used as a virtual prefix of each block, so
+    small blocks could reference it and compress much better. The same
+    dictionary must be used to decompress the block. Only the last 64KB of
+    the dictionary are used.
+
+    Thread-safe.
+
+    https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+*/
+class LZ4
+{
+public:
+    LZ4() = delete;
+    LZ4(const LZ4&) = delete;
+    LZ4(LZ4&&) = delete;
+    ~LZ4() = delete;
+
+    LZ4& operator=(const LZ4&) = delete;
+    LZ4& operator=(LZ4&&) = delete;
+
+    //! Get the maximal size of the compressed block for the given source size
+    static size_t Bound(size_t size) noexcept { return size + (size / 255) + 16; }
+
+    //! Compress the given buffer into the LZ4 block
+    /*!
+        \param source - Source buffer
+        \param size - Source buffer size
+        \param destination - Destination buffer
+        \param capacity - Destination buffer capacity (Bound(size) is always enough)
+        \param dictionary - Dictionary buffer (default is nullptr)
+        \param dictionary_size - Dictionary buffer size (default is 0)
+        \return Compressed block size or 0 if the destination buffer is too small
+    */
+    static size_t Compress(const void* source, size_t size, void* destination, size_t capacity, const void* dictionary = nullptr, size_t dictionary_size = 0);
+
+    //! Decompress the given LZ4 block
+    /*!
+        \param source - Compressed block
+        \param size - Compressed block size
+        \param destination - Destination buffer
+        \param capacity - Destination buffer capacity
+        \param dictionary - Dictionary buffer used to compress the block (default is nullptr)
+        \param dictionary_size - Dictionary buffer size (default is 0)
+        \return Decompressed size or SIZE_MAX if the block is malformed or the destination buffer is too small
+    */
+    static size_t Decompress(const void* source, size_t size, void* destination, size_t capacity, const void* dictionary = nullptr, size_t dictionary_size = 0) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ALGORITHMS_LZ4_H
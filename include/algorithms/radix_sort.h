@@ -0,0 +1,170 @@
+/*!
+    \file radix_sort.h
+    \brief Radix sort algorithms definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_RADIX_SORT_H
+#define CPPCOMMON_ALGORITHMS_RADIX_SORT_H
+
+#include "common/uint128.h"
+#include "memory/allocator.h"
+#include "system/uuid.h"
+#include "threads/parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Radix sort key traits
+/*!
+    Radix sort key traits map the fixed-width key into bytes which are
+    ordered in the same way as keys: bytes is the count of key bytes and
+    byte(key, index) returns the key byte with the given index starting
+    from the least significant one.
+
+    Specializations are provided for integral and floating point types,
+    uint128_t and UUID. Other fixed-width key types could be supported
+    with user specializations.
+*/
+template <typename T, typename = void>
+struct RadixSortTraits;
+
+//! Radix sort key traits for integral types
+template <typename T>
+struct RadixSortTraits<T, std::enable_if_t<std::is_integral_v<T>>>
+{
+    typedef std::make_unsigned_t<std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>> type;
+
+    static constexpr size_t bytes = sizeof(T);
+    static uint8_t byte(T key, size_t index) noexcept
+    {
+        type value = (type)key;
+        // Flip the sign bit of signed keys to order negative keys first
+        if constexpr (std::is_signed_v<T>)
+            value ^= (type)((type)1 << (sizeof(T) * 8 - 1));
+        return (uint8_t)(value >> (index * 8));
+    }
+};
+
+//! Radix sort key traits for floating point types
+template <typename T>
+struct RadixSortTraits<T, std::enable_if_t<std::is_floating_point_v<T> && ((sizeof(T) == 4) || (sizeof(T) == 8))>>
+{
+    typedef std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t> type;
+
+    static constexpr size_t bytes = sizeof(T);
+    static uint8_t byte(T key, size_t index) noexcept
+    {
+        type value;
+        std::memcpy(&value, &key, sizeof(T));
+        // Invert negative keys and flip the sign bit of positive keys
+        const type sign = (type)1 << (sizeof(T) * 8 - 1);
+        value = (value & sign) ? ~value : (value ^ sign);
+        return (uint8_t)(value >> (index * 8));
+    }
+};
+
+//! Radix sort key traits for 128-bit unsigned integer type
+template <>
+struct RadixSortTraits<uint128_t>
+{
+    static constexpr size_t bytes = 16;
+    static uint8_t byte(const uint128_t& key, size_t index) noexcept
+    { return (index < 8) ? (uint8_t)(key.lower() >> (index * 8)) : (uint8_t)(key.upper() >> ((index - 8) * 8)); }
+};
+
+//! Radix sort key traits for UUID type
+template <>
+struct RadixSortTraits<UUID>
+{
+    static constexpr size_t bytes = 16;
+    static uint8_t byte(const UUID& key, size_t index) noexcept { return key.data()[15 - index]; }
+};
+
+//! Radix sort identity key projection
+struct RadixSortIdentity
+{
+    template <typename T>
+    const T& operator()(const T& value) const noexcept { return value; }
+};
+
+//! Radix sort
+/*!
+    Sorts range [first, last) by keys projected from elements with the key
+    extractor. Fixed-width keys (see RadixSortTraits) are sorted with the
+    stable least significant digit (LSD) radix sort which makes one
+    histogram pass and one scatter pass over the range for each key byte
+    and skips bytes which are the same for all keys. Keys convertible to
+    std::string_view are sorted with the not stable most significant digit
+    (MSD) in-place radix sort which caches the current byte of each key.
+
+    Scratch memory (the copy of the range for LSD radix sort or the byte
+    cache for MSD radix sort) is allocated with the given memory manager.
+    Elements must be nothrow movable.
+
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param key - Key extractor: key_type key(const value_type& value) (default is RadixSortIdentity())
+*/
+template <typename TIterator, class TKey = RadixSortIdentity>
+void RadixSort(TIterator first, TIterator last, TKey key = TKey());
+//! Radix sort with scratch memory from the given memory manager
+/*!
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param key - Key extractor: key_type key(const value_type& value)
+    \param manager - Memory manager for scratch memory
+*/
+template <typename TIterator, class TKey, class TMemoryManager>
+void RadixSort(TIterator first, TIterator last, TKey key, TMemoryManager& manager);
+
+//! Parallel radix sort
+/*!
+    Works like RadixSort() with workers of the thread pool and the calling
+    thread. LSD radix sort splits the range into contiguous blocks, one
+    block per thread. Each thread counts its own histogram of the current
+    key byte, and then scatters its block into offsets calculated from all
+    histograms, so the sort stays stable. MSD radix sort partitions the
+    range by the first key byte and sorts partitions in parallel.
+
+    \param pool - Thread pool
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param key - Key extractor: key_type key(const value_type& value) (default is RadixSortIdentity())
+    \param options - Parallel options (default is ParallelOptions())
+*/
+template <typename TIterator, class TKey = RadixSortIdentity>
+void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, TKey key = TKey(), const ParallelOptions& options = ParallelOptions());
+//! Parallel radix sort with scratch memory from the given memory manager
+/*!
+    Memory manager is used only from the calling thread.
+
+    \param pool - Thread pool
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param key - Key extractor: key_type key(const value_type& value)
+    \param manager - Memory manager for scratch memory
+    \param options - Parallel options (default is ParallelOptions())
+*/
+template <typename TIterator, class TKey, class TMemoryManager, std::enable_if_t<!std::is_same_v<std::remove_cv_t<TMemoryManager>, ParallelOptions>, int> = 0>
+void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, TKey key, TMemoryManager& manager, const ParallelOptions& options = ParallelOptions());
+
+/*! \example algorithms_radix_sort.cpp Radix sort algorithms example */
+
+} // namespace CppCommon
+
+#include "radix_sort.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_RADIX_SORT_H
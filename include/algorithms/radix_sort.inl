@@ -0,0 +1,416 @@
+/*!
+    \file radix_sort.inl
+    \brief Radix sort algorithms inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Radix sort scratch memory allocated with the memory manager
+template <typename T, class TMemoryManager>
+class RadixBuffer
+{
+public:
+    RadixBuffer(TMemoryManager& manager, size_t count)
+        : _manager(manager),
+          _count(count),
+          _data((T*)manager.malloc(count * sizeof(T), alignof(T)))
+    {
+        if (_data == nullptr)
+            throw std::bad_alloc();
+    }
+    RadixBuffer(const RadixBuffer&) = delete;
+    RadixBuffer(RadixBuffer&&) = delete;
+    ~RadixBuffer() { _manager.free(_data, _count * sizeof(T)); }
+
+    RadixBuffer& operator=(const RadixBuffer&) = delete;
+    RadixBuffer& operator=(RadixBuffer&&) = delete;
+
+    T* data() const noexcept { return _data; }
+
+private:
+    TMemoryManager& _manager;
+    size_t _count;
+    T* _data;
+};
+
+// Count of threads for the radix sort of the given count of elements
+inline size_t RadixThreads(ThreadPool* pool, size_t count, const ParallelOptions& options)
+{
+    return (pool != nullptr) ? PlanParallel(*pool, count, options, 65536).threads : 1;
+}
+
+// Execute the given count of tasks: void body(size_t task, size_t, size_t)
+template <class TBody>
+inline void RadixExecute(ThreadPool* pool, size_t tasks, size_t threads, TBody& body)
+{
+    if ((pool == nullptr) || (threads <= 1))
+    {
+        for (size_t task = 0; task < tasks; ++task)
+            body(task, task, task + 1);
+        return;
+    }
+
+    ParallelPlan plan = { tasks, 1, tasks, std::min(threads, tasks) };
+    ParallelExecute(*pool, plan, body);
+}
+
+// Compare fixed-width keys in the radix order
+template <typename TTraits, typename TKey>
+inline bool RadixLess(const TKey& key1, const TKey& key2) noexcept
+{
+    for (size_t index = TTraits::bytes; index-- > 0;)
+    {
+        uint8_t byte1 = TTraits::byte(key1, index);
+        uint8_t byte2 = TTraits::byte(key2, index);
+        if (byte1 != byte2)
+            return byte1 < byte2;
+    }
+    return false;
+}
+
+// Least significant digit radix sort of fixed-width keys
+template <typename TIterator, class TKey, class TMemoryManager>
+inline void RadixSortLSD(ThreadPool* pool, TIterator first, size_t count, TKey& key, TMemoryManager& manager, const ParallelOptions& options)
+{
+    typedef typename std::iterator_traits<TIterator>::value_type T;
+    typedef std::decay_t<std::invoke_result_t<TKey&, const T&>> K;
+    typedef RadixSortTraits<K> Traits;
+    constexpr size_t BYTES = Traits::bytes;
+
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "Radix sort requires nothrow movable elements!");
+
+    // Split the range into contiguous blocks, one block per thread
+    size_t threads = RadixThreads(pool, count, options);
+    std::vector<size_t> bounds(threads + 1);
+    for (size_t i = 0; i <= threads; ++i)
+        bounds[i] = count * i / threads;
+
+    // Count histograms of all key bytes with one pass
+    std::vector<std::array<size_t, 256>> histograms(threads * BYTES);
+    auto histogram = [first, &key, &bounds, &histograms](size_t thread, size_t, size_t)
+    {
+        std::array<size_t, 256>* current = &histograms[thread * BYTES];
+        for (size_t i = bounds[thread]; i < bounds[thread + 1]; ++i)
+        {
+            decltype(auto) k = key(first[i]);
+            for (size_t index = 0; index < BYTES; ++index)
+                ++current[index][Traits::byte(k, index)];
+        }
+    };
+    RadixExecute(pool, threads, threads, histogram);
+
+    // Skip key bytes which are the same for all keys
+    std::vector<size_t> digits;
+    {
+        decltype(auto) k = key(first[0]);
+        for (size_t index = 0; index < BYTES; ++index)
+        {
+            uint8_t byte = Traits::byte(k, index);
+            size_t total = 0;
+            for (size_t thread = 0; thread < threads; ++thread)
+                total += histograms[thread * BYTES + index][byte];
+            if (total != count)
+                digits.push_back(index);
+        }
+    }
+    if (digits.empty())
+        return;
+
+    RadixBuffer<T, TMemoryManager> scratch(manager, count);
+    T* buffer = scratch.data();
+
+    std::vector<std::array<size_t, 256>> offsets(threads);
+    size_t digit = 0;
+
+    // Count histograms of the current key byte for blocks of the source
+    auto recount = [&](auto source)
+    {
+        auto body = [&, source](size_t thread, size_t, size_t)
+        {
+            std::array<size_t, 256>& current = offsets[thread];
+            current.fill(0);
+            for (size_t i = bounds[thread]; i < bounds[thread + 1]; ++i)
+                ++current[Traits::byte(key(source[i]), digit)];
+        };
+        RadixExecute(pool, threads, threads, body);
+    };
+
+    // Scatter blocks of the source into the destination by offsets of the current key byte
+    auto scatter = [&](auto source, auto destination, bool construct)
+    {
+        auto body = [&, source, destination, construct](size_t thread, size_t, size_t)
+        {
+            std::array<size_t, 256>& current = offsets[thread];
+            for (size_t i = bounds[thread]; i < bounds[thread + 1]; ++i)
+            {
+                auto& item = source[i];
+                size_t index = current[Traits::byte(key(item), digit)]++;
+                if (construct)
+                    ::new ((void*)std::addressof(destination[index])) T(std::move(item));
+                else
+                    destination[index] = std::move(item);
+            }
+        };
+        RadixExecute(pool, threads, threads, body);
+    };
+
+    bool swapped = false;
+    for (size_t pass = 0; pass < digits.size(); ++pass)
+    {
+        digit = digits[pass];
+
+        // The first pass reuses histograms of the initial order,
+        // histograms of the only block are the same for all passes
+        if ((pass == 0) || (threads == 1))
+        {
+            for (size_t thread = 0; thread < threads; ++thread)
+                offsets[thread] = histograms[thread * BYTES + digit];
+        }
+        else if (swapped)
+            recount(buffer);
+        else
+            recount(first);
+
+        // Offsets of buckets: buckets in order, blocks of each bucket in order
+        size_t offset = 0;
+        for (size_t byte = 0; byte < 256; ++byte)
+        {
+            for (size_t thread = 0; thread < threads; ++thread)
+            {
+                size_t current = offsets[thread][byte];
+                offsets[thread][byte] = offset;
+                offset += current;
+            }
+        }
+
+        if (swapped)
+            scatter(buffer, first, false);
+        else
+            scatter(first, buffer, (pass == 0));
+        swapped = !swapped;
+    }
+
+    // Move sorted elements back from the scratch memory
+    if (swapped)
+    {
+        auto body = [first, buffer, &bounds](size_t thread, size_t, size_t)
+        {
+            for (size_t i = bounds[thread]; i < bounds[thread + 1]; ++i)
+                first[i] = std::move(buffer[i]);
+        };
+        RadixExecute(pool, threads, threads, body);
+    }
+
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        std::destroy(buffer, buffer + count);
+}
+
+// Get the string key digit at the given depth: 0 - end of the key, 1 + byte otherwise
+template <typename TIterator, class TKey>
+inline uint16_t RadixDigit(TIterator it, TKey& key, size_t depth)
+{
+    decltype(auto) k = key(*it);
+    std::string_view view(k);
+    return (depth < view.size()) ? (uint16_t)(1 + (uint8_t)view[depth]) : 0;
+}
+
+// Permute elements in place into buckets of cached digits (American flag sort)
+template <typename TIterator>
+inline void RadixPermute(TIterator first, uint16_t* digits, const std::array<size_t, 257>& counts, std::array<size_t, 258>& starts)
+{
+    starts[0] = 0;
+    for (size_t bucket = 0; bucket < 257; ++bucket)
+        starts[bucket + 1] = starts[bucket] + counts[bucket];
+
+    std::array<size_t, 257> next;
+    std::copy(starts.begin(), starts.begin() + 257, next.begin());
+
+    for (size_t bucket = 0; bucket < 257; ++bucket)
+    {
+        while (next[bucket] < starts[bucket + 1])
+        {
+            size_t i = next[bucket];
+            uint16_t digit = digits[i];
+            if (digit == bucket)
+            {
+                ++next[bucket];
+                continue;
+            }
+
+            // Move the element into the next free place of its bucket
+            size_t j = next[digit]++;
+            using std::swap;
+            swap(first[i], first[j]);
+            std::swap(digits[i], digits[j]);
+        }
+    }
+}
+
+// Most significant digit radix sort of string keys with the common prefix of the given depth
+template <typename TIterator, class TKey>
+inline void RadixSortMSDRange(TIterator first, size_t count, size_t depth, uint16_t* digits, TKey& key)
+{
+    typedef typename std::iterator_traits<TIterator>::value_type T;
+
+    struct Task
+    {
+        size_t offset;
+        size_t count;
+        size_t depth;
+    };
+
+    // Explicit stack of ranges instead of the recursion for long keys
+    std::vector<Task> stack;
+    stack.push_back(Task{ 0, count, depth });
+    while (!stack.empty())
+    {
+        Task task = stack.back();
+        stack.pop_back();
+
+        TIterator begin = first + task.offset;
+        uint16_t* cache = digits + task.offset;
+
+        // Sort small ranges with the comparison sort
+        if (task.count < 32)
+        {
+            size_t prefix = task.depth;
+            std::sort(begin, begin + task.count, [&key, prefix](const T& item1, const T& item2)
+            {
+                decltype(auto) key1 = key(item1);
+                decltype(auto) key2 = key(item2);
+                return std::string_view(key1).substr(prefix) < std::string_view(key2).substr(prefix);
+            });
+            continue;
+        }
+
+        std::array<size_t, 257> counts{};
+        for (size_t i = 0; i < task.count; ++i)
+            ++counts[cache[i] = RadixDigit(begin + i, key, task.depth)];
+
+        // Skip the common key byte
+        if (counts[cache[0]] == task.count)
+        {
+            if (cache[0] != 0)
+                stack.push_back(Task{ task.offset, task.count, task.depth + 1 });
+            continue;
+        }
+
+        std::array<size_t, 258> starts;
+        RadixPermute(begin, cache, counts, starts);
+
+        // Keys of the first bucket are already sorted (ended at the current depth)
+        for (size_t bucket = 1; bucket < 257; ++bucket)
+            if (counts[bucket] > 1)
+                stack.push_back(Task{ task.offset + starts[bucket], counts[bucket], task.depth + 1 });
+    }
+}
+
+// Most significant digit radix sort of string keys
+template <typename TIterator, class TKey, class TMemoryManager>
+inline void RadixSortMSD(ThreadPool* pool, TIterator first, size_t count, TKey& key, TMemoryManager& manager, const ParallelOptions& options)
+{
+    // Cache of the current key digit of each element
+    RadixBuffer<uint16_t, TMemoryManager> scratch(manager, count);
+    uint16_t* digits = scratch.data();
+
+    size_t threads = RadixThreads(pool, count, options);
+    if (threads <= 1)
+    {
+        RadixSortMSDRange(first, count, 0, digits, key);
+        return;
+    }
+
+    std::vector<size_t> bounds(threads + 1);
+    for (size_t i = 0; i <= threads; ++i)
+        bounds[i] = count * i / threads;
+
+    // Cache first key digits and count histograms in parallel
+    std::vector<std::array<size_t, 257>> histograms(threads);
+    auto histogram = [first, &key, digits, &bounds, &histograms](size_t thread, size_t, size_t)
+    {
+        std::array<size_t, 257>& current = histograms[thread];
+        for (size_t i = bounds[thread]; i < bounds[thread + 1]; ++i)
+            ++current[digits[i] = RadixDigit(first + i, key, 0)];
+    };
+    RadixExecute(pool, threads, threads, histogram);
+
+    std::array<size_t, 257> counts{};
+    for (const auto& current : histograms)
+        for (size_t bucket = 0; bucket < 257; ++bucket)
+            counts[bucket] += current[bucket];
+
+    std::array<size_t, 258> starts;
+    RadixPermute(first, digits, counts, starts);
+
+    // Sort buckets of the first key byte in parallel
+    auto sort = [first, &key, digits, &counts, &starts](size_t task, size_t, size_t)
+    {
+        size_t bucket = task + 1;
+        if (counts[bucket] > 1)
+            RadixSortMSDRange(first + starts[bucket], counts[bucket], 1, digits + starts[bucket], key);
+    };
+    RadixExecute(pool, 256, threads, sort);
+}
+
+// Radix sort dispatched by the key type
+template <typename TIterator, class TKey, class TMemoryManager>
+inline void RadixSortDispatch(ThreadPool* pool, TIterator first, TIterator last, TKey& key, TMemoryManager& manager, const ParallelOptions& options)
+{
+    typedef typename std::iterator_traits<TIterator>::value_type T;
+    typedef std::decay_t<std::invoke_result_t<TKey&, const T&>> K;
+
+    size_t count = (size_t)std::distance(first, last);
+    if (count < 2)
+        return;
+
+    if constexpr (std::is_convertible_v<const K&, std::string_view>)
+        RadixSortMSD(pool, first, count, key, manager, options);
+    else
+    {
+        // Sort small ranges with the stable comparison sort
+        if (count < 256)
+        {
+            std::stable_sort(first, last, [&key](const T& item1, const T& item2) { return RadixLess<RadixSortTraits<K>>(key(item1), key(item2)); });
+            return;
+        }
+
+        RadixSortLSD(pool, first, count, key, manager, options);
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename TIterator, class TKey>
+inline void RadixSort(TIterator first, TIterator last, TKey key)
+{
+    DefaultMemoryManager manager;
+    Internals::RadixSortDispatch(nullptr, first, last, key, manager, ParallelOptions());
+}
+
+template <typename TIterator, class TKey, class TMemoryManager>
+inline void RadixSort(TIterator first, TIterator last, TKey key, TMemoryManager& manager)
+{
+    Internals::RadixSortDispatch(nullptr, first, last, key, manager, ParallelOptions());
+}
+
+template <typename TIterator, class TKey>
+inline void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, TKey key, const ParallelOptions& options)
+{
+    DefaultMemoryManager manager;
+    Internals::RadixSortDispatch(&pool, first, last, key, manager, options);
+}
+
+template <typename TIterator, class TKey, class TMemoryManager, std::enable_if_t<!std::is_same_v<std::remove_cv_t<TMemoryManager>, ParallelOptions>, int>>
+inline void ParallelRadixSort(ThreadPool& pool, TIterator first, TIterator last, TKey key, TMemoryManager& manager, const ParallelOptions& options)
+{
+    Internals::RadixSortDispatch(&pool, first, last, key, manager, options);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,112 @@
+/*!
+    \file sliding_window.h
+    \brief Sliding window rate limit algorithm definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_SLIDING_WINDOW_H
+#define CPPCOMMON_ALGORITHMS_SLIDING_WINDOW_H
+
+#include "algorithms/token_bucket.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Sliding window rate limit algorithm
+/*!
+    Lock-free implementation of the sliding window counter rate limit
+    algorithm. Limiter allows up to the given count of requests during any
+    window of the given duration. Instead of keeping the log of all request
+    times it keeps counters of the current and the previous fixed windows and
+    estimates the count of requests in the sliding window by weighting the
+    previous window counter with its overlap.
+
+    The whole state (window number and both counters) is packed into a single
+    64-bit atomic value, so the limit is restricted with 65535 requests per
+    window.
+
+    Thread-safe.
+*/
+class SlidingWindow
+{
+public:
+    //! Maximal count of requests per window
+    static const uint64_t MAX_LIMIT = 0xFFFF;
+
+    //! Initialize the sliding window rate limiter
+    /*!
+        \param limit - Maximal count of requests per window (up to MAX_LIMIT)
+        \param window - Window duration (default is 1 second)
+        \param clock - Limiter clock (default is TokenBucketClock::TSC)
+    */
+    SlidingWindow(uint64_t limit, const Timespan& window = Timespan::seconds(1), TokenBucketClock clock = TokenBucketClock::TSC);
+    SlidingWindow(const SlidingWindow& sw);
+    SlidingWindow(SlidingWindow&&) = delete;
+    ~SlidingWindow() = default;
+
+    SlidingWindow& operator=(const SlidingWindow& sw);
+    SlidingWindow& operator=(SlidingWindow&&) = delete;
+
+    //! Get the maximal count of requests per window
+    uint64_t limit() const noexcept { return _limit; }
+    //! Get the window duration
+    Timespan window() const noexcept { return Timespan((int64_t)_window); }
+
+    //! Get the limiter clock
+    TokenBucketClock clock() const noexcept { return _clock; }
+    //! Get the current time of the limiter clock
+    uint64_t now() const { return Internals::TokenBucketNow(_clock); }
+
+    //! Get the estimated count of requests in the sliding window at the given time
+    uint64_t Count(uint64_t now) const noexcept;
+
+    //! Try to consume the given count of requests
+    /*!
+        \param requests - Requests to consume (default is 1)
+        \return 'true' if requests were allowed, 'false' if requests were limited
+    */
+    bool Consume(uint64_t requests = 1) { return (TryConsume(requests, now()) == Timespan::zero()); }
+
+    //! Try to consume the given count of requests and get the wait time hint
+    /*!
+        \param requests - Requests to consume (default is 1)
+        \return Zero timespan if requests were allowed, otherwise estimated time until requests will be allowed
+                (maximal timespan if the count of requests is greater than the limit)
+    */
+    Timespan TryConsume(uint64_t requests = 1) { return TryConsume(requests, now()); }
+    //! Try to consume the given count of requests at the given time and get the wait time hint
+    /*!
+        \param requests - Requests to consume
+        \param now - Current time of the limiter clock (see now())
+        \return Zero timespan if requests were allowed, otherwise estimated time until requests will be allowed
+                (maximal timespan if the count of requests is greater than the limit)
+    */
+    Timespan TryConsume(uint64_t requests, uint64_t now);
+
+    //! Reset the limiter
+    void Reset() noexcept { _state.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> _state;
+    uint64_t _limit;
+    uint64_t _window;
+    TokenBucketClock _clock;
+
+    // Get the state which is actual for the given window number
+    static uint64_t Actualize(uint64_t state, uint64_t number) noexcept;
+    // Estimate the count of requests in the sliding window
+    uint64_t Estimate(uint64_t state, uint64_t elapsed) const noexcept;
+};
+
+/*! \example algorithms_sliding_window.cpp Sliding window rate limit algorithm example */
+
+} // namespace CppCommon
+
+#include "sliding_window.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_SLIDING_WINDOW_H
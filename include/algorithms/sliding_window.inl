@@ -0,0 +1,38 @@
+/*!
+    \file sliding_window.inl
+    \brief Sliding window rate limit algorithm inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SlidingWindow::SlidingWindow(uint64_t limit, const Timespan& window, TokenBucketClock clock)
+    : _state(0),
+      _limit(limit),
+      _window((uint64_t)window.total()),
+      _clock(clock)
+{
+    assert(((limit > 0) && (limit <= MAX_LIMIT)) && "Sliding window limit must be in range [1, 65535]!");
+    assert((window.total() > 0) && "Sliding window duration must be positive!");
+}
+
+inline SlidingWindow::SlidingWindow(const SlidingWindow& sw)
+    : _state(sw._state.load()),
+      _limit(sw._limit),
+      _window(sw._window),
+      _clock(sw._clock)
+{
+}
+
+inline SlidingWindow& SlidingWindow::operator=(const SlidingWindow& sw)
+{
+    _state = sw._state.load();
+    _limit = sw._limit;
+    _window = sw._window;
+    _clock = sw._clock;
+    return *this;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,186 @@
+/*!
+    \file timing_wheel.h
+    \brief Hierarchical timing wheel definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_TIMING_WHEEL_H
+#define CPPCOMMON_ALGORITHMS_TIMING_WHEEL_H
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Hierarchical timing wheel
+/*!
+    Hierarchical timing wheel is used to track a large amount of deadlines
+    (timeouts, TTLs) with O(1) insert and remove operations.
+
+    Timing wheel contains four levels of slots. With the default resolution
+    of one millisecond they are milliseconds (1000 slots), seconds (60 slots),
+    minutes (60 slots) and hours (24 slots) wheels. New deadlines are placed
+    into the lowest level that covers them and are cascaded into lower levels
+    when the upper level slot is reached. Deadlines far beyond the top level
+    are cascaded in the top level until they come into its range.
+
+    Advance operation touches only slots which are reached by the current
+    time and skips empty levels, so it stays cheap after long idle periods.
+
+    Deadlines are never expired before their time, but could be expired up
+    to one resolution tick later.
+
+    Not thread-safe.
+*/
+template <typename T>
+class TimingWheel
+{
+public:
+    //! Timing wheel handle type
+    /*!
+        Handle is used to remove the deadline from the timing wheel.
+        Stale handles (already expired or removed) are safely detected.
+    */
+    typedef uint64_t Handle;
+
+    //! Invalid timing wheel handle
+    static constexpr Handle INVALID = std::numeric_limits<Handle>::max();
+
+    //! Initialize the timing wheel
+    /*!
+        \param start - Start timestamp (default is UtcTimestamp())
+        \param resolution - Timing wheel resolution (default is 1 millisecond)
+    */
+    explicit TimingWheel(const Timestamp& start = UtcTimestamp(), const Timespan& resolution = Timespan::milliseconds(1));
+    TimingWheel(const TimingWheel&) = default;
+    TimingWheel(TimingWheel&&) = default;
+    ~TimingWheel() = default;
+
+    TimingWheel& operator=(const TimingWheel&) = default;
+    TimingWheel& operator=(TimingWheel&&) = default;
+
+    //! Check if the timing wheel is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the timing wheel empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the timing wheel size
+    size_t size() const noexcept { return _size; }
+
+    //! Get the timing wheel resolution
+    Timespan resolution() const noexcept { return Timespan(_resolution); }
+    //! Get the timing wheel current timestamp (all deadlines before it are expired)
+    Timestamp current() const noexcept { return Timestamp(_current * _resolution); }
+
+    //! Insert a new deadline into the timing wheel
+    /*!
+        Deadlines in the past will be expired with the next advance.
+
+        \param deadline - Deadline timestamp
+        \param value - Value to expire
+        \return Timing wheel handle
+    */
+    Handle insert(const Timestamp& deadline, const T& value);
+    //! Insert a new deadline into the timing wheel
+    /*!
+        \param deadline - Deadline timestamp
+        \param value - Value to expire
+        \return Timing wheel handle
+    */
+    Handle insert(const Timestamp& deadline, T&& value);
+
+    //! Remove the deadline from the timing wheel
+    /*!
+        \param handle - Timing wheel handle
+        \return 'true' if the deadline was removed, 'false' if the given handle is stale
+    */
+    bool remove(Handle handle);
+
+    //! Advance the timing wheel to the given timestamp
+    /*!
+        Handler is called for each expired value with the signature 'void (T& value)'.
+        It is allowed to insert new deadlines from the handler.
+
+        \param timestamp - Timestamp to advance
+        \param handler - Expire handler
+        \return Count of expired values
+    */
+    template <class THandler>
+    size_t advance(const Timestamp& timestamp, THandler&& handler);
+    //! Advance the timing wheel to the given timestamp expiring not more than the given count of values
+    /*!
+        Expiration stops after the given count of values. The next advance
+        call continues from the same place, so large expiration bursts could
+        be split into small bounded chunks.
+
+        \param timestamp - Timestamp to advance
+        \param handler - Expire handler
+        \param limit - Maximal count of values to expire
+        \return Count of expired values
+    */
+    template <class THandler>
+    size_t advance(const Timestamp& timestamp, THandler&& handler, size_t limit);
+
+    //! Clear the timing wheel
+    void clear();
+
+    //! Swap two instances
+    void swap(TimingWheel& wheel) noexcept;
+    template <typename U>
+    friend void swap(TimingWheel<U>& wheel1, TimingWheel<U>& wheel2) noexcept;
+
+private:
+    static constexpr size_t LEVELS = 4;
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+    static constexpr uint64_t CANCELLED = std::numeric_limits<uint64_t>::max();
+
+    struct Node
+    {
+        T value;
+        uint64_t deadline;
+        uint32_t generation;
+        uint32_t prev;
+        uint32_t next;
+        uint32_t slot;
+    };
+
+    uint64_t _resolution;
+    uint64_t _current;
+    size_t _size;
+    std::vector<Node> _nodes;
+    uint32_t _free;
+    uint32_t _pending;
+    std::vector<uint32_t> _slots;
+    size_t _counts[LEVELS];
+
+    static constexpr size_t SLOT_COUNTS[LEVELS] = { 1000, 60, 60, 24 };
+    static constexpr size_t SLOT_OFFSETS[LEVELS] = { 0, 1000, 1060, 1120 };
+    static constexpr uint64_t SLOT_SPANS[LEVELS] = { 1, 1000, 60000, 3600000 };
+    static constexpr size_t SLOTS = 1144;
+
+    uint32_t allocate();
+    void release(uint32_t index);
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    uint32_t detach(uint32_t slot);
+    void cascade(size_t level, size_t slot);
+    template <class THandler>
+    size_t expire(THandler& handler, size_t limit);
+    size_t place(uint64_t deadline) const noexcept;
+};
+
+/*! \example algorithms_timing_wheel.cpp Hierarchical timing wheel example */
+
+} // namespace CppCommon
+
+#include "timing_wheel.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_TIMING_WHEEL_H
@@ -0,0 +1,299 @@
+/*!
+    \file timing_wheel.inl
+    \brief Hierarchical timing wheel inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline TimingWheel<T>::TimingWheel(const Timestamp& start, const Timespan& resolution)
+    : _resolution((resolution.total() > 0) ? (uint64_t)resolution.total() : 1),
+      _current(start.total() / _resolution),
+      _size(0),
+      _free(NONE),
+      _pending(NONE),
+      _slots(SLOTS, NONE),
+      _counts{ 0, 0, 0, 0 }
+{
+}
+
+template <typename T>
+inline typename TimingWheel<T>::Handle TimingWheel<T>::insert(const Timestamp& deadline, const T& value)
+{
+    return insert(deadline, T(value));
+}
+
+template <typename T>
+inline typename TimingWheel<T>::Handle TimingWheel<T>::insert(const Timestamp& deadline, T&& value)
+{
+    uint32_t index = allocate();
+    Node& node = _nodes[index];
+
+    // Round the deadline up to the next tick to never expire it earlier
+    uint64_t ticks = (deadline.total() + _resolution - 1) / _resolution;
+
+    node.value = std::move(value);
+    node.deadline = (ticks < _current) ? _current : ticks;
+    link(index);
+
+    ++_size;
+    return ((Handle)node.generation << 32) | index;
+}
+
+template <typename T>
+inline bool TimingWheel<T>::remove(Handle handle)
+{
+    uint32_t index = (uint32_t)(handle & 0xFFFFFFFF);
+    uint32_t generation = (uint32_t)(handle >> 32);
+
+    // Check for the stale handle
+    if ((index >= _nodes.size()) || (_nodes[index].generation != generation))
+        return false;
+
+    Node& node = _nodes[index];
+    if (node.slot == NONE)
+    {
+        // Cancel the node waiting for expiration in the advance loop
+        if (node.deadline == CANCELLED)
+            return false;
+        node.deadline = CANCELLED;
+    }
+    else
+    {
+        unlink(index);
+        release(index);
+    }
+
+    --_size;
+    return true;
+}
+
+template <typename T>
+template <class THandler>
+inline size_t TimingWheel<T>::advance(const Timestamp& timestamp, THandler&& handler)
+{
+    return advance(timestamp, handler, std::numeric_limits<size_t>::max());
+}
+
+template <typename T>
+template <class THandler>
+inline size_t TimingWheel<T>::advance(const Timestamp& timestamp, THandler&& handler, size_t limit)
+{
+    uint64_t target = timestamp.total() / _resolution;
+
+    // Expire values of the previously detached slot
+    size_t expired = expire(handler, limit);
+
+    while ((_current <= target) && (expired < limit))
+    {
+        // Fast forward the empty timing wheel
+        if (_size == 0)
+        {
+            _current = target + 1;
+            break;
+        }
+
+        // Cascade upper levels slots reached by the current tick
+        for (size_t level = LEVELS - 1; level > 0; --level)
+            if ((_current % SLOT_SPANS[level]) == 0)
+                cascade(level, SLOT_OFFSETS[level] + (_current / SLOT_SPANS[level]) % SLOT_COUNTS[level]);
+
+        // Detach the current tick slot
+        _pending = detach((uint32_t)(_current % SLOT_COUNTS[0]));
+
+        // Calculate the next tick skipping empty levels
+        uint64_t next = _current + 1;
+        for (size_t level = 0; (level < (LEVELS - 1)) && (_counts[level] == 0); ++level)
+            next = (_current / SLOT_SPANS[level + 1] + 1) * SLOT_SPANS[level + 1];
+        _current = (next < (target + 1)) ? next : (target + 1);
+
+        // Expire values of the detached slot
+        expired += expire(handler, limit - expired);
+    }
+
+    return expired;
+}
+
+template <typename T>
+template <class THandler>
+inline size_t TimingWheel<T>::expire(THandler& handler, size_t limit)
+{
+    size_t expired = 0;
+    while ((_pending != NONE) && (expired < limit))
+    {
+        uint32_t index = _pending;
+        _pending = _nodes[index].next;
+        if (_nodes[index].deadline != CANCELLED)
+        {
+            T value = std::move(_nodes[index].value);
+            release(index);
+            --_size;
+            ++expired;
+            handler(value);
+        }
+        else
+            release(index);
+    }
+
+    // Release cancelled values left at the end of the detached slot
+    while ((_pending != NONE) && (_nodes[_pending].deadline == CANCELLED))
+    {
+        uint32_t index = _pending;
+        _pending = _nodes[index].next;
+        release(index);
+    }
+
+    return expired;
+}
+
+template <typename T>
+inline void TimingWheel<T>::clear()
+{
+    _size = 0;
+    _nodes.clear();
+    _free = NONE;
+    _pending = NONE;
+    std::fill(_slots.begin(), _slots.end(), NONE);
+    for (auto& count : _counts)
+        count = 0;
+}
+
+template <typename T>
+inline uint32_t TimingWheel<T>::allocate()
+{
+    // Reuse the free node
+    if (_free != NONE)
+    {
+        uint32_t index = _free;
+        _free = _nodes[index].next;
+        return index;
+    }
+
+    // Allocate a new node
+    Node node;
+    node.generation = 0;
+    node.slot = NONE;
+    _nodes.emplace_back(std::move(node));
+    return (uint32_t)(_nodes.size() - 1);
+}
+
+template <typename T>
+inline void TimingWheel<T>::release(uint32_t index)
+{
+    Node& node = _nodes[index];
+    node.value = T();
+    node.slot = NONE;
+    ++node.generation;
+    node.next = _free;
+    _free = index;
+}
+
+template <typename T>
+inline size_t TimingWheel<T>::place(uint64_t deadline) const noexcept
+{
+    // Find the lowest level which covers the given deadline
+    for (size_t level = 0; level < (LEVELS - 1); ++level)
+        if ((deadline / SLOT_SPANS[level + 1]) == (_current / SLOT_SPANS[level + 1]))
+            return SLOT_OFFSETS[level] + (deadline / SLOT_SPANS[level]) % SLOT_COUNTS[level];
+
+    // Place the deadline into the top level
+    const size_t top = LEVELS - 1;
+    uint64_t slot = deadline / SLOT_SPANS[top];
+    uint64_t limit = _current / SLOT_SPANS[top] + SLOT_COUNTS[top] - 1;
+    return SLOT_OFFSETS[top] + ((slot < limit) ? slot : limit) % SLOT_COUNTS[top];
+}
+
+template <typename T>
+inline void TimingWheel<T>::link(uint32_t index)
+{
+    Node& node = _nodes[index];
+    node.slot = (uint32_t)place(node.deadline);
+    node.prev = NONE;
+    node.next = _slots[node.slot];
+    if (node.next != NONE)
+        _nodes[node.next].prev = index;
+    _slots[node.slot] = index;
+
+    size_t level = LEVELS - 1;
+    while (node.slot < SLOT_OFFSETS[level])
+        --level;
+    ++_counts[level];
+}
+
+template <typename T>
+inline void TimingWheel<T>::unlink(uint32_t index)
+{
+    Node& node = _nodes[index];
+    if (node.prev != NONE)
+        _nodes[node.prev].next = node.next;
+    else
+        _slots[node.slot] = node.next;
+    if (node.next != NONE)
+        _nodes[node.next].prev = node.prev;
+
+    size_t level = LEVELS - 1;
+    while (node.slot < SLOT_OFFSETS[level])
+        --level;
+    --_counts[level];
+}
+
+template <typename T>
+inline uint32_t TimingWheel<T>::detach(uint32_t slot)
+{
+    uint32_t head = _slots[slot];
+    _slots[slot] = NONE;
+
+    size_t level = LEVELS - 1;
+    while (slot < SLOT_OFFSETS[level])
+        --level;
+
+    // Mark all detached nodes as unlinked
+    for (uint32_t index = head; index != NONE; index = _nodes[index].next)
+    {
+        _nodes[index].slot = NONE;
+        --_counts[level];
+    }
+
+    return head;
+}
+
+template <typename T>
+inline void TimingWheel<T>::cascade(size_t level, size_t slot)
+{
+    if (_counts[level] == 0)
+        return;
+
+    // Re-link all nodes of the slot into lower levels
+    uint32_t index = detach((uint32_t)slot);
+    while (index != NONE)
+    {
+        uint32_t next = _nodes[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+template <typename T>
+inline void TimingWheel<T>::swap(TimingWheel& wheel) noexcept
+{
+    using std::swap;
+    swap(_resolution, wheel._resolution);
+    swap(_current, wheel._current);
+    swap(_size, wheel._size);
+    swap(_nodes, wheel._nodes);
+    swap(_free, wheel._free);
+    swap(_pending, wheel._pending);
+    swap(_slots, wheel._slots);
+    swap(_counts, wheel._counts);
+}
+
+template <typename T>
+inline void swap(TimingWheel<T>& wheel1, TimingWheel<T>& wheel2) noexcept
+{
+    wheel1.swap(wheel2);
+}
+
+} // namespace CppCommon
@@ -9,11 +9,51 @@
 #ifndef CPPCOMMON_ALGORITHMS_TOKEN_BUCKET_H
 #define CPPCOMMON_ALGORITHMS_TOKEN_BUCKET_H
 
+#include "containers/concurrent_hashmap.h"
+#include "memory/cache_padded.h"
+#include "time/timespan.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <functional>
+#include <limits>
 
 namespace CppCommon {
 
+//! Token bucket clock
+enum class TokenBucketClock
+{
+    Nano,                   //!< High resolution timestamp (Timestamp::nano())
+    CoarseNano,             //!< Coarse high resolution timestamp (Timestamp::coarse_nano())
+    TSC                     //!< Calibrated TSC timestamp (Timestamp::tsc())
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Get the current time of the given token bucket clock
+uint64_t TokenBucketNow(TokenBucketClock clock);
+
+// Consume tokens from the token bucket state and return the wait time in nanoseconds (zero if tokens were consumed)
+uint64_t TokenBucketConsume(std::atomic<uint64_t>& time, uint64_t time_per_token, uint64_t time_per_burst, uint64_t tokens, uint64_t now) noexcept;
+// Consume up to the given count of tokens from the token bucket state and return the count of consumed tokens
+uint64_t TokenBucketConsumeUpTo(std::atomic<uint64_t>& time, uint64_t time_per_token, uint64_t time_per_burst, uint64_t tokens, uint64_t now) noexcept;
+
+// Compact per-key token bucket state
+struct TokenBucketState
+{
+    mutable std::atomic<uint64_t> time;
+
+    TokenBucketState() noexcept : time(0) {}
+    TokenBucketState(const TokenBucketState& state) noexcept : time(state.time.load(std::memory_order_relaxed)) {}
+    TokenBucketState& operator=(const TokenBucketState& state) noexcept
+    { time.store(state.time.load(std::memory_order_relaxed), std::memory_order_relaxed); return *this; }
+};
+
+} // namespace Internals
+//! @endcond
+
 //! Token bucket rate limit algorithm
 /*!
     Lock-free implementation of the token bucket rate limit algorithm.
@@ -26,6 +66,11 @@ namespace CppCommon {
     limits on bandwidth and burstiness (a measure of the unevenness or
     variations in the traffic flow).
 
+    Token bucket reads the calibrated TSC clock by default. Coarse clock
+    is even cheaper but has the granularity of the system tick. Callers
+    which check several buckets per request might read the clock once with
+    now() and pass it to TryConsume().
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Token_bucket
@@ -40,8 +85,9 @@ public:
 
         \param rate - Rate of tokens per second to accumulate in the token bucket
         \param burst - Maximum of burst tokens in the token bucket
+        \param clock - Token bucket clock (default is TokenBucketClock::TSC)
     */
-    TokenBucket(uint64_t rate, uint64_t burst);
+    TokenBucket(uint64_t rate, uint64_t burst, TokenBucketClock clock = TokenBucketClock::TSC);
     TokenBucket(const TokenBucket& tb);
     TokenBucket(TokenBucket&&) = delete;
     ~TokenBucket() = default;
@@ -49,6 +95,11 @@ public:
     TokenBucket& operator=(const TokenBucket& tb);
     TokenBucket& operator=(TokenBucket&&) = delete;
 
+    //! Get the token bucket clock
+    TokenBucketClock clock() const noexcept { return _clock; }
+    //! Get the current time of the token bucket clock
+    uint64_t now() const { return Internals::TokenBucketNow(_clock); }
+
     //! Try to consume the given count of tokens
     /*!
         \param tokens - Tokens to consume (default is 1)
@@ -56,10 +107,119 @@ public:
     */
     bool Consume(uint64_t tokens = 1);
 
+    //! Try to consume the given count of tokens and get the wait time hint
+    /*!
+        \param tokens - Tokens to consume (default is 1)
+        \return Zero timespan if all tokens were successfully consumed, otherwise time until the required count of tokens
+                is available (maximal timespan if the count of tokens is greater than the burst)
+    */
+    Timespan TryConsume(uint64_t tokens = 1) { return TryConsume(tokens, now()); }
+    //! Try to consume the given count of tokens at the given time and get the wait time hint
+    /*!
+        \param tokens - Tokens to consume
+        \param now - Current time of the token bucket clock (see now())
+        \return Zero timespan if all tokens were successfully consumed, otherwise time until the required count of tokens
+                is available (maximal timespan if the count of tokens is greater than the burst)
+    */
+    Timespan TryConsume(uint64_t tokens, uint64_t now);
+
+    //! Consume up to the given count of tokens
+    /*!
+        Batched acquire consumes all available tokens but not more than requested.
+
+        \param tokens - Maximal count of tokens to consume
+        \return Count of consumed tokens
+    */
+    uint64_t ConsumeUpTo(uint64_t tokens);
+
 private:
-    std::atomic<uint64_t> _time;
+    CachePadded<std::atomic<uint64_t>> _time;
     std::atomic<uint64_t> _time_per_token;
     std::atomic<uint64_t> _time_per_burst;
+    TokenBucketClock _clock;
+};
+
+//! Keyed token bucket rate limit algorithm
+/*!
+    Token bucket set keeps a separate token bucket for each key (e.g. tenant
+    or client address) with the same rate and burst. Per-key state is a single
+    64-bit time value stored in the lock-striped concurrent hash map, so the
+    consume operation takes only the stripe read lock and performs the same
+    lock-free update as TokenBucket. Unknown keys get a full bucket on the
+    first consume.
+
+    Thread-safe.
+*/
+template <typename TKey, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>>
+class TokenBucketSet
+{
+public:
+    //! Initialize the token bucket set
+    /*!
+        \param rate - Rate of tokens per second to accumulate in each token bucket
+        \param burst - Maximum of burst tokens in each token bucket
+        \param blank - Blank key value which is never used as a key (default is TKey())
+        \param capacity - Initial capacity of the token bucket set (default is 1024)
+        \param clock - Token bucket clock (default is TokenBucketClock::TSC)
+    */
+    TokenBucketSet(uint64_t rate, uint64_t burst, const TKey& blank = TKey(), size_t capacity = 1024, TokenBucketClock clock = TokenBucketClock::TSC);
+    TokenBucketSet(const TokenBucketSet&) = delete;
+    TokenBucketSet(TokenBucketSet&&) = delete;
+    ~TokenBucketSet() = default;
+
+    TokenBucketSet& operator=(const TokenBucketSet&) = delete;
+    TokenBucketSet& operator=(TokenBucketSet&&) = delete;
+
+    //! Is the token bucket set empty?
+    bool empty() const { return _buckets.empty(); }
+    //! Get the count of token buckets in the set
+    size_t size() const { return _buckets.size(); }
+
+    //! Get the token bucket clock
+    TokenBucketClock clock() const noexcept { return _clock; }
+    //! Get the current time of the token bucket clock
+    uint64_t now() const { return Internals::TokenBucketNow(_clock); }
+
+    //! Try to consume the given count of tokens from the token bucket with the given key
+    /*!
+        \param key - Token bucket key
+        \param tokens - Tokens to consume (default is 1)
+        \return 'true' if all tokens were successfully consumed, 'false' if the token bucket is lack of required count of tokens
+    */
+    bool Consume(const TKey& key, uint64_t tokens = 1) { return (TryConsume(key, tokens, now()) == Timespan::zero()); }
+
+    //! Try to consume the given count of tokens from the token bucket with the given key and get the wait time hint
+    /*!
+        \param key - Token bucket key
+        \param tokens - Tokens to consume (default is 1)
+        \return Zero timespan if all tokens were successfully consumed, otherwise time until the required count of tokens
+                is available (maximal timespan if the count of tokens is greater than the burst)
+    */
+    Timespan TryConsume(const TKey& key, uint64_t tokens = 1) { return TryConsume(key, tokens, now()); }
+    //! Try to consume the given count of tokens from the token bucket with the given key at the given time and get the wait time hint
+    /*!
+        \param key - Token bucket key
+        \param tokens - Tokens to consume
+        \param now - Current time of the token bucket clock (see now())
+        \return Zero timespan if all tokens were successfully consumed, otherwise time until the required count of tokens
+                is available (maximal timespan if the count of tokens is greater than the burst)
+    */
+    Timespan TryConsume(const TKey& key, uint64_t tokens, uint64_t now);
+
+    //! Erase the token bucket with the given key
+    /*!
+        \param key - Token bucket key
+        \return 'true' if the token bucket was erased, 'false' if the given key was not found
+    */
+    bool Erase(const TKey& key) { return _buckets.erase(key); }
+    //! Clear all token buckets
+    void Clear() { _buckets.clear(); }
+
+private:
+    uint64_t _time_per_token;
+    uint64_t _time_per_burst;
+    TokenBucketClock _clock;
+    ConcurrentHashMap<TKey, Internals::TokenBucketState, THash, TEqual> _buckets;
 };
 
 /*! \example algorithms_token_bucket.cpp Token bucket rate limit algorithm example */
@@ -8,27 +8,85 @@
 
 namespace CppCommon {
 
-inline TokenBucket::TokenBucket(uint64_t rate, uint64_t burst)
+//! @cond INTERNALS
+namespace Internals {
+
+// Convert the token bucket wait time in nanoseconds into the timespan
+inline Timespan TokenBucketWait(uint64_t wait) noexcept
+{
+    return Timespan((int64_t)std::min(wait, (uint64_t)std::numeric_limits<int64_t>::max()));
+}
+
+} // namespace Internals
+//! @endcond
+
+inline TokenBucket::TokenBucket(uint64_t rate, uint64_t burst, TokenBucketClock clock)
     : _time(0),
       _time_per_token(1000000000 / rate),
-      _time_per_burst(burst * _time_per_token)
+      _time_per_burst(burst * _time_per_token),
+      _clock(clock)
 {
 
 }
 
 inline TokenBucket::TokenBucket(const TokenBucket& tb)
-    : _time(tb._time.load()),
+    : _time(tb._time->load()),
       _time_per_token(tb._time_per_token.load()),
-      _time_per_burst(tb._time_per_burst.load())
+      _time_per_burst(tb._time_per_burst.load()),
+      _clock(tb._clock)
 {
 }
 
 inline TokenBucket& TokenBucket::operator=(const TokenBucket& tb)
 {
-    _time = tb._time.load();
+    _time->store(tb._time->load());
     _time_per_token = tb._time_per_token.load();
     _time_per_burst = tb._time_per_burst.load();
+    _clock = tb._clock;
     return *this;
 }
 
+inline bool TokenBucket::Consume(uint64_t tokens)
+{
+    return (Internals::TokenBucketConsume(*_time, _time_per_token.load(std::memory_order_relaxed), _time_per_burst.load(std::memory_order_relaxed), tokens, now()) == 0);
+}
+
+inline Timespan TokenBucket::TryConsume(uint64_t tokens, uint64_t now)
+{
+    return Internals::TokenBucketWait(Internals::TokenBucketConsume(*_time, _time_per_token.load(std::memory_order_relaxed), _time_per_burst.load(std::memory_order_relaxed), tokens, now));
+}
+
+inline uint64_t TokenBucket::ConsumeUpTo(uint64_t tokens)
+{
+    return Internals::TokenBucketConsumeUpTo(*_time, _time_per_token.load(std::memory_order_relaxed), _time_per_burst.load(std::memory_order_relaxed), tokens, now());
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline TokenBucketSet<TKey, THash, TEqual>::TokenBucketSet(uint64_t rate, uint64_t burst, const TKey& blank, size_t capacity, TokenBucketClock clock)
+    : _time_per_token(1000000000 / rate),
+      _time_per_burst(burst * _time_per_token),
+      _clock(clock),
+      _buckets(capacity, blank)
+{
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline Timespan TokenBucketSet<TKey, THash, TEqual>::TryConsume(const TKey& key, uint64_t tokens, uint64_t now)
+{
+    uint64_t wait = 0;
+    auto consume = [this, tokens, now, &wait](const Internals::TokenBucketState& state)
+    {
+        wait = Internals::TokenBucketConsume(state.time, _time_per_token, _time_per_burst, tokens, now);
+    };
+
+    // Fast path: consume tokens from the existing token bucket under the stripe read lock
+    while (!_buckets.visit(key, consume))
+    {
+        // Slow path: insert a new full token bucket (might be concurrently inserted by another thread)
+        _buckets.insert(key, Internals::TokenBucketState());
+    }
+
+    return Internals::TokenBucketWait(wait);
+}
+
 } // namespace CppCommon
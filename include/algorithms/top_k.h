@@ -0,0 +1,109 @@
+/*!
+    \file top_k.h
+    \brief Space-Saving top-K heavy hitters estimator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ALGORITHMS_TOP_K_H
+#define CPPCOMMON_ALGORITHMS_TOP_K_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace CppCommon {
+
+//! Space-Saving top-K heavy hitters estimator
+/*!
+    Space-Saving algorithm tracks the most frequent keys of the stream with
+    the fixed count of counters. Tracked keys are kept in the min-heap by
+    their counts. The new key replaces the key with the minimal count and
+    inherits its count as the overestimation error, so the count of each
+    tracked key is never less than the actual one and overestimates it by
+    not more than the error. Every key with the frequency greater than
+    total / capacity is guaranteed to be tracked.
+
+    Add operation takes O(log(capacity)) time. Estimators could be kept per
+    thread (or per shard) and merged on read.
+
+    Not thread-safe.
+
+    https://www.cs.ucsb.edu/sites/default/files/documents/2005-23.pdf
+*/
+template <typename TKey, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>>
+class TopK
+{
+public:
+    //! Tracked item
+    struct Item
+    {
+        TKey key;           //!< Item key
+        uint64_t count;     //!< Estimated count (never less than the actual one)
+        uint64_t error;     //!< Maximal overestimation of the count
+    };
+
+    //! Initialize the top-K estimator
+    /*!
+        \param capacity - Count of tracked keys
+    */
+    explicit TopK(size_t capacity);
+    TopK(const TopK&) = default;
+    TopK(TopK&&) = default;
+    ~TopK() = default;
+
+    TopK& operator=(const TopK&) = default;
+    TopK& operator=(TopK&&) = default;
+
+    //! Is the estimator empty?
+    bool empty() const noexcept { return _heap.empty(); }
+    //! Get the count of tracked keys
+    size_t size() const noexcept { return _heap.size(); }
+    //! Get the maximal count of tracked keys
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the total count of added keys
+    uint64_t total() const noexcept { return _total; }
+
+    //! Add the given count of the key
+    void Add(const TKey& key, uint64_t count = 1);
+
+    //! Get the estimated count of the key (zero if the key is not tracked)
+    uint64_t Estimate(const TKey& key) const;
+
+    //! Get the top tracked items sorted by count in descending order
+    /*!
+        \param k - Count of items to get (default is 0 - all tracked items)
+        \return Top tracked items
+    */
+    std::vector<Item> Top(size_t k = 0) const;
+
+    //! Merge the given estimator
+    void Merge(const TopK& estimator);
+    //! Clear the estimator
+    void Clear();
+
+private:
+    size_t _capacity;
+    uint64_t _total;
+    std::vector<Item> _heap;
+    std::unordered_map<TKey, size_t, THash, TEqual> _index;
+
+    // Minimal count of the full estimator (zero if the estimator is not full)
+    uint64_t Minimum() const noexcept { return (_heap.size() < _capacity) ? 0 : _heap.front().count; }
+
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    void Swap(size_t index1, size_t index2);
+};
+
+/*! \example algorithms_top_k.cpp Space-Saving top-K heavy hitters estimator example */
+
+} // namespace CppCommon
+
+#include "top_k.inl"
+
+#endif // CPPCOMMON_ALGORITHMS_TOP_K_H
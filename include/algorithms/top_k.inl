@@ -0,0 +1,157 @@
+/*!
+    \file top_k.inl
+    \brief Space-Saving top-K heavy hitters estimator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename THash, typename TEqual>
+inline TopK<TKey, THash, TEqual>::TopK(size_t capacity)
+    : _capacity(capacity), _total(0)
+{
+    assert((capacity > 0) && "Top-K estimator capacity must be positive!");
+
+    _heap.reserve(capacity);
+    _index.reserve(capacity);
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline void TopK<TKey, THash, TEqual>::Add(const TKey& key, uint64_t count)
+{
+    _total += count;
+
+    // Tracked key
+    auto it = _index.find(key);
+    if (it != _index.end())
+    {
+        _heap[it->second].count += count;
+        SiftDown(it->second);
+        return;
+    }
+
+    // New key while the estimator is not full
+    if (_heap.size() < _capacity)
+    {
+        _heap.push_back(Item{ key, count, 0 });
+        _index.emplace(key, _heap.size() - 1);
+        SiftUp(_heap.size() - 1);
+        return;
+    }
+
+    // Replace the key with the minimal count
+    Item& minimal = _heap.front();
+    _index.erase(minimal.key);
+    minimal.error = minimal.count;
+    minimal.count += count;
+    minimal.key = key;
+    _index.emplace(key, 0);
+    SiftDown(0);
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline uint64_t TopK<TKey, THash, TEqual>::Estimate(const TKey& key) const
+{
+    auto it = _index.find(key);
+    return (it != _index.end()) ? _heap[it->second].count : 0;
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline std::vector<typename TopK<TKey, THash, TEqual>::Item> TopK<TKey, THash, TEqual>::Top(size_t k) const
+{
+    std::vector<Item> result(_heap);
+    std::sort(result.begin(), result.end(), [](const Item& item1, const Item& item2) { return item1.count > item2.count; });
+    if ((k > 0) && (k < result.size()))
+        result.resize(k);
+    return result;
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline void TopK<TKey, THash, TEqual>::Merge(const TopK& estimator)
+{
+    // Keys missing in one of estimators might have up to its minimal count
+    uint64_t minimum1 = Minimum();
+    uint64_t minimum2 = estimator.Minimum();
+
+    std::vector<Item> items;
+    items.reserve(_heap.size() + estimator._heap.size());
+    for (const auto& item : _heap)
+    {
+        auto it = estimator._index.find(item.key);
+        if (it != estimator._index.end())
+        {
+            const Item& other = estimator._heap[it->second];
+            items.push_back(Item{ item.key, item.count + other.count, item.error + other.error });
+        }
+        else
+            items.push_back(Item{ item.key, item.count + minimum2, item.error + minimum2 });
+    }
+    for (const auto& item : estimator._heap)
+        if (_index.find(item.key) == _index.end())
+            items.push_back(Item{ item.key, item.count + minimum1, item.error + minimum1 });
+
+    // Keep items with the greatest counts
+    std::sort(items.begin(), items.end(), [](const Item& item1, const Item& item2) { return item1.count > item2.count; });
+    if (items.size() > _capacity)
+        items.resize(_capacity);
+
+    // Rebuild the min-heap
+    std::make_heap(items.begin(), items.end(), [](const Item& item1, const Item& item2) { return item1.count > item2.count; });
+    _heap.swap(items);
+    _index.clear();
+    for (size_t i = 0; i < _heap.size(); ++i)
+        _index.emplace(_heap[i].key, i);
+    _total += estimator._total;
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline void TopK<TKey, THash, TEqual>::Clear()
+{
+    _heap.clear();
+    _index.clear();
+    _total = 0;
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline void TopK<TKey, THash, TEqual>::SiftUp(size_t index)
+{
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (_heap[parent].count <= _heap[index].count)
+            break;
+        Swap(parent, index);
+        index = parent;
+    }
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline void TopK<TKey, THash, TEqual>::SiftDown(size_t index)
+{
+    for (;;)
+    {
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+        size_t minimal = index;
+        if ((left < _heap.size()) && (_heap[left].count < _heap[minimal].count))
+            minimal = left;
+        if ((right < _heap.size()) && (_heap[right].count < _heap[minimal].count))
+            minimal = right;
+        if (minimal == index)
+            break;
+        Swap(minimal, index);
+        index = minimal;
+    }
+}
+
+template <typename TKey, typename THash, typename TEqual>
+inline void TopK<TKey, THash, TEqual>::Swap(size_t index1, size_t index2)
+{
+    std::swap(_heap[index1], _heap[index2]);
+    _index[_heap[index1].key] = index1;
+    _index[_heap[index2].key] = index2;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,98 @@
+/*!
+    \file cache_codec.h
+    \brief Cache codec definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_CACHE_CODEC_H
+#define CPPCOMMON_CACHE_CACHE_CODEC_H
+
+#include <string>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Cache codec
+/*!
+    Cache codec is used to compress cache values transparently. Compressed
+    bytes are stored as is, so the codec name could be used as the content
+    encoding to serve compressed values directly to clients which accept
+    it. The original value size is kept by the cache and provided for
+    the decompression.
+
+    Custom codecs (e.g. zstd with a trained shared dictionary) should
+    implement the same interface.
+
+    Thread-safe.
+*/
+class CacheCodec
+{
+public:
+    CacheCodec() = default;
+    CacheCodec(const CacheCodec&) = delete;
+    CacheCodec(CacheCodec&&) = delete;
+    virtual ~CacheCodec() = default;
+
+    CacheCodec& operator=(const CacheCodec&) = delete;
+    CacheCodec& operator=(CacheCodec&&) = delete;
+
+    //! Get the codec name (content encoding of compressed values)
+    virtual std::string_view name() const noexcept = 0;
+
+    //! Compress the given value
+    /*!
+        \param value - Value to compress
+        \param buffer - Buffer to store compressed bytes
+        \return 'true' if the value was compressed, 'false' if the value could not be compressed
+    */
+    virtual bool compress(std::string_view value, std::string& buffer) const = 0;
+    //! Decompress the given compressed bytes
+    /*!
+        \param data - Compressed bytes
+        \param size - Original value size
+        \param value - Decompressed value
+        \return 'true' if the value was decompressed, 'false' if compressed bytes are malformed
+    */
+    virtual bool decompress(std::string_view data, size_t size, std::string& value) const = 0;
+};
+
+//! LZ4 cache codec
+/*!
+    LZ4 cache codec compresses values into LZ4 blocks. It is fast enough to
+    decompress values on each cache lookup. Optional shared dictionary (e.g.
+    the typical cached document) improves the compression of small values.
+
+    Thread-safe.
+*/
+class LZ4CacheCodec : public CacheCodec
+{
+public:
+    //! Initialize LZ4 cache codec with the given shared dictionary
+    /*!
+        \param dictionary - Shared dictionary (default is "" - no dictionary)
+    */
+    explicit LZ4CacheCodec(const std::string& dictionary = "") : _dictionary(dictionary) {}
+    LZ4CacheCodec(const LZ4CacheCodec&) = delete;
+    LZ4CacheCodec(LZ4CacheCodec&&) = delete;
+    ~LZ4CacheCodec() override = default;
+
+    LZ4CacheCodec& operator=(const LZ4CacheCodec&) = delete;
+    LZ4CacheCodec& operator=(LZ4CacheCodec&&) = delete;
+
+    //! Get the shared dictionary
+    const std::string& dictionary() const noexcept { return _dictionary; }
+
+    std::string_view name() const noexcept override { return "lz4"; }
+
+    bool compress(std::string_view value, std::string& buffer) const override;
+    bool decompress(std::string_view data, size_t size, std::string& value) const override;
+
+private:
+    std::string _dictionary;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CACHE_CACHE_CODEC_H
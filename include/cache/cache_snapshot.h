@@ -0,0 +1,160 @@
+/*!
+    \file cache_snapshot.h
+    \brief Cache snapshot definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_CACHE_SNAPSHOT_H
+#define CPPCOMMON_CACHE_CACHE_SNAPSHOT_H
+
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Cache serializer
+/*!
+    Cache serializer is used to store cache keys and values into cache
+    snapshots and disk tiers. Default serializer copies bytes of trivially
+    copyable types. Custom serializers should provide the same static
+    encode() and decode() methods.
+*/
+template <typename T>
+struct CacheSerializer
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Default cache serializer requires trivially copyable types!");
+
+    //! Append the encoded item to the given buffer
+    static void encode(const T& item, std::string& buffer) { buffer.append((const char*)&item, sizeof(T)); }
+    //! Decode the item from the given data
+    /*!
+        \param data - Encoded item data
+        \param item - Decoded item
+        \return 'true' if the item was successfully decoded, 'false' if the data is malformed
+    */
+    static bool decode(std::string_view data, T& item)
+    {
+        if (data.size() != sizeof(T))
+            return false;
+        std::memcpy(&item, data.data(), sizeof(T));
+        return true;
+    }
+};
+
+//! Cache string serializer
+template <>
+struct CacheSerializer<std::string>
+{
+    static void encode(const std::string& item, std::string& buffer) { buffer.append(item); }
+    static bool decode(std::string_view data, std::string& item) { item.assign(data); return true; }
+};
+
+//! Cache snapshot
+/*!
+    Cache snapshot is a compact binary file of cache entries used to warm
+    caches up after the restart. Snapshot file has the 24 bytes header
+    (magic, count of records, CRC32C checksum of records) followed by
+    records: key size, value size, expiry UTC timestamp in nanoseconds
+    (0 if the entry has no timeout), key and value data.
+
+    Records are appended into the memory buffer, so caches fill it under
+    their shared locks and write it into the file without locks. The
+    snapshot is written sequentially into the temporary file which replaces
+    the snapshot file on commit, so the previous snapshot is never torn.
+
+    Snapshot files are read through the read-only memory mapping.
+
+    Not thread-safe.
+*/
+class CacheSnapshot
+{
+public:
+    //! Snapshot record
+    struct Record
+    {
+        std::string_view key;   //!< Key data
+        std::string_view value; //!< Value data
+        uint64_t expiry;        //!< Expiry UTC timestamp in nanoseconds (0 if the entry has no timeout)
+    };
+
+    //! Size of the snapshot file header (24)
+    static const size_t HEADER_SIZE = 24;
+    //! Size of the snapshot record header (16)
+    static const size_t RECORD_SIZE = 16;
+
+    //! Create a new snapshot file
+    /*!
+        \param path - Snapshot file path
+    */
+    explicit CacheSnapshot(const Path& path);
+    CacheSnapshot(const CacheSnapshot&) = delete;
+    CacheSnapshot(CacheSnapshot&&) = delete;
+    //! Remove the temporary file of the uncommitted snapshot
+    ~CacheSnapshot();
+
+    CacheSnapshot& operator=(const CacheSnapshot&) = delete;
+    CacheSnapshot& operator=(CacheSnapshot&&) = delete;
+
+    //! Get the snapshot file path
+    const Path& path() const noexcept { return _path; }
+    //! Get the count of appended records
+    uint64_t count() const noexcept { return _count; }
+
+    //! Append the record into the snapshot buffer
+    /*!
+        \param key - Key data
+        \param value - Value data
+        \param expiry - Expiry UTC timestamp in nanoseconds (0 if the entry has no timeout)
+    */
+    void Append(std::string_view key, std::string_view value, uint64_t expiry);
+    //! Append the record encoded with the given serializers into the snapshot buffer
+    /*!
+        \param key - Key to encode
+        \param value - Value to encode
+        \param expiry - Expiry UTC timestamp in nanoseconds (0 if the entry has no timeout)
+    */
+    template <class TKeySerializer, class TValueSerializer, typename TKey, typename TValue>
+    void Append(const TKey& key, const TValue& value, uint64_t expiry);
+
+    //! Write buffered records into the snapshot file
+    void Flush();
+    //! Write the snapshot header, flush the snapshot file and replace the previous snapshot with it
+    void Commit();
+
+    //! Read records of the given mapped snapshot file
+    /*!
+        Record views point into the mapping. If the snapshot file is
+        truncated or corrupted the method will raise a filesystem exception!
+
+        \param file - Mapped snapshot file
+        \return Snapshot records
+    */
+    static std::vector<Record> Read(const MappedFile& file);
+
+private:
+    Path _path;
+    Path _temp;
+    File _file;
+    std::string _buffer;
+    uint64_t _count;
+    uint32_t _crc;
+    bool _committed;
+
+    size_t Prepare();
+    void Complete(size_t offset, size_t key, uint64_t expiry);
+};
+
+} // namespace CppCommon
+
+#include "cache_snapshot.inl"
+
+#endif // CPPCOMMON_CACHE_CACHE_SNAPSHOT_H
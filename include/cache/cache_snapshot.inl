@@ -0,0 +1,22 @@
+/*!
+    \file cache_snapshot.inl
+    \brief Cache snapshot inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TKeySerializer, class TValueSerializer, typename TKey, typename TValue>
+inline void CacheSnapshot::Append(const TKey& key, const TValue& value, uint64_t expiry)
+{
+    // Encode the record in place after the reserved record header
+    size_t offset = Prepare();
+    TKeySerializer::encode(key, _buffer);
+    size_t size = _buffer.size() - offset - RECORD_SIZE;
+    TValueSerializer::encode(value, _buffer);
+    Complete(offset, size, expiry);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,185 @@
+/*!
+    \file cache_statistics.h
+    \brief Cache statistics definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_CACHE_STATISTICS_H
+#define CPPCOMMON_CACHE_CACHE_STATISTICS_H
+
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Cache latency histogram
+/*!
+    Latency histogram with logarithmic buckets. Bucket N contains samples
+    in range [2^N, 2^(N+1)) nanoseconds, the first bucket also contains
+    zero samples.
+
+    Not thread-safe.
+*/
+struct CacheHistogram
+{
+    //! Histogram buckets count
+    static const size_t BUCKETS = 40;
+
+    //! Histogram buckets
+    uint64_t buckets[BUCKETS] = {};
+
+    //! Get the total count of samples
+    uint64_t count() const noexcept;
+    //! Get the latency percentile
+    /*!
+        \param percentile - Percentile in range [0.0, 1.0]
+        \return Upper bound of the percentile bucket in nanoseconds
+    */
+    uint64_t percentile(double percentile) const noexcept;
+
+    //! Get the bucket index for the given latency
+    static size_t bucket(uint64_t nanoseconds) noexcept;
+
+    //! Merge another histogram into the current one
+    CacheHistogram& operator+=(const CacheHistogram& histogram) noexcept;
+};
+
+//! Cache statistics
+/*!
+    Snapshot of cache counters aggregated over all cache shards.
+
+    Latencies and lock times are sampled (see CacheCounters::SAMPLING),
+    so histograms contain only a fraction of all cache operations.
+
+    Not thread-safe.
+*/
+struct CacheStatistics
+{
+    //! Count of successful finds
+    uint64_t hits{0};
+    //! Count of failed finds
+    uint64_t misses{0};
+    //! Count of inserted entries
+    uint64_t inserts{0};
+    //! Count of entries rejected by the admission filter
+    uint64_t rejections{0};
+    //! Count of removed entries
+    uint64_t removals{0};
+    //! Count of evicted entries
+    uint64_t evictions{0};
+    //! Count of expired entries
+    uint64_t expirations{0};
+
+    //! Current count of entries
+    uint64_t entries{0};
+    //! Current memory usage in bytes (calculated by the cache size handler)
+    uint64_t bytes{0};
+
+    //! Count of lock samples
+    uint64_t lock_samples{0};
+    //! Total sampled lock wait time in nanoseconds
+    uint64_t lock_wait{0};
+    //! Total sampled lock hold time in nanoseconds
+    uint64_t lock_hold{0};
+
+    //! Sampled find latency histogram
+    CacheHistogram find_latency;
+    //! Sampled insert latency histogram
+    CacheHistogram insert_latency;
+
+    //! Get the hit ratio in range [0.0, 1.0]
+    double hit_ratio() const noexcept
+    { return ((hits + misses) > 0) ? ((double)hits / (double)(hits + misses)) : 0.0; }
+
+    //! Merge another statistics into the current one
+    CacheStatistics& operator+=(const CacheStatistics& statistics) noexcept;
+};
+
+//! Cache counters
+/*!
+    Cache counters are updated with relaxed atomic operations on the cache
+    hot path and could be read concurrently without stopping the traffic.
+    Caches keep counters per shard and aggregate them on read.
+
+    Thread-safe.
+*/
+class CacheCounters
+{
+public:
+    //! Sample one of SAMPLING operations for latency and lock timings
+    static const uint32_t SAMPLING = 64;
+
+    CacheCounters() = default;
+    CacheCounters(const CacheCounters&) = delete;
+    CacheCounters(CacheCounters&&) = delete;
+    ~CacheCounters() = default;
+
+    CacheCounters& operator=(const CacheCounters&) = delete;
+    CacheCounters& operator=(CacheCounters&&) = delete;
+
+    //! Count cache hit
+    void hit() noexcept { _hits.fetch_add(1, std::memory_order_relaxed); }
+    //! Count cache miss
+    void miss() noexcept { _misses.fetch_add(1, std::memory_order_relaxed); }
+    //! Count cache insert
+    void insert() noexcept { _inserts.fetch_add(1, std::memory_order_relaxed); }
+    //! Count cache rejection
+    void reject() noexcept { _rejections.fetch_add(1, std::memory_order_relaxed); }
+    //! Count cache removal
+    void remove() noexcept { _removals.fetch_add(1, std::memory_order_relaxed); }
+    //! Count cache eviction
+    void evict() noexcept { _evictions.fetch_add(1, std::memory_order_relaxed); }
+    //! Count cache expiration
+    void expire() noexcept { _expirations.fetch_add(1, std::memory_order_relaxed); }
+
+    //! Check if the current operation should be sampled
+    bool sample() noexcept { return (_ticks.fetch_add(1, std::memory_order_relaxed) % SAMPLING) == 0; }
+
+    //! Record sampled find operation timings
+    /*!
+        \param start - Operation start timestamp in nanoseconds
+        \param locked - Lock acquired timestamp in nanoseconds
+        \param finish - Operation finish timestamp in nanoseconds
+    */
+    void record_find(uint64_t start, uint64_t locked, uint64_t finish) noexcept
+    { record(_find_latency, start, locked, finish); }
+    //! Record sampled insert operation timings
+    /*!
+        \param start - Operation start timestamp in nanoseconds
+        \param locked - Lock acquired timestamp in nanoseconds
+        \param finish - Operation finish timestamp in nanoseconds
+    */
+    void record_insert(uint64_t start, uint64_t locked, uint64_t finish) noexcept
+    { record(_insert_latency, start, locked, finish); }
+
+    //! Collect counters into the given statistics
+    void collect(CacheStatistics& statistics) const noexcept;
+
+    //! Reset all counters
+    void reset() noexcept;
+
+private:
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _inserts{0};
+    std::atomic<uint64_t> _rejections{0};
+    std::atomic<uint64_t> _removals{0};
+    std::atomic<uint64_t> _evictions{0};
+    std::atomic<uint64_t> _expirations{0};
+    std::atomic<uint32_t> _ticks{0};
+    std::atomic<uint64_t> _lock_samples{0};
+    std::atomic<uint64_t> _lock_wait{0};
+    std::atomic<uint64_t> _lock_hold{0};
+    std::atomic<uint64_t> _find_latency[CacheHistogram::BUCKETS] = {};
+    std::atomic<uint64_t> _insert_latency[CacheHistogram::BUCKETS] = {};
+
+    void record(std::atomic<uint64_t>* histogram, uint64_t start, uint64_t locked, uint64_t finish) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CACHE_CACHE_STATISTICS_H
@@ -0,0 +1,66 @@
+/*!
+    \file cache_watchdog.h
+    \brief Cache background watchdog definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_CACHE_WATCHDOG_H
+#define CPPCOMMON_CACHE_CACHE_WATCHDOG_H
+
+#include "time/timespan.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace CppCommon {
+
+//! Cache background watchdog
+/*!
+    Cache background watchdog periodically calls the given watchdog routine
+    from the dedicated thread, so expired cache entries are not removed on
+    the caller hot path.
+
+    Thread-safe.
+*/
+class CacheWatchdog
+{
+public:
+    CacheWatchdog() = default;
+    CacheWatchdog(const CacheWatchdog&) = delete;
+    CacheWatchdog(CacheWatchdog&&) = delete;
+    ~CacheWatchdog() { stop(); }
+
+    CacheWatchdog& operator=(const CacheWatchdog&) = delete;
+    CacheWatchdog& operator=(CacheWatchdog&&) = delete;
+
+    //! Is the watchdog thread running?
+    bool running() const;
+
+    //! Start the watchdog thread
+    /*!
+        \param period - Watchdog period
+        \param routine - Watchdog routine
+        \return 'true' if the watchdog thread was started, 'false' if the watchdog thread is already running
+    */
+    bool start(const Timespan& period, const std::function<void ()>& routine);
+    //! Stop the watchdog thread
+    /*!
+        \return 'true' if the watchdog thread was stopped, 'false' if the watchdog thread is not running
+    */
+    bool stop();
+
+private:
+    mutable std::mutex _control;
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::thread _thread;
+    bool _stop{false};
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CACHE_CACHE_WATCHDOG_H
@@ -9,20 +9,31 @@
 #ifndef CPPCOMMON_CACHE_FILECACHE_H
 #define CPPCOMMON_CACHE_FILECACHE_H
 
+#include "algorithms/timing_wheel.h"
+#include "cache/cache_codec.h"
+#include "cache/cache_snapshot.h"
+#include "cache/cache_statistics.h"
+#include "cache/cache_watchdog.h"
+#include "cache/memcache.h"
+#include "containers/radix_tree.h"
 #include "filesystem/directory.h"
+#include "filesystem/directory_watcher.h"
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 #include "filesystem/path.h"
 #include "time/timespan.h"
 #include "time/timestamp.h"
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace CppCommon {
 
@@ -30,6 +41,30 @@ namespace CppCommon {
 /*!
     File cache is used to cache files in memory with optional timeouts.
 
+    File cache entries could be backed by read-only memory-mapped files
+    (see insert_file() and insert_path_mapped()). In this case find() returns
+    a view into the mapping, file pages are loaded lazily by the operating
+    system and the page cache keeps the only copy of the file content.
+    Memory-mapped files must not be truncated while they are cached.
+
+    Cache paths could be watched for filesystem changes (see watch_path()).
+    Watched paths are updated incrementally: only changed and new files are
+    reloaded and removed files are dropped.
+
+    Cache timeouts are tracked with hierarchical timing wheels, so insert
+    and remove operations are O(1) and watchdog() touches only expired slots.
+
+    Cache entries are indexed by the radix tree, so keys of the same cache
+    path share their common prefixes. find() and remove() methods take
+    std::string_view keys, so no temporary key strings are allocated.
+    find_prefix() returns the longest cached key which is a prefix of the
+    given key (e.g. for URL routing) and walk() iterates cache entries of
+    the virtual directory in lexicographical order.
+
+    Cache values could be compressed transparently with the cache codec
+    (see set_compression()). Compressed values are decompressed by find()
+    and could be served as is with find_compressed().
+
     Thread-safe.
 */
 class FileCache
@@ -55,6 +90,37 @@ public:
     //! Get the file cache size
     size_t size() const;
 
+    //! Is the coarse clock used for cache timeouts?
+    bool coarse_clock() const noexcept { return _coarse; }
+    //! Enable or disable the coarse clock for cache timeouts
+    /*!
+        Coarse clock (see Timestamp::coarse_utc()) is much cheaper than the UTC
+        clock used by default, but cache entries could expire earlier at most
+        by the system timer tick (usually 1-4 ms). Should be set before the
+        cache is shared between threads.
+
+        \param coarse - Coarse clock flag
+    */
+    void set_coarse_clock(bool coarse) noexcept { _coarse = coarse; }
+
+    //! Get the cache values compression codec (nullptr - compression is disabled)
+    const std::shared_ptr<const CacheCodec>& compression() const noexcept { return _codec; }
+    //! Set the cache values compression codec
+    /*!
+        New cache values not smaller than the threshold are compressed before
+        the cache lock is taken. Compressed value is kept only if its size is
+        not greater than the original size multiplied by the ratio, otherwise
+        the value is stored uncompressed. Memory-mapped files are never
+        compressed. Previously inserted values keep their codecs, so the codec
+        could be changed at any time. Should be set before the cache is shared
+        between threads.
+
+        \param codec - Compression codec (nullptr - disable compression)
+        \param threshold - Minimal size of the value to compress (default is 1024)
+        \param ratio - Maximal compression ratio to keep the compressed value (default is 0.9)
+    */
+    void set_compression(const std::shared_ptr<const CacheCodec>& codec, size_t threshold = 1024, double ratio = 0.9);
+
     //! Emplace a new cache value with the given timeout into the file cache
     /*!
         \param key - Key to emplace
@@ -73,26 +139,99 @@ public:
     */
     bool insert(const std::string& key, const std::string& value, const Timespan& timeout = Timespan(0));
 
+    //! Insert a new memory-mapped cache file with the given timeout into the file cache
+    /*!
+        \param key - Key to insert
+        \param file - File to map
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return 'true' if the cache file was inserted, 'false' if the given file was not mapped
+    */
+    bool insert_file(const std::string& key, const CppCommon::Path& file, const Timespan& timeout = Timespan(0));
+    //! Insert many cache values with the given timeout into the file cache
+    /*!
+        All values are inserted under a single cache lock.
+
+        \param items - Key/value pairs array to insert
+        \param count - Key/value pairs count
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return Count of inserted cache values
+    */
+    size_t insert_many(const std::pair<std::string, std::string>* items, size_t count, const Timespan& timeout = Timespan(0));
+
     //! Try to find the cache value by the given key
     /*!
+        Compressed cache values are decompressed into the thread local buffer,
+        so the returned view is valid until the next find() or find_many()
+        call of the same thread.
+
         \param key - Key to find
         \return 'true' if the cache value was found, 'false' if the given key was not found
     */
-    std::pair<bool, std::string_view> find(const std::string& key);
+    std::pair<bool, std::string_view> find(std::string_view key);
     //! Try to find the cache value with timeout by the given key
     /*!
         \param key - Key to find
         \param timeout - Cache timeout value
         \return 'true' if the cache value was found, 'false' if the given key was not found
     */
-    std::pair<bool, std::string_view> find(const std::string& key, Timestamp& timeout);
+    std::pair<bool, std::string_view> find(std::string_view key, Timestamp& timeout);
+    //! Try to find many cache values by the given keys
+    /*!
+        All keys are looked up under a single cache lock. No allocations are made.
+
+        \param keys - Keys array to find
+        \param count - Keys count
+        \param results - Results array to fill (must contain at least count items)
+        \return Count of found cache values
+    */
+    size_t find_many(const std::string* keys, size_t count, std::pair<bool, std::string_view>* results);
+    //! Try to find the cache value of the longest key which is a prefix of the given key
+    /*!
+        Compressed values are decompressed in the same way as with find().
+
+        \param key - Key to match
+        \param prefix - Matched prefix of the given key
+        \return 'true' if the cache value was found, 'false' if no cache keys match the given key
+    */
+    std::pair<bool, std::string_view> find_prefix(std::string_view key, std::string_view& prefix);
+    //! Walk through cache values with keys started with the given prefix in lexicographical order
+    /*!
+        Visitor is called under the shared cache lock, so it must not modify
+        the file cache. Compressed values are decompressed and their views are
+        valid only during the visitor call.
+
+        \param prefix - Keys prefix (e.g. "/static/" for the virtual directory)
+        \param visitor - Visitor which returns 'true' to continue the walk or 'false' to stop it
+        \return Count of visited cache values
+    */
+    size_t walk(std::string_view prefix, const std::function<bool (std::string_view key, std::string_view value)>& visitor) const;
+
+    //! Try to find the compressed cache value by the given key
+    /*!
+        Compressed bytes are returned without decompression, so they could be
+        sent as is to clients which accept the given content encoding.
+        Uncompressed values and values compressed with another codec are not
+        found and should be taken with find().
+
+        \param key - Key to find
+        \param encoding - Content encoding (codec name) accepted by the client
+        \return 'true' if the compressed cache value was found, 'false' if the given key was not found or its value is not compressed with the given encoding
+    */
+    std::pair<bool, std::string_view> find_compressed(std::string_view key, std::string_view encoding);
 
     //! Remove the cache value with the given key from the file cache
     /*!
         \param key - Key to remove
         \return 'true' if the cache value was removed, 'false' if the given key was not found
     */
-    bool remove(const std::string& key);
+    bool remove(std::string_view key);
+    //! Remove many cache values with the given keys from the file cache
+    /*!
+        \param keys - Keys array to remove
+        \param count - Keys count
+        \return Count of removed cache values
+    */
+    size_t remove_many(const std::string* keys, size_t count);
 
     //! Insert a new cache path with the given timeout into the file cache
     /*!
@@ -103,6 +242,33 @@ public:
         \return 'true' if the cache path was setup, 'false' if failed to setup the cache path
     */
     bool insert_path(const CppCommon::Path& path, const std::string& prefix = "/", const Timespan& timeout = Timespan(0), const InsertHandler& handler = [](FileCache& cache, const std::string& key, const std::string& value, const Timespan& timeout){ return cache.insert(key, value, timeout); });
+    //! Insert a new memory-mapped cache path with the given timeout into the file cache
+    /*!
+        All files of the cache path are inserted with insert_file() without
+        reading their content.
+
+        \param path - Path to insert
+        \param prefix - Cache prefix (default is "/")
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return 'true' if the cache path was setup, 'false' if failed to setup the cache path
+    */
+    bool insert_path_mapped(const CppCommon::Path& path, const std::string& prefix = "/", const Timespan& timeout = Timespan(0));
+
+    //! Watch the cache path for filesystem changes
+    /*!
+        Watched cache path subscribes to filesystem change notifications
+        (inotify on Linux, ReadDirectoryChangesW on Windows). Pending changes
+        are applied by refresh() and watchdog() calls, so the insert handler
+        is called only for changed and new files. Watch mode is kept when the
+        cache path is reloaded by timeout.
+
+        \param path - Path to watch
+        \return 'true' if the cache path is watched, 'false' if the given path was not found or change notifications are not supported
+    */
+    bool watch_path(const CppCommon::Path& path);
+
+    //! Refresh watched cache paths with pending filesystem changes
+    void refresh();
 
     //! Try to find the cache path
     /*!
@@ -128,47 +294,135 @@ public:
     //! Clear the memory cache
     void clear();
 
+    //! Save the file cache snapshot into the given file
+    /*!
+        Cache entries are copied under the shared cache lock, so readers are
+        not blocked, and written into the snapshot file sequentially without
+        the lock. Memory-mapped entries are saved with their content. Cache
+        paths are not saved and should be inserted again after the restore.
+        Entry timeouts are stored as expiry timestamps.
+
+        \param path - Snapshot file path
+        \return Count of saved cache entries
+    */
+    uint64_t snapshot(const CppCommon::Path& path) const;
+    //! Restore cache entries from the given snapshot file
+    /*!
+        Snapshot file is mapped into memory and its records are inserted
+        under a single cache lock. Entries expired since the snapshot are
+        skipped, other entries keep their remaining timeouts. If the snapshot
+        file is corrupted the method will raise a filesystem exception!
+
+        \param path - Snapshot file path
+        \return Count of restored cache entries
+    */
+    size_t restore(const CppCommon::Path& path);
+
+    //! Get the file cache statistics
+    /*!
+        Statistics counters are updated with relaxed atomic operations,
+        so they could be scraped periodically without stopping the traffic.
+        Memory usage is the total size of cached values and mapped files.
+
+        \return File cache statistics
+    */
+    CacheStatistics statistics() const;
+    //! Reset the file cache statistics
+    void reset_statistics();
+
     //! Watchdog the file cache
+    /*!
+        Watchdog applies pending changes of watched cache paths, erases cache
+        entries with timeout and reloads cache paths with timeout. Expired
+        entries are erased in small bounded chunks, the cache lock is dropped
+        between chunks and expired values are freed without the lock.
+
+        \param utc - UTC timestamp to check cache timeouts (default is UtcTimestamp())
+    */
     void watchdog(const UtcTimestamp& utc = UtcTimestamp());
 
+    //! Start the background watchdog thread
+    /*!
+        Background watchdog thread calls watchdog() with the given period,
+        so cache timeouts and watched paths changes are not processed on
+        the caller thread.
+
+        \param period - Watchdog period (default is 1 second)
+        \return 'true' if the watchdog thread was started, 'false' if the watchdog thread is already running
+    */
+    bool start_watchdog(const Timespan& period = Timespan::seconds(1));
+    //! Stop the background watchdog thread
+    /*!
+        \return 'true' if the watchdog thread was stopped, 'false' if the watchdog thread is not running
+    */
+    bool stop_watchdog();
+
     //! Swap two instances
     void swap(FileCache& cache) noexcept;
     friend void swap(FileCache& cache1, FileCache& cache2) noexcept;
 
 private:
     mutable std::shared_mutex _lock;
-    Timestamp _timestamp;
 
     struct MemCacheEntry
     {
         std::string value;
+        MappedFile mapping;
+        const CacheCodec* codec{nullptr};
+        size_t size{0};
         Timestamp timestamp;
         Timespan timespan;
+        TimingWheel<std::string>::Handle handle{TimingWheel<std::string>::INVALID};
 
         MemCacheEntry() = default;
         MemCacheEntry(const std::string& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
         MemCacheEntry(std::string&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
+        MemCacheEntry(MappedFile&& m, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : mapping(std::move(m)), timestamp(ts), timespan(tp) {}
+
+        std::string_view view() const noexcept { return mapping ? mapping.view() : std::string_view(value); }
     };
 
     struct FileCacheEntry
     {
         std::string prefix;
         InsertHandler handler;
+        bool mapped{false};
+        std::shared_ptr<DirectoryWatcher> watcher;
         Timestamp timestamp;
         Timespan timespan;
+        TimingWheel<CppCommon::Path>::Handle handle{TimingWheel<CppCommon::Path>::INVALID};
 
         FileCacheEntry() = default;
-        FileCacheEntry(const std::string& pfx, const InsertHandler& h, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : prefix(pfx), handler(h), timestamp(ts), timespan(tp) {}
+        FileCacheEntry(const std::string& pfx, const InsertHandler& h, bool m, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : prefix(pfx), handler(h), mapped(m), timestamp(ts), timespan(tp) {}
     };
 
-    std::unordered_map<std::string, MemCacheEntry> _entries_by_key;
-    std::map<Timestamp, std::string> _entries_by_timestamp;
+    RadixTree<MemCacheEntry> _entries_by_key;
+    TimingWheel<std::string> _entries_by_timeout;
     std::map<CppCommon::Path, FileCacheEntry> _paths_by_key;
-    std::map<Timestamp, CppCommon::Path> _paths_by_timestamp;
-
-    bool remove_internal(const std::string& key);
-    bool insert_path_internal(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler);
+    TimingWheel<CppCommon::Path> _paths_by_timeout;
+    size_t _bytes{0};
+    bool _coarse{false};
+    std::shared_ptr<const CacheCodec> _codec;
+    std::vector<std::shared_ptr<const CacheCodec>> _codecs;
+    size_t _threshold{1024};
+    double _ratio{0.9};
+    CacheCounters _counters;
+    CacheWatchdog _watchdog;
+
+    // Count of expired entries erased under a single cache lock
+    static const size_t WATCHDOG_CHUNK = 256;
+
+    Timestamp utc_internal() const { return Timestamp(_coarse ? Timestamp::coarse_utc() : Timestamp::utc()); }
+    bool compress_internal(std::string_view value, MemCacheEntry& entry) const;
+    bool decompress_internal(const MemCacheEntry& entry, std::string& value) const;
+    std::string_view value_internal(const MemCacheEntry& entry) const;
+    bool insert_internal(const std::string& key, MemCacheEntry&& entry, const Timespan& timeout, const Timestamp& current);
+    bool remove_internal(std::string_view key);
+    bool insert_path_common(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler, bool mapped, bool watch);
+    bool insert_path_internal(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler, bool mapped);
     bool remove_path_internal(const CppCommon::Path& path);
+    void refresh_path_internal(const CppCommon::Path& path, const FileCacheEntry& entry, const std::vector<DirectoryWatcher::Change>& changes);
+    void remove_prefix_internal(const std::string& prefix);
 };
 
 /*! \example cache_filecache.cpp File cache example */
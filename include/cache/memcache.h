@@ -9,27 +9,127 @@
 #ifndef CPPCOMMON_CACHE_MEMCACHE_H
 #define CPPCOMMON_CACHE_MEMCACHE_H
 
+#include "algorithms/timing_wheel.h"
+#include "cache/cache_codec.h"
+#include "cache/cache_snapshot.h"
+#include "cache/cache_statistics.h"
+#include "cache/cache_watchdog.h"
+#include "filesystem/exceptions.h"
 #include "time/timespan.h"
 #include "time/timestamp.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
+#include <memory>
 #include <mutex>
-#include <map>
+#include <optional>
+#include <random>
 #include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CppCommon {
 
+//! Memory cache eviction policy
+enum class MemCacheEviction
+{
+    NONE,               //!< No eviction (cache entries are removed only by timeout)
+    LRU,                //!< Evict the least recently used cache entry
+    CLOCK,              //!< Evict the cache entry using CLOCK (second chance) approximation of LRU
+    TINYLFU             //!< Evict the least recently used cache entry and admit new entries with TinyLFU frequency filter
+};
+
+//! Memory cache key hash
+/*!
+    Memory cache key hash is the standard hash for all key types except
+    strings. String keys hash is transparent, so memory cache with string
+    keys could be searched by std::string_view or const char* without key
+    allocations.
+*/
+template <typename TKey>
+struct MemCacheHash : public std::hash<TKey> {};
+
+//! Memory cache string key hash
+template <>
+struct MemCacheHash<std::string>
+{
+    typedef void is_transparent;
+
+    size_t operator()(std::string_view key) const noexcept { return std::hash<std::string_view>()(key); }
+};
+
 //! Memory cache
 /*!
     Memory cache is used to cache data in memory with optional timeouts.
 
+    Cache timeouts are tracked with a hierarchical timing wheel, so insert
+    and remove operations are O(1) and watchdog() touches only expired slots.
+
+    Memory cache could be split into several shards. Each shard has its own
+    lock, hash index and expiry index, and keys are routed to the shard by
+    their hash value. Sharding reduces contention between readers and writers
+    that work with different keys.
+
+    Memory cache could be bounded by the count of entries and/or by the bytes
+    budget calculated with the size handler. When the limit is reached the
+    eviction policy selects the cache entry to remove in O(1):
+    - LRU policy keeps the recently used order, so find() takes an exclusive shard lock;
+    - CLOCK policy marks used entries with a reference bit under a shared shard lock;
+    - TINYLFU policy uses LRU order and rejects new entries which are accessed
+      not more frequently than the eviction victim (frequencies are estimated
+      with an aging Count-Min sketch).
+
+    Limits are split evenly between shards.
+
+    find() and remove() methods accept any key type comparable with the
+    cache key type. For string keys the lookup is heterogeneous and does not
+    materialize a temporary key.
+
+    get_or_compute() method coalesces concurrent misses of the same key into
+    a single loader call (single-flight), so an expired hot key does not
+    stampede the backend. Optional stale-while-revalidate period and
+    probabilistic early refresh flatten the latency at timeout boundaries.
+
+    Memory cache with string values could compress them transparently with
+    the cache codec (see set_compression()). Compressed values are accounted
+    by their compressed size and could be taken as is with find_compressed().
+
     Thread-safe.
 */
 template <typename TKey, typename TValue>
 class MemCache
 {
 public:
-    MemCache() = default;
+    //! Memory cache size handler type
+    typedef std::function<size_t (const TKey& key, const TValue& value)> SizeHandler;
+    //! Memory cache eviction handler type (key, value, expiry timestamp or 0 if the entry has no timeout)
+    typedef std::function<void (const TKey& key, TValue&& value, const Timestamp& expiry)> EvictionHandler;
+
+    //! Initialize the memory cache with the given count of shards
+    /*!
+        \param shards - Count of memory cache shards (default is 1)
+    */
+    explicit MemCache(size_t shards = 1);
+    //! Initialize the bounded memory cache
+    /*!
+        \param shards - Count of memory cache shards
+        \param capacity - Maximal count of cache entries (0 - unlimited)
+        \param eviction - Cache eviction policy (default is MemCacheEviction::LRU)
+        \param budget - Maximal bytes budget of cache entries (default is 0 - unlimited)
+        \param handler - Cache entry size handler used to calculate the bytes budget (default is nullptr)
+    */
+    MemCache(size_t shards, size_t capacity, MemCacheEviction eviction = MemCacheEviction::LRU, size_t budget = 0, const SizeHandler& handler = nullptr);
     MemCache(const MemCache&) = delete;
     MemCache(MemCache&&) = delete;
     ~MemCache() = default;
@@ -45,13 +145,89 @@ public:
 
     //! Get the memory cache size
     size_t size() const;
+    //! Get the memory cache shards count
+    size_t shards() const noexcept { return _shards.size(); }
+    //! Get the memory cache capacity (0 - unlimited)
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the memory cache bytes budget (0 - unlimited)
+    size_t budget() const noexcept { return _budget; }
+    //! Get the memory cache eviction policy
+    MemCacheEviction eviction() const noexcept { return _eviction; }
+    //! Is the coarse clock used for cache timeouts?
+    bool coarse_clock() const noexcept { return _coarse; }
+    //! Enable or disable the coarse clock for cache timeouts
+    /*!
+        Coarse clock (see Timestamp::coarse_utc()) is much cheaper than the UTC
+        clock used by default, but cache entries could expire earlier at most
+        by the system timer tick (usually 1-4 ms). Should be set before the
+        cache is shared between threads.
+
+        \param coarse - Coarse clock flag
+    */
+    void set_coarse_clock(bool coarse) noexcept { _coarse = coarse; }
+
+    //! Set the eviction handler
+    /*!
+        Eviction handler is called with the evicted cache entry under the
+        shard lock, so it could demote the entry into the next cache tier,
+        but must not access the memory cache. Should be set before the cache
+        is shared between threads.
+
+        \param handler - Eviction handler (nullptr - evicted entries are dropped)
+    */
+    void set_eviction_handler(const EvictionHandler& handler) { _evict_handler = handler; }
+
+    //! Get the stale-while-revalidate period
+    const Timespan& stale_while_revalidate() const noexcept { return _stale; }
+    //! Set the stale-while-revalidate period
+    /*!
+        Cache entries are kept for the stale period after their timeout.
+        During this period get_or_compute() returns the stale value to all
+        callers except one, which reloads the value. Should be set before
+        the cache is shared between threads.
+
+        \param stale - Stale-while-revalidate period (0 - disabled)
+    */
+    void set_stale_while_revalidate(const Timespan& stale) noexcept { _stale = stale; }
+    //! Get the probabilistic early refresh factor
+    double early_refresh() const noexcept { return _beta; }
+    //! Set the probabilistic early refresh factor
+    /*!
+        get_or_compute() reloads the value before its timeout with probability
+        that grows when the timeout approaches (XFetch algorithm). The refresh
+        happens when 'now - cost * beta * log(random) >= expiry', where cost is
+        the last loader call duration. Values greater than 1.0 favor earlier
+        refreshes. Should be set before the cache is shared between threads.
+
+        https://cseweb.ucsd.edu/~avattani/papers/cache_stampede.pdf
+
+        \param beta - Early refresh factor (0.0 - disabled)
+    */
+    void set_early_refresh(double beta) noexcept { _beta = beta; }
+
+    //! Get the cache values compression codec (nullptr - compression is disabled)
+    const std::shared_ptr<const CacheCodec>& compression() const noexcept { return _codec; }
+    //! Set the cache values compression codec
+    /*!
+        Only std::string values are compressed. New cache values not smaller
+        than the threshold are compressed before the size handler is called,
+        so the bytes budget accounts compressed sizes. Compressed value is
+        kept only if its size is not greater than the original size multiplied
+        by the ratio. Values are decompressed on each lookup, eviction and
+        snapshot. Should be set before the cache is shared between threads.
+
+        \param codec - Compression codec (nullptr - disable compression)
+        \param threshold - Minimal size of the value to compress (default is 1024)
+        \param ratio - Maximal compression ratio to keep the compressed value (default is 0.9)
+    */
+    void set_compression(const std::shared_ptr<const CacheCodec>& codec, size_t threshold = 1024, double ratio = 0.9);
 
     //! Emplace a new cache value with the given timeout into the memory cache
     /*!
         \param key - Key to emplace
         \param value - Value to emplace
         \param timeout - Cache timeout (default is 0 - no timeout)
-        \return 'true' if the cache value was emplaced, 'false' if the given key was not emplaced
+        \return 'true' if the cache value was emplaced, 'false' if the given key was not emplaced (rejected by the admission filter)
     */
     bool emplace(TKey&& key, TValue&& value, const Timespan& timeout = Timespan(0));
 
@@ -60,7 +236,7 @@ public:
         \param key - Key to insert
         \param value - Value to insert
         \param timeout - Cache timeout (default is 0 - no timeout)
-        \return 'true' if the cache value was inserted, 'false' if the given key was not inserted
+        \return 'true' if the cache value was inserted, 'false' if the given key was not inserted (rejected by the admission filter)
     */
     bool insert(const TKey& key, const TValue& value, const Timespan& timeout = Timespan(0));
 
@@ -69,14 +245,16 @@ public:
         \param key - Key to find
         \return 'true' if the cache value was found, 'false' if the given key was not found
     */
-    bool find(const TKey& key);
+    template <typename TLookup>
+    bool find(const TLookup& key);
     //! Try to find the cache value by the given key
     /*!
         \param key - Key to find
         \param value - Value to find
         \return 'true' if the cache value was found, 'false' if the given key was not found
     */
-    bool find(const TKey& key, TValue& value);
+    template <typename TLookup>
+    bool find(const TLookup& key, TValue& value);
     //! Try to find the cache value with timeout by the given key
     /*!
         \param key - Key to find
@@ -84,45 +262,271 @@ public:
         \param timeout - Cache timeout value
         \return 'true' if the cache value was found, 'false' if the given key was not found
     */
-    bool find(const TKey& key, TValue& value, Timestamp& timeout);
+    template <typename TLookup>
+    bool find(const TLookup& key, TValue& value, Timestamp& timeout);
+    //! Try to find the compressed cache value by the given key
+    /*!
+        Compressed bytes are copied without decompression, so they could be
+        sent as is to clients which accept the given content encoding.
+        Uncompressed values and values compressed with another codec are not
+        found and should be taken with find().
+
+        \param key - Key to find
+        \param encoding - Content encoding (codec name) accepted by the client
+        \param value - Compressed value to find
+        \return 'true' if the compressed cache value was found, 'false' if the given key was not found or its value is not compressed with the given encoding
+    */
+    template <typename TLookup>
+    bool find_compressed(const TLookup& key, std::string_view encoding, std::string& value);
+
+    //! Get the cache value by the given key or compute it with the given loader
+    /*!
+        Loader is called as loader(const TKey& key) and returns the value to
+        insert into the memory cache with the given timeout. Concurrent callers
+        of the same missing key wait for the single in-flight loader call and
+        share its result or exception.
+
+        Expired cache entries are treated as missing. Within the stale period
+        (see set_stale_while_revalidate()) and on probabilistic early refresh
+        (see set_early_refresh()) the cached value is returned to all callers
+        except the one which calls the loader.
+
+        Will block while the loader call is in flight.
+
+        \param key - Key to find
+        \param loader - Value loader
+        \param timeout - Cache timeout of the loaded value (default is 0 - no timeout)
+        \return Cached or loaded value
+    */
+    template <typename TLoader>
+    TValue get_or_compute(const TKey& key, TLoader&& loader, const Timespan& timeout = Timespan(0));
 
     //! Remove the cache value with the given key from the memory cache
     /*!
         \param key - Key to remove
         \return 'true' if the cache value was removed, 'false' if the given key was not found
     */
-    bool remove(const TKey& key);
+    template <typename TLookup>
+    bool remove(const TLookup& key);
+
+    //! Try to find many cache values by the given keys
+    /*!
+        Each shard lock is taken once per batch chunk instead of once per key.
+        No allocations are made.
+
+        \param keys - Keys array to find
+        \param count - Keys count
+        \param values - Values array to fill (must contain at least count items)
+        \param found - Found flags array to fill (must contain at least count items, default is nullptr)
+        \return Count of found cache values
+    */
+    size_t find_many(const TKey* keys, size_t count, TValue* values, bool* found = nullptr);
+    //! Insert many cache values with the given timeout into the memory cache
+    /*!
+        \param items - Key/value pairs array to insert
+        \param count - Key/value pairs count
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return Count of inserted cache values
+    */
+    size_t insert_many(const std::pair<TKey, TValue>* items, size_t count, const Timespan& timeout = Timespan(0));
+    //! Remove many cache values with the given keys from the memory cache
+    /*!
+        \param keys - Keys array to remove
+        \param count - Keys count
+        \return Count of removed cache values
+    */
+    size_t remove_many(const TKey* keys, size_t count);
+
+    //! Evict the given count of cache entries by the eviction policy
+    /*!
+        Entries are evicted evenly from all shards and passed to the eviction
+        handler, so the memory cache could shed cold entries under the memory
+        pressure (see MemoryPressure). Only bounded memory caches keep the
+        eviction order, other caches evict nothing.
+
+        \param count - Count of cache entries to evict
+        \return Count of evicted cache entries
+    */
+    size_t evict(size_t count);
 
     //! Clear the memory cache
     void clear();
 
+    //! Save the memory cache snapshot into the given file
+    /*!
+        Memory cache shards are copied one at a time under the shared shard
+        lock, so readers are not blocked and writers are blocked only while
+        their shard is copied. Copied records are written into the snapshot
+        file sequentially without locks. Entry timeouts are stored as expiry
+        timestamps.
+
+        \param path - Snapshot file path
+        \return Count of saved cache entries
+    */
+    template <class TKeySerializer = CacheSerializer<TKey>, class TValueSerializer = CacheSerializer<TValue>>
+    uint64_t snapshot(const Path& path) const;
+    //! Restore cache entries from the given snapshot file
+    /*!
+        Snapshot file is mapped into memory and its records are decoded and
+        inserted in parallel by the given count of threads. Entries expired
+        since the snapshot are skipped, other entries keep their remaining
+        timeouts. If the snapshot file is corrupted the method will raise
+        a filesystem exception!
+
+        \param path - Snapshot file path
+        \param threads - Count of restore threads (default is 0 - hardware concurrency)
+        \return Count of restored cache entries
+    */
+    template <class TKeySerializer = CacheSerializer<TKey>, class TValueSerializer = CacheSerializer<TValue>>
+    size_t restore(const Path& path, size_t threads = 0);
+
+    //! Get the memory cache statistics
+    /*!
+        Statistics counters are kept per shard and aggregated on read,
+        so they could be scraped periodically without stopping the traffic.
+
+        \return Memory cache statistics
+    */
+    CacheStatistics statistics() const;
+    //! Reset the memory cache statistics
+    void reset_statistics();
+
     //! Watchdog the memory cache
+    /*!
+        Memory cache shards are swept one at a time, so only one shard
+        is locked at any moment. Expired entries are erased in small
+        bounded chunks, the shard lock is dropped between chunks and
+        expired values are freed without the lock.
+
+        \param utc - UTC timestamp to check cache timeouts (default is UtcTimestamp())
+    */
     void watchdog(const UtcTimestamp& utc = UtcTimestamp());
 
+    //! Start the background watchdog thread
+    /*!
+        Background watchdog thread calls watchdog() with the given period,
+        so cache timeouts are not processed on the caller thread.
+
+        \param period - Watchdog period (default is 1 second)
+        \return 'true' if the watchdog thread was started, 'false' if the watchdog thread is already running
+    */
+    bool start_watchdog(const Timespan& period = Timespan::seconds(1));
+    //! Stop the background watchdog thread
+    /*!
+        \return 'true' if the watchdog thread was stopped, 'false' if the watchdog thread is not running
+    */
+    bool stop_watchdog();
+
     //! Swap two instances
     void swap(MemCache& cache) noexcept;
     template <typename UKey, typename UValue>
     friend void swap(MemCache<UKey, UValue>& cache1, MemCache<UKey, UValue>& cache2) noexcept;
 
 private:
-    mutable std::shared_mutex _lock;
-    Timestamp _timestamp;
+    struct MemCacheNode
+    {
+        TKey key;
+        std::atomic<bool> referenced;
+
+        explicit MemCacheNode(const TKey& k) : key(k), referenced(false) {}
+    };
+
+    typedef std::list<MemCacheNode> MemCacheOrder;
 
     struct MemCacheEntry
     {
         TValue value;
         Timestamp timestamp;
         Timespan timespan;
+        size_t size{0};
+        uint64_t cost{0};
+        const CacheCodec* codec{nullptr};
+        size_t raw{0};
+        typename MemCacheOrder::iterator node;
+        typename TimingWheel<TKey>::Handle handle{TimingWheel<TKey>::INVALID};
 
         MemCacheEntry() = default;
         MemCacheEntry(const TValue& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
-        MemCacheEntry(TValue&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
+        MemCacheEntry(TValue&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(std::move(v)), timestamp(ts), timespan(tp) {}
+    };
+
+    typedef std::unordered_map<TKey, MemCacheEntry, MemCacheHash<TKey>, std::equal_to<>> MemCacheMap;
+
+    struct MemCacheShard
+    {
+        mutable std::shared_mutex lock;
+        MemCacheMap entries_by_key;
+        TimingWheel<TKey> entries_by_timeout;
+        MemCacheOrder order;
+        typename MemCacheOrder::iterator hand;
+        size_t bytes{0};
+        std::vector<uint8_t> sketch;
+        size_t samples{0};
+        CacheCounters counters;
+        std::unordered_map<TKey, std::shared_future<TValue>, MemCacheHash<TKey>, std::equal_to<>> flights;
+
+        MemCacheShard() : hand(order.end()) {}
     };
 
-    std::unordered_map<TKey, MemCacheEntry> _entries_by_key;
-    std::map<Timestamp, TKey> _entries_by_timestamp;
+    MemCacheHash<TKey> _hash;
+    std::vector<MemCacheShard> _shards;
+    MemCacheEviction _eviction;
+    size_t _capacity;
+    size_t _budget;
+    size_t _shard_capacity;
+    size_t _shard_budget;
+    SizeHandler _handler;
+    EvictionHandler _evict_handler;
+    bool _coarse;
+    Timespan _stale;
+    double _beta;
+    std::shared_ptr<const CacheCodec> _codec;
+    std::vector<std::shared_ptr<const CacheCodec>> _codecs;
+    size_t _threshold;
+    double _ratio;
+    CacheWatchdog _watchdog;
+
+    // Count of expired entries erased under a single shard lock
+    static const size_t WATCHDOG_CHUNK = 256;
+    // Minimal count of snapshot records restored by a single thread
+    static const size_t RESTORE_CHUNK = 1024;
+
+    template <typename TLookup>
+    MemCacheShard& shard(const TLookup& key) { return _shards[_hash(key) % _shards.size()]; }
+
+    bool bounded() const noexcept { return (_eviction != MemCacheEviction::NONE) && ((_shard_capacity > 0) || (_shard_budget > 0)); }
+    bool exclusive() const noexcept { return bounded() && (_eviction != MemCacheEviction::CLOCK); }
+    Timestamp utc_internal() const { return Timestamp(_coarse ? Timestamp::coarse_utc() : Timestamp::utc()); }
+    static uint64_t expiry_internal(const MemCacheEntry& entry) noexcept { return (entry.timespan.total() > 0) ? (entry.timestamp + entry.timespan).total() : 0; }
+    bool refresh_internal(uint64_t now, uint64_t expiry, uint64_t cost) const;
+    template <typename TValueArg>
+    MemCacheEntry compress_internal(TValueArg&& value) const;
+    MemCacheEntry compress_internal(MemCacheEntry&& entry) const { return std::move(entry); }
+    TValue value_internal(const MemCacheEntry& entry) const;
+    TValue take_internal(MemCacheEntry& entry) const;
+
+    template <typename TLookup, typename TFunction>
+    bool find_internal(const TLookup& key, TFunction&& function);
+    template <typename TLookup, typename TFunction>
+    bool find_internal(MemCacheShard& shard, const TLookup& key, TFunction&& function);
+    template <typename TKeyArg, typename TValueArg>
+    bool insert_internal(TKeyArg&& key, TValueArg&& value, const Timespan& timeout);
+    template <typename TKeyArg, typename TValueArg>
+    bool insert_internal(MemCacheShard& shard, TKeyArg&& key, TValueArg&& value, const Timespan& timeout);
+    template <typename TKeyGetter, typename TFunction>
+    void batch_internal(size_t count, bool exclusive, TKeyGetter&& key, TFunction&& function);
+    template <typename TLookup>
+    bool remove_internal(MemCacheShard& shard, const TLookup& key);
+    void erase_internal(MemCacheShard& shard, typename MemCacheMap::iterator it);
+    bool evict_internal(MemCacheShard& shard);
+    bool overflow_internal(const MemCacheShard& shard, size_t size) const noexcept;
+    void touch_internal(MemCacheShard& shard, MemCacheEntry& entry);
 
-    bool remove_internal(const TKey& key);
+    template <typename TLookup>
+    size_t frequency_internal(const MemCacheShard& shard, const TLookup& key) const;
+    template <typename TLookup>
+    void increment_internal(MemCacheShard& shard, const TLookup& key);
+    size_t sketch_index(size_t hash, size_t row, size_t mask) const noexcept;
 };
 
 /*! \example cache_memcache.cpp Memory cache example */
@@ -8,176 +8,896 @@
 
 namespace CppCommon {
 
+template <typename TKey, typename TValue>
+inline MemCache<TKey, TValue>::MemCache(size_t shards) : MemCache(shards, 0, MemCacheEviction::NONE)
+{
+}
+
+template <typename TKey, typename TValue>
+inline MemCache<TKey, TValue>::MemCache(size_t shards, size_t capacity, MemCacheEviction eviction, size_t budget, const SizeHandler& handler)
+    : _shards((shards > 0) ? shards : 1),
+      _eviction(eviction),
+      _capacity(capacity),
+      _budget(budget),
+      _shard_capacity((capacity + _shards.size() - 1) / _shards.size()),
+      _shard_budget((budget + _shards.size() - 1) / _shards.size()),
+      _handler(handler),
+      _coarse(false),
+      _stale(0),
+      _beta(0.0),
+      _threshold(1024),
+      _ratio(0.9)
+{
+    // Prepare TinyLFU frequency sketches
+    if (_eviction == MemCacheEviction::TINYLFU)
+    {
+        size_t counters = 64;
+        while (counters < (_shard_capacity * 4))
+            counters <<= 1;
+        for (auto& shard : _shards)
+            shard.sketch.resize(counters, 0);
+    }
+}
+
 template <typename TKey, typename TValue>
 inline bool MemCache<TKey, TValue>::empty() const
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
-    return _entries_by_key.empty();
+    for (const auto& shard : _shards)
+    {
+        std::shared_lock<std::shared_mutex> locker(shard.lock);
+        if (!shard.entries_by_key.empty())
+            return false;
+    }
+    return true;
 }
 
 template <typename TKey, typename TValue>
 inline size_t MemCache<TKey, TValue>::size() const
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
-    return _entries_by_key.size();
+    size_t result = 0;
+    for (const auto& shard : _shards)
+    {
+        std::shared_lock<std::shared_mutex> locker(shard.lock);
+        result += shard.entries_by_key.size();
+    }
+    return result;
 }
 
 template <typename TKey, typename TValue>
 inline bool MemCache<TKey, TValue>::emplace(TKey&& key, TValue&& value, const Timespan& timeout)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    return insert_internal(std::move(key), std::move(value), timeout);
+}
+
+template <typename TKey, typename TValue>
+inline bool MemCache<TKey, TValue>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+{
+    return insert_internal(key, value, timeout);
+}
+
+template <typename TKey, typename TValue>
+template <typename TKeyArg, typename TValueArg>
+inline bool MemCache<TKey, TValue>::insert_internal(TKeyArg&& key, TValueArg&& value, const Timespan& timeout)
+{
+    auto& shard = this->shard(key);
+
+    // Compress the value without the shard lock
+    MemCacheEntry entry = compress_internal(std::forward<TValueArg>(value));
+
+    // Sample the operation latency and lock timings
+    bool sample = shard.counters.sample();
+    uint64_t start = sample ? Timestamp::nano() : 0;
+
+    std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+    uint64_t locked = sample ? Timestamp::nano() : 0;
+    bool result = insert_internal(shard, std::forward<TKeyArg>(key), std::move(entry), timeout);
+    if (sample)
+        shard.counters.record_insert(start, locked, Timestamp::nano());
+    return result;
+}
+
+template <typename TKey, typename TValue>
+template <typename TKeyArg, typename TValueArg>
+inline bool MemCache<TKey, TValue>::insert_internal(MemCacheShard& shard, TKeyArg&& key, TValueArg&& value, const Timespan& timeout)
+{
+    // Update the key access frequency
+    if (_eviction == MemCacheEviction::TINYLFU)
+        increment_internal(shard, key);
 
     // Try to find and remove the previous key
-    remove_internal(key);
+    bool updated = remove_internal(shard, key);
 
-    // Update the cache entry
+    // Create the compressed cache entry and calculate its size
+    MemCacheEntry entry = compress_internal(std::forward<TValueArg>(value));
+    size_t size = _handler ? _handler(key, entry.value) : 0;
+
+    if (bounded())
+    {
+        // Check the admission filter for the new key
+        if (!updated && (_eviction == MemCacheEviction::TINYLFU) && !shard.order.empty() && overflow_internal(shard, size))
+            if (frequency_internal(shard, key) <= frequency_internal(shard, shard.order.back().key))
+            {
+                shard.counters.reject();
+                return false;
+            }
+
+        // Evict cache entries to free space for the new one
+        while (overflow_internal(shard, size) && evict_internal(shard)) {}
+    }
+
+    entry.size = size;
+
+    // Update the cache eviction order
+    if (bounded())
+    {
+        if (_eviction == MemCacheEviction::CLOCK)
+            entry.node = shard.order.emplace(shard.hand, key);
+        else
+            entry.node = shard.order.emplace(shard.order.begin(), key);
+    }
+
+    // Update the cache expiry index
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        entry.timestamp = utc_internal();
+        entry.timespan = timeout;
+        entry.handle = shard.entries_by_timeout.insert(entry.timestamp + timeout + _stale, key);
     }
-    else
-        _entries_by_key.emplace(std::make_pair(std::move(key), MemCacheEntry(std::move(value))));
+
+    // Update the cache entry
+    shard.entries_by_key.emplace(std::forward<TKeyArg>(key), std::move(entry));
+    shard.bytes += size;
+    shard.counters.insert();
 
     return true;
 }
 
 template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+template <typename TLookup>
+inline bool MemCache<TKey, TValue>::find(const TLookup& key)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    return find_internal(key, [](const MemCacheEntry&) {});
+}
 
-    // Try to find and remove the previous key
-    remove_internal(key);
+template <typename TKey, typename TValue>
+template <typename TLookup>
+inline bool MemCache<TKey, TValue>::find(const TLookup& key, TValue& value)
+{
+    return find_internal(key, [this, &value](const MemCacheEntry& entry) { value = value_internal(entry); });
+}
 
-    // Update the cache entry
-    if (timeout.total() > 0)
+template <typename TKey, typename TValue>
+template <typename TLookup>
+inline bool MemCache<TKey, TValue>::find(const TLookup& key, TValue& value, Timestamp& timeout)
+{
+    return find_internal(key, [this, &value, &timeout](const MemCacheEntry& entry)
+    {
+        value = value_internal(entry);
+        timeout = entry.timestamp + entry.timespan;
+    });
+}
+
+template <typename TKey, typename TValue>
+template <typename TLookup>
+inline bool MemCache<TKey, TValue>::find_compressed(const TLookup& key, std::string_view encoding, std::string& value)
+{
+    bool result = false;
+    find_internal(key, [&value, &result, encoding](const MemCacheEntry& entry)
+    {
+        if constexpr (std::is_same_v<TValue, std::string>)
+        {
+            if ((entry.codec != nullptr) && (entry.codec->name() == encoding))
+            {
+                value = entry.value;
+                result = true;
+            }
+        }
+    });
+    return result;
+}
+
+template <typename TKey, typename TValue>
+inline void MemCache<TKey, TValue>::set_compression(const std::shared_ptr<const CacheCodec>& codec, size_t threshold, double ratio)
+{
+    // Keep all used codecs alive while their values are cached
+    if (codec && (std::find(_codecs.begin(), _codecs.end(), codec) == _codecs.end()))
+        _codecs.push_back(codec);
+
+    _codec = codec;
+    _threshold = threshold;
+    _ratio = ratio;
+}
+
+template <typename TKey, typename TValue>
+template <typename TValueArg>
+inline typename MemCache<TKey, TValue>::MemCacheEntry MemCache<TKey, TValue>::compress_internal(TValueArg&& value) const
+{
+    if constexpr (std::is_same_v<TValue, std::string>)
+    {
+        if (_codec && (value.size() >= _threshold))
+        {
+            // Keep the compressed value only if it is small enough
+            std::string buffer;
+            if (_codec->compress(value, buffer) && ((double)buffer.size() <= ((double)value.size() * _ratio)))
+            {
+                MemCacheEntry entry(std::move(buffer));
+                entry.codec = _codec.get();
+                entry.raw = value.size();
+                return entry;
+            }
+        }
+    }
+    return MemCacheEntry(std::forward<TValueArg>(value));
+}
+
+template <typename TKey, typename TValue>
+inline TValue MemCache<TKey, TValue>::value_internal(const MemCacheEntry& entry) const
+{
+    if constexpr (std::is_same_v<TValue, std::string>)
+    {
+        if (entry.codec != nullptr)
+        {
+            std::string result;
+            entry.codec->decompress(entry.value, entry.raw, result);
+            return result;
+        }
+    }
+    return entry.value;
+}
+
+template <typename TKey, typename TValue>
+inline TValue MemCache<TKey, TValue>::take_internal(MemCacheEntry& entry) const
+{
+    if constexpr (std::is_same_v<TValue, std::string>)
+        if (entry.codec != nullptr)
+            return value_internal(entry);
+    return std::move(entry.value);
+}
+
+template <typename TKey, typename TValue>
+template <typename TLoader>
+inline TValue MemCache<TKey, TValue>::get_or_compute(const TKey& key, TLoader&& loader, const Timespan& timeout)
+{
+    auto& shard = this->shard(key);
+
+    // Try to find the cached value
+    std::optional<TValue> cached;
+    uint64_t expiry = 0;
+    uint64_t cost = 0;
+    find_internal(key, [this, &cached, &expiry, &cost](const MemCacheEntry& entry)
     {
-        Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value, _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        cached = value_internal(entry);
+        expiry = expiry_internal(entry);
+        cost = entry.cost;
+    });
+
+    uint64_t now = utc_internal().total();
+    if (cached)
+    {
+        // Return the fresh value if it is not selected for the early refresh
+        if ((expiry == 0) || (now < expiry))
+        {
+            if (!refresh_internal(now, expiry, cost))
+                return std::move(*cached);
+        }
+        // Expired value out of the stale period is treated as missing
+        else if (now >= (expiry + (uint64_t)_stale.total()))
+            cached.reset();
+    }
+
+    std::promise<TValue> promise;
+    {
+        std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+        // Check the value loaded by another caller in the meantime
+        auto it = shard.entries_by_key.find(key);
+        if (it != shard.entries_by_key.end())
+        {
+            uint64_t current = expiry_internal(it->second);
+            if (((current == 0) || (now < current)) && (!cached || (current != expiry)))
+                return value_internal(it->second);
+        }
+
+        // Wait for the in-flight loader call or return the stale value
+        auto flight = shard.flights.find(key);
+        if (flight != shard.flights.end())
+        {
+            if (cached)
+                return std::move(*cached);
+
+            std::shared_future<TValue> future = flight->second;
+            locker.unlock();
+            return future.get();
+        }
+
+        // Register the in-flight loader call
+        shard.flights.emplace(key, promise.get_future().share());
+    }
+
+    try
+    {
+        // Load the value
+        uint64_t start = Timestamp::nano();
+        TValue value = loader(key);
+        uint64_t finish = Timestamp::nano();
+
+        // Insert the loaded value into the cache and complete the loader call
+        std::unique_lock<std::shared_mutex> locker(shard.lock);
+        if (insert_internal(shard, key, value, timeout))
+            shard.entries_by_key.find(key)->second.cost = finish - start;
+        shard.flights.erase(key);
+        locker.unlock();
+
+        promise.set_value(value);
+        return value;
+    }
+    catch (...)
+    {
+        // Complete the loader call with the exception
+        {
+            std::unique_lock<std::shared_mutex> locker(shard.lock);
+            shard.flights.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
+template <typename TKey, typename TValue>
+inline bool MemCache<TKey, TValue>::refresh_internal(uint64_t now, uint64_t expiry, uint64_t cost) const
+{
+    if ((_beta <= 0.0) || (expiry == 0) || (cost == 0))
+        return false;
+
+    // XFetch: refresh when the exponentially distributed gap reaches the expiry
+    thread_local std::minstd_rand generator(std::random_device{}());
+    std::uniform_real_distribution<double> distribution(std::numeric_limits<double>::min(), 1.0);
+    double gap = -(double)cost * _beta * std::log(distribution(generator));
+    return (((double)now + gap) >= (double)expiry);
+}
+
+template <typename TKey, typename TValue>
+template <typename TLookup, typename TFunction>
+inline bool MemCache<TKey, TValue>::find_internal(const TLookup& key, TFunction&& function)
+{
+    auto& shard = this->shard(key);
+
+    // Sample the operation latency and lock timings
+    bool sample = shard.counters.sample();
+    uint64_t start = sample ? Timestamp::nano() : 0;
+    uint64_t locked = 0;
+    bool result;
+
+    // LRU order is updated on each access, so it requires an exclusive lock
+    if (exclusive())
+    {
+        std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+        if (sample)
+            locked = Timestamp::nano();
+        result = find_internal(shard, key, function);
     }
     else
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value)));
+    {
+        std::shared_lock<std::shared_mutex> locker(shard.lock);
 
-    return true;
+        if (sample)
+            locked = Timestamp::nano();
+        result = find_internal(shard, key, function);
+    }
+
+    if (sample)
+        shard.counters.record_find(start, locked, Timestamp::nano());
+    return result;
 }
 
 template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key)
+template <typename TLookup, typename TFunction>
+inline bool MemCache<TKey, TValue>::find_internal(MemCacheShard& shard, const TLookup& key, TFunction&& function)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
+    // Update the key access frequency. Unbounded cache never evicts and is
+    // searched under the shared lock, so its frequency sketch is not updated.
+    if ((_eviction == MemCacheEviction::TINYLFU) && bounded())
+        increment_internal(shard, key);
 
     // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    auto it = shard.entries_by_key.find(key);
+    if (it == shard.entries_by_key.end())
+    {
+        shard.counters.miss();
         return false;
+    }
 
+    if (bounded())
+        touch_internal(shard, it->second);
+    function(it->second);
+    shard.counters.hit();
     return true;
 }
 
 template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value)
+inline size_t MemCache<TKey, TValue>::find_many(const TKey* keys, size_t count, TValue* values, bool* found)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
+    size_t result = 0;
+    batch_internal(count, exclusive(), [keys](size_t index) -> const TKey& { return keys[index]; }, [this, keys, values, found, &result](MemCacheShard& shard, size_t index)
+    {
+        bool success = find_internal(shard, keys[index], [this, values, index](const MemCacheEntry& entry) { values[index] = value_internal(entry); });
+        if (found != nullptr)
+            found[index] = success;
+        if (success)
+            ++result;
+    });
+    return result;
+}
 
-    // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+template <typename TKey, typename TValue>
+inline size_t MemCache<TKey, TValue>::insert_many(const std::pair<TKey, TValue>* items, size_t count, const Timespan& timeout)
+{
+    size_t result = 0;
+    batch_internal(count, true, [items](size_t index) -> const TKey& { return items[index].first; }, [this, items, &timeout, &result](MemCacheShard& shard, size_t index)
+    {
+        if (insert_internal(shard, items[index].first, items[index].second, timeout))
+            ++result;
+    });
+    return result;
+}
+
+template <typename TKey, typename TValue>
+inline size_t MemCache<TKey, TValue>::remove_many(const TKey* keys, size_t count)
+{
+    size_t result = 0;
+    batch_internal(count, true, [keys](size_t index) -> const TKey& { return keys[index]; }, [this, keys, &result](MemCacheShard& shard, size_t index)
+    {
+        if (remove_internal(shard, keys[index]))
+        {
+            shard.counters.remove();
+            ++result;
+        }
+    });
+    return result;
+}
+
+template <typename TKey, typename TValue>
+template <typename TKeyGetter, typename TFunction>
+inline void MemCache<TKey, TValue>::batch_internal(size_t count, bool exclusive, TKeyGetter&& key, TFunction&& function)
+{
+    // Process the batch in chunks to route keys to shards without allocations
+    const size_t CHUNK = 64;
+    size_t shards[CHUNK];
+
+    for (size_t offset = 0; offset < count; offset += CHUNK)
+    {
+        size_t size = std::min(CHUNK, count - offset);
+
+        // Route chunk keys to shards
+        for (size_t i = 0; i < size; ++i)
+            shards[i] = _hash(key(offset + i)) % _shards.size();
+
+        // Lock each shard once per chunk and process all its keys
+        for (size_t i = 0; i < size; ++i)
+        {
+            size_t current = shards[i];
+            if (current == _shards.size())
+                continue;
+
+            auto& shard = _shards[current];
+            if (exclusive)
+            {
+                std::unique_lock<std::shared_mutex> locker(shard.lock);
+                for (size_t j = i; j < size; ++j)
+                {
+                    if (shards[j] == current)
+                    {
+                        function(shard, offset + j);
+                        shards[j] = _shards.size();
+                    }
+                }
+            }
+            else
+            {
+                std::shared_lock<std::shared_mutex> locker(shard.lock);
+                for (size_t j = i; j < size; ++j)
+                {
+                    if (shards[j] == current)
+                    {
+                        function(shard, offset + j);
+                        shards[j] = _shards.size();
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename TKey, typename TValue>
+template <typename TLookup>
+inline bool MemCache<TKey, TValue>::remove(const TLookup& key)
+{
+    auto& shard = this->shard(key);
+
+    std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+    if (!remove_internal(shard, key))
         return false;
 
-    value = it->second.value;
+    shard.counters.remove();
     return true;
 }
 
 template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value, Timestamp& timeout)
+template <typename TLookup>
+inline bool MemCache<TKey, TValue>::remove_internal(MemCacheShard& shard, const TLookup& key)
 {
-    std::shared_lock<std::shared_mutex> locker(_lock);
-
     // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    auto it = shard.entries_by_key.find(key);
+    if (it == shard.entries_by_key.end())
         return false;
 
-    value = it->second.value;
-    timeout = it->second.timestamp + it->second.timespan;
+    erase_internal(shard, it);
+
     return true;
 }
 
 template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::remove(const TKey& key)
+inline void MemCache<TKey, TValue>::erase_internal(MemCacheShard& shard, typename MemCacheMap::iterator it)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    // Try to erase cache entry by timeout
+    if (it->second.timestamp.total() > 0)
+        shard.entries_by_timeout.remove(it->second.handle);
 
-    return remove_internal(key);
+    // Try to erase cache entry from the eviction order
+    if (bounded())
+    {
+        if (shard.hand == it->second.node)
+            ++shard.hand;
+        shard.order.erase(it->second.node);
+    }
+
+    // Erase cache entry
+    shard.bytes -= it->second.size;
+    shard.entries_by_key.erase(it);
 }
 
 template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::remove_internal(const TKey& key)
+inline bool MemCache<TKey, TValue>::evict_internal(MemCacheShard& shard)
 {
-    // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    if (shard.order.empty())
         return false;
 
-    // Try to erase cache entry by timestamp
-    if (it->second.timestamp.total() > 0)
-        _entries_by_timestamp.erase(it->second.timestamp);
+    typename MemCacheOrder::iterator victim;
+    if (_eviction == MemCacheEviction::CLOCK)
+    {
+        // Move the clock hand over referenced entries giving them the second chance
+        for (;;)
+        {
+            if (shard.hand == shard.order.end())
+                shard.hand = shard.order.begin();
+            if (!shard.hand->referenced.exchange(false, std::memory_order_relaxed))
+                break;
+            ++shard.hand;
+        }
+        victim = shard.hand;
+    }
+    else
+        victim = std::prev(shard.order.end());
 
-    // Erase cache entry
-    _entries_by_key.erase(it);
+    // Erase the victim cache entry
+    auto it = shard.entries_by_key.find(victim->key);
+    if (_evict_handler)
+        _evict_handler(it->first, take_internal(it->second), Timestamp(expiry_internal(it->second)));
+    erase_internal(shard, it);
+    shard.counters.evict();
 
     return true;
 }
 
+template <typename TKey, typename TValue>
+inline bool MemCache<TKey, TValue>::overflow_internal(const MemCacheShard& shard, size_t size) const noexcept
+{
+    if ((_shard_capacity > 0) && ((shard.entries_by_key.size() + 1) > _shard_capacity))
+        return true;
+    if ((_shard_budget > 0) && ((shard.bytes + size) > _shard_budget))
+        return true;
+    return false;
+}
+
+template <typename TKey, typename TValue>
+inline void MemCache<TKey, TValue>::touch_internal(MemCacheShard& shard, MemCacheEntry& entry)
+{
+    if (_eviction == MemCacheEviction::CLOCK)
+        entry.node->referenced.store(true, std::memory_order_relaxed);
+    else
+        shard.order.splice(shard.order.begin(), shard.order, entry.node);
+}
+
+template <typename TKey, typename TValue>
+inline size_t MemCache<TKey, TValue>::sketch_index(size_t hash, size_t row, size_t mask) const noexcept
+{
+    uint64_t h = (uint64_t)hash + (row + 1) * 0x9E3779B97F4A7C15ull;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    h = h ^ (h >> 31);
+    return (size_t)h & mask;
+}
+
+template <typename TKey, typename TValue>
+template <typename TLookup>
+inline size_t MemCache<TKey, TValue>::frequency_internal(const MemCacheShard& shard, const TLookup& key) const
+{
+    size_t hash = _hash(key);
+    size_t mask = shard.sketch.size() - 1;
+
+    // Estimate the key frequency as a minimum of Count-Min sketch counters
+    size_t result = 0xFF;
+    for (size_t row = 0; row < 4; ++row)
+        result = std::min(result, (size_t)shard.sketch[sketch_index(hash, row, mask)]);
+    return result;
+}
+
+template <typename TKey, typename TValue>
+template <typename TLookup>
+inline void MemCache<TKey, TValue>::increment_internal(MemCacheShard& shard, const TLookup& key)
+{
+    size_t hash = _hash(key);
+    size_t mask = shard.sketch.size() - 1;
+
+    // Increment 4-bit saturated Count-Min sketch counters
+    for (size_t row = 0; row < 4; ++row)
+    {
+        uint8_t& counter = shard.sketch[sketch_index(hash, row, mask)];
+        if (counter < 15)
+            ++counter;
+    }
+
+    // Age the sketch by halving all counters after the sample period
+    if (++shard.samples >= (shard.sketch.size() * 2))
+    {
+        for (auto& counter : shard.sketch)
+            counter >>= 1;
+        shard.samples /= 2;
+    }
+}
+
+template <typename TKey, typename TValue>
+inline size_t MemCache<TKey, TValue>::evict(size_t count)
+{
+    if (!bounded() || (count == 0))
+        return 0;
+
+    // Split evicted entries evenly between shards
+    size_t quota = (count + _shards.size() - 1) / _shards.size();
+
+    size_t result = 0;
+    for (auto& shard : _shards)
+    {
+        std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+        for (size_t i = 0; (i < quota) && (result < count) && evict_internal(shard); ++i)
+            ++result;
+    }
+    return result;
+}
+
 template <typename TKey, typename TValue>
 inline void MemCache<TKey, TValue>::clear()
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    for (auto& shard : _shards)
+    {
+        std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+        // Clear all cache entries
+        shard.entries_by_key.clear();
+        shard.entries_by_timeout.clear();
+        shard.order.clear();
+        shard.hand = shard.order.end();
+        shard.bytes = 0;
+    }
+}
+
+template <typename TKey, typename TValue>
+template <class TKeySerializer, class TValueSerializer>
+inline uint64_t MemCache<TKey, TValue>::snapshot(const Path& path) const
+{
+    CacheSnapshot snapshot(path);
+
+    for (const auto& shard : _shards)
+    {
+        // Copy shard entries under the shared shard lock
+        {
+            std::shared_lock<std::shared_mutex> locker(shard.lock);
+            for (const auto& entry : shard.entries_by_key)
+            {
+                // Compressed values are saved decompressed
+                if (entry.second.codec != nullptr)
+                    snapshot.template Append<TKeySerializer, TValueSerializer>(entry.first, value_internal(entry.second), expiry_internal(entry.second));
+                else
+                    snapshot.template Append<TKeySerializer, TValueSerializer>(entry.first, entry.second.value, expiry_internal(entry.second));
+            }
+        }
+
+        // Write shard records without the shard lock
+        snapshot.Flush();
+    }
 
-    // Clear all cache entries
-    _entries_by_key.clear();
-    _entries_by_timestamp.clear();
+    snapshot.Commit();
+    return snapshot.count();
 }
 
 template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::watchdog(const UtcTimestamp& utc)
+template <class TKeySerializer, class TValueSerializer>
+inline size_t MemCache<TKey, TValue>::restore(const Path& path, size_t threads)
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    MappedFile file(path);
+    file.Advise(MappedFileAdvice::SEQUENTIAL);
+    std::vector<CacheSnapshot::Record> records = CacheSnapshot::Read(file);
+    if (records.empty())
+        return 0;
 
-    // Watchdog for cache entries
-    auto it_entry_by_timestamp = _entries_by_timestamp.begin();
-    while (it_entry_by_timestamp != _entries_by_timestamp.end())
+    uint64_t now = utc_internal().total();
+
+    // Restore the range of snapshot records
+    std::atomic<size_t> result(0);
+    auto worker = [this, &path, &records, &result, now](size_t first, size_t last)
     {
-        // Check for the cache entry timeout
-        auto it_entry_by_key = _entries_by_key.find(it_entry_by_timestamp->second);
-        if ((it_entry_by_key->second.timestamp + it_entry_by_key->second.timespan) <= utc)
+        size_t restored = 0;
+        for (size_t i = first; i < last; ++i)
         {
-            // Erase the cache entry with timeout
-            _entries_by_key.erase(it_entry_by_key);
-            _entries_by_timestamp.erase(it_entry_by_timestamp);
-            it_entry_by_timestamp = _entries_by_timestamp.begin();
-            continue;
+            const auto& record = records[i];
+
+            // Skip entries expired since the snapshot
+            if ((record.expiry > 0) && (record.expiry <= now))
+                continue;
+
+            TKey key;
+            TValue value;
+            if (!TKeySerializer::decode(record.key, key) || !TValueSerializer::decode(record.value, value))
+                throwex FileSystemException("Invalid cache snapshot record!").Attach(path);
+
+            Timespan timeout((record.expiry > 0) ? (int64_t)(record.expiry - now) : 0);
+            if (insert_internal(std::move(key), std::move(value), timeout))
+                ++restored;
         }
-        else
-            break;
+        result += restored;
+    };
+
+    // Split snapshot records between restore threads
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    threads = std::max(std::min(threads, records.size() / RESTORE_CHUNK), (size_t)1);
+    size_t chunk = (records.size() + threads - 1) / threads;
+
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i)
+    {
+        workers.emplace_back([&worker, &errors, &records, chunk, i]()
+        {
+            try { worker(i * chunk, std::min((i + 1) * chunk, records.size())); }
+            catch (...) { errors[i] = std::current_exception(); }
+        });
     }
+    try { worker(0, std::min(chunk, records.size())); }
+    catch (...) { errors[0] = std::current_exception(); }
+    for (auto& thread : workers)
+        thread.join();
+
+    // Rethrow the first restore error
+    for (auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+
+    return result;
+}
+
+template <typename TKey, typename TValue>
+inline CacheStatistics MemCache<TKey, TValue>::statistics() const
+{
+    CacheStatistics result;
+    for (const auto& shard : _shards)
+    {
+        shard.counters.collect(result);
+
+        std::shared_lock<std::shared_mutex> locker(shard.lock);
+        result.entries += shard.entries_by_key.size();
+        result.bytes += shard.bytes;
+    }
+    return result;
+}
+
+template <typename TKey, typename TValue>
+inline void MemCache<TKey, TValue>::reset_statistics()
+{
+    for (auto& shard : _shards)
+        shard.counters.reset();
+}
+
+template <typename TKey, typename TValue>
+inline void MemCache<TKey, TValue>::watchdog(const UtcTimestamp& utc)
+{
+    std::vector<TValue> expired;
+    expired.reserve(WATCHDOG_CHUNK);
+
+    // Sweep cache shards one at a time
+    for (auto& shard : _shards)
+    {
+        size_t count;
+        do
+        {
+            std::unique_lock<std::shared_mutex> locker(shard.lock);
+
+            // Watchdog for the bounded chunk of cache entries
+            count = shard.entries_by_timeout.advance(utc, [this, &shard, &expired](TKey& key)
+            {
+                // Erase the cache entry with timeout
+                auto it = shard.entries_by_key.find(key);
+                if (it != shard.entries_by_key.end())
+                {
+                    expired.emplace_back(std::move(it->second.value));
+                    erase_internal(shard, it);
+                    shard.counters.expire();
+                }
+            }, WATCHDOG_CHUNK);
+
+            locker.unlock();
+
+            // Free expired values without the shard lock
+            expired.clear();
+        } while (count == WATCHDOG_CHUNK);
+    }
+}
+
+template <typename TKey, typename TValue>
+inline bool MemCache<TKey, TValue>::start_watchdog(const Timespan& period)
+{
+    return _watchdog.start(period, [this]() { watchdog(); });
+}
+
+template <typename TKey, typename TValue>
+inline bool MemCache<TKey, TValue>::stop_watchdog()
+{
+    return _watchdog.stop();
 }
 
 template <typename TKey, typename TValue>
 inline void MemCache<TKey, TValue>::swap(MemCache& cache) noexcept
 {
-    std::unique_lock<std::shared_mutex> locker1(_lock);
-    std::unique_lock<std::shared_mutex> locker2(cache._lock);
+    if (this == &cache)
+        return;
+
+    // Lock all shards of both caches in the order of caches addresses,
+    // so concurrent a.swap(b) and b.swap(a) cannot deadlock
+    bool order = std::less<const MemCache*>()(this, &cache);
+    MemCache& first = order ? *this : cache;
+    MemCache& second = order ? cache : *this;
+    for (auto& shard : first._shards)
+        shard.lock.lock();
+    for (auto& shard : second._shards)
+        shard.lock.lock();
 
     using std::swap;
-    swap(_timestamp, cache._timestamp);
-    swap(_entries_by_key, cache._entries_by_key);
-    swap(_entries_by_timestamp, cache._entries_by_timestamp);
+    swap(_hash, cache._hash);
+    swap(_shards, cache._shards);
+    swap(_eviction, cache._eviction);
+    swap(_capacity, cache._capacity);
+    swap(_budget, cache._budget);
+    swap(_shard_capacity, cache._shard_capacity);
+    swap(_shard_budget, cache._shard_budget);
+    swap(_handler, cache._handler);
+    swap(_evict_handler, cache._evict_handler);
+    swap(_coarse, cache._coarse);
+    swap(_stale, cache._stale);
+    swap(_beta, cache._beta);
+    swap(_codec, cache._codec);
+    swap(_codecs, cache._codecs);
+    swap(_threshold, cache._threshold);
+    swap(_ratio, cache._ratio);
+
+    // Unlock all shards of both caches
+    for (auto& shard : _shards)
+        shard.lock.unlock();
+    for (auto& shard : cache._shards)
+        shard.lock.unlock();
 }
 
 template <typename TKey, typename TValue>
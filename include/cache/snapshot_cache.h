@@ -0,0 +1,193 @@
+/*!
+    \file snapshot_cache.h
+    \brief Read-mostly snapshot memory cache definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_SNAPSHOT_CACHE_H
+#define CPPCOMMON_CACHE_SNAPSHOT_CACHE_H
+
+#include "algorithms/timing_wheel.h"
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace CppCommon {
+
+//! Read-mostly snapshot memory cache
+/*!
+    Snapshot memory cache has the same API as MemCache, but optimized for
+    read-mostly workloads in RCU (read-copy-update) style:
+    - find() reads an immutable, atomically published snapshot of the cache
+      without taking any lock, so the read latency does not depend on the
+      count of reader threads;
+    - writers update a private copy of the cache under the writer lock and
+      publish a new snapshot after the given batch of updates (or with an
+      explicit publish() call);
+    - old snapshots are reclaimed after the grace period when all readers
+      that could observe them have left (epoch-based reclamation with
+      per-thread reader slots).
+
+    Updates become visible to readers only after the snapshot is published.
+    Each publish copies the whole cache, so update batches should be large
+    enough to amortize it.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue>
+class SnapshotCache
+{
+public:
+    //! Initialize the snapshot memory cache
+    /*!
+        \param batch - Count of updates to publish a new snapshot automatically (default is 1, 0 - publish manually)
+    */
+    explicit SnapshotCache(size_t batch = 1);
+    SnapshotCache(const SnapshotCache&) = delete;
+    SnapshotCache(SnapshotCache&&) = delete;
+    ~SnapshotCache();
+
+    SnapshotCache& operator=(const SnapshotCache&) = delete;
+    SnapshotCache& operator=(SnapshotCache&&) = delete;
+
+    //! Check if the published memory cache snapshot is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the published memory cache snapshot empty?
+    bool empty() const;
+
+    //! Get the published memory cache snapshot size
+    size_t size() const;
+
+    //! Get the count of unpublished updates
+    size_t pending() const;
+
+    //! Emplace a new cache value with the given timeout into the memory cache
+    /*!
+        \param key - Key to emplace
+        \param value - Value to emplace
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return 'true' if the cache value was emplaced, 'false' if the given key was not emplaced
+    */
+    bool emplace(TKey&& key, TValue&& value, const Timespan& timeout = Timespan(0));
+
+    //! Insert a new cache value with the given timeout into the memory cache
+    /*!
+        \param key - Key to insert
+        \param value - Value to insert
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return 'true' if the cache value was inserted, 'false' if the given key was not inserted
+    */
+    bool insert(const TKey& key, const TValue& value, const Timespan& timeout = Timespan(0));
+
+    //! Try to find the cache value by the given key in the published snapshot
+    /*!
+        Lock-free.
+
+        \param key - Key to find
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key) const;
+    //! Try to find the cache value by the given key in the published snapshot
+    /*!
+        Lock-free.
+
+        \param key - Key to find
+        \param value - Value to find
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key, TValue& value) const;
+    //! Try to find the cache value with timeout by the given key in the published snapshot
+    /*!
+        Lock-free.
+
+        \param key - Key to find
+        \param value - Value to find
+        \param timeout - Cache timeout value
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key, TValue& value, Timestamp& timeout) const;
+
+    //! Remove the cache value with the given key from the memory cache
+    /*!
+        \param key - Key to remove
+        \return 'true' if the cache value was removed, 'false' if the given key was not found
+    */
+    bool remove(const TKey& key);
+
+    //! Clear the memory cache
+    void clear();
+
+    //! Publish a new memory cache snapshot with all pending updates
+    /*!
+        Will block until the previous snapshot is not used by readers.
+    */
+    void publish();
+
+    //! Watchdog the memory cache
+    /*!
+        \param utc - UTC timestamp to check cache timeouts (default is UtcTimestamp())
+    */
+    void watchdog(const UtcTimestamp& utc = UtcTimestamp());
+
+private:
+    typedef char cache_line_pad[128];
+
+    struct SnapshotEntry
+    {
+        TValue value;
+        Timestamp timestamp;
+        Timespan timespan;
+        typename TimingWheel<TKey>::Handle handle{TimingWheel<TKey>::INVALID};
+
+        SnapshotEntry() = default;
+        SnapshotEntry(const TValue& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(v), timestamp(ts), timespan(tp) {}
+        SnapshotEntry(TValue&& v, const Timestamp& ts = Timestamp(), const Timespan& tp = Timespan()) : value(std::move(v)), timestamp(ts), timespan(tp) {}
+    };
+
+    typedef std::unordered_map<TKey, SnapshotEntry> Snapshot;
+
+    struct ReaderSlot
+    {
+        std::atomic<size_t> readers[2];
+        cache_line_pad pad;
+
+        ReaderSlot() { readers[0] = 0; readers[1] = 0; }
+    };
+
+    static const size_t SLOTS = 64;
+
+    cache_line_pad _pad0;
+    std::atomic<const Snapshot*> _snapshot;
+    std::atomic<size_t> _epoch;
+    cache_line_pad _pad1;
+    mutable ReaderSlot _slots[SLOTS];
+
+    std::mutex _lock;
+    Snapshot _entries;
+    TimingWheel<TKey> _entries_by_timeout;
+    size_t _batch;
+    std::atomic<size_t> _pending;
+
+    template <typename TFunction>
+    bool find_internal(TFunction&& function) const;
+    template <typename TKeyArg, typename TValueArg>
+    bool insert_internal(TKeyArg&& key, TValueArg&& value, const Timespan& timeout);
+    bool remove_internal(const TKey& key);
+    void update_internal();
+    void publish_internal();
+
+    static ReaderSlot& slot(ReaderSlot* slots) noexcept;
+};
+
+} // namespace CppCommon
+
+#include "snapshot_cache.inl"
+
+#endif // CPPCOMMON_CACHE_SNAPSHOT_CACHE_H
@@ -0,0 +1,244 @@
+/*!
+    \file snapshot_cache.inl
+    \brief Read-mostly snapshot memory cache inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue>
+inline SnapshotCache<TKey, TValue>::SnapshotCache(size_t batch)
+    : _snapshot(new Snapshot()),
+      _epoch(0),
+      _batch(batch),
+      _pending(0)
+{
+}
+
+template <typename TKey, typename TValue>
+inline SnapshotCache<TKey, TValue>::~SnapshotCache()
+{
+    delete _snapshot.load();
+}
+
+template <typename TKey, typename TValue>
+inline typename SnapshotCache<TKey, TValue>::ReaderSlot& SnapshotCache<TKey, TValue>::slot(ReaderSlot* slots) noexcept
+{
+    // Each thread is bound to its own reader slot
+    static std::atomic<size_t> counter(0);
+    thread_local size_t index = counter.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+    return slots[index];
+}
+
+template <typename TKey, typename TValue>
+template <typename TFunction>
+inline bool SnapshotCache<TKey, TValue>::find_internal(TFunction&& function) const
+{
+    ReaderSlot& reader = slot(_slots);
+
+    // Enter the current epoch
+    size_t epoch;
+    for (;;)
+    {
+        epoch = _epoch.load(std::memory_order_acquire);
+        reader.readers[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+        if (_epoch.load(std::memory_order_seq_cst) == epoch)
+            break;
+        reader.readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+    }
+
+    // Read the published snapshot
+    const Snapshot* snapshot = _snapshot.load(std::memory_order_acquire);
+    bool result = function(*snapshot);
+
+    // Leave the current epoch
+    reader.readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+
+    return result;
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::empty() const
+{
+    return find_internal([](const Snapshot& snapshot) { return snapshot.empty(); });
+}
+
+template <typename TKey, typename TValue>
+inline size_t SnapshotCache<TKey, TValue>::size() const
+{
+    size_t result = 0;
+    find_internal([&result](const Snapshot& snapshot) { result = snapshot.size(); return true; });
+    return result;
+}
+
+template <typename TKey, typename TValue>
+inline size_t SnapshotCache<TKey, TValue>::pending() const
+{
+    return _pending.load(std::memory_order_relaxed);
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::find(const TKey& key) const
+{
+    return find_internal([&key](const Snapshot& snapshot)
+    {
+        return snapshot.find(key) != snapshot.end();
+    });
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::find(const TKey& key, TValue& value) const
+{
+    return find_internal([&key, &value](const Snapshot& snapshot)
+    {
+        auto it = snapshot.find(key);
+        if (it == snapshot.end())
+            return false;
+
+        value = it->second.value;
+        return true;
+    });
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::find(const TKey& key, TValue& value, Timestamp& timeout) const
+{
+    return find_internal([&key, &value, &timeout](const Snapshot& snapshot)
+    {
+        auto it = snapshot.find(key);
+        if (it == snapshot.end())
+            return false;
+
+        value = it->second.value;
+        timeout = it->second.timestamp + it->second.timespan;
+        return true;
+    });
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::emplace(TKey&& key, TValue&& value, const Timespan& timeout)
+{
+    return insert_internal(std::move(key), std::move(value), timeout);
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+{
+    return insert_internal(key, value, timeout);
+}
+
+template <typename TKey, typename TValue>
+template <typename TKeyArg, typename TValueArg>
+inline bool SnapshotCache<TKey, TValue>::insert_internal(TKeyArg&& key, TValueArg&& value, const Timespan& timeout)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    // Try to find and remove the previous key
+    remove_internal(key);
+
+    // Update the cache entry
+    SnapshotEntry entry(std::forward<TValueArg>(value));
+    if (timeout.total() > 0)
+    {
+        entry.timestamp = UtcTimestamp();
+        entry.timespan = timeout;
+        entry.handle = _entries_by_timeout.insert(entry.timestamp + timeout, key);
+    }
+    _entries.emplace(std::forward<TKeyArg>(key), std::move(entry));
+
+    update_internal();
+    return true;
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::remove(const TKey& key)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    if (!remove_internal(key))
+        return false;
+
+    update_internal();
+    return true;
+}
+
+template <typename TKey, typename TValue>
+inline bool SnapshotCache<TKey, TValue>::remove_internal(const TKey& key)
+{
+    // Try to find the given key
+    auto it = _entries.find(key);
+    if (it == _entries.end())
+        return false;
+
+    // Try to erase cache entry by timeout
+    if (it->second.timestamp.total() > 0)
+        _entries_by_timeout.remove(it->second.handle);
+
+    // Erase cache entry
+    _entries.erase(it);
+
+    return true;
+}
+
+template <typename TKey, typename TValue>
+inline void SnapshotCache<TKey, TValue>::clear()
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    // Clear all cache entries
+    _entries.clear();
+    _entries_by_timeout.clear();
+
+    update_internal();
+}
+
+template <typename TKey, typename TValue>
+inline void SnapshotCache<TKey, TValue>::publish()
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    publish_internal();
+}
+
+template <typename TKey, typename TValue>
+inline void SnapshotCache<TKey, TValue>::watchdog(const UtcTimestamp& utc)
+{
+    std::unique_lock<std::mutex> locker(_lock);
+
+    // Watchdog for cache entries
+    size_t expired = _entries_by_timeout.advance(utc, [this](TKey& key) { _entries.erase(key); });
+    if (expired > 0)
+        update_internal();
+}
+
+template <typename TKey, typename TValue>
+inline void SnapshotCache<TKey, TValue>::update_internal()
+{
+    // Publish a new snapshot after the batch of updates
+    size_t pending = _pending.load(std::memory_order_relaxed) + 1;
+    _pending.store(pending, std::memory_order_relaxed);
+    if ((_batch > 0) && (pending >= _batch))
+        publish_internal();
+}
+
+template <typename TKey, typename TValue>
+inline void SnapshotCache<TKey, TValue>::publish_internal()
+{
+    // Publish a new snapshot and flip the epoch
+    const Snapshot* snapshot = new Snapshot(_entries);
+    const Snapshot* previous = _snapshot.exchange(snapshot, std::memory_order_seq_cst);
+    size_t epoch = _epoch.fetch_add(1, std::memory_order_seq_cst);
+    _pending.store(0, std::memory_order_relaxed);
+
+    // Wait for the grace period: all readers of the previous epoch must leave
+    for (auto& reader : _slots)
+        while (reader.readers[epoch & 1].load(std::memory_order_acquire) != 0)
+            std::this_thread::yield();
+
+    // Reclaim the previous snapshot
+    delete previous;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,200 @@
+/*!
+    \file tiered_cache.h
+    \brief Tiered memory / disk cache definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CACHE_TIERED_CACHE_H
+#define CPPCOMMON_CACHE_TIERED_CACHE_H
+
+#include "algorithms/crc32c.h"
+#include "cache/cache_snapshot.h"
+#include "cache/memcache.h"
+#include "filesystem/file.h"
+
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace CppCommon {
+
+//! Tiered memory / disk cache
+/*!
+    Tiered cache keeps the hot set of entries in the bounded memory cache
+    (L1 tier) and demotes entries evicted from it into the log-structured
+    disk store (L2 tier). Entries found in the disk tier are promoted back
+    into the memory cache, so the hot set is served with the memory cache
+    latency and the cold tail is kept on disk instead of being dropped.
+
+    Each key is kept in exactly one tier. The disk tier index is a compact
+    key directory which maps keys to offsets of their records in the log
+    file, values are never kept in memory. Values are encoded with the
+    cache serializer (see CacheSerializer). Demoted values are appended to
+    the end of the log file with a CRC32C checksum, promoted and overwritten
+    records become garbage which is reclaimed by the log compaction.
+
+    The log file is a spill area of the current process: it is truncated on
+    construction and removed on destruction.
+
+    Hot entries are found in the memory cache without the disk tier lock.
+    Inserts, removals and disk tier lookups are serialized by the disk tier
+    lock.
+
+    Thread-safe.
+
+    https://riak.com/assets/bitcask-intro.pdf
+*/
+template <typename TKey, typename TValue, class TCodec = CacheSerializer<TValue>>
+class TieredCache
+{
+public:
+    //! Size of the record header in the log file (8)
+    static const size_t HEADER_SIZE = 8;
+
+    //! Initialize the tiered cache
+    /*!
+        \param path - Log file path of the disk tier
+        \param capacity - Maximal count of memory cache entries
+        \param shards - Count of memory cache shards (default is 1)
+        \param eviction - Memory cache eviction policy (default is MemCacheEviction::LRU)
+    */
+    TieredCache(const Path& path, size_t capacity, size_t shards = 1, MemCacheEviction eviction = MemCacheEviction::LRU);
+    TieredCache(const TieredCache&) = delete;
+    TieredCache(TieredCache&&) = delete;
+    ~TieredCache();
+
+    TieredCache& operator=(const TieredCache&) = delete;
+    TieredCache& operator=(TieredCache&&) = delete;
+
+    //! Check if the tiered cache is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the tiered cache empty?
+    bool empty() const { return (size() == 0); }
+
+    //! Get the tiered cache size
+    size_t size() const;
+    //! Get the count of memory tier entries
+    size_t memory_size() const { return _memory.size(); }
+    //! Get the count of disk tier entries
+    size_t disk_size() const;
+    //! Get the log file size in bytes
+    uint64_t disk_bytes() const;
+    //! Get the size of garbage records in the log file in bytes
+    uint64_t garbage_bytes() const;
+    //! Get the log file path
+    const Path& path() const noexcept { return _path; }
+
+    //! Get the memory tier
+    const MemCache<TKey, TValue>& memory() const noexcept { return _memory; }
+
+    //! Get the count of entries demoted into the disk tier
+    uint64_t demotions() const;
+    //! Get the count of entries promoted into the memory tier
+    uint64_t promotions() const;
+
+    //! Get the log compaction threshold in bytes
+    uint64_t compaction_threshold() const;
+    //! Set the log compaction threshold in bytes
+    /*!
+        The log file is compacted automatically when garbage records take
+        more than half of the log file and more than the given threshold.
+
+        \param threshold - Log compaction threshold in bytes (0 - compact manually)
+    */
+    void set_compaction_threshold(uint64_t threshold);
+
+    //! Insert a new cache value with the given timeout into the tiered cache
+    /*!
+        The value is inserted into the memory tier. If the memory tier
+        rejects it with the admission filter the value is written into the
+        disk tier.
+
+        \param key - Key to insert
+        \param value - Value to insert
+        \param timeout - Cache timeout (default is 0 - no timeout)
+        \return 'true' if the cache value was inserted, 'false' if the value is too large for the disk tier
+    */
+    bool insert(const TKey& key, const TValue& value, const Timespan& timeout = Timespan(0));
+
+    //! Try to find the cache value by the given key
+    /*!
+        \param key - Key to find
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key) { TValue value; return find(key, value); }
+    //! Try to find the cache value by the given key
+    /*!
+        Value found in the disk tier is promoted into the memory tier.
+
+        \param key - Key to find
+        \param value - Value to find
+        \return 'true' if the cache value was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key, TValue& value);
+
+    //! Remove the cache value with the given key from the tiered cache
+    /*!
+        \param key - Key to remove
+        \return 'true' if the cache value was removed, 'false' if the given key was not found
+    */
+    bool remove(const TKey& key);
+
+    //! Clear the tiered cache
+    void clear();
+
+    //! Compact the log file
+    /*!
+        Live records are copied into the new log file which replaces the
+        current one, garbage records are dropped.
+    */
+    void compact();
+
+    //! Watchdog the tiered cache
+    /*!
+        Expired entries of the memory tier are removed by the memory cache
+        watchdog, expired entries of the disk tier are removed from the key
+        directory.
+
+        \param utc - UTC timestamp to check cache timeouts (default is UtcTimestamp())
+    */
+    void watchdog(const UtcTimestamp& utc = UtcTimestamp());
+
+private:
+    struct Location
+    {
+        uint64_t offset;
+        uint32_t size;
+        uint64_t expiry;
+    };
+
+    Path _path;
+    MemCache<TKey, TValue> _memory;
+    mutable std::mutex _lock;
+    File _file;
+    std::unordered_map<TKey, Location> _index;
+    uint64_t _tail;
+    uint64_t _garbage;
+    uint64_t _threshold;
+    uint64_t _demotions;
+    uint64_t _promotions;
+    std::string _buffer;
+
+    bool demote_internal(const TKey& key, const TValue& value, uint64_t expiry);
+    bool read_internal(const Location& location, TValue& value);
+    void discard_internal(const TKey& key);
+    void compact_internal();
+};
+
+/*! \example cache_tiered_cache.cpp Tiered memory / disk cache example */
+
+} // namespace CppCommon
+
+#include "tiered_cache.inl"
+
+#endif // CPPCOMMON_CACHE_TIERED_CACHE_H
@@ -0,0 +1,306 @@
+/*!
+    \file tiered_cache.inl
+    \brief Tiered memory / disk cache inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, class TCodec>
+inline TieredCache<TKey, TValue, TCodec>::TieredCache(const Path& path, size_t capacity, size_t shards, MemCacheEviction eviction)
+    : _path(path),
+      _memory(shards, capacity, eviction),
+      _file(path),
+      _tail(0),
+      _garbage(0),
+      _threshold(64 * 1024 * 1024),
+      _demotions(0),
+      _promotions(0)
+{
+    _file.OpenOrCreate(true, true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+
+    // Demote entries evicted from the memory tier into the disk tier.
+    // Memory tier is modified only under the disk tier lock, so the handler
+    // is always called with the disk tier lock held.
+    _memory.set_eviction_handler([this](const TKey& key, TValue&& value, const Timestamp& expiry)
+    {
+        demote_internal(key, value, expiry.total());
+    });
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline TieredCache<TKey, TValue, TCodec>::~TieredCache()
+{
+    try
+    {
+        // Remove the spill log file
+        _file.Close();
+        Path::Remove(_path);
+    }
+    catch (...) {}
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline size_t TieredCache<TKey, TValue, TCodec>::size() const
+{
+    std::scoped_lock locker(_lock);
+    return _memory.size() + _index.size();
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline size_t TieredCache<TKey, TValue, TCodec>::disk_size() const
+{
+    std::scoped_lock locker(_lock);
+    return _index.size();
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline uint64_t TieredCache<TKey, TValue, TCodec>::disk_bytes() const
+{
+    std::scoped_lock locker(_lock);
+    return _tail;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline uint64_t TieredCache<TKey, TValue, TCodec>::garbage_bytes() const
+{
+    std::scoped_lock locker(_lock);
+    return _garbage;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline uint64_t TieredCache<TKey, TValue, TCodec>::demotions() const
+{
+    std::scoped_lock locker(_lock);
+    return _demotions;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline uint64_t TieredCache<TKey, TValue, TCodec>::promotions() const
+{
+    std::scoped_lock locker(_lock);
+    return _promotions;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline uint64_t TieredCache<TKey, TValue, TCodec>::compaction_threshold() const
+{
+    std::scoped_lock locker(_lock);
+    return _threshold;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline void TieredCache<TKey, TValue, TCodec>::set_compaction_threshold(uint64_t threshold)
+{
+    std::scoped_lock locker(_lock);
+    _threshold = threshold;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline bool TieredCache<TKey, TValue, TCodec>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+{
+    std::scoped_lock locker(_lock);
+
+    // Discard the previous value from the disk tier
+    discard_internal(key);
+
+    if (_memory.insert(key, value, timeout))
+        return true;
+
+    // Spill the value rejected by the memory tier admission filter
+    uint64_t expiry = (timeout.total() > 0) ? (UtcTimestamp() + timeout).total() : 0;
+    return demote_internal(key, value, expiry);
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline bool TieredCache<TKey, TValue, TCodec>::find(const TKey& key, TValue& value)
+{
+    // Find the hot value without the disk tier lock
+    if (_memory.find(key, value))
+        return true;
+
+    std::scoped_lock locker(_lock);
+
+    // Check the value promoted in the meantime
+    if (_memory.find(key, value))
+        return true;
+
+    auto it = _index.find(key);
+    if (it == _index.end())
+        return false;
+
+    Location location = it->second;
+    uint64_t now = UtcTimestamp().total();
+
+    // Drop expired or corrupted records
+    if (((location.expiry > 0) && (location.expiry <= now)) || !read_internal(location, value))
+    {
+        discard_internal(key);
+        return false;
+    }
+
+    // Promote the value into the memory tier
+    Timespan timeout((location.expiry > 0) ? (int64_t)(location.expiry - now) : 0);
+    if (_memory.insert(key, value, timeout))
+    {
+        discard_internal(key);
+        ++_promotions;
+    }
+
+    return true;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline bool TieredCache<TKey, TValue, TCodec>::remove(const TKey& key)
+{
+    std::scoped_lock locker(_lock);
+
+    bool result = _memory.remove(key);
+    if (_index.find(key) != _index.end())
+    {
+        discard_internal(key);
+        result = true;
+    }
+    return result;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline void TieredCache<TKey, TValue, TCodec>::clear()
+{
+    std::scoped_lock locker(_lock);
+
+    _memory.clear();
+    _index.clear();
+    _file.Resize(0);
+    _tail = 0;
+    _garbage = 0;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline void TieredCache<TKey, TValue, TCodec>::compact()
+{
+    std::scoped_lock locker(_lock);
+    compact_internal();
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline void TieredCache<TKey, TValue, TCodec>::watchdog(const UtcTimestamp& utc)
+{
+    std::scoped_lock locker(_lock);
+
+    _memory.watchdog(utc);
+
+    // Remove expired entries from the key directory
+    for (auto it = _index.begin(); it != _index.end();)
+    {
+        if ((it->second.expiry > 0) && (it->second.expiry <= utc.total()))
+        {
+            _garbage += HEADER_SIZE + it->second.size;
+            it = _index.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline bool TieredCache<TKey, TValue, TCodec>::demote_internal(const TKey& key, const TValue& value, uint64_t expiry)
+{
+    // Skip expired values
+    if ((expiry > 0) && (expiry <= UtcTimestamp().total()))
+        return false;
+
+    _buffer.assign(HEADER_SIZE, 0);
+    TCodec::encode(value, _buffer);
+    size_t size = _buffer.size() - HEADER_SIZE;
+    if (size > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    // Prepare the record header: value size and CRC32C checksum of the value
+    uint32_t size32 = (uint32_t)size;
+    uint32_t crc = CRC32C::Compute(_buffer.data() + HEADER_SIZE, size);
+    std::memcpy(_buffer.data(), &size32, 4);
+    std::memcpy(_buffer.data() + 4, &crc, 4);
+
+    // Append the record to the log file
+    _file.WriteAt(_tail, _buffer.data(), _buffer.size());
+
+    // Update the key directory
+    discard_internal(key);
+    _index[key] = Location{ _tail, size32, expiry };
+    _tail += _buffer.size();
+    ++_demotions;
+
+    // Compact the log file with too many garbage records
+    if ((_threshold > 0) && (_garbage >= _threshold) && (_garbage > (_tail - _garbage)))
+        compact_internal();
+
+    return true;
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline bool TieredCache<TKey, TValue, TCodec>::read_internal(const Location& location, TValue& value)
+{
+    _buffer.resize(HEADER_SIZE + location.size);
+    if (_file.ReadAt(location.offset, _buffer.data(), _buffer.size()) != _buffer.size())
+        return false;
+
+    // Validate the record header and checksum
+    uint32_t size32;
+    uint32_t crc;
+    std::memcpy(&size32, _buffer.data(), 4);
+    std::memcpy(&crc, _buffer.data() + 4, 4);
+    if ((size32 != location.size) || (crc != CRC32C::Compute(_buffer.data() + HEADER_SIZE, location.size)))
+        return false;
+
+    return TCodec::decode(std::string_view(_buffer.data() + HEADER_SIZE, location.size), value);
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline void TieredCache<TKey, TValue, TCodec>::discard_internal(const TKey& key)
+{
+    auto it = _index.find(key);
+    if (it == _index.end())
+        return;
+
+    _garbage += HEADER_SIZE + it->second.size;
+    _index.erase(it);
+}
+
+template <typename TKey, typename TValue, class TCodec>
+inline void TieredCache<TKey, TValue, TCodec>::compact_internal()
+{
+    Path temp(_path.string() + ".compact");
+    File file(temp);
+    file.Create(true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+
+    // Copy live records into the new log file
+    uint64_t tail = 0;
+    for (const auto& entry : _index)
+    {
+        _buffer.resize(HEADER_SIZE + entry.second.size);
+        _file.ReadAt(entry.second.offset, _buffer.data(), _buffer.size());
+        file.WriteAt(tail, _buffer.data(), _buffer.size());
+        tail += _buffer.size();
+    }
+
+    // Replace the current log file with the compacted one
+    file.Close();
+    _file.Close();
+    Path::Rename(temp, _path);
+    _file.Open(true, true, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+
+    // Relocate live records in the key directory
+    tail = 0;
+    for (auto& entry : _index)
+    {
+        entry.second.offset = tail;
+        tail += HEADER_SIZE + entry.second.size;
+    }
+    _tail = tail;
+    _garbage = 0;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,283 @@
+/*!
+    \file binary_layout.h
+    \brief Zero-copy binary layout definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_BINARY_LAYOUT_H
+#define CPPCOMMON_BINARY_LAYOUT_H
+
+#include "utility/endian.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Binary layout variable-length string field
+struct BinaryString {};
+//! Binary layout variable-length bytes field
+struct BinaryBytes {};
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Binary layout field traits for scalar fields (integers, floating points, enums and booleans)
+template <typename T>
+struct BinaryFieldTraits
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Binary layout field type must be a scalar, BinaryString or BinaryBytes!");
+
+    typedef T value_type;
+
+    static constexpr size_t SIZE = sizeof(T);
+    static constexpr bool VARIABLE = false;
+
+    static T Load(const uint8_t* ptr) noexcept;
+    static void Store(uint8_t* ptr, T value) noexcept;
+};
+
+// Binary layout field traits for variable-length string fields
+template <>
+struct BinaryFieldTraits<BinaryString>
+{
+    typedef std::string_view value_type;
+
+    static constexpr size_t SIZE = 8;
+    static constexpr bool VARIABLE = true;
+};
+
+// Binary layout field traits for variable-length bytes fields
+template <>
+struct BinaryFieldTraits<BinaryBytes>
+{
+    typedef std::span<const uint8_t> value_type;
+
+    static constexpr size_t SIZE = 8;
+    static constexpr bool VARIABLE = true;
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Binary layout
+/*!
+    Binary layout describes an offset-based binary message format derived at
+    compile time from the list of field types. Each message starts with the
+    32-bit message size header followed by the fixed block with all fields
+    in the declared order without padding, and the variable data area.
+
+    Scalar fields (integers, floating points, enums and booleans) are stored
+    in the fixed block in little-endian byte order. Variable-length fields
+    (BinaryString, BinaryBytes) are stored in the fixed block as a pair of
+    32-bit offset (from the message start) and size of the data appended to
+    the variable data area.
+
+    Messages are read in place with BinaryView (no decode step) and written
+    in place with BinaryBuilder directly into any contiguous memory, e.g.
+    SPSCRingBuffer::Prepare() reservation, shared memory or mapped file.
+
+    Example:
+    \code{.cpp}
+    // Order message: id, price, quantity, side, symbol
+    typedef BinaryLayout<uint64_t, double, int32_t, Side, BinaryString> Order;
+
+    auto buffer = ring.Prepare(Order::Size(symbol.size()));
+    BinaryBuilder<Order> builder(buffer);
+    builder.Set<0>(id);
+    builder.Set<4>(symbol);
+    ring.Commit(builder.size());
+    \endcode
+
+    Thread-safe.
+*/
+template <typename... TFields>
+class BinaryLayout
+{
+public:
+    BinaryLayout() = delete;
+    BinaryLayout(const BinaryLayout&) = delete;
+    BinaryLayout(BinaryLayout&&) = delete;
+    ~BinaryLayout() = delete;
+
+    BinaryLayout& operator=(const BinaryLayout&) = delete;
+    BinaryLayout& operator=(BinaryLayout&&) = delete;
+
+    //! Field type with the given index
+    template <size_t Index>
+    using Field = typename std::tuple_element<Index, std::tuple<TFields...>>::type;
+    //! Field value type with the given index
+    template <size_t Index>
+    using Value = typename Internals::BinaryFieldTraits<Field<Index>>::value_type;
+
+    //! Count of fields
+    static constexpr size_t FIELDS = sizeof...(TFields);
+    //! Message size header size
+    static constexpr size_t HEADER_SIZE = 4;
+    //! Fixed message size (header and fixed block)
+    static constexpr size_t FIXED_SIZE = (HEADER_SIZE + ... + Internals::BinaryFieldTraits<TFields>::SIZE);
+
+    //! Get the offset of the field with the given index from the message start
+    template <size_t Index>
+    static constexpr size_t Offset() noexcept { static_assert((Index < FIELDS), "Invalid binary layout field index!"); return _offsets[Index]; }
+    //! Is the field with the given index variable-length?
+    template <size_t Index>
+    static constexpr bool IsVariable() noexcept { return Internals::BinaryFieldTraits<Field<Index>>::VARIABLE; }
+
+    //! Calculate the message size with the given sizes of variable-length fields
+    /*!
+        \param sizes - Sizes of variable-length fields
+        \return Message size in bytes
+    */
+    template <typename... TSizes>
+    static constexpr size_t Size(TSizes... sizes) noexcept { return (FIXED_SIZE + ... + (size_t)sizes); }
+
+private:
+    static constexpr std::array<size_t, FIELDS> _offsets = []()
+    {
+        std::array<size_t, FIELDS> offsets{};
+        size_t offset = HEADER_SIZE;
+        size_t index = 0;
+        ((offsets[index++] = offset, offset += Internals::BinaryFieldTraits<TFields>::SIZE), ...);
+        return offsets;
+    }();
+};
+
+//! Binary view
+/*!
+    Binary view reads the binary message in place from the given buffer.
+    Field accessors just load values from their fixed offsets, so there is
+    no decode step and no copy of variable-length fields.
+
+    Message received from an untrusted source should be validated with
+    valid() before any field access.
+
+    Not thread-safe.
+*/
+template <class TLayout>
+class BinaryView
+{
+public:
+    BinaryView() noexcept : _data(nullptr), _capacity(0) {}
+    //! Initialize the binary view with the given buffer
+    /*!
+        \param buffer - Buffer with the message
+        \param capacity - Buffer capacity (might be greater than the message size)
+    */
+    BinaryView(const void* buffer, size_t capacity) noexcept : _data((const uint8_t*)buffer), _capacity(capacity) {}
+    //! Initialize the binary view with the given buffer span
+    /*!
+        \param buffer - Buffer span with the message
+    */
+    explicit BinaryView(std::span<const uint8_t> buffer) noexcept : BinaryView(buffer.data(), buffer.size()) {}
+    BinaryView(const BinaryView&) noexcept = default;
+    BinaryView(BinaryView&&) noexcept = default;
+    ~BinaryView() noexcept = default;
+
+    BinaryView& operator=(const BinaryView&) noexcept = default;
+    BinaryView& operator=(BinaryView&&) noexcept = default;
+
+    //! Check if the message is valid
+    explicit operator bool() const noexcept { return valid(); }
+
+    //! Get the message data
+    const uint8_t* data() const noexcept { return _data; }
+    //! Get the buffer capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the message size from the message header
+    size_t size() const noexcept { assert((_capacity >= TLayout::HEADER_SIZE) && "Binary view buffer is too small!"); return Endian::LoadLittleEndian<uint32_t>(_data); }
+
+    //! Is the message valid?
+    /*!
+        Message is valid if the buffer contains the whole message and all
+        variable-length fields are inside the message.
+    */
+    bool valid() const noexcept;
+
+    //! Get the field value with the given index
+    /*!
+        Variable-length fields are returned as views into the message buffer.
+
+        \return Field value
+    */
+    template <size_t Index>
+    typename TLayout::template Value<Index> Get() const noexcept;
+
+private:
+    const uint8_t* _data;
+    size_t _capacity;
+};
+
+//! Binary builder
+/*!
+    Binary builder writes the binary message in place into the given buffer.
+    Scalar fields are stored at their fixed offsets, variable-length fields
+    are appended to the variable data area. The buffer should be at least
+    TLayout::FIXED_SIZE bytes and unset fields are zero-initialized.
+
+    Not thread-safe.
+*/
+template <class TLayout>
+class BinaryBuilder
+{
+public:
+    //! Initialize the binary builder with the given buffer
+    /*!
+        \param buffer - Buffer to build the message
+        \param capacity - Buffer capacity (should be at least TLayout::FIXED_SIZE bytes)
+    */
+    BinaryBuilder(void* buffer, size_t capacity) noexcept;
+    //! Initialize the binary builder with the given buffer span
+    /*!
+        \param buffer - Buffer span to build the message
+    */
+    explicit BinaryBuilder(std::span<uint8_t> buffer) noexcept : BinaryBuilder(buffer.data(), buffer.size()) {}
+    BinaryBuilder(const BinaryBuilder&) = delete;
+    BinaryBuilder(BinaryBuilder&&) noexcept = default;
+    ~BinaryBuilder() noexcept = default;
+
+    BinaryBuilder& operator=(const BinaryBuilder&) = delete;
+    BinaryBuilder& operator=(BinaryBuilder&&) noexcept = default;
+
+    //! Get the message data
+    uint8_t* data() noexcept { return _data; }
+    const uint8_t* data() const noexcept { return _data; }
+    //! Get the buffer capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the current message size
+    size_t size() const noexcept { return _size; }
+
+    //! Set the field value with the given index
+    /*!
+        Variable-length field should be set only once.
+
+        \param value - Field value
+        \return 'true' if the field value was successfully set, 'false' if the buffer has not enough space
+    */
+    template <size_t Index>
+    bool Set(typename TLayout::template Value<Index> value) noexcept;
+
+    //! Get the binary view of the built message
+    BinaryView<TLayout> view() const noexcept { return BinaryView<TLayout>(_data, _size); }
+
+private:
+    uint8_t* _data;
+    size_t _capacity;
+    size_t _size;
+};
+
+/*! \example common_binary_layout.cpp Zero-copy binary layout example */
+
+} // namespace CppCommon
+
+#include "binary_layout.inl"
+
+#endif // CPPCOMMON_BINARY_LAYOUT_H
@@ -0,0 +1,148 @@
+/*!
+    \file binary_layout.inl
+    \brief Zero-copy binary layout inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+inline T BinaryFieldTraits<T>::Load(const uint8_t* ptr) noexcept
+{
+    if constexpr (std::is_same<T, bool>::value)
+        return (ptr[0] != 0);
+    else if constexpr (std::is_enum<T>::value)
+        return (T)BinaryFieldTraits<typename std::underlying_type<T>::type>::Load(ptr);
+    else if constexpr (std::is_same<T, float>::value)
+        return std::bit_cast<float>(Endian::LoadLittleEndian<uint32_t>(ptr));
+    else if constexpr (std::is_same<T, double>::value)
+        return std::bit_cast<double>(Endian::LoadLittleEndian<uint64_t>(ptr));
+    else
+    {
+        static_assert(std::is_integral<T>::value, "Binary layout floating point field must be float or double!");
+        return Endian::LoadLittleEndian<T>(ptr);
+    }
+}
+
+template <typename T>
+inline void BinaryFieldTraits<T>::Store(uint8_t* ptr, T value) noexcept
+{
+    if constexpr (std::is_same<T, bool>::value)
+        ptr[0] = value ? 1 : 0;
+    else if constexpr (std::is_enum<T>::value)
+        BinaryFieldTraits<typename std::underlying_type<T>::type>::Store(ptr, (typename std::underlying_type<T>::type)value);
+    else if constexpr (std::is_same<T, float>::value)
+        Endian::StoreLittleEndian(ptr, std::bit_cast<uint32_t>(value));
+    else if constexpr (std::is_same<T, double>::value)
+        Endian::StoreLittleEndian(ptr, std::bit_cast<uint64_t>(value));
+    else
+    {
+        static_assert(std::is_integral<T>::value, "Binary layout floating point field must be float or double!");
+        Endian::StoreLittleEndian(ptr, value);
+    }
+}
+
+// Validate variable-length fields of the message with the given size
+template <class TLayout, size_t... Indexes>
+inline bool BinaryValidate(const uint8_t* data, size_t size, std::index_sequence<Indexes...>) noexcept
+{
+    auto validate = [data, size](size_t index, bool variable) -> bool
+    {
+        if (!variable)
+            return true;
+
+        const uint8_t* ptr = data + index;
+        uint32_t offset = Endian::LoadLittleEndian<uint32_t>(ptr);
+        uint32_t length = Endian::LoadLittleEndian<uint32_t>(ptr + 4);
+        // Unset variable-length fields are empty
+        if (length == 0)
+            return true;
+
+        return ((offset >= TLayout::FIXED_SIZE) && (offset <= size) && (length <= (size - offset)));
+    };
+
+    return (validate(TLayout::template Offset<Indexes>(), TLayout::template IsVariable<Indexes>()) && ...);
+}
+
+} // namespace Internals
+//! @endcond
+
+template <class TLayout>
+inline bool BinaryView<TLayout>::valid() const noexcept
+{
+    if ((_data == nullptr) || (_capacity < TLayout::FIXED_SIZE))
+        return false;
+
+    size_t message = size();
+    if ((message < TLayout::FIXED_SIZE) || (message > _capacity))
+        return false;
+
+    return Internals::BinaryValidate<TLayout>(_data, message, std::make_index_sequence<TLayout::FIELDS>());
+}
+
+template <class TLayout>
+template <size_t Index>
+inline typename TLayout::template Value<Index> BinaryView<TLayout>::Get() const noexcept
+{
+    assert((_capacity >= TLayout::FIXED_SIZE) && "Binary view buffer is too small!");
+
+    const uint8_t* ptr = _data + TLayout::template Offset<Index>();
+
+    if constexpr (TLayout::template IsVariable<Index>())
+    {
+        uint32_t offset = Endian::LoadLittleEndian<uint32_t>(ptr);
+        uint32_t length = Endian::LoadLittleEndian<uint32_t>(ptr + 4);
+        assert(((offset + length) <= _capacity) && "Binary view variable-length field is out of the buffer!");
+
+        if constexpr (std::is_same<typename TLayout::template Field<Index>, BinaryString>::value)
+            return std::string_view((const char*)_data + offset, length);
+        else
+            return std::span<const uint8_t>(_data + offset, length);
+    }
+    else
+        return Internals::BinaryFieldTraits<typename TLayout::template Field<Index>>::Load(ptr);
+}
+
+template <class TLayout>
+inline BinaryBuilder<TLayout>::BinaryBuilder(void* buffer, size_t capacity) noexcept
+    : _data((uint8_t*)buffer), _capacity(capacity), _size(TLayout::FIXED_SIZE)
+{
+    assert((buffer != nullptr) && "Binary builder buffer must be valid!");
+    assert((capacity >= TLayout::FIXED_SIZE) && "Binary builder buffer is too small!");
+
+    std::memset(_data, 0, TLayout::FIXED_SIZE);
+    Endian::StoreLittleEndian(_data, (uint32_t)_size);
+}
+
+template <class TLayout>
+template <size_t Index>
+inline bool BinaryBuilder<TLayout>::Set(typename TLayout::template Value<Index> value) noexcept
+{
+    uint8_t* ptr = _data + TLayout::template Offset<Index>();
+
+    if constexpr (TLayout::template IsVariable<Index>())
+    {
+        if (value.size() > (_capacity - _size))
+            return false;
+
+        // Append the field data to the variable data area
+        std::memcpy(_data + _size, value.data(), value.size());
+        Endian::StoreLittleEndian(ptr, (uint32_t)_size);
+        Endian::StoreLittleEndian(ptr + 4, (uint32_t)value.size());
+        _size += value.size();
+
+        // Update the message size header
+        Endian::StoreLittleEndian(_data, (uint32_t)_size);
+    }
+    else
+        Internals::BinaryFieldTraits<typename TLayout::template Field<Index>>::Store(ptr, value);
+
+    return true;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,224 @@
+/*!
+    \file buffer_chain.h
+    \brief Buffer chain definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_BUFFER_CHAIN_H
+#define CPPCOMMON_BUFFER_CHAIN_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! Buffer slice
+/*!
+    Buffer slice is a view of the bytes range in the reference counted memory
+    block. Copies of the slice share the same memory block, so slices could
+    be passed between buffer chains without copying of their content.
+
+    Not thread-safe.
+*/
+class BufferSlice
+{
+public:
+    //! Initialize an empty buffer slice
+    BufferSlice() noexcept : _block(), _data(nullptr), _size(0) {}
+    //! Initialize buffer slice with the given bytes range of the memory block
+    /*!
+        \param block - Reference counted memory block
+        \param offset - Offset of the bytes range in the memory block
+        \param size - Size of the bytes range
+    */
+    BufferSlice(std::shared_ptr<uint8_t[]> block, size_t offset, size_t size) noexcept;
+    BufferSlice(const BufferSlice&) = default;
+    BufferSlice(BufferSlice&&) noexcept = default;
+    ~BufferSlice() = default;
+
+    BufferSlice& operator=(const BufferSlice&) = default;
+    BufferSlice& operator=(BufferSlice&&) noexcept = default;
+
+    //! Check if the buffer slice is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the buffer slice empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the buffer slice data
+    const uint8_t* data() const noexcept { return _data; }
+    //! Get the buffer slice size
+    size_t size() const noexcept { return _size; }
+    //! Get the buffer slice content as a bytes span
+    std::span<const uint8_t> span() const noexcept { return std::span<const uint8_t>(_data, _size); }
+
+    //! Get the reference counted memory block of the buffer slice
+    const std::shared_ptr<uint8_t[]>& block() const noexcept { return _block; }
+
+    //! Get the sub-slice of the buffer slice which shares the same memory block
+    /*!
+        \param offset - Sub-slice offset (will be limited by the buffer slice size)
+        \param size - Sub-slice size (will be limited by the rest of the buffer slice)
+        \return Buffer sub-slice
+    */
+    BufferSlice Slice(size_t offset, size_t size) const noexcept;
+
+    //! Allocate a new buffer slice with the copy of the given bytes buffer
+    /*!
+        \param buffer - Bytes buffer
+        \param size - Bytes buffer size
+        \return Buffer slice
+    */
+    static BufferSlice Copy(const void* buffer, size_t size);
+
+    //! Swap two instances
+    void swap(BufferSlice& slice) noexcept;
+    friend void swap(BufferSlice& slice1, BufferSlice& slice2) noexcept;
+
+private:
+    friend class BufferChain;
+
+    std::shared_ptr<uint8_t[]> _block;
+    const uint8_t* _data;
+    size_t _size;
+};
+
+//! Buffer chain
+/*!
+    Buffer chain is a sequence of buffer slices which represents one logical
+    bytes stream (IOBuf style). Appending of slices or other chains, splitting
+    and consuming of the chain front never copy the content, and the whole
+    chain could be written with a single gather I/O operation.
+
+    New content is appended into the writable tail block owned by the chain,
+    which is prepared by Prepare() and committed by Commit() methods, so
+    readers fill the chain memory directly. Committed bytes are never
+    modified, so they are safely shared with other chains.
+
+    Not thread-safe.
+*/
+class BufferChain
+{
+public:
+    //! Default size of allocated memory blocks (64 KiB)
+    static const size_t DEFAULT_BLOCK_SIZE;
+
+    //! Initialize an empty buffer chain
+    /*!
+        \param block - Size of allocated memory blocks (default is BufferChain::DEFAULT_BLOCK_SIZE)
+    */
+    explicit BufferChain(size_t block = BufferChain::DEFAULT_BLOCK_SIZE);
+    BufferChain(const BufferChain& chain);
+    BufferChain(BufferChain&& chain) noexcept;
+    ~BufferChain() = default;
+
+    BufferChain& operator=(const BufferChain& chain);
+    BufferChain& operator=(BufferChain&& chain) noexcept;
+
+    //! Check if the buffer chain is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the buffer chain empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the total size of the buffer chain content
+    size_t size() const noexcept { return _size; }
+    //! Get the size of allocated memory blocks
+    size_t block() const noexcept { return _block; }
+
+    //! Get the buffer chain slices
+    const std::deque<BufferSlice>& slices() const noexcept { return _slices; }
+    //! Get the buffer chain content as a list of bytes spans (e.g. for the gather I/O)
+    std::vector<std::span<const uint8_t>> spans() const;
+
+    //! Append the copy of the given bytes buffer
+    /*!
+        \param buffer - Bytes buffer
+        \param size - Bytes buffer size
+    */
+    void Append(const void* buffer, size_t size);
+    //! Append the buffer slice without copying its content
+    /*!
+        \param slice - Buffer slice
+    */
+    void Append(const BufferSlice& slice);
+    //! Append all slices of the given buffer chain without copying their content
+    /*!
+        \param chain - Buffer chain
+    */
+    void Append(const BufferChain& chain);
+    //! Move all slices of the given buffer chain to the end of the current one
+    /*!
+        \param chain - Buffer chain (will be empty)
+    */
+    void Append(BufferChain&& chain);
+
+    //! Prepare the writable tail space
+    /*!
+        Returns the free space of the tail block, or allocates a new block if
+        the tail block is full. The space is valid until the next modification
+        of the chain.
+
+        \param size - Maximal size of the writable space
+        \return Writable space (not empty for the non-zero size)
+    */
+    std::span<uint8_t> Prepare(size_t size);
+    //! Commit bytes written into the prepared tail space
+    /*!
+        \param size - Count of written bytes (must not exceed the prepared space)
+    */
+    void Commit(size_t size);
+
+    //! Copy the front of the buffer chain content into the given buffer without consuming
+    /*!
+        \param buffer - Buffer to copy
+        \param size - Buffer size
+        \return Count of copied bytes
+    */
+    size_t CopyTo(void* buffer, size_t size) const;
+    //! Consume the front of the buffer chain content
+    /*!
+        \param size - Count of bytes to consume (will be limited by the buffer chain size)
+        \return Count of consumed bytes
+    */
+    size_t Consume(size_t size);
+    //! Split the front of the buffer chain content into a new buffer chain without copying
+    /*!
+        \param size - Count of bytes to split (will be limited by the buffer chain size)
+        \return Buffer chain with the front content
+    */
+    BufferChain Split(size_t size);
+
+    //! Copy the whole buffer chain content into a contiguous bytes buffer
+    std::vector<uint8_t> ToBytes() const;
+    //! Copy the whole buffer chain content into a contiguous string
+    std::string ToString() const;
+
+    //! Clear the buffer chain
+    void Clear() noexcept;
+
+    //! Swap two instances
+    void swap(BufferChain& chain) noexcept;
+    friend void swap(BufferChain& chain1, BufferChain& chain2) noexcept;
+
+private:
+    size_t _block;
+    size_t _size;
+    std::deque<BufferSlice> _slices;
+    std::shared_ptr<uint8_t[]> _tail;
+    size_t _tail_used;
+};
+
+/*! \example common_buffer_chain.cpp Buffer chain example */
+
+} // namespace CppCommon
+
+#include "buffer_chain.inl"
+
+#endif // CPPCOMMON_BUFFER_CHAIN_H
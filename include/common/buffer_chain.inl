@@ -0,0 +1,39 @@
+/*!
+    \file buffer_chain.inl
+    \brief Buffer chain inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void BufferSlice::swap(BufferSlice& slice) noexcept
+{
+    using std::swap;
+    swap(_block, slice._block);
+    swap(_data, slice._data);
+    swap(_size, slice._size);
+}
+
+inline void swap(BufferSlice& slice1, BufferSlice& slice2) noexcept
+{
+    slice1.swap(slice2);
+}
+
+inline void BufferChain::swap(BufferChain& chain) noexcept
+{
+    using std::swap;
+    swap(_block, chain._block);
+    swap(_size, chain._size);
+    swap(_slices, chain._slices);
+    swap(_tail, chain._tail);
+    swap(_tail_used, chain._tail_used);
+}
+
+inline void swap(BufferChain& chain1, BufferChain& chain2) noexcept
+{
+    chain1.swap(chain2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,288 @@
+/*!
+    \file compressed_stream.h
+    \brief Compressing writer and decompressing reader definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_COMPRESSED_STREAM_H
+#define CPPCOMMON_COMPRESSED_STREAM_H
+
+#include "common/reader.h"
+#include "common/writer.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+class File;
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Streaming xxHash32 state of LZ4 frame checksums
+struct XXH32State
+{
+    uint32_t v[4];
+    uint64_t total;
+    uint8_t memory[16];
+    size_t size;
+
+    explicit XXH32State(uint32_t seed = 0) noexcept { Reset(seed); }
+
+    void Reset(uint32_t seed = 0) noexcept;
+    void Update(const void* buffer, size_t size) noexcept;
+    uint32_t Digest() const noexcept;
+
+    static uint32_t Compute(const void* buffer, size_t size, uint32_t seed = 0) noexcept;
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Compressing writer options
+struct CompressedWriterOptions
+{
+    //! Maximal size of the uncompressed block, rounded up to 64 KiB, 256 KiB, 1 MiB or 4 MiB (default is 256 KiB)
+    size_t block{262144};
+    //! Write checksums of blocks (default is true)
+    bool checksum{true};
+    //! Write the checksum of the whole content (default is true)
+    bool content{true};
+    //! Write the seekable index of blocks when the writer is closed (default is false)
+    bool index{false};
+    //! Compress blocks in the background thread (default is true)
+    bool background{true};
+    //! Count of block buffers in flight of the background thread (default is 4)
+    size_t buffers{4};
+};
+
+//! Compressing writer
+/*!
+    Compressing writer wraps any writer (File, Pipe, StdOutput) and writes
+    its content in the standard LZ4 frame format, so it could be read with
+    the lz4 command line tool or any LZ4 library. Content is split into
+    independent blocks which are compressed with LZ4 and protected with
+    xxHash32 block checksums. Incompressible blocks are stored as is.
+
+    With the background option the producer only copies bytes into the
+    current block buffer. Filled blocks are compressed and written by the
+    background thread, while the producer fills the next free buffer. The
+    producer waits only when all buffers are in flight. Errors of the
+    background thread are rethrown by the next Write(), Flush() or Close()
+    call.
+
+    With the index option the skippable frame with sizes of all blocks is
+    appended after the LZ4 frame. Its layout follows the seek table of the
+    zstd seekable format (entries are LZ4 blocks instead of zstd frames).
+    LZ4 decoders skip it, while CompressedReader uses it for random access
+    into the compressed content.
+
+    Not thread-safe.
+
+    https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md
+*/
+class CompressedWriter : public Writer
+{
+public:
+    //! Initialize the compressing writer and write the LZ4 frame header
+    /*!
+        \param writer - Writer of the compressed content (must be valid until the compressing writer is closed)
+        \param options - Compressing writer options (default is CompressedWriterOptions())
+    */
+    explicit CompressedWriter(Writer& writer, const CompressedWriterOptions& options = CompressedWriterOptions());
+    CompressedWriter(const CompressedWriter&) = delete;
+    CompressedWriter(CompressedWriter&&) = delete;
+    //! Close the compressing writer
+    ~CompressedWriter() noexcept;
+
+    CompressedWriter& operator=(const CompressedWriter&) = delete;
+    CompressedWriter& operator=(CompressedWriter&&) = delete;
+
+    //! Get the maximal size of the uncompressed block
+    size_t block() const noexcept { return _block; }
+    //! Get the count of written uncompressed bytes
+    uint64_t size() const noexcept { return _size; }
+    //! Get the count of written compressed bytes
+    uint64_t compressed() const noexcept { return _compressed.load(std::memory_order_acquire); }
+    //! Get the count of written blocks
+    uint64_t blocks() const noexcept { return _blocks.load(std::memory_order_acquire); }
+
+    //! Is the compressing writer closed?
+    bool IsClosed() const noexcept { return _closed; }
+
+    //! Write the given buffer into the current block
+    /*!
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size) override;
+    using Writer::Write;
+
+    //! Compress and write the current block and flush the underlying writer
+    /*!
+        Will block until all blocks are written.
+    */
+    void Flush() override;
+
+    //! Finish the LZ4 frame, write the seekable index and flush the underlying writer
+    /*!
+        Will block until all blocks are written.
+    */
+    void Close();
+
+private:
+    // Block buffer
+    struct Block
+    {
+        std::vector<uint8_t> data;
+        std::vector<uint8_t> output;
+        size_t size;
+    };
+
+    Writer& _writer;
+    CompressedWriterOptions _options;
+    size_t _block;
+    bool _closed;
+    uint64_t _size;
+    std::atomic<uint64_t> _compressed;
+    std::atomic<uint64_t> _blocks;
+
+    // Content checksum and block sizes of the seekable index
+    Internals::XXH32State _content;
+    std::vector<std::pair<uint32_t, uint32_t>> _index;
+
+    // Block buffers
+    std::vector<std::unique_ptr<Block>> _buffers;
+    Block* _current;
+
+    // Background thread state
+    CriticalSection _lock;
+    ConditionVariable _cv;
+    std::vector<Block*> _free;
+    std::deque<Block*> _pending;
+    size_t _busy;
+    bool _stop;
+    std::exception_ptr _error;
+    std::thread _thread;
+
+    void Submit();
+    void Wait();
+    void Process(Block& block);
+    void Output(const void* buffer, size_t size);
+    void Compressor();
+};
+
+//! Decompressing reader
+/*!
+    Decompressing reader reads the content written in the LZ4 frame format
+    from any reader. Block checksums and the content checksum are verified
+    if they are present, otherwise RuntimeException is thrown. Concatenated
+    frames are read one by one and skippable frames are skipped.
+
+    Reader created for the file with the seekable index supports random
+    access to the uncompressed content: Seek() reads only the block which
+    contains the given offset.
+
+    Not thread-safe.
+*/
+class CompressedReader : public Reader
+{
+public:
+    //! Initialize the decompressing reader with the given reader
+    /*!
+        \param reader - Reader of the compressed content (must be valid until the decompressing reader is destroyed)
+    */
+    explicit CompressedReader(Reader& reader);
+    //! Initialize the seekable decompressing reader with the given opened file
+    /*!
+        File is read with ReadAt(), so its offset is not changed. The reader is
+        seekable if the file contains the single LZ4 frame with the seekable
+        index written by CompressedWriter.
+
+        \param file - Opened file of the compressed content (must be valid until the decompressing reader is destroyed)
+    */
+    explicit CompressedReader(const File& file);
+    CompressedReader(const CompressedReader&) = delete;
+    CompressedReader(CompressedReader&&) = delete;
+    ~CompressedReader() noexcept = default;
+
+    CompressedReader& operator=(const CompressedReader&) = delete;
+    CompressedReader& operator=(CompressedReader&&) = delete;
+
+    //! Get the current offset in the uncompressed content
+    uint64_t offset() const noexcept { return _offset; }
+    //! Get the size of the uncompressed content (only for the seekable reader)
+    uint64_t size() const noexcept { return _positions.empty() ? 0 : _offsets.back(); }
+    //! Get the count of read blocks
+    uint64_t blocks() const noexcept { return _blocks; }
+
+    //! Is the reader seekable?
+    bool IsSeekable() const noexcept { return !_positions.empty(); }
+
+    //! Read the uncompressed content into the given buffer
+    /*!
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes (0 at the end of the content)
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+    //! Seek to the given offset in the uncompressed content
+    /*!
+        The content checksum is not verified after the seek.
+
+        \param offset - Offset in the uncompressed content
+    */
+    void Seek(uint64_t offset);
+
+private:
+    Reader* _reader;
+    const File* _file;
+    uint64_t _position;
+    uint64_t _offset;
+    uint64_t _blocks;
+
+    // Current frame
+    bool _frame;
+    size_t _header;
+    size_t _block_max;
+    bool _block_checksum;
+    bool _content_checksum;
+    bool _linked;
+    bool _verify;
+    Internals::XXH32State _content;
+
+    // Current block
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+    size_t _output_offset;
+    size_t _output_size;
+    std::vector<uint8_t> _dictionary;
+
+    // Seekable index (compressed positions and uncompressed offsets of blocks)
+    std::vector<uint64_t> _positions;
+    std::vector<uint64_t> _offsets;
+
+    size_t Input(void* buffer, size_t size);
+    void InputExact(void* buffer, size_t size);
+    void Skip(uint64_t size);
+    void ReadHeader();
+    bool ReadBlock();
+    void LoadIndex();
+};
+
+/*! \example common_compressed_stream.cpp Compressing writer and decompressing reader example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_COMPRESSED_STREAM_H
@@ -0,0 +1,98 @@
+/*!
+    \file enum_strings.h
+    \brief Enum strings conversion definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_ENUM_STRINGS_H
+#define CPPCOMMON_ENUM_STRINGS_H
+
+#include "containers/perfect_hashmap.h"
+
+#include <array>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace CppCommon {
+
+//! Enum strings traits
+/*!
+    Specialize the traits with the static constexpr 'items' array of enum
+    value names to enable EnumToString() and EnumFromString() conversions.
+    Names and values must be unique.
+
+    Example:
+    \code{.cpp}
+    enum class MyEnum { One, Two };
+
+    template <>
+    struct EnumStrings<MyEnum>
+    {
+        static constexpr std::pair<std::string_view, MyEnum> items[] =
+        {
+            { "One", MyEnum::One },
+            { "Two", MyEnum::Two }
+        };
+    };
+    \endcode
+*/
+template <typename TEnum>
+struct EnumStrings;
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename TEnum, size_t N>
+constexpr std::array<std::pair<TEnum, std::string_view>, N> EnumValues(const std::pair<std::string_view, TEnum> (&items)[N])
+{
+    std::array<std::pair<TEnum, std::string_view>, N> result{};
+    for (size_t i = 0; i < N; ++i)
+        result[i] = std::make_pair(items[i].second, items[i].first);
+    return result;
+}
+
+// Perfect hash maps of enum names and values built at compile time
+template <typename TEnum>
+struct EnumMaps
+{
+    static constexpr size_t N = std::size(EnumStrings<TEnum>::items);
+    static constexpr PerfectHashMap<std::string_view, TEnum, N> names{EnumStrings<TEnum>::items};
+    static constexpr PerfectHashMap<TEnum, std::string_view, N> values{EnumValues(EnumStrings<TEnum>::items)};
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Convert the enum value to its name
+/*!
+    \param value - Enum value
+    \return Enum value name or empty string view if the value has no name
+*/
+template <typename TEnum>
+constexpr std::string_view EnumToString(TEnum value) noexcept
+{
+    auto it = Internals::EnumMaps<TEnum>::values.find(value);
+    return (it != Internals::EnumMaps<TEnum>::values.end()) ? it->second : std::string_view();
+}
+
+//! Convert the name to the enum value
+/*!
+    Names are case-sensitive.
+
+    \param name - Enum value name
+    \return Enum value or std::nullopt if the name is unknown
+*/
+template <typename TEnum>
+constexpr std::optional<TEnum> EnumFromString(std::string_view name) noexcept
+{
+    auto it = Internals::EnumMaps<TEnum>::names.find(name);
+    return (it != Internals::EnumMaps<TEnum>::names.end()) ? std::optional<TEnum>(it->second) : std::nullopt;
+}
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_ENUM_STRINGS_H
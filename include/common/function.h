@@ -9,13 +9,15 @@
 #ifndef CPPCOMMON_FUNCTION_H
 #define CPPCOMMON_FUNCTION_H
 
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 namespace CppCommon {
 
 //! Allocation free function stub
-template <class, size_t Capacity = 1024>
+template <class, size_t Capacity = 1024, bool Copyable = true>
 class Function;
 
 //! Allocation free function
@@ -24,24 +26,52 @@ class Function;
     the closure. This allows to avoid slow heap allocation in function
     constructor as it performed in std::function implementation.
 
+    Capacity is the total size of the function object including two
+    internal pointers (16 bytes on 64-bit platforms), so Function<R(), 64>
+    fits into a single cache line and keeps up to 48 bytes of the closure.
+    Closures which do not fit into the storage are rejected at compile time,
+    so the function never allocates memory. Use fits<TFunction>() to select
+    the suitable capacity in generic code.
+
+    Move-only functions (Copyable = false, see MoveFunction) accept closures
+    with move-only captures (e.g. std::unique_ptr).
+
+    Trivially copyable closures are copied and moved with memcpy() without
+    the manager call. If relocatable() is true the whole function object
+    might be relocated with memcpy() as well (e.g. by queues which store
+    raw bytes).
+
     Invocation overhead is similar to std::function implementation.
 */
-template <class R, class... Args, size_t Capacity>
-class Function<R(Args...), Capacity>
+template <class R, class... Args, size_t Capacity, bool Copyable>
+class Function<R(Args...), Capacity, Copyable>
 {
+    enum class Operation { Clone, Move, Destroy };
+
+    using Invoker = R (*)(void*, Args&&...);
+    using Manager = void (*)(void*, void*, Operation);
+
+    static constexpr size_t StorageSize = Capacity - sizeof(Invoker) - sizeof(Manager);
+    static constexpr size_t StorageAlign = 8;
+
+    static_assert((Capacity >= (sizeof(Invoker) + sizeof(Manager) + StorageAlign)), "Function capacity is too small to keep any closure!");
+    static_assert(((Capacity % StorageAlign) == 0), "Function capacity must be a multiple of the storage alignment!");
+
 public:
     Function() noexcept;
     Function(std::nullptr_t) noexcept;
-    Function(const Function& function) noexcept;
+    Function(const Function& function) noexcept requires (Copyable);
     Function(Function&& function) noexcept;
     template <class TFunction>
+    requires (!std::is_same<typename std::decay<TFunction>::type, Function>::value)
     Function(TFunction&& function) noexcept;
     ~Function() noexcept;
 
     Function& operator=(std::nullptr_t) noexcept;
-    Function& operator=(const Function& function) noexcept;
+    Function& operator=(const Function& function) noexcept requires (Copyable);
     Function& operator=(Function&& function) noexcept;
     template <typename TFunction>
+    requires (!std::is_same<typename std::decay<TFunction>::type, Function>::value)
     Function& operator=(TFunction&& function) noexcept;
     template <typename TFunction>
     Function& operator=(std::reference_wrapper<TFunction> function) noexcept;
@@ -49,23 +79,30 @@ public:
     //! Check if the function is valid
     explicit operator bool() const noexcept { return (_manager != nullptr); }
 
+    //! Get the function capacity
+    static constexpr size_t capacity() noexcept { return Capacity; }
+    //! Get the closure storage size
+    static constexpr size_t storage() noexcept { return StorageSize; }
+    //! Check if the given closure type fits into the function storage
+    template <class TFunction>
+    static constexpr bool fits() noexcept
+    {
+        using function_type = typename std::decay<TFunction>::type;
+        return (sizeof(function_type) <= StorageSize) && ((StorageAlign % alignof(function_type)) == 0);
+    }
+
+    //! Is the function safe to relocate with memcpy()? (empty or keeps a trivially copyable closure)
+    bool relocatable() const noexcept { return ((_manager == nullptr) || (_manager == &ManageTrivial)); }
+
     //! Invoke the function
     R operator()(Args... args);
 
     //! Swap two instances
     void swap(Function& function) noexcept;
-    template <class UR, class... UArgs, size_t UCapacity>
-    friend void swap(Function<UR(UArgs...), UCapacity>& function1, Function<UR(UArgs...), UCapacity>& function2) noexcept;
+    template <class UR, class... UArgs, size_t UCapacity, bool UCopyable>
+    friend void swap(Function<UR(UArgs...), UCapacity, UCopyable>& function1, Function<UR(UArgs...), UCapacity, UCopyable>& function2) noexcept;
 
 private:
-    enum class Operation { Clone, Destroy };
-
-    using Invoker = R (*)(void*, Args&&...);
-    using Manager = void (*)(void*, void*, Operation);
-
-    static const size_t StorageSize = Capacity - sizeof(Invoker) - sizeof(Manager);
-    static const size_t StorageAlign = 8;
-
     alignas(StorageAlign) std::byte _data[StorageSize];
     Invoker _invoker;
     Manager _manager;
@@ -75,8 +112,20 @@ private:
 
     template <typename TFunction>
     static void Manage(void* dst, void* src, Operation op) noexcept;
+    static void ManageTrivial(void* dst, void* src, Operation op) noexcept;
+
+    // Move the closure from the given function, which becomes empty
+    void MoveFrom(Function& function) noexcept;
 };
 
+//! Move-only allocation free function
+/*!
+    Move-only function accepts closures with move-only captures. Default
+    capacity of 64 bytes keeps the function object in a single cache line.
+*/
+template <class TSignature, size_t Capacity = 64>
+using MoveFunction = Function<TSignature, Capacity, false>;
+
 /*! \example common_function.cpp Allocation free function example */
 
 } // namespace CppCommon
@@ -8,108 +8,121 @@
 
 namespace CppCommon {
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>::Function() noexcept
-    : _data(),
-      _invoker(nullptr),
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>::Function() noexcept
+    : _invoker(nullptr),
       _manager(nullptr)
 {
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>::Function(std::nullptr_t) noexcept
-    : Function<R(Args...), Capacity>()
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>::Function(std::nullptr_t) noexcept
+    : Function<R(Args...), Capacity, Copyable>()
 {
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>::Function(const Function& function) noexcept
-    : Function<R(Args...), Capacity>()
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>::Function(const Function& function) noexcept requires (Copyable)
+    : Function<R(Args...), Capacity, Copyable>()
 {
     if (function)
     {
-        function._manager(&_data, &function._data, Operation::Clone);
+        if (function._manager == &ManageTrivial)
+            std::memcpy(&_data, &function._data, StorageSize);
+        else
+            function._manager(&_data, (void*)&function._data, Operation::Clone);
         _invoker = function._invoker;
         _manager = function._manager;
     }
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>::Function(Function&& function) noexcept
-    : Function<R(Args...), Capacity>()
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>::Function(Function&& function) noexcept
+    : Function<R(Args...), Capacity, Copyable>()
 {
-    function.swap(*this);
+    MoveFrom(function);
 }
 
-template <class R, class... Args, size_t Capacity>
+template <class R, class... Args, size_t Capacity, bool Copyable>
 template <class TFunction>
-inline Function<R(Args...), Capacity>::Function(TFunction&& function) noexcept
-    : Function<R(Args...), Capacity>()
+requires (!std::is_same<typename std::decay<TFunction>::type, Function<R(Args...), Capacity, Copyable>>::value)
+inline Function<R(Args...), Capacity, Copyable>::Function(TFunction&& function) noexcept
+    : Function<R(Args...), Capacity, Copyable>()
 {
     using function_type = typename std::decay<TFunction>::type;
 
     // Check implementation storage parameters
-    static_assert((StorageSize >= sizeof(function_type)), "Function::StorageSize must be increased!");
+    static_assert((StorageSize >= sizeof(function_type)), "Function capacity must be increased to keep the closure without heap allocation!");
     static_assert(((StorageAlign % alignof(function_type)) == 0), "Function::StorageAlign must be adjusted!");
+    static_assert((!Copyable || std::is_copy_constructible<function_type>::value), "Closure with move-only captures requires MoveFunction!");
 
     // Create the implementation instance
     new (&_data) function_type(std::forward<TFunction>(function));
 
     _invoker = &Invoke<function_type>;
-    _manager = &Manage<function_type>;
+    if constexpr (std::is_trivially_copyable<function_type>::value)
+        _manager = &ManageTrivial;
+    else
+        _manager = &Manage<function_type>;
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>::~Function() noexcept
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>::~Function() noexcept
 {
-    if (_manager)
+    if (_manager && (_manager != &ManageTrivial))
         _manager(&_data, nullptr, Operation::Destroy);
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(std::nullptr_t) noexcept
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>& Function<R(Args...), Capacity, Copyable>::operator=(std::nullptr_t) noexcept
 {
     if (_manager)
     {
-        _manager(&_data, nullptr, Operation::Destroy);
+        if (_manager != &ManageTrivial)
+            _manager(&_data, nullptr, Operation::Destroy);
         _manager = nullptr;
         _invoker = nullptr;
     }
     return *this;
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(const Function& function) noexcept
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>& Function<R(Args...), Capacity, Copyable>::operator=(const Function& function) noexcept requires (Copyable)
 {
     Function(function).swap(*this);
     return *this;
 }
 
-template <class R, class... Args, size_t Capacity>
-inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(Function&& function) noexcept
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline Function<R(Args...), Capacity, Copyable>& Function<R(Args...), Capacity, Copyable>::operator=(Function&& function) noexcept
 {
-    Function(std::move(function)).swap(*this);
+    if (this != &function)
+    {
+        *this = nullptr;
+        MoveFrom(function);
+    }
     return *this;
 }
 
-template <class R, class... Args, size_t Capacity>
+template <class R, class... Args, size_t Capacity, bool Copyable>
 template <typename TFunction>
-inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(TFunction&& function) noexcept
+requires (!std::is_same<typename std::decay<TFunction>::type, Function<R(Args...), Capacity, Copyable>>::value)
+inline Function<R(Args...), Capacity, Copyable>& Function<R(Args...), Capacity, Copyable>::operator=(TFunction&& function) noexcept
 {
-    Function(std::forward<TFunction>(function)).swap(*this);
+    *this = Function(std::forward<TFunction>(function));
     return *this;
 }
 
-template <class R, class... Args, size_t Capacity>
+template <class R, class... Args, size_t Capacity, bool Copyable>
 template <typename TFunction>
-inline Function<R(Args...), Capacity>& Function<R(Args...), Capacity>::operator=(std::reference_wrapper<TFunction> function) noexcept
+inline Function<R(Args...), Capacity, Copyable>& Function<R(Args...), Capacity, Copyable>::operator=(std::reference_wrapper<TFunction> function) noexcept
 {
-    Function(function).swap(*this);
+    *this = Function(function);
     return *this;
 }
 
-template <class R, class... Args, size_t Capacity>
-inline R Function<R(Args...), Capacity>::operator()(Args... args)
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline R Function<R(Args...), Capacity, Copyable>::operator()(Args... args)
 {
     if (!_invoker)
         throw std::bad_function_call();
@@ -117,22 +130,27 @@ inline R Function<R(Args...), Capacity>::operator()(Args... args)
     return _invoker(&_data, std::forward<Args>(args)...);
 }
 
-template <class R, class... Args, size_t Capacity>
+template <class R, class... Args, size_t Capacity, bool Copyable>
 template <typename TFunction>
-inline R Function<R(Args...), Capacity>::Invoke(void* data, Args&&... args) noexcept
+inline R Function<R(Args...), Capacity, Copyable>::Invoke(void* data, Args&&... args) noexcept
 {
     TFunction& function = *static_cast<TFunction*>(data);
     return function(std::forward<Args>(args)...);
 }
 
-template <class R, class... Args, size_t Capacity>
+template <class R, class... Args, size_t Capacity, bool Copyable>
 template <typename TFunction>
-inline void Function<R(Args...), Capacity>::Manage(void* dst, void* src, Operation op) noexcept
+inline void Function<R(Args...), Capacity, Copyable>::Manage(void* dst, void* src, Operation op) noexcept
 {
     switch (op)
     {
         case Operation::Clone:
-            new (dst) TFunction(*static_cast<TFunction*>(src));
+            if constexpr (Copyable)
+                new (dst) TFunction(*static_cast<TFunction*>(src));
+            break;
+        case Operation::Move:
+            new (dst) TFunction(std::move(*static_cast<TFunction*>(src)));
+            static_cast<TFunction*>(src)->~TFunction();
             break;
         case Operation::Destroy:
             static_cast<TFunction*>(dst)->~TFunction();
@@ -140,17 +158,43 @@ inline void Function<R(Args...), Capacity>::Manage(void* dst, void* src, Operati
     }
 }
 
-template <class R, class... Args, size_t Capacity>
-inline void Function<R(Args...), Capacity>::swap(Function& function) noexcept
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline void Function<R(Args...), Capacity, Copyable>::ManageTrivial(void* dst, void* src, Operation op) noexcept
+{
+    // Trivially copyable closures are copied and moved in place, so the manager is only used as a marker
+    if ((op == Operation::Clone) || (op == Operation::Move))
+        std::memcpy(dst, src, StorageSize);
+}
+
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline void Function<R(Args...), Capacity, Copyable>::MoveFrom(Function& function) noexcept
+{
+    if (function)
+    {
+        if (function._manager == &ManageTrivial)
+            std::memcpy(&_data, &function._data, StorageSize);
+        else
+            function._manager(&_data, &function._data, Operation::Move);
+        _invoker = function._invoker;
+        _manager = function._manager;
+        function._invoker = nullptr;
+        function._manager = nullptr;
+    }
+}
+
+template <class R, class... Args, size_t Capacity, bool Copyable>
+inline void Function<R(Args...), Capacity, Copyable>::swap(Function& function) noexcept
 {
-    using std::swap;
-    swap(_data, function._data);
-    swap(_manager, function._manager);
-    swap(_invoker, function._invoker);
+    if (this == &function)
+        return;
+
+    Function temp(std::move(function));
+    function = std::move(*this);
+    *this = std::move(temp);
 }
 
-template <class R, class... Args, size_t Capacity>
-void swap(Function<R(Args...), Capacity>& function1, Function<R(Args...), Capacity>& function2) noexcept
+template <class R, class... Args, size_t Capacity, bool Copyable>
+void swap(Function<R(Args...), Capacity, Copyable>& function1, Function<R(Args...), Capacity, Copyable>& function2) noexcept
 {
     function1.swap(function2);
 }
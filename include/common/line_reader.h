@@ -0,0 +1,141 @@
+/*!
+    \file line_reader.h
+    \brief Streaming line reader definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_LINE_READER_H
+#define CPPCOMMON_LINE_READER_H
+
+#include "common/reader.h"
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Streaming line reader
+/*!
+    Line reader splits the content of the reader or the memory region (e.g.
+    the memory-mapped file view) into lines or records separated by the given
+    delimiter. Lines are returned as string views into the reusable buffer or
+    the memory region, so the memory usage does not depend on the content
+    size and no heap string is created for each line.
+
+    Delimiters are searched with memchr(), which is vectorized (SSE2/AVX2/
+    NEON) by standard C libraries. Multi-character delimiters are searched
+    by their first character and then compared.
+
+    If the delimiter is "\n" then the trailing '\r' is removed from lines, so
+    Unix and Windows text files are handled in the same way. The last line
+    without delimiter is also returned.
+
+    Not thread-safe.
+*/
+class LineReader
+{
+public:
+    //! Default size of the read buffer (1 MiB)
+    static const size_t DEFAULT_BUFFER;
+
+    //! Initialize line reader with the given reader
+    /*!
+        The read buffer grows only if a single line does not fit into it.
+
+        \param reader - Reader to read the content
+        \param delimiter - Lines delimiter (default is "\n")
+        \param buffer - Read buffer size (default is LineReader::DEFAULT_BUFFER)
+    */
+    explicit LineReader(Reader& reader, std::string_view delimiter = "\n", size_t buffer = LineReader::DEFAULT_BUFFER);
+    //! Initialize line reader with the given memory region
+    /*!
+        Memory region must be valid while lines are used!
+
+        \param content - Memory region content
+        \param delimiter - Lines delimiter (default is "\n")
+    */
+    explicit LineReader(std::string_view content, std::string_view delimiter = "\n");
+    LineReader(const LineReader&) = delete;
+    LineReader(LineReader&&) = delete;
+    ~LineReader() = default;
+
+    LineReader& operator=(const LineReader&) = delete;
+    LineReader& operator=(LineReader&&) = delete;
+
+    //! Get the lines delimiter
+    const std::string& delimiter() const noexcept { return _delimiter; }
+    //! Get the count of read lines
+    size_t lines() const noexcept { return _lines; }
+
+    //! Read the next line
+    /*!
+        Returned line is valid until the next call of the method!
+
+        \param line - Line to read
+        \return 'true' if the line was read, 'false' if the end of content was met
+    */
+    bool Next(std::string_view& line);
+
+    //! Lines input iterator
+    class Iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef std::string_view value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const std::string_view* pointer;
+        typedef const std::string_view& reference;
+
+        Iterator() noexcept : _reader(nullptr) {}
+        explicit Iterator(LineReader* reader) : _reader(reader) { ++(*this); }
+
+        Iterator& operator++()
+        {
+            if ((_reader != nullptr) && !_reader->Next(_line))
+                _reader = nullptr;
+            return *this;
+        }
+
+        reference operator*() const noexcept { return _line; }
+        pointer operator->() const noexcept { return &_line; }
+
+        friend bool operator==(const Iterator& it1, const Iterator& it2) noexcept
+        { return it1._reader == it2._reader; }
+        friend bool operator!=(const Iterator& it1, const Iterator& it2) noexcept
+        { return it1._reader != it2._reader; }
+
+    private:
+        LineReader* _reader;
+        std::string_view _line;
+    };
+
+    //! Get the begin lines iterator (starts reading)
+    Iterator begin() { return Iterator(this); }
+    //! Get the end lines iterator
+    Iterator end() noexcept { return Iterator(); }
+
+private:
+    Reader* _reader;
+    std::string _delimiter;
+    std::unique_ptr<char[]> _buffer;
+    size_t _capacity;
+    const char* _begin;
+    const char* _cursor;
+    const char* _scan;
+    const char* _end;
+    bool _eof;
+    size_t _lines;
+
+    const char* Find(const char* first, const char* last) const noexcept;
+    void Fill();
+};
+
+/*! \example common_line_reader.cpp Streaming line reader example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_LINE_READER_H
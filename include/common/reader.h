@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_READER_H
 #define CPPCOMMON_READER_H
 
+#include "common/buffer_chain.h"
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -39,8 +41,23 @@ public:
     */
     virtual size_t Read(void* buffer, size_t size) = 0;
 
+    //! Read bytes into the buffer chain
+    /*!
+        Bytes are read directly into the writable tail of the buffer chain.
+        Reading is stopped when the given size is read or the reader returns
+        less bytes than requested.
+
+        \param chain - Buffer chain to append
+        \param size - Maximal count of bytes to read
+        \return Count of read bytes
+    */
+    virtual size_t ReadInto(BufferChain& chain, size_t size);
+
     //! Read all bytes
     /*!
+        All bytes are read into the buffer chain and copied into the result
+        with a single allocation.
+
         \return Bytes buffer
     */
     std::vector<uint8_t> ReadAllBytes();
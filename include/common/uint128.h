@@ -11,15 +11,38 @@
 
 #include "string/format.h"
 
+#include <bit>
+#include <charconv>
 #include <cstdint>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(__SIZEOF_INT128__)
+// Native unsigned 128-bit compiler extension type
+__extension__ typedef unsigned __int128 NativeUInt128;
+#endif
+
+// Convert the array of 64-bit limbs (most significant first) into the buffer of at least 64 characters per limb
+size_t UIntToChars(const uint64_t* limbs, size_t count, size_t base, char* buffer) noexcept;
+// Parse the string into the array of 64-bit limbs (most significant first)
+std::from_chars_result UIntFromChars(const char* first, const char* last, uint64_t* limbs, size_t count, size_t base) noexcept;
+
+} // namespace Internals
+//! @endcond
+
 //! Unsigned 128-bit integer type
 /*!
     Represents unsigned 128-bit integer type and provides basic arithmetic operations.
@@ -277,6 +300,19 @@ public:
     */
     std::wstring wstring(size_t base = 10, size_t length = 0) const;
 
+    //! Convert the current 128-bit integer into the given character buffer
+    /*!
+        Decimal and other bases are converted by chunks of the largest power
+        of the base which fits into 64 bits, power of two bases are converted
+        by bits. No memory is allocated.
+
+        \param first - Buffer begin
+        \param last - Buffer end
+        \param base - Conversion base in range [2, 16] (default is 10)
+        \return Conversion result with the end of written characters or std::errc::value_too_large error
+    */
+    std::to_chars_result to_chars(char* first, char* last, size_t base = 10) const noexcept;
+
     //! Calculate quotient and remainder when dividing X by Y
     /*!
         \param x - X value
@@ -285,6 +321,27 @@ public:
     */
     static std::pair<uint128_t, uint128_t> divmod(const uint128_t& x, const uint128_t& y);
 
+    //! Parse the 128-bit integer from the given character buffer
+    /*!
+        Digits are parsed in the same way as std::from_chars() does: without
+        leading whitespaces, signs or prefixes. In case of error the value is
+        not modified.
+
+        \param first - Buffer begin
+        \param last - Buffer end
+        \param value - Parsed value
+        \param base - Conversion base in range [2, 16] (default is 10)
+        \return Conversion result with the end of parsed characters or std::errc::invalid_argument, std::errc::result_out_of_range errors
+    */
+    static std::from_chars_result from_chars(const char* first, const char* last, uint128_t& value, size_t base = 10) noexcept;
+    //! Parse the 128-bit integer from the given string
+    /*!
+        \param str - String to parse
+        \param base - Conversion base in range [2, 16] (default is 10)
+        \return Parsed value
+    */
+    static uint128_t parse(std::string_view str, size_t base = 10);
+
     //! Input instance from the given input stream
     friend std::istream& operator>>(std::istream& is, uint128_t& value)
     { is >> value._upper >> value._lower; return is; }
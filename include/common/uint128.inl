@@ -8,6 +8,97 @@
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Multiply two 64-bit values into the 128-bit product
+constexpr uint64_t Multiply64(uint64_t value1, uint64_t value2, uint64_t& upper) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    NativeUInt128 result = (NativeUInt128)value1 * value2;
+    upper = (uint64_t)(result >> 64);
+    return (uint64_t)result;
+#else
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+    if (!std::is_constant_evaluated())
+        return _umul128(value1, value2, &upper);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    if (!std::is_constant_evaluated())
+    {
+        upper = __umulh(value1, value2);
+        return value1 * value2;
+    }
+#endif
+    // Combine four 32-bit partial products
+    uint64_t p00 = (value1 & 0xFFFFFFFF) * (value2 & 0xFFFFFFFF);
+    uint64_t p01 = (value1 & 0xFFFFFFFF) * (value2 >> 32);
+    uint64_t p10 = (value1 >> 32) * (value2 & 0xFFFFFFFF);
+    uint64_t p11 = (value1 >> 32) * (value2 >> 32);
+    uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+    upper = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+    return (middle << 32) | (p00 & 0xFFFFFFFF);
+#endif
+}
+
+// Divide the 128-bit value by the 64-bit divisor (upper part must be less than the divisor)
+constexpr uint64_t Divide128(uint64_t upper, uint64_t lower, uint64_t divisor, uint64_t& remainder) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        uint64_t quotient = 0;
+        __asm__("divq %[divisor]" : "=a"(quotient), "=d"(remainder) : [divisor] "r"(divisor), "a"(lower), "d"(upper));
+        return quotient;
+#elif defined(_MSC_VER) && (_MSC_VER >= 1920) && (defined(_M_X64) || defined(_M_AMD64)) && !defined(__clang__)
+        return _udiv128(upper, lower, divisor, &remainder);
+#endif
+    }
+
+#if defined(__SIZEOF_INT128__)
+    NativeUInt128 value = ((NativeUInt128)upper << 64) | lower;
+    remainder = (uint64_t)(value % divisor);
+    return (uint64_t)(value / divisor);
+#else
+    // Knuth's algorithm D with 32-bit digits (Hacker's Delight divlu)
+    const uint64_t base = 1ull << 32;
+    int shift = std::countl_zero(divisor);
+    divisor <<= shift;
+    uint64_t vn1 = divisor >> 32;
+    uint64_t vn0 = divisor & 0xFFFFFFFF;
+    uint64_t un32 = (shift == 0) ? upper : ((upper << shift) | (lower >> (64 - shift)));
+    uint64_t un10 = lower << shift;
+    uint64_t un1 = un10 >> 32;
+    uint64_t un0 = un10 & 0xFFFFFFFF;
+
+    uint64_t q1 = un32 / vn1;
+    uint64_t rhat = un32 - q1 * vn1;
+    while ((q1 >= base) || ((q1 * vn0) > ((rhat << 32) + un1)))
+    {
+        --q1;
+        rhat += vn1;
+        if (rhat >= base)
+            break;
+    }
+
+    uint64_t un21 = (un32 << 32) + un1 - q1 * divisor;
+    uint64_t q0 = un21 / vn1;
+    rhat = un21 - q0 * vn1;
+    while ((q0 >= base) || ((q0 * vn0) > ((rhat << 32) + un0)))
+    {
+        --q0;
+        rhat += vn1;
+        if (rhat >= base)
+            break;
+    }
+
+    remainder = ((un21 << 32) + un0 - q0 * divisor) >> shift;
+    return (q1 << 32) + q0;
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
 inline uint128_t::uint128_t() noexcept
     : _upper(0), _lower(0)
 {
@@ -87,6 +178,15 @@ inline uint128_t operator-(const uint128_t& value1, const uint128_t& value2) noe
     return uint128_t(value1._upper - value2._upper - (((value1._lower - value2._lower) > value1._lower) ? 1 : 0), value1._lower - value2._lower);
 }
 
+inline uint128_t operator*(const uint128_t& value1, const uint128_t& value2) noexcept
+{
+    // Only the lower product of upper parts is required for the 128-bit result
+    uint64_t upper;
+    uint64_t lower = Internals::Multiply64(value1._lower, value2._lower, upper);
+    upper += value1._lower * value2._upper + value1._upper * value2._lower;
+    return uint128_t(upper, lower);
+}
+
 inline uint128_t operator/(const uint128_t& value1, const uint128_t& value2)
 {
     return uint128_t::divmod(value1, value2).first;
@@ -97,6 +197,34 @@ inline uint128_t operator%(const uint128_t& value1, const uint128_t& value2)
     return uint128_t::divmod(value1, value2).second;
 }
 
+inline uint128_t operator<<(const uint128_t& value1, const uint128_t& value2) noexcept
+{
+    const uint64_t shift = value2._lower;
+
+    if (((bool)value2._upper) || (shift >= 128))
+        return 0;
+    else if (shift == 0)
+        return value1;
+    else if (shift < 64)
+        return uint128_t((value1._upper << shift) | (value1._lower >> (64 - shift)), value1._lower << shift);
+    else
+        return uint128_t(value1._lower << (shift - 64), 0);
+}
+
+inline uint128_t operator>>(const uint128_t& value1, const uint128_t& value2) noexcept
+{
+    const uint64_t shift = value2._lower;
+
+    if (((bool)value2._upper) || (shift >= 128))
+        return 0;
+    else if (shift == 0)
+        return value1;
+    else if (shift < 64)
+        return uint128_t(value1._upper >> shift, (value1._upper << (64 - shift)) | (value1._lower >> shift));
+    else
+        return uint128_t(0, value1._upper >> (shift - 64));
+}
+
 inline uint128_t operator&(const uint128_t& value1, const uint128_t& value2) noexcept
 {
     return uint128_t(value1._upper & value2._upper, value1._lower & value2._lower);
@@ -154,12 +282,15 @@ inline bool operator||(const uint128_t& value1, const uint128_t& value2) noexcep
 
 inline std::ostream& operator<<(std::ostream& os, const uint128_t& value)
 {
+    char buffer[96];
+    std::to_chars_result result = { buffer, std::errc() };
     if (os.flags() & os.oct)
-        os << value.string(8);
+        result = value.to_chars(buffer, buffer + sizeof(buffer), 8);
     else if (os.flags() & os.dec)
-        os << value.string(10);
+        result = value.to_chars(buffer, buffer + sizeof(buffer), 10);
     else if (os.flags() & os.hex)
-        os << value.string(16);
+        result = value.to_chars(buffer, buffer + sizeof(buffer), 16);
+    os << std::string_view(buffer, result.ptr - buffer);
     return os;
 }
 
@@ -174,6 +305,54 @@ inline std::wostream& operator<<(std::wostream& os, const uint128_t& value)
     return os;
 }
 
+inline size_t uint128_t::bits() const noexcept
+{
+    if (_upper)
+        return 128 - std::countl_zero(_upper);
+    else
+        return 64 - std::countl_zero(_lower);
+}
+
+inline std::pair<uint128_t, uint128_t> uint128_t::divmod(const uint128_t& x, const uint128_t& y)
+{
+    if (y == 0)
+        throw std::domain_error("Division by 0");
+    else if (x < y)
+        return std::pair<uint128_t, uint128_t>(0, x);
+
+    // Both values fit into 64 bits
+    if (x._upper == 0)
+        return std::pair<uint128_t, uint128_t>(x._lower / y._lower, x._lower % y._lower);
+
+    // Divisor fits into 64 bits: divide upper and lower parts with the native 128-bit by 64-bit division
+    if (y._upper == 0)
+    {
+        uint64_t remainder;
+        uint64_t upper = x._upper / y._lower;
+        uint64_t lower = Internals::Divide128(x._upper % y._lower, x._lower, y._lower, remainder);
+        return std::pair<uint128_t, uint128_t>(uint128_t(upper, lower), remainder);
+    }
+
+    // Divisor is greater than 64 bits, so the quotient fits into 64 bits (Hacker's Delight divlu2).
+    // Estimate the quotient with the normalized divisor upper part, it is exact or greater by one.
+    const int shift = std::countl_zero(y._upper);
+    const uint64_t divisor = (y << shift)._upper;
+    const uint128_t dividend = x >> 1;
+    uint64_t remainder;
+    uint64_t quotient = Internals::Divide128(dividend._upper, dividend._lower, divisor, remainder) >> (63 - shift);
+    if (quotient != 0)
+        --quotient;
+
+    uint128_t rest = x - y * quotient;
+    if (rest >= y)
+    {
+        ++quotient;
+        rest -= y;
+    }
+
+    return std::pair<uint128_t, uint128_t>(quotient, rest);
+}
+
 inline void uint128_t::swap(uint128_t& value) noexcept
 {
     using std::swap;
@@ -195,7 +374,9 @@ struct fmt::formatter<CppCommon::uint128_t> : formatter<std::string_view>
     template <typename FormatContext>
     auto format(const CppCommon::uint128_t& value, FormatContext& ctx) const
     {
-        return formatter<string_view>::format(value.string(10), ctx);
+        char buffer[48];
+        std::to_chars_result result = value.to_chars(buffer, buffer + sizeof(buffer), 10);
+        return formatter<string_view>::format(std::string_view(buffer, result.ptr - buffer), ctx);
     }
 };
 #endif
@@ -321,6 +321,15 @@ public:
     */
     std::wstring wstring(size_t base = 10, size_t length = 0) const;
 
+    //! Convert the current 256-bit integer into the given character buffer
+    /*!
+        \param first - Buffer begin
+        \param last - Buffer end
+        \param base - Conversion base in range [2, 16] (default is 10)
+        \return Conversion result with the end of written characters or std::errc::value_too_large error
+    */
+    std::to_chars_result to_chars(char* first, char* last, size_t base = 10) const noexcept;
+
     //! Calculate quotient and remainder when dividing X by Y
     /*!
         \param x - X value
@@ -329,6 +338,23 @@ public:
     */
     static std::pair<uint256_t, uint256_t> divmod(const uint256_t& x, const uint256_t& y);
 
+    //! Parse the 256-bit integer from the given character buffer
+    /*!
+        \param first - Buffer begin
+        \param last - Buffer end
+        \param value - Parsed value
+        \param base - Conversion base in range [2, 16] (default is 10)
+        \return Conversion result with the end of parsed characters or std::errc::invalid_argument, std::errc::result_out_of_range errors
+    */
+    static std::from_chars_result from_chars(const char* first, const char* last, uint256_t& value, size_t base = 10) noexcept;
+    //! Parse the 256-bit integer from the given string
+    /*!
+        \param str - String to parse
+        \param base - Conversion base in range [2, 16] (default is 10)
+        \return Parsed value
+    */
+    static uint256_t parse(std::string_view str, size_t base = 10);
+
     //! Input instance from the given input stream
     friend std::istream& operator>>(std::istream& is, uint256_t& value)
     { is >> value._upper >> value._lower; return is; }
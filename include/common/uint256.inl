@@ -99,6 +99,32 @@ inline uint256_t operator-(const uint256_t& value1, const uint256_t& value2) noe
     return uint256_t(value1._upper - value2._upper - (((value1._lower - value2._lower) > value1._lower) ? 1 : 0), value1._lower - value2._lower);
 }
 
+inline uint256_t operator*(const uint256_t& value1, const uint256_t& value2) noexcept
+{
+    // Split values into four 64-bit limbs
+    const uint64_t a[4] = { value1._lower.lower(), value1._lower.upper(), value1._upper.lower(), value1._upper.upper() };
+    const uint64_t b[4] = { value2._lower.lower(), value2._lower.upper(), value2._upper.lower(), value2._upper.upper() };
+    uint64_t r[4] = { 0, 0, 0, 0 };
+
+    // Schoolbook multiplication truncated to the lower four limbs
+    for (size_t i = 0; i < 4; ++i)
+    {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < (4 - i); ++j)
+        {
+            uint64_t upper;
+            uint64_t lower = Internals::Multiply64(a[i], b[j], upper);
+            lower += carry;
+            upper += (lower < carry);
+            r[i + j] += lower;
+            upper += (r[i + j] < lower);
+            carry = upper;
+        }
+    }
+
+    return uint256_t(r[3], r[2], r[1], r[0]);
+}
+
 inline uint256_t operator/(const uint256_t& value1, const uint256_t& value2)
 {
     return uint256_t::divmod(value1, value2).first;
@@ -109,6 +135,34 @@ inline uint256_t operator%(const uint256_t& value1, const uint256_t& value2)
     return uint256_t::divmod(value1, value2).second;
 }
 
+inline uint256_t operator<<(const uint256_t& value1, const uint256_t& value2) noexcept
+{
+    const uint128_t shift = value2._lower;
+
+    if (((bool)value2._upper) || (shift >= 256))
+        return 0;
+    else if (shift == 0)
+        return value1;
+    else if (shift < 128)
+        return uint256_t((value1._upper << shift) | (value1._lower >> (128 - shift)), value1._lower << shift);
+    else
+        return uint256_t(value1._lower << (shift - 128), 0);
+}
+
+inline uint256_t operator>>(const uint256_t& value1, const uint256_t& value2) noexcept
+{
+    const uint128_t shift = value2._lower;
+
+    if (((bool)value2._upper) || (shift >= 256))
+        return 0;
+    else if (shift == 0)
+        return value1;
+    else if (shift < 128)
+        return uint256_t(value1._upper >> shift, (value1._upper << (128 - shift)) | (value1._lower >> shift));
+    else
+        return uint256_t(value1._upper >> (shift - 128));
+}
+
 inline uint256_t operator&(const uint256_t& value1, const uint256_t& value2) noexcept
 {
     return uint256_t(value1._upper & value2._upper, value1._lower & value2._lower);
@@ -166,12 +220,15 @@ inline bool operator||(const uint256_t& value1, const uint256_t& value2) noexcep
 
 inline std::ostream& operator<<(std::ostream& os, const uint256_t& value)
 {
+    char buffer[192];
+    std::to_chars_result result = { buffer, std::errc() };
     if (os.flags() & os.oct)
-        os << value.string(8);
+        result = value.to_chars(buffer, buffer + sizeof(buffer), 8);
     else if (os.flags() & os.dec)
-        os << value.string(10);
+        result = value.to_chars(buffer, buffer + sizeof(buffer), 10);
     else if (os.flags() & os.hex)
-        os << value.string(16);
+        result = value.to_chars(buffer, buffer + sizeof(buffer), 16);
+    os << std::string_view(buffer, result.ptr - buffer);
     return os;
 }
 
@@ -186,6 +243,140 @@ inline std::wostream& operator<<(std::wostream& os, const uint256_t& value)
     return os;
 }
 
+inline size_t uint256_t::bits() const noexcept
+{
+    if (_upper)
+        return 128 + _upper.bits();
+    else
+        return _lower.bits();
+}
+
+inline std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& x, const uint256_t& y)
+{
+    if (y == 0)
+        throw std::domain_error("Division by 0");
+    else if (x < y)
+        return std::pair<uint256_t, uint256_t>(0, x);
+
+    // Both values fit into 128 bits
+    if (!x._upper)
+    {
+        auto result = uint128_t::divmod(x._lower, y._lower);
+        return std::pair<uint256_t, uint256_t>(result.first, result.second);
+    }
+
+    // Split values into 64-bit limbs
+    const uint64_t u[4] = { x._lower.lower(), x._lower.upper(), x._upper.lower(), x._upper.upper() };
+    const uint64_t v[4] = { y._lower.lower(), y._lower.upper(), y._upper.lower(), y._upper.upper() };
+    uint64_t q[4] = { 0, 0, 0, 0 };
+    uint64_t r[4] = { 0, 0, 0, 0 };
+
+    size_t m = 4;
+    while (u[m - 1] == 0)
+        --m;
+    size_t n = 4;
+    while (v[n - 1] == 0)
+        --n;
+
+    if (n == 1)
+    {
+        // Short division by the single limb divisor
+        uint64_t remainder = 0;
+        for (size_t i = m; i-- > 0;)
+            q[i] = Internals::Divide128(remainder, u[i], v[0], remainder);
+        r[0] = remainder;
+    }
+    else
+    {
+        // Knuth's algorithm D with 64-bit limbs
+        const int shift = std::countl_zero(v[n - 1]);
+
+        // Normalize the divisor and the dividend
+        uint64_t vn[4];
+        for (size_t i = n - 1; i > 0; --i)
+            vn[i] = (v[i] << shift) | ((shift != 0) ? (v[i - 1] >> (64 - shift)) : 0);
+        vn[0] = v[0] << shift;
+
+        uint64_t un[5];
+        un[m] = (shift != 0) ? (u[m - 1] >> (64 - shift)) : 0;
+        for (size_t i = m - 1; i > 0; --i)
+            un[i] = (u[i] << shift) | ((shift != 0) ? (u[i - 1] >> (64 - shift)) : 0);
+        un[0] = u[0] << shift;
+
+        for (size_t j = m - n + 1; j-- > 0;)
+        {
+            // Estimate the quotient limb with two upper limbs of the dividend
+            uint64_t qhat;
+            uint64_t rhat;
+            bool overflow = false;
+            if (un[j + n] >= vn[n - 1])
+            {
+                qhat = ~0ull;
+                rhat = un[j + n - 1] + vn[n - 1];
+                overflow = (rhat < vn[n - 1]);
+            }
+            else
+                qhat = Internals::Divide128(un[j + n], un[j + n - 1], vn[n - 1], rhat);
+
+            // Refine the estimation with the next divisor limb
+            while (!overflow)
+            {
+                uint64_t upper;
+                uint64_t lower = Internals::Multiply64(qhat, vn[n - 2], upper);
+                if ((upper < rhat) || ((upper == rhat) && (lower <= un[j + n - 2])))
+                    break;
+                --qhat;
+                rhat += vn[n - 1];
+                overflow = (rhat < vn[n - 1]);
+            }
+
+            // Multiply and subtract
+            uint64_t carry = 0;
+            uint64_t borrow = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                uint64_t upper;
+                uint64_t lower = Internals::Multiply64(qhat, vn[i], upper);
+                lower += carry;
+                upper += (lower < carry);
+                carry = upper;
+                uint64_t value = un[i + j] - lower;
+                uint64_t next = (un[i + j] < lower);
+                next += (value < borrow);
+                un[i + j] = value - borrow;
+                borrow = next;
+            }
+            uint64_t value = un[j + n] - carry;
+            bool negative = (un[j + n] < carry) || (value < borrow);
+            un[j + n] = value - borrow;
+
+            // Add back if the estimation was greater by one
+            if (negative)
+            {
+                --qhat;
+                carry = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    uint64_t sum = un[i + j] + vn[i];
+                    uint64_t next = (sum < vn[i]);
+                    un[i + j] = sum + carry;
+                    next += (un[i + j] < carry);
+                    carry = next;
+                }
+                un[j + n] += carry;
+            }
+
+            q[j] = qhat;
+        }
+
+        // Denormalize the remainder
+        for (size_t i = 0; i < n; ++i)
+            r[i] = (un[i] >> shift) | ((shift != 0) ? (un[i + 1] << (64 - shift)) : 0);
+    }
+
+    return std::pair<uint256_t, uint256_t>(uint256_t(q[3], q[2], q[1], q[0]), uint256_t(r[3], r[2], r[1], r[0]));
+}
+
 inline void uint256_t::swap(uint256_t& value) noexcept
 {
     using std::swap;
@@ -207,7 +398,9 @@ struct fmt::formatter<CppCommon::uint256_t> : formatter<std::string_view>
     template <typename FormatContext>
     auto format(const CppCommon::uint256_t& value, FormatContext& ctx) const
     {
-        return formatter<string_view>::format(value.string(10), ctx);
+        char buffer[96];
+        std::to_chars_result result = value.to_chars(buffer, buffer + sizeof(buffer), 10);
+        return formatter<string_view>::format(std::string_view(buffer, result.ptr - buffer), ctx);
     }
 };
 #endif
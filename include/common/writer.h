@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_WRITER_H
 #define CPPCOMMON_WRITER_H
 
+#include "common/buffer_chain.h"
+
 #include <string>
 #include <vector>
 
@@ -38,6 +40,17 @@ public:
     */
     virtual size_t Write(const void* buffer, size_t size) = 0;
 
+    //! Write the buffer chain content
+    /*!
+        Written bytes are consumed from the buffer chain. Writing is stopped
+        when the whole chain is written or the writer writes less bytes than
+        requested.
+
+        \param chain - Buffer chain to write
+        \return Count of written bytes
+    */
+    virtual size_t WriteFrom(BufferChain& chain);
+
     //! Write a text string
     /*!
         \param text - Text string
@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace CppCommon {
@@ -496,6 +497,64 @@ private:
     const T* _node;
 };
 
+//! Intrusive binary tree empty augmentation policy
+/*!
+    Default augmentation policy of balanced binary trees. It keeps no  extra
+    data in nodes and balanced binary tree skips all augmentation updates.
+*/
+struct BinTreeNoAugment
+{
+    template <typename T>
+    static void update(T&) noexcept {}
+};
+
+//! Intrusive binary tree order statistic augmentation policy
+/*!
+    Augmentation policy keeps the count of items in  the  subtree  of  each
+    node and allows balanced binary trees to perform select(k) and rank(item)
+    operations in O(log n) time. Binary tree node must have 'count' field:
+
+    \code{.cpp}
+    struct MyBinTreeNode : public BinTreeRB<MyBinTreeNode>::Node
+    {
+        size_t count;
+        ...
+    };
+    \endcode
+
+    Augmentation policy update() method  recalculates  the  data  of  the
+    given node from its children. Balanced binary trees call it for all nodes
+    which subtrees are changed by insert, erase and rotations. Range aggregates
+    require the policy to provide two more methods:
+
+    \li value(const T& node) - the value of the single node
+    \li aggregate(const T* node) - the aggregate value of the node subtree (the
+        identity value for nullptr node)
+
+    Custom policy usually extends the order statistic one:
+
+    \code{.cpp}
+    struct MySumAugment : public BinTreeOrderStatistic<MyBinTreeNode>
+    {
+        static int value(const MyBinTreeNode& node) noexcept { return node.value; }
+        static int aggregate(const MyBinTreeNode* node) noexcept { return (node != nullptr) ? node->sum : 0; }
+        static void update(MyBinTreeNode& node) noexcept
+        {
+            BinTreeOrderStatistic<MyBinTreeNode>::update(node);
+            node.sum = value(node) + aggregate(node.left) + aggregate(node.right);
+        }
+    };
+    \endcode
+*/
+template <typename T>
+struct BinTreeOrderStatistic
+{
+    //! Get the count of items in the subtree of the given node
+    static size_t count(const T* node) noexcept { return (node != nullptr) ? node->count : 0; }
+    //! Update the count of items in the subtree of the given node
+    static void update(T& node) noexcept { node.count = 1 + count(node.left) + count(node.right); }
+};
+
 /*! \example containers_bintree.cpp Intrusive binary tree container example */
 
 } // namespace CppCommon
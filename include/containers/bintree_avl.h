@@ -17,6 +17,11 @@ namespace CppCommon {
 /*!
     Not thread-safe.
 
+    Optional augmentation policy keeps extra data (subtree size, aggregates)
+    in nodes up to date through insert, erase and rotations. It allows to find
+    items by index, rank items and calculate range aggregates in O(log n) time
+    (see BinTreeOrderStatistic).
+
     <b>Overview</b>\n
     In computer science, an AVL tree is a self-balancing binary  search  tree,
     and the first such data structure to be  invented.  In  an  AVL  tree  the
@@ -95,7 +100,7 @@ namespace CppCommon {
     AVL tree from Wikipedia, the free encyclopedia
     http://en.wikipedia.org/wiki/AVL_tree
 */
-template <typename T, typename TCompare = std::less<T>>
+template <typename T, typename TCompare = std::less<T>, class TAugment = BinTreeNoAugment>
 class BinTreeAVL
 {
 public:
@@ -108,10 +113,10 @@ public:
     typedef const value_type* const_pointer;
     typedef ptrdiff_t difference_type;
     typedef size_t size_type;
-    typedef BinTreeIterator<BinTreeAVL<T, TCompare>, T> iterator;
-    typedef BinTreeConstIterator<BinTreeAVL<T, TCompare>, T> const_iterator;
-    typedef BinTreeReverseIterator<BinTreeAVL<T, TCompare>, T> reverse_iterator;
-    typedef BinTreeConstReverseIterator<BinTreeAVL<T, TCompare>, T> const_reverse_iterator;
+    typedef BinTreeIterator<BinTreeAVL<T, TCompare, TAugment>, T> iterator;
+    typedef BinTreeConstIterator<BinTreeAVL<T, TCompare, TAugment>, T> const_iterator;
+    typedef BinTreeReverseIterator<BinTreeAVL<T, TCompare, TAugment>, T> reverse_iterator;
+    typedef BinTreeConstReverseIterator<BinTreeAVL<T, TCompare, TAugment>, T> const_reverse_iterator;
 
     //! AVL binary tree node
     struct Node
@@ -189,6 +194,47 @@ public:
     iterator upper_bound(const T& item) noexcept;
     const_iterator upper_bound(const T& item) const noexcept;
 
+    //! Find the iterator which points to the item with the given index in the binary tree or return end iterator
+    /*!
+        Requires order statistic augmentation (see BinTreeOrderStatistic).
+        Complexity is O(log n).
+
+        \param index - Zero-based index of the item in the binary tree order
+        \return Iterator to the found item or end iterator
+    */
+    iterator select(size_t index) noexcept;
+    const_iterator select(size_t index) const noexcept;
+    //! Get the count of items that less than the given item in the binary tree
+    /*!
+        Requires order statistic augmentation (see BinTreeOrderStatistic).
+        Complexity is O(log n).
+
+        \param item - Item to rank
+        \return Count of items that less than the given item
+    */
+    size_t rank(const T& item) const noexcept;
+
+    //! Get the aggregate value of all items that less than the given item in the binary tree
+    /*!
+        Requires augmentation policy with value() and aggregate() methods
+        (see BinTreeOrderStatistic). Complexity is O(log n).
+
+        \param item - Upper bound item (not included)
+        \return Aggregate value of items that less than the given item
+    */
+    auto prefix_aggregate(const T& item) const noexcept;
+    //! Get the aggregate value of items in the range [first, last) of the binary tree
+    /*!
+        Aggregate value type must support subtraction, because range aggregate
+        is calculated as a difference of two prefix aggregates (e.g. sums).
+        Complexity is O(log n).
+
+        \param first - Lower bound item (included)
+        \param last - Upper bound item (not included)
+        \return Aggregate value of items in the given range
+    */
+    auto range_aggregate(const T& first, const T& last) const noexcept { return prefix_aggregate(last) - prefix_aggregate(first); }
+
     //! Insert a new item into the binary tree
     /*!
         \param item - Item to insert
@@ -221,8 +267,8 @@ public:
 
     //! Swap two instances
     void swap(BinTreeAVL& bintree) noexcept;
-    template <typename U, typename UCompare>
-    friend void swap(BinTreeAVL<U, UCompare>& bintree1, BinTreeAVL<U, UCompare>& bintree2) noexcept;
+    template <typename U, typename UCompare, class UAugment>
+    friend void swap(BinTreeAVL<U, UCompare, UAugment>& bintree1, BinTreeAVL<U, UCompare, UAugment>& bintree2) noexcept;
 
 private:
     TCompare _compare;  // Binary tree compare
@@ -234,6 +280,7 @@ private:
     const T* InternalFind(const T& item) const noexcept;
     const T* InternalLowerBound(const T& item) const noexcept;
     const T* InternalUpperBound(const T& item) const noexcept;
+    const T* InternalSelect(size_t index) const noexcept;
 
     static void RotateLeft(T* node);
     static void RotateRight(T* node);
@@ -241,6 +288,7 @@ private:
     static void RotateRightRight(T* node);
     static void Unlink(T* node);
     static void Swap(T*& node1, T*& node2);
+    static void UpdateAugment(T* node);
 };
 
 } // namespace CppCommon
@@ -8,29 +8,29 @@
 
 namespace CppCommon {
 
-template <typename T, typename TCompare>
+template <typename T, typename TCompare, class TAugment>
 template <class InputIterator>
-inline BinTreeAVL<T, TCompare>::BinTreeAVL(InputIterator first, InputIterator last, const TCompare& compare) noexcept
+inline BinTreeAVL<T, TCompare, TAugment>::BinTreeAVL(InputIterator first, InputIterator last, const TCompare& compare) noexcept
     : _compare(compare)
 {
     for (auto it = first; it != last; ++it)
         insert(*it);
 }
 
-template <typename T, typename TCompare>
-inline T* BinTreeAVL<T, TCompare>::lowest() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline T* BinTreeAVL<T, TCompare, TAugment>::lowest() noexcept
 {
     return (T*)InternalLowest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::lowest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::lowest() const noexcept
 {
     return InternalLowest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::InternalLowest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::InternalLowest() const noexcept
 {
     const T* result = _root;
     if (result != nullptr)
@@ -39,20 +39,20 @@ inline const T* BinTreeAVL<T, TCompare>::InternalLowest() const noexcept
     return result;
 }
 
-template <typename T, typename TCompare>
-inline T* BinTreeAVL<T, TCompare>::highest() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline T* BinTreeAVL<T, TCompare, TAugment>::highest() noexcept
 {
     return (T*)InternalHighest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::highest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::highest() const noexcept
 {
     return InternalHighest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::InternalHighest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::InternalHighest() const noexcept
 {
     const T* result = _root;
     if (result != nullptr)
@@ -61,92 +61,92 @@ inline const T* BinTreeAVL<T, TCompare>::InternalHighest() const noexcept
     return result;
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::begin() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::begin() noexcept
 {
     return iterator(this, lowest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::begin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::begin() const noexcept
 {
     return const_iterator(this, lowest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::cbegin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::cbegin() const noexcept
 {
     return const_iterator(this, lowest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::end() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::end() noexcept
 {
     return iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::end() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::end() const noexcept
 {
     return const_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::cend() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::cend() const noexcept
 {
     return const_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::reverse_iterator BinTreeAVL<T, TCompare>::rbegin() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::reverse_iterator BinTreeAVL<T, TCompare, TAugment>::rbegin() noexcept
 {
     return reverse_iterator(this, highest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_reverse_iterator BinTreeAVL<T, TCompare>::rbegin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_reverse_iterator BinTreeAVL<T, TCompare, TAugment>::rbegin() const noexcept
 {
     return const_reverse_iterator(this, highest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_reverse_iterator BinTreeAVL<T, TCompare>::crbegin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_reverse_iterator BinTreeAVL<T, TCompare, TAugment>::crbegin() const noexcept
 {
     return const_reverse_iterator(this, highest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::reverse_iterator BinTreeAVL<T, TCompare>::rend() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::reverse_iterator BinTreeAVL<T, TCompare, TAugment>::rend() noexcept
 {
     return reverse_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_reverse_iterator BinTreeAVL<T, TCompare>::rend() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_reverse_iterator BinTreeAVL<T, TCompare, TAugment>::rend() const noexcept
 {
     return const_reverse_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_reverse_iterator BinTreeAVL<T, TCompare>::crend() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_reverse_iterator BinTreeAVL<T, TCompare, TAugment>::crend() const noexcept
 {
     return const_reverse_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::find(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::find(const T& item) noexcept
 {
     return iterator(this, (T*)InternalFind(item));
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::find(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::find(const T& item) const noexcept
 {
     return const_iterator(this, InternalFind(item));
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::InternalFind(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::InternalFind(const T& item) const noexcept
 {
     // Perform the binary tree search from the root node
     const T* current = _root;
@@ -175,20 +175,20 @@ inline const T* BinTreeAVL<T, TCompare>::InternalFind(const T& item) const noexc
     return nullptr;
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::lower_bound(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::lower_bound(const T& item) noexcept
 {
     return iterator(this, (T*)InternalLowerBound(item));
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::lower_bound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::lower_bound(const T& item) const noexcept
 {
     return const_iterator(this, InternalLowerBound(item));
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::InternalLowerBound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::InternalLowerBound(const T& item) const noexcept
 {
     // Perform the binary tree search from the root node
     const T* current = _root;
@@ -219,20 +219,20 @@ inline const T* BinTreeAVL<T, TCompare>::InternalLowerBound(const T& item) const
     return previous;
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::upper_bound(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::upper_bound(const T& item) noexcept
 {
     return iterator(this, (T*)InternalUpperBound(item));
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::const_iterator BinTreeAVL<T, TCompare>::upper_bound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::upper_bound(const T& item) const noexcept
 {
     return const_iterator(this, InternalUpperBound(item));
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeAVL<T, TCompare>::InternalUpperBound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::InternalUpperBound(const T& item) const noexcept
 {
     // Perform the binary tree search from the root node
     const T* current = _root;
@@ -256,14 +256,106 @@ inline const T* BinTreeAVL<T, TCompare>::InternalUpperBound(const T& item) const
     return previous;
 }
 
-template <typename T, typename TCompare>
-inline std::pair<typename BinTreeAVL<T, TCompare>::iterator, bool> BinTreeAVL<T, TCompare>::insert(T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::select(size_t index) noexcept
+{
+    return iterator(this, (T*)InternalSelect(index));
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::const_iterator BinTreeAVL<T, TCompare, TAugment>::select(size_t index) const noexcept
+{
+    return const_iterator(this, InternalSelect(index));
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeAVL<T, TCompare, TAugment>::InternalSelect(size_t index) const noexcept
+{
+    // Perform the binary tree search from the root node
+    const T* current = _root;
+
+    while (current != nullptr)
+    {
+        size_t left = TAugment::count(current->left);
+
+        // Move to the left subtree
+        if (index < left)
+        {
+            current = current->left;
+            continue;
+        }
+
+        // Found result node
+        if (index == left)
+            return current;
+
+        // Move to the right subtree
+        index -= left + 1;
+        current = current->right;
+    }
+
+    // Nothing was found...
+    return nullptr;
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline size_t BinTreeAVL<T, TCompare, TAugment>::rank(const T& item) const noexcept
+{
+    size_t result = 0;
+
+    // Perform the binary tree search from the root node
+    const T* current = _root;
+
+    while (current != nullptr)
+    {
+        // Move to the right subtree and count the left subtree with the current node
+        if (compare(*current, item))
+        {
+            result += TAugment::count(current->left) + 1;
+            current = current->right;
+            continue;
+        }
+
+        // Move to the left subtree
+        current = current->left;
+    }
+
+    return result;
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline auto BinTreeAVL<T, TCompare, TAugment>::prefix_aggregate(const T& item) const noexcept
+{
+    auto result = TAugment::aggregate(nullptr);
+
+    // Perform the binary tree search from the root node
+    const T* current = _root;
+
+    while (current != nullptr)
+    {
+        // Move to the right subtree and aggregate the left subtree with the current node
+        if (compare(*current, item))
+        {
+            result = result + TAugment::aggregate(current->left) + TAugment::value(*current);
+            current = current->right;
+            continue;
+        }
+
+        // Move to the left subtree
+        current = current->left;
+    }
+
+    return result;
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline std::pair<typename BinTreeAVL<T, TCompare, TAugment>::iterator, bool> BinTreeAVL<T, TCompare, TAugment>::insert(T& item) noexcept
 {
     return insert(const_iterator(this, _root), item);
 }
 
-template <typename T, typename TCompare>
-inline std::pair<typename BinTreeAVL<T, TCompare>::iterator, bool> BinTreeAVL<T, TCompare>::insert(const const_iterator& position, T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline std::pair<typename BinTreeAVL<T, TCompare, TAugment>::iterator, bool> BinTreeAVL<T, TCompare, TAugment>::insert(const const_iterator& position, T& item) noexcept
 {
     // Perform the binary tree insert from the given node
     T* current = (T*)position.operator->();
@@ -313,6 +405,9 @@ inline std::pair<typename BinTreeAVL<T, TCompare>::iterator, bool> BinTreeAVL<T,
         _root = &item;
     ++_size;
 
+    // Update augmentation data of the inserted item ancestors
+    UpdateAugment(&item);
+
     // Balance the binary tree
     T* node = &item;
     node->balance = 0;
@@ -370,14 +465,14 @@ inline std::pair<typename BinTreeAVL<T, TCompare>::iterator, bool> BinTreeAVL<T,
     return std::make_pair(iterator(this, &item), true);
 }
 
-template <typename T, typename TCompare>
-inline T* BinTreeAVL<T, TCompare>::erase(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline T* BinTreeAVL<T, TCompare, TAugment>::erase(const T& item) noexcept
 {
     return erase(find(item)).operator->();
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::erase(const iterator& it) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeAVL<T, TCompare, TAugment>::iterator BinTreeAVL<T, TCompare, TAugment>::erase(const iterator& it) noexcept
 {
     T* result = ((iterator&)it).operator->();
     if (result == nullptr)
@@ -460,6 +555,9 @@ inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::erase
         }
     }
 
+    // Update augmentation data of the removed node ancestors
+    UpdateAugment(start);
+
     // Unlink the removed node
     if (start != nullptr)
         Unlink(start);
@@ -478,8 +576,8 @@ inline typename BinTreeAVL<T, TCompare>::iterator BinTreeAVL<T, TCompare>::erase
     return iterator(this, result);
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::RotateLeft(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::RotateLeft(T* node)
 {
     if (node->right == nullptr)
         return;
@@ -502,6 +600,10 @@ inline void BinTreeAVL<T, TCompare>::RotateLeft(T* node)
     if (node->right != nullptr)
         node->right->parent = node;
 
+    // Update augmentation data of rotated nodes
+    TAugment::update(*node);
+    TAugment::update(*current);
+
     if (current->balance == 0)
     {
         node->balance = 1;
@@ -514,8 +616,8 @@ inline void BinTreeAVL<T, TCompare>::RotateLeft(T* node)
     }
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::RotateRight(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::RotateRight(T* node)
 {
     if (node->left == nullptr)
         return;
@@ -538,6 +640,10 @@ inline void BinTreeAVL<T, TCompare>::RotateRight(T* node)
     if (node->left != nullptr)
         node->left->parent = node;
 
+    // Update augmentation data of rotated nodes
+    TAugment::update(*node);
+    TAugment::update(*current);
+
     if (current->balance == 0)
     {
         node->balance = -1;
@@ -550,8 +656,8 @@ inline void BinTreeAVL<T, TCompare>::RotateRight(T* node)
     }
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::RotateLeftLeft(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::RotateLeftLeft(T* node)
 {
     if ((node->left == nullptr) || (node->left->right == nullptr))
         return;
@@ -578,6 +684,11 @@ inline void BinTreeAVL<T, TCompare>::RotateLeftLeft(T* node)
     if (node->left != nullptr)
         node->left->parent = node;
 
+    // Update augmentation data of rotated nodes
+    TAugment::update(*current);
+    TAugment::update(*node);
+    TAugment::update(*next);
+
     switch (next->balance)
     {
         case -1:
@@ -596,8 +707,8 @@ inline void BinTreeAVL<T, TCompare>::RotateLeftLeft(T* node)
     next->balance = 0;
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::RotateRightRight(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::RotateRightRight(T* node)
 {
     if ((node->right == nullptr) || (node->right->left == nullptr))
         return;
@@ -624,6 +735,11 @@ inline void BinTreeAVL<T, TCompare>::RotateRightRight(T* node)
     if (current->left != nullptr)
         current->left->parent = current;
 
+    // Update augmentation data of rotated nodes
+    TAugment::update(*node);
+    TAugment::update(*current);
+    TAugment::update(*next);
+
     switch (next->balance)
     {
         case -1:
@@ -642,8 +758,8 @@ inline void BinTreeAVL<T, TCompare>::RotateRightRight(T* node)
     next->balance = 0;
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::Unlink(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::Unlink(T* node)
 {
     // Rule 1
     if ((node->balance == 0) && (node->left == nullptr))
@@ -742,8 +858,8 @@ inline void BinTreeAVL<T, TCompare>::Unlink(T* node)
     }
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::Swap(T*& node1, T*& node2)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::Swap(T*& node1, T*& node2)
 {
     T* first_parent = node1->parent;
     T* first_left = node1->left;
@@ -790,15 +906,26 @@ inline void BinTreeAVL<T, TCompare>::Swap(T*& node1, T*& node2)
     std::swap(node1, node2);
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::clear() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::UpdateAugment(T* node)
+{
+    if constexpr (!std::is_same<TAugment, BinTreeNoAugment>::value)
+    {
+        // Update augmentation data from the given node up to the root
+        for (; node != nullptr; node = node->parent)
+            TAugment::update(*node);
+    }
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::clear() noexcept
 {
     _size = 0;
     _root = nullptr;
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeAVL<T, TCompare>::swap(BinTreeAVL& bintree) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeAVL<T, TCompare, TAugment>::swap(BinTreeAVL& bintree) noexcept
 {
     using std::swap;
     swap(_compare, bintree._compare);
@@ -806,8 +933,8 @@ inline void BinTreeAVL<T, TCompare>::swap(BinTreeAVL& bintree) noexcept
     swap(_root, bintree._root);
 }
 
-template <typename T, typename TCompare>
-inline void swap(BinTreeAVL<T, TCompare>& bintree1, BinTreeAVL<T, TCompare>& bintree2) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline void swap(BinTreeAVL<T, TCompare, TAugment>& bintree1, BinTreeAVL<T, TCompare, TAugment>& bintree2) noexcept
 {
     bintree1.swap(bintree2);
 }
@@ -17,6 +17,11 @@ namespace CppCommon {
 /*!
     Not thread-safe.
 
+    Optional augmentation policy keeps extra data (subtree size, aggregates)
+    in nodes up to date through insert, erase and rotations. It allows to find
+    items by index, rank items and calculate range aggregates in O(log n) time
+    (see BinTreeOrderStatistic).
+
     <b>Overview</b>\n
     A red-black tree is a type of self-balancing binary search  tree,  a  data
     structure  used  in  computer  science,  typically   used   to   implement
@@ -197,7 +202,7 @@ namespace CppCommon {
     Red-black tree from Wikipedia, the free encyclopedia
     http://en.wikipedia.org/wiki/Red-black_tree
 */
-template <typename T, typename TCompare = std::less<T>>
+template <typename T, typename TCompare = std::less<T>, class TAugment = BinTreeNoAugment>
 class BinTreeRB
 {
 public:
@@ -210,10 +215,10 @@ public:
     typedef const value_type* const_pointer;
     typedef ptrdiff_t difference_type;
     typedef size_t size_type;
-    typedef BinTreeIterator<BinTreeRB<T, TCompare>, T> iterator;
-    typedef BinTreeConstIterator<BinTreeRB<T, TCompare>, T> const_iterator;
-    typedef BinTreeReverseIterator<BinTreeRB<T, TCompare>, T> reverse_iterator;
-    typedef BinTreeConstReverseIterator<BinTreeRB<T, TCompare>, T> const_reverse_iterator;
+    typedef BinTreeIterator<BinTreeRB<T, TCompare, TAugment>, T> iterator;
+    typedef BinTreeConstIterator<BinTreeRB<T, TCompare, TAugment>, T> const_iterator;
+    typedef BinTreeReverseIterator<BinTreeRB<T, TCompare, TAugment>, T> reverse_iterator;
+    typedef BinTreeConstReverseIterator<BinTreeRB<T, TCompare, TAugment>, T> const_reverse_iterator;
 
     //! Red-Black binary tree node
     struct Node
@@ -291,6 +296,47 @@ public:
     iterator upper_bound(const T& item) noexcept;
     const_iterator upper_bound(const T& item) const noexcept;
 
+    //! Find the iterator which points to the item with the given index in the binary tree or return end iterator
+    /*!
+        Requires order statistic augmentation (see BinTreeOrderStatistic).
+        Complexity is O(log n).
+
+        \param index - Zero-based index of the item in the binary tree order
+        \return Iterator to the found item or end iterator
+    */
+    iterator select(size_t index) noexcept;
+    const_iterator select(size_t index) const noexcept;
+    //! Get the count of items that less than the given item in the binary tree
+    /*!
+        Requires order statistic augmentation (see BinTreeOrderStatistic).
+        Complexity is O(log n).
+
+        \param item - Item to rank
+        \return Count of items that less than the given item
+    */
+    size_t rank(const T& item) const noexcept;
+
+    //! Get the aggregate value of all items that less than the given item in the binary tree
+    /*!
+        Requires augmentation policy with value() and aggregate() methods
+        (see BinTreeOrderStatistic). Complexity is O(log n).
+
+        \param item - Upper bound item (not included)
+        \return Aggregate value of items that less than the given item
+    */
+    auto prefix_aggregate(const T& item) const noexcept;
+    //! Get the aggregate value of items in the range [first, last) of the binary tree
+    /*!
+        Aggregate value type must support subtraction, because range aggregate
+        is calculated as a difference of two prefix aggregates (e.g. sums).
+        Complexity is O(log n).
+
+        \param first - Lower bound item (included)
+        \param last - Upper bound item (not included)
+        \return Aggregate value of items in the given range
+    */
+    auto range_aggregate(const T& first, const T& last) const noexcept { return prefix_aggregate(last) - prefix_aggregate(first); }
+
     //! Insert a new item into the binary tree
     /*!
         \param item - Item to insert
@@ -323,8 +369,8 @@ public:
 
     //! Swap two instances
     void swap(BinTreeRB& bintree) noexcept;
-    template <typename U, typename UCompare>
-    friend void swap(BinTreeRB<U, UCompare>& bintree1, BinTreeRB<U, UCompare>& bintree2) noexcept;
+    template <typename U, typename UCompare, class UAugment>
+    friend void swap(BinTreeRB<U, UCompare, UAugment>& bintree1, BinTreeRB<U, UCompare, UAugment>& bintree2) noexcept;
 
 private:
     TCompare _compare;  // Binary tree compare
@@ -336,11 +382,13 @@ private:
     const T* InternalFind(const T& item) const noexcept;
     const T* InternalLowerBound(const T& item) const noexcept;
     const T* InternalUpperBound(const T& item) const noexcept;
+    const T* InternalSelect(size_t index) const noexcept;
 
     void RotateLeft(T* node);
     void RotateRight(T* node);
     void Unlink(T* node, T* parent);
     static void Swap(T*& node1, T*& node2);
+    static void UpdateAugment(T* node);
 };
 
 } // namespace CppCommon
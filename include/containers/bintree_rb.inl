@@ -8,29 +8,29 @@
 
 namespace CppCommon {
 
-template <typename T, typename TCompare>
+template <typename T, typename TCompare, class TAugment>
 template <class InputIterator>
-inline BinTreeRB<T, TCompare>::BinTreeRB(InputIterator first, InputIterator last, const TCompare& compare) noexcept
+inline BinTreeRB<T, TCompare, TAugment>::BinTreeRB(InputIterator first, InputIterator last, const TCompare& compare) noexcept
     : _compare(compare)
 {
     for (auto it = first; it != last; ++it)
         insert(*it);
 }
 
-template <typename T, typename TCompare>
-inline T* BinTreeRB<T, TCompare>::lowest() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline T* BinTreeRB<T, TCompare, TAugment>::lowest() noexcept
 {
     return (T*)InternalLowest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::lowest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::lowest() const noexcept
 {
     return InternalLowest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::InternalLowest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::InternalLowest() const noexcept
 {
     const T* result = _root;
     if (result != nullptr)
@@ -39,20 +39,20 @@ inline const T* BinTreeRB<T, TCompare>::InternalLowest() const noexcept
     return result;
 }
 
-template <typename T, typename TCompare>
-inline T* BinTreeRB<T, TCompare>::highest() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline T* BinTreeRB<T, TCompare, TAugment>::highest() noexcept
 {
     return (T*)InternalHighest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::highest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::highest() const noexcept
 {
     return InternalHighest();
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::InternalHighest() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::InternalHighest() const noexcept
 {
     const T* result = _root;
     if (result != nullptr)
@@ -61,92 +61,92 @@ inline const T* BinTreeRB<T, TCompare>::InternalHighest() const noexcept
     return result;
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::begin() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::begin() noexcept
 {
     return iterator(this, lowest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::begin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::begin() const noexcept
 {
     return const_iterator(this, lowest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::cbegin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::cbegin() const noexcept
 {
     return const_iterator(this, lowest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::end() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::end() noexcept
 {
     return iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::end() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::end() const noexcept
 {
     return const_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::cend() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::cend() const noexcept
 {
     return const_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::reverse_iterator BinTreeRB<T, TCompare>::rbegin() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::reverse_iterator BinTreeRB<T, TCompare, TAugment>::rbegin() noexcept
 {
     return reverse_iterator(this, highest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_reverse_iterator BinTreeRB<T, TCompare>::rbegin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_reverse_iterator BinTreeRB<T, TCompare, TAugment>::rbegin() const noexcept
 {
     return const_reverse_iterator(this, highest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_reverse_iterator BinTreeRB<T, TCompare>::crbegin() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_reverse_iterator BinTreeRB<T, TCompare, TAugment>::crbegin() const noexcept
 {
     return const_reverse_iterator(this, highest());
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::reverse_iterator BinTreeRB<T, TCompare>::rend() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::reverse_iterator BinTreeRB<T, TCompare, TAugment>::rend() noexcept
 {
     return reverse_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_reverse_iterator BinTreeRB<T, TCompare>::rend() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_reverse_iterator BinTreeRB<T, TCompare, TAugment>::rend() const noexcept
 {
     return const_reverse_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_reverse_iterator BinTreeRB<T, TCompare>::crend() const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_reverse_iterator BinTreeRB<T, TCompare, TAugment>::crend() const noexcept
 {
     return const_reverse_iterator(this, nullptr);
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::find(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::find(const T& item) noexcept
 {
     return iterator(this, (T*)InternalFind(item));
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::find(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::find(const T& item) const noexcept
 {
     return const_iterator(this, InternalFind(item));
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::InternalFind(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::InternalFind(const T& item) const noexcept
 {
     // Perform the binary tree search from the root node
     const T* current = _root;
@@ -175,20 +175,20 @@ inline const T* BinTreeRB<T, TCompare>::InternalFind(const T& item) const noexce
     return nullptr;
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::lower_bound(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::lower_bound(const T& item) noexcept
 {
     return iterator(this, (T*)InternalLowerBound(item));
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::lower_bound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::lower_bound(const T& item) const noexcept
 {
     return const_iterator(this, InternalLowerBound(item));
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::InternalLowerBound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::InternalLowerBound(const T& item) const noexcept
 {
     // Perform the binary tree search from the root node
     const T* current = _root;
@@ -219,20 +219,20 @@ inline const T* BinTreeRB<T, TCompare>::InternalLowerBound(const T& item) const
     return previous;
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::upper_bound(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::upper_bound(const T& item) noexcept
 {
     return iterator(this, (T*)InternalUpperBound(item));
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::const_iterator BinTreeRB<T, TCompare>::upper_bound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::upper_bound(const T& item) const noexcept
 {
     return const_iterator(this, InternalUpperBound(item));
 }
 
-template <typename T, typename TCompare>
-inline const T* BinTreeRB<T, TCompare>::InternalUpperBound(const T& item) const noexcept
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::InternalUpperBound(const T& item) const noexcept
 {
     // Perform the binary tree search from the root node
     const T* current = _root;
@@ -256,14 +256,106 @@ inline const T* BinTreeRB<T, TCompare>::InternalUpperBound(const T& item) const
     return previous;
 }
 
-template <typename T, typename TCompare>
-inline std::pair<typename BinTreeRB<T, TCompare>::iterator, bool> BinTreeRB<T, TCompare>::insert(T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::select(size_t index) noexcept
+{
+    return iterator(this, (T*)InternalSelect(index));
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::const_iterator BinTreeRB<T, TCompare, TAugment>::select(size_t index) const noexcept
+{
+    return const_iterator(this, InternalSelect(index));
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline const T* BinTreeRB<T, TCompare, TAugment>::InternalSelect(size_t index) const noexcept
+{
+    // Perform the binary tree search from the root node
+    const T* current = _root;
+
+    while (current != nullptr)
+    {
+        size_t left = TAugment::count(current->left);
+
+        // Move to the left subtree
+        if (index < left)
+        {
+            current = current->left;
+            continue;
+        }
+
+        // Found result node
+        if (index == left)
+            return current;
+
+        // Move to the right subtree
+        index -= left + 1;
+        current = current->right;
+    }
+
+    // Nothing was found...
+    return nullptr;
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline size_t BinTreeRB<T, TCompare, TAugment>::rank(const T& item) const noexcept
+{
+    size_t result = 0;
+
+    // Perform the binary tree search from the root node
+    const T* current = _root;
+
+    while (current != nullptr)
+    {
+        // Move to the right subtree and count the left subtree with the current node
+        if (compare(*current, item))
+        {
+            result += TAugment::count(current->left) + 1;
+            current = current->right;
+            continue;
+        }
+
+        // Move to the left subtree
+        current = current->left;
+    }
+
+    return result;
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline auto BinTreeRB<T, TCompare, TAugment>::prefix_aggregate(const T& item) const noexcept
+{
+    auto result = TAugment::aggregate(nullptr);
+
+    // Perform the binary tree search from the root node
+    const T* current = _root;
+
+    while (current != nullptr)
+    {
+        // Move to the right subtree and aggregate the left subtree with the current node
+        if (compare(*current, item))
+        {
+            result = result + TAugment::aggregate(current->left) + TAugment::value(*current);
+            current = current->right;
+            continue;
+        }
+
+        // Move to the left subtree
+        current = current->left;
+    }
+
+    return result;
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline std::pair<typename BinTreeRB<T, TCompare, TAugment>::iterator, bool> BinTreeRB<T, TCompare, TAugment>::insert(T& item) noexcept
 {
     return insert(const_iterator(this, _root), item);
 }
 
-template <typename T, typename TCompare>
-inline std::pair<typename BinTreeRB<T, TCompare>::iterator, bool> BinTreeRB<T, TCompare>::insert(const const_iterator& position, T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline std::pair<typename BinTreeRB<T, TCompare, TAugment>::iterator, bool> BinTreeRB<T, TCompare, TAugment>::insert(const const_iterator& position, T& item) noexcept
 {
     // Perform the binary tree insert from the given node
     T* current = (T*)position.operator->();
@@ -313,6 +405,9 @@ inline std::pair<typename BinTreeRB<T, TCompare>::iterator, bool> BinTreeRB<T, T
         _root = &item;
     ++_size;
 
+    // Update augmentation data of the inserted item ancestors
+    UpdateAugment(&item);
+
     // Balance the binary tree
     T* node = &item;
     // Set red color for new red-black balanced binary tree node
@@ -381,14 +476,14 @@ inline std::pair<typename BinTreeRB<T, TCompare>::iterator, bool> BinTreeRB<T, T
     return std::make_pair(iterator(this, &item), true);
 }
 
-template <typename T, typename TCompare>
-inline T* BinTreeRB<T, TCompare>::erase(const T& item) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline T* BinTreeRB<T, TCompare, TAugment>::erase(const T& item) noexcept
 {
     return erase(find(item)).operator->();
 }
 
-template <typename T, typename TCompare>
-inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::erase(const iterator& it) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline typename BinTreeRB<T, TCompare, TAugment>::iterator BinTreeRB<T, TCompare, TAugment>::erase(const iterator& it) noexcept
 {
     T* result = ((iterator&)it).operator->();
     if (result == nullptr)
@@ -438,6 +533,9 @@ inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::erase(c
     else
         _root = x;
 
+    // Update augmentation data of the removed node ancestors
+    UpdateAugment(y->parent);
+
     // Unlink given node
     if (!y->rb)
         Unlink(x, y->parent);
@@ -449,8 +547,8 @@ inline typename BinTreeRB<T, TCompare>::iterator BinTreeRB<T, TCompare>::erase(c
     return iterator(this, result);
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeRB<T, TCompare>::RotateLeft(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::RotateLeft(T* node)
 {
     T* current = node->right;
 
@@ -474,10 +572,14 @@ inline void BinTreeRB<T, TCompare>::RotateLeft(T* node)
     // Link node and current
     current->left = node;
     node->parent = current;
+
+    // Update augmentation data of rotated nodes
+    TAugment::update(*node);
+    TAugment::update(*current);
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeRB<T, TCompare>::RotateRight(T* node)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::RotateRight(T* node)
 {
     T* current = node->left;
 
@@ -501,10 +603,14 @@ inline void BinTreeRB<T, TCompare>::RotateRight(T* node)
     // Link node and current
     current->right = node;
     node->parent = current;
+
+    // Update augmentation data of rotated nodes
+    TAugment::update(*node);
+    TAugment::update(*current);
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeRB<T, TCompare>::Unlink(T* node, T* parent)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::Unlink(T* node, T* parent)
 {
     T* w;
 
@@ -596,8 +702,8 @@ inline void BinTreeRB<T, TCompare>::Unlink(T* node, T* parent)
         node->rb = false;
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeRB<T, TCompare>::Swap(T*& node1, T*& node2)
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::Swap(T*& node1, T*& node2)
 {
     T* first_parent = node1->parent;
     T* first_left = node1->left;
@@ -638,21 +744,32 @@ inline void BinTreeRB<T, TCompare>::Swap(T*& node1, T*& node2)
     std::swap(node1->parent, node2->parent);
     std::swap(node1->left, node2->left);
     std::swap(node1->right, node2->right);
-    std::swap(node1->balance, node2->balance);
+    std::swap(node1->rb, node2->rb);
 
     // Swap nodes
     std::swap(node1, node2);
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeRB<T, TCompare>::clear() noexcept
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::UpdateAugment(T* node)
+{
+    if constexpr (!std::is_same<TAugment, BinTreeNoAugment>::value)
+    {
+        // Update augmentation data from the given node up to the root
+        for (; node != nullptr; node = node->parent)
+            TAugment::update(*node);
+    }
+}
+
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::clear() noexcept
 {
     _size = 0;
     _root = nullptr;
 }
 
-template <typename T, typename TCompare>
-inline void BinTreeRB<T, TCompare>::swap(BinTreeRB& bintree) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline void BinTreeRB<T, TCompare, TAugment>::swap(BinTreeRB& bintree) noexcept
 {
     using std::swap;
     swap(_compare, bintree._compare);
@@ -660,8 +777,8 @@ inline void BinTreeRB<T, TCompare>::swap(BinTreeRB& bintree) noexcept
     swap(_root, bintree._root);
 }
 
-template <typename T, typename TCompare>
-inline void swap(BinTreeRB<T, TCompare>& bintree1, BinTreeRB<T, TCompare>& bintree2) noexcept
+template <typename T, typename TCompare, class TAugment>
+inline void swap(BinTreeRB<T, TCompare, TAugment>& bintree1, BinTreeRB<T, TCompare, TAugment>& bintree2) noexcept
 {
     bintree1.swap(bintree2);
 }
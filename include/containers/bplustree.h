@@ -0,0 +1,469 @@
+/*!
+    \file bplustree.h
+    \brief B+ tree container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_BPLUSTREE_H
+#define CPPCOMMON_CONTAINERS_BPLUSTREE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class BPlusTreeIterator;
+template <class TContainer, typename T>
+class BPlusTreeConstIterator;
+template <class TContainer, typename T>
+class BPlusTreeReverseIterator;
+template <class TContainer, typename T>
+class BPlusTreeConstReverseIterator;
+
+//! B+ tree container
+/*!
+    B+ tree is a cache-conscious ordered container. Unlike intrusive binary
+    trees with one node per item, B+ tree keeps many items in each node, so
+    a lookup touches only a few cache-line aligned nodes and in-order range
+    iteration walks over sequential items in the linked list of leaves.
+
+    Inner nodes contain separator items and pointers to children, leaf nodes
+    contain sorted items and links to neighbour leaves. All leaves are on the
+    same level, so the tree is always balanced. Node size is the template
+    parameter in bytes and should be a multiple of the cache line size.
+
+    Items must be default constructible and copy assignable. Modifications
+    invalidate all iterators.
+
+    Not thread-safe.
+
+    Times for various operations in terms of number of items in the tree n:
+    \li Lookup - O(log n)
+    \li Insertion -  O(log n)
+    \li Removal -  O(log n)
+    \li Bulk load from sorted items - O(n)
+    \li In-order iteration over all elements - O(n)
+
+    <b>Taken from:</b>\n
+    B+ tree from Wikipedia, the free encyclopedia
+    https://en.wikipedia.org/wiki/B%2B_tree
+*/
+template <typename T, typename TCompare = std::less<T>, size_t NodeSize = 256>
+class BPlusTree
+{
+    friend class BPlusTreeIterator<BPlusTree<T, TCompare, NodeSize>, T>;
+    friend class BPlusTreeConstIterator<BPlusTree<T, TCompare, NodeSize>, T>;
+    friend class BPlusTreeReverseIterator<BPlusTree<T, TCompare, NodeSize>, T>;
+    friend class BPlusTreeConstReverseIterator<BPlusTree<T, TCompare, NodeSize>, T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef TCompare value_compare;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef BPlusTreeIterator<BPlusTree<T, TCompare, NodeSize>, T> iterator;
+    typedef BPlusTreeConstIterator<BPlusTree<T, TCompare, NodeSize>, T> const_iterator;
+    typedef BPlusTreeReverseIterator<BPlusTree<T, TCompare, NodeSize>, T> reverse_iterator;
+    typedef BPlusTreeConstReverseIterator<BPlusTree<T, TCompare, NodeSize>, T> const_reverse_iterator;
+
+    //! Count of items in the leaf node
+    static constexpr size_t LEAF_CAPACITY = std::max<size_t>(4, (NodeSize - 4 * sizeof(void*)) / sizeof(T));
+    //! Count of separator items in the inner node
+    static constexpr size_t INNER_CAPACITY = std::max<size_t>(4, (NodeSize - 3 * sizeof(void*)) / (sizeof(T) + sizeof(void*)));
+
+    explicit BPlusTree(const TCompare& compare = TCompare()) noexcept : _compare(compare), _size(0), _root(nullptr), _first(nullptr), _last(nullptr) {}
+    template <class InputIterator>
+    BPlusTree(InputIterator first, InputIterator last, const TCompare& compare = TCompare());
+    BPlusTree(const BPlusTree& bplustree);
+    BPlusTree(BPlusTree&& bplustree) noexcept;
+    ~BPlusTree() { clear(); }
+
+    BPlusTree& operator=(const BPlusTree& bplustree);
+    BPlusTree& operator=(BPlusTree&& bplustree) noexcept;
+
+    //! Check if the B+ tree is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the B+ tree empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the B+ tree size
+    size_t size() const noexcept { return _size; }
+    //! Get the B+ tree height (0 for the empty tree)
+    size_t height() const noexcept;
+
+    //! Get the lowest B+ tree item
+    T* lowest() noexcept { return (_first != nullptr) ? &_first->items[0] : nullptr; }
+    const T* lowest() const noexcept { return (_first != nullptr) ? &_first->items[0] : nullptr; }
+    //! Get the highest B+ tree item
+    T* highest() noexcept { return (_last != nullptr) ? &_last->items[_last->count - 1] : nullptr; }
+    const T* highest() const noexcept { return (_last != nullptr) ? &_last->items[_last->count - 1] : nullptr; }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return _compare(item1, item2); }
+
+    //! Get the begin B+ tree iterator
+    iterator begin() noexcept { return iterator(this, _first, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, _first, 0); }
+    const_iterator cbegin() const noexcept { return const_iterator(this, _first, 0); }
+    //! Get the end B+ tree iterator
+    iterator end() noexcept { return iterator(this, nullptr, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, nullptr, 0); }
+    const_iterator cend() const noexcept { return const_iterator(this, nullptr, 0); }
+
+    //! Get the reverse begin B+ tree iterator
+    reverse_iterator rbegin() noexcept { return reverse_iterator(this, _last, (_last != nullptr) ? (_last->count - 1) : 0); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this, _last, (_last != nullptr) ? (_last->count - 1) : 0); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    //! Get the reverse end B+ tree iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(this, nullptr, 0); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this, nullptr, 0); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //! Find the iterator which points to the equal item in the B+ tree or return end iterator
+    iterator find(const T& item) noexcept;
+    const_iterator find(const T& item) const noexcept;
+
+    //! Find the iterator which points to the first item that not less than the given item in the B+ tree or return end iterator
+    iterator lower_bound(const T& item) noexcept;
+    const_iterator lower_bound(const T& item) const noexcept;
+    //! Find the iterator which points to the first item that greater than the given item in the B+ tree or return end iterator
+    iterator upper_bound(const T& item) noexcept;
+    const_iterator upper_bound(const T& item) const noexcept;
+
+    //! Insert a new item into the B+ tree
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted item and success flag
+    */
+    std::pair<iterator, bool> insert(const T& item);
+
+    //! Load sorted unique items into the B+ tree
+    /*!
+        Replaces the content of the B+ tree with sorted unique items in O(n).
+        Nodes are filled evenly, so the built tree has the minimal height.
+
+        \param first - The first iterator of sorted items
+        \param last - The last iterator of sorted items
+    */
+    template <class InputIterator>
+    void load(InputIterator first, InputIterator last);
+
+    //! Erase the given item from the B+ tree
+    /*!
+        \param item - Item to erase
+        \return Number of erased items (0 or 1 for the B+ tree)
+    */
+    size_t erase(const T& item);
+    //! Erase the given item from the B+ tree
+    /*!
+        \param it - Iterator to the erased item
+        \return Iterator to the next item
+    */
+    iterator erase(const const_iterator& it);
+
+    //! Clear the B+ tree
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(BPlusTree& bplustree) noexcept;
+    template <typename U, typename UCompare, size_t USize>
+    friend void swap(BPlusTree<U, UCompare, USize>& bplustree1, BPlusTree<U, UCompare, USize>& bplustree2) noexcept;
+
+private:
+    static constexpr size_t LEAF_MIN = LEAF_CAPACITY / 2;
+    static constexpr size_t INNER_MIN = INNER_CAPACITY / 2;
+
+    struct alignas(64) Node
+    {
+        bool leaf;      // Leaf node flag
+        size_t count;   // Count of items (leaf) or separators (inner)
+
+        explicit Node(bool is_leaf) noexcept : leaf(is_leaf), count(0) {}
+    };
+
+    struct Leaf : public Node
+    {
+        Leaf* prev;                 // Previous leaf node
+        Leaf* next;                 // Next leaf node
+        T items[LEAF_CAPACITY];     // Sorted leaf items
+
+        Leaf() : Node(true), prev(nullptr), next(nullptr) {}
+    };
+
+    struct Inner : public Node
+    {
+        T keys[INNER_CAPACITY];                 // Sorted separator items
+        Node* children[INNER_CAPACITY + 1];     // Children nodes
+
+        Inner() : Node(false) {}
+    };
+
+    TCompare _compare;  // B+ tree item comparator
+    size_t _size;       // B+ tree size
+    Node* _root;        // B+ tree root node
+    Leaf* _first;       // B+ tree first leaf node
+    Leaf* _last;        // B+ tree last leaf node
+
+    std::pair<const Leaf*, size_t> InternalLowerBound(const T& item) const noexcept;
+    std::pair<const Leaf*, size_t> InternalUpperBound(const T& item) const noexcept;
+    bool InternalInsert(Node* node, const T& item, T& key, Node*& split, Leaf*& leaf, size_t& index);
+    bool InternalErase(Node* node, const T& item);
+    void InternalRebalance(Inner* parent, size_t index);
+    void InternalRemoveChild(Inner* parent, size_t index);
+    void InternalDestroy(Node* node) noexcept;
+};
+
+//! B+ tree iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BPlusTreeIterator
+{
+    friend BPlusTreeConstIterator<TContainer, T>;
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BPlusTreeIterator() noexcept : _container(nullptr), _leaf(nullptr), _index(0) {}
+    explicit BPlusTreeIterator(TContainer* container, typename TContainer::Leaf* leaf, size_t index) noexcept : _container(container), _leaf(leaf), _index(index) {}
+    BPlusTreeIterator(const BPlusTreeIterator& it) noexcept = default;
+    BPlusTreeIterator(BPlusTreeIterator&& it) noexcept = default;
+    ~BPlusTreeIterator() noexcept = default;
+
+    BPlusTreeIterator& operator=(const BPlusTreeIterator& it) noexcept = default;
+    BPlusTreeIterator& operator=(BPlusTreeIterator&& it) noexcept = default;
+
+    friend bool operator==(const BPlusTreeIterator& it1, const BPlusTreeIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._leaf == it2._leaf) && (it1._index == it2._index); }
+    friend bool operator!=(const BPlusTreeIterator& it1, const BPlusTreeIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BPlusTreeIterator& operator++() noexcept;
+    BPlusTreeIterator operator++(int) noexcept;
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_leaf != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BPlusTreeIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BPlusTreeIterator<UContainer, U>& it1, BPlusTreeIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    typename TContainer::Leaf* _leaf;
+    size_t _index;
+};
+
+//! B+ tree constant iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BPlusTreeConstIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BPlusTreeConstIterator() noexcept : _container(nullptr), _leaf(nullptr), _index(0) {}
+    explicit BPlusTreeConstIterator(const TContainer* container, const typename TContainer::Leaf* leaf, size_t index) noexcept : _container(container), _leaf(leaf), _index(index) {}
+    BPlusTreeConstIterator(const BPlusTreeIterator<TContainer, T>& it) noexcept : _container(it._container), _leaf(it._leaf), _index(it._index) {}
+    BPlusTreeConstIterator(const BPlusTreeConstIterator& it) noexcept = default;
+    BPlusTreeConstIterator(BPlusTreeConstIterator&& it) noexcept = default;
+    ~BPlusTreeConstIterator() noexcept = default;
+
+    BPlusTreeConstIterator& operator=(const BPlusTreeIterator<TContainer, T>& it) noexcept
+    { _container = it._container; _leaf = it._leaf; _index = it._index; return *this; }
+    BPlusTreeConstIterator& operator=(const BPlusTreeConstIterator& it) noexcept = default;
+    BPlusTreeConstIterator& operator=(BPlusTreeConstIterator&& it) noexcept = default;
+
+    friend bool operator==(const BPlusTreeConstIterator& it1, const BPlusTreeConstIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._leaf == it2._leaf) && (it1._index == it2._index); }
+    friend bool operator!=(const BPlusTreeConstIterator& it1, const BPlusTreeConstIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BPlusTreeConstIterator& operator++() noexcept;
+    BPlusTreeConstIterator operator++(int) noexcept;
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_leaf != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BPlusTreeConstIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BPlusTreeConstIterator<UContainer, U>& it1, BPlusTreeConstIterator<UContainer, U>& it2) noexcept;
+
+private:
+    const TContainer* _container;
+    const typename TContainer::Leaf* _leaf;
+    size_t _index;
+};
+
+//! B+ tree reverse iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BPlusTreeReverseIterator
+{
+    friend BPlusTreeConstReverseIterator<TContainer, T>;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BPlusTreeReverseIterator() noexcept : _container(nullptr), _leaf(nullptr), _index(0) {}
+    explicit BPlusTreeReverseIterator(TContainer* container, typename TContainer::Leaf* leaf, size_t index) noexcept : _container(container), _leaf(leaf), _index(index) {}
+    BPlusTreeReverseIterator(const BPlusTreeReverseIterator& it) noexcept = default;
+    BPlusTreeReverseIterator(BPlusTreeReverseIterator&& it) noexcept = default;
+    ~BPlusTreeReverseIterator() noexcept = default;
+
+    BPlusTreeReverseIterator& operator=(const BPlusTreeReverseIterator& it) noexcept = default;
+    BPlusTreeReverseIterator& operator=(BPlusTreeReverseIterator&& it) noexcept = default;
+
+    friend bool operator==(const BPlusTreeReverseIterator& it1, const BPlusTreeReverseIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._leaf == it2._leaf) && (it1._index == it2._index); }
+    friend bool operator!=(const BPlusTreeReverseIterator& it1, const BPlusTreeReverseIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BPlusTreeReverseIterator& operator++() noexcept;
+    BPlusTreeReverseIterator operator++(int) noexcept;
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_leaf != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BPlusTreeReverseIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BPlusTreeReverseIterator<UContainer, U>& it1, BPlusTreeReverseIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    typename TContainer::Leaf* _leaf;
+    size_t _index;
+};
+
+//! B+ tree constant reverse iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class BPlusTreeConstReverseIterator
+{
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    BPlusTreeConstReverseIterator() noexcept : _container(nullptr), _leaf(nullptr), _index(0) {}
+    explicit BPlusTreeConstReverseIterator(const TContainer* container, const typename TContainer::Leaf* leaf, size_t index) noexcept : _container(container), _leaf(leaf), _index(index) {}
+    BPlusTreeConstReverseIterator(const BPlusTreeReverseIterator<TContainer, T>& it) noexcept : _container(it._container), _leaf(it._leaf), _index(it._index) {}
+    BPlusTreeConstReverseIterator(const BPlusTreeConstReverseIterator& it) noexcept = default;
+    BPlusTreeConstReverseIterator(BPlusTreeConstReverseIterator&& it) noexcept = default;
+    ~BPlusTreeConstReverseIterator() noexcept = default;
+
+    BPlusTreeConstReverseIterator& operator=(const BPlusTreeReverseIterator<TContainer, T>& it) noexcept
+    { _container = it._container; _leaf = it._leaf; _index = it._index; return *this; }
+    BPlusTreeConstReverseIterator& operator=(const BPlusTreeConstReverseIterator& it) noexcept = default;
+    BPlusTreeConstReverseIterator& operator=(BPlusTreeConstReverseIterator&& it) noexcept = default;
+
+    friend bool operator==(const BPlusTreeConstReverseIterator& it1, const BPlusTreeConstReverseIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._leaf == it2._leaf) && (it1._index == it2._index); }
+    friend bool operator!=(const BPlusTreeConstReverseIterator& it1, const BPlusTreeConstReverseIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    BPlusTreeConstReverseIterator& operator++() noexcept;
+    BPlusTreeConstReverseIterator operator++(int) noexcept;
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_leaf != nullptr); }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return (_container != nullptr) ? _container->compare(item1, item2) : false; }
+
+    //! Swap two instances
+    void swap(BPlusTreeConstReverseIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(BPlusTreeConstReverseIterator<UContainer, U>& it1, BPlusTreeConstReverseIterator<UContainer, U>& it2) noexcept;
+
+private:
+    const TContainer* _container;
+    const typename TContainer::Leaf* _leaf;
+    size_t _index;
+};
+
+/*! \example containers_bplustree.cpp B+ tree container example */
+
+} // namespace CppCommon
+
+#include "bplustree.inl"
+
+#endif // CPPCOMMON_CONTAINERS_BPLUSTREE_H
@@ -0,0 +1,796 @@
+/*!
+    \file bplustree.inl
+    \brief B+ tree container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TCompare, size_t NodeSize>
+template <class InputIterator>
+inline BPlusTree<T, TCompare, NodeSize>::BPlusTree(InputIterator first, InputIterator last, const TCompare& compare)
+    : BPlusTree(compare)
+{
+    for (auto it = first; it != last; ++it)
+        insert(*it);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline BPlusTree<T, TCompare, NodeSize>::BPlusTree(const BPlusTree& bplustree)
+    : BPlusTree(bplustree._compare)
+{
+    load(bplustree.begin(), bplustree.end());
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline BPlusTree<T, TCompare, NodeSize>::BPlusTree(BPlusTree&& bplustree) noexcept
+    : BPlusTree(bplustree._compare)
+{
+    swap(bplustree);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline BPlusTree<T, TCompare, NodeSize>& BPlusTree<T, TCompare, NodeSize>::operator=(const BPlusTree& bplustree)
+{
+    if (this != &bplustree)
+    {
+        _compare = bplustree._compare;
+        load(bplustree.begin(), bplustree.end());
+    }
+    return *this;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline BPlusTree<T, TCompare, NodeSize>& BPlusTree<T, TCompare, NodeSize>::operator=(BPlusTree&& bplustree) noexcept
+{
+    if (this != &bplustree)
+    {
+        clear();
+        swap(bplustree);
+    }
+    return *this;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline size_t BPlusTree<T, TCompare, NodeSize>::height() const noexcept
+{
+    size_t result = 0;
+    for (const Node* node = _root; node != nullptr; node = node->leaf ? nullptr : ((const Inner*)node)->children[0])
+        ++result;
+    return result;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::iterator BPlusTree<T, TCompare, NodeSize>::find(const T& item) noexcept
+{
+    auto result = InternalLowerBound(item);
+    if ((result.first == nullptr) || compare(item, result.first->items[result.second]))
+        return end();
+    return iterator(this, (Leaf*)result.first, result.second);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::const_iterator BPlusTree<T, TCompare, NodeSize>::find(const T& item) const noexcept
+{
+    auto result = InternalLowerBound(item);
+    if ((result.first == nullptr) || compare(item, result.first->items[result.second]))
+        return end();
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::iterator BPlusTree<T, TCompare, NodeSize>::lower_bound(const T& item) noexcept
+{
+    auto result = InternalLowerBound(item);
+    return iterator(this, (Leaf*)result.first, result.second);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::const_iterator BPlusTree<T, TCompare, NodeSize>::lower_bound(const T& item) const noexcept
+{
+    auto result = InternalLowerBound(item);
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::iterator BPlusTree<T, TCompare, NodeSize>::upper_bound(const T& item) noexcept
+{
+    auto result = InternalUpperBound(item);
+    return iterator(this, (Leaf*)result.first, result.second);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::const_iterator BPlusTree<T, TCompare, NodeSize>::upper_bound(const T& item) const noexcept
+{
+    auto result = InternalUpperBound(item);
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline std::pair<const typename BPlusTree<T, TCompare, NodeSize>::Leaf*, size_t> BPlusTree<T, TCompare, NodeSize>::InternalLowerBound(const T& item) const noexcept
+{
+    auto less = [this](const T& item1, const T& item2) { return compare(item1, item2); };
+
+    const Node* node = _root;
+    if (node == nullptr)
+        return std::make_pair(nullptr, 0);
+
+    // Descend to the leaf node (children on the right contain items not less than the separator)
+    while (!node->leaf)
+    {
+        const Inner* inner = (const Inner*)node;
+        node = inner->children[std::upper_bound(inner->keys, inner->keys + inner->count, item, less) - inner->keys];
+    }
+
+    // Find the lower bound in the leaf node or take the first item of the next leaf node
+    const Leaf* leaf = (const Leaf*)node;
+    size_t index = std::lower_bound(leaf->items, leaf->items + leaf->count, item, less) - leaf->items;
+    if (index < leaf->count)
+        return std::make_pair(leaf, index);
+    return std::make_pair(leaf->next, 0);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline std::pair<const typename BPlusTree<T, TCompare, NodeSize>::Leaf*, size_t> BPlusTree<T, TCompare, NodeSize>::InternalUpperBound(const T& item) const noexcept
+{
+    auto less = [this](const T& item1, const T& item2) { return compare(item1, item2); };
+
+    const Node* node = _root;
+    if (node == nullptr)
+        return std::make_pair(nullptr, 0);
+
+    // Descend to the leaf node (children on the right contain items not less than the separator)
+    while (!node->leaf)
+    {
+        const Inner* inner = (const Inner*)node;
+        node = inner->children[std::upper_bound(inner->keys, inner->keys + inner->count, item, less) - inner->keys];
+    }
+
+    // Find the upper bound in the leaf node or take the first item of the next leaf node
+    const Leaf* leaf = (const Leaf*)node;
+    size_t index = std::upper_bound(leaf->items, leaf->items + leaf->count, item, less) - leaf->items;
+    if (index < leaf->count)
+        return std::make_pair(leaf, index);
+    return std::make_pair(leaf->next, 0);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline std::pair<typename BPlusTree<T, TCompare, NodeSize>::iterator, bool> BPlusTree<T, TCompare, NodeSize>::insert(const T& item)
+{
+    // Insert the first leaf node into the empty B+ tree
+    if (_root == nullptr)
+    {
+        Leaf* leaf = new Leaf();
+        _root = _first = _last = leaf;
+    }
+
+    T key;
+    Node* split = nullptr;
+    Leaf* leaf = nullptr;
+    size_t index = 0;
+    bool inserted = InternalInsert(_root, item, key, split, leaf, index);
+
+    // Grow the B+ tree with a new root node
+    if (split != nullptr)
+    {
+        Inner* root = new Inner();
+        root->count = 1;
+        root->keys[0] = key;
+        root->children[0] = _root;
+        root->children[1] = split;
+        _root = root;
+    }
+
+    if (inserted)
+        ++_size;
+
+    return std::make_pair(iterator(this, leaf, index), inserted);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline bool BPlusTree<T, TCompare, NodeSize>::InternalInsert(Node* node, const T& item, T& key, Node*& split, Leaf*& leaf, size_t& index)
+{
+    auto less = [this](const T& item1, const T& item2) { return compare(item1, item2); };
+
+    if (node->leaf)
+    {
+        Leaf* current = (Leaf*)node;
+        size_t position = std::lower_bound(current->items, current->items + current->count, item, less) - current->items;
+
+        // Check for the duplicate item
+        if ((position < current->count) && !compare(item, current->items[position]))
+        {
+            leaf = current;
+            index = position;
+            return false;
+        }
+
+        // Split the full leaf node into two halves
+        if (current->count == LEAF_CAPACITY)
+        {
+            size_t middle = (LEAF_CAPACITY + 1) / 2;
+            Leaf* right = new Leaf();
+            std::move(current->items + middle, current->items + current->count, right->items);
+            right->count = current->count - middle;
+            current->count = middle;
+
+            // Link the new leaf node
+            right->prev = current;
+            right->next = current->next;
+            if (right->next != nullptr)
+                right->next->prev = right;
+            else
+                _last = right;
+            current->next = right;
+
+            if (position > middle)
+            {
+                current = right;
+                position -= middle;
+            }
+            split = right;
+        }
+
+        // Insert the item into the leaf node
+        std::move_backward(current->items + position, current->items + current->count, current->items + current->count + 1);
+        current->items[position] = item;
+        ++current->count;
+
+        if (split != nullptr)
+            key = ((Leaf*)split)->items[0];
+
+        leaf = current;
+        index = position;
+        return true;
+    }
+
+    Inner* current = (Inner*)node;
+    size_t position = std::upper_bound(current->keys, current->keys + current->count, item, less) - current->keys;
+
+    T child_key;
+    Node* child_split = nullptr;
+    bool inserted = InternalInsert(current->children[position], item, child_key, child_split, leaf, index);
+    if (child_split == nullptr)
+        return inserted;
+
+    // Split the full inner node and move its middle separator up
+    if (current->count == INNER_CAPACITY)
+    {
+        size_t middle = INNER_CAPACITY / 2;
+        Inner* right = new Inner();
+        key = current->keys[middle];
+        std::move(current->keys + middle + 1, current->keys + current->count, right->keys);
+        std::copy(current->children + middle + 1, current->children + current->count + 1, right->children);
+        right->count = current->count - middle - 1;
+        current->count = middle;
+
+        if (position > middle)
+        {
+            current = right;
+            position -= middle + 1;
+        }
+        split = right;
+    }
+
+    // Insert the split child node into the inner node
+    std::move_backward(current->keys + position, current->keys + current->count, current->keys + current->count + 1);
+    std::copy_backward(current->children + position + 1, current->children + current->count + 1, current->children + current->count + 2);
+    current->keys[position] = child_key;
+    current->children[position + 1] = child_split;
+    ++current->count;
+
+    return inserted;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+template <class InputIterator>
+inline void BPlusTree<T, TCompare, NodeSize>::load(InputIterator first, InputIterator last)
+{
+    clear();
+
+    size_t count = (size_t)std::distance(first, last);
+    if (count == 0)
+        return;
+
+    // Fill leaf nodes evenly with sorted items
+    std::vector<std::pair<Node*, T>> level;
+    size_t leaves = (count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+    level.reserve(leaves);
+    Leaf* previous = nullptr;
+    auto it = first;
+    for (size_t i = 0; i < leaves; ++i)
+    {
+        Leaf* leaf = new Leaf();
+        leaf->count = count / leaves + ((i < (count % leaves)) ? 1 : 0);
+        for (size_t j = 0; j < leaf->count; ++j, ++it)
+        {
+            leaf->items[j] = *it;
+            assert(((j == 0) || compare(leaf->items[j - 1], leaf->items[j])) && "Loaded items must be sorted and unique!");
+        }
+        assert(((previous == nullptr) || compare(previous->items[previous->count - 1], leaf->items[0])) && "Loaded items must be sorted and unique!");
+
+        // Link leaf nodes
+        leaf->prev = previous;
+        if (previous != nullptr)
+            previous->next = leaf;
+        else
+            _first = leaf;
+        previous = leaf;
+
+        level.emplace_back(leaf, leaf->items[0]);
+    }
+    _last = previous;
+    _size = count;
+
+    // Build inner levels from the bottom to the root
+    while (level.size() > 1)
+    {
+        size_t children = level.size();
+        size_t nodes = (children + INNER_CAPACITY) / (INNER_CAPACITY + 1);
+        std::vector<std::pair<Node*, T>> upper;
+        upper.reserve(nodes);
+
+        size_t k = 0;
+        for (size_t i = 0; i < nodes; ++i)
+        {
+            Inner* inner = new Inner();
+            size_t n = children / nodes + ((i < (children % nodes)) ? 1 : 0);
+            for (size_t j = 0; j < n; ++j, ++k)
+            {
+                inner->children[j] = level[k].first;
+                if (j > 0)
+                    inner->keys[j - 1] = level[k].second;
+            }
+            inner->count = n - 1;
+            upper.emplace_back(inner, level[k - n].second);
+        }
+
+        level.swap(upper);
+    }
+
+    _root = level[0].first;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline size_t BPlusTree<T, TCompare, NodeSize>::erase(const T& item)
+{
+    if ((_root == nullptr) || !InternalErase(_root, item))
+        return 0;
+
+    --_size;
+
+    // Shrink the B+ tree
+    if (_root->leaf)
+    {
+        if (_root->count == 0)
+        {
+            delete (Leaf*)_root;
+            _root = _first = _last = nullptr;
+        }
+    }
+    else if (_root->count == 0)
+    {
+        Inner* root = (Inner*)_root;
+        _root = root->children[0];
+        delete root;
+    }
+
+    return 1;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline typename BPlusTree<T, TCompare, NodeSize>::iterator BPlusTree<T, TCompare, NodeSize>::erase(const const_iterator& it)
+{
+    if (!it)
+        return end();
+
+    const_iterator next = it;
+    ++next;
+
+    // Remember the next item, because erase moves items between nodes
+    T item = *it;
+    if (!next)
+    {
+        erase(item);
+        return end();
+    }
+
+    T following = *next;
+    erase(item);
+    return lower_bound(following);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline bool BPlusTree<T, TCompare, NodeSize>::InternalErase(Node* node, const T& item)
+{
+    auto less = [this](const T& item1, const T& item2) { return compare(item1, item2); };
+
+    if (node->leaf)
+    {
+        Leaf* current = (Leaf*)node;
+        size_t position = std::lower_bound(current->items, current->items + current->count, item, less) - current->items;
+        if ((position == current->count) || compare(item, current->items[position]))
+            return false;
+
+        std::move(current->items + position + 1, current->items + current->count, current->items + position);
+        --current->count;
+        return true;
+    }
+
+    Inner* current = (Inner*)node;
+    size_t position = std::upper_bound(current->keys, current->keys + current->count, item, less) - current->keys;
+    if (!InternalErase(current->children[position], item))
+        return false;
+
+    // Rebalance the underflowed child node
+    Node* child = current->children[position];
+    if (child->count < (child->leaf ? LEAF_MIN : INNER_MIN))
+        InternalRebalance(current, position);
+
+    return true;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline void BPlusTree<T, TCompare, NodeSize>::InternalRebalance(Inner* parent, size_t index)
+{
+    size_t merge = (index > 0) ? (index - 1) : index;
+
+    if (parent->children[index]->leaf)
+    {
+        Leaf* current = (Leaf*)parent->children[index];
+
+        // Borrow the highest item from the left leaf node
+        if (index > 0)
+        {
+            Leaf* left = (Leaf*)parent->children[index - 1];
+            if (left->count > LEAF_MIN)
+            {
+                std::move_backward(current->items, current->items + current->count, current->items + current->count + 1);
+                current->items[0] = std::move(left->items[left->count - 1]);
+                --left->count;
+                ++current->count;
+                parent->keys[index - 1] = current->items[0];
+                return;
+            }
+        }
+
+        // Borrow the lowest item from the right leaf node
+        if (index < parent->count)
+        {
+            Leaf* right = (Leaf*)parent->children[index + 1];
+            if (right->count > LEAF_MIN)
+            {
+                current->items[current->count++] = std::move(right->items[0]);
+                std::move(right->items + 1, right->items + right->count, right->items);
+                --right->count;
+                parent->keys[index] = right->items[0];
+                return;
+            }
+        }
+
+        // Merge two neighbour leaf nodes
+        Leaf* left = (Leaf*)parent->children[merge];
+        Leaf* right = (Leaf*)parent->children[merge + 1];
+        std::move(right->items, right->items + right->count, left->items + left->count);
+        left->count += right->count;
+        left->next = right->next;
+        if (left->next != nullptr)
+            left->next->prev = left;
+        else
+            _last = left;
+        delete right;
+    }
+    else
+    {
+        Inner* current = (Inner*)parent->children[index];
+
+        // Rotate the highest child from the left inner node through the parent separator
+        if (index > 0)
+        {
+            Inner* left = (Inner*)parent->children[index - 1];
+            if (left->count > INNER_MIN)
+            {
+                std::move_backward(current->keys, current->keys + current->count, current->keys + current->count + 1);
+                std::copy_backward(current->children, current->children + current->count + 1, current->children + current->count + 2);
+                current->keys[0] = std::move(parent->keys[index - 1]);
+                current->children[0] = left->children[left->count];
+                parent->keys[index - 1] = std::move(left->keys[left->count - 1]);
+                --left->count;
+                ++current->count;
+                return;
+            }
+        }
+
+        // Rotate the lowest child from the right inner node through the parent separator
+        if (index < parent->count)
+        {
+            Inner* right = (Inner*)parent->children[index + 1];
+            if (right->count > INNER_MIN)
+            {
+                current->keys[current->count] = std::move(parent->keys[index]);
+                current->children[current->count + 1] = right->children[0];
+                ++current->count;
+                parent->keys[index] = std::move(right->keys[0]);
+                std::move(right->keys + 1, right->keys + right->count, right->keys);
+                std::copy(right->children + 1, right->children + right->count + 1, right->children);
+                --right->count;
+                return;
+            }
+        }
+
+        // Merge two neighbour inner nodes with the parent separator between them
+        Inner* left = (Inner*)parent->children[merge];
+        Inner* right = (Inner*)parent->children[merge + 1];
+        left->keys[left->count] = std::move(parent->keys[merge]);
+        std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+        std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+        left->count += right->count + 1;
+        delete right;
+    }
+
+    InternalRemoveChild(parent, merge);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline void BPlusTree<T, TCompare, NodeSize>::InternalRemoveChild(Inner* parent, size_t index)
+{
+    // Remove the separator and the right child after the merge
+    std::move(parent->keys + index + 1, parent->keys + parent->count, parent->keys + index);
+    std::copy(parent->children + index + 2, parent->children + parent->count + 1, parent->children + index + 1);
+    --parent->count;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline void BPlusTree<T, TCompare, NodeSize>::InternalDestroy(Node* node) noexcept
+{
+    if (node->leaf)
+    {
+        delete (Leaf*)node;
+        return;
+    }
+
+    Inner* inner = (Inner*)node;
+    for (size_t i = 0; i <= inner->count; ++i)
+        InternalDestroy(inner->children[i]);
+    delete inner;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline void BPlusTree<T, TCompare, NodeSize>::clear() noexcept
+{
+    if (_root != nullptr)
+        InternalDestroy(_root);
+    _size = 0;
+    _root = nullptr;
+    _first = nullptr;
+    _last = nullptr;
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline void BPlusTree<T, TCompare, NodeSize>::swap(BPlusTree& bplustree) noexcept
+{
+    using std::swap;
+    swap(_compare, bplustree._compare);
+    swap(_size, bplustree._size);
+    swap(_root, bplustree._root);
+    swap(_first, bplustree._first);
+    swap(_last, bplustree._last);
+}
+
+template <typename T, typename TCompare, size_t NodeSize>
+inline void swap(BPlusTree<T, TCompare, NodeSize>& bplustree1, BPlusTree<T, TCompare, NodeSize>& bplustree2) noexcept
+{
+    bplustree1.swap(bplustree2);
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeIterator<TContainer, T>& BPlusTreeIterator<TContainer, T>::operator++() noexcept
+{
+    if (_leaf != nullptr)
+    {
+        if (++_index >= _leaf->count)
+        {
+            _leaf = _leaf->next;
+            _index = 0;
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeIterator<TContainer, T> BPlusTreeIterator<TContainer, T>::operator++(int) noexcept
+{
+    BPlusTreeIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeIterator<TContainer, T>::reference BPlusTreeIterator<TContainer, T>::operator*() noexcept
+{
+    assert((_leaf != nullptr) && "Iterator must be valid!");
+
+    return _leaf->items[_index];
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeIterator<TContainer, T>::pointer BPlusTreeIterator<TContainer, T>::operator->() noexcept
+{
+    return (_leaf != nullptr) ? &_leaf->items[_index] : nullptr;
+}
+
+template <class TContainer, typename T>
+void BPlusTreeIterator<TContainer, T>::swap(BPlusTreeIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_leaf, it._leaf);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BPlusTreeIterator<TContainer, T>& it1, BPlusTreeIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeConstIterator<TContainer, T>& BPlusTreeConstIterator<TContainer, T>::operator++() noexcept
+{
+    if (_leaf != nullptr)
+    {
+        if (++_index >= _leaf->count)
+        {
+            _leaf = _leaf->next;
+            _index = 0;
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeConstIterator<TContainer, T> BPlusTreeConstIterator<TContainer, T>::operator++(int) noexcept
+{
+    BPlusTreeConstIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeConstIterator<TContainer, T>::const_reference BPlusTreeConstIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_leaf != nullptr) && "Iterator must be valid!");
+
+    return _leaf->items[_index];
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeConstIterator<TContainer, T>::const_pointer BPlusTreeConstIterator<TContainer, T>::operator->() const noexcept
+{
+    return (_leaf != nullptr) ? &_leaf->items[_index] : nullptr;
+}
+
+template <class TContainer, typename T>
+void BPlusTreeConstIterator<TContainer, T>::swap(BPlusTreeConstIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_leaf, it._leaf);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BPlusTreeConstIterator<TContainer, T>& it1, BPlusTreeConstIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeReverseIterator<TContainer, T>& BPlusTreeReverseIterator<TContainer, T>::operator++() noexcept
+{
+    if (_leaf != nullptr)
+    {
+        if (_index > 0)
+            --_index;
+        else
+        {
+            _leaf = _leaf->prev;
+            _index = (_leaf != nullptr) ? (_leaf->count - 1) : 0;
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeReverseIterator<TContainer, T> BPlusTreeReverseIterator<TContainer, T>::operator++(int) noexcept
+{
+    BPlusTreeReverseIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeReverseIterator<TContainer, T>::reference BPlusTreeReverseIterator<TContainer, T>::operator*() noexcept
+{
+    assert((_leaf != nullptr) && "Iterator must be valid!");
+
+    return _leaf->items[_index];
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeReverseIterator<TContainer, T>::pointer BPlusTreeReverseIterator<TContainer, T>::operator->() noexcept
+{
+    return (_leaf != nullptr) ? &_leaf->items[_index] : nullptr;
+}
+
+template <class TContainer, typename T>
+void BPlusTreeReverseIterator<TContainer, T>::swap(BPlusTreeReverseIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_leaf, it._leaf);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BPlusTreeReverseIterator<TContainer, T>& it1, BPlusTreeReverseIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeConstReverseIterator<TContainer, T>& BPlusTreeConstReverseIterator<TContainer, T>::operator++() noexcept
+{
+    if (_leaf != nullptr)
+    {
+        if (_index > 0)
+            --_index;
+        else
+        {
+            _leaf = _leaf->prev;
+            _index = (_leaf != nullptr) ? (_leaf->count - 1) : 0;
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline BPlusTreeConstReverseIterator<TContainer, T> BPlusTreeConstReverseIterator<TContainer, T>::operator++(int) noexcept
+{
+    BPlusTreeConstReverseIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeConstReverseIterator<TContainer, T>::const_reference BPlusTreeConstReverseIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_leaf != nullptr) && "Iterator must be valid!");
+
+    return _leaf->items[_index];
+}
+
+template <class TContainer, typename T>
+typename BPlusTreeConstReverseIterator<TContainer, T>::const_pointer BPlusTreeConstReverseIterator<TContainer, T>::operator->() const noexcept
+{
+    return (_leaf != nullptr) ? &_leaf->items[_index] : nullptr;
+}
+
+template <class TContainer, typename T>
+void BPlusTreeConstReverseIterator<TContainer, T>::swap(BPlusTreeConstReverseIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_leaf, it._leaf);
+    swap(_index, it._index);
+}
+
+template <class TContainer, typename T>
+void swap(BPlusTreeConstReverseIterator<TContainer, T>& it1, BPlusTreeConstReverseIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,244 @@
+/*!
+    \file compressed_sequence.h
+    \brief Compressed integer sequence container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_COMPRESSED_SEQUENCE_H
+#define CPPCOMMON_CONTAINERS_COMPRESSED_SEQUENCE_H
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+class CompressedSequenceIterator;
+
+//! Compressed integer sequence container
+/*!
+    Compressed sequence is an immutable non-decreasing sequence of 64-bit
+    unsigned integers (timestamps, identifiers, offsets) stored in blocks of
+    128 values. Each block keeps its first value in the skip index and
+    deltas between consecutive values bit packed with the minimal bit width
+    of the block (0..32 bits), so dense sequences take 1-2 bytes per value
+    instead of 8. Blocks with deltas wider than 32 bits are stored raw.
+
+    Deltas are packed in the vertical layout of four 32-bit lanes
+    (SIMD-BP128), so the block is unpacked with SSE4.1 shifts and masks four
+    values at a time and restored with SSE4.1/AVX2 prefix sums. The best
+    implementation is selected at runtime, the scalar implementation is used
+    on other CPUs.
+
+    lower_bound() searches the skip index with the binary search and decodes
+    only one block. Sequential scans with iterators or Decode() decode whole
+    blocks.
+
+    Compressed sequence is stored as a flat buffer (header, skip index and
+    packed words) in the native byte order, so it could be written into a
+    file, mapped into memory and opened with Open() without deserialization.
+
+    Not thread-safe.
+
+    <b>References</b>\n
+    \li Daniel Lemire, Leonid Boytsov. Decoding billions of integers per
+        second through vectorization. Software: Practice and Experience,
+        45(1):1-29, 2015.
+*/
+class CompressedSequence
+{
+    friend class CompressedSequenceIterator;
+
+public:
+    // Standard container type definitions
+    typedef uint64_t value_type;
+    typedef uint64_t reference;
+    typedef uint64_t const_reference;
+    typedef size_t size_type;
+    typedef CompressedSequenceIterator iterator;
+    typedef CompressedSequenceIterator const_iterator;
+
+    //! Count of values in the block
+    static const size_t BLOCK = 128;
+
+    //! Initialize the empty compressed sequence
+    CompressedSequence();
+    //! Initialize the compressed sequence with the given non-decreasing values
+    /*!
+        Throws std::invalid_argument exception if values are not sorted.
+
+        \param values - Non-decreasing values
+    */
+    CompressedSequence(std::initializer_list<uint64_t> values) : CompressedSequence(std::span<const uint64_t>(values.begin(), values.size())) {}
+    explicit CompressedSequence(std::span<const uint64_t> values);
+    CompressedSequence(const CompressedSequence& sequence);
+    CompressedSequence(CompressedSequence&& sequence) noexcept;
+    ~CompressedSequence() = default;
+
+    CompressedSequence& operator=(const CompressedSequence& sequence);
+    CompressedSequence& operator=(CompressedSequence&& sequence) noexcept;
+
+    //! Check if the compressed sequence is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the value with the given index
+    uint64_t operator[](size_t index) const noexcept;
+
+    //! Is the compressed sequence empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the compressed sequence size (count of values)
+    size_t size() const noexcept { return _size; }
+    //! Get the count of compressed sequence blocks
+    size_t blocks() const noexcept { return _blocks; }
+
+    //! Get the flat buffer of the compressed sequence
+    std::span<const uint8_t> data() const noexcept { return std::span<const uint8_t>(_data, _bytes); }
+    //! Is the compressed sequence opened over the external memory?
+    bool mapped() const noexcept { return _storage.empty(); }
+
+    //! Access to the value with the given index or throw std::out_of_range exception
+    uint64_t at(size_t index) const;
+    //! Get the first value of the non-empty compressed sequence
+    uint64_t front() const noexcept;
+    //! Get the last value of the non-empty compressed sequence
+    uint64_t back() const noexcept;
+
+    //! Get the begin compressed sequence iterator
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end compressed sequence iterator
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Find the index of the first value which is not less than the given value
+    /*!
+        \param value - Value to search
+        \return Index of the found value or size() if not found
+    */
+    size_t lower_bound(uint64_t value) const noexcept;
+    //! Find the index of the first value which is greater than the given value
+    /*!
+        \param value - Value to search
+        \return Index of the found value or size() if not found
+    */
+    size_t upper_bound(uint64_t value) const noexcept;
+    //! Is the compressed sequence contains the given value?
+    bool contains(uint64_t value) const noexcept;
+
+    //! Decode the block of values
+    /*!
+        \param block - Block index
+        \param output - Output buffer of BLOCK values
+        \return Count of decoded values
+    */
+    size_t Decode(size_t block, uint64_t* output) const noexcept;
+    //! Decode all values
+    std::vector<uint64_t> Decode() const;
+
+    //! Open the compressed sequence over the external flat buffer
+    /*!
+        The buffer is not copied and must be 8 bytes aligned and outlive the
+        compressed sequence. Throws std::invalid_argument exception if the
+        buffer is not valid.
+
+        \param buffer - Flat buffer of the compressed sequence (e.g. mapped file)
+        \return Compressed sequence over the given buffer
+    */
+    static CompressedSequence Open(std::span<const uint8_t> buffer);
+
+    //! Swap two instances
+    void swap(CompressedSequence& sequence) noexcept;
+    friend void swap(CompressedSequence& sequence1, CompressedSequence& sequence2) noexcept
+    { sequence1.swap(sequence2); }
+
+private:
+    // Skip index entry
+    struct Block
+    {
+        uint64_t first;     // First value of the block
+        uint32_t offset;    // Offset of the block in packed words
+        uint32_t bits;      // Bit width of deltas (0..32) or 64 for raw values
+    };
+
+    std::vector<uint64_t> _storage;
+    const uint8_t* _data;
+    size_t _bytes;
+    size_t _size;
+    size_t _blocks;
+    const Block* _index;
+    const uint32_t* _words;
+
+    CompressedSequence(const uint8_t* data, size_t bytes) noexcept { Attach(data, bytes); }
+
+    void Attach(const uint8_t* data, size_t bytes) noexcept;
+    size_t count(size_t block) const noexcept { return (block + 1 < _blocks) ? BLOCK : (_size - block * BLOCK); }
+};
+
+//! Compressed sequence iterator
+/*!
+    Iterator keeps the decoded block of values, so it is relatively heavy
+    to copy.
+
+    Not thread-safe.
+*/
+class CompressedSequenceIterator
+{
+    friend CompressedSequence;
+
+public:
+    // Standard iterator type definitions
+    typedef uint64_t value_type;
+    typedef uint64_t reference;
+    typedef const uint64_t* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    CompressedSequenceIterator() noexcept : _container(nullptr), _index(0), _block(0), _count(0) {}
+
+    friend bool operator==(const CompressedSequenceIterator& it1, const CompressedSequenceIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._index == it2._index); }
+    friend bool operator!=(const CompressedSequenceIterator& it1, const CompressedSequenceIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    CompressedSequenceIterator& operator++() noexcept
+    {
+        assert((_container != nullptr) && (_index < _container->size()) && "Iterator must be valid!");
+        // Decode the next block
+        if ((++_index == (_block * CompressedSequence::BLOCK + _count)) && (_index < _container->size()))
+            _count = _container->Decode(++_block, _values.data());
+        return *this;
+    }
+    CompressedSequenceIterator operator++(int) noexcept { CompressedSequenceIterator result(*this); operator++(); return result; }
+
+    uint64_t operator*() const noexcept
+    {
+        assert((_container != nullptr) && (_index < _container->size()) && "Iterator must be valid!");
+        return _values[_index - _block * CompressedSequence::BLOCK];
+    }
+
+    //! Get the index of the current value
+    size_t index() const noexcept { return _index; }
+
+private:
+    const CompressedSequence* _container;
+    size_t _index;
+    size_t _block;
+    size_t _count;
+    std::array<uint64_t, CompressedSequence::BLOCK> _values;
+
+    CompressedSequenceIterator(const CompressedSequence* container, size_t index) noexcept;
+};
+
+/*! \example containers_compressed_sequence.cpp Compressed integer sequence container example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CONTAINERS_COMPRESSED_SEQUENCE_H
@@ -0,0 +1,148 @@
+/*!
+    \file concurrent_hashmap.h
+    \brief Concurrent hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CONCURRENT_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_CONCURRENT_HASHMAP_H
+
+#include "containers/hashmap.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! Concurrent hash map container
+/*!
+    Concurrent hash map is a lock-striped version of the open address hash map.
+    Keys are routed to stripes by the mixed key hash, each stripe is a separate
+    hash map protected by its own read/write lock and placed into its own cache
+    line. Lookups of different stripes never contend, lookups of the same stripe
+    share the read lock and only writers of the same stripe are serialized.
+
+    Values are always copied out of the container under the stripe lock, so no
+    references to the container storage escape and no additional memory
+    reclamation scheme is required. Use visit() to access the stored value in
+    place without copying.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
+class ConcurrentHashMap
+{
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef size_t size_type;
+
+    //! Initialize the concurrent hash map with a given capacity and blank key value
+    /*!
+        \param capacity - Concurrent hash map capacity (default is 128)
+        \param blank - Blank key value (default is TKey())
+        \param stripes - Count of stripes (default is 0 - four stripes per hardware thread)
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit ConcurrentHashMap(size_t capacity = 128, const TKey& blank = TKey(), size_t stripes = 0, const THash& hash = THash(), const TEqual& equal = TEqual(), const TAllocator& allocator = TAllocator());
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+    ~ConcurrentHashMap() = default;
+
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+
+    //! Check if the concurrent hash map is not empty
+    explicit operator bool() const { return !empty(); }
+
+    //! Is the concurrent hash map empty?
+    bool empty() const;
+
+    //! Get the concurrent hash map size
+    size_t size() const;
+    //! Get the concurrent hash map count of stripes
+    size_t stripes() const noexcept { return _stripes.size(); }
+
+    //! Check if the concurrent hash map contains the given key
+    bool contains(const TKey& key) const;
+
+    //! Try to find the value with the given key
+    /*!
+        \param key - Key to find
+        \param value - Value to fill
+        \return 'true' if the given key was found, 'false' if the given key was not found
+    */
+    bool find(const TKey& key, TValue& value) const;
+
+    //! Visit the value with the given key in place
+    /*!
+        Visitor is called under the stripe read lock with the signature 'void (const TValue& value)'.
+        It must not access the concurrent hash map.
+
+        \param key - Key to visit
+        \param visitor - Value visitor
+        \return 'true' if the given key was found, 'false' if the given key was not found
+    */
+    template <typename TVisitor>
+    bool visit(const TKey& key, TVisitor&& visitor) const;
+
+    //! Insert a new item into the concurrent hash map
+    /*!
+        \param key - Key of the item
+        \param value - Value of the item
+        \return 'true' if the item was inserted, 'false' if the given key already exists
+    */
+    bool insert(const TKey& key, const TValue& value);
+    //! Insert a new item or assign the value of the existing item in the concurrent hash map
+    /*!
+        \param key - Key of the item
+        \param value - Value of the item
+        \return 'true' if the item was inserted, 'false' if the value of the existing item was assigned
+    */
+    bool insert_or_assign(const TKey& key, const TValue& value);
+
+    //! Erase the item with the given key from the concurrent hash map
+    /*!
+        \param key - Key of the item to erase
+        \return 'true' if the item was erased, 'false' if the given key was not found
+    */
+    bool erase(const TKey& key);
+
+    //! Clear the concurrent hash map
+    void clear();
+
+private:
+    typedef HashMap<TKey, TValue, THash, TEqual, TAllocator> Map;
+
+    struct alignas(64) Stripe
+    {
+        mutable std::shared_mutex lock;
+        Map map;
+
+        Stripe(size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator) : map(capacity, blank, hash, equal, allocator) {}
+    };
+
+    THash _hash;
+    size_t _shift;
+    std::vector<std::unique_ptr<Stripe>> _stripes;
+
+    Stripe& stripe(const TKey& key) const noexcept;
+};
+
+/*! \example containers_concurrent_hashmap.cpp Concurrent hash map container example */
+
+} // namespace CppCommon
+
+#include "concurrent_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CONCURRENT_HASHMAP_H
@@ -0,0 +1,136 @@
+/*!
+    \file concurrent_hashmap.inl
+    \brief Concurrent hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::ConcurrentHashMap(size_t capacity, const TKey& blank, size_t stripes, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+    : _hash(hash), _shift(64)
+{
+    if (stripes == 0)
+        stripes = std::max<size_t>(std::thread::hardware_concurrency(), 1) * 4;
+
+    // Round the count of stripes up to the power of two
+    size_t count = 1;
+    while (count < stripes)
+    {
+        count <<= 1;
+        --_shift;
+    }
+
+    // Split the capacity between stripes
+    size_t reserve = std::max<size_t>((capacity + count - 1) / count, 1);
+
+    _stripes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        _stripes.emplace_back(std::make_unique<Stripe>(reserve, blank, hash, equal, allocator));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::empty() const
+{
+    for (const auto& stripe : _stripes)
+    {
+        std::shared_lock<std::shared_mutex> locker(stripe->lock);
+        if (!stripe->map.empty())
+            return false;
+    }
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::size() const
+{
+    size_t result = 0;
+    for (const auto& stripe : _stripes)
+    {
+        std::shared_lock<std::shared_mutex> locker(stripe->lock);
+        result += stripe->map.size();
+    }
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::contains(const TKey& key) const
+{
+    Stripe& current = stripe(key);
+    std::shared_lock<std::shared_mutex> locker(current.lock);
+    return current.map.find(key) != current.map.end();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::find(const TKey& key, TValue& value) const
+{
+    return visit(key, [&value](const TValue& item) { value = item; });
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TVisitor>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::visit(const TKey& key, TVisitor&& visitor) const
+{
+    const Stripe& current = stripe(key);
+    std::shared_lock<std::shared_mutex> locker(current.lock);
+
+    auto it = current.map.find(key);
+    if (it == current.map.end())
+        return false;
+
+    visitor(it->second);
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::insert(const TKey& key, const TValue& value)
+{
+    Stripe& current = stripe(key);
+    std::unique_lock<std::shared_mutex> locker(current.lock);
+    return current.map.emplace(key, value).second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::insert_or_assign(const TKey& key, const TValue& value)
+{
+    Stripe& current = stripe(key);
+    std::unique_lock<std::shared_mutex> locker(current.lock);
+
+    auto result = current.map.emplace(key, value);
+    if (!result.second)
+        result.first->second = value;
+    return result.second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline bool ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const TKey& key)
+{
+    Stripe& current = stripe(key);
+    std::unique_lock<std::shared_mutex> locker(current.lock);
+    return current.map.erase(key) > 0;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::clear()
+{
+    for (auto& stripe : _stripes)
+    {
+        std::unique_lock<std::shared_mutex> locker(stripe->lock);
+        stripe->map.clear();
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::Stripe& ConcurrentHashMap<TKey, TValue, THash, TEqual, TAllocator>::stripe(const TKey& key) const noexcept
+{
+    // Route by the high bits of the mixed hash, so each stripe hash map
+    // still receives well distributed low bits for its own bucket index
+    if (_shift >= 64)
+        return *_stripes[0];
+    uint64_t hash = (uint64_t)_hash(key) * 0x9E3779B97F4A7C15ull;
+    return *_stripes[(size_t)(hash >> _shift)];
+}
+
+} // namespace CppCommon
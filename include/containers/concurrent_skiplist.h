@@ -0,0 +1,249 @@
+/*!
+    \file concurrent_skiplist.h
+    \brief Intrusive lock-free concurrent skip list container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_CONCURRENT_SKIPLIST_H
+#define CPPCOMMON_CONTAINERS_CONCURRENT_SKIPLIST_H
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class ConcurrentSkipListIterator;
+
+//! Intrusive lock-free concurrent skip list container
+/*!
+    Concurrent skip list is an ordered set of unique items which allows to
+    insert, erase and search items from multiple threads without locks. Each
+    item is linked into the lowest level list and with probability 1/2 into
+    each next level list, so searches skip most of items and take O(log n)
+    expected time.
+
+    Erase marks the item links at all levels (logical removal) and then unlinks
+    the item from all level lists (physical removal). All concurrent operations
+    skip marked items and help to unlink them. Search and iteration operations
+    never write into the container.
+
+    Iteration is weakly consistent: iterators never become invalid because of
+    concurrent insert/erase operations, visit each item at most once in the sort
+    order and reflect some of the changes performed after the iterator creation.
+
+    The skip list is intrusive and does not allocate or free any memory, so its
+    nodes can be allocated from arenas or memory pools. Erased item memory must
+    not be reused or freed until all concurrent operations which were started
+    before the erase operation has completed (e.g. use epoch based reclamation
+    or free arena memory at quiescent points).
+
+    Skip list item should be derived from the ConcurrentSkipList<T>::Node:
+    \code{.cpp}
+    struct MySkipListNode : public ConcurrentSkipList<MySkipListNode>::Node
+    {
+        int key;
+        ...
+        friend bool operator<(const MySkipListNode& node1, const MySkipListNode& node2) { return node1.key < node2.key; }
+    };
+    \endcode
+
+    Thread-safe.
+
+    <b>References</b>\n
+    \li William Pugh. Skip Lists: A Probabilistic Alternative to Balanced Trees.
+        Communications of the ACM, 33(6):668-676, 1990.
+    \li Maurice Herlihy, Nir Shavit. The Art of Multiprocessor Programming.
+        Morgan Kaufmann, 2008. Chapter 14: Skiplists and Balanced Search.
+*/
+template <typename T, typename TCompare = std::less<T>, size_t Levels = 16>
+class ConcurrentSkipList
+{
+    static_assert(((Levels > 0) && (Levels <= 64)), "Concurrent skip list levels count must be in range [1, 64]!");
+
+    friend class ConcurrentSkipListIterator<ConcurrentSkipList<T, TCompare, Levels>, T>;
+    friend class ConcurrentSkipListIterator<const ConcurrentSkipList<T, TCompare, Levels>, const T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef TCompare value_compare;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef ConcurrentSkipListIterator<ConcurrentSkipList<T, TCompare, Levels>, T> iterator;
+    typedef ConcurrentSkipListIterator<const ConcurrentSkipList<T, TCompare, Levels>, const T> const_iterator;
+
+    //! Concurrent skip list node
+    struct Node
+    {
+        std::atomic<uintptr_t> next[Levels];    //!< Links to the next skip list nodes at each level (the lowest bit marks the removed node)
+        size_t levels;                          //!< Count of levels the node is linked into
+
+        Node() : levels(0) { for (auto& link : next) link.store(0, std::memory_order_relaxed); }
+        Node(const Node&) : Node() {}
+        Node& operator=(const Node&) noexcept { return *this; }
+    };
+
+    explicit ConcurrentSkipList(const TCompare& compare = TCompare()) noexcept;
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList(ConcurrentSkipList&&) = delete;
+    ~ConcurrentSkipList() noexcept = default;
+
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(ConcurrentSkipList&&) = delete;
+
+    //! Check if the skip list is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the skip list empty?
+    bool empty() const noexcept { return begin() == end(); }
+
+    //! Get the skip list size
+    /*!
+        The size is approximate while concurrent insert/erase operations are in progress.
+    */
+    size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+    //! Get the skip list levels count
+    static constexpr size_t levels() noexcept { return Levels; }
+
+    //! Compare two items: if the first item is less than the second one?
+    bool compare(const T& item1, const T& item2) const noexcept { return _compare(item1, item2); }
+
+    //! Get the begin skip list iterator
+    iterator begin() noexcept { return iterator((T*)InternalFirst()); }
+    const_iterator begin() const noexcept { return const_iterator(InternalFirst()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    //! Get the end skip list iterator
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cend() const noexcept { return end(); }
+
+    //! Find the iterator which points to the equal item in the skip list or return end iterator
+    iterator find(const T& item) noexcept { return iterator((T*)InternalFind(item)); }
+    const_iterator find(const T& item) const noexcept { return const_iterator(InternalFind(item)); }
+
+    //! Check if the skip list contains the equal item
+    bool contains(const T& item) const noexcept { return InternalFind(item) != nullptr; }
+
+    //! Find the iterator which points to the first item that not less than the given item in the skip list or return end iterator
+    iterator lower_bound(const T& item) noexcept { return iterator((T*)InternalLowerBound(item)); }
+    const_iterator lower_bound(const T& item) const noexcept { return const_iterator(InternalLowerBound(item)); }
+    //! Find the iterator which points to the first item that greater than the given item in the skip list or return end iterator
+    iterator upper_bound(const T& item) noexcept { return iterator((T*)InternalUpperBound(item)); }
+    const_iterator upper_bound(const T& item) const noexcept { return const_iterator(InternalUpperBound(item)); }
+
+    //! Insert a new item into the skip list
+    /*!
+        Will not block.
+
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted or already existing equal item and success flag
+    */
+    std::pair<iterator, bool> insert(T& item) noexcept;
+
+    //! Erase the equal item from the skip list
+    /*!
+        Will not block.
+
+        \param item - Item to erase
+        \return Erased item or nullptr if the equal item was not found (or concurrently erased by another thread)
+    */
+    T* erase(const T& item) noexcept;
+
+    //! Clear the skip list
+    /*!
+        Not thread-safe.
+    */
+    void clear() noexcept;
+
+private:
+    TCompare _compare;                      // Skip list compare
+    std::atomic<size_t> _size;              // Skip list size
+    std::atomic<uintptr_t> _head[Levels];   // Skip list head links
+
+    static constexpr uintptr_t MARK = 1;
+
+    static T* link_pointer(uintptr_t link) noexcept { return (T*)(link & ~MARK); }
+    static bool link_marked(uintptr_t link) noexcept { return (link & MARK) != 0; }
+
+    static size_t RandomLevels() noexcept;
+    static const T* InternalNext(const T* node) noexcept;
+
+    const T* InternalFirst() const noexcept;
+    const T* InternalFind(const T& item) const noexcept;
+    const T* InternalLowerBound(const T& item) const noexcept;
+    const T* InternalUpperBound(const T& item) const noexcept;
+    bool InternalSearch(const T& item, std::atomic<uintptr_t>** preds, T** succs) noexcept;
+};
+
+//! Intrusive lock-free concurrent skip list iterator
+/*!
+    Iterator is weakly consistent and skips items erased concurrently.
+
+    Thread-safe.
+*/
+template <class TContainer, typename T>
+class ConcurrentSkipListIterator
+{
+    friend typename std::remove_const<TContainer>::type;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    ConcurrentSkipListIterator() noexcept : _node(nullptr) {}
+    explicit ConcurrentSkipListIterator(T* node) noexcept : _node(node) {}
+    template <class UContainer, typename U>
+    ConcurrentSkipListIterator(const ConcurrentSkipListIterator<UContainer, U>& it) noexcept : _node(it._node) {}
+    ConcurrentSkipListIterator(const ConcurrentSkipListIterator& it) noexcept = default;
+    ~ConcurrentSkipListIterator() noexcept = default;
+
+    ConcurrentSkipListIterator& operator=(const ConcurrentSkipListIterator& it) noexcept = default;
+
+    friend bool operator==(const ConcurrentSkipListIterator& it1, const ConcurrentSkipListIterator& it2) noexcept
+    { return it1._node == it2._node; }
+    friend bool operator!=(const ConcurrentSkipListIterator& it1, const ConcurrentSkipListIterator& it2) noexcept
+    { return it1._node != it2._node; }
+
+    ConcurrentSkipListIterator& operator++() noexcept;
+    ConcurrentSkipListIterator operator++(int) noexcept;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept { return _node; }
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return _node != nullptr; }
+
+private:
+    template <class UContainer, typename U>
+    friend class ConcurrentSkipListIterator;
+
+    T* _node;
+};
+
+/*! \example containers_concurrent_skiplist.cpp Intrusive lock-free concurrent skip list container example */
+
+} // namespace CppCommon
+
+#include "concurrent_skiplist.inl"
+
+#endif // CPPCOMMON_CONTAINERS_CONCURRENT_SKIPLIST_H
@@ -0,0 +1,284 @@
+/*!
+    \file concurrent_skiplist.inl
+    \brief Intrusive lock-free concurrent skip list container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TCompare, size_t Levels>
+inline ConcurrentSkipList<T, TCompare, Levels>::ConcurrentSkipList(const TCompare& compare) noexcept
+    : _compare(compare), _size(0)
+{
+    for (auto& link : _head)
+        link.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline std::pair<typename ConcurrentSkipList<T, TCompare, Levels>::iterator, bool> ConcurrentSkipList<T, TCompare, Levels>::insert(T& item) noexcept
+{
+    std::atomic<uintptr_t>* preds[Levels];
+    T* succs[Levels];
+
+    size_t levels = RandomLevels();
+
+    // Link the item into the lowest level list
+    for (;;)
+    {
+        if (InternalSearch(item, preds, succs))
+            return std::make_pair(iterator(succs[0]), false);
+
+        item.levels = levels;
+        for (size_t level = 0; level < levels; ++level)
+            item.next[level].store((uintptr_t)succs[level], std::memory_order_relaxed);
+
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (preds[0][0].compare_exchange_strong(expected, (uintptr_t)&item, std::memory_order_release, std::memory_order_relaxed))
+            break;
+    }
+
+    _size.fetch_add(1, std::memory_order_relaxed);
+
+    // Link the item into upper level lists
+    for (size_t level = 1; level < levels; ++level)
+    {
+        for (;;)
+        {
+            // Stop if the item was concurrently erased
+            uintptr_t link = item.next[level].load(std::memory_order_acquire);
+            if (link_marked(link))
+                goto finish;
+
+            // Update the item link to the actual successor
+            if ((link_pointer(link) != succs[level]) && !item.next[level].compare_exchange_strong(link, (uintptr_t)succs[level], std::memory_order_acq_rel, std::memory_order_acquire))
+                continue;
+
+            uintptr_t expected = (uintptr_t)succs[level];
+            if (preds[level][level].compare_exchange_strong(expected, (uintptr_t)&item, std::memory_order_release, std::memory_order_relaxed))
+                break;
+
+            // Update predecessors and successors
+            InternalSearch(item, preds, succs);
+        }
+    }
+
+finish:
+    // Help to unlink the item completely if it was concurrently erased
+    if (link_marked(item.next[0].load(std::memory_order_acquire)))
+        InternalSearch(item, preds, succs);
+
+    return std::make_pair(iterator(&item), true);
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline T* ConcurrentSkipList<T, TCompare, Levels>::erase(const T& item) noexcept
+{
+    std::atomic<uintptr_t>* preds[Levels];
+    T* succs[Levels];
+
+    if (!InternalSearch(item, preds, succs))
+        return nullptr;
+
+    T* node = succs[0];
+
+    // Mark the node links from the top level to the lowest one
+    for (size_t level = node->levels; level-- > 1;)
+        node->next[level].fetch_or(MARK, std::memory_order_acq_rel);
+
+    // The thread which marks the lowest level link owns the erased node
+    if (link_marked(node->next[0].fetch_or(MARK, std::memory_order_acq_rel)))
+        return nullptr;
+
+    _size.fetch_sub(1, std::memory_order_relaxed);
+
+    // Unlink the node from all level lists
+    InternalSearch(*node, preds, succs);
+
+    return node;
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline void ConcurrentSkipList<T, TCompare, Levels>::clear() noexcept
+{
+    _size.store(0, std::memory_order_relaxed);
+    for (auto& link : _head)
+        link.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline size_t ConcurrentSkipList<T, TCompare, Levels>::RandomLevels() noexcept
+{
+    // Per-thread xorshift random generator
+    static thread_local uint64_t seed = ((uint64_t)(uintptr_t)&seed * 0x9E3779B97F4A7C15ull) | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    // Geometric distribution with probability 1/2 limited by levels count
+    return 1 + (size_t)std::countr_zero(seed | (1ull << (Levels - 1)));
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline const T* ConcurrentSkipList<T, TCompare, Levels>::InternalNext(const T* node) noexcept
+{
+    // Skip all marked nodes in the lowest level list
+    node = link_pointer(node->next[0].load(std::memory_order_acquire));
+    while ((node != nullptr) && link_marked(node->next[0].load(std::memory_order_acquire)))
+        node = link_pointer(node->next[0].load(std::memory_order_acquire));
+    return node;
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline const T* ConcurrentSkipList<T, TCompare, Levels>::InternalFirst() const noexcept
+{
+    // Skip all marked nodes in the lowest level list
+    const T* node = link_pointer(_head[0].load(std::memory_order_acquire));
+    while ((node != nullptr) && link_marked(node->next[0].load(std::memory_order_acquire)))
+        node = link_pointer(node->next[0].load(std::memory_order_acquire));
+    return node;
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline const T* ConcurrentSkipList<T, TCompare, Levels>::InternalFind(const T& item) const noexcept
+{
+    const T* result = InternalLowerBound(item);
+    return ((result != nullptr) && !compare(item, *result)) ? result : nullptr;
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline const T* ConcurrentSkipList<T, TCompare, Levels>::InternalLowerBound(const T& item) const noexcept
+{
+    // Perform the skip list search from the top level of the head
+    const std::atomic<uintptr_t>* pred = _head;
+    const T* current = nullptr;
+
+    for (size_t level = Levels; level-- > 0;)
+    {
+        current = link_pointer(pred[level].load(std::memory_order_acquire));
+        while (current != nullptr)
+        {
+            uintptr_t succ = current->next[level].load(std::memory_order_acquire);
+
+            // Skip the marked node
+            if (link_marked(succ))
+            {
+                current = link_pointer(succ);
+                continue;
+            }
+
+            // Stop at the first node that not less than the given item
+            if (!compare(*current, item))
+                break;
+
+            // Move to the next node
+            pred = current->next;
+            current = link_pointer(succ);
+        }
+    }
+
+    return current;
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline const T* ConcurrentSkipList<T, TCompare, Levels>::InternalUpperBound(const T& item) const noexcept
+{
+    // Perform the skip list search from the top level of the head
+    const std::atomic<uintptr_t>* pred = _head;
+    const T* current = nullptr;
+
+    for (size_t level = Levels; level-- > 0;)
+    {
+        current = link_pointer(pred[level].load(std::memory_order_acquire));
+        while (current != nullptr)
+        {
+            uintptr_t succ = current->next[level].load(std::memory_order_acquire);
+
+            // Skip the marked node
+            if (link_marked(succ))
+            {
+                current = link_pointer(succ);
+                continue;
+            }
+
+            // Stop at the first node that greater than the given item
+            if (compare(item, *current))
+                break;
+
+            // Move to the next node
+            pred = current->next;
+            current = link_pointer(succ);
+        }
+    }
+
+    return current;
+}
+
+template <typename T, typename TCompare, size_t Levels>
+inline bool ConcurrentSkipList<T, TCompare, Levels>::InternalSearch(const T& item, std::atomic<uintptr_t>** preds, T** succs) noexcept
+{
+retry:
+    // Perform the skip list search from the top level of the head
+    std::atomic<uintptr_t>* pred = _head;
+    T* current = nullptr;
+
+    for (size_t level = Levels; level-- > 0;)
+    {
+        current = link_pointer(pred[level].load(std::memory_order_acquire));
+        while (current != nullptr)
+        {
+            uintptr_t succ = current->next[level].load(std::memory_order_acquire);
+
+            // Unlink the marked node from the current level list
+            if (link_marked(succ))
+            {
+                uintptr_t expected = (uintptr_t)current;
+                if (!pred[level].compare_exchange_strong(expected, succ & ~MARK, std::memory_order_acq_rel, std::memory_order_acquire))
+                    goto retry;
+                current = link_pointer(succ);
+                continue;
+            }
+
+            // Stop at the first node that not less than the given item
+            if (!compare(*current, item))
+                break;
+
+            // Move to the next node
+            pred = current->next;
+            current = link_pointer(succ);
+        }
+
+        preds[level] = pred;
+        succs[level] = current;
+    }
+
+    return (current != nullptr) && !compare(item, *current);
+}
+
+template <class TContainer, typename T>
+inline ConcurrentSkipListIterator<TContainer, T>& ConcurrentSkipListIterator<TContainer, T>::operator++() noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    _node = (T*)std::remove_const<TContainer>::type::InternalNext(_node);
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline ConcurrentSkipListIterator<TContainer, T> ConcurrentSkipListIterator<TContainer, T>::operator++(int) noexcept
+{
+    ConcurrentSkipListIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+inline typename ConcurrentSkipListIterator<TContainer, T>::reference ConcurrentSkipListIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return *_node;
+}
+
+} // namespace CppCommon
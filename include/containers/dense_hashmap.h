@@ -0,0 +1,249 @@
+/*!
+    \file dense_hashmap.h
+    \brief Dense hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_DENSE_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_DENSE_HASHMAP_H
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Dense hash map container
+/*!
+    Dense hash map keeps all items in the contiguous vector without blanks,
+    so the full scan is a linear pass over live items only and its cost does
+    not depend on the load factor or on previous erases. Iterators are plain
+    random access iterators of the items vector and data() gives direct
+    access to items for vectorized processing.
+
+    Lookups use the separate open addressing index table with linear probing.
+    Each index bucket is a 32-bit item position, so the index table is much
+    smaller than buckets of HashMap with large values and it is rebuilt on
+    growth without moving items. Key hashes are stored next to items, so
+    rehash never calls the key hasher again and probes compare full keys
+    only on hash match.
+
+    Items are iterated in the insert order until the first erase. Erase moves
+    the last item into the erased position (swap-and-pop), so it is O(1) and
+    changes the position of the last item only. Erase by iterator returns the
+    iterator to the same position, which makes erasing in the forward loop
+    safe.
+
+    Iterators, references and pointers to items are invalidated by inserts
+    which grow the items vector and by erases of previous items.
+
+    Dense hash map holds up to 2^32 - 1 items.
+
+    Not thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
+class DenseHashMap
+{
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef typename std::vector<value_type, TAllocator>::iterator iterator;
+    typedef typename std::vector<value_type, TAllocator>::const_iterator const_iterator;
+    typedef typename std::vector<value_type, TAllocator>::reverse_iterator reverse_iterator;
+    typedef typename std::vector<value_type, TAllocator>::const_reverse_iterator const_reverse_iterator;
+
+    //! Initialize the dense hash map with a given capacity
+    /*!
+        \param capacity - Dense hash map capacity (default is 128)
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit DenseHashMap(size_t capacity = 128, const THash& hash = THash(), const TEqual& equal = TEqual(), const TAllocator& allocator = TAllocator());
+    template <class InputIterator>
+    DenseHashMap(InputIterator first, InputIterator last, size_t capacity = 128, const THash& hash = THash(), const TEqual& equal = TEqual(), const TAllocator& allocator = TAllocator());
+    DenseHashMap(const DenseHashMap&) = default;
+    DenseHashMap(DenseHashMap&&) = default;
+    ~DenseHashMap() = default;
+
+    DenseHashMap& operator=(const DenseHashMap&) = default;
+    DenseHashMap& operator=(DenseHashMap&&) = default;
+
+    //! Check if the dense hash map is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given key or insert a new one
+    mapped_type& operator[](const TKey& key);
+
+    //! Is the dense hash map empty?
+    bool empty() const noexcept { return _items.empty(); }
+
+    //! Get the dense hash map size
+    size_t size() const noexcept { return _items.size(); }
+    //! Get the dense hash map maximum size
+    size_t max_size() const noexcept { return NONE; }
+    //! Get the dense hash map capacity
+    size_t capacity() const noexcept { return _items.capacity(); }
+    //! Get the dense hash map index bucket count
+    size_t bucket_count() const noexcept { return _index.size(); }
+
+    //! Get the dense hash map items
+    pointer data() noexcept { return _items.data(); }
+    const_pointer data() const noexcept { return _items.data(); }
+
+    //! Get the begin dense hash map iterator
+    iterator begin() noexcept { return _items.begin(); }
+    const_iterator begin() const noexcept { return _items.begin(); }
+    const_iterator cbegin() const noexcept { return _items.cbegin(); }
+    //! Get the end dense hash map iterator
+    iterator end() noexcept { return _items.end(); }
+    const_iterator end() const noexcept { return _items.end(); }
+    const_iterator cend() const noexcept { return _items.cend(); }
+
+    //! Get the reverse begin dense hash map iterator
+    reverse_iterator rbegin() noexcept { return _items.rbegin(); }
+    const_reverse_iterator rbegin() const noexcept { return _items.rbegin(); }
+    const_reverse_iterator crbegin() const noexcept { return _items.crbegin(); }
+    //! Get the reverse end dense hash map iterator
+    reverse_iterator rend() noexcept { return _items.rend(); }
+    const_reverse_iterator rend() const noexcept { return _items.rend(); }
+    const_reverse_iterator crend() const noexcept { return _items.crend(); }
+
+    //! Get the first item
+    reference front() noexcept { assert(!empty() && "Dense hash map is empty!"); return _items.front(); }
+    const_reference front() const noexcept { assert(!empty() && "Dense hash map is empty!"); return _items.front(); }
+    //! Get the last item
+    reference back() noexcept { assert(!empty() && "Dense hash map is empty!"); return _items.back(); }
+    const_reference back() const noexcept { assert(!empty() && "Dense hash map is empty!"); return _items.back(); }
+
+    //! Find the iterator which points to the item with the given key or return end iterator
+    iterator find(const TKey& key) noexcept { return begin() + find_internal(key); }
+    const_iterator find(const TKey& key) const noexcept { return begin() + find_internal(key); }
+
+    //! Find the count of items with the given key
+    size_t count(const TKey& key) const noexcept { return contains(key) ? 1 : 0; }
+    //! Is the dense hash map contains an item with the given key?
+    bool contains(const TKey& key) const noexcept { return (find_internal(key) != size()); }
+
+    //! Access to the item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Item with the given key
+    */
+    mapped_type& at(const TKey& key);
+    //! Access to the constant item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Constant item with the given key
+    */
+    const mapped_type& at(const TKey& key) const;
+
+    //! Insert a new item at the end of the dense hash map
+    /*!
+        \param item - Item to insert as a key/value pair
+        \return Pair with the iterator to the given key and success flag
+    */
+    std::pair<iterator, bool> insert(const value_type& item) { return insert_internal(item); }
+    //! Insert a new item at the end of the dense hash map
+    /*!
+        \param item - Item to insert as a key/value pair
+        \return Pair with the iterator to the given key and success flag
+    */
+    std::pair<iterator, bool> insert(value_type&& item) { return insert_internal(std::move(item)); }
+
+    //! Emplace a new item at the end of the dense hash map
+    /*!
+        \param args - Arguments to emplace
+        \return Pair with the iterator to the given key and success flag
+    */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return insert_internal(value_type(std::forward<Args>(args)...)); }
+
+    //! Erase the item with the given key from the dense hash map
+    /*!
+        The last item is moved into the position of the erased one.
+
+        \param key - Key of the item to erase
+        \return Number of erased elements (0 or 1 for the dense hash map)
+    */
+    size_t erase(const TKey& key);
+    //! Erase the item by its iterator from the dense hash map
+    /*!
+        The last item is moved into the position of the erased one.
+
+        \param position - Iterator position to the erased item
+        \return Iterator to the same position (the moved last item or end iterator)
+    */
+    iterator erase(const const_iterator& position);
+
+    //! Pop the last item from the dense hash map
+    /*!
+        \return The last item
+    */
+    value_type pop_back();
+
+    //! Rehash the dense hash map index table to the given capacity or more
+    /*!
+        \param capacity - Dense hash map index capacity
+    */
+    void rehash(size_t capacity);
+    //! Reserve the dense hash map capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+    //! Shrink the dense hash map items and index table to fit its size
+    void shrink_to_fit();
+
+    //! Clear the dense hash map
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(DenseHashMap& hashmap) noexcept;
+    template <typename UKey, typename UValue, typename UHash, typename UEqual, typename UAllocator>
+    friend void swap(DenseHashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap1, DenseHashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap2) noexcept;
+
+private:
+    static constexpr size_t NONE = std::numeric_limits<uint32_t>::max();
+
+    THash _hash;                                // Dense hash map key hasher
+    TEqual _equal;                              // Dense hash map key comparator
+    std::vector<value_type, TAllocator> _items; // Dense hash map items
+    std::vector<size_t> _hashes;                // Dense hash map item key hashes
+    std::vector<uint32_t> _index;               // Dense hash map index table of item positions
+
+    size_t slot_internal(size_t hash, const TKey& key) const noexcept;
+    size_t locate_internal(size_t hash, size_t item) const noexcept;
+    size_t find_internal(const TKey& key) const noexcept;
+    template <typename TItem>
+    std::pair<iterator, bool> insert_internal(TItem&& item);
+    void erase_internal(size_t item);
+    void place_internal(size_t item) noexcept;
+};
+
+/*! \example containers_dense_hashmap.cpp Dense hash map container example */
+
+} // namespace CppCommon
+
+#include "dense_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_DENSE_HASHMAP_H
@@ -0,0 +1,260 @@
+/*!
+    \file dense_hashmap.inl
+    \brief Dense hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::DenseHashMap(size_t capacity, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+    : _hash(hash), _equal(equal), _items(allocator)
+{
+    _index.resize(std::bit_ceil(std::max((size_t)8, capacity)), (uint32_t)NONE);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <class InputIterator>
+inline DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::DenseHashMap(InputIterator first, InputIterator last, size_t capacity, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+    : DenseHashMap(capacity, hash, equal, allocator)
+{
+    for (auto it = first; it != last; ++it)
+        insert(*it);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::operator[](const TKey& key)
+{
+    size_t item = find_internal(key);
+    if (item != size())
+        return _items[item].second;
+
+    return insert_internal(value_type(key, TValue())).first->second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::at(const TKey& key)
+{
+    size_t item = find_internal(key);
+    if (item == size())
+        throw std::out_of_range("Item with the given key was not found in the dense hash map!");
+
+    return _items[item].second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline const typename DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::at(const TKey& key) const
+{
+    size_t item = find_internal(key);
+    if (item == size())
+        throw std::out_of_range("Item with the given key was not found in the dense hash map!");
+
+    return _items[item].second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::slot_internal(size_t hash, const TKey& key) const noexcept
+{
+    size_t mask = _index.size() - 1;
+
+    // Probe index buckets until the first empty one
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        size_t item = _index[index];
+        if (item == NONE)
+            return NONE;
+        if ((_hashes[item] == hash) && _equal(_items[item].first, key))
+            return index;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::locate_internal(size_t hash, size_t item) const noexcept
+{
+    size_t mask = _index.size() - 1;
+
+    // Item is always present in its probe chain
+    size_t index = hash & mask;
+    while (_index[index] != item)
+        index = (index + 1) & mask;
+    return index;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::find_internal(const TKey& key) const noexcept
+{
+    size_t index = slot_internal(_hash(key), key);
+    return (index != NONE) ? _index[index] : size();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::place_internal(size_t item) noexcept
+{
+    size_t mask = _index.size() - 1;
+    size_t index = _hashes[item] & mask;
+    while (_index[index] != NONE)
+        index = (index + 1) & mask;
+    _index[index] = (uint32_t)item;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TItem>
+inline std::pair<typename DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, bool> DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::insert_internal(TItem&& item)
+{
+    size_t hash = _hash(item.first);
+    size_t index = slot_internal(hash, item.first);
+    if (index != NONE)
+        return std::make_pair(begin() + _index[index], false);
+
+    if (size() >= NONE)
+        throw std::length_error("Dense hash map size exceeds its maximum size!");
+
+    // Keep the index table load factor not greater than 0.5
+    if (((size() + 1) * 2) > _index.size())
+        rehash((size() + 1) * 2);
+
+    // Append the new item
+    _hashes.push_back(hash);
+    try
+    {
+        _items.push_back(std::forward<TItem>(item));
+    }
+    catch (...)
+    {
+        _hashes.pop_back();
+        throw;
+    }
+
+    place_internal(size() - 1);
+    return std::make_pair(end() - 1, true);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const TKey& key)
+{
+    size_t item = find_internal(key);
+    if (item == size())
+        return 0;
+
+    erase_internal(item);
+    return 1;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const const_iterator& position)
+{
+    assert((position >= cbegin()) && (position < cend()) && "Iterator must be valid!");
+
+    size_t item = position - cbegin();
+    erase_internal(item);
+    return begin() + item;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::value_type DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::pop_back()
+{
+    assert(!empty() && "Dense hash map is empty!");
+
+    value_type result(std::move(_items.back()));
+    erase_internal(size() - 1);
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase_internal(size_t item)
+{
+    size_t mask = _index.size() - 1;
+
+    // Find the index bucket of the erased item
+    size_t index = locate_internal(_hashes[item], item);
+    _index[index] = (uint32_t)NONE;
+
+    // Shift back all following items of the probe chain which could fill the hole
+    for (size_t next = (index + 1) & mask; _index[next] != NONE; next = (next + 1) & mask)
+    {
+        size_t ideal = _hashes[_index[next]] & mask;
+        bool stays = (index <= next) ? ((index < ideal) && (ideal <= next)) : ((index < ideal) || (ideal <= next));
+        if (stays)
+            continue;
+
+        _index[index] = _index[next];
+        _index[next] = (uint32_t)NONE;
+        index = next;
+    }
+
+    // Move the last item into the erased position
+    size_t last = size() - 1;
+    if (item != last)
+    {
+        _index[locate_internal(_hashes[last], last)] = (uint32_t)item;
+        _items[item] = std::move(_items[last]);
+        _hashes[item] = _hashes[last];
+    }
+    _items.pop_back();
+    _hashes.pop_back();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::rehash(size_t capacity)
+{
+    capacity = std::bit_ceil(std::max({ (size_t)8, capacity, size() * 2 }));
+    if (capacity == _index.size())
+        return;
+
+    // Rebuild the index table with stored key hashes
+    _index.assign(capacity, (uint32_t)NONE);
+    for (size_t item = 0; item < size(); ++item)
+        place_internal(item);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::reserve(size_t count)
+{
+    if (count > NONE)
+        throw std::length_error("Dense hash map size exceeds its maximum size!");
+
+    _items.reserve(count);
+    _hashes.reserve(count);
+
+    // Keep the index table load factor not greater than 0.5
+    if ((count * 2) > _index.size())
+        rehash(count * 2);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::shrink_to_fit()
+{
+    _items.shrink_to_fit();
+    _hashes.shrink_to_fit();
+    rehash(0);
+    _index.shrink_to_fit();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::clear() noexcept
+{
+    std::fill(_index.begin(), _index.end(), (uint32_t)NONE);
+    _items.clear();
+    _hashes.clear();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>::swap(DenseHashMap& hashmap) noexcept
+{
+    using std::swap;
+    swap(_hash, hashmap._hash);
+    swap(_equal, hashmap._equal);
+    swap(_items, hashmap._items);
+    swap(_hashes, hashmap._hashes);
+    swap(_index, hashmap._index);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void swap(DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>& hashmap1, DenseHashMap<TKey, TValue, THash, TEqual, TAllocator>& hashmap2) noexcept
+{
+    hashmap1.swap(hashmap2);
+}
+
+} // namespace CppCommon
@@ -9,11 +9,16 @@
 #ifndef CPPCOMMON_CONTAINERS_FLATMAP_H
 #define CPPCOMMON_CONTAINERS_FLATMAP_H
 
+#include "memory/memory.h"
+
 #include <algorithm>
+#include <bit>
+#include <cassert>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -26,7 +31,12 @@ namespace CppCommon {
     array container with using binary search algorithm to  find  the  item  by  the
     given key.
 
-    Not thread-safe.
+    Optional read-optimized layout keeps a copy of keys in Eytzinger (BFS) order,
+    so the branchless lookup descends an implicit binary tree where the next
+    levels are adjacent in memory and could be prefetched ahead. The layout is
+    rebuilt eagerly by each modification, so lookups never modify the flat map.
+
+    Not thread-safe, but concurrent lookups without modifications are safe.
 */
 template <typename TKey, typename TValue, typename TCompare = std::less<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
 class FlatMap
@@ -80,6 +90,23 @@ public:
     //! Get the flat map maximum size
     size_t max_size() const noexcept { return _container.max_size(); }
 
+    //! Is the read-optimized layout enabled?
+    bool read_optimized() const noexcept { return _optimized; }
+
+    //! Enable or disable the read-optimized layout
+    /*!
+        Read-optimized layout speeds up lookups of large read-mostly flat maps
+        at the cost of the extra copy of keys. Enabling the layout builds it in
+        O(n) and each modification rebuilds it in O(n), so load the flat map
+        with bulk insert() or merge() or enable the layout after loading.
+
+        If the layout rebuild fails with an exception the layout is disabled
+        and lookups fall back to the binary search.
+
+        \param optimized - Read-optimized layout flag
+    */
+    void set_read_optimized(bool optimized);
+
     //! Compare two items: if the first key is less than the second one?
     bool compare(const TKey& key1, const TKey& key2) const noexcept { return _compare(key1, key2); }
     bool compare(const TKey& key1, const value_type& key2) const noexcept { return _compare(key1, key2.first); }
@@ -108,6 +135,21 @@ public:
     iterator find(const TKey& key) noexcept;
     const_iterator find(const TKey& key) const noexcept;
 
+    //! Find items with the given keys in a batch
+    /*!
+        Binary searches of the batch keys run in lockstep with branchless steps,
+        so each round issues independent memory loads for all keys and
+        prefetches both candidates of the next round. Cache misses of
+        independent lookups overlap instead of being paid one by one, which
+        speeds up lookups in flat maps much larger than CPU caches.
+
+        \param keys - Keys to find
+        \param results - Iterators to found items or end iterators (must fit all keys)
+        \return Count of found items
+    */
+    size_t find_many(std::span<const TKey> keys, std::span<iterator> results) noexcept;
+    size_t find_many(std::span<const TKey> keys, std::span<const_iterator> results) const noexcept;
+
     //! Find the iterator which points to the first item with the given key that not less than the given key in the flat map or return end iterator
     iterator lower_bound(const TKey& key) noexcept;
     const_iterator lower_bound(const TKey& key) const noexcept;
@@ -163,12 +205,27 @@ public:
     iterator insert(const const_iterator& position, value_type&& item);
     //! Insert all items into the flat map from the given iterators range
     /*!
+        Items are appended to the flat map, sorted, deduplicated and merged
+        with existing ones in O(n*log(n)), so bulk loading of unsorted items
+        does not cost O(n^2) of single inserts. Existing items and the first
+        of duplicate items in the range are kept.
+
         \param first - The first iterator of the inserted range
         \param last - The last iterator of the inserted range
     */
     template <class InputIterator>
     void insert(InputIterator first, InputIterator last);
 
+    //! Merge all items of another flat map into the current one
+    /*!
+        Both flat maps are already sorted, so items are merged in O(n).
+        Items of the given flat map with keys already present in the current
+        one are discarded.
+
+        \param flatmap - Flat map to merge
+    */
+    void merge(FlatMap&& flatmap);
+
     //! Emplace a new item into the flat map
     /*!
         \param args - Arguments to emplace
@@ -217,7 +274,7 @@ public:
     void shrink_to_fit() { _container.shrink_to_fit(); }
 
     //! Clear the flat map
-    void clear() noexcept { _container.clear(); }
+    void clear() noexcept { _container.clear(); _layout.clear(); _positions.clear(); }
 
     //! Swap two instances
     void swap(FlatMap& flatmap) noexcept;
@@ -227,11 +284,26 @@ public:
 private:
     TCompare _compare;                              // Flat map key comparator
     std::vector<value_type, TAllocator> _container; // Flat map container
+    bool _optimized{false};                         // Flat map read-optimized layout flag
+    std::vector<TKey> _layout;                      // Flat map keys in Eytzinger order (1-based)
+    std::vector<size_t> _positions;                 // Flat map item positions in Eytzinger order (1-based)
+
+    static constexpr size_t BATCH = 16;
+
+    size_t search_internal(const TKey& key) const noexcept;
+    size_t layout_internal(const TKey& key, bool upper) const noexcept;
+    void search_many_internal(const TKey* keys, size_t count, size_t* positions) const noexcept;
+    void layout_many_internal(const TKey* keys, size_t count, size_t* positions) const noexcept;
+    template <typename TResult>
+    size_t find_many_internal(std::span<const TKey> keys, TResult result) const noexcept;
+    void optimize_internal();
+    void build_internal(size_t& position, size_t index);
 
     template <typename... Args>
     std::pair<iterator, bool> emplace_internal(const TKey& key, Args&&... args);
     template <typename... Args>
     iterator emplace_hint_internal(const const_iterator& position, const TKey& key, Args&&... args);
+    void merge_internal(size_t middle);
 };
 
 /*! \example containers_flatmap.cpp Flat map container example */
@@ -29,6 +29,7 @@ inline FlatMap<TKey, TValue, TCompare, TAllocator>::FlatMap(const FlatMap& flatm
 {
     for (const auto& item : flatmap)
         insert(item);
+    _optimized = flatmap._optimized;
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
@@ -37,6 +38,7 @@ inline FlatMap<TKey, TValue, TCompare, TAllocator>::FlatMap(const FlatMap& flatm
 {
     for (const auto& item : flatmap)
         insert(item);
+    _optimized = flatmap._optimized;
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
@@ -67,39 +69,96 @@ inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator Flat
     return it;
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::find_many(std::span<const TKey> keys, std::span<iterator> results) noexcept
+{
+    assert((results.size() >= keys.size()) && "Results must fit all keys!");
+
+    return find_many_internal(keys, [this, &results](size_t i, size_t position) { results[i] = begin() + position; });
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::find_many(std::span<const TKey> keys, std::span<const_iterator> results) const noexcept
+{
+    assert((results.size() >= keys.size()) && "Results must fit all keys!");
+
+    return find_many_internal(keys, [this, &results](size_t i, size_t position) { results[i] = begin() + position; });
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+template <typename TResult>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::find_many_internal(std::span<const TKey> keys, TResult result) const noexcept
+{
+    size_t size = _container.size();
+    size_t positions[BATCH];
+    size_t found = 0;
+
+    for (size_t first = 0; first < keys.size(); first += BATCH)
+    {
+        size_t count = std::min(BATCH, keys.size() - first);
+
+        // Find lower bounds of the batch keys
+        if (_optimized)
+            layout_many_internal(keys.data() + first, count, positions);
+        else
+            search_many_internal(keys.data() + first, count, positions);
+
+        // Lower bounds with greater keys are not found
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t position = positions[i];
+            if ((position != size) && !compare(keys[first + i], _container[position].first))
+                ++found;
+            else
+                position = size;
+            result(first + i, position);
+        }
+    }
+
+    return found;
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound(const TKey& key) noexcept
 {
-    return std::lower_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
+    return begin() + (_optimized ? layout_internal(key, false) : search_internal(key));
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::lower_bound(const TKey& key) const noexcept
 {
-    return std::lower_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
+    return begin() + (_optimized ? layout_internal(key, false) : search_internal(key));
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound(const TKey& key) noexcept
 {
+    if (_optimized)
+        return begin() + layout_internal(key, true);
     return std::upper_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator FlatMap<TKey, TValue, TCompare, TAllocator>::upper_bound(const TKey& key) const noexcept
 {
+    if (_optimized)
+        return begin() + layout_internal(key, true);
     return std::upper_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline std::pair<typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator, typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator> FlatMap<TKey, TValue, TCompare, TAllocator>::equal_range(const TKey& key) noexcept
 {
+    if (_optimized)
+        return std::make_pair(lower_bound(key), upper_bound(key));
     return std::equal_range(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline std::pair<typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator, typename FlatMap<TKey, TValue, TCompare, TAllocator>::const_iterator> FlatMap<TKey, TValue, TCompare, TAllocator>::equal_range(const TKey& key) const noexcept
 {
+    if (_optimized)
+        return std::make_pair(lower_bound(key), upper_bound(key));
     return std::equal_range(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); });
 }
 
@@ -151,8 +210,45 @@ template <typename TKey, typename TValue, typename TCompare, typename TAllocator
 template <class InputIterator>
 inline void FlatMap<TKey, TValue, TCompare, TAllocator>::insert(InputIterator first, InputIterator last)
 {
-    for (auto it = first; it != last; ++it)
-        insert(*it);
+    size_t middle = _container.size();
+
+    // Append all items and sort them with keeping the order of duplicates
+    _container.insert(_container.end(), first, last);
+    std::stable_sort(_container.begin() + middle, _container.end(), [this](const value_type& item1, const value_type& item2) { return compare(item1, item2); });
+
+    merge_internal(middle);
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::merge(FlatMap&& flatmap)
+{
+    if (empty())
+    {
+        _container = std::move(flatmap._container);
+        flatmap.clear();
+        optimize_internal();
+        return;
+    }
+
+    size_t middle = _container.size();
+
+    // Append all sorted items of the given flat map
+    _container.insert(_container.end(), std::make_move_iterator(flatmap._container.begin()), std::make_move_iterator(flatmap._container.end()));
+    flatmap.clear();
+
+    merge_internal(middle);
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::merge_internal(size_t middle)
+{
+    auto less = [this](const value_type& item1, const value_type& item2) { return compare(item1, item2); };
+    auto equal = [this](const value_type& item1, const value_type& item2) { return !compare(item1, item2) && !compare(item2, item1); };
+
+    // Merge two sorted parts (existing items go first for equal keys) and remove duplicates
+    std::inplace_merge(_container.begin(), _container.begin() + middle, _container.end(), less);
+    _container.erase(std::unique(_container.begin(), _container.end(), equal), _container.end());
+    optimize_internal();
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
@@ -172,11 +268,12 @@ inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TK
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::erase(const TKey& key)
 {
-    auto it = find(key);
-    if (it == end())
+    auto it = begin() + search_internal(key);
+    if ((it == end()) || compare(key, it->first))
         return 0;
 
     _container.erase(it);
+    optimize_internal();
     return 1;
 }
 
@@ -186,6 +283,7 @@ inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TK
     iterator result(position);
     ++result;
     _container.erase(position);
+    optimize_internal();
     return result;
 }
 
@@ -194,6 +292,7 @@ inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TK
 {
     iterator result(last);
     _container.erase(first, last);
+    optimize_internal();
     return result;
 }
 
@@ -202,10 +301,11 @@ template <typename... Args>
 inline std::pair<typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator, bool> FlatMap<TKey, TValue, TCompare, TAllocator>::emplace_internal(const TKey& key, Args&&... args)
 {
     bool found = true;
-    iterator it = lower_bound(key);
+    iterator it = begin() + search_internal(key);
     if ((it == end()) || compare(key, it->first))
     {
         it = _container.emplace(it, std::make_pair(key, TValue(std::forward<Args>(args)...)));
+        optimize_internal();
         found = false;
     }
     return std::make_pair(it, !found);
@@ -216,16 +316,164 @@ template <typename... Args>
 inline typename FlatMap<TKey, TValue, TCompare, TAllocator>::iterator FlatMap<TKey, TValue, TCompare, TAllocator>::emplace_hint_internal(const const_iterator& position, const TKey& key, Args&&... args)
 {
     if (((position == begin()) || compare((position - 1)->first, key)) && ((position == end()) || compare(key, position.first)))
-        return _container.emplace(position, std::make_pair(key, TValue(std::forward<Args>(args)...)));
+    {
+        iterator it = _container.emplace(position, std::make_pair(key, TValue(std::forward<Args>(args)...)));
+        optimize_internal();
+        return it;
+    }
     return emplace_internal(key, std::forward<Args>(args)...).first;
 }
 
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::set_read_optimized(bool optimized)
+{
+    if (optimized == _optimized)
+        return;
+
+    _optimized = optimized;
+    if (_optimized)
+        optimize_internal();
+    else
+    {
+        // Release the read-optimized layout
+        std::vector<TKey>().swap(_layout);
+        std::vector<size_t>().swap(_positions);
+    }
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::optimize_internal()
+{
+    if (!_optimized)
+        return;
+
+    try
+    {
+        // Fill the implicit binary tree with the in-order traversal of sorted items
+        size_t position = 0;
+        _layout.resize(_container.size() + 1);
+        _positions.resize(_container.size() + 1);
+        build_internal(position, 1);
+    }
+    catch (...)
+    {
+        // Fall back to the binary search instead of the partially built layout
+        set_read_optimized(false);
+        throw;
+    }
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::build_internal(size_t& position, size_t index)
+{
+    if (index <= _container.size())
+    {
+        build_internal(position, 2 * index);
+        _layout[index] = _container[position].first;
+        _positions[index] = position++;
+        build_internal(position, 2 * index + 1);
+    }
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::search_internal(const TKey& key) const noexcept
+{
+    return std::lower_bound(begin(), end(), key, [this](auto key1, auto key2) { return this->compare(key1, key2); }) - begin();
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline size_t FlatMap<TKey, TValue, TCompare, TAllocator>::layout_internal(const TKey& key, bool upper) const noexcept
+{
+    size_t size = _container.size();
+    size_t index = 1;
+    while (index <= size)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        // Prefetch the 4th level of descendants
+        __builtin_prefetch(_layout.data() + std::min(16 * index, size));
+#endif
+        // Branchless descent: go to the right child if the node key goes before the given key
+        bool right = upper ? !compare(key, _layout[index]) : compare(_layout[index], key);
+        index = 2 * index + (size_t)right;
+    }
+
+    // Cancel right turns and the last left turn to get the bound node
+    index >>= std::countr_one(index) + 1;
+    return (index == 0) ? size : _positions[index];
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::search_many_internal(const TKey* keys, size_t count, size_t* positions) const noexcept
+{
+    std::fill(positions, positions + count, (size_t)0);
+
+    size_t size = _container.size();
+    if (size == 0)
+        return;
+
+    // All searches have the same length, so they run in lockstep
+    const value_type* items = _container.data();
+    for (size_t length = size; length > 1;)
+    {
+        size_t half = length / 2;
+        size_t next = (length - half) / 2;
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Prefetch both candidates of the next round
+            Memory::Prefetch(items + positions[i] + next);
+            Memory::Prefetch(items + positions[i] + half + next);
+
+            // Branchless step: go to the upper half if its first item goes before the given key
+            positions[i] += compare(items[positions[i] + half].first, keys[i]) ? half : 0;
+        }
+        length -= half;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+        positions[i] += compare(items[positions[i]].first, keys[i]) ? 1 : 0;
+}
+
+template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
+inline void FlatMap<TKey, TValue, TCompare, TAllocator>::layout_many_internal(const TKey* keys, size_t count, size_t* positions) const noexcept
+{
+    // Descents of the implicit binary tree differ in depth by one level at most
+    size_t size = _container.size();
+    std::fill(positions, positions + count, (size_t)1);
+    for (bool active = true; active;)
+    {
+        active = false;
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t index = positions[i];
+            if (index > size)
+                continue;
+
+            // Prefetch the 4th level of descendants
+            Memory::Prefetch(_layout.data() + std::min(16 * index, size));
+
+            // Branchless descent: go to the right child if the node key goes before the given key
+            positions[i] = 2 * index + (size_t)compare(_layout[index], keys[i]);
+            active = true;
+        }
+    }
+
+    // Cancel right turns and the last left turn to get the bound nodes
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t index = positions[i] >> (std::countr_one(positions[i]) + 1);
+        positions[i] = (index == 0) ? size : _positions[index];
+    }
+}
+
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
 inline void FlatMap<TKey, TValue, TCompare, TAllocator>::swap(FlatMap& flatmap) noexcept
 {
     using std::swap;
     swap(_compare, flatmap._compare);
     swap(_container, flatmap._container);
+    swap(_optimized, flatmap._optimized);
+    swap(_layout, flatmap._layout);
+    swap(_positions, flatmap._positions);
 }
 
 template <typename TKey, typename TValue, typename TCompare, typename TAllocator>
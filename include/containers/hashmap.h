@@ -9,15 +9,31 @@
 #ifndef CPPCOMMON_CONTAINERS_HASHMAP_H
 #define CPPCOMMON_CONTAINERS_HASHMAP_H
 
+#include "memory/allocator_aligned.h"
+#include "memory/memory.h"
+
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <span>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CPPCOMMON_HASHMAP_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CPPCOMMON_HASHMAP_NEON
+#include <arm_neon.h>
+#endif
+
 namespace CppCommon {
 
 template <class TContainer, typename TKey, typename TValue>
@@ -38,6 +54,20 @@ class HashMapConstReverseIterator;
     Open  address  hash map resolves collisions of the  same  hash  values  by
     inserting new item into the next free place (probing with step 1).
 
+    Each bucket has a one byte tag in the separate metadata array  with  7  bits
+    of the key hash or the blank mark. Lookups probe tags by groups of 16 with
+    SSE2/NEON instructions (with a scalar fallback) and compare full keys only
+    on tag match, so a probe sequence usually touches a single cache line of
+    the metadata array and a single bucket.
+
+    Key hashes are stored next to buckets, so erase with backward  shift  and
+    rehash never call the key hasher again. Current buckets use no tombstones.
+
+    With the incremental resize enabled old buckets under migration are marked
+    with DELETED tombstones when their items are moved or erased, so probes of
+    old buckets are not broken. Tombstones are never reused and disappear when
+    the last old item is migrated and old buckets are released.
+
     Not thread-safe.
 */
 template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
@@ -98,6 +128,23 @@ public:
     size_t max_size() const noexcept { return std::numeric_limits<size_type>::max(); }
     //! Get the hash map bucket count
     size_t bucket_count() const noexcept { return _buckets.size(); }
+
+    //! Is the incremental rehashing enabled?
+    bool incremental() const noexcept { return _incremental; }
+    //! Is the incremental rehashing in progress?
+    bool rehashing() const noexcept { return !_old_buckets.empty(); }
+
+    //! Enable or disable the incremental rehashing
+    /*!
+        When the incremental rehashing is enabled, the growing hash map keeps
+        the old buckets array next to the new one. Each insert and erase
+        migrates a bounded number of old buckets, lookups consult both arrays
+        until migration finishes, so the worst-case insert latency is O(1).
+        Disabling the incremental rehashing finishes the pending migration.
+
+        \param incremental - Incremental rehashing flag
+    */
+    void set_incremental(bool incremental);
     //! Get the hash map maximum bucket count
     size_t max_bucket_count() const noexcept { return std::numeric_limits<size_type>::max(); }
 
@@ -128,6 +175,21 @@ public:
     iterator find(const TKey& key) noexcept;
     const_iterator find(const TKey& key) const noexcept;
 
+    //! Find items with the given keys in a batch
+    /*!
+        Hashes of the batch keys are calculated first and their home tag groups
+        and buckets are prefetched, then keys are probed while cache lines are
+        loaded. Cache misses of independent lookups overlap instead of being
+        paid one by one, which speeds up lookups in hash maps much larger than
+        CPU caches (e.g. hash joins).
+
+        \param keys - Keys to find
+        \param results - Iterators to found items or end iterators (must fit all keys)
+        \return Count of found items
+    */
+    size_t find_many(std::span<const TKey> keys, std::span<iterator> results) noexcept;
+    size_t find_many(std::span<const TKey> keys, std::span<const_iterator> results) const noexcept;
+
     //! Find the bounds of a range that includes all the elements in the hash map with the given key
     std::pair<iterator, iterator> equal_range(const TKey& key) noexcept;
     std::pair<const_iterator, const_iterator> equal_range(const TKey& key) const noexcept;
@@ -183,6 +245,9 @@ public:
 
     //! Rehash the hash map to the given capacity or more
     /*!
+        Explicit rehash finishes the pending incremental migration and moves
+        all items at once.
+
         \param capacity - Hash map capacity
     */
     void rehash(size_t capacity);
@@ -192,6 +257,39 @@ public:
     */
     void reserve(size_t count);
 
+    //! Rehash the hash map to the given capacity or more using multiple threads
+    /*!
+        Parallel rehash partitions stored key hashes by high bits of their base
+        index, so each worker thread places items into its own disjoint range
+        of buckets without locks. Rare items which probe sequences leave their
+        range are placed sequentially after all worker threads finish.
+
+        Small hash maps are rehashed sequentially.
+
+        \param capacity - Hash map capacity
+        \param threads - Count of worker threads (default is 0 - hardware concurrency)
+    */
+    void parallel_rehash(size_t capacity, size_t threads = 0);
+
+    //! Insert items from the given range into the hash map using multiple threads
+    /*!
+        Parallel insert reserves the hash map capacity to fit all items with the
+        parallel rehash, calculates key hashes and places items into disjoint
+        ranges of buckets with multiple worker threads in the same way as the
+        parallel rehash. If the range contains several items with the same key
+        the first one is inserted like with sequential inserts.
+
+        Key hasher and comparator must be safe to call from multiple threads.
+        Temporary memory of two size_t values per item is used to partition
+        items between worker threads.
+
+        \param first - Random access iterator to the first item
+        \param last - Random access iterator to the end of items
+        \param threads - Count of worker threads (default is 0 - hardware concurrency)
+    */
+    template <class RandomIterator>
+    void parallel_insert(RandomIterator first, RandomIterator last, size_t threads = 0);
+
     //! Clear the hash map
     void clear() noexcept;
 
@@ -201,16 +299,60 @@ public:
     friend void swap(HashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap1, HashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap2) noexcept;
 
 private:
+    // Bucket tags start on the cache line boundary, so the first SIMD probe group never straddles cache lines
+    typedef std::vector<uint8_t, CacheAlignedAllocator<uint8_t>> tags_type;
+
     THash _hash;    // Hash map key hasher
     TEqual _equal;  // Hash map key comparator
     TKey _blank;    // Hash map blank key
     size_t _size;   // Hash map size
     std::vector<value_type, TAllocator> _buckets; // Hash map buckets
+    tags_type _tags; // Hash map bucket tags (with mirrored group tail)
+    std::vector<size_t> _hashes; // Hash map bucket key hashes
+    bool _incremental; // Hash map incremental rehashing flag
+    std::vector<value_type, TAllocator> _old_buckets; // Hash map old buckets under migration
+    tags_type _old_tags; // Hash map old bucket tags under migration
+    std::vector<size_t> _old_hashes; // Hash map old bucket key hashes under migration
+    size_t _old_size; // Hash map count of items not migrated yet
+    size_t _migrated; // Hash map count of migrated old buckets
+
+    static constexpr size_t GROUP = 16;
+    static constexpr size_t MIGRATE = 8;
+    static constexpr size_t PARALLEL = 4096;
+    static constexpr size_t BATCH = 16;
+    static constexpr uint8_t EMPTY = 0x80;
+    static constexpr uint8_t DELETED = 0xFE;
+    static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+    static uint8_t hash_to_tag(size_t hash) noexcept { return (uint8_t)(((uint64_t)hash * 0x9E3779B97F4A7C15ull) >> 57); }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace_internal(const TKey& key, Args&&... args);
     void erase_internal(size_t index);
-    size_t key_to_index(const TKey& key) const noexcept;
+    size_t find_internal(const TKey& key) const noexcept;
+    size_t find_internal(const TKey& key, size_t hash) const noexcept;
+    template <typename TResult>
+    size_t find_many_internal(std::span<const TKey> keys, TResult result) const noexcept;
+    template <typename TItem>
+    void place_internal(size_t hash, TItem&& item);
+    void grow_internal(size_t count);
+    void migrate_internal(size_t count);
+    void release_internal();
+    template <typename TItem>
+    bool place_range_internal(size_t hash, TItem&& item, size_t end, bool check, size_t& placed);
+    template <typename TSelect, typename THashOf, typename TPlace, typename TDefer>
+    void parallel_internal(size_t count, size_t threads, TSelect select, THashOf hash, TPlace place, TDefer defer);
+
+    // Hash map slots are new buckets followed by old buckets under migration
+    size_t slots() const noexcept { return _buckets.size() + _old_buckets.size(); }
+    bool occupied(size_t index) const noexcept { return (index < _buckets.size()) ? (_tags[index] < EMPTY) : (_old_tags[index - _buckets.size()] < EMPTY); }
+    value_type& slot(size_t index) noexcept { return (index < _buckets.size()) ? _buckets[index] : _old_buckets[index - _buckets.size()]; }
+    const value_type& slot(size_t index) const noexcept { return (index < _buckets.size()) ? _buckets[index] : _old_buckets[index - _buckets.size()]; }
+    size_t slot_hash(size_t index) const noexcept { return (index < _buckets.size()) ? _hashes[index] : _old_hashes[index - _buckets.size()]; }
+
+    size_t probe(const std::vector<value_type, TAllocator>& buckets, const tags_type& tags, size_t hash, const TKey& key) const noexcept;
+    static uint32_t group_match(const tags_type& tags, size_t index, uint8_t tag) noexcept;
+    static void set_tag(tags_type& tags, size_t count, size_t index, uint8_t tag) noexcept;
     size_t next_index(size_t index) const noexcept;
     size_t diff(size_t index1, size_t index2) const noexcept;
 };
@@ -10,12 +10,14 @@ namespace CppCommon {
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
 inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(size_t capacity, const TKey& blank, const THash& hash, const TEqual& equal, const TAllocator& allocator)
-    : _hash(hash), _equal(equal), _blank(blank), _size(0), _buckets(allocator)
+    : _hash(hash), _equal(equal), _blank(blank), _size(0), _buckets(allocator), _incremental(false), _old_buckets(allocator), _old_size(0), _migrated(0)
 {
     size_t reserve = 1;
     while (reserve < capacity)
         reserve <<= 1;
     _buckets.resize(reserve, std::make_pair(_blank, TValue()));
+    _tags.resize(reserve + GROUP - 1, EMPTY);
+    _hashes.resize(reserve, 0);
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
@@ -31,16 +33,22 @@ template <typename TKey, typename TValue, typename THash, typename TEqual, typen
 inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(const HashMap& hashmap)
     : HashMap(hashmap.bucket_count(), hashmap._blank, hashmap._hash, hashmap._equal, hashmap._buckets.get_allocator())
 {
-    for (const auto& item : hashmap)
-        insert(item);
+    // Copy items with their stored hashes
+    for (size_t i = 0; i < hashmap.slots(); ++i)
+        if (hashmap.occupied(i))
+            place_internal(hashmap.slot_hash(i), hashmap.slot(i));
+    _incremental = hashmap._incremental;
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
 inline HashMap<TKey, TValue, THash, TEqual, TAllocator>::HashMap(const HashMap& hashmap, size_t capacity)
     : HashMap(capacity, hashmap._blank, hashmap._hash, hashmap._equal, hashmap._buckets.get_allocator())
 {
-    for (const auto& item : hashmap)
-        insert(item);
+    // Copy items with their stored hashes
+    for (size_t i = 0; i < hashmap.slots(); ++i)
+        if (hashmap.occupied(i))
+            place_internal(hashmap.slot_hash(i), hashmap.slot(i));
+    _incremental = hashmap._incremental;
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
@@ -130,13 +138,8 @@ inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator HashM
 {
     assert(!key_equal(key, _blank) && "Cannot find a blank key!");
 
-    for (size_t index = key_to_index(key);; index = next_index(index))
-    {
-        if (key_equal(_buckets[index].first, key))
-            return iterator(this, index);
-        if (key_equal(_buckets[index].first, _blank))
-            return end();
-    }
+    size_t index = find_internal(key);
+    return (index != NONE) ? iterator(this, index) : end();
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
@@ -144,13 +147,60 @@ inline typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::const_iterator
 {
     assert(!key_equal(key, _blank) && "Cannot find a blank key!");
 
-    for (size_t index = key_to_index(key);; index = next_index(index))
+    size_t index = find_internal(key);
+    return (index != NONE) ? const_iterator(this, index) : end();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::find_many(std::span<const TKey> keys, std::span<iterator> results) noexcept
+{
+    assert((results.size() >= keys.size()) && "Results must fit all keys!");
+
+    return find_many_internal(keys, [this, &results](size_t i, size_t index) { results[i] = (index != NONE) ? iterator(this, index) : end(); });
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::find_many(std::span<const TKey> keys, std::span<const_iterator> results) const noexcept
+{
+    assert((results.size() >= keys.size()) && "Results must fit all keys!");
+
+    return find_many_internal(keys, [this, &results](size_t i, size_t index) { results[i] = (index != NONE) ? const_iterator(this, index) : end(); });
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TResult>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::find_many_internal(std::span<const TKey> keys, TResult result) const noexcept
+{
+    size_t mask = _buckets.size() - 1;
+    size_t hashes[BATCH];
+    size_t found = 0;
+
+    for (size_t first = 0; first < keys.size(); first += BATCH)
     {
-        if (key_equal(_buckets[index].first, key))
-            return const_iterator(this, index);
-        if (key_equal(_buckets[index].first, _blank))
-            return end();
+        size_t count = std::min(BATCH, keys.size() - first);
+
+        // Calculate hashes of the batch and prefetch home tag groups and buckets
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(!key_equal(keys[first + i], _blank) && "Cannot find a blank key!");
+
+            size_t hash = _hash(keys[first + i]);
+            hashes[i] = hash;
+            Memory::Prefetch(_tags.data() + (hash & mask));
+            Memory::Prefetch(_buckets.data() + (hash & mask));
+        }
+
+        // Probe the batch keys while their cache lines are loaded
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t index = find_internal(keys[first + i], hashes[i]);
+            if (index != NONE)
+                ++found;
+            result(first + i, index);
+        }
     }
+
+    return found;
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
@@ -227,52 +277,254 @@ inline std::pair<typename HashMap<TKey, TValue, THash, TEqual, TAllocator>::iter
 {
     assert(!key_equal(key, _blank) && "Cannot emplace a blank key!");
 
-    reserve(_size + 1);
+    if (_incremental)
+    {
+        // Grow the hash map incrementally and migrate a bounded number of old buckets
+        grow_internal(_size + 1);
+        migrate_internal(MIGRATE);
+    }
+    else
+        reserve(_size + 1);
+
+    size_t hash = _hash(key);
+    uint8_t tag = hash_to_tag(hash);
+    size_t mask = _buckets.size() - 1;
+
+    // Move the existing item from old buckets under migration
+    if (rehashing())
+    {
+        size_t index = probe(_old_buckets, _old_tags, hash, key);
+        if (index != NONE)
+        {
+            place_internal(hash, std::move(_old_buckets[index]));
+            _old_buckets[index].first = _blank;
+            set_tag(_old_tags, _old_buckets.size(), index, DELETED);
+            --_size;
+            if (--_old_size == 0)
+                release_internal();
+            return std::make_pair(find(key), false);
+        }
+    }
 
-    for (size_t index = key_to_index(key);; index = next_index(index))
+    // Probe groups of tags from the key base index to the first group with a blank bucket
+    for (size_t index = hash & mask;; index = (index + GROUP) & mask)
     {
-        if (key_equal(_buckets[index].first, key))
-            return std::make_pair(iterator(this, index), false);
-        if (key_equal(_buckets[index].first, _blank))
+        for (uint32_t matches = group_match(_tags, index, tag); matches != 0; matches &= (matches - 1))
         {
-            _buckets[index].first = key;
-            _buckets[index].second = TValue(std::forward<Args>(args)...);
+            size_t current = (index + std::countr_zero(matches)) & mask;
+            if (key_equal(_buckets[current].first, key))
+                return std::make_pair(iterator(this, current), false);
+        }
+
+        uint32_t blanks = group_match(_tags, index, EMPTY);
+        if (blanks != 0)
+        {
+            // Insert the new item into the first blank bucket
+            size_t current = (index + std::countr_zero(blanks)) & mask;
+            _buckets[current].first = key;
+            _buckets[current].second = TValue(std::forward<Args>(args)...);
+            _hashes[current] = hash;
+            set_tag(_tags, _buckets.size(), current, tag);
             ++_size;
-            return std::make_pair(iterator(this, index), true);
+            return std::make_pair(iterator(this, current), true);
+        }
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::find_internal(const TKey& key) const noexcept
+{
+    return find_internal(key, _hash(key));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::find_internal(const TKey& key, size_t hash) const noexcept
+{
+    // Find the key in new buckets
+    size_t index = probe(_buckets, _tags, hash, key);
+    if (index != NONE)
+        return index;
+
+    // Find the key in old buckets under migration
+    if (rehashing())
+    {
+        index = probe(_old_buckets, _old_tags, hash, key);
+        if (index != NONE)
+            return _buckets.size() + index;
+    }
+
+    return NONE;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::probe(const std::vector<value_type, TAllocator>& buckets, const tags_type& tags, size_t hash, const TKey& key) const noexcept
+{
+    uint8_t tag = hash_to_tag(hash);
+    size_t mask = buckets.size() - 1;
+
+    // Probe groups of tags and compare full keys only on tag match
+    for (size_t index = hash & mask;; index = (index + GROUP) & mask)
+    {
+        for (uint32_t matches = group_match(tags, index, tag); matches != 0; matches &= (matches - 1))
+        {
+            size_t current = (index + std::countr_zero(matches)) & mask;
+            if (key_equal(buckets[current].first, key))
+                return current;
+        }
+
+        // Blank bucket in the group terminates the probe sequence
+        if (group_match(tags, index, EMPTY) != 0)
+            return NONE;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TItem>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::place_internal(size_t hash, TItem&& item)
+{
+    size_t mask = _buckets.size() - 1;
+
+    // Place the unique item into the first blank bucket of its probe sequence
+    for (size_t index = hash & mask;; index = (index + GROUP) & mask)
+    {
+        uint32_t blanks = group_match(_tags, index, EMPTY);
+        if (blanks != 0)
+        {
+            size_t current = (index + std::countr_zero(blanks)) & mask;
+            _buckets[current] = std::forward<TItem>(item);
+            _hashes[current] = hash;
+            set_tag(_tags, _buckets.size(), current, hash_to_tag(hash));
+            ++_size;
+            return;
+        }
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline uint32_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::group_match(const tags_type& tags, size_t index, uint8_t tag) noexcept
+{
+    const uint8_t* group = tags.data() + index;
+#if defined(CPPCOMMON_HASHMAP_SSE2)
+    __m128i values = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(values, _mm_set1_epi8((char)tag)));
+#elif defined(CPPCOMMON_HASHMAP_NEON)
+    static const uint8_t bits[GROUP] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t matches = vandq_u8(vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag)), vld1q_u8(bits));
+    return (uint32_t)vaddv_u8(vget_low_u8(matches)) | ((uint32_t)vaddv_u8(vget_high_u8(matches)) << 8);
+#else
+    uint32_t result = 0;
+    for (size_t i = 0; i < GROUP; ++i)
+        if (group[i] == tag)
+            result |= (1u << i);
+    return result;
+#endif
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::set_tag(tags_type& tags, size_t count, size_t index, uint8_t tag) noexcept
+{
+    // Update the tag and its mirrors after the end of the tags array
+    for (size_t i = index; i < (count + GROUP - 1); i += count)
+        tags[i] = tag;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::grow_internal(size_t count)
+{
+    if (_buckets.size() >= 2 * count)
+        return;
+
+    // Finish the previous migration
+    migrate_internal(_old_buckets.size());
+
+    size_t capacity = 1;
+    while (capacity < 2 * count)
+        capacity <<= 1;
+
+    // Keep current buckets as old ones and allocate new buckets
+    _old_buckets = std::move(_buckets);
+    _old_tags = std::move(_tags);
+    _old_hashes = std::move(_hashes);
+    _old_size = _size;
+    _migrated = 0;
+    _buckets = std::vector<value_type, TAllocator>(capacity, std::make_pair(_blank, TValue()), _old_buckets.get_allocator());
+    _tags.assign(capacity + GROUP - 1, EMPTY);
+    _hashes.assign(capacity, 0);
+
+    if (_old_size == 0)
+        release_internal();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::migrate_internal(size_t count)
+{
+    // Move old buckets into new ones leaving tombstones behind
+    for (; (count > 0) && rehashing(); --count)
+    {
+        size_t index = _migrated++;
+        if (_old_tags[index] < EMPTY)
+        {
+            place_internal(_old_hashes[index], std::move(_old_buckets[index]));
+            _old_buckets[index].first = _blank;
+            set_tag(_old_tags, _old_buckets.size(), index, DELETED);
+            --_size;
+            if (--_old_size == 0)
+                release_internal();
         }
     }
 }
 
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::release_internal()
+{
+    std::vector<value_type, TAllocator>(_buckets.get_allocator()).swap(_old_buckets);
+    tags_type().swap(_old_tags);
+    std::vector<size_t>().swap(_old_hashes);
+    _old_size = 0;
+    _migrated = 0;
+}
+
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
 inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::erase_internal(size_t index)
 {
+    if (index >= _buckets.size())
+    {
+        // Erase the old bucket under migration leaving the tombstone
+        index -= _buckets.size();
+        _old_buckets[index].first = _blank;
+        set_tag(_old_tags, _old_buckets.size(), index, DELETED);
+        --_size;
+        if (--_old_size == 0)
+            release_internal();
+        return;
+    }
+
+    if (_incremental)
+        migrate_internal(MIGRATE);
+
     size_t current = index;
     for (index = next_index(current);; index = next_index(index))
     {
-        if (key_equal(_buckets[index].first, _blank))
+        if (_tags[index] == EMPTY)
         {
             _buckets[current].first = _blank;
+            set_tag(_tags, _buckets.size(), current, EMPTY);
             --_size;
             return;
         }
 
         // Move buckets with the same key hash closer to the first suitable position in the hash map
-        size_t base = key_to_index(_buckets[index].first);
+        size_t base = _hashes[index] & (_buckets.size() - 1);
         if (diff(current, base) < diff(index, base))
         {
-            _buckets[current] = _buckets[index];
+            _buckets[current] = std::move(_buckets[index]);
+            _hashes[current] = _hashes[index];
+            set_tag(_tags, _buckets.size(), current, _tags[index]);
             current = index;
         }
     }
 }
 
-template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
-inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::key_to_index(const TKey& key) const noexcept
-{
-    size_t mask = _buckets.size() - 1;
-    return _hash(key) & mask;
-}
-
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
 inline size_t HashMap<TKey, TValue, THash, TEqual, TAllocator>::next_index(size_t index) const noexcept
 {
@@ -291,7 +543,14 @@ template <typename TKey, typename TValue, typename THash, typename TEqual, typen
 inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::rehash(size_t capacity)
 {
     capacity = std::max(capacity, 2 * size());
-    HashMap<TKey, TValue, THash, TEqual, TAllocator> temp(*this, capacity);
+    HashMap<TKey, TValue, THash, TEqual, TAllocator> temp(capacity, _blank, _hash, _equal, _buckets.get_allocator());
+    temp._incremental = _incremental;
+
+    // Move items with their stored hashes, so the key hasher is not called
+    for (size_t i = 0; i < slots(); ++i)
+        if (occupied(i))
+            temp.place_internal(slot_hash(i), std::move(slot(i)));
+
     swap(temp);
 }
 
@@ -302,12 +561,214 @@ inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::reserve(size_t cou
         rehash(2 * count);
 }
 
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::parallel_rehash(size_t capacity, size_t threads)
+{
+    capacity = std::max(capacity, 2 * size());
+    HashMap<TKey, TValue, THash, TEqual, TAllocator> temp(capacity, _blank, _hash, _equal, _buckets.get_allocator());
+    temp._incremental = _incremental;
+
+    // Move items with their stored hashes, so the key hasher is not called
+    temp.parallel_internal(slots(), threads,
+        [this](size_t index) { return occupied(index); },
+        [this](size_t index) { return slot_hash(index); },
+        [this, &temp](size_t index, size_t hash, size_t end, size_t& placed) { return temp.place_range_internal(hash, std::move(slot(index)), end, false, placed); },
+        [this, &temp](size_t index, size_t hash) { temp.place_internal(hash, std::move(slot(index))); });
+
+    swap(temp);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <class RandomIterator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::parallel_insert(RandomIterator first, RandomIterator last, size_t threads)
+{
+    size_t count = (size_t)std::distance(first, last);
+
+    // Reserve the hash map capacity or finish the pending incremental migration
+    if (_buckets.size() < 2 * (_size + count))
+        parallel_rehash(2 * (_size + count), threads);
+    else
+        migrate_internal(_old_buckets.size());
+
+    parallel_internal(count, threads,
+        [](size_t) { return true; },
+        [this, &first](size_t index) { assert(!key_equal(first[index].first, _blank) && "Cannot insert a blank key!"); return _hash(first[index].first); },
+        [this, &first](size_t index, size_t hash, size_t end, size_t& placed) { return place_range_internal(hash, first[index], end, true, placed); },
+        [this, &first](size_t index, size_t) { insert(first[index]); });
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TItem>
+inline bool HashMap<TKey, TValue, THash, TEqual, TAllocator>::place_range_internal(size_t hash, TItem&& item, size_t end, bool check, size_t& placed)
+{
+    uint8_t tag = hash_to_tag(hash);
+
+    // Probe groups of tags until the probe sequence leaves the range of buckets
+    for (size_t index = hash & (_buckets.size() - 1); (index + GROUP) <= end; index += GROUP)
+    {
+        // Skip the item with the existing key
+        if (check)
+            for (uint32_t matches = group_match(_tags, index, tag); matches != 0; matches &= (matches - 1))
+                if (key_equal(_buckets[index + std::countr_zero(matches)].first, item.first))
+                    return true;
+
+        uint32_t blanks = group_match(_tags, index, EMPTY);
+        if (blanks != 0)
+        {
+            // Update only the tag, its mirrors are updated after all ranges are built
+            size_t current = index + std::countr_zero(blanks);
+            _buckets[current] = std::forward<TItem>(item);
+            _hashes[current] = hash;
+            _tags[current] = tag;
+            ++placed;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TSelect, typename THashOf, typename TPlace, typename TDefer>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::parallel_internal(size_t count, size_t threads, TSelect select, THashOf hash, TPlace place, TDefer defer)
+{
+    if (threads == 0)
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    // Split buckets into the power of two count of ranges (several ranges per thread for better balance)
+    size_t buckets = _buckets.size();
+    size_t ranges = 1;
+    while ((ranges < 4 * threads) && ((buckets / (2 * ranges)) >= PARALLEL))
+        ranges <<= 1;
+
+    // Place items sequentially into small hash maps
+    if ((threads == 1) || (ranges == 1))
+    {
+        for (size_t i = 0; i < count; ++i)
+            if (select(i))
+                defer(i, hash(i));
+        return;
+    }
+
+    size_t shift = (size_t)std::countr_zero(buckets / ranges);
+    size_t mask = buckets - 1;
+
+    // Run the given task in all worker threads and return the first thrown exception
+    auto run = [threads](auto task)
+    {
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        auto work = [&task, &errors](size_t worker)
+        {
+            try { task(worker); } catch (...) { errors[worker] = std::current_exception(); }
+        };
+        for (size_t worker = 1; worker < threads; ++worker)
+            workers.emplace_back(work, worker);
+        work(0);
+        for (auto& worker : workers)
+            worker.join();
+        for (auto& error : errors)
+            if (error)
+                return error;
+        return std::exception_ptr();
+    };
+
+    std::vector<size_t> hashes(count);
+    std::vector<size_t> order(count);
+    std::vector<size_t> offsets(threads * ranges, 0);
+    std::vector<size_t> bounds(ranges + 1, 0);
+
+    // Calculate hashes and count items of each range in each chunk of items
+    std::exception_ptr error = run([&](size_t worker)
+    {
+        for (size_t i = count * worker / threads; i < count * (worker + 1) / threads; ++i)
+        {
+            if (select(i))
+            {
+                hashes[i] = hash(i);
+                ++offsets[worker * ranges + ((hashes[i] & mask) >> shift)];
+            }
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+
+    // Calculate offsets of chunks of items, so items of each range keep their order
+    size_t offset = 0;
+    for (size_t range = 0; range < ranges; ++range)
+    {
+        bounds[range] = offset;
+        for (size_t worker = 0; worker < threads; ++worker)
+        {
+            size_t current = offsets[worker * ranges + range];
+            offsets[worker * ranges + range] = offset;
+            offset += current;
+        }
+    }
+    bounds[ranges] = offset;
+
+    // Partition items by ranges
+    run([&](size_t worker)
+    {
+        for (size_t i = count * worker / threads; i < count * (worker + 1) / threads; ++i)
+            if (select(i))
+                order[offsets[worker * ranges + ((hashes[i] & mask) >> shift)]++] = i;
+    });
+
+    // Build disjoint ranges of buckets without locks and defer items which probe sequences leave their range
+    std::vector<size_t> placed(threads, 0);
+    std::vector<std::vector<size_t>> deferred(ranges);
+    error = run([&](size_t worker)
+    {
+        size_t current = 0;
+        try
+        {
+            for (size_t range = worker; range < ranges; range += threads)
+            {
+                size_t end = (range + 1) << shift;
+                for (size_t i = bounds[range]; i < bounds[range + 1]; ++i)
+                    if (!place(order[i], hashes[order[i]], end, current))
+                        deferred[range].push_back(order[i]);
+            }
+        }
+        catch (...)
+        {
+            placed[worker] = current;
+            throw;
+        }
+        placed[worker] = current;
+    });
+
+    // Stitch ranges of buckets together updating mirrored tags and the hash map size
+    std::copy(_tags.begin(), _tags.begin() + (GROUP - 1), _tags.begin() + buckets);
+    for (size_t current : placed)
+        _size += current;
+    if (error)
+        std::rethrow_exception(error);
+
+    // Place deferred items sequentially
+    for (const auto& items : deferred)
+        for (size_t i : items)
+            defer(i, hashes[i]);
+}
+
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
 inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::clear() noexcept
 {
     _size = 0;
     for (auto& bucket : _buckets)
         bucket.first = _blank;
+    std::fill(_tags.begin(), _tags.end(), EMPTY);
+    release_internal();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::set_incremental(bool incremental)
+{
+    _incremental = incremental;
+    if (!_incremental)
+        migrate_internal(_old_buckets.size());
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
@@ -319,6 +780,14 @@ inline void HashMap<TKey, TValue, THash, TEqual, TAllocator>::swap(HashMap& hash
     swap(_blank, hashmap._blank);
     swap(_size, hashmap._size);
     swap(_buckets, hashmap._buckets);
+    swap(_tags, hashmap._tags);
+    swap(_hashes, hashmap._hashes);
+    swap(_incremental, hashmap._incremental);
+    swap(_old_buckets, hashmap._old_buckets);
+    swap(_old_tags, hashmap._old_tags);
+    swap(_old_hashes, hashmap._old_hashes);
+    swap(_old_size, hashmap._old_size);
+    swap(_migrated, hashmap._migrated);
 }
 
 template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
@@ -341,9 +810,9 @@ inline HashMapIterator<TContainer, TKey, TValue>::HashMapIterator(TContainer* co
         }
         else
         {
-            for (size_t i = 0; i < _container->_buckets.size(); ++i)
+            for (size_t i = 0; i < _container->slots(); ++i)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (_container->occupied(i))
                 {
                     _index = i;
                     return;
@@ -360,9 +829,9 @@ HashMapIterator<TContainer, TKey, TValue>& HashMapIterator<TContainer, TKey, TVa
 {
     if (_container != nullptr)
     {
-        for (size_t i = _index + 1; i < _container->_buckets.size(); ++i)
+        for (size_t i = _index + 1; i < _container->slots(); ++i)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (_container->occupied(i))
             {
                 _index = i;
                 return *this;
@@ -388,15 +857,15 @@ inline HashMapIterator<TContainer, TKey, TValue> HashMapIterator<TContainer, TKe
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapIterator<TContainer, TKey, TValue>::reference HashMapIterator<TContainer, TKey, TValue>::operator*() noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->slots())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->slot(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapIterator<TContainer, TKey, TValue>::pointer HashMapIterator<TContainer, TKey, TValue>::operator->() noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->slots())) ? &_container->slot(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -427,9 +896,9 @@ inline HashMapConstIterator<TContainer, TKey, TValue>::HashMapConstIterator(cons
         }
         else
         {
-            for (size_t i = 0; i < _container->_buckets.size(); ++i)
+            for (size_t i = 0; i < _container->slots(); ++i)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (_container->occupied(i))
                 {
                     _index = i;
                     return;
@@ -446,9 +915,9 @@ HashMapConstIterator<TContainer, TKey, TValue>& HashMapConstIterator<TContainer,
 {
     if (_container != nullptr)
     {
-        for (size_t i = _index + 1; i < _container->_buckets.size(); ++i)
+        for (size_t i = _index + 1; i < _container->slots(); ++i)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (_container->occupied(i))
             {
                 _index = i;
                 return *this;
@@ -474,15 +943,15 @@ inline HashMapConstIterator<TContainer, TKey, TValue> HashMapConstIterator<TCont
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstIterator<TContainer, TKey, TValue>::const_reference HashMapConstIterator<TContainer, TKey, TValue>::operator*() const noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->slots())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->slot(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstIterator<TContainer, TKey, TValue>::const_pointer HashMapConstIterator<TContainer, TKey, TValue>::operator->() const noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->slots())) ? &_container->slot(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -513,9 +982,9 @@ inline HashMapReverseIterator<TContainer, TKey, TValue>::HashMapReverseIterator(
         }
         else
         {
-            for (size_t i = _container->_buckets.size(); i-- > 0;)
+            for (size_t i = _container->slots(); i-- > 0;)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (_container->occupied(i))
                 {
                     _index = i;
                     return;
@@ -534,7 +1003,7 @@ HashMapReverseIterator<TContainer, TKey, TValue>& HashMapReverseIterator<TContai
     {
         for (size_t i = _index; i-- > 0;)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (_container->occupied(i))
             {
                 _index = i;
                 return *this;
@@ -560,15 +1029,15 @@ inline HashMapReverseIterator<TContainer, TKey, TValue> HashMapReverseIterator<T
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapReverseIterator<TContainer, TKey, TValue>::reference HashMapReverseIterator<TContainer, TKey, TValue>::operator*() noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->slots())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->slot(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapReverseIterator<TContainer, TKey, TValue>::pointer HashMapReverseIterator<TContainer, TKey, TValue>::operator->() noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->slots())) ? &_container->slot(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
@@ -599,9 +1068,9 @@ inline HashMapConstReverseIterator<TContainer, TKey, TValue>::HashMapConstRevers
         }
         else
         {
-            for (size_t i = _container->_buckets.size(); i-- > 0;)
+            for (size_t i = _container->slots(); i-- > 0;)
             {
-                if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+                if (_container->occupied(i))
                 {
                     _index = i;
                     return;
@@ -620,7 +1089,7 @@ HashMapConstReverseIterator<TContainer, TKey, TValue>& HashMapConstReverseIterat
     {
         for (size_t i = _index; i-- > 0;)
         {
-            if (!_container->key_equal(_container->_buckets[i].first, _container->_blank))
+            if (_container->occupied(i))
             {
                 _index = i;
                 return *this;
@@ -646,15 +1115,15 @@ inline HashMapConstReverseIterator<TContainer, TKey, TValue> HashMapConstReverse
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstReverseIterator<TContainer, TKey, TValue>::const_reference HashMapConstReverseIterator<TContainer, TKey, TValue>::operator*() const noexcept
 {
-    assert(((_container != nullptr) && (_index < _container->_buckets.size())) && "Iterator must be valid!");
+    assert(((_container != nullptr) && (_index < _container->slots())) && "Iterator must be valid!");
 
-    return _container->_buckets[_index];
+    return _container->slot(_index);
 }
 
 template <class TContainer, typename TKey, typename TValue>
 typename HashMapConstReverseIterator<TContainer, TKey, TValue>::const_pointer HashMapConstReverseIterator<TContainer, TKey, TValue>::operator->() const noexcept
 {
-    return ((_container != nullptr) && (_index < _container->_buckets.size())) ? &_container->_buckets[_index] : nullptr;
+    return ((_container != nullptr) && (_index < _container->slots())) ? &_container->slot(_index) : nullptr;
 }
 
 template <class TContainer, typename TKey, typename TValue>
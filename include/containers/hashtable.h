@@ -0,0 +1,366 @@
+/*!
+    \file hashtable.h
+    \brief Intrusive hash table container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_HASHTABLE_H
+#define CPPCOMMON_CONTAINERS_HASHTABLE_H
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class HashTableIterator;
+template <class TContainer, typename T>
+class HashTableConstIterator;
+
+//! Intrusive hash table node
+/*!
+    Item must inherit the node of each hash table it is linked into. Nodes
+    of different hash tables are distinguished by the key extractor type,
+    which could be incomplete at the point of the item declaration:
+
+    \code{.cpp}
+    struct Order : public HashTableNode<Order, struct OrderById>, public HashTableNode<Order, struct OrderByClient>
+    {
+        uint64_t id;
+        uint64_t client;
+    };
+    \endcode
+*/
+template <typename T, typename TKeyOf>
+struct HashTableNode
+{
+    T* hash_next;       //!< Pointer to the next item in the hash table bucket
+    size_t hash_value;  //!< Hash value of the item key
+
+    HashTableNode() : hash_next(nullptr), hash_value(0) {}
+};
+
+//! Intrusive hash table key type
+template <typename T, typename TKeyOf>
+using HashTableKey = std::remove_cvref_t<std::invoke_result_t<const TKeyOf&, const T&>>;
+
+//! Intrusive hash table container
+/*!
+    Hash table indexes items which already live somewhere else (in a pool,
+    in an array or on the stack) by the key extracted from the item with
+    the TKeyOf function object. Links are embedded into items, so insert and
+    erase make no allocations except growing the bucket array, and the same
+    item could be indexed by several hash tables with different keys at the
+    same time.
+
+    Buckets are singly linked chains of items. Item nodes store key hashes,
+    so the key hasher is called once per insert and never during resize.
+    Items with equal keys could be inserted with insert_equal(), they are kept
+    adjacent in their chain and could be found with equal_range().
+
+    Resize is incremental: when the hash table grows, the old bucket array
+    is kept next to the new one and each insert migrates a bounded number of
+    old buckets, so the worst-case insert latency does not depend on the
+    hash table size. Lookups consult both arrays until migration finishes.
+
+    Inserts could migrate items between bucket arrays and invalidate
+    iterators. Erases invalidate only iterators to the erased item.
+
+    Not thread-safe.
+*/
+template <typename T, typename TKeyOf, typename THash = std::hash<HashTableKey<T, TKeyOf>>, typename TEqual = std::equal_to<HashTableKey<T, TKeyOf>>>
+class HashTable
+{
+    friend class HashTableIterator<HashTable<T, TKeyOf, THash, TEqual>, T>;
+    friend class HashTableConstIterator<HashTable<T, TKeyOf, THash, TEqual>, T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef HashTableKey<T, TKeyOf> key_type;
+    typedef THash hasher;
+    typedef TEqual key_equal;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef HashTableIterator<HashTable<T, TKeyOf, THash, TEqual>, T> iterator;
+    typedef HashTableConstIterator<HashTable<T, TKeyOf, THash, TEqual>, T> const_iterator;
+
+    //! Hash table node
+    typedef HashTableNode<T, TKeyOf> Node;
+
+    //! Initialize the hash table with a given capacity
+    /*!
+        \param capacity - Hash table capacity (default is 128)
+        \param key_of - Key extractor (default is TKeyOf())
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    explicit HashTable(size_t capacity = 128, const TKeyOf& key_of = TKeyOf(), const THash& hash = THash(), const TEqual& equal = TEqual());
+    template <class InputIterator>
+    HashTable(InputIterator first, InputIterator last, size_t capacity = 128, const TKeyOf& key_of = TKeyOf(), const THash& hash = THash(), const TEqual& equal = TEqual());
+    HashTable(const HashTable&) = delete;
+    HashTable(HashTable&&) noexcept = default;
+    ~HashTable() noexcept = default;
+
+    HashTable& operator=(const HashTable&) = delete;
+    HashTable& operator=(HashTable&&) noexcept = default;
+
+    //! Check if the hash table is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the hash table empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the hash table size
+    size_t size() const noexcept { return _size; }
+    //! Get the hash table bucket count
+    size_t bucket_count() const noexcept { return _buckets.size(); }
+
+    //! Is the incremental resize in progress?
+    bool rehashing() const noexcept { return !_old_buckets.empty(); }
+
+    //! Get the key of the given item
+    key_type key(const T& item) const noexcept { return _key_of(item); }
+
+    //! Get the begin hash table iterator
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end hash table iterator
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Find the iterator which points to the first item with the given key in the hash table or return end iterator
+    iterator find(const key_type& key) noexcept;
+    const_iterator find(const key_type& key) const noexcept;
+
+    //! Find the bounds of a range that includes all the items in the hash table with the given key
+    std::pair<iterator, iterator> equal_range(const key_type& key) noexcept;
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const noexcept;
+
+    //! Find the count of items with the given key
+    size_t count(const key_type& key) const noexcept;
+    //! Is the hash table contains an item with the given key?
+    bool contains(const key_type& key) const noexcept { return find(key) != end(); }
+
+    //! Insert a new item with the unique key into the hash table
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted or existing item and success flag
+    */
+    std::pair<iterator, bool> insert(T& item);
+    //! Insert a new item into the hash table allowing equal keys
+    /*!
+        \param item - Item to insert
+        \return Iterator to the inserted item
+    */
+    iterator insert_equal(T& item);
+
+    //! Erase the first item with the given key from the hash table
+    /*!
+        \param key - Key of the item to erase
+        \return Erased item or nullptr if the given key was not found
+    */
+    T* erase(const key_type& key) noexcept;
+    //! Erase the item by its iterator from the hash table
+    /*!
+        \param it - Iterator to the erased item
+        \return Iterator to the next item
+    */
+    iterator erase(const const_iterator& it) noexcept;
+    //! Unlink the given item from the hash table
+    /*!
+        \param item - Item to unlink
+        \return 'true' if the item was unlinked, 'false' if the item was not found in the hash table
+    */
+    bool unlink(T& item) noexcept;
+
+    //! Rehash the hash table to the given capacity or more
+    /*!
+        Explicit rehash finishes the pending incremental migration and moves
+        all items at once.
+
+        \param capacity - Hash table capacity
+    */
+    void rehash(size_t capacity);
+    //! Reserve the hash table capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+
+    //! Clear the hash table
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(HashTable& hashtable) noexcept;
+    template <typename U, typename UKeyOf, typename UHash, typename UEqual>
+    friend void swap(HashTable<U, UKeyOf, UHash, UEqual>& hashtable1, HashTable<U, UKeyOf, UHash, UEqual>& hashtable2) noexcept;
+
+private:
+    TKeyOf _key_of;                 // Hash table key extractor
+    THash _hash;                    // Hash table key hasher
+    TEqual _equal;                  // Hash table key comparator
+    size_t _size;                   // Hash table size
+    std::vector<T*> _buckets;       // Hash table buckets
+    std::vector<T*> _old_buckets;   // Hash table old buckets under migration
+    size_t _old_size;               // Hash table count of items not migrated yet
+    size_t _migrated;               // Hash table migration cursor in old buckets
+
+    static constexpr size_t MIGRATE = 8;
+
+    static Node& node(T& item) noexcept { return static_cast<Node&>(item); }
+    static const Node& node(const T& item) noexcept { return static_cast<const Node&>(item); }
+
+    // Hash table slots are new buckets followed by old buckets under migration
+    size_t slots() const noexcept { return _buckets.size() + _old_buckets.size(); }
+    T*& slot(size_t index) noexcept { return (index < _buckets.size()) ? _buckets[index] : _old_buckets[index - _buckets.size()]; }
+    T* slot(size_t index) const noexcept { return (index < _buckets.size()) ? _buckets[index] : _old_buckets[index - _buckets.size()]; }
+    size_t new_slot(size_t hash) const noexcept { return hash & (_buckets.size() - 1); }
+    size_t old_slot(size_t hash) const noexcept { return _buckets.size() + (hash & (_old_buckets.size() - 1)); }
+    size_t next_slot(size_t index) const noexcept;
+
+    bool match(const T* item, size_t hash, const key_type& key) const noexcept { return (node(*item).hash_value == hash) && _equal(_key_of(*item), key); }
+    std::pair<size_t, T*> find_internal(const key_type& key) const noexcept;
+    std::pair<size_t, T*> find_internal(size_t hash, const key_type& key) const noexcept;
+    void link_internal(size_t index, T* prev, T& item) noexcept;
+    void unlink_internal(size_t index, T* prev, T& item) noexcept;
+    T* prev_internal(size_t index, const T& item) const noexcept;
+    void prepare_internal(size_t hash);
+    void migrate_bucket(size_t index) noexcept;
+    void migrate_internal(size_t count) noexcept;
+};
+
+//! Intrusive hash table iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class HashTableIterator
+{
+    friend HashTableConstIterator<TContainer, T>;
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    HashTableIterator() noexcept : _container(nullptr), _slot(0), _node(nullptr) {}
+    explicit HashTableIterator(TContainer* container, size_t slot, T* node) noexcept : _container(container), _slot(slot), _node(node) {}
+    HashTableIterator(const HashTableIterator& it) noexcept = default;
+    HashTableIterator(HashTableIterator&& it) noexcept = default;
+    ~HashTableIterator() noexcept = default;
+
+    HashTableIterator& operator=(const HashTableIterator& it) noexcept = default;
+    HashTableIterator& operator=(HashTableIterator&& it) noexcept = default;
+
+    friend bool operator==(const HashTableIterator& it1, const HashTableIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._node == it2._node); }
+    friend bool operator!=(const HashTableIterator& it1, const HashTableIterator& it2) noexcept
+    { return (it1._container != it2._container) || (it1._node != it2._node); }
+
+    HashTableIterator& operator++() noexcept;
+    HashTableIterator operator++(int) noexcept;
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != nullptr); }
+
+    //! Swap two instances
+    void swap(HashTableIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(HashTableIterator<UContainer, U>& it1, HashTableIterator<UContainer, U>& it2) noexcept;
+
+private:
+    TContainer* _container;
+    size_t _slot;
+    T* _node;
+};
+
+//! Intrusive hash table constant iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class HashTableConstIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    HashTableConstIterator() noexcept : _container(nullptr), _slot(0), _node(nullptr) {}
+    explicit HashTableConstIterator(const TContainer* container, size_t slot, const T* node) noexcept : _container(container), _slot(slot), _node(node) {}
+    HashTableConstIterator(const HashTableIterator<TContainer, T>& it) noexcept : _container(it._container), _slot(it._slot), _node(it._node) {}
+    HashTableConstIterator(const HashTableConstIterator& it) noexcept = default;
+    HashTableConstIterator(HashTableConstIterator&& it) noexcept = default;
+    ~HashTableConstIterator() noexcept = default;
+
+    HashTableConstIterator& operator=(const HashTableIterator<TContainer, T>& it) noexcept
+    { _container = it._container; _slot = it._slot; _node = it._node; return *this; }
+    HashTableConstIterator& operator=(const HashTableConstIterator& it) noexcept = default;
+    HashTableConstIterator& operator=(HashTableConstIterator&& it) noexcept = default;
+
+    friend bool operator==(const HashTableConstIterator& it1, const HashTableConstIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._node == it2._node); }
+    friend bool operator!=(const HashTableConstIterator& it1, const HashTableConstIterator& it2) noexcept
+    { return (it1._container != it2._container) || (it1._node != it2._node); }
+
+    HashTableConstIterator& operator++() noexcept;
+    HashTableConstIterator operator++(int) noexcept;
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != nullptr); }
+
+    //! Swap two instances
+    void swap(HashTableConstIterator& it) noexcept;
+    template <class UContainer, typename U>
+    friend void swap(HashTableConstIterator<UContainer, U>& it1, HashTableConstIterator<UContainer, U>& it2) noexcept;
+
+private:
+    const TContainer* _container;
+    size_t _slot;
+    const T* _node;
+};
+
+/*! \example containers_hashtable.cpp Intrusive hash table container example */
+
+} // namespace CppCommon
+
+#include "hashtable.inl"
+
+#endif // CPPCOMMON_CONTAINERS_HASHTABLE_H
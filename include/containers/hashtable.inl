@@ -0,0 +1,503 @@
+/*!
+    \file hashtable.inl
+    \brief Intrusive hash table container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline HashTable<T, TKeyOf, THash, TEqual>::HashTable(size_t capacity, const TKeyOf& key_of, const THash& hash, const TEqual& equal)
+    : _key_of(key_of), _hash(hash), _equal(equal), _size(0), _old_size(0), _migrated(0)
+{
+    _buckets.resize(std::bit_ceil(std::max((size_t)8, capacity)), nullptr);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+template <class InputIterator>
+inline HashTable<T, TKeyOf, THash, TEqual>::HashTable(InputIterator first, InputIterator last, size_t capacity, const TKeyOf& key_of, const THash& hash, const TEqual& equal)
+    : HashTable(capacity, key_of, hash, equal)
+{
+    for (auto it = first; it != last; ++it)
+        insert(*it);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline size_t HashTable<T, TKeyOf, THash, TEqual>::next_slot(size_t index) const noexcept
+{
+    size_t count = slots();
+    while ((index < count) && (slot(index) == nullptr))
+        ++index;
+    return index;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::iterator HashTable<T, TKeyOf, THash, TEqual>::begin() noexcept
+{
+    size_t index = next_slot(0);
+    return iterator(this, index, (index < slots()) ? slot(index) : nullptr);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator HashTable<T, TKeyOf, THash, TEqual>::begin() const noexcept
+{
+    size_t index = next_slot(0);
+    return const_iterator(this, index, (index < slots()) ? slot(index) : nullptr);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator HashTable<T, TKeyOf, THash, TEqual>::cbegin() const noexcept
+{
+    return begin();
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::iterator HashTable<T, TKeyOf, THash, TEqual>::end() noexcept
+{
+    return iterator(this, slots(), nullptr);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator HashTable<T, TKeyOf, THash, TEqual>::end() const noexcept
+{
+    return const_iterator(this, slots(), nullptr);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator HashTable<T, TKeyOf, THash, TEqual>::cend() const noexcept
+{
+    return end();
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline std::pair<size_t, T*> HashTable<T, TKeyOf, THash, TEqual>::find_internal(size_t hash, const key_type& key) const noexcept
+{
+    // Check the old bucket under migration first
+    if (rehashing())
+    {
+        size_t index = old_slot(hash);
+        for (T* item = slot(index); item != nullptr; item = node(*item).hash_next)
+            if (match(item, hash, key))
+                return std::make_pair(index, item);
+    }
+
+    size_t index = new_slot(hash);
+    for (T* item = slot(index); item != nullptr; item = node(*item).hash_next)
+        if (match(item, hash, key))
+            return std::make_pair(index, item);
+
+    return std::make_pair(slots(), (T*)nullptr);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline std::pair<size_t, T*> HashTable<T, TKeyOf, THash, TEqual>::find_internal(const key_type& key) const noexcept
+{
+    return find_internal(_hash(key), key);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::iterator HashTable<T, TKeyOf, THash, TEqual>::find(const key_type& key) noexcept
+{
+    auto result = find_internal(key);
+    return iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator HashTable<T, TKeyOf, THash, TEqual>::find(const key_type& key) const noexcept
+{
+    auto result = find_internal(key);
+    return const_iterator(this, result.first, result.second);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline std::pair<typename HashTable<T, TKeyOf, THash, TEqual>::iterator, typename HashTable<T, TKeyOf, THash, TEqual>::iterator> HashTable<T, TKeyOf, THash, TEqual>::equal_range(const key_type& key) noexcept
+{
+    size_t hash = _hash(key);
+    auto result = find_internal(hash, key);
+    iterator first(this, result.first, result.second);
+    iterator last(first);
+
+    // Items with equal keys are adjacent in their bucket
+    while (last && match(last._node, hash, key))
+        ++last;
+    return std::make_pair(first, last);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline std::pair<typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator, typename HashTable<T, TKeyOf, THash, TEqual>::const_iterator> HashTable<T, TKeyOf, THash, TEqual>::equal_range(const key_type& key) const noexcept
+{
+    size_t hash = _hash(key);
+    auto result = find_internal(hash, key);
+    const_iterator first(this, result.first, result.second);
+    const_iterator last(first);
+
+    // Items with equal keys are adjacent in their bucket
+    while (last && match(last._node, hash, key))
+        ++last;
+    return std::make_pair(first, last);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline size_t HashTable<T, TKeyOf, THash, TEqual>::count(const key_type& key) const noexcept
+{
+    auto range = equal_range(key);
+    return (size_t)std::distance(range.first, range.second);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::link_internal(size_t index, T* prev, T& item) noexcept
+{
+    if (prev != nullptr)
+    {
+        node(item).hash_next = node(*prev).hash_next;
+        node(*prev).hash_next = &item;
+    }
+    else
+    {
+        node(item).hash_next = slot(index);
+        slot(index) = &item;
+    }
+    ++_size;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::unlink_internal(size_t index, T* prev, T& item) noexcept
+{
+    if (prev != nullptr)
+        node(*prev).hash_next = node(item).hash_next;
+    else
+        slot(index) = node(item).hash_next;
+    node(item).hash_next = nullptr;
+    --_size;
+
+    // Release old buckets when the last old item is unlinked
+    if ((index >= _buckets.size()) && (--_old_size == 0))
+    {
+        std::vector<T*>().swap(_old_buckets);
+        _migrated = 0;
+    }
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline T* HashTable<T, TKeyOf, THash, TEqual>::prev_internal(size_t index, const T& item) const noexcept
+{
+    T* prev = nullptr;
+    for (T* current = slot(index); current != &item; current = node(*current).hash_next)
+        prev = current;
+    return prev;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::migrate_bucket(size_t index) noexcept
+{
+    T* item = _old_buckets[index];
+    _old_buckets[index] = nullptr;
+
+    // Move the whole chain, so items with equal keys stay adjacent
+    while (item != nullptr)
+    {
+        T* next = node(*item).hash_next;
+        size_t target = new_slot(node(*item).hash_value);
+        node(*item).hash_next = _buckets[target];
+        _buckets[target] = item;
+        --_old_size;
+        item = next;
+    }
+
+    if (_old_size == 0)
+    {
+        std::vector<T*>().swap(_old_buckets);
+        _migrated = 0;
+    }
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::migrate_internal(size_t count) noexcept
+{
+    for (size_t i = 0; (i < count) && rehashing(); ++i)
+    {
+        while (_old_buckets[_migrated] == nullptr)
+            ++_migrated;
+        migrate_bucket(_migrated++);
+    }
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::prepare_internal(size_t hash)
+{
+    // Start the incremental resize when the load factor exceeds 1
+    if (!rehashing() && ((_size + 1) > _buckets.size()))
+    {
+        std::vector<T*> buckets(_buckets.size() * 2, nullptr);
+        _old_buckets.swap(_buckets);
+        _buckets.swap(buckets);
+        _old_size = _size;
+        _migrated = 0;
+    }
+
+    if (rehashing())
+    {
+        migrate_internal(MIGRATE);
+
+        // Items with the given key must be placed into new buckets
+        if (rehashing())
+            migrate_bucket(old_slot(hash) - _buckets.size());
+    }
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline std::pair<typename HashTable<T, TKeyOf, THash, TEqual>::iterator, bool> HashTable<T, TKeyOf, THash, TEqual>::insert(T& item)
+{
+    const key_type& key = _key_of(item);
+    size_t hash = _hash(key);
+    prepare_internal(hash);
+
+    auto result = find_internal(hash, key);
+    if (result.second != nullptr)
+        return std::make_pair(iterator(this, result.first, result.second), false);
+
+    size_t index = new_slot(hash);
+    node(item).hash_value = hash;
+    link_internal(index, nullptr, item);
+    return std::make_pair(iterator(this, index, &item), true);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::iterator HashTable<T, TKeyOf, THash, TEqual>::insert_equal(T& item)
+{
+    const key_type& key = _key_of(item);
+    size_t hash = _hash(key);
+    prepare_internal(hash);
+
+    // Link the item next to the existing item with the equal key
+    auto result = find_internal(hash, key);
+    size_t index = (result.second != nullptr) ? result.first : new_slot(hash);
+    node(item).hash_value = hash;
+    link_internal(index, result.second, item);
+    return iterator(this, index, &item);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline T* HashTable<T, TKeyOf, THash, TEqual>::erase(const key_type& key) noexcept
+{
+    auto result = find_internal(key);
+    if (result.second == nullptr)
+        return nullptr;
+
+    unlink_internal(result.first, prev_internal(result.first, *result.second), *result.second);
+    return result.second;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline typename HashTable<T, TKeyOf, THash, TEqual>::iterator HashTable<T, TKeyOf, THash, TEqual>::erase(const const_iterator& it) noexcept
+{
+    assert((it._container == this) && (it._node != nullptr) && "Iterator must be valid!");
+
+    T* item = (T*)it._node;
+    iterator next(this, it._slot, item);
+    ++next;
+
+    unlink_internal(it._slot, prev_internal(it._slot, *item), *item);
+    return next;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline bool HashTable<T, TKeyOf, THash, TEqual>::unlink(T& item) noexcept
+{
+    size_t hash = node(item).hash_value;
+
+    // Find the item in its old and new buckets
+    size_t candidates[2] = { rehashing() ? old_slot(hash) : slots(), new_slot(hash) };
+    for (size_t index : candidates)
+    {
+        if (index >= slots())
+            continue;
+
+        T* prev = nullptr;
+        for (T* current = slot(index); current != nullptr; current = node(*current).hash_next)
+        {
+            if (current == &item)
+            {
+                unlink_internal(index, prev, item);
+                return true;
+            }
+            prev = current;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::rehash(size_t capacity)
+{
+    capacity = std::bit_ceil(std::max({ (size_t)8, capacity, _size }));
+    if ((capacity == _buckets.size()) && !rehashing())
+        return;
+
+    std::vector<T*> buckets(capacity, nullptr);
+
+    // Move whole chains, so items with equal keys stay adjacent
+    for (size_t index = 0; index < slots(); ++index)
+    {
+        T* item = slot(index);
+        while (item != nullptr)
+        {
+            T* next = node(*item).hash_next;
+            size_t target = node(*item).hash_value & (capacity - 1);
+            node(*item).hash_next = buckets[target];
+            buckets[target] = item;
+            item = next;
+        }
+    }
+
+    _buckets.swap(buckets);
+    std::vector<T*>().swap(_old_buckets);
+    _old_size = 0;
+    _migrated = 0;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::reserve(size_t count)
+{
+    if (count > _buckets.size())
+        rehash(count);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::clear() noexcept
+{
+    std::fill(_buckets.begin(), _buckets.end(), nullptr);
+    std::vector<T*>().swap(_old_buckets);
+    _size = 0;
+    _old_size = 0;
+    _migrated = 0;
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void HashTable<T, TKeyOf, THash, TEqual>::swap(HashTable& hashtable) noexcept
+{
+    using std::swap;
+    swap(_key_of, hashtable._key_of);
+    swap(_hash, hashtable._hash);
+    swap(_equal, hashtable._equal);
+    swap(_size, hashtable._size);
+    swap(_buckets, hashtable._buckets);
+    swap(_old_buckets, hashtable._old_buckets);
+    swap(_old_size, hashtable._old_size);
+    swap(_migrated, hashtable._migrated);
+}
+
+template <typename T, typename TKeyOf, typename THash, typename TEqual>
+inline void swap(HashTable<T, TKeyOf, THash, TEqual>& hashtable1, HashTable<T, TKeyOf, THash, TEqual>& hashtable2) noexcept
+{
+    hashtable1.swap(hashtable2);
+}
+
+template <class TContainer, typename T>
+HashTableIterator<TContainer, T>& HashTableIterator<TContainer, T>::operator++() noexcept
+{
+    if (_node != nullptr)
+    {
+        _node = TContainer::node(*_node).hash_next;
+        if (_node == nullptr)
+        {
+            _slot = _container->next_slot(_slot + 1);
+            _node = (_slot < _container->slots()) ? _container->slot(_slot) : nullptr;
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline HashTableIterator<TContainer, T> HashTableIterator<TContainer, T>::operator++(int) noexcept
+{
+    HashTableIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename HashTableIterator<TContainer, T>::reference HashTableIterator<TContainer, T>::operator*() noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return *_node;
+}
+
+template <class TContainer, typename T>
+typename HashTableIterator<TContainer, T>::pointer HashTableIterator<TContainer, T>::operator->() noexcept
+{
+    return _node;
+}
+
+template <class TContainer, typename T>
+void HashTableIterator<TContainer, T>::swap(HashTableIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_slot, it._slot);
+    swap(_node, it._node);
+}
+
+template <class TContainer, typename T>
+void swap(HashTableIterator<TContainer, T>& it1, HashTableIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+template <class TContainer, typename T>
+HashTableConstIterator<TContainer, T>& HashTableConstIterator<TContainer, T>::operator++() noexcept
+{
+    if (_node != nullptr)
+    {
+        _node = TContainer::node(*_node).hash_next;
+        if (_node == nullptr)
+        {
+            _slot = _container->next_slot(_slot + 1);
+            _node = (_slot < _container->slots()) ? _container->slot(_slot) : nullptr;
+        }
+    }
+    return *this;
+}
+
+template <class TContainer, typename T>
+inline HashTableConstIterator<TContainer, T> HashTableConstIterator<TContainer, T>::operator++(int) noexcept
+{
+    HashTableConstIterator<TContainer, T> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename T>
+typename HashTableConstIterator<TContainer, T>::const_reference HashTableConstIterator<TContainer, T>::operator*() const noexcept
+{
+    assert((_node != nullptr) && "Iterator must be valid!");
+
+    return *_node;
+}
+
+template <class TContainer, typename T>
+typename HashTableConstIterator<TContainer, T>::const_pointer HashTableConstIterator<TContainer, T>::operator->() const noexcept
+{
+    return _node;
+}
+
+template <class TContainer, typename T>
+void HashTableConstIterator<TContainer, T>::swap(HashTableConstIterator& it) noexcept
+{
+    using std::swap;
+    swap(_container, it._container);
+    swap(_slot, it._slot);
+    swap(_node, it._node);
+}
+
+template <class TContainer, typename T>
+void swap(HashTableConstIterator<TContainer, T>& it1, HashTableConstIterator<TContainer, T>& it2) noexcept
+{
+    it1.swap(it2);
+}
+
+} // namespace CppCommon
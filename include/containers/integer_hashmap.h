@@ -0,0 +1,271 @@
+/*!
+    \file integer_hashmap.h
+    \brief Integer keys hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_INTEGER_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_INTEGER_HASHMAP_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+template <class TContainer, typename TKey, typename TValue>
+class IntegerHashMapIterator;
+
+//! Integer keys hash map traits
+/*!
+    Traits provide the empty key value which marks blank buckets (so it cannot
+    be inserted into the hash map) and the key mixing hash. Default traits use
+    the maximal key value as the empty key and Fibonacci hashing, which spreads
+    sequential and strided integer keys over the whole 64-bit range.
+
+    Specialize or replace traits to change the empty key or the hash function.
+    The hash map takes bucket index from the high bits of the hash value.
+*/
+template <typename TKey>
+struct IntegerHashMapTraits
+{
+    //! Get the empty key value
+    static constexpr TKey empty() noexcept { return std::numeric_limits<TKey>::max(); }
+    //! Calculate the mixed hash of the given key
+    static constexpr uint64_t hash(TKey key) noexcept { return (uint64_t)key * 0x9E3779B97F4A7C15ull; }
+};
+
+//! Integer keys hash map container
+/*!
+    Integer keys hash map is a compact version of the open address hash map for
+    integral keys. Keys and values are stored in separate arrays (SoA), so there
+    is no padding of key/value pairs, no stored hashes and no tags: a probe
+    sequence scans the dense keys array only and touches the value on hit.
+
+    For HashMap<uint64_t, uint32_t> each bucket takes 12 bytes instead of 25 bytes
+    (padded pair, stored hash and tag).
+
+    Collisions are resolved with linear probing and erase uses backward shift
+    (no tombstones are used).
+
+    Iterators dereference to the pair of references to the key and the value.
+
+    Not thread-safe.
+*/
+template <typename TKey, typename TValue, class TTraits = IntegerHashMapTraits<TKey>>
+class IntegerHashMap
+{
+    static_assert(std::is_integral<TKey>::value, "Integer hash map key must be an integral type!");
+
+    friend class IntegerHashMapIterator<IntegerHashMap<TKey, TValue, TTraits>, TKey, TValue>;
+    friend class IntegerHashMapIterator<const IntegerHashMap<TKey, TValue, TTraits>, TKey, const TValue>;
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef size_t size_type;
+    typedef IntegerHashMapIterator<IntegerHashMap<TKey, TValue, TTraits>, TKey, TValue> iterator;
+    typedef IntegerHashMapIterator<const IntegerHashMap<TKey, TValue, TTraits>, TKey, const TValue> const_iterator;
+
+    //! Initialize the hash map with a given capacity
+    /*!
+        \param capacity - Hash map capacity (default is 128)
+    */
+    explicit IntegerHashMap(size_t capacity = 128);
+    IntegerHashMap(const IntegerHashMap&) = default;
+    IntegerHashMap(IntegerHashMap&&) = default;
+    ~IntegerHashMap() = default;
+
+    IntegerHashMap& operator=(const IntegerHashMap&) = default;
+    IntegerHashMap& operator=(IntegerHashMap&&) = default;
+
+    //! Check if the hash map is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given key or insert a new one
+    mapped_type& operator[](TKey key) { return _values[emplace_internal(key).first]; }
+
+    //! Is the hash map empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the hash map size
+    size_t size() const noexcept { return _size; }
+    //! Get the hash map bucket count
+    size_t bucket_count() const noexcept { return _keys.size(); }
+
+    //! Get the empty key value
+    static constexpr TKey blank() noexcept { return TTraits::empty(); }
+
+    //! Get the begin hash map iterator
+    iterator begin() noexcept { return iterator(this, next_occupied(0)); }
+    const_iterator begin() const noexcept { return const_iterator(this, next_occupied(0)); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    //! Get the end hash map iterator
+    iterator end() noexcept { return iterator(this, _keys.size()); }
+    const_iterator end() const noexcept { return const_iterator(this, _keys.size()); }
+    const_iterator cend() const noexcept { return end(); }
+
+    //! Find the iterator which points to the item with the given key in the hash map or return end iterator
+    iterator find(TKey key) noexcept;
+    const_iterator find(TKey key) const noexcept;
+
+    //! Find the count of items with the given key
+    size_t count(TKey key) const noexcept { return (find_internal(key) != NONE) ? 1 : 0; }
+
+    //! Access to the item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Item with the given key
+    */
+    mapped_type& at(TKey key);
+    //! Access to the constant item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Constant item with the given key
+    */
+    const mapped_type& at(TKey key) const;
+
+    //! Insert a new item into the hash map
+    /*!
+        \param item - Item to insert as a key/value pair
+        \return Pair with the iterator to the given key and success flag
+    */
+    std::pair<iterator, bool> insert(const value_type& item);
+
+    //! Emplace a new item into the hash map
+    /*!
+        \param key - Key of the item
+        \param args - Arguments to construct the value
+        \return Pair with the iterator to the given key and success flag
+    */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(TKey key, Args&&... args);
+
+    //! Erase the item with the given key from the hash map
+    /*!
+        \param key - Key of the item to erase
+        \return Number of erased elements (0 or 1 for the hash map)
+    */
+    size_t erase(TKey key);
+    //! Erase the item by its iterator from the hash map
+    /*!
+        \param position - Iterator position to the erased item
+    */
+    void erase(const const_iterator& position);
+
+    //! Rehash the hash map to the given capacity or more
+    /*!
+        \param capacity - Hash map capacity
+    */
+    void rehash(size_t capacity);
+    //! Reserve the hash map capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+
+    //! Clear the hash map
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(IntegerHashMap& hashmap) noexcept;
+    template <typename UKey, typename UValue, class UTraits>
+    friend void swap(IntegerHashMap<UKey, UValue, UTraits>& hashmap1, IntegerHashMap<UKey, UValue, UTraits>& hashmap2) noexcept;
+
+private:
+    size_t _size;               // Hash map size
+    size_t _shift;              // Hash map bucket index shift
+    std::vector<TKey> _keys;    // Hash map bucket keys
+    std::vector<TValue> _values; // Hash map bucket values
+
+    static constexpr size_t MIN_BUCKETS = 16;
+    static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+    size_t key_to_index(TKey key) const noexcept { return (size_t)(TTraits::hash(key) >> _shift); }
+    size_t next_index(size_t index) const noexcept { return (index + 1) & (_keys.size() - 1); }
+    size_t diff(size_t index1, size_t index2) const noexcept { return (index1 - index2) & (_keys.size() - 1); }
+    size_t next_occupied(size_t index) const noexcept;
+
+    template <typename... Args>
+    std::pair<size_t, bool> emplace_internal(TKey key, Args&&... args);
+    size_t find_internal(TKey key) const noexcept;
+    void erase_internal(size_t index);
+};
+
+//! Integer keys hash map iterator
+/*!
+    Iterator dereferences to the pair of references to the key and the value
+    stored in separate arrays of the hash map.
+
+    Not thread-safe.
+*/
+template <class TContainer, typename TKey, typename TValue>
+class IntegerHashMapIterator
+{
+    friend typename std::remove_const<TContainer>::type;
+
+public:
+    // Standard iterator type definitions
+    typedef std::pair<const TKey&, TValue&> value_type;
+    typedef value_type reference;
+    typedef ptrdiff_t difference_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    //! Iterator arrow proxy
+    struct pointer
+    {
+        value_type item;
+        value_type* operator->() noexcept { return &item; }
+    };
+
+    IntegerHashMapIterator() noexcept : _container(nullptr), _index(0) {}
+    IntegerHashMapIterator(TContainer* container, size_t index) noexcept : _container(container), _index(index) {}
+    template <class UContainer, typename UValue>
+    IntegerHashMapIterator(const IntegerHashMapIterator<UContainer, TKey, UValue>& it) noexcept : _container(it._container), _index(it._index) {}
+    IntegerHashMapIterator(const IntegerHashMapIterator&) noexcept = default;
+    ~IntegerHashMapIterator() noexcept = default;
+
+    IntegerHashMapIterator& operator=(const IntegerHashMapIterator&) noexcept = default;
+
+    friend bool operator==(const IntegerHashMapIterator& it1, const IntegerHashMapIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._index == it2._index); }
+    friend bool operator!=(const IntegerHashMapIterator& it1, const IntegerHashMapIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    IntegerHashMapIterator& operator++() noexcept;
+    IntegerHashMapIterator operator++(int) noexcept;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept { return pointer{ operator*() }; }
+
+    //! Get the key of the current item
+    TKey key() const noexcept { return _container->_keys[_index]; }
+    //! Get the value of the current item
+    TValue& value() const noexcept { return _container->_values[_index]; }
+
+private:
+    template <class UContainer, typename UKey, typename UValue>
+    friend class IntegerHashMapIterator;
+
+    TContainer* _container;
+    size_t _index;
+};
+
+/*! \example containers_integer_hashmap.cpp Integer keys hash map container example */
+
+} // namespace CppCommon
+
+#include "integer_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_INTEGER_HASHMAP_H
@@ -0,0 +1,238 @@
+/*!
+    \file integer_hashmap.inl
+    \brief Integer keys hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, class TTraits>
+inline IntegerHashMap<TKey, TValue, TTraits>::IntegerHashMap(size_t capacity)
+    : _size(0), _shift(64)
+{
+    size_t reserve = 1;
+    while ((reserve < capacity) || (reserve < MIN_BUCKETS))
+    {
+        reserve <<= 1;
+        --_shift;
+    }
+    _keys.resize(reserve, TTraits::empty());
+    _values.resize(reserve);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline typename IntegerHashMap<TKey, TValue, TTraits>::iterator IntegerHashMap<TKey, TValue, TTraits>::find(TKey key) noexcept
+{
+    size_t index = find_internal(key);
+    return (index != NONE) ? iterator(this, index) : end();
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline typename IntegerHashMap<TKey, TValue, TTraits>::const_iterator IntegerHashMap<TKey, TValue, TTraits>::find(TKey key) const noexcept
+{
+    size_t index = find_internal(key);
+    return (index != NONE) ? const_iterator(this, index) : end();
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline typename IntegerHashMap<TKey, TValue, TTraits>::mapped_type& IntegerHashMap<TKey, TValue, TTraits>::at(TKey key)
+{
+    size_t index = find_internal(key);
+    if (index == NONE)
+        throw std::out_of_range("Item with the given key was not found in the hash map!");
+
+    return _values[index];
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline const typename IntegerHashMap<TKey, TValue, TTraits>::mapped_type& IntegerHashMap<TKey, TValue, TTraits>::at(TKey key) const
+{
+    size_t index = find_internal(key);
+    if (index == NONE)
+        throw std::out_of_range("Item with the given key was not found in the hash map!");
+
+    return _values[index];
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline std::pair<typename IntegerHashMap<TKey, TValue, TTraits>::iterator, bool> IntegerHashMap<TKey, TValue, TTraits>::insert(const value_type& item)
+{
+    auto result = emplace_internal(item.first, item.second);
+    return std::make_pair(iterator(this, result.first), result.second);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+template <typename... Args>
+inline std::pair<typename IntegerHashMap<TKey, TValue, TTraits>::iterator, bool> IntegerHashMap<TKey, TValue, TTraits>::emplace(TKey key, Args&&... args)
+{
+    auto result = emplace_internal(key, std::forward<Args>(args)...);
+    return std::make_pair(iterator(this, result.first), result.second);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline size_t IntegerHashMap<TKey, TValue, TTraits>::erase(TKey key)
+{
+    size_t index = find_internal(key);
+    if (index == NONE)
+        return 0;
+
+    erase_internal(index);
+    return 1;
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void IntegerHashMap<TKey, TValue, TTraits>::erase(const const_iterator& position)
+{
+    erase_internal(position._index);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+template <typename... Args>
+inline std::pair<size_t, bool> IntegerHashMap<TKey, TValue, TTraits>::emplace_internal(TKey key, Args&&... args)
+{
+    assert((key != TTraits::empty()) && "Cannot emplace an empty key!");
+
+    reserve(_size + 1);
+
+    // Probe keys from the key base index to the first empty bucket
+    for (size_t index = key_to_index(key);; index = next_index(index))
+    {
+        if (_keys[index] == key)
+            return std::make_pair(index, false);
+
+        if (_keys[index] == TTraits::empty())
+        {
+            _keys[index] = key;
+            _values[index] = TValue(std::forward<Args>(args)...);
+            ++_size;
+            return std::make_pair(index, true);
+        }
+    }
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline size_t IntegerHashMap<TKey, TValue, TTraits>::find_internal(TKey key) const noexcept
+{
+    assert((key != TTraits::empty()) && "Cannot find an empty key!");
+
+    for (size_t index = key_to_index(key);; index = next_index(index))
+    {
+        if (_keys[index] == key)
+            return index;
+        if (_keys[index] == TTraits::empty())
+            return NONE;
+    }
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void IntegerHashMap<TKey, TValue, TTraits>::erase_internal(size_t index)
+{
+    size_t current = index;
+    for (index = next_index(current);; index = next_index(index))
+    {
+        if (_keys[index] == TTraits::empty())
+        {
+            _keys[current] = TTraits::empty();
+            --_size;
+            return;
+        }
+
+        // Move items closer to the first suitable position in the hash map (key hash is cheap to recalculate)
+        size_t base = key_to_index(_keys[index]);
+        if (diff(current, base) < diff(index, base))
+        {
+            _keys[current] = _keys[index];
+            _values[current] = std::move(_values[index]);
+            current = index;
+        }
+    }
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline size_t IntegerHashMap<TKey, TValue, TTraits>::next_occupied(size_t index) const noexcept
+{
+    while ((index < _keys.size()) && (_keys[index] == TTraits::empty()))
+        ++index;
+    return index;
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void IntegerHashMap<TKey, TValue, TTraits>::rehash(size_t capacity)
+{
+    IntegerHashMap<TKey, TValue, TTraits> temp(std::max(capacity, 2 * _size));
+
+    // Move items into the new buckets
+    for (size_t i = 0; i < _keys.size(); ++i)
+    {
+        if (_keys[i] != TTraits::empty())
+        {
+            size_t index = temp.key_to_index(_keys[i]);
+            while (temp._keys[index] != TTraits::empty())
+                index = temp.next_index(index);
+            temp._keys[index] = _keys[i];
+            temp._values[index] = std::move(_values[i]);
+            ++temp._size;
+        }
+    }
+
+    swap(temp);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void IntegerHashMap<TKey, TValue, TTraits>::reserve(size_t count)
+{
+    if (_keys.size() < 2 * count)
+        rehash(2 * count);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void IntegerHashMap<TKey, TValue, TTraits>::clear() noexcept
+{
+    _size = 0;
+    std::fill(_keys.begin(), _keys.end(), TTraits::empty());
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void IntegerHashMap<TKey, TValue, TTraits>::swap(IntegerHashMap& hashmap) noexcept
+{
+    using std::swap;
+    swap(_size, hashmap._size);
+    swap(_shift, hashmap._shift);
+    swap(_keys, hashmap._keys);
+    swap(_values, hashmap._values);
+}
+
+template <typename TKey, typename TValue, class TTraits>
+inline void swap(IntegerHashMap<TKey, TValue, TTraits>& hashmap1, IntegerHashMap<TKey, TValue, TTraits>& hashmap2) noexcept
+{
+    hashmap1.swap(hashmap2);
+}
+
+template <class TContainer, typename TKey, typename TValue>
+inline IntegerHashMapIterator<TContainer, TKey, TValue>& IntegerHashMapIterator<TContainer, TKey, TValue>::operator++() noexcept
+{
+    assert((_container != nullptr) && "Iterator must be valid!");
+
+    _index = _container->next_occupied(_index + 1);
+    return *this;
+}
+
+template <class TContainer, typename TKey, typename TValue>
+inline IntegerHashMapIterator<TContainer, TKey, TValue> IntegerHashMapIterator<TContainer, TKey, TValue>::operator++(int) noexcept
+{
+    IntegerHashMapIterator<TContainer, TKey, TValue> result(*this);
+    operator++();
+    return result;
+}
+
+template <class TContainer, typename TKey, typename TValue>
+inline typename IntegerHashMapIterator<TContainer, TKey, TValue>::reference IntegerHashMapIterator<TContainer, TKey, TValue>::operator*() const noexcept
+{
+    assert(((_container != nullptr) && (_index < _container->_keys.size())) && "Iterator must be valid!");
+
+    return reference(_container->_keys[_index], _container->_values[_index]);
+}
+
+} // namespace CppCommon
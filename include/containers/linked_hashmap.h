@@ -0,0 +1,325 @@
+/*!
+    \file linked_hashmap.h
+    \brief Linked hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_LINKED_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_LINKED_HASHMAP_H
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+template <class TContainer, typename TValueType>
+class LinkedHashMapIterator;
+
+//! Linked hash map container
+/*!
+    Linked hash map is a hash map which keeps items in the access order:
+    each item node embeds previous/next links of the doubly linked list, so
+    the least recently used item is found, moved to the newest end (touch)
+    or removed (pop_oldest) in O(1) with a single hash lookup and without
+    additional allocations. Together with the capacity limit it is the
+    building block of LRU caches, connection and session tables.
+
+    Item nodes are placed into the dense array and are linked by indices.
+    Erased nodes are reused by next inserts, so the node array grows only
+    when the hash map grows. Open addressing index table with linear probing
+    keeps node indices and stored key hashes, so it is rebuilt on growth
+    without calling the key hasher again and erased with backward shift
+    without tombstones.
+
+    Iterators are not invalidated by inserts, touches and erases of other
+    items, because nodes are never moved between indices. References and
+    pointers to items are invalidated when the node array grows.
+
+    Items are iterated from the oldest one to the newest one.
+
+    Not thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>, typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
+class LinkedHashMap
+{
+    friend class LinkedHashMapIterator<LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>, std::pair<TKey, TValue>>;
+    friend class LinkedHashMapIterator<const LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>, const std::pair<TKey, TValue>>;
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef LinkedHashMapIterator<LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>, std::pair<TKey, TValue>> iterator;
+    typedef LinkedHashMapIterator<const LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>, const std::pair<TKey, TValue>> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //! Initialize the linked hash map with a given capacity
+    /*!
+        \param capacity - Linked hash map capacity (default is 128)
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit LinkedHashMap(size_t capacity = 128, const THash& hash = THash(), const TEqual& equal = TEqual(), const TAllocator& allocator = TAllocator());
+    LinkedHashMap(const LinkedHashMap&) = default;
+    LinkedHashMap(LinkedHashMap&&) = default;
+    ~LinkedHashMap() = default;
+
+    LinkedHashMap& operator=(const LinkedHashMap&) = default;
+    LinkedHashMap& operator=(LinkedHashMap&&) = default;
+
+    //! Check if the linked hash map is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given key or insert a new one as the newest item
+    /*!
+        Access order of the existing item is not changed.
+    */
+    mapped_type& operator[](const TKey& key);
+
+    //! Is the linked hash map empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the linked hash map size
+    size_t size() const noexcept { return _size; }
+    //! Get the linked hash map maximum size
+    size_t max_size() const noexcept { return std::numeric_limits<size_type>::max(); }
+    //! Get the linked hash map bucket count
+    size_t bucket_count() const noexcept { return _index.size(); }
+
+    //! Get the begin linked hash map iterator (the oldest item)
+    iterator begin() noexcept { return iterator(this, _head); }
+    const_iterator begin() const noexcept { return const_iterator(this, _head); }
+    const_iterator cbegin() const noexcept { return const_iterator(this, _head); }
+    //! Get the end linked hash map iterator
+    iterator end() noexcept { return iterator(this, NONE); }
+    const_iterator end() const noexcept { return const_iterator(this, NONE); }
+    const_iterator cend() const noexcept { return const_iterator(this, NONE); }
+
+    //! Get the reverse begin linked hash map iterator (the newest item)
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    //! Get the reverse end linked hash map iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    //! Get the oldest item
+    reference oldest() noexcept { assert(!empty() && "Linked hash map is empty!"); return _nodes[_head].item; }
+    const_reference oldest() const noexcept { assert(!empty() && "Linked hash map is empty!"); return _nodes[_head].item; }
+    //! Get the newest item
+    reference newest() noexcept { assert(!empty() && "Linked hash map is empty!"); return _nodes[_tail].item; }
+    const_reference newest() const noexcept { assert(!empty() && "Linked hash map is empty!"); return _nodes[_tail].item; }
+
+    //! Find the iterator which points to the item with the given key or return end iterator
+    /*!
+        Access order is not changed, use touch() to mark the item as recently used.
+    */
+    iterator find(const TKey& key) noexcept { return iterator(this, find_internal(key)); }
+    const_iterator find(const TKey& key) const noexcept { return const_iterator(this, find_internal(key)); }
+
+    //! Find the count of items with the given key
+    size_t count(const TKey& key) const noexcept { return (find_internal(key) == NONE) ? 0 : 1; }
+    //! Is the linked hash map contains an item with the given key?
+    bool contains(const TKey& key) const noexcept { return (find_internal(key) != NONE); }
+
+    //! Access to the item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Item with the given key
+    */
+    mapped_type& at(const TKey& key);
+    //! Access to the constant item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Constant item with the given key
+    */
+    const mapped_type& at(const TKey& key) const;
+
+    //! Insert a new item into the linked hash map as the newest item
+    /*!
+        Access order of the existing item is not changed.
+
+        \param item - Item to insert as a key/value pair
+        \return Pair with the iterator to the given key and success flag
+    */
+    std::pair<iterator, bool> insert(const value_type& item) { return insert_internal(item); }
+    //! Insert a new item into the linked hash map as the newest item
+    /*!
+        \param item - Item to insert as a key/value pair
+        \return Pair with the iterator to the given key and success flag
+    */
+    std::pair<iterator, bool> insert(value_type&& item) { return insert_internal(std::move(item)); }
+
+    //! Emplace a new item into the linked hash map as the newest item
+    /*!
+        \param args - Arguments to emplace
+        \return Pair with the iterator to the given key and success flag
+    */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return insert_internal(value_type(std::forward<Args>(args)...)); }
+
+    //! Touch the item with the given key (move it to the newest end)
+    /*!
+        \param key - Key of the item to touch
+        \return Iterator to the touched item or end iterator if the given key was not found
+    */
+    iterator touch(const TKey& key) noexcept;
+    //! Touch the item by its iterator (move it to the newest end)
+    /*!
+        \param position - Iterator position to the touched item
+    */
+    void touch(const const_iterator& position) noexcept;
+
+    //! Pop the oldest item from the linked hash map
+    /*!
+        \return The oldest item
+    */
+    value_type pop_oldest();
+    //! Pop the newest item from the linked hash map
+    /*!
+        \return The newest item
+    */
+    value_type pop_newest();
+
+    //! Erase the item with the given key from the linked hash map
+    /*!
+        \param key - Key of the item to erase
+        \return Number of erased elements (0 or 1 for the linked hash map)
+    */
+    size_t erase(const TKey& key);
+    //! Erase the item by its iterator from the linked hash map
+    /*!
+        \param position - Iterator position to the erased item
+        \return Iterator to the next newer item
+    */
+    iterator erase(const const_iterator& position);
+
+    //! Rehash the linked hash map to the given capacity or more
+    /*!
+        \param capacity - Linked hash map capacity
+    */
+    void rehash(size_t capacity);
+    //! Reserve the linked hash map capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+
+    //! Clear the linked hash map
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(LinkedHashMap& hashmap) noexcept;
+    template <typename UKey, typename UValue, typename UHash, typename UEqual, typename UAllocator>
+    friend void swap(LinkedHashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap1, LinkedHashMap<UKey, UValue, UHash, UEqual, UAllocator>& hashmap2) noexcept;
+
+private:
+    static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+    // Item node with access order links
+    struct Node
+    {
+        value_type item;
+        size_t hash;
+        size_t prev;
+        size_t next;
+
+        template <typename TItem>
+        Node(TItem&& i, size_t h) : item(std::forward<TItem>(i)), hash(h), prev(NONE), next(NONE) {}
+    };
+
+    typedef typename std::allocator_traits<TAllocator>::template rebind_alloc<Node> node_allocator;
+
+    THash _hash;                            // Linked hash map key hasher
+    TEqual _equal;                          // Linked hash map key comparator
+    size_t _size;                           // Linked hash map size
+    std::vector<Node, node_allocator> _nodes; // Linked hash map item nodes
+    std::vector<size_t> _index;             // Linked hash map index table of node indices
+    size_t _head;                           // The oldest node index
+    size_t _tail;                           // The newest node index
+    size_t _free;                           // The first free node index
+
+    size_t probe_internal(size_t hash, const TKey& key) const noexcept;
+    size_t find_internal(const TKey& key) const noexcept;
+    template <typename TItem>
+    std::pair<iterator, bool> insert_internal(TItem&& item);
+    void erase_internal(size_t node);
+    void link_internal(size_t node) noexcept;
+    void unlink_internal(size_t node) noexcept;
+    void place_internal(size_t node) noexcept;
+};
+
+//! Linked hash map iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer, typename TValueType>
+class LinkedHashMapIterator
+{
+    friend TContainer;
+    template <class UContainer, typename UValueType>
+    friend class LinkedHashMapIterator;
+
+public:
+    // Standard iterator type definitions
+    typedef TValueType value_type;
+    typedef value_type& reference;
+    typedef value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    LinkedHashMapIterator() noexcept : _container(nullptr), _node(0) {}
+    explicit LinkedHashMapIterator(TContainer* container, size_t node) noexcept : _container(container), _node(node) {}
+    template <class UContainer, typename UValueType>
+    LinkedHashMapIterator(const LinkedHashMapIterator<UContainer, UValueType>& it) noexcept : _container(it._container), _node(it._node) {}
+
+    template <class UContainer, typename UValueType>
+    bool operator==(const LinkedHashMapIterator<UContainer, UValueType>& it) const noexcept { return (_container == it._container) && (_node == it._node); }
+    template <class UContainer, typename UValueType>
+    bool operator!=(const LinkedHashMapIterator<UContainer, UValueType>& it) const noexcept { return !operator==(it); }
+
+    LinkedHashMapIterator& operator++() noexcept { _node = _container->_nodes[_node].next; return *this; }
+    LinkedHashMapIterator operator++(int) noexcept { LinkedHashMapIterator result(*this); operator++(); return result; }
+    LinkedHashMapIterator& operator--() noexcept { _node = (_node == TContainer::NONE) ? _container->_tail : _container->_nodes[_node].prev; return *this; }
+    LinkedHashMapIterator operator--(int) noexcept { LinkedHashMapIterator result(*this); operator--(); return result; }
+
+    reference operator*() const noexcept { assert((_node != TContainer::NONE) && "Iterator must be valid!"); return _container->_nodes[_node].item; }
+    pointer operator->() const noexcept { assert((_node != TContainer::NONE) && "Iterator must be valid!"); return &_container->_nodes[_node].item; }
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_container != nullptr) && (_node != TContainer::NONE); }
+
+private:
+    TContainer* _container;
+    size_t _node;
+};
+
+/*! \example containers_linked_hashmap.cpp Linked hash map container example */
+
+} // namespace CppCommon
+
+#include "linked_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_LINKED_HASHMAP_H
@@ -0,0 +1,292 @@
+/*!
+    \file linked_hashmap.inl
+    \brief Linked hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::LinkedHashMap(size_t capacity, const THash& hash, const TEqual& equal, const TAllocator& allocator)
+    : _hash(hash), _equal(equal), _size(0), _nodes(node_allocator(allocator)), _head(NONE), _tail(NONE), _free(NONE)
+{
+    _index.resize(std::bit_ceil(std::max((size_t)8, capacity)), NONE);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::operator[](const TKey& key)
+{
+    size_t node = find_internal(key);
+    if (node != NONE)
+        return _nodes[node].item.second;
+
+    return insert_internal(value_type(key, TValue())).first->second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::at(const TKey& key)
+{
+    size_t node = find_internal(key);
+    if (node == NONE)
+        throw std::out_of_range("Item with the given key was not found in the linked hash map!");
+
+    return _nodes[node].item.second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline const typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::mapped_type& LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::at(const TKey& key) const
+{
+    size_t node = find_internal(key);
+    if (node == NONE)
+        throw std::out_of_range("Item with the given key was not found in the linked hash map!");
+
+    return _nodes[node].item.second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::probe_internal(size_t hash, const TKey& key) const noexcept
+{
+    size_t mask = _index.size() - 1;
+
+    // Probe index buckets until the first empty one
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        size_t node = _index[index];
+        if (node == NONE)
+            return NONE;
+        if ((_nodes[node].hash == hash) && _equal(_nodes[node].item.first, key))
+            return index;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::find_internal(const TKey& key) const noexcept
+{
+    size_t index = probe_internal(_hash(key), key);
+    return (index != NONE) ? _index[index] : NONE;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::link_internal(size_t node) noexcept
+{
+    _nodes[node].prev = _tail;
+    _nodes[node].next = NONE;
+    if (_tail != NONE)
+        _nodes[_tail].next = node;
+    else
+        _head = node;
+    _tail = node;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::unlink_internal(size_t node) noexcept
+{
+    size_t prev = _nodes[node].prev;
+    size_t next = _nodes[node].next;
+    if (prev != NONE)
+        _nodes[prev].next = next;
+    else
+        _head = next;
+    if (next != NONE)
+        _nodes[next].prev = prev;
+    else
+        _tail = prev;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::place_internal(size_t node) noexcept
+{
+    size_t mask = _index.size() - 1;
+    size_t index = _nodes[node].hash & mask;
+    while (_index[index] != NONE)
+        index = (index + 1) & mask;
+    _index[index] = node;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+template <typename TItem>
+inline std::pair<typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator, bool> LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::insert_internal(TItem&& item)
+{
+    size_t hash = _hash(item.first);
+    size_t index = probe_internal(hash, item.first);
+    if (index != NONE)
+        return std::make_pair(iterator(this, _index[index]), false);
+
+    reserve(_size + 1);
+
+    // Reuse the free node or append a new one
+    size_t node;
+    if (_free != NONE)
+    {
+        node = _free;
+        _free = _nodes[node].next;
+        _nodes[node].item = std::forward<TItem>(item);
+        _nodes[node].hash = hash;
+    }
+    else
+    {
+        node = _nodes.size();
+        _nodes.emplace_back(std::forward<TItem>(item), hash);
+    }
+
+    place_internal(node);
+    link_internal(node);
+    ++_size;
+    return std::make_pair(iterator(this, node), true);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::touch(const TKey& key) noexcept
+{
+    size_t node = find_internal(key);
+    if ((node != NONE) && (node != _tail))
+    {
+        unlink_internal(node);
+        link_internal(node);
+    }
+    return iterator(this, node);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::touch(const const_iterator& position) noexcept
+{
+    assert((position._container == this) && (position._node != NONE) && "Iterator must be valid!");
+
+    if (position._node != _tail)
+    {
+        unlink_internal(position._node);
+        link_internal(position._node);
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::value_type LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::pop_oldest()
+{
+    assert(!empty() && "Linked hash map is empty!");
+
+    size_t node = _head;
+    value_type result(std::move(_nodes[node].item));
+    erase_internal(node);
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::value_type LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::pop_newest()
+{
+    assert(!empty() && "Linked hash map is empty!");
+
+    size_t node = _tail;
+    value_type result(std::move(_nodes[node].item));
+    erase_internal(node);
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline size_t LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const TKey& key)
+{
+    size_t node = find_internal(key);
+    if (node == NONE)
+        return 0;
+
+    erase_internal(node);
+    return 1;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline typename LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::iterator LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase(const const_iterator& position)
+{
+    assert((position._container == this) && (position._node != NONE) && "Iterator must be valid!");
+
+    size_t next = _nodes[position._node].next;
+    erase_internal(position._node);
+    return iterator(this, next);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::erase_internal(size_t node)
+{
+    size_t mask = _index.size() - 1;
+
+    // Find the index bucket of the erased node
+    size_t index = _nodes[node].hash & mask;
+    while (_index[index] != node)
+        index = (index + 1) & mask;
+    _index[index] = NONE;
+
+    // Shift back all following nodes of the probe chain which could fill the hole
+    for (size_t next = (index + 1) & mask; _index[next] != NONE; next = (next + 1) & mask)
+    {
+        size_t ideal = _nodes[_index[next]].hash & mask;
+        bool stays = (index <= next) ? ((index < ideal) && (ideal <= next)) : ((index < ideal) || (ideal <= next));
+        if (stays)
+            continue;
+
+        _index[index] = _index[next];
+        _index[next] = NONE;
+        index = next;
+    }
+
+    // Release the item and put the node into the free list
+    unlink_internal(node);
+    _nodes[node].item = value_type();
+    _nodes[node].prev = NONE;
+    _nodes[node].next = _free;
+    _free = node;
+    --_size;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::rehash(size_t capacity)
+{
+    capacity = std::bit_ceil(std::max({ (size_t)8, capacity, _size * 2 }));
+    if (capacity == _index.size())
+        return;
+
+    // Rebuild the index table with stored key hashes
+    _index.assign(capacity, NONE);
+    for (size_t node = _head; node != NONE; node = _nodes[node].next)
+        place_internal(node);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::reserve(size_t count)
+{
+    // Keep the index table load factor not greater than 0.5
+    if ((count * 2) > _index.size())
+        rehash(count * 2);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::clear() noexcept
+{
+    std::fill(_index.begin(), _index.end(), NONE);
+    _nodes.clear();
+    _size = 0;
+    _head = NONE;
+    _tail = NONE;
+    _free = NONE;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>::swap(LinkedHashMap& hashmap) noexcept
+{
+    using std::swap;
+    swap(_hash, hashmap._hash);
+    swap(_equal, hashmap._equal);
+    swap(_size, hashmap._size);
+    swap(_nodes, hashmap._nodes);
+    swap(_index, hashmap._index);
+    swap(_head, hashmap._head);
+    swap(_tail, hashmap._tail);
+    swap(_free, hashmap._free);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual, typename TAllocator>
+inline void swap(LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>& hashmap1, LinkedHashMap<TKey, TValue, THash, TEqual, TAllocator>& hashmap2) noexcept
+{
+    hashmap1.swap(hashmap2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,369 @@
+/*!
+    \file mapped_hashmap.h
+    \brief Memory-mapped persistent hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_MAPPED_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_MAPPED_HASHMAP_H
+
+#include "algorithms/crc32c.h"
+#include "algorithms/hash.h"
+#include "filesystem/exceptions.h"
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+#include "memory/memory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Memory-mapped hash map layouts
+enum class MappedHashMapLayout : uint32_t
+{
+    OPEN_ADDRESSING = 1,    //!< Open addressing table with linear probing (load factor 0.5)
+    PERFECT = 2             //!< Minimal perfect hash table (one bucket per item, one probe per lookup)
+};
+
+//! Memory-mapped hash map persistent hasher
+/*!
+    Persistent hasher must give the same hash values for the same seed in all
+    processes and program builds, so std::hash is not suitable. Default one
+    hashes key bytes with FastHash::Compute64(), so the key must not contain
+    padding bytes or pointers.
+*/
+template <typename T>
+struct MappedHasher
+{
+    static_assert(std::has_unique_object_representations<T>::value, "Default mapped hasher requires keys without padding bytes!");
+
+    uint64_t operator()(const T& key, uint64_t seed) const noexcept { return FastHash::Compute64(&key, sizeof(T), seed); }
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Memory-mapped hash map file header
+struct MappedHashMapHeader
+{
+    uint64_t magic;             // File magic
+    uint32_t version;           // File format version
+    uint32_t layout;            // Hash map layout
+    uint32_t key_size;          // Key size
+    uint32_t value_size;        // Value size
+    uint32_t item_size;         // Item size
+    uint32_t item_alignment;    // Item alignment
+    uint64_t size;              // Count of items
+    uint64_t capacity;          // Count of buckets
+    uint64_t seed;              // Hash seed
+    uint64_t groups;            // Count of perfect hash groups
+    uint64_t pilots_offset;     // Offset of perfect hash pilots
+    uint64_t filled_offset;     // Offset of bucket filled flags
+    uint64_t items_offset;      // Offset of buckets
+    uint64_t file_size;         // File size
+    uint32_t checksum;          // CRC32C checksum of the data after the header
+    uint32_t header_checksum;   // CRC32C checksum of the header before this field
+};
+
+const uint64_t MAPPED_HASHMAP_MAGIC = 0x3150414D48534148ull; // "HASHMAP1"
+const uint32_t MAPPED_HASHMAP_VERSION = 1;
+const uint64_t MAPPED_HASHMAP_ALIGNMENT = 64;
+const uint64_t MAPPED_HASHMAP_HEADER = (sizeof(MappedHashMapHeader) + MAPPED_HASHMAP_ALIGNMENT - 1) & ~(MAPPED_HASHMAP_ALIGNMENT - 1);
+
+} // namespace Internals
+//! @endcond
+
+//! Memory-mapped hash map builder
+/*!
+    Builder collects items of the static lookup table and writes them into
+    the image or the file which could be opened by MappedHashMap and queried
+    immediately without parsing or allocations.
+
+    File consists of the header, perfect hash pilots, bucket filled flags and
+    buckets with items, each section is aligned to the cache line. The image
+    contains items as is, so it could be read only by the program with the
+    same key/value types, byte order and hasher.
+
+    Perfect hash layout is built with the hash and displace algorithm: keys
+    are distributed into groups of about 4 keys, and for each group the pilot
+    is found which places all its keys into free buckets. Lookup takes one
+    hash computation, one pilot load and one bucket load with the keys
+    comparison. Building perfect hash table is slower (about a microsecond
+    per key).
+
+    Not thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = MappedHasher<TKey>, typename TEqual = std::equal_to<TKey>>
+class MappedHashMapBuilder
+{
+    static_assert(std::is_trivially_copyable<TKey>::value, "Mapped hash map key must be trivially copyable!");
+    static_assert(std::is_trivially_copyable<TValue>::value, "Mapped hash map value must be trivially copyable!");
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+
+    //! Initialize the empty builder
+    /*!
+        \param seed - Hash seed (default is 0)
+    */
+    explicit MappedHashMapBuilder(uint64_t seed = 0) : _seed(seed) {}
+    MappedHashMapBuilder(const MappedHashMapBuilder&) = default;
+    MappedHashMapBuilder(MappedHashMapBuilder&&) noexcept = default;
+    ~MappedHashMapBuilder() = default;
+
+    MappedHashMapBuilder& operator=(const MappedHashMapBuilder&) = default;
+    MappedHashMapBuilder& operator=(MappedHashMapBuilder&&) noexcept = default;
+
+    //! Is the builder empty?
+    bool empty() const noexcept { return _items.empty(); }
+
+    //! Get the count of collected items
+    size_t size() const noexcept { return _items.size(); }
+
+    //! Reserve the builder capacity to fit the given count of items
+    void reserve(size_t count) { _items.reserve(count); }
+
+    //! Add a new item into the builder
+    /*!
+        Duplicate keys are detected when the table is built.
+
+        \param key - Item key
+        \param value - Item value
+    */
+    void insert(const TKey& key, const TValue& value) { _items.emplace_back(key, value); }
+    //! Add a new item into the builder
+    void insert(const value_type& item) { _items.push_back(item); }
+
+    //! Clear the builder
+    void clear() noexcept { _items.clear(); }
+
+    //! Build the hash map image
+    /*!
+        If the builder contains duplicate keys the method will raise
+        an argument exception!
+
+        \param layout - Hash map layout (default is MappedHashMapLayout::OPEN_ADDRESSING)
+        \return Hash map image
+    */
+    std::vector<uint8_t> Build(MappedHashMapLayout layout = MappedHashMapLayout::OPEN_ADDRESSING) const;
+
+    //! Build the hash map and save it into the given file
+    /*!
+        The image is written into the temporary file and then renamed, so
+        the file is replaced atomically.
+
+        \param path - File path
+        \param layout - Hash map layout (default is MappedHashMapLayout::OPEN_ADDRESSING)
+    */
+    void Save(const Path& path, MappedHashMapLayout layout = MappedHashMapLayout::OPEN_ADDRESSING) const;
+
+private:
+    uint64_t _seed;
+    std::vector<value_type> _items;
+
+    bool BuildPerfect(uint64_t seed, size_t groups, std::vector<uint32_t>& pilots, std::vector<uint32_t>& slots) const;
+};
+
+template <class TContainer>
+class MappedHashMapIterator;
+
+//! Memory-mapped persistent hash map container
+/*!
+    Memory-mapped hash map is the read-only hash map which is opened from the
+    file created by MappedHashMapBuilder. The file is mapped into the process
+    address space and queried in place, so the hash map of any size is opened
+    instantly and its pages are shared between all processes through the
+    system page cache.
+
+    Open validates the header and the file size. Checksum of the whole file
+    is verified only on demand, because it reads all file pages.
+
+    Thread-safe for all const methods.
+*/
+template <typename TKey, typename TValue, typename THash = MappedHasher<TKey>, typename TEqual = std::equal_to<TKey>>
+class MappedHashMap
+{
+    static_assert(std::is_trivially_copyable<TKey>::value, "Mapped hash map key must be trivially copyable!");
+    static_assert(std::is_trivially_copyable<TValue>::value, "Mapped hash map value must be trivially copyable!");
+
+    friend class MappedHashMapIterator<MappedHashMap<TKey, TValue, THash, TEqual>>;
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef MappedHashMapIterator<MappedHashMap<TKey, TValue, THash, TEqual>> iterator;
+    typedef MappedHashMapIterator<MappedHashMap<TKey, TValue, THash, TEqual>> const_iterator;
+
+    //! Initialize the empty hash map
+    MappedHashMap() noexcept { reset_internal(); }
+    //! Initialize the hash map with the given file
+    /*!
+        \param path - File path
+        \param verify - Verify the checksum of the whole file (default is false)
+    */
+    explicit MappedHashMap(const Path& path, bool verify = false) : MappedHashMap() { Open(path, verify); }
+    //! Initialize the hash map with the given image
+    /*!
+        Image must be kept alive while the hash map is used.
+
+        \param image - Image data
+        \param verify - Verify the checksum of the whole image (default is false)
+    */
+    explicit MappedHashMap(std::span<const uint8_t> image, bool verify = false) : MappedHashMap() { Open(image, verify); }
+    MappedHashMap(const MappedHashMap&) = delete;
+    MappedHashMap(MappedHashMap&& hashmap) noexcept : MappedHashMap() { swap(hashmap); }
+    ~MappedHashMap() = default;
+
+    MappedHashMap& operator=(const MappedHashMap&) = delete;
+    MappedHashMap& operator=(MappedHashMap&& hashmap) noexcept { MappedHashMap(std::move(hashmap)).swap(*this); return *this; }
+
+    //! Check if the hash map is opened
+    explicit operator bool() const noexcept { return IsOpened(); }
+
+    //! Is the hash map opened?
+    bool IsOpened() const noexcept { return (_header != nullptr); }
+
+    //! Is the hash map empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the hash map size
+    size_t size() const noexcept { return _size; }
+    //! Get the hash map bucket count
+    size_t bucket_count() const noexcept { return _capacity; }
+    //! Get the hash map layout
+    MappedHashMapLayout layout() const noexcept { return _layout; }
+
+    //! Get the begin hash map iterator
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept { return begin(); }
+    //! Get the end hash map iterator
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept { return end(); }
+
+    //! Find the iterator which points to the item with the given key
+    /*!
+        \param key - Key to find
+        \return Hash map iterator
+    */
+    const_iterator find(const TKey& key) const noexcept;
+
+    //! Find the count of items with the given key
+    size_t count(const TKey& key) const noexcept { return (find(key) != end()) ? 1 : 0; }
+    //! Is the hash map contains an item with the given key?
+    bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+
+    //! Access to the item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Item with the given key
+    */
+    const mapped_type& at(const TKey& key) const;
+
+    //! Open the hash map file
+    /*!
+        If the file is not a valid hash map of the same key/value types the
+        method will raise a filesystem exception!
+
+        \param path - File path
+        \param verify - Verify the checksum of the whole file (default is false)
+    */
+    void Open(const Path& path, bool verify = false);
+    //! Open the hash map image
+    /*!
+        If the image is not a valid hash map of the same key/value types the
+        method will raise an argument exception!
+
+        \param image - Image data
+        \param verify - Verify the checksum of the whole image (default is false)
+    */
+    void Open(std::span<const uint8_t> image, bool verify = false);
+    //! Close the hash map
+    void Close();
+
+    //! Swap two instances
+    void swap(MappedHashMap& hashmap) noexcept;
+    template <typename UKey, typename UValue, typename UHash, typename UEqual>
+    friend void swap(MappedHashMap<UKey, UValue, UHash, UEqual>& hashmap1, MappedHashMap<UKey, UValue, UHash, UEqual>& hashmap2) noexcept;
+
+private:
+    MappedFile _file;
+    const Internals::MappedHashMapHeader* _header;
+    const uint32_t* _pilots;
+    const uint8_t* _filled;
+    const value_type* _items;
+    MappedHashMapLayout _layout;
+    size_t _size;
+    size_t _capacity;
+    size_t _groups;
+    uint64_t _seed;
+
+    const char* attach_internal(const uint8_t* data, size_t size, bool verify) noexcept;
+    void reset_internal() noexcept;
+    size_t find_internal(const TKey& key) const noexcept;
+    size_t next_internal(size_t index) const noexcept;
+};
+
+//! Memory-mapped hash map iterator
+template <class TContainer>
+class MappedHashMapIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef typename TContainer::value_type value_type;
+    typedef const value_type& reference;
+    typedef const value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    MappedHashMapIterator() noexcept : _container(nullptr), _index(0) {}
+    explicit MappedHashMapIterator(const TContainer* container, size_t index) noexcept : _container(container), _index(index) {}
+
+    MappedHashMapIterator& operator++() noexcept { _index = _container->next_internal(_index + 1); return *this; }
+    MappedHashMapIterator operator++(int) noexcept { MappedHashMapIterator result(*this); operator++(); return result; }
+
+    reference operator*() const noexcept { return _container->_items[_index]; }
+    pointer operator->() const noexcept { return &_container->_items[_index]; }
+
+    bool operator==(const MappedHashMapIterator& it) const noexcept { return (_container == it._container) && (_index == it._index); }
+    bool operator!=(const MappedHashMapIterator& it) const noexcept { return !operator==(it); }
+
+private:
+    const TContainer* _container;
+    size_t _index;
+};
+
+/*! \example containers_mapped_hashmap.cpp Memory-mapped persistent hash map container example */
+
+} // namespace CppCommon
+
+#include "mapped_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_MAPPED_HASHMAP_H
@@ -0,0 +1,413 @@
+/*!
+    \file mapped_hashmap.inl
+    \brief Memory-mapped persistent hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const uint64_t MAPPED_HASHMAP_MAGIC_SWAPPED = 0x485341484D415031ull;
+
+inline uint64_t MappedHashMapAlign(uint64_t value, uint64_t alignment) noexcept
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+inline uint64_t MappedHashMapGroup(uint64_t hash, uint64_t groups) noexcept
+{
+    return hash % groups;
+}
+
+inline uint64_t MappedHashMapSlot(uint64_t hash, uint32_t pilot, uint64_t capacity) noexcept
+{
+    return FastHash::Mix64(hash ^ FastHash::Mix64((uint64_t)pilot + 1)) % capacity;
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool MappedHashMapBuilder<TKey, TValue, THash, TEqual>::BuildPerfect(uint64_t seed, size_t groups, std::vector<uint32_t>& pilots, std::vector<uint32_t>& slots) const
+{
+    const size_t count = _items.size();
+
+    std::vector<uint64_t> hashes(count);
+    for (size_t i = 0; i < count; ++i)
+        hashes[i] = THash()(_items[i].first, seed);
+
+    // Distribute items into groups with the counting sort
+    std::vector<size_t> starts(groups + 1, 0);
+    for (size_t i = 0; i < count; ++i)
+        ++starts[Internals::MappedHashMapGroup(hashes[i], groups) + 1];
+    for (size_t i = 0; i < groups; ++i)
+        starts[i + 1] += starts[i];
+    std::vector<size_t> positions(starts.begin(), starts.end() - 1);
+    std::vector<uint32_t> members(count);
+    for (size_t i = 0; i < count; ++i)
+        members[positions[Internals::MappedHashMapGroup(hashes[i], groups)]++] = (uint32_t)i;
+
+    // Items with the same hash could not be separated by any pilot
+    for (size_t group = 0; group < groups; ++group)
+    {
+        std::sort(members.begin() + starts[group], members.begin() + starts[group + 1], [&hashes](uint32_t a, uint32_t b) { return hashes[a] < hashes[b]; });
+        for (size_t i = starts[group] + 1; i < starts[group + 1]; ++i)
+        {
+            if (hashes[members[i - 1]] == hashes[members[i]])
+            {
+                if (TEqual()(_items[members[i - 1]].first, _items[members[i]].first))
+                    throwex ArgumentException("Mapped hash map builder contains duplicate keys!");
+                return false;
+            }
+        }
+    }
+
+    // Place the largest groups first while there are a lot of free buckets
+    std::vector<uint32_t> order(groups);
+    for (size_t i = 0; i < groups; ++i)
+        order[i] = (uint32_t)i;
+    std::stable_sort(order.begin(), order.end(), [&starts](uint32_t a, uint32_t b) { return (starts[a + 1] - starts[a]) > (starts[b + 1] - starts[b]); });
+
+    const uint64_t limit = std::min((uint64_t)0xFFFFFFFFull, (uint64_t)count * 64 + 1024);
+    std::vector<uint8_t> taken(count, 0);
+    std::vector<uint32_t> candidates;
+    pilots.assign(groups, 0);
+    slots.assign(count, 0);
+
+    for (uint32_t group : order)
+    {
+        const size_t first = starts[group];
+        const size_t last = starts[group + 1];
+        if (first == last)
+            break;
+
+        candidates.resize(last - first);
+        for (uint64_t pilot = 0;; ++pilot)
+        {
+            if (pilot >= limit)
+                return false;
+
+            // Try to place all items of the group into free buckets
+            size_t placed = 0;
+            for (; placed < (last - first); ++placed)
+            {
+                uint32_t slot = (uint32_t)Internals::MappedHashMapSlot(hashes[members[first + placed]], (uint32_t)pilot, count);
+                if (taken[slot])
+                    break;
+                taken[slot] = 1;
+                candidates[placed] = slot;
+            }
+
+            if (placed == (last - first))
+            {
+                pilots[group] = (uint32_t)pilot;
+                for (size_t i = 0; i < placed; ++i)
+                    slots[members[first + i]] = candidates[i];
+                break;
+            }
+
+            // Release buckets of the failed attempt
+            for (size_t i = 0; i < placed; ++i)
+                taken[candidates[i]] = 0;
+        }
+    }
+
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline std::vector<uint8_t> MappedHashMapBuilder<TKey, TValue, THash, TEqual>::Build(MappedHashMapLayout layout) const
+{
+    static_assert(alignof(value_type) <= Internals::MAPPED_HASHMAP_ALIGNMENT, "Mapped hash map item alignment is too big!");
+
+    const uint64_t count = _items.size();
+
+    Internals::MappedHashMapHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = Internals::MAPPED_HASHMAP_MAGIC;
+    header.version = Internals::MAPPED_HASHMAP_VERSION;
+    header.layout = (uint32_t)layout;
+    header.key_size = (uint32_t)sizeof(TKey);
+    header.value_size = (uint32_t)sizeof(TValue);
+    header.item_size = (uint32_t)sizeof(value_type);
+    header.item_alignment = (uint32_t)alignof(value_type);
+    header.size = count;
+    header.seed = _seed;
+
+    std::vector<uint32_t> pilots;
+    std::vector<uint32_t> slots;
+    if (layout == MappedHashMapLayout::PERFECT)
+    {
+        if (count > 0xFFFFFFFFull)
+            throwex ArgumentException("Too many items for the perfect hash table!");
+
+        header.capacity = count;
+        header.groups = count / 4 + 1;
+
+        // Retry with another seed in the rare case of unlucky hash values
+        bool built = false;
+        for (uint64_t attempt = 0; !built && (attempt < 16); ++attempt)
+        {
+            header.seed = _seed + attempt * 0x9E3779B97F4A7C15ull;
+            built = BuildPerfect(header.seed, (size_t)header.groups, pilots, slots);
+        }
+        if (!built)
+            throwex RuntimeException("Cannot build the perfect hash table!");
+    }
+    else if (layout == MappedHashMapLayout::OPEN_ADDRESSING)
+        header.capacity = std::bit_ceil(std::max((uint64_t)8, count * 2));
+    else
+        throwex ArgumentException("Invalid mapped hash map layout!");
+
+    // Calculate cache line aligned sections
+    const uint64_t alignment = Internals::MAPPED_HASHMAP_ALIGNMENT;
+    header.pilots_offset = Internals::MAPPED_HASHMAP_HEADER;
+    header.filled_offset = Internals::MappedHashMapAlign(header.pilots_offset + header.groups * sizeof(uint32_t), alignment);
+    uint64_t filled_size = (layout == MappedHashMapLayout::OPEN_ADDRESSING) ? header.capacity : 0;
+    header.items_offset = Internals::MappedHashMapAlign(header.filled_offset + filled_size, alignment);
+    header.file_size = header.items_offset + header.capacity * sizeof(value_type);
+
+    std::vector<uint8_t> image((size_t)header.file_size, 0);
+    uint8_t* filled = image.data() + header.filled_offset;
+    value_type* items = (value_type*)(image.data() + header.items_offset);
+
+    if (layout == MappedHashMapLayout::PERFECT)
+    {
+        if (!pilots.empty())
+            std::memcpy(image.data() + header.pilots_offset, pilots.data(), pilots.size() * sizeof(uint32_t));
+        for (size_t i = 0; i < _items.size(); ++i)
+            new (&items[slots[i]]) value_type(_items[i]);
+    }
+    else
+    {
+        const uint64_t mask = header.capacity - 1;
+        for (const auto& item : _items)
+        {
+            uint64_t index = THash()(item.first, header.seed) & mask;
+            while (filled[index])
+            {
+                if (TEqual()(items[index].first, item.first))
+                    throwex ArgumentException("Mapped hash map builder contains duplicate keys!");
+                index = (index + 1) & mask;
+            }
+            new (&items[index]) value_type(item);
+            filled[index] = 1;
+        }
+    }
+
+    // Checksum the data and then the header
+    header.checksum = CRC32C::Compute(image.data() + Internals::MAPPED_HASHMAP_HEADER, image.size() - Internals::MAPPED_HASHMAP_HEADER);
+    header.header_checksum = CRC32C::Compute(&header, offsetof(Internals::MappedHashMapHeader, header_checksum));
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    return image;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void MappedHashMapBuilder<TKey, TValue, THash, TEqual>::Save(const Path& path, MappedHashMapLayout layout) const
+{
+    std::vector<uint8_t> image = Build(layout);
+
+    Path temp = path.string() + ".tmp";
+    File::WriteAllBytes(temp, image.data(), image.size());
+    Path::Rename(temp, path);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void MappedHashMap<TKey, TValue, THash, TEqual>::reset_internal() noexcept
+{
+    _header = nullptr;
+    _pilots = nullptr;
+    _filled = nullptr;
+    _items = nullptr;
+    _layout = MappedHashMapLayout::OPEN_ADDRESSING;
+    _size = 0;
+    _capacity = 0;
+    _groups = 0;
+    _seed = 0;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline const char* MappedHashMap<TKey, TValue, THash, TEqual>::attach_internal(const uint8_t* data, size_t size, bool verify) noexcept
+{
+    if ((data == nullptr) || (size < Internals::MAPPED_HASHMAP_HEADER))
+        return "Truncated mapped hash map!";
+    if (!Memory::IsAligned(data, alignof(Internals::MappedHashMapHeader)))
+        return "Mapped hash map image is not aligned!";
+
+    const Internals::MappedHashMapHeader* header = (const Internals::MappedHashMapHeader*)data;
+    if (header->magic == Internals::MAPPED_HASHMAP_MAGIC_SWAPPED)
+        return "Mapped hash map was built with different byte order!";
+    if (header->magic != Internals::MAPPED_HASHMAP_MAGIC)
+        return "Invalid mapped hash map!";
+    if (header->header_checksum != CRC32C::Compute(header, offsetof(Internals::MappedHashMapHeader, header_checksum)))
+        return "Corrupted mapped hash map header!";
+    if (header->version != Internals::MAPPED_HASHMAP_VERSION)
+        return "Unsupported mapped hash map version!";
+    if ((header->key_size != sizeof(TKey)) || (header->value_size != sizeof(TValue)) || (header->item_size != sizeof(value_type)) || (header->item_alignment != alignof(value_type)))
+        return "Mapped hash map was built with different key/value types!";
+    if ((header->file_size > size) || (header->items_offset > header->file_size))
+        return "Truncated mapped hash map!";
+
+    // Validate sections of the layout
+    MappedHashMapLayout layout = (MappedHashMapLayout)header->layout;
+    bool valid = (header->pilots_offset >= Internals::MAPPED_HASHMAP_HEADER) &&
+                 (header->pilots_offset <= header->filled_offset) &&
+                 (header->groups <= ((header->filled_offset - header->pilots_offset) / sizeof(uint32_t))) &&
+                 (header->filled_offset <= header->items_offset) &&
+                 (header->capacity <= ((header->file_size - header->items_offset) / sizeof(value_type))) &&
+                 Memory::IsAligned(data + header->items_offset, alignof(value_type));
+    if (layout == MappedHashMapLayout::PERFECT)
+        valid = valid && (header->capacity == header->size) && (header->groups > 0);
+    else if (layout == MappedHashMapLayout::OPEN_ADDRESSING)
+        valid = valid && (header->capacity >= 8) && std::has_single_bit(header->capacity) && ((header->size * 2) <= header->capacity) && (header->capacity <= (header->items_offset - header->filled_offset));
+    else
+        valid = false;
+    if (!valid)
+        return "Invalid mapped hash map layout!";
+
+    if (verify && (header->checksum != CRC32C::Compute(data + Internals::MAPPED_HASHMAP_HEADER, (size_t)header->file_size - Internals::MAPPED_HASHMAP_HEADER)))
+        return "Corrupted mapped hash map!";
+
+    _header = header;
+    _pilots = (const uint32_t*)(data + header->pilots_offset);
+    _filled = (layout == MappedHashMapLayout::OPEN_ADDRESSING) ? (data + header->filled_offset) : nullptr;
+    _items = (const value_type*)(data + header->items_offset);
+    _layout = layout;
+    _size = (size_t)header->size;
+    _capacity = (size_t)header->capacity;
+    _groups = (size_t)header->groups;
+    _seed = header->seed;
+    return nullptr;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void MappedHashMap<TKey, TValue, THash, TEqual>::Open(const Path& path, bool verify)
+{
+    Close();
+
+    MappedFile file(path, MappedFileMode::READONLY);
+    const char* error = attach_internal((const uint8_t*)file.data(), file.size(), verify);
+    if (error != nullptr)
+    {
+        reset_internal();
+        throwex FileSystemException(error).Attach(path);
+    }
+
+    // Moving the mapped file keeps its mapping address
+    _file = std::move(file);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void MappedHashMap<TKey, TValue, THash, TEqual>::Open(std::span<const uint8_t> image, bool verify)
+{
+    Close();
+
+    const char* error = attach_internal(image.data(), image.size(), verify);
+    if (error != nullptr)
+    {
+        reset_internal();
+        throwex ArgumentException(error);
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void MappedHashMap<TKey, TValue, THash, TEqual>::Close()
+{
+    reset_internal();
+    if (_file)
+        _file.Unmap();
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t MappedHashMap<TKey, TValue, THash, TEqual>::next_internal(size_t index) const noexcept
+{
+    if (_filled == nullptr)
+        return std::min(index, _capacity);
+
+    while ((index < _capacity) && !_filled[index])
+        ++index;
+    return index;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename MappedHashMap<TKey, TValue, THash, TEqual>::const_iterator MappedHashMap<TKey, TValue, THash, TEqual>::begin() const noexcept
+{
+    return const_iterator(this, next_internal(0));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename MappedHashMap<TKey, TValue, THash, TEqual>::const_iterator MappedHashMap<TKey, TValue, THash, TEqual>::end() const noexcept
+{
+    return const_iterator(this, _capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t MappedHashMap<TKey, TValue, THash, TEqual>::find_internal(const TKey& key) const noexcept
+{
+    if (_size == 0)
+        return _capacity;
+
+    uint64_t hash = THash()(key, _seed);
+
+    // Perfect hash table has the only candidate bucket
+    if (_layout == MappedHashMapLayout::PERFECT)
+    {
+        size_t index = (size_t)Internals::MappedHashMapSlot(hash, _pilots[Internals::MappedHashMapGroup(hash, _groups)], _capacity);
+        return TEqual()(_items[index].first, key) ? index : _capacity;
+    }
+
+    // Probe buckets until the first empty one
+    const size_t mask = _capacity - 1;
+    for (size_t index = (size_t)hash & mask;; index = (index + 1) & mask)
+    {
+        if (!_filled[index])
+            return _capacity;
+        if (TEqual()(_items[index].first, key))
+            return index;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename MappedHashMap<TKey, TValue, THash, TEqual>::const_iterator MappedHashMap<TKey, TValue, THash, TEqual>::find(const TKey& key) const noexcept
+{
+    return const_iterator(this, find_internal(key));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline const typename MappedHashMap<TKey, TValue, THash, TEqual>::mapped_type& MappedHashMap<TKey, TValue, THash, TEqual>::at(const TKey& key) const
+{
+    size_t index = find_internal(key);
+    if (index == _capacity)
+        throw std::out_of_range("Item with the given key was not found in the mapped hash map!");
+
+    return _items[index].second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void MappedHashMap<TKey, TValue, THash, TEqual>::swap(MappedHashMap& hashmap) noexcept
+{
+    using std::swap;
+    swap(_file, hashmap._file);
+    swap(_header, hashmap._header);
+    swap(_pilots, hashmap._pilots);
+    swap(_filled, hashmap._filled);
+    swap(_items, hashmap._items);
+    swap(_layout, hashmap._layout);
+    swap(_size, hashmap._size);
+    swap(_capacity, hashmap._capacity);
+    swap(_groups, hashmap._groups);
+    swap(_seed, hashmap._seed);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void swap(MappedHashMap<TKey, TValue, THash, TEqual>& hashmap1, MappedHashMap<TKey, TValue, THash, TEqual>& hashmap2) noexcept
+{
+    hashmap1.swap(hashmap2);
+}
+
+} // namespace CppCommon
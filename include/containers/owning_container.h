@@ -0,0 +1,90 @@
+/*!
+    \file owning_container.h
+    \brief Owning adapter for intrusive containers definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_OWNING_CONTAINER_H
+#define CPPCOMMON_CONTAINERS_OWNING_CONTAINER_H
+
+#include "memory/allocator.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Owning adapter for intrusive containers
+/*!
+    Owning adapter extends the intrusive container (List, Queue, Stack or any
+    of binary trees) with nodes allocation from the given memory manager (e.g.
+    ArenaMemoryManager or PoolMemoryManager). Nodes are created with create()
+    method and linked into the container with its usual methods.
+
+    Clear method destroys all linked nodes and frees all the memory manager
+    blocks at once instead of deleting nodes one by one. For trivially
+    destructible nodes it takes constant time regardless of the container size.
+    Nodes created but not linked into the container should be released before
+    clear, otherwise their destructors will not be called.
+
+    Memory manager must support free_all() method and must not be shared with
+    other allocations, because clear method frees all its memory blocks.
+
+    Not thread-safe.
+*/
+template <class TContainer, class TMemoryManager>
+class OwningContainer : public TContainer
+{
+public:
+    // Standard container type definitions
+    typedef typename TContainer::value_type value_type;
+    typedef Allocator<value_type, TMemoryManager> allocator_type;
+
+    //! Initialize the owning container with a given memory manager
+    /*!
+        \param manager - Nodes memory manager
+        \param args - Arguments to initialize the intrusive container with
+    */
+    template <class... Args>
+    explicit OwningContainer(TMemoryManager& manager, Args&&... args) : TContainer(std::forward<Args>(args)...), _allocator(manager) {}
+    OwningContainer(const OwningContainer&) = delete;
+    OwningContainer(OwningContainer&&) = delete;
+    ~OwningContainer() { clear(); }
+
+    OwningContainer& operator=(const OwningContainer&) = delete;
+    OwningContainer& operator=(OwningContainer&&) = delete;
+
+    //! Get the nodes allocator
+    allocator_type& allocator() noexcept { return _allocator; }
+
+    //! Create a new node (not linked into the container)
+    /*!
+        \param args - Arguments to initialize the created node with
+        \return Pointer to the created node
+    */
+    template <class... Args>
+    value_type* create(Args&&... args) { return _allocator.Create(std::forward<Args>(args)...); }
+    //! Release the node unlinked from the container
+    /*!
+        \param node - Node to release
+    */
+    void release(value_type* node) { _allocator.Release(node); }
+
+    //! Clear the container, destroy all linked nodes and free all their memory at once
+    void clear();
+
+private:
+    allocator_type _allocator;
+
+    void DestroyNodes();
+};
+
+/*! \example containers_owning_container.cpp Owning adapter for intrusive containers example */
+
+} // namespace CppCommon
+
+#include "owning_container.inl"
+
+#endif // CPPCOMMON_CONTAINERS_OWNING_CONTAINER_H
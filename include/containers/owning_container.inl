@@ -0,0 +1,65 @@
+/*!
+    \file owning_container.inl
+    \brief Owning adapter for intrusive containers inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TContainer, class TMemoryManager>
+inline void OwningContainer<TContainer, TMemoryManager>::clear()
+{
+    // Destructors of trivially destructible nodes are not required
+    if constexpr (!std::is_trivially_destructible<value_type>::value)
+        DestroyNodes();
+
+    TContainer::clear();
+
+    // Free all nodes memory at once
+    _allocator.free_all();
+}
+
+template <class TContainer, class TMemoryManager>
+inline void OwningContainer<TContainer, TMemoryManager>::DestroyNodes()
+{
+    if constexpr (requires(TContainer& container) { container.root(); })
+    {
+        // Destroy binary tree nodes in post-order cutting child links on the way down
+        value_type* node = TContainer::root();
+        while (node != nullptr)
+        {
+            if (node->left != nullptr)
+            {
+                value_type* left = node->left;
+                node->left = nullptr;
+                node = left;
+                continue;
+            }
+            if (node->right != nullptr)
+            {
+                value_type* right = node->right;
+                node->right = nullptr;
+                node = right;
+                continue;
+            }
+
+            value_type* parent = node->parent;
+            node->~value_type();
+            node = parent;
+        }
+    }
+    else
+    {
+        // Destroy linked nodes moving the iterator before each node destruction
+        for (auto it = TContainer::begin(); it != TContainer::end();)
+        {
+            value_type* node = it.operator->();
+            ++it;
+            node->~value_type();
+        }
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,169 @@
+/*!
+    \file perfect_hashmap.h
+    \brief Perfect hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_PERFECT_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_PERFECT_HASHMAP_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Perfect hash map key hasher
+/*!
+    Seeded constexpr hasher of integral and enum keys. Specialized for
+    std::string_view keys.
+*/
+template <typename TKey>
+struct PerfectHash
+{
+    constexpr uint64_t operator()(const TKey& key, uint64_t seed) const noexcept;
+};
+
+//! Perfect hash map key hasher for string keys
+template <>
+struct PerfectHash<std::string_view>
+{
+    constexpr uint64_t operator()(std::string_view key, uint64_t seed) const noexcept;
+};
+
+//! Perfect hash map container
+/*!
+    Perfect hash map is an immutable associative container for the static set
+    of keys known at compile time (protocol tags, header names, enum names).
+    It is built by the constexpr constructor, so a constexpr map is placed in
+    the read-only data without any startup or allocation cost.
+
+    Keys are hashed with the seed into buckets of about four keys. Each
+    bucket keeps the pilot value which displaces all keys of the bucket into
+    free distinct slots of the table (CHD / PTHash construction), so every
+    key has exactly one candidate slot. Lookup hashes the key, reads the
+    bucket pilot, takes the slot with one multiplication (Fibonacci hashing)
+    and compares a single key.
+
+    Duplicate keys fail the construction with std::invalid_argument
+    exception (compile error in constant evaluation).
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, size_t N, typename THash = PerfectHash<TKey>>
+class PerfectHashMap
+{
+    static_assert((N > 0), "Perfect hash map must contain at least one item!");
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef const value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    //! Build the perfect hash map from the given items
+    /*!
+        \param items - Items to build as key/value pairs
+        \param hash - Key hasher (default is THash())
+    */
+    constexpr explicit PerfectHashMap(const value_type (&items)[N], const THash& hash = THash()) : PerfectHashMap(std::to_array(items), hash) {}
+    //! Build the perfect hash map from the given items
+    /*!
+        \param items - Items to build as key/value pairs
+        \param hash - Key hasher (default is THash())
+    */
+    constexpr explicit PerfectHashMap(const std::array<value_type, N>& items, const THash& hash = THash());
+    constexpr PerfectHashMap(const PerfectHashMap&) = default;
+    constexpr PerfectHashMap(PerfectHashMap&&) = default;
+    constexpr ~PerfectHashMap() = default;
+
+    constexpr PerfectHashMap& operator=(const PerfectHashMap&) = default;
+    constexpr PerfectHashMap& operator=(PerfectHashMap&&) = default;
+
+    //! Is the perfect hash map empty?
+    constexpr bool empty() const noexcept { return false; }
+
+    //! Get the perfect hash map size
+    constexpr size_t size() const noexcept { return N; }
+    //! Get the perfect hash map slot count
+    constexpr size_t bucket_count() const noexcept { return SLOTS; }
+    //! Get the perfect hash map hash seed
+    constexpr uint64_t seed() const noexcept { return _seed; }
+
+    //! Get the begin perfect hash map iterator (items are kept in the build order)
+    constexpr const_iterator begin() const noexcept { return _items.data(); }
+    constexpr const_iterator cbegin() const noexcept { return _items.data(); }
+    //! Get the end perfect hash map iterator
+    constexpr const_iterator end() const noexcept { return _items.data() + N; }
+    constexpr const_iterator cend() const noexcept { return _items.data() + N; }
+
+    //! Find the iterator which points to the item with the given key or return end iterator
+    constexpr const_iterator find(const TKey& key) const noexcept;
+
+    //! Find the count of items with the given key
+    constexpr size_t count(const TKey& key) const noexcept { return contains(key) ? 1 : 0; }
+    //! Is the perfect hash map contains an item with the given key?
+    constexpr bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+
+    //! Access to the item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Item with the given key
+    */
+    constexpr const TValue& at(const TKey& key) const;
+
+private:
+    // About four keys per bucket and the load factor not greater than 0.8
+    static constexpr size_t BUCKETS = (N + 3) / 4;
+    static constexpr size_t SLOTS = std::bit_ceil(N + N / 4 + 1);
+    static constexpr size_t SEEDS = 64;
+    static constexpr size_t PILOTS = 4096;
+    static constexpr int SHIFT = 64 - std::countr_zero(SLOTS);
+
+    typedef std::conditional_t<(N < 0xFFFF), uint16_t, uint32_t> index_type;
+
+    THash _hash;                                // Perfect hash map key hasher
+    uint64_t _seed;                             // Perfect hash map hash seed
+    std::array<value_type, N> _items;           // Perfect hash map items
+    std::array<uint64_t, BUCKETS> _pilots;      // Perfect hash map bucket pilot hashes
+    std::array<index_type, SLOTS> _slots;       // Perfect hash map slot item indexes
+
+    static constexpr uint64_t mix(uint64_t value) noexcept;
+    static constexpr size_t bucket(uint64_t hash) noexcept { return (size_t)(((hash >> 32) * BUCKETS) >> 32); }
+    static constexpr size_t slot(uint64_t hash, uint64_t pilot) noexcept { return (size_t)(((hash ^ pilot) * 0x9E3779B97F4A7C15ull) >> SHIFT); }
+
+    constexpr bool build_internal(uint64_t seed);
+};
+
+//! Make the perfect hash map from the given items
+/*!
+    \param items - Items to build as key/value pairs
+    \return Perfect hash map
+*/
+template <typename TKey, typename TValue, size_t N>
+constexpr PerfectHashMap<TKey, TValue, N> MakePerfectHashMap(const std::pair<TKey, TValue> (&items)[N])
+{ return PerfectHashMap<TKey, TValue, N>(items); }
+
+/*! \example containers_perfect_hashmap.cpp Perfect hash map container example */
+
+} // namespace CppCommon
+
+#include "perfect_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_PERFECT_HASHMAP_H
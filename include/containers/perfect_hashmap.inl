@@ -0,0 +1,173 @@
+/*!
+    \file perfect_hashmap.inl
+    \brief Perfect hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey>
+constexpr uint64_t PerfectHash<TKey>::operator()(const TKey& key, uint64_t seed) const noexcept
+{
+    static_assert(std::is_integral_v<TKey> || std::is_enum_v<TKey>, "Perfect hash of the key type is not provided!");
+
+    // SplitMix64 finalizer of the seeded key
+    uint64_t hash = (uint64_t)key ^ seed;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    return hash ^ (hash >> 31);
+}
+
+constexpr uint64_t PerfectHash<std::string_view>::operator()(std::string_view key, uint64_t seed) const noexcept
+{
+    // FNV-1a of the seeded key with the SplitMix64 finalizer
+    uint64_t hash = 0xCBF29CE484222325ull ^ seed;
+    for (char ch : key)
+    {
+        hash ^= (uint8_t)ch;
+        hash *= 0x100000001B3ull;
+    }
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    return hash ^ (hash >> 31);
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash>
+constexpr PerfectHashMap<TKey, TValue, N, THash>::PerfectHashMap(const std::array<value_type, N>& items, const THash& hash)
+    : _hash(hash), _seed(0), _items(items), _pilots{}, _slots{}
+{
+    // Try next seeds until all buckets are placed
+    for (size_t attempt = 0; attempt < SEEDS; ++attempt)
+        if (build_internal(mix(attempt + 1)))
+            return;
+
+    throw std::invalid_argument("Failed to build the perfect hash map!");
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash>
+constexpr uint64_t PerfectHashMap<TKey, TValue, N, THash>::mix(uint64_t value) noexcept
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash>
+constexpr bool PerfectHashMap<TKey, TValue, N, THash>::build_internal(uint64_t seed)
+{
+    std::array<uint64_t, N> hashes{};
+    for (size_t i = 0; i < N; ++i)
+        hashes[i] = _hash(_items[i].first, seed);
+
+    // Group items by buckets with the counting sort
+    std::array<size_t, BUCKETS + 1> offsets{};
+    for (size_t i = 0; i < N; ++i)
+        ++offsets[bucket(hashes[i]) + 1];
+    for (size_t i = 0; i < BUCKETS; ++i)
+        offsets[i + 1] += offsets[i];
+    std::array<size_t, N> members{};
+    std::array<size_t, BUCKETS> filled{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        size_t index = bucket(hashes[i]);
+        members[offsets[index] + filled[index]++] = i;
+    }
+
+    // Same hashes within the bucket are never separated by pilots
+    for (size_t b = 0; b < BUCKETS; ++b)
+    {
+        for (size_t i = offsets[b]; i < offsets[b + 1]; ++i)
+        {
+            for (size_t j = offsets[b]; j < i; ++j)
+            {
+                if (hashes[members[i]] == hashes[members[j]])
+                {
+                    if (_items[members[i]].first == _items[members[j]].first)
+                        throw std::invalid_argument("Duplicate key in the perfect hash map!");
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Place larger buckets first while the table is mostly free
+    std::array<size_t, BUCKETS> order{};
+    for (size_t b = 0; b < BUCKETS; ++b)
+        order[b] = b;
+    std::sort(order.begin(), order.end(), [&offsets](size_t b1, size_t b2)
+    {
+        size_t size1 = offsets[b1 + 1] - offsets[b1];
+        size_t size2 = offsets[b2 + 1] - offsets[b2];
+        return (size1 != size2) ? (size1 > size2) : (b1 < b2);
+    });
+
+    std::array<bool, SLOTS> taken{};
+    for (size_t b : order)
+    {
+        _pilots[b] = mix(0);
+
+        size_t first = offsets[b];
+        size_t last = offsets[b + 1];
+        if (first == last)
+            continue;
+
+        // Find the pilot which displaces all bucket items into free distinct slots
+        bool placed = false;
+        for (size_t candidate = 0; !placed && (candidate < PILOTS); ++candidate)
+        {
+            uint64_t pilot = mix(candidate);
+
+            placed = true;
+            for (size_t i = first; placed && (i < last); ++i)
+            {
+                size_t index = slot(hashes[members[i]], pilot);
+                if (taken[index])
+                    placed = false;
+                for (size_t j = first; placed && (j < i); ++j)
+                    if (slot(hashes[members[j]], pilot) == index)
+                        placed = false;
+            }
+
+            if (placed)
+            {
+                _pilots[b] = pilot;
+                for (size_t i = first; i < last; ++i)
+                    taken[slot(hashes[members[i]], pilot)] = true;
+            }
+        }
+
+        if (!placed)
+            return false;
+    }
+
+    // Fill slots with item indexes, free slots point to the end
+    for (size_t i = 0; i < SLOTS; ++i)
+        _slots[i] = (index_type)N;
+    for (size_t i = 0; i < N; ++i)
+        _slots[slot(hashes[i], _pilots[bucket(hashes[i])])] = (index_type)i;
+
+    _seed = seed;
+    return true;
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash>
+constexpr typename PerfectHashMap<TKey, TValue, N, THash>::const_iterator PerfectHashMap<TKey, TValue, N, THash>::find(const TKey& key) const noexcept
+{
+    uint64_t hash = _hash(key, _seed);
+    size_t index = _slots[slot(hash, _pilots[bucket(hash)])];
+    return ((index < N) && (_items[index].first == key)) ? (begin() + index) : end();
+}
+
+template <typename TKey, typename TValue, size_t N, typename THash>
+constexpr const TValue& PerfectHashMap<TKey, TValue, N, THash>::at(const TKey& key) const
+{
+    auto it = find(key);
+    if (it == end())
+        throw std::out_of_range("Item with the given key was not found in the perfect hash map!");
+
+    return it->second;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,347 @@
+/*!
+    \file persistent_hashmap.h
+    \brief Persistent hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_PERSISTENT_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_PERSISTENT_HASHMAP_H
+
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+template <class TContainer>
+class PersistentHashMapIterator;
+
+//! Persistent hash map container
+/*!
+    Persistent hash map is an immutable hash array mapped trie (HAMT) with
+    the compressed CHAMP node layout: each node keeps a 32-bit bitmap of
+    inline items and a 32-bit bitmap of child nodes indexed by 5 bits of
+    the key hash. Updates copy only the path from the root to the changed
+    node (O(log32 n) nodes) and share all other nodes with the previous
+    version, so each version of the hash map is a cheap consistent snapshot.
+
+    Copying the hash map is O(1) (atomic reference counter increment), all
+    versions could be read concurrently from any threads. Nodes are freed
+    when the last version which refers them is destroyed.
+
+    Bulk updates should use Transient builder which modifies nodes in place
+    while they are not shared with any other version.
+
+    Thread-safe for all const methods.
+*/
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>>
+class PersistentHashMap
+{
+    friend class PersistentHashMapIterator<PersistentHashMap<TKey, TValue, THash, TEqual>>;
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef PersistentHashMapIterator<PersistentHashMap<TKey, TValue, THash, TEqual>> iterator;
+    typedef PersistentHashMapIterator<PersistentHashMap<TKey, TValue, THash, TEqual>> const_iterator;
+
+    class Transient;
+
+    //! Initialize the empty persistent hash map
+    /*!
+        \param hash - Key hasher (default is THash())
+        \param equal - Key comparator (default is TEqual())
+    */
+    explicit PersistentHashMap(const THash& hash = THash(), const TEqual& equal = TEqual()) : _hash(hash), _equal(equal), _size(0) {}
+    PersistentHashMap(const PersistentHashMap&) = default;
+    PersistentHashMap(PersistentHashMap&& hashmap) noexcept : _hash(hashmap._hash), _equal(hashmap._equal), _root(std::move(hashmap._root)), _size(std::exchange(hashmap._size, 0)) {}
+    ~PersistentHashMap() = default;
+
+    PersistentHashMap& operator=(const PersistentHashMap&) = default;
+    PersistentHashMap& operator=(PersistentHashMap&& hashmap) noexcept { PersistentHashMap(std::move(hashmap)).swap(*this); return *this; }
+
+    //! Check if the persistent hash map is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the persistent hash map empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the persistent hash map size
+    size_t size() const noexcept { return _size; }
+
+    //! Get the begin persistent hash map iterator
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept { return begin(); }
+    //! Get the end persistent hash map iterator
+    const_iterator end() const noexcept { return const_iterator(); }
+    const_iterator cend() const noexcept { return const_iterator(); }
+
+    //! Find the iterator which points to the item with the given key or return end iterator
+    const_iterator find(const TKey& key) const noexcept;
+
+    //! Find the count of items with the given key
+    size_t count(const TKey& key) const noexcept { return (find_internal(key) != nullptr) ? 1 : 0; }
+    //! Is the persistent hash map contains an item with the given key?
+    bool contains(const TKey& key) const noexcept { return (find_internal(key) != nullptr); }
+
+    //! Access to the item with the given key or throw std::out_of_range exception
+    /*!
+        \param key - Key of the item
+        \return Item with the given key
+    */
+    const mapped_type& at(const TKey& key) const;
+
+    //! Get a new version of the persistent hash map with the given item inserted or replaced
+    /*!
+        \param key - Item key
+        \param value - Item value
+        \return New version of the persistent hash map
+    */
+    PersistentHashMap set(const TKey& key, const TValue& value) const &;
+    PersistentHashMap set(const TKey& key, const TValue& value) &&;
+
+    //! Get a new version of the persistent hash map without the item with the given key
+    /*!
+        \param key - Key of the item to erase
+        \return New version of the persistent hash map
+    */
+    PersistentHashMap erase(const TKey& key) const &;
+    PersistentHashMap erase(const TKey& key) &&;
+
+    //! Get the transient builder initialized with the current version
+    Transient transient() const { return Transient(*this); }
+
+    //! Swap two instances
+    void swap(PersistentHashMap& hashmap) noexcept;
+    template <typename UKey, typename UValue, typename UHash, typename UEqual>
+    friend void swap(PersistentHashMap<UKey, UValue, UHash, UEqual>& hashmap1, PersistentHashMap<UKey, UValue, UHash, UEqual>& hashmap2) noexcept;
+
+    //! Are two persistent hash maps the same version?
+    bool same(const PersistentHashMap& hashmap) const noexcept { return (_root == hashmap._root); }
+
+    //! Persistent hash map transient builder
+    /*!
+        Transient builder modifies the private version of the persistent hash
+        map in place. Nodes which are shared with other versions are copied
+        on the first modification, all other nodes are modified without
+        copying and allocations, so bulk updates cost O(1) allocations per
+        modified node instead of O(log32 n) per update.
+
+        Not thread-safe.
+    */
+    class Transient
+    {
+    public:
+        //! Initialize the empty transient builder
+        Transient() = default;
+        //! Initialize the transient builder with the given version of the persistent hash map
+        explicit Transient(const PersistentHashMap& hashmap) : _map(hashmap) {}
+        Transient(const Transient&) = delete;
+        Transient(Transient&&) = default;
+        ~Transient() = default;
+
+        Transient& operator=(const Transient&) = delete;
+        Transient& operator=(Transient&&) = default;
+
+        //! Is the transient builder empty?
+        bool empty() const noexcept { return _map.empty(); }
+        //! Get the transient builder size
+        size_t size() const noexcept { return _map.size(); }
+
+        //! Is the transient builder contains an item with the given key?
+        bool contains(const TKey& key) const noexcept { return _map.contains(key); }
+        //! Access to the item with the given key or throw std::out_of_range exception
+        const mapped_type& at(const TKey& key) const { return _map.at(key); }
+
+        //! Insert or replace the item
+        /*!
+            \param key - Item key
+            \param value - Item value
+            \return 'true' if a new item was inserted, 'false' if the existing item was replaced
+        */
+        bool set(const TKey& key, const TValue& value) { return _map.set_internal(key, value); }
+        //! Erase the item with the given key
+        /*!
+            \param key - Key of the item to erase
+            \return 'true' if the item was erased, 'false' if the given key was not found
+        */
+        bool erase(const TKey& key) { return _map.erase_internal(key); }
+
+        //! Get the persistent version of the transient builder
+        /*!
+            Further modifications of the transient builder copy nodes of the
+            returned version instead of changing them.
+
+            \return Persistent hash map
+        */
+        PersistentHashMap persistent() const { return _map; }
+
+    private:
+        PersistentHashMap _map;
+    };
+
+private:
+    static constexpr size_t BITS = 5;
+    static constexpr size_t HASH_BITS = sizeof(size_t) * 8;
+    static constexpr size_t MAX_DEPTH = HASH_BITS / BITS + 2;
+
+    // Persistent hash map item with its key hash
+    struct Entry
+    {
+        value_type item;
+        size_t hash;
+    };
+
+    struct Node;
+    typedef std::shared_ptr<Node> NodePtr;
+
+    // Persistent hash map node (collision nodes below the last hash level have no bitmaps)
+    struct Node
+    {
+        uint32_t datamap{0};
+        uint32_t nodemap{0};
+        std::vector<Entry> entries;
+        std::vector<NodePtr> children;
+    };
+
+    THash _hash;    // Persistent hash map key hasher
+    TEqual _equal;  // Persistent hash map key comparator
+    NodePtr _root;  // Persistent hash map root node
+    size_t _size;   // Persistent hash map size
+
+    static uint32_t bit(size_t hash, size_t shift) noexcept { return (uint32_t)1 << ((hash >> shift) & 31); }
+    static size_t index(uint32_t bitmap, uint32_t bit) noexcept { return (size_t)std::popcount(bitmap & (bit - 1)); }
+    static void unique(NodePtr& node);
+    static NodePtr merge(Entry&& entry1, Entry&& entry2, size_t shift);
+
+    const Entry* find_internal(const TKey& key) const noexcept;
+    bool set_internal(const TKey& key, const TValue& value);
+    bool set_node(NodePtr& node, Entry&& entry, size_t shift);
+    bool erase_internal(const TKey& key);
+    void erase_node(NodePtr& node, size_t hash, const TKey& key, size_t shift);
+};
+
+//! Persistent hash map iterator
+/*!
+    Not thread-safe.
+*/
+template <class TContainer>
+class PersistentHashMapIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef typename TContainer::value_type value_type;
+    typedef const value_type& reference;
+    typedef const value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    PersistentHashMapIterator() noexcept : _depth(0), _current(nullptr) {}
+
+    friend bool operator==(const PersistentHashMapIterator& it1, const PersistentHashMapIterator& it2) noexcept
+    { return it1._current == it2._current; }
+    friend bool operator!=(const PersistentHashMapIterator& it1, const PersistentHashMapIterator& it2) noexcept
+    { return it1._current != it2._current; }
+
+    PersistentHashMapIterator& operator++() noexcept { next(); return *this; }
+    PersistentHashMapIterator operator++(int) noexcept { PersistentHashMapIterator result(*this); next(); return result; }
+
+    reference operator*() const noexcept { assert((_current != nullptr) && "Iterator must be valid!"); return _current->item; }
+    pointer operator->() const noexcept { return &_current->item; }
+
+    //! Check if the iterator is valid
+    explicit operator bool() const noexcept { return (_current != nullptr); }
+
+private:
+    // Iterator frame: node and position of the next entry or child
+    struct Frame
+    {
+        const typename TContainer::Node* node;
+        size_t position;
+    };
+
+    Frame _stack[TContainer::MAX_DEPTH];
+    size_t _depth;
+    const typename TContainer::Entry* _current;
+
+    void push(const typename TContainer::Node* node, size_t position) noexcept { _stack[_depth++] = Frame{ node, position }; }
+    void next() noexcept;
+};
+
+//! Atomic persistent hash map
+/*!
+    Atomic persistent hash map publishes versions of the persistent hash map
+    for concurrent readers. Readers load the current version as a cheap
+    reference counted snapshot and use it without any locks. Writers publish
+    new versions with store() or update the current version with a function
+    which is retried if another writer published a version concurrently.
+
+    Thread-safe.
+*/
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>>
+class AtomicPersistentHashMap
+{
+public:
+    typedef PersistentHashMap<TKey, TValue, THash, TEqual> map_type;
+
+    //! Initialize the atomic persistent hash map with the given version
+    explicit AtomicPersistentHashMap(const map_type& hashmap = map_type()) : _map(hashmap) {}
+    AtomicPersistentHashMap(const AtomicPersistentHashMap&) = delete;
+    AtomicPersistentHashMap(AtomicPersistentHashMap&&) = delete;
+    ~AtomicPersistentHashMap() = default;
+
+    AtomicPersistentHashMap& operator=(const AtomicPersistentHashMap&) = delete;
+    AtomicPersistentHashMap& operator=(AtomicPersistentHashMap&&) = delete;
+
+    //! Load the current version of the persistent hash map
+    map_type load() const { Locker<SpinLock> locker(_lock); return _map; }
+    //! Publish the given version of the persistent hash map
+    void store(const map_type& hashmap) { map_type old(hashmap); { Locker<SpinLock> locker(_lock); _map.swap(old); } }
+
+    //! Update the current version of the persistent hash map
+    /*!
+        Updater is called as updater(const map_type& current) and returns the
+        new version. If another writer publishes a version concurrently the
+        updater is called again with the newer version.
+
+        \param updater - Version updater
+        \return Published version of the persistent hash map
+    */
+    template <typename TUpdater>
+    map_type update(TUpdater&& updater);
+
+private:
+    mutable SpinLock _lock;
+    map_type _map;
+};
+
+/*! \example containers_persistent_hashmap.cpp Persistent hash map container example */
+
+} // namespace CppCommon
+
+#include "persistent_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_PERSISTENT_HASHMAP_H
@@ -0,0 +1,372 @@
+/*!
+    \file persistent_hashmap.inl
+    \brief Persistent hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename PersistentHashMap<TKey, TValue, THash, TEqual>::const_iterator PersistentHashMap<TKey, TValue, THash, TEqual>::begin() const noexcept
+{
+    const_iterator result;
+    if (_root)
+    {
+        result.push(_root.get(), 0);
+        result.next();
+    }
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename PersistentHashMap<TKey, TValue, THash, TEqual>::const_iterator PersistentHashMap<TKey, TValue, THash, TEqual>::find(const TKey& key) const noexcept
+{
+    const_iterator result;
+    if (!_root)
+        return result;
+
+    size_t hash = _hash(key);
+    const Node* node = _root.get();
+
+    // Descend to the item and remember the path to continue iteration from it
+    for (size_t shift = 0;; shift += BITS)
+    {
+        if (shift >= HASH_BITS)
+        {
+            for (size_t i = 0; i < node->entries.size(); ++i)
+            {
+                if (_equal(node->entries[i].item.first, key))
+                {
+                    result.push(node, i + 1);
+                    result._current = &node->entries[i];
+                    return result;
+                }
+            }
+            return const_iterator();
+        }
+
+        uint32_t b = bit(hash, shift);
+        if (node->datamap & b)
+        {
+            size_t i = index(node->datamap, b);
+            const Entry& entry = node->entries[i];
+            if ((entry.hash != hash) || !_equal(entry.item.first, key))
+                return const_iterator();
+            result.push(node, i + 1);
+            result._current = &entry;
+            return result;
+        }
+        if (node->nodemap & b)
+        {
+            size_t i = index(node->nodemap, b);
+            result.push(node, node->entries.size() + i + 1);
+            node = node->children[i].get();
+            continue;
+        }
+        return const_iterator();
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline const typename PersistentHashMap<TKey, TValue, THash, TEqual>::Entry* PersistentHashMap<TKey, TValue, THash, TEqual>::find_internal(const TKey& key) const noexcept
+{
+    if (!_root)
+        return nullptr;
+
+    size_t hash = _hash(key);
+    const Node* node = _root.get();
+
+    for (size_t shift = 0;; shift += BITS)
+    {
+        if (shift >= HASH_BITS)
+        {
+            for (const auto& entry : node->entries)
+                if (_equal(entry.item.first, key))
+                    return &entry;
+            return nullptr;
+        }
+
+        uint32_t b = bit(hash, shift);
+        if (node->datamap & b)
+        {
+            const Entry& entry = node->entries[index(node->datamap, b)];
+            return ((entry.hash == hash) && _equal(entry.item.first, key)) ? &entry : nullptr;
+        }
+        if (!(node->nodemap & b))
+            return nullptr;
+        node = node->children[index(node->nodemap, b)].get();
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline const typename PersistentHashMap<TKey, TValue, THash, TEqual>::mapped_type& PersistentHashMap<TKey, TValue, THash, TEqual>::at(const TKey& key) const
+{
+    const Entry* entry = find_internal(key);
+    if (entry == nullptr)
+        throw std::out_of_range("Item with the given key was not found in the persistent hash map!");
+
+    return entry->item.second;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline PersistentHashMap<TKey, TValue, THash, TEqual> PersistentHashMap<TKey, TValue, THash, TEqual>::set(const TKey& key, const TValue& value) const &
+{
+    PersistentHashMap result(*this);
+    result.set_internal(key, value);
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline PersistentHashMap<TKey, TValue, THash, TEqual> PersistentHashMap<TKey, TValue, THash, TEqual>::set(const TKey& key, const TValue& value) &&
+{
+    set_internal(key, value);
+    return std::move(*this);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline PersistentHashMap<TKey, TValue, THash, TEqual> PersistentHashMap<TKey, TValue, THash, TEqual>::erase(const TKey& key) const &
+{
+    // Keep the same version if the key is not found
+    if (find_internal(key) == nullptr)
+        return *this;
+
+    PersistentHashMap result(*this);
+    result.erase_internal(key);
+    return result;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline PersistentHashMap<TKey, TValue, THash, TEqual> PersistentHashMap<TKey, TValue, THash, TEqual>::erase(const TKey& key) &&
+{
+    erase_internal(key);
+    return std::move(*this);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void PersistentHashMap<TKey, TValue, THash, TEqual>::unique(NodePtr& node)
+{
+    // Copy the node shared with other versions before modification
+    if (node.use_count() != 1)
+        node = std::make_shared<Node>(*node);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename PersistentHashMap<TKey, TValue, THash, TEqual>::NodePtr PersistentHashMap<TKey, TValue, THash, TEqual>::merge(Entry&& entry1, Entry&& entry2, size_t shift)
+{
+    NodePtr node = std::make_shared<Node>();
+
+    // Both hashes are exhausted, so create the collision node
+    if (shift >= HASH_BITS)
+    {
+        node->entries.reserve(2);
+        node->entries.push_back(std::move(entry1));
+        node->entries.push_back(std::move(entry2));
+        return node;
+    }
+
+    uint32_t bit1 = bit(entry1.hash, shift);
+    uint32_t bit2 = bit(entry2.hash, shift);
+    if (bit1 == bit2)
+    {
+        node->nodemap = bit1;
+        node->children.push_back(merge(std::move(entry1), std::move(entry2), shift + BITS));
+        return node;
+    }
+
+    node->datamap = bit1 | bit2;
+    node->entries.reserve(2);
+    if (bit1 < bit2)
+    {
+        node->entries.push_back(std::move(entry1));
+        node->entries.push_back(std::move(entry2));
+    }
+    else
+    {
+        node->entries.push_back(std::move(entry2));
+        node->entries.push_back(std::move(entry1));
+    }
+    return node;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool PersistentHashMap<TKey, TValue, THash, TEqual>::set_internal(const TKey& key, const TValue& value)
+{
+    if (!_root)
+        _root = std::make_shared<Node>();
+
+    bool inserted = set_node(_root, Entry{ value_type(key, value), _hash(key) }, 0);
+    if (inserted)
+        ++_size;
+    return inserted;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool PersistentHashMap<TKey, TValue, THash, TEqual>::set_node(NodePtr& node, Entry&& entry, size_t shift)
+{
+    unique(node);
+
+    if (shift >= HASH_BITS)
+    {
+        for (auto& current : node->entries)
+        {
+            if (_equal(current.item.first, entry.item.first))
+            {
+                current.item.second = std::move(entry.item.second);
+                return false;
+            }
+        }
+        node->entries.push_back(std::move(entry));
+        return true;
+    }
+
+    uint32_t b = bit(entry.hash, shift);
+    if (node->datamap & b)
+    {
+        size_t i = index(node->datamap, b);
+        Entry& current = node->entries[i];
+        if ((current.hash == entry.hash) && _equal(current.item.first, entry.item.first))
+        {
+            current.item.second = std::move(entry.item.second);
+            return false;
+        }
+
+        // Push both items down into the new child node
+        NodePtr child = merge(std::move(current), std::move(entry), shift + BITS);
+        node->entries.erase(node->entries.begin() + i);
+        node->datamap ^= b;
+        node->nodemap |= b;
+        node->children.insert(node->children.begin() + index(node->nodemap, b), std::move(child));
+        return true;
+    }
+
+    if (node->nodemap & b)
+        return set_node(node->children[index(node->nodemap, b)], std::move(entry), shift + BITS);
+
+    node->entries.insert(node->entries.begin() + index(node->datamap, b), std::move(entry));
+    node->datamap |= b;
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline bool PersistentHashMap<TKey, TValue, THash, TEqual>::erase_internal(const TKey& key)
+{
+    if (find_internal(key) == nullptr)
+        return false;
+
+    erase_node(_root, _hash(key), key, 0);
+    if (_root->entries.empty() && _root->children.empty())
+        _root.reset();
+    --_size;
+    return true;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void PersistentHashMap<TKey, TValue, THash, TEqual>::erase_node(NodePtr& node, size_t hash, const TKey& key, size_t shift)
+{
+    unique(node);
+
+    if (shift >= HASH_BITS)
+    {
+        for (auto it = node->entries.begin(); it != node->entries.end(); ++it)
+        {
+            if (_equal(it->item.first, key))
+            {
+                node->entries.erase(it);
+                return;
+            }
+        }
+        return;
+    }
+
+    uint32_t b = bit(hash, shift);
+    if (node->datamap & b)
+    {
+        node->entries.erase(node->entries.begin() + index(node->datamap, b));
+        node->datamap ^= b;
+        return;
+    }
+
+    size_t i = index(node->nodemap, b);
+    NodePtr& child = node->children[i];
+    erase_node(child, hash, key, shift + BITS);
+
+    // Pull the last item of the child node up to keep the trie compact
+    if (child->children.empty() && (child->entries.size() == 1))
+    {
+        Entry entry(std::move(child->entries.front()));
+        node->children.erase(node->children.begin() + i);
+        node->nodemap ^= b;
+        node->entries.insert(node->entries.begin() + index(node->datamap, b), std::move(entry));
+        node->datamap |= b;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void PersistentHashMap<TKey, TValue, THash, TEqual>::swap(PersistentHashMap& hashmap) noexcept
+{
+    using std::swap;
+    swap(_hash, hashmap._hash);
+    swap(_equal, hashmap._equal);
+    swap(_root, hashmap._root);
+    swap(_size, hashmap._size);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void swap(PersistentHashMap<TKey, TValue, THash, TEqual>& hashmap1, PersistentHashMap<TKey, TValue, THash, TEqual>& hashmap2) noexcept
+{
+    hashmap1.swap(hashmap2);
+}
+
+template <class TContainer>
+inline void PersistentHashMapIterator<TContainer>::next() noexcept
+{
+    while (_depth > 0)
+    {
+        Frame& frame = _stack[_depth - 1];
+
+        // Visit node items first and then its child nodes
+        if (frame.position < frame.node->entries.size())
+        {
+            _current = &frame.node->entries[frame.position++];
+            return;
+        }
+
+        size_t child = frame.position - frame.node->entries.size();
+        if (child < frame.node->children.size())
+        {
+            ++frame.position;
+            push(frame.node->children[child].get(), 0);
+            continue;
+        }
+
+        --_depth;
+    }
+
+    _current = nullptr;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+template <typename TUpdater>
+inline typename AtomicPersistentHashMap<TKey, TValue, THash, TEqual>::map_type AtomicPersistentHashMap<TKey, TValue, THash, TEqual>::update(TUpdater&& updater)
+{
+    for (;;)
+    {
+        map_type current = load();
+        map_type result = updater(static_cast<const map_type&>(current));
+
+        // Publish the new version only if the current one was not changed
+        {
+            Locker<SpinLock> locker(_lock);
+            if (_map.same(current))
+            {
+                // Old version is released outside of the lock by the current snapshot
+                _map = result;
+                return result;
+            }
+        }
+    }
+}
+
+} // namespace CppCommon
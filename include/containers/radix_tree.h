@@ -0,0 +1,189 @@
+/*!
+    \file radix_tree.h
+    \brief Radix tree container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_RADIX_TREE_H
+#define CPPCOMMON_CONTAINERS_RADIX_TREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Radix tree container
+/*!
+    Radix tree is an ordered string keyed container which shares common key
+    prefixes. Chains of single-child nodes are collapsed into one node with
+    the compressed path (like in adaptive radix trees), so each key byte is
+    stored once per distinct prefix and the lookup touches at most one node
+    per distinct prefix.
+
+    Children of each node are kept in the sorted byte array, so children
+    lookup is a binary search over a compact array and the tree iterates
+    keys in lexicographical order.
+
+    Besides exact lookups radix tree supports the longest prefix match
+    (e.g. for URL routing) and walks or erases all keys with the given
+    prefix (e.g. virtual directories) without touching other keys.
+
+    Modifications invalidate pointers to values only of erased keys.
+
+    Not thread-safe.
+
+    Times for various operations in terms of key length k and number of keys n:
+    \li Lookup - O(k log 256)
+    \li Insertion -  O(k log 256)
+    \li Removal -  O(k log 256)
+    \li Longest prefix match - O(k log 256)
+    \li Prefix iteration - O(k log 256 + m), where m is the number of keys with the prefix
+
+    <b>Taken from:</b>\n
+    The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases
+    https://db.in.tum.de/~leis/papers/ART.pdf
+*/
+template <typename T>
+class RadixTree
+{
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t size_type;
+
+    RadixTree() noexcept : _size(0), _nodes(0) {}
+    RadixTree(const RadixTree&) = delete;
+    RadixTree(RadixTree&& tree) noexcept : _root(std::move(tree._root)), _size(tree._size), _nodes(tree._nodes) { tree._size = 0; tree._nodes = 0; }
+    ~RadixTree() = default;
+
+    RadixTree& operator=(const RadixTree&) = delete;
+    RadixTree& operator=(RadixTree&& tree) noexcept { RadixTree(std::move(tree)).swap(*this); return *this; }
+
+    //! Check if the radix tree is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the radix tree empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the radix tree size
+    size_t size() const noexcept { return _size; }
+    //! Get the count of radix tree nodes
+    size_t nodes() const noexcept { return _nodes; }
+
+    //! Find the value of the given key
+    /*!
+        \param key - Key to find
+        \return Pointer to the found value or nullptr if the given key was not found
+    */
+    T* find(std::string_view key) noexcept { return const_cast<T*>(std::as_const(*this).find(key)); }
+    const T* find(std::string_view key) const noexcept;
+
+    //! Find the value of the longest key which is a prefix of the given key
+    /*!
+        \param key - Key to match
+        \return Pair with the matched prefix of the given key and the pointer to its value (nullptr if no keys match)
+    */
+    std::pair<std::string_view, T*> longest_prefix(std::string_view key) noexcept;
+    std::pair<std::string_view, const T*> longest_prefix(std::string_view key) const noexcept;
+
+    //! Insert a new value with the given key into the radix tree
+    /*!
+        \param key - Key to insert
+        \param value - Value to insert
+        \return Pair with the pointer to the inserted or existing value and success flag
+    */
+    std::pair<T*, bool> insert(std::string_view key, const T& value) { return emplace(key, value); }
+    std::pair<T*, bool> insert(std::string_view key, T&& value) { return emplace(key, std::move(value)); }
+
+    //! Emplace a new value with the given key into the radix tree
+    /*!
+        \param key - Key to emplace
+        \param args - Value constructor arguments
+        \return Pair with the pointer to the emplaced or existing value and success flag
+    */
+    template <typename... Args>
+    std::pair<T*, bool> emplace(std::string_view key, Args&&... args);
+
+    //! Erase the value with the given key from the radix tree
+    /*!
+        \param key - Key to erase
+        \return 'true' if the value was erased, 'false' if the given key was not found
+    */
+    bool erase(std::string_view key);
+    //! Erase all values with keys started with the given prefix from the radix tree
+    /*!
+        \param prefix - Keys prefix
+        \return Count of erased values
+    */
+    size_t erase_prefix(std::string_view prefix);
+
+    //! Walk through all values with keys started with the given prefix in lexicographical order
+    /*!
+        Visitor is called as visitor(std::string_view key, T& value) and
+        returns 'true' to continue the walk or 'false' to stop it. Visitor
+        must not modify the radix tree.
+
+        \param prefix - Keys prefix
+        \param visitor - Visitor
+        \return 'true' if all values were visited, 'false' if the walk was stopped by the visitor
+    */
+    template <typename TVisitor>
+    bool walk(std::string_view prefix, TVisitor&& visitor);
+    template <typename TVisitor>
+    bool walk(std::string_view prefix, TVisitor&& visitor) const;
+
+    //! Clear the radix tree
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(RadixTree& tree) noexcept;
+    template <typename U>
+    friend void swap(RadixTree<U>& tree1, RadixTree<U>& tree2) noexcept;
+
+private:
+    struct Node
+    {
+        std::string prefix;                             // Compressed path (the first byte is the edge label)
+        std::string labels;                             // Sorted first bytes of children
+        std::vector<std::unique_ptr<Node>> children;    // Children nodes
+        std::optional<T> value;                         // Node value
+    };
+
+    struct Frame
+    {
+        Node* parent;   // Parent node
+        size_t index;   // Child index in the parent node
+    };
+
+    std::unique_ptr<Node> _root;    // Radix tree root node (with the empty prefix)
+    size_t _size;                   // Radix tree size
+    size_t _nodes;                  // Radix tree nodes count
+
+    static size_t InternalIndex(const Node* node, char label) noexcept;
+    static const Node* InternalChild(const Node* node, char label) noexcept;
+    const Node* InternalLocate(std::string_view prefix, std::string& key, std::vector<Frame>* path) const;
+    void InternalCompact(std::vector<Frame>& path);
+    static void InternalCount(const Node* node, size_t& values, size_t& nodes) noexcept;
+    template <typename TNode, typename TVisitor>
+    static bool InternalWalk(TNode* node, std::string& key, TVisitor& visitor);
+};
+
+/*! \example containers_radix_tree.cpp Radix tree container example */
+
+} // namespace CppCommon
+
+#include "radix_tree.inl"
+
+#endif // CPPCOMMON_CONTAINERS_RADIX_TREE_H
@@ -0,0 +1,353 @@
+/*!
+    \file radix_tree.inl
+    \brief Radix tree container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline size_t RadixTree<T>::InternalIndex(const Node* node, char label) noexcept
+{
+    // Children labels are sorted as unsigned bytes to keep the lexicographical order
+    auto it = std::lower_bound(node->labels.begin(), node->labels.end(), label, [](char label1, char label2) { return (unsigned char)label1 < (unsigned char)label2; });
+    return (size_t)(it - node->labels.begin());
+}
+
+template <typename T>
+inline const typename RadixTree<T>::Node* RadixTree<T>::InternalChild(const Node* node, char label) noexcept
+{
+    size_t index = InternalIndex(node, label);
+    if ((index == node->labels.size()) || (node->labels[index] != label))
+        return nullptr;
+    return node->children[index].get();
+}
+
+template <typename T>
+inline const T* RadixTree<T>::find(std::string_view key) const noexcept
+{
+    const Node* node = _root.get();
+    if (node == nullptr)
+        return nullptr;
+
+    // Follow compressed paths of the key
+    size_t pos = 0;
+    while (pos < key.size())
+    {
+        const Node* next = InternalChild(node, key[pos]);
+        if ((next == nullptr) || (key.compare(pos, next->prefix.size(), next->prefix) != 0))
+            return nullptr;
+        pos += next->prefix.size();
+        node = next;
+    }
+
+    return node->value ? &*node->value : nullptr;
+}
+
+template <typename T>
+inline std::pair<std::string_view, T*> RadixTree<T>::longest_prefix(std::string_view key) noexcept
+{
+    auto result = std::as_const(*this).longest_prefix(key);
+    return std::make_pair(result.first, const_cast<T*>(result.second));
+}
+
+template <typename T>
+inline std::pair<std::string_view, const T*> RadixTree<T>::longest_prefix(std::string_view key) const noexcept
+{
+    std::pair<std::string_view, const T*> result(std::string_view(), nullptr);
+
+    const Node* node = _root.get();
+    if (node == nullptr)
+        return result;
+
+    // Remember the last node with the value on the key path
+    size_t pos = 0;
+    for (;;)
+    {
+        if (node->value)
+            result = std::make_pair(key.substr(0, pos), &*node->value);
+        if (pos == key.size())
+            break;
+
+        const Node* next = InternalChild(node, key[pos]);
+        if ((next == nullptr) || (key.compare(pos, next->prefix.size(), next->prefix) != 0))
+            break;
+        pos += next->prefix.size();
+        node = next;
+    }
+
+    return result;
+}
+
+template <typename T>
+template <typename... Args>
+inline std::pair<T*, bool> RadixTree<T>::emplace(std::string_view key, Args&&... args)
+{
+    if (!_root)
+    {
+        _root = std::make_unique<Node>();
+        ++_nodes;
+    }
+
+    Node* node = _root.get();
+    size_t pos = 0;
+    for (;;)
+    {
+        // Update the value of the existing node
+        if (pos == key.size())
+        {
+            if (node->value)
+                return std::make_pair(&*node->value, false);
+            node->value.emplace(std::forward<Args>(args)...);
+            ++_size;
+            return std::make_pair(&*node->value, true);
+        }
+
+        // Create a new leaf node with the rest of the key
+        size_t index = InternalIndex(node, key[pos]);
+        if ((index == node->labels.size()) || (node->labels[index] != key[pos]))
+        {
+            auto leaf = std::make_unique<Node>();
+            leaf->prefix = key.substr(pos);
+            leaf->value.emplace(std::forward<Args>(args)...);
+            T* result = &*leaf->value;
+            node->labels.insert(node->labels.begin() + index, key[pos]);
+            node->children.insert(node->children.begin() + index, std::move(leaf));
+            ++_nodes;
+            ++_size;
+            return std::make_pair(result, true);
+        }
+
+        // Find the common part of the child compressed path and the key
+        Node* next = node->children[index].get();
+        size_t common = 1;
+        while ((common < next->prefix.size()) && ((pos + common) < key.size()) && (next->prefix[common] == key[pos + common]))
+            ++common;
+
+        // Split the child compressed path after the common part
+        if (common < next->prefix.size())
+        {
+            auto split = std::make_unique<Node>();
+            split->prefix = next->prefix.substr(0, common);
+            next->prefix.erase(0, common);
+            split->labels.push_back(next->prefix[0]);
+            split->children.push_back(std::move(node->children[index]));
+            node->children[index] = std::move(split);
+            next = node->children[index].get();
+            ++_nodes;
+        }
+
+        pos += common;
+        node = next;
+    }
+}
+
+template <typename T>
+inline bool RadixTree<T>::erase(std::string_view key)
+{
+    Node* node = _root.get();
+    if (node == nullptr)
+        return false;
+
+    // Find the key node and remember the path to it
+    std::vector<Frame> path;
+    size_t pos = 0;
+    while (pos < key.size())
+    {
+        size_t index = InternalIndex(node, key[pos]);
+        if ((index == node->labels.size()) || (node->labels[index] != key[pos]))
+            return false;
+        Node* next = node->children[index].get();
+        if (key.compare(pos, next->prefix.size(), next->prefix) != 0)
+            return false;
+        path.push_back(Frame{ node, index });
+        pos += next->prefix.size();
+        node = next;
+    }
+
+    if (!node->value)
+        return false;
+
+    node->value.reset();
+    if (--_size == 0)
+    {
+        clear();
+        return true;
+    }
+
+    InternalCompact(path);
+    return true;
+}
+
+template <typename T>
+inline size_t RadixTree<T>::erase_prefix(std::string_view prefix)
+{
+    std::vector<Frame> path;
+    std::string key;
+    const Node* node = InternalLocate(prefix, key, &path);
+    if (node == nullptr)
+        return 0;
+
+    size_t values = 0;
+    size_t nodes = 0;
+    InternalCount(node, values, nodes);
+    if (path.empty() || (values == _size))
+    {
+        clear();
+        return values;
+    }
+
+    // Detach the whole prefix subtree from its parent
+    Frame frame = path.back();
+    path.pop_back();
+    frame.parent->labels.erase(frame.index, 1);
+    frame.parent->children.erase(frame.parent->children.begin() + frame.index);
+    _size -= values;
+    _nodes -= nodes;
+
+    if (!path.empty())
+        InternalCompact(path);
+    return values;
+}
+
+template <typename T>
+template <typename TVisitor>
+inline bool RadixTree<T>::walk(std::string_view prefix, TVisitor&& visitor)
+{
+    std::string key;
+    Node* node = const_cast<Node*>(InternalLocate(prefix, key, nullptr));
+    if (node == nullptr)
+        return true;
+
+    return InternalWalk(node, key, visitor);
+}
+
+template <typename T>
+template <typename TVisitor>
+inline bool RadixTree<T>::walk(std::string_view prefix, TVisitor&& visitor) const
+{
+    std::string key;
+    const Node* node = InternalLocate(prefix, key, nullptr);
+    if (node == nullptr)
+        return true;
+
+    return InternalWalk(node, key, visitor);
+}
+
+template <typename T>
+inline const typename RadixTree<T>::Node* RadixTree<T>::InternalLocate(std::string_view prefix, std::string& key, std::vector<Frame>* path) const
+{
+    const Node* node = _root.get();
+    if (node == nullptr)
+        return nullptr;
+
+    // Find the topmost node which key is started with the given prefix
+    key.clear();
+    size_t pos = 0;
+    while (pos < prefix.size())
+    {
+        size_t index = InternalIndex(node, prefix[pos]);
+        if ((index == node->labels.size()) || (node->labels[index] != prefix[pos]))
+            return nullptr;
+        const Node* next = node->children[index].get();
+        size_t count = std::min(next->prefix.size(), prefix.size() - pos);
+        if (prefix.compare(pos, count, next->prefix, 0, count) != 0)
+            return nullptr;
+        if (path != nullptr)
+            path->push_back(Frame{ const_cast<Node*>(node), index });
+        key.append(next->prefix);
+        pos += next->prefix.size();
+        node = next;
+    }
+
+    return node;
+}
+
+template <typename T>
+inline void RadixTree<T>::InternalCompact(std::vector<Frame>& path)
+{
+    while (!path.empty())
+    {
+        Frame frame = path.back();
+        Node* node = frame.parent->children[frame.index].get();
+        if (node->value)
+            return;
+
+        // Remove the empty node and check its parent
+        if (node->children.empty())
+        {
+            frame.parent->labels.erase(frame.index, 1);
+            frame.parent->children.erase(frame.parent->children.begin() + frame.index);
+            --_nodes;
+            path.pop_back();
+            continue;
+        }
+
+        // Merge the node with its single child
+        if (node->children.size() == 1)
+        {
+            std::unique_ptr<Node> child = std::move(node->children[0]);
+            child->prefix.insert(0, node->prefix);
+            frame.parent->children[frame.index] = std::move(child);
+            --_nodes;
+        }
+        return;
+    }
+}
+
+template <typename T>
+inline void RadixTree<T>::InternalCount(const Node* node, size_t& values, size_t& nodes) noexcept
+{
+    ++nodes;
+    if (node->value)
+        ++values;
+    for (const auto& child : node->children)
+        InternalCount(child.get(), values, nodes);
+}
+
+template <typename T>
+template <typename TNode, typename TVisitor>
+inline bool RadixTree<T>::InternalWalk(TNode* node, std::string& key, TVisitor& visitor)
+{
+    if (node->value && !visitor(std::string_view(key), *node->value))
+        return false;
+
+    for (const auto& child : node->children)
+    {
+        size_t size = key.size();
+        key.append(child->prefix);
+        bool result = InternalWalk<TNode>(child.get(), key, visitor);
+        key.resize(size);
+        if (!result)
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+inline void RadixTree<T>::clear() noexcept
+{
+    _root.reset();
+    _size = 0;
+    _nodes = 0;
+}
+
+template <typename T>
+inline void RadixTree<T>::swap(RadixTree& tree) noexcept
+{
+    using std::swap;
+    swap(_root, tree._root);
+    swap(_size, tree._size);
+    swap(_nodes, tree._nodes);
+}
+
+template <typename T>
+inline void swap(RadixTree<T>& tree1, RadixTree<T>& tree2) noexcept
+{
+    tree1.swap(tree2);
+}
+
+} // namespace CppCommon
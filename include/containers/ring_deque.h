@@ -0,0 +1,295 @@
+/*!
+    \file ring_deque.h
+    \brief Ring buffer deque container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_RING_DEQUE_H
+#define CPPCOMMON_CONTAINERS_RING_DEQUE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+template <class TContainer, typename T>
+class RingDequeIterator;
+
+//! Ring buffer deque container
+/*!
+    Ring buffer deque stores trivially copyable items in the contiguous buffer
+    with the power of two capacity allocated with the given allocator. Items
+    are pushed and popped at both ends in O(1) and the buffer grows twice when
+    it is full, so hot paths do not allocate memory per item and iteration is
+    cache-linear with at most one wrap around the buffer end.
+
+    Each pushed item gets a stable index which is not changed by pushing or
+    popping other items and by the buffer growth. The front item index is
+    head() and the index after the back item is tail(), so a consumer could
+    remember message positions and access them later with slot() method while
+    they are not popped. Stable indices are unsigned counters masked by the
+    buffer capacity, so they wrap around without any issues.
+
+    Bulk push and pop methods copy spans of items with at most two memcpy()
+    calls.
+
+    Not thread-safe.
+*/
+template <typename T, typename TAllocator = std::allocator<T>>
+class RingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Ring deque item must be trivially copyable!");
+
+    friend class RingDequeIterator<RingDeque<T, TAllocator>, T>;
+    friend class RingDequeIterator<const RingDeque<T, TAllocator>, const T>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef TAllocator allocator_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef RingDequeIterator<RingDeque<T, TAllocator>, T> iterator;
+    typedef RingDequeIterator<const RingDeque<T, TAllocator>, const T> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //! Initialize the ring deque with a given capacity
+    /*!
+        \param capacity - Ring deque capacity rounded up to the power of two (default is 16)
+        \param allocator - Allocator (default is TAllocator())
+    */
+    explicit RingDeque(size_t capacity = 16, const TAllocator& allocator = TAllocator());
+    RingDeque(const RingDeque& deque);
+    RingDeque(RingDeque&& deque) noexcept;
+    ~RingDeque() = default;
+
+    RingDeque& operator=(const RingDeque& deque);
+    RingDeque& operator=(RingDeque&& deque) noexcept;
+
+    //! Check if the ring deque is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given position from the front of the ring deque
+    T& operator[](size_t position) noexcept { return slot(_head + position); }
+    const T& operator[](size_t position) const noexcept { return slot(_head + position); }
+
+    //! Is the ring deque empty?
+    bool empty() const noexcept { return _head == _tail; }
+
+    //! Get the ring deque size
+    size_t size() const noexcept { return _tail - _head; }
+    //! Get the ring deque capacity
+    size_t capacity() const noexcept { return _buffer.size(); }
+    //! Get the ring deque maximum size
+    size_t max_size() const noexcept { return _buffer.max_size(); }
+
+    //! Get the ring deque allocator
+    allocator_type get_allocator() const { return _buffer.get_allocator(); }
+
+    //! Get the stable index of the front item
+    size_t head() const noexcept { return _head; }
+    //! Get the stable index after the back item
+    size_t tail() const noexcept { return _tail; }
+
+    //! Is the given stable index points to the item in the ring deque?
+    bool valid(size_t index) const noexcept { return (index - _head) < size(); }
+
+    //! Access to the item with the given stable index
+    T& slot(size_t index) noexcept { assert(valid(index) && "Invalid ring deque index!"); return _buffer[index & _mask]; }
+    const T& slot(size_t index) const noexcept { assert(valid(index) && "Invalid ring deque index!"); return _buffer[index & _mask]; }
+
+    //! Access to the item with the given position from the front of the ring deque or throw std::out_of_range exception
+    /*!
+        \param position - Item position
+        \return Item with the given position
+    */
+    T& at(size_t position);
+    const T& at(size_t position) const;
+
+    //! Get the front item
+    T& front() noexcept { return slot(_head); }
+    const T& front() const noexcept { return slot(_head); }
+    //! Get the back item
+    T& back() noexcept { return slot(_tail - 1); }
+    const T& back() const noexcept { return slot(_tail - 1); }
+
+    //! Get the begin ring deque iterator
+    iterator begin() noexcept { return iterator(this, _head); }
+    const_iterator begin() const noexcept { return const_iterator(this, _head); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    //! Get the end ring deque iterator
+    iterator end() noexcept { return iterator(this, _tail); }
+    const_iterator end() const noexcept { return const_iterator(this, _tail); }
+    const_iterator cend() const noexcept { return end(); }
+
+    //! Get the reverse begin ring deque iterator
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    //! Get the reverse end ring deque iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //! Push the given item into the back of the ring deque
+    /*!
+        \param item - Item to push
+        \return Stable index of the pushed item
+    */
+    size_t push_back(const T& item);
+    //! Push the given item into the front of the ring deque
+    /*!
+        \param item - Item to push
+        \return Stable index of the pushed item
+    */
+    size_t push_front(const T& item);
+
+    //! Push the given span of items into the back of the ring deque
+    /*!
+        \param items - Pointer to the first item
+        \param count - Count of items to push
+        \return Stable index of the first pushed item
+    */
+    size_t push_back(const T* items, size_t count);
+
+    //! Pop the back item from the ring deque
+    void pop_back() noexcept { assert(!empty() && "Ring deque is empty!"); --_tail; }
+    //! Pop the front item from the ring deque
+    void pop_front() noexcept { assert(!empty() && "Ring deque is empty!"); ++_head; }
+
+    //! Pop the span of items from the front of the ring deque
+    /*!
+        \param items - Pointer to the buffer for popped items
+        \param count - Maximal count of items to pop
+        \return Count of popped items
+    */
+    size_t pop_front(T* items, size_t count) noexcept;
+    //! Pop the given count of items from the front of the ring deque without copying them
+    /*!
+        \param count - Maximal count of items to pop
+        \return Count of popped items
+    */
+    size_t skip_front(size_t count) noexcept;
+
+    //! Reserve the ring deque capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+
+    //! Clear the ring deque
+    /*!
+        Clear keeps the buffer and continues stable indices from the tail.
+    */
+    void clear() noexcept { _head = _tail; }
+
+    //! Swap two instances
+    void swap(RingDeque& deque) noexcept;
+    template <typename U, typename UAllocator>
+    friend void swap(RingDeque<U, UAllocator>& deque1, RingDeque<U, UAllocator>& deque2) noexcept;
+
+private:
+    std::vector<T, TAllocator> _buffer; // Ring deque buffer
+    size_t _mask;                       // Ring deque buffer index mask
+    size_t _head;                       // Ring deque stable index of the front item
+    size_t _tail;                       // Ring deque stable index after the back item
+
+    void grow_internal(size_t count);
+    static void copy_internal(T* buffer, size_t mask, size_t index, const T* items, size_t count) noexcept;
+};
+
+//! Ring buffer deque iterator
+/*!
+    Random access iterator over stable indices of the ring deque.
+
+    Not thread-safe.
+*/
+template <class TContainer, typename T>
+class RingDequeIterator
+{
+    friend typename std::remove_const<TContainer>::type;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::random_access_iterator_tag iterator_category;
+
+    RingDequeIterator() noexcept : _container(nullptr), _index(0) {}
+    explicit RingDequeIterator(TContainer* container, size_t index) noexcept : _container(container), _index(index) {}
+    template <class UContainer, typename U>
+    RingDequeIterator(const RingDequeIterator<UContainer, U>& it) noexcept : _container(it._container), _index(it._index) {}
+    RingDequeIterator(const RingDequeIterator& it) noexcept = default;
+    ~RingDequeIterator() noexcept = default;
+
+    RingDequeIterator& operator=(const RingDequeIterator& it) noexcept = default;
+
+    friend bool operator==(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return it1._index == it2._index; }
+    friend bool operator!=(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return it1._index != it2._index; }
+    friend bool operator<(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return (it1 - it2) < 0; }
+    friend bool operator>(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return (it1 - it2) > 0; }
+    friend bool operator<=(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return (it1 - it2) <= 0; }
+    friend bool operator>=(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return (it1 - it2) >= 0; }
+
+    RingDequeIterator& operator++() noexcept { ++_index; return *this; }
+    RingDequeIterator operator++(int) noexcept { RingDequeIterator result(*this); ++_index; return result; }
+    RingDequeIterator& operator--() noexcept { --_index; return *this; }
+    RingDequeIterator operator--(int) noexcept { RingDequeIterator result(*this); --_index; return result; }
+
+    RingDequeIterator& operator+=(difference_type offset) noexcept { _index += (size_t)offset; return *this; }
+    RingDequeIterator& operator-=(difference_type offset) noexcept { _index -= (size_t)offset; return *this; }
+
+    friend RingDequeIterator operator+(const RingDequeIterator& it, difference_type offset) noexcept
+    { return RingDequeIterator(it._container, it._index + (size_t)offset); }
+    friend RingDequeIterator operator+(difference_type offset, const RingDequeIterator& it) noexcept
+    { return RingDequeIterator(it._container, it._index + (size_t)offset); }
+    friend RingDequeIterator operator-(const RingDequeIterator& it, difference_type offset) noexcept
+    { return RingDequeIterator(it._container, it._index - (size_t)offset); }
+    friend difference_type operator-(const RingDequeIterator& it1, const RingDequeIterator& it2) noexcept
+    { return (difference_type)(it1._index - it2._index); }
+
+    reference operator*() const noexcept { return _container->slot(_index); }
+    pointer operator->() const noexcept { return &_container->slot(_index); }
+    reference operator[](difference_type offset) const noexcept { return _container->slot(_index + (size_t)offset); }
+
+    //! Get the stable index of the item
+    size_t index() const noexcept { return _index; }
+
+private:
+    template <class UContainer, typename U>
+    friend class RingDequeIterator;
+
+    TContainer* _container;
+    size_t _index;
+};
+
+/*! \example containers_ring_deque.cpp Ring buffer deque container example */
+
+} // namespace CppCommon
+
+#include "ring_deque.inl"
+
+#endif // CPPCOMMON_CONTAINERS_RING_DEQUE_H
@@ -0,0 +1,180 @@
+/*!
+    \file ring_deque.inl
+    \brief Ring buffer deque container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, typename TAllocator>
+inline RingDeque<T, TAllocator>::RingDeque(size_t capacity, const TAllocator& allocator)
+    : _buffer(allocator), _mask(0), _head(0), _tail(0)
+{
+    size_t reserve = 1;
+    while (reserve < capacity)
+        reserve <<= 1;
+    _buffer.resize(reserve);
+    _mask = reserve - 1;
+}
+
+template <typename T, typename TAllocator>
+inline RingDeque<T, TAllocator>::RingDeque(const RingDeque& deque)
+    : _buffer(deque._buffer), _mask(deque._mask), _head(deque._head), _tail(deque._tail)
+{
+}
+
+template <typename T, typename TAllocator>
+inline RingDeque<T, TAllocator>::RingDeque(RingDeque&& deque) noexcept
+    : _buffer(std::move(deque._buffer)), _mask(deque._mask), _head(deque._head), _tail(deque._tail)
+{
+    deque._buffer.clear();
+    deque._mask = 0;
+    deque._head = 0;
+    deque._tail = 0;
+}
+
+template <typename T, typename TAllocator>
+inline RingDeque<T, TAllocator>& RingDeque<T, TAllocator>::operator=(const RingDeque& deque)
+{
+    RingDeque<T, TAllocator>(deque).swap(*this);
+    return *this;
+}
+
+template <typename T, typename TAllocator>
+inline RingDeque<T, TAllocator>& RingDeque<T, TAllocator>::operator=(RingDeque&& deque) noexcept
+{
+    RingDeque<T, TAllocator>(std::move(deque)).swap(*this);
+    return *this;
+}
+
+template <typename T, typename TAllocator>
+inline T& RingDeque<T, TAllocator>::at(size_t position)
+{
+    if (position >= size())
+        throw std::out_of_range("Item with the given position was not found in the ring deque!");
+
+    return slot(_head + position);
+}
+
+template <typename T, typename TAllocator>
+inline const T& RingDeque<T, TAllocator>::at(size_t position) const
+{
+    if (position >= size())
+        throw std::out_of_range("Item with the given position was not found in the ring deque!");
+
+    return slot(_head + position);
+}
+
+template <typename T, typename TAllocator>
+inline size_t RingDeque<T, TAllocator>::push_back(const T& item)
+{
+    if (size() == capacity())
+        grow_internal(size() + 1);
+
+    _buffer[_tail & _mask] = item;
+    return _tail++;
+}
+
+template <typename T, typename TAllocator>
+inline size_t RingDeque<T, TAllocator>::push_front(const T& item)
+{
+    if (size() == capacity())
+        grow_internal(size() + 1);
+
+    _buffer[--_head & _mask] = item;
+    return _head;
+}
+
+template <typename T, typename TAllocator>
+inline size_t RingDeque<T, TAllocator>::push_back(const T* items, size_t count)
+{
+    if ((size() + count) > capacity())
+        grow_internal(size() + count);
+
+    size_t index = _tail;
+    copy_internal(_buffer.data(), _mask, index, items, count);
+    _tail += count;
+    return index;
+}
+
+template <typename T, typename TAllocator>
+inline size_t RingDeque<T, TAllocator>::pop_front(T* items, size_t count) noexcept
+{
+    count = std::min(count, size());
+
+    // Copy items from the buffer with at most two copy operations
+    size_t offset = _head & _mask;
+    size_t first = std::min(count, capacity() - offset);
+    if (first > 0)
+        std::memcpy(items, _buffer.data() + offset, first * sizeof(T));
+    if (count > first)
+        std::memcpy(items + first, _buffer.data(), (count - first) * sizeof(T));
+
+    _head += count;
+    return count;
+}
+
+template <typename T, typename TAllocator>
+inline size_t RingDeque<T, TAllocator>::skip_front(size_t count) noexcept
+{
+    count = std::min(count, size());
+    _head += count;
+    return count;
+}
+
+template <typename T, typename TAllocator>
+inline void RingDeque<T, TAllocator>::reserve(size_t count)
+{
+    if (capacity() < count)
+        grow_internal(count);
+}
+
+template <typename T, typename TAllocator>
+inline void RingDeque<T, TAllocator>::grow_internal(size_t count)
+{
+    size_t reserve = std::max<size_t>(capacity(), 1);
+    while (reserve < count)
+        reserve <<= 1;
+
+    // Copy items into the new buffer keeping their stable indices
+    std::vector<T, TAllocator> buffer(reserve, _buffer.get_allocator());
+    size_t offset = _head & _mask;
+    size_t first = std::min(size(), capacity() - offset);
+    copy_internal(buffer.data(), reserve - 1, _head, _buffer.data() + offset, first);
+    copy_internal(buffer.data(), reserve - 1, _head + first, _buffer.data(), size() - first);
+
+    _buffer.swap(buffer);
+    _mask = reserve - 1;
+}
+
+template <typename T, typename TAllocator>
+inline void RingDeque<T, TAllocator>::copy_internal(T* buffer, size_t mask, size_t index, const T* items, size_t count) noexcept
+{
+    // Copy items into the buffer with at most two copy operations
+    size_t offset = index & mask;
+    size_t first = std::min(count, mask + 1 - offset);
+    if (first > 0)
+        std::memcpy(buffer + offset, items, first * sizeof(T));
+    if (count > first)
+        std::memcpy(buffer, items + first, (count - first) * sizeof(T));
+}
+
+template <typename T, typename TAllocator>
+inline void RingDeque<T, TAllocator>::swap(RingDeque& deque) noexcept
+{
+    using std::swap;
+    swap(_buffer, deque._buffer);
+    swap(_mask, deque._mask);
+    swap(_head, deque._head);
+    swap(_tail, deque._tail);
+}
+
+template <typename T, typename TAllocator>
+inline void swap(RingDeque<T, TAllocator>& deque1, RingDeque<T, TAllocator>& deque2) noexcept
+{
+    deque1.swap(deque2);
+}
+
+} // namespace CppCommon
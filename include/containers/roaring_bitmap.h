@@ -0,0 +1,314 @@
+/*!
+    \file roaring_bitmap.h
+    \brief Roaring compressed bitmap container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_ROARING_BITMAP_H
+#define CPPCOMMON_CONTAINERS_ROARING_BITMAP_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace CppCommon {
+
+class RoaringBitmapIterator;
+
+//! Roaring compressed bitmap container
+/*!
+    Roaring bitmap is a compressed set of 32-bit unsigned integers. The values
+    space is split into chunks of 65536 values by the high 16 bits and each
+    non-empty chunk is stored in the container of the most compact type:
+    \li Array container - sorted array of up to 4096 low 16 bits values;
+    \li Bitmap container - bitmap of 65536 bits (8 KB);
+    \li Run container - sorted array of runs of consecutive values.
+
+    Set operations (AND, OR, XOR, ANDNOT) are performed chunk by chunk with
+    merging of arrays and with word operations on bitmaps, which are
+    vectorized with AVX2 instructions if available. Run containers are created
+    with run_optimize() method only and are expanded when modified.
+
+    Serialized roaring bitmap is a flat buffer with 8 bytes aligned
+    containers data, so it could be mapped into memory from a file and
+    queried with RoaringBitmapView without deserialization. Serialized
+    format uses the native byte order.
+
+    Not thread-safe.
+
+    <b>References</b>\n
+    \li Samy Chambi, Daniel Lemire, Owen Kaser, Robert Godin. Better bitmap
+        performance with Roaring bitmaps. Software: Practice and Experience,
+        46(5):709-719, 2016.
+    \li Daniel Lemire, Owen Kaser, Nathan Kurz et al. Roaring Bitmaps:
+        Implementation of an Optimized Software Library. Software: Practice and
+        Experience, 48(4):867-895, 2018.
+*/
+class RoaringBitmap
+{
+    friend class RoaringBitmapIterator;
+    friend class RoaringBitmapView;
+
+public:
+    // Standard container type definitions
+    typedef uint32_t value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef size_t size_type;
+    typedef RoaringBitmapIterator iterator;
+    typedef RoaringBitmapIterator const_iterator;
+
+    RoaringBitmap() = default;
+    RoaringBitmap(std::initializer_list<uint32_t> values);
+    RoaringBitmap(const RoaringBitmap&) = default;
+    RoaringBitmap(RoaringBitmap&&) noexcept = default;
+    ~RoaringBitmap() = default;
+
+    RoaringBitmap& operator=(const RoaringBitmap&) = default;
+    RoaringBitmap& operator=(RoaringBitmap&&) noexcept = default;
+
+    //! Check if the roaring bitmap is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Intersection of two roaring bitmaps
+    RoaringBitmap& operator&=(const RoaringBitmap& bitmap);
+    //! Union of two roaring bitmaps
+    RoaringBitmap& operator|=(const RoaringBitmap& bitmap);
+    //! Symmetric difference of two roaring bitmaps
+    RoaringBitmap& operator^=(const RoaringBitmap& bitmap);
+    //! Difference of two roaring bitmaps
+    RoaringBitmap& operator-=(const RoaringBitmap& bitmap);
+
+    friend RoaringBitmap operator&(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+    friend RoaringBitmap operator|(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+    friend RoaringBitmap operator^(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+    friend RoaringBitmap operator-(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+
+    friend bool operator==(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+    friend bool operator!=(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+    { return !(bitmap1 == bitmap2); }
+
+    //! Is the roaring bitmap empty?
+    bool empty() const noexcept { return _containers.empty(); }
+
+    //! Get the roaring bitmap cardinality (count of values)
+    uint64_t cardinality() const noexcept;
+    //! Get the roaring bitmap size (count of values)
+    size_t size() const noexcept { return (size_t)cardinality(); }
+
+    //! Get the count of roaring bitmap containers
+    size_t containers() const noexcept { return _containers.size(); }
+
+    //! Get the minimal value of the non-empty roaring bitmap
+    uint32_t minimum() const noexcept;
+    //! Get the maximal value of the non-empty roaring bitmap
+    uint32_t maximum() const noexcept;
+
+    //! Get the begin roaring bitmap iterator
+    iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end roaring bitmap iterator
+    iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Check if the roaring bitmap contains the given value
+    bool contains(uint32_t value) const noexcept;
+
+    //! Add the given value into the roaring bitmap
+    /*!
+        \param value - Value to add
+        \return 'true' if the value was added, 'false' if the value already exists
+    */
+    bool add(uint32_t value);
+    //! Add the given range of values [first, last] into the roaring bitmap
+    /*!
+        \param first - The first value of the range
+        \param last - The last value of the range
+    */
+    void add_range(uint32_t first, uint32_t last);
+    //! Remove the given value from the roaring bitmap
+    /*!
+        \param value - Value to remove
+        \return 'true' if the value was removed, 'false' if the value was not found
+    */
+    bool remove(uint32_t value);
+
+    //! Get the cardinality of the intersection of two roaring bitmaps without building it
+    static uint64_t and_cardinality(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2);
+
+    //! Convert containers to run containers where they are more compact
+    /*!
+        \return 'true' if any container was converted, 'false' if all containers remain the same
+    */
+    bool run_optimize();
+    //! Shrink all containers memory to fit their data
+    void shrink_to_fit();
+
+    //! Get the size of the roaring bitmap serialized buffer in bytes
+    size_t serialized_size() const noexcept;
+    //! Serialize the roaring bitmap into the given buffer
+    /*!
+        \param buffer - Buffer of serialized_size() bytes
+        \return Count of written bytes
+    */
+    size_t serialize(void* buffer) const;
+    //! Serialize the roaring bitmap into the bytes vector
+    std::vector<uint8_t> serialize() const;
+    //! Deserialize the roaring bitmap from the given buffer
+    /*!
+        Throws std::invalid_argument exception if the buffer is not valid.
+
+        \param buffer - Serialized buffer
+        \param size - Serialized buffer size
+        \return Deserialized roaring bitmap
+    */
+    static RoaringBitmap deserialize(const void* buffer, size_t size);
+
+    //! Clear the roaring bitmap
+    void clear() noexcept { _containers.clear(); }
+
+    //! Swap two instances
+    void swap(RoaringBitmap& bitmap) noexcept;
+    friend void swap(RoaringBitmap& bitmap1, RoaringBitmap& bitmap2) noexcept;
+
+private:
+    enum class ContainerType : uint8_t
+    {
+        ARRAY,
+        BITMAP,
+        RUN
+    };
+
+    // Roaring bitmap chunk container
+    struct Container
+    {
+        uint16_t key;                   // Container key (high 16 bits of values)
+        ContainerType type;             // Container type
+        uint32_t cardinality;           // Container cardinality
+        std::vector<uint16_t> values;   // Sorted array values or pairs of run start and length minus one
+        std::vector<uint64_t> words;    // Bitmap words
+    };
+
+    std::vector<Container> _containers;
+
+    static constexpr uint32_t ARRAY_LIMIT = 4096;
+    static constexpr size_t BITMAP_WORDS = 1024;
+
+    size_t find_internal(uint16_t key) const noexcept;
+
+    static bool contains_internal(const Container& container, uint16_t low) noexcept;
+    static void to_bitmap_internal(Container& container);
+    static void normalize_internal(Container& container);
+    static uint32_t runs_internal(const Container& container) noexcept;
+
+    static Container and_internal(const Container& container1, const Container& container2);
+    static Container or_internal(const Container& container1, const Container& container2);
+    static Container xor_internal(const Container& container1, const Container& container2);
+    static Container andnot_internal(const Container& container1, const Container& container2);
+    static uint32_t and_cardinality_internal(const Container& container1, const Container& container2);
+
+    template <class TOperation>
+    static RoaringBitmap combine_internal(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2, TOperation operation, bool left, bool right);
+};
+
+//! Roaring bitmap iterator
+/*!
+    Constant forward iterator over values of the roaring bitmap in ascending order.
+
+    Not thread-safe.
+*/
+class RoaringBitmapIterator
+{
+    friend class RoaringBitmap;
+
+public:
+    // Standard iterator type definitions
+    typedef uint32_t value_type;
+    typedef const uint32_t& reference;
+    typedef const uint32_t* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    RoaringBitmapIterator() noexcept : _bitmap(nullptr), _container(0), _position(0), _offset(0), _value(0) {}
+    RoaringBitmapIterator(const RoaringBitmapIterator&) noexcept = default;
+    ~RoaringBitmapIterator() noexcept = default;
+
+    RoaringBitmapIterator& operator=(const RoaringBitmapIterator&) noexcept = default;
+
+    friend bool operator==(const RoaringBitmapIterator& it1, const RoaringBitmapIterator& it2) noexcept
+    { return (it1._container == it2._container) && (it1._position == it2._position) && (it1._offset == it2._offset); }
+    friend bool operator!=(const RoaringBitmapIterator& it1, const RoaringBitmapIterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    RoaringBitmapIterator& operator++() noexcept;
+    RoaringBitmapIterator operator++(int) noexcept { RoaringBitmapIterator result(*this); operator++(); return result; }
+
+    reference operator*() const noexcept { assert((_bitmap != nullptr) && "Iterator must be valid!"); return _value; }
+    pointer operator->() const noexcept { return &_value; }
+
+private:
+    const RoaringBitmap* _bitmap;
+    size_t _container;  // Container index
+    uint32_t _position; // Array index, bitmap bit index or run index
+    uint32_t _offset;   // Offset in the current run
+    uint32_t _value;    // Current value
+
+    RoaringBitmapIterator(const RoaringBitmap* bitmap, size_t container) noexcept;
+
+    void seek() noexcept;
+};
+
+//! Roaring bitmap view
+/*!
+    Roaring bitmap view queries the serialized roaring bitmap buffer (e.g. mapped
+    into memory from a file) without deserialization. The buffer must be 8 bytes
+    aligned and must outlive the view.
+
+    Thread-safe.
+*/
+class RoaringBitmapView
+{
+public:
+    //! Initialize the roaring bitmap view with the given serialized buffer
+    /*!
+        Throws std::invalid_argument exception if the buffer is not valid.
+
+        \param buffer - Serialized buffer
+        \param size - Serialized buffer size
+    */
+    RoaringBitmapView(const void* buffer, size_t size);
+    RoaringBitmapView(const RoaringBitmapView&) noexcept = default;
+    RoaringBitmapView(RoaringBitmapView&&) noexcept = default;
+    ~RoaringBitmapView() noexcept = default;
+
+    RoaringBitmapView& operator=(const RoaringBitmapView&) noexcept = default;
+    RoaringBitmapView& operator=(RoaringBitmapView&&) noexcept = default;
+
+    //! Is the roaring bitmap view empty?
+    bool empty() const noexcept { return _count == 0; }
+
+    //! Get the roaring bitmap view cardinality (count of values)
+    uint64_t cardinality() const noexcept;
+
+    //! Check if the roaring bitmap view contains the given value
+    bool contains(uint32_t value) const noexcept;
+
+    //! Convert the roaring bitmap view into the roaring bitmap
+    RoaringBitmap bitmap() const;
+
+private:
+    const uint8_t* _buffer;
+    size_t _size;
+    uint32_t _count;
+};
+
+/*! \example containers_roaring_bitmap.cpp Roaring compressed bitmap container example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_CONTAINERS_ROARING_BITMAP_H
@@ -0,0 +1,174 @@
+/*!
+    \file shared_flatmap.h
+    \brief Shared memory flat map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_SHARED_FLATMAP_H
+#define CPPCOMMON_CONTAINERS_SHARED_FLATMAP_H
+
+#include "memory/allocator_shared.h"
+#include "memory/offset_ptr.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Shared memory flat map container
+/*!
+    Shared memory flat map is a position-independent sorted array of items
+    which is placed in the shared memory region managed by SharedMemoryManager.
+    Items are referred with the offset pointer, so the flat map created by
+    one process could be used by other processes which map the same shared
+    memory region at different addresses.
+
+    Flat map is the best choice for build once / read many lookup tables:
+    it has the minimal memory overhead, binary search lookups and ordered
+    iteration. Insertion and removal are O(n).
+
+    Keys and values must be trivially copyable and must not contain pointers.
+    Comparator is default constructed on each call and must give the same
+    results in all processes.
+
+    Iterators are pointers to items valid only in the current process.
+
+    Not thread-safe. Several processes could read the flat map concurrently
+    while no process modifies it.
+*/
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>>
+class SharedFlatMap
+{
+    static_assert(std::is_trivially_copyable<TKey>::value, "Shared flat map key must be trivially copyable!");
+    static_assert(std::is_trivially_copyable<TValue>::value, "Shared flat map value must be trivially copyable!");
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    //! Initialize the flat map in the given shared memory region
+    /*!
+        \param manager - Shared memory manager
+        \param capacity - Flat map capacity (default is 128)
+    */
+    explicit SharedFlatMap(SharedMemoryManager& manager, size_t capacity = 128);
+    SharedFlatMap(const SharedFlatMap&) = delete;
+    SharedFlatMap(SharedFlatMap&&) = delete;
+    ~SharedFlatMap();
+
+    SharedFlatMap& operator=(const SharedFlatMap&) = delete;
+    SharedFlatMap& operator=(SharedFlatMap&&) = delete;
+
+    //! Check if the flat map is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given key or insert a new one
+    mapped_type& operator[](const TKey& key) { return emplace(key, TValue()).first->second; }
+
+    //! Is the flat map empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the flat map size
+    size_t size() const noexcept { return _size; }
+    //! Get the flat map capacity
+    size_t capacity() const noexcept { return _capacity; }
+
+    //! Get the begin flat map iterator
+    iterator begin() noexcept { return _items.get(); }
+    const_iterator begin() const noexcept { return _items.get(); }
+    const_iterator cbegin() const noexcept { return _items.get(); }
+    //! Get the end flat map iterator
+    iterator end() noexcept { return _items.get() + _size; }
+    const_iterator end() const noexcept { return _items.get() + _size; }
+    const_iterator cend() const noexcept { return _items.get() + _size; }
+
+    //! Find the iterator which points to the item with the given key
+    /*!
+        \param key - Key to find
+        \return Flat map iterator
+    */
+    iterator find(const TKey& key) noexcept { return const_cast<iterator>(std::as_const(*this).find(key)); }
+    const_iterator find(const TKey& key) const noexcept;
+
+    //! Find the iterator which points to the first item that not less than the given key
+    iterator lower_bound(const TKey& key) noexcept { return const_cast<iterator>(std::as_const(*this).lower_bound(key)); }
+    const_iterator lower_bound(const TKey& key) const noexcept;
+    //! Find the iterator which points to the first item that greater than the given key
+    iterator upper_bound(const TKey& key) noexcept { return const_cast<iterator>(std::as_const(*this).upper_bound(key)); }
+    const_iterator upper_bound(const TKey& key) const noexcept;
+
+    //! Find the count of items with the given key
+    size_t count(const TKey& key) const noexcept { return (find(key) != end()) ? 1 : 0; }
+    //! Is the flat map contains an item with the given key?
+    bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+
+    //! Insert a new item into the flat map
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted item and success flag
+    */
+    std::pair<iterator, bool> insert(const value_type& item) { return emplace(item.first, item.second); }
+
+    //! Emplace a new item into the flat map
+    /*!
+        \param key - Item key
+        \param value - Item value
+        \return Pair with the iterator to the inserted or existing item and success flag
+    */
+    std::pair<iterator, bool> emplace(const TKey& key, const TValue& value);
+
+    //! Erase the item with the given key from the flat map
+    /*!
+        \param key - Key of the item to erase
+        \return Number of erased items (0 or 1)
+    */
+    size_t erase(const TKey& key);
+    //! Erase the item by its position from the flat map
+    /*!
+        \param position - Iterator position to the erased item
+        \return Iterator to the item following the erased one
+    */
+    iterator erase(const_iterator position);
+
+    //! Reserve the flat map capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+    //! Shrink the flat map capacity to its size
+    void shrink_to_fit();
+
+    //! Clear the flat map
+    void clear() noexcept;
+
+private:
+    OffsetPtr<Internals::SharedHeap> _heap;     // Shared memory heap
+    OffsetPtr<value_type> _items;               // Flat map sorted items
+    size_t _capacity;                           // Flat map capacity
+    size_t _size;                               // Flat map size
+
+    void reallocate_internal(size_t capacity);
+};
+
+} // namespace CppCommon
+
+#include "shared_flatmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_SHARED_FLATMAP_H
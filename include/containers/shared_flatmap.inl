@@ -0,0 +1,137 @@
+/*!
+    \file shared_flatmap.inl
+    \brief Shared memory flat map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename TCompare>
+inline SharedFlatMap<TKey, TValue, TCompare>::SharedFlatMap(SharedMemoryManager& manager, size_t capacity)
+    : _heap(manager.heap()), _capacity(0), _size(0)
+{
+    reallocate_internal(std::max((size_t)8, capacity));
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline SharedFlatMap<TKey, TValue, TCompare>::~SharedFlatMap()
+{
+    clear();
+    _heap->free(_items.get(), _capacity * sizeof(value_type));
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void SharedFlatMap<TKey, TValue, TCompare>::reallocate_internal(size_t capacity)
+{
+    value_type* items = (value_type*)_heap->malloc(capacity * sizeof(value_type), alignof(value_type));
+    if (items == nullptr)
+        throw std::bad_alloc();
+
+    // Move all items into the new storage
+    value_type* old_items = _items.get();
+    for (size_t i = 0; i < _size; ++i)
+    {
+        new (&items[i]) value_type(std::move(old_items[i]));
+        old_items[i].~value_type();
+    }
+
+    if (old_items != nullptr)
+        _heap->free(old_items, _capacity * sizeof(value_type));
+    _items = items;
+    _capacity = capacity;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename SharedFlatMap<TKey, TValue, TCompare>::const_iterator SharedFlatMap<TKey, TValue, TCompare>::find(const TKey& key) const noexcept
+{
+    const_iterator it = lower_bound(key);
+    return ((it != end()) && !TCompare()(key, it->first)) ? it : end();
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename SharedFlatMap<TKey, TValue, TCompare>::const_iterator SharedFlatMap<TKey, TValue, TCompare>::lower_bound(const TKey& key) const noexcept
+{
+    return std::lower_bound(begin(), end(), key, [](const value_type& item, const TKey& k) { return TCompare()(item.first, k); });
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename SharedFlatMap<TKey, TValue, TCompare>::const_iterator SharedFlatMap<TKey, TValue, TCompare>::upper_bound(const TKey& key) const noexcept
+{
+    return std::upper_bound(begin(), end(), key, [](const TKey& k, const value_type& item) { return TCompare()(k, item.first); });
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline std::pair<typename SharedFlatMap<TKey, TValue, TCompare>::iterator, bool> SharedFlatMap<TKey, TValue, TCompare>::emplace(const TKey& key, const TValue& value)
+{
+    size_t index = (size_t)(lower_bound(key) - begin());
+    if ((index < _size) && !TCompare()(key, _items.get()[index].first))
+        return std::make_pair(begin() + index, false);
+
+    if (_size == _capacity)
+        reallocate_internal(_capacity * 2);
+
+    // Shift greater items to make the room for the new one
+    value_type* items = _items.get();
+    if (index < _size)
+    {
+        new (&items[_size]) value_type(std::move(items[_size - 1]));
+        std::move_backward(items + index, items + _size - 1, items + _size);
+        items[index] = value_type(key, value);
+    }
+    else
+        new (&items[index]) value_type(key, value);
+    ++_size;
+
+    return std::make_pair(items + index, true);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline size_t SharedFlatMap<TKey, TValue, TCompare>::erase(const TKey& key)
+{
+    const_iterator it = find(key);
+    if (it == end())
+        return 0;
+
+    erase(it);
+    return 1;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline typename SharedFlatMap<TKey, TValue, TCompare>::iterator SharedFlatMap<TKey, TValue, TCompare>::erase(const_iterator position)
+{
+    assert((position >= begin()) && (position < end()) && "Iterator must point to the item of the flat map!");
+
+    value_type* items = _items.get();
+    size_t index = (size_t)(position - items);
+    std::move(items + index + 1, items + _size, items + index);
+    items[--_size].~value_type();
+    return items + index;
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void SharedFlatMap<TKey, TValue, TCompare>::reserve(size_t count)
+{
+    if (count > _capacity)
+        reallocate_internal(count);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void SharedFlatMap<TKey, TValue, TCompare>::shrink_to_fit()
+{
+    size_t capacity = std::max((size_t)1, _size);
+    if (capacity < _capacity)
+        reallocate_internal(capacity);
+}
+
+template <typename TKey, typename TValue, typename TCompare>
+inline void SharedFlatMap<TKey, TValue, TCompare>::clear() noexcept
+{
+    value_type* items = _items.get();
+    for (size_t i = 0; i < _size; ++i)
+        items[i].~value_type();
+    _size = 0;
+}
+
+} // namespace CppCommon
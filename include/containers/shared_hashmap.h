@@ -0,0 +1,222 @@
+/*!
+    \file shared_hashmap.h
+    \brief Shared memory hash map container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_SHARED_HASHMAP_H
+#define CPPCOMMON_CONTAINERS_SHARED_HASHMAP_H
+
+#include "memory/allocator_shared.h"
+#include "memory/offset_ptr.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+template <class TContainer, typename TValueType>
+class SharedHashMapIterator;
+
+//! Shared memory hash map container
+/*!
+    Shared memory hash map is a position-independent open addressing hash map
+    which is placed with all its buckets in the shared memory region managed
+    by SharedMemoryManager. Buckets are referred with offset pointers, so the
+    hash map created by one process could be used by other processes which
+    map the same shared memory region at different addresses (e.g. huge
+    lookup tables mapped once instead of loaded per process).
+
+    Keys and values must be trivially copyable and must not contain pointers.
+    Hasher and comparator are default constructed on each call and must give
+    the same results in all processes.
+
+    Buckets are probed linearly and removed with the backward shift, so the
+    hash map has no tombstones.
+
+    Not thread-safe. Several processes could read the hash map concurrently
+    while no process modifies it.
+*/
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEqual = std::equal_to<TKey>>
+class SharedHashMap
+{
+    static_assert(std::is_trivially_copyable<TKey>::value, "Shared hash map key must be trivially copyable!");
+    static_assert(std::is_trivially_copyable<TValue>::value, "Shared hash map value must be trivially copyable!");
+
+    friend class SharedHashMapIterator<SharedHashMap<TKey, TValue, THash, TEqual>, std::pair<TKey, TValue>>;
+    friend class SharedHashMapIterator<const SharedHashMap<TKey, TValue, THash, TEqual>, const std::pair<TKey, TValue>>;
+
+public:
+    // Standard container type definitions
+    typedef TKey key_type;
+    typedef TValue mapped_type;
+    typedef std::pair<TKey, TValue> value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef SharedHashMapIterator<SharedHashMap<TKey, TValue, THash, TEqual>, std::pair<TKey, TValue>> iterator;
+    typedef SharedHashMapIterator<const SharedHashMap<TKey, TValue, THash, TEqual>, const std::pair<TKey, TValue>> const_iterator;
+
+    //! Initialize the hash map in the given shared memory region
+    /*!
+        \param manager - Shared memory manager
+        \param capacity - Hash map capacity (default is 128)
+    */
+    explicit SharedHashMap(SharedMemoryManager& manager, size_t capacity = 128);
+    SharedHashMap(const SharedHashMap&) = delete;
+    SharedHashMap(SharedHashMap&&) = delete;
+    ~SharedHashMap();
+
+    SharedHashMap& operator=(const SharedHashMap&) = delete;
+    SharedHashMap& operator=(SharedHashMap&&) = delete;
+
+    //! Check if the hash map is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given key or insert a new one
+    mapped_type& operator[](const TKey& key) { return emplace(key, TValue()).first->second; }
+
+    //! Is the hash map empty?
+    bool empty() const noexcept { return (_size == 0); }
+
+    //! Get the hash map size
+    size_t size() const noexcept { return _size; }
+    //! Get the hash map bucket count
+    size_t bucket_count() const noexcept { return _capacity; }
+
+    //! Get the begin hash map iterator
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end hash map iterator
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Find the iterator which points to the first item with the given key
+    /*!
+        \param key - Key to find
+        \return Hash map iterator
+    */
+    iterator find(const TKey& key) noexcept;
+    const_iterator find(const TKey& key) const noexcept;
+
+    //! Find the count of items with the given key
+    size_t count(const TKey& key) const noexcept { return (find(key) != end()) ? 1 : 0; }
+    //! Is the hash map contains an item with the given key?
+    bool contains(const TKey& key) const noexcept { return (find(key) != end()); }
+
+    //! Insert a new item into the hash map
+    /*!
+        \param item - Item to insert
+        \return Pair with the iterator to the inserted item and success flag
+    */
+    std::pair<iterator, bool> insert(const value_type& item) { return emplace(item.first, item.second); }
+
+    //! Emplace a new item into the hash map
+    /*!
+        \param key - Item key
+        \param value - Item value
+        \return Pair with the iterator to the inserted or existing item and success flag
+    */
+    std::pair<iterator, bool> emplace(const TKey& key, const TValue& value);
+
+    //! Erase the item with the given key from the hash map
+    /*!
+        \param key - Key of the item to erase
+        \return Number of erased items (0 or 1)
+    */
+    size_t erase(const TKey& key);
+    //! Erase the item by its position from the hash map
+    /*!
+        \param position - Iterator position to the erased item
+    */
+    void erase(const const_iterator& position);
+
+    //! Rehash the hash map to the given capacity or more
+    /*!
+        \param capacity - Hash map capacity
+    */
+    void rehash(size_t capacity);
+    //! Reserve the hash map capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+
+    //! Clear the hash map
+    void clear() noexcept;
+
+private:
+    OffsetPtr<Internals::SharedHeap> _heap;     // Shared memory heap
+    OffsetPtr<value_type> _buckets;             // Hash map buckets
+    OffsetPtr<uint8_t> _filled;                 // Hash map bucket filled flags
+    size_t _capacity;                           // Hash map bucket count (power of two)
+    size_t _size;                               // Hash map size
+
+    static size_t key_to_index(const TKey& key, size_t capacity) noexcept { return THash()(key) & (capacity - 1); }
+    size_t find_internal(const TKey& key) const noexcept;
+    size_t next_internal(size_t index) const noexcept;
+    void erase_internal(size_t index);
+    void allocate_internal(size_t capacity, OffsetPtr<value_type>& buckets, OffsetPtr<uint8_t>& filled);
+    void release_internal(value_type* buckets, uint8_t* filled, size_t capacity) noexcept;
+};
+
+//! Shared memory hash map iterator
+template <class TContainer, typename TValueType>
+class SharedHashMapIterator
+{
+    friend TContainer;
+
+public:
+    // Standard iterator type definitions
+    typedef TValueType value_type;
+    typedef value_type& reference;
+    typedef value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    SharedHashMapIterator() noexcept : _container(nullptr), _index(0) {}
+    explicit SharedHashMapIterator(TContainer* container, size_t index) noexcept : _container(container), _index(index) {}
+    template <class UContainer, typename UValueType>
+    SharedHashMapIterator(const SharedHashMapIterator<UContainer, UValueType>& it) noexcept : _container(it._container), _index(it._index) {}
+
+    SharedHashMapIterator& operator++() noexcept { _index = _container->next_internal(_index + 1); return *this; }
+    SharedHashMapIterator operator++(int) noexcept { SharedHashMapIterator result(*this); operator++(); return result; }
+
+    reference operator*() const noexcept { return _container->_buckets.get()[_index]; }
+    pointer operator->() const noexcept { return &_container->_buckets.get()[_index]; }
+
+    template <class UContainer, typename UValueType>
+    bool operator==(const SharedHashMapIterator<UContainer, UValueType>& it) const noexcept { return (_container == it._container) && (_index == it._index); }
+    template <class UContainer, typename UValueType>
+    bool operator!=(const SharedHashMapIterator<UContainer, UValueType>& it) const noexcept { return !operator==(it); }
+
+private:
+    template <class UContainer, typename UValueType>
+    friend class SharedHashMapIterator;
+
+    TContainer* _container;
+    size_t _index;
+};
+
+/*! \example containers_shared_hashmap.cpp Shared memory hash map container example */
+
+} // namespace CppCommon
+
+#include "shared_hashmap.inl"
+
+#endif // CPPCOMMON_CONTAINERS_SHARED_HASHMAP_H
@@ -0,0 +1,259 @@
+/*!
+    \file shared_hashmap.inl
+    \brief Shared memory hash map container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline SharedHashMap<TKey, TValue, THash, TEqual>::SharedHashMap(SharedMemoryManager& manager, size_t capacity)
+    : _heap(manager.heap()), _capacity(0), _size(0)
+{
+    _capacity = std::bit_ceil(std::max((size_t)8, capacity));
+    allocate_internal(_capacity, _buckets, _filled);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline SharedHashMap<TKey, TValue, THash, TEqual>::~SharedHashMap()
+{
+    release_internal(_buckets.get(), _filled.get(), _capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::allocate_internal(size_t capacity, OffsetPtr<value_type>& buckets, OffsetPtr<uint8_t>& filled)
+{
+    void* buckets_ptr = _heap->malloc(capacity * sizeof(value_type), alignof(value_type));
+    if (buckets_ptr == nullptr)
+        throw std::bad_alloc();
+    void* filled_ptr = _heap->malloc(capacity, 1);
+    if (filled_ptr == nullptr)
+    {
+        _heap->free(buckets_ptr, capacity * sizeof(value_type));
+        throw std::bad_alloc();
+    }
+    std::memset(filled_ptr, 0, capacity);
+    buckets = (value_type*)buckets_ptr;
+    filled = (uint8_t*)filled_ptr;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::release_internal(value_type* buckets, uint8_t* filled, size_t capacity) noexcept
+{
+    if (buckets != nullptr)
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            if (filled[i])
+                buckets[i].~value_type();
+        _heap->free(buckets, capacity * sizeof(value_type));
+    }
+    if (filled != nullptr)
+        _heap->free(filled, capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t SharedHashMap<TKey, TValue, THash, TEqual>::next_internal(size_t index) const noexcept
+{
+    const uint8_t* filled = _filled.get();
+    while ((index < _capacity) && !filled[index])
+        ++index;
+    return index;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::iterator SharedHashMap<TKey, TValue, THash, TEqual>::begin() noexcept
+{
+    return iterator(this, next_internal(0));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::const_iterator SharedHashMap<TKey, TValue, THash, TEqual>::begin() const noexcept
+{
+    return const_iterator(this, next_internal(0));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::const_iterator SharedHashMap<TKey, TValue, THash, TEqual>::cbegin() const noexcept
+{
+    return const_iterator(this, next_internal(0));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::iterator SharedHashMap<TKey, TValue, THash, TEqual>::end() noexcept
+{
+    return iterator(this, _capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::const_iterator SharedHashMap<TKey, TValue, THash, TEqual>::end() const noexcept
+{
+    return const_iterator(this, _capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::const_iterator SharedHashMap<TKey, TValue, THash, TEqual>::cend() const noexcept
+{
+    return const_iterator(this, _capacity);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t SharedHashMap<TKey, TValue, THash, TEqual>::find_internal(const TKey& key) const noexcept
+{
+    const value_type* buckets = _buckets.get();
+    const uint8_t* filled = _filled.get();
+    const size_t mask = _capacity - 1;
+
+    // Probe buckets until the first empty one
+    for (size_t index = key_to_index(key, _capacity);; index = (index + 1) & mask)
+    {
+        if (!filled[index])
+            return _capacity;
+        if (TEqual()(buckets[index].first, key))
+            return index;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::iterator SharedHashMap<TKey, TValue, THash, TEqual>::find(const TKey& key) noexcept
+{
+    return iterator(this, find_internal(key));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline typename SharedHashMap<TKey, TValue, THash, TEqual>::const_iterator SharedHashMap<TKey, TValue, THash, TEqual>::find(const TKey& key) const noexcept
+{
+    return const_iterator(this, find_internal(key));
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline std::pair<typename SharedHashMap<TKey, TValue, THash, TEqual>::iterator, bool> SharedHashMap<TKey, TValue, THash, TEqual>::emplace(const TKey& key, const TValue& value)
+{
+    size_t index = find_internal(key);
+    if (index != _capacity)
+        return std::make_pair(iterator(this, index), false);
+
+    // Keep the load factor not greater than 0.5
+    if (((_size + 1) * 2) > _capacity)
+        rehash(_capacity * 2);
+
+    value_type* buckets = _buckets.get();
+    uint8_t* filled = _filled.get();
+    const size_t mask = _capacity - 1;
+
+    index = key_to_index(key, _capacity);
+    while (filled[index])
+        index = (index + 1) & mask;
+
+    new (&buckets[index]) value_type(key, value);
+    filled[index] = 1;
+    ++_size;
+    return std::make_pair(iterator(this, index), true);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline size_t SharedHashMap<TKey, TValue, THash, TEqual>::erase(const TKey& key)
+{
+    size_t index = find_internal(key);
+    if (index == _capacity)
+        return 0;
+
+    erase_internal(index);
+    return 1;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::erase(const const_iterator& position)
+{
+    assert((position._container == this) && (position._index < _capacity) && "Iterator must point to the item of the hash map!");
+
+    erase_internal(position._index);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::erase_internal(size_t index)
+{
+    value_type* buckets = _buckets.get();
+    uint8_t* filled = _filled.get();
+    const size_t mask = _capacity - 1;
+
+    buckets[index].~value_type();
+    filled[index] = 0;
+    --_size;
+
+    // Shift back all following items of the probe chain which could fill the hole
+    for (size_t next = (index + 1) & mask; filled[next]; next = (next + 1) & mask)
+    {
+        size_t ideal = key_to_index(buckets[next].first, _capacity);
+        bool stays = (index <= next) ? ((index < ideal) && (ideal <= next)) : ((index < ideal) || (ideal <= next));
+        if (stays)
+            continue;
+
+        new (&buckets[index]) value_type(std::move(buckets[next]));
+        buckets[next].~value_type();
+        filled[index] = 1;
+        filled[next] = 0;
+        index = next;
+    }
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::rehash(size_t capacity)
+{
+    capacity = std::bit_ceil(std::max((size_t)8, capacity));
+    if ((capacity == _capacity) || ((_size * 2) > capacity))
+        return;
+
+    OffsetPtr<value_type> buckets;
+    OffsetPtr<uint8_t> filled;
+    allocate_internal(capacity, buckets, filled);
+
+    // Move all items into new buckets
+    value_type* old_buckets = _buckets.get();
+    uint8_t* old_filled = _filled.get();
+    value_type* new_buckets = buckets.get();
+    uint8_t* new_filled = filled.get();
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < _capacity; ++i)
+    {
+        if (!old_filled[i])
+            continue;
+
+        size_t index = key_to_index(old_buckets[i].first, capacity);
+        while (new_filled[index])
+            index = (index + 1) & mask;
+        new (&new_buckets[index]) value_type(std::move(old_buckets[i]));
+        new_filled[index] = 1;
+    }
+
+    release_internal(old_buckets, old_filled, _capacity);
+    _buckets = buckets;
+    _filled = filled;
+    _capacity = capacity;
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::reserve(size_t count)
+{
+    if ((count * 2) > _capacity)
+        rehash(count * 2);
+}
+
+template <typename TKey, typename TValue, typename THash, typename TEqual>
+inline void SharedHashMap<TKey, TValue, THash, TEqual>::clear() noexcept
+{
+    value_type* buckets = _buckets.get();
+    uint8_t* filled = _filled.get();
+    for (size_t i = 0; i < _capacity; ++i)
+    {
+        if (filled[i])
+        {
+            buckets[i].~value_type();
+            filled[i] = 0;
+        }
+    }
+    _size = 0;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,262 @@
+/*!
+    \file small_vector.h
+    \brief Small vector container definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_CONTAINERS_SMALL_VECTOR_H
+#define CPPCOMMON_CONTAINERS_SMALL_VECTOR_H
+
+#include "memory/allocator_stack.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Small vector container
+/*!
+    Small vector keeps up to N items inline in the stack memory manager buffer
+    embedded into the vector instance, so small vectors do not allocate any
+    memory. When the vector grows over the inline capacity all items spill
+    into the memory allocated with the given allocator (e.g. Allocator with
+    arena or pool memory manager to configure the spill memory manager).
+
+    Moving the inline small vector moves its items one by one, so unlike std::vector
+    iterators and references are invalidated by the move of the inline vector.
+
+    Not thread-safe.
+*/
+template <typename T, size_t N, typename TAllocator = std::allocator<T>>
+class SmallVector
+{
+    static_assert((N > 0), "Small vector inline capacity must be greater than zero!");
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef TAllocator allocator_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //! Initialize the empty small vector
+    /*!
+        \param allocator - Allocator of spilled items (default is TAllocator())
+    */
+    explicit SmallVector(const TAllocator& allocator = TAllocator());
+    //! Initialize the small vector with items of the given initializer list
+    /*!
+        \param items - Initializer list of items
+        \param allocator - Allocator of spilled items (default is TAllocator())
+    */
+    SmallVector(std::initializer_list<T> items, const TAllocator& allocator = TAllocator());
+    //! Initialize the small vector with items of the given iterators range
+    /*!
+        \param first - The first iterator of the range
+        \param last - The last iterator of the range
+        \param allocator - Allocator of spilled items (default is TAllocator())
+    */
+    template <class InputIterator>
+    SmallVector(InputIterator first, InputIterator last, const TAllocator& allocator = TAllocator());
+    SmallVector(const SmallVector& vector);
+    SmallVector(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible<T>::value);
+    ~SmallVector();
+
+    SmallVector& operator=(const SmallVector& vector);
+    SmallVector& operator=(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    //! Check if the small vector is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Access to the item with the given index
+    T& operator[](size_t index) noexcept { assert((index < _size) && "Index out of bounds!"); return _data[index]; }
+    const T& operator[](size_t index) const noexcept { assert((index < _size) && "Index out of bounds!"); return _data[index]; }
+
+    //! Is the small vector empty?
+    bool empty() const noexcept { return _size == 0; }
+    //! Is the small vector items stored inline?
+    bool is_inline() const noexcept { return _capacity == N; }
+
+    //! Get the small vector size
+    size_t size() const noexcept { return _size; }
+    //! Get the small vector capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the small vector inline capacity
+    static constexpr size_t inline_capacity() noexcept { return N; }
+    //! Get the small vector maximum size
+    size_t max_size() const noexcept { return std::allocator_traits<TAllocator>::max_size(_allocator); }
+
+    //! Get the small vector allocator
+    allocator_type get_allocator() const { return _allocator; }
+
+    //! Get the small vector data
+    T* data() noexcept { return _data; }
+    const T* data() const noexcept { return _data; }
+
+    //! Access to the item with the given index or throw std::out_of_range exception
+    /*!
+        \param index - Item index
+        \return Item with the given index
+    */
+    T& at(size_t index);
+    const T& at(size_t index) const;
+
+    //! Get the front item
+    T& front() noexcept { assert(!empty() && "Small vector is empty!"); return _data[0]; }
+    const T& front() const noexcept { assert(!empty() && "Small vector is empty!"); return _data[0]; }
+    //! Get the back item
+    T& back() noexcept { assert(!empty() && "Small vector is empty!"); return _data[_size - 1]; }
+    const T& back() const noexcept { assert(!empty() && "Small vector is empty!"); return _data[_size - 1]; }
+
+    //! Get the begin small vector iterator
+    iterator begin() noexcept { return _data; }
+    const_iterator begin() const noexcept { return _data; }
+    const_iterator cbegin() const noexcept { return _data; }
+    //! Get the end small vector iterator
+    iterator end() noexcept { return _data + _size; }
+    const_iterator end() const noexcept { return _data + _size; }
+    const_iterator cend() const noexcept { return _data + _size; }
+
+    //! Get the reverse begin small vector iterator
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    //! Get the reverse end small vector iterator
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //! Push a new item into the back of the small vector
+    /*!
+        \param item - Item to push
+    */
+    void push_back(const T& item) { emplace_back(item); }
+    //! Push a new item into the back of the small vector
+    /*!
+        \param item - Item to push
+    */
+    void push_back(T&& item) { emplace_back(std::move(item)); }
+    //! Emplace a new item into the back of the small vector
+    /*!
+        \param args - Arguments to emplace
+        \return Reference to the emplaced item
+    */
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+    //! Pop the back item from the small vector
+    void pop_back() noexcept;
+
+    //! Insert a new item into the given position of the small vector
+    /*!
+        \param position - Iterator position to insert
+        \param item - Item to insert
+        \return Iterator to the inserted item
+    */
+    iterator insert(const_iterator position, const T& item) { return emplace(position, item); }
+    //! Insert a new item into the given position of the small vector
+    /*!
+        \param position - Iterator position to insert
+        \param item - Item to insert
+        \return Iterator to the inserted item
+    */
+    iterator insert(const_iterator position, T&& item) { return emplace(position, std::move(item)); }
+    //! Emplace a new item into the given position of the small vector
+    /*!
+        \param position - Iterator position to emplace
+        \param args - Arguments to emplace
+        \return Iterator to the emplaced item
+    */
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args);
+
+    //! Erase the item by its iterator from the small vector
+    /*!
+        \param position - Iterator position to the erased item
+        \return Iterator to the item after the erased one
+    */
+    iterator erase(const_iterator position) { return erase(position, position + 1); }
+    //! Erase the given range of items from the small vector
+    /*!
+        \param first - The first iterator of the erased range
+        \param last - The last iterator of the erased range
+        \return Iterator to the item after the erased range
+    */
+    iterator erase(const_iterator first, const_iterator last);
+
+    //! Resize the small vector with default items
+    /*!
+        \param size - New small vector size
+    */
+    void resize(size_t size);
+    //! Resize the small vector with the given items
+    /*!
+        \param size - New small vector size
+        \param item - Item to fill
+    */
+    void resize(size_t size, const T& item);
+
+    //! Reserve the small vector capacity to fit the given count of items
+    /*!
+        \param count - Count of items to fit
+    */
+    void reserve(size_t count);
+    //! Shrink the small vector capacity to fit its size
+    /*!
+        Small vector which size fits the inline capacity moves its items back inline.
+    */
+    void shrink_to_fit();
+
+    //! Clear the small vector
+    /*!
+        Clear keeps the current capacity.
+    */
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(SmallVector& vector) noexcept(std::is_nothrow_move_constructible<T>::value);
+    template <typename U, size_t UN, typename UAllocator>
+    friend void swap(SmallVector<U, UN, UAllocator>& vector1, SmallVector<U, UN, UAllocator>& vector2) noexcept(std::is_nothrow_move_constructible<U>::value);
+
+    friend bool operator==(const SmallVector& vector1, const SmallVector& vector2)
+    { return std::equal(vector1.begin(), vector1.end(), vector2.begin(), vector2.end()); }
+    friend bool operator!=(const SmallVector& vector1, const SmallVector& vector2)
+    { return !(vector1 == vector2); }
+
+private:
+    StackMemoryManager<N * sizeof(T) + alignof(T)> _stack; // Small vector inline buffer
+    TAllocator _allocator;                                  // Small vector spill allocator
+    T* _data;                                               // Small vector data
+    size_t _size;                                           // Small vector size
+    size_t _capacity;                                       // Small vector capacity
+
+    T* allocate_internal(size_t capacity);
+    void deallocate_internal(T* data, size_t capacity) noexcept;
+    void relocate_internal(size_t capacity);
+    void steal_internal(SmallVector& vector) noexcept(std::is_nothrow_move_constructible<T>::value);
+};
+
+/*! \example containers_small_vector.cpp Small vector and small string containers example */
+
+} // namespace CppCommon
+
+#include "small_vector.inl"
+
+#endif // CPPCOMMON_CONTAINERS_SMALL_VECTOR_H
@@ -0,0 +1,324 @@
+/*!
+    \file small_vector.inl
+    \brief Small vector container inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(const TAllocator& allocator)
+    : _allocator(allocator), _data(nullptr), _size(0), _capacity(N)
+{
+    _data = allocate_internal(N);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(std::initializer_list<T> items, const TAllocator& allocator)
+    : SmallVector(items.begin(), items.end(), allocator)
+{
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <class InputIterator>
+inline SmallVector<T, N, TAllocator>::SmallVector(InputIterator first, InputIterator last, const TAllocator& allocator)
+    : SmallVector(allocator)
+{
+    for (auto it = first; it != last; ++it)
+        emplace_back(*it);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(const SmallVector& vector)
+    : SmallVector(vector._allocator)
+{
+    reserve(vector._size);
+    std::uninitialized_copy(vector.begin(), vector.end(), _data);
+    _size = vector._size;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::SmallVector(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible<T>::value)
+    : SmallVector(vector._allocator)
+{
+    steal_internal(vector);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>::~SmallVector()
+{
+    clear();
+    deallocate_internal(_data, _capacity);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(const SmallVector& vector)
+{
+    if (this != &vector)
+    {
+        clear();
+        reserve(vector._size);
+        std::uninitialized_copy(vector.begin(), vector.end(), _data);
+        _size = vector._size;
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(SmallVector&& vector) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (this != &vector)
+    {
+        // Return to the inline buffer before stealing items
+        clear();
+        if (!is_inline())
+        {
+            deallocate_internal(_data, _capacity);
+            _data = allocate_internal(N);
+            _capacity = N;
+        }
+        steal_internal(vector);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline T& SmallVector<T, N, TAllocator>::at(size_t index)
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds of the small vector!");
+
+    return _data[index];
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline const T& SmallVector<T, N, TAllocator>::at(size_t index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds of the small vector!");
+
+    return _data[index];
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <typename... Args>
+inline T& SmallVector<T, N, TAllocator>::emplace_back(Args&&... args)
+{
+    if (_size == _capacity)
+    {
+        // Construct the item before relocation, because arguments could refer to existing items
+        T item(std::forward<Args>(args)...);
+        relocate_internal(2 * _capacity);
+        ::new (_data + _size) T(std::move(item));
+    }
+    else
+        ::new (_data + _size) T(std::forward<Args>(args)...);
+
+    return _data[_size++];
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::pop_back() noexcept
+{
+    assert(!empty() && "Small vector is empty!");
+
+    _data[--_size].~T();
+}
+
+template <typename T, size_t N, typename TAllocator>
+template <typename... Args>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::emplace(const_iterator position, Args&&... args)
+{
+    assert((position >= begin()) && (position <= end()) && "Iterator position is out of bounds!");
+
+    size_t index = position - begin();
+    if (index == _size)
+    {
+        emplace_back(std::forward<Args>(args)...);
+        return _data + index;
+    }
+
+    T item(std::forward<Args>(args)...);
+    if (_size == _capacity)
+        relocate_internal(2 * _capacity);
+
+    // Shift items after the position to the back
+    ::new (_data + _size) T(std::move(_data[_size - 1]));
+    ++_size;
+    std::move_backward(_data + index, _data + _size - 2, _data + _size - 1);
+    _data[index] = std::move(item);
+    return _data + index;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline typename SmallVector<T, N, TAllocator>::iterator SmallVector<T, N, TAllocator>::erase(const_iterator first, const_iterator last)
+{
+    assert((first >= begin()) && (first <= last) && (last <= end()) && "Iterators range is out of bounds!");
+
+    size_t index = first - begin();
+    size_t count = last - first;
+    if (count > 0)
+    {
+        // Shift items after the range to the front and destroy the tail
+        std::move(_data + index + count, _data + _size, _data + index);
+        std::destroy(_data + _size - count, _data + _size);
+        _size -= count;
+    }
+    return _data + index;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::resize(size_t size)
+{
+    if (size < _size)
+    {
+        std::destroy(_data + size, _data + _size);
+        _size = size;
+        return;
+    }
+
+    reserve(size);
+    std::uninitialized_value_construct(_data + _size, _data + size);
+    _size = size;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::resize(size_t size, const T& item)
+{
+    if (size < _size)
+    {
+        std::destroy(_data + size, _data + _size);
+        _size = size;
+        return;
+    }
+
+    if (size > _capacity)
+    {
+        // Copy the item before relocation, because it could refer to existing item
+        T copy(item);
+        reserve(size);
+        std::uninitialized_fill(_data + _size, _data + size, copy);
+    }
+    else
+        std::uninitialized_fill(_data + _size, _data + size, item);
+    _size = size;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::reserve(size_t count)
+{
+    if (count > _capacity)
+        relocate_internal(std::max(count, 2 * _capacity));
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::shrink_to_fit()
+{
+    if (!is_inline() && (_size < _capacity))
+        relocate_internal(std::max(_size, N));
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::clear() noexcept
+{
+    std::destroy(_data, _data + _size);
+    _size = 0;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::swap(SmallVector& vector) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    SmallVector temp(std::move(vector));
+    vector = std::move(*this);
+    *this = std::move(temp);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void swap(SmallVector<T, N, TAllocator>& vector1, SmallVector<T, N, TAllocator>& vector2) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    vector1.swap(vector2);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline T* SmallVector<T, N, TAllocator>::allocate_internal(size_t capacity)
+{
+    if (capacity == N)
+    {
+        // Allocate the inline buffer from the stack memory manager
+        T* data = (T*)_stack.malloc(N * sizeof(T), alignof(T));
+        assert((data != nullptr) && "Small vector inline buffer must be free!");
+        return data;
+    }
+
+    return std::allocator_traits<TAllocator>::allocate(_allocator, capacity);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::deallocate_internal(T* data, size_t capacity) noexcept
+{
+    if (capacity == N)
+    {
+        // Release the inline buffer of the stack memory manager
+        _stack.free(data, N * sizeof(T));
+        _stack.reset();
+        return;
+    }
+
+    std::allocator_traits<TAllocator>::deallocate(_allocator, data, capacity);
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::relocate_internal(size_t capacity)
+{
+    assert((capacity >= _size) && "Small vector capacity must fit its size!");
+
+    // Inline buffer is still in use, so the new buffer is always allocated first
+    T* data = allocate_internal(capacity);
+    try
+    {
+        // Keep the strong exception guarantee for items with throwing move constructor
+        if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)
+            std::uninitialized_move(_data, _data + _size, data);
+        else
+            std::uninitialized_copy(_data, _data + _size, data);
+    }
+    catch (...)
+    {
+        deallocate_internal(data, capacity);
+        throw;
+    }
+
+    std::destroy(_data, _data + _size);
+    deallocate_internal(_data, _capacity);
+    _data = data;
+    _capacity = capacity;
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void SmallVector<T, N, TAllocator>::steal_internal(SmallVector& vector) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    assert(is_inline() && empty() && "Small vector must be inline and empty!");
+
+    if (!vector.is_inline() && (_allocator == vector._allocator))
+    {
+        // Steal spilled items
+        deallocate_internal(_data, _capacity);
+        _data = vector._data;
+        _size = vector._size;
+        _capacity = vector._capacity;
+        vector._data = vector.allocate_internal(N);
+        vector._size = 0;
+        vector._capacity = N;
+        return;
+    }
+
+    // Move items one by one
+    reserve(vector._size);
+    std::uninitialized_move(vector.begin(), vector.end(), _data);
+    _size = vector._size;
+    vector.clear();
+}
+
+} // namespace CppCommon
@@ -12,9 +12,11 @@
 #include "errors/system_error.h"
 #include "system/source_location.h"
 
+#include <atomic>
 #include <exception>
 #include <string>
 #include <utility>
+#include <vector>
 
 //! Throw extended exception macro
 /*!
@@ -24,6 +26,8 @@
 
 namespace CppCommon {
 
+class StackTrace;
+
 //! Exception
 /*!
     Exception base interface.
@@ -103,6 +107,13 @@ public:
 };
 
 //! System exception
+/*!
+    System exception optionally captures the raw stack trace addresses of
+    the throw point. Capture is disabled by default and could be enabled
+    globally with SystemException::SetCaptureStackTrace() for diagnostics.
+    Symbols of captured frames are resolved only when the stack trace is
+    requested or the exception string is formatted.
+*/
 class SystemException : public Exception
 {
 public:
@@ -133,21 +144,35 @@ public:
         : Exception(message),
           _system_error(error),
           _system_message(SystemError::Description(error))
-    {}
+    { if (IsCaptureStackTrace()) CaptureStackTrace(); }
 
     //! Get system error code
     int system_error() const noexcept { return _system_error; }
     //! Get system error message
     const std::string& system_message() const noexcept { return _system_message; }
+    //! Get the captured stack trace (empty if the stack trace capture is disabled)
+    StackTrace stack_trace() const;
 
     //! Get string from the current system exception
     std::string string() const override;
 
+    //! Is the stack trace capture of new system exceptions enabled?
+    static bool IsCaptureStackTrace() noexcept { return _capture.load(std::memory_order_relaxed); }
+    //! Enable or disable the stack trace capture of new system exceptions (disabled by default)
+    static void SetCaptureStackTrace(bool capture) noexcept { _capture.store(capture, std::memory_order_relaxed); }
+
 protected:
     //! System error code
     int _system_error;
     //! System error message
     std::string _system_message;
+    //! Captured stack trace addresses
+    std::vector<void*> _stack_trace;
+
+private:
+    static std::atomic<bool> _capture;
+
+    void CaptureStackTrace();
 };
 
 } // namespace CppCommon
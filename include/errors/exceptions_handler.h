@@ -49,6 +49,15 @@ public:
         \param handler - Exceptions handler function
     */
     static void SetupHandler(const std::function<void (const SystemException&, const StackTrace&)>& handler);
+    //! Add the dump handler function
+    /*!
+        Dump handler functions are called in the order of addition just before
+        the exceptions handler function. They allow to save the state of the
+        process (e.g. in-memory trace or log buffers) before it terminates.
+
+        \param handler - Dump handler function
+    */
+    static void AddDumpHandler(const std::function<void ()>& handler);
     //! Setup exceptions handler for the current process
     /*!
         This method should be called once for the current process.
@@ -62,13 +71,34 @@ public:
     */
     static void SetupThread();
 
+    //! Setup async-signal-safe crash dump for the current process
+    /*!
+        Process signals are handled without memory allocations and locks.
+        The signal description, raw stack frames addresses and the memory
+        map of the process (Linux only) are written into the given file
+        descriptor with write() system call, then the default signal action
+        is raised. Frames addresses could be resolved offline (e.g. with
+        addr2line using the memory map). Exceptions handler and dump handler
+        functions are not called for signals in this mode.
+
+        Signal handlers run on the preallocated alternate signal stack of
+        the thread set up with SetupProcess() or SetupThread(), so also the
+        stack overflow is reported.
+
+        This method should be called after SetupProcess(). Only Unix
+        platforms are supported, the call is ignored on Windows.
+
+        \param fd - File descriptor to write the crash dump into (default is 2 - stderr)
+    */
+    static void SetupSignalSafeDump(int fd = 2);
+
 private:
     class Impl;
 
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 72;
+    static const size_t StorageSize = 104;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     static const size_t StorageAlign = 16;
 #else
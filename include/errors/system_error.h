@@ -10,6 +10,7 @@
 #define CPPCOMMON_ERRORS_SYSTEM_ERROR_H
 
 #include <string>
+#include <system_error>
 
 namespace CppCommon {
 
@@ -35,6 +36,11 @@ public:
         \return Last system error code
     */
     static int GetLast() noexcept;
+    //! Get the last system error code as the standard error code of the system category
+    /*!
+        \return Last system error code
+    */
+    static std::error_code GetLastCode() noexcept { return std::error_code(GetLast(), std::system_category()); }
 
     //! Set the last system error code
     /*!
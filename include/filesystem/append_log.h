@@ -0,0 +1,157 @@
+/*!
+    \file append_log.h
+    \brief Group-commit durable append log definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_APPEND_LOG_H
+#define CPPCOMMON_FILESYSTEM_APPEND_LOG_H
+
+#include "filesystem/path.h"
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <thread>
+
+namespace CppCommon {
+
+//! Group-commit durable append log
+/*!
+    Append log is a write-ahead log file of checksummed records. Multiple
+    producers append records into the wait-free MPSC ring buffer without
+    system calls. The single writer thread drains all appended records as a
+    group, writes them sequentially into the log file and makes the whole
+    group durable with a single fsync() call. Producers which need durability
+    wait for the group of their record, so the cost of fsync() is shared by
+    all records appended while the previous group was flushing.
+
+    Each record is stored in the log file with the 8 bytes header: record
+    size and CRC32C checksum of the size and the record data (little-endian).
+    Checksums are computed by producers in parallel. Recovery scanner reads
+    the log file through the memory mapping and stops at the first truncated
+    or corrupted record, which is the torn tail of the last group written
+    before the crash.
+
+    Thread-safe.
+*/
+class AppendLog
+{
+public:
+    //! Recovered record handler (record offset in the log file, record data)
+    typedef std::function<void(uint64_t, std::span<const uint8_t>)> Handler;
+
+    //! Size of the record header in the log file (8)
+    static const size_t HEADER_SIZE;
+    //! Default ring buffer capacity of each producer (262144)
+    static const size_t DEFAULT_CAPACITY;
+
+    //! Initialize the append log
+    /*!
+        \param capacity - Ring buffer capacity of each producer (must be a power of two, default is AppendLog::DEFAULT_CAPACITY)
+        \param concurrency - Count of producers' ring buffers (default is std::thread::hardware_concurrency)
+    */
+    explicit AppendLog(size_t capacity = AppendLog::DEFAULT_CAPACITY, size_t concurrency = std::thread::hardware_concurrency());
+    AppendLog(const AppendLog&) = delete;
+    AppendLog(AppendLog&&) = delete;
+    //! Close the opened append log
+    ~AppendLog();
+
+    AppendLog& operator=(const AppendLog&) = delete;
+    AppendLog& operator=(AppendLog&&) = delete;
+
+    //! Check if the append log is opened
+    explicit operator bool() const noexcept { return IsOpened(); }
+
+    //! Get the log file path
+    const Path& path() const noexcept;
+    //! Get the maximal record size
+    size_t max_size() const noexcept;
+    //! Get the count of committed groups (fsync() calls)
+    uint64_t groups() const noexcept;
+
+    //! Is the append log opened?
+    bool IsOpened() const noexcept;
+
+    //! Open the append log file
+    /*!
+        Existing log file is recovered: valid records are passed to the given
+        handler in the log order and the torn tail is truncated. New records
+        are appended after the last valid record.
+
+        \param path - Log file path
+        \param handler - Recovered record handler (default is nullptr)
+        \param preallocate - Size of disk space chunks reserved in advance to avoid fragmentation of the log file (default is 0)
+    */
+    void Open(const Path& path, const Handler& handler = nullptr, uint64_t preallocate = 0);
+    //! Close the append log file
+    /*!
+        All appended records are written and flushed before the close.
+    */
+    void Close();
+
+    //! Append the record into the log
+    /*!
+        Record is copied into the ring buffer. If the ring buffer is full the
+        method waits until the writer thread drains it. If the record size is
+        greater than max_size() or the writer thread failed the method will
+        raise an exception!
+
+        Will not block unless the ring buffer is full.
+
+        \param data - Record data
+        \param size - Record size
+        \return Ticket to wait for the record durability
+    */
+    uint64_t Append(const void* data, size_t size);
+    //! Wait until the record of the given ticket is durable
+    /*!
+        If the writer thread failed to write or to flush the log file the
+        method will rethrow its exception!
+
+        Will block.
+
+        \param ticket - Ticket returned by the Append() method
+    */
+    void Wait(uint64_t ticket);
+    //! Append the record into the log and wait until it is durable
+    /*!
+        Will block.
+
+        \param data - Record data
+        \param size - Record size
+    */
+    void Commit(const void* data, size_t size)
+    { Wait(Append(data, size)); }
+    //! Wait until all records appended before the call are durable
+    /*!
+        Will block.
+    */
+    void Flush();
+
+    //! Scan the log file and pass valid records to the given handler
+    /*!
+        \param path - Log file path
+        \param handler - Recovered record handler
+        \return Size of the valid part of the log file
+    */
+    static uint64_t Recover(const Path& path, const Handler& handler);
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 640;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example filesystem_append_log.cpp Group-commit durable append log example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_APPEND_LOG_H
@@ -0,0 +1,219 @@
+/*!
+    \file async_file_io.h
+    \brief Asynchronous file I/O engine definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_ASYNC_FILE_IO_H
+#define CPPCOMMON_FILESYSTEM_ASYNC_FILE_IO_H
+
+#include "filesystem/path.h"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <span>
+#include <vector>
+
+namespace CppCommon {
+
+//! Asynchronous file I/O engine
+/*!
+    Asynchronous file I/O engine performs reads, writes and flushes of files at
+    arbitrary offsets without blocking the calling thread, so a single thread
+    is able to keep a deep queue of operations to the storage device.
+
+    Operations are queued by Read(), Write() and Fsync() methods and are
+    passed to the operating system in batches by Submit() method. Completed
+    operations are dispatched by Poll() or Wait() methods in the calling
+    thread either to the given completion handler or to the returned future.
+    Operations which do not fit into the queue depth are kept queued and are
+    submitted when previous operations are completed.
+
+    Linux implementation is based on io_uring and uses registered buffers
+    for operations with the memory inside the buffers given to
+    RegisterBuffers(). Windows implementation is based on overlapped I/O
+    with I/O completion port. If none of them is available operations are
+    performed synchronously during Submit() call.
+
+    Files opened in the direct I/O mode bypass the system page cache. Buffers,
+    offsets and sizes of their operations must be aligned to the logical
+    block size of the storage device!
+
+    Not thread-safe.
+*/
+class AsyncFileIO
+{
+public:
+    //! Async file Id (zero is invalid Id)
+    typedef uint64_t FileId;
+    //! Operation completion handler (count of transferred bytes, system error code or zero on success)
+    typedef std::function<void(size_t, int)> Handler;
+
+    //! Default queue depth (256)
+    static const size_t DEFAULT_DEPTH;
+
+    //! Initialize the asynchronous file I/O engine
+    /*!
+        \param depth - Maximal count of operations submitted to the operating system at once (default is AsyncFileIO::DEFAULT_DEPTH)
+    */
+    explicit AsyncFileIO(size_t depth = AsyncFileIO::DEFAULT_DEPTH);
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO(AsyncFileIO&&) = delete;
+    //! Wait for all pending operations and close all opened files
+    ~AsyncFileIO();
+
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(AsyncFileIO&&) = delete;
+
+    //! Get the queue depth
+    size_t depth() const noexcept;
+    //! Get the count of pending operations (queued, submitted and not dispatched)
+    size_t pending() const noexcept;
+
+    //! Is the asynchronous I/O provided by the operating system (io_uring, IOCP)?
+    bool native() const noexcept;
+
+    //! Open the file for asynchronous I/O
+    /*!
+        \param path - File path
+        \param read - Read mode
+        \param write - Write mode
+        \param create - Create the file if it does not exist (default is false)
+        \param direct - Direct I/O mode which bypasses the system page cache (default is false)
+        \return Async file Id
+    */
+    FileId Open(const Path& path, bool read, bool write, bool create = false, bool direct = false);
+    //! Close the file
+    /*!
+        The file must not have pending operations!
+
+        \param file - Async file Id
+    */
+    void Close(FileId file);
+
+    //! Register buffers used by following operations
+    /*!
+        Registered buffers are pinned in the memory once, so operations with
+        them avoid mapping of user pages for each operation. Previously
+        registered buffers are unregistered. Must be called without pending
+        operations!
+
+        \param buffers - Buffers to register
+    */
+    void RegisterBuffers(const std::vector<std::span<uint8_t>>& buffers);
+    //! Unregister all registered buffers
+    /*!
+        Must be called without pending operations!
+    */
+    void UnregisterBuffers();
+
+    //! Queue the file read operation
+    /*!
+        Buffer must be valid until the operation is completed!
+
+        \param file - Async file Id
+        \param offset - File offset
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param handler - Completion handler
+    */
+    void Read(FileId file, uint64_t offset, void* buffer, size_t size, Handler handler);
+    //! Queue the file read operation with the future result
+    /*!
+        The future is ready when the operation completion is dispatched by
+        Poll() or Wait() methods. Failed operation stores FileSystemException.
+
+        \param file - Async file Id
+        \param offset - File offset
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Future with the count of read bytes
+    */
+    std::future<size_t> Read(FileId file, uint64_t offset, void* buffer, size_t size);
+
+    //! Queue the file write operation
+    /*!
+        Buffer must be valid until the operation is completed!
+
+        \param file - Async file Id
+        \param offset - File offset
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param handler - Completion handler
+    */
+    void Write(FileId file, uint64_t offset, const void* buffer, size_t size, Handler handler);
+    //! Queue the file write operation with the future result
+    /*!
+        The future is ready when the operation completion is dispatched by
+        Poll() or Wait() methods. Failed operation stores FileSystemException.
+
+        \param file - Async file Id
+        \param offset - File offset
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Future with the count of written bytes
+    */
+    std::future<size_t> Write(FileId file, uint64_t offset, const void* buffer, size_t size);
+
+    //! Queue the file flush operation
+    /*!
+        Flush operation is not ordered with other operations of the file,
+        so it must be queued after the completion of writes to be flushed.
+
+        \param file - Async file Id
+        \param datasync - Flush only file data without unnecessary metadata
+        \param handler - Completion handler
+    */
+    void Fsync(FileId file, bool datasync, Handler handler);
+    //! Queue the file flush operation with the future result
+    /*!
+        \param file - Async file Id
+        \param datasync - Flush only file data without unnecessary metadata (default is false)
+        \return Future of the flush operation
+    */
+    std::future<void> Fsync(FileId file, bool datasync = false);
+
+    //! Submit all queued operations to the operating system
+    /*!
+        \return Count of submitted operations
+    */
+    size_t Submit();
+    //! Dispatch completed operations without blocking
+    /*!
+        Completion handlers must not call Poll() or Wait() methods.
+
+        \return Count of dispatched operations
+    */
+    size_t Poll();
+    //! Submit queued operations and wait for at least one completed operation
+    /*!
+        Will block.
+
+        \return Count of dispatched operations
+    */
+    size_t Wait();
+    //! Submit queued operations and wait for all pending operations
+    /*!
+        Will block.
+    */
+    void WaitAll();
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 384;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example filesystem_async_file_io.cpp Asynchronous file I/O engine example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_ASYNC_FILE_IO_H
@@ -10,11 +10,64 @@
 #define CPPCOMMON_FILESYSTEM_DIRECTORY_H
 
 #include "filesystem/directory_iterator.h"
+#include "filesystem/directory_listing.h"
 #include "filesystem/file.h"
 #include "filesystem/symlink.h"
 
+#include <functional>
+#include <string_view>
+
 namespace CppCommon {
 
+class GlobPattern;
+class ThreadPool;
+
+//! Directory walk entry
+/*!
+    Directory walk entry is reported before any path is constructed, so
+    entries filtered by the handler cost neither allocations nor system calls.
+    Entry fields are valid only during the handler call!
+*/
+struct DirectoryEntry
+{
+    //! Parent directory path
+    const Path& parent;
+    //! Entry name
+    std::string_view name;
+    //! Entry type (symbolic links are reported as FileType::SYMLINK)
+    FileType type;
+    //! Entry target type (type of the symbolic link target if symbolic links are followed, otherwise the entry type)
+    FileType target;
+    //! Entry depth (zero for entries of the walked directory)
+    size_t depth;
+    //! Entry inode number (zero if not provided by the file system)
+    uint64_t inode;
+    //! Entry status (nullptr if it is not requested with DirectoryWalkOptions::status)
+    const PathStatus* status;
+
+    //! Get the entry path
+    Path path() const { return parent / name; }
+};
+
+//! Directory walk options
+struct DirectoryWalkOptions
+{
+    //! Regular expression pattern of reported entry names (default is "" - all entries)
+    std::string pattern;
+    //! Compiled glob pattern of reported entry names, must be valid during the walk (default is nullptr - all entries)
+    const GlobPattern* glob{nullptr};
+    //! Walk sub-directories (default is true)
+    bool recursive{true};
+    //! Follow symbolic links to directories (default is false)
+    bool symlinks{false};
+    //! Request status of reported entries (default is false)
+    bool status{false};
+    //! Thread pool to fan sub-directories out (default is nullptr - walk in the calling thread)
+    ThreadPool* pool{nullptr};
+    //! Maximal count of threads walking sub-directories, including the calling thread (default is 0 - all workers of the thread pool and the calling thread)
+    size_t concurrency{0};
+};
+
 //! Filesystem directory
 /*!
     Filesystem directory wraps directory management operations (create, remove, iterate).
@@ -24,6 +77,9 @@ namespace CppCommon {
 class Directory : public Path
 {
 public:
+    //! Directory walk handler (return 'false' to stop the walk)
+    typedef std::function<bool(const DirectoryEntry&)> WalkHandler;
+
     //! Default directory attributes (Normal)
     static const Flags<FileAttributes> DEFAULT_ATTRIBUTES;
     //! Default directory permissions (IRUSR | IWUSR | IXUSR | IRGRP | IXGRP | IROTH | IXOTH)
@@ -69,12 +125,24 @@ public:
         \return Entries collection
     */
     std::vector<Path> GetEntries(const std::string& pattern = "");
+    //! Get all entries (directories, files, symbolic links) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Entries collection
+    */
+    std::vector<Path> GetEntries(const GlobPattern& pattern);
     //! Recursively get all entries (directories, files, symbolic links) in the current directory
     /*!
         \param pattern - Regular expression pattern (default is "")
         \return Entries collection
     */
     std::vector<Path> GetEntriesRecursive(const std::string& pattern = "");
+    //! Recursively get all entries (directories, files, symbolic links) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Entries collection
+    */
+    std::vector<Path> GetEntriesRecursive(const GlobPattern& pattern);
 
     //! Get all directories (including symbolic link directories) in the current directory
     /*!
@@ -82,12 +150,24 @@ public:
         \return Directories collection
     */
     std::vector<Directory> GetDirectories(const std::string& pattern = "");
+    //! Get all directories (including symbolic link directories) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Directories collection
+    */
+    std::vector<Directory> GetDirectories(const GlobPattern& pattern);
     //! Recursively get all directories (including symbolic link directories) in the current directory
     /*!
         \param pattern - Regular expression pattern (default is "")
         \return Directories collection
     */
     std::vector<Directory> GetDirectoriesRecursive(const std::string& pattern = "");
+    //! Recursively get all directories (including symbolic link directories) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Directories collection
+    */
+    std::vector<Directory> GetDirectoriesRecursive(const GlobPattern& pattern);
 
     //! Get all files (including symbolic link files) in the current directory
     /*!
@@ -95,12 +175,24 @@ public:
         \return Files collection
     */
     std::vector<File> GetFiles(const std::string& pattern = "");
+    //! Get all files (including symbolic link files) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Files collection
+    */
+    std::vector<File> GetFiles(const GlobPattern& pattern);
     //! Recursively get all files (including symbolic link files) in the current directory
     /*!
         \param pattern - Regular expression pattern (default is "")
         \return Files collection
     */
     std::vector<File> GetFilesRecursive(const std::string& pattern = "");
+    //! Recursively get all files (including symbolic link files) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Files collection
+    */
+    std::vector<File> GetFilesRecursive(const GlobPattern& pattern);
 
     //! Get all symbolic links (including symbolic link directories) in the current directory
     /*!
@@ -108,12 +200,69 @@ public:
         \return Symbolic links collection
     */
     std::vector<Symlink> GetSymlinks(const std::string& pattern = "");
+    //! Get all symbolic links (including symbolic link directories) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Symbolic links collection
+    */
+    std::vector<Symlink> GetSymlinks(const GlobPattern& pattern);
     //! Recursively get all symbolic links (including symbolic link directories) in the current directory
     /*!
         \param pattern - Regular expression pattern (default is "")
         \return Symbolic links collection
     */
     std::vector<Symlink> GetSymlinksRecursive(const std::string& pattern = "");
+    //! Recursively get all symbolic links (including symbolic link directories) in the current directory
+    /*!
+        \param pattern - Compiled glob pattern
+        \return Symbolic links collection
+    */
+    std::vector<Symlink> GetSymlinksRecursive(const GlobPattern& pattern);
+
+    //! Walk all entries (directories, files, symbolic links) of the current directory
+    /*!
+        Entries are streamed to the handler without building collections.
+        Entry types are taken from directory records ('d_type' of getdents64()
+        or readdir() in Unix systems, basic find data in Windows), so status
+        of entries is requested only if the file system does not provide
+        their types or if symbolic links are followed. The pattern is matched
+        against raw entry names before any path is constructed. Pattern does
+        not limit the walk, sub-directories with other names are walked too.
+
+        Each directory entry is reported before its sub-directory is walked.
+        With the thread pool sub-directories are walked by workers of the
+        thread pool and the calling thread, so the handler is called
+        concurrently and must be thread-safe. The calling thread always takes
+        part in the walk and does not depend on free workers. If the handler
+        throws an exception the walk is stopped and the first exception is
+        rethrown in the calling thread.
+
+        Loops of followed symbolic links are not detected!
+
+        \param handler - Walk handler
+        \param options - Walk options (default is DirectoryWalkOptions())
+        \return Count of reported entries
+    */
+    size_t Walk(const WalkHandler& handler, const DirectoryWalkOptions& options = DirectoryWalkOptions()) const;
+
+    //! List all entries (directories, files, symbolic links) of the current directory into the compact listing
+    /*!
+        Batch variant of GetEntries() and GetEntriesRecursive() methods which
+        keeps entries in the directory listing instead of the vector of paths.
+
+        \param options - Walk options (default is DirectoryWalkOptions())
+        \return Directory listing
+    */
+    DirectoryListing ListEntries(const DirectoryWalkOptions& options = DirectoryWalkOptions()) const;
+    //! List all files (including symbolic link files) of the current directory into the compact listing
+    /*!
+        Batch variant of GetFiles() and GetFilesRecursive() methods which
+        keeps entries in the directory listing instead of the vector of files.
+
+        \param options - Walk options (default is DirectoryWalkOptions())
+        \return Directory listing
+    */
+    DirectoryListing ListFiles(const DirectoryWalkOptions& options = DirectoryWalkOptions()) const;
 
     //! Create directory from the given path
     /*!
@@ -53,6 +53,17 @@ public:
     const Path& operator*() const noexcept;
     const Path* operator->() const noexcept;
 
+    //! Get the metadata of the current directory entry
+    /*!
+        Windows implementation returns metadata pre-populated from the read
+        directory entry without any system call. Unix implementation fetches
+        metadata with the single system call relative to the opened directory
+        descriptor, so the full path is not resolved again.
+
+        \return Current directory entry metadata
+    */
+    PathStatus status() const;
+
     //! Swap two instances
     void swap(DirectoryIterator& it) noexcept;
     friend void swap(DirectoryIterator& it1, DirectoryIterator& it2) noexcept;
@@ -0,0 +1,190 @@
+/*!
+    \file directory_listing.h
+    \brief Filesystem directory listing definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_DIRECTORY_LISTING_H
+#define CPPCOMMON_FILESYSTEM_DIRECTORY_LISTING_H
+
+#include "filesystem/path.h"
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Directory listing entry
+/*!
+    Lightweight view of the listed entry. Entry fields reference the string
+    table of the listing and are valid while the listing is not modified!
+*/
+struct DirectoryListingEntry
+{
+    //! Parent directory path
+    std::string_view parent;
+    //! Entry name
+    std::string_view name;
+    //! Entry type (symbolic links are reported as FileType::SYMLINK)
+    FileType type;
+    //! Entry target type (type of the symbolic link target if symbolic links are followed, otherwise the entry type)
+    FileType target;
+    //! Entry inode number (zero if not provided by the file system)
+    uint64_t inode;
+    //! Entry depth (zero for entries of the listed directory)
+    size_t depth;
+    //! Entry status (nullptr if the status was not requested)
+    const PathStatus* status;
+
+    //! Get the entry path
+    Path path() const { return Path(std::string(parent)) / Path(std::string(name)); }
+};
+
+//! Filesystem directory listing
+/*!
+    Directory listing keeps listed entries in compact records and all names
+    and parent paths in the single string table. Each parent directory path
+    is stored once for all its entries, so listing of millions of files
+    costs a few large allocations instead of a path and a file object with
+    buffers per entry. Paths are constructed on demand only.
+
+    Directory listing is filled with Directory::ListEntries() and
+    Directory::ListFiles() methods.
+
+    Not thread-safe.
+*/
+class DirectoryListing
+{
+public:
+    //! Directory listing iterator
+    class iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef DirectoryListingEntry value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const DirectoryListingEntry* pointer;
+        typedef DirectoryListingEntry reference;
+
+        iterator() noexcept : _listing(nullptr), _index(0) {}
+        iterator(const DirectoryListing* listing, size_t index) noexcept : _listing(listing), _index(index) {}
+
+        iterator& operator++() noexcept { ++_index; return *this; }
+        iterator operator++(int) noexcept { iterator result(*this); ++_index; return result; }
+        iterator& operator--() noexcept { --_index; return *this; }
+        iterator operator--(int) noexcept { iterator result(*this); --_index; return result; }
+        iterator& operator+=(difference_type offset) noexcept { _index += offset; return *this; }
+        iterator& operator-=(difference_type offset) noexcept { _index -= offset; return *this; }
+        friend iterator operator+(const iterator& it, difference_type offset) noexcept { return iterator(it._listing, it._index + offset); }
+        friend iterator operator-(const iterator& it, difference_type offset) noexcept { return iterator(it._listing, it._index - offset); }
+        friend difference_type operator-(const iterator& it1, const iterator& it2) noexcept { return (difference_type)it1._index - (difference_type)it2._index; }
+
+        friend bool operator==(const iterator& it1, const iterator& it2) noexcept { return (it1._listing == it2._listing) && (it1._index == it2._index); }
+        friend bool operator!=(const iterator& it1, const iterator& it2) noexcept { return !(it1 == it2); }
+        friend bool operator<(const iterator& it1, const iterator& it2) noexcept { return it1._index < it2._index; }
+
+        reference operator*() const noexcept { return (*_listing)[_index]; }
+        reference operator[](difference_type offset) const noexcept { return (*_listing)[_index + offset]; }
+
+    private:
+        const DirectoryListing* _listing;
+        size_t _index;
+    };
+
+    DirectoryListing() = default;
+    DirectoryListing(const DirectoryListing&) = default;
+    DirectoryListing(DirectoryListing&&) noexcept = default;
+    ~DirectoryListing() = default;
+
+    DirectoryListing& operator=(const DirectoryListing&) = default;
+    DirectoryListing& operator=(DirectoryListing&&) noexcept = default;
+
+    //! Check if the listing is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the listing entry with the given index
+    DirectoryListingEntry operator[](size_t index) const noexcept;
+
+    //! Is the listing empty?
+    bool empty() const noexcept { return _records.empty(); }
+    //! Get the count of listed entries
+    size_t size() const noexcept { return _records.size(); }
+    //! Get the count of distinct parent directories
+    size_t parents() const noexcept { return _parents.size(); }
+    //! Get the size of the string table in bytes
+    size_t strings() const noexcept { return _strings.size(); }
+
+    //! Get the begin listing iterator
+    iterator begin() const noexcept { return iterator(this, 0); }
+    //! Get the end listing iterator
+    iterator end() const noexcept { return iterator(this, size()); }
+
+    //! Get the path of the listing entry with the given index
+    Path path(size_t index) const { return (*this)[index].path(); }
+
+    //! Reserve the listing capacity
+    /*!
+        \param entries - Count of entries
+        \param strings - Size of the string table in bytes (default is 0)
+    */
+    void reserve(size_t entries, size_t strings = 0);
+
+    //! Add a new entry into the listing
+    /*!
+        Entries of the same parent directory added one by one share the
+        stored parent path.
+
+        \param parent - Parent directory path
+        \param name - Entry name
+        \param type - Entry type
+        \param target - Entry target type
+        \param inode - Entry inode number
+        \param depth - Entry depth
+        \param status - Entry status (default is nullptr)
+    */
+    void Add(std::string_view parent, std::string_view name, FileType type, FileType target, uint64_t inode, size_t depth, const PathStatus* status = nullptr);
+
+    //! Clear the listing
+    void Clear() noexcept;
+
+    //! Swap two instances
+    void swap(DirectoryListing& listing) noexcept;
+    friend void swap(DirectoryListing& listing1, DirectoryListing& listing2) noexcept;
+
+private:
+    // Compact listing record
+    struct Record
+    {
+        uint64_t inode;
+        size_t name;
+        uint32_t name_size;
+        uint32_t parent;
+        uint32_t depth;
+        FileType type;
+        FileType target;
+    };
+
+    // Stored parent path in the string table
+    struct Parent
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    std::string _strings;
+    std::vector<Record> _records;
+    std::vector<Parent> _parents;
+    std::vector<PathStatus> _statuses;
+};
+
+} // namespace CppCommon
+
+#include "directory_listing.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_DIRECTORY_LISTING_H
@@ -0,0 +1,70 @@
+/*!
+    \file directory_listing.inl
+    \brief Filesystem directory listing inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline DirectoryListingEntry DirectoryListing::operator[](size_t index) const noexcept
+{
+    assert((index < _records.size()) && "Index of the directory listing entry is out of bounds!");
+
+    const Record& record = _records[index];
+    const Parent& parent = _parents[record.parent];
+    const PathStatus* status = _statuses.empty() ? nullptr : &_statuses[index];
+    return DirectoryListingEntry{ std::string_view(_strings.data() + parent.offset, parent.size), std::string_view(_strings.data() + record.name, record.name_size), record.type, record.target, record.inode, record.depth, status };
+}
+
+inline void DirectoryListing::reserve(size_t entries, size_t strings)
+{
+    _records.reserve(entries);
+    if (strings > 0)
+        _strings.reserve(strings);
+}
+
+inline void DirectoryListing::Add(std::string_view parent, std::string_view name, FileType type, FileType target, uint64_t inode, size_t depth, const PathStatus* status)
+{
+    // Store the parent path once for all its entries added one by one
+    if (_parents.empty() || (std::string_view(_strings.data() + _parents.back().offset, _parents.back().size) != parent))
+    {
+        _parents.push_back(Parent{ _strings.size(), parent.size() });
+        _strings.append(parent);
+    }
+
+    // Listing with statuses keeps them for all entries
+    if ((status != nullptr) || !_statuses.empty())
+    {
+        _statuses.resize(_records.size());
+        _statuses.push_back((status != nullptr) ? *status : PathStatus());
+    }
+
+    _records.push_back(Record{ inode, _strings.size(), (uint32_t)name.size(), (uint32_t)(_parents.size() - 1), (uint32_t)depth, type, target });
+    _strings.append(name);
+}
+
+inline void DirectoryListing::Clear() noexcept
+{
+    _strings.clear();
+    _records.clear();
+    _parents.clear();
+    _statuses.clear();
+}
+
+inline void DirectoryListing::swap(DirectoryListing& listing) noexcept
+{
+    using std::swap;
+    swap(_strings, listing._strings);
+    swap(_records, listing._records);
+    swap(_parents, listing._parents);
+    swap(_statuses, listing._statuses);
+}
+
+inline void swap(DirectoryListing& listing1, DirectoryListing& listing2) noexcept
+{
+    listing1.swap(listing2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,85 @@
+/*!
+    \file directory_watcher.h
+    \brief Filesystem directory watcher definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_DIRECTORY_WATCHER_H
+#define CPPCOMMON_FILESYSTEM_DIRECTORY_WATCHER_H
+
+#include "filesystem/path.h"
+
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Directory change type
+enum class DirectoryChange
+{
+    ADDED,              //!< File or directory was added (created or moved in)
+    MODIFIED,           //!< File was modified
+    REMOVED,            //!< File or directory was removed (deleted or moved out)
+    RESCAN              //!< Change notifications were lost, the whole directory must be rescanned
+};
+
+//! Filesystem directory watcher
+/*!
+    Directory watcher subscribes to filesystem change notifications of the
+    given directory tree (inotify on Linux, ReadDirectoryChangesW on Windows)
+    and allows to poll them without blocking.
+
+    Not thread-safe.
+*/
+class DirectoryWatcher
+{
+public:
+    //! Directory change type (change type and absolute path of the changed entry)
+    typedef std::pair<DirectoryChange, Path> Change;
+
+    //! Start watching the given directory tree
+    /*!
+        Throws FileSystemException if change notifications are not supported
+        or failed to be subscribed.
+
+        \param path - Directory path
+    */
+    explicit DirectoryWatcher(const Path& path);
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher(DirectoryWatcher&&) = delete;
+    ~DirectoryWatcher();
+
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(DirectoryWatcher&&) = delete;
+
+    //! Get the watched directory path
+    const Path& path() const noexcept { return _path; }
+
+    //! Poll pending directory changes without blocking
+    /*!
+        \param changes - Directory changes to fill
+        \return Count of polled directory changes
+    */
+    size_t Poll(std::vector<Change>& changes);
+
+    //! Is directory change notifications supported on the current platform?
+    static bool IsSupported() noexcept;
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 256;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+
+    Path _path;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_DIRECTORY_WATCHER_H
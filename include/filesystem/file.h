@@ -14,14 +14,46 @@
 #include "filesystem/path.h"
 
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace CppCommon {
 
+class Pipe;
+
+//! File access advices
+enum class FileAdvice
+{
+    NORMAL,             //!< No special access pattern
+    SEQUENTIAL,         //!< Sequential access (aggressive read-ahead)
+    RANDOM,             //!< Random access (no read-ahead)
+    NOREUSE,            //!< Data will be accessed only once
+    WILLNEED,           //!< Data will be needed soon (start read-ahead)
+    DONTNEED            //!< Data will not be needed soon (drop it from the page cache)
+};
+
+//! File data region
+struct FileRegion
+{
+    uint64_t offset;    //!< Region offset
+    uint64_t size;      //!< Region size
+};
+
 //! Filesystem file
 /*!
     Filesystem file wraps file management operations (create, open, read, write, flush, close).
 
+    File could be opened in direct I/O mode (O_DIRECT, FILE_FLAG_NO_BUFFERING,
+    F_NOCACHE) which bypasses the system page cache, e.g. for storage engines
+    with their own cache. In direct I/O mode file buffers are aligned to
+    File::DIRECT_ALIGNMENT and their size must be a multiple of it. Unbuffered,
+    positional and vectored operations must use buffers, sizes and offsets
+    aligned to File::DIRECT_ALIGNMENT, otherwise the filesystem exception is
+    raised. Seek offsets must be aligned as well. Buffered writes could have
+    any size: the unaligned tail of written data is merged with the file
+    content of the last block, written with the whole block and kept in the
+    write buffer to be continued by following writes.
+
     Not thread-safe.
 */
 class File : public Path, public Reader, public Writer
@@ -33,6 +65,8 @@ public:
     static const Flags<FilePermissions> DEFAULT_PERMISSIONS;
     //! Default file buffer size (8192)
     static const size_t DEFAULT_BUFFER;
+    //! Alignment of buffers, sizes and offsets in direct I/O mode (4096)
+    static const size_t DIRECT_ALIGNMENT;
 
     //! Initialize file with an empty path
     File();
@@ -69,6 +103,8 @@ public:
     bool IsFileReadOpened() const;
     //! Is the file opened for writing?
     bool IsFileWriteOpened() const;
+    //! Is the file opened in direct I/O mode?
+    bool IsFileDirect() const;
 
     //! Create a new file
     /*!
@@ -80,8 +116,9 @@ public:
         \param attributes - File attributes (default is File::DEFAULT_ATTRIBUTES)
         \param permissions - File permissions (default is File::DEFAULT_PERMISSIONS)
         \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
+        \param direct - Direct I/O mode which bypasses the system page cache (default is false)
     */
-    void Create(bool read, bool write, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER);
+    void Create(bool read, bool write, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false);
     //! Open an existing file
     /*!
         If the file with the same name is not exist the method will raise
@@ -93,8 +130,25 @@ public:
         \param attributes - File attributes (default is File::DEFAULT_ATTRIBUTES)
         \param permissions - File permissions (default is File::DEFAULT_PERMISSIONS)
         \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
+        \param direct - Direct I/O mode which bypasses the system page cache (default is false)
     */
-    void Open(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER);
+    void Open(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false);
+    //! Open an existing file and report system errors into the given error code
+    /*!
+        Non-throwing variant for hot paths where a missing or inaccessible file
+        is an expected outcome. Opening of the already opened file is still
+        a programming error which raises a filesystem exception!
+
+        \param read - Read mode
+        \param write - Write mode
+        \param ec - Error code of the failed open (cleared on success)
+        \param truncate - Truncate file (default is false)
+        \param attributes - File attributes (default is File::DEFAULT_ATTRIBUTES)
+        \param permissions - File permissions (default is File::DEFAULT_PERMISSIONS)
+        \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
+        \param direct - Direct I/O mode which bypasses the system page cache (default is false)
+    */
+    void Open(bool read, bool write, std::error_code& ec, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false);
     //! Open or create file
     /*!
         \param read - Read mode
@@ -103,8 +157,9 @@ public:
         \param attributes - File attributes (default is File::DEFAULT_ATTRIBUTES)
         \param permissions - File permissions (default is File::DEFAULT_PERMISSIONS)
         \param buffer - File buffer size (default is File::DEFAULT_BUFFER)
+        \param direct - Direct I/O mode which bypasses the system page cache (default is false)
     */
-    void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER);
+    void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false);
 
     //! Read a bytes buffer from the opened file
     /*!
@@ -116,6 +171,28 @@ public:
         \return Count of read bytes
     */
     size_t Read(void* buffer, size_t size) override;
+    //! Read a bytes buffer from the opened file and report system errors into the given error code
+    /*!
+        Reading from the file which is not opened for reading is still
+        a programming error which raises a filesystem exception!
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param ec - Error code of the failed read (cleared on success)
+        \return Count of read bytes
+    */
+    size_t Read(void* buffer, size_t size, std::error_code& ec);
+    //! Read bytes from the opened file into the buffer chain
+    /*!
+        Data available in the read buffer is consumed first, the rest is read
+        directly into the writable tail of the buffer chain. If the file is
+        not opened for reading the method will raise a filesystem exception!
+
+        \param chain - Buffer chain to append
+        \param size - Maximal count of bytes to read
+        \return Count of read bytes
+    */
+    size_t ReadInto(BufferChain& chain, size_t size) override;
 
     using Reader::ReadAllBytes;
     using Reader::ReadAllText;
@@ -131,9 +208,150 @@ public:
         \return Count of written bytes
     */
     size_t Write(const void* buffer, size_t size) override;
+    //! Write a byte buffer into the opened file and report system errors into the given error code
+    /*!
+        Writing into the file which is not opened for writing is still
+        a programming error which raises a filesystem exception!
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param ec - Error code of the failed write (cleared on success)
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size, std::error_code& ec);
+    //! Write the buffer chain content into the opened file
+    /*!
+        The write buffer is flushed first, then all slices of the buffer chain
+        are written with the gather write (writev) without copy. Written bytes
+        are consumed from the buffer chain. If the file is not opened for
+        writing the method will raise a filesystem exception!
+
+        \param chain - Buffer chain to write
+        \return Count of written bytes
+    */
+    size_t WriteFrom(BufferChain& chain) override;
 
     using Writer::Write;
 
+    //! Read a bytes buffer from the given offset of the opened file
+    /*!
+        Positional read bypasses the file buffers and does not change the
+        current file offset (except Windows platform, where the file offset
+        is moved after the read bytes), so it is safe to read the same file
+        from multiple threads at different offsets. Data written by Write()
+        method is visible only after it is flushed from the write buffer.
+
+        Reads until the buffer is filled or the end of file is met.
+        If the file is not opened for reading the method will raise
+        a filesystem exception!
+
+        Thread-safe.
+
+        \param offset - File offset
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes
+    */
+    size_t ReadAt(uint64_t offset, void* buffer, size_t size) const;
+    //! Read a vector of bytes buffers from the given offset of the opened file
+    /*!
+        Scatter version of the positional read (preadv). Fills buffers in
+        order until all of them are filled or the end of file is met.
+
+        Thread-safe.
+
+        \param offset - File offset
+        \param buffers - Buffers to read
+        \return Count of read bytes
+    */
+    size_t ReadAt(uint64_t offset, std::span<const std::span<uint8_t>> buffers) const;
+    //! Write a byte buffer into the given offset of the opened file
+    /*!
+        Positional write bypasses the file buffers and does not change the
+        current file offset (except Windows platform, where the file offset
+        is moved after the written bytes), so it is safe to write the same
+        file from multiple threads at different offsets.
+
+        Writes the whole buffer. If the file is not opened for writing the
+        method will raise a filesystem exception!
+
+        Thread-safe.
+
+        \param offset - File offset
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t WriteAt(uint64_t offset, const void* buffer, size_t size);
+    //! Write a vector of bytes buffers into the given offset of the opened file
+    /*!
+        Gather version of the positional write (pwritev), e.g. to write
+        a header and a payload with a single system call and without copy.
+
+        Thread-safe.
+
+        \param offset - File offset
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteAt(uint64_t offset, std::span<const std::span<const uint8_t>> buffers);
+
+    //! Read a vector of bytes buffers from the current offset of the opened file
+    /*!
+        Scatter version of the read (readv). Data available in the read
+        buffer is consumed first, the rest is read directly into the given
+        buffers. Fills buffers in order until all of them are filled or
+        the end of file is met. If the file is not opened for reading the
+        method will raise a filesystem exception!
+
+        \param buffers - Buffers to read
+        \return Count of read bytes
+    */
+    size_t ReadV(std::span<const std::span<uint8_t>> buffers);
+    //! Write a vector of bytes buffers into the current offset of the opened file
+    /*!
+        Gather version of the write (writev). The write buffer is flushed
+        first, then given buffers are written directly without copy. If the
+        file is not opened for writing the method will raise a filesystem
+        exception!
+
+        \param buffers - Buffers to write
+        \return Count of written bytes
+    */
+    size_t WriteV(std::span<const std::span<const uint8_t>> buffers);
+
+    //! Transfer bytes from the given pipe into the current offset of the opened file
+    /*!
+        Linux implementation moves pipe pages into the file with splice()
+        without copying them through the user space, other platforms copy
+        them with the intermediate buffer. The write buffer is flushed first.
+        If the file is not opened for writing or opened in direct I/O mode
+        the method will raise a filesystem exception!
+
+        Will block until the given count of bytes is transferred or the write
+        endpoint of the pipe is closed.
+
+        \param pipe - Pipe to read
+        \param size - Count of bytes to transfer
+        \return Count of transferred bytes
+    */
+    size_t SpliceFrom(Pipe& pipe, size_t size);
+    //! Transfer bytes from the current offset of the opened file into the given pipe
+    /*!
+        Data available in the read buffer is written into the pipe first, the
+        rest is transferred with splice() in Linux without copying it through
+        the user space. If the file is not opened for reading or opened in
+        direct I/O mode the method will raise a filesystem exception!
+
+        Will block until the given count of bytes is transferred or the end of
+        file is met.
+
+        \param pipe - Pipe to write
+        \param size - Count of bytes to transfer
+        \return Count of transferred bytes
+    */
+    size_t SpliceTo(Pipe& pipe, size_t size);
+
     //! Seek into the opened file
     /*!
         If the file is not opened for writing the method will raise
@@ -155,6 +373,59 @@ public:
     */
     void Resize(uint64_t size);
 
+    //! Advise the operating system about the access pattern of the range of the opened file
+    /*!
+        Advice is a hint for the system page cache (posix_fadvise()), it is
+        ignored on platforms which do not support it.
+
+        \param advice - Access advice
+        \param offset - Range offset (default is 0)
+        \param size - Range size, zero means up to the end of file (default is 0)
+    */
+    void Advise(FileAdvice advice, uint64_t offset = 0, uint64_t size = 0);
+
+    //! Preallocate disk space for the range of the opened file
+    /*!
+        Reserves disk blocks for the given range at once (fallocate(),
+        F_PREALLOCATE, FileAllocationInfo), so following appends do not
+        fragment the file and do not fail because of the lack of disk space.
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param offset - Range offset
+        \param size - Range size
+        \param keep_size - Keep the current file size and reserve disk blocks only (default is true)
+    */
+    void Preallocate(uint64_t offset, uint64_t size, bool keep_size = true);
+
+    //! Punch a hole in the range of the opened file
+    /*!
+        Deallocates disk blocks of the given range (FALLOC_FL_PUNCH_HOLE,
+        F_PUNCHHOLE, FSCTL_SET_ZERO_DATA) keeping the file size, so old
+        segments of a circular log could be dropped without rewriting the
+        file. Reading of the range returns zeros. The range is limited by
+        the current file size. Filesystems without hole punching support
+        get the range filled with zeros. If the file is not opened for
+        writing the method will raise a filesystem exception!
+
+        \param offset - Range offset
+        \param size - Range size
+    */
+    void PunchHole(uint64_t offset, uint64_t size);
+
+    //! Get data regions of the range of the opened sparse file
+    /*!
+        Data regions are ranges of the file allocated on a disk, all other
+        ranges are holes which are read as zeros (SEEK_DATA and SEEK_HOLE,
+        FSCTL_QUERY_ALLOCATED_RANGES). Filesystems without sparse files
+        support report the whole range as a single data region.
+
+        \param offset - Range offset (default is 0)
+        \param size - Range size, zero means up to the end of file (default is 0)
+        \return Ordered data regions of the range
+    */
+    std::vector<FileRegion> DataRegions(uint64_t offset = 0, uint64_t size = 0) const;
+
     //! Flush the file
     /*!
         Flush any unwritten data of the opened file to the physical file
@@ -9,10 +9,16 @@
 #ifndef CPPCOMMON_FILESYSTEM_H
 #define CPPCOMMON_FILESYSTEM_H
 
+#include "filesystem/append_log.h"
 #include "filesystem/directory.h"
+#include "filesystem/directory_watcher.h"
 #include "filesystem/exceptions.h"
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 #include "filesystem/path.h"
+#include "filesystem/path_stat_cache.h"
+#include "filesystem/path_view.h"
 #include "filesystem/symlink.h"
+#include "filesystem/tree_fingerprint.h"
 
 #endif // CPPCOMMON_FILESYSTEM_H
@@ -0,0 +1,226 @@
+/*!
+    \file mapped_file.h
+    \brief Filesystem memory-mapped file definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+#define CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+
+#include "common/reader.h"
+#include "filesystem/path.h"
+
+#include <span>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Memory-mapped file modes
+enum class MappedFileMode
+{
+    READONLY,           //!< Read-only mapping
+    READWRITE,          //!< Read-write mapping shared with the file
+    COPYONWRITE         //!< Private copy-on-write mapping (modifications are not written into the file)
+};
+
+//! Memory-mapped file access advices
+enum class MappedFileAdvice
+{
+    NORMAL,             //!< No special access pattern
+    SEQUENTIAL,         //!< Sequential access (aggressive read-ahead, pages may be freed after access)
+    RANDOM,             //!< Random access (no read-ahead)
+    WILLNEED,           //!< Pages will be needed soon (start read-ahead)
+    DONTNEED            //!< Pages will not be needed soon (free them from the process working set)
+};
+
+//! Filesystem memory-mapped file
+/*!
+    Memory-mapped file maps the whole file content or the window of the file
+    into the process address space. File pages are loaded lazily by the
+    operating system on the first access and are shared with the system page
+    cache, so no additional copy of the file content is made and no system
+    call is required to access it.
+
+    The file is not kept opened while it is mapped, so it is possible to map
+    a lot of files without exhausting file descriptors.
+
+    Memory-mapped file is also a reader of the mapped content, so it can be
+    used with any code which consumes the Reader interface.
+
+    Not thread-safe.
+*/
+class MappedFile : public Reader
+{
+public:
+    //! Initialize an empty memory-mapped file
+    MappedFile() noexcept;
+    //! Initialize and map the whole given file
+    /*!
+        \param path - File path
+        \param mode - Mapping mode (default is MappedFileMode::READONLY)
+    */
+    explicit MappedFile(const Path& path, MappedFileMode mode = MappedFileMode::READONLY);
+    //! Initialize and map the window of the given file
+    /*!
+        \param path - File path
+        \param mode - Mapping mode
+        \param offset - Window offset in the file
+        \param size - Window size
+    */
+    MappedFile(const Path& path, MappedFileMode mode, uint64_t offset, size_t size);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& file) noexcept;
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& file) noexcept;
+
+    //! Check if the file is mapped
+    explicit operator bool() const noexcept { return IsMapped(); }
+
+    //! Get the mapped file path
+    const Path& path() const noexcept { return _path; }
+    //! Get the mapping mode
+    MappedFileMode mode() const noexcept { return _mode; }
+    //! Get the mapped window offset in the file
+    uint64_t offset() const noexcept { return _offset; }
+    //! Get the mapped window size
+    size_t size() const noexcept { return _size; }
+    //! Get the mapped window data
+    const void* data() const noexcept { return _ptr; }
+    //! Get the mapped window data (must not be modified in read-only mode)
+    void* data() noexcept { return _ptr; }
+
+    //! Get the mapped window content as a string view
+    std::string_view view() const noexcept { return std::string_view((const char*)_ptr, _size); }
+    //! Get the mapped window content as a bytes span
+    std::span<const uint8_t> span() const noexcept { return std::span<const uint8_t>((const uint8_t*)_ptr, _size); }
+    //! Get the mapped window content as a mutable bytes span (must not be modified in read-only mode)
+    std::span<uint8_t> span() noexcept { return std::span<uint8_t>((uint8_t*)_ptr, _size); }
+
+    //! Get the current read position in the mapped window
+    size_t position() const noexcept { return _position; }
+
+    //! Is the file mapped?
+    bool IsMapped() const noexcept { return !_path.empty(); }
+    //! Is the mapped window writable?
+    bool IsWritable() const noexcept { return IsMapped() && (_mode != MappedFileMode::READONLY); }
+
+    //! Map the whole given file
+    /*!
+        Empty files are mapped into an empty view.
+
+        \param path - File path
+        \param mode - Mapping mode (default is MappedFileMode::READONLY)
+    */
+    void Map(const Path& path, MappedFileMode mode = MappedFileMode::READONLY);
+    //! Map the window of the given file
+    /*!
+        The window offset may be unaligned, the mapping is aligned to the
+        system allocation granularity internally. If the window is out of
+        the file then the file is extended in read-write mode, otherwise
+        the method will raise a filesystem exception!
+
+        \param path - File path
+        \param mode - Mapping mode
+        \param offset - Window offset in the file
+        \param size - Window size
+    */
+    void Map(const Path& path, MappedFileMode mode, uint64_t offset, size_t size);
+    //! Unmap the file
+    void Unmap();
+
+    //! Resize the mapped window
+    /*!
+        Remaps the window with the same offset and the new size. In read-write
+        mode the file is extended to cover the new window, which allows to
+        append data through the mapping. In read-only mode the window may grow
+        up to the current file size, which allows to follow growing files.
+        Copy-on-write mappings cannot be resized, because private
+        modifications would be lost!
+
+        Pointers into the previous window are invalidated.
+
+        \param size - New window size
+    */
+    void Resize(size_t size);
+
+    //! Advise the operating system about the access pattern of the whole mapped window
+    /*!
+        \param advice - Access advice
+    */
+    void Advise(MappedFileAdvice advice)
+    { Advise(advice, 0, _size); }
+    //! Advise the operating system about the access pattern of the range of the mapped window
+    /*!
+        MappedFileAdvice::DONTNEED discards private modifications of
+        copy-on-write mappings!
+
+        \param advice - Access advice
+        \param offset - Range offset in the mapped window
+        \param size - Range size
+    */
+    void Advise(MappedFileAdvice advice, size_t offset, size_t size);
+
+    //! Flush the whole mapped window into the file
+    /*!
+        If the file is not mapped in read-write mode the method will raise
+        a filesystem exception!
+    */
+    void Flush()
+    { Flush(0, _size); }
+    //! Flush the range of the mapped window into the file
+    /*!
+        Synchronously writes modified pages of the range into the file.
+        If the file is not mapped in read-write mode the method will raise
+        a filesystem exception!
+
+        \param offset - Range offset in the mapped window
+        \param size - Range size
+    */
+    void Flush(size_t offset, size_t size);
+
+    //! Read a bytes buffer from the mapped window
+    /*!
+        Reads from the current read position and advances it.
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+    using Reader::ReadAllBytes;
+    using Reader::ReadAllText;
+    using Reader::ReadAllLines;
+
+    //! Seek the read position in the mapped window
+    /*!
+        \param position - Read position (will be limited by the window size)
+    */
+    void Seek(size_t position) noexcept { _position = (position < _size) ? position : _size; }
+
+    //! Swap two instances
+    void swap(MappedFile& file) noexcept;
+    friend void swap(MappedFile& file1, MappedFile& file2) noexcept;
+
+private:
+    Path _path;
+    MappedFileMode _mode;
+    uint64_t _offset;
+    void* _base;
+    size_t _length;
+    void* _ptr;
+    size_t _size;
+    size_t _position;
+};
+
+/*! \example filesystem_mapped_file.cpp Filesystem memory-mapped file example */
+
+} // namespace CppCommon
+
+#include "mapped_file.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
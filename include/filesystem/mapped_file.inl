@@ -0,0 +1,29 @@
+/*!
+    \file mapped_file.inl
+    \brief Filesystem memory-mapped file inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void MappedFile::swap(MappedFile& file) noexcept
+{
+    using std::swap;
+    swap(_path, file._path);
+    swap(_mode, file._mode);
+    swap(_offset, file._offset);
+    swap(_base, file._base);
+    swap(_length, file._length);
+    swap(_ptr, file._ptr);
+    swap(_size, file._size);
+    swap(_position, file._position);
+}
+
+inline void swap(MappedFile& file1, MappedFile& file2) noexcept
+{
+    file1.swap(file2);
+}
+
+} // namespace CppCommon
@@ -9,15 +9,24 @@
 #ifndef CPPCOMMON_FILESYSTEM_PATH_H
 #define CPPCOMMON_FILESYSTEM_PATH_H
 
+#include "common/enum_strings.h"
 #include "common/flags.h"
+#include "filesystem/path_view.h"
 #include "string/encoding.h"
 #include "string/format.h"
 #include "time/timestamp.h"
 
+#include <functional>
 #include <string>
+#include <system_error>
+#include <utility>
 
 namespace CppCommon {
 
+class GlobPattern;
+class Path;
+class ThreadPool;
+
 //! File types
 enum class FileType
 {
@@ -67,6 +76,42 @@ enum class FilePermissions
     ISVTX     = 01000   //!< This is the sticky bit
 };
 
+//! File type strings
+template <>
+struct EnumStrings<FileType>
+{
+    static constexpr std::pair<std::string_view, FileType> items[] =
+    {
+        { "NONE", FileType::NONE },
+        { "REGULAR", FileType::REGULAR },
+        { "DIRECTORY", FileType::DIRECTORY },
+        { "SYMLINK", FileType::SYMLINK },
+        { "BLOCK", FileType::BLOCK },
+        { "CHARACTER", FileType::CHARACTER },
+        { "FIFO", FileType::FIFO },
+        { "SOCKET", FileType::SOCKET },
+        { "UNKNOWN", FileType::UNKNOWN }
+    };
+};
+
+//! File attributes strings
+template <>
+struct EnumStrings<FileAttributes>
+{
+    static constexpr std::pair<std::string_view, FileAttributes> items[] =
+    {
+        { "NONE", FileAttributes::NONE },
+        { "NORMAL", FileAttributes::NORMAL },
+        { "ARCHIVED", FileAttributes::ARCHIVED },
+        { "HIDDEN", FileAttributes::HIDDEN },
+        { "INDEXED", FileAttributes::INDEXED },
+        { "OFFLINE", FileAttributes::OFFLINE },
+        { "READONLY", FileAttributes::READONLY },
+        { "SYSTEM", FileAttributes::SYSTEM },
+        { "TEMPORARY", FileAttributes::TEMPORARY }
+    };
+};
+
 //! Filesystem space information
 struct SpaceInfo
 {
@@ -75,6 +120,51 @@ struct SpaceInfo
     uint64_t available; //!< Free space available to a non-privileged process (may be equal or less than free)
 };
 
+//! Filesystem path metadata
+/*!
+    Metadata of the path fetched with the single system call (statx() on
+    Linux, GetFileAttributesEx() on Windows) instead of separate calls of
+    type(), permissions(), modified() and other path methods. Symbolic link
+    is reported with SYMLINK type and metadata of its target (if exists).
+*/
+struct PathStatus
+{
+    FileType type{FileType::NONE};          //!< File type (FileType::NONE if the path is not found)
+    Flags<FileAttributes> attributes;       //!< File attributes (Windows specific)
+    Flags<FilePermissions> permissions;     //!< File permissions (Unix specific)
+    uint64_t size{0};                       //!< File size, in bytes
+    size_t hardlinks{0};                    //!< Count of hardlinks (Unix specific)
+    UtcTimestamp created{Timestamp(0)};     //!< Created UTC timestamp (birth time if supported, otherwise modified time on Unix)
+    UtcTimestamp modified{Timestamp(0)};    //!< Modified UTC timestamp
+
+    //! Is the path exists?
+    bool IsExists() const noexcept { return type != FileType::NONE; }
+};
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+// Get metadata of the entry relative to the opened directory descriptor
+PathStatus StatusAt(int directory, const char* name, std::error_code& ec) noexcept;
+#endif
+// Get metadata from fields of the Windows directory entry find data
+PathStatus StatusFindData(uint32_t attributes, uint64_t size, uint64_t created, uint64_t modified) noexcept;
+
+} // namespace Internals
+//! @endcond
+
+//! Recursive copy and remove options
+struct PathTreeOptions
+{
+    //! Thread pool to run concurrent operations (default is nullptr - run in the calling thread)
+    ThreadPool* pool{nullptr};
+    //! Maximal count of in-flight operations, including the calling thread (default is 0 - all workers of the thread pool and the calling thread)
+    size_t concurrency{0};
+    //! Progress handler called after each processed entry with its path, count of processed entries and count of copied bytes (default is nullptr)
+    std::function<void(const Path&, uint64_t, uint64_t)> progress;
+};
+
 //! Filesystem path
 /*!
     Filesystem path wraps string directory, filename, symlink and other path types
@@ -82,6 +172,10 @@ struct SpaceInfo
     permissions in a file system. Additionally path contains operators and methods
     for path manipulation (concatenation, canonization, absolute path).
 
+    Path methods which only read or append a path value accept PathView,
+    so temporary paths are not materialized. Decompositions of the path
+    without allocations are available with PathView(path).
+
     Path is managed in UTF-8 encoding!
 
     Not thread-safe.
@@ -101,6 +195,16 @@ public:
         \param path - Path value as string
     */
     Path(const std::string& path) : _path(path) {}
+    //! Initialize path with a given string value (moved)
+    /*!
+        \param path - Path value as string
+    */
+    Path(std::string&& path) noexcept : _path(std::move(path)) {}
+    //! Initialize path with a given path view value
+    /*!
+        \param path - Path view value
+    */
+    explicit Path(PathView path) : _path(path.string()) {}
     //! Initialize path with a given wide C-string value
     /*!
         \param path - Path value as wide C-string
@@ -122,16 +226,24 @@ public:
     explicit operator bool() const noexcept { return !empty(); }
 
     // Append the given path with a path separator
-    Path& operator/=(const Path& path)
+    Path& operator/=(PathView path)
+    { return Append(path); }
+    Path& operator/=(const std::wstring& path)
     { return Append(path); }
-    friend Path operator/(const Path& path1, const Path& path2)
-    { return Path(path1).Append(path2); }
+    friend Path operator/(const Path& path1, PathView path2)
+    { Path result; result._path.reserve(path1._path.size() + path2.size() + 1); result._path = path1._path; result.Append(path2); return result; }
+    friend Path operator/(const Path& path1, const std::wstring& path2)
+    { return path1 / Path(path2); }
 
     // Concatenate the given path without a path separator
-    Path& operator+=(const Path& path)
+    Path& operator+=(PathView path)
+    { return Concat(path); }
+    Path& operator+=(const std::wstring& path)
     { return Concat(path); }
-    friend Path operator+(const Path& path1, const Path& path2)
-    { return Path(path1).Concat(path2); }
+    friend Path operator+(const Path& path1, PathView path2)
+    { Path result; result._path.reserve(path1._path.size() + path2.size()); result._path = path1._path; result.Concat(path2); return result; }
+    friend Path operator+(const Path& path1, const std::wstring& path2)
+    { return path1 + Path(path2); }
 
     // Path comparison
     friend bool operator==(const Path& path1, const Path& path2)
@@ -174,6 +286,8 @@ public:
 
     //! Get the path file type
     FileType type() const;
+    //! Get the path file type and report system errors into the given error code
+    FileType type(std::error_code& ec) const noexcept;
     //! Get the path file attributes
     Flags<FileAttributes> attributes() const;
     //! Get the path file permissions
@@ -184,6 +298,10 @@ public:
     UtcTimestamp modified() const;
     //! Get the path count of hardlinks
     size_t hardlinks() const;
+    //! Get the path metadata with the single system call
+    PathStatus status() const;
+    //! Get the path metadata and report system errors into the given error code
+    PathStatus status(std::error_code& ec) const noexcept;
     //! Get the path space information
     SpaceInfo space() const;
 
@@ -191,22 +309,22 @@ public:
     bool empty() const noexcept { return _path.empty(); }
 
     //! Has root path?
-    bool HasRoot() const { return !root().empty(); }
+    bool HasRoot() const noexcept { return PathView(_path).HasRoot(); }
     //! Has relative path?
-    bool HasRelative() const { return !relative().empty(); }
+    bool HasRelative() const noexcept { return PathView(_path).HasRelative(); }
     //! Has parent path?
-    bool HasParent() const { return !parent().empty(); }
+    bool HasParent() const noexcept { return PathView(_path).HasParent(); }
     //! Has filename?
-    bool HasFilename() const { return !filename().empty(); }
+    bool HasFilename() const noexcept { return PathView(_path).HasFilename(); }
     //! Has stem?
-    bool HasStem() const { return !stem().empty(); }
+    bool HasStem() const noexcept { return PathView(_path).HasStem(); }
     //! Has extension?
-    bool HasExtension() const { return !extension().empty(); }
+    bool HasExtension() const noexcept { return PathView(_path).HasExtension(); }
 
     //! Is absolute path?
-    bool IsAbsolute() const { return HasRoot(); }
+    bool IsAbsolute() const noexcept { return HasRoot(); }
     //! Is relative path?
-    bool IsRelative() const { return !HasRoot(); }
+    bool IsRelative() const noexcept { return !HasRoot(); }
 
     //! Is the path exists?
     bool IsExists() const { return type() != FileType::NONE; }
@@ -229,15 +347,19 @@ public:
     //! Assign the given path to the current one
     Path& Assign(const Path& path);
     //! Append the given path to the current one
-    Path& Append(const Path& path);
+    Path& Append(PathView path);
+    //! Append the given wide path to the current one
+    Path& Append(const std::wstring& path) { return Append(Path(path)); }
     //! Concatenate the given path to the current one
-    Path& Concat(const Path& path);
+    Path& Concat(PathView path);
+    //! Concatenate the given wide path to the current one
+    Path& Concat(const std::wstring& path) { return Concat(Path(path)); }
     //! Convert all path separators to system ones ('\' for Windows or '/' for Unix)
     Path& MakePreferred();
     //! Replace the current path filename with a given one
-    Path& ReplaceFilename(const Path& filename);
+    Path& ReplaceFilename(PathView filename);
     //! Replace the current path extension with a given one
-    Path& ReplaceExtension(const Path& extension);
+    Path& ReplaceExtension(PathView extension);
 
     //! Remove the current path filename
     Path& RemoveFilename() { return ReplaceFilename(""); }
@@ -271,6 +393,10 @@ public:
 
     //! Copy the given source path to destination path (file, empty directory, symlink, etc)
     /*!
+        Regular files are cloned by the file system if possible (reflinks
+        with FICLONE or in-kernel copy_file_range() in Linux, clonefile() in
+        macOS), so copies inside XFS/btrfs/APFS volumes share data blocks.
+
         \param src - Source path
         \param dst - Destination path
         \param overwrite - Overwrite destination path (default is false)
@@ -286,14 +412,29 @@ public:
         \return Copied path
     */
     static Path CopyIf(const Path& src, const Path& dst, const std::string& pattern = "", bool overwrite = false);
+    //! Copy all files matched to the compiled glob pattern from the the given source path to destination path (files, directories, symlinks, etc)
+    /*!
+        \param src - Source path
+        \param dst - Destination path
+        \param pattern - Compiled glob pattern
+        \param overwrite - Overwrite destination path (default is false)
+        \return Copied path
+    */
+    static Path CopyIf(const Path& src, const Path& dst, const GlobPattern& pattern, bool overwrite = false);
     //! Recursively copy the given source path to destination path (files, directories, symlinks, etc)
     /*!
+        Directory tree is walked and created first, then files are copied
+        with the bounded count of in-flight operations by workers of the
+        thread pool and the calling thread. Progress handler calls are
+        serialized.
+
         \param src - Source path
         \param dst - Destination path
         \param overwrite - Overwrite destination path (default is false)
+        \param options - Recursive copy options (default is PathTreeOptions())
         \return Copied path
     */
-    static Path CopyAll(const Path& src, const Path& dst, bool overwrite = false);
+    static Path CopyAll(const Path& src, const Path& dst, bool overwrite = false, const PathTreeOptions& options = PathTreeOptions());
     //! Rename the given source path to destination path (file, empty directory, symlink, etc)
     /*!
         \param src - Source path
@@ -309,10 +450,16 @@ public:
     static Path Remove(const Path& path);
     //! Recursively remove the given path (file, empty directory, symlink, etc) from the filesystem
     /*!
+        Files and symbolic links are removed during the directory tree walk by
+        workers of the thread pool and the calling thread, then directories
+        are removed. Symbolic links are never followed. Progress handler
+        calls are serialized.
+
         \param path - Path to remove
+        \param options - Recursive remove options (default is PathTreeOptions())
         \return Parent path
     */
-    static Path RemoveAll(const Path& path);
+    static Path RemoveAll(const Path& path, const PathTreeOptions& options = PathTreeOptions());
     //! Recursively remove the given path matched to the given pattern (file, empty directory, symlink, etc) from the filesystem
     /*!
         All files/symlinks will be matched to the given pattern!
@@ -322,6 +469,15 @@ public:
         \return Parent path
     */
     static Path RemoveIf(const Path& path, const std::string& pattern = "");
+    //! Recursively remove the given path matched to the compiled glob pattern (file, empty directory, symlink, etc) from the filesystem
+    /*!
+        All files/symlinks will be matched to the given pattern!
+
+        \param path - Path to remove
+        \param pattern - Compiled glob pattern
+        \return Parent path
+    */
+    static Path RemoveIf(const Path& path, const GlobPattern& pattern);
 
     //! Set file attributes for the given path
     /*!
@@ -374,6 +530,11 @@ public:
 protected:
     //! Path string
     std::string _path;
+
+private:
+    // Is the given path view references the path string?
+    bool overlaps(PathView path) const noexcept
+    { return !path.empty() && !std::less<const char*>()(path.data(), _path.data()) && !std::less<const char*>()(_path.data() + _path.size(), path.data()); }
 };
 
 /*! \example filesystem_path.cpp Filesystem path example */
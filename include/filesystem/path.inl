@@ -11,6 +11,15 @@ ENUM_FLAGS(CppCommon::FilePermissions)
 
 namespace CppCommon {
 
+inline PathView::PathView(const Path& path) noexcept : _path(path.string())
+{
+}
+
+inline Path PathView::path() const
+{
+    return Path(*this);
+}
+
 inline bool Path::IsOther() const
 {
     FileType t = type();
@@ -23,9 +32,13 @@ inline Path& Path::Assign(const Path& path)
     return *this;
 }
 
-inline Path& Path::Concat(const Path& path)
+inline Path& Path::Concat(PathView path)
 {
-    _path.append(path._path);
+    // Path view of the current path is copied before it is modified
+    if (overlaps(path))
+        return Concat(Path(path));
+
+    _path.append(path.data(), path.size());
     return *this;
 }
 
@@ -52,4 +65,14 @@ struct fmt::formatter<CppCommon::Path> : formatter<std::string_view>
         return formatter<string_view>::format(value.string(), ctx);
     }
 };
+
+template <>
+struct fmt::formatter<CppCommon::PathView> : formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const CppCommon::PathView& value, FormatContext& ctx) const
+    {
+        return formatter<string_view>::format(value.string(), ctx);
+    }
+};
 #endif
@@ -0,0 +1,133 @@
+/*!
+    \file path_stat_cache.h
+    \brief Filesystem path metadata cache definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_PATH_STAT_CACHE_H
+#define CPPCOMMON_FILESYSTEM_PATH_STAT_CACHE_H
+
+#include "filesystem/path.h"
+#include "time/timespan.h"
+
+#include <vector>
+
+namespace CppCommon {
+
+//! Filesystem path metadata cache
+/*!
+    Path metadata cache keeps metadata of repeatedly queried paths, so
+    stat-heavy workloads (e.g. build artifacts indexers) issue a single
+    Path::status() system call per path instead of separate calls for the
+    type, size, permissions and timestamps on each query.
+
+    Cached metadata is coherent with the filesystem for the given time to
+    live. Directory trees subscribed with Watch() invalidate cached entries
+    of changed paths (and their parent directories) with directory change
+    notifications, so the time to live could be disabled for them. Change
+    notifications are polled lazily during lookups at most once per
+    millisecond. Notifications report absolute paths, so watched entries
+    should be queried with absolute paths as well.
+
+    Cache is divided into shards with separate read-write locks, so
+    concurrent lookups from different threads do not contend each other.
+    Batched lookups take the lock of each shard only once.
+
+    Thread-safe.
+*/
+class PathStatCache
+{
+public:
+    //! Initialize path metadata cache with the given time to live
+    /*!
+        \param ttl - Time to live of cached entries (default is 1 second, Timespan::zero() to disable the expiration)
+    */
+    explicit PathStatCache(const Timespan& ttl = Timespan::seconds(1));
+    PathStatCache(const PathStatCache&) = delete;
+    PathStatCache(PathStatCache&&) = delete;
+    ~PathStatCache();
+
+    PathStatCache& operator=(const PathStatCache&) = delete;
+    PathStatCache& operator=(PathStatCache&&) = delete;
+
+    //! Get the time to live of cached entries
+    const Timespan& ttl() const noexcept;
+    //! Get the count of cached entries
+    size_t size() const;
+    //! Get the count of lookups served from the cache
+    uint64_t hits() const noexcept;
+    //! Get the count of lookups which called the filesystem
+    uint64_t misses() const noexcept;
+
+    //! Watch the directory tree and invalidate changed entries
+    /*!
+        Throws FileSystemException if change notifications are not supported
+        or failed to be subscribed.
+
+        \param directory - Directory path
+    */
+    void Watch(const Path& directory);
+
+    //! Get the path metadata
+    /*!
+        \param path - Path to query
+        \return Cached or fetched path metadata
+    */
+    PathStatus Get(const Path& path);
+    //! Get metadata of the given paths in a batch
+    /*!
+        \param paths - Paths to query
+        \param result - Metadata of the given paths in the same order
+    */
+    void Get(const std::vector<Path>& paths, std::vector<PathStatus>& result);
+
+    //! Put the known path metadata into the cache
+    /*!
+        Allows to pre-populate the cache with metadata returned by
+        DirectoryIterator::status().
+
+        \param path - Path
+        \param status - Path metadata
+    */
+    void Put(const Path& path, const PathStatus& status);
+    //! Populate the cache with metadata of the directory entries
+    /*!
+        \param directory - Directory path
+        \param recursive - Recursive directory traversal flag (default is false)
+        \return Count of populated entries
+    */
+    size_t Populate(const Path& directory, bool recursive = false);
+
+    //! Invalidate the cached path metadata
+    /*!
+        \param path - Path
+        \return 'true' if the cached entry was removed, 'false' if the path was not cached
+    */
+    bool Invalidate(const Path& path);
+    //! Clear the cache
+    void Clear();
+
+    //! Apply pending directory change notifications
+    /*!
+        \return Count of applied directory changes
+    */
+    size_t Poll();
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 256;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example filesystem_path_stat_cache.cpp Filesystem path metadata cache example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_PATH_STAT_CACHE_H
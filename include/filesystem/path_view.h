@@ -0,0 +1,133 @@
+/*!
+    \file path_view.h
+    \brief Filesystem path view definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_PATH_VIEW_H
+#define CPPCOMMON_FILESYSTEM_PATH_VIEW_H
+
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace CppCommon {
+
+class Path;
+
+//! Filesystem path view
+/*!
+    Path view is a non-owning reference to the UTF-8 path string with the
+    same decomposition methods as Path (root, relative, parent, filename,
+    stem, extension). Decompositions return views into the same string, so
+    walking and filtering paths costs no allocations. Path is materialized
+    explicitly with Path(view) or path() only when it is really required.
+
+    Path view must not outlive the referenced string!
+
+    Not thread-safe.
+*/
+class PathView
+{
+public:
+    //! Initialize path view with an empty value
+    PathView() noexcept : _path() {}
+    //! Initialize path view with a given C-string value
+    /*!
+        \param path - Path value as C-string
+    */
+    PathView(const char* path) noexcept : _path(path) {}
+    //! Initialize path view with a given string view value
+    /*!
+        \param path - Path value as string view
+    */
+    PathView(std::string_view path) noexcept : _path(path) {}
+    //! Initialize path view with a given string value
+    /*!
+        \param path - Path value as string
+    */
+    PathView(const std::string& path) noexcept : _path(path) {}
+    //! Initialize path view with a given path value
+    /*!
+        \param path - Path value
+    */
+    PathView(const Path& path) noexcept;
+    PathView(const PathView&) noexcept = default;
+    ~PathView() noexcept = default;
+
+    PathView& operator=(const PathView&) noexcept = default;
+
+    //! Check if the path view is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    // Path view comparison
+    friend bool operator==(PathView path1, PathView path2) noexcept
+    { return path1._path == path2._path; }
+    friend bool operator!=(PathView path1, PathView path2) noexcept
+    { return path1._path != path2._path; }
+    friend bool operator<(PathView path1, PathView path2) noexcept
+    { return path1._path < path2._path; }
+    friend bool operator>(PathView path1, PathView path2) noexcept
+    { return path1._path > path2._path; }
+    friend bool operator<=(PathView path1, PathView path2) noexcept
+    { return path1._path <= path2._path; }
+    friend bool operator>=(PathView path1, PathView path2) noexcept
+    { return path1._path >= path2._path; }
+
+    //! Get the path value as UTF-8 string view
+    std::string_view string() const noexcept { return _path; }
+    //! Get the path value data (not null-terminated!)
+    const char* data() const noexcept { return _path.data(); }
+    //! Get the path value size
+    size_t size() const noexcept { return _path.size(); }
+
+    //! Materialize the path
+    Path path() const;
+
+    //! Decompose root path from the current path view
+    PathView root() const noexcept;
+    //! Decompose relative path from the current path view
+    PathView relative() const noexcept;
+    //! Decompose parent path from the current path view
+    PathView parent() const noexcept;
+    //! Decompose filename from the current path view
+    PathView filename() const noexcept;
+    //! Decompose stem from the current path view
+    PathView stem() const noexcept;
+    //! Decompose extension from the current path view
+    PathView extension() const noexcept;
+
+    //! Is the path view empty?
+    bool empty() const noexcept { return _path.empty(); }
+
+    //! Has root path?
+    bool HasRoot() const noexcept { return !root().empty(); }
+    //! Has relative path?
+    bool HasRelative() const noexcept { return !relative().empty(); }
+    //! Has parent path?
+    bool HasParent() const noexcept { return !parent().empty(); }
+    //! Has filename?
+    bool HasFilename() const noexcept { return !filename().empty(); }
+    //! Has stem?
+    bool HasStem() const noexcept { return !stem().empty(); }
+    //! Has extension?
+    bool HasExtension() const noexcept { return !extension().empty(); }
+
+    //! Is absolute path?
+    bool IsAbsolute() const noexcept { return HasRoot(); }
+    //! Is relative path?
+    bool IsRelative() const noexcept { return !HasRoot(); }
+
+    //! Output instance into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, PathView path)
+    { os << path._path; return os; }
+
+private:
+    std::string_view _path;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_PATH_VIEW_H
@@ -0,0 +1,188 @@
+/*!
+    \file tree_fingerprint.h
+    \brief Filesystem directory tree fingerprint definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_TREE_FINGERPRINT_H
+#define CPPCOMMON_FILESYSTEM_TREE_FINGERPRINT_H
+
+#include "common/uint128.h"
+#include "filesystem/path.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+class GlobPattern;
+class ThreadPool;
+
+//! File fingerprint
+struct FileFingerprint
+{
+    //! File path relative to the tree root (UTF-8 with '/' separators)
+    std::string path;
+    //! File inode number (zero if not provided by the file system)
+    uint64_t inode{0};
+    //! File size, in bytes
+    uint64_t size{0};
+    //! File modified UTC timestamp
+    UtcTimestamp modified{Timestamp(0)};
+    //! File content hash
+    uint128_t hash;
+};
+
+//! Directory tree fingerprint options
+struct TreeFingerprintOptions
+{
+    //! Compiled glob pattern of fingerprinted file names, must be valid during the scan (default is nullptr - all files)
+    const GlobPattern* glob{nullptr};
+    //! Follow symbolic links to directories and files (default is false)
+    bool symlinks{false};
+    //! Minimal size of files hashed through the memory mapping, smaller files are read with a single call (default is 64 KiB)
+    size_t mapping{65536};
+    //! Thread pool to walk and hash files in parallel (default is nullptr - scan in the calling thread)
+    ThreadPool* pool{nullptr};
+    //! Maximal count of threads hashing files, including the calling thread (default is 0 - all workers of the thread pool and the calling thread)
+    size_t concurrency{0};
+};
+
+//! Difference of two directory tree fingerprints
+struct TreeDifference
+{
+    //! Relative paths of files which are present only in the target tree
+    std::vector<std::string> created;
+    //! Relative paths of files which are present only in the source tree
+    std::vector<std::string> removed;
+    //! Relative paths of files with different content
+    std::vector<std::string> modified;
+
+    //! Are trees equal?
+    bool empty() const noexcept { return created.empty() && removed.empty() && modified.empty(); }
+};
+
+//! Directory tree fingerprint
+/*!
+    Directory tree fingerprint keeps content hashes of all regular files of
+    the directory tree, sorted by their relative paths. Fingerprints of two
+    trees are compared without reading files again, so synchronization
+    tools copy only changed files.
+
+    Scan is incremental: the previous fingerprint (scanned or loaded from
+    the cache file) is used as the cache keyed by (inode, size, modified
+    timestamp), so only new and changed files are read. Renamed files keep
+    their inode and are not read again as well. Files modified within the
+    timestamp granularity of the previous scan are always read again, so
+    changes right after hashing are not missed.
+
+    Files are walked and hashed in parallel with workers of the thread pool.
+    Large files are hashed through the memory mapping without copying,
+    small files are read with a single system call into the per-thread
+    buffer. Contents are hashed with 128-bit FastHash.
+
+    Hash values depend on the CPU byte order, so cache files must not be
+    shared between machines with different byte orders (the cache is
+    reset in this case).
+
+    Not thread-safe.
+*/
+class TreeFingerprint
+{
+public:
+    TreeFingerprint();
+    TreeFingerprint(const TreeFingerprint&) = default;
+    TreeFingerprint(TreeFingerprint&&) = default;
+    ~TreeFingerprint() = default;
+
+    TreeFingerprint& operator=(const TreeFingerprint&) = default;
+    TreeFingerprint& operator=(TreeFingerprint&&) = default;
+
+    //! Get the count of fingerprinted files
+    size_t size() const noexcept { return _files.size(); }
+    //! Get file fingerprints sorted by their relative paths
+    const std::vector<FileFingerprint>& files() const noexcept { return _files; }
+    //! Get the scan UTC timestamp
+    const UtcTimestamp& scanned() const noexcept { return _scanned; }
+
+    //! Get the count of files read by the last scan
+    uint64_t hashed() const noexcept { return _hashed; }
+    //! Get the count of files reused from the cache by the last scan
+    uint64_t reused() const noexcept { return _reused; }
+    //! Get the count of bytes read by the last scan
+    uint64_t bytes() const noexcept { return _bytes; }
+
+    //! Is the fingerprint empty?
+    bool empty() const noexcept { return _files.empty(); }
+
+    //! Calculate the hash of the whole tree (relative paths and content hashes of all files)
+    uint128_t hash() const noexcept;
+
+    //! Find the fingerprint of the file with the given relative path
+    /*!
+        \param path - Relative path of the file (UTF-8 with '/' separators)
+        \return Pointer to the file fingerprint or nullptr if the file was not found
+    */
+    const FileFingerprint* find(std::string_view path) const noexcept;
+
+    //! Scan the directory tree and update the fingerprint
+    /*!
+        Throws FileSystemException if the directory tree cannot be walked or
+        any file cannot be read.
+
+        \param directory - Directory path
+        \param options - Scan options (default is TreeFingerprintOptions())
+    */
+    void Scan(const Path& directory, const TreeFingerprintOptions& options = TreeFingerprintOptions());
+
+    //! Compare two directory tree fingerprints
+    /*!
+        \param source - Source tree fingerprint
+        \param target - Target tree fingerprint
+        \return Difference of the source and target trees
+    */
+    static TreeDifference Compare(const TreeFingerprint& source, const TreeFingerprint& target);
+
+    //! Load the fingerprint from the cache file
+    /*!
+        Missing, corrupted or incompatible cache files are ignored.
+
+        \param path - Cache file path
+        \return 'true' if the fingerprint was loaded, 'false' if the fingerprint was reset
+    */
+    bool Load(const Path& path);
+    //! Save the fingerprint into the cache file
+    /*!
+        Cache file is written into the temporary file and then renamed, so the
+        previous cache file is never left partially written.
+
+        Throws FileSystemException if the cache file cannot be written.
+
+        \param path - Cache file path
+    */
+    void Save(const Path& path) const;
+
+    //! Clear the fingerprint
+    void clear() noexcept;
+
+    //! Swap two instances
+    void swap(TreeFingerprint& fingerprint) noexcept;
+    friend void swap(TreeFingerprint& fingerprint1, TreeFingerprint& fingerprint2) noexcept
+    { fingerprint1.swap(fingerprint2); }
+
+private:
+    std::vector<FileFingerprint> _files;
+    UtcTimestamp _scanned;
+    uint64_t _hashed;
+    uint64_t _reused;
+    uint64_t _bytes;
+};
+
+/*! \example filesystem_tree_fingerprint.cpp Filesystem directory tree fingerprint example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_TREE_FINGERPRINT_H
@@ -0,0 +1,269 @@
+/*!
+    \file decimal.h
+    \brief Fixed-point decimal type definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MATH_DECIMAL_H
+#define CPPCOMMON_MATH_DECIMAL_H
+
+#include "errors/exceptions.h"
+#include "math/math.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Calculate 10 raised to the given power
+constexpr int64_t DecimalPower10(unsigned exponent) noexcept
+{
+    int64_t result = 1;
+    while (exponent-- > 0)
+        result *= 10;
+    return result;
+}
+
+// Add two raw decimal values ('false' on overflow)
+inline bool DecimalAdd(int64_t value1, int64_t value2, int64_t& result) noexcept;
+// Subtract two raw decimal values ('false' on overflow)
+inline bool DecimalSubtract(int64_t value1, int64_t value2, int64_t& result) noexcept;
+// Calculate (value * multiplier / divider) rounded half away from zero ('false' on overflow)
+inline bool DecimalMulDiv(int64_t value, int64_t multiplier, int64_t divider, int64_t& result) noexcept;
+
+// Format the raw decimal value with the given scale into the buffer
+size_t DecimalFormat(int64_t value, unsigned scale, char* buffer, size_t size) noexcept;
+// Parse the raw decimal value with the given scale from the string
+bool DecimalParse(std::string_view str, unsigned scale, int64_t& value) noexcept;
+
+} // namespace Internals
+//! @endcond
+
+//! Fixed-point decimal type
+/*!
+    Fixed-point decimal keeps the value as a signed 64-bit count of 10^-Scale
+    units, so Decimal<4> represents values up to +/-922337203685477.5807
+    exactly. Addition, subtraction and comparison are plain integer operations.
+    Multiplication and division calculate the full 128-bit intermediate value
+    with Math::MulDivRound64() and round the result half away from zero.
+
+    All arithmetic operations are overflow-checked and throw DomainException
+    on overflow or division by zero. Batch operations over spans accumulate
+    overflow flags without branches in the loop body, so compilers are able
+    to vectorize them, and check the overflow once after the loop.
+
+    Not thread-safe.
+*/
+template <unsigned Scale>
+class Decimal
+{
+    static_assert(Scale <= 18, "Decimal scale must be in the range [0, 18]!");
+
+public:
+    //! Count of fractional digits
+    static constexpr unsigned SCALE = Scale;
+    //! Count of 10^-Scale units in one
+    static constexpr int64_t FACTOR = Internals::DecimalPower10(Scale);
+    //! Maximal size of the formatted decimal string
+    static constexpr size_t STRING_SIZE = 21;
+
+    //! Initialize decimal with a zero value
+    constexpr Decimal() noexcept : _value(0) {}
+    //! Initialize decimal with a given integer value
+    /*!
+        Throws DomainException if the value is out of the decimal range.
+
+        \param value - Integer value
+    */
+    explicit Decimal(int64_t value);
+    Decimal(const Decimal&) noexcept = default;
+    Decimal(Decimal&&) noexcept = default;
+    ~Decimal() noexcept = default;
+
+    Decimal& operator=(const Decimal&) noexcept = default;
+    Decimal& operator=(Decimal&&) noexcept = default;
+
+    //! Create decimal from the raw count of 10^-Scale units
+    /*!
+        \param raw - Raw count of 10^-Scale units
+        \return Decimal value
+    */
+    static constexpr Decimal FromRaw(int64_t raw) noexcept
+    { Decimal result; result._value = raw; return result; }
+    //! Create decimal from the double value rounded to the nearest 10^-Scale unit
+    /*!
+        Throws DomainException if the value is not finite or out of the decimal range.
+
+        \param value - Double value
+        \return Decimal value
+    */
+    static Decimal FromDouble(double value);
+
+    //! Check if the decimal is not zero
+    explicit operator bool() const noexcept { return (_value != 0); }
+
+    //! Get the raw count of 10^-Scale units
+    constexpr int64_t raw() const noexcept { return _value; }
+    //! Get the integer part truncated toward zero
+    constexpr int64_t integer() const noexcept { return _value / FACTOR; }
+    //! Get the fractional part in 10^-Scale units with the sign of the value
+    constexpr int64_t fraction() const noexcept { return _value % FACTOR; }
+
+    //! Convert decimal to the double value
+    double ToDouble() const noexcept { return (double)_value / (double)FACTOR; }
+
+    //! Rescale decimal to another count of fractional digits rounding half away from zero
+    /*!
+        Throws DomainException if the rescaled value is out of the decimal range.
+
+        \return Rescaled decimal value
+    */
+    template <unsigned OtherScale>
+    Decimal<OtherScale> rescale() const;
+
+    // Decimal arithmetic
+    Decimal operator+() const noexcept { return *this; }
+    Decimal operator-() const;
+
+    Decimal& operator+=(const Decimal& value) { return *this = *this + value; }
+    Decimal& operator-=(const Decimal& value) { return *this = *this - value; }
+    Decimal& operator*=(const Decimal& value) { return *this = *this * value; }
+    Decimal& operator*=(int64_t value) { return *this = *this * value; }
+    Decimal& operator/=(const Decimal& value) { return *this = *this / value; }
+    Decimal& operator/=(int64_t value) { return *this = *this / value; }
+
+    friend Decimal operator+(const Decimal& value1, const Decimal& value2)
+    { int64_t result; bool success = Internals::DecimalAdd(value1._value, value2._value, result); return Decimal::Checked(success, result); }
+    friend Decimal operator-(const Decimal& value1, const Decimal& value2)
+    { int64_t result; bool success = Internals::DecimalSubtract(value1._value, value2._value, result); return Decimal::Checked(success, result); }
+
+    friend Decimal operator*(const Decimal& value1, const Decimal& value2)
+    { int64_t result; bool success = Internals::DecimalMulDiv(value1._value, value2._value, FACTOR, result); return Decimal::Checked(success, result); }
+    friend Decimal operator*(const Decimal& value1, int64_t value2)
+    { int64_t result; bool success = Internals::DecimalMulDiv(value1._value, value2, 1, result); return Decimal::Checked(success, result); }
+    friend Decimal operator*(int64_t value1, const Decimal& value2)
+    { return value2 * value1; }
+
+    friend Decimal operator/(const Decimal& value1, const Decimal& value2)
+    { int64_t result; bool success = Internals::DecimalMulDiv(value1._value, FACTOR, Decimal::Divider(value2._value), result); return Decimal::Checked(success, result); }
+    friend Decimal operator/(const Decimal& value1, int64_t value2)
+    { int64_t result; bool success = Internals::DecimalMulDiv(value1._value, 1, Decimal::Divider(value2), result); return Decimal::Checked(success, result); }
+
+    // Decimal comparison
+    friend constexpr bool operator==(const Decimal& value1, const Decimal& value2) noexcept
+    { return value1._value == value2._value; }
+    friend constexpr bool operator!=(const Decimal& value1, const Decimal& value2) noexcept
+    { return value1._value != value2._value; }
+    friend constexpr bool operator<(const Decimal& value1, const Decimal& value2) noexcept
+    { return value1._value < value2._value; }
+    friend constexpr bool operator>(const Decimal& value1, const Decimal& value2) noexcept
+    { return value1._value > value2._value; }
+    friend constexpr bool operator<=(const Decimal& value1, const Decimal& value2) noexcept
+    { return value1._value <= value2._value; }
+    friend constexpr bool operator>=(const Decimal& value1, const Decimal& value2) noexcept
+    { return value1._value >= value2._value; }
+
+    //! Convert decimal to the string with all fractional digits ("-123.4500")
+    std::string string() const;
+    //! Convert decimal to the string with all fractional digits into the given buffer
+    /*!
+        \param buffer - Output buffer
+        \param size - Output buffer size
+        \return Count of written characters (zero if the output buffer is too small)
+    */
+    size_t string(char* buffer, size_t size) const noexcept
+    { return Internals::DecimalFormat(_value, Scale, buffer, size); }
+
+    //! Parse decimal from the string
+    /*!
+        Accepts an optional sign, integer digits and optional fractional digits
+        after '.'. Extra fractional digits are rounded half away from zero.
+
+        \param str - String to parse
+        \param value - Parsed decimal value
+        \return 'true' if the string is a valid decimal in the decimal range, 'false' otherwise
+    */
+    static bool Parse(std::string_view str, Decimal& value) noexcept
+    { return Internals::DecimalParse(str, Scale, value._value); }
+    //! Parse decimal from the string
+    /*!
+        Throws ArgumentException if the string is not a valid decimal.
+
+        \param str - String to parse
+        \return Parsed decimal value
+    */
+    static Decimal Parse(std::string_view str);
+
+    //! Add two spans of decimals element-wise
+    /*!
+        Throws DomainException on overflow of any element. In this case
+        the content of the result span is unspecified.
+
+        \param values1 - First span of decimals
+        \param values2 - Second span of decimals (same size)
+        \param results - Result span of decimals (same size, might be the same as any input span)
+    */
+    static void Add(std::span<const Decimal> values1, std::span<const Decimal> values2, std::span<Decimal> results);
+    //! Subtract two spans of decimals element-wise
+    /*!
+        Throws DomainException on overflow of any element. In this case
+        the content of the result span is unspecified.
+
+        \param values1 - First span of decimals
+        \param values2 - Second span of decimals (same size)
+        \param results - Result span of decimals (same size, might be the same as any input span)
+    */
+    static void Subtract(std::span<const Decimal> values1, std::span<const Decimal> values2, std::span<Decimal> results);
+    //! Multiply the span of decimals by the decimal multiplier
+    /*!
+        Throws DomainException on overflow of any element. In this case
+        the content of the result span is unspecified.
+
+        \param values - Span of decimals
+        \param multiplier - Decimal multiplier
+        \param results - Result span of decimals (same size, might be the same as the input span)
+    */
+    static void Multiply(std::span<const Decimal> values, const Decimal& multiplier, std::span<Decimal> results);
+    //! Calculate the sum of the span of decimals
+    /*!
+        Throws DomainException on overflow.
+
+        \param values - Span of decimals
+        \return Sum of decimals
+    */
+    static Decimal Sum(std::span<const Decimal> values);
+
+    //! Output decimal into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const Decimal& value)
+    { char buffer[STRING_SIZE]; os.write(buffer, value.string(buffer, sizeof(buffer))); return os; }
+
+    //! Swap two instances
+    void swap(Decimal& value) noexcept;
+    friend void swap(Decimal& value1, Decimal& value2) noexcept
+    { value1.swap(value2); }
+
+private:
+    int64_t _value;
+
+    static Decimal Checked(bool success, int64_t raw);
+    static int64_t Divider(int64_t divider);
+};
+
+/*! \example math_decimal.cpp Fixed-point decimal example */
+
+} // namespace CppCommon
+
+#include "decimal.inl"
+
+#endif // CPPCOMMON_MATH_DECIMAL_H
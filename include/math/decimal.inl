@@ -0,0 +1,206 @@
+/*!
+    \file decimal.inl
+    \brief Fixed-point decimal type inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline bool DecimalAdd(int64_t value1, int64_t value2, int64_t& result) noexcept
+{
+    // Overflow happens if both operands have the sign different from the result
+    result = (int64_t)((uint64_t)value1 + (uint64_t)value2);
+    return ((value1 ^ result) & (value2 ^ result)) >= 0;
+}
+
+inline bool DecimalSubtract(int64_t value1, int64_t value2, int64_t& result) noexcept
+{
+    // Overflow happens if operands have different signs and the result sign differs from the first operand
+    result = (int64_t)((uint64_t)value1 - (uint64_t)value2);
+    return ((value1 ^ value2) & (value1 ^ result)) >= 0;
+}
+
+inline bool DecimalMulDiv(int64_t value, int64_t multiplier, int64_t divider, int64_t& result) noexcept
+{
+    const bool negative = ((value < 0) != (multiplier < 0)) != (divider < 0);
+    const uint64_t abs_value = (value < 0) ? (0 - (uint64_t)value) : (uint64_t)value;
+    const uint64_t abs_multiplier = (multiplier < 0) ? (0 - (uint64_t)multiplier) : (uint64_t)multiplier;
+    const uint64_t abs_divider = (divider < 0) ? (0 - (uint64_t)divider) : (uint64_t)divider;
+
+    // Rounding of the absolute value half up is the rounding half away from zero
+    uint64_t abs_result;
+    if (!Math::MulDivRound64(abs_value, abs_multiplier, abs_divider, abs_result))
+        return false;
+
+    const uint64_t limit = negative ? 0x8000000000000000ull : 0x7FFFFFFFFFFFFFFFull;
+    if (abs_result > limit)
+        return false;
+
+    result = negative ? (int64_t)(0 - abs_result) : (int64_t)abs_result;
+    return true;
+}
+
+} // namespace Internals
+//! @endcond
+
+template <unsigned Scale>
+inline Decimal<Scale>::Decimal(int64_t value)
+{
+    if (!Internals::DecimalMulDiv(value, FACTOR, 1, _value))
+        throwex DomainException("Decimal overflow!");
+}
+
+template <unsigned Scale>
+inline Decimal<Scale> Decimal<Scale>::FromDouble(double value)
+{
+    const double scaled = std::round(value * (double)FACTOR);
+
+    // Negated comparison also rejects NaN
+    if (!((scaled >= -9223372036854775808.0) && (scaled < 9223372036854775808.0)))
+        throwex DomainException("Decimal overflow!");
+
+    return FromRaw((int64_t)scaled);
+}
+
+template <unsigned Scale>
+template <unsigned OtherScale>
+inline Decimal<OtherScale> Decimal<Scale>::rescale() const
+{
+    int64_t result;
+    if (!Internals::DecimalMulDiv(_value, Decimal<OtherScale>::FACTOR, FACTOR, result))
+        throwex DomainException("Decimal overflow!");
+
+    return Decimal<OtherScale>::FromRaw(result);
+}
+
+template <unsigned Scale>
+inline Decimal<Scale> Decimal<Scale>::operator-() const
+{
+    int64_t result;
+    bool success = Internals::DecimalSubtract(0, _value, result);
+    return Checked(success, result);
+}
+
+template <unsigned Scale>
+inline std::string Decimal<Scale>::string() const
+{
+    char buffer[STRING_SIZE];
+    return std::string(buffer, string(buffer, sizeof(buffer)));
+}
+
+template <unsigned Scale>
+inline Decimal<Scale> Decimal<Scale>::Parse(std::string_view str)
+{
+    Decimal result;
+    if (!Parse(str, result))
+        throwex ArgumentException("Invalid decimal string: " + std::string(str));
+
+    return result;
+}
+
+template <unsigned Scale>
+inline void Decimal<Scale>::Add(std::span<const Decimal> values1, std::span<const Decimal> values2, std::span<Decimal> results)
+{
+    assert(((values1.size() == values2.size()) && (values1.size() == results.size())) && "Decimal spans must have the same size!");
+    if ((values1.size() != values2.size()) || (values1.size() != results.size()))
+        throwex ArgumentException("Decimal spans must have the same size!");
+
+    int64_t overflow = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const int64_t value1 = values1[i]._value;
+        const int64_t value2 = values2[i]._value;
+        const int64_t result = (int64_t)((uint64_t)value1 + (uint64_t)value2);
+        overflow |= (value1 ^ result) & (value2 ^ result);
+        results[i]._value = result;
+    }
+
+    if (overflow < 0)
+        throwex DomainException("Decimal overflow!");
+}
+
+template <unsigned Scale>
+inline void Decimal<Scale>::Subtract(std::span<const Decimal> values1, std::span<const Decimal> values2, std::span<Decimal> results)
+{
+    assert(((values1.size() == values2.size()) && (values1.size() == results.size())) && "Decimal spans must have the same size!");
+    if ((values1.size() != values2.size()) || (values1.size() != results.size()))
+        throwex ArgumentException("Decimal spans must have the same size!");
+
+    int64_t overflow = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const int64_t value1 = values1[i]._value;
+        const int64_t value2 = values2[i]._value;
+        const int64_t result = (int64_t)((uint64_t)value1 - (uint64_t)value2);
+        overflow |= (value1 ^ value2) & (value1 ^ result);
+        results[i]._value = result;
+    }
+
+    if (overflow < 0)
+        throwex DomainException("Decimal overflow!");
+}
+
+template <unsigned Scale>
+inline void Decimal<Scale>::Multiply(std::span<const Decimal> values, const Decimal& multiplier, std::span<Decimal> results)
+{
+    assert((values.size() == results.size()) && "Decimal spans must have the same size!");
+    if (values.size() != results.size())
+        throwex ArgumentException("Decimal spans must have the same size!");
+
+    bool success = true;
+    for (size_t i = 0; i < results.size(); ++i)
+        success &= Internals::DecimalMulDiv(values[i]._value, multiplier._value, FACTOR, results[i]._value);
+
+    if (!success)
+        throwex DomainException("Decimal overflow!");
+}
+
+template <unsigned Scale>
+inline Decimal<Scale> Decimal<Scale>::Sum(std::span<const Decimal> values)
+{
+    int64_t overflow = 0;
+    int64_t sum = 0;
+    for (const auto& value : values)
+    {
+        const int64_t result = (int64_t)((uint64_t)sum + (uint64_t)value._value);
+        overflow |= (sum ^ result) & (value._value ^ result);
+        sum = result;
+    }
+
+    if (overflow < 0)
+        throwex DomainException("Decimal overflow!");
+
+    return FromRaw(sum);
+}
+
+template <unsigned Scale>
+inline void Decimal<Scale>::swap(Decimal& value) noexcept
+{
+    using std::swap;
+    swap(_value, value._value);
+}
+
+template <unsigned Scale>
+inline Decimal<Scale> Decimal<Scale>::Checked(bool success, int64_t raw)
+{
+    if (!success)
+        throwex DomainException("Decimal overflow!");
+
+    return FromRaw(raw);
+}
+
+template <unsigned Scale>
+inline int64_t Decimal<Scale>::Divider(int64_t divider)
+{
+    if (divider == 0)
+        throwex DomainException("Division by zero!");
+
+    return divider;
+}
+
+} // namespace CppCommon
@@ -9,7 +9,13 @@
 #ifndef CPPCOMMON_MATH_MATH_H
 #define CPPCOMMON_MATH_MATH_H
 
+#include "common/uint128.h"
+
+#include <cassert>
 #include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
 
 namespace CppCommon {
 
@@ -17,6 +23,12 @@ namespace CppCommon {
 /*!
     Contains useful math functions.
 
+    Scalar functions are constexpr and use 64x64->128-bit multiply and
+    128/64-bit divide intrinsics at runtime. Batch functions process spans
+    of values with AVX2 / NEON kernels selected at runtime, so results of
+    floating-point batch functions might differ from the sequential scalar
+    loop in the last bits because of the different summation order.
+
     Thread-safe.
 */
 class Math
@@ -37,7 +49,7 @@ public:
         \return Greatest common divisor of a and b
     */
     template <typename T>
-    static T GCD(T a, T b);
+    static constexpr T GCD(T a, T b) noexcept;
 
     //! Finds the smallest value x >= a such that x % k == 0
     /*!
@@ -46,16 +58,100 @@ public:
         \return Value x
     */
     template <typename T>
-    static T RoundUp(T a, T k);
+    static constexpr T RoundUp(T a, T k) noexcept;
 
     //! Calculate (operant * multiplier / divider) with 64-bit unsigned integer values
     /*!
+        If the calculated value does not fit into 64 bits its lower 64 bits are returned.
+
         \param operant - Operant
         \param multiplier - Multiplier
-        \param divider - Divider
+        \param divider - Divider (must not be zero)
         \return Calculated value of (operant * multiplier / divider) expression
     */
-    static uint64_t MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider);
+    static constexpr uint64_t MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider) noexcept;
+    //! Calculate (operant * multiplier / divider) with 64-bit unsigned integer values rounded half up with overflow check
+    /*!
+        \param operant - Operant
+        \param multiplier - Multiplier
+        \param divider - Divider (must not be zero)
+        \param result - Calculated value of (operant * multiplier / divider) expression rounded half up
+        \return 'true' if the calculated value fits into 64 bits, 'false' on overflow
+    */
+    static constexpr bool MulDivRound64(uint64_t operant, uint64_t multiplier, uint64_t divider, uint64_t& result) noexcept;
+    //! Calculate (value * multiplier / divider) rounded half up for each value in the given span
+    /*!
+        Overflowed results are set to the maximal 64-bit value.
+
+        \param values - Span of values
+        \param multiplier - Multiplier
+        \param divider - Divider (must not be zero)
+        \param result - Span of calculated values (should have the same size as values, might be the same span)
+        \return 'true' if all calculated values fit into 64 bits, 'false' on any overflow
+    */
+    static bool MulDivRound64(std::span<const uint64_t> values, uint64_t multiplier, uint64_t divider, std::span<uint64_t> result) noexcept;
+
+    //! Calculate the sum of values
+    /*!
+        Integer sum wraps around on overflow.
+
+        \param values - Span of values
+        \return Sum of values
+    */
+    static int64_t Sum(std::span<const int64_t> values) noexcept;
+    //! Calculate the sum of values
+    /*!
+        \param values - Span of values
+        \return Sum of values
+    */
+    static double Sum(std::span<const double> values) noexcept;
+
+    //! Find minimal and maximal values
+    /*!
+        \param values - Span of values
+        \return Pair of minimal and maximal values or (max, lowest) pair of numeric limits for the empty span
+    */
+    static std::pair<int64_t, int64_t> MinMax(std::span<const int64_t> values) noexcept;
+    //! Find minimal and maximal values
+    /*!
+        NaN values are not supported.
+
+        \param values - Span of values
+        \return Pair of minimal and maximal values or (max, lowest) pair of numeric limits for the empty span
+    */
+    static std::pair<double, double> MinMax(std::span<const double> values) noexcept;
+
+    //! Calculate the dot product of two spans of values
+    /*!
+        Integer dot product wraps around on overflow.
+
+        \param values1 - Span of values 1
+        \param values2 - Span of values 2 (should have the same size as values 1)
+        \return Dot product of values
+    */
+    static int64_t Dot(std::span<const int64_t> values1, std::span<const int64_t> values2) noexcept;
+    //! Calculate the dot product of two spans of values
+    /*!
+        \param values1 - Span of values 1
+        \param values2 - Span of values 2 (should have the same size as values 1)
+        \return Dot product of values
+    */
+    static double Dot(std::span<const double> values1, std::span<const double> values2) noexcept;
+
+    //! Calculate the inclusive prefix sum of values
+    /*!
+        Integer prefix sum wraps around on overflow.
+
+        \param values - Span of values
+        \param result - Span of prefix sums (should have the same size as values, might be the same span)
+    */
+    static void PrefixSum(std::span<const int64_t> values, std::span<int64_t> result) noexcept;
+    //! Calculate the inclusive prefix sum of values
+    /*!
+        \param values - Span of values
+        \param result - Span of prefix sums (should have the same size as values, might be the same span)
+    */
+    static void PrefixSum(std::span<const double> values, std::span<double> result) noexcept;
 };
 
 /*! \example math_math.cpp Math example */
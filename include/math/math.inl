@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template <typename T>
-inline T GCD(T a, T b)
+constexpr T Math::GCD(T a, T b) noexcept
 {
     T c = a % b;
 
@@ -24,9 +24,46 @@ inline T GCD(T a, T b)
 }
 
 template <typename T>
-inline T Math::RoundUp(T a, T k)
+constexpr T Math::RoundUp(T a, T k) noexcept
 {
     return ((a + k - 1) / k) * k;
 }
 
+constexpr uint64_t Math::MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider) noexcept
+{
+    assert((divider != 0) && "Divider must not be zero!");
+
+    // Calculate the full 128-bit product
+    uint64_t upper = 0;
+    uint64_t lower = Internals::Multiply64(operant, multiplier, upper);
+
+    // Single 128/64-bit division gives the lower 64 bits of the quotient
+    uint64_t remainder = 0;
+    return Internals::Divide128(upper % divider, lower, divider, remainder);
+}
+
+constexpr bool Math::MulDivRound64(uint64_t operant, uint64_t multiplier, uint64_t divider, uint64_t& result) noexcept
+{
+    assert((divider != 0) && "Divider must not be zero!");
+    if (divider == 0)
+        return false;
+
+    // Calculate the full 128-bit product
+    uint64_t upper = 0;
+    uint64_t lower = Internals::Multiply64(operant, multiplier, upper);
+
+    // Add the half of the divider to round the quotient half up
+    const uint64_t half = divider / 2;
+    lower += half;
+    upper += (lower < half);
+
+    // The quotient fits into 64 bits only if the upper part is less than the divider
+    if (upper >= divider)
+        return false;
+
+    uint64_t remainder = 0;
+    result = Internals::Divide128(upper, lower, divider, remainder);
+    return true;
+}
+
 } // namespace CppCommon
@@ -95,6 +95,11 @@ public:
 
     //! Reset the allocator
     void reset() { _manager.reset(); }
+    //! Free all allocated memory blocks of the allocator at once
+    /*!
+        Requires the memory manager with free_all() method (e.g. arena or pool memory manager).
+    */
+    void free_all() { _manager.free_all(); }
 
     //! Constructs an element object on the given location pointer
     /*!
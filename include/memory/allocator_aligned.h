@@ -0,0 +1,187 @@
+/*!
+    \file allocator_aligned.h
+    \brief Aligned memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_ALIGNED_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_ALIGNED_H
+
+#include "allocator.h"
+#include "cache_padded.h"
+
+#include <algorithm>
+#include <new>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <malloc.h>
+#endif
+
+namespace CppCommon {
+
+//! Aligned memory manager class
+/*!
+    Aligned memory manager will allocate memory blocks in system heap aligned
+    at least to the given minimal alignment. It is useful for buffers which
+    require a strong alignment, e.g. sector aligned buffers of direct I/O or
+    page aligned buffers. Cache line (64 B), page (4 KB) and huge page (2 MB)
+    alignments are provided as constants, the last one allows the kernel to
+    back large buffers with transparent huge pages.
+    Windows: _aligned_malloc()/_aligned_free()
+    Unix: posix_memalign()/free()
+
+    Not thread-safe.
+*/
+class AlignedMemoryManager
+{
+public:
+    //! Cache line alignment (64)
+    static constexpr size_t CACHE_LINE_ALIGNMENT = 64;
+    //! Page alignment (4096)
+    static constexpr size_t PAGE_ALIGNMENT = 4096;
+    //! Huge page alignment (2097152)
+    static constexpr size_t HUGE_PAGE_ALIGNMENT = 2 * 1024 * 1024;
+    //! Default minimal alignment (4096)
+    static constexpr size_t DEFAULT_ALIGNMENT = PAGE_ALIGNMENT;
+
+    //! Initialize aligned memory manager
+    /*!
+        \param alignment - Minimal alignment of allocated memory blocks (default is AlignedMemoryManager::DEFAULT_ALIGNMENT)
+    */
+    explicit AlignedMemoryManager(size_t alignment = DEFAULT_ALIGNMENT) noexcept : _allocated(0), _allocations(0), _alignment(std::max(alignment, alignof(std::max_align_t)))
+    {
+        assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+    }
+    AlignedMemoryManager(const AlignedMemoryManager&) = delete;
+    AlignedMemoryManager(AlignedMemoryManager&&) = delete;
+    ~AlignedMemoryManager() noexcept { reset(); }
+
+    AlignedMemoryManager& operator=(const AlignedMemoryManager&) = delete;
+    AlignedMemoryManager& operator=(AlignedMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Minimal alignment of allocated memory blocks
+    size_t alignment() const noexcept { return _alignment; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return std::numeric_limits<size_t>::max(); }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        Memory block is aligned to the greatest of the given alignment and
+        the minimal alignment of the memory manager.
+
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Minimal alignment
+    size_t _alignment;
+};
+
+//! Aligned memory allocator class
+template <typename T, bool nothrow = false>
+using AlignedAllocator = Allocator<T, AlignedMemoryManager, nothrow>;
+
+//! Cache aligned memory allocator class
+/*!
+    Cache aligned memory allocator is a stateless STL compatible allocator
+    which allocates memory blocks in system heap aligned to the given
+    alignment (default is the destructive interference size). It does not
+    require a memory manager instance, so it could be used as a default
+    allocator of containers which bucket arrays should start on cache line
+    boundaries (e.g. SIMD probed hash map tags).
+
+    Thread-safe.
+*/
+template <typename T, size_t Alignment = hardware_destructive_interference_size>
+class CacheAlignedAllocator
+{
+    static_assert(((Alignment & (Alignment - 1)) == 0), "Alignment must be a power of two!");
+
+public:
+    //! Element type
+    typedef T value_type;
+    //! Pointer to element
+    typedef T* pointer;
+    //! Reference to element
+    typedef T& reference;
+    //! Pointer to constant element
+    typedef const T* const_pointer;
+    //! Reference to constant element
+    typedef const T& const_reference;
+    //! Quantities of elements
+    typedef size_t size_type;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+    //! Stateless allocators are always equal
+    typedef std::true_type is_always_equal;
+
+    //! Memory alignment
+    static constexpr size_t alignment = std::max(Alignment, alignof(T));
+
+    CacheAlignedAllocator() noexcept = default;
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U, Alignment>&) noexcept {}
+
+    //! Allocate a block of storage suitable to contain the given count of elements
+    /*!
+        \param num - Number of elements to be allocated
+        \return A pointer to the initial element in the block of storage
+    */
+    pointer allocate(size_type num)
+    {
+        if (num > (std::numeric_limits<size_type>::max() / sizeof(T)))
+            throw std::bad_array_new_length();
+        return (pointer)::operator new(num * sizeof(T), std::align_val_t(alignment));
+    }
+    //! Release a block of storage previously allocated
+    /*!
+        \param ptr - Pointer to a block of storage
+        \param num - Number of releasing elements
+    */
+    void deallocate(pointer ptr, size_type num) noexcept
+    {
+        ::operator delete(ptr, num * sizeof(T), std::align_val_t(alignment));
+    }
+
+    //! Allocator rebind
+    template <typename U>
+    struct rebind
+    {
+        typedef CacheAlignedAllocator<U, Alignment> other;
+    };
+
+    template <typename U>
+    friend bool operator==(const CacheAlignedAllocator&, const CacheAlignedAllocator<U, Alignment>&) noexcept { return true; }
+    template <typename U>
+    friend bool operator!=(const CacheAlignedAllocator&, const CacheAlignedAllocator<U, Alignment>&) noexcept { return false; }
+};
+
+} // namespace CppCommon
+
+#include "allocator_aligned.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_ALIGNED_H
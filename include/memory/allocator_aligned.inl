@@ -0,0 +1,58 @@
+/*!
+    \file allocator_aligned.inl
+    \brief Aligned memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void* AlignedMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    alignment = std::max(alignment, _alignment);
+
+#if defined(_WIN32) || defined(_WIN64)
+    void* result = _aligned_malloc(size, alignment);
+#else
+    void* result = nullptr;
+    if (posix_memalign(&result, alignment, size) != 0)
+        result = nullptr;
+#endif
+    if (result != nullptr)
+    {
+        // Update allocation statistics
+        _allocated += size;
+        ++_allocations;
+    }
+    return result;
+}
+
+inline void AlignedMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+    }
+}
+
+inline void AlignedMemoryManager::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
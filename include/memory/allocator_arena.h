@@ -22,13 +22,31 @@ namespace CppCommon {
 
     Arena memory manager is suitable for multiple allocations during long
     operations with a single reset at the end (e.g. HTTP request processing).
+    Nested phases of the operation could drop their temporary allocations
+    with savepoints (mark() / rollback() or ArenaScope), so arena pages are
+    reused by the next phase without growing.
 
     Not thread-safe.
 */
 template <class TAuxMemoryManager = DefaultMemoryManager>
 class ArenaMemoryManager
 {
+    struct Page;
+
 public:
+    //! Arena savepoint
+    struct Mark
+    {
+    private:
+        friend class ArenaMemoryManager;
+
+        Page* page;
+        size_t size;
+        size_t reserved;
+        size_t allocated;
+        size_t allocations;
+    };
+
     //! Initialize arena memory manager with an auxiliary memory manager
     /*!
         Arena page capacity will be 65536.
@@ -88,6 +106,37 @@ public:
     */
     void free(void* ptr, size_t size);
 
+    //! Get the savepoint of the current arena state
+    Mark mark() const noexcept;
+    //! Rollback the arena to the given savepoint
+    /*!
+        Drops all allocations made after the savepoint. Arena pages allocated
+        after the savepoint are kept to be reused by next allocations. Any
+        pointers to memory blocks allocated after the savepoint become invalid
+        and destructors of allocated objects are not called. Allocation statistics
+        are restored to the savepoint values.
+
+        Savepoints must be rolled back in the reverse order (nested phases).
+        Memory blocks of the external arena buffer allocated from the auxiliary
+        memory manager after the savepoint (in case of the arena buffer overflow)
+        must be freed before.
+
+        \param mark - Arena savepoint
+    */
+    void rollback(const Mark& mark);
+
+    //! Free all allocated memory blocks at once
+    /*!
+        Drops all active allocations and resets the memory manager. Any pointers
+        to the previously allocated memory blocks become invalid. Destructors of
+        allocated objects are not called, so it is suitable for bulk clear of
+        trivially destructible objects.
+
+        Memory blocks of the external arena buffer allocated from the auxiliary
+        memory manager (in case of the arena buffer overflow) must be freed before.
+    */
+    void free_all();
+
     //! Reset the memory manager
     void reset();
     //! Reset the memory manager with a given page capacity
@@ -124,6 +173,7 @@ private:
 
     // Arena pages
     Page* _current;
+    Page* _spare;
     size_t _reserved;
 
     // External buffer
@@ -138,6 +188,39 @@ private:
     void ClearArena();
 };
 
+//! Arena scope class
+/*!
+    Arena scope takes the arena savepoint on construction and rolls the arena
+    back on destruction, so all allocations made within the scope are dropped.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ArenaScope
+{
+public:
+    //! Take the savepoint of the given arena memory manager
+    /*!
+        \param arena - Arena memory manager
+    */
+    explicit ArenaScope(ArenaMemoryManager<TAuxMemoryManager>& arena) noexcept : _arena(arena), _mark(arena.mark()) {}
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ~ArenaScope() { _arena.rollback(_mark); }
+
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+
+    //! Arena memory manager
+    ArenaMemoryManager<TAuxMemoryManager>& arena() noexcept { return _arena; }
+    //! Arena savepoint
+    const typename ArenaMemoryManager<TAuxMemoryManager>::Mark& mark() const noexcept { return _mark; }
+
+private:
+    ArenaMemoryManager<TAuxMemoryManager>& _arena;
+    typename ArenaMemoryManager<TAuxMemoryManager>::Mark _mark;
+};
+
 //! Arena memory allocator class
 template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
 using ArenaAllocator = Allocator<T, ArenaMemoryManager<TAuxMemoryManager>, nothrow>;
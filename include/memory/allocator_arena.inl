@@ -14,6 +14,7 @@ inline ArenaMemoryManager<TAuxMemoryManager>::ArenaMemoryManager(TAuxMemoryManag
       _allocations(0),
       _auxiliary(auxiliary),
       _current(nullptr),
+      _spare(nullptr),
       _reserved(0),
       _external(false),
       _buffer(nullptr),
@@ -29,6 +30,7 @@ inline ArenaMemoryManager<TAuxMemoryManager>::ArenaMemoryManager(TAuxMemoryManag
       _allocations(0),
       _auxiliary(auxiliary),
       _current(nullptr),
+      _spare(nullptr),
       _reserved(0),
       _external(true),
       _buffer(nullptr),
@@ -100,6 +102,39 @@ inline void* ArenaMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t a
             }
         }
 
+        // Reuse the spare arena page left after the rollback
+        while (_spare != nullptr)
+        {
+            Page* spare = _spare;
+            _spare = spare->prev;
+
+            // Release too small spare arena page
+            if ((size + alignment) > spare->capacity)
+            {
+                _auxiliary.free(spare, sizeof(Page) + spare->capacity + alignof(std::max_align_t));
+                continue;
+            }
+
+            // Update the current arena page
+            spare->size = 0;
+            spare->prev = _current;
+            _current = spare;
+
+            // Allocate memory from the current arena page
+            uint8_t* buffer = _current->buffer + _current->size;
+            uint8_t* aligned = Memory::Align(buffer, alignment);
+            size_t aligned_size = size + (aligned - buffer);
+
+            // Memory allocated
+            _current->size += aligned_size;
+
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+
+            return aligned;
+        }
+
         // Increase the required reserved memory size
         size_t next_reserved = 2 * _reserved;
         while (next_reserved < size)
@@ -158,6 +193,63 @@ inline void ArenaMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
     --_allocations;
 }
 
+template <class TAuxMemoryManager>
+inline typename ArenaMemoryManager<TAuxMemoryManager>::Mark ArenaMemoryManager<TAuxMemoryManager>::mark() const noexcept
+{
+    Mark result;
+    result.page = _current;
+    result.size = _external ? _size : ((_current != nullptr) ? _current->size : 0);
+    result.reserved = _reserved;
+    result.allocated = _allocated;
+    result.allocations = _allocations;
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void ArenaMemoryManager<TAuxMemoryManager>::rollback(const Mark& mark)
+{
+    if (_external)
+    {
+        assert((_reserved == mark.reserved) && "Auxiliary memory blocks of the external arena buffer cannot be rolled back!");
+        assert((mark.size <= _size) && "Arena savepoints must be rolled back in the reverse order!");
+
+        _size = mark.size;
+    }
+    else
+    {
+        // Keep arena pages allocated after the savepoint as spare ones
+        while ((_current != nullptr) && (_current != mark.page))
+        {
+            Page* prev = _current->prev;
+            _current->prev = _spare;
+            _spare = _current;
+            _current = prev;
+        }
+
+        assert((_current == mark.page) && "Arena savepoints must be rolled back in the reverse order!");
+        assert(((_current == nullptr) || (mark.size <= _current->size)) && "Arena savepoints must be rolled back in the reverse order!");
+
+        if (_current != nullptr)
+            _current->size = mark.size;
+    }
+
+    // Restore allocation statistics
+    _allocated = mark.allocated;
+    _allocations = mark.allocations;
+}
+
+template <class TAuxMemoryManager>
+inline void ArenaMemoryManager<TAuxMemoryManager>::free_all()
+{
+    assert((!_external || (_reserved == _capacity)) && "Auxiliary memory blocks of the external arena buffer cannot be freed at once!");
+
+    // Drop allocation statistics of all allocated blocks
+    _allocated = 0;
+    _allocations = 0;
+
+    reset();
+}
+
 template <class TAuxMemoryManager>
 inline void ArenaMemoryManager<TAuxMemoryManager>::reset()
 {
@@ -261,6 +353,14 @@ inline void ArenaMemoryManager<TAuxMemoryManager>::ClearArena()
             _auxiliary.free(_current, sizeof(Page) + _current->capacity + alignof(std::max_align_t));
             _current = prev;
         }
+
+        // Clear all spare arena pages
+        while (_spare != nullptr)
+        {
+            Page* prev = _spare->prev;
+            _auxiliary.free(_spare, sizeof(Page) + _spare->capacity + alignof(std::max_align_t));
+            _spare = prev;
+        }
     }
 }
 
@@ -0,0 +1,104 @@
+/*!
+    \file allocator_huge_page.h
+    \brief Huge page memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_HUGE_PAGE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_HUGE_PAGE_H
+
+#include "allocator.h"
+
+namespace CppCommon {
+
+//! Huge page memory manager class
+/*!
+    Huge page memory manager maps memory blocks directly from the operating
+    system with huge pages to reduce TLB misses of big memory regions:
+    \li Linux: mmap() with MAP_HUGETLB, falls back to the huge page aligned
+        mapping with madvise(MADV_HUGEPAGE) for transparent huge pages;
+    \li Windows: VirtualAlloc() with MEM_LARGE_PAGES (requires the
+        SeLockMemoryPrivilege), falls back to regular pages;
+    \li Other platforms: mmap() with regular pages.
+
+    Memory blocks could be optionally bound to the given NUMA node (mbind()
+    on Linux, VirtualAllocExNuma() on Windows). NUMA binding is a best effort
+    and is ignored if it is not supported by the system.
+
+    Each memory block is rounded up to the huge page size, so huge page memory
+    manager is designed to be an auxiliary memory manager for arena or pool
+    memory managers configured with page sizes multiple of the huge page size.
+
+    Not thread-safe.
+*/
+class HugePageMemoryManager
+{
+public:
+    //! Initialize huge page memory manager
+    /*!
+        \param node - NUMA node to bind memory blocks. Negative value means no binding (default is -1)
+    */
+    explicit HugePageMemoryManager(int node = -1) noexcept : _allocated(0), _allocations(0), _node(node) {}
+    HugePageMemoryManager(const HugePageMemoryManager&) = delete;
+    HugePageMemoryManager(HugePageMemoryManager&&) = delete;
+    ~HugePageMemoryManager() noexcept { reset(); }
+
+    HugePageMemoryManager& operator=(const HugePageMemoryManager&) = delete;
+    HugePageMemoryManager& operator=(HugePageMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! NUMA node to bind memory blocks
+    int node() const noexcept { return _node; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return std::numeric_limits<size_t>::max(); }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        Memory block is aligned to the huge page size, so the given alignment
+        must not be greater than the huge page size.
+
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+    //! Get the system huge page size in bytes
+    static size_t HugePageSize();
+    //! Get the count of system NUMA nodes
+    static int NumaNodes();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // NUMA node
+    int _node;
+};
+
+//! Huge page memory allocator class
+template <typename T, bool nothrow = false>
+using HugePageAllocator = Allocator<T, HugePageMemoryManager, nothrow>;
+
+/*! \example memory_huge_page.cpp Huge page memory allocator example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_HUGE_PAGE_H
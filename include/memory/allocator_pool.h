@@ -90,6 +90,19 @@ public:
     */
     void free(void* ptr, size_t size);
 
+    //! Free all allocated memory blocks at once
+    /*!
+        Drops all active allocations and resets the memory manager. Any pointers
+        to the previously allocated memory blocks become invalid. Destructors of
+        allocated objects are not called, so it is suitable for bulk clear of
+        trivially destructible objects. Allocated memory pool pages are kept for
+        further allocations.
+
+        Huge memory blocks allocated directly from the auxiliary memory manager
+        must be freed before.
+    */
+    void free_all();
+
     //! Reset the memory manager
     void reset();
     //! Reset the memory manager with a given signle page size and max pages count
@@ -146,6 +159,10 @@ private:
     // Free block
     FreeBlock* _free_block;
 
+    //! Is the block of the given size too huge to fit into the pool page with its header?
+    bool IsHugeBlock(size_t size) const noexcept
+    { return (size + sizeof(AllocBlock) + alignof(std::max_align_t)) > _page; }
+
     //! Calculate the align adjustment of the given buffer
     size_t AlignAdjustment(const void* address, size_t alignment);
     //! Calculate the align adjustment of the given buffer with header
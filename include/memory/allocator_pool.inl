@@ -45,7 +45,7 @@ inline void* PoolMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t al
     assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
 
     // Allocate huge blocks using the auxiliary memory manager
-    if (size > _page)
+    if (IsHugeBlock(size))
     {
         void* result = _auxiliary.malloc(size, alignment);
         if (result != nullptr)
@@ -204,7 +204,7 @@ inline void PoolMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
     assert((ptr != nullptr) && "Deallocated block must be valid!");
 
     // Deallocate huge blocks using the auxiliary memory manager
-    if (size > _page)
+    if (IsHugeBlock(size))
     {
         _auxiliary.free(ptr, size);
 
@@ -251,6 +251,20 @@ inline void PoolMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
     --_allocations;
 }
 
+template <class TAuxMemoryManager>
+inline void PoolMemoryManager<TAuxMemoryManager>::free_all()
+{
+    // Drop allocation statistics of all allocated blocks
+    _allocated = 0;
+    _allocations = 0;
+
+    // External memory pool buffer starts with its single page
+    if (_external)
+        reset(_current, _page);
+    else
+        reset();
+}
+
 template <class TAuxMemoryManager>
 inline void PoolMemoryManager<TAuxMemoryManager>::reset()
 {
@@ -0,0 +1,258 @@
+/*!
+    \file allocator_profiling.h
+    \brief Profiling memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_PROFILING_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_PROFILING_H
+
+#include "allocator.h"
+#include "containers/integer_hashmap.h"
+#include "system/stack_trace.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+//! Not inlined function attribute
+/*!
+    Keeps the function as a real stack frame, so the count of frames to skip
+    in the captured stack trace does not depend on the optimization level.
+*/
+#if defined(_MSC_VER)
+#define PROFILING_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+#define PROFILING_NOINLINE __attribute__((noinline))
+#else
+#define PROFILING_NOINLINE
+#endif
+
+namespace CppCommon {
+
+//! Allocation profiler
+/*!
+    Allocation profiler samples allocations with the mean sampling interval
+    given in bytes (Poisson sampling of allocated bytes), so big allocations
+    are sampled more often than small ones. Each sampled allocation captures
+    stack frames addresses without symbols resolving and aggregates them by
+    the allocation callsite. Estimated statistics of each callsite are scaled
+    by the inverse probability of sampling:
+    \li live allocations and bytes;
+    \li total allocations and bytes (churn);
+    \li size histogram of power of two size buckets.
+
+    Symbols of callsites are resolved only on report.
+
+    Not thread-safe.
+*/
+class AllocationProfiler
+{
+public:
+    //! Count of power of two size histogram buckets
+    static const size_t HISTOGRAM = 32;
+
+    //! Allocation callsite
+    struct Callsite
+    {
+        std::vector<void*> frames;          //!< Callsite stack frames addresses
+        uint64_t samples;                   //!< Count of sampled allocations
+        uint64_t allocations;               //!< Estimated count of allocations
+        uint64_t bytes;                     //!< Estimated allocated bytes
+        uint64_t live_allocations;          //!< Estimated count of live allocations
+        uint64_t live_bytes;                //!< Estimated live bytes
+        std::array<uint64_t, HISTOGRAM> histogram; //!< Estimated count of allocations in (2^(i-1), 2^i] size buckets
+
+        Callsite() : samples(0), allocations(0), bytes(0), live_allocations(0), live_bytes(0), histogram{} {}
+
+        //! Resolve the callsite stack trace
+        StackTrace stack() const { return StackTrace(frames.data(), (int)frames.size()); }
+    };
+
+    //! Initialize allocation profiler
+    /*!
+        \param rate - Mean sampling interval in bytes (default is 524288)
+        \param depth - Max depth of captured stack traces (default is 32)
+    */
+    explicit AllocationProfiler(size_t rate = 524288, size_t depth = 32);
+    AllocationProfiler(const AllocationProfiler&) = delete;
+    AllocationProfiler(AllocationProfiler&&) = delete;
+    ~AllocationProfiler() = default;
+
+    AllocationProfiler& operator=(const AllocationProfiler&) = delete;
+    AllocationProfiler& operator=(AllocationProfiler&&) = delete;
+
+    //! Mean sampling interval in bytes
+    size_t rate() const noexcept { return _rate; }
+    //! Max depth of captured stack traces
+    size_t depth() const noexcept { return _depth; }
+
+    //! Count of sampled allocations
+    size_t samples() const noexcept { return _samples; }
+    //! Count of live sampled allocations
+    size_t tracked() const noexcept { return _tracked.size(); }
+
+    //! Should the allocation of the given size be sampled?
+    /*!
+        Fast path: the allocation is sampled when the sampling interval
+        countdown is exhausted.
+
+        \param size - Allocation size
+        \return 'true' if the allocation should be recorded, 'false' otherwise
+    */
+    bool sample(size_t size) noexcept;
+    //! Is the given memory block possibly tracked?
+    /*!
+        Fast path of the counting filter to skip untracked memory blocks on free.
+
+        \param ptr - Pointer to the memory block
+        \return 'true' if the memory block may be tracked, 'false' if not
+    */
+    bool tracked(const void* ptr) const noexcept { return _filter[Filter(ptr)] != 0; }
+
+    //! Record the sampled allocation
+    /*!
+        \param ptr - Pointer to the allocated memory block
+        \param size - Allocation size
+        \param skip - Skip frames count (default is 0)
+    */
+    void record(void* ptr, size_t size, int skip = 0);
+    //! Release the tracked allocation
+    /*!
+        \param ptr - Pointer to the memory block
+        \return 'true' if the memory block was tracked, 'false' otherwise
+    */
+    bool release(void* ptr);
+
+    //! Get profiled callsites sorted by estimated live bytes, then by estimated allocated bytes
+    std::vector<Callsite> callsites() const;
+
+    //! Get the text report of the top profiled callsites
+    /*!
+        \param top - Count of callsites in the report (default is 10)
+        \return Text report
+    */
+    std::string report(size_t top = 10) const;
+
+    //! Clear all profiled callsites
+    void clear();
+
+private:
+    static const size_t FILTER = 1024;
+
+    // Tracked allocation
+    struct Tracked
+    {
+        size_t callsite;
+        size_t size;
+        uint64_t weight;
+    };
+
+    size_t _rate;
+    size_t _depth;
+    size_t _samples;
+    size_t _countdown;
+    uint64_t _random;
+
+    std::vector<Callsite> _callsites;
+    IntegerHashMap<uint64_t, size_t> _index;
+    IntegerHashMap<uintptr_t, Tracked> _tracked;
+    std::array<uint32_t, FILTER> _filter;
+
+    //! Get the counting filter bucket of the given pointer
+    static size_t Filter(const void* ptr) noexcept
+    { return (size_t)(((uint64_t)(uintptr_t)ptr * 0x9E3779B97F4A7C15ull) >> 54); }
+
+    //! Get the next random sampling interval
+    size_t NextInterval() noexcept;
+};
+
+//! Profiling memory manager class
+/*!
+    Profiling memory manager wraps the auxiliary memory manager and profiles
+    sampled allocations with the allocation profiler. Not sampled allocations
+    pay only for the sampling countdown on malloc and the counting filter
+    check on free.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ProfilingMemoryManager
+{
+public:
+    //! Initialize profiling memory manager with an auxiliary memory manager
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param rate - Mean sampling interval in bytes (default is 524288)
+        \param depth - Max depth of captured stack traces (default is 32)
+    */
+    explicit ProfilingMemoryManager(TAuxMemoryManager& auxiliary, size_t rate = 524288, size_t depth = 32)
+        : _allocated(0), _allocations(0), _auxiliary(auxiliary), _profiler(rate, depth)
+    {}
+    ProfilingMemoryManager(const ProfilingMemoryManager&) = delete;
+    ProfilingMemoryManager(ProfilingMemoryManager&&) = delete;
+    ~ProfilingMemoryManager() { reset(); }
+
+    ProfilingMemoryManager& operator=(const ProfilingMemoryManager&) = delete;
+    ProfilingMemoryManager& operator=(ProfilingMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+    //! Allocation profiler
+    AllocationProfiler& profiler() noexcept { return _profiler; }
+    //! Allocation profiler
+    const AllocationProfiler& profiler() const noexcept { return _profiler; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        Never inlined, so the allocation profiler skips exactly one stack frame
+        to reach the allocation callsite with any optimization level.
+
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    PROFILING_NOINLINE void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    PROFILING_NOINLINE void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+
+    // Allocation profiler
+    AllocationProfiler _profiler;
+};
+
+//! Profiling memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ProfilingAllocator = Allocator<T, ProfilingMemoryManager<TAuxMemoryManager>, nothrow>;
+
+/*! \example memory_profiling.cpp Profiling memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_profiling.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_PROFILING_H
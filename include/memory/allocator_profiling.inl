@@ -0,0 +1,67 @@
+/*!
+    \file allocator_profiling.inl
+    \brief Profiling memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool AllocationProfiler::sample(size_t size) noexcept
+{
+    if (size < _countdown)
+    {
+        _countdown -= size;
+        return false;
+    }
+    return true;
+}
+
+template <class TAuxMemoryManager>
+void* ProfilingMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    void* result = _auxiliary.malloc(size, alignment);
+    if (result != nullptr)
+    {
+        // Record the sampled allocation
+        if (_profiler.sample(size))
+            _profiler.record(result, size, 1);
+
+        // Update allocation statistics
+        _allocated += size;
+        ++_allocations;
+    }
+    return result;
+}
+
+template <class TAuxMemoryManager>
+void ProfilingMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        // Release the tracked allocation
+        if (_profiler.tracked(ptr))
+            _profiler.release(ptr);
+
+        _auxiliary.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void ProfilingMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
@@ -0,0 +1,181 @@
+/*!
+    \file allocator_scratch.h
+    \brief Thread-local scratch memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SCRATCH_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SCRATCH_H
+
+#include "allocator_arena.h"
+
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Thread-local scratch arena
+/*!
+    Scratch arena is the arena memory manager of the current thread for
+    temporary allocations of the current task (request, message, frame),
+    so the arena does not need to be passed through every call layer.
+    Temporary allocations are made within scratch scopes (ScratchScope)
+    with the scratch allocator (ScratchAllocator) and are dropped at once
+    when the scope is left. Arena pages are kept for the next task, so the
+    steady state task processing does not touch the global heap.
+
+    Scratch arena is created on the first use and freed when the thread
+    exits.
+
+    Not thread-safe, but each thread has its own scratch arena.
+*/
+class ScratchArena
+{
+public:
+    ScratchArena() = delete;
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena(ScratchArena&&) = delete;
+    ~ScratchArena() = delete;
+
+    ScratchArena& operator=(const ScratchArena&) = delete;
+    ScratchArena& operator=(ScratchArena&&) = delete;
+
+    //! Scratch arena page capacity in bytes
+    static const size_t PAGE_CAPACITY = 65536;
+
+    //! Get the scratch arena of the current thread
+    static ArenaMemoryManager<>& Current();
+
+    //! Get the count of active scratch scopes of the current thread
+    static size_t depth() noexcept;
+
+    //! Free all arena pages of the current thread
+    /*!
+        Could be called outside of scratch scopes only (e.g. by the idle
+        worker thread to return memory after the load peak).
+    */
+    static void Reset();
+
+private:
+    friend class ScratchScope;
+
+    struct State;
+    static State& state();
+};
+
+//! Scratch scope class
+/*!
+    Scratch scope takes the savepoint of the current thread scratch arena on
+    construction and rolls the arena back on destruction, so all scratch
+    allocations made within the scope are dropped at once. Scopes could be
+    nested, the outermost scope resets the arena for the next task.
+
+    Containers with the scratch allocator must be destroyed before the scope
+    is left. Destructors of objects allocated within the scope are not called
+    by the rollback.
+
+    Not thread-safe.
+*/
+class ScratchScope
+{
+public:
+    //! Take the savepoint of the current thread scratch arena
+    ScratchScope();
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope(ScratchScope&&) = delete;
+    ~ScratchScope();
+
+    ScratchScope& operator=(const ScratchScope&) = delete;
+    ScratchScope& operator=(ScratchScope&&) = delete;
+
+    //! Scratch arena memory manager
+    ArenaMemoryManager<>& arena() noexcept { return _scope.arena(); }
+
+private:
+    ArenaScope<> _scope;
+};
+
+//! Scratch memory allocator class
+/*!
+    Scratch allocator allocates memory from the scratch arena of the thread
+    which has constructed it, so containers for temporaries could use it
+    without passing any memory manager (e.g. std::vector<int, ScratchAllocator<int>>
+    or SmallVector<int, 16, ScratchAllocator<int>>). Deallocation is free,
+    memory is dropped when the current scratch scope is left.
+
+    Should be constructed within the scratch scope.
+
+    Not thread-safe.
+*/
+template <typename T>
+class ScratchAllocator
+{
+    template <typename U>
+    friend class ScratchAllocator;
+
+public:
+    //! Element type
+    typedef T value_type;
+    //! Pointer to element
+    typedef T* pointer;
+    //! Reference to element
+    typedef T& reference;
+    //! Pointer to constant element
+    typedef const T* const_pointer;
+    //! Reference to constant element
+    typedef const T& const_reference;
+    //! Quantities of elements
+    typedef size_t size_type;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+
+    //! Initialize allocator with the current thread scratch arena
+    ScratchAllocator() : _arena(&ScratchArena::Current()) {}
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>& alloc) noexcept : _arena(alloc._arena) {}
+
+    //! Scratch arena memory manager
+    ArenaMemoryManager<>& arena() const noexcept { return *_arena; }
+
+    //! Get the maximum number of elements, that could potentially be allocated by the allocator
+    size_type max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+    //! Allocate a block of storage suitable to contain the given count of elements
+    /*!
+        \param num - Number of elements to be allocated
+        \return A pointer to the initial element in the block of storage
+    */
+    pointer allocate(size_type num);
+    //! Release a block of storage previously allocated
+    /*!
+        \param ptr - Pointer to a block of storage
+        \param num - Number of releasing elements
+    */
+    void deallocate(pointer ptr, size_type num) noexcept { _arena->free(ptr, num * sizeof(T)); }
+
+    //! Allocator rebind
+    template <typename U>
+    struct rebind
+    {
+        typedef ScratchAllocator<U> other;
+    };
+
+    template <typename U>
+    friend bool operator==(const ScratchAllocator& alloc1, const ScratchAllocator<U>& alloc2) noexcept { return alloc1._arena == alloc2._arena; }
+    template <typename U>
+    friend bool operator!=(const ScratchAllocator& alloc1, const ScratchAllocator<U>& alloc2) noexcept { return alloc1._arena != alloc2._arena; }
+
+private:
+    ArenaMemoryManager<>* _arena;
+};
+
+/*! \example memory_scratch.cpp Thread-local scratch memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_scratch.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SCRATCH_H
@@ -0,0 +1,71 @@
+/*!
+    \file allocator_scratch.inl
+    \brief Thread-local scratch memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+struct ScratchArena::State
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<> arena;
+    size_t depth;
+
+    State() : arena(auxiliary, PAGE_CAPACITY), depth(0) {}
+};
+//! @endcond
+
+inline ScratchArena::State& ScratchArena::state()
+{
+    thread_local State state;
+    return state;
+}
+
+inline ArenaMemoryManager<>& ScratchArena::Current()
+{
+    return state().arena;
+}
+
+inline size_t ScratchArena::depth() noexcept
+{
+    return state().depth;
+}
+
+inline void ScratchArena::Reset()
+{
+    State& current = state();
+    assert((current.depth == 0) && "Scratch arena cannot be reset within the scratch scope!");
+
+    current.arena.reset(PAGE_CAPACITY);
+}
+
+inline ScratchScope::ScratchScope() : _scope(ScratchArena::Current())
+{
+    ++ScratchArena::state().depth;
+}
+
+inline ScratchScope::~ScratchScope()
+{
+    --ScratchArena::state().depth;
+}
+
+template <typename T>
+inline T* ScratchAllocator<T>::allocate(size_type num)
+{
+    assert((ScratchArena::depth() > 0) && "Scratch memory must be allocated within the scratch scope!");
+
+    if (num > max_size())
+        throw std::bad_array_new_length();
+
+    void* result = _arena->malloc(num * sizeof(T), alignof(T));
+    if (result == nullptr)
+        throw std::bad_alloc();
+
+    return (T*)result;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,167 @@
+/*!
+    \file allocator_shared.h
+    \brief Shared memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
+
+#include "allocator.h"
+#include "system/shared_memory.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Shared memory heap header
+/*!
+    Shared memory heap header is placed at the beginning of the shared memory
+    region and keeps all allocation state as offsets relative to itself, so
+    the heap is position-independent and shared between processes.
+*/
+struct SharedHeap
+{
+    uint64_t magic;                     // Shared heap magic
+    std::atomic<uint32_t> state;        // Shared heap state (0 - empty, 1 - formatting, 2 - ready)
+    std::atomic<uint32_t> lock;         // Shared heap spin lock
+    uint64_t capacity;                  // Shared heap capacity in bytes
+    std::atomic<uint64_t> allocated;    // Allocated memory in bytes
+    std::atomic<uint64_t> allocations;  // Count of active memory allocations
+    std::atomic<uint64_t> available;    // Free memory in bytes
+    std::atomic<uint64_t> root;         // Offset of the root object (0 - no root object)
+    uint64_t head;                      // Offset of the first free block sorted by offsets (0 - no free blocks)
+
+    //! Format a new or attach to the existing shared heap
+    static SharedHeap* Attach(void* buffer, size_t capacity);
+
+    uint8_t* base() noexcept { return (uint8_t*)this; }
+    const uint8_t* base() const noexcept { return (const uint8_t*)this; }
+
+    void* malloc(size_t size, size_t alignment);
+    void free(void* ptr, size_t size);
+
+private:
+    void lock_heap() noexcept;
+    void unlock_heap() noexcept;
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Shared memory manager class
+/*!
+    Shared memory manager allocates memory blocks in the shared memory region
+    (e.g. SharedMemory block). All allocator state is kept in the region
+    itself as offsets, so several processes could allocate and free memory
+    blocks in the same region even if they map it at different addresses.
+
+    The first process formats the region, other processes attach to the
+    existing heap. Memory blocks are allocated with the first-fit policy
+    from the free list sorted by offsets, freed blocks are coalesced with
+    their neighbours.
+
+    Returned pointers are valid only in the current process. Objects placed
+    in the shared region must refer to each other with OffsetPtr or with
+    offsets (see offset() and pointer() methods). The root object could be
+    registered to find the shared data structure in other processes.
+
+    Allocations are serialized by the spin lock inside the region, so the
+    process must not crash while allocating or freeing memory blocks.
+
+    Thread-safe.
+*/
+class SharedMemoryManager
+{
+public:
+    //! Initialize shared memory manager with a given shared memory block
+    /*!
+        \param shared - Shared memory block
+    */
+    explicit SharedMemoryManager(SharedMemory& shared) : SharedMemoryManager(shared.ptr(), shared.size()) {}
+    //! Initialize shared memory manager with a given memory region
+    /*!
+        \param buffer - Shared memory region
+        \param capacity - Shared memory region capacity
+    */
+    explicit SharedMemoryManager(void* buffer, size_t capacity) : _heap(Internals::SharedHeap::Attach(buffer, capacity)) {}
+    SharedMemoryManager(const SharedMemoryManager&) = delete;
+    SharedMemoryManager(SharedMemoryManager&&) = delete;
+    ~SharedMemoryManager() noexcept = default;
+
+    SharedMemoryManager& operator=(const SharedMemoryManager&) = delete;
+    SharedMemoryManager& operator=(SharedMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes (by all processes)
+    size_t allocated() const noexcept { return (size_t)_heap->allocated.load(std::memory_order_relaxed); }
+    //! Count of active memory allocations (by all processes)
+    size_t allocations() const noexcept { return (size_t)_heap->allocations.load(std::memory_order_relaxed); }
+
+    //! Shared memory region
+    const uint8_t* buffer() const noexcept { return _heap->base(); }
+    //! Shared memory region capacity
+    size_t capacity() const noexcept { return (size_t)_heap->capacity; }
+    //! Free memory in bytes
+    size_t available() const noexcept { return (size_t)_heap->available.load(std::memory_order_relaxed); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return capacity(); }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t)) { return _heap->malloc(size, alignment); }
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size) { _heap->free(ptr, size); }
+
+    //! Reset the memory manager
+    /*!
+        Memory blocks could be still used by other processes, so reset
+        does nothing.
+    */
+    void reset() {}
+
+    //! Get the root object of the shared memory region
+    /*!
+        \return Pointer to the root object or nullptr if the root object is not registered
+    */
+    void* root() const noexcept { uint64_t root = _heap->root.load(std::memory_order_acquire); return (root != 0) ? pointer(root) : nullptr; }
+    //! Register the root object of the shared memory region
+    /*!
+        \param ptr - Pointer to the root object allocated in the shared memory region (nullptr to unregister)
+    */
+    void set_root(void* ptr) noexcept { _heap->root.store((ptr != nullptr) ? offset(ptr) : 0, std::memory_order_release); }
+
+    //! Convert the pointer into the shared memory region to the offset
+    uint64_t offset(const void* ptr) const noexcept { return (uint64_t)((const uint8_t*)ptr - _heap->base()); }
+    //! Convert the offset in the shared memory region to the pointer
+    void* pointer(uint64_t offset) const noexcept { return _heap->base() + offset; }
+
+    //! Get the shared memory heap
+    Internals::SharedHeap* heap() const noexcept { return _heap; }
+
+private:
+    Internals::SharedHeap* _heap;
+};
+
+//! Shared memory allocator class
+template <typename T, bool nothrow = false>
+using SharedAllocator = Allocator<T, SharedMemoryManager, nothrow>;
+
+/*! \example memory_shared.cpp Shared memory allocator example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
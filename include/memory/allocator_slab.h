@@ -0,0 +1,181 @@
+/*!
+    \file allocator_slab.h
+    \brief Slab memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
+
+#include "allocator.h"
+#include "containers/integer_hashmap.h"
+
+namespace CppCommon {
+
+//! Slab memory manager class
+/*!
+    Slab memory manager serves mixed small allocations with random lifetimes
+    from segregated size classes. Each size class keeps a list of slabs of
+    the same size blocks allocated from the auxiliary memory manager. Free
+    blocks of the slab are tracked with the slab bitmap, so there are no
+    per-block headers at all: the freed block is mapped to its slab with the
+    index of slab addresses.
+
+    Small blocks (up to 1024 bytes) are rounded up to one of size classes
+    (16 bytes steps up to 128 bytes, then 4 size classes for each power of
+    two). Huge blocks are allocated directly from the auxiliary memory manager.
+
+    Each size class keeps at most one empty slab to avoid trashing on the
+    boundary. Other empty slabs are returned to the auxiliary memory manager.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class SlabMemoryManager
+{
+public:
+    //! Initialize slab memory manager with an auxiliary memory manager
+    /*!
+        Slab size will be 65536.
+
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit SlabMemoryManager(TAuxMemoryManager& auxiliary) : SlabMemoryManager(auxiliary, 65536) {}
+    //! Initialize slab memory manager with an auxiliary memory manager and a given slab size
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param slab - Slab size in bytes (power of two from 4096)
+    */
+    explicit SlabMemoryManager(TAuxMemoryManager& auxiliary, size_t slab);
+    SlabMemoryManager(const SlabMemoryManager&) = delete;
+    SlabMemoryManager(SlabMemoryManager&&) = delete;
+    ~SlabMemoryManager() { clear(); }
+
+    SlabMemoryManager& operator=(const SlabMemoryManager&) = delete;
+    SlabMemoryManager& operator=(SlabMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Slab size in bytes
+    size_t slab() const noexcept { return _slab; }
+    //! Count of allocated slabs
+    size_t slabs() const noexcept { return _index.size(); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Free all allocated memory blocks at once
+    /*!
+        Drops all active small blocks allocations and returns all slabs to the
+        auxiliary memory manager. Any pointers to the previously allocated small
+        memory blocks become invalid. Destructors of allocated objects are not
+        called, so it is suitable for bulk clear of trivially destructible objects.
+
+        Huge memory blocks allocated directly from the auxiliary memory manager
+        must be freed before.
+    */
+    void free_all();
+
+    //! Reset the memory manager
+    void reset();
+    //! Reset the memory manager with a given slab size
+    /*!
+        \param slab - Slab size in bytes (power of two from 4096)
+    */
+    void reset(size_t slab);
+
+    //! Clear all slabs
+    void clear();
+
+private:
+    static constexpr size_t MAX_SIZE = 1024;
+    static constexpr size_t CLASSES = 20;
+
+    // Slab header placed at the beginning of the slab memory
+    struct Slab
+    {
+        uint8_t* data;          // The first block of the slab
+        Slab* prev;             // Previous slab in the partial slabs list
+        Slab* next;             // Next slab in the partial slabs list
+        uint32_t size_class;    // Size class index
+        uint32_t size;          // Block size
+        uint32_t reciprocal;    // Block size reciprocal to find the block index without division
+        uint32_t count;         // Count of blocks
+        uint32_t free;          // Count of free blocks
+        uint32_t first;         // The first bitmap word which could contain free blocks
+        uint32_t words;         // Count of bitmap words
+
+        uint64_t* bitmap() noexcept { return (uint64_t*)(this + 1); }
+    };
+
+    // Size class slabs
+    struct SizeClass
+    {
+        Slab* partial;          // List of slabs with free blocks
+        size_t empty;           // Count of empty slabs in the partial list
+    };
+
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+
+    // Slabs
+    size_t _slab;
+    size_t _shift;
+    SizeClass _classes[CLASSES];
+    IntegerHashMap<uintptr_t, Slab*> _index;
+
+    //! Get the size class index of the given block size
+    static size_t GetSizeClass(size_t size) noexcept;
+    //! Get the block size of the given size class index
+    static size_t GetClassSize(size_t index) noexcept;
+
+    //! Allocate a new slab of the given size class
+    Slab* AllocateSlab(size_t index);
+    //! Release the empty slab
+    void ReleaseSlab(Slab* slab);
+    //! Find the slab of the given memory block
+    Slab* FindSlab(const void* ptr) const noexcept;
+
+    //! Link the slab into the partial slabs list
+    void LinkSlab(Slab* slab) noexcept;
+    //! Unlink the slab from the partial slabs list
+    void UnlinkSlab(Slab* slab) noexcept;
+};
+
+//! Slab memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using SlabAllocator = Allocator<T, SlabMemoryManager<TAuxMemoryManager>, nothrow>;
+
+/*! \example memory_slab.cpp Slab memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_slab.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
@@ -0,0 +1,303 @@
+/*!
+    \file allocator_slab.inl
+    \brief Slab memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include <bit>
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline SlabMemoryManager<TAuxMemoryManager>::SlabMemoryManager(TAuxMemoryManager& auxiliary, size_t slab)
+    : _allocated(0),
+      _allocations(0),
+      _auxiliary(auxiliary),
+      _slab(0),
+      _shift(0),
+      _classes{}
+{
+    reset(slab);
+}
+
+template <class TAuxMemoryManager>
+inline size_t SlabMemoryManager<TAuxMemoryManager>::GetSizeClass(size_t size) noexcept
+{
+    // 16 bytes steps up to 128 bytes, then 4 size classes for each power of two
+    if (size <= 128)
+        return ((size + 15) >> 4) - 1;
+
+    size_t power = std::bit_width(size - 1);
+    return 8 + (power - 8) * 4 + ((size - 1 - ((size_t)1 << (power - 1))) >> (power - 3));
+}
+
+template <class TAuxMemoryManager>
+inline size_t SlabMemoryManager<TAuxMemoryManager>::GetClassSize(size_t index) noexcept
+{
+    if (index < 8)
+        return (index + 1) << 4;
+
+    size_t group = (index - 8) >> 2;
+    return ((size_t)128 << group) + ((((index - 8) & 3) + 1) << (5 + group));
+}
+
+template <class TAuxMemoryManager>
+inline void* SlabMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Power of two size classes are aligned by their size within the slab
+    size_t block = size;
+    if ((alignment > alignof(std::max_align_t)) && (size <= MAX_SIZE))
+    {
+        block = std::bit_ceil(std::max(size, alignment));
+        if (block > MAX_SIZE)
+        {
+            assert(false && "Alignment of small blocks must not be greater than the max small block size!");
+            return nullptr;
+        }
+    }
+
+    // Allocate huge blocks using the auxiliary memory manager
+    if (size > MAX_SIZE)
+    {
+        void* result = _auxiliary.malloc(size, alignment);
+        if (result != nullptr)
+        {
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+        }
+        return result;
+    }
+
+    size_t index = GetSizeClass(block);
+    SizeClass& size_class = _classes[index];
+
+    Slab* slab = size_class.partial;
+    if (slab == nullptr)
+    {
+        slab = AllocateSlab(index);
+        if (slab == nullptr)
+            return nullptr;
+    }
+
+    // The empty slab becomes used
+    if (slab->free == slab->count)
+        --size_class.empty;
+
+    // Find the first free block in the slab bitmap
+    uint64_t* bitmap = slab->bitmap();
+    size_t word = slab->first;
+    while (bitmap[word] == 0)
+        ++word;
+    size_t bit = std::countr_zero(bitmap[word]);
+    bitmap[word] &= bitmap[word] - 1;
+    slab->first = (uint32_t)word;
+
+    // The full slab leaves the partial slabs list
+    if (--slab->free == 0)
+        UnlinkSlab(slab);
+
+    // Update allocation statistics
+    _allocated += size;
+    ++_allocations;
+
+    return slab->data + (word * 64 + bit) * slab->size;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr == nullptr)
+        return;
+
+    // Update allocation statistics
+    _allocated -= size;
+    --_allocations;
+
+    // Free huge blocks using the auxiliary memory manager
+    if (size > MAX_SIZE)
+    {
+        _auxiliary.free(ptr, size);
+        return;
+    }
+
+    Slab* slab = FindSlab(ptr);
+    assert((slab != nullptr) && "Deallocated block must be allocated by the slab memory manager!");
+    if (slab == nullptr)
+        return;
+
+    // Find the block index with the reciprocal multiplication instead of the division
+    size_t offset = (uint8_t*)ptr - slab->data;
+    size_t index = (size_t)(((uint64_t)offset * slab->reciprocal) >> 32);
+    size_t word = index / 64;
+    uint64_t mask = (uint64_t)1 << (index % 64);
+
+    uint64_t* bitmap = slab->bitmap();
+    assert(((bitmap[word] & mask) == 0) && "Deallocated block must not be freed twice!");
+    bitmap[word] |= mask;
+    if (word < slab->first)
+        slab->first = (uint32_t)word;
+
+    // The full slab returns into the partial slabs list
+    if (slab->free++ == 0)
+        LinkSlab(slab);
+
+    // Keep only one empty slab for each size class
+    if (slab->free == slab->count)
+    {
+        SizeClass& size_class = _classes[slab->size_class];
+        if (size_class.empty > 0)
+            ReleaseSlab(slab);
+        else
+            ++size_class.empty;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::free_all()
+{
+    clear();
+
+    // Reset allocation statistics
+    _allocated = 0;
+    _allocations = 0;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    clear();
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::reset(size_t slab)
+{
+    assert((slab >= 4096) && std::has_single_bit(slab) && "Slab size must be a power of two not less than 4096!");
+
+    reset();
+
+    _slab = std::bit_ceil(std::max(slab, (size_t)4096));
+    _shift = std::countr_zero(_slab);
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::clear()
+{
+    // Release all slabs
+    for (auto it = _index.begin(); it != _index.end(); ++it)
+        _auxiliary.free(it.value(), _slab);
+    _index.clear();
+
+    for (auto& size_class : _classes)
+        size_class = SizeClass{};
+}
+
+template <class TAuxMemoryManager>
+inline typename SlabMemoryManager<TAuxMemoryManager>::Slab* SlabMemoryManager<TAuxMemoryManager>::AllocateSlab(size_t index)
+{
+    uint8_t* memory = (uint8_t*)_auxiliary.malloc(_slab, alignof(std::max_align_t));
+    if (memory == nullptr)
+        return nullptr;
+
+    // Blocks are aligned by the lowest power of two of their size
+    size_t size = GetClassSize(index);
+    size_t alignment = std::min(size & (0 - size), (size_t)4096);
+
+    // Layout the slab header, the bitmap and blocks
+    size_t count = (_slab - sizeof(Slab)) / size;
+    size_t words = (count + 63) / 64;
+    uint8_t* data = Memory::Align(memory + sizeof(Slab) + words * sizeof(uint64_t), alignment);
+    count = (memory + _slab - data) / size;
+    words = (count + 63) / 64;
+
+    Slab* slab = (Slab*)memory;
+    slab->data = data;
+    slab->prev = nullptr;
+    slab->next = nullptr;
+    slab->size_class = (uint32_t)index;
+    slab->size = (uint32_t)size;
+    slab->reciprocal = (uint32_t)((((uint64_t)1 << 32) + size - 1) / size);
+    slab->count = (uint32_t)count;
+    slab->free = (uint32_t)count;
+    slab->first = 0;
+    slab->words = (uint32_t)words;
+
+    // All blocks are free
+    uint64_t* bitmap = slab->bitmap();
+    for (size_t i = 0; i < words; ++i)
+        bitmap[i] = ~(uint64_t)0;
+    if ((count % 64) != 0)
+        bitmap[words - 1] = ((uint64_t)1 << (count % 64)) - 1;
+
+    // Index the slab by its start window
+    _index[(uintptr_t)memory >> _shift] = slab;
+
+    LinkSlab(slab);
+    ++_classes[index].empty;
+    return slab;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::ReleaseSlab(Slab* slab)
+{
+    UnlinkSlab(slab);
+    _index.erase((uintptr_t)slab >> _shift);
+    _auxiliary.free(slab, _slab);
+}
+
+template <class TAuxMemoryManager>
+inline typename SlabMemoryManager<TAuxMemoryManager>::Slab* SlabMemoryManager<TAuxMemoryManager>::FindSlab(const void* ptr) const noexcept
+{
+    // Slabs do not overlap, so each window contains at most one slab start.
+    // The block belongs either to the slab started in its window or to the
+    // slab started in the previous window.
+    uintptr_t address = (uintptr_t)ptr;
+    uintptr_t window = address >> _shift;
+
+    auto it = _index.find(window);
+    if ((it != _index.end()) && ((uintptr_t)it.value() <= address))
+        return it.value();
+
+    it = _index.find(window - 1);
+    if ((it != _index.end()) && (((uintptr_t)it.value() + _slab) > address))
+        return it.value();
+
+    return nullptr;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::LinkSlab(Slab* slab) noexcept
+{
+    SizeClass& size_class = _classes[slab->size_class];
+    slab->prev = nullptr;
+    slab->next = size_class.partial;
+    if (size_class.partial != nullptr)
+        size_class.partial->prev = slab;
+    size_class.partial = slab;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::UnlinkSlab(Slab* slab) noexcept
+{
+    SizeClass& size_class = _classes[slab->size_class];
+    if (slab->prev != nullptr)
+        slab->prev->next = slab->next;
+    else
+        size_class.partial = slab->next;
+    if (slab->next != nullptr)
+        slab->next->prev = slab->prev;
+    slab->prev = nullptr;
+    slab->next = nullptr;
+}
+
+} // namespace CppCommon
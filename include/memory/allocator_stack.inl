@@ -30,8 +30,8 @@ inline void* StackMemoryManager<N>::malloc(size_t size, size_t alignment)
     // Check if there is enough free space to allocate the block
     if ((size + (aligned - buffer)) <= (_capacity - _size))
     {
-        // Memory allocated
-        _size += size;
+        // Memory allocated (including the alignment padding)
+        _size += size + (aligned - buffer);
 
         // Update allocation statistics
         _allocated += size;
@@ -0,0 +1,282 @@
+/*!
+    \file allocator_thread_cache.h
+    \brief Thread cache memory allocator definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_THREAD_CACHE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_THREAD_CACHE_H
+
+#include "allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Registry of thread caches of the current thread
+/*!
+    Keeps thread caches of all thread cache memory managers used by the
+    current thread and detaches them when the thread exits.
+*/
+class ThreadCacheRegistry
+{
+public:
+    //! Get the registry of the current thread
+    static ThreadCacheRegistry& current() noexcept
+    {
+        thread_local ThreadCacheRegistry registry;
+        return registry;
+    }
+
+    //! Find the thread cache of the memory manager with the given unique Id
+    void* find(uint64_t id) noexcept
+    {
+        if (id == _last_id)
+            return _last_cache;
+
+        for (const auto& entry : _entries)
+        {
+            if (entry.id == id)
+            {
+                _last_id = entry.id;
+                _last_cache = entry.cache;
+                return entry.cache;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //! Register the thread cache of the memory manager with the given unique Id
+    void insert(uint64_t id, void* cache, bool (*alive)(void*), void (*detach)(void*))
+    {
+        // Detach thread caches of destroyed memory managers
+        for (auto it = _entries.begin(); it != _entries.end();)
+        {
+            if (!it->alive(it->cache))
+            {
+                if (it->id == _last_id)
+                {
+                    _last_id = 0;
+                    _last_cache = nullptr;
+                }
+                it->detach(it->cache);
+                it = _entries.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        _entries.push_back({ id, cache, alive, detach });
+        _last_id = id;
+        _last_cache = cache;
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t id;
+        void* cache;
+        bool (*alive)(void*);
+        void (*detach)(void*);
+    };
+
+    uint64_t _last_id{0};
+    void* _last_cache{nullptr};
+    std::vector<Entry> _entries;
+
+    ThreadCacheRegistry() = default;
+    ~ThreadCacheRegistry()
+    {
+        for (const auto& entry : _entries)
+            entry.detach(entry.cache);
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Thread cache memory manager class
+/*!
+    Thread cache memory manager is a thread-safe front-end for a single-threaded
+    central memory manager (e.g. pool memory manager) designed in tcmalloc style.
+
+    Small blocks (up to 2048 bytes) are rounded up to one of size classes and
+    are served from per-thread free lists without any synchronization. Empty
+    thread free list is refilled with a batch of blocks from the shared central
+    free list or from a new span of 64 KB carved from the central memory
+    manager. Thread free list which grows over the given capacity drains a batch
+    of blocks back to the shared central free list. Only batch transfers and
+    span allocations lock the central memory manager.
+
+    Each span remembers the thread cache which carved it. A block freed by
+    another thread is returned into the owner thread cache with a lock-free
+    push, so producer/consumer threads do not contend on the central lock.
+
+    Huge blocks are allocated from the central memory manager under the lock.
+    Alignment of small blocks greater than 16 bytes is supported up to the
+    maximal small block size.
+
+    Thread cache of the exited thread keeps its cached blocks and is adopted
+    by the next new thread. All memory is returned to the central memory
+    manager when the thread cache memory manager is reset or destroyed.
+
+    Thread-safe.
+*/
+template <class TCentralMemoryManager = DefaultMemoryManager>
+class ThreadCacheMemoryManager
+{
+public:
+    //! Initialize thread cache memory manager with a central memory manager
+    /*!
+        \param central - Central memory manager
+        \param batch - Count of blocks transferred between thread and central free lists (default is 32)
+        \param capacity - Max count of cached blocks of each size class in the thread free list (default is 128)
+    */
+    explicit ThreadCacheMemoryManager(TCentralMemoryManager& central, size_t batch = 32, size_t capacity = 128);
+    ThreadCacheMemoryManager(const ThreadCacheMemoryManager&) = delete;
+    ThreadCacheMemoryManager(ThreadCacheMemoryManager&&) = delete;
+    ~ThreadCacheMemoryManager();
+
+    ThreadCacheMemoryManager& operator=(const ThreadCacheMemoryManager&) = delete;
+    ThreadCacheMemoryManager& operator=(ThreadCacheMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept;
+    //! Count of active memory allocations
+    size_t allocations() const noexcept;
+
+    //! Count of blocks transferred between thread and central free lists
+    size_t batch() const noexcept { return _batch; }
+    //! Max count of cached blocks of each size class in the thread free list
+    size_t capacity() const noexcept { return _capacity; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _central.max_size(); }
+
+    //! Central memory manager
+    TCentralMemoryManager& central() noexcept { return _central; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    /*!
+        Drops all cached blocks of all threads and returns all spans to the
+        central memory manager. Must be called when there are no active small
+        blocks allocations and other threads do not use the memory manager.
+    */
+    void reset();
+
+private:
+    static constexpr size_t SPAN = 65536;
+    static constexpr size_t SEGMENT_SPANS = 16;
+    static constexpr size_t MAX_SIZE = 2048;
+    static constexpr size_t CLASSES = 24;
+
+    // Free block
+    struct FreeBlock
+    {
+        FreeBlock* next;
+        FreeBlock* batch;
+    };
+
+    // Thread free list of the size class
+    struct FreeList
+    {
+        FreeBlock* head;
+        size_t count;
+        uint8_t* bump;
+        uint8_t* bump_end;
+    };
+
+    // Thread cache
+    struct alignas(64) Cache
+    {
+        std::atomic<bool> alive{true};
+        std::atomic<bool> abandoned{false};
+        std::atomic<int> references{2};
+        std::atomic<size_t> allocated{0};
+        std::atomic<size_t> allocations{0};
+        FreeList lists[CLASSES]{};
+        alignas(64) std::atomic<FreeBlock*> remote[CLASSES]{};
+    };
+
+    // Span header placed at the end of the span
+    struct SpanHeader
+    {
+        Cache* owner;
+        size_t size_class;
+    };
+
+    // Unique Id of the memory manager
+    uint64_t _id;
+
+    // Central memory manager
+    TCentralMemoryManager& _central;
+    mutable std::mutex _lock;
+
+    // Allocation statistics of huge blocks
+    size_t _allocated;
+    size_t _allocations;
+
+    // Thread cache settings
+    size_t _batch;
+    size_t _capacity;
+
+    // Thread caches
+    std::vector<Cache*> _caches;
+    // Central free lists of blocks batches
+    FreeBlock* _batches[CLASSES];
+    // Allocated segments and free spans
+    std::vector<void*> _segments;
+    std::vector<uint8_t*> _spans;
+
+    //! Get the size class index of the given block size
+    static size_t SizeClass(size_t size) noexcept;
+    //! Get the block size of the given size class index
+    static size_t ClassSize(size_t index) noexcept;
+
+    //! Get the thread cache of the current thread
+    Cache* GetCache();
+    //! Refill the empty thread free list
+    bool Refill(Cache* cache, size_t index);
+    //! Drain the batch of blocks from the thread free list into the central free list
+    void Drain(Cache* cache, size_t index);
+    //! Release all spans and segments
+    void Release();
+
+    static bool IsAlive(void* cache) noexcept;
+    static void Detach(void* cache) noexcept;
+};
+
+//! Thread cache memory allocator class
+template <typename T, class TCentralMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ThreadCacheAllocator = Allocator<T, ThreadCacheMemoryManager<TCentralMemoryManager>, nothrow>;
+
+/*! \example memory_thread_cache.cpp Thread cache memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_thread_cache.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_THREAD_CACHE_H
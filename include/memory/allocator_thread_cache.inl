@@ -0,0 +1,374 @@
+/*!
+    \file allocator_thread_cache.inl
+    \brief Thread cache memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include <bit>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Generate the unique Id of the thread cache memory manager
+inline uint64_t ThreadCacheId() noexcept
+{
+    static std::atomic<uint64_t> id(0);
+    return ++id;
+}
+
+} // namespace Internals
+//! @endcond
+
+template <class TCentralMemoryManager>
+inline ThreadCacheMemoryManager<TCentralMemoryManager>::ThreadCacheMemoryManager(TCentralMemoryManager& central, size_t batch, size_t capacity)
+    : _id(Internals::ThreadCacheId()),
+      _central(central),
+      _allocated(0),
+      _allocations(0),
+      _batch(batch),
+      _capacity(capacity),
+      _batches{}
+{
+    assert((batch > 0) && "Thread cache batch must be greater than zero!");
+    assert((capacity >= batch) && "Thread cache capacity must not be less than batch!");
+}
+
+template <class TCentralMemoryManager>
+inline ThreadCacheMemoryManager<TCentralMemoryManager>::~ThreadCacheMemoryManager()
+{
+    Release();
+
+    // Release thread caches. Registries of alive threads detach them later.
+    for (auto cache : _caches)
+    {
+        cache->alive.store(false, std::memory_order_release);
+        Detach(cache);
+    }
+
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+template <class TCentralMemoryManager>
+inline size_t ThreadCacheMemoryManager<TCentralMemoryManager>::allocated() const noexcept
+{
+    std::scoped_lock locker(_lock);
+
+    // Wrapped per-thread counters sum to the right value
+    size_t result = _allocated;
+    for (auto cache : _caches)
+        result += cache->allocated.load(std::memory_order_relaxed);
+    return result;
+}
+
+template <class TCentralMemoryManager>
+inline size_t ThreadCacheMemoryManager<TCentralMemoryManager>::allocations() const noexcept
+{
+    std::scoped_lock locker(_lock);
+
+    // Wrapped per-thread counters sum to the right value
+    size_t result = _allocations;
+    for (auto cache : _caches)
+        result += cache->allocations.load(std::memory_order_relaxed);
+    return result;
+}
+
+template <class TCentralMemoryManager>
+inline size_t ThreadCacheMemoryManager<TCentralMemoryManager>::SizeClass(size_t size) noexcept
+{
+    // 16 bytes steps up to 128 bytes, then 4 size classes for each power of two
+    if (size <= 128)
+        return ((size + 15) >> 4) - 1;
+
+    size_t power = std::bit_width(size - 1);
+    return 8 + (power - 8) * 4 + ((size - 1 - ((size_t)1 << (power - 1))) >> (power - 3));
+}
+
+template <class TCentralMemoryManager>
+inline size_t ThreadCacheMemoryManager<TCentralMemoryManager>::ClassSize(size_t index) noexcept
+{
+    if (index < 8)
+        return (index + 1) << 4;
+
+    size_t group = (index - 8) >> 2;
+    return ((size_t)128 << group) + ((((index - 8) & 3) + 1) << (5 + group));
+}
+
+template <class TCentralMemoryManager>
+inline void* ThreadCacheMemoryManager<TCentralMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Allocate huge blocks using the central memory manager
+    if (size > MAX_SIZE)
+    {
+        std::scoped_lock locker(_lock);
+
+        void* result = _central.malloc(size, alignment);
+        if (result != nullptr)
+        {
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+        }
+        return result;
+    }
+
+    // Power of two size classes are aligned by their size within the span
+    size_t block = size;
+    if (alignment > alignof(std::max_align_t))
+    {
+        block = std::bit_ceil(std::max(size, alignment));
+        if (block > MAX_SIZE)
+        {
+            assert(false && "Alignment of small blocks must not be greater than the max small block size!");
+            return nullptr;
+        }
+    }
+
+    Cache* cache = GetCache();
+    size_t index = SizeClass(block);
+    FreeList& list = cache->lists[index];
+
+    // Refill the empty thread free list
+    if ((list.head == nullptr) && !Refill(cache, index))
+        return nullptr;
+
+    FreeBlock* result = list.head;
+    list.head = result->next;
+    --list.count;
+
+    // Update allocation statistics of the current thread
+    cache->allocated.store(cache->allocated.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+    cache->allocations.store(cache->allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    return result;
+}
+
+template <class TCentralMemoryManager>
+inline void ThreadCacheMemoryManager<TCentralMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr == nullptr)
+        return;
+
+    // Free huge blocks using the central memory manager
+    if (size > MAX_SIZE)
+    {
+        std::scoped_lock locker(_lock);
+
+        _central.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+        return;
+    }
+
+    Cache* cache = GetCache();
+    SpanHeader* span = (SpanHeader*)(((uintptr_t)ptr & ~(uintptr_t)(SPAN - 1)) + SPAN - sizeof(SpanHeader));
+    size_t index = span->size_class;
+    FreeBlock* block = (FreeBlock*)ptr;
+
+    // Update allocation statistics of the current thread
+    cache->allocated.store(cache->allocated.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+    cache->allocations.store(cache->allocations.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+    if (span->owner == cache)
+    {
+        // Push the block into the thread free list
+        FreeList& list = cache->lists[index];
+        block->next = list.head;
+        list.head = block;
+        if (++list.count > _capacity)
+            Drain(cache, index);
+    }
+    else
+    {
+        // Return the block into the owner thread cache with the lock-free push
+        std::atomic<FreeBlock*>& remote = span->owner->remote[index];
+        block->next = remote.load(std::memory_order_relaxed);
+        while (!remote.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed));
+    }
+}
+
+template <class TCentralMemoryManager>
+inline void ThreadCacheMemoryManager<TCentralMemoryManager>::reset()
+{
+    std::scoped_lock locker(_lock);
+
+    Release();
+
+    for (auto cache : _caches)
+    {
+        for (size_t i = 0; i < CLASSES; ++i)
+        {
+            cache->lists[i] = FreeList{};
+            cache->remote[i].store(nullptr, std::memory_order_relaxed);
+        }
+        cache->allocated.store(0, std::memory_order_relaxed);
+        cache->allocations.store(0, std::memory_order_relaxed);
+    }
+}
+
+template <class TCentralMemoryManager>
+inline typename ThreadCacheMemoryManager<TCentralMemoryManager>::Cache* ThreadCacheMemoryManager<TCentralMemoryManager>::GetCache()
+{
+    Internals::ThreadCacheRegistry& registry = Internals::ThreadCacheRegistry::current();
+
+    Cache* cache = (Cache*)registry.find(_id);
+    if (cache != nullptr)
+        return cache;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Adopt the thread cache of the exited thread
+        for (auto abandoned : _caches)
+        {
+            bool expected = true;
+            if (abandoned->abandoned.compare_exchange_strong(expected, false, std::memory_order_acq_rel))
+            {
+                abandoned->references.fetch_add(1, std::memory_order_relaxed);
+                cache = abandoned;
+                break;
+            }
+        }
+
+        // Create a new thread cache
+        if (cache == nullptr)
+        {
+            _caches.reserve(_caches.size() + 1);
+            cache = new Cache();
+            _caches.push_back(cache);
+        }
+    }
+
+    registry.insert(_id, cache, IsAlive, Detach);
+    return cache;
+}
+
+template <class TCentralMemoryManager>
+inline bool ThreadCacheMemoryManager<TCentralMemoryManager>::Refill(Cache* cache, size_t index)
+{
+    FreeList& list = cache->lists[index];
+
+    // Take blocks returned by other threads
+    FreeBlock* remote = cache->remote[index].exchange(nullptr, std::memory_order_acquire);
+    if (remote != nullptr)
+    {
+        list.head = remote;
+        list.count = 0;
+        for (FreeBlock* block = remote; block != nullptr; block = block->next)
+            ++list.count;
+        return true;
+    }
+
+    size_t size = ClassSize(index);
+
+    if (list.bump == list.bump_end)
+    {
+        std::scoped_lock locker(_lock);
+
+        // Take the batch of blocks from the central free list
+        if (_batches[index] != nullptr)
+        {
+            list.head = _batches[index];
+            list.count = _batch;
+            _batches[index] = list.head->batch;
+            return true;
+        }
+
+        // Allocate a new segment of spans
+        if (_spans.empty())
+        {
+            void* segment = _central.malloc((SEGMENT_SPANS + 1) * SPAN, SPAN);
+            if (segment == nullptr)
+                return false;
+            _segments.push_back(segment);
+
+            uint8_t* base = (uint8_t*)(((uintptr_t)segment + SPAN - 1) & ~(uintptr_t)(SPAN - 1));
+            for (size_t i = SEGMENT_SPANS; i-- > 0;)
+                _spans.push_back(base + i * SPAN);
+        }
+
+        // Carve a new span owned by the current thread cache
+        uint8_t* span = _spans.back();
+        _spans.pop_back();
+
+        SpanHeader* header = (SpanHeader*)(span + SPAN - sizeof(SpanHeader));
+        header->owner = cache;
+        header->size_class = index;
+
+        list.bump = span;
+        list.bump_end = span + ((SPAN - sizeof(SpanHeader)) / size) * size;
+    }
+
+    // Carve the batch of blocks from the current span
+    size_t count = std::min(_batch, (size_t)(list.bump_end - list.bump) / size);
+    for (size_t i = 0; i < count; ++i)
+    {
+        FreeBlock* block = (FreeBlock*)(list.bump + (count - i - 1) * size);
+        block->next = list.head;
+        list.head = block;
+    }
+    list.bump += count * size;
+    list.count = count;
+    return true;
+}
+
+template <class TCentralMemoryManager>
+inline void ThreadCacheMemoryManager<TCentralMemoryManager>::Drain(Cache* cache, size_t index)
+{
+    FreeList& list = cache->lists[index];
+
+    // Cut the batch of blocks from the thread free list
+    FreeBlock* first = list.head;
+    FreeBlock* last = first;
+    for (size_t i = 1; i < _batch; ++i)
+        last = last->next;
+    list.head = last->next;
+    list.count -= _batch;
+    last->next = nullptr;
+
+    // Push the batch into the central free list
+    std::scoped_lock locker(_lock);
+    first->batch = _batches[index];
+    _batches[index] = first;
+}
+
+template <class TCentralMemoryManager>
+inline void ThreadCacheMemoryManager<TCentralMemoryManager>::Release()
+{
+    for (auto segment : _segments)
+        _central.free(segment, (SEGMENT_SPANS + 1) * SPAN);
+    _segments.clear();
+    _spans.clear();
+
+    for (size_t i = 0; i < CLASSES; ++i)
+        _batches[i] = nullptr;
+}
+
+template <class TCentralMemoryManager>
+inline bool ThreadCacheMemoryManager<TCentralMemoryManager>::IsAlive(void* cache) noexcept
+{
+    return ((Cache*)cache)->alive.load(std::memory_order_acquire);
+}
+
+template <class TCentralMemoryManager>
+inline void ThreadCacheMemoryManager<TCentralMemoryManager>::Detach(void* cache) noexcept
+{
+    // The last of the memory manager and the owner thread deletes the thread cache
+    Cache* instance = (Cache*)cache;
+    instance->abandoned.store(true, std::memory_order_release);
+    if (instance->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete instance;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,74 @@
+/*!
+    \file cache_padded.h
+    \brief Cache line padding definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_CACHE_PADDED_H
+#define CPPCOMMON_MEMORY_CACHE_PADDED_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Minimal offset between two objects to avoid false sharing
+/*!
+    std::hardware_destructive_interference_size depends on the compiler
+    tuning flags and changes the ABI between translation units, so the
+    fixed value is used. Modern x86-64 CPUs prefetch cache lines in pairs
+    and some ARM64 and POWER CPUs have 128 bytes cache lines.
+*/
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64) || defined(__powerpc64__)
+inline constexpr size_t hardware_destructive_interference_size = 128;
+#else
+inline constexpr size_t hardware_destructive_interference_size = 64;
+#endif
+
+//! Maximal size of contiguous memory to promote true sharing
+inline constexpr size_t hardware_constructive_interference_size = 64;
+
+//! Cache padded value
+/*!
+    Cache padded value is aligned and padded to the destructive interference
+    size, so the value never shares a cache line with other values. It is
+    useful for hot atomics (e.g. head and tail of ring queues) which are
+    modified by different threads.
+
+    Not thread-safe.
+*/
+template <typename T>
+class alignas(hardware_destructive_interference_size) CachePadded
+{
+public:
+    CachePadded() = default;
+    template <typename... Args, typename = std::enable_if_t<std::is_constructible_v<T, Args...>>>
+    explicit CachePadded(Args&&... args) : _value(std::forward<Args>(args)...) {}
+    CachePadded(const CachePadded&) = default;
+    CachePadded(CachePadded&&) = default;
+    ~CachePadded() = default;
+
+    CachePadded& operator=(const CachePadded&) = default;
+    CachePadded& operator=(CachePadded&&) = default;
+
+    T& operator*() noexcept { return _value; }
+    const T& operator*() const noexcept { return _value; }
+    T* operator->() noexcept { return &_value; }
+    const T* operator->() const noexcept { return &_value; }
+
+    //! Get the padded value
+    T& get() noexcept { return _value; }
+    const T& get() const noexcept { return _value; }
+
+private:
+    T _value;
+};
+
+/*! \example memory_cache_padded.cpp Cache line padding example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_CACHE_PADDED_H
@@ -20,17 +20,31 @@
 #include <limits>
 #include <memory>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 namespace CppCommon {
 
 //! Memory management static class
 /*!
     Provides memory management functionality such as total and free RAM available.
 
+    Bulk memory operations use SIMD and non-temporal (streaming) stores for
+    large buffers which are not going to be read again soon, so they do not
+    evict the working set from CPU caches. Small buffers automatically fall
+    back to regular stores.
+
     Thread-safe.
 */
 class Memory
 {
 public:
+    //! Minimal buffer size in bytes to use non-temporal stores (256 KB)
+    static constexpr size_t NON_TEMPORAL_THRESHOLD = 256 * 1024;
+    //! Minimal buffer size in bytes to fill with the pseudo-random generator instead of the system entropy source (256 bytes)
+    static constexpr size_t RANDOM_THRESHOLD = 256;
+
     Memory() = delete;
     Memory(const Memory&) = delete;
     Memory(Memory&&) = delete;
@@ -46,6 +60,8 @@ public:
 
     //! Is the given memory buffer filled with zeros?
     /*!
+        Memory buffer is checked with SIMD loads 64 bytes at a time.
+
         \param buffer - Memory buffer
         \param size - Size of memory buffer in bytes
         \return 'true' if the given memory buffer is filled with zeros, 'false' if the memory buffer is not filled with zeros
@@ -78,14 +94,61 @@ public:
     template <typename T>
     static T* Align(const T* address, size_t alignment = alignof(T), bool upwards = true) noexcept;
 
+    //! Prefetch the cache line with the given address
+    /*!
+        \param address - Address to prefetch
+        \param write - Prefetch for writing flag (default is false)
+    */
+    static void Prefetch(const void* address, bool write = false) noexcept;
+    //! Prefetch all cache lines of the given memory buffer
+    /*!
+        \param buffer - Memory buffer to prefetch
+        \param size - Size of memory buffer in bytes
+        \param write - Prefetch for writing flag (default is false)
+    */
+    static void PrefetchRange(const void* buffer, size_t size, bool write = false) noexcept;
+
+    //! Copy the given memory buffer with non-temporal stores
+    /*!
+        Buffers smaller than Memory::NON_TEMPORAL_THRESHOLD are copied with
+        memcpy(). Larger buffers are copied with streaming stores (x86 SSE2
+        'movntdq') which bypass CPU caches. Buffers must not overlap.
+
+        \param destination - Destination memory buffer
+        \param source - Source memory buffer
+        \param size - Size of memory buffers in bytes
+    */
+    static void StreamCopy(void* destination, const void* source, size_t size) noexcept;
+    //! Fill the given memory buffer with the given byte value using non-temporal stores
+    /*!
+        Buffers smaller than Memory::NON_TEMPORAL_THRESHOLD are filled with
+        memset(). Larger buffers are filled with streaming stores (x86 SSE2
+        'movntdq') or zeroed by cache line blocks (ARM64 'dc zva').
+
+        \param buffer - Memory buffer to fill
+        \param value - Byte value to fill
+        \param size - Size of memory buffer in bytes
+    */
+    static void StreamFill(void* buffer, uint8_t value, size_t size) noexcept;
+
     //! Fill the given memory buffer with zeros
     /*!
+        Zero fill is never optimized away by the compiler, so it is suitable
+        to wipe sensitive data. Large buffers are zeroed with non-temporal
+        stores.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
     */
     static void ZeroFill(void* buffer, size_t size);
     //! Fill the given memory buffer with random bytes
     /*!
+        Buffers smaller than Memory::RANDOM_THRESHOLD are filled from the
+        system entropy source. Larger buffers are filled with the vectorized
+        xoshiro256++ pseudo-random generator seeded from the system entropy
+        source. Random bytes are not cryptographic strong, use CryptoFill()
+        for keys and nonces.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
     */
@@ -96,6 +159,26 @@ public:
         \param size - Size of memory buffer in bytes
     */
     static void CryptoFill(void* buffer, size_t size);
+
+    //! Granularity of the mirrored memory buffer size in bytes
+    static size_t MirrorGranularity();
+    //! Allocate the mirrored memory buffer
+    /*!
+        Mirrored memory buffer maps the same physical memory twice into adjacent
+        virtual address ranges, so 'buffer[i]' and 'buffer[i + size]' refer to
+        the same byte. It allows to access any wrapped range of the ring buffer
+        as a contiguous memory block.
+
+        \param size - Size of memory buffer in bytes (must be a multiple of the mirror granularity)
+        \return A pointer to the mirrored memory buffer of '2 * size' bytes of address space or nullptr in case of allocation failed
+    */
+    static void* MirrorAllocate(size_t size);
+    //! Free the mirrored memory buffer
+    /*!
+        \param buffer - Mirrored memory buffer
+        \param size - Size of memory buffer in bytes
+    */
+    static void MirrorFree(void* buffer, size_t size);
 };
 
 /*! \example memory_memory.cpp Memory management example */
@@ -39,4 +39,26 @@ inline T* Memory::Align(const T* address, size_t alignment, bool upwards) noexce
         return (T*)(ptr & -((int)alignment));
 }
 
+inline void Memory::Prefetch(const void* address, bool write) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if (write)
+        __builtin_prefetch(address, 1, 3);
+    else
+        __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    (void)write;
+    _mm_prefetch((const char*)address, _MM_HINT_T0);
+#endif
+}
+
+inline void Memory::PrefetchRange(const void* buffer, size_t size, bool write) noexcept
+{
+    // Prefetch each cache line touched by the buffer
+    uintptr_t ptr = (uintptr_t)buffer & ~(uintptr_t)63;
+    uintptr_t end = (uintptr_t)buffer + size;
+    for (; ptr < end; ptr += 64)
+        Prefetch((const void*)ptr, write);
+}
+
 } // namespace CppCommon
@@ -0,0 +1,197 @@
+/*!
+    \file memory_pressure.h
+    \brief Memory pressure monitor definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MEMORY_PRESSURE_H
+#define CPPCOMMON_MEMORY_MEMORY_PRESSURE_H
+
+#include "time/timespan.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace CppCommon {
+
+//! Memory pressure levels
+enum class MemoryPressureLevel : uint8_t
+{
+    NORMAL,             //!< Enough memory is available
+    MODERATE,           //!< Memory is close to the limit, caches should shed cold entries
+    CRITICAL            //!< Memory is almost exhausted, caches and pools should release as much memory as possible
+};
+
+//! Stream output: Memory pressure level
+/*!
+    \param stream - Output stream
+    \param level - Memory pressure level
+    \return Output stream
+*/
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, MemoryPressureLevel level);
+
+//! Memory pressure status
+struct MemoryPressureStatus
+{
+    //! Memory limit in bytes (cgroup limit or total RAM, -1 if unknown)
+    int64_t limit{-1};
+    //! Memory usage in bytes (without reclaimable inactive page cache, -1 if unknown)
+    int64_t usage{-1};
+    //! Percentage of time some tasks were stalled on memory for the last 10 seconds (PSI 'some avg10')
+    double some{0.0};
+    //! Percentage of time all tasks were stalled on memory for the last 10 seconds (PSI 'full avg10')
+    double full{0.0};
+    //! Is the memory limit taken from the cgroup?
+    bool cgroup{false};
+
+    //! Get the available memory in bytes
+    int64_t available() const noexcept { return ((limit >= 0) && (usage >= 0)) ? std::max<int64_t>(limit - usage, 0) : -1; }
+    //! Get the memory utilization in range [0.0, 1.0]
+    double utilization() const noexcept { return ((limit > 0) && (usage >= 0)) ? std::min((double)usage / (double)limit, 1.0) : 0.0; }
+};
+
+//! Memory pressure monitor
+/*!
+    Memory pressure monitor samples the memory limit and usage of the current
+    process container and publishes memory pressure levels to subscribers, so
+    caches and pool allocators could shed or trim memory before the limit is
+    reached and the OOM killer fires.
+
+    On Linux the memory limit and usage are taken from cgroup v2 (memory.max,
+    memory.current, memory.stat, memory.pressure) or cgroup v1
+    (memory.limit_in_bytes, memory.usage_in_bytes, memory.stat) of the current
+    process. Inactive file pages are reclaimable, so they are not counted as
+    used memory. If the cgroup is not limited the host RAM is used. Memory
+    stall information (PSI) is taken from the cgroup or /proc/pressure/memory.
+    On other platforms the host RAM is used and PSI is not available.
+
+    Pressure level is the highest level reached either by the memory
+    utilization or by the PSI 'some avg10' stall percentage. Subscribers are
+    notified when the level changes and on each update while the level is
+    above normal, so they could release memory gradually.
+
+    Thread-safe.
+*/
+class MemoryPressure
+{
+public:
+    //! Memory pressure handler type
+    typedef std::function<void (MemoryPressureLevel level, const MemoryPressureStatus& status)> Handler;
+
+    //! Initialize the memory pressure monitor of the given cgroup
+    /*!
+        \param cgroup - Path to the cgroup directory (default is "" - detect the cgroup of the current process)
+    */
+    explicit MemoryPressure(const std::string& cgroup = "");
+    MemoryPressure(const MemoryPressure&) = delete;
+    MemoryPressure(MemoryPressure&&) = delete;
+    ~MemoryPressure() { stop(); }
+
+    MemoryPressure& operator=(const MemoryPressure&) = delete;
+    MemoryPressure& operator=(MemoryPressure&&) = delete;
+
+    //! Get the monitored cgroup directory ("" if the host RAM is monitored)
+    const std::string& cgroup() const noexcept { return _cgroup; }
+
+    //! Get the current memory pressure level
+    MemoryPressureLevel level() const noexcept { return _level.load(std::memory_order_acquire); }
+
+    //! Set memory utilization thresholds
+    /*!
+        \param moderate - Moderate pressure utilization (default is 0.80)
+        \param critical - Critical pressure utilization (default is 0.95)
+    */
+    void set_thresholds(double moderate = 0.80, double critical = 0.95);
+    //! Set memory stall (PSI 'some avg10') thresholds in percents
+    /*!
+        \param moderate - Moderate pressure stall percentage (default is 10.0)
+        \param critical - Critical pressure stall percentage (default is 40.0)
+    */
+    void set_stall_thresholds(double moderate = 10.0, double critical = 40.0);
+
+    //! Subscribe to memory pressure level notifications
+    /*!
+        Handler is called from the thread which updates the memory pressure
+        monitor. Handler must not subscribe or unsubscribe handlers.
+
+        \param handler - Memory pressure handler
+        \return Subscription Id
+    */
+    size_t subscribe(const Handler& handler);
+    //! Unsubscribe from memory pressure level notifications
+    /*!
+        \param id - Subscription Id
+        \return 'true' if the handler was unsubscribed, 'false' if the given subscription was not found
+    */
+    bool unsubscribe(size_t id);
+
+    //! Sample the memory status of the monitored cgroup
+    MemoryPressureStatus status() const;
+
+    //! Update the memory pressure level and notify subscribers
+    /*!
+        \return Updated memory pressure level
+    */
+    MemoryPressureLevel update();
+    //! Update the memory pressure level with the given memory status and notify subscribers
+    /*!
+        \param status - Memory status
+        \return Updated memory pressure level
+    */
+    MemoryPressureLevel update(const MemoryPressureStatus& status);
+
+    //! Start the background monitor thread
+    /*!
+        \param period - Update period (default is 1 second)
+        \return 'true' if the monitor thread was started, 'false' if the monitor thread is already running
+    */
+    bool start(const Timespan& period = Timespan::seconds(1));
+    //! Stop the background monitor thread
+    /*!
+        \return 'true' if the monitor thread was stopped, 'false' if the monitor thread is not running
+    */
+    bool stop();
+
+    //! Detect the cgroup directory of the current process
+    /*!
+        \return Path to the cgroup directory with memory accounting or "" if the cgroup was not found
+    */
+    static std::string DetectCgroup();
+
+private:
+    std::string _cgroup;
+    bool _v2;
+    std::atomic<MemoryPressureLevel> _level;
+    double _moderate;
+    double _critical;
+    double _stall_moderate;
+    double _stall_critical;
+
+    std::mutex _state;
+    std::map<size_t, Handler> _handlers;
+    size_t _id;
+
+    mutable std::mutex _control;
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::thread _thread;
+    bool _stop;
+};
+
+/*! \example memory_pressure.cpp Memory pressure monitor example */
+
+} // namespace CppCommon
+
+#include "memory_pressure.inl"
+
+#endif // CPPCOMMON_MEMORY_MEMORY_PRESSURE_H
@@ -0,0 +1,32 @@
+/*!
+    \file memory_pressure.inl
+    \brief Memory pressure monitor inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, MemoryPressureLevel level)
+{
+    switch (level)
+    {
+        case MemoryPressureLevel::NORMAL:
+            stream << "NORMAL";
+            break;
+        case MemoryPressureLevel::MODERATE:
+            stream << "MODERATE";
+            break;
+        case MemoryPressureLevel::CRITICAL:
+            stream << "CRITICAL";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,139 @@
+/*!
+    \file object_pool.h
+    \brief Typed object pool definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_OBJECT_POOL_H
+#define CPPCOMMON_MEMORY_OBJECT_POOL_H
+
+#include "allocator_thread_cache.h"
+#include "threads/lock_free_stack.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Typed object pool
+/*!
+    Typed object pool recycles storage slots of released objects, so objects
+    are created and released without touching the memory manager in the
+    steady state.
+
+    Each thread keeps released slots in its own magazine and creates new
+    objects from it without any synchronization. Thread magazine which grows
+    over two magazine capacities moves a full magazine into the shared depot,
+    and the empty thread magazine takes a full one back from the depot. The
+    depot is a lock-free stack of magazines protected from the ABA problem
+    with a tagged pointer. Only when the depot is empty a new chunk of slots
+    is allocated from the memory manager under the lock.
+
+    Objects could be released by any thread. Magazine of the exited thread
+    keeps its slots and is adopted by the next new thread. All chunks are
+    returned to the memory manager when the pool is destroyed, so all objects
+    must be released before.
+
+    Thread-safe.
+*/
+template <typename T, class TMemoryManager = DefaultMemoryManager>
+class ObjectPool
+{
+public:
+    //! Initialize object pool with a given memory manager
+    /*!
+        \param manager - Memory manager of slots chunks
+        \param magazine - Count of slots in each magazine and chunk (default is 64)
+    */
+    explicit ObjectPool(TMemoryManager& manager, size_t magazine = 64);
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ~ObjectPool();
+
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+
+    //! Memory manager of slots chunks
+    TMemoryManager& manager() noexcept { return _manager; }
+
+    //! Count of slots in each magazine and chunk
+    size_t magazine() const noexcept { return _magazine; }
+    //! Count of slots allocated from the memory manager
+    size_t capacity() const noexcept { return _capacity.load(std::memory_order_relaxed); }
+    //! Count of chunks allocated from the memory manager
+    size_t chunks() const noexcept { return _chunks_count.load(std::memory_order_relaxed); }
+
+    //! Create a new object in the recycled slot
+    /*!
+        \param args - Arguments to initialize the created object with
+        \return Pointer to the created object or nullptr in case of allocation failed
+    */
+    template <class... Args>
+    T* Create(Args&&... args);
+    //! Release the object and recycle its slot
+    /*!
+        \param ptr - Pointer to the object created by the pool
+    */
+    void Release(T* ptr);
+
+private:
+    // Object storage slot
+    struct Slot
+    {
+        std::atomic<Slot*> next;    // Next magazine in the depot
+        Slot* link;                 // Next slot in the magazine
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Thread magazine
+    struct alignas(64) Cache
+    {
+        std::atomic<bool> alive{true};
+        std::atomic<bool> abandoned{false};
+        std::atomic<int> references{2};
+        Slot* slots{nullptr};
+        size_t count{0};
+    };
+
+    // Unique Id of the object pool
+    uint64_t _id;
+
+    TMemoryManager& _manager;
+    const size_t _magazine;
+
+    // Depot of full magazines
+    LockFreeStack<Slot> _depot;
+
+    // Allocated chunks and thread magazines
+    std::mutex _lock;
+    std::vector<void*> _chunks;
+    std::vector<Cache*> _caches;
+    std::atomic<size_t> _chunks_count;
+    std::atomic<size_t> _capacity;
+
+    //! Get the thread magazine of the current thread
+    Cache* GetCache();
+    //! Refill the empty thread magazine from the depot or a new chunk
+    bool Refill(Cache* cache);
+    //! Move the full magazine from the thread magazine into the depot
+    void Drain(Cache* cache);
+
+    static Slot* ToSlot(T* ptr) noexcept { return (Slot*)((unsigned char*)ptr - offsetof(Slot, storage)); }
+
+    static bool IsAlive(void* cache) noexcept;
+    static void Detach(void* cache) noexcept;
+};
+
+/*! \example memory_object_pool.cpp Typed object pool example */
+
+} // namespace CppCommon
+
+#include "object_pool.inl"
+
+#endif // CPPCOMMON_MEMORY_OBJECT_POOL_H
@@ -0,0 +1,185 @@
+/*!
+    \file object_pool.inl
+    \brief Typed object pool inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, class TMemoryManager>
+inline ObjectPool<T, TMemoryManager>::ObjectPool(TMemoryManager& manager, size_t magazine)
+    : _id(Internals::ThreadCacheId()),
+      _manager(manager),
+      _magazine(magazine),
+      _chunks_count(0),
+      _capacity(0)
+{
+    assert((magazine > 0) && "Object pool magazine must be greater than zero!");
+}
+
+template <typename T, class TMemoryManager>
+inline ObjectPool<T, TMemoryManager>::~ObjectPool()
+{
+    // Release thread magazines. Registries of alive threads detach them later.
+    for (auto cache : _caches)
+    {
+        cache->alive.store(false, std::memory_order_release);
+        Detach(cache);
+    }
+
+    // Return all chunks to the memory manager
+    for (auto chunk : _chunks)
+        _manager.free(chunk, _magazine * sizeof(Slot));
+}
+
+template <typename T, class TMemoryManager>
+template <class... Args>
+inline T* ObjectPool<T, TMemoryManager>::Create(Args&&... args)
+{
+    Cache* cache = GetCache();
+    if ((cache->count == 0) && !Refill(cache))
+        return nullptr;
+
+    Slot* slot = cache->slots;
+    cache->slots = slot->link;
+    --cache->count;
+
+    try
+    {
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        slot->link = cache->slots;
+        cache->slots = slot;
+        ++cache->count;
+        throw;
+    }
+}
+
+template <typename T, class TMemoryManager>
+inline void ObjectPool<T, TMemoryManager>::Release(T* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    ptr->~T();
+
+    Cache* cache = GetCache();
+    Slot* slot = ToSlot(ptr);
+    slot->link = cache->slots;
+    cache->slots = slot;
+
+    // Move the full magazine into the depot
+    if (++cache->count >= (2 * _magazine))
+        Drain(cache);
+}
+
+template <typename T, class TMemoryManager>
+inline typename ObjectPool<T, TMemoryManager>::Cache* ObjectPool<T, TMemoryManager>::GetCache()
+{
+    Internals::ThreadCacheRegistry& registry = Internals::ThreadCacheRegistry::current();
+
+    Cache* cache = (Cache*)registry.find(_id);
+    if (cache != nullptr)
+        return cache;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Adopt the thread magazine of the exited thread
+        for (auto abandoned : _caches)
+        {
+            bool expected = true;
+            if (abandoned->abandoned.compare_exchange_strong(expected, false, std::memory_order_acq_rel))
+            {
+                abandoned->references.fetch_add(1, std::memory_order_relaxed);
+                cache = abandoned;
+                break;
+            }
+        }
+
+        // Create a new thread magazine
+        if (cache == nullptr)
+        {
+            _caches.reserve(_caches.size() + 1);
+            cache = new Cache();
+            _caches.push_back(cache);
+        }
+    }
+
+    registry.insert(_id, cache, IsAlive, Detach);
+    return cache;
+}
+
+template <typename T, class TMemoryManager>
+inline bool ObjectPool<T, TMemoryManager>::Refill(Cache* cache)
+{
+    // Take the full magazine from the depot
+    Slot* slots = _depot.Pop();
+    if (slots != nullptr)
+    {
+        cache->slots = slots;
+        cache->count = _magazine;
+        return true;
+    }
+
+    // Allocate a new chunk of slots
+    Slot* chunk;
+    {
+        std::scoped_lock locker(_lock);
+        _chunks.reserve(_chunks.size() + 1);
+        chunk = (Slot*)_manager.malloc(_magazine * sizeof(Slot), alignof(Slot));
+        if (chunk == nullptr)
+            return false;
+        _chunks.push_back(chunk);
+    }
+    _chunks_count.fetch_add(1, std::memory_order_relaxed);
+    _capacity.fetch_add(_magazine, std::memory_order_relaxed);
+
+    for (size_t i = 0; i < _magazine; ++i)
+    {
+        Slot* slot = new (&chunk[i]) Slot;
+        slot->next.store(nullptr, std::memory_order_relaxed);
+        slot->link = (i + 1 < _magazine) ? &chunk[i + 1] : nullptr;
+    }
+
+    cache->slots = chunk;
+    cache->count = _magazine;
+    return true;
+}
+
+template <typename T, class TMemoryManager>
+inline void ObjectPool<T, TMemoryManager>::Drain(Cache* cache)
+{
+    // Cut the full magazine from the thread magazine
+    Slot* first = cache->slots;
+    Slot* last = first;
+    for (size_t i = 1; i < _magazine; ++i)
+        last = last->link;
+    cache->slots = last->link;
+    cache->count -= _magazine;
+    last->link = nullptr;
+
+    _depot.Push(*first);
+}
+
+template <typename T, class TMemoryManager>
+inline bool ObjectPool<T, TMemoryManager>::IsAlive(void* cache) noexcept
+{
+    return ((Cache*)cache)->alive.load(std::memory_order_acquire);
+}
+
+template <typename T, class TMemoryManager>
+inline void ObjectPool<T, TMemoryManager>::Detach(void* cache) noexcept
+{
+    // The last of the object pool and the owner thread deletes the thread magazine
+    Cache* instance = (Cache*)cache;
+    instance->abandoned.store(true, std::memory_order_release);
+    if (instance->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete instance;
+}
+
+} // namespace CppCommon
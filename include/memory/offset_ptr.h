@@ -0,0 +1,82 @@
+/*!
+    \file offset_ptr.h
+    \brief Offset pointer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_OFFSET_PTR_H
+#define CPPCOMMON_MEMORY_OFFSET_PTR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Offset pointer
+/*!
+    Offset pointer stores the distance from its own address to the pointed
+    object instead of the absolute address. If both the offset pointer and
+    the pointed object are placed in the same shared memory block then the
+    offset pointer remains valid in all processes which map the block at
+    different addresses.
+
+    Copying the offset pointer recalculates the distance, so the offset
+    pointer must not be copied with memcpy() or similar functions.
+
+    Not thread-safe.
+*/
+template <typename T>
+class OffsetPtr
+{
+public:
+    //! Element type
+    typedef T element_type;
+    //! Reference to element
+    typedef std::add_lvalue_reference_t<T> reference;
+
+    OffsetPtr() noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(std::nullptr_t) noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(T* ptr) noexcept { set(ptr); }
+    OffsetPtr(const OffsetPtr& ptr) noexcept { set(ptr.get()); }
+    ~OffsetPtr() noexcept = default;
+
+    OffsetPtr& operator=(const OffsetPtr& ptr) noexcept { set(ptr.get()); return *this; }
+    OffsetPtr& operator=(T* ptr) noexcept { set(ptr); return *this; }
+    OffsetPtr& operator=(std::nullptr_t) noexcept { _offset = NULL_OFFSET; return *this; }
+
+    //! Check if the offset pointer is not null
+    explicit operator bool() const noexcept { return (_offset != NULL_OFFSET); }
+
+    //! Dereference the offset pointer
+    reference operator*() const noexcept { return *get(); }
+    //! Dereference the offset pointer member
+    T* operator->() const noexcept { return get(); }
+
+    //! Get the pointer
+    T* get() const noexcept { return (_offset == NULL_OFFSET) ? nullptr : (T*)((uintptr_t)this + (uintptr_t)_offset); }
+
+    friend bool operator==(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() == ptr2.get(); }
+    friend bool operator!=(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() != ptr2.get(); }
+    friend bool operator==(const OffsetPtr& ptr, std::nullptr_t) noexcept { return !ptr; }
+    friend bool operator!=(const OffsetPtr& ptr, std::nullptr_t) noexcept { return (bool)ptr; }
+
+    //! Swap two instances
+    void swap(OffsetPtr& ptr) noexcept { T* temp = get(); set(ptr.get()); ptr.set(temp); }
+    friend void swap(OffsetPtr& ptr1, OffsetPtr& ptr2) noexcept { ptr1.swap(ptr2); }
+
+private:
+    // Offset to itself + 1 is never a valid object address, so it is used as a null pointer
+    static constexpr ptrdiff_t NULL_OFFSET = 1;
+
+    ptrdiff_t _offset;
+
+    void set(T* ptr) noexcept { _offset = (ptr == nullptr) ? NULL_OFFSET : (ptrdiff_t)((uintptr_t)ptr - (uintptr_t)this); }
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_OFFSET_PTR_H
@@ -18,6 +18,18 @@ namespace CppCommon {
 /*!
     Encoding utilities contains methods for UTF-8, UTF-16, UTF-32 encoding conversions.
 
+    UTF conversions process ASCII blocks at once and decode other characters
+    with the validation. Every maximal invalid subsequence (overlong forms,
+    surrogates, truncated sequences, unpaired UTF-16 surrogates, code points
+    above U+10FFFF) is replaced with U+FFFD replacement character, so the
+    conversion never throws. Buffer overloads write into the caller provided
+    memory, so no allocation happens.
+
+    Base16, Base32 and Base64 codecs process the bulk of the content with
+    AVX2, AVX-512 or NEON implementations selected for the current CPU in
+    runtime. Buffer overloads write into the caller provided memory, so no
+    allocation happens.
+
     Thread-safe.
 */
 class Encoding
@@ -31,6 +43,17 @@ public:
     Encoding& operator=(const Encoding&) = delete;
     Encoding& operator=(Encoding&&) = delete;
 
+    //! Validate UTF-8 encoded string
+    /*!
+        Checks overlong encodings, surrogates, code points above U+10FFFF and
+        truncated sequences. The bulk of the string is validated with AVX2 or
+        NEON implementation selected for the current CPU in runtime.
+
+        \param str - UTF-8 encoded string to validate
+        \return 'true' if the string is valid UTF-8 encoded string, 'false' otherwise
+    */
+    static bool ValidateUTF8(std::string_view str) noexcept;
+
     //! Convert system wide-string to UTF-8 encoded string
     /*!
         System wide-string could be UTF-16 (Windows) or UTF-32 (Unix).
@@ -39,6 +62,14 @@ public:
         \return UTF-8 encoded string
     */
     static std::string ToUTF8(std::wstring_view wstr);
+    //! Convert system wide-string to UTF-8 encoded string into the given buffer
+    /*!
+        \param wstr - System wide-string to convert
+        \param buffer - Output buffer
+        \param size - Output buffer size
+        \return Count of written UTF-8 code units (zero if the output buffer is too small)
+    */
+    static size_t ToUTF8(std::wstring_view wstr, char* buffer, size_t size);
 
     //! Convert UTF-8 encoded string to system wide-string
     /*!
@@ -48,6 +79,14 @@ public:
         \return System wide-string
     */
     static std::wstring FromUTF8(std::string_view str);
+    //! Convert UTF-8 encoded string to system wide-string into the given buffer
+    /*!
+        \param str - UTF-8 encoded string to convert
+        \param buffer - Output buffer
+        \param size - Output buffer size
+        \return Count of written wide characters (zero if the output buffer is too small)
+    */
+    static size_t FromUTF8(std::string_view str, wchar_t* buffer, size_t size);
 
     //! Convert UTF-8 encoded string to UTF-16 encoded string
     /*!
@@ -55,12 +94,28 @@ public:
         \return UTF-16 encoded string
     */
     static std::u16string UTF8toUTF16(std::string_view str);
+    //! Convert UTF-8 encoded string to UTF-16 encoded string into the given buffer
+    /*!
+        \param str - UTF-8 encoded string to convert
+        \param buffer - Output buffer (str.size() code units are always enough)
+        \param size - Output buffer size
+        \return Count of written UTF-16 code units (zero if the output buffer is too small)
+    */
+    static size_t UTF8toUTF16(std::string_view str, char16_t* buffer, size_t size);
     //! Convert UTF-8 encoded string to UTF-32 encoded string
     /*!
         \param str - UTF-8 encoded string to convert
         \return UTF-32 encoded string
     */
     static std::u32string UTF8toUTF32(std::string_view str);
+    //! Convert UTF-8 encoded string to UTF-32 encoded string into the given buffer
+    /*!
+        \param str - UTF-8 encoded string to convert
+        \param buffer - Output buffer (str.size() code units are always enough)
+        \param size - Output buffer size
+        \return Count of written UTF-32 code units (zero if the output buffer is too small)
+    */
+    static size_t UTF8toUTF32(std::string_view str, char32_t* buffer, size_t size);
 
     //! Convert UTF-16 encoded string to UTF-8 encoded string
     /*!
@@ -68,12 +123,28 @@ public:
         \return UTF-8 encoded string
     */
     static std::string UTF16toUTF8(std::u16string_view str);
+    //! Convert UTF-16 encoded string to UTF-8 encoded string into the given buffer
+    /*!
+        \param str - UTF-16 encoded string to convert
+        \param buffer - Output buffer (3 * str.size() code units are always enough)
+        \param size - Output buffer size
+        \return Count of written UTF-8 code units (zero if the output buffer is too small)
+    */
+    static size_t UTF16toUTF8(std::u16string_view str, char* buffer, size_t size);
     //! Convert UTF-16 encoded string to UTF-32 encoded string
     /*!
         \param str - UTF-16 encoded string to convert
         \return UTF-32 encoded string
     */
     static std::u32string UTF16toUTF32(std::u16string_view str);
+    //! Convert UTF-16 encoded string to UTF-32 encoded string into the given buffer
+    /*!
+        \param str - UTF-16 encoded string to convert
+        \param buffer - Output buffer (str.size() code units are always enough)
+        \param size - Output buffer size
+        \return Count of written UTF-32 code units (zero if the output buffer is too small)
+    */
+    static size_t UTF16toUTF32(std::u16string_view str, char32_t* buffer, size_t size);
 
     //! Convert UTF-32 encoded string to UTF-8 encoded string
     /*!
@@ -81,12 +152,33 @@ public:
         \return UTF-8 encoded string
     */
     static std::string UTF32toUTF8(std::u32string_view str);
+    //! Convert UTF-32 encoded string to UTF-8 encoded string into the given buffer
+    /*!
+        \param str - UTF-32 encoded string to convert
+        \param buffer - Output buffer (4 * str.size() code units are always enough)
+        \param size - Output buffer size
+        \return Count of written UTF-8 code units (zero if the output buffer is too small)
+    */
+    static size_t UTF32toUTF8(std::u32string_view str, char* buffer, size_t size);
     //! Convert UTF-32 encoded string to UTF-16 encoded string
     /*!
         \param str - UTF-32 encoded string to convert
         \return UTF-16 encoded string
     */
     static std::u16string UTF32toUTF16(std::u32string_view str);
+    //! Convert UTF-32 encoded string to UTF-16 encoded string into the given buffer
+    /*!
+        \param str - UTF-32 encoded string to convert
+        \param buffer - Output buffer (2 * str.size() code units are always enough)
+        \param size - Output buffer size
+        \return Count of written UTF-16 code units (zero if the output buffer is too small)
+    */
+    static size_t UTF32toUTF16(std::u32string_view str, char16_t* buffer, size_t size);
+
+    //! Get the Base16 encoded size of the given bytes size
+    static size_t Base16EncodeSize(size_t size) noexcept { return size * 2; }
+    //! Get the Base16 decoded size of the given encoded string (zero for the invalid string size)
+    static size_t Base16DecodeSize(std::string_view str) noexcept;
 
     //! Base16 encode string
     /*!
@@ -94,12 +186,33 @@ public:
         \return Base16 encoded string
     */
     static std::string Base16Encode(std::string_view str);
+    //! Base16 encode string into the given buffer
+    /*!
+        \param str - String to encode
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least Base16EncodeSize(str.size()))
+        \return Base16 encoded size (zero if the output buffer is too small)
+    */
+    static size_t Base16Encode(std::string_view str, char* buffer, size_t size);
     //! Base16 decode string
     /*!
         \param str - Base16 encoded string
         \return Decoded string
     */
     static std::string Base16Decode(std::string_view str);
+    //! Base16 decode string into the given buffer
+    /*!
+        \param str - Base16 encoded string
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least Base16DecodeSize(str))
+        \return Decoded size (zero if the encoded string is invalid or the output buffer is too small)
+    */
+    static size_t Base16Decode(std::string_view str, char* buffer, size_t size);
+
+    //! Get the Base32 encoded size of the given bytes size
+    static size_t Base32EncodeSize(size_t size) noexcept { return ((size + 4) / 5) * 8; }
+    //! Get the Base32 decoded size of the given encoded string (zero for the invalid string size)
+    static size_t Base32DecodeSize(std::string_view str) noexcept;
 
     //! Base32 encode string
     /*!
@@ -107,12 +220,33 @@ public:
         \return Base32 encoded string
     */
     static std::string Base32Encode(std::string_view str);
+    //! Base32 encode string into the given buffer
+    /*!
+        \param str - String to encode
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least Base32EncodeSize(str.size()))
+        \return Base32 encoded size (zero if the output buffer is too small)
+    */
+    static size_t Base32Encode(std::string_view str, char* buffer, size_t size);
     //! Base32 decode string
     /*!
         \param str - Base32 encoded string
         \return Decoded string
     */
     static std::string Base32Decode(std::string_view str);
+    //! Base32 decode string into the given buffer
+    /*!
+        \param str - Base32 encoded string
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least Base32DecodeSize(str))
+        \return Decoded size (zero if the encoded string is invalid or the output buffer is too small)
+    */
+    static size_t Base32Decode(std::string_view str, char* buffer, size_t size);
+
+    //! Get the Base64 encoded size of the given bytes size
+    static size_t Base64EncodeSize(size_t size) noexcept { return ((size + 2) / 3) * 4; }
+    //! Get the Base64 decoded size of the given encoded string (zero for the invalid string size)
+    static size_t Base64DecodeSize(std::string_view str) noexcept;
 
     //! Base64 encode string
     /*!
@@ -120,25 +254,76 @@ public:
         \return Base64 encoded string
     */
     static std::string Base64Encode(std::string_view str);
+    //! Base64 encode string into the given buffer
+    /*!
+        \param str - String to encode
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least Base64EncodeSize(str.size()))
+        \return Base64 encoded size (zero if the output buffer is too small)
+    */
+    static size_t Base64Encode(std::string_view str, char* buffer, size_t size);
     //! Base64 decode string
     /*!
         \param str - Base64 encoded string
         \return Decoded string
     */
     static std::string Base64Decode(std::string_view str);
+    //! Base64 decode string into the given buffer
+    /*!
+        \param str - Base64 encoded string
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least Base64DecodeSize(str))
+        \return Decoded size (zero if the encoded string is invalid or the output buffer is too small)
+    */
+    static size_t Base64Decode(std::string_view str, char* buffer, size_t size);
+
+    //! Get the URL encoded size of the given string
+    static size_t URLEncodeSize(std::string_view str) noexcept;
 
     //! URL encode string
     /*!
+        Runs of unreserved characters are found with vectorized scan and
+        copied in bulk.
+
         \param str - String to encode
         \return URL encoded string
     */
     static std::string URLEncode(std::string_view str);
+    //! URL encode string into the given buffer
+    /*!
+        \param str - String to encode
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least URLEncodeSize(str))
+        \return URL encoded size (zero if the output buffer is too small)
+    */
+    static size_t URLEncode(std::string_view str, char* buffer, size_t size);
     //! URL decode string
     /*!
+        Runs of not encoded characters are found with vectorized scan and
+        copied in bulk. Invalid escape sequence is decoded as '?' and stops
+        decoding.
+
         \param str - URL encoded string
         \return Decoded string
     */
     static std::string URLDecode(std::string_view str);
+    //! URL decode string into the given buffer
+    /*!
+        \param str - URL encoded string
+        \param buffer - Output buffer
+        \param size - Output buffer size (at least str.size())
+        \return Decoded size (zero if the output buffer is too small)
+    */
+    static size_t URLDecode(std::string_view str, char* buffer, size_t size);
+    //! URL decode string in place
+    /*!
+        Decoded string is never longer than the encoded one, so the string is
+        decoded without memory allocation. The string without escape sequences
+        is checked with a single vectorized scan.
+
+        \param str - URL encoded string to decode
+    */
+    static void URLDecodeInPlace(std::string& str);
 };
 
 /*! \example string_encoding.cpp Encoding utilities example */
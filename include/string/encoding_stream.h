@@ -0,0 +1,250 @@
+/*!
+    \file encoding_stream.h
+    \brief Streaming encoding definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_ENCODING_STREAM_H
+#define CPPCOMMON_STRING_ENCODING_STREAM_H
+
+#include "common/reader.h"
+#include "common/writer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CppCommon {
+
+//! Streaming encoding interface
+/*!
+    Streaming encoding transforms data chunk by chunk and carries incomplete
+    groups (Base-N blocks, partial UTF sequences) between chunks, so data of
+    any size is transformed in constant memory. Result of the transformation
+    does not depend on how the input is split into chunks and is the same as
+    the result of the corresponding Encoding function for the whole input.
+
+    Decoders throw ArgumentException for malformed encoded data (incomplete
+    blocks or data after the padding). Invalid characters are handled the
+    same way as the corresponding Encoding function does.
+
+    Not thread-safe.
+*/
+class EncodingStream
+{
+public:
+    EncodingStream() noexcept = default;
+    EncodingStream(const EncodingStream&) noexcept = default;
+    EncodingStream(EncodingStream&&) noexcept = default;
+    virtual ~EncodingStream() noexcept = default;
+
+    EncodingStream& operator=(const EncodingStream&) noexcept = default;
+    EncodingStream& operator=(EncodingStream&&) noexcept = default;
+
+    //! Get the maximal output size of Update() or Finish() call for the given input size
+    /*!
+        \param size - Input size in bytes
+        \return Maximal output size in bytes
+    */
+    virtual size_t OutputSize(size_t size) const noexcept = 0;
+
+    //! Transform the next input chunk
+    /*!
+        \param input - Input chunk
+        \param size - Input chunk size in bytes
+        \param output - Output buffer
+        \param capacity - Output buffer capacity in bytes (at least OutputSize(size))
+        \return Size of the output in bytes
+    */
+    virtual size_t Update(const void* input, size_t size, void* output, size_t capacity) = 0;
+    //! Finish the transformation and reset the stream state
+    /*!
+        \param output - Output buffer
+        \param capacity - Output buffer capacity in bytes (at least OutputSize(0))
+        \return Size of the output in bytes
+    */
+    virtual size_t Finish(void* output, size_t capacity) = 0;
+
+    //! Reset the stream state
+    virtual void Reset() noexcept = 0;
+};
+
+//! Base-N streaming encoder
+/*!
+    Supported bases are 16, 32 and 64 with the same alphabets and padding as
+    Encoding::Base16Encode(), Encoding::Base32Encode() and Encoding::Base64Encode().
+*/
+class BaseStreamEncoder : public EncodingStream
+{
+public:
+    //! Initialize Base-N streaming encoder
+    /*!
+        \param base - Base of the encoding (16, 32 or 64)
+    */
+    explicit BaseStreamEncoder(int base);
+
+    //! Get the base of the encoding
+    int base() const noexcept { return _base; }
+
+    size_t OutputSize(size_t size) const noexcept override;
+    size_t Update(const void* input, size_t size, void* output, size_t capacity) override;
+    size_t Finish(void* output, size_t capacity) override;
+    void Reset() noexcept override { _pending_size = 0; }
+
+private:
+    int _base;
+    size_t _block;
+    size_t _encoded;
+    uint8_t _pending[8];
+    size_t _pending_size;
+
+    size_t Encode(const uint8_t* input, size_t size, uint8_t* output, size_t capacity) const;
+};
+
+//! Base-N streaming decoder
+/*!
+    Supported bases are 16, 32 and 64 with the same alphabets and padding as
+    Encoding::Base16Decode(), Encoding::Base32Decode() and Encoding::Base64Decode().
+    Padding is allowed only at the end of the encoded data.
+*/
+class BaseStreamDecoder : public EncodingStream
+{
+public:
+    //! Initialize Base-N streaming decoder
+    /*!
+        \param base - Base of the encoding (16, 32 or 64)
+    */
+    explicit BaseStreamDecoder(int base);
+
+    //! Get the base of the encoding
+    int base() const noexcept { return _base; }
+
+    size_t OutputSize(size_t size) const noexcept override;
+    size_t Update(const void* input, size_t size, void* output, size_t capacity) override;
+    size_t Finish(void* output, size_t capacity) override;
+    void Reset() noexcept override { _pending_size = 0; _padded = false; }
+
+private:
+    int _base;
+    size_t _block;
+    size_t _decoded;
+    uint8_t _pending[8];
+    size_t _pending_size;
+    bool _padded;
+
+    size_t Decode(const uint8_t* input, size_t size, uint8_t* output, size_t capacity);
+};
+
+//! UTF streaming transcoder
+/*!
+    Transcodes UTF-8 (char), UTF-16 (char16_t) and UTF-32 (char32_t) code
+    units in the native byte order. Invalid sequences are replaced with
+    U+FFFD replacement character as Encoding UTF conversions do.
+*/
+template <typename TInput, typename TOutput>
+class UTFStreamTranscoder : public EncodingStream
+{
+public:
+    UTFStreamTranscoder() noexcept : _pending_size(0) {}
+
+    size_t OutputSize(size_t size) const noexcept override;
+    size_t Update(const void* input, size_t size, void* output, size_t capacity) override;
+    size_t Finish(void* output, size_t capacity) override;
+    void Reset() noexcept override { _pending_size = 0; }
+
+private:
+    uint8_t _pending[8];
+    size_t _pending_size;
+
+    size_t Transcode(const uint8_t* input, size_t size, uint8_t* output, size_t capacity) const;
+};
+
+//! Encoding reader
+/*!
+    Encoding reader reads data from the source reader and returns it transformed
+    by the given encoding stream in the constant memory.
+
+    Not thread-safe.
+*/
+class EncodingReader : public Reader
+{
+public:
+    //! Initialize encoding reader
+    /*!
+        \param reader - Source reader
+        \param stream - Encoding stream
+        \param chunk - Size of the source reader chunk (default is 65536)
+    */
+    explicit EncodingReader(Reader& reader, EncodingStream& stream, size_t chunk = 65536);
+    EncodingReader(const EncodingReader&) = delete;
+    EncodingReader(EncodingReader&&) = delete;
+    ~EncodingReader() noexcept override = default;
+
+    EncodingReader& operator=(const EncodingReader&) = delete;
+    EncodingReader& operator=(EncodingReader&&) = delete;
+
+    using Reader::ReadAllBytes;
+    using Reader::ReadAllText;
+    using Reader::ReadAllLines;
+
+    size_t Read(void* buffer, size_t size) override;
+
+private:
+    Reader& _reader;
+    EncodingStream& _stream;
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+    size_t _offset;
+    size_t _size;
+    bool _eof;
+};
+
+//! Encoding writer
+/*!
+    Encoding writer transforms written data by the given encoding stream
+    and writes it into the target writer in the constant memory. Finish()
+    must be called after the last write to flush the carried stream state.
+
+    Not thread-safe.
+*/
+class EncodingWriter : public Writer
+{
+public:
+    //! Initialize encoding writer
+    /*!
+        \param writer - Target writer
+        \param stream - Encoding stream
+        \param chunk - Size of the transformed chunk (default is 65536)
+    */
+    explicit EncodingWriter(Writer& writer, EncodingStream& stream, size_t chunk = 65536);
+    EncodingWriter(const EncodingWriter&) = delete;
+    EncodingWriter(EncodingWriter&&) = delete;
+    ~EncodingWriter() noexcept override = default;
+
+    EncodingWriter& operator=(const EncodingWriter&) = delete;
+    EncodingWriter& operator=(EncodingWriter&&) = delete;
+
+    using Writer::Write;
+
+    size_t Write(const void* buffer, size_t size) override;
+    void Flush() override;
+
+    //! Finish the encoding stream and write its carried state into the target writer
+    void Finish();
+
+private:
+    Writer& _writer;
+    EncodingStream& _stream;
+    size_t _chunk;
+    std::vector<uint8_t> _output;
+
+    void WriteOutput(size_t size);
+};
+
+/*! \example string_encoding_stream.cpp Streaming encoding example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_STRING_ENCODING_STREAM_H
@@ -18,10 +18,14 @@
 #endif
 
 #include <fmt/args.h>
+#include <fmt/compile.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <fmt/xchar.h>
 
+#include <string>
+#include <type_traits>
+
 namespace CppCommon {
 
 //! Format string
@@ -50,6 +54,136 @@ std::string format(fmt::format_string<T...> pattern, T&&... args);
 template <typename... T>
 std::wstring format(fmt::wformat_string<T...> pattern, T&&... args);
 
+//! Format string with the pre-compiled pattern
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net) using
+    the pattern compiled at compile-time with FMT_COMPILE() macro. Compiled
+    pattern is parsed only once during the compilation, so formatting does
+    not spend any time on the pattern parsing.
+
+    Example:
+        std::string result = format(FMT_COMPILE("{}.{}"), 1, 2);
+
+    Thread-safe.
+
+    \param pattern - Compiled format string pattern
+    \param args - Format arguments
+    \return Formatted string
+*/
+template <typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int> = 0>
+std::basic_string<typename S::char_type> format(const S& pattern, T&&... args);
+
+//! Format string and append it to the given memory buffer
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net) into
+    the reusable memory buffer. No memory allocation is performed when the
+    formatted string fits into the buffer capacity, so the buffer could be
+    cleared and reused for formatting of many strings.
+
+    Thread-safe.
+
+    \param buffer - Memory buffer to append
+    \param pattern - Format string pattern
+    \param args - Format arguments
+*/
+template <size_t N, typename TAllocator, typename... T>
+void format_to(fmt::basic_memory_buffer<char, N, TAllocator>& buffer, fmt::format_string<T...> pattern, T&&... args);
+
+//! Format wide string and append it to the given memory buffer
+/*!
+    Format wide string with the help of {fmt} library (http://fmtlib.net)
+    into the reusable memory buffer.
+
+    Thread-safe.
+
+    \param buffer - Wide memory buffer to append
+    \param pattern - Format wide string pattern
+    \param args - Format arguments
+*/
+template <size_t N, typename TAllocator, typename... T>
+void format_to(fmt::basic_memory_buffer<wchar_t, N, TAllocator>& buffer, fmt::wformat_string<T...> pattern, T&&... args);
+
+//! Format string and append it to the given string
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net) into
+    the reusable string. The string could use any allocator, for example
+    the arena allocator, so formatting does not allocate from the heap.
+
+    Thread-safe.
+
+    \param str - String to append
+    \param pattern - Format string pattern
+    \param args - Format arguments
+*/
+template <typename TAllocator, typename... T>
+void format_to(std::basic_string<char, std::char_traits<char>, TAllocator>& str, fmt::format_string<T...> pattern, T&&... args);
+
+//! Format wide string and append it to the given wide string
+/*!
+    Format wide string with the help of {fmt} library (http://fmtlib.net)
+    into the reusable wide string.
+
+    Thread-safe.
+
+    \param str - Wide string to append
+    \param pattern - Format wide string pattern
+    \param args - Format arguments
+*/
+template <typename TAllocator, typename... T>
+void format_to(std::basic_string<wchar_t, std::char_traits<wchar_t>, TAllocator>& str, fmt::wformat_string<T...> pattern, T&&... args);
+
+//! Format string with the pre-compiled pattern and append it to the given memory buffer
+/*!
+    Thread-safe.
+
+    \param buffer - Memory buffer to append
+    \param pattern - Compiled format string pattern
+    \param args - Format arguments
+*/
+template <typename TChar, size_t N, typename TAllocator, typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int> = 0>
+void format_to(fmt::basic_memory_buffer<TChar, N, TAllocator>& buffer, const S& pattern, T&&... args);
+
+//! Format string with the pre-compiled pattern and append it to the given string
+/*!
+    Thread-safe.
+
+    \param str - String to append
+    \param pattern - Compiled format string pattern
+    \param args - Format arguments
+*/
+template <typename TChar, typename TAllocator, typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int> = 0>
+void format_to(std::basic_string<TChar, std::char_traits<TChar>, TAllocator>& str, const S& pattern, T&&... args);
+
+//! Format string into the given fixed size buffer
+/*!
+    Format string with the help of {fmt} library (http://fmtlib.net) into
+    the fixed size buffer. Formatted string is truncated if it does not fit
+    into the buffer. The buffer is not null-terminated.
+
+    Thread-safe.
+
+    \param buffer - Buffer to format
+    \param size - Buffer size
+    \param pattern - Format string pattern
+    \param args - Format arguments
+    \return Size of the whole formatted string (greater than the buffer size if the result was truncated)
+*/
+template <typename... T>
+size_t format_to_n(char* buffer, size_t size, fmt::format_string<T...> pattern, T&&... args);
+
+//! Format string with the pre-compiled pattern into the given fixed size buffer
+/*!
+    Thread-safe.
+
+    \param buffer - Buffer to format
+    \param size - Buffer size
+    \param pattern - Compiled format string pattern
+    \param args - Format arguments
+    \return Size of the whole formatted string (greater than the buffer size if the result was truncated)
+*/
+template <typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int> = 0>
+size_t format_to_n(typename S::char_type* buffer, size_t size, const S& pattern, T&&... args);
+
 //! Format string and print it into the std::cout
 /*!
     Format string with the help of {fmt} library (http://fmtlib.net)
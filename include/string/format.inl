@@ -20,6 +20,60 @@ inline std::wstring format(fmt::wformat_string<T...> pattern, T&&... args)
     return fmt::vformat<wchar_t>(pattern, fmt::make_format_args<fmt::wformat_context>(args...));
 }
 
+template <typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int>>
+inline std::basic_string<typename S::char_type> format(const S& pattern, T&&... args)
+{
+    return fmt::format(pattern, std::forward<T>(args)...);
+}
+
+template <size_t N, typename TAllocator, typename... T>
+inline void format_to(fmt::basic_memory_buffer<char, N, TAllocator>& buffer, fmt::format_string<T...> pattern, T&&... args)
+{
+    fmt::vformat_to(std::back_inserter(buffer), pattern, fmt::make_format_args(args...));
+}
+
+template <size_t N, typename TAllocator, typename... T>
+inline void format_to(fmt::basic_memory_buffer<wchar_t, N, TAllocator>& buffer, fmt::wformat_string<T...> pattern, T&&... args)
+{
+    fmt::vformat_to(std::back_inserter(buffer), fmt::wstring_view(pattern), fmt::make_format_args<fmt::wformat_context>(args...));
+}
+
+template <typename TAllocator, typename... T>
+inline void format_to(std::basic_string<char, std::char_traits<char>, TAllocator>& str, fmt::format_string<T...> pattern, T&&... args)
+{
+    fmt::vformat_to(std::back_inserter(str), pattern, fmt::make_format_args(args...));
+}
+
+template <typename TAllocator, typename... T>
+inline void format_to(std::basic_string<wchar_t, std::char_traits<wchar_t>, TAllocator>& str, fmt::wformat_string<T...> pattern, T&&... args)
+{
+    fmt::vformat_to(std::back_inserter(str), fmt::wstring_view(pattern), fmt::make_format_args<fmt::wformat_context>(args...));
+}
+
+template <typename TChar, size_t N, typename TAllocator, typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int>>
+inline void format_to(fmt::basic_memory_buffer<TChar, N, TAllocator>& buffer, const S& pattern, T&&... args)
+{
+    fmt::format_to(std::back_inserter(buffer), pattern, std::forward<T>(args)...);
+}
+
+template <typename TChar, typename TAllocator, typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int>>
+inline void format_to(std::basic_string<TChar, std::char_traits<TChar>, TAllocator>& str, const S& pattern, T&&... args)
+{
+    fmt::format_to(std::back_inserter(str), pattern, std::forward<T>(args)...);
+}
+
+template <typename... T>
+inline size_t format_to_n(char* buffer, size_t size, fmt::format_string<T...> pattern, T&&... args)
+{
+    return fmt::format_to_n(buffer, size, pattern, std::forward<T>(args)...).size;
+}
+
+template <typename S, typename... T, std::enable_if_t<fmt::detail::is_compiled_string<S>::value, int>>
+inline size_t format_to_n(typename S::char_type* buffer, size_t size, const S& pattern, T&&... args)
+{
+    return fmt::format_to_n(buffer, size, pattern, std::forward<T>(args)...).size;
+}
+
 template <typename... T>
 inline void print(fmt::format_string<T...> pattern, T&&... args)
 {
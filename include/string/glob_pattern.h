@@ -0,0 +1,132 @@
+/*!
+    \file glob_pattern.h
+    \brief Compiled glob pattern definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_GLOB_PATTERN_H
+#define CPPCOMMON_STRING_GLOB_PATTERN_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Compiled glob pattern
+/*!
+    Glob pattern is compiled once from the patterns string and then matched
+    against strings without any memory allocation, so it is suitable for
+    filtering of huge directory scans.
+
+    Patterns string contains one or more glob patterns separated by ';'.
+    If the pattern has '!' prefix it treats as 'not matching'. Patterns
+    are checked in order and the first matched pattern defines the result.
+    If no pattern matches, the result is 'true' only if the last pattern is
+    negative (the same rules as StringUtils::IsPatternMatch() uses).
+
+    Glob syntax:
+    - '*' matches any sequence of characters (including the empty one)
+    - '?' matches any single character
+    - '[abc]', '[a-z]' match any character of the set
+    - '[!abc]', '[^a-z]' match any character not in the set
+    - '\\' escapes the next character (including ';' and '!')
+
+    Examples:
+        "*.txt;*.log" + "error.log" -> true
+        "!*.tmp;*" + "data.tmp" -> false
+        "!*.tmp" + "data.bin" -> true
+
+    Each pattern is compiled into literal prefix and suffix, which reject
+    most of strings with a single comparison, and the sequence of tokens
+    matched by the linear backtracking algorithm.
+
+    Thread-safe for matching.
+*/
+class GlobPattern
+{
+public:
+    //! Initialize an empty glob pattern which matches all strings
+    GlobPattern() noexcept : _ignore_case(false) {}
+    //! Compile glob pattern from the given patterns string
+    /*!
+        \param patterns - Patterns string
+        \param ignore_case - Match ASCII characters case insensitive (default is false)
+    */
+    explicit GlobPattern(std::string_view patterns, bool ignore_case = false);
+    GlobPattern(const GlobPattern&) = default;
+    GlobPattern(GlobPattern&&) noexcept = default;
+    ~GlobPattern() = default;
+
+    GlobPattern& operator=(const GlobPattern&) = default;
+    GlobPattern& operator=(GlobPattern&&) noexcept = default;
+
+    //! Check if the glob pattern is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the glob pattern empty (matches all strings)?
+    bool empty() const noexcept { return _rules.empty(); }
+    //! Get the source patterns string
+    const std::string& patterns() const noexcept { return _patterns; }
+    //! Get the count of compiled patterns
+    size_t size() const noexcept { return _rules.size(); }
+    //! Is the glob pattern case insensitive?
+    bool ignore_case() const noexcept { return _ignore_case; }
+
+    //! Match the given string
+    /*!
+        \param str - String to match
+        \return 'true' if the given string matches, 'false' if the given string does not match
+    */
+    bool Match(std::string_view str) const noexcept;
+    //! Match the given string
+    bool operator()(std::string_view str) const noexcept { return Match(str); }
+
+    //! Swap two instances
+    void swap(GlobPattern& pattern) noexcept;
+    friend void swap(GlobPattern& pattern1, GlobPattern& pattern2) noexcept
+    { pattern1.swap(pattern2); }
+
+private:
+    enum class TokenType : uint8_t { LITERAL, ANY, SET, STAR };
+
+    struct Token
+    {
+        TokenType type;
+        char literal;
+        uint32_t set;
+    };
+
+    struct Rule
+    {
+        bool negative;
+        bool fixed;
+        bool any;
+        size_t min_size;
+        std::string prefix;
+        std::string suffix;
+        size_t first;
+        size_t last;
+    };
+
+    std::string _patterns;
+    bool _ignore_case;
+    std::vector<Rule> _rules;
+    std::vector<Token> _tokens;
+    std::vector<std::array<uint64_t, 4>> _sets;
+
+    void Compile(std::string_view pattern);
+    bool MatchRule(const Rule& rule, std::string_view str) const noexcept;
+    bool MatchToken(const Token& token, char ch) const noexcept;
+    bool Equal(std::string_view str1, std::string_view str2) const noexcept;
+};
+
+/*! \example string_glob_pattern.cpp Compiled glob pattern example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_STRING_GLOB_PATTERN_H
@@ -0,0 +1,180 @@
+/*!
+    \file multi_pattern.h
+    \brief Compiled multi-pattern substring matcher definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_MULTI_PATTERN_H
+#define CPPCOMMON_STRING_MULTI_PATTERN_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Multi-pattern substring match
+struct PatternMatch
+{
+    //! Match position in the string
+    size_t position{0};
+    //! Match length
+    size_t length{0};
+    //! Index of the matched pattern
+    size_t pattern{0};
+};
+
+//! Compiled multi-pattern substring matcher
+/*!
+    Multi-pattern matcher is compiled once from the set of substrings and
+    then finds all of them in the string with a single pass, so the search
+    cost does not grow with the count of patterns as loops over
+    StringUtils::Find() do (e.g. log filtering or redaction with hundreds
+    of patterns per line).
+
+    Two search engines are used:
+    - Teddy (for small sets up to TEDDY_PATTERNS patterns on CPUs with
+      AVX2): patterns are grouped into eight buckets, and the fingerprint
+      of up to three leading pattern characters is matched against 32
+      string positions at once with nibble lookup tables (PSHUFB). Only
+      candidate positions are verified against patterns of their buckets;
+    - Aho-Corasick DFA (for large sets and other CPUs): the state machine
+      with precomputed transitions over compressed byte classes consumes
+      one string character per step without backtracking.
+
+    Patterns must not be empty. The same pattern could be added several
+    times, each copy is reported with its own index.
+
+    Thread-safe for matching.
+*/
+class MultiPattern
+{
+public:
+    //! Maximal count of patterns matched with Teddy engine
+    static const size_t TEDDY_PATTERNS = 64;
+
+    //! Initialize an empty multi-pattern matcher which matches nothing
+    MultiPattern() noexcept : _ignore_case(false), _teddy(false), _min_length(0), _fingerprint(0), _masks{}, _classes(0), _class{} {}
+    //! Compile multi-pattern matcher from the given patterns
+    /*!
+        Throws ArgumentException if some pattern is empty.
+
+        \param patterns - Patterns to match
+        \param ignore_case - Match ASCII characters case insensitive (default is false)
+    */
+    explicit MultiPattern(const std::vector<std::string>& patterns, bool ignore_case = false);
+    MultiPattern(const MultiPattern&) = default;
+    MultiPattern(MultiPattern&&) noexcept = default;
+    ~MultiPattern() = default;
+
+    MultiPattern& operator=(const MultiPattern&) = default;
+    MultiPattern& operator=(MultiPattern&&) noexcept = default;
+
+    //! Check if the multi-pattern matcher is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the multi-pattern matcher empty?
+    bool empty() const noexcept { return _patterns.empty(); }
+    //! Get the count of patterns
+    size_t size() const noexcept { return _patterns.size(); }
+    //! Get the source patterns
+    const std::vector<std::string>& patterns() const noexcept { return _patterns; }
+    //! Is the multi-pattern matcher case insensitive?
+    bool ignore_case() const noexcept { return _ignore_case; }
+    //! Is Teddy engine used?
+    bool teddy() const noexcept { return _teddy; }
+
+    //! Is the given string contains any pattern?
+    /*!
+        \param str - String to search in
+        \return 'true' if some pattern was found, 'false' if no pattern was found
+    */
+    bool Contains(std::string_view str) const noexcept;
+
+    //! Find all matches of all patterns in the given string
+    /*!
+        Overlapping matches are reported too.
+
+        \param str - String to search in
+        \return Matches sorted by the position and then by the pattern index
+    */
+    std::vector<PatternMatch> FindAll(std::string_view str) const;
+
+    //! Count all not overlapping matches in the given string
+    /*!
+        Matches are selected from left to right, the longest pattern wins
+        at the same position (the same rules as ReplaceAll() uses).
+
+        \param str - String to search in
+        \return Count of matches
+    */
+    size_t CountAll(std::string_view str) const;
+
+    //! Replace all not overlapping matches in the given string with the given string
+    /*!
+        Matches are selected from left to right, the longest pattern wins
+        at the same position.
+
+        \param str - String to modify
+        \param with - Replacement string
+        \return 'true' if some pattern was replaced, 'false' if no pattern was found
+    */
+    bool ReplaceAll(std::string& str, std::string_view with) const;
+    //! Replace all not overlapping matches in the given string with replacements of matched patterns
+    /*!
+        Throws ArgumentException if the count of replacements differs from the count of patterns.
+
+        \param str - String to modify
+        \param with - Replacement strings for each pattern
+        \return 'true' if some pattern was replaced, 'false' if no pattern was found
+    */
+    bool ReplaceAll(std::string& str, const std::vector<std::string>& with) const;
+
+    //! Swap two instances
+    void swap(MultiPattern& pattern) noexcept;
+    friend void swap(MultiPattern& pattern1, MultiPattern& pattern2) noexcept
+    { pattern1.swap(pattern2); }
+
+private:
+    std::vector<std::string> _patterns;
+    bool _ignore_case;
+    bool _teddy;
+    size_t _min_length;
+
+    // Teddy fingerprint length, bucket nibble masks and bucket patterns
+    size_t _fingerprint;
+    std::array<uint8_t, 3 * 32> _masks;
+    std::array<std::vector<uint32_t>, 8> _buckets;
+
+    // Aho-Corasick DFA transitions over byte classes, reported states and dictionary suffix links
+    size_t _classes;
+    std::array<uint16_t, 256> _class;
+    std::vector<uint32_t> _transitions;
+    std::vector<uint32_t> _report;
+    std::vector<uint32_t> _dictionary;
+    std::vector<uint32_t> _outputs;
+    std::vector<uint32_t> _output_patterns;
+
+    void CompileTeddy();
+    void CompileAhoCorasick();
+
+    template <typename TCallback>
+    bool SearchTeddy(std::string_view str, TCallback&& callback) const;
+    template <typename TCallback>
+    bool SearchAhoCorasick(std::string_view str, TCallback&& callback) const;
+    template <typename TCallback>
+    bool Search(std::string_view str, TCallback&& callback) const;
+
+    std::vector<PatternMatch> Select(std::string_view str) const;
+    bool Verify(std::string_view str, size_t position, uint32_t pattern) const noexcept;
+};
+
+/*! \example string_multi_pattern.cpp Compiled multi-pattern substring matcher example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_STRING_MULTI_PATTERN_H
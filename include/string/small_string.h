@@ -0,0 +1,173 @@
+/*!
+    \file small_string.h
+    \brief Small string definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_SMALL_STRING_H
+#define CPPCOMMON_STRING_SMALL_STRING_H
+
+#include "containers/small_vector.h"
+
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Small string
+/*!
+    Small string keeps up to N characters inline (with the additional null
+    terminator) in the small vector buffer, so short strings do not allocate
+    any memory. Longer strings spill into the memory allocated with the given
+    allocator.
+
+    Not thread-safe.
+*/
+template <size_t N, typename TAllocator = std::allocator<char>>
+class SmallString
+{
+public:
+    // Standard container type definitions
+    typedef char value_type;
+    typedef TAllocator allocator_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    //! Initialize the empty small string
+    /*!
+        \param allocator - Allocator of spilled characters (default is TAllocator())
+    */
+    explicit SmallString(const TAllocator& allocator = TAllocator()) : _data(allocator) { _data.push_back('\0'); }
+    //! Initialize the small string with the given C-string
+    /*!
+        \param str - C-string
+        \param allocator - Allocator of spilled characters (default is TAllocator())
+    */
+    SmallString(const char* str, const TAllocator& allocator = TAllocator()) : SmallString(std::string_view(str), allocator) {}
+    //! Initialize the small string with the given string
+    /*!
+        \param str - String
+        \param allocator - Allocator of spilled characters (default is TAllocator())
+    */
+    SmallString(std::string_view str, const TAllocator& allocator = TAllocator()) : SmallString(allocator) { append(str); }
+    SmallString(const SmallString&) = default;
+    SmallString(SmallString&&) = default;
+    ~SmallString() = default;
+
+    SmallString& operator=(std::string_view str) { assign(str); return *this; }
+    SmallString& operator=(const char* str) { assign(str); return *this; }
+    SmallString& operator=(const SmallString&) = default;
+    SmallString& operator=(SmallString&&) = default;
+
+    SmallString& operator+=(std::string_view str) { return append(str); }
+    SmallString& operator+=(char ch) { push_back(ch); return *this; }
+
+    //! Convert the small string to the string view
+    operator std::string_view() const noexcept { return std::string_view(data(), size()); }
+
+    //! Access to the character with the given index
+    char& operator[](size_t index) noexcept { assert((index < size()) && "Index out of bounds!"); return _data[index]; }
+    const char& operator[](size_t index) const noexcept { assert((index < size()) && "Index out of bounds!"); return _data[index]; }
+
+    //! Is the small string empty?
+    bool empty() const noexcept { return size() == 0; }
+    //! Is the small string characters stored inline?
+    bool is_inline() const noexcept { return _data.is_inline(); }
+
+    //! Get the small string size
+    size_t size() const noexcept { return _data.size() - 1; }
+    //! Get the small string length
+    size_t length() const noexcept { return size(); }
+    //! Get the small string capacity
+    size_t capacity() const noexcept { return _data.capacity() - 1; }
+    //! Get the small string inline capacity
+    static constexpr size_t inline_capacity() noexcept { return N; }
+
+    //! Get the small string data
+    char* data() noexcept { return _data.data(); }
+    const char* data() const noexcept { return _data.data(); }
+    //! Get the null-terminated C-string
+    const char* c_str() const noexcept { return _data.data(); }
+
+    //! Get the small string as std::string
+    std::string string() const { return std::string(data(), size()); }
+
+    //! Get the begin small string iterator
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return data(); }
+    //! Get the end small string iterator
+    iterator end() noexcept { return data() + size(); }
+    const_iterator end() const noexcept { return data() + size(); }
+    const_iterator cend() const noexcept { return data() + size(); }
+
+    //! Assign the given string
+    /*!
+        \param str - String to assign
+        \return Small string reference
+    */
+    SmallString& assign(std::string_view str);
+    //! Append the given string
+    /*!
+        \param str - String to append
+        \return Small string reference
+    */
+    SmallString& append(std::string_view str);
+    //! Append the given character
+    /*!
+        \param ch - Character to append
+    */
+    void push_back(char ch);
+    //! Pop the last character
+    void pop_back() noexcept;
+
+    //! Resize the small string
+    /*!
+        \param size - New small string size
+        \param ch - Character to fill (default is '\0')
+    */
+    void resize(size_t size, char ch = '\0');
+    //! Reserve the small string capacity to fit the given count of characters
+    /*!
+        \param count - Count of characters to fit
+    */
+    void reserve(size_t count) { _data.reserve(count + 1); }
+
+    //! Clear the small string
+    void clear() noexcept { _data.resize(1); _data[0] = '\0'; }
+
+    //! Swap two instances
+    void swap(SmallString& str) noexcept { _data.swap(str._data); }
+    template <size_t UN, typename UAllocator>
+    friend void swap(SmallString<UN, UAllocator>& str1, SmallString<UN, UAllocator>& str2) noexcept;
+
+    friend bool operator==(const SmallString& str1, std::string_view str2) noexcept
+    { return std::string_view(str1) == str2; }
+    friend bool operator!=(const SmallString& str1, std::string_view str2) noexcept
+    { return std::string_view(str1) != str2; }
+    friend bool operator<(const SmallString& str1, std::string_view str2) noexcept
+    { return std::string_view(str1) < str2; }
+
+    friend std::ostream& operator<<(std::ostream& os, const SmallString& str)
+    { return os << std::string_view(str); }
+
+private:
+    SmallVector<char, N + 1, TAllocator> _data; // Small string characters with the null terminator
+};
+
+} // namespace CppCommon
+
+#include "small_string.inl"
+
+#endif // CPPCOMMON_STRING_SMALL_STRING_H
@@ -0,0 +1,84 @@
+/*!
+    \file small_string.inl
+    \brief Small string inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <size_t N, typename TAllocator>
+inline SmallString<N, TAllocator>& SmallString<N, TAllocator>::assign(std::string_view str)
+{
+    // Move the assigned string if it refers to the small string itself
+    std::less_equal<const char*> less_equal;
+    if (less_equal(data(), str.data()) && less_equal(str.data(), data() + size()))
+    {
+        std::memmove(data(), str.data(), str.size());
+        _data.resize(str.size() + 1);
+        _data.back() = '\0';
+        return *this;
+    }
+
+    clear();
+    return append(str);
+}
+
+template <size_t N, typename TAllocator>
+inline SmallString<N, TAllocator>& SmallString<N, TAllocator>::append(std::string_view str)
+{
+    size_t offset = size();
+
+    // Restore the appended string if it refers to the small string itself
+    if ((offset + str.size()) > capacity())
+    {
+        std::less_equal<const char*> less_equal;
+        if (less_equal(data(), str.data()) && less_equal(str.data(), data() + offset))
+        {
+            size_t position = str.data() - data();
+            reserve(offset + str.size());
+            str = std::string_view(data() + position, str.size());
+        }
+        else
+            reserve(offset + str.size());
+    }
+
+    _data.resize(offset + str.size() + 1);
+    if (!str.empty())
+        std::memmove(_data.data() + offset, str.data(), str.size());
+    _data.back() = '\0';
+    return *this;
+}
+
+template <size_t N, typename TAllocator>
+inline void SmallString<N, TAllocator>::push_back(char ch)
+{
+    _data.back() = ch;
+    _data.push_back('\0');
+}
+
+template <size_t N, typename TAllocator>
+inline void SmallString<N, TAllocator>::pop_back() noexcept
+{
+    assert(!empty() && "Small string is empty!");
+
+    _data.pop_back();
+    _data.back() = '\0';
+}
+
+template <size_t N, typename TAllocator>
+inline void SmallString<N, TAllocator>::resize(size_t size, char ch)
+{
+    _data.back() = ch;
+    _data.resize(size + 1, ch);
+    _data.back() = '\0';
+}
+
+template <size_t N, typename TAllocator>
+inline void swap(SmallString<N, TAllocator>& str1, SmallString<N, TAllocator>& str2) noexcept
+{
+    str1.swap(str2);
+}
+
+} // namespace CppCommon
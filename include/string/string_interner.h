@@ -0,0 +1,176 @@
+/*!
+    \file string_interner.h
+    \brief String interner definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_STRING_INTERNER_H
+#define CPPCOMMON_STRING_STRING_INTERNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace CppCommon {
+
+class StringInterner;
+
+//! Interned string
+/*!
+    Interned string is a pointer sized handle to the unique string stored
+    in the string interner. Interned strings of the same interner are equal
+    only if they refer to the same string, so they are compared in O(1)
+    by the pointer. The string hash and the stable id are precomputed.
+
+    Interned string is valid until the string interner is destroyed.
+    Default constructed interned string represents an empty string.
+
+    Thread-safe.
+*/
+class InternedString
+{
+    friend class StringInterner;
+
+public:
+    InternedString() noexcept : _entry(nullptr) {}
+    InternedString(const InternedString&) noexcept = default;
+    InternedString(InternedString&&) noexcept = default;
+    ~InternedString() noexcept = default;
+
+    InternedString& operator=(const InternedString&) noexcept = default;
+    InternedString& operator=(InternedString&&) noexcept = default;
+
+    //! Check if the interned string is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Convert the interned string to the string view
+    operator std::string_view() const noexcept { return view(); }
+
+    //! Is the interned string empty?
+    bool empty() const noexcept { return (_entry == nullptr); }
+
+    //! Get the interned string data
+    const char* data() const noexcept { return (_entry != nullptr) ? _entry->data : ""; }
+    //! Get the null-terminated interned string
+    const char* c_str() const noexcept { return data(); }
+    //! Get the interned string size
+    size_t size() const noexcept { return (_entry != nullptr) ? _entry->size : 0; }
+    //! Get the interned string view
+    std::string_view view() const noexcept { return std::string_view(data(), size()); }
+    //! Get the interned string
+    std::string string() const { return std::string(view()); }
+
+    //! Get the precomputed interned string hash
+    size_t hash() const noexcept { return (_entry != nullptr) ? _entry->hash : 0; }
+    //! Get the stable interned string id (0 for the empty string)
+    uint64_t id() const noexcept { return (_entry != nullptr) ? _entry->id : 0; }
+
+    //! Compare interned strings by their identity
+    friend bool operator==(const InternedString& str1, const InternedString& str2) noexcept
+    { return str1._entry == str2._entry; }
+    friend bool operator!=(const InternedString& str1, const InternedString& str2) noexcept
+    { return str1._entry != str2._entry; }
+    //! Order interned strings by their ids
+    friend bool operator<(const InternedString& str1, const InternedString& str2) noexcept
+    { return str1.id() < str2.id(); }
+
+    //! Output interned string into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const InternedString& str)
+    { os << str.view(); return os; }
+
+    //! Swap two instances
+    void swap(InternedString& str) noexcept;
+    friend void swap(InternedString& str1, InternedString& str2) noexcept;
+
+private:
+    struct Entry
+    {
+        size_t hash;
+        uint64_t id;
+        size_t size;
+        char data[1];
+    };
+
+    const Entry* _entry;
+
+    explicit InternedString(const Entry* entry) noexcept : _entry(entry) {}
+};
+
+//! String interner
+/*!
+    String interner stores a single copy of each unique string and returns
+    interned string handles for them. Strings are stored in the arena memory
+    pages and never move, so duplicate-heavy workloads (keys of caches and
+    maps) store each string only once and compare keys in O(1).
+
+    String interner is lock-striped: strings are routed to stripes by their
+    hash, each stripe has its own arena, hash index and read/write lock. Lookup
+    of the already interned strings takes only the shared stripe lock.
+
+    Thread-safe.
+*/
+class StringInterner
+{
+public:
+    //! Initialize the string interner
+    /*!
+        \param stripes - Count of stripes (default is 0 - four stripes per hardware thread)
+        \param page - Arena page capacity in bytes (default is 65536)
+    */
+    explicit StringInterner(size_t stripes = 0, size_t page = 65536);
+    StringInterner(const StringInterner&) = delete;
+    StringInterner(StringInterner&&) = delete;
+    ~StringInterner();
+
+    StringInterner& operator=(const StringInterner&) = delete;
+    StringInterner& operator=(StringInterner&&) = delete;
+
+    //! Get the count of interned strings
+    size_t size() const;
+    //! Get the memory in bytes allocated for interned strings
+    size_t memory() const;
+    //! Get the count of stripes
+    size_t stripes() const noexcept;
+
+    //! Intern the given string
+    /*!
+        \param str - String to intern
+        \return Interned string (empty for the empty string)
+    */
+    InternedString Intern(std::string_view str);
+    //! Find the already interned string
+    /*!
+        \param str - String to find
+        \return Interned string or empty interned string if the given string is not interned
+    */
+    InternedString Find(std::string_view str) const;
+    //! Get the interned string by its stable id
+    /*!
+        \param id - Interned string id
+        \return Interned string or empty interned string if the given id is not valid
+    */
+    InternedString Get(uint64_t id) const;
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 64;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example string_interner.cpp String interner example */
+
+} // namespace CppCommon
+
+#include "string_interner.inl"
+
+#endif // CPPCOMMON_STRING_STRING_INTERNER_H
@@ -0,0 +1,36 @@
+/*!
+    \file string_interner.inl
+    \brief String interner inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void InternedString::swap(InternedString& str) noexcept
+{
+    using std::swap;
+    swap(_entry, str._entry);
+}
+
+inline void swap(InternedString& str1, InternedString& str2) noexcept
+{
+    str1.swap(str2);
+}
+
+} // namespace CppCommon
+
+//! \cond DOXYGEN_SKIP
+template <>
+struct std::hash<CppCommon::InternedString>
+{
+    typedef CppCommon::InternedString argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const noexcept
+    {
+        return value.hash();
+    }
+};
+//! \endcond
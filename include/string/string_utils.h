@@ -9,11 +9,17 @@
 #ifndef CPPCOMMON_STRING_STRING_UTILS_H
 #define CPPCOMMON_STRING_STRING_UTILS_H
 
+#include "string/small_string.h"
+
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace CppCommon {
@@ -23,6 +29,11 @@ namespace CppCommon {
     String utilities contains methods for UPPER/lower case conversions, join/split strings
     and other useful string manipulation methods.
 
+    Case conversions and blank characters checks are locale independent and
+    handle only ASCII characters, so UTF-8 strings are processed safely. Case
+    conversions, trimming and substring search process the bulk of strings
+    with AVX2 or NEON implementations selected for the current CPU in runtime.
+
     Thread-safe.
 */
 class StringUtils
@@ -67,6 +78,9 @@ public:
             "!Demo.*;!Live.*" + "LiveAccount" -> false
             "!Demo.*;!Live.*" + "UnknownAccount" -> true
 
+        Regular expressions are compiled on each call. Use GlobPattern to
+        compile glob patterns once and match them without allocations.
+
         \param patterns - Patterns to match with
         \param str - String to match
         \return 'true' if given string matches, 'false' if given string does not match
@@ -198,6 +212,19 @@ public:
     */
     static bool Contains(std::string_view str, std::string_view substr);
 
+    //! Find the first occurrence of substring
+    /*!
+        Candidate positions are selected by the first and the last characters
+        of the substring with SIMD comparisons, so the search is fast even if
+        the first character is frequent in the string.
+
+        \param str - String to search in
+        \param substr - Substring to find
+        \param pos - Position to start search from (default is 0)
+        \return Position of the first substring occurrence or std::string_view::npos if the substring was not found
+    */
+    static size_t Find(std::string_view str, std::string_view substr, size_t pos = 0) noexcept;
+
     //! Count all occurrences of substring
     /*!
         \param str - Modifying string
@@ -271,6 +298,87 @@ public:
     */
     static std::vector<std::string> SplitByAny(std::string_view str, std::string_view delimiters, bool skip_empty = false);
 
+    //! Lazy range of string tokens
+    /*!
+        Tokens range searches the next delimiter only when the iterator is
+        incremented and returns tokens as string views into the source string,
+        so splitting does not allocate memory at all. Source string must be
+        valid while tokens are used!
+    */
+    class TokenRange
+    {
+    public:
+        //! Initialize tokens range with the given delimiter character
+        TokenRange(std::string_view str, char delimiter, bool skip_empty) noexcept
+            : _str(str), _delimiter(), _symbol(delimiter), _skip_empty(skip_empty)
+        {}
+        //! Initialize tokens range with the given delimiter string
+        TokenRange(std::string_view str, std::string_view delimiter, bool skip_empty) noexcept
+            : _str(str), _delimiter((delimiter.data() != nullptr) ? delimiter : std::string_view("")), _symbol(0), _skip_empty(skip_empty)
+        {}
+
+        //! Tokens input iterator
+        class Iterator
+        {
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef std::string_view value_type;
+            typedef ptrdiff_t difference_type;
+            typedef const std::string_view* pointer;
+            typedef const std::string_view& reference;
+
+            Iterator() noexcept : _range(nullptr), _position(0) {}
+            explicit Iterator(const TokenRange* range) noexcept : _range(range), _position(0) { ++(*this); }
+
+            Iterator& operator++() noexcept;
+            Iterator operator++(int) noexcept { Iterator result(*this); ++(*this); return result; }
+
+            reference operator*() const noexcept { return _token; }
+            pointer operator->() const noexcept { return &_token; }
+
+            friend bool operator==(const Iterator& it1, const Iterator& it2) noexcept
+            { return (it1._range == it2._range) && (it1._position == it2._position); }
+            friend bool operator!=(const Iterator& it1, const Iterator& it2) noexcept
+            { return !(it1 == it2); }
+
+        private:
+            const TokenRange* _range;
+            size_t _position;
+            std::string_view _token;
+        };
+
+        //! Get the begin tokens iterator (finds the first token)
+        Iterator begin() const noexcept { return Iterator(this); }
+        //! Get the end tokens iterator
+        Iterator end() const noexcept { return Iterator(); }
+
+    private:
+        std::string_view _str;
+        // Delimiter character is used if the delimiter string is not set
+        std::string_view _delimiter;
+        char _symbol;
+        bool _skip_empty;
+    };
+
+    //! Split the string into the lazy range of string view tokens by the given delimiter character
+    /*!
+        \param str - String to split
+        \param delimiter - Delimiter character
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return Lazy range of tokens
+    */
+    static TokenRange SplitView(std::string_view str, char delimiter, bool skip_empty = false) noexcept
+    { return TokenRange(str, delimiter, skip_empty); }
+    //! Split the string into the lazy range of string view tokens by the given delimiter string
+    /*!
+        \param str - String to split
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return Lazy range of tokens
+    */
+    static TokenRange SplitView(std::string_view str, std::string_view delimiter, bool skip_empty = false) noexcept
+    { return TokenRange(str, delimiter, skip_empty); }
+
     //! Join tokens into the string
     /*!
         \param tokens - Vector of string tokens
@@ -307,22 +415,124 @@ public:
     */
     static std::string Join(const std::vector<std::string>& tokens, std::string_view delimiter, bool skip_empty = false, bool skip_blank = false);
 
-    //! Converts arbitrary datatypes into string using std::ostringstream
+    //! Split the string into the small vector of tokens by the given delimiter character
+    /*!
+        Small vector of small strings or string views does not allocate memory
+        while the count of tokens and their lengths fit inline capacities.
+
+        \param str - String to split
+        \param delimiter - Delimiter character
+        \param tokens - Small vector of tokens (cleared before splitting)
+        \param skip_empty - Skip empty substrings flag (default is false)
+    */
+    template <typename T, size_t N, typename TAllocator>
+    static void Split(std::string_view str, char delimiter, SmallVector<T, N, TAllocator>& tokens, bool skip_empty = false);
+    //! Split the string into the small vector of tokens by the given delimiter string
+    /*!
+        Small vector of small strings or string views does not allocate memory
+        while the count of tokens and their lengths fit inline capacities.
+
+        \param str - String to split
+        \param delimiter - Delimiter string
+        \param tokens - Small vector of tokens (cleared before splitting)
+        \param skip_empty - Skip empty substrings flag (default is false)
+    */
+    template <typename T, size_t N, typename TAllocator>
+    static void Split(std::string_view str, std::string_view delimiter, SmallVector<T, N, TAllocator>& tokens, bool skip_empty = false);
+
+    //! Join the small vector of tokens into the small string with delimiter character
+    /*!
+        \param tokens - Small vector of tokens
+        \param delimiter - Delimiter character
+        \param result - Joined small string
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \param skip_blank - Skip blank tokens flag (default is false)
+    */
+    template <typename T, size_t N, typename TAllocator, size_t M, typename TStringAllocator>
+    static void Join(const SmallVector<T, N, TAllocator>& tokens, char delimiter, SmallString<M, TStringAllocator>& result, bool skip_empty = false, bool skip_blank = false)
+    { Join(tokens, std::string_view(&delimiter, 1), result, skip_empty, skip_blank); }
+    //! Join the small vector of tokens into the small string with delimiter string
     /*!
+        \param tokens - Small vector of tokens
+        \param delimiter - Delimiter string
+        \param result - Joined small string
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \param skip_blank - Skip blank tokens flag (default is false)
+    */
+    template <typename T, size_t N, typename TAllocator, size_t M, typename TStringAllocator>
+    static void Join(const SmallVector<T, N, TAllocator>& tokens, std::string_view delimiter, SmallString<M, TStringAllocator>& result, bool skip_empty = false, bool skip_blank = false);
+
+    //! Converts arbitrary datatypes into string
+    /*!
+        Integer and floating point numbers are converted with std::to_chars()
+        (locale independent, shortest round-trip representation for floating
+        point). Other datatypes are converted using std::ostringstream.
+
         \param value - Value to convert
         \return Result converted string
     */
     template <typename T>
     static std::string ToString(const T& value);
-    //! Converts strings to arbitrary datatypes using std::istringstream
+    //! Converts strings to arbitrary datatypes
     /*!
+        Integer and floating point numbers are parsed with std::from_chars()
+        after skipping leading blanks and '+' sign. Trailing characters are
+        ignored and invalid numbers are converted to zero. Other datatypes
+        are converted using std::istringstream.
+
         \param str - String converted into the value
         \return Result converted value
     */
     template <typename T>
     static T FromString(std::string_view str);
 
+    //! Converts the number into the given buffer without memory allocation
+    /*!
+        \param value - Integer or floating point number to convert
+        \param buffer - Buffer to convert
+        \param size - Buffer size
+        \return Count of written characters or 0 if the buffer is too small
+    */
+    template <typename T>
+    static size_t ToChars(T value, char* buffer, size_t size) noexcept;
+    //! Try to convert the string into the number
+    /*!
+        The whole string except leading and trailing blanks must represent
+        the number, otherwise the conversion fails and the value is not modified.
+
+        \param str - String converted into the number
+        \param value - Result converted integer or floating point number
+        \return 'true' if the number was successfully converted, 'false' if the string is not a valid number
+    */
+    template <typename T>
+    static bool TryFromString(std::string_view str, T& value) noexcept;
+    //! Converts the string of delimited numbers into the given buffer without memory allocation
+    /*!
+        Useful to parse numeric columns of CSV lines. Conversion stops at the
+        first invalid or empty token or when the values buffer is full.
+
+        Examples:
+            "1,2,3" + ',' -> { 1, 2, 3 }, position = 5
+            "1, x,3" + ',' -> { 1 }, position = 2
+
+        \param str - String of delimited numbers
+        \param delimiter - Delimiter character
+        \param values - Buffer of integer or floating point numbers
+        \param size - Buffer size
+        \param position - Position of the first not converted token or the string size if all tokens were converted (default is nullptr)
+        \return Count of converted numbers
+    */
+    template <typename T>
+    static size_t FromStrings(std::string_view str, char delimiter, T* values, size_t size, size_t* position = nullptr) noexcept;
+
 private:
+    template <typename T>
+    static constexpr bool IsNumberInternal = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+        !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+    template <typename T>
+    static const char* ParseNumberInternal(const char* first, const char* last, T& value) noexcept;
+
     static bool IsBlankInternal(char ch);
     static char ToLowerInternal(char ch);
     static char ToUpperInternal(char ch);
@@ -10,7 +10,8 @@ namespace CppCommon {
 
 inline bool StringUtils::IsBlankInternal(char ch)
 {
-    return std::isspace(ch);
+    // Space, '\t', '\n', '\v', '\f', '\r' characters
+    return (ch == ' ') || ((uint8_t)(ch - '\t') < 5);
 }
 
 inline bool StringUtils::IsBlank(char ch)
@@ -20,7 +21,7 @@ inline bool StringUtils::IsBlank(char ch)
 
 inline char StringUtils::ToLowerInternal(char ch)
 {
-    return (char)std::tolower(ch);
+    return ((uint8_t)(ch - 'A') < 26) ? (char)(ch + ('a' - 'A')) : ch;
 }
 
 inline char StringUtils::ToLower(char ch)
@@ -30,7 +31,7 @@ inline char StringUtils::ToLower(char ch)
 
 inline char StringUtils::ToUpperInternal(char ch)
 {
-    return (char)std::toupper(ch);
+    return ((uint8_t)(ch - 'a') < 26) ? (char)(ch - ('a' - 'A')) : ch;
 }
 
 inline char StringUtils::ToUpper(char ch)
@@ -52,18 +53,6 @@ inline std::string StringUtils::ToUpper(std::string_view str)
     return result;
 }
 
-inline std::string& StringUtils::Lower(std::string& str)
-{
-    std::transform(str.begin(), str.end(), str.begin(), ToLowerInternal);
-    return str;
-}
-
-inline std::string& StringUtils::Upper(std::string& str)
-{
-    std::transform(str.begin(), str.end(), str.begin(), ToUpperInternal);
-    return str;
-}
-
 inline std::string& StringUtils::Trim(std::string& str)
 {
     return LTrim(RTrim(str));
@@ -89,12 +78,12 @@ inline bool StringUtils::Contains(std::string_view str, const char ch)
 
 inline bool StringUtils::Contains(std::string_view str, const char* substr)
 {
-    return (str.find(substr) != std::string::npos);
+    return (Find(str, substr) != std::string::npos);
 }
 
 inline bool StringUtils::Contains(std::string_view str, std::string_view substr)
 {
-    return (str.find(substr) != std::string::npos);
+    return (Find(str, substr) != std::string::npos);
 }
 
 inline bool StringUtils::StartsWith(std::string_view str, std::string_view prefix)
@@ -108,51 +97,109 @@ inline bool StringUtils::EndsWith(std::string_view str, std::string_view suffix)
 }
 
 template <typename T>
-inline std::string StringUtils::ToString(const T& value)
+inline const char* StringUtils::ParseNumberInternal(const char* first, const char* last, T& value) noexcept
 {
-    std::ostringstream ss;
-    ss << value;
-    return ss.str();
+    while ((first < last) && IsBlankInternal(*first))
+        ++first;
+    // std::from_chars() does not accept leading '+' sign
+    if ((first < last) && (*first == '+') && ((last - first) > 1) && (first[1] != '-'))
+        ++first;
+
+    auto [ptr, ec] = std::from_chars(first, last, value);
+    return (ec == std::errc()) ? ptr : nullptr;
 }
 
-template <>
-inline std::string StringUtils::ToString(const int8_t& value)
+template <typename T>
+inline size_t StringUtils::ToChars(T value, char* buffer, size_t size) noexcept
 {
-    std::ostringstream ss;
-    ss << (int32_t)value;
-    return ss.str();
+    static_assert(IsNumberInternal<T>, "Only integer and floating point numbers are supported!");
+
+    auto [ptr, ec] = std::to_chars(buffer, buffer + size, value);
+    return (ec == std::errc()) ? (size_t)(ptr - buffer) : 0;
 }
 
-template <>
-inline std::string StringUtils::ToString(const uint8_t& value)
+template <typename T>
+inline bool StringUtils::TryFromString(std::string_view str, T& value) noexcept
 {
-    std::ostringstream ss;
-    ss << (uint32_t)value;
-    return ss.str();
+    static_assert(IsNumberInternal<T>, "Only integer and floating point numbers are supported!");
+
+    const char* last = str.data() + str.size();
+    T result;
+    const char* ptr = ParseNumberInternal(str.data(), last, result);
+    if (ptr == nullptr)
+        return false;
+    while ((ptr < last) && IsBlankInternal(*ptr))
+        ++ptr;
+    if (ptr != last)
+        return false;
+
+    value = result;
+    return true;
 }
 
 template <typename T>
-inline T StringUtils::FromString(std::string_view str)
+inline size_t StringUtils::FromStrings(std::string_view str, char delimiter, T* values, size_t size, size_t* position) noexcept
 {
-    T result;
-    std::istringstream(std::string(str)) >> result;
-    return result;
+    static_assert(IsNumberInternal<T>, "Only integer and floating point numbers are supported!");
+
+    size_t count = 0;
+    size_t offset = 0;
+    while (!str.empty() && (count < size))
+    {
+        const char* first = str.data() + offset;
+        const char* found = (const char*)std::memchr(first, delimiter, str.size() - offset);
+        size_t length = (found != nullptr) ? (size_t)(found - first) : (str.size() - offset);
+
+        if (!TryFromString(std::string_view(first, length), values[count]))
+            break;
+
+        ++count;
+        if (found == nullptr)
+        {
+            offset = str.size();
+            break;
+        }
+        offset += length + 1;
+    }
+
+    if (position != nullptr)
+        *position = offset;
+    return count;
 }
 
-template <>
-inline int8_t StringUtils::FromString(std::string_view str)
+template <typename T>
+inline std::string StringUtils::ToString(const T& value)
 {
-    int32_t result;
-    std::istringstream(std::string(str)) >> result;
-    return (int8_t)result;
+    if constexpr (IsNumberInternal<T>)
+    {
+        // Enough for the shortest round-trip representation of any number
+        char buffer[128];
+        return std::string(buffer, ToChars(value, buffer, sizeof(buffer)));
+    }
+    else
+    {
+        std::ostringstream ss;
+        ss << value;
+        return ss.str();
+    }
 }
 
-template <>
-inline uint8_t StringUtils::FromString(std::string_view str)
+template <typename T>
+inline T StringUtils::FromString(std::string_view str)
 {
-    uint32_t result;
-    std::istringstream(std::string(str)) >> result;
-    return (uint8_t)result;
+    if constexpr (IsNumberInternal<T>)
+    {
+        T result = T();
+        if (ParseNumberInternal(str.data(), str.data() + str.size(), result) == nullptr)
+            return T();
+        return result;
+    }
+    else
+    {
+        T result;
+        std::istringstream(std::string(str)) >> result;
+        return result;
+    }
 }
 
 template <>
@@ -170,4 +217,122 @@ inline std::string_view StringUtils::FromString(std::string_view str)
 template <>
 bool StringUtils::FromString(std::string_view str);
 
+template <typename T, size_t N, typename TAllocator>
+inline void StringUtils::Split(std::string_view str, char delimiter, SmallVector<T, N, TAllocator>& tokens, bool skip_empty)
+{
+    tokens.clear();
+
+    size_t pos_current;
+    size_t pos_last = 0;
+    size_t length;
+
+    while (true)
+    {
+        pos_current = str.find(delimiter, pos_last);
+        if (pos_current == std::string::npos)
+            pos_current = str.size();
+
+        length = pos_current - pos_last;
+        if (!skip_empty || (length != 0))
+            tokens.emplace_back(str.substr(pos_last, length));
+
+        if (pos_current == str.size())
+            break;
+        else
+            pos_last = pos_current + 1;
+    }
+}
+
+template <typename T, size_t N, typename TAllocator>
+inline void StringUtils::Split(std::string_view str, std::string_view delimiter, SmallVector<T, N, TAllocator>& tokens, bool skip_empty)
+{
+    tokens.clear();
+
+    size_t pos_current;
+    size_t pos_last = 0;
+    size_t length;
+
+    while (true)
+    {
+        pos_current = Find(str, delimiter, pos_last);
+        if (pos_current == std::string::npos)
+            pos_current = str.size();
+
+        length = pos_current - pos_last;
+        if (!skip_empty || (length != 0))
+            tokens.emplace_back(str.substr(pos_last, length));
+
+        if (pos_current == str.size())
+            break;
+        else
+            pos_last = pos_current + delimiter.size();
+    }
+}
+
+inline StringUtils::TokenRange::Iterator& StringUtils::TokenRange::Iterator::operator++() noexcept
+{
+    for (;;)
+    {
+        // The last token was already returned
+        if (_position == std::string_view::npos)
+        {
+            _range = nullptr;
+            _position = 0;
+            return *this;
+        }
+
+        const std::string_view str = _range->_str;
+
+        size_t found;
+        size_t length;
+        if (_range->_delimiter.data() == nullptr)
+        {
+            found = str.find(_range->_symbol, _position);
+            length = 1;
+        }
+        else
+        {
+            found = _range->_delimiter.empty() ? std::string_view::npos : Find(str, _range->_delimiter, _position);
+            length = _range->_delimiter.size();
+        }
+
+        if (found == std::string_view::npos)
+        {
+            _token = str.substr(_position);
+            _position = std::string_view::npos;
+        }
+        else
+        {
+            _token = str.substr(_position, found - _position);
+            _position = found + length;
+        }
+
+        if (!_range->_skip_empty || !_token.empty())
+            return *this;
+    }
+}
+
+template <typename T, size_t N, typename TAllocator, size_t M, typename TStringAllocator>
+inline void StringUtils::Join(const SmallVector<T, N, TAllocator>& tokens, std::string_view delimiter, SmallString<M, TStringAllocator>& result, bool skip_empty, bool skip_blank)
+{
+    result.clear();
+
+    if (tokens.empty())
+        return;
+
+    for (size_t i = 0; i < tokens.size() - 1; ++i)
+    {
+        std::string_view token(tokens[i]);
+        if (!((skip_empty && token.empty()) || (skip_blank && IsBlank(token))))
+        {
+            result.append(token);
+            result.append(delimiter);
+        }
+    }
+
+    std::string_view token(tokens[tokens.size() - 1]);
+    if (!((skip_empty && token.empty()) || (skip_blank && IsBlank(token))))
+        result.append(token);
+}
+
 } // namespace CppCommon
@@ -0,0 +1,280 @@
+/*!
+    \file async_logger.h
+    \brief Asynchronous low-latency logger definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_ASYNC_LOGGER_H
+#define CPPCOMMON_SYSTEM_ASYNC_LOGGER_H
+
+#include "filesystem/file.h"
+#include "string/format.h"
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/spsc_ring_buffer.h"
+#include "threads/thread_local.h"
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Formatter of the serialized log record arguments
+typedef void (*AsyncLogFormatterFunction)(fmt::memory_buffer& buffer, std::string_view pattern, const uint8_t* data);
+
+// Fixed-size log record header followed by serialized arguments
+struct AsyncLogRecord
+{
+    uint32_t size;                          // Record size with arguments
+    uint32_t length;                        // Format pattern length
+    uint64_t timestamp;                     // Timestamp::tsc() value
+    const char* pattern;                    // Static format pattern
+    AsyncLogFormatterFunction formatter;    // Arguments formatter
+};
+
+static_assert((sizeof(AsyncLogRecord) == 32), "Async log record must be 32 bytes!");
+
+// Log ring buffer of the thread
+struct AsyncLogRing
+{
+    SPSCRingBuffer buffer;
+    uint64_t thread;
+    std::atomic<uint64_t> dropped;
+    std::atomic<bool> finished;
+
+    AsyncLogRing(size_t capacity, uint64_t thread_id) : buffer(capacity), thread(thread_id), dropped(0), finished(false) {}
+};
+
+// Type of the serialized log argument (strings are copied, other arguments are copied as raw bytes)
+template <typename T>
+using AsyncLogType = std::conditional_t<std::is_convertible_v<const std::decay_t<T>&, std::string_view>, std::string_view, std::decay_t<T>>;
+
+// Serialized log argument
+template <typename T>
+struct AsyncLogArgument
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Async log argument must be a string or a trivially copyable value!");
+
+    static size_t Size(const T&) noexcept { return sizeof(T); }
+    static uint8_t* Store(uint8_t* data, const T& value) noexcept
+    { std::memcpy(data, &value, sizeof(T)); return data + sizeof(T); }
+};
+
+// Serialized log string argument (32-bit length and characters)
+template <>
+struct AsyncLogArgument<std::string_view>
+{
+    static size_t Size(std::string_view value) noexcept { return sizeof(uint32_t) + value.size(); }
+    static uint8_t* Store(uint8_t* data, std::string_view value) noexcept
+    {
+        uint32_t size = (uint32_t)value.size();
+        std::memcpy(data, &size, sizeof(uint32_t));
+        std::memcpy(data + sizeof(uint32_t), value.data(), value.size());
+        return data + sizeof(uint32_t) + value.size();
+    }
+};
+
+// Formatter which deserializes log arguments one by one and formats them with the pattern
+template <typename... T>
+struct AsyncLogFormatter;
+
+template <>
+struct AsyncLogFormatter<>
+{
+    template <typename... TDecoded>
+    static void Format(fmt::memory_buffer& buffer, std::string_view pattern, const uint8_t*, const TDecoded&... decoded)
+    { fmt::vformat_to(std::back_inserter(buffer), fmt::string_view(pattern.data(), pattern.size()), fmt::make_format_args(decoded...)); }
+};
+
+template <typename THead, typename... TTail>
+struct AsyncLogFormatter<THead, TTail...>
+{
+    template <typename... TDecoded>
+    static void Format(fmt::memory_buffer& buffer, std::string_view pattern, const uint8_t* data, const TDecoded&... decoded);
+};
+
+template <typename... T>
+void AsyncLogFormat(fmt::memory_buffer& buffer, std::string_view pattern, const uint8_t* data)
+{ AsyncLogFormatter<T...>::Format(buffer, pattern, data); }
+
+} // namespace Internals
+//! @endcond
+
+//! Asynchronous low-latency logger
+/*!
+    Asynchronous logger moves formatting and file I/O out of the logging
+    threads. Producer serializes only the pointer to the static format
+    pattern, the pointer to the typed formatter, the Timestamp::tsc() value
+    and raw bytes of arguments (strings are copied with their length) into
+    the single producer / single consumer ring buffer of its thread. Nothing
+    is allocated, locked or formatted on the producer path, so it takes few
+    tens of nanoseconds. If the ring buffer of the thread is full the record
+    is dropped and counted, so producers never block.
+
+    Background writer thread periodically drains ring buffers of all threads,
+    merges records by their timestamps, formats them with format_to() into
+    the memory buffer and writes the log file in large batches:
+
+    \code
+    2026-10-14T12:34:56.123456789Z [12345] Order 42 filled at 101.25
+    \endcode
+
+    Log file is appended and rotated by size: the current file is renamed
+    into 'path.1', previous 'path.1' into 'path.2' and so on up to the
+    configured count of backups.
+
+    Format patterns are checked at compile time and must be string literals
+    or other strings with the static storage duration, because only the
+    pointer is recorded. Arguments must be strings or trivially copyable
+    values with the {fmt} formatter.
+
+    Thread-safe.
+*/
+class AsyncLogger
+{
+public:
+    //! Default capacity of the ring buffer of each thread in bytes
+    static const size_t DEFAULT_CAPACITY = 1048576;
+    //! Default count of the rotated log file backups
+    static const size_t DEFAULT_BACKUPS = 8;
+    //! Default size of the formatted output written at once
+    static const size_t DEFAULT_BATCH = 1048576;
+
+    //! Initialize the asynchronous logger
+    /*!
+        \param capacity - Capacity of the ring buffer of each thread in bytes (must be a power of two, default is DEFAULT_CAPACITY)
+    */
+    explicit AsyncLogger(size_t capacity = DEFAULT_CAPACITY);
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+    //! Close the opened log file
+    ~AsyncLogger();
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    //! Check if the logger is opened
+    explicit operator bool() const noexcept { return IsOpened(); }
+
+    //! Get the log file path
+    const Path& path() const noexcept { return _path; }
+    //! Get the capacity of the ring buffer of each thread in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the total count of written records
+    uint64_t records() const noexcept { return _records.load(std::memory_order_relaxed); }
+    //! Get the total count of log file rotations
+    uint64_t rotations() const noexcept { return _rotations.load(std::memory_order_relaxed); }
+    //! Get the total count of dropped records
+    uint64_t dropped() const;
+
+    //! Is the logger opened?
+    bool IsOpened() const noexcept { return _opened.load(std::memory_order_acquire); }
+
+    //! Open the log file and start the writer thread
+    /*!
+        Records logged while the logger was closed are written first.
+
+        \param path - Log file path
+        \param rotation - Size of the log file to rotate it (0 to disable rotation, default is 0)
+        \param backups - Count of the rotated log file backups (default is DEFAULT_BACKUPS)
+        \param period - Writer thread flush period (default is 10 milliseconds)
+        \param batch - Size of the formatted output written at once (default is DEFAULT_BATCH)
+    */
+    void Open(const Path& path, uint64_t rotation = 0, size_t backups = DEFAULT_BACKUPS, const Timespan& period = Timespan::milliseconds(10), size_t batch = DEFAULT_BATCH);
+    //! Stop the writer thread, write all logged records and close the log file
+    /*!
+        If the writer thread failed to write the log file the method will
+        rethrow its exception!
+    */
+    void Close();
+
+    //! Write all logged records into the log file
+    /*!
+        If the writer thread failed to write the log file the method will
+        rethrow its exception!
+
+        Will block.
+    */
+    void Flush();
+
+    //! Log the record with the given format pattern and arguments
+    /*!
+        Ring buffer of the current thread is created on the first record.
+        Records logged while the logger is closed are kept in ring buffers
+        until the next Open() call.
+
+        Will not block.
+
+        \param pattern - Format pattern (string literal)
+        \param args - Format arguments (strings or trivially copyable values)
+        \return 'true' if the record was successfully logged, 'false' if the ring buffer is full
+    */
+    template <typename... T>
+    bool Log(fmt::format_string<T...> pattern, T&&... args);
+
+private:
+    size_t _capacity;
+    Path _path;
+    uint64_t _rotation;
+    size_t _backups;
+    size_t _batch;
+    Timespan _period;
+    std::atomic<bool> _opened;
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _rotations;
+
+    // Monotonic to UTC timestamp conversion
+    uint64_t _base_tsc;
+    uint64_t _base_utc;
+
+    // Protects the list of ring buffers
+    mutable CriticalSection _lock;
+    std::vector<std::shared_ptr<Internals::AsyncLogRing>> _rings;
+    uint64_t _dropped;
+
+    // Protects the log file (single consumer of all ring buffers)
+    CriticalSection _drain;
+    File _file;
+    uint64_t _size;
+    fmt::memory_buffer _output;
+    uint64_t _second;
+    char _prefix[32];
+    std::exception_ptr _error;
+
+    // Writer thread
+    std::thread _writer;
+    std::atomic<bool> _stop;
+    EventAutoReset _wake;
+
+    // Ring buffer of the current thread (must be destroyed before ring buffers)
+    ThreadLocal<Internals::AsyncLogRing*> _ring;
+
+    Internals::AsyncLogRing* RegisterRing();
+    void Drain();
+    size_t Append(const Internals::AsyncLogRing& ring, const uint8_t* data);
+    void WriteOutput();
+    void Rotate();
+    void Writer();
+};
+
+/*! \example system_async_logger.cpp Asynchronous low-latency logger example */
+
+} // namespace CppCommon
+
+#include "async_logger.inl"
+
+#endif // CPPCOMMON_SYSTEM_ASYNC_LOGGER_H
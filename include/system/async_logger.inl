@@ -0,0 +1,62 @@
+/*!
+    \file async_logger.inl
+    \brief Asynchronous low-latency logger inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename THead, typename... TTail>
+template <typename... TDecoded>
+inline void AsyncLogFormatter<THead, TTail...>::Format(fmt::memory_buffer& buffer, std::string_view pattern, const uint8_t* data, const TDecoded&... decoded)
+{
+    if constexpr (std::is_same_v<THead, std::string_view>)
+    {
+        uint32_t size;
+        std::memcpy(&size, data, sizeof(uint32_t));
+        std::string_view value((const char*)(data + sizeof(uint32_t)), size);
+        AsyncLogFormatter<TTail...>::Format(buffer, pattern, data + sizeof(uint32_t) + size, decoded..., value);
+    }
+    else
+    {
+        // Serialized arguments are not aligned, so they are copied before formatting
+        alignas(THead) uint8_t storage[sizeof(THead)];
+        std::memcpy(storage, data, sizeof(THead));
+        const THead& value = *std::launder(reinterpret_cast<const THead*>(storage));
+        AsyncLogFormatter<TTail...>::Format(buffer, pattern, data + sizeof(THead), decoded..., value);
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename... T>
+inline bool AsyncLogger::Log(fmt::format_string<T...> pattern, T&&... args)
+{
+    Internals::AsyncLogRing* ring = _ring.get();
+
+    size_t size = sizeof(Internals::AsyncLogRecord) + (Internals::AsyncLogArgument<Internals::AsyncLogType<T>>::Size(args) + ... + 0);
+    std::span<uint8_t> space = (size <= ring->buffer.capacity()) ? ring->buffer.Prepare(size) : std::span<uint8_t>();
+    if (space.empty())
+    {
+        ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    fmt::string_view view = pattern;
+    Internals::AsyncLogRecord record = { (uint32_t)size, (uint32_t)view.size(), Timestamp::tsc(), view.data(), &Internals::AsyncLogFormat<Internals::AsyncLogType<T>...> };
+    std::memcpy(space.data(), &record, sizeof(record));
+
+    [[maybe_unused]] uint8_t* data = space.data() + sizeof(record);
+    ((data = Internals::AsyncLogArgument<Internals::AsyncLogType<T>>::Store(data, args)), ...);
+
+    ring->buffer.Commit(size);
+    return true;
+}
+
+} // namespace CppCommon
@@ -9,7 +9,14 @@
 #ifndef CPPCOMMON_SYSTEM_CONSOLE_H
 #define CPPCOMMON_SYSTEM_CONSOLE_H
 
+#include "common/writer.h"
+#include "errors/exceptions.h"
+#include "string/format.h"
+
 #include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace CppCommon {
 
@@ -78,7 +85,127 @@ public:
     static void SetColor(Color color, Color background = Color::BLACK);
 };
 
+//! Console buffer
+/*!
+    Console buffer accumulates text, color changes and cursor movements of
+    the whole console frame (e.g. dashboard redraw) into the single memory
+    buffer and writes it into the console standard output with the single
+    system call on Flush(). Color changes are encoded as ANSI escape
+    sequences and repeated changes to the current colors are skipped.
+
+    Unix implementation writes the buffer with write() after flushing the
+    standard output stream. Windows implementation enables virtual terminal
+    processing of the console and writes the whole frame with the single
+    WriteConsoleW() call, redirected output is written with WriteFile().
+
+    Console buffer is flushed on destruction.
+
+    Not thread-safe.
+*/
+class ConsoleBuffer : public Writer
+{
+public:
+    //! Initialize console buffer with the given capacity
+    /*!
+        \param capacity - Buffer capacity reserved for the console frame (default is 65536)
+    */
+    explicit ConsoleBuffer(size_t capacity = 65536);
+    ConsoleBuffer(const ConsoleBuffer&) = delete;
+    ConsoleBuffer(ConsoleBuffer&&) = delete;
+    ~ConsoleBuffer();
+
+    ConsoleBuffer& operator=(const ConsoleBuffer&) = delete;
+    ConsoleBuffer& operator=(ConsoleBuffer&&) = delete;
+
+    //! Is the console buffer empty?
+    bool empty() const noexcept { return _buffer.empty(); }
+    //! Get the console buffer size
+    size_t size() const noexcept { return _buffer.size(); }
+    //! Get the console buffer content
+    const std::string& buffer() const noexcept { return _buffer; }
+
+    //! Write a byte buffer into the console buffer
+    /*!
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size) override;
+    using Writer::Write;
+
+    //! Write the formatted text into the console buffer
+    /*!
+        \param pattern - Format string pattern
+        \param args - Format arguments
+        \return Console buffer reference
+    */
+    template <typename... T>
+    ConsoleBuffer& Print(fmt::format_string<T...> pattern, T&&... args);
+
+    //! Set console text color
+    /*!
+        \param color - Console text color
+        \param background - Console background color (default is Color::BLACK)
+        \return Console buffer reference
+    */
+    ConsoleBuffer& SetColor(Color color, Color background = Color::BLACK);
+    //! Reset console text and background colors to defaults
+    ConsoleBuffer& ResetColor();
+
+    //! Move cursor to the given position
+    /*!
+        \param row - Zero-based row
+        \param column - Zero-based column
+        \return Console buffer reference
+    */
+    ConsoleBuffer& MoveTo(int row, int column);
+    //! Move cursor up for the given count of rows
+    ConsoleBuffer& MoveUp(int count = 1) { return Move(count, 'A'); }
+    //! Move cursor down for the given count of rows
+    ConsoleBuffer& MoveDown(int count = 1) { return Move(count, 'B'); }
+    //! Move cursor right for the given count of columns
+    ConsoleBuffer& MoveRight(int count = 1) { return Move(count, 'C'); }
+    //! Move cursor left for the given count of columns
+    ConsoleBuffer& MoveLeft(int count = 1) { return Move(count, 'D'); }
+
+    //! Show cursor
+    ConsoleBuffer& ShowCursor() { _buffer.append("\033[?25h"); return *this; }
+    //! Hide cursor
+    ConsoleBuffer& HideCursor() { _buffer.append("\033[?25l"); return *this; }
+
+    //! Clear the whole screen and move cursor to the top-left position
+    ConsoleBuffer& ClearScreen() { _buffer.append("\033[2J\033[H"); return *this; }
+    //! Clear the current line from the cursor to its end
+    ConsoleBuffer& ClearLine() { _buffer.append("\033[K"); return *this; }
+
+    //! Discard the console buffer content
+    void Discard() noexcept { _buffer.clear(); }
+
+    //! Flush the console buffer into the console standard output
+    void Flush() override;
+
+    //! Output text into the console buffer
+    ConsoleBuffer& operator<<(std::string_view text) { _buffer.append(text); return *this; }
+    //! Output character into the console buffer
+    ConsoleBuffer& operator<<(char ch) { _buffer.push_back(ch); return *this; }
+    //! Output console text color into the console buffer
+    ConsoleBuffer& operator<<(Color color) { return SetColor(color); }
+    //! Output console text and background colors into the console buffer
+    ConsoleBuffer& operator<<(std::pair<Color, Color> colors) { return SetColor(colors.first, colors.second); }
+    //! Output arithmetic value into the console buffer
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, char>>>
+    ConsoleBuffer& operator<<(T value) { return Print("{}", value); }
+
+private:
+    std::string _buffer;
+    int _color;
+    int _background;
+
+    ConsoleBuffer& Move(int count, char direction);
+};
+
 /*! \example system_console.cpp Console management example */
+/*! \example system_console_buffer.cpp Console buffer example */
 
 } // namespace CppCommon
 
@@ -22,4 +22,11 @@ inline TOutputStream& operator<<(TOutputStream& stream, std::pair<Color, Color>
     return stream;
 }
 
+template <typename... T>
+inline ConsoleBuffer& ConsoleBuffer::Print(fmt::format_string<T...> pattern, T&&... args)
+{
+    CppCommon::format_to(_buffer, pattern, std::forward<T>(args)...);
+    return *this;
+}
+
 } // namespace CppCommon
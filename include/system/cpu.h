@@ -9,15 +9,67 @@
 #ifndef CPPCOMMON_SYSTEM_CPU_H
 #define CPPCOMMON_SYSTEM_CPU_H
 
+#include <cstddef>
 #include <cstdint>
+#include <ostream>
 #include <string>
 
 namespace CppCommon {
 
+//! CPU features
+/*!
+    Instruction set extensions supported by the CPU and enabled by the
+    operating system (e.g. AVX registers state is saved on context switch).
+    Features are used to select vectorized implementations at runtime in
+    portable binaries (see CPUDispatch).
+*/
+struct CPUFeatures
+{
+    // x86 features
+    bool sse2{false};               //!< SSE2
+    bool sse3{false};               //!< SSE3
+    bool ssse3{false};              //!< SSSE3
+    bool sse41{false};              //!< SSE4.1
+    bool sse42{false};              //!< SSE4.2 (including CRC32 instruction)
+    bool popcnt{false};             //!< POPCNT
+    bool pclmul{false};             //!< PCLMULQDQ carry-less multiplication
+    bool aes{false};                //!< AES-NI
+    bool sha{false};                //!< SHA extensions
+    bool avx{false};                //!< AVX
+    bool avx2{false};               //!< AVX2
+    bool fma{false};                //!< FMA3
+    bool bmi1{false};               //!< BMI1
+    bool bmi2{false};               //!< BMI2
+    bool lzcnt{false};              //!< LZCNT
+    bool avx512f{false};            //!< AVX-512 Foundation
+    bool avx512cd{false};           //!< AVX-512 Conflict Detection
+    bool avx512dq{false};           //!< AVX-512 Doubleword and Quadword
+    bool avx512bw{false};           //!< AVX-512 Byte and Word
+    bool avx512vl{false};           //!< AVX-512 Vector Length
+    bool avx512vbmi{false};         //!< AVX-512 Vector Byte Manipulation
+    bool avx512vpopcntdq{false};    //!< AVX-512 Vector Population Count
+
+    // ARM features
+    bool neon{false};               //!< NEON (Advanced SIMD)
+    bool crc32{false};              //!< ARMv8 CRC32 instructions
+    bool crypto{false};             //!< ARMv8 AES and PMULL instructions
+    bool sve{false};                //!< SVE
+    bool sve2{false};               //!< SVE2
+
+    //! Invariant time stamp counter (runs at a constant rate in all power states)
+    bool invariant_tsc{false};
+
+    //! L1 data cache line size in bytes
+    size_t cache_line{64};
+
+    //! Output CPU features into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const CPUFeatures& features);
+};
+
 //! CPU management static class
 /*!
     Provides CPU management functionality such as architecture, cores count,
-    clock speed, Hyper-Threading feature.
+    clock speed, Hyper-Threading feature and instruction set extensions.
 
     Thread-safe.
 */
@@ -46,6 +98,13 @@ public:
     static int64_t ClockSpeed();
     //! Is CPU Hyper-Threading enabled?
     static bool HyperThreading();
+    //! CPU features
+    /*!
+        Features are detected once on the first call.
+
+        \return CPU features
+    */
+    static const CPUFeatures& Features();
 };
 
 /*! \example system_cpu.cpp CPU management example */
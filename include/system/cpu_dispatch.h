@@ -0,0 +1,99 @@
+/*!
+    \file cpu_dispatch.h
+    \brief CPU features runtime dispatch definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_CPU_DISPATCH_H
+#define CPPCOMMON_SYSTEM_CPU_DISPATCH_H
+
+#include "system/cpu.h"
+
+#include <atomic>
+#include <utility>
+
+//! Compile the function for the given instruction set extensions
+/*!
+    Allows to compile vectorized implementations (e.g. CPU_TARGET("avx2,bmi2"))
+    in the portable binary built without -mavx2 and to call them only after
+    the runtime check of CPU features. Expands to nothing on compilers which
+    allow intrinsics without target options (MSVC).
+*/
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#define CPU_TARGET(features) __attribute__((target(features)))
+#else
+#define CPU_TARGET(features)
+#endif
+
+namespace CppCommon {
+
+template <typename TSignature>
+class CPUDispatch;
+
+//! CPU features runtime dispatch
+/*!
+    Selects the best implementation of the function for the current CPU once
+    and calls it through the function pointer afterwards (ifunc-style). The
+    resolver gets detected CPU features and returns the implementation which
+    is cached on the first call, so the dispatch cost is a single relaxed load
+    and an indirect call.
+
+    Dispatch is usually declared as a static variable:
+    \code{.cpp}
+    static CPUDispatch<size_t(const char*, size_t)> count([](const CPUFeatures& features)
+    {
+        return features.avx2 ? CountAVX2 : CountScalar;
+    });
+    size_t result = count(buffer, size);
+    \endcode
+
+    Thread-safe.
+*/
+template <typename TResult, typename... TArgs>
+class CPUDispatch<TResult(TArgs...)>
+{
+public:
+    //! Implementation function pointer
+    typedef TResult (*Function)(TArgs...);
+    //! Implementation resolver function pointer
+    typedef Function (*Resolver)(const CPUFeatures&);
+
+    //! Initialize CPU dispatch with the given resolver
+    /*!
+        \param resolver - Implementation resolver
+    */
+    explicit CPUDispatch(Resolver resolver) noexcept : _resolver(resolver), _function(nullptr) {}
+    CPUDispatch(const CPUDispatch&) = delete;
+    CPUDispatch(CPUDispatch&&) = delete;
+    ~CPUDispatch() = default;
+
+    CPUDispatch& operator=(const CPUDispatch&) = delete;
+    CPUDispatch& operator=(CPUDispatch&&) = delete;
+
+    //! Get the resolved implementation
+    Function function() const
+    {
+        Function resolved = _function.load(std::memory_order_relaxed);
+        if (resolved == nullptr)
+        {
+            // Concurrent resolutions give the same implementation
+            resolved = _resolver(CPU::Features());
+            _function.store(resolved, std::memory_order_relaxed);
+        }
+        return resolved;
+    }
+
+    //! Call the resolved implementation
+    TResult operator()(TArgs... args) const
+    { return function()(std::forward<TArgs>(args)...); }
+
+private:
+    Resolver _resolver;
+    mutable std::atomic<Function> _function;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_CPU_DISPATCH_H
@@ -0,0 +1,133 @@
+/*!
+    \file cpu_profiler.h
+    \brief Sampling CPU profiler definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_CPU_PROFILER_H
+#define CPPCOMMON_SYSTEM_CPU_PROFILER_H
+
+#include "filesystem/path.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! CPU profile sample
+struct CpuSample
+{
+    //! Frames addresses of the sampled stack trace (from the leaf frame to the root one)
+    std::vector<void*> frames;
+    //! Count of samples with the same stack trace
+    uint64_t count{0};
+};
+
+//! Sampling CPU profiler
+/*!
+    CPU profiler periodically interrupts threads which consume CPU time and
+    captures their stack traces with StackTrace::Capture(). The process CPU
+    timer (ITIMER_PROF) sends SIGPROF signal to the running thread with the
+    given frequency, so idle and blocked threads are never sampled.
+
+    Signal handler only captures frames addresses into the fixed-size slot
+    of the lock-free ring queue: nothing is allocated, locked or resolved
+    inside the handler. If the ring queue is full the sample is dropped and
+    counted. The background collector thread drains the ring queue and
+    aggregates same stack traces. Symbols are resolved only when the profile
+    is reported (Folded(), SavePprof()), so the sampling overhead is about a
+    few microseconds per sample (well below 1% at 100 Hz).
+
+    Profile is reported in the folded stacks format of flame graph tools
+    or saved in the legacy binary CPU profile format of gperftools which is
+    read by 'pprof' tool.
+
+    Signal handler stays installed after Stop() and ignores late signals, so
+    pending SIGPROF signals of the stopped timer never reach the previous
+    (e.g. ExceptionsHandler fatal) handler. Start the profiler after the
+    ExceptionsHandler::SetupProcess() call.
+
+    Supported only on Unix platforms, throws SystemException on others.
+
+    Thread-safe.
+*/
+class CpuProfiler
+{
+public:
+    CpuProfiler() = delete;
+    CpuProfiler(const CpuProfiler&) = delete;
+    CpuProfiler(CpuProfiler&&) = delete;
+    ~CpuProfiler() = delete;
+
+    CpuProfiler& operator=(const CpuProfiler&) = delete;
+    CpuProfiler& operator=(CpuProfiler&&) = delete;
+
+    //! Default sampling frequency in Hz
+    static const size_t DEFAULT_FREQUENCY = 100;
+    //! Default count of samples in the ring queue
+    static const size_t DEFAULT_CAPACITY = 4096;
+    //! Maximal count of captured frames per sample
+    static const int MAX_FRAMES = 64;
+
+    //! Is CPU profiler running?
+    static bool IsRunning() noexcept;
+
+    //! Get the sampling frequency in Hz
+    static size_t frequency() noexcept;
+    //! Get the total count of collected samples
+    static uint64_t samples() noexcept;
+    //! Get the total count of samples dropped because the ring queue was full
+    static uint64_t dropped() noexcept;
+
+    //! Start CPU profiling
+    /*!
+        Collected samples are kept over restarts until Reset() is called.
+
+        \param frequency - Sampling frequency in Hz (default is DEFAULT_FREQUENCY)
+        \param capacity - Count of samples in the ring queue (must be a power of two, default is DEFAULT_CAPACITY)
+    */
+    static void Start(size_t frequency = DEFAULT_FREQUENCY, size_t capacity = DEFAULT_CAPACITY);
+    //! Stop CPU profiling
+    /*!
+        Stops the timer, waits for the collector thread and collects all
+        remaining samples. Does nothing if the profiler is not running.
+    */
+    static void Stop();
+
+    //! Reset collected samples and counters
+    static void Reset();
+
+    //! Take the snapshot of collected samples
+    /*!
+        \return Aggregated samples sorted by their count in descending order
+    */
+    static std::vector<CpuSample> Snapshot();
+
+    //! Report collected samples in the folded stacks format
+    /*!
+        Each line contains function names of the stack trace from the root
+        frame to the leaf one separated with ';' and followed by the count
+        of samples ("main;foo;bar 42"). Frames without symbols are reported
+        with their addresses.
+
+        \return Folded stacks report
+    */
+    static std::string Folded();
+
+    //! Save collected samples in the gperftools CPU profile format
+    /*!
+        Throws FileSystemException if the profile file cannot be written.
+
+        \param path - Profile file path
+    */
+    static void SavePprof(const Path& path);
+};
+
+/*! \example system_cpu_profiler.cpp Sampling CPU profiler example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_CPU_PROFILER_H
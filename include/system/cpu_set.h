@@ -0,0 +1,124 @@
+/*!
+    \file cpu_set.h
+    \brief CPU set definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_CPU_SET_H
+#define CPPCOMMON_SYSTEM_CPU_SET_H
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! CPU set
+/*!
+    Dynamic set of logical CPU indexes without the limit of 64 CPUs. It is
+    used to describe the CPU topology (SMT siblings, cache sharing, sockets
+    and NUMA nodes) and thread CPU affinity on large machines.
+
+    CPU set could be parsed from and formatted to the Linux CPU list format
+    (e.g. "0-3,8,10-11").
+
+    Not thread-safe.
+*/
+class CPUSet
+{
+public:
+    CPUSet() = default;
+    //! Initialize CPU set with the given CPU affinity bitset
+    /*!
+        \param bitset - CPU affinity bitset
+    */
+    explicit CPUSet(const std::bitset<64>& bitset);
+    //! Initialize CPU set with the given list of CPU indexes
+    /*!
+        \param cpus - List of CPU indexes
+    */
+    CPUSet(std::initializer_list<int> cpus);
+    CPUSet(const CPUSet&) = default;
+    CPUSet(CPUSet&&) noexcept = default;
+    ~CPUSet() = default;
+
+    CPUSet& operator=(const CPUSet&) = default;
+    CPUSet& operator=(CPUSet&&) noexcept = default;
+
+    //! Check if the CPU set is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the CPU set empty?
+    bool empty() const noexcept;
+    //! Get the count of CPUs in the set
+    size_t count() const noexcept;
+    //! Get the size of the CPU set (maximal CPU index + 1)
+    int size() const noexcept;
+
+    //! Get the first CPU index in the set (-1 if the set is empty)
+    int first() const noexcept { return next(-1); }
+    //! Get the next CPU index in the set after the given one (-1 if there is no more CPUs)
+    int next(int cpu) const noexcept;
+
+    //! Is the given CPU in the set?
+    bool test(int cpu) const noexcept;
+    //! Add or remove the given CPU
+    /*!
+        \param cpu - CPU index
+        \param value - Add ('true') or remove ('false') the CPU (default is true)
+        \return CPU set reference
+    */
+    CPUSet& set(int cpu, bool value = true);
+    //! Remove the given CPU
+    CPUSet& reset(int cpu) { return set(cpu, false); }
+    //! Remove all CPUs
+    void clear() noexcept { _words.clear(); }
+
+    //! Get the vector of CPU indexes in the set
+    std::vector<int> cpus() const;
+    //! Get the CPU affinity bitset of the first 64 CPUs
+    std::bitset<64> bitset() const noexcept;
+    //! Get the CPU list string (e.g. "0-3,8,10-11")
+    std::string string() const;
+
+    //! Parse the CPU set from the CPU list string (e.g. "0-3,8,10-11")
+    /*!
+        \param list - CPU list string
+        \return Parsed CPU set (invalid ranges are skipped)
+    */
+    static CPUSet Parse(const std::string& list);
+
+    CPUSet& operator|=(const CPUSet& cpuset);
+    CPUSet& operator&=(const CPUSet& cpuset) noexcept;
+    friend CPUSet operator|(CPUSet cpuset1, const CPUSet& cpuset2)
+    { return cpuset1 |= cpuset2; }
+    friend CPUSet operator&(CPUSet cpuset1, const CPUSet& cpuset2)
+    { return cpuset1 &= cpuset2; }
+
+    friend bool operator==(const CPUSet& cpuset1, const CPUSet& cpuset2) noexcept;
+    friend bool operator!=(const CPUSet& cpuset1, const CPUSet& cpuset2) noexcept
+    { return !(cpuset1 == cpuset2); }
+
+    //! Output CPU set into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const CPUSet& cpuset)
+    { os << cpuset.string(); return os; }
+
+    //! Swap two instances
+    void swap(CPUSet& cpuset) noexcept;
+    friend void swap(CPUSet& cpuset1, CPUSet& cpuset2) noexcept;
+
+private:
+    std::vector<uint64_t> _words;
+};
+
+} // namespace CppCommon
+
+#include "cpu_set.inl"
+
+#endif // CPPCOMMON_SYSTEM_CPU_SET_H
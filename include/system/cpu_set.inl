@@ -0,0 +1,156 @@
+/*!
+    \file cpu_set.inl
+    \brief CPU set inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline CPUSet::CPUSet(const std::bitset<64>& bitset)
+{
+    uint64_t word = bitset.to_ullong();
+    if (word != 0)
+        _words.push_back(word);
+}
+
+inline CPUSet::CPUSet(std::initializer_list<int> cpus)
+{
+    for (int cpu : cpus)
+        set(cpu);
+}
+
+inline bool CPUSet::empty() const noexcept
+{
+    for (uint64_t word : _words)
+        if (word != 0)
+            return false;
+    return true;
+}
+
+inline size_t CPUSet::count() const noexcept
+{
+    size_t result = 0;
+    for (uint64_t word : _words)
+        for (; word != 0; word &= (word - 1))
+            ++result;
+    return result;
+}
+
+inline int CPUSet::size() const noexcept
+{
+    for (size_t i = _words.size(); i-- > 0;)
+    {
+        uint64_t word = _words[i];
+        if (word == 0)
+            continue;
+
+        int bit = 63;
+        while ((word & (1ull << bit)) == 0)
+            --bit;
+        return (int)(i * 64) + bit + 1;
+    }
+    return 0;
+}
+
+inline int CPUSet::next(int cpu) const noexcept
+{
+    size_t index = (size_t)(cpu + 1);
+    for (size_t i = index / 64; i < _words.size(); ++i)
+    {
+        uint64_t word = _words[i];
+        if (i == (index / 64))
+            word &= ~0ull << (index % 64);
+        if (word == 0)
+            continue;
+
+        int bit = 0;
+        while ((word & (1ull << bit)) == 0)
+            ++bit;
+        return (int)(i * 64) + bit;
+    }
+    return -1;
+}
+
+inline bool CPUSet::test(int cpu) const noexcept
+{
+    if (cpu < 0)
+        return false;
+
+    size_t index = (size_t)cpu / 64;
+    return (index < _words.size()) && ((_words[index] & (1ull << (cpu % 64))) != 0);
+}
+
+inline CPUSet& CPUSet::set(int cpu, bool value)
+{
+    if (cpu < 0)
+        return *this;
+
+    size_t index = (size_t)cpu / 64;
+    if (value)
+    {
+        if (index >= _words.size())
+            _words.resize(index + 1, 0);
+        _words[index] |= (1ull << (cpu % 64));
+    }
+    else if (index < _words.size())
+        _words[index] &= ~(1ull << (cpu % 64));
+    return *this;
+}
+
+inline std::vector<int> CPUSet::cpus() const
+{
+    std::vector<int> result;
+    result.reserve(count());
+    for (int cpu = first(); cpu >= 0; cpu = next(cpu))
+        result.push_back(cpu);
+    return result;
+}
+
+inline std::bitset<64> CPUSet::bitset() const noexcept
+{
+    return std::bitset<64>(_words.empty() ? 0 : _words[0]);
+}
+
+inline CPUSet& CPUSet::operator|=(const CPUSet& cpuset)
+{
+    if (_words.size() < cpuset._words.size())
+        _words.resize(cpuset._words.size(), 0);
+    for (size_t i = 0; i < cpuset._words.size(); ++i)
+        _words[i] |= cpuset._words[i];
+    return *this;
+}
+
+inline CPUSet& CPUSet::operator&=(const CPUSet& cpuset) noexcept
+{
+    for (size_t i = 0; i < _words.size(); ++i)
+        _words[i] &= (i < cpuset._words.size()) ? cpuset._words[i] : 0;
+    return *this;
+}
+
+inline bool operator==(const CPUSet& cpuset1, const CPUSet& cpuset2) noexcept
+{
+    size_t size = std::max(cpuset1._words.size(), cpuset2._words.size());
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint64_t word1 = (i < cpuset1._words.size()) ? cpuset1._words[i] : 0;
+        uint64_t word2 = (i < cpuset2._words.size()) ? cpuset2._words[i] : 0;
+        if (word1 != word2)
+            return false;
+    }
+    return true;
+}
+
+inline void CPUSet::swap(CPUSet& cpuset) noexcept
+{
+    using std::swap;
+    swap(_words, cpuset._words);
+}
+
+inline void swap(CPUSet& cpuset1, CPUSet& cpuset2) noexcept
+{
+    cpuset1.swap(cpuset2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,145 @@
+/*!
+    \file cpu_topology.h
+    \brief CPU topology definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_CPU_TOPOLOGY_H
+#define CPPCOMMON_SYSTEM_CPU_TOPOLOGY_H
+
+#include "system/cpu_set.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace CppCommon {
+
+//! CPU cache type
+enum class CPUCacheType
+{
+    Unified,        //!< Unified cache
+    Data,           //!< Data cache
+    Instruction     //!< Instruction cache
+};
+
+//! CPU cache
+struct CPUCache
+{
+    //! Cache level (1, 2, 3...)
+    int level{0};
+    //! Cache type
+    CPUCacheType type{CPUCacheType::Unified};
+    //! Cache size in bytes
+    size_t size{0};
+    //! Cache line size in bytes
+    size_t line_size{0};
+    //! Set of logical CPUs sharing the cache
+    CPUSet cpus;
+};
+
+//! Logical CPU location in the CPU topology
+struct CPULocation
+{
+    //! Logical CPU index
+    int cpu{-1};
+    //! Physical core index in CPUTopology::cores()
+    int core{-1};
+    //! Socket index in CPUTopology::sockets()
+    int socket{-1};
+    //! NUMA node index in CPUTopology::nodes()
+    int node{-1};
+};
+
+//! CPU topology
+/*!
+    CPU topology describes online logical CPUs, their SMT siblings (physical
+    cores), sockets, NUMA nodes and caches with the sets of CPUs sharing them.
+    It allows to place cooperating threads close to each other (e.g. producer
+    and consumer pair on CPUs sharing L2 cache) or apart (on different NUMA
+    nodes) with Thread::SetAffinity() taking the CPU set.
+
+    Topology is discovered from sysfs on Linux and with
+    GetLogicalProcessorInformationEx() on Windows (all processor groups).
+    On Apple platform only counts are available, so the topology is
+    approximated (single socket and NUMA node, consecutive SMT siblings).
+
+    Not thread-safe, but CPUTopology::Current() is thread-safe.
+*/
+class CPUTopology
+{
+public:
+    CPUTopology() = default;
+    CPUTopology(const CPUTopology&) = default;
+    CPUTopology(CPUTopology&&) noexcept = default;
+    ~CPUTopology() = default;
+
+    CPUTopology& operator=(const CPUTopology&) = default;
+    CPUTopology& operator=(CPUTopology&&) noexcept = default;
+
+    //! Set of online logical CPUs
+    const CPUSet& online() const noexcept { return _online; }
+    //! Locations of online logical CPUs ordered by the CPU index
+    const std::vector<CPULocation>& cpus() const noexcept { return _cpus; }
+    //! Physical cores (sets of SMT siblings)
+    const std::vector<CPUSet>& cores() const noexcept { return _cores; }
+    //! Sockets (sets of logical CPUs in the same physical package)
+    const std::vector<CPUSet>& sockets() const noexcept { return _sockets; }
+    //! NUMA nodes (sets of logical CPUs of the same NUMA node)
+    const std::vector<CPUSet>& nodes() const noexcept { return _nodes; }
+    //! Caches (each cache is listed once with all CPUs sharing it)
+    const std::vector<CPUCache>& caches() const noexcept { return _caches; }
+
+    //! Find the location of the given logical CPU
+    /*!
+        \param cpu - Logical CPU index
+        \return Pointer to the CPU location or nullptr if the CPU is not online
+    */
+    const CPULocation* Find(int cpu) const noexcept;
+    //! Get the SMT siblings of the given logical CPU (including itself)
+    CPUSet Siblings(int cpu) const;
+    //! Get the logical CPUs sharing the given cache level (data or unified) with the given logical CPU (including itself)
+    CPUSet SharedCache(int cpu, int level) const;
+    //! Get the cache of the given level (data or unified) of the given logical CPU
+    /*!
+        \param cpu - Logical CPU index
+        \param level - Cache level
+        \return Pointer to the cache or nullptr if there is no such cache
+    */
+    const CPUCache* FindCache(int cpu, int level) const noexcept;
+    //! Get the cache domains of the given level (sets of logical CPUs sharing data or unified cache)
+    std::vector<CPUSet> CacheDomains(int level) const;
+
+    //! Get the current CPU topology
+    /*!
+        Topology is discovered once on the first call.
+
+        \return Current CPU topology
+    */
+    static const CPUTopology& Current();
+    //! Discover the CPU topology
+    /*!
+        \return Discovered CPU topology
+    */
+    static CPUTopology Discover();
+
+private:
+    CPUSet _online;
+    std::vector<CPULocation> _cpus;
+    std::vector<CPUSet> _cores;
+    std::vector<CPUSet> _sockets;
+    std::vector<CPUSet> _nodes;
+    std::vector<CPUCache> _caches;
+
+    //! Add the cache shared by the given CPUs if it is not added yet
+    void AddCache(const CPUCache& cache);
+    //! Fill CPU locations from cores, sockets and nodes
+    void UpdateLocations();
+};
+
+/*! \example system_cpu_topology.cpp CPU topology example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_CPU_TOPOLOGY_H
@@ -9,10 +9,14 @@
 #ifndef CPPCOMMON_SYSTEM_DLL_H
 #define CPPCOMMON_SYSTEM_DLL_H
 
+#include "common/flags.h"
 #include "filesystem/path.h"
 #include "system/exceptions.h"
 
+#include <cassert>
+#include <cstdint>
 #include <memory>
+#include <utility>
 
 //! DLL export macro
 /*!
@@ -46,23 +50,91 @@
 
 namespace CppCommon {
 
+//! Dynamic link library load flags (Unix specific)
+enum class DLLFlags
+{
+    NONE     = 0x00,    //!< Resolve all symbols at load time (RTLD_NOW)
+    LAZY     = 0x01,    //!< Resolve function symbols on the first call (RTLD_LAZY)
+    GLOBAL   = 0x02,    //!< Make symbols available for subsequently loaded libraries (RTLD_GLOBAL)
+    NODELETE = 0x04,    //!< Do not unload the library from the memory on unload (RTLD_NODELETE)
+    DEEPBIND = 0x08     //!< Prefer own symbols to global symbols with the same name (RTLD_DEEPBIND, Linux only)
+};
+
 //! Dynamic link library
 /*!
     Dynamic link library wraps dll operations (load, resolve, unload).
 
+    Symbol resolution with Resolve() looks up the symbol by its name on each
+    call. Typed symbol handles (DLL::Symbol) resolve the symbol once and keep
+    its address until the library is unloaded, so they are suitable for hot
+    paths. Symbol table could be resolved at once after loading the library
+    with ResolveAll().
+
     Not thread-safe.
 */
 class DLL
 {
 public:
+    //! Cached typed symbol handle
+    /*!
+        Symbol handle resolves the symbol by its name on the first access and
+        caches its address until the library is unloaded or reloaded. Symbol
+        handle must not outlive its library instance.
+
+        Not thread-safe. Symbol handles resolved with DLL::ResolveAll() could
+        be shared between threads while the library stays loaded.
+    */
+    template <typename T>
+    class Symbol
+    {
+        friend class DLL;
+
+    public:
+        //! Initialize the symbol handle with the given library and symbol name
+        /*!
+            \param dll - Dynamic link library
+            \param name - Symbol name
+        */
+        Symbol(const DLL& dll, const std::string& name) : _dll(&dll), _name(name), _address(nullptr), _generation(0) {}
+        Symbol(const Symbol&) = default;
+        Symbol(Symbol&&) = default;
+        ~Symbol() = default;
+
+        Symbol& operator=(const Symbol&) = default;
+        Symbol& operator=(Symbol&&) = default;
+
+        //! Check if the symbol is resolved
+        explicit operator bool() const { return (get() != nullptr); }
+
+        //! Get the symbol name
+        const std::string& name() const noexcept { return _name; }
+
+        //! Get the resolved symbol
+        /*!
+            \return A pointer to the resolved symbol or nullptr in case of symbol resolution failed
+        */
+        T* get() const;
+
+        //! Call the resolved function symbol
+        template <typename... Args>
+        decltype(auto) operator()(Args&&... args) const { return (*get())(std::forward<Args>(args)...); }
+
+    private:
+        const DLL* _dll;
+        std::string _name;
+        mutable void* _address;
+        mutable uint64_t _generation;
+    };
+
     //! Initialize the dynamic link library with an empty path
     DLL();
     //! Initialize the dynamic link library with a given path and optionally load it
     /*!
         \param path - Dynamic link library path
         \param load - Load library flag (default is true)
+        \param flags - Load flags (default is DLLFlags::NONE)
     */
-    DLL(const Path& path, bool load = true);
+    DLL(const Path& path, bool load = true, const Flags<DLLFlags>& flags = DLLFlags::NONE);
     DLL(const DLL& dll);
     DLL(DLL&& dll) noexcept;
     ~DLL();
@@ -85,15 +157,17 @@ public:
 
     //! Load dynamic link library
     /*!
+        \param flags - Load flags (default is DLLFlags::NONE)
         \return 'true' if the library was successfully loaded, 'false' if the library was not loaded
     */
-    bool Load();
+    bool Load(const Flags<DLLFlags>& flags = DLLFlags::NONE);
     //! Load dynamic link library with a given path
     /*!
         \param path - Dynamic link library path
+        \param flags - Load flags (default is DLLFlags::NONE)
         \return 'true' if the library was successfully loaded, 'false' if the library was not loaded
     */
-    bool Load(const Path& path);
+    bool Load(const Path& path, const Flags<DLLFlags>& flags = DLLFlags::NONE);
 
     //! Unload dynamic link library
     /*!
@@ -110,6 +184,17 @@ public:
     template <typename T>
     T* Resolve(const std::string& name) const;
 
+    //! Resolve all given symbol handles
+    /*!
+        Symbol table is resolved once after loading the library, so resolved
+        symbol handles are not looked up on the first call.
+
+        \param symbols - Symbol handles of the library
+        \return 'true' if all symbols were successfully resolved, 'false' if any symbol resolution failed
+    */
+    template <typename... T>
+    bool ResolveAll(Symbol<T>&... symbols) const;
+
     //! Get the dynamic link library prefix
     /*!
         Cygwin: cyg
@@ -145,6 +230,9 @@ private:
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 
+    // Unique generation of the loaded library (zero if the library is not loaded)
+    uint64_t _generation;
+
     //! Resolve dynamic link library symbol by the given name
     /*!
         \param name - Symbol name
@@ -6,14 +6,38 @@
     \copyright MIT License
 */
 
+ENUM_FLAGS(CppCommon::DLLFlags)
+
 namespace CppCommon {
 
+template <typename T>
+inline T* DLL::Symbol<T>::get() const
+{
+    // Resolve the symbol again only if the library was reloaded
+    if (_generation != _dll->_generation)
+    {
+        _address = _dll->IsLoaded() ? _dll->ResolveAddress(_name) : nullptr;
+        _generation = _dll->_generation;
+    }
+    return (T*)_address;
+}
+
 template <typename T>
 inline T* DLL::Resolve(const std::string& name) const
 {
     return (T*)ResolveAddress(name);
 }
 
+template <typename... T>
+inline bool DLL::ResolveAll(Symbol<T>&... symbols) const
+{
+    assert(((symbols._dll == this) && ...) && "Symbol handles must belong to the library!");
+
+    bool result = true;
+    ((result &= (symbols.get() != nullptr)), ...);
+    return result;
+}
+
 inline std::string DLL::prefix()
 {
 #if defined(__CYGWIN__)
@@ -11,11 +11,93 @@
 
 #include "errors/exceptions.h"
 
+#include <charconv>
+#include <cstdint>
 #include <map>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CppCommon {
 
+//! Environment variables snapshot
+/*!
+    Immutable snapshot of environment variables with the open addressing
+    hash table index. Lookups do not allocate memory and return views
+    into the snapshot storage. Windows environment variable names are
+    case-insensitive.
+
+    Thread-safe.
+*/
+class EnvironmentSnapshot
+{
+public:
+    //! Environment variable (name and value)
+    typedef std::pair<std::string, std::string> Envar;
+
+    //! Build the snapshot from the given environment variables
+    /*!
+        \param envars - Environment variables
+    */
+    explicit EnvironmentSnapshot(std::vector<Envar> envars);
+    EnvironmentSnapshot(const EnvironmentSnapshot&) = delete;
+    EnvironmentSnapshot(EnvironmentSnapshot&&) = delete;
+    ~EnvironmentSnapshot() = default;
+
+    EnvironmentSnapshot& operator=(const EnvironmentSnapshot&) = delete;
+    EnvironmentSnapshot& operator=(EnvironmentSnapshot&&) = delete;
+
+    //! Is the snapshot empty?
+    bool empty() const noexcept { return _envars.empty(); }
+    //! Get the count of environment variables
+    size_t size() const noexcept { return _envars.size(); }
+    //! Get all environment variables of the snapshot
+    const std::vector<Envar>& envars() const noexcept { return _envars; }
+
+    //! Find environment variable value by the given name
+    /*!
+        \param name - Environment variable name
+        \return Pointer to the environment variable value or nullptr if the environment variable is not set
+    */
+    const std::string* Find(std::string_view name) const noexcept;
+    //! Is environment variable with the given name set?
+    bool Contains(std::string_view name) const noexcept { return (Find(name) != nullptr); }
+
+    //! Get environment variable value by the given name
+    /*!
+        \param name - Environment variable name
+        \return Environment variable value or empty string view if the environment variable is not set
+    */
+    std::string_view Get(std::string_view name) const noexcept
+    { const std::string* value = Find(name); return (value != nullptr) ? std::string_view(*value) : std::string_view(); }
+
+    //! Get environment variable value parsed into the given type
+    /*!
+        Supported types are bool ('1', 'true', 'yes', 'on' or '0', 'false',
+        'no', 'off' in any case), integral and floating point types,
+        std::string_view and std::string.
+
+        \param name - Environment variable name
+        \param defaults - Default value if the environment variable is not set or cannot be parsed
+        \return Parsed environment variable value
+    */
+    template <typename T>
+    T Get(std::string_view name, const T& defaults) const;
+
+private:
+    std::vector<Envar> _envars;
+    std::vector<uint64_t> _hashes;
+    std::vector<uint32_t> _buckets;
+    size_t _mask;
+
+    //! Calculate the hash of environment variable name
+    static uint64_t Hash(std::string_view name) noexcept;
+    //! Compare environment variable names
+    static bool Equals(std::string_view name1, std::string_view name2) noexcept;
+};
+
 //! Environment management static class
 /*!
     Provides environment management functionality to get OS bit version, process bit version,
@@ -88,10 +170,46 @@ public:
         \param name - Environment variable name
     */
     static void ClearEnvar(const std::string name);
+
+    //! Get the cached snapshot of environment variables
+    /*!
+        Snapshot is taken on the first call and published again after each
+        SetEnvar() or ClearEnvar() call. Getting the current snapshot is
+        lock-free. Snapshots are never destroyed, so their views are valid
+        until the process exit.
+
+        \return Current environment variables snapshot
+    */
+    static const EnvironmentSnapshot& Snapshot();
+    //! Take and publish a new snapshot of environment variables
+    /*!
+        Should be called after environment variables are changed bypassing
+        Environment class (e.g. with setenv() in a third-party library).
+    */
+    static void Refresh();
+
+    //! Get the cached environment variable value by the given name
+    /*!
+        Lock-free and allocation-free version of GetEnvar().
+
+        \param name - Environment variable name
+        \return Environment variable value or empty string view if the environment variable is not set
+    */
+    static std::string_view Envar(std::string_view name) { return Snapshot().Get(name); }
+    //! Get the cached environment variable value parsed into the given type
+    /*!
+        \param name - Environment variable name
+        \param defaults - Default value if the environment variable is not set or cannot be parsed
+        \return Parsed environment variable value
+    */
+    template <typename T>
+    static T Envar(std::string_view name, const T& defaults) { return Snapshot().Get<T>(name, defaults); }
 };
 
 /*! \example system_environment.cpp Environment management example */
 
 } // namespace CppCommon
 
+#include "environment.inl"
+
 #endif // CPPCOMMON_SYSTEM_ENVIRONMENT_H
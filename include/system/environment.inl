@@ -0,0 +1,49 @@
+/*!
+    \file environment.inl
+    \brief Environment management inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline T EnvironmentSnapshot::Get(std::string_view name, const T& defaults) const
+{
+    const std::string* envar = Find(name);
+    if (envar == nullptr)
+        return defaults;
+
+    std::string_view value(*envar);
+    if constexpr (std::is_same<T, std::string_view>::value)
+        return value;
+    else if constexpr (std::is_same<T, std::string>::value)
+        return std::string(value);
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        auto is = [value](std::string_view str)
+        {
+            if (value.size() != str.size())
+                return false;
+            for (size_t i = 0; i < value.size(); ++i)
+                if ((value[i] | 0x20) != str[i])
+                    return false;
+            return true;
+        };
+        if (is("1") || is("true") || is("yes") || is("on"))
+            return true;
+        if (is("0") || is("false") || is("no") || is("off"))
+            return false;
+        return defaults;
+    }
+    else
+    {
+        static_assert(std::is_arithmetic<T>::value, "Unsupported environment variable type!");
+        T result;
+        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+        return ((ec == std::errc()) && (ptr == (value.data() + value.size()))) ? result : defaults;
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,161 @@
+/*!
+    \file flight_recorder.h
+    \brief Crash-safe flight recorder definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_FLIGHT_RECORDER_H
+#define CPPCOMMON_SYSTEM_FLIGHT_RECORDER_H
+
+#include "system/shared_memory.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Global flight recorder state flag checked by all records
+extern std::atomic<bool> flight_recorder_enabled;
+
+} // namespace Internals
+//! @endcond
+
+//! Flight recorder event
+struct FlightEvent
+{
+    //! Thread Id of the recorded event
+    uint64_t thread{0};
+    //! Sequence number of the event in the thread ring
+    uint64_t sequence{0};
+    //! UTC timestamp of the event
+    UtcTimestamp timestamp{Timestamp()};
+    //! Event code
+    uint32_t code{0};
+    //! Event argument
+    uint64_t argument{0};
+    //! Event message (truncated to FlightRecorder::MESSAGE_SIZE)
+    std::string message;
+
+    //! Output flight recorder event into the given output stream
+    friend std::ostream& operator<<(std::ostream& os, const FlightEvent& event);
+};
+
+//! Crash-safe flight recorder
+/*!
+    Flight recorder keeps a fixed count of the most recent events of each
+    thread in per-thread rings laid out in the named shared memory segment.
+    Each thread claims its own ring on the first record, so recording is
+    a wait-free single writer operation: it stamps the event with
+    Timestamp::tsc(), copies fixed-size fields into the next ring slot and
+    publishes its sequence number. Nothing is allocated, locked or formatted
+    on the record path. If all rings are claimed records of new threads are
+    dropped and counted. Rings of finished threads are reused by new threads.
+
+    The segment layout is position-independent and survives the crash of the
+    process, so an external watchdog process could open the same segment and
+    read recent events with FlightRecorder::Read(). Flight recorder adds the
+    dump handler into ExceptionsHandler, so recent events of all threads are
+    written into std::cerr on fatal signals and unhandled exceptions.
+
+    Thread-safe.
+*/
+class FlightRecorder
+{
+public:
+    FlightRecorder() = delete;
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder(FlightRecorder&&) = delete;
+    ~FlightRecorder() = delete;
+
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(FlightRecorder&&) = delete;
+
+    //! Default count of thread rings
+    static const size_t DEFAULT_THREADS = 64;
+    //! Default count of events in each thread ring
+    static const size_t DEFAULT_CAPACITY = 256;
+    //! Maximal size of the event message
+    static constexpr size_t MESSAGE_SIZE = 32;
+
+    //! Is flight recorder enabled?
+    static bool enabled() noexcept { return Internals::flight_recorder_enabled.load(std::memory_order_relaxed); }
+    //! Get the flight recorder shared memory segment name
+    static std::string name();
+    //! Get the total count of events dropped because all thread rings were claimed
+    static uint64_t dropped() noexcept;
+
+    //! Get the size of the shared memory segment for the given count of thread rings and events
+    /*!
+        \param threads - Count of thread rings
+        \param capacity - Count of events in each thread ring (must be a power of two)
+        \return Shared memory segment size in bytes
+    */
+    static size_t SegmentSize(size_t threads, size_t capacity) noexcept;
+
+    //! Setup flight recorder in the named shared memory segment
+    /*!
+        This method should be called once for the current process. Next calls
+        are ignored. It is recommended to call the method just after the
+        current process start next to ExceptionsHandler::SetupProcess()!
+
+        \param name - Shared memory segment name
+        \param threads - Count of thread rings (default is DEFAULT_THREADS)
+        \param capacity - Count of events in each thread ring (must be a power of two, default is DEFAULT_CAPACITY)
+    */
+    static void Setup(const std::string& name, size_t threads = DEFAULT_THREADS, size_t capacity = DEFAULT_CAPACITY);
+
+    //! Record the event into the ring of the current thread
+    /*!
+        Does nothing if the flight recorder is not setup.
+
+        \param code - Event code
+        \param argument - Event argument (default is 0)
+    */
+    static void Record(uint32_t code, uint64_t argument = 0) noexcept;
+    //! Record the event with the message into the ring of the current thread
+    /*!
+        Message is copied and truncated to MESSAGE_SIZE bytes.
+        Does nothing if the flight recorder is not setup.
+
+        \param code - Event code
+        \param message - Event message
+        \param argument - Event argument (default is 0)
+    */
+    static void Record(uint32_t code, std::string_view message, uint64_t argument = 0) noexcept;
+
+    //! Take the snapshot of recent events of all thread rings
+    /*!
+        \return Recent events ordered by timestamps
+    */
+    static std::vector<FlightEvent> Snapshot();
+    //! Read recent events from the flight recorder shared memory segment of another process
+    /*!
+        Events which are overwritten during the read are skipped.
+
+        \param shared - Flight recorder shared memory segment
+        \return Recent events ordered by timestamps (empty if the segment is not initialized)
+    */
+    static std::vector<FlightEvent> Read(const SharedMemory& shared);
+
+    //! Write recent events of all thread rings into the given output stream
+    /*!
+        \param stream - Output stream (default is std::cerr)
+    */
+    static void Dump(std::ostream& stream = std::cerr);
+};
+
+/*! \example system_flight_recorder.cpp Crash-safe flight recorder example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_FLIGHT_RECORDER_H
@@ -0,0 +1,253 @@
+/*!
+    \file perf_counters.h
+    \brief Hardware performance counters definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_PERF_COUNTERS_H
+#define CPPCOMMON_SYSTEM_PERF_COUNTERS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+//! Measure the current scope with the given performance probe
+/*!
+    Only every N-th pass of the scope is measured, where N is the sampling
+    interval of the probe.
+*/
+#define PERF_PROBE(probe) CppCommon::PerfProbeScope CPPCOMMON_PERF_CONCAT(__perf_probe_scope_, __LINE__)(probe)
+
+//! @cond INTERNALS
+#define CPPCOMMON_PERF_CONCAT_IMPL(x, y) x##y
+#define CPPCOMMON_PERF_CONCAT(x, y) CPPCOMMON_PERF_CONCAT_IMPL(x, y)
+//! @endcond
+
+namespace CppCommon {
+
+//! Performance event
+enum class PerfEvent
+{
+    CYCLES,             //!< CPU cycles
+    INSTRUCTIONS,       //!< Retired instructions
+    L1D_MISSES,         //!< L1 data cache read misses
+    LLC_MISSES,         //!< Last level cache misses
+    BRANCH_MISSES,      //!< Mispredicted branches
+    CONTEXT_SWITCHES    //!< Context switches
+};
+
+//! Performance counters values
+struct PerfCounterValues
+{
+    uint64_t cycles{0};             //!< CPU cycles
+    uint64_t instructions{0};       //!< Retired instructions
+    uint64_t l1d_misses{0};         //!< L1 data cache read misses
+    uint64_t llc_misses{0};         //!< Last level cache misses
+    uint64_t branch_misses{0};      //!< Mispredicted branches
+    uint64_t context_switches{0};   //!< Context switches
+
+    //! Get the value of the given performance event
+    uint64_t value(PerfEvent event) const noexcept;
+    //! Get instructions per cycle
+    double ipc() const noexcept { return (cycles > 0) ? ((double)instructions / (double)cycles) : 0.0; }
+
+    PerfCounterValues& operator+=(const PerfCounterValues& values) noexcept;
+    PerfCounterValues& operator-=(const PerfCounterValues& values) noexcept;
+
+    friend PerfCounterValues operator+(PerfCounterValues values1, const PerfCounterValues& values2) noexcept
+    { return values1 += values2; }
+    friend PerfCounterValues operator-(PerfCounterValues values1, const PerfCounterValues& values2) noexcept
+    { return values1 -= values2; }
+};
+
+//! Hardware performance counters
+/*!
+    Performance counters measure CPU cycles, retired instructions, L1 data
+    cache misses, last level cache misses, branch misses and context switches
+    of the calling thread. On Linux counters are opened with perf_event_open()
+    as a single group, so all of them are scheduled together and read with a
+    single system call. Values are scaled if the kernel multiplexes counters.
+
+    Counters which are not supported by the platform, the CPU, the virtual
+    machine or denied by the perf_event_paranoid setting are not available
+    and always read as zero, so the code measured with performance counters
+    works everywhere.
+
+    Not thread-safe. Counters measure only the thread which created them.
+*/
+class PerfCounters
+{
+public:
+    //! Open performance counters of the calling thread
+    /*!
+        Counters are started immediately.
+    */
+    PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters(PerfCounters&&) = delete;
+    ~PerfCounters();
+
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    PerfCounters& operator=(PerfCounters&&) = delete;
+
+    //! Is any performance counter available?
+    bool available() const noexcept { return _count > 0; }
+    //! Is the given performance counter available?
+    bool available(PerfEvent event) const noexcept { return _fds[(size_t)event] >= 0; }
+
+    //! Read current values of performance counters
+    /*!
+        Values are accumulated since counters were opened, so the difference
+        of two reads gives values of the code between them.
+
+        \return Performance counters values
+    */
+    PerfCounterValues Read() const noexcept;
+
+    //! Get the performance counters of the current thread
+    /*!
+        Thread local performance counters are opened on the first call.
+
+        \return Performance counters of the current thread
+    */
+    static PerfCounters& thread();
+
+private:
+    static const size_t EVENTS = 6;
+
+    int _fds[EVENTS];
+    size_t _order[EVENTS];
+    size_t _count;
+};
+
+//! Performance counters scope
+/*!
+    Adds values of performance counters of the scope into the given result
+    when the scope is finished.
+
+    Not thread-safe.
+*/
+class PerfScope
+{
+public:
+    //! Start measuring the scope with the given performance counters
+    /*!
+        \param counters - Performance counters
+        \param result - Performance counters values to accumulate the scope into
+    */
+    PerfScope(const PerfCounters& counters, PerfCounterValues& result) noexcept
+        : _counters(counters), _result(result), _start(counters.Read())
+    {}
+    PerfScope(const PerfScope&) = delete;
+    PerfScope(PerfScope&&) = delete;
+    ~PerfScope() { _result += _counters.Read() - _start; }
+
+    PerfScope& operator=(const PerfScope&) = delete;
+    PerfScope& operator=(PerfScope&&) = delete;
+
+private:
+    const PerfCounters& _counters;
+    PerfCounterValues& _result;
+    PerfCounterValues _start;
+};
+
+//! Sampled performance probe
+/*!
+    Performance probe accumulates performance counters of a hot path in the
+    production code. Only every N-th pass of the probe scope is measured with
+    thread local performance counters, so the cost of an unsampled pass is a
+    single relaxed atomic increment.
+
+    Thread-safe.
+*/
+class PerfProbe
+{
+public:
+    //! Initialize the performance probe with the given name and sampling interval
+    /*!
+        \param name - Probe name (static string)
+        \param sampling - Sampling interval (default is 1024)
+    */
+    explicit PerfProbe(const char* name, uint64_t sampling = 1024) noexcept
+        : _name(name), _sampling((sampling > 0) ? sampling : 1), _calls(0), _samples(0)
+    { Reset(); }
+    PerfProbe(const PerfProbe&) = delete;
+    PerfProbe(PerfProbe&&) = delete;
+    ~PerfProbe() = default;
+
+    PerfProbe& operator=(const PerfProbe&) = delete;
+    PerfProbe& operator=(PerfProbe&&) = delete;
+
+    //! Get the probe name
+    const char* name() const noexcept { return _name; }
+    //! Get the sampling interval
+    uint64_t sampling() const noexcept { return _sampling; }
+    //! Get the count of probe passes
+    uint64_t calls() const noexcept { return _calls.load(std::memory_order_relaxed); }
+    //! Get the count of measured probe passes
+    uint64_t samples() const noexcept { return _samples.load(std::memory_order_relaxed); }
+
+    //! Get total values of all measured probe passes
+    PerfCounterValues total() const noexcept;
+    //! Get average values of a single measured probe pass
+    PerfCounterValues average() const noexcept;
+
+    //! Should the current probe pass be measured?
+    bool Sample() noexcept { return (_calls.fetch_add(1, std::memory_order_relaxed) % _sampling) == 0; }
+    //! Record values of the measured probe pass
+    void Record(const PerfCounterValues& values) noexcept;
+
+    //! Reset the probe
+    void Reset() noexcept;
+
+private:
+    const char* _name;
+    uint64_t _sampling;
+    std::atomic<uint64_t> _calls;
+    std::atomic<uint64_t> _samples;
+    std::atomic<uint64_t> _values[6];
+};
+
+//! Performance probe scope
+/*!
+    Measures the scope with thread local performance counters if the probe
+    samples the current pass.
+
+    Not thread-safe.
+*/
+class PerfProbeScope
+{
+public:
+    //! Start the performance probe scope
+    /*!
+        \param probe - Performance probe
+    */
+    explicit PerfProbeScope(PerfProbe& probe)
+        : _probe(probe.Sample() ? &probe : nullptr)
+    {
+        if (_probe != nullptr)
+            _start = PerfCounters::thread().Read();
+    }
+    PerfProbeScope(const PerfProbeScope&) = delete;
+    PerfProbeScope(PerfProbeScope&&) = delete;
+    ~PerfProbeScope()
+    {
+        if (_probe != nullptr)
+            _probe->Record(PerfCounters::thread().Read() - _start);
+    }
+
+    PerfProbeScope& operator=(const PerfProbeScope&) = delete;
+    PerfProbeScope& operator=(PerfProbeScope&&) = delete;
+
+private:
+    PerfProbe* _probe;
+    PerfCounterValues _start;
+};
+
+/*! \example system_perf_counters.cpp Hardware performance counters example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_PERF_COUNTERS_H
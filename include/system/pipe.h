@@ -25,12 +25,23 @@ namespace CppCommon {
     other process reads the information from the pipe. This overview describes  how
     to create, manage, and use pipes.
 
+    Pipe could be switched into the non-blocking mode to be used from an event
+    loop: read and write operations return zero instead of waiting, and the end
+    of the pipe stream is reported by IsPipeEOF() method. On Linux the kernel
+    buffer size could be increased from the default 64 KiB to reduce the count
+    of context switches, and the data could be moved between pipes or mapped
+    from the user memory with splice()/vmsplice() without copying.
+
     Not thread-safe.
 */
 class Pipe : public Reader, public Writer
 {
 public:
-    Pipe();
+    //! Create a new pipe
+    /*!
+        \param capacity - Kernel buffer size of the pipe (default is 0 for the system default size)
+    */
+    explicit Pipe(size_t capacity = 0);
     Pipe(const Pipe&) = delete;
     Pipe(Pipe&& pipe) = delete;
     virtual ~Pipe();
@@ -49,6 +60,42 @@ public:
     bool IsPipeReadOpened() const noexcept;
     //! Is pipe opened for writing?
     bool IsPipeWriteOpened() const noexcept;
+    //! Is the end of the pipe stream met (the write endpoint was closed and all data was read)?
+    bool IsPipeEOF() const noexcept;
+
+    //! Get the kernel buffer size of the pipe
+    /*!
+        \return Kernel buffer size of the pipe (zero if the platform does not report it)
+    */
+    size_t capacity() const;
+    //! Set the kernel buffer size of the pipe
+    /*!
+        Linux implementation uses fcntl(F_SETPIPE_SZ) and rounds the size up
+        to the power of two pages. Unprivileged processes are limited by
+        /proc/sys/fs/pipe-max-size value. Other platforms support the buffer
+        size only in the constructor and the method will raise a system
+        exception!
+
+        \param capacity - Kernel buffer size of the pipe
+        \return Actual kernel buffer size of the pipe
+    */
+    size_t SetCapacity(size_t capacity);
+
+    //! Is pipe in the blocking mode?
+    bool IsBlocking() const noexcept;
+    //! Set the blocking mode of all opened pipe endpoints
+    /*!
+        In the non-blocking mode read and write operations return zero if
+        they would block. Zero read result with IsPipeEOF() flag means the
+        end of the pipe stream.
+
+        Endpoints of the pipe passed to the child process should stay in the
+        blocking mode, so the mode should be changed after the child process
+        was executed.
+
+        \param blocking - Blocking mode flag
+    */
+    void SetBlocking(bool blocking);
 
     //! Read a bytes buffer from the pipe
     /*!
@@ -57,9 +104,20 @@ public:
 
         \param buffer - Buffer to read
         \param size - Buffer size
-        \return Count of read bytes
+        \return Count of read bytes (zero if the end of the pipe stream was met or the non-blocking read would block)
     */
     size_t Read(void* buffer, size_t size) override;
+    //! Read a bytes buffer from the pipe and report system errors into the given error code
+    /*!
+        Reading from the closed pipe is still a programming error which raises
+        a system exception!
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param ec - Error code of the failed read (cleared on success)
+        \return Count of read bytes (zero on error, at the end of the pipe stream or if the non-blocking read would block)
+    */
+    size_t Read(void* buffer, size_t size, std::error_code& ec);
 
     using Reader::ReadAllBytes;
     using Reader::ReadAllText;
@@ -72,12 +130,74 @@ public:
 
         \param buffer - Buffer to write
         \param size - Buffer size
-        \return Count of written bytes
+        \return Count of written bytes (zero if the non-blocking write would block)
     */
     size_t Write(const void* buffer, size_t size) override;
+    //! Write a byte buffer into the pipe and report system errors into the given error code
+    /*!
+        Writing into the closed pipe is still a programming error which raises
+        a system exception!
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param ec - Error code of the failed write (cleared on success)
+        \return Count of written bytes (zero on error or if the non-blocking write would block)
+    */
+    size_t Write(const void* buffer, size_t size, std::error_code& ec);
+    //! Write the buffer chain content into the pipe
+    /*!
+        All slices of the buffer chain are written with the gather write
+        (writev) without copy. Written bytes are consumed from the buffer
+        chain. If the pipe is not opened for writing the method will raise
+        a system exception!
+
+        \param chain - Buffer chain to write
+        \return Count of written bytes
+    */
+    size_t WriteFrom(BufferChain& chain) override;
 
     using Writer::Write;
 
+    //! Duplicate bytes of the pipe into the given pipe without consuming them
+    /*!
+        Linux implementation duplicates pipe pages with tee() without copying
+        them through the user space, so the same data could be spliced into
+        several destinations. Other platforms do not support the operation
+        and the method will raise a system exception!
+
+        Will block until some data is available in the pipe.
+
+        \param pipe - Pipe to write
+        \param size - Maximal count of bytes to duplicate
+        \return Count of duplicated bytes (zero if the write endpoint of the pipe was closed)
+    */
+    size_t Tee(Pipe& pipe, size_t size);
+    //! Move bytes of the pipe into the given pipe
+    /*!
+        Linux implementation moves pipe pages with splice() without copying
+        them through the user space. Other platforms copy bytes through the
+        intermediate buffer.
+
+        Will block until some data is available in the pipe.
+
+        \param pipe - Pipe to write
+        \param size - Maximal count of bytes to move
+        \return Count of moved bytes (zero if the end of the pipe stream was met or the non-blocking operation would block)
+    */
+    size_t Splice(Pipe& pipe, size_t size);
+    //! Map the user memory buffer into the pipe
+    /*!
+        Linux implementation uses vmsplice() to add references to the user
+        memory pages into the pipe without copying them, so the buffer must
+        not be modified or released until all its bytes are read from the
+        pipe! Other platforms copy bytes as Write() method does.
+
+        \param buffer - Buffer to map
+        \param size - Buffer size
+        \return Count of mapped bytes (zero if the non-blocking operation would block)
+    */
+    size_t SpliceFrom(const void* buffer, size_t size);
+
     //! Close the read pipe endpoint
     void CloseRead();
     //! Close the write pipe endpoint
@@ -96,10 +216,11 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 16;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static const size_t StorageSize = 16;
     static const size_t StorageAlign = 4;
 #else
+    static const size_t StorageSize = 24;
     static const size_t StorageAlign = 8;
 #endif
     alignas(StorageAlign) std::byte _storage[StorageSize];
@@ -27,6 +27,24 @@
 
 namespace CppCommon {
 
+//! Process resource usage
+struct ProcessUsage
+{
+    Timespan user;                      //!< CPU time spent in the user mode by all threads
+    Timespan system;                    //!< CPU time spent in the kernel mode by all threads
+    uint64_t rss{0};                    //!< Resident set size in bytes
+    uint64_t peak_rss{0};               //!< Peak resident set size in bytes
+    uint64_t minor_faults{0};           //!< Page faults serviced without I/O
+    uint64_t major_faults{0};           //!< Page faults serviced with I/O
+    uint64_t voluntary_switches{0};     //!< Voluntary context switches (waits for a resource)
+    uint64_t involuntary_switches{0};   //!< Involuntary context switches (preemptions)
+    uint64_t read_bytes{0};             //!< Bytes read by I/O system calls
+    uint64_t write_bytes{0};            //!< Bytes written by I/O system calls
+
+    //! Get the total CPU time
+    Timespan cpu() const noexcept { return user + system; }
+};
+
 //! Process abstraction
 /*!
     Process contains different kinds of process manipulation functionality such as
@@ -90,6 +108,18 @@ public:
     */
     static uint64_t ParentProcessId() noexcept;
 
+    //! Get the resource usage of the current process
+    /*!
+        Values which are not supported by the platform are reported as zero
+        (context switches are not counted on Windows, I/O bytes are not
+        counted on Apple). On Linux I/O bytes are read from /proc/self/io
+        and include all read() and write() calls (sockets, pipes and cached
+        files).
+
+        \return Resource usage of the current process
+    */
+    static ProcessUsage CurrentUsage();
+
     //! Get the current process
     /*!
         \return Current process
@@ -113,6 +143,14 @@ public:
         new process will use equivalent standard stream of the parent
         process.
 
+        Unix implementation creates the new process with posix_spawn()
+        when the C library is able to redirect pipes, close inherited file
+        descriptors and change the working directory of the new process
+        (glibc 2.34+, macOS without the initial working directory). glibc
+        spawns the process with vfork semantics, so the cost does not depend
+        on the size of the parent address space. Otherwise the current
+        process is forked.
+
         \param command - Command to execute
         \param arguments - Pointer to arguments vector (default is nullptr)
         \param envars - Pointer to environment variables map (default is nullptr)
@@ -123,6 +161,28 @@ public:
         \return Created process
     */
     static Process Execute(const std::string& command, const std::vector<std::string>* arguments = nullptr, const std::map<std::string, std::string>* envars = nullptr, const std::string* directory = nullptr, Pipe* input = nullptr, Pipe* output = nullptr, Pipe* error = nullptr);
+    //! Execute a new process, communicate with it and wait for its exit
+    /*!
+        The given input is written into the standard input of the new process
+        while its standard output and error streams are drained concurrently,
+        so the process never blocks on the full pipe buffer and no deadlock
+        is possible. Unix implementation multiplexes non-blocking pipes with
+        a single poll() loop, Windows implementation drains pipes in separate
+        threads.
+
+        If input/output/error buffer is not provided then new process will
+        use equivalent standard stream of the parent process.
+
+        \param command - Command to execute
+        \param arguments - Pointer to arguments vector (default is nullptr)
+        \param envars - Pointer to environment variables map (default is nullptr)
+        \param directory - Initial working directory (default is nullptr)
+        \param input - Standard input content (default is nullptr)
+        \param output - Standard output content (default is nullptr)
+        \param error - Standard error content (default is nullptr)
+        \return Process exit result
+    */
+    static int Run(const std::string& command, const std::vector<std::string>* arguments = nullptr, const std::map<std::string, std::string>* envars = nullptr, const std::string* directory = nullptr, const std::string* input = nullptr, std::string* output = nullptr, std::string* error = nullptr);
 
     //! Swap two instances
     void swap(Process& process) noexcept;
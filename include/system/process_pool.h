@@ -0,0 +1,126 @@
+/*!
+    \file process_pool.h
+    \brief Process pool definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_PROCESS_POOL_H
+#define CPPCOMMON_SYSTEM_PROCESS_POOL_H
+
+#include "system/process.h"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Process pool
+/*!
+    Process pool prespawns the given count of worker processes and keeps
+    them running between jobs, so short-lived jobs do not pay for the new
+    process creation. Each worker reads jobs from its standard input and
+    writes results into its standard output. Jobs and results are framed
+    as 32-bit little-endian size followed by the payload. Worker process
+    could be implemented with Serve() method, any other stream filter which
+    echoes frames (e.g. 'cat') is also suitable.
+
+    Job is dispatched to the worker with the least count of pending jobs.
+    Results of each worker are delivered in the order of submission. Crashed
+    worker is restarted in its reader thread, pending jobs of the crashed
+    worker fail with SystemException.
+
+    Thread-safe.
+*/
+class ProcessPool
+{
+public:
+    //! Prespawn worker processes
+    /*!
+        \param command - Worker command to execute
+        \param arguments - Pointer to worker arguments vector (default is nullptr)
+        \param workers - Count of worker processes (default is 0 for the count of CPU cores)
+        \param envars - Pointer to worker environment variables map (default is nullptr)
+        \param directory - Initial working directory of workers (default is nullptr)
+    */
+    explicit ProcessPool(const std::string& command, const std::vector<std::string>* arguments = nullptr, size_t workers = 0, const std::map<std::string, std::string>* envars = nullptr, const std::string* directory = nullptr);
+    ProcessPool(const ProcessPool&) = delete;
+    ProcessPool(ProcessPool&&) = delete;
+    //! Stop all worker processes
+    ~ProcessPool();
+
+    ProcessPool& operator=(const ProcessPool&) = delete;
+    ProcessPool& operator=(ProcessPool&&) = delete;
+
+    //! Get the count of worker processes
+    size_t workers() const noexcept;
+    //! Get the count of pending jobs
+    size_t pending() const noexcept;
+    //! Get the count of restarted worker processes
+    uint64_t restarts() const noexcept;
+
+    //! Get the process Id of the given worker
+    /*!
+        \param index - Worker index
+        \return Worker process Id
+    */
+    uint64_t pid(size_t index) const;
+
+    //! Submit the job to the least loaded worker
+    /*!
+        Will block only while the job is written into the worker pipe.
+
+        \param job - Job payload
+        \return Future result of the job
+    */
+    std::future<std::string> Submit(std::string_view job);
+
+    //! Execute the job and wait for its result
+    /*!
+        Will block.
+
+        \param job - Job payload
+        \return Result of the job
+    */
+    std::string Execute(std::string_view job) { return Submit(job).get(); }
+
+    //! Stop the process pool
+    /*!
+        Closes standard input of all workers, waits for results of pending
+        jobs and for exit of worker processes. Will block.
+    */
+    void Stop();
+
+    //! Serve jobs in the worker process
+    /*!
+        Reads jobs from the standard input, calls the given handler and
+        writes its result into the standard output until the standard input
+        is closed. Worker must not write anything else into the standard
+        output.
+
+        \param handler - Job handler
+    */
+    static void Serve(const std::function<std::string(std::string_view)>& handler);
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 192;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example system_process_pool.cpp Process pool example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_PROCESS_POOL_H
@@ -0,0 +1,196 @@
+/*!
+    \file reactor.h
+    \brief Reactor definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_REACTOR_H
+#define CPPCOMMON_SYSTEM_REACTOR_H
+
+#include "common/flags.h"
+#include "errors/exceptions.h"
+#include "threads/coroutine_scheduler.h"
+#include "threads/timer_service.h"
+#include "time/timespan.h"
+
+#include <coroutine>
+#include <functional>
+
+namespace CppCommon {
+
+//! Reactor events
+enum class ReactorEvents
+{
+    NONE     = 0x0,     //!< None
+    READABLE = 0x1,     //!< Handle is ready for reading (or signaled)
+    WRITABLE = 0x2,     //!< Handle is ready for writing
+    HANGUP   = 0x4      //!< Peer endpoint is closed or the handle is failed
+};
+
+class Reactor;
+
+//! Reactor awaiter
+class ReactorAwaiter
+{
+public:
+    ReactorAwaiter(Reactor& reactor, void* handle, const Flags<ReactorEvents>& events) noexcept
+        : _reactor(reactor), _handle(handle), _events(events) {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> coroutine);
+    Flags<ReactorEvents> await_resume() const noexcept { return _result; }
+
+private:
+    Reactor& _reactor;
+    void* _handle;
+    Flags<ReactorEvents> _events;
+    Flags<ReactorEvents> _result;
+};
+
+//! Reactor
+/*!
+    Reactor multiplexes waiting for readiness of a large count of native
+    handles (e.g. Pipe::reader(), Pipe::writer(), sockets, terminals) in the
+    single thread which calls Run() or Poll(). Ready handles are dispatched
+    to their handlers in this thread.
+
+    Linux implementation is based on edge-triggered epoll, BSD and macOS
+    implementations are based on kqueue with EV_CLEAR. Handlers are notified
+    only when the handle becomes ready, so they should read or write until
+    the operation would block (e.g. non-blocking Pipe returns zero). Other
+    Unix systems use level-triggered poll(). Windows implementation is based
+    on I/O completion port and notifies about signaled waitable handles
+    (processes, events, console input). Windows anonymous pipes are not
+    waitable.
+
+    Tasks posted from any thread wake the reactor up with eventfd (Linux),
+    EVFILT_USER (BSD, macOS), self-pipe (other Unix systems) or completion
+    packet (Windows) and are executed in the reactor thread. Timer service
+    could dispatch expired timers into the reactor thread with executor().
+
+    Coroutines could wait for the handle readiness with co_await Wait().
+
+    Thread-safe.
+*/
+class Reactor
+{
+public:
+    //! Ready handle handler
+    typedef std::function<void(Flags<ReactorEvents>)> Handler;
+    //! Reactor task
+    typedef std::function<void()> Task;
+
+    Reactor();
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    ~Reactor();
+
+    Reactor& operator=(const Reactor&) = delete;
+    Reactor& operator=(Reactor&&) = delete;
+
+    //! Get the count of registered handles
+    size_t handles() const;
+    //! Is the reactor stopped?
+    bool stopped() const noexcept;
+
+    //! Register the native handle
+    /*!
+        Handle must not be closed before it is removed from the reactor.
+
+        \param handle - Native handle
+        \param events - Events to wait (READABLE and/or WRITABLE, HANGUP is always reported)
+        \param handler - Ready handle handler
+    */
+    void Add(void* handle, const Flags<ReactorEvents>& events, const Handler& handler);
+    //! Register the native handle for the single notification
+    /*!
+        Handle is removed from the reactor before its handler is called.
+
+        \param handle - Native handle
+        \param events - Events to wait (READABLE and/or WRITABLE, HANGUP is always reported)
+        \param handler - Ready handle handler
+    */
+    void AddOnce(void* handle, const Flags<ReactorEvents>& events, const Handler& handler);
+    //! Modify events to wait for the registered native handle
+    /*!
+        \param handle - Native handle
+        \param events - Events to wait (READABLE and/or WRITABLE, HANGUP is always reported)
+    */
+    void Modify(void* handle, const Flags<ReactorEvents>& events);
+    //! Remove the registered native handle
+    /*!
+        Handler which is already being dispatched in the reactor thread might
+        be called once after the handle is removed from another thread.
+
+        \param handle - Native handle
+        \return 'true' if the handle was removed, 'false' if the handle was not registered
+    */
+    bool Remove(void* handle);
+
+    //! Wait for the handle readiness in the coroutine
+    /*!
+        The coroutine is resumed by the coroutine scheduler it was suspended
+        on, or in the reactor thread if it was not run by any scheduler.
+
+        Usage: auto events = co_await reactor.Wait(pipe.reader(), ReactorEvents::READABLE);
+
+        \param handle - Native handle which is not registered in the reactor
+        \param events - Events to wait (READABLE and/or WRITABLE, HANGUP is always reported)
+        \return Reactor awaiter
+    */
+    ReactorAwaiter Wait(void* handle, const Flags<ReactorEvents>& events) noexcept { return ReactorAwaiter(*this, handle, events); }
+
+    //! Post the task to be executed in the reactor thread
+    /*!
+        \param task - Task to execute
+    */
+    void Post(Task task);
+
+    //! Get the timer service executor which dispatches expired timers into the reactor thread
+    /*!
+        Usage: TimerService timers(reactor.executor());
+    */
+    TimerService::Executor executor() { return [this](TimerService::Task task) { Post(std::move(task)); }; }
+
+    //! Dispatch ready handles and posted tasks
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timeout - Timespan to wait for ready handles (default is Timespan::zero())
+        \return Count of dispatched handlers and tasks
+    */
+    size_t Poll(const Timespan& timeout = Timespan::zero());
+
+    //! Dispatch ready handles and posted tasks in the current thread until the reactor is stopped
+    /*!
+        Will block.
+    */
+    void Run();
+
+    //! Stop the reactor
+    /*!
+        Wakes up the thread which runs the reactor. Tasks posted after the stop
+        could be still executed with Poll().
+    */
+    void Stop();
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 320;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example system_reactor.cpp Reactor example */
+
+} // namespace CppCommon
+
+ENUM_FLAGS(CppCommon::ReactorEvents)
+
+#endif // CPPCOMMON_SYSTEM_REACTOR_H
@@ -16,6 +16,26 @@
 
 namespace CppCommon {
 
+//! Shared memory creation options
+/*!
+    All options are a best effort and are silently ignored if they are not
+    supported by the system or the process has no required privileges.
+    Use SharedMemory::huge_pages() and SharedMemory::locked() to check the
+    result. All processes sharing the same memory block should use the same
+    huge pages option, because huge pages blocks are placed apart.
+*/
+struct SharedMemoryOptions
+{
+    //! Map the block with huge pages: hugetlbfs file on Linux (falls back to transparent huge pages), large pages on Windows (default is false)
+    bool huge_pages{false};
+    //! Prefault all pages of the block, so the hot path does not take first touch page faults (default is false)
+    bool prefault{false};
+    //! Lock all pages of the block in the physical memory (default is false)
+    bool lock{false};
+    //! NUMA node to bind pages of the block. Negative value means no binding (default is -1)
+    int node{-1};
+};
+
 //! Shared memory manager
 /*!
     Shared memory manager allows to create named memory buffers shared between multiple processes.
@@ -32,8 +52,9 @@ public:
     /*!
         \param name - Shared memory block name
         \param size - Shared memory block size
+        \param options - Shared memory creation options (default is SharedMemoryOptions())
     */
-    explicit SharedMemory(const std::string& name, size_t size);
+    explicit SharedMemory(const std::string& name, size_t size, const SharedMemoryOptions& options = SharedMemoryOptions());
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory(SharedMemory&& shmem) = delete;
     ~SharedMemory();
@@ -56,6 +77,12 @@ public:
 
     //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
     bool owner() const;
+    //! Get the shared memory creation options
+    const SharedMemoryOptions& options() const noexcept { return _options; }
+    //! Is the shared memory block mapped with huge pages?
+    bool huge_pages() const;
+    //! Is the shared memory block locked in the physical memory?
+    bool locked() const;
 
 private:
     class Impl;
@@ -63,12 +90,13 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 64;
+    static const size_t StorageSize = 80;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 
     std::string _name;
     size_t _size;
+    SharedMemoryOptions _options;
 };
 
 /*! \example system_shared_memory.cpp Shared memory manager example */
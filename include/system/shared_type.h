@@ -30,8 +30,9 @@ public:
     //! Create a new or open existing shared memory type with a given name
     /*!
         \param name - Shared memory type name
+        \param options - Shared memory creation options (default is SharedMemoryOptions())
     */
-    explicit SharedType(const std::string& name);
+    explicit SharedType(const std::string& name, const SharedMemoryOptions& options = SharedMemoryOptions());
     SharedType(const SharedType<T>&) = delete;
     SharedType(SharedType<T>&&) = delete;
     ~SharedType() = default;
@@ -69,6 +70,10 @@ public:
 
     //! Get the shared memory type owner flag (true if the new one was created, false if the existing one was opened)
     bool owner() const { return _shared.owner(); }
+    //! Is the shared memory type mapped with huge pages?
+    bool huge_pages() const { return _shared.huge_pages(); }
+    //! Is the shared memory type locked in the physical memory?
+    bool locked() const { return _shared.locked(); }
 
 private:
     SharedMemory _shared;
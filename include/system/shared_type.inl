@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template <typename T>
-inline SharedType<T>::SharedType(const std::string& name) : _shared(name, sizeof(T))
+inline SharedType<T>::SharedType(const std::string& name, const SharedMemoryOptions& options) : _shared(name, sizeof(T), options)
 {
     // Check for the owner flag
     if (_shared.owner())
@@ -11,6 +11,7 @@
 
 #include "string/format.h"
 
+#include <atomic>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -27,6 +28,18 @@ namespace CppCommon {
 /*!
     Capture the current stack trace snapshot with easy-to-use interface.
 
+    Stack trace construction captures only frames addresses. Symbols are
+    resolved lazily on the first access to frames (frames(), string() or
+    stream output), so capturing stack traces that are never printed is
+    cheap. Resolved frames symbols are kept in the shared symbols cache
+    (and opened modules debug information is kept per module), so repeated
+    resolution of the same addresses is cheap as well.
+
+    Symbols are resolved with the stack trace manager state at the moment
+    of the first access, so the manager should be initialized until then.
+    Debug symbols deferred by the lazy manager initialization are loaded
+    on the first symbols resolution.
+
     Thread-safe.
 */
 class StackTrace
@@ -55,15 +68,26 @@ public:
         \param skip - Skip frames count (default is 0)
     */
     explicit StackTrace(int skip = 0);
-    StackTrace(const StackTrace&) = default;
-    StackTrace(StackTrace&&) noexcept = default;
+    //! Resolve the stack trace snapshot from the previously captured frames addresses
+    /*!
+        \param frames - Frames addresses captured with StackTrace::Capture()
+        \param size - Frames count
+    */
+    explicit StackTrace(void* const* frames, int size);
+    StackTrace(const StackTrace& stack_trace);
+    StackTrace(StackTrace&& stack_trace) noexcept;
     ~StackTrace() = default;
 
-    StackTrace& operator=(const StackTrace&) = default;
-    StackTrace& operator=(StackTrace&&) noexcept = default;
+    StackTrace& operator=(const StackTrace& stack_trace);
+    StackTrace& operator=(StackTrace&& stack_trace) noexcept;
 
-    //! Get stack trace frames
-    const std::vector<Frame>& frames() const noexcept { return _frames; }
+    //! Get captured frames addresses (without symbols resolving)
+    const std::vector<void*>& addresses() const noexcept { return _addresses; }
+    //! Is stack trace frames symbols resolved?
+    bool resolved() const noexcept { return _resolved.load(std::memory_order_acquire); }
+
+    //! Get stack trace frames (symbols are resolved on the first call)
+    const std::vector<Frame>& frames() const;
 
     //! Get string from the current stack trace snapshot
     std::string string() const
@@ -72,8 +96,32 @@ public:
     //! Output stack trace into the given output stream
     friend std::ostream& operator<<(std::ostream& os, const StackTrace& stack_trace);
 
+    //! Capture frames addresses of the current stack trace without symbols resolving
+    /*!
+        Cheap capture of the current stack trace suitable for hot paths
+        (e.g. allocation profiling). Captured frames could be resolved
+        later with StackTrace(frames, size) constructor.
+
+        \param frames - Frames addresses buffer
+        \param capacity - Frames addresses buffer capacity
+        \param skip - Skip frames count (default is 0)
+        \return Count of captured frames
+    */
+    static int Capture(void** frames, int capacity, int skip = 0) noexcept;
+
+    //! Clear the shared symbols cache
+    /*!
+        Should be called after unloading of dynamic libraries which frames
+        could be resolved before.
+    */
+    static void ClearCache();
+
 private:
-    std::vector<Frame> _frames;
+    std::vector<void*> _addresses;
+    mutable std::vector<Frame> _frames;
+    mutable std::atomic<bool> _resolved;
+
+    void Resolve() const;
 };
 
 /*! \example system_stack_trace.cpp Stack trace snapshot provider example */
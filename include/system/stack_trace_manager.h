@@ -20,7 +20,13 @@ namespace CppCommon {
 /*!
     Provides interface to initialize and cleanup stack trace snapshots capturing.
 
-    Not thread-safe.
+    Debug symbols (Windows symbol handler with all loaded modules) could be
+    loaded lazily on the first stack trace symbols resolution instead of the
+    initialization, so the process startup does not pay for symbols which
+    are never used. Unix implementation always opens modules debug
+    information on demand.
+
+    Not thread-safe except LoadSymbols() method.
 */
 class StackTraceManager : public CppCommon::Singleton<StackTraceManager>
 {
@@ -38,8 +44,21 @@ public:
     /*!
         This method should be called before you start capture any stack trace snapshots.
         It is recommended to call the method just after the current process start!
+
+        \param lazy - Defer debug symbols loading until the first stack trace symbols resolution (default is false)
+    */
+    static void Initialize(bool lazy = false);
+    //! Load debug symbols deferred by the lazy initialization
+    /*!
+        The method is called automatically before stack trace symbols are
+        resolved. It could be called explicitly to preload debug symbols
+        in the convenient moment (e.g. after the startup is completed).
+        Does nothing if debug symbols are already loaded or the manager is
+        not initialized.
+
+        Thread-safe.
     */
-    static void Initialize();
+    static void LoadSymbols();
     //! Cleanup stack trace manager
     /*!
         This method should be called just before the current process exits!
@@ -52,8 +71,8 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 4;
-    static const size_t StorageAlign = 1;
+    static const size_t StorageSize = 80;
+    static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 
     StackTraceManager();
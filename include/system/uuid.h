@@ -24,13 +24,21 @@ namespace CppCommon {
     - Nil UUID0 (all bits set to zero)
     - Sequential UUID1 (time based version)
     - Random UUID4 (randomly or pseudo-randomly generated version)
+    - Ordered UUID7 (Unix time in milliseconds with random bits version)
 
     A UUID is simply a 128-bit value: "123e4567-e89b-12d3-a456-426655440000"
 
+    Random UUID4 and ordered UUID7 are generated without locks and system
+    calls from the per-thread buffered ChaCha20 generator seeded from the
+    operating system secure random source (reseeded periodically and after
+    fork). Ordered UUID7 are monotonic in each thread and are suitable for
+    database index keys.
+
     Not thread-safe.
 
     https://en.wikipedia.org/wiki/Universally_unique_identifier
     https://www.ietf.org/rfc/rfc4122.txt
+    https://www.ietf.org/rfc/rfc9562.txt
 */
 class UUID
 {
@@ -51,9 +59,12 @@ public:
     explicit constexpr UUID(const char* uuid, size_t size);
     //! Initialize UUID with a given string
     /*!
+        Canonical "00000000-0000-0000-0000-000000000000" strings are parsed
+        with SSE2 or NEON at once.
+
         \param uuid - UUID string
     */
-    explicit UUID(const std::string& uuid) : UUID(uuid.data(), uuid.size()) {}
+    explicit UUID(const std::string& uuid);
     //! Initialize UUID with a given 16 bytes data buffer
     /*!
         \param data - UUID 16 bytes data buffer
@@ -92,8 +103,18 @@ public:
     //! Get the UUID data buffer
     const std::array<uint8_t, 16>& data() const noexcept { return _data; }
 
+    //! Get the UUID version (0 for nil UUID)
+    int version() const noexcept { return _data[6] >> 4; }
+
     //! Get string from the current UUID in format "00000000-0000-0000-0000-000000000000"
     std::string string() const;
+    //! Get string from the current UUID in format "00000000-0000-0000-0000-000000000000" into the given buffer
+    /*!
+        \param buffer - Output buffer
+        \param size - Output buffer size
+        \return Count of written characters (36 or zero if the output buffer is too small)
+    */
+    size_t string(char* buffer, size_t size) const noexcept;
 
     //! Generate nil UUID0 (all bits set to zero)
     static UUID Nil() { return UUID(); }
@@ -103,6 +124,8 @@ public:
     static UUID Random();
     //! Generate secure UUID4 (secure generated version)
     static UUID Secure();
+    //! Generate ordered UUID7 (Unix time in milliseconds with random bits version)
+    static UUID Ordered();
 
     //! Output instance into the given output stream
     friend std::ostream& operator<<(std::ostream& os, const UUID& uuid)
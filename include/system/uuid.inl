@@ -61,7 +61,7 @@ inline constexpr UUID::UUID(const char* uuid, size_t size)
 
     // Fill remaining data with zeros
     for (; index < 16; ++index)
-        _data[index++] = 0;
+        _data[index] = 0;
 }
 
 inline void UUID::swap(UUID& uuid) noexcept
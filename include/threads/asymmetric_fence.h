@@ -0,0 +1,92 @@
+/*!
+    \file asymmetric_fence.h
+    \brief Asymmetric memory fence definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYMMETRIC_FENCE_H
+#define CPPCOMMON_THREADS_ASYMMETRIC_FENCE_H
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Heavy fence is supported and registered by the process, so light fences could be compiler barriers
+inline std::atomic<bool> asymmetric_fence_enabled(false);
+
+} // namespace Internals
+//! @endcond
+
+//! Asymmetric memory fence static class
+/*!
+    Asymmetric fence splits the full memory fence of Dekker-style protocols
+    (hazard pointers, epoch pinning, reader-biased locks) into two parts:
+    the light fence executed on the hot path of readers and the heavy fence
+    executed by rare writers. The pair of the light fence in one thread and
+    the heavy fence in another thread works as the pair of full fences.
+
+    With the operating system support the light fence is only a compiler
+    barrier and the heavy fence forces a memory barrier on all CPUs running
+    threads of the process: membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED)
+    system call on Linux 4.14+ and FlushProcessWriteBuffers() on Windows.
+    Without the support both fences are full sequentially consistent fences.
+
+    The heavy fence costs several microseconds and interrupts other CPUs,
+    so it should be issued only on slow paths (scans, reclamation, write
+    lock acquisition).
+
+    Thread-safe.
+
+    https://man7.org/linux/man-pages/man2/membarrier.2.html
+*/
+class AsymmetricFence
+{
+public:
+    AsymmetricFence() = delete;
+    AsymmetricFence(const AsymmetricFence&) = delete;
+    AsymmetricFence(AsymmetricFence&&) = delete;
+    ~AsymmetricFence() = delete;
+
+    AsymmetricFence& operator=(const AsymmetricFence&) = delete;
+    AsymmetricFence& operator=(AsymmetricFence&&) = delete;
+
+    //! Initialize the asymmetric fence support of the current process
+    /*!
+        Called automatically on the first heavy fence. Users of the light
+        fence should call it once before the hot path, otherwise light
+        fences are full fences until the initialization.
+
+        \return 'true' if the heavy fence is supported by the operating system, 'false' otherwise
+    */
+    static bool Initialize() noexcept;
+
+    //! Is the heavy fence supported by the operating system?
+    static bool IsSupported() noexcept { return Initialize(); }
+
+    //! Light fence of the fast path
+    static void Light() noexcept
+    {
+        if (Internals::asymmetric_fence_enabled.load(std::memory_order_relaxed))
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        else
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    //! Heavy fence of the slow path
+    /*!
+        Failure of the heavy fence of the registered process is fatal, because
+        light fences of other threads might be only compiler barriers.
+    */
+    static void Heavy() noexcept;
+};
+
+/*! \example threads_asymmetric_fence.cpp Asymmetric memory fence example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYMMETRIC_FENCE_H
@@ -0,0 +1,82 @@
+/*!
+    \file async_event_auto_reset.h
+    \brief Awaitable auto-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
+#define CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
+
+#include "threads/coroutine_scheduler.h"
+
+namespace CppCommon {
+
+//! Awaitable auto-reset event synchronization primitive
+/*!
+    Awaitable auto-reset event is the coroutine counterpart of EventAutoReset.
+    Waiting coroutines are suspended without blocking threads and resumed one
+    by one in FIFO order by their coroutine schedulers.
+
+    Usage: co_await event;
+
+    Thread-safe.
+*/
+class AsyncEventAutoReset
+{
+public:
+    //! Event awaiter
+    class Awaiter
+    {
+    public:
+        explicit Awaiter(AsyncEventAutoReset& event) noexcept : _event(event) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> coroutine);
+        void await_resume() const noexcept {}
+
+    private:
+        AsyncEventAutoReset& _event;
+        Internals::CoroutineWaiter _waiter;
+    };
+
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit AsyncEventAutoReset(bool signaled = false) noexcept : _signaled(signaled) {}
+    AsyncEventAutoReset(const AsyncEventAutoReset&) = delete;
+    AsyncEventAutoReset(AsyncEventAutoReset&&) = delete;
+    ~AsyncEventAutoReset();
+
+    AsyncEventAutoReset& operator=(const AsyncEventAutoReset&) = delete;
+    AsyncEventAutoReset& operator=(AsyncEventAutoReset&&) = delete;
+
+    //! Signal one of waiting coroutines about event occurred
+    /*!
+        If some coroutines are waiting for the event one of them will be resumed.
+        Otherwise the event stays signaled until the next wait.
+
+        Will not block.
+    */
+    void Signal();
+
+    //! Try to wait the event without suspend
+    /*!
+        \return 'true' if the event was occurred before and no suspend was made, 'false' if the event was not occurred before
+    */
+    bool TryWait();
+
+    //! Wait the event
+    Awaiter operator co_await() noexcept { return Awaiter(*this); }
+
+private:
+    CriticalSection _cs;
+    bool _signaled;
+    Internals::CoroutineWaiters _waiters;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
@@ -0,0 +1,94 @@
+/*!
+    \file async_latch.h
+    \brief Awaitable latch synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_LATCH_H
+#define CPPCOMMON_THREADS_ASYNC_LATCH_H
+
+#include "threads/coroutine_scheduler.h"
+
+namespace CppCommon {
+
+//! Awaitable latch synchronization primitive
+/*!
+    Awaitable latch is the coroutine counterpart of Latch. Coroutines waiting
+    for the latch are suspended without blocking threads and all of them are
+    resumed by their coroutine schedulers when the latch counter reaches zero.
+
+    Usage: co_await latch;
+
+    Thread-safe.
+*/
+class AsyncLatch
+{
+public:
+    //! Latch awaiter
+    class Awaiter
+    {
+    public:
+        explicit Awaiter(AsyncLatch& latch) noexcept : _latch(latch) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> coroutine);
+        void await_resume() const noexcept {}
+
+    private:
+        AsyncLatch& _latch;
+        Internals::CoroutineWaiter _waiter;
+    };
+
+    //! Default class constructor
+    /*!
+        \param counter - Latch counter initial value
+    */
+    explicit AsyncLatch(int counter) noexcept;
+    AsyncLatch(const AsyncLatch&) = delete;
+    AsyncLatch(AsyncLatch&&) = delete;
+    ~AsyncLatch();
+
+    AsyncLatch& operator=(const AsyncLatch&) = delete;
+    AsyncLatch& operator=(AsyncLatch&&) = delete;
+
+    //! Get the current latch counter
+    int counter() const;
+
+    //! Reset the latch with a new counter value
+    /*!
+        This method may only be invoked when there are no coroutines currently
+        waiting for the latch.
+
+        \param counter - Latch counter value
+    */
+    void Reset(int counter);
+
+    //! Countdown the latch
+    /*!
+        Decrements the latch counter by 1. If the latch counter reaches 0,
+        all waiting coroutines will be resumed.
+
+        Will not block.
+    */
+    void CountDown();
+
+    //! Try to wait for the latch without suspend
+    /*!
+        \return 'true' if the latch counter is zero, 'false' if the latch counter is not zero
+    */
+    bool TryWait() const { return (counter() == 0); }
+
+    //! Wait for the latch
+    Awaiter operator co_await() noexcept { return Awaiter(*this); }
+
+private:
+    mutable CriticalSection _cs;
+    int _counter;
+    Internals::CoroutineWaiters _waiters;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_LATCH_H
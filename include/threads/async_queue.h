@@ -0,0 +1,215 @@
+/*!
+    \file async_queue.h
+    \brief Awaitable multiple producers / multiple consumers queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_QUEUE_H
+#define CPPCOMMON_THREADS_ASYNC_QUEUE_H
+
+#include "threads/coroutine_scheduler.h"
+
+#include <deque>
+#include <vector>
+
+namespace CppCommon {
+
+//! Awaitable multiple producers / multiple consumers queue
+/*!
+    Awaitable queue is the coroutine counterpart of WaitQueue, WaitRing and
+    WaitBatcher. Consumers waiting for items and producers waiting for free
+    space of the bounded queue are suspended without blocking threads. Items
+    are handed over to waiting consumers directly. Suspended coroutines are
+    resumed in FIFO order by their coroutine schedulers.
+
+    Usage: if (co_await queue.Dequeue(item)) { ... }
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+*/
+template<typename T>
+class AsyncQueue
+{
+    // Suspended consumer
+    struct ConsumerWaiter : public Internals::CoroutineWaiter
+    {
+        T* item;
+        std::vector<T>* items;
+        bool result;
+
+        ConsumerWaiter(T* target, std::vector<T>* targets) noexcept : item(target), items(targets), result(false) {}
+
+        void Deliver(T&& value);
+    };
+
+    // Suspended producer
+    struct ProducerWaiter : public Internals::CoroutineWaiter
+    {
+        T item;
+        bool result;
+
+        template <typename U>
+        explicit ProducerWaiter(U&& value) : item(std::forward<U>(value)), result(false) {}
+    };
+
+public:
+    //! Enqueue awaiter
+    class EnqueueAwaiter
+    {
+    public:
+        template <typename U>
+        EnqueueAwaiter(AsyncQueue& queue, U&& item) : _queue(queue), _producer(std::forward<U>(item)) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> coroutine);
+        bool await_resume() const noexcept { return _producer.result; }
+
+    private:
+        AsyncQueue& _queue;
+        ProducerWaiter _producer;
+    };
+
+    //! Dequeue awaiter
+    class DequeueAwaiter
+    {
+    public:
+        DequeueAwaiter(AsyncQueue& queue, T* item, std::vector<T>* items) noexcept : _queue(queue), _consumer(item, items) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> coroutine);
+        bool await_resume() const noexcept { return _consumer.result; }
+
+    private:
+        AsyncQueue& _queue;
+        ConsumerWaiter _consumer;
+    };
+
+    //! Default class constructor
+    /*!
+        \param capacity - Queue capacity (default is 0 for unlimited capacity)
+    */
+    explicit AsyncQueue(size_t capacity = 0) : _closed(false), _capacity(capacity) {}
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue(AsyncQueue&&) = delete;
+    ~AsyncQueue();
+
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(AsyncQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const { return !closed() && !empty(); }
+
+    //! Is queue closed?
+    bool closed() const;
+
+    //! Is queue empty?
+    bool empty() const { return (size() == 0); }
+    //! Get queue capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get queue size
+    size_t size() const;
+
+    //! Try to enqueue an item into the queue without suspend
+    /*!
+        The item will be copied into the queue.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the queue is full or closed
+    */
+    bool TryEnqueue(const T& item) { return TryEnqueue(T(item)); }
+    //! Try to enqueue an item into the queue without suspend
+    /*!
+        The item will be moved into the queue.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the queue is full or closed
+    */
+    bool TryEnqueue(T&& item);
+
+    //! Enqueue an item into the queue
+    /*!
+        The item will be copied into the queue. Suspends the current coroutine
+        while the bounded queue is full.
+
+        Usage: co_await queue.Enqueue(item) returns 'true' if the item was successfully enqueue, 'false' if the queue is closed
+
+        \param item - Item to enqueue
+    */
+    EnqueueAwaiter Enqueue(const T& item) { return EnqueueAwaiter(*this, item); }
+    //! Enqueue an item into the queue
+    /*!
+        The item will be moved into the queue. Suspends the current coroutine
+        while the bounded queue is full.
+
+        Usage: co_await queue.Enqueue(std::move(item)) returns 'true' if the item was successfully enqueue, 'false' if the queue is closed
+
+        \param item - Item to enqueue
+    */
+    EnqueueAwaiter Enqueue(T&& item) { return EnqueueAwaiter(*this, std::move(item)); }
+
+    //! Try to dequeue an item from the queue without suspend
+    /*!
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the queue is empty
+    */
+    bool TryDequeue(T& item);
+
+    //! Dequeue an item from the queue
+    /*!
+        The item will be moved from the queue. Suspends the current coroutine
+        while the queue is empty.
+
+        Usage: co_await queue.Dequeue(item) returns 'true' if the item was successfully dequeue, 'false' if the queue is closed and empty
+
+        \param item - Item to dequeue
+    */
+    DequeueAwaiter Dequeue(T& item) noexcept { return DequeueAwaiter(*this, &item, nullptr); }
+    //! Dequeue all items from the queue
+    /*!
+        All items will be moved from the queue with a single resume. Suspends
+        the current coroutine while the queue is empty.
+
+        Usage: co_await queue.DequeueAll(items) returns 'true' if items were successfully dequeue, 'false' if the queue is closed and empty
+
+        \param items - Items to dequeue
+    */
+    DequeueAwaiter DequeueAll(std::vector<T>& items) noexcept { return DequeueAwaiter(*this, nullptr, &items); }
+
+    //! Close the queue
+    /*!
+        All suspended producers are resumed with 'false' result. All suspended
+        consumers are resumed with 'false' result. Items left in the queue could
+        be still dequeued.
+    */
+    void Close();
+
+private:
+    mutable CriticalSection _cs;
+    bool _closed;
+    const size_t _capacity;
+    std::deque<T> _queue;
+    Internals::CoroutineWaiters _consumers;
+    Internals::CoroutineWaiters _producers;
+
+    //! Is the queue full? (must be called under the critical section)
+    bool full() const noexcept { return ((_capacity > 0) && (_queue.size() >= _capacity)); }
+
+    //! Take items from the queue for the given consumer (must be called under the critical section)
+    /*!
+        \param consumer - Consumer to deliver items
+        \return List of producers to resume
+    */
+    Internals::CoroutineWaiter* Take(ConsumerWaiter& consumer);
+
+    //! Resume the list of suspended coroutines
+    static void Resume(Internals::CoroutineWaiter* waiters);
+};
+
+} // namespace CppCommon
+
+#include "async_queue.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_QUEUE_H
@@ -0,0 +1,230 @@
+/*!
+    \file async_queue.inl
+    \brief Awaitable multiple producers / multiple consumers queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline AsyncQueue<T>::~AsyncQueue()
+{
+    Close();
+}
+
+template<typename T>
+inline bool AsyncQueue<T>::closed() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _closed;
+}
+
+template<typename T>
+inline size_t AsyncQueue<T>::size() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _queue.size();
+}
+
+template<typename T>
+inline bool AsyncQueue<T>::TryEnqueue(T&& item)
+{
+    ConsumerWaiter* consumer;
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        if (_closed)
+            return false;
+
+        // Hand over the item to the waiting consumer
+        consumer = static_cast<ConsumerWaiter*>(_consumers.Pop());
+        if (consumer != nullptr)
+            consumer->Deliver(std::move(item));
+        else if (full())
+            return false;
+        else
+            _queue.push_back(std::move(item));
+    }
+
+    if (consumer != nullptr)
+        consumer->Resume();
+
+    return true;
+}
+
+template<typename T>
+inline bool AsyncQueue<T>::EnqueueAwaiter::await_suspend(std::coroutine_handle<> coroutine)
+{
+    ConsumerWaiter* consumer;
+    {
+        Locker<CriticalSection> locker(_queue._cs);
+
+        if (_queue._closed)
+        {
+            _producer.result = false;
+            return false;
+        }
+
+        // Hand over the item to the waiting consumer
+        consumer = static_cast<ConsumerWaiter*>(_queue._consumers.Pop());
+        if (consumer != nullptr)
+            consumer->Deliver(std::move(_producer.item));
+        else if (!_queue.full())
+            _queue._queue.push_back(std::move(_producer.item));
+        else
+        {
+            // Suspend the producer until the queue has free space
+            _producer.Suspend(coroutine);
+            _queue._producers.Push(&_producer);
+            return true;
+        }
+
+        _producer.result = true;
+    }
+
+    if (consumer != nullptr)
+        consumer->Resume();
+
+    return false;
+}
+
+template<typename T>
+inline bool AsyncQueue<T>::TryDequeue(T& item)
+{
+    Internals::CoroutineWaiter* producers;
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        if (_queue.empty())
+            return false;
+
+        ConsumerWaiter consumer(&item, nullptr);
+        producers = Take(consumer);
+    }
+
+    Resume(producers);
+
+    return true;
+}
+
+template<typename T>
+inline bool AsyncQueue<T>::DequeueAwaiter::await_suspend(std::coroutine_handle<> coroutine)
+{
+    Internals::CoroutineWaiter* producers;
+    {
+        Locker<CriticalSection> locker(_queue._cs);
+
+        if (_queue._queue.empty())
+        {
+            if (_queue._closed)
+            {
+                _consumer.result = false;
+                return false;
+            }
+
+            // Suspend the consumer until the item is handed over
+            if (_consumer.items != nullptr)
+                _consumer.items->clear();
+            _consumer.Suspend(coroutine);
+            _queue._consumers.Push(&_consumer);
+            return true;
+        }
+
+        producers = _queue.Take(_consumer);
+    }
+
+    Resume(producers);
+
+    return false;
+}
+
+template<typename T>
+inline void AsyncQueue<T>::Close()
+{
+    Internals::CoroutineWaiter* consumers;
+    Internals::CoroutineWaiter* producers;
+    {
+        Locker<CriticalSection> locker(_cs);
+        _closed = true;
+        consumers = _consumers.Release();
+        producers = _producers.Release();
+    }
+
+    // Resume all suspended coroutines with 'false' result
+    for (auto waiter = consumers; waiter != nullptr; waiter = waiter->next)
+        static_cast<ConsumerWaiter*>(waiter)->result = false;
+    for (auto waiter = producers; waiter != nullptr; waiter = waiter->next)
+        static_cast<ProducerWaiter*>(waiter)->result = false;
+    Resume(consumers);
+    Resume(producers);
+}
+
+template<typename T>
+inline void AsyncQueue<T>::ConsumerWaiter::Deliver(T&& value)
+{
+    if (item != nullptr)
+        *item = std::move(value);
+    else
+    {
+        items->clear();
+        items->push_back(std::move(value));
+    }
+    result = true;
+}
+
+template<typename T>
+inline Internals::CoroutineWaiter* AsyncQueue<T>::Take(ConsumerWaiter& consumer)
+{
+    Internals::CoroutineWaiters producers;
+
+    if (consumer.item != nullptr)
+    {
+        *consumer.item = std::move(_queue.front());
+        _queue.pop_front();
+
+        // Admit the first waiting producer into the freed space
+        ProducerWaiter* producer = static_cast<ProducerWaiter*>(_producers.Pop());
+        if (producer != nullptr)
+        {
+            _queue.push_back(std::move(producer->item));
+            producer->result = true;
+            producer->next = nullptr;
+            producers.Push(producer);
+        }
+    }
+    else
+    {
+        consumer.items->clear();
+        for (auto& item : _queue)
+            consumer.items->push_back(std::move(item));
+        _queue.clear();
+
+        // Take items of all waiting producers which are next in FIFO order
+        producers.head = _producers.Release();
+        for (auto waiter = producers.head; waiter != nullptr; waiter = waiter->next)
+        {
+            ProducerWaiter* producer = static_cast<ProducerWaiter*>(waiter);
+            consumer.items->push_back(std::move(producer->item));
+            producer->result = true;
+        }
+    }
+
+    consumer.result = true;
+    return producers.head;
+}
+
+template<typename T>
+inline void AsyncQueue<T>::Resume(Internals::CoroutineWaiter* waiters)
+{
+    while (waiters != nullptr)
+    {
+        // Take the next waiter before the resume which could destroy the current one
+        Internals::CoroutineWaiter* waiter = waiters;
+        waiters = waiters->next;
+        waiter->Resume();
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,114 @@
+/*!
+    \file combining_tree.h
+    \brief Combining tree layout definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_COMBINING_TREE_H
+#define CPPCOMMON_THREADS_COMBINING_TREE_H
+
+#include "system/cpu_topology.h"
+
+#include <cassert>
+#include <vector>
+
+namespace CppCommon {
+
+//! Combining tree layout
+/*!
+    Combining tree describes how participants of hierarchical synchronization
+    primitives (TreeBarrier, TreeLatch) are combined. Each participant is
+    attached to a leaf node, each node is attached to its parent node and
+    counts its children (participants and nodes). Primitives keep the state
+    of each node in its own cache line, so each cache line is shared only by
+    children of a single node (at most fan-in threads) instead of all threads.
+
+    The topology-aware layout groups participants by the CPUs they are pinned
+    to: SMT siblings of the same physical core first, then CPUs sharing L2
+    and L3 caches, then CPUs of the same socket. So most of arrivals and
+    wakeups stay in the local cache and only one thread of each group
+    crosses the socket boundary.
+
+    Not thread-safe.
+
+    https://en.wikipedia.org/wiki/Barrier_(computer_science)#Combining_tree_barrier
+*/
+class CombiningTree
+{
+public:
+    //! Combining tree node
+    struct Node
+    {
+        //! Parent node index (-1 for the root node)
+        int parent{-1};
+        //! Count of children (participants and nodes)
+        int count{0};
+        //! Depth of the node (0 for the root node)
+        int depth{0};
+    };
+
+    //! Default fan-in of tree nodes
+    static const int FANIN = 4;
+
+    //! Initialize the combining tree of consecutive participants
+    /*!
+        Participants with consecutive indexes are combined together.
+
+        \param participants - Count of participants
+        \param fanin - Maximal count of children of each node (default is FANIN)
+    */
+    explicit CombiningTree(int participants, int fanin = FANIN);
+    //! Initialize the topology-aware combining tree of participants pinned to the given CPUs
+    /*!
+        \param cpus - Logical CPU index of each participant (-1 if the participant is not pinned)
+        \param topology - CPU topology (default is CPUTopology::Current())
+        \param fanin - Maximal count of children of each node (default is FANIN)
+    */
+    explicit CombiningTree(const std::vector<int>& cpus, const CPUTopology& topology = CPUTopology::Current(), int fanin = FANIN);
+    CombiningTree(const CombiningTree&) = default;
+    CombiningTree(CombiningTree&&) noexcept = default;
+    ~CombiningTree() = default;
+
+    CombiningTree& operator=(const CombiningTree&) = default;
+    CombiningTree& operator=(CombiningTree&&) noexcept = default;
+
+    //! Get the count of participants
+    int participants() const noexcept { return (int)_leaves.size(); }
+    //! Get the count of tree nodes
+    int size() const noexcept { return (int)_nodes.size(); }
+    //! Get the tree depth (count of node levels)
+    int depth() const noexcept { return _depth; }
+    //! Get the root node index
+    int root() const noexcept { return (int)_nodes.size() - 1; }
+
+    //! Get tree nodes
+    const std::vector<Node>& nodes() const noexcept { return _nodes; }
+    //! Get the leaf node index of the given participant
+    int leaf(int participant) const noexcept
+    {
+        assert(((participant >= 0) && (participant < participants())) && "Invalid participant index!");
+        return _leaves[participant];
+    }
+
+private:
+    // Combined unit (participant or node)
+    struct Unit
+    {
+        int participant;    // Representative participant
+        int node;           // Node index (-1 for the participant)
+    };
+
+    std::vector<Node> _nodes;
+    std::vector<int> _leaves;
+    int _depth;
+    int _fanin;
+
+    void Build(const std::vector<std::vector<int>>& levels);
+    Unit Combine(std::vector<Unit>& units);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_COMBINING_TREE_H
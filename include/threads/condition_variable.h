@@ -25,6 +25,10 @@ namespace CppCommon {
     a thread is woken, it re-acquires the lock it released when the thread entered
     the sleeping state.
 
+    On Linux and Windows waiting threads are blocked on the notification sequence
+    number, so notifying without waiting threads does not enter the kernel. Other
+    Unix systems keep the queue of waiting threads and wake only dequeued ones.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Monitor_(synchronization)
@@ -0,0 +1,312 @@
+/*!
+    \file coroutine_scheduler.h
+    \brief Coroutine schedulers definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_COROUTINE_SCHEDULER_H
+#define CPPCOMMON_THREADS_COROUTINE_SCHEDULER_H
+
+#include "threads/coroutine_task.h"
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/thread_pool.h"
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <coroutine>
+#include <vector>
+
+namespace CppCommon {
+
+//! Coroutine scheduler interface
+/*!
+    Coroutine scheduler resumes suspended coroutines in its threads. Awaitable
+    synchronization primitives remember the scheduler of the suspended coroutine
+    and post the coroutine back to it when it is ready to continue, so waiting
+    coroutines occupy only their frames instead of blocked threads.
+
+    Thread-safe.
+*/
+class CoroutineScheduler
+{
+public:
+    //! Schedule awaiter
+    class ScheduleAwaiter
+    {
+    public:
+        explicit ScheduleAwaiter(CoroutineScheduler& scheduler) noexcept : _scheduler(scheduler) {}
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> coroutine) { _scheduler.Post(coroutine); }
+        void await_resume() const noexcept {}
+
+    private:
+        CoroutineScheduler& _scheduler;
+    };
+
+    CoroutineScheduler() = default;
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler(CoroutineScheduler&&) = delete;
+    virtual ~CoroutineScheduler() = default;
+
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(CoroutineScheduler&&) = delete;
+
+    //! Get the coroutine scheduler of the current thread
+    /*!
+        \return Coroutine scheduler which resumes the current coroutine or nullptr if the current thread is not run by any coroutine scheduler
+    */
+    static CoroutineScheduler* Current() noexcept;
+
+    //! Post the suspended coroutine to be resumed by the scheduler
+    /*!
+        \param coroutine - Suspended coroutine
+    */
+    virtual void Post(std::coroutine_handle<> coroutine) = 0;
+
+    //! Switch the current coroutine onto the scheduler
+    /*!
+        Usage: co_await scheduler.Schedule();
+    */
+    ScheduleAwaiter Schedule() noexcept { return ScheduleAwaiter(*this); }
+
+    //! Spawn the detached task on the scheduler
+    /*!
+        The task is started in the scheduler and destroyed when it is completed.
+        Unhandled exception thrown from the detached task terminates the process
+        like the one thrown from std::thread.
+
+        \param task - Task to spawn
+    */
+    void Spawn(Task<void> task);
+
+protected:
+    //! Resume the coroutine in the current thread on behalf of the scheduler
+    /*!
+        \param coroutine - Suspended coroutine
+    */
+    void Resume(std::coroutine_handle<> coroutine);
+};
+
+//! Single-threaded coroutine scheduler
+/*!
+    Single-threaded coroutine scheduler resumes all posted coroutines in the
+    thread which calls Run() or Poll(). Coroutines could be posted from any
+    thread. Coroutines left suspended in the scheduler are not destroyed.
+
+    Thread-safe.
+*/
+class SingleThreadScheduler : public CoroutineScheduler
+{
+public:
+    SingleThreadScheduler() : _stopped(false) {}
+    SingleThreadScheduler(const SingleThreadScheduler&) = delete;
+    SingleThreadScheduler(SingleThreadScheduler&&) = delete;
+    ~SingleThreadScheduler() = default;
+
+    SingleThreadScheduler& operator=(const SingleThreadScheduler&) = delete;
+    SingleThreadScheduler& operator=(SingleThreadScheduler&&) = delete;
+
+    //! Is the scheduler stopped?
+    bool stopped() const noexcept { return _stopped.load(std::memory_order_acquire); }
+
+    //! Get the count of coroutines ready to resume
+    size_t pending() const;
+
+    //! Post the suspended coroutine to be resumed by the scheduler
+    void Post(std::coroutine_handle<> coroutine) override;
+
+    //! Resume all coroutines ready to resume in the current thread
+    /*!
+        Coroutines posted during the poll are resumed too.
+
+        Will not block.
+
+        \return Count of resumed coroutines
+    */
+    size_t Poll();
+
+    //! Run the scheduler in the current thread until it is stopped
+    /*!
+        Will block.
+    */
+    void Run();
+
+    //! Stop the scheduler
+    /*!
+        Wakes up the thread which runs the scheduler. Coroutines posted after
+        the stop could be still resumed with Poll().
+    */
+    void Stop();
+
+private:
+    mutable CriticalSection _cs;
+    EventAutoReset _wakeup;
+    std::vector<std::coroutine_handle<>> _ready;
+    std::vector<std::coroutine_handle<>> _batch;
+    std::atomic<bool> _stopped;
+};
+
+//! Multi-threaded coroutine scheduler
+/*!
+    Multi-threaded coroutine scheduler resumes posted coroutines in worker
+    threads of the work-stealing thread pool. Coroutines posted from worker
+    threads are resumed in the same worker if it is not stolen.
+
+    Thread-safe.
+*/
+class MultiThreadScheduler : public CoroutineScheduler
+{
+public:
+    //! Initialize and start the scheduler
+    /*!
+        \param threads - Count of worker threads (default is 0 for the count of logical CPU cores)
+        \param capacity - Global injection queue capacity (must be a power of two, default is 4096)
+        \param pinning - Pin worker threads to CPU cores (default is false)
+    */
+    explicit MultiThreadScheduler(size_t threads = 0, size_t capacity = 4096, bool pinning = false) : _pool(threads, capacity, pinning) {}
+    MultiThreadScheduler(const MultiThreadScheduler&) = delete;
+    MultiThreadScheduler(MultiThreadScheduler&&) = delete;
+    ~MultiThreadScheduler() { Stop(); }
+
+    MultiThreadScheduler& operator=(const MultiThreadScheduler&) = delete;
+    MultiThreadScheduler& operator=(MultiThreadScheduler&&) = delete;
+
+    //! Get the count of worker threads
+    size_t threads() const noexcept { return _pool.threads(); }
+    //! Is the scheduler stopped?
+    bool stopped() const noexcept { return _pool.stopped(); }
+
+    //! Post the suspended coroutine to be resumed by the scheduler
+    /*!
+        Coroutines posted after the stop are never resumed.
+    */
+    void Post(std::coroutine_handle<> coroutine) override;
+
+    //! Wait until all posted coroutines are resumed and suspended again or completed
+    /*!
+        Will block.
+    */
+    void Wait() { _pool.Wait(); }
+
+    //! Stop the scheduler
+    /*!
+        Resumes all posted coroutines and joins worker threads.
+
+        Will block.
+    */
+    void Stop() { _pool.Stop(); }
+
+private:
+    ThreadPool _pool;
+};
+
+//! Sleep awaiter
+class SleepAwaiter
+{
+public:
+    explicit SleepAwaiter(const Timespan& timespan) noexcept : _timespan(timespan) {}
+
+    bool await_ready() const noexcept { return (_timespan.total() <= 0); }
+    void await_suspend(std::coroutine_handle<> coroutine);
+    void await_resume() const noexcept {}
+
+private:
+    Timespan _timespan;
+};
+
+//! Suspend the current coroutine for the given timespan
+/*!
+    The coroutine is resumed by the coroutine scheduler it was suspended on,
+    or in the timer thread if it was not run by any scheduler. Sleeping
+    coroutines share the single timer thread.
+
+    Usage: co_await SleepFor(Timespan::milliseconds(100));
+
+    \param timespan - Timespan to sleep
+*/
+inline SleepAwaiter SleepFor(const Timespan& timespan) noexcept { return SleepAwaiter(timespan); }
+//! Suspend the current coroutine until the given timestamp
+/*!
+    \param timestamp - Timestamp to stop sleeping
+*/
+inline SleepAwaiter SleepUntil(const UtcTimestamp& timestamp) noexcept { return SleepAwaiter(timestamp - UtcTimestamp()); }
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Suspended coroutine waiting for an awaitable synchronization primitive
+struct CoroutineWaiter
+{
+    std::coroutine_handle<> coroutine;
+    CoroutineScheduler* scheduler;
+    CoroutineWaiter* next;
+
+    // Remember the suspended coroutine and its scheduler
+    void Suspend(std::coroutine_handle<> handle) noexcept
+    {
+        coroutine = handle;
+        scheduler = CoroutineScheduler::Current();
+        next = nullptr;
+    }
+
+    // Resume the coroutine with its scheduler or in the current thread
+    void Resume()
+    {
+        if (scheduler != nullptr)
+            scheduler->Post(coroutine);
+        else
+            coroutine.resume();
+    }
+};
+
+// Intrusive FIFO list of suspended coroutines
+struct CoroutineWaiters
+{
+    CoroutineWaiter* head = nullptr;
+    CoroutineWaiter* tail = nullptr;
+
+    bool empty() const noexcept { return (head == nullptr); }
+
+    void Push(CoroutineWaiter* waiter) noexcept
+    {
+        if (tail != nullptr)
+            tail->next = waiter;
+        else
+            head = waiter;
+        tail = waiter;
+    }
+
+    CoroutineWaiter* Pop() noexcept
+    {
+        CoroutineWaiter* waiter = head;
+        if (waiter != nullptr)
+        {
+            head = waiter->next;
+            if (head == nullptr)
+                tail = nullptr;
+        }
+        return waiter;
+    }
+
+    // Move all waiters out of the list
+    CoroutineWaiter* Release() noexcept
+    {
+        CoroutineWaiter* waiters = head;
+        head = tail = nullptr;
+        return waiters;
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+/*! \example threads_coroutines.cpp Coroutines with awaitable synchronization primitives example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_COROUTINE_SCHEDULER_H
@@ -0,0 +1,154 @@
+/*!
+    \file coroutine_task.h
+    \brief Coroutine task definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_COROUTINE_TASK_H
+#define CPPCOMMON_THREADS_COROUTINE_TASK_H
+
+#include "threads/event_manual_reset.h"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+template <typename T>
+class Task;
+
+//! @cond INTERNALS
+namespace Internals {
+
+class TaskPromiseBase
+{
+public:
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <class TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> coroutine) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { _exception = std::current_exception(); }
+
+    void continuation(std::coroutine_handle<> coroutine) noexcept { _continuation = coroutine; }
+
+protected:
+    std::coroutine_handle<> _continuation;
+    std::exception_ptr _exception;
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value) { _value.emplace(std::forward<U>(value)); }
+
+    T result();
+
+private:
+    std::optional<T> _value;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void result();
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Coroutine task
+/*!
+    Coroutine task is a lazy coroutine which starts when it is awaited with
+    co_await from another coroutine or with SyncWait() from a regular thread.
+    The awaiting coroutine is resumed with symmetric transfer when the task is
+    completed, so long chains of nested tasks do not grow the stack in optimized
+    builds.
+
+    Task result (or the exception thrown from the task) is moved out to the
+    awaiting coroutine, so the task could be awaited only once.
+
+    Not thread-safe.
+*/
+template <typename T = void>
+class Task
+{
+public:
+    //! Coroutine promise type
+    typedef Internals::TaskPromise<T> promise_type;
+
+    static_assert(!std::is_reference<T>::value, "Task result must not be a reference!");
+
+    //! Task awaiter
+    class Awaiter
+    {
+    public:
+        explicit Awaiter(std::coroutine_handle<promise_type> coroutine) noexcept : _coroutine(coroutine) {}
+
+        bool await_ready() const noexcept { return !_coroutine || _coroutine.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept;
+        T await_resume() { return _coroutine.promise().result(); }
+
+    private:
+        std::coroutine_handle<promise_type> _coroutine;
+    };
+
+    Task() noexcept = default;
+    explicit Task(std::coroutine_handle<promise_type> coroutine) noexcept : _coroutine(coroutine) {}
+    Task(const Task&) = delete;
+    Task(Task&& task) noexcept : _coroutine(std::exchange(task._coroutine, nullptr)) {}
+    ~Task() { if (_coroutine) _coroutine.destroy(); }
+
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&& task) noexcept;
+
+    //! Check if the task is valid
+    explicit operator bool() const noexcept { return (bool)_coroutine; }
+
+    //! Is the task completed?
+    bool done() const noexcept { return !_coroutine || _coroutine.done(); }
+
+    //! Await the task
+    Awaiter operator co_await() const noexcept { return Awaiter(_coroutine); }
+
+private:
+    std::coroutine_handle<promise_type> _coroutine;
+};
+
+//! Run the task and wait for its result in the current thread
+/*!
+    Starts the task in the current thread and blocks until the task is completed.
+    The task could be switched onto a coroutine scheduler and completed there.
+
+    Will block.
+
+    \param task - Task to wait
+    \return Task result (the exception thrown from the task is rethrown)
+*/
+template <typename T>
+T SyncWait(Task<T>&& task);
+
+} // namespace CppCommon
+
+#include "coroutine_task.inl"
+
+#endif // CPPCOMMON_THREADS_COROUTINE_TASK_H
@@ -0,0 +1,145 @@
+/*!
+    \file coroutine_task.inl
+    \brief Coroutine task inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <class TPromise>
+inline std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<TPromise> coroutine) noexcept
+{
+    // Transfer the control to the awaiting coroutine
+    std::coroutine_handle<> continuation = coroutine.promise()._continuation;
+    return continuation ? continuation : std::noop_coroutine();
+}
+
+template <typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+template <typename T>
+inline T TaskPromise<T>::result()
+{
+    if (_exception)
+        std::rethrow_exception(_exception);
+
+    return std::move(*_value);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+inline void TaskPromise<void>::result()
+{
+    if (_exception)
+        std::rethrow_exception(_exception);
+}
+
+class SyncWaitTask
+{
+public:
+    struct promise_type
+    {
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> coroutine) const noexcept { coroutine.promise().event->Signal(); }
+            void await_resume() const noexcept {}
+        };
+
+        EventManualReset* event = nullptr;
+        std::exception_ptr exception;
+
+        SyncWaitTask get_return_object() noexcept { return SyncWaitTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+    };
+
+    explicit SyncWaitTask(std::coroutine_handle<promise_type> coroutine) noexcept : _coroutine(coroutine) {}
+    SyncWaitTask(const SyncWaitTask&) = delete;
+    SyncWaitTask(SyncWaitTask&&) = delete;
+    ~SyncWaitTask() { _coroutine.destroy(); }
+
+    SyncWaitTask& operator=(const SyncWaitTask&) = delete;
+    SyncWaitTask& operator=(SyncWaitTask&&) = delete;
+
+    void Run()
+    {
+        // Start the coroutine and wait for its final suspend point
+        EventManualReset event;
+        _coroutine.promise().event = &event;
+        _coroutine.resume();
+        event.Wait();
+
+        if (_coroutine.promise().exception)
+            std::rethrow_exception(_coroutine.promise().exception);
+    }
+
+private:
+    std::coroutine_handle<promise_type> _coroutine;
+};
+
+template <typename T>
+inline SyncWaitTask SyncWaitValue(Task<T>& task, std::optional<T>& result)
+{
+    result.emplace(co_await task);
+}
+
+inline SyncWaitTask SyncWaitVoid(Task<void>& task)
+{
+    co_await task;
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+inline std::coroutine_handle<> Task<T>::Awaiter::await_suspend(std::coroutine_handle<> awaiting) noexcept
+{
+    // Start the task and resume the awaiting coroutine when it is completed
+    _coroutine.promise().continuation(awaiting);
+    return _coroutine;
+}
+
+template <typename T>
+inline Task<T>& Task<T>::operator=(Task&& task) noexcept
+{
+    if (this != &task)
+    {
+        if (_coroutine)
+            _coroutine.destroy();
+        _coroutine = std::exchange(task._coroutine, nullptr);
+    }
+    return *this;
+}
+
+template <typename T>
+inline T SyncWait(Task<T>&& task)
+{
+    if constexpr (std::is_void<T>::value)
+    {
+        Internals::SyncWaitTask wait = Internals::SyncWaitVoid(task);
+        wait.Run();
+    }
+    else
+    {
+        std::optional<T> result;
+        Internals::SyncWaitTask wait = Internals::SyncWaitValue(task, result);
+        wait.Run();
+        return std::move(*result);
+    }
+}
+
+} // namespace CppCommon
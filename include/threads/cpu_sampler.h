@@ -0,0 +1,116 @@
+/*!
+    \file cpu_sampler.h
+    \brief Thread CPU time sampler definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_CPU_SAMPLER_H
+#define CPPCOMMON_THREADS_CPU_SAMPLER_H
+
+#include "system/process.h"
+#include "threads/thread.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! Thread CPU time sample
+struct CpuThreadSample
+{
+    std::string name;           //!< Thread name
+    Timespan cpu;               //!< CPU time consumed since the previous sample
+    double utilization{0.0};    //!< CPU time to the wall time ratio (1.0 is a fully busy CPU)
+    bool alive{true};           //!< Is the thread still alive?
+};
+
+//! CPU time sample
+struct CpuSample
+{
+    Timespan wall;                          //!< Wall time since the previous sample
+    std::vector<CpuThreadSample> threads;   //!< Samples of registered threads
+    ProcessUsage process;                   //!< Process resource usage since the previous sample (RSS values are current)
+
+    //! Get the process CPU time which is not attributed to registered threads
+    Timespan unattributed() const noexcept;
+    //! Get the process CPU time to the wall time ratio
+    double utilization() const noexcept
+    { return (wall.total() > 0) ? ((double)process.cpu().total() / (double)wall.total()) : 0.0; }
+};
+
+//! Thread CPU time sampler
+/*!
+    CPU sampler attributes CPU time of the process to registered threads
+    (e.g. worker threads pinned to CPUs). Each Sample() call reads CPU clocks
+    of registered threads (one system call per thread, CPU clocks of threads
+    are kept from the registration) and the process resource usage, and
+    returns differences since the previous sample, so it is cheap enough to
+    be called periodically from a monitoring thread.
+
+    Threads which finished are reported as not alive with zero CPU time.
+
+    Thread-safe.
+*/
+class CpuSampler
+{
+public:
+    //! Initialize the CPU sampler
+    /*!
+        The first sample starts when the sampler is created.
+    */
+    CpuSampler();
+    CpuSampler(const CpuSampler&) = delete;
+    CpuSampler(CpuSampler&&) = delete;
+    ~CpuSampler();
+
+    CpuSampler& operator=(const CpuSampler&) = delete;
+    CpuSampler& operator=(CpuSampler&&) = delete;
+
+    //! Get the count of registered threads
+    size_t size() const;
+
+    //! Register the given thread
+    /*!
+        \param thread - Running thread
+        \param name - Thread name
+    */
+    void Register(std::thread& thread, const std::string& name);
+    //! Register the current thread
+    /*!
+        \param name - Thread name
+    */
+    void RegisterCurrentThread(const std::string& name);
+
+    //! Sample CPU time of registered threads and the process
+    /*!
+        \return CPU time sample since the previous sample
+    */
+    CpuSample Sample();
+
+private:
+    // Registered thread
+    struct Entry
+    {
+        std::string name;   // Thread name
+        uint64_t clock;     // Platform CPU clock of the thread
+        Timespan last;      // CPU time of the previous sample
+        bool alive;         // Is the thread alive?
+    };
+
+    mutable std::mutex _mutex;
+    std::vector<Entry> _threads;
+    uint64_t _timestamp;
+    ProcessUsage _process;
+
+    void Register(std::string name, uint64_t clock);
+};
+
+/*! \example threads_cpu_sampler.cpp Thread CPU time sampler example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_CPU_SAMPLER_H
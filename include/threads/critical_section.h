@@ -12,16 +12,37 @@
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
+#include <atomic>
+#include <cassert>
+#include <cstdint>
 #include <memory>
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Address of the thread local variable identifies the current thread without the system call
+inline uintptr_t CurrentThreadTag() noexcept
+{
+    static thread_local char tag = 0;
+    return (uintptr_t)&tag;
+}
+
+} // namespace Internals
+//! @endcond
+
 //! Critical section synchronization primitive
 /*!
     Critical sections prevents code fragments from access by multiple threads simultaneously. Only one thread can
     access the code inside the critical section. Other threads must wait for the lock! Critical sections are usually
     more lightweight than mutexes and don't enter kernel mode.
 
+    Critical section is recursive: the owner thread may acquire it several times and must release it
+    the same count of times. Critical section state, owner thread and recursion count are kept in the
+    critical section object, so uncontended and recursive lock and unlock are inlined atomic operations.
+    Only contended operations call the platform implementation to spin and block the thread.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Critical_section
@@ -45,7 +66,7 @@ public:
 
         \return 'true' if the critical section was successfully acquired, 'false' if the critical section is busy
     */
-    bool TryLock();
+    bool TryLock() noexcept;
 
     //! Try to acquire critical section for the given timespan
     /*!
@@ -78,21 +99,28 @@ public:
     void Unlock();
 
 private:
-    class Impl;
-
-    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
-    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
-
-    static const size_t StorageSize = 64;
-    static const size_t StorageAlign = 8;
-    alignas(StorageAlign) std::byte _storage[StorageSize];
-
-    //! Get the native critical section handler
-    void* native() noexcept;
+    // Critical section state: 0 - unlocked, 1 - locked, 2 - locked with blocked threads
+    std::atomic<uint32_t> _state;
+    // Recursion count of the owner thread
+    uint32_t _count;
+    // Owner thread tag
+    std::atomic<uintptr_t> _owner;
+
+    //! Acquire the contended critical section with block
+    void LockSlow();
+    //! Wake one of threads blocked on the released critical section
+    void UnlockSlow();
+
+    //! Release all recursive acquisitions of the owner thread (used by ConditionVariable)
+    uint32_t ReleaseAll();
+    //! Acquire the critical section and restore the recursion count (used by ConditionVariable)
+    void RestoreAll(uint32_t count);
 };
 
 /*! \example threads_critical_section.cpp Critical section synchronization primitive example */
 
 } // namespace CppCommon
 
+#include "critical_section.inl"
+
 #endif // CPPCOMMON_THREADS_CRITICAL_SECTION_H
@@ -0,0 +1,63 @@
+/*!
+    \file critical_section.inl
+    \brief Critical section synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool CriticalSection::TryLock() noexcept
+{
+    // Recursive acquisition by the owner thread
+    uintptr_t thread = Internals::CurrentThreadTag();
+    if (_owner.load(std::memory_order_relaxed) == thread)
+    {
+        ++_count;
+        return true;
+    }
+
+    uint32_t state = 0;
+    if (!_state.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        return false;
+
+    _owner.store(thread, std::memory_order_relaxed);
+    _count = 1;
+    return true;
+}
+
+inline void CriticalSection::Lock()
+{
+    // Recursive acquisition by the owner thread
+    uintptr_t thread = Internals::CurrentThreadTag();
+    if (_owner.load(std::memory_order_relaxed) == thread)
+    {
+        ++_count;
+        return;
+    }
+
+    // Uncontended path is a single atomic operation
+    uint32_t state = 0;
+    if (!_state.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        LockSlow();
+
+    _owner.store(thread, std::memory_order_relaxed);
+    _count = 1;
+}
+
+inline void CriticalSection::Unlock()
+{
+    assert((_owner.load(std::memory_order_relaxed) == Internals::CurrentThreadTag()) && "Critical section must be released by the owner thread!");
+
+    if (--_count > 0)
+        return;
+
+    _owner.store(0, std::memory_order_relaxed);
+
+    // Call the platform implementation only if there are blocked threads
+    if (_state.exchange(0, std::memory_order_release) != 1)
+        UnlockSlow();
+}
+
+} // namespace CppCommon
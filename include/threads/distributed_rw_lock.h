@@ -0,0 +1,129 @@
+/*!
+    \file distributed_rw_lock.h
+    \brief Distributed reader-biased read/write lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
+#define CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
+
+#include "system/cpu.h"
+#include "threads/futex.h"
+#include "threads/locker.h"
+#include "threads/mutex.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Distributed reader-biased read/write lock synchronization primitive
+/*!
+    Distributed read/write lock keeps readers counters in per-CPU slots placed
+    on separate cache lines. Reader acquires the lock with a single atomic
+    increment of the current CPU slot counter and a load of the writer flag,
+    so readers on different CPU cores never write the same cache line and read
+    operations scale with the count of cores.
+
+    Writer raises the writer flag to stop new readers and waits until readers
+    of all slots are drained, so write operations are much more expensive than
+    in the ordinary read/write lock. It is suitable for read-mostly data which
+    is read by many threads and rarely updated (e.g. configuration or routing
+    tables).
+
+    Reader could unlock the lock on another CPU core after the thread migration,
+    so slots counters could be negative. Writer checks the sum of all slots.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Readers%E2%80%93writer_lock
+*/
+class DistributedRWLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param slots - Count of readers slots rounded up to the power of two (default is 0 - count of logical CPU cores)
+    */
+    explicit DistributedRWLock(size_t slots = 0);
+    DistributedRWLock(const DistributedRWLock&) = delete;
+    DistributedRWLock(DistributedRWLock&&) = delete;
+    ~DistributedRWLock() = default;
+
+    DistributedRWLock& operator=(const DistributedRWLock&) = delete;
+    DistributedRWLock& operator=(DistributedRWLock&&) = delete;
+
+    //! Get the count of readers slots
+    size_t slots() const noexcept { return _mask + 1; }
+
+    //! Try to acquire read lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead() noexcept;
+    //! Try to acquire write lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite();
+
+    //! Acquire read lock with block
+    /*!
+        Will block.
+    */
+    void LockRead();
+    //! Acquire write lock with block
+    /*!
+        Will block.
+    */
+    void LockWrite();
+
+    //! Release read lock
+    /*!
+        Will not block.
+    */
+    void UnlockRead() noexcept;
+    //! Release write lock
+    /*!
+        Will not block.
+    */
+    void UnlockWrite();
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Readers slot placed on its own cache line
+    struct alignas(128) Slot
+    {
+        std::atomic<int64_t> readers;
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint32_t> _writer;
+    cache_line_pad _pad1;
+    Mutex _writers;
+    size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    //! Get the readers slot of the current CPU core
+    Slot& CurrentSlot() noexcept;
+    //! Check if readers of all slots are drained
+    bool IsDrained() const noexcept;
+};
+
+/*! \example threads_distributed_rw_lock.cpp Distributed reader-biased read/write lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "distributed_rw_lock.inl"
+
+#endif // CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
@@ -0,0 +1,103 @@
+/*!
+    \file distributed_rw_lock.inl
+    \brief Distributed reader-biased read/write lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline DistributedRWLock::DistributedRWLock(size_t slots) : _writer(0)
+{
+    if (slots == 0)
+        slots = (size_t)std::max(CPU::LogicalCores(), 1);
+
+    // Round up the count of slots to the power of two
+    size_t count = 1;
+    while (count < slots)
+        count <<= 1;
+
+    _mask = count - 1;
+    _slots = std::make_unique<Slot[]>(count);
+    for (size_t i = 0; i < count; ++i)
+        _slots[i].readers.store(0, std::memory_order_relaxed);
+}
+
+inline bool DistributedRWLock::TryLockRead() noexcept
+{
+    Slot& slot = CurrentSlot();
+
+    // Register the reader in the current CPU slot. Pairs with the writer flag store in LockWrite()
+    slot.readers.fetch_add(1, std::memory_order_seq_cst);
+    if (_writer.load(std::memory_order_seq_cst) == 0)
+        return true;
+
+    // Back off in favor of the writer
+    slot.readers.fetch_sub(1, std::memory_order_release);
+    return false;
+}
+
+inline bool DistributedRWLock::TryLockWrite()
+{
+    if (!_writers.TryLock())
+        return false;
+
+    // Stop new readers and check for active ones
+    _writer.store(1, std::memory_order_seq_cst);
+    if (IsDrained())
+        return true;
+
+    // Failed to acquire write lock
+    UnlockWrite();
+    return false;
+}
+
+inline void DistributedRWLock::LockRead()
+{
+    while (!TryLockRead())
+    {
+        // Block while the writer holds the lock
+        while (_writer.load(std::memory_order_acquire) != 0)
+            Futex::Wait(_writer, 1);
+    }
+}
+
+inline void DistributedRWLock::LockWrite()
+{
+    _writers.Lock();
+
+    // Stop new readers and wait for active ones
+    _writer.store(1, std::memory_order_seq_cst);
+    while (!IsDrained())
+        Thread::Yield();
+}
+
+inline void DistributedRWLock::UnlockRead() noexcept
+{
+    CurrentSlot().readers.fetch_sub(1, std::memory_order_release);
+}
+
+inline void DistributedRWLock::UnlockWrite()
+{
+    // Release readers blocked by the writer
+    _writer.store(0, std::memory_order_seq_cst);
+    Futex::WakeAll(_writer);
+
+    _writers.Unlock();
+}
+
+inline DistributedRWLock::Slot& DistributedRWLock::CurrentSlot() noexcept
+{
+    return _slots[Thread::CurrentThreadAffinity() & _mask];
+}
+
+inline bool DistributedRWLock::IsDrained() const noexcept
+{
+    int64_t readers = 0;
+    for (size_t i = 0; i <= _mask; ++i)
+        readers += _slots[i].readers.load(std::memory_order_seq_cst);
+    return (readers == 0);
+}
+
+} // namespace CppCommon
@@ -11,6 +11,8 @@
 
 #include "time/timestamp.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 namespace CppCommon {
@@ -21,6 +23,10 @@ namespace CppCommon {
     and signal only one thread at the time. Other thread will wait for the next event signalization.
     The order of thread signalization by auto-reset event is not guaranteed.
 
+    Event state and the count of blocked threads are kept in the event object, so signaling without
+    blocked threads and waiting for the signaled event are inlined atomic operations. Only blocking
+    operations call the platform implementation.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
@@ -55,7 +61,7 @@ public:
 
         \return 'true' if the event was occurred before and no other threads were signaled, 'false' if the event was not occurred before
     */
-    bool TryWait();
+    bool TryWait() noexcept;
 
     //! Try to wait the event for the given timespan
     /*!
@@ -84,16 +90,28 @@ public:
 private:
     class Impl;
 
+    // Count of pending signals
+    std::atomic<uint32_t> _signaled;
+    // Count of blocked threads
+    std::atomic<uint32_t> _waiters;
+
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 128;
+    static const size_t StorageSize = 120;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
+
+    //! Wake one of blocked threads
+    void SignalSlow();
+    //! Block until the event is signaled
+    void WaitSlow();
 };
 
 /*! \example threads_event_auto_reset.cpp Auto-reset event synchronization primitive example */
 
 } // namespace CppCommon
 
+#include "event_auto_reset.inl"
+
 #endif // CPPCOMMON_THREADS_EVENT_AUTO_RESET_H
@@ -0,0 +1,39 @@
+/*!
+    \file event_auto_reset.inl
+    \brief Auto-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void EventAutoReset::Signal()
+{
+    _signaled.fetch_add(1, std::memory_order_release);
+
+    // Pairs with the fence in the blocking wait
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Call the platform implementation only if there are blocked threads
+    if (_waiters.load(std::memory_order_relaxed) > 0)
+        SignalSlow();
+}
+
+inline bool EventAutoReset::TryWait() noexcept
+{
+    uint32_t signaled = _signaled.load(std::memory_order_relaxed);
+    while (signaled > 0)
+        if (_signaled.compare_exchange_weak(signaled, signaled - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    return false;
+}
+
+inline void EventAutoReset::Wait()
+{
+    // Uncontended path is a single atomic operation
+    if (!TryWait())
+        WaitSlow();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,40 @@
+/*!
+    \file event_manual_reset.inl
+    \brief Manual-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void EventManualReset::Reset()
+{
+    _signaled.store(0, std::memory_order_relaxed);
+}
+
+inline void EventManualReset::Signal()
+{
+    _signaled.store(1, std::memory_order_release);
+
+    // Pairs with the fence in the blocking wait
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Call the platform implementation only if there are blocked threads
+    if (_waiters.load(std::memory_order_relaxed) > 0)
+        SignalSlow();
+}
+
+inline bool EventManualReset::TryWait() noexcept
+{
+    return (_signaled.load(std::memory_order_acquire) != 0);
+}
+
+inline void EventManualReset::Wait()
+{
+    // Uncontended path is a single atomic operation
+    if (!TryWait())
+        WaitSlow();
+}
+
+} // namespace CppCommon
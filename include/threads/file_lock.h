@@ -26,6 +26,29 @@ namespace CppCommon {
     all other writers or readers will be blocked until the writer is finished
     writing.
 
+    Timed lock methods block in the kernel instead of polling. On Linux the
+    wait is interrupted at the deadline by the signal sent to the waiting
+    thread from the short-lived helper thread, on Windows the overlapped lock
+    request is waited with a timeout. Other platforms or threads with the
+    blocked signal fall back to the sleeping exponential backoff.
+
+    On Linux the first timed lock reserves the real-time signal for the whole
+    process (CPPCOMMON_FILE_LOCK_SIGNAL, SIGRTMAX - 1 by default, could be
+    redefined at build time) and installs its empty handler without
+    SA_RESTART. The application must not use the reserved signal for other
+    purposes. If the application has installed its own handler before, the
+    handler is kept and timed locks fall back to the sleeping exponential
+    backoff. Signals sent to the waiting thread are drained before the timed
+    lock method returns, so they never interrupt its other system calls.
+
+    Byte-range locks allow multiple processes to lock disjoint regions of
+    one shared data file concurrently. Open the data file with the temporary
+    flag set to false, so it is not removed on reset. On Linux and Windows
+    byte-range locks of different file-lock instances exclude each other even
+    within one process. Other Unix systems use classic process-owned record
+    locks, which only exclude other processes. Do not mix whole-file and
+    byte-range locks on the same file.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/File_locking
@@ -34,7 +57,12 @@ class FileLock
 {
 public:
     FileLock();
-    explicit FileLock(const Path& path);
+    //! Initialize file-lock with the given path
+    /*!
+        \param path - File-lock path
+        \param temporary - Remove the file-lock file on reset (default is true)
+    */
+    explicit FileLock(const Path& path, bool temporary = true);
     FileLock(const FileLock&) = delete;
     FileLock(FileLock&& lock) = delete;
     ~FileLock();
@@ -49,8 +77,9 @@ public:
     //! Assign a new file-lock path
     /*!
         \param path - File-lock path
+        \param temporary - Remove the file-lock file on reset (default is true)
     */
-    void Assign(const Path& path);
+    void Assign(const Path& path, bool temporary = true);
 
     //! Reset file-lock
     void Reset();
@@ -127,6 +156,80 @@ public:
     */
     void UnlockWrite();
 
+    //! Try to acquire read lock of the given byte range without block
+    /*!
+        Will not block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead(uint64_t offset, uint64_t size);
+    //! Try to acquire write lock of the given byte range without block
+    /*!
+        Will not block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite(uint64_t offset, uint64_t size);
+
+    //! Try to acquire read lock of the given byte range for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+        \param timespan - Timespan to wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadFor(uint64_t offset, uint64_t size, const Timespan& timespan);
+    //! Try to acquire write lock of the given byte range for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+        \param timespan - Timespan to wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteFor(uint64_t offset, uint64_t size, const Timespan& timespan);
+
+    //! Acquire read lock of the given byte range with block
+    /*!
+        Will block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+    */
+    void LockRead(uint64_t offset, uint64_t size);
+    //! Acquire write lock of the given byte range with block
+    /*!
+        Will block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+    */
+    void LockWrite(uint64_t offset, uint64_t size);
+
+    //! Release read lock of the given byte range
+    /*!
+        Will not block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+    */
+    void UnlockRead(uint64_t offset, uint64_t size);
+    //! Release write lock of the given byte range
+    /*!
+        Will not block.
+
+        \param offset - Byte range offset
+        \param size - Byte range size (must be greater than zero)
+    */
+    void UnlockWrite(uint64_t offset, uint64_t size);
+
 private:
     class Impl;
 
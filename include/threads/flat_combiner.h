@@ -0,0 +1,131 @@
+/*!
+    \file flat_combiner.h
+    \brief Flat combining synchronization wrapper definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FLAT_COMBINER_H
+#define CPPCOMMON_THREADS_FLAT_COMBINER_H
+
+#include "threads/thread.h"
+#include "threads/thread_local.h"
+
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Flat combining synchronization wrapper
+/*!
+    Flat combiner protects a sequential data structure (flat map, order book,
+    priority queue) shared by many threads. Instead of acquiring the lock
+    itself each thread publishes its operation in its own publication slot.
+    The thread which acquires the combiner lock becomes the combiner: it
+    executes operations of all published slots in a batch and then releases
+    the lock. Other threads spin on their slots until their operations are
+    done or the lock is free.
+
+    Under contention the data structure stays in the cache of the combiner
+    and the lock is acquired once per batch instead of once per operation,
+    so the throughput does not collapse with the count of threads as lock
+    handoff does. Without contention the cost is close to a spin-lock.
+
+    Operations are executed by the combiner thread, so they must not depend
+    on thread local state of the caller and must not call Execute() of the
+    same flat combiner. Exceptions thrown by operations are rethrown in the
+    calling thread.
+
+    Thread-safe.
+
+    <b>References</b>\n
+    \li Danny Hendler, Itai Incze, Nir Shavit, Moran Tzafrir. Flat combining
+        and the synchronization-parallelism tradeoff. SPAA 2010.
+*/
+template <typename T>
+class FlatCombiner
+{
+public:
+    //! Initialize the flat combiner and construct the protected data with the given arguments
+    template <typename... Args>
+    explicit FlatCombiner(Args&&... args);
+    FlatCombiner(const FlatCombiner&) = delete;
+    FlatCombiner(FlatCombiner&&) = delete;
+    ~FlatCombiner();
+
+    FlatCombiner& operator=(const FlatCombiner&) = delete;
+    FlatCombiner& operator=(FlatCombiner&&) = delete;
+
+    //! Get the count of publication slots
+    size_t slots() const noexcept { return _size.load(std::memory_order_relaxed); }
+    //! Get the count of combining batches
+    uint64_t batches() const noexcept { return _batches.load(std::memory_order_relaxed); }
+    //! Get the count of combined operations
+    uint64_t operations() const noexcept { return _operations.load(std::memory_order_relaxed); }
+
+    //! Execute the operation with the protected data
+    /*!
+        Will block until the operation is executed by the current or the
+        combiner thread.
+
+        \param operation - Operation functor called with the protected data reference
+        \return Result of the operation
+    */
+    template <class TOperation>
+    std::invoke_result_t<TOperation&, T&> Execute(TOperation&& operation);
+
+    //! Access the protected data without synchronization
+    /*!
+        May only be used when no other threads execute operations.
+    */
+    T& unsafe() noexcept { return _data; }
+
+private:
+    // Published operation request
+    struct Request
+    {
+        void (*invoke)(Request* request, T& data) noexcept;
+    };
+
+    // Typed operation request with the result storage
+    template <class TOperation, typename TResult>
+    struct Task : public Request
+    {
+        TOperation* operation;
+        std::optional<std::conditional_t<std::is_void_v<TResult>, bool, std::conditional_t<std::is_reference_v<TResult>, std::add_pointer_t<std::remove_reference_t<TResult>>, TResult>>> result;
+        std::exception_ptr error;
+
+        static void Invoke(Request* request, T& data) noexcept;
+    };
+
+    // Publication slot placed on its own cache line
+    struct alignas(128) Slot
+    {
+        std::atomic<Request*> request{nullptr};
+        std::atomic<bool> active{true};
+        Slot* next{nullptr};
+    };
+
+    alignas(128) std::atomic<bool> _lock;
+    std::atomic<Slot*> _head;
+    std::atomic<size_t> _size;
+    std::atomic<uint64_t> _batches;
+    std::atomic<uint64_t> _operations;
+    alignas(128) T _data;
+    ThreadLocal<Slot*> _slot;
+
+    Slot* AcquireSlot();
+    void Combine() noexcept;
+};
+
+/*! \example threads_flat_combiner.cpp Flat combining synchronization wrapper example */
+
+} // namespace CppCommon
+
+#include "flat_combiner.inl"
+
+#endif // CPPCOMMON_THREADS_FLAT_COMBINER_H
@@ -0,0 +1,147 @@
+/*!
+    \file flat_combiner.inl
+    \brief Flat combining synchronization wrapper inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+template <typename... Args>
+inline FlatCombiner<T>::FlatCombiner(Args&&... args)
+    : _lock(false), _head(nullptr), _size(0), _batches(0), _operations(0),
+      _data(std::forward<Args>(args)...),
+      _slot([this]() { return AcquireSlot(); }, [](Slot*& slot) { slot->active.store(false, std::memory_order_release); })
+{
+}
+
+template <typename T>
+inline FlatCombiner<T>::~FlatCombiner()
+{
+    Slot* slot = _head.load(std::memory_order_acquire);
+    while (slot != nullptr)
+    {
+        Slot* next = slot->next;
+        delete slot;
+        slot = next;
+    }
+}
+
+template <typename T>
+template <class TOperation, typename TResult>
+inline void FlatCombiner<T>::Task<TOperation, TResult>::Invoke(Request* request, T& data) noexcept
+{
+    Task* task = static_cast<Task*>(request);
+    try
+    {
+        if constexpr (std::is_void_v<TResult>)
+        {
+            (*task->operation)(data);
+            task->result.emplace(true);
+        }
+        else if constexpr (std::is_reference_v<TResult>)
+            task->result.emplace(&(*task->operation)(data));
+        else
+            task->result.emplace((*task->operation)(data));
+    }
+    catch (...)
+    {
+        task->error = std::current_exception();
+    }
+}
+
+template <typename T>
+template <class TOperation>
+inline std::invoke_result_t<TOperation&, T&> FlatCombiner<T>::Execute(TOperation&& operation)
+{
+    typedef std::invoke_result_t<TOperation&, T&> TResult;
+    typedef std::remove_reference_t<TOperation> TFunctor;
+
+    // Publish the operation request in the slot of the current thread
+    Slot* slot = _slot.get();
+    Task<TFunctor, TResult> task;
+    task.invoke = &Task<TFunctor, TResult>::Invoke;
+    task.operation = &operation;
+    slot->request.store(&task, std::memory_order_release);
+
+    for (int spin = 0; slot->request.load(std::memory_order_acquire) != nullptr; ++spin)
+    {
+        // Try to become the combiner
+        if (!_lock.load(std::memory_order_relaxed) && !_lock.exchange(true, std::memory_order_acquire))
+        {
+            Combine();
+            _lock.store(false, std::memory_order_release);
+            continue;
+        }
+
+        // Wait for the combiner
+        if (spin < 64)
+            Thread::Pause();
+        else
+            Thread::Yield();
+    }
+
+    if (task.error)
+        std::rethrow_exception(task.error);
+
+    if constexpr (std::is_void_v<TResult>)
+        return;
+    else if constexpr (std::is_reference_v<TResult>)
+        return static_cast<TResult>(**task.result);
+    else
+        return std::move(*task.result);
+}
+
+template <typename T>
+inline typename FlatCombiner<T>::Slot* FlatCombiner<T>::AcquireSlot()
+{
+    // Try to reuse the slot of the exited thread
+    for (Slot* slot = _head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        bool active = false;
+        if (!slot->active.load(std::memory_order_relaxed) && slot->active.compare_exchange_strong(active, true, std::memory_order_acquire))
+            return slot;
+    }
+
+    // Register a new slot
+    Slot* slot = new Slot();
+    Slot* head = _head.load(std::memory_order_relaxed);
+    do
+    {
+        slot->next = head;
+    } while (!_head.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+    _size.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+template <typename T>
+inline void FlatCombiner<T>::Combine() noexcept
+{
+    // Scan publication slots a few times while there are new requests
+    uint64_t total = 0;
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        uint64_t count = 0;
+        for (Slot* slot = _head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+        {
+            Request* request = slot->request.load(std::memory_order_acquire);
+            if (request != nullptr)
+            {
+                request->invoke(request, _data);
+                slot->request.store(nullptr, std::memory_order_release);
+                ++count;
+            }
+        }
+        if (count == 0)
+            break;
+        total += count;
+    }
+
+    // Statistics are updated only by the combiner
+    _batches.store(_batches.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    _operations.store(_operations.load(std::memory_order_relaxed) + total, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
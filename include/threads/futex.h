@@ -0,0 +1,143 @@
+/*!
+    \file futex.h
+    \brief Futex address wait/wake primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_H
+#define CPPCOMMON_THREADS_FUTEX_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Robust inter-process mutex placed in the shared memory.
+//
+// On Linux it is the process shared robust pthread mutex built on kernel robust
+// futexes: the mutex word keeps the owner thread id with FUTEX_WAITERS and
+// FUTEX_OWNER_DIED flags, and on the owner thread exit the kernel walks the
+// robust list registered by the C runtime for each thread (set_robust_list),
+// marks the mutex with FUTEX_OWNER_DIED and wakes a waiter. The waiter takes
+// over the mutex, which is reported with the abandoned flag. Only the owner
+// thread might unlock the mutex. The locked mutex must stay mapped till the
+// owner thread exit, otherwise the kernel could not find it.
+//
+// Other platforms have no kernel robust futexes, so the mutex word keeps the
+// owner process id and the waiters flag, and waiters check the owner process
+// every 100 milliseconds with kill(pid, 0) or OpenProcess(). This fallback is
+// limited: reused process id keeps the dead owner alive, the owner from
+// another process id namespace is considered dead, the dead owner is detected
+// with up to 100 milliseconds delay, any thread of the owner process might
+// unlock the mutex and the owner thread exit is not detected.
+class FutexRobustMutex
+{
+public:
+    FutexRobustMutex();
+    FutexRobustMutex(const FutexRobustMutex&) = delete;
+    FutexRobustMutex(FutexRobustMutex&&) = delete;
+    ~FutexRobustMutex() = default;
+
+    FutexRobustMutex& operator=(const FutexRobustMutex&) = delete;
+    FutexRobustMutex& operator=(FutexRobustMutex&&) = delete;
+
+    bool TryLock(bool& abandoned);
+    bool TryLockFor(uint32_t spin, const Timespan& timespan, bool& abandoned);
+    void Lock(uint32_t spin, bool& abandoned);
+    bool Unlock();
+
+private:
+    static const size_t StorageSize = 64;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+
+    bool Acquire(uint32_t spin, int64_t timeout, bool& abandoned);
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Futex static class
+/*!
+    Futex allows to block the current thread while the given 32-bit address
+    contains the expected value and to wake threads blocked on the address.
+    It is a building block for lightweight synchronization primitives which
+    keep their state in a single atomic word and enter the kernel only when
+    they are contended.
+
+    Futex is implemented with futex system call on Linux and WaitOnAddress()
+    on Windows. Other platforms use std::atomic wait/notify.
+
+    Shared futex addresses are placed in the shared memory and might be
+    waited from multiple processes. Only Linux supports blocking on shared
+    addresses, other platforms poll them with the sleeping backoff.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Futex
+*/
+class Futex
+{
+public:
+    Futex() = delete;
+    Futex(const Futex&) = delete;
+    Futex(Futex&&) = delete;
+    ~Futex() = delete;
+
+    Futex& operator=(const Futex&) = delete;
+    Futex& operator=(Futex&&) = delete;
+
+    //! Block the current thread while the given address contains the expected value
+    /*!
+        Spurious wake-ups are possible, so the caller must re-check its condition.
+
+        Will block.
+
+        \param address - Futex address
+        \param expected - Expected value
+        \param shared - Shared between processes futex address (default is false)
+    */
+    static void Wait(std::atomic<uint32_t>& address, uint32_t expected, bool shared = false);
+    //! Block the current thread while the given address contains the expected value for the given timespan
+    /*!
+        Spurious wake-ups are possible, so the caller must re-check its condition.
+
+        Will block for the given timespan in the worst case.
+
+        \param address - Futex address
+        \param expected - Expected value
+        \param timespan - Timespan to wait
+        \param shared - Shared between processes futex address (default is false)
+        \return 'true' if the thread was woken or the address value differs, 'false' if the timeout was expired
+    */
+    static bool WaitFor(std::atomic<uint32_t>& address, uint32_t expected, const Timespan& timespan, bool shared = false);
+
+    //! Wake one thread blocked on the given address
+    /*!
+        Will not block.
+
+        \param address - Futex address
+        \param shared - Shared between processes futex address (default is false)
+    */
+    static void WakeOne(std::atomic<uint32_t>& address, bool shared = false);
+    //! Wake all threads blocked on the given address
+    /*!
+        Will not block.
+
+        \param address - Futex address
+        \param shared - Shared between processes futex address (default is false)
+    */
+    static void WakeAll(std::atomic<uint32_t>& address, bool shared = false);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_FUTEX_H
@@ -0,0 +1,455 @@
+/*!
+    \file future.h
+    \brief Lightweight future and promise definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTURE_H
+#define CPPCOMMON_THREADS_FUTURE_H
+
+#include "errors/exceptions.h"
+#include "memory/object_pool.h"
+#include "threads/coroutine_scheduler.h"
+#include "threads/futex.h"
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+template <typename T>
+class Future;
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Future continuation which is run once when the future state is ready
+class FutureContinuation
+{
+public:
+    virtual void Run() noexcept = 0;
+
+protected:
+    ~FutureContinuation() = default;
+};
+
+// Future shared state base
+class FutureStateBase
+{
+public:
+    explicit FutureStateBase(uint32_t refs) noexcept : _refs(refs), _status(PENDING), _continuation(nullptr) {}
+    FutureStateBase(const FutureStateBase&) = delete;
+    FutureStateBase(FutureStateBase&&) = delete;
+
+    FutureStateBase& operator=(const FutureStateBase&) = delete;
+    FutureStateBase& operator=(FutureStateBase&&) = delete;
+
+    bool ready() const noexcept { return (_status.load(std::memory_order_acquire) == READY); }
+    const std::exception_ptr& exception() const noexcept { return _exception; }
+
+    void Release() noexcept { if (_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) Destroy(); }
+
+    // Attach the continuation or return false if the state is already ready
+    bool Attach(FutureContinuation* continuation) noexcept;
+    // Attach the continuation or run it in place if the state is already ready
+    void Subscribe(FutureContinuation* continuation) noexcept { if (!Attach(continuation)) continuation->Run(); }
+    // Block the current thread until the state is ready
+    void Wait();
+
+    void SetException(std::exception_ptr exception) noexcept { _exception = std::move(exception); Complete(); }
+
+protected:
+    std::exception_ptr _exception;
+
+    virtual ~FutureStateBase() = default;
+    virtual void Destroy() noexcept = 0;
+
+    // Make the state ready and run the attached continuation or wake up the waiting thread
+    void Complete() noexcept;
+
+private:
+    static const uint32_t PENDING = 0;
+    static const uint32_t ATTACHED = 1;
+    static const uint32_t WAITING = 2;
+    static const uint32_t READY = 3;
+
+    std::atomic<uint32_t> _refs;
+    std::atomic<uint32_t> _status;
+    FutureContinuation* _continuation;
+};
+
+// Value of the void future
+struct FutureVoid {};
+
+// Future shared state with a value
+template <typename T>
+class FutureState : public FutureStateBase
+{
+public:
+    typedef std::conditional_t<std::is_void_v<T>, FutureVoid, T> Value;
+
+    using FutureStateBase::FutureStateBase;
+
+    template <class... Args>
+    void SetValue(Args&&... args) noexcept;
+    // Take the value out of the ready state or rethrow its exception
+    T Take();
+
+protected:
+    std::optional<Value> _value;
+};
+
+// Pool of future states of the given type
+template <class TState>
+class FutureStatePool
+{
+public:
+    FutureStatePool() = delete;
+
+    template <class... Args>
+    static TState* Create(Args&&... args);
+    static void Release(TState* state) noexcept { pool().Release(state); }
+
+private:
+    static ObjectPool<TState>& pool();
+};
+
+// Future state of the promise
+template <typename T>
+class PromiseState final : public FutureState<T>
+{
+public:
+    // Referenced by the promise and its future
+    PromiseState() noexcept : FutureState<T>(2) {}
+
+protected:
+    void Destroy() noexcept override { FutureStatePool<PromiseState>::Release(this); }
+};
+
+// Result type of the continuation function
+template <typename T, class TFunction>
+struct FutureResult { typedef std::remove_cvref_t<std::invoke_result_t<TFunction, T>> type; };
+template <class TFunction>
+struct FutureResult<void, TFunction> { typedef std::remove_cvref_t<std::invoke_result_t<TFunction>> type; };
+
+// Future state of the continuation
+template <typename T, typename R, class TFunction, class TExecutor>
+class ThenState final : public FutureState<R>, public FutureContinuation
+{
+public:
+    template <class F>
+    ThenState(FutureState<T>* source, F&& function, TExecutor* executor) : FutureState<R>(2), _source(source), _function(std::forward<F>(function)), _executor(executor) {}
+
+    void Run() noexcept override;
+
+protected:
+    void Destroy() noexcept override { FutureStatePool<ThenState>::Release(this); }
+
+private:
+    FutureState<T>* _source;
+    TFunction _function;
+    TExecutor* _executor;
+
+    void Invoke() noexcept;
+};
+
+// Result types of future combinators
+template <typename T>
+struct WhenAllResult { typedef std::vector<T> type; };
+template <>
+struct WhenAllResult<void> { typedef void type; };
+template <typename T>
+struct WhenAnyResult { typedef std::pair<size_t, T> type; };
+template <>
+struct WhenAnyResult<void> { typedef size_t type; };
+
+// Future state of the future combinator
+template <typename T, bool All>
+class WhenState final : public FutureState<std::conditional_t<All, typename WhenAllResult<T>::type, typename WhenAnyResult<T>::type>>
+{
+public:
+    explicit WhenState(std::vector<Future<T>>& futures);
+
+    // Subscribe to all input futures
+    void Start() noexcept;
+
+protected:
+    void Destroy() noexcept override { FutureStatePool<WhenState>::Release(this); }
+
+private:
+    struct Input final : public FutureContinuation
+    {
+        WhenState* parent{nullptr};
+        FutureState<T>* source{nullptr};
+        size_t index{0};
+
+        void Run() noexcept override { parent->Arrive(*this); }
+    };
+
+    std::vector<Input> _inputs;
+    std::vector<std::optional<typename FutureState<T>::Value>> _values;
+    std::atomic<size_t> _remaining;
+    std::atomic<bool> _done;
+    std::exception_ptr _failure;
+
+    void Arrive(Input& input) noexcept;
+    void Finish() noexcept;
+};
+
+// Access to the future state
+struct FutureAccess
+{
+    template <typename T>
+    static FutureState<T>* Detach(Future<T>& future) noexcept { return std::exchange(future._state, nullptr); }
+    template <typename T>
+    static Future<T> Make(FutureState<T>* state) noexcept { return Future<T>(state); }
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Lightweight future
+/*!
+    Future is the consumer side of the asynchronous result produced by
+    Promise, a continuation or a future combinator. Unlike std::future it
+    could be continued with Then() and awaited with co_await from coroutines
+    without blocking threads.
+
+    Shared state is created in the typed object pool with the value and the
+    continuation function stored inline, so the steady state asynchronous
+    operation performs no heap allocation. The state is completed with a
+    single atomic exchange and the waiting thread is blocked on the futex
+    only when Wait() or Get() is called before the result is ready.
+
+    Future has a single consumer: Then(), co_await and Get() consume the
+    future and make it invalid.
+
+    Not thread-safe.
+*/
+template <typename T>
+class Future
+{
+    friend struct Internals::FutureAccess;
+
+    template <typename U>
+    friend class Future;
+
+public:
+    //! Future awaiter
+    class Awaiter : public Internals::FutureContinuation
+    {
+    public:
+        explicit Awaiter(Future& future) noexcept : _future(future) {}
+
+        bool await_ready() const noexcept { return _future.ready(); }
+        bool await_suspend(std::coroutine_handle<> coroutine) noexcept;
+        T await_resume() { return _future.Get(); }
+
+        void Run() noexcept override { _waiter.Resume(); }
+
+    private:
+        Future& _future;
+        Internals::CoroutineWaiter _waiter;
+    };
+
+    Future() noexcept : _state(nullptr) {}
+    Future(const Future&) = delete;
+    Future(Future&& future) noexcept : _state(std::exchange(future._state, nullptr)) {}
+    ~Future() { if (_state != nullptr) _state->Release(); }
+
+    Future& operator=(const Future&) = delete;
+    Future& operator=(Future&& future) noexcept;
+
+    //! Check if the future is valid
+    explicit operator bool() const noexcept { return valid(); }
+
+    //! Is the future valid (not consumed)?
+    bool valid() const noexcept { return (_state != nullptr); }
+    //! Is the future result ready?
+    bool ready() const noexcept { return valid() && _state->ready(); }
+
+    //! Wait for the future result is ready
+    /*!
+        Will block.
+    */
+    void Wait() const;
+    //! Wait for the future result and take it
+    /*!
+        Future becomes invalid.
+
+        Will block.
+
+        \return Future result (the exception of the future is rethrown)
+    */
+    T Get();
+
+    //! Continue the future with the given function
+    /*!
+        The function is called with the future value (or without arguments
+        for the void future) in the thread which completes the future, or in
+        place if the future is already ready. The exception of the future is
+        propagated to the result without calling the function.
+
+        Future becomes invalid.
+
+        \param function - Continuation function
+        \return Future of the continuation function result
+    */
+    template <class TFunction>
+    Future<typename Internals::FutureResult<T, TFunction>::type> Then(TFunction&& function)
+    { return Chain<void>(nullptr, std::forward<TFunction>(function)); }
+    //! Continue the future with the given function in the given executor
+    /*!
+        Executor is any class with the Post() method which takes the callable
+        object, e.g. ThreadPool. If Post() returns 'false' (e.g. the injection
+        queue of the thread pool is full) the continuation is called in place.
+
+        Future becomes invalid.
+
+        \param executor - Executor of the continuation function
+        \param function - Continuation function
+        \return Future of the continuation function result
+    */
+    template <class TExecutor, class TFunction>
+    Future<typename Internals::FutureResult<T, TFunction>::type> Then(TExecutor& executor, TFunction&& function)
+    { return Chain<TExecutor>(&executor, std::forward<TFunction>(function)); }
+
+    //! Await the future
+    /*!
+        The awaiting coroutine is resumed with its coroutine scheduler or in
+        the thread which completes the future.
+    */
+    Awaiter operator co_await() noexcept { return Awaiter(*this); }
+
+    //! Swap two instances
+    void swap(Future& future) noexcept { std::swap(_state, future._state); }
+    friend void swap(Future& future1, Future& future2) noexcept { future1.swap(future2); }
+
+private:
+    Internals::FutureState<T>* _state;
+
+    explicit Future(Internals::FutureState<T>* state) noexcept : _state(state) {}
+
+    template <class TExecutor, class TFunction>
+    Future<typename Internals::FutureResult<T, TFunction>::type> Chain(TExecutor* executor, TFunction&& function);
+};
+
+//! Lightweight promise
+/*!
+    Promise is the producer side of the asynchronous result. It creates the
+    shared state in the typed object pool and completes it with a value or
+    an exception. The future of the destroyed not satisfied promise is
+    completed with "Broken promise!" RuntimeException.
+
+    Not thread-safe.
+*/
+template <typename T>
+class Promise
+{
+public:
+    //! Create the promise with a new shared state
+    Promise() : _state(Internals::FutureStatePool<Internals::PromiseState<T>>::Create()), _retrieved(false), _satisfied(false) {}
+    Promise(const Promise&) = delete;
+    Promise(Promise&& promise) noexcept;
+    ~Promise() { Abandon(); }
+
+    Promise& operator=(const Promise&) = delete;
+    Promise& operator=(Promise&& promise) noexcept;
+
+    //! Is the promise satisfied with a value or an exception?
+    bool satisfied() const noexcept { return _satisfied; }
+
+    //! Get the future of the promise
+    /*!
+        Throws RuntimeException if the future was already retrieved.
+
+        \return Future of the promise
+    */
+    Future<T> GetFuture();
+
+    //! Satisfy the promise with the value constructed from the given arguments
+    /*!
+        Continuation of the future is run in place.
+
+        Throws RuntimeException if the promise is already satisfied.
+
+        \param args - Value constructor arguments
+    */
+    template <class... Args>
+    void SetValue(Args&&... args);
+    //! Satisfy the promise with the given exception
+    /*!
+        Throws RuntimeException if the promise is already satisfied.
+
+        \param exception - Exception pointer
+    */
+    void SetException(std::exception_ptr exception);
+
+    //! Swap two instances
+    void swap(Promise& promise) noexcept;
+    friend void swap(Promise& promise1, Promise& promise2) noexcept { promise1.swap(promise2); }
+
+private:
+    Internals::PromiseState<T>* _state;
+    bool _retrieved;
+    bool _satisfied;
+
+    void Abandon() noexcept;
+};
+
+//! Make the ready future with the value constructed from the given arguments
+/*!
+    \param args - Value constructor arguments
+    \return Ready future
+*/
+template <typename T, class... Args>
+Future<T> MakeReadyFuture(Args&&... args);
+//! Make the ready future with the given exception
+/*!
+    \param exception - Exception pointer
+    \return Ready future with the exception
+*/
+template <typename T>
+Future<T> MakeExceptionalFuture(std::exception_ptr exception);
+
+//! Wait for all the given futures
+/*!
+    Result future is ready when all the given futures are ready. It contains
+    the vector of their values (nothing for void futures) in the same order,
+    or the first exception observed among failed futures.
+
+    \param futures - Futures to wait (consumed)
+    \return Future of all results
+*/
+template <typename T>
+Future<typename Internals::WhenAllResult<T>::type> WhenAll(std::vector<Future<T>> futures);
+//! Wait for any of the given futures
+/*!
+    Result future is ready when the first of the given futures is ready. It
+    contains the index and the value of the first ready future (only the
+    index for void futures), or its exception. Results of other futures are
+    discarded.
+
+    Throws ArgumentException if the vector of futures is empty.
+
+    \param futures - Futures to wait (consumed)
+    \return Future of the first result
+*/
+template <typename T>
+Future<typename Internals::WhenAnyResult<T>::type> WhenAny(std::vector<Future<T>> futures);
+
+/*! \example threads_future.cpp Lightweight future and promise example */
+
+} // namespace CppCommon
+
+#include "future.inl"
+
+#endif // CPPCOMMON_THREADS_FUTURE_H
@@ -0,0 +1,473 @@
+/*!
+    \file future.inl
+    \brief Lightweight future and promise inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline bool FutureStateBase::Attach(FutureContinuation* continuation) noexcept
+{
+    _continuation = continuation;
+
+    uint32_t status = PENDING;
+    return _status.compare_exchange_strong(status, ATTACHED, std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+inline void FutureStateBase::Wait()
+{
+    uint32_t status = PENDING;
+    if (!_status.compare_exchange_strong(status, WAITING, std::memory_order_acq_rel, std::memory_order_acquire) && (status == READY))
+        return;
+
+    assert((status != ATTACHED) && "Future with the continuation cannot be waited!");
+
+    // Block on the futex only if the state is still not ready
+    while ((status = _status.load(std::memory_order_acquire)) != READY)
+        Futex::Wait(_status, status);
+}
+
+inline void FutureStateBase::Complete() noexcept
+{
+    // Waiting thread and the continuation hold their own references to the state
+    uint32_t status = _status.exchange(READY, std::memory_order_acq_rel);
+    if (status == ATTACHED)
+        _continuation->Run();
+    else if (status == WAITING)
+        Futex::WakeAll(_status);
+}
+
+template <typename T>
+template <class... Args>
+inline void FutureState<T>::SetValue(Args&&... args) noexcept
+{
+    try
+    {
+        _value.emplace(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        _exception = std::current_exception();
+    }
+
+    Complete();
+}
+
+template <typename T>
+inline T FutureState<T>::Take()
+{
+    if (_exception)
+        std::rethrow_exception(_exception);
+
+    if constexpr (!std::is_void_v<T>)
+        return std::move(*_value);
+}
+
+template <class TState>
+template <class... Args>
+inline TState* FutureStatePool<TState>::Create(Args&&... args)
+{
+    TState* state = pool().Create(std::forward<Args>(args)...);
+    if (state == nullptr)
+        throw std::bad_alloc();
+    return state;
+}
+
+template <class TState>
+inline ObjectPool<TState>& FutureStatePool<TState>::pool()
+{
+    // Pool is never destroyed, because futures could be released by destructors of static objects
+    static DefaultMemoryManager* manager = new DefaultMemoryManager();
+    static ObjectPool<TState>* instance = new ObjectPool<TState>(*manager);
+    return *instance;
+}
+
+// Post the function into the executor and return false if it is rejected
+template <class TExecutor, class TFunction>
+inline bool FuturePost(TExecutor& executor, TFunction&& function) noexcept
+{
+    try
+    {
+        if constexpr (std::is_void_v<decltype(executor.Post(std::forward<TFunction>(function)))>)
+        {
+            executor.Post(std::forward<TFunction>(function));
+            return true;
+        }
+        else
+            return executor.Post(std::forward<TFunction>(function));
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+template <typename T, typename R, class TFunction, class TExecutor>
+inline void ThenState<T, R, TFunction, TExecutor>::Run() noexcept
+{
+    if constexpr (!std::is_void_v<TExecutor>)
+    {
+        if ((_executor != nullptr) && FuturePost(*_executor, [this]() { Invoke(); }))
+            return;
+    }
+
+    Invoke();
+}
+
+template <typename T, typename R, class TFunction, class TExecutor>
+inline void ThenState<T, R, TFunction, TExecutor>::Invoke() noexcept
+{
+    FutureState<T>* source = std::exchange(_source, nullptr);
+
+    // Propagate the exception of the source future without calling the function
+    if (source->exception())
+        this->_exception = source->exception();
+    else
+    {
+        try
+        {
+            if constexpr (std::is_void_v<T> && std::is_void_v<R>)
+            {
+                _function();
+                this->_value.emplace();
+            }
+            else if constexpr (std::is_void_v<T>)
+                this->_value.emplace(_function());
+            else if constexpr (std::is_void_v<R>)
+            {
+                _function(source->Take());
+                this->_value.emplace();
+            }
+            else
+                this->_value.emplace(_function(source->Take()));
+        }
+        catch (...)
+        {
+            this->_exception = std::current_exception();
+        }
+    }
+    source->Release();
+
+    // Complete the result and release the producer reference
+    this->Complete();
+    this->Release();
+}
+
+template <typename T, bool All>
+inline WhenState<T, All>::WhenState(std::vector<Future<T>>& futures)
+    : FutureState<std::conditional_t<All, typename WhenAllResult<T>::type, typename WhenAnyResult<T>::type>>(2),
+      _inputs(futures.size()),
+      _remaining(futures.size()),
+      _done(false)
+{
+    if constexpr (All && !std::is_void_v<T>)
+        _values.resize(futures.size());
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        assert(futures[i].valid() && "Invalid future cannot be combined!");
+        _inputs[i].parent = this;
+        _inputs[i].source = FutureAccess::Detach(futures[i]);
+        _inputs[i].index = i;
+    }
+}
+
+template <typename T, bool All>
+inline void WhenState<T, All>::Start() noexcept
+{
+    if constexpr (All)
+    {
+        if (_inputs.empty())
+        {
+            Finish();
+            return;
+        }
+    }
+
+    // The last input might complete the state, the consumer reference keeps it alive
+    for (auto& input : _inputs)
+        input.source->Subscribe(&input);
+}
+
+template <typename T, bool All>
+inline void WhenState<T, All>::Arrive(Input& input) noexcept
+{
+    FutureState<T>* source = input.source;
+
+    if constexpr (All)
+    {
+        if (source->exception())
+        {
+            if (!_done.exchange(true, std::memory_order_acq_rel))
+                _failure = source->exception();
+        }
+        else if constexpr (!std::is_void_v<T>)
+        {
+            try
+            {
+                _values[input.index].emplace(source->Take());
+            }
+            catch (...)
+            {
+                if (!_done.exchange(true, std::memory_order_acq_rel))
+                    _failure = std::current_exception();
+            }
+        }
+        source->Release();
+
+        if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            Finish();
+    }
+    else
+    {
+        // The first ready input completes the state
+        if (!_done.exchange(true, std::memory_order_acq_rel))
+        {
+            if (source->exception())
+                this->SetException(source->exception());
+            else if constexpr (std::is_void_v<T>)
+                this->SetValue(input.index);
+            else
+            {
+                try
+                {
+                    this->SetValue(input.index, source->Take());
+                }
+                catch (...)
+                {
+                    this->SetException(std::current_exception());
+                }
+            }
+        }
+        source->Release();
+
+        // The last input releases the producer reference
+        if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            this->Release();
+    }
+}
+
+template <typename T, bool All>
+inline void WhenState<T, All>::Finish() noexcept
+{
+    if (_done.load(std::memory_order_acquire))
+        this->SetException(_failure);
+    else if constexpr (std::is_void_v<T>)
+        this->SetValue();
+    else
+    {
+        try
+        {
+            std::vector<T> result;
+            result.reserve(_values.size());
+            for (auto& value : _values)
+                result.emplace_back(std::move(*value));
+            this->SetValue(std::move(result));
+        }
+        catch (...)
+        {
+            this->SetException(std::current_exception());
+        }
+    }
+
+    this->Release();
+}
+
+// Release the future state on scope exit
+class FutureStateReleaser
+{
+public:
+    explicit FutureStateReleaser(FutureStateBase* state) noexcept : _state(state) {}
+    FutureStateReleaser(const FutureStateReleaser&) = delete;
+    ~FutureStateReleaser() { _state->Release(); }
+
+    FutureStateReleaser& operator=(const FutureStateReleaser&) = delete;
+
+private:
+    FutureStateBase* _state;
+};
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+inline bool Future<T>::Awaiter::await_suspend(std::coroutine_handle<> coroutine) noexcept
+{
+    assert(_future.valid() && "Invalid future cannot be awaited!");
+
+    // The coroutine might be resumed as soon as the continuation is attached
+    _waiter.Suspend(coroutine);
+    return _future._state->Attach(this);
+}
+
+template <typename T>
+inline Future<T>& Future<T>::operator=(Future&& future) noexcept
+{
+    Future(std::move(future)).swap(*this);
+    return *this;
+}
+
+template <typename T>
+inline void Future<T>::Wait() const
+{
+    assert(valid() && "Invalid future cannot be waited!");
+
+    if (!_state->ready())
+        _state->Wait();
+}
+
+template <typename T>
+inline T Future<T>::Get()
+{
+    Wait();
+
+    Internals::FutureState<T>* state = std::exchange(_state, nullptr);
+    Internals::FutureStateReleaser releaser(state);
+    return state->Take();
+}
+
+template <typename T>
+template <class TExecutor, class TFunction>
+inline Future<typename Internals::FutureResult<T, TFunction>::type> Future<T>::Chain(TExecutor* executor, TFunction&& function)
+{
+    assert(valid() && "Invalid future cannot be continued!");
+
+    typedef typename Internals::FutureResult<T, TFunction>::type R;
+    typedef Internals::ThenState<T, R, std::decay_t<TFunction>, TExecutor> State;
+
+    State* state = Internals::FutureStatePool<State>::Create(_state, std::forward<TFunction>(function), executor);
+    Future<R> result(state);
+    std::exchange(_state, nullptr)->Subscribe(state);
+    return result;
+}
+
+template <typename T>
+inline Promise<T>::Promise(Promise&& promise) noexcept
+    : _state(std::exchange(promise._state, nullptr)),
+      _retrieved(promise._retrieved),
+      _satisfied(promise._satisfied)
+{
+}
+
+template <typename T>
+inline Promise<T>& Promise<T>::operator=(Promise&& promise) noexcept
+{
+    if (this != &promise)
+    {
+        Abandon();
+        _state = std::exchange(promise._state, nullptr);
+        _retrieved = promise._retrieved;
+        _satisfied = promise._satisfied;
+    }
+    return *this;
+}
+
+template <typename T>
+inline Future<T> Promise<T>::GetFuture()
+{
+    assert((_state != nullptr) && "Moved promise cannot be used!");
+
+    if (_retrieved)
+        throwex RuntimeException("Future of the promise was already retrieved!");
+
+    _retrieved = true;
+    return Internals::FutureAccess::Make<T>(_state);
+}
+
+template <typename T>
+template <class... Args>
+inline void Promise<T>::SetValue(Args&&... args)
+{
+    assert((_state != nullptr) && "Moved promise cannot be used!");
+
+    if (_satisfied)
+        throwex RuntimeException("Promise is already satisfied!");
+
+    _satisfied = true;
+    _state->SetValue(std::forward<Args>(args)...);
+}
+
+template <typename T>
+inline void Promise<T>::SetException(std::exception_ptr exception)
+{
+    assert((_state != nullptr) && "Moved promise cannot be used!");
+
+    if (_satisfied)
+        throwex RuntimeException("Promise is already satisfied!");
+
+    _satisfied = true;
+    _state->SetException(std::move(exception));
+}
+
+template <typename T>
+inline void Promise<T>::swap(Promise& promise) noexcept
+{
+    using std::swap;
+    swap(_state, promise._state);
+    swap(_retrieved, promise._retrieved);
+    swap(_satisfied, promise._satisfied);
+}
+
+template <typename T>
+inline void Promise<T>::Abandon() noexcept
+{
+    if (_state == nullptr)
+        return;
+
+    if (!_satisfied)
+        _state->SetException(std::make_exception_ptr(__LOCATION__ + RuntimeException("Broken promise!")));
+
+    // Release the reference of the not retrieved future
+    if (!_retrieved)
+        _state->Release();
+
+    std::exchange(_state, nullptr)->Release();
+}
+
+template <typename T, class... Args>
+inline Future<T> MakeReadyFuture(Args&&... args)
+{
+    Promise<T> promise;
+    promise.SetValue(std::forward<Args>(args)...);
+    return promise.GetFuture();
+}
+
+template <typename T>
+inline Future<T> MakeExceptionalFuture(std::exception_ptr exception)
+{
+    Promise<T> promise;
+    promise.SetException(std::move(exception));
+    return promise.GetFuture();
+}
+
+template <typename T>
+inline Future<typename Internals::WhenAllResult<T>::type> WhenAll(std::vector<Future<T>> futures)
+{
+    typedef Internals::WhenState<T, true> State;
+
+    State* state = Internals::FutureStatePool<State>::Create(futures);
+    auto result = Internals::FutureAccess::Make<typename Internals::WhenAllResult<T>::type>(state);
+    state->Start();
+    return result;
+}
+
+template <typename T>
+inline Future<typename Internals::WhenAnyResult<T>::type> WhenAny(std::vector<Future<T>> futures)
+{
+    typedef Internals::WhenState<T, false> State;
+
+    if (futures.empty())
+        throwex ArgumentException("WhenAny() requires at least one future!");
+
+    State* state = Internals::FutureStatePool<State>::Create(futures);
+    auto result = Internals::FutureAccess::Make<typename Internals::WhenAnyResult<T>::type>(state);
+    state->Start();
+    return result;
+}
+
+} // namespace CppCommon
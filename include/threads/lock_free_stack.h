@@ -0,0 +1,116 @@
+/*!
+    \file lock_free_stack.h
+    \brief Lock-free intrusive stack definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_LOCK_FREE_STACK_H
+#define CPPCOMMON_THREADS_LOCK_FREE_STACK_H
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Lock-free intrusive stack
+/*!
+    Lock-free intrusive stack (Treiber stack) links items through their own
+    atomic 'next' field, so push and pop operations do not allocate memory.
+    Item type must provide 'std::atomic<T*> next' member.
+
+    The top of the stack is a tagged pointer: pointer bits are packed with the
+    modification counter into a single 64-bit word which is updated with a
+    single-width CAS. The counter is incremented with each successful
+    modification, so the ABA problem (the top item is popped and pushed back
+    between the load and the CAS of the other thread) is prevented without
+    double-width CAS.
+
+    Popped items could be read by concurrent pop operations which loaded them
+    before, so items memory must remain valid while the stack is in use (e.g.
+    items from a pool which is never returned to the operating system).
+
+    LIFO order is guaranteed!
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Treiber_stack
+*/
+template <typename T>
+class LockFreeStack
+{
+public:
+    LockFreeStack() noexcept : _top(0) {}
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack(LockFreeStack&&) = delete;
+    ~LockFreeStack() = default;
+
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(LockFreeStack&&) = delete;
+
+    //! Check if the stack is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the stack empty?
+    bool empty() const noexcept { return (top() == nullptr); }
+
+    //! Get the top stack item (could be popped concurrently)
+    T* top() const noexcept { return Pointer(_top.load(std::memory_order_acquire)); }
+
+    //! Push a new item into the top of the stack
+    /*!
+        Will not block.
+
+        \param item - Pushed item
+    */
+    void Push(T& item) noexcept { Push(item, item); }
+    //! Push the chain of items linked through their 'next' fields into the top of the stack
+    /*!
+        Will not block.
+
+        \param first - First item of the chain (becomes the top item)
+        \param last - Last item of the chain
+    */
+    void Push(T& first, T& last) noexcept;
+
+    //! Pop the item from the top of the stack
+    /*!
+        Will not block.
+
+        \return The top item popped from the stack or nullptr if the stack is empty
+    */
+    T* Pop() noexcept;
+
+    //! Pop all items from the stack
+    /*!
+        Will not block.
+
+        \return The chain of all popped items linked through their 'next' fields or nullptr if the stack is empty
+    */
+    T* PopAll() noexcept;
+
+private:
+#if UINTPTR_MAX > 0xFFFFFFFFu
+    // User space virtual addresses of 64-bit platforms fit into 48 bits
+    static const int POINTER_BITS = 48;
+#else
+    static const int POINTER_BITS = 32;
+#endif
+    static const uint64_t POINTER_MASK = (((uint64_t)1) << POINTER_BITS) - 1;
+
+    alignas(64) std::atomic<uint64_t> _top;
+
+    static T* Pointer(uint64_t top) noexcept { return (T*)(uintptr_t)(top & POINTER_MASK); }
+    static uint64_t Tag(uint64_t top) noexcept { return (top >> POINTER_BITS); }
+    static uint64_t Pack(T* ptr, uint64_t tag) noexcept;
+};
+
+/*! \example threads_lock_free_stack.cpp Lock-free intrusive stack example */
+
+} // namespace CppCommon
+
+#include "lock_free_stack.inl"
+
+#endif // CPPCOMMON_THREADS_LOCK_FREE_STACK_H
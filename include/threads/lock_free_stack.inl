@@ -0,0 +1,54 @@
+/*!
+    \file lock_free_stack.inl
+    \brief Lock-free intrusive stack inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline uint64_t LockFreeStack<T>::Pack(T* ptr, uint64_t tag) noexcept
+{
+    assert((((uint64_t)(uintptr_t)ptr & ~POINTER_MASK) == 0) && "Stack item address does not fit into the tagged pointer!");
+    return ((uint64_t)(uintptr_t)ptr & POINTER_MASK) | (tag << POINTER_BITS);
+}
+
+template <typename T>
+inline void LockFreeStack<T>::Push(T& first, T& last) noexcept
+{
+    uint64_t top = _top.load(std::memory_order_relaxed);
+    do
+    {
+        last.next.store(Pointer(top), std::memory_order_relaxed);
+    } while (!_top.compare_exchange_weak(top, Pack(&first, Tag(top) + 1), std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename T>
+inline T* LockFreeStack<T>::Pop() noexcept
+{
+    uint64_t top = _top.load(std::memory_order_acquire);
+    for (;;)
+    {
+        T* item = Pointer(top);
+        if (item == nullptr)
+            return nullptr;
+
+        // The next item could be stale if the top item was popped concurrently,
+        // but then the tag is changed and the CAS will fail
+        T* next = item->next.load(std::memory_order_relaxed);
+        if (_top.compare_exchange_weak(top, Pack(next, Tag(top) + 1), std::memory_order_acquire, std::memory_order_acquire))
+            return item;
+    }
+}
+
+template <typename T>
+inline T* LockFreeStack<T>::PopAll() noexcept
+{
+    uint64_t top = _top.load(std::memory_order_relaxed);
+    while ((Pointer(top) != nullptr) && !_top.compare_exchange_weak(top, Pack(nullptr, Tag(top) + 1), std::memory_order_acquire, std::memory_order_relaxed));
+    return Pointer(top);
+}
+
+} // namespace CppCommon
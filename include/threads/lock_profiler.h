@@ -0,0 +1,327 @@
+/*!
+    \file lock_profiler.h
+    \brief Lock contention profiler definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_LOCK_PROFILER_H
+#define CPPCOMMON_THREADS_LOCK_PROFILER_H
+
+#include "system/source_location.h"
+#include "system/stack_trace.h"
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//! Lock the given primitive in the current scope and profile the lock site
+/*!
+    Declares a static lock site for the current source location and a scoped
+    profiled locker, so it must be used as a statement in a function scope.
+    Defining CPPCOMMON_LOCK_PROFILING_DISABLE replaces profiled lockers with
+    plain Locker, ReadLocker and WriteLocker.
+*/
+#define PROFILED_LOCKER(primitive) \
+    static CppCommon::LockSite CPPCOMMON_LOCK_CONCAT(__lock_site_, __LINE__)(__LOCATION__); \
+    CppCommon::ProfiledLocker<std::remove_reference_t<decltype(primitive)>> CPPCOMMON_LOCK_CONCAT(__profiled_locker_, __LINE__)(primitive, CPPCOMMON_LOCK_CONCAT(__lock_site_, __LINE__))
+//! Read-lock the given primitive in the current scope and profile the lock site
+#define PROFILED_READ_LOCKER(primitive) \
+    static CppCommon::LockSite CPPCOMMON_LOCK_CONCAT(__lock_site_, __LINE__)(__LOCATION__); \
+    CppCommon::ProfiledReadLocker<std::remove_reference_t<decltype(primitive)>> CPPCOMMON_LOCK_CONCAT(__profiled_locker_, __LINE__)(primitive, CPPCOMMON_LOCK_CONCAT(__lock_site_, __LINE__))
+//! Write-lock the given primitive in the current scope and profile the lock site
+#define PROFILED_WRITE_LOCKER(primitive) \
+    static CppCommon::LockSite CPPCOMMON_LOCK_CONCAT(__lock_site_, __LINE__)(__LOCATION__); \
+    CppCommon::ProfiledWriteLocker<std::remove_reference_t<decltype(primitive)>> CPPCOMMON_LOCK_CONCAT(__profiled_locker_, __LINE__)(primitive, CPPCOMMON_LOCK_CONCAT(__lock_site_, __LINE__))
+
+#if defined(CPPCOMMON_LOCK_PROFILING_DISABLE)
+#undef PROFILED_LOCKER
+#undef PROFILED_READ_LOCKER
+#undef PROFILED_WRITE_LOCKER
+#define PROFILED_LOCKER(primitive) CppCommon::Locker<std::remove_reference_t<decltype(primitive)>> CPPCOMMON_LOCK_CONCAT(__locker_, __LINE__)(primitive)
+#define PROFILED_READ_LOCKER(primitive) CppCommon::ReadLocker<std::remove_reference_t<decltype(primitive)>> CPPCOMMON_LOCK_CONCAT(__locker_, __LINE__)(primitive)
+#define PROFILED_WRITE_LOCKER(primitive) CppCommon::WriteLocker<std::remove_reference_t<decltype(primitive)>> CPPCOMMON_LOCK_CONCAT(__locker_, __LINE__)(primitive)
+#endif
+
+//! @cond INTERNALS
+#define CPPCOMMON_LOCK_CONCAT_IMPL(x, y) x##y
+#define CPPCOMMON_LOCK_CONCAT(x, y) CPPCOMMON_LOCK_CONCAT_IMPL(x, y)
+//! @endcond
+
+namespace CppCommon {
+
+//! Lock wait sample
+struct LockWait
+{
+    uint64_t wait;              //!< Wait time in nanoseconds
+    std::vector<void*> frames;  //!< Stack frames addresses of the waiting thread
+
+    //! Resolve the stack trace of the waiting thread
+    StackTrace stack() const { return StackTrace(frames.data(), (int)frames.size()); }
+};
+
+//! Lock site statistics
+/*!
+    Snapshot of lock site counters. Hold times are sampled (see
+    LockSite::SAMPLING), so only a fraction of acquisitions is timed.
+
+    Not thread-safe.
+*/
+struct LockStatistics
+{
+    //! Source location of the lock site
+    SourceLocation location;
+
+    //! Count of acquisitions
+    uint64_t acquisitions{0};
+    //! Count of contended acquisitions
+    uint64_t contentions{0};
+    //! Total wait time of contended acquisitions in nanoseconds
+    uint64_t wait_total{0};
+    //! Max wait time in nanoseconds
+    uint64_t wait_max{0};
+    //! Count of hold time samples
+    uint64_t hold_samples{0};
+    //! Total sampled hold time in nanoseconds
+    uint64_t hold_total{0};
+    //! Max sampled hold time in nanoseconds
+    uint64_t hold_max{0};
+
+    //! Worst waits with stack traces sorted by the wait time
+    std::vector<LockWait> worst;
+
+    explicit LockStatistics(const SourceLocation& site_location) : location(site_location) {}
+
+    //! Get the contended acquisitions ratio in range [0.0, 1.0]
+    double contention_ratio() const noexcept
+    { return (acquisitions > 0) ? ((double)contentions / (double)acquisitions) : 0.0; }
+    //! Get the average wait time of contended acquisitions in nanoseconds
+    uint64_t wait_average() const noexcept { return (contentions > 0) ? (wait_total / contentions) : 0; }
+    //! Get the average sampled hold time in nanoseconds
+    uint64_t hold_average() const noexcept { return (hold_samples > 0) ? (hold_total / hold_samples) : 0; }
+};
+
+//! Lock site
+/*!
+    Lock site keeps contention counters of a single source location where
+    locks are acquired (usually a static object declared by PROFILED_LOCKER
+    macro). Counters are updated with relaxed atomic operations. Lock sites
+    are registered in LockProfiler for the whole lifetime.
+
+    Uncontended acquisition costs a successful try-lock and a single relaxed
+    atomic increment. Contended acquisitions measure the wait time, the worst
+    waits also capture stack frames addresses of the waiting thread. Hold time
+    is measured for one of SAMPLING acquisitions.
+
+    Thread-safe.
+*/
+class LockSite
+{
+public:
+    //! Measure hold time of one of SAMPLING acquisitions
+    static const uint64_t SAMPLING = 64;
+    //! Count of the worst waits with stack traces
+    static const size_t WORST = 4;
+    //! Max depth of stack traces of the worst waits
+    static const int DEPTH = 32;
+
+    //! Register the lock site with the given source location
+    /*!
+        \param location - Source location of the lock site
+    */
+    explicit LockSite(const SourceLocation& location);
+    LockSite(const LockSite&) = delete;
+    LockSite(LockSite&&) = delete;
+    ~LockSite();
+
+    LockSite& operator=(const LockSite&) = delete;
+    LockSite& operator=(LockSite&&) = delete;
+
+    //! Get the source location of the lock site
+    const SourceLocation& location() const noexcept { return _location; }
+
+    //! Count the acquisition
+    /*!
+        \return 'true' if the hold time of the acquisition should be measured, 'false' otherwise
+    */
+    bool Acquired() noexcept { return (_acquisitions.fetch_add(1, std::memory_order_relaxed) % SAMPLING) == 0; }
+    //! Record the contended acquisition
+    /*!
+        \param wait - Wait time in nanoseconds
+    */
+    void Contended(uint64_t wait) noexcept;
+    //! Record the sampled hold time
+    /*!
+        \param hold - Hold time in nanoseconds
+    */
+    void Held(uint64_t hold) noexcept;
+
+    //! Get the lock site statistics
+    LockStatistics statistics() const;
+    //! Reset the lock site statistics
+    void Reset();
+
+private:
+    SourceLocation _location;
+
+    std::atomic<uint64_t> _acquisitions;
+    std::atomic<uint64_t> _contentions;
+    std::atomic<uint64_t> _wait_total;
+    std::atomic<uint64_t> _wait_max;
+    std::atomic<uint64_t> _hold_samples;
+    std::atomic<uint64_t> _hold_total;
+    std::atomic<uint64_t> _hold_max;
+
+    // The worst waits are updated under the spin-lock
+    // only when the wait is worse than the threshold
+    mutable SpinLock _lock;
+    std::atomic<uint64_t> _threshold;
+    std::vector<LockWait> _worst;
+
+    static void UpdateMax(std::atomic<uint64_t>& max, uint64_t value) noexcept;
+};
+
+//! Lock contention profiler
+/*!
+    Lock contention profiler is a registry of all lock sites. Statistics of
+    lock sites could be exported or reported at any time without stopping
+    threads.
+
+    Thread-safe.
+*/
+class LockProfiler
+{
+public:
+    LockProfiler() = delete;
+    LockProfiler(const LockProfiler&) = delete;
+    LockProfiler(LockProfiler&&) = delete;
+    ~LockProfiler() = delete;
+
+    LockProfiler& operator=(const LockProfiler&) = delete;
+    LockProfiler& operator=(LockProfiler&&) = delete;
+
+    //! Get statistics of all lock sites sorted by the total wait time, then by acquisitions
+    static std::vector<LockStatistics> statistics();
+
+    //! Get the text report of the most contended lock sites
+    /*!
+        \param top - Count of lock sites in the report (default is 10)
+        \return Text report
+    */
+    static std::string report(size_t top = 10);
+
+    //! Reset statistics of all lock sites
+    static void Reset();
+
+private:
+    friend class LockSite;
+
+    static void Register(LockSite* site);
+    static void Unregister(LockSite* site);
+};
+
+//! Profiled locker synchronization primitive
+/*!
+    Locker which keeps the given synchronization primitive locked in the
+    scope and records the acquisition into the given lock site.
+
+    Thread-safe.
+*/
+template <class T>
+class ProfiledLocker
+{
+public:
+    //! Lock the synchronization primitive and profile the given lock site
+    /*!
+        \param primitive - Synchronization primitive to manage
+        \param site - Lock site
+    */
+    explicit ProfiledLocker(T& primitive, LockSite& site);
+    ProfiledLocker(const ProfiledLocker&) = delete;
+    ProfiledLocker(ProfiledLocker&&) = delete;
+    ~ProfiledLocker();
+
+    ProfiledLocker& operator=(const ProfiledLocker&) = delete;
+    ProfiledLocker& operator=(ProfiledLocker&&) = delete;
+
+private:
+    T& _primitive;
+    LockSite& _site;
+    uint64_t _acquired;
+};
+
+//! Profiled read locker synchronization primitive
+/*!
+    Read locker which keeps the given read/write synchronization primitive
+    locked for read in the scope and records the acquisition into the given
+    lock site.
+
+    Thread-safe.
+*/
+template <class T>
+class ProfiledReadLocker
+{
+public:
+    //! Read-lock the synchronization primitive and profile the given lock site
+    /*!
+        \param primitive - Synchronization primitive to manage
+        \param site - Lock site
+    */
+    explicit ProfiledReadLocker(T& primitive, LockSite& site);
+    ProfiledReadLocker(const ProfiledReadLocker&) = delete;
+    ProfiledReadLocker(ProfiledReadLocker&&) = delete;
+    ~ProfiledReadLocker();
+
+    ProfiledReadLocker& operator=(const ProfiledReadLocker&) = delete;
+    ProfiledReadLocker& operator=(ProfiledReadLocker&&) = delete;
+
+private:
+    T& _primitive;
+    LockSite& _site;
+    uint64_t _acquired;
+};
+
+//! Profiled write locker synchronization primitive
+/*!
+    Write locker which keeps the given read/write synchronization primitive
+    locked for write in the scope and records the acquisition into the given
+    lock site.
+
+    Thread-safe.
+*/
+template <class T>
+class ProfiledWriteLocker
+{
+public:
+    //! Write-lock the synchronization primitive and profile the given lock site
+    /*!
+        \param primitive - Synchronization primitive to manage
+        \param site - Lock site
+    */
+    explicit ProfiledWriteLocker(T& primitive, LockSite& site);
+    ProfiledWriteLocker(const ProfiledWriteLocker&) = delete;
+    ProfiledWriteLocker(ProfiledWriteLocker&&) = delete;
+    ~ProfiledWriteLocker();
+
+    ProfiledWriteLocker& operator=(const ProfiledWriteLocker&) = delete;
+    ProfiledWriteLocker& operator=(ProfiledWriteLocker&&) = delete;
+
+private:
+    T& _primitive;
+    LockSite& _site;
+    uint64_t _acquired;
+};
+
+/*! \example threads_lock_profiler.cpp Lock contention profiler example */
+
+} // namespace CppCommon
+
+#include "lock_profiler.inl"
+
+#endif // CPPCOMMON_THREADS_LOCK_PROFILER_H
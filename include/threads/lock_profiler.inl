@@ -0,0 +1,98 @@
+/*!
+    \file lock_profiler.inl
+    \brief Lock contention profiler inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class T>
+inline ProfiledLocker<T>::ProfiledLocker(T& primitive, LockSite& site) : _primitive(primitive), _site(site), _acquired(0)
+{
+    // Fast path: uncontended acquisition
+    if (_primitive.TryLock())
+    {
+        if (_site.Acquired())
+            _acquired = Timestamp::nano();
+        return;
+    }
+
+    // Slow path: measure the wait time
+    uint64_t timestamp = Timestamp::nano();
+    _primitive.Lock();
+    uint64_t acquired = Timestamp::nano();
+    _site.Contended(acquired - timestamp);
+    if (_site.Acquired())
+        _acquired = acquired;
+}
+
+template <class T>
+inline ProfiledLocker<T>::~ProfiledLocker()
+{
+    uint64_t hold = (_acquired > 0) ? (Timestamp::nano() - _acquired) : 0;
+    _primitive.Unlock();
+    if (_acquired > 0)
+        _site.Held(hold);
+}
+
+template <class T>
+inline ProfiledReadLocker<T>::ProfiledReadLocker(T& primitive, LockSite& site) : _primitive(primitive), _site(site), _acquired(0)
+{
+    // Fast path: uncontended acquisition
+    if (_primitive.TryLockRead())
+    {
+        if (_site.Acquired())
+            _acquired = Timestamp::nano();
+        return;
+    }
+
+    // Slow path: measure the wait time
+    uint64_t timestamp = Timestamp::nano();
+    _primitive.LockRead();
+    uint64_t acquired = Timestamp::nano();
+    _site.Contended(acquired - timestamp);
+    if (_site.Acquired())
+        _acquired = acquired;
+}
+
+template <class T>
+inline ProfiledReadLocker<T>::~ProfiledReadLocker()
+{
+    uint64_t hold = (_acquired > 0) ? (Timestamp::nano() - _acquired) : 0;
+    _primitive.UnlockRead();
+    if (_acquired > 0)
+        _site.Held(hold);
+}
+
+template <class T>
+inline ProfiledWriteLocker<T>::ProfiledWriteLocker(T& primitive, LockSite& site) : _primitive(primitive), _site(site), _acquired(0)
+{
+    // Fast path: uncontended acquisition
+    if (_primitive.TryLockWrite())
+    {
+        if (_site.Acquired())
+            _acquired = Timestamp::nano();
+        return;
+    }
+
+    // Slow path: measure the wait time
+    uint64_t timestamp = Timestamp::nano();
+    _primitive.LockWrite();
+    uint64_t acquired = Timestamp::nano();
+    _site.Contended(acquired - timestamp);
+    if (_site.Acquired())
+        _acquired = acquired;
+}
+
+template <class T>
+inline ProfiledWriteLocker<T>::~ProfiledWriteLocker()
+{
+    uint64_t hold = (_acquired > 0) ? (Timestamp::nano() - _acquired) : 0;
+    _primitive.UnlockWrite();
+    if (_acquired > 0)
+        _site.Held(hold);
+}
+
+} // namespace CppCommon
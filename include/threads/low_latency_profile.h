@@ -0,0 +1,144 @@
+/*!
+    \file low_latency_profile.h
+    \brief Low-latency thread profile definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_LOW_LATENCY_PROFILE_H
+#define CPPCOMMON_THREADS_LOW_LATENCY_PROFILE_H
+
+#include "system/cpu_set.h"
+#include "time/timespan.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace CppCommon {
+
+//! Real-time scheduling policy
+enum class RealtimePolicy
+{
+    NONE,       //!< Keep the current scheduling policy
+    FIFO,       //!< First in, first out real-time policy (SCHED_FIFO)
+    RR,         //!< Round robin real-time policy (SCHED_RR)
+    DEADLINE    //!< Earliest deadline first policy (SCHED_DEADLINE, Linux only)
+};
+
+//! Low-latency thread profile options
+struct LowLatencyOptions
+{
+    //! CPUs to pin the thread to (empty set to use isolated CPUs if any)
+    CPUSet cpus;
+    //! Real-time scheduling policy
+    RealtimePolicy policy{RealtimePolicy::FIFO};
+    //! Real-time priority for FIFO and RR policies (1..99)
+    int priority{80};
+    //! Runtime budget of each period for DEADLINE policy
+    Timespan runtime;
+    //! Period (and relative deadline) for DEADLINE policy
+    Timespan period;
+    //! Lock current and future memory pages of the process (mlockall)
+    bool lock_memory{true};
+    //! Size of the thread stack to prefault in bytes (0 to skip)
+    size_t prefault_stack{256 * 1024};
+    //! Disable returning of freed heap memory to the system (glibc malloc trimming and mmap)
+    bool disable_malloc_trim{true};
+    //! Set the timer slack of the thread to 1 nanosecond (Linux only)
+    bool disable_timer_slack{true};
+};
+
+//! Low-latency thread profile report
+struct LowLatencyReport
+{
+    //! Thread is pinned to CPUs
+    bool pinned{false};
+    //! Real-time scheduling policy is set
+    bool realtime{false};
+    //! Process memory is locked
+    bool memory_locked{false};
+    //! Thread stack is prefaulted
+    bool stack_prefaulted{false};
+    //! Malloc trimming is disabled
+    bool malloc_trim_disabled{false};
+    //! Timer slack is disabled
+    bool timer_slack_disabled{false};
+    //! CPUs the thread is pinned to
+    CPUSet cpus;
+    //! Descriptions of optimizations which are failed or not supported
+    std::vector<std::string> failures;
+
+    //! Are all requested optimizations applied?
+    bool complete() const noexcept { return failures.empty(); }
+};
+
+//! Low-latency thread profile
+/*!
+    Low-latency thread profile applies the usual tuning of latency critical
+    threads (market data handlers, order gateways, real-time control loops)
+    to the current thread in one call:
+    \li pin the thread to the given or isolated CPUs (isolcpus kernel
+        parameter), so the scheduler does not migrate it and other threads
+        do not preempt it;
+    \li set the real-time scheduling policy (SCHED_FIFO, SCHED_RR or
+        SCHED_DEADLINE), so normal threads never preempt it;
+    \li lock current and future memory pages (mlockall), so the thread never
+        waits for page faults and swapping;
+    \li prefault the thread stack, so the first deep call does not fault;
+    \li disable returning of freed heap memory to the system, so free() and
+        malloc() do not call munmap() and mmap() on the hot path;
+    \li set the timer slack to 1 nanosecond (PR_SET_TIMERSLACK), so timed
+        waits are not delayed by 50 microseconds of the default slack.
+
+    Each optimization is independent. Failures (missing CAP_SYS_NICE or
+    CAP_IPC_LOCK privileges, RLIMIT_MEMLOCK limit, unsupported platform) do
+    not throw exceptions and are reported, so the same code works in
+    production and in development environments. On Windows platform the
+    thread is pinned, gets the time critical priority and the working set
+    is locked, other optimizations are reported as not supported.
+
+    Thread-safe.
+*/
+class LowLatencyProfile
+{
+public:
+    LowLatencyProfile() = delete;
+    LowLatencyProfile(const LowLatencyProfile&) = delete;
+    LowLatencyProfile(LowLatencyProfile&&) = delete;
+    ~LowLatencyProfile() = delete;
+
+    LowLatencyProfile& operator=(const LowLatencyProfile&) = delete;
+    LowLatencyProfile& operator=(LowLatencyProfile&&) = delete;
+
+    //! Apply the low-latency profile to the current thread
+    /*!
+        \param options - Low-latency profile options (default is LowLatencyOptions())
+        \return Report of applied optimizations
+    */
+    static LowLatencyReport Apply(const LowLatencyOptions& options = LowLatencyOptions());
+
+    //! Get the set of isolated CPUs
+    /*!
+        Isolated CPUs are excluded from the scheduler load balancing with the
+        isolcpus kernel parameter (Linux only).
+
+        \return Set of isolated CPUs (empty if there are no isolated CPUs)
+    */
+    static CPUSet IsolatedCPUs();
+
+    //! Prefault the given size of the current thread stack
+    /*!
+        The size must be less than the free space of the thread stack.
+
+        \param size - Size of the stack to prefault in bytes
+    */
+    static void PrefaultStack(size_t size) noexcept;
+};
+
+/*! \example threads_low_latency_profile.cpp Low-latency thread profile example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_LOW_LATENCY_PROFILE_H
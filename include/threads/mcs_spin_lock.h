@@ -0,0 +1,144 @@
+/*!
+    \file mcs_spin_lock.h
+    \brief MCS queued spin-lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MCS_SPIN_LOCK_H
+#define CPPCOMMON_THREADS_MCS_SPIN_LOCK_H
+
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! MCS queued spin-lock synchronization primitive
+/*!
+    MCS spin-lock links waiting threads into the FIFO queue of nodes. Each
+    waiting thread spins on the flag of its own node, so only one cache line
+    is transferred on the lock hand-off regardless of the count of waiting
+    threads. The lock is fair and starvation-free and scales well under the
+    high contention.
+
+    Queue nodes are taken from the thread local node cache, so the lock must
+    be released by the same thread which acquired it.
+
+    Thread-safe.
+
+    https://www.cs.rochester.edu/research/synchronization/pseudocode/ss.html#mcs
+*/
+class MCSSpinLock
+{
+public:
+    MCSSpinLock() noexcept : _tail(nullptr), _owner(nullptr) {}
+    MCSSpinLock(const MCSSpinLock&) = delete;
+    MCSSpinLock(MCSSpinLock&&) = delete;
+    ~MCSSpinLock() = default;
+
+    MCSSpinLock& operator=(const MCSSpinLock&) = delete;
+    MCSSpinLock& operator=(MCSSpinLock&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock is already locked, 'false' if the spin-lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire spin-lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire spin-lock for the given spin count
+    /*!
+        Will block for the given spin count in the worst case.
+
+        \param spin - Spin count
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockSpin(int64_t spin) noexcept;
+
+    //! Try to acquire spin-lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire spin-lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire spin-lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock() noexcept;
+
+    //! Release spin-lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    static constexpr uint32_t MaxBackoff = 1024;
+    static constexpr int MaxSpin = 4096;
+
+    typedef char cache_line_pad[128];
+
+    // Queue node placed on its own cache line
+    struct alignas(128) Node
+    {
+        std::atomic<Node*> next;
+        std::atomic<bool> locked;
+    };
+
+    // Thread local cache of free nodes
+    struct NodeCache
+    {
+        Node* nodes = nullptr;
+
+        ~NodeCache();
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<Node*> _tail;
+    cache_line_pad _pad1;
+    Node* _owner;
+    cache_line_pad _pad2;
+
+    //! Get the thread local node cache
+    static NodeCache& Cache() noexcept;
+    //! Allocate a new node from the thread local node cache or the heap
+    static Node* AllocateNode() noexcept;
+    //! Release the node into the thread local node cache
+    static void ReleaseNode(Node* node) noexcept;
+};
+
+/*! \example threads_mcs_spin_lock.cpp MCS queued spin-lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "mcs_spin_lock.inl"
+
+#endif // CPPCOMMON_THREADS_MCS_SPIN_LOCK_H
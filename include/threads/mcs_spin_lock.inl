@@ -0,0 +1,177 @@
+/*!
+    \file mcs_spin_lock.inl
+    \brief MCS queued spin-lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool MCSSpinLock::IsLocked() noexcept
+{
+    return (_tail.load(std::memory_order_acquire) != nullptr);
+}
+
+inline bool MCSSpinLock::TryLock() noexcept
+{
+    // Check for the empty queue before the node allocation
+    if (_tail.load(std::memory_order_relaxed) != nullptr)
+        return false;
+
+    Node* node = AllocateNode();
+    node->next.store(nullptr, std::memory_order_relaxed);
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Acquire spin-lock only if the queue is empty
+    Node* tail = nullptr;
+    if (_tail.compare_exchange_strong(tail, node, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        _owner = node;
+        return true;
+    }
+
+    ReleaseNode(node);
+    return false;
+}
+
+inline bool MCSSpinLock::TryLockSpin(int64_t spin) noexcept
+{
+    uint32_t backoff = 1;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+
+        // Exponential backoff
+        for (uint32_t i = 0; i < backoff; ++i)
+            Thread::Pause();
+        backoff = std::min(backoff * 2, MaxBackoff);
+    } while (spin-- > 0);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline bool MCSSpinLock::TryLockFor(const Timespan& timespan) noexcept
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    uint32_t backoff = 1;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+
+        // Exponential backoff
+        for (uint32_t i = 0; i < backoff; ++i)
+            Thread::Pause();
+        backoff = std::min(backoff * 2, MaxBackoff);
+    } while (NanoTimestamp() < finish);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline void MCSSpinLock::Lock() noexcept
+{
+    Node* node = AllocateNode();
+    node->next.store(nullptr, std::memory_order_relaxed);
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node and link it with the previous one
+    Node* prev = _tail.exchange(node, std::memory_order_acq_rel);
+    if (prev != nullptr)
+    {
+        prev->next.store(node, std::memory_order_release);
+
+        // Spin on the flag of the own node
+        int spin = 0;
+        while (node->locked.load(std::memory_order_acquire))
+        {
+            Thread::Pause();
+
+            // Yield to other threads if the lock owner seems to be preempted
+            if (++spin >= MaxSpin)
+            {
+                Thread::Yield();
+                spin = 0;
+            }
+        }
+    }
+
+    _owner = node;
+}
+
+inline void MCSSpinLock::Unlock() noexcept
+{
+    Node* node = _owner;
+
+    Node* next = node->next.load(std::memory_order_acquire);
+    if (next == nullptr)
+    {
+        // Release spin-lock if there are no waiting threads
+        Node* tail = node;
+        if (_tail.compare_exchange_strong(tail, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            ReleaseNode(node);
+            return;
+        }
+
+        // Wait for the next thread to link its node
+        while ((next = node->next.load(std::memory_order_acquire)) == nullptr)
+            Thread::Pause();
+    }
+
+    // Hand-off spin-lock to the next waiting thread
+    next->locked.store(false, std::memory_order_release);
+    ReleaseNode(node);
+}
+
+inline MCSSpinLock::NodeCache::~NodeCache()
+{
+    // Remove all cached nodes
+    while (nodes != nullptr)
+    {
+        Node* next = nodes->next.load(std::memory_order_relaxed);
+        delete nodes;
+        nodes = next;
+    }
+}
+
+inline MCSSpinLock::NodeCache& MCSSpinLock::Cache() noexcept
+{
+    static thread_local NodeCache cache;
+    return cache;
+}
+
+inline MCSSpinLock::Node* MCSSpinLock::AllocateNode() noexcept
+{
+    NodeCache& cache = Cache();
+
+    // Allocate a new node from the thread local node cache
+    Node* node = cache.nodes;
+    if (node != nullptr)
+    {
+        cache.nodes = node->next.load(std::memory_order_relaxed);
+        return node;
+    }
+
+    // Allocate a new node from the heap
+    return new Node();
+}
+
+inline void MCSSpinLock::ReleaseNode(Node* node) noexcept
+{
+    NodeCache& cache = Cache();
+
+    node->next.store(cache.nodes, std::memory_order_relaxed);
+    cache.nodes = node;
+}
+
+} // namespace CppCommon
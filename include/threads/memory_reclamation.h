@@ -0,0 +1,405 @@
+/*!
+    \file memory_reclamation.h
+    \brief Safe memory reclamation (hazard pointers and epoch-based reclamation) definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MEMORY_RECLAMATION_H
+#define CPPCOMMON_THREADS_MEMORY_RECLAMATION_H
+
+#include "memory/allocator.h"
+#include "threads/asymmetric_fence.h"
+#include "threads/spin_lock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Retired node with the typed deleter
+template <class TMemoryManager>
+struct ReclamationNode
+{
+    void* ptr;
+    void (*deleter)(void* ptr, TMemoryManager& manager, SpinLock& lock);
+    uint64_t epoch;
+};
+
+// Lock-free list of thread records acquired by guards
+template <class TRecord>
+class ReclamationRecords
+{
+public:
+    ReclamationRecords() noexcept;
+    ReclamationRecords(const ReclamationRecords&) = delete;
+    ReclamationRecords(ReclamationRecords&&) = delete;
+    ~ReclamationRecords();
+
+    ReclamationRecords& operator=(const ReclamationRecords&) = delete;
+    ReclamationRecords& operator=(ReclamationRecords&&) = delete;
+
+    TRecord* head() const noexcept { return _head.load(std::memory_order_acquire); }
+    size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+    // Acquire the record for exclusive usage by the current thread
+    TRecord* Acquire();
+    // Try to acquire the given record
+    static bool TryAcquire(TRecord* record) noexcept;
+    // Release the acquired record
+    static void Release(TRecord* record) noexcept { record->active.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<TRecord*> _head;
+    std::atomic<size_t> _size;
+    const uint64_t _id;
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Hazard pointers memory reclamation domain
+/*!
+    Hazard pointers domain protects nodes of lock-free data structures from
+    being freed while other threads still access them. Reader publishes the
+    node pointer in one of its guard hazard slots with Protect() method and
+    writer retires unlinked nodes with Retire() method. Retired nodes are freed
+    by a scan once none of the hazard slots points to them.
+
+    Each guard owns a thread record with SLOTS hazard slots and a list of
+    retired nodes. The list is scanned when it exceeds the threshold, which
+    grows with the count of records, so the count of retired but not yet freed
+    nodes is bounded by records * (threshold + records * SLOTS).
+
+    Nodes are created and finally freed with the given memory manager. Calls
+    to the memory manager are serialized by the domain, so memory managers
+    which are not thread-safe (e.g. PoolMemoryManager) could be used.
+
+    Protect() method uses the light asymmetric fence instead of the full
+    fence, the scan issues the heavy one (see AsymmetricFence).
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Hazard_pointer
+*/
+template <class TMemoryManager = DefaultMemoryManager>
+class HazardPointers
+{
+    struct Record;
+
+public:
+    //! Count of hazard slots in each guard
+    static const size_t SLOTS = 4;
+
+    //! Hazard pointers guard
+    /*!
+        Guard binds the current thread to a thread record of the domain, so
+        it should be created on the stack for the lock-free operation and must
+        not be shared with other threads.
+
+        Not thread-safe.
+    */
+    class Guard
+    {
+    public:
+        //! Acquire a thread record of the given hazard pointers domain
+        /*!
+            \param domain - Hazard pointers domain
+        */
+        explicit Guard(HazardPointers& domain);
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard();
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        //! Protect the pointer loaded from the given atomic source
+        /*!
+            Publishes the loaded pointer in the hazard slot and validates
+            that the source was not changed in the meantime.
+
+            \param index - Hazard slot index in range [0, SLOTS)
+            \param source - Atomic source of the pointer
+            \return Protected pointer (could be nullptr)
+        */
+        template <typename T>
+        T* Protect(size_t index, const std::atomic<T*>& source) noexcept;
+        //! Publish the pointer which is known to be alive in the hazard slot
+        /*!
+            \param index - Hazard slot index in range [0, SLOTS)
+            \param ptr - Pointer to protect
+        */
+        void Set(size_t index, const void* ptr) noexcept;
+        //! Clear the hazard slot
+        /*!
+            \param index - Hazard slot index in range [0, SLOTS)
+        */
+        void Clear(size_t index) noexcept { Set(index, nullptr); }
+
+        //! Retire the node unlinked from the data structure
+        /*!
+            The node will be destroyed and freed with the domain memory
+            manager once no hazard slot points to it.
+
+            \param ptr - Pointer to the retired node
+        */
+        template <typename T>
+        void Retire(T* ptr);
+
+        //! Free retired nodes of the guard which are not protected by any hazard slot
+        void Reclaim();
+
+    private:
+        HazardPointers& _domain;
+        Record* _record;
+    };
+
+    //! Initialize hazard pointers domain with a given memory manager
+    /*!
+        \param manager - Nodes memory manager
+        \param threshold - Minimal count of retired nodes of the guard to start the scan (default is 64)
+    */
+    explicit HazardPointers(TMemoryManager& manager, size_t threshold = 64);
+    HazardPointers(const HazardPointers&) = delete;
+    HazardPointers(HazardPointers&&) = delete;
+    ~HazardPointers();
+
+    HazardPointers& operator=(const HazardPointers&) = delete;
+    HazardPointers& operator=(HazardPointers&&) = delete;
+
+    //! Get the nodes memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+    //! Get the count of thread records
+    size_t records() const noexcept { return _records.size(); }
+    //! Get the count of retired but not yet freed nodes
+    size_t retired() const noexcept { return _retired.load(std::memory_order_relaxed); }
+
+    //! Create a new node with the domain memory manager
+    /*!
+        \param args - Arguments to initialize the created node with
+        \return Pointer to the created node
+    */
+    template <typename T, class... Args>
+    T* Create(Args&&... args);
+    //! Destroy the node which was never published to other threads
+    /*!
+        \param ptr - Pointer to the node
+    */
+    template <typename T>
+    void Destroy(T* ptr);
+
+    //! Retire the node unlinked from the data structure with a temporary guard
+    /*!
+        \param ptr - Pointer to the retired node
+    */
+    template <typename T>
+    void Retire(T* ptr) { Guard guard(*this); guard.Retire(ptr); }
+
+    //! Free retired nodes of all idle thread records which are not protected by any hazard slot
+    void Reclaim();
+
+private:
+    typedef Internals::ReclamationNode<TMemoryManager> Node;
+    typedef char cache_line_pad[128];
+
+    struct Record
+    {
+        std::atomic<bool> active;
+        Record* next;
+        std::atomic<const void*> hazards[SLOTS];
+        std::vector<Node> retired;
+        cache_line_pad pad;
+
+        Record() : active(false), next(nullptr) { for (auto& hazard : hazards) hazard.store(nullptr, std::memory_order_relaxed); }
+    };
+
+    TMemoryManager& _manager;
+    SpinLock _lock;
+    const size_t _threshold;
+    std::atomic<size_t> _retired;
+    Internals::ReclamationRecords<Record> _records;
+
+    //! Free retired nodes of the given record which are not protected by any hazard slot
+    void Scan(Record* record);
+
+    template <typename T>
+    static void Delete(void* ptr, TMemoryManager& manager, SpinLock& lock);
+};
+
+//! Epoch-based memory reclamation domain
+/*!
+    Epoch-based reclamation domain protects nodes of lock-free data
+    structures from being freed while other threads still access them. Each
+    lock-free operation is performed under the guard which pins the current
+    global epoch. Retired nodes are appended to the deferred free list of the
+    guard thread record tagged with the current epoch.
+
+    The global epoch is advanced when all pinned guards have observed it, and
+    nodes retired two epochs ago are freed in batches, because no thread can
+    reference them anymore. Reading is cheaper than with hazard pointers (no
+    per-pointer publication), but a stalled guard delays reclamation of all
+    retired nodes.
+
+    Nodes are created and finally freed with the given memory manager. Calls
+    to the memory manager are serialized by the domain, so memory managers
+    which are not thread-safe (e.g. PoolMemoryManager) could be used.
+
+    Guard pins the epoch with the light asymmetric fence instead of the
+    full fence, the epoch advance issues the heavy one (see AsymmetricFence).
+
+    Thread-safe.
+
+    https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf
+*/
+template <class TMemoryManager = DefaultMemoryManager>
+class EpochReclamation
+{
+    struct Record;
+
+public:
+    //! Epoch-based reclamation guard
+    /*!
+        Guard pins the current global epoch for the lifetime of the lock-free
+        operation, so it should be created on the stack and must not be shared
+        with other threads.
+
+        Not thread-safe.
+    */
+    class Guard
+    {
+    public:
+        //! Pin the current epoch of the given epoch-based reclamation domain
+        /*!
+            \param domain - Epoch-based reclamation domain
+        */
+        explicit Guard(EpochReclamation& domain);
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard();
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        //! Get the pinned epoch
+        uint64_t epoch() const noexcept { return _epoch; }
+
+        //! Retire the node unlinked from the data structure
+        /*!
+            The node will be destroyed and freed with the domain memory
+            manager after the grace period of two epochs.
+
+            \param ptr - Pointer to the retired node
+        */
+        template <typename T>
+        void Retire(T* ptr);
+
+        //! Try to advance the global epoch and free retired nodes of the guard with the passed grace period
+        void Reclaim();
+
+    private:
+        EpochReclamation& _domain;
+        Record* _record;
+        uint64_t _epoch;
+    };
+
+    //! Initialize epoch-based reclamation domain with a given memory manager
+    /*!
+        \param manager - Nodes memory manager
+        \param batch - Count of retired nodes of the guard to start the reclamation (default is 64)
+    */
+    explicit EpochReclamation(TMemoryManager& manager, size_t batch = 64);
+    EpochReclamation(const EpochReclamation&) = delete;
+    EpochReclamation(EpochReclamation&&) = delete;
+    ~EpochReclamation();
+
+    EpochReclamation& operator=(const EpochReclamation&) = delete;
+    EpochReclamation& operator=(EpochReclamation&&) = delete;
+
+    //! Get the nodes memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+    //! Get the current global epoch
+    uint64_t epoch() const noexcept { return _epoch.load(std::memory_order_acquire); }
+    //! Get the count of thread records
+    size_t records() const noexcept { return _records.size(); }
+    //! Get the count of retired but not yet freed nodes
+    size_t retired() const noexcept { return _retired.load(std::memory_order_relaxed); }
+
+    //! Create a new node with the domain memory manager
+    /*!
+        \param args - Arguments to initialize the created node with
+        \return Pointer to the created node
+    */
+    template <typename T, class... Args>
+    T* Create(Args&&... args);
+    //! Destroy the node which was never published to other threads
+    /*!
+        \param ptr - Pointer to the node
+    */
+    template <typename T>
+    void Destroy(T* ptr);
+
+    //! Retire the node unlinked from the data structure with a temporary guard
+    /*!
+        \param ptr - Pointer to the retired node
+    */
+    template <typename T>
+    void Retire(T* ptr) { Guard guard(*this); guard.Retire(ptr); }
+
+    //! Try to advance the global epoch
+    /*!
+        \return 'true' if the global epoch was advanced, 'false' if some guard has not observed the current epoch yet
+    */
+    bool TryAdvance() noexcept;
+
+    //! Try to advance the global epoch and free retired nodes of all idle thread records with the passed grace period
+    void Reclaim();
+
+private:
+    typedef Internals::ReclamationNode<TMemoryManager> Node;
+    typedef char cache_line_pad[128];
+
+    struct Record
+    {
+        std::atomic<bool> active;
+        Record* next;
+        // Pinned epoch shifted left by one with the lowest bit set, or zero if the record is not pinned
+        std::atomic<uint64_t> pinned;
+        std::vector<Node> retired;
+        cache_line_pad pad;
+
+        Record() : active(false), next(nullptr), pinned(0) {}
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint64_t> _epoch;
+    cache_line_pad _pad1;
+    TMemoryManager& _manager;
+    SpinLock _lock;
+    const size_t _batch;
+    std::atomic<size_t> _retired;
+    Internals::ReclamationRecords<Record> _records;
+
+    //! Free retired nodes of the given record with the passed grace period
+    void Collect(Record* record);
+
+    template <typename T>
+    static void Delete(void* ptr, TMemoryManager& manager, SpinLock& lock);
+};
+
+/*! \example threads_memory_reclamation.cpp Safe memory reclamation example */
+
+} // namespace CppCommon
+
+#include "memory_reclamation.inl"
+
+#endif // CPPCOMMON_THREADS_MEMORY_RECLAMATION_H
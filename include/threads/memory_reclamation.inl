@@ -0,0 +1,400 @@
+/*!
+    \file memory_reclamation.inl
+    \brief Safe memory reclamation (hazard pointers and epoch-based reclamation) inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline uint64_t ReclamationDomainId() noexcept
+{
+    static std::atomic<uint64_t> counter(0);
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+template <class TRecord>
+inline ReclamationRecords<TRecord>::ReclamationRecords() noexcept : _head(nullptr), _size(0), _id(ReclamationDomainId())
+{
+}
+
+template <class TRecord>
+inline ReclamationRecords<TRecord>::~ReclamationRecords()
+{
+    TRecord* record = _head.load(std::memory_order_acquire);
+    while (record != nullptr)
+    {
+        TRecord* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+template <class TRecord>
+inline bool ReclamationRecords<TRecord>::TryAcquire(TRecord* record) noexcept
+{
+    return !record->active.load(std::memory_order_relaxed) && !record->active.exchange(true, std::memory_order_acquire);
+}
+
+template <class TRecord>
+inline TRecord* ReclamationRecords<TRecord>::Acquire()
+{
+    // Each thread tries the record it used last time first
+    thread_local struct { uint64_t id; TRecord* record; } hint = { 0, nullptr };
+    if ((hint.id == _id) && TryAcquire(hint.record))
+        return hint.record;
+
+    // Try to acquire any idle record
+    TRecord* record = _head.load(std::memory_order_acquire);
+    while ((record != nullptr) && !TryAcquire(record))
+        record = record->next;
+
+    // Register a new record
+    if (record == nullptr)
+    {
+        record = new TRecord();
+        record->active.store(true, std::memory_order_relaxed);
+        TRecord* head = _head.load(std::memory_order_relaxed);
+        do
+        {
+            record->next = head;
+        } while (!_head.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        _size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    hint.id = _id;
+    hint.record = record;
+    return record;
+}
+
+} // namespace Internals
+//! @endcond
+
+template <class TMemoryManager>
+inline HazardPointers<TMemoryManager>::Guard::Guard(HazardPointers& domain) : _domain(domain), _record(domain._records.Acquire())
+{
+}
+
+template <class TMemoryManager>
+inline HazardPointers<TMemoryManager>::Guard::~Guard()
+{
+    for (auto& hazard : _record->hazards)
+        hazard.store(nullptr, std::memory_order_release);
+    Internals::ReclamationRecords<Record>::Release(_record);
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline T* HazardPointers<TMemoryManager>::Guard::Protect(size_t index, const std::atomic<T*>& source) noexcept
+{
+    assert((index < SLOTS) && "Hazard slot index is out of bounds!");
+
+    T* ptr = source.load(std::memory_order_acquire);
+    for (;;)
+    {
+        // Publish the pointer and validate it is still reachable from the source.
+        // Light fence pairs with the heavy fence of the scan
+        _record->hazards[index].store(ptr, std::memory_order_relaxed);
+        AsymmetricFence::Light();
+        T* current = source.load(std::memory_order_acquire);
+        if (current == ptr)
+            return ptr;
+        ptr = current;
+    }
+}
+
+template <class TMemoryManager>
+inline void HazardPointers<TMemoryManager>::Guard::Set(size_t index, const void* ptr) noexcept
+{
+    assert((index < SLOTS) && "Hazard slot index is out of bounds!");
+
+    _record->hazards[index].store(ptr, std::memory_order_release);
+    AsymmetricFence::Light();
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline void HazardPointers<TMemoryManager>::Guard::Retire(T* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    _record->retired.push_back(Node{ ptr, &HazardPointers::template Delete<T>, 0 });
+    _domain._retired.fetch_add(1, std::memory_order_relaxed);
+
+    // Scan retired nodes when the bounded threshold is exceeded
+    if (_record->retired.size() >= std::max(_domain._threshold, 2 * SLOTS * _domain._records.size()))
+        _domain.Scan(_record);
+}
+
+template <class TMemoryManager>
+inline void HazardPointers<TMemoryManager>::Guard::Reclaim()
+{
+    _domain.Scan(_record);
+}
+
+template <class TMemoryManager>
+inline HazardPointers<TMemoryManager>::HazardPointers(TMemoryManager& manager, size_t threshold)
+    : _manager(manager), _threshold(std::max(threshold, (size_t)1)), _retired(0)
+{
+    AsymmetricFence::Initialize();
+}
+
+template <class TMemoryManager>
+inline HazardPointers<TMemoryManager>::~HazardPointers()
+{
+    // Free all retired nodes, no guards should exist at this point
+    for (Record* record = _records.head(); record != nullptr; record = record->next)
+    {
+        assert(!record->active.load(std::memory_order_acquire) && "Hazard pointers domain is destroyed with active guards!");
+        for (auto& node : record->retired)
+            node.deleter(node.ptr, _manager, _lock);
+        record->retired.clear();
+    }
+}
+
+template <class TMemoryManager>
+template <typename T, class... Args>
+inline T* HazardPointers<TMemoryManager>::Create(Args&&... args)
+{
+    void* ptr;
+    {
+        Locker<SpinLock> locker(_lock);
+        ptr = _manager.malloc(sizeof(T), alignof(T));
+    }
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    try
+    {
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        Locker<SpinLock> locker(_lock);
+        _manager.free(ptr, sizeof(T));
+        throw;
+    }
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline void HazardPointers<TMemoryManager>::Destroy(T* ptr)
+{
+    if (ptr != nullptr)
+        Delete<T>(ptr, _manager, _lock);
+}
+
+template <class TMemoryManager>
+inline void HazardPointers<TMemoryManager>::Reclaim()
+{
+    for (Record* record = _records.head(); record != nullptr; record = record->next)
+    {
+        if (Internals::ReclamationRecords<Record>::TryAcquire(record))
+        {
+            Scan(record);
+            Internals::ReclamationRecords<Record>::Release(record);
+        }
+    }
+}
+
+template <class TMemoryManager>
+inline void HazardPointers<TMemoryManager>::Scan(Record* record)
+{
+    if (record->retired.empty())
+        return;
+
+    // Collect all published hazard pointers after the heavy fence which pairs with light fences of guards
+    AsymmetricFence::Heavy();
+    std::vector<const void*> hazards;
+    hazards.reserve(SLOTS * _records.size());
+    for (Record* current = _records.head(); current != nullptr; current = current->next)
+    {
+        for (auto& hazard : current->hazards)
+        {
+            const void* ptr = hazard.load(std::memory_order_acquire);
+            if (ptr != nullptr)
+                hazards.push_back(ptr);
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    // Free retired nodes which are not protected
+    size_t kept = 0;
+    for (auto& node : record->retired)
+    {
+        if (std::binary_search(hazards.begin(), hazards.end(), (const void*)node.ptr))
+            record->retired[kept++] = node;
+        else
+            node.deleter(node.ptr, _manager, _lock);
+    }
+    _retired.fetch_sub(record->retired.size() - kept, std::memory_order_relaxed);
+    record->retired.resize(kept);
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline void HazardPointers<TMemoryManager>::Delete(void* ptr, TMemoryManager& manager, SpinLock& lock)
+{
+    static_cast<T*>(ptr)->~T();
+    Locker<SpinLock> locker(lock);
+    manager.free(ptr, sizeof(T));
+}
+
+template <class TMemoryManager>
+inline EpochReclamation<TMemoryManager>::Guard::Guard(EpochReclamation& domain) : _domain(domain), _record(domain._records.Acquire())
+{
+    // Pin the current global epoch. Light fence pairs with the heavy fence of the epoch advance
+    _epoch = _domain._epoch.load(std::memory_order_acquire);
+    _record->pinned.store((_epoch << 1) | 1, std::memory_order_relaxed);
+    AsymmetricFence::Light();
+}
+
+template <class TMemoryManager>
+inline EpochReclamation<TMemoryManager>::Guard::~Guard()
+{
+    // Unpin the epoch
+    _record->pinned.store(0, std::memory_order_release);
+    Internals::ReclamationRecords<Record>::Release(_record);
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline void EpochReclamation<TMemoryManager>::Guard::Retire(T* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    _record->retired.push_back(Node{ ptr, &EpochReclamation::template Delete<T>, _domain._epoch.load(std::memory_order_seq_cst) });
+    _domain._retired.fetch_add(1, std::memory_order_relaxed);
+
+    // Reclaim retired nodes in batches
+    if (_record->retired.size() >= _domain._batch)
+        Reclaim();
+}
+
+template <class TMemoryManager>
+inline void EpochReclamation<TMemoryManager>::Guard::Reclaim()
+{
+    _domain.TryAdvance();
+    _domain.Collect(_record);
+}
+
+template <class TMemoryManager>
+inline EpochReclamation<TMemoryManager>::EpochReclamation(TMemoryManager& manager, size_t batch)
+    : _epoch(1), _manager(manager), _batch(std::max(batch, (size_t)1)), _retired(0)
+{
+    AsymmetricFence::Initialize();
+}
+
+template <class TMemoryManager>
+inline EpochReclamation<TMemoryManager>::~EpochReclamation()
+{
+    // Free all retired nodes, no guards should exist at this point
+    for (Record* record = _records.head(); record != nullptr; record = record->next)
+    {
+        assert(!record->active.load(std::memory_order_acquire) && "Epoch-based reclamation domain is destroyed with active guards!");
+        for (auto& node : record->retired)
+            node.deleter(node.ptr, _manager, _lock);
+        record->retired.clear();
+    }
+}
+
+template <class TMemoryManager>
+template <typename T, class... Args>
+inline T* EpochReclamation<TMemoryManager>::Create(Args&&... args)
+{
+    void* ptr;
+    {
+        Locker<SpinLock> locker(_lock);
+        ptr = _manager.malloc(sizeof(T), alignof(T));
+    }
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    try
+    {
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        Locker<SpinLock> locker(_lock);
+        _manager.free(ptr, sizeof(T));
+        throw;
+    }
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline void EpochReclamation<TMemoryManager>::Destroy(T* ptr)
+{
+    if (ptr != nullptr)
+        Delete<T>(ptr, _manager, _lock);
+}
+
+template <class TMemoryManager>
+inline bool EpochReclamation<TMemoryManager>::TryAdvance() noexcept
+{
+    uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+
+    // Check if all pinned guards have observed the current epoch after the heavy fence which pairs with light fences of guards
+    AsymmetricFence::Heavy();
+    for (Record* record = _records.head(); record != nullptr; record = record->next)
+    {
+        uint64_t pinned = record->pinned.load(std::memory_order_acquire);
+        if (((pinned & 1) != 0) && ((pinned >> 1) != epoch))
+            return false;
+    }
+
+    return _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+template <class TMemoryManager>
+inline void EpochReclamation<TMemoryManager>::Reclaim()
+{
+    TryAdvance();
+
+    for (Record* record = _records.head(); record != nullptr; record = record->next)
+    {
+        if (Internals::ReclamationRecords<Record>::TryAcquire(record))
+        {
+            Collect(record);
+            Internals::ReclamationRecords<Record>::Release(record);
+        }
+    }
+}
+
+template <class TMemoryManager>
+inline void EpochReclamation<TMemoryManager>::Collect(Record* record)
+{
+    uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+
+    // Retired nodes are ordered by the epoch, so free the prefix with the passed grace period
+    size_t count = 0;
+    while ((count < record->retired.size()) && ((record->retired[count].epoch + 2) <= epoch))
+    {
+        Node& node = record->retired[count++];
+        node.deleter(node.ptr, _manager, _lock);
+    }
+
+    if (count > 0)
+    {
+        record->retired.erase(record->retired.begin(), record->retired.begin() + count);
+        _retired.fetch_sub(count, std::memory_order_relaxed);
+    }
+}
+
+template <class TMemoryManager>
+template <typename T>
+inline void EpochReclamation<TMemoryManager>::Delete(void* ptr, TMemoryManager& manager, SpinLock& lock)
+{
+    static_cast<T*>(ptr)->~T();
+    Locker<SpinLock> locker(lock);
+    manager.free(ptr, sizeof(T));
+}
+
+} // namespace CppCommon
@@ -9,10 +9,15 @@
 #ifndef CPPCOMMON_THREADS_MPMC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_MPMC_RING_QUEUE_H
 
+#include "memory/cache_padded.h"
+#include "threads/wait_strategy.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
 #include <utility>
 
 namespace CppCommon {
@@ -24,12 +29,18 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    Enqueue() and Dequeue() never block. EnqueueWait() and DequeueWait() block
+    the calling thread with the pluggable wait strategy (SpinWaitStrategy,
+    YieldWaitStrategy, BlockingWaitStrategy) while the ring queue is full or
+    empty. The lock-free fast path is kept and the strategy is notified after
+    each successful operation, which costs nothing for spin and yield ones.
+
     Thread-safe.
 
     C++ implementation of Dmitry Vyukov's non-intrusive lock free unbound MPSC queue
     http://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
 */
-template<typename T>
+template<typename T, class TWaitStrategy = SpinWaitStrategy>
 class MPMCRingQueue
 {
 public:
@@ -87,6 +98,60 @@ public:
     */
     bool Dequeue(T& item);
 
+    //! Enqueue a range of items into the ring queue (multiple producers threads method)
+    /*!
+        Items will be copied into the ring queue. Contiguous range of slots is claimed with one atomic operation, so the range must be a forward iterator range.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param last - Iterator to the item after the last one to enqueue
+        \return Count of successfully enqueued items (could be less than the range size if the ring queue is full)
+    */
+    template <class InputIterator>
+    size_t EnqueueBulk(InputIterator first, InputIterator last);
+    //! Dequeue a range of items from the ring queue (multiple consumers threads method)
+    /*!
+        Items will be moved from the ring queue into the given output iterator. Contiguous range of slots is claimed with one atomic operation.
+
+        Will not block.
+
+        \param out - Output iterator to dequeue items into
+        \param max - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (0 if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator out, size_t max);
+
+    //! Enqueue an item into the ring queue and wait while the ring queue is full (multiple producers threads method)
+    /*!
+        The item will be copied into the ring queue.
+
+        Will block with the wait strategy.
+
+        \param item - Item to enqueue
+    */
+    void EnqueueWait(const T& item);
+    //! Enqueue an item into the ring queue and wait while the ring queue is full (multiple producers threads method)
+    /*!
+        The item will be moved into the ring queue.
+
+        Will block with the wait strategy.
+
+        \param item - Item to enqueue
+    */
+    void EnqueueWait(T&& item);
+
+    //! Dequeue an item from the ring queue and wait while the ring queue is empty (multiple consumers threads method)
+    /*!
+        The item will be moved from the ring queue.
+
+        Will block with the wait strategy.
+
+        \param item - Item to dequeue
+    */
+    void DequeueWait(T& item);
+
 private:
     struct Node
     {
@@ -94,18 +159,14 @@ private:
         T value;
     };
 
-    typedef char cache_line_pad[128];
-
-    cache_line_pad _pad0;
-    const size_t _capacity;
+    alignas(hardware_destructive_interference_size) const size_t _capacity;
     const size_t _mask;
     Node* const _buffer;
 
-    cache_line_pad _pad1;
-    std::atomic<size_t> _head;
-    cache_line_pad _pad2;
-    std::atomic<size_t> _tail;
-    cache_line_pad _pad3;
+    CachePadded<std::atomic<size_t>> _head;
+    CachePadded<std::atomic<size_t>> _tail;
+    CachePadded<TWaitStrategy> _not_empty;
+    CachePadded<TWaitStrategy> _not_full;
 };
 
 /*! \example threads_mpmc_ring_queue.cpp Multiple producers / multiple consumers wait-free ring queue example */
@@ -8,42 +8,37 @@
 
 namespace CppCommon {
 
-template<typename T>
-inline MPMCRingQueue<T>::MPMCRingQueue(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new Node[capacity]), _head(0), _tail(0)
+template<typename T, class TWaitStrategy>
+inline MPMCRingQueue<T, TWaitStrategy>::MPMCRingQueue(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new Node[capacity]), _head(0), _tail(0)
 {
     assert((capacity > 1) && "Ring queue capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
 
-    memset(_pad0, 0, sizeof(cache_line_pad));
-    memset(_pad1, 0, sizeof(cache_line_pad));
-    memset(_pad2, 0, sizeof(cache_line_pad));
-    memset(_pad3, 0, sizeof(cache_line_pad));
-
     // Populate the sequence initial values
     for (size_t i = 0; i < capacity; ++i)
         _buffer[i].sequence.store(i, std::memory_order_relaxed);
 }
 
-template<typename T>
-inline size_t MPMCRingQueue<T>::size() const noexcept
+template<typename T, class TWaitStrategy>
+inline size_t MPMCRingQueue<T, TWaitStrategy>::size() const noexcept
 {
-    const size_t head = _head.load(std::memory_order_acquire);
-    const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t head = _head->load(std::memory_order_acquire);
+    const size_t tail = _tail->load(std::memory_order_acquire);
 
     return head - tail;
 }
 
-template<typename T>
-inline bool MPMCRingQueue<T>::Enqueue(const T& item)
+template<typename T, class TWaitStrategy>
+inline bool MPMCRingQueue<T, TWaitStrategy>::Enqueue(const T& item)
 {
     T temp = item;
     return Enqueue(std::forward<T>(temp));
 }
 
-template<typename T>
-inline bool MPMCRingQueue<T>::Enqueue(T&& item)
+template<typename T, class TWaitStrategy>
+inline bool MPMCRingQueue<T, TWaitStrategy>::Enqueue(T&& item)
 {
-    size_t head_sequence = _head.load(std::memory_order_relaxed);
+    size_t head_sequence = _head->load(std::memory_order_relaxed);
 
     for (;;)
     {
@@ -58,13 +53,16 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
             // as we last checked then that means someone beat us to
             // the punch weak compare is faster, but can return spurious
             // results which in this instance is OK, because it's in the loop
-            if (_head.compare_exchange_weak(head_sequence, head_sequence + 1, std::memory_order_relaxed))
+            if (_head->compare_exchange_weak(head_sequence, head_sequence + 1, std::memory_order_relaxed))
             {
                 // Store the item value
                 node->value = std::move(item);
 
                 // Increment the sequence so that the tail knows it's accessible
                 node->sequence.store(head_sequence + 1, std::memory_order_release);
+
+                // Notify waiting consumers
+                _not_empty->Notify();
                 return true;
             }
         }
@@ -77,7 +75,7 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
         else
         {
             // Under normal circumstances this branch should never be taken
-            head_sequence = _head.load(std::memory_order_relaxed);
+            head_sequence = _head->load(std::memory_order_relaxed);
         }
     }
 
@@ -85,10 +83,10 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
     return false;
 }
 
-template<typename T>
-inline bool MPMCRingQueue<T>::Dequeue(T& item)
+template<typename T, class TWaitStrategy>
+inline bool MPMCRingQueue<T, TWaitStrategy>::Dequeue(T& item)
 {
-    size_t tail_sequence = _tail.load(std::memory_order_relaxed);
+    size_t tail_sequence = _tail->load(std::memory_order_relaxed);
 
     for (;;)
     {
@@ -103,13 +101,16 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
             // as we last checked then that means someone beat us to
             // the punch weak compare is faster, but can return spurious
             // results which in this instance is OK, because it's in the loop
-            if (_tail.compare_exchange_weak(tail_sequence, tail_sequence + 1, std::memory_order_relaxed))
+            if (_tail->compare_exchange_weak(tail_sequence, tail_sequence + 1, std::memory_order_relaxed))
             {
                 // Get the item value
                 item = std::move(node->value);
 
                 // Set the sequence to what the head sequence should be next time around
                 node->sequence.store(tail_sequence + _mask + 1, std::memory_order_release);
+
+                // Notify waiting producers
+                _not_full->Notify();
                 return true;
             }
         }
@@ -121,7 +122,7 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
         else
         {
             // Under normal circumstances this branch should never be taken
-            tail_sequence = _tail.load(std::memory_order_relaxed);
+            tail_sequence = _tail->load(std::memory_order_relaxed);
         }
     }
 
@@ -129,4 +130,144 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
     return false;
 }
 
+template<typename T, class TWaitStrategy>
+template <class InputIterator>
+inline size_t MPMCRingQueue<T, TWaitStrategy>::EnqueueBulk(InputIterator first, InputIterator last)
+{
+    const size_t size = (size_t)std::distance(first, last);
+    if (size == 0)
+        return 0;
+
+    size_t head_sequence = _head->load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count contiguous empty slots starting from the head
+        size_t count = 0;
+        for (; count < size; ++count)
+        {
+            size_t node_sequence = _buffer[(head_sequence + count) & _mask].sequence.load(std::memory_order_acquire);
+            if (node_sequence != (head_sequence + count))
+                break;
+        }
+
+        if (count == 0)
+        {
+            int64_t diff = (int64_t)_buffer[head_sequence & _mask].sequence.load(std::memory_order_acquire) - (int64_t)head_sequence;
+
+            // If node sequence is less than head sequence then it means this slot is full
+            // and therefore buffer is full
+            if (diff < 0)
+                return 0;
+
+            // Someone beat us to the punch
+            head_sequence = _head->load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Claim all empty slots by moving head once
+        if (_head->compare_exchange_weak(head_sequence, head_sequence + count, std::memory_order_relaxed))
+        {
+            for (size_t i = 0; i < count; ++i, ++first)
+            {
+                Node* node = &_buffer[(head_sequence + i) & _mask];
+
+                // Store the item value
+                node->value = *first;
+
+                // Increment the sequence so that the tail knows it's accessible
+                node->sequence.store(head_sequence + i + 1, std::memory_order_release);
+            }
+
+            // Notify waiting consumers
+            _not_empty->Notify();
+            return count;
+        }
+    }
+}
+
+template<typename T, class TWaitStrategy>
+template <class OutputIterator>
+inline size_t MPMCRingQueue<T, TWaitStrategy>::DequeueBulk(OutputIterator out, size_t max)
+{
+    if (max == 0)
+        return 0;
+
+    size_t tail_sequence = _tail->load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count contiguous filled slots starting from the tail
+        size_t count = 0;
+        for (; count < max; ++count)
+        {
+            size_t node_sequence = _buffer[(tail_sequence + count) & _mask].sequence.load(std::memory_order_acquire);
+            if (node_sequence != (tail_sequence + count + 1))
+                break;
+        }
+
+        if (count == 0)
+        {
+            int64_t diff = (int64_t)_buffer[tail_sequence & _mask].sequence.load(std::memory_order_acquire) - (int64_t)(tail_sequence + 1);
+
+            // If node sequence is less than tail sequence then it means this slot is empty
+            // and therefore buffer is empty
+            if (diff < 0)
+                return 0;
+
+            // Someone beat us to the punch
+            tail_sequence = _tail->load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Claim all filled slots by moving tail once
+        if (_tail->compare_exchange_weak(tail_sequence, tail_sequence + count, std::memory_order_relaxed))
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                Node* node = &_buffer[(tail_sequence + i) & _mask];
+
+                // Get the item value
+                *out++ = std::move(node->value);
+
+                // Set the sequence to what the head sequence should be next time around
+                node->sequence.store(tail_sequence + i + _mask + 1, std::memory_order_release);
+            }
+
+            // Notify waiting producers
+            _not_full->Notify();
+            return count;
+        }
+    }
+}
+
+template<typename T, class TWaitStrategy>
+inline void MPMCRingQueue<T, TWaitStrategy>::EnqueueWait(const T& item)
+{
+    T temp = item;
+    EnqueueWait(std::forward<T>(temp));
+}
+
+template<typename T, class TWaitStrategy>
+inline void MPMCRingQueue<T, TWaitStrategy>::EnqueueWait(T&& item)
+{
+    // Fast path without waiting
+    if (Enqueue(std::forward<T>(item)))
+        return;
+
+    // Wait while the ring queue is full
+    _not_full->Wait([this, &item]() { return Enqueue(std::forward<T>(item)); });
+}
+
+template<typename T, class TWaitStrategy>
+inline void MPMCRingQueue<T, TWaitStrategy>::DequeueWait(T& item)
+{
+    // Fast path without waiting
+    if (Dequeue(item))
+        return;
+
+    // Wait while the ring queue is empty
+    _not_empty->Wait([this, &item]() { return Dequeue(item); });
+}
+
 } // namespace CppCommon
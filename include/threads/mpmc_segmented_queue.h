@@ -0,0 +1,203 @@
+/*!
+    \file mpmc_segmented_queue.h
+    \brief Multiple producers / multiple consumers lock-free segmented queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MPMC_SEGMENTED_QUEUE_H
+#define CPPCOMMON_THREADS_MPMC_SEGMENTED_QUEUE_H
+
+#include "threads/spin_lock.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers lock-free segmented queue
+/*!
+    Multiple producers / multiple consumers lock-free segmented queue is an
+    unbounded queue of fixed-size array segments linked together. Producers
+    and consumers claim cells of the tail and head segments with a single
+    fetch-and-add operation, so the queue has cache behavior of the ring queue
+    and grows as the linked queue. Consumer which outruns the producer of the
+    claimed cell abandons it and the producer retries with the next cell.
+
+    Drained segments are reclaimed after the grace period when all threads
+    that could observe them have left the queue operation (epoch-based
+    reclamation with per-thread slots). A few reclaimed segments are kept
+    for reuse, so steady-state operation does no heap allocations.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    C++ implementation of Pedro Ramalhete and Andreia Correia FAAArrayQueue
+    http://concurrencyfreaks.blogspot.com/2016/11/faaarrayqueue-mpmc-lock-free-queue-part.html
+*/
+template<typename T>
+class MPMCSegmentedQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param segment - Count of cells in each segment (default is 1024)
+        \param spare - Count of spare segments kept for reuse (default is 16)
+    */
+    explicit MPMCSegmentedQueue(size_t segment = 1024, size_t spare = 16);
+    MPMCSegmentedQueue(const MPMCSegmentedQueue&) = delete;
+    MPMCSegmentedQueue(MPMCSegmentedQueue&&) = delete;
+    ~MPMCSegmentedQueue();
+
+    MPMCSegmentedQueue& operator=(const MPMCSegmentedQueue&) = delete;
+    MPMCSegmentedQueue& operator=(MPMCSegmentedQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is queue empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get the count of cells in each segment
+    size_t segment() const noexcept { return _segment; }
+    //! Get the count of allocated segments (linked, retired and spare ones)
+    size_t segments() const noexcept { return _segments.load(std::memory_order_relaxed); }
+    //! Get queue size
+    /*!
+        The size is approximate under concurrent operations, because abandoned
+        cells are counted as occupied ones.
+    */
+    size_t size() const noexcept;
+
+    //! Enqueue an item into the queue (multiple producers threads method)
+    /*!
+        The item will be copied into the queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(const T& item) { return EnqueueInternal(item); }
+    //! Enqueue an item into the queue (multiple producers threads method)
+    /*!
+        The item will be moved into the queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(T&& item) { return EnqueueInternal(std::move(item)); }
+
+    //! Dequeue an item from the queue (multiple consumers threads method)
+    /*!
+        The item will be moved from the queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the queue is empty
+    */
+    bool Dequeue(T& item);
+
+private:
+    typedef char cache_line_pad[128];
+
+    enum CellState : uint32_t { EMPTY, BUSY, FULL, TAKEN };
+
+    struct Cell
+    {
+        std::atomic<uint32_t> state;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Segment
+    {
+        std::atomic<size_t> enqueue;
+        cache_line_pad pad0;
+        std::atomic<size_t> dequeue;
+        cache_line_pad pad1;
+        std::atomic<Segment*> next;
+        Segment* link;
+        size_t index;
+        size_t epoch;
+        Cell* cells;
+    };
+
+    struct EpochSlot
+    {
+        std::atomic<size_t> threads[2];
+        cache_line_pad pad;
+
+        EpochSlot() { threads[0] = 0; threads[1] = 0; }
+    };
+
+    // RAII guard of the queue operation epoch
+    class EpochGuard
+    {
+    public:
+        explicit EpochGuard(const MPMCSegmentedQueue& queue) noexcept;
+        EpochGuard(const EpochGuard&) = delete;
+        EpochGuard(EpochGuard&&) = delete;
+        ~EpochGuard();
+
+        EpochGuard& operator=(const EpochGuard&) = delete;
+        EpochGuard& operator=(EpochGuard&&) = delete;
+
+    private:
+        EpochSlot& _slot;
+        size_t _epoch;
+    };
+
+    static const size_t SLOTS = 64;
+
+    cache_line_pad _pad0;
+    const size_t _segment;
+    const size_t _spare;
+    std::atomic<size_t> _segments;
+
+    cache_line_pad _pad1;
+    std::atomic<Segment*> _head;
+    cache_line_pad _pad2;
+    std::atomic<Segment*> _tail;
+    cache_line_pad _pad3;
+    std::atomic<size_t> _epoch;
+    cache_line_pad _pad4;
+    mutable EpochSlot _slots[SLOTS];
+
+    // Retired and spare segments
+    SpinLock _lock;
+    Segment* _retired_head;
+    Segment* _retired_tail;
+    Segment* _free;
+    size_t _free_count;
+
+    template <typename U>
+    bool EnqueueInternal(U&& item);
+
+    //! Allocate a new segment from spare segments or the heap
+    Segment* AllocateSegment(size_t index);
+    //! Release the unpublished segment into spare segments
+    void ReleaseSegment(Segment* segment);
+    //! Retire the unlinked segment until the grace period is over
+    void RetireSegment(Segment* segment);
+    //! Delete the segment and all its items
+    void DeleteSegment(Segment* segment);
+
+    static EpochSlot& slot(EpochSlot* slots) noexcept;
+};
+
+/*! \example threads_mpmc_segmented_queue.cpp Multiple producers / multiple consumers lock-free segmented queue example */
+
+} // namespace CppCommon
+
+#include "mpmc_segmented_queue.inl"
+
+#endif // CPPCOMMON_THREADS_MPMC_SEGMENTED_QUEUE_H
@@ -0,0 +1,352 @@
+/*!
+    \file mpmc_segmented_queue.inl
+    \brief Multiple producers / multiple consumers lock-free segmented queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline MPMCSegmentedQueue<T>::MPMCSegmentedQueue(size_t segment, size_t spare)
+    : _segment(segment),
+      _spare(spare),
+      _segments(0),
+      _epoch(0),
+      _retired_head(nullptr),
+      _retired_tail(nullptr),
+      _free(nullptr),
+      _free_count(0)
+{
+    assert((segment > 0) && "Segment size must be greater than zero!");
+
+    Segment* first = AllocateSegment(0);
+    if (first == nullptr)
+        throw std::bad_alloc();
+
+    _head.store(first, std::memory_order_relaxed);
+    _tail.store(first, std::memory_order_relaxed);
+}
+
+template<typename T>
+inline MPMCSegmentedQueue<T>::~MPMCSegmentedQueue()
+{
+    // Delete all linked segments with remaining items
+    Segment* segment = _head.load(std::memory_order_relaxed);
+    while (segment != nullptr)
+    {
+        Segment* next = segment->next.load(std::memory_order_relaxed);
+        DeleteSegment(segment);
+        segment = next;
+    }
+
+    // Delete all retired segments
+    while (_retired_head != nullptr)
+    {
+        Segment* next = _retired_head->link;
+        DeleteSegment(_retired_head);
+        _retired_head = next;
+    }
+
+    // Delete all spare segments
+    while (_free != nullptr)
+    {
+        Segment* next = _free->link;
+        DeleteSegment(_free);
+        _free = next;
+    }
+}
+
+template<typename T>
+inline typename MPMCSegmentedQueue<T>::EpochSlot& MPMCSegmentedQueue<T>::slot(EpochSlot* slots) noexcept
+{
+    // Each thread is bound to its own epoch slot
+    static std::atomic<size_t> counter(0);
+    thread_local size_t index = counter.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+    return slots[index];
+}
+
+template<typename T>
+inline MPMCSegmentedQueue<T>::EpochGuard::EpochGuard(const MPMCSegmentedQueue& queue) noexcept : _slot(slot(queue._slots))
+{
+    // Enter the current epoch
+    for (;;)
+    {
+        _epoch = queue._epoch.load(std::memory_order_acquire);
+        _slot.threads[_epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+        if (queue._epoch.load(std::memory_order_seq_cst) == _epoch)
+            break;
+        _slot.threads[_epoch & 1].fetch_sub(1, std::memory_order_release);
+    }
+}
+
+template<typename T>
+inline MPMCSegmentedQueue<T>::EpochGuard::~EpochGuard()
+{
+    // Leave the current epoch
+    _slot.threads[_epoch & 1].fetch_sub(1, std::memory_order_release);
+}
+
+template<typename T>
+inline size_t MPMCSegmentedQueue<T>::size() const noexcept
+{
+    EpochGuard guard(*this);
+
+    Segment* head = _head.load(std::memory_order_acquire);
+    Segment* tail = _tail.load(std::memory_order_acquire);
+
+    size_t first = head->index * _segment + std::min(head->dequeue.load(std::memory_order_acquire), _segment);
+    size_t last = tail->index * _segment + std::min(tail->enqueue.load(std::memory_order_acquire), _segment);
+    return (last > first) ? (last - first) : 0;
+}
+
+template<typename T>
+template <typename U>
+inline bool MPMCSegmentedQueue<T>::EnqueueInternal(U&& item)
+{
+    EpochGuard guard(*this);
+
+    for (;;)
+    {
+        Segment* tail = _tail.load(std::memory_order_acquire);
+
+        // Claim the next cell of the tail segment
+        size_t index = tail->enqueue.fetch_add(1, std::memory_order_acq_rel);
+        if (index < _segment)
+        {
+            Cell& cell = tail->cells[index];
+
+            // Try to occupy the cell which could be abandoned by the consumer
+            uint32_t state = EMPTY;
+            if (!cell.state.compare_exchange_strong(state, BUSY, std::memory_order_acq_rel))
+                continue;
+
+            try
+            {
+                new (cell.storage) T(std::forward<U>(item));
+            }
+            catch (...)
+            {
+                // Abandon the cell and release the waiting consumer
+                cell.state.store(TAKEN, std::memory_order_release);
+                throw;
+            }
+
+            cell.state.store(FULL, std::memory_order_release);
+            return true;
+        }
+
+        // The tail segment is full, so link the next segment
+        Segment* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            Segment* segment = AllocateSegment(tail->index + 1);
+            if (segment == nullptr)
+                return false;
+
+            if (tail->next.compare_exchange_strong(next, segment, std::memory_order_acq_rel))
+                next = segment;
+            else
+                ReleaseSegment(segment);
+        }
+
+        // Help to advance the tail segment
+        _tail.compare_exchange_strong(tail, next, std::memory_order_acq_rel);
+    }
+}
+
+template<typename T>
+inline bool MPMCSegmentedQueue<T>::Dequeue(T& item)
+{
+    EpochGuard guard(*this);
+
+    for (;;)
+    {
+        Segment* head = _head.load(std::memory_order_acquire);
+
+        size_t index = head->dequeue.load(std::memory_order_acquire);
+        if (index < _segment)
+        {
+            // Check if the queue is empty
+            if (index >= head->enqueue.load(std::memory_order_acquire))
+                return false;
+
+            // Claim the next cell of the head segment
+            index = head->dequeue.fetch_add(1, std::memory_order_acq_rel);
+            if (index < _segment)
+            {
+                Cell& cell = head->cells[index];
+
+                // Abandon the cell which producer has not arrived yet
+                uint32_t state = EMPTY;
+                if (cell.state.compare_exchange_strong(state, TAKEN, std::memory_order_acq_rel))
+                    continue;
+
+                // Wait for the producer which is writing the cell
+                while (state == BUSY)
+                {
+                    Thread::Pause();
+                    state = cell.state.load(std::memory_order_acquire);
+                }
+                if (state != FULL)
+                    continue;
+
+                T* value = (T*)cell.storage;
+                item = std::move(*value);
+                value->~T();
+                cell.state.store(TAKEN, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // The head segment is drained, so move to the next segment
+        Segment* next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+
+        // Do not let the head segment pass the tail one
+        Segment* tail = head;
+        _tail.compare_exchange_strong(tail, next, std::memory_order_acq_rel);
+
+        if (_head.compare_exchange_strong(head, next, std::memory_order_acq_rel))
+            RetireSegment(head);
+    }
+}
+
+template<typename T>
+inline typename MPMCSegmentedQueue<T>::Segment* MPMCSegmentedQueue<T>::AllocateSegment(size_t index)
+{
+    Segment* segment = nullptr;
+
+    // Try to reuse the spare segment
+    {
+        Locker<SpinLock> locker(_lock);
+        if (_free != nullptr)
+        {
+            segment = _free;
+            _free = segment->link;
+            --_free_count;
+        }
+    }
+
+    // Allocate a new segment
+    if (segment == nullptr)
+    {
+        segment = new(std::nothrow) Segment;
+        if (segment == nullptr)
+            return nullptr;
+        segment->cells = new(std::nothrow) Cell[_segment];
+        if (segment->cells == nullptr)
+        {
+            delete segment;
+            return nullptr;
+        }
+        _segments.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Reset the segment
+    segment->enqueue.store(0, std::memory_order_relaxed);
+    segment->dequeue.store(0, std::memory_order_relaxed);
+    segment->next.store(nullptr, std::memory_order_relaxed);
+    segment->link = nullptr;
+    segment->index = index;
+    segment->epoch = 0;
+    for (size_t i = 0; i < _segment; ++i)
+        segment->cells[i].state.store(EMPTY, std::memory_order_relaxed);
+
+    return segment;
+}
+
+template<typename T>
+inline void MPMCSegmentedQueue<T>::ReleaseSegment(Segment* segment)
+{
+    {
+        Locker<SpinLock> locker(_lock);
+        if (_free_count < _spare)
+        {
+            segment->link = _free;
+            _free = segment;
+            ++_free_count;
+            return;
+        }
+    }
+
+    DeleteSegment(segment);
+}
+
+template<typename T>
+inline void MPMCSegmentedQueue<T>::RetireSegment(Segment* segment)
+{
+    Segment* reclaimed = nullptr;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        // Append the segment to the retired segments list in the epoch order
+        segment->epoch = _epoch.load(std::memory_order_seq_cst);
+        segment->link = nullptr;
+        if (_retired_tail != nullptr)
+            _retired_tail->link = segment;
+        else
+            _retired_head = segment;
+        _retired_tail = segment;
+
+        // Advance the epoch if all threads have left the previous one
+        size_t epoch = _epoch.load(std::memory_order_relaxed);
+        bool quiescent = true;
+        for (auto& slot : _slots)
+        {
+            if (slot.threads[(epoch - 1) & 1].load(std::memory_order_acquire) != 0)
+            {
+                quiescent = false;
+                break;
+            }
+        }
+        if (quiescent)
+            _epoch.store(++epoch, std::memory_order_seq_cst);
+
+        // Reclaim retired segments with the passed grace period
+        while ((_retired_head != nullptr) && ((_retired_head->epoch + 2) <= epoch))
+        {
+            Segment* current = _retired_head;
+            _retired_head = current->link;
+            if (_retired_head == nullptr)
+                _retired_tail = nullptr;
+
+            if (_free_count < _spare)
+            {
+                current->link = _free;
+                _free = current;
+                ++_free_count;
+            }
+            else
+            {
+                current->link = reclaimed;
+                reclaimed = current;
+            }
+        }
+    }
+
+    // Delete reclaimed segments outside the lock
+    while (reclaimed != nullptr)
+    {
+        Segment* next = reclaimed->link;
+        DeleteSegment(reclaimed);
+        reclaimed = next;
+    }
+}
+
+template<typename T>
+inline void MPMCSegmentedQueue<T>::DeleteSegment(Segment* segment)
+{
+    // Destroy all remaining items of the segment
+    for (size_t i = 0; i < _segment; ++i)
+        if (segment->cells[i].state.load(std::memory_order_relaxed) == FULL)
+            ((T*)segment->cells[i].storage)->~T();
+
+    delete[] segment->cells;
+    delete segment;
+    _segments.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
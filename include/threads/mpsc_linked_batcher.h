@@ -12,7 +12,9 @@
 #include <atomic>
 #include <cassert>
 #include <functional>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace CppCommon {
 
@@ -22,6 +24,11 @@ namespace CppCommon {
     enqueue and batch dequeue operations. Linked batcher is a dynamically grows queue which allocates memory for each
     new node. It allows a consumer thread to process all items in queue in a batch mode.
 
+    Processed nodes are not deleted, but returned into the lock-free node freelist with a single atomic
+    operation per batch. Producer threads take the whole freelist into their thread local node caches, so
+    steady-state operation does no heap allocations. Memory of the peak load is kept for reuse until the
+    batcher is destroyed (freelist) or the producer thread is finished (thread local node cache).
+
     FIFO order is guaranteed!
 
     Thread-safe.
@@ -72,6 +79,32 @@ public:
         \return 'true' if all items were successfully handled, 'false' if the linked batcher is empty
     */
     bool Dequeue(const std::function<void(const T&)>& handler = [](const int&){});
+    //! Dequeue all items from the linked queue and visit them by rvalue (single consumer thread method)
+    /*!
+        All items in the batcher will be moved into the given handler one by one.
+        The handler is called directly, so it could be inlined.
+
+        Will not block.
+
+        \param handler - Batch handler with the signature 'void(T&& item)'
+        \return 'true' if all items were successfully handled, 'false' if the linked batcher is empty
+    */
+    template <class THandler>
+    bool Dequeue(THandler&& handler);
+
+    //! Dequeue all items from the linked queue as a contiguous span (single consumer thread method)
+    /*!
+        All items in the batcher will be moved into the internal batch buffer
+        and passed to the given handler at once. The batch buffer is reused by
+        the next calls, so there are no heap allocations in the steady state.
+
+        Will not block.
+
+        \param handler - Batch handler with the signature 'void(std::span<T> items)'
+        \return 'true' if all items were successfully handled, 'false' if the linked batcher is empty
+    */
+    template <class THandler>
+    bool DequeueBatch(THandler&& handler);
 
 private:
     struct Node
@@ -80,7 +113,25 @@ private:
         T value;
     };
 
+    // Thread local cache of free nodes
+    struct NodeCache
+    {
+        Node* nodes = nullptr;
+
+        ~NodeCache();
+    };
+
     std::atomic<Node*> _head;
+    std::atomic<Node*> _free;
+    std::vector<T> _batch;
+
+    //! Take all nodes from the linked batcher in FIFO order (single consumer thread method)
+    Node* TakeNodes() noexcept;
+
+    //! Allocate a new node from the thread local node cache or the heap (multiple producers threads method)
+    Node* AllocateNode();
+    //! Release the list of nodes into the freelist (single consumer thread method)
+    void ReleaseNodes(Node* first, Node* last) noexcept;
 };
 
 } // namespace CppCommon
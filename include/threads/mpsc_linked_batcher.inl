@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template<typename T>
-inline MPSCLinkedBatcher<T>::MPSCLinkedBatcher() : _head(nullptr)
+inline MPSCLinkedBatcher<T>::MPSCLinkedBatcher() : _head(nullptr), _free(nullptr)
 {
 }
 
@@ -18,6 +18,15 @@ inline MPSCLinkedBatcher<T>::~MPSCLinkedBatcher()
 {
     // Remove all nodes from the linked batcher
     Dequeue([](const T&){});
+
+    // Remove all nodes from the freelist
+    Node* node = _free.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr)
+    {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
 }
 
 template<typename T>
@@ -31,7 +40,7 @@ template<typename T>
 inline bool MPSCLinkedBatcher<T>::Enqueue(T&& item)
 {
     // Create new head node
-    Node* node = new Node;
+    Node* node = AllocateNode();
     if (node == nullptr)
         return false;
 
@@ -53,33 +62,143 @@ inline bool MPSCLinkedBatcher<T>::Dequeue(const std::function<void(const T&)>& h
 {
     assert((handler) && "Batch handler must be valid!");
 
-    Node* last = _head.exchange(nullptr, std::memory_order_acq_rel);
-    Node* first = nullptr;
+    // Check if the linked batcher is empty
+    Node* first = TakeNodes();
+    if (first == nullptr)
+        return false;
+
+    // Process all items in a batch mode
+    Node* node = first;
+    Node* prev = nullptr;
+    do
+    {
+        // Process the item with the given handler
+        handler(node->value);
+        prev = node;
+        node = node->next;
+    } while (node != nullptr);
+
+    // Release all processed nodes into the freelist at once
+    ReleaseNodes(first, prev);
+
+    return true;
+}
+
+template<typename T>
+template <class THandler>
+inline bool MPSCLinkedBatcher<T>::Dequeue(THandler&& handler)
+{
+    // Check if the linked batcher is empty
+    Node* first = TakeNodes();
+    if (first == nullptr)
+        return false;
+
+    // Move all items into the given handler in a batch mode
+    Node* node = first;
+    Node* prev = nullptr;
+    do
+    {
+        handler(std::move(node->value));
+        prev = node;
+        node = node->next;
+    } while (node != nullptr);
+
+    // Release all processed nodes into the freelist at once
+    ReleaseNodes(first, prev);
 
+    return true;
+}
+
+template<typename T>
+template <class THandler>
+inline bool MPSCLinkedBatcher<T>::DequeueBatch(THandler&& handler)
+{
     // Check if the linked batcher is empty
-    if (last == nullptr)
+    Node* first = TakeNodes();
+    if (first == nullptr)
         return false;
 
-    // Reverse the order to get nodes in FIFO order
+    // Move all items into the contiguous batch buffer
+    Node* node = first;
+    Node* prev = nullptr;
     do
+    {
+        _batch.emplace_back(std::move(node->value));
+        prev = node;
+        node = node->next;
+    } while (node != nullptr);
+
+    // Release all processed nodes into the freelist at once
+    ReleaseNodes(first, prev);
+
+    // Process all items at once
+    handler(std::span<T>(_batch.data(), _batch.size()));
+    _batch.clear();
+
+    return true;
+}
+
+template<typename T>
+inline typename MPSCLinkedBatcher<T>::Node* MPSCLinkedBatcher<T>::TakeNodes() noexcept
+{
+    Node* last = _head.exchange(nullptr, std::memory_order_acq_rel);
+    Node* first = nullptr;
+
+    // Reverse the order to get nodes in FIFO order
+    while (last != nullptr)
     {
         Node* temp = last;
         last = last->next;
         temp->next = first;
         first = temp;
-    } while (last != nullptr);
+    }
 
-    // Process all items in a batch mode
-    do
+    return first;
+}
+
+template<typename T>
+inline MPSCLinkedBatcher<T>::NodeCache::~NodeCache()
+{
+    // Remove all cached nodes
+    while (nodes != nullptr)
     {
-        Node* temp = first;
-        first = first->next;
-        // Process the item with the given handler
-        handler(temp->value);
-        delete temp;
-    } while (first != nullptr);
+        Node* next = nodes->next;
+        delete nodes;
+        nodes = next;
+    }
+}
 
-    return true;
+template<typename T>
+inline typename MPSCLinkedBatcher<T>::Node* MPSCLinkedBatcher<T>::AllocateNode()
+{
+    static thread_local NodeCache cache;
+
+    // Take the whole freelist into the empty thread local node cache
+    if ((cache.nodes == nullptr) && (_free.load(std::memory_order_relaxed) != nullptr))
+        cache.nodes = _free.exchange(nullptr, std::memory_order_acquire);
+
+    // Allocate a new node from the thread local node cache
+    Node* node = cache.nodes;
+    if (node != nullptr)
+    {
+        cache.nodes = node->next;
+        return node;
+    }
+
+    // Allocate a new node from the heap
+    return new Node;
+}
+
+template<typename T>
+inline void MPSCLinkedBatcher<T>::ReleaseNodes(Node* first, Node* last) noexcept
+{
+    // Push the list of nodes into the freelist. The consumer is the only thread which pushes
+    // nodes and producers always take the whole freelist, so there is no ABA problem.
+    Node* head = _free.load(std::memory_order_relaxed);
+    do
+    {
+        last->next = head;
+    } while (!_free.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
 }
 
 } // namespace CppCommon
@@ -21,6 +21,11 @@ namespace CppCommon {
     enqueue and dequeue operations. Linked queue is a dynamically grows queue which allocates memory for each
     new node.
 
+    Dequeued nodes are not deleted, but returned into the lock-free node freelist. Producer threads take the
+    whole freelist into their thread local node caches, so steady-state operation does no heap allocations.
+    Memory of the peak load is kept for reuse until the queue is destroyed (freelist) or the producer thread
+    is finished (thread local node cache).
+
     FIFO order is guaranteed!
 
     Thread-safe.
@@ -81,11 +86,26 @@ private:
 
     typedef char cache_line_pad[128];
 
+    // Thread local cache of free nodes
+    struct NodeCache
+    {
+        Node* nodes = nullptr;
+
+        ~NodeCache();
+    };
+
     cache_line_pad _pad0;
     std::atomic<Node*> _head;
     cache_line_pad _pad1;
     std::atomic<Node*> _tail;
     cache_line_pad _pad2;
+    std::atomic<Node*> _free;
+    cache_line_pad _pad3;
+
+    //! Allocate a new node from the thread local node cache or the heap (multiple producers threads method)
+    Node* AllocateNode();
+    //! Release the node into the freelist (single consumer thread method)
+    void ReleaseNode(Node* node) noexcept;
 };
 
 /*! \example threads_mpsc_linked_queue.cpp Multiple producers / single consumer wait-free linked queue example */
@@ -9,11 +9,12 @@
 namespace CppCommon {
 
 template<typename T>
-inline MPSCLinkedQueue<T>::MPSCLinkedQueue() : _head(new Node), _tail(_head.load(std::memory_order_relaxed))
+inline MPSCLinkedQueue<T>::MPSCLinkedQueue() : _head(new Node), _tail(_head.load(std::memory_order_relaxed)), _free(nullptr)
 {
     memset(_pad0, 0, sizeof(cache_line_pad));
     memset(_pad1, 0, sizeof(cache_line_pad));
     memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
 
     // Linked queue is initialized with a fake node as a head node
     Node* front = _head.load(std::memory_order_relaxed);
@@ -30,6 +31,15 @@ inline MPSCLinkedQueue<T>::~MPSCLinkedQueue()
     // Remove the last fake node
     Node* front = _head.load(std::memory_order_relaxed);
     delete front;
+
+    // Remove all nodes from the freelist
+    Node* node = _free.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr)
+    {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
 }
 
 template<typename T>
@@ -43,7 +53,7 @@ template<typename T>
 inline bool MPSCLinkedQueue<T>::Enqueue(T&& item)
 {
     // Create new head node
-    Node* node = new Node;
+    Node* node = AllocateNode();
     if (node == nullptr)
         return false;
 
@@ -74,10 +84,55 @@ inline bool MPSCLinkedQueue<T>::Dequeue(T& item)
     // Update tail node with a next one
     _tail.store(next, std::memory_order_release);
 
-    // Remove the previous tail node
-    delete tail;
+    // Release the previous tail node into the freelist
+    ReleaseNode(tail);
 
     return true;
 }
 
+template<typename T>
+inline MPSCLinkedQueue<T>::NodeCache::~NodeCache()
+{
+    // Remove all cached nodes
+    while (nodes != nullptr)
+    {
+        Node* next = nodes->next.load(std::memory_order_relaxed);
+        delete nodes;
+        nodes = next;
+    }
+}
+
+template<typename T>
+inline typename MPSCLinkedQueue<T>::Node* MPSCLinkedQueue<T>::AllocateNode()
+{
+    static thread_local NodeCache cache;
+
+    // Take the whole freelist into the empty thread local node cache
+    if ((cache.nodes == nullptr) && (_free.load(std::memory_order_relaxed) != nullptr))
+        cache.nodes = _free.exchange(nullptr, std::memory_order_acquire);
+
+    // Allocate a new node from the thread local node cache
+    Node* node = cache.nodes;
+    if (node != nullptr)
+    {
+        cache.nodes = node->next.load(std::memory_order_relaxed);
+        return node;
+    }
+
+    // Allocate a new node from the heap
+    return new Node;
+}
+
+template<typename T>
+inline void MPSCLinkedQueue<T>::ReleaseNode(Node* node) noexcept
+{
+    // Push the node into the freelist. The consumer is the only thread which pushes
+    // nodes and producers always take the whole freelist, so there is no ABA problem.
+    Node* head = _free.load(std::memory_order_relaxed);
+    do
+    {
+        node->next.store(head, std::memory_order_relaxed);
+    } while (!_free.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
 } // namespace CppCommon
@@ -30,6 +30,10 @@ namespace CppCommon {
 
     FIFO order is not guaranteed!
 
+    Zero-copy API (Prepare() / Commit() and Peek() / Release()) works with the
+    chosen producer's ring buffer in place. The producer's ring buffer stays
+    locked between Prepare() and Commit() calls.
+
     Thread-safe.
 */
 class MPSCRingBuffer
@@ -85,6 +89,43 @@ public:
     */
     bool Dequeue(void* data, size_t& size);
 
+    //! Prepare a contiguous free space in the ring buffer to write the data in place (multiple producers threads method)
+    /*!
+        Chosen producer's ring buffer is locked until the prepared space is committed.
+        Data size should not be greater than ring buffer capacity!
+
+        Will not block.
+
+        \param size - Required free space size
+        \return Prepared free space or empty span if the ring buffer has not enough free space
+    */
+    std::span<uint8_t> Prepare(size_t size);
+    //! Commit the given size of the previously prepared space (multiple producers threads method)
+    /*!
+        Will not block.
+
+        \param prepared - Previously prepared space
+        \param size - Committed size (should not be greater than the prepared size, zero to discard the prepared space)
+    */
+    void Commit(std::span<uint8_t> prepared, size_t size);
+
+    //! Peek available data of one of producers' ring buffers as a contiguous memory block (single consumer thread method)
+    /*!
+        Peeked data stays in the ring buffer until it is released.
+
+        Will not block.
+
+        \return Available data or empty span if the ring buffer is empty
+    */
+    std::span<const uint8_t> Peek();
+    //! Release the given size of the previously peeked data (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param size - Released size (should not be greater than the peeked size)
+    */
+    void Release(size_t size);
+
 private:
     struct Producer
     {
@@ -98,6 +139,7 @@ private:
     size_t _concurrency;
     std::vector<std::shared_ptr<Producer>> _producers;
     size_t _consumer;
+    size_t _peeked;
 };
 
 /*! \example threads_mpsc_ring_buffer.cpp Multiple producers / single consumer wait-free ring buffer example */
@@ -8,7 +8,7 @@
 
 namespace CppCommon {
 
-inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0)
+inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0), _peeked(0)
 {
     // Initialize producers' ring buffer
     for (size_t i = 0; i < concurrency; ++i)
@@ -52,4 +52,63 @@ inline bool MPSCRingBuffer::Dequeue(void* data, size_t& size)
     return false;
 }
 
+inline std::span<uint8_t> MPSCRingBuffer::Prepare(size_t size)
+{
+    // Get producer index for the current thread based on RDTS value
+    size_t index = Timestamp::rdts() % _concurrency;
+
+    // Lock the chosen producer using its spin-lock until the commit
+    _producers[index]->lock.Lock();
+
+    // Prepare the free space in the producer's ring buffer
+    std::span<uint8_t> result = _producers[index]->buffer.Prepare(size);
+    if (result.empty())
+        _producers[index]->lock.Unlock();
+    return result;
+}
+
+inline void MPSCRingBuffer::Commit(std::span<uint8_t> prepared, size_t size)
+{
+    assert(!prepared.empty() && "Prepared space should not be empty!");
+    if (prepared.empty())
+        return;
+
+    // Find the producer which owns the prepared space
+    for (auto& producer : _producers)
+    {
+        if (producer->buffer.Owns(prepared.data()))
+        {
+            // Commit the prepared space and unlock the producer
+            producer->buffer.Commit(size);
+            producer->lock.Unlock();
+            return;
+        }
+    }
+
+    assert(false && "Prepared space does not belong to the ring buffer!");
+}
+
+inline std::span<const uint8_t> MPSCRingBuffer::Peek()
+{
+    // Try to peek data from the one of producer's ring buffers
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        size_t index = _consumer++ % _concurrency;
+        std::span<const uint8_t> result = _producers[index]->buffer.Peek();
+        if (!result.empty())
+        {
+            _peeked = index;
+            return result;
+        }
+    }
+
+    return std::span<const uint8_t>();
+}
+
+inline void MPSCRingBuffer::Release(size_t size)
+{
+    // Release data of the last peeked producer's ring buffer
+    _producers[_peeked]->buffer.Release(size);
+}
+
 } // namespace CppCommon
@@ -96,6 +96,31 @@ public:
     */
     bool Dequeue(T& item);
 
+    //! Enqueue a range of items into the ring queue (multiple producers threads method)
+    /*!
+        Items will be copied into the ring queue. All items are enqueued into one producer's ring queue under one lock.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param last - Iterator to the item after the last one to enqueue
+        \return Count of successfully enqueued items (could be less than the range size if the ring queue is full)
+    */
+    template <class InputIterator>
+    size_t EnqueueBulk(InputIterator first, InputIterator last);
+    //! Dequeue a range of items from the ring queue (single consumer thread method)
+    /*!
+        Items will be moved from the ring queue into the given output iterator. Items are dequeued from producers' ring queues in bulks.
+
+        Will not block.
+
+        \param out - Output iterator to dequeue items into
+        \param max - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (0 if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator out, size_t max);
+
     //! Dequeue all items from the linked queue (single consumer thread method)
     /*!
         All items in the batcher will be processed by the given handler.
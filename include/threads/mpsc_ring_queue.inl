@@ -79,4 +79,42 @@ inline bool MPSCRingQueue<T>::Dequeue(const std::function<void(const T&)>& handl
     return result;
 }
 
+template<typename T>
+template <class InputIterator>
+inline size_t MPSCRingQueue<T>::EnqueueBulk(InputIterator first, InputIterator last)
+{
+    // Get producer index for the current thread based on RDTS value
+    size_t index = Timestamp::rdts() % _concurrency;
+
+    // Lock the chosen producer using its spin-lock
+    Locker<SpinLock> lock(_producers[index]->lock);
+
+    // Enqueue items into the producer's ring queue
+    return _producers[index]->queue.EnqueueBulk(first, last);
+}
+
+template<typename T>
+template <class OutputIterator>
+inline size_t MPSCRingQueue<T>::DequeueBulk(OutputIterator out, size_t max)
+{
+    // Output iterator adapter which keeps the given output iterator advanced across producers' ring queues
+    struct Output
+    {
+        OutputIterator* out;
+
+        Output& operator*() noexcept { return *this; }
+        Output& operator++() noexcept { return *this; }
+        Output& operator++(int) noexcept { return *this; }
+        Output& operator=(T&& item) { *(*out)++ = std::move(item); return *this; }
+    };
+
+    size_t result = 0;
+
+    // Dequeue items from producers' ring queues
+    for (size_t i = 0; (i < _concurrency) && (result < max); ++i)
+        result += _producers[_consumer++ % _concurrency]->queue.DequeueBulk(Output{ &out }, max - result);
+
+    return result;
+}
+
 } // namespace CppCommon
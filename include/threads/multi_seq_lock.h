@@ -0,0 +1,129 @@
+/*!
+    \file multi_seq_lock.h
+    \brief Multi-slot sequential lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MULTI_SEQLOCK_H
+#define CPPCOMMON_THREADS_MULTI_SEQLOCK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Multi-slot sequential lock synchronization primitive
+/*!
+    Multi-slot sequential lock keeps the given count of data versions in
+    separate slots with own sequence counters. Writer fills the slot next to
+    the current one and publishes its version, so it never blocks readers and
+    never disturbs readers of the current version. Readers visit the current
+    version in place through the visitor without copying the whole data and
+    retry only if the writer wraps around all slots during the visit.
+
+    Visitor could observe inconsistent data in case of the retry, so it must
+    not have side effects and must not follow pointers from the data. Visitor
+    result is returned only for the consistent visit.
+
+    Single writer / multiple readers. Multiple writers must be serialized.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Seqlock
+*/
+template <typename T, size_t N = 3>
+class MultiSeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Multi-slot sequential lock data must be trivially copyable!");
+    static_assert((N >= 2), "Multi-slot sequential lock must have at least two slots!");
+
+public:
+    MultiSeqLock();
+    explicit MultiSeqLock(const T& data);
+    MultiSeqLock(const MultiSeqLock&) = delete;
+    MultiSeqLock(MultiSeqLock&&) = delete;
+    ~MultiSeqLock() = default;
+
+    MultiSeqLock& operator=(const T& data) noexcept;
+    MultiSeqLock& operator=(const MultiSeqLock&) = delete;
+    MultiSeqLock& operator=(MultiSeqLock&&) = delete;
+
+    //! Get the count of slots
+    static constexpr size_t slots() noexcept { return N; }
+    //! Get the current published version
+    size_t version() const noexcept { return _version.load(std::memory_order_acquire); }
+
+    //! Read the copy of the current data version
+    /*!
+        Will block in a spin loop.
+
+        \return Read data
+    */
+    T Read() const noexcept;
+
+    //! Visit the current data version in place
+    /*!
+        Visitor is called with the constant reference to the current data
+        version and could be called several times in case of the retry.
+
+        Will block in a spin loop.
+
+        \param visitor - Data visitor with the signature 'R(const T& data)'
+        \return Visitor result of the consistent visit
+    */
+    template <class TVisitor>
+    auto Visit(TVisitor&& visitor) const -> decltype(visitor(std::declval<const T&>()));
+
+    //! Write data as a new version
+    /*!
+        Will not block.
+
+        \param data - Data to write
+    */
+    void Write(const T& data) noexcept;
+
+    //! Update the copy of the current data as a new version
+    /*!
+        Current data version is copied into the next slot and updated with
+        the given updater in place before it is published.
+
+        Will not block.
+
+        \param updater - Data updater with the signature 'void(T& data)'
+    */
+    template <class TUpdater>
+    void Update(TUpdater&& updater);
+
+private:
+    // Data slot placed on its own cache lines
+    struct alignas(128) Slot
+    {
+        std::atomic<size_t> seq;
+        T data;
+    };
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<size_t> _version;
+    cache_line_pad _pad1;
+    Slot _slots[N];
+
+    //! Begin writing of the next slot
+    Slot& BeginWrite() noexcept;
+    //! Publish the written slot
+    void EndWrite(Slot& slot) noexcept;
+};
+
+/*! \example threads_multi_seq_lock.cpp Multi-slot sequential lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "multi_seq_lock.inl"
+
+#endif // CPPCOMMON_THREADS_MULTI_SEQLOCK_H
@@ -0,0 +1,116 @@
+/*!
+    \file multi_seq_lock.inl
+    \brief Multi-slot sequential lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, size_t N>
+inline MultiSeqLock<T, N>::MultiSeqLock() : _version(0)
+{
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    for (auto& slot : _slots)
+    {
+        slot.seq.store(0, std::memory_order_relaxed);
+        slot.data = T();
+    }
+}
+
+template <typename T, size_t N>
+inline MultiSeqLock<T, N>::MultiSeqLock(const T& data) : MultiSeqLock()
+{
+    _slots[0].data = data;
+}
+
+template <typename T, size_t N>
+inline MultiSeqLock<T, N>& MultiSeqLock<T, N>::operator=(const T& data) noexcept
+{
+    Write(data);
+    return *this;
+}
+
+template <typename T, size_t N>
+inline T MultiSeqLock<T, N>::Read() const noexcept
+{
+    return Visit([](const T& data) { return data; });
+}
+
+template <typename T, size_t N>
+template <class TVisitor>
+inline auto MultiSeqLock<T, N>::Visit(TVisitor&& visitor) const -> decltype(visitor(std::declval<const T&>()))
+{
+    for (;;)
+    {
+        // Find the slot of the current version
+        const Slot& slot = _slots[_version.load(std::memory_order_acquire) % N];
+
+        // Skip the slot in the middle of writing
+        size_t seq0 = slot.seq.load(std::memory_order_acquire);
+        if (seq0 & 1)
+            continue;
+
+        if constexpr (std::is_void<decltype(visitor(slot.data))>::value)
+        {
+            visitor(slot.data);
+
+            // Check the slot was not rewritten during the visit
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) == seq0)
+                return;
+        }
+        else
+        {
+            auto result = visitor(slot.data);
+
+            // Check the slot was not rewritten during the visit
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) == seq0)
+                return result;
+        }
+    }
+}
+
+template <typename T, size_t N>
+inline void MultiSeqLock<T, N>::Write(const T& data) noexcept
+{
+    Slot& slot = BeginWrite();
+    slot.data = data;
+    EndWrite(slot);
+}
+
+template <typename T, size_t N>
+template <class TUpdater>
+inline void MultiSeqLock<T, N>::Update(TUpdater&& updater)
+{
+    const Slot& current = _slots[_version.load(std::memory_order_relaxed) % N];
+    Slot& slot = BeginWrite();
+    slot.data = current.data;
+    updater(slot.data);
+    EndWrite(slot);
+}
+
+template <typename T, size_t N>
+inline typename MultiSeqLock<T, N>::Slot& MultiSeqLock<T, N>::BeginWrite() noexcept
+{
+    Slot& slot = _slots[(_version.load(std::memory_order_relaxed) + 1) % N];
+
+    // Mark the next slot as in the middle of writing
+    slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return slot;
+}
+
+template <typename T, size_t N>
+inline void MultiSeqLock<T, N>::EndWrite(Slot& slot) noexcept
+{
+    // Complete the slot writing and publish its version
+    slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    _version.store(_version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // namespace CppCommon
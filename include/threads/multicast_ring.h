@@ -0,0 +1,264 @@
+/*!
+    \file multicast_ring.h
+    \brief Multicast ring buffer with sequence barriers definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MULTICAST_RING_H
+#define CPPCOMMON_THREADS_MULTICAST_RING_H
+
+#include "threads/wait_strategy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Multicast ring producers claim strategy
+enum class MulticastClaim
+{
+    SINGLE,     //!< Single producer claims sequences without atomic read-modify-write operations
+    MULTI       //!< Multiple producers claim sequences with CAS and publish slots independently
+};
+
+//! Multicast ring buffer with sequence barriers
+/*!
+    Multicast ring buffer (LMAX Disruptor style) delivers every published
+    event to every consumer in the sequence order. Events are preallocated
+    in the ring and reused, so producers write them in place and consumers
+    read them in place without copying.
+
+    Producer claims a range of sequences with the sequencer, fills claimed
+    events and publishes them. Each consumer has its own sequence cursor and
+    could depend on other consumers (e.g. decoder -> risk -> journal ->
+    publisher pipeline), so it sees only events already processed by all its
+    dependencies. Producers never overwrite events which are not processed
+    by all consumers yet.
+
+    Consumers are batch-aware: a single wait returns the highest available
+    sequence, so all available events are processed at once with one cursor
+    release store. Blocking waits use the pluggable wait strategy
+    (SpinWaitStrategy, YieldWaitStrategy, BlockingWaitStrategy).
+
+    All consumers must be created before the first event is claimed and must
+    live until the last one is processed.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    https://lmax-exchange.github.io/disruptor/disruptor.html
+*/
+template <typename T, MulticastClaim claim = MulticastClaim::SINGLE, class TWaitStrategy = SpinWaitStrategy>
+class MulticastRing
+{
+    typedef char cache_line_pad[128];
+
+public:
+    //! Multicast ring consumer
+    /*!
+        Consumer keeps the sequence of the last processed event and a
+        barrier of dependencies: the ring producers and optionally other
+        consumers which must process events before this one.
+
+        Consumer methods must be called from a single consumer thread.
+
+        Thread-safe.
+    */
+    class Consumer
+    {
+    public:
+        //! Register a new consumer of the given multicast ring
+        /*!
+            \param ring - Multicast ring
+            \param dependencies - Consumers which must process events before this one (default is none)
+        */
+        explicit Consumer(MulticastRing& ring, std::initializer_list<const Consumer*> dependencies = {});
+        Consumer(const Consumer&) = delete;
+        Consumer(Consumer&&) = delete;
+        ~Consumer();
+
+        Consumer& operator=(const Consumer&) = delete;
+        Consumer& operator=(Consumer&&) = delete;
+
+        //! Get the sequence of the last processed event (-1 if none)
+        int64_t sequence() const noexcept { return _sequence.load(std::memory_order_acquire); }
+
+        //! Get the highest sequence available for processing
+        /*!
+            Will not block.
+
+            \return The highest available sequence (less than the next sequence if there are no available events)
+        */
+        int64_t Available() const noexcept;
+        //! Wait until the event with the given sequence is available for processing
+        /*!
+            Will block with the wait strategy.
+
+            \param sequence - Sequence to wait for
+            \return The highest available sequence (not less than the given one)
+        */
+        int64_t Wait(int64_t sequence);
+
+        //! Release all events up to the given sequence as processed
+        /*!
+            \param sequence - Sequence of the last processed event
+        */
+        void Release(int64_t sequence) noexcept;
+
+        //! Process available events in a single batch
+        /*!
+            Handler is called as handler(T& event, int64_t sequence, bool end_of_batch)
+            for each available event, then processed events are released at once.
+
+            Will not block.
+
+            \param handler - Events handler
+            \param max - Maximal count of events in the batch (default is unlimited)
+            \return Count of processed events (0 if there are no available events)
+        */
+        template <class THandler>
+        size_t Process(THandler&& handler, size_t max = std::numeric_limits<size_t>::max());
+        //! Wait for the next event and process all available events in a single batch
+        /*!
+            Handler is called as handler(T& event, int64_t sequence, bool end_of_batch).
+
+            Will block with the wait strategy.
+
+            \param handler - Events handler
+            \param max - Maximal count of events in the batch (default is unlimited)
+            \return Count of processed events (at least one)
+        */
+        template <class THandler>
+        size_t ProcessWait(THandler&& handler, size_t max = std::numeric_limits<size_t>::max());
+
+    private:
+        MulticastRing& _ring;
+        std::vector<const std::atomic<int64_t>*> _dependencies;
+        mutable bool _dependents;
+        cache_line_pad _pad0;
+        std::atomic<int64_t> _sequence;
+        cache_line_pad _pad1;
+
+        //! Handle the batch of available events and release them
+        template <class THandler>
+        size_t Handle(THandler& handler, int64_t first, int64_t last, size_t max);
+    };
+
+    //! Default class constructor
+    /*!
+        \param capacity - Ring capacity (must be a power of two)
+    */
+    explicit MulticastRing(size_t capacity);
+    MulticastRing(const MulticastRing&) = delete;
+    MulticastRing(MulticastRing&&) = delete;
+    ~MulticastRing();
+
+    MulticastRing& operator=(const MulticastRing&) = delete;
+    MulticastRing& operator=(MulticastRing&&) = delete;
+
+    //! Get ring capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the count of registered consumers
+    size_t consumers() const noexcept { return _gating.size(); }
+    //! Get the highest claimed sequence (-1 if none)
+    int64_t cursor() const noexcept { return _claimed.load(std::memory_order_acquire); }
+
+    //! Access the event with the given sequence
+    /*!
+        Producer could access only claimed and not yet published events,
+        consumers could access only available and not yet released events.
+
+        \param sequence - Event sequence
+        \return Event reference
+    */
+    T& operator[](int64_t sequence) noexcept { return _buffer[sequence & _mask]; }
+    const T& operator[](int64_t sequence) const noexcept { return _buffer[sequence & _mask]; }
+
+    //! Try to claim the given count of sequences (producer threads method)
+    /*!
+        Will not block.
+
+        \param sequence - The highest claimed sequence (first claimed one is sequence - count + 1)
+        \param count - Count of sequences to claim (default is 1)
+        \return 'true' if sequences were successfully claimed, 'false' if the ring has no enough free events
+    */
+    bool TryClaim(int64_t& sequence, size_t count = 1);
+    //! Claim the given count of sequences and wait while the ring has no enough free events (producer threads method)
+    /*!
+        Will block with the wait strategy.
+
+        \param count - Count of sequences to claim (default is 1)
+        \return The highest claimed sequence (first claimed one is sequence - count + 1)
+    */
+    int64_t Claim(size_t count = 1);
+
+    //! Publish the claimed event with the given sequence (producer threads method)
+    /*!
+        \param sequence - Claimed sequence
+    */
+    void Publish(int64_t sequence) { Publish(sequence, sequence); }
+    //! Publish the claimed range of events (producer threads method)
+    /*!
+        \param first - The first claimed sequence
+        \param last - The last claimed sequence
+    */
+    void Publish(int64_t first, int64_t last);
+
+    //! Claim, fill and publish a single event (producer threads method)
+    /*!
+        Translator is called as translator(T& event, int64_t sequence).
+
+        Will block with the wait strategy.
+
+        \param translator - Event translator
+        \return Published sequence
+    */
+    template <class TTranslator>
+    int64_t PublishEvent(TTranslator&& translator);
+
+private:
+    cache_line_pad _pad0;
+    const size_t _capacity;
+    const size_t _mask;
+    T* const _buffer;
+    // Published sequence of each slot (multiple producers only)
+    std::atomic<int64_t>* const _available;
+    // Sequences of all consumers which gate producers
+    std::vector<const std::atomic<int64_t>*> _gating;
+
+    cache_line_pad _pad1;
+    // The highest claimed sequence
+    std::atomic<int64_t> _claimed;
+    cache_line_pad _pad2;
+    // The highest published sequence (single producer only)
+    std::atomic<int64_t> _published;
+    cache_line_pad _pad3;
+    // Cached minimal consumers sequence
+    std::atomic<int64_t> _gate;
+    cache_line_pad _pad4;
+    TWaitStrategy _not_empty;
+    cache_line_pad _pad5;
+    TWaitStrategy _not_full;
+    cache_line_pad _pad6;
+
+    //! Get the minimal sequence of all consumers
+    int64_t MinimumGating(int64_t sequence) const noexcept;
+    //! Get the highest published sequence in the given range
+    int64_t HighestPublished(int64_t first, int64_t last) const noexcept;
+};
+
+/*! \example threads_multicast_ring.cpp Multicast ring buffer with sequence barriers example */
+
+} // namespace CppCommon
+
+#include "multicast_ring.inl"
+
+#endif // CPPCOMMON_THREADS_MULTICAST_RING_H
@@ -0,0 +1,243 @@
+/*!
+    \file multicast_ring.inl
+    \brief Multicast ring buffer with sequence barriers inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline MulticastRing<T, claim, TWaitStrategy>::Consumer::Consumer(MulticastRing& ring, std::initializer_list<const Consumer*> dependencies)
+    : _ring(ring), _dependents(false), _sequence(-1)
+{
+    for (auto dependency : dependencies)
+    {
+        assert((&dependency->_ring == &ring) && "Consumer dependency must belong to the same multicast ring!");
+        _dependencies.push_back(&dependency->_sequence);
+        dependency->_dependents = true;
+    }
+
+    // Gate producers with the consumer sequence
+    _ring._gating.push_back(&_sequence);
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline MulticastRing<T, claim, TWaitStrategy>::Consumer::~Consumer()
+{
+    auto it = std::find(_ring._gating.begin(), _ring._gating.end(), &_sequence);
+    if (it != _ring._gating.end())
+        _ring._gating.erase(it);
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline int64_t MulticastRing<T, claim, TWaitStrategy>::Consumer::Available() const noexcept
+{
+    int64_t next = _sequence.load(std::memory_order_relaxed) + 1;
+
+    // Barrier of the ring producers
+    int64_t result;
+    if constexpr (claim == MulticastClaim::SINGLE)
+        result = _ring._published.load(std::memory_order_acquire);
+    else
+        result = _ring._claimed.load(std::memory_order_acquire);
+
+    // Barrier of dependencies
+    for (auto dependency : _dependencies)
+        result = std::min(result, dependency->load(std::memory_order_acquire));
+
+    // Claimed sequences of multiple producers could be published out of order
+    if constexpr (claim == MulticastClaim::MULTI)
+    {
+        if (result >= next)
+            result = _ring.HighestPublished(next, result);
+    }
+
+    return result;
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline int64_t MulticastRing<T, claim, TWaitStrategy>::Consumer::Wait(int64_t sequence)
+{
+    int64_t result = Available();
+    if (result >= sequence)
+        return result;
+
+    _ring._not_empty.Wait([this, sequence, &result]() { result = Available(); return (result >= sequence); });
+    return result;
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline void MulticastRing<T, claim, TWaitStrategy>::Consumer::Release(int64_t sequence) noexcept
+{
+    _sequence.store(sequence, std::memory_order_release);
+
+    // Notify waiting producers and dependent consumers
+    _ring._not_full.Notify();
+    if (_dependents)
+        _ring._not_empty.Notify();
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+template <class THandler>
+inline size_t MulticastRing<T, claim, TWaitStrategy>::Consumer::Process(THandler&& handler, size_t max)
+{
+    int64_t next = _sequence.load(std::memory_order_relaxed) + 1;
+    int64_t available = Available();
+    if (available < next)
+        return 0;
+
+    return Handle(handler, next, available, max);
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+template <class THandler>
+inline size_t MulticastRing<T, claim, TWaitStrategy>::Consumer::ProcessWait(THandler&& handler, size_t max)
+{
+    int64_t next = _sequence.load(std::memory_order_relaxed) + 1;
+    int64_t available = Wait(next);
+
+    return Handle(handler, next, available, max);
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+template <class THandler>
+inline size_t MulticastRing<T, claim, TWaitStrategy>::Consumer::Handle(THandler& handler, int64_t first, int64_t last, size_t max)
+{
+    assert((max > 0) && "Batch size must be greater than zero!");
+
+    // Limit the batch size
+    if ((uint64_t)(last - first) >= max)
+        last = first + (int64_t)max - 1;
+
+    for (int64_t sequence = first; sequence <= last; ++sequence)
+        handler(_ring[sequence], sequence, (sequence == last));
+
+    Release(last);
+    return (size_t)(last - first + 1);
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline MulticastRing<T, claim, TWaitStrategy>::MulticastRing(size_t capacity)
+    : _capacity(capacity),
+      _mask(capacity - 1),
+      _buffer(new T[capacity]),
+      _available((claim == MulticastClaim::MULTI) ? new std::atomic<int64_t>[capacity] : nullptr),
+      _claimed(-1),
+      _published(-1),
+      _gate(-1)
+{
+    assert((capacity > 1) && "Ring capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring capacity must be a power of two!");
+
+    if constexpr (claim == MulticastClaim::MULTI)
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            _available[i].store(-1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline MulticastRing<T, claim, TWaitStrategy>::~MulticastRing()
+{
+    delete[] _available;
+    delete[] _buffer;
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline int64_t MulticastRing<T, claim, TWaitStrategy>::MinimumGating(int64_t sequence) const noexcept
+{
+    int64_t result = sequence;
+    for (auto gating : _gating)
+        result = std::min(result, gating->load(std::memory_order_acquire));
+    return result;
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline int64_t MulticastRing<T, claim, TWaitStrategy>::HighestPublished(int64_t first, int64_t last) const noexcept
+{
+    for (int64_t sequence = first; sequence <= last; ++sequence)
+        if (_available[sequence & _mask].load(std::memory_order_acquire) != sequence)
+            return sequence - 1;
+    return last;
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline bool MulticastRing<T, claim, TWaitStrategy>::TryClaim(int64_t& sequence, size_t count)
+{
+    assert(((count > 0) && (count <= _capacity)) && "Count of claimed sequences must be in range [1, capacity]!");
+
+    int64_t current = _claimed.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        int64_t next = current + (int64_t)count;
+        int64_t wrap = next - (int64_t)_capacity;
+
+        // Check if all consumers have released the wrapped events
+        if (wrap > _gate.load(std::memory_order_relaxed))
+        {
+            int64_t gate = MinimumGating(current);
+            _gate.store(gate, std::memory_order_relaxed);
+            if (wrap > gate)
+                return false;
+        }
+
+        if constexpr (claim == MulticastClaim::SINGLE)
+        {
+            _claimed.store(next, std::memory_order_relaxed);
+            sequence = next;
+            return true;
+        }
+        else
+        {
+            if (_claimed.compare_exchange_weak(current, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                sequence = next;
+                return true;
+            }
+        }
+    }
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline int64_t MulticastRing<T, claim, TWaitStrategy>::Claim(size_t count)
+{
+    int64_t sequence;
+    while (!TryClaim(sequence, count))
+    {
+        _not_full.Wait([this, count]()
+        {
+            int64_t current = _claimed.load(std::memory_order_relaxed);
+            return ((current + (int64_t)count - (int64_t)_capacity) <= MinimumGating(current));
+        });
+    }
+    return sequence;
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+inline void MulticastRing<T, claim, TWaitStrategy>::Publish(int64_t first, int64_t last)
+{
+    if constexpr (claim == MulticastClaim::SINGLE)
+        _published.store(last, std::memory_order_release);
+    else
+    {
+        for (int64_t sequence = first; sequence <= last; ++sequence)
+            _available[sequence & _mask].store(sequence, std::memory_order_release);
+    }
+
+    // Notify waiting consumers
+    _not_empty.Notify();
+}
+
+template <typename T, MulticastClaim claim, class TWaitStrategy>
+template <class TTranslator>
+inline int64_t MulticastRing<T, claim, TWaitStrategy>::PublishEvent(TTranslator&& translator)
+{
+    int64_t sequence = Claim(1);
+    translator((*this)[sequence], sequence);
+    Publish(sequence);
+    return sequence;
+}
+
+} // namespace CppCommon
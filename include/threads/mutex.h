@@ -12,6 +12,7 @@
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
+#include <atomic>
 #include <memory>
 
 namespace CppCommon {
@@ -22,6 +23,10 @@ namespace CppCommon {
     of data between threads. A thread obtains ownership of a mutex object by calling one of the lock
     functions and relinquishes ownership by calling the corresponding unlock function.
 
+    Mutex state is a single atomic word kept in the mutex object, so uncontended lock and unlock are
+    inlined atomic operations. Only contended operations call the platform implementation to spin and
+    block the thread.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Mutual_exclusion
@@ -43,7 +48,7 @@ public:
 
         \return 'true' if the mutex was successfully acquired, 'false' if the mutex is busy
     */
-    bool TryLock();
+    bool TryLock() noexcept;
 
     //! Try to acquire mutex for the given timespan
     /*!
@@ -78,16 +83,26 @@ public:
 private:
     class Impl;
 
+    // Mutex state: 0 - unlocked, 1 - locked, 2 - locked with blocked threads
+    std::atomic<uint32_t> _state;
+
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 64;
-    static const size_t StorageAlign = 8;
+    static const size_t StorageSize = 4;
+    static const size_t StorageAlign = 4;
     alignas(StorageAlign) std::byte _storage[StorageSize];
+
+    //! Acquire the contended mutex with block
+    void LockSlow();
+    //! Wake one of threads blocked on the released mutex
+    void UnlockSlow();
 };
 
 /*! \example threads_mutex.cpp Mutex synchronization primitive example */
 
 } // namespace CppCommon
 
+#include "mutex.inl"
+
 #endif // CPPCOMMON_THREADS_MUTEX_H
@@ -0,0 +1,31 @@
+/*!
+    \file mutex.inl
+    \brief Mutex synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool Mutex::TryLock() noexcept
+{
+    uint32_t state = 0;
+    return _state.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void Mutex::Lock()
+{
+    // Uncontended path is a single atomic operation
+    if (!TryLock())
+        LockSlow();
+}
+
+inline void Mutex::Unlock()
+{
+    // Call the platform implementation only if there are blocked threads
+    if (_state.exchange(0, std::memory_order_release) != 1)
+        UnlockSlow();
+}
+
+} // namespace CppCommon
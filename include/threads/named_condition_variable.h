@@ -21,6 +21,10 @@ namespace CppCommon {
     Named condition variable behaves as a simple condition variable but could be shared
     between processes on the same machine.
 
+    On Unix systems waiters block on the notification sequence counter in the
+    shared memory with the shared futex, so notification without waiters does
+    not enter the kernel.
+
     Thread-safe.
 */
 class NamedConditionVariable
@@ -12,6 +12,7 @@
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -22,6 +23,10 @@ namespace CppCommon {
     Named critical section behaves as a simple critical section but could be shared
     between processes on the same machine.
 
+    On Unix systems the critical section is based on the same robust shared
+    mutex as NamedMutex, so it spins for a while before blocking and recovers
+    the critical section abandoned by the dead owner.
+
     Thread-safe.
 
     \see CriticalSection
@@ -32,8 +37,9 @@ public:
     //! Default class constructor
     /*!
         \param name - Critical section name
+        \param spin - Count of spin iterations before blocking (default is 4000)
     */
-    explicit NamedCriticalSection(const std::string& name);
+    explicit NamedCriticalSection(const std::string& name, uint32_t spin = 4000);
     NamedCriticalSection(const NamedCriticalSection&) = delete;
     NamedCriticalSection(NamedCriticalSection&& cs) = delete;
     ~NamedCriticalSection();
@@ -44,6 +50,9 @@ public:
     //! Get the critical section name
     const std::string& name() const;
 
+    //! Was the critical section abandoned by the dead owner before the last successful lock?
+    bool abandoned() const noexcept;
+
     //! Try to acquire critical section without block
     /*!
         Will not block.
@@ -88,7 +97,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 256;
+    static const size_t StorageSize = 296;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
@@ -0,0 +1,149 @@
+/*!
+    \file named_distributed_rw_lock.h
+    \brief Named distributed reader-biased read/write lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_NAMED_DISTRIBUTED_RW_LOCK_H
+#define CPPCOMMON_THREADS_NAMED_DISTRIBUTED_RW_LOCK_H
+
+#include "threads/locker.h"
+#include "time/timestamp.h"
+
+#include <memory>
+#include <string>
+
+namespace CppCommon {
+
+//! Named distributed reader-biased read/write lock synchronization primitive
+/*!
+    Named distributed read/write lock behaves as a DistributedRWLock but could
+    be shared between processes on the same machine. Readers counters are kept
+    in per-CPU slots placed on separate cache lines of the shared memory, so
+    readers of different processes never write the same cache line and the
+    read lock takes one atomic increment and one load of the writer flag.
+
+    Writers are preferred: the writer raises the writer flag to stop new
+    readers and waits until readers of all slots are drained. Readers blocked
+    by the writer wait on the shared futex. Writers exclude each other with the
+    robust shared mutex of NamedMutex, so the writer lock abandoned by the dead
+    owner is recovered. Readers counters are anonymous, so the read lock held by the
+    dead process is never released.
+
+    All processes must use the same count of readers slots.
+
+    Thread-safe.
+
+    \see DistributedRWLock
+*/
+class NamedDistributedRWLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param name - Read/Write lock name
+        \param slots - Count of readers slots rounded up to the power of two (default is 0 - count of logical CPU cores)
+    */
+    explicit NamedDistributedRWLock(const std::string& name, size_t slots = 0);
+    NamedDistributedRWLock(const NamedDistributedRWLock&) = delete;
+    NamedDistributedRWLock(NamedDistributedRWLock&& lock) = delete;
+    ~NamedDistributedRWLock();
+
+    NamedDistributedRWLock& operator=(const NamedDistributedRWLock&) = delete;
+    NamedDistributedRWLock& operator=(NamedDistributedRWLock&& lock) = delete;
+
+    //! Get the read/write lock name
+    const std::string& name() const;
+    //! Get the count of readers slots
+    size_t slots() const noexcept;
+
+    //! Try to acquire read lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead() noexcept;
+    //! Try to acquire write lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite();
+
+    //! Try to acquire read lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadFor(const Timespan& timespan);
+    //! Try to acquire write lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteFor(const Timespan& timespan);
+    //! Try to acquire read lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadUntil(const UtcTimestamp& timestamp)
+    { return TryLockReadFor(timestamp - UtcTimestamp()); }
+    //! Try to acquire write lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteUntil(const UtcTimestamp& timestamp)
+    { return TryLockWriteFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire read lock with block
+    /*!
+        Will block.
+    */
+    void LockRead();
+    //! Acquire write lock with block
+    /*!
+        Will block.
+    */
+    void LockWrite();
+
+    //! Release read lock
+    /*!
+        Will not block.
+    */
+    void UnlockRead() noexcept;
+    //! Release write lock
+    /*!
+        Will not block.
+    */
+    void UnlockWrite();
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 160;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example threads_named_distributed_rw_lock.cpp Named distributed reader-biased read/write lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_NAMED_DISTRIBUTED_RW_LOCK_H
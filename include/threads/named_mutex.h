@@ -12,6 +12,7 @@
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -22,6 +23,21 @@ namespace CppCommon {
     Named mutex behaves as a simple mutex but could be shared between processes
     on the same machine.
 
+    On Linux the mutex is a robust process shared mutex in the shared memory
+    built on kernel robust futexes: the mutex word keeps the owner thread id,
+    uncontended lock and unlock perform one atomic operation without system
+    calls, contended lock spins for a while and then blocks on the futex. If
+    the owner thread or process dies, the kernel marks the mutex with the
+    owner died flag, one of waiters takes over the mutex and abandoned()
+    becomes true, so the caller could repair the shared state protected by
+    the mutex. Only the owner thread might unlock the mutex. Windows reports
+    WAIT_ABANDONED of the named kernel mutex in the same way.
+
+    Other Unix systems have no kernel robust futexes, so the mutex word keeps
+    the owner process id and waiters check the owner process liveness every
+    100 milliseconds. The fallback does not detect the dead owner thread and
+    is unreliable with reused process ids or process id namespaces.
+
     Thread-safe.
 
     \see Mutex
@@ -32,8 +48,9 @@ public:
     //! Default class constructor
     /*!
         \param name - Mutex name
+        \param spin - Count of spin iterations before blocking (default is 1000)
     */
-    explicit NamedMutex(const std::string& name);
+    explicit NamedMutex(const std::string& name, uint32_t spin = 1000);
     NamedMutex(const NamedMutex&) = delete;
     NamedMutex(NamedMutex&& mutex) = delete;
     ~NamedMutex();
@@ -43,6 +60,11 @@ public:
 
     //! Get the mutex name
     const std::string& name() const;
+    //! Get the count of spin iterations before blocking
+    uint32_t spin() const noexcept;
+
+    //! Was the mutex abandoned by the dead owner before the last successful lock?
+    bool abandoned() const noexcept;
 
     //! Try to acquire mutex without block
     /*!
@@ -88,7 +110,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 136;
+    static const size_t StorageSize = 168;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
@@ -12,6 +12,7 @@
 #include "threads/locker.h"
 #include "time/timestamp.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -22,6 +23,11 @@ namespace CppCommon {
     Named semaphore behaves as a simple semaphore but could be shared between processes
     on the same machine.
 
+    On Unix systems the resources counter is a single atomic word in the
+    shared memory. Uncontended lock and unlock perform one atomic operation
+    without system calls, contended lock spins for a while and then blocks
+    on the shared futex.
+
     Thread-safe.
 
     \see Semaphore
@@ -33,8 +39,9 @@ public:
     /*!
         \param name - Semaphore name
         \param resources - Semaphore resources counter
+        \param spin - Count of spin iterations before blocking (default is 1000)
     */
-    explicit NamedSemaphore(const std::string& name, int resources);
+    explicit NamedSemaphore(const std::string& name, int resources, uint32_t spin = 1000);
     NamedSemaphore(const NamedSemaphore&) = delete;
     NamedSemaphore(NamedSemaphore&& semaphore) = delete;
     ~NamedSemaphore();
@@ -46,6 +53,8 @@ public:
     const std::string& name() const;
     //! Get the semaphore resources counter
     int resources() const noexcept;
+    //! Get the count of spin iterations before blocking
+    uint32_t spin() const noexcept;
 
     //! Try to acquire semaphore without block
     /*!
@@ -91,7 +100,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 56;
+    static const size_t StorageSize = 168;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
@@ -0,0 +1,104 @@
+/*!
+    \file named_seq_lock.h
+    \brief Named sequential lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_NAMED_SEQ_LOCK_H
+#define CPPCOMMON_THREADS_NAMED_SEQ_LOCK_H
+
+#include "system/shared_type.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Shared sequential lock structure
+template <typename T>
+struct NamedSeqLockData
+{
+    alignas(128) std::atomic<uint64_t> seq;
+    T data;
+
+    NamedSeqLockData() : seq(0), data() {}
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Named sequential lock synchronization primitive
+/*!
+    Named sequential lock behaves as a SeqLock but could be shared between
+    processes on the same machine. The data is kept in the shared memory next
+    to the sequence counter, so readers never write shared memory and small
+    POD payloads (e.g. configuration or market data snapshots) are read by
+    any count of processes without contention.
+
+    Writers exclude each other with the odd sequence counter value, so the
+    sequential lock might have multiple writer processes.
+
+    Thread-safe.
+
+    \see SeqLock
+*/
+template <typename T>
+class NamedSeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Named sequential lock data must be trivially copyable!");
+
+public:
+    //! Default class constructor
+    /*!
+        \param name - Sequential lock name
+    */
+    explicit NamedSeqLock(const std::string& name) : _shared(name) {}
+    NamedSeqLock(const NamedSeqLock&) = delete;
+    NamedSeqLock(NamedSeqLock&&) = delete;
+    ~NamedSeqLock() = default;
+
+    NamedSeqLock& operator=(const T& data) noexcept;
+    NamedSeqLock& operator=(const NamedSeqLock&) = delete;
+    NamedSeqLock& operator=(NamedSeqLock&&) = delete;
+
+    //! Get the sequential lock name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the current sequence number (even if there is no active writer)
+    uint64_t sequence() const noexcept { return _shared->seq.load(std::memory_order_acquire); }
+
+    //! Read data under the sequential lock
+    /*!
+        Will block in a spin loop.
+
+        \return Read data
+    */
+    T Read() const noexcept;
+
+    //! Write data under the sequential lock
+    /*!
+        Will block in a spin loop while another process writes the data.
+
+        \param data - Data to write
+    */
+    void Write(const T& data) noexcept;
+
+private:
+    SharedType<Internals::NamedSeqLockData<T>> _shared;
+};
+
+/*! \example threads_named_seq_lock.cpp Named sequential lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "named_seq_lock.inl"
+
+#endif // CPPCOMMON_THREADS_NAMED_SEQ_LOCK_H
@@ -0,0 +1,61 @@
+/*!
+    \file named_seq_lock.inl
+    \brief Named sequential lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline NamedSeqLock<T>& NamedSeqLock<T>::operator=(const T& data) noexcept
+{
+    Write(data);
+    return *this;
+}
+
+template <typename T>
+inline T NamedSeqLock<T>::Read() const noexcept
+{
+    const Internals::NamedSeqLockData<T>& shared = *_shared;
+
+    T data;
+    uint64_t seq0;
+    uint64_t seq1;
+
+    do
+    {
+        seq0 = shared.seq.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::memcpy((void*)&data, (const void*)&shared.data, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seq1 = shared.seq.load(std::memory_order_relaxed);
+        if ((seq0 != seq1) || (seq0 & 1))
+            Thread::Pause();
+    } while ((seq0 != seq1) || (seq0 & 1));
+
+    return data;
+}
+
+template <typename T>
+inline void NamedSeqLock<T>::Write(const T& data) noexcept
+{
+    Internals::NamedSeqLockData<T>& shared = *_shared;
+
+    // Acquire the writer ownership with the odd sequence number
+    uint64_t seq0 = shared.seq.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (((seq0 & 1) == 0) && shared.seq.compare_exchange_weak(seq0, seq0 + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            break;
+        Thread::Pause();
+        seq0 = shared.seq.load(std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy((void*)&shared.data, (const void*)&data, sizeof(T));
+    shared.seq.store(seq0 + 2, std::memory_order_release);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,86 @@
+/*!
+    \file named_wait_strategy.h
+    \brief Named wait strategy for inter-process lock-free data structures definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_NAMED_WAIT_STRATEGY_H
+#define CPPCOMMON_THREADS_NAMED_WAIT_STRATEGY_H
+
+#include "threads/named_event_auto_reset.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace CppCommon {
+
+//! Named spin-then-block wait strategy
+/*!
+    Named wait strategy behaves as a BlockingWaitStrategy but could be shared
+    between processes on the same machine. The waiters counter is placed in
+    the shared memory of the data structure and blocked threads are parked on
+    the named auto-reset event.
+
+    Notification costs one full memory fence and one load of the shared
+    waiters counter while nobody waits. The named event is signaled only if
+    there are blocked threads.
+
+    Thread-safe.
+
+    \see BlockingWaitStrategy
+*/
+class NamedWaitStrategy
+{
+public:
+    //! Default class constructor
+    /*!
+        \param name - Wait strategy name
+        \param waiters - Waiters counter placed in the shared memory
+        \param spin - Count of spin iterations before blocking (default is 1024)
+    */
+    explicit NamedWaitStrategy(const std::string& name, std::atomic<uint32_t>& waiters, int spin = 1024) : _spin(spin), _waiters(waiters), _event(name) {}
+    NamedWaitStrategy(const NamedWaitStrategy&) = delete;
+    NamedWaitStrategy(NamedWaitStrategy&&) = delete;
+    ~NamedWaitStrategy() = default;
+
+    NamedWaitStrategy& operator=(const NamedWaitStrategy&) = delete;
+    NamedWaitStrategy& operator=(NamedWaitStrategy&&) = delete;
+
+    //! Get the wait strategy name
+    const std::string& name() const { return _event.name(); }
+    //! Get the count of spin iterations before blocking
+    int spin() const noexcept { return _spin; }
+    //! Get the count of blocked threads in all processes
+    uint32_t waiters() const noexcept { return _waiters.load(std::memory_order_relaxed); }
+
+    //! Wait until the given condition becomes true
+    /*!
+        Will block.
+
+        \param condition - Wait condition functor which returns 'true' to stop waiting
+    */
+    template <class TCondition>
+    void Wait(TCondition&& condition);
+
+    //! Notify waiting threads about the condition change
+    /*!
+        Will not block.
+    */
+    void Notify();
+
+private:
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared waiters counter must be lock-free!");
+
+    int _spin;
+    std::atomic<uint32_t>& _waiters;
+    NamedEventAutoReset _event;
+};
+
+} // namespace CppCommon
+
+#include "named_wait_strategy.inl"
+
+#endif // CPPCOMMON_THREADS_NAMED_WAIT_STRATEGY_H
@@ -0,0 +1,50 @@
+/*!
+    \file named_wait_strategy.inl
+    \brief Named wait strategy for inter-process lock-free data structures inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TCondition>
+inline void NamedWaitStrategy::Wait(TCondition&& condition)
+{
+    // Spin for a while
+    for (int i = 0; i < _spin; ++i)
+        if (condition())
+            return;
+
+    for (;;)
+    {
+        // Publish the waiter and check the condition again. Pairs with the fence
+        // in Notify(): either the notifier sees the waiter or we see the change.
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (condition())
+        {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Block until the named event is signaled
+        _event.Wait();
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+
+        if (condition())
+            return;
+    }
+}
+
+inline void NamedWaitStrategy::Notify()
+{
+    // Pairs with the fence in Wait()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Signal the named event only if there are blocked threads
+    if (_waiters.load(std::memory_order_relaxed) > 0)
+        _event.Signal();
+}
+
+} // namespace CppCommon
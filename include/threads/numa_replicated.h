@@ -0,0 +1,186 @@
+/*!
+    \file numa_replicated.h
+    \brief NUMA-replicated read-mostly data definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_NUMA_REPLICATED_H
+#define CPPCOMMON_THREADS_NUMA_REPLICATED_H
+
+#include "memory/allocator_huge_page.h"
+#include "system/cpu_topology.h"
+#include "threads/memory_reclamation.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CppCommon {
+
+//! NUMA-replicated read-mostly data
+/*!
+    NUMA-replicated data keeps one copy of the value per NUMA node, so
+    readers on every node access the local memory only and never share cache
+    lines of the value with readers on other nodes. It is suitable for large
+    read-mostly data which is read by many threads on all nodes and rarely
+    updated (e.g. routing, pricing or configuration tables).
+
+    Each replica is allocated with the huge page memory manager bound to its
+    NUMA node and is copy-constructed by the writer thread temporarily pinned
+    to the CPUs of the node, so the own memory allocations of the value (e.g.
+    container buffers) are first-touched on the same node. Readers find the
+    replica of their node with the current CPU index and the CPU topology
+    (see CPUTopology::Current()).
+
+    Updates are published in RCU (read-copy-update) style: the writer builds
+    new replicas on all nodes and atomically swaps them one by one. Readers
+    access replicas under the epoch-based reclamation guard of their node,
+    so old replicas are freed only after all readers which could observe
+    them have left. Readers are never blocked, but may observe the previous
+    value on some nodes while the update is in progress.
+
+    Each replica is rounded up to the huge page size, so the value should be
+    large enough to justify it. On systems without NUMA a single replica is
+    kept and nothing is pinned.
+
+    NUMA nodes are indexed as in CPUTopology::nodes().
+
+    Thread-safe.
+*/
+template <typename T>
+class NumaReplicated
+{
+    struct Node;
+
+public:
+    //! NUMA-replicated data read guard
+    /*!
+        Read guard provides access to the replica of the current NUMA node
+        and keeps it alive for the guard lifetime, so it should be created
+        on the stack and must not be shared with other threads. Guards should
+        be short-lived, because a stalled guard delays reclamation of old
+        replicas of its node.
+
+        Not thread-safe.
+    */
+    class Guard
+    {
+    public:
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard() = default;
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        //! Get the NUMA node of the replica
+        int node() const noexcept { return _node; }
+
+        //! Access to the replica
+        const T& operator*() const noexcept { return *_value; }
+        const T* operator->() const noexcept { return _value; }
+
+    private:
+        typename EpochReclamation<HugePageMemoryManager>::Guard _guard;
+        int _node;
+        const T* _value;
+
+        Guard(Node& node, int index) : _guard(node.domain), _node(index), _value(node.value.load(std::memory_order_acquire)) {}
+
+        friend class NumaReplicated<T>;
+    };
+
+    //! Initialize NUMA-replicated data with the given value
+    /*!
+        \param value - Initial value (default is T())
+    */
+    explicit NumaReplicated(const T& value = T());
+    NumaReplicated(const NumaReplicated&) = delete;
+    NumaReplicated(NumaReplicated&&) = delete;
+    ~NumaReplicated();
+
+    NumaReplicated& operator=(const NumaReplicated&) = delete;
+    NumaReplicated& operator=(NumaReplicated&&) = delete;
+
+    //! Get the count of replicas (NUMA nodes)
+    size_t replicas() const noexcept { return _nodes.size(); }
+    //! Get the count of published values (including the initial one)
+    uint64_t version() const noexcept { return _version.load(std::memory_order_acquire); }
+    //! Get the count of old replicas which are not freed yet
+    size_t retired() const noexcept;
+
+    //! Read the replica of the current NUMA node
+    /*!
+        Lock-free. Current NUMA node is found once per call, so the guard
+        could refer to the remote replica after the thread migration.
+
+        \return Read guard of the replica
+    */
+    Guard Read() const { return Read(CurrentNode()); }
+    //! Read the replica of the given NUMA node
+    /*!
+        Lock-free.
+
+        \param node - NUMA node index
+        \return Read guard of the replica
+    */
+    Guard Read(int node) const;
+
+    //! Load the copy of the replica of the current NUMA node
+    T Load() const { Guard guard = Read(); return *guard; }
+
+    //! Store the new value into all replicas
+    /*!
+        Will block until other updates are finished.
+
+        \param value - Value to store
+    */
+    void Store(const T& value);
+
+    //! Update the value of all replicas with the given function
+    /*!
+        The function is called with the mutable copy of the current value,
+        the modified copy is stored into all replicas. Will block until other
+        updates are finished.
+
+        \param updater - Updater function with the signature 'void (T&)'
+    */
+    template <typename TUpdater>
+    void Update(TUpdater&& updater);
+
+    //! Try to free old replicas which are not used by readers anymore
+    void Reclaim();
+
+    //! Get the NUMA node of the current CPU
+    int CurrentNode() const noexcept;
+
+private:
+    struct alignas(128) Node
+    {
+        HugePageMemoryManager manager;
+        EpochReclamation<HugePageMemoryManager> domain;
+        std::atomic<T*> value;
+        CPUSet cpus;
+
+        Node(int index, const CPUSet& set) : manager(index), domain(manager, 1), value(nullptr), cpus(set) {}
+    };
+
+    std::vector<std::unique_ptr<Node>> _nodes;
+    std::vector<int> _cpu_nodes;
+    std::atomic<uint64_t> _version;
+    std::mutex _lock;
+
+    void Publish(const T& value);
+};
+
+/*! \example threads_numa_replicated.cpp NUMA-replicated read-mostly data example */
+
+} // namespace CppCommon
+
+#include "numa_replicated.inl"
+
+#endif // CPPCOMMON_THREADS_NUMA_REPLICATED_H
@@ -0,0 +1,151 @@
+/*!
+    \file numa_replicated.inl
+    \brief NUMA-replicated read-mostly data inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline NumaReplicated<T>::NumaReplicated(const T& value) : _version(0)
+{
+    const CPUTopology& topology = CPUTopology::Current();
+
+    // Single replica is not bound and not pinned
+    const std::vector<CPUSet>& nodes = topology.nodes();
+    if (nodes.size() > 1)
+    {
+        for (size_t i = 0; i < nodes.size(); ++i)
+            _nodes.push_back(std::make_unique<Node>((int)i, nodes[i]));
+    }
+    else
+        _nodes.push_back(std::make_unique<Node>(-1, topology.online()));
+
+    // Map logical CPUs to NUMA nodes
+    for (const auto& location : topology.cpus())
+    {
+        if (location.cpu >= (int)_cpu_nodes.size())
+            _cpu_nodes.resize(location.cpu + 1, 0);
+        _cpu_nodes[location.cpu] = ((location.node >= 0) && (location.node < (int)_nodes.size())) ? location.node : 0;
+    }
+
+    Publish(value);
+}
+
+template <typename T>
+inline NumaReplicated<T>::~NumaReplicated()
+{
+    // Old replicas are freed by reclamation domains, no guards should exist at this point
+    for (auto& node : _nodes)
+        node->domain.Destroy(node->value.exchange(nullptr, std::memory_order_acq_rel));
+}
+
+template <typename T>
+inline size_t NumaReplicated<T>::retired() const noexcept
+{
+    size_t result = 0;
+    for (const auto& node : _nodes)
+        result += node->domain.retired();
+    return result;
+}
+
+template <typename T>
+inline typename NumaReplicated<T>::Guard NumaReplicated<T>::Read(int node) const
+{
+    if ((node < 0) || (node >= (int)_nodes.size()))
+        node = 0;
+
+    return Guard(*_nodes[node], node);
+}
+
+template <typename T>
+inline void NumaReplicated<T>::Store(const T& value)
+{
+    std::scoped_lock locker(_lock);
+
+    Publish(value);
+}
+
+template <typename T>
+template <typename TUpdater>
+inline void NumaReplicated<T>::Update(TUpdater&& updater)
+{
+    std::scoped_lock locker(_lock);
+
+    // Copy the current value, the writer lock prevents concurrent updates
+    T value(*_nodes.front()->value.load(std::memory_order_acquire));
+    updater(value);
+
+    Publish(value);
+}
+
+template <typename T>
+inline void NumaReplicated<T>::Reclaim()
+{
+    // Retired replicas are freed after two epoch advances
+    for (auto& node : _nodes)
+    {
+        node->domain.Reclaim();
+        node->domain.Reclaim();
+    }
+}
+
+template <typename T>
+inline int NumaReplicated<T>::CurrentNode() const noexcept
+{
+    uint32_t cpu = Thread::CurrentThreadAffinity();
+    return (cpu < _cpu_nodes.size()) ? _cpu_nodes[cpu] : 0;
+}
+
+template <typename T>
+inline void NumaReplicated<T>::Publish(const T& value)
+{
+    // Pin the writer thread to CPUs of each node, so replicas are first-touched locally
+    bool pinned = false;
+    CPUSet affinity;
+    if (_nodes.size() > 1)
+    {
+        try
+        {
+            affinity = Thread::GetAffinitySet();
+            pinned = true;
+        }
+        catch (...) {}
+    }
+
+    try
+    {
+        for (auto& node : _nodes)
+        {
+            if (pinned)
+            {
+                try { Thread::SetAffinity(node->cpus); } catch (...) {}
+            }
+
+            // Publish the new replica and retire the old one after the grace period
+            T* replica = node->domain.template Create<T>(value);
+            T* old = node->value.exchange(replica, std::memory_order_acq_rel);
+            if (old != nullptr)
+                node->domain.Retire(old);
+        }
+    }
+    catch (...)
+    {
+        if (pinned)
+        {
+            try { Thread::SetAffinity(affinity); } catch (...) {}
+        }
+        throw;
+    }
+
+    if (pinned)
+    {
+        try { Thread::SetAffinity(affinity); } catch (...) {}
+    }
+
+    _version.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace CppCommon
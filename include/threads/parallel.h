@@ -0,0 +1,142 @@
+/*!
+    \file parallel.h
+    \brief Parallel algorithms definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_PARALLEL_H
+#define CPPCOMMON_THREADS_PARALLEL_H
+
+#include "system/cpu_topology.h"
+#include "threads/thread.h"
+#include "threads/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace CppCommon {
+
+//! Parallel algorithms options
+struct ParallelOptions
+{
+    //! Count of elements processed by one chunk (default is 0 - automatic grain size)
+    size_t grain{0};
+    //! Maximal count of threads, including the calling thread (default is 0 - all workers of the thread pool and the calling thread)
+    size_t concurrency{0};
+    //! Limit the concurrency with the count of physical cores, so SMT siblings do not compete for caches of the same core (default is false)
+    bool physical{false};
+};
+
+//! Parallel for loop
+/*!
+    Calls the function for each index in range [first, last) with workers of
+    the thread pool and the calling thread.
+
+    The range is split into chunks of the grain size, and chunks are split
+    into contiguous segments, one segment per thread. Each thread processes
+    chunks of its own segment in order, so it walks the contiguous memory
+    (hardware prefetch friendly, NUMA first-touch placement with pinned
+    workers), and then steals chunks from segments of other threads to
+    balance the load. The automatic grain size gives about 8 chunks for each
+    thread.
+
+    The calling thread always takes part in the loop and does not depend on
+    free workers, so parallel algorithms could be nested (called from tasks
+    of the same thread pool). If the function throws an exception remaining
+    chunks are skipped and the first exception is rethrown in the calling
+    thread.
+
+    \param pool - Thread pool
+    \param first - First index
+    \param last - Last index (not included)
+    \param function - Function to call for each index: void function(TIndex index)
+    \param options - Parallel options (default is ParallelOptions())
+*/
+template <typename TIndex, class TFunction>
+void ParallelFor(ThreadPool& pool, TIndex first, TIndex last, TFunction&& function, const ParallelOptions& options = ParallelOptions());
+
+//! Parallel for loop over chunks
+/*!
+    Calls the function for each chunk of range [first, last). Works like
+    ParallelFor(), but allows to process the chunk with a tight loop.
+
+    \param pool - Thread pool
+    \param first - First index
+    \param last - Last index (not included)
+    \param function - Function to call for each chunk: void function(TIndex begin, TIndex end)
+    \param options - Parallel options (default is ParallelOptions())
+*/
+template <typename TIndex, class TFunction>
+void ParallelForRange(ThreadPool& pool, TIndex first, TIndex last, TFunction&& function, const ParallelOptions& options = ParallelOptions());
+
+//! Parallel reduce
+/*!
+    Reduces range [first, last) with the associative reduce operation. Each
+    chunk is reduced separately starting from its first element and chunk
+    results are combined with the initial value in the order of chunks, so
+    the result is deterministic for the given grain size even for
+    non-commutative operations. The reduce operation must accept both range
+    values and chunk results.
+
+    \param pool - Thread pool
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param init - Initial value
+    \param reduce - Associative reduce operation: T reduce(const T& accumulator, const value_type& value)
+    \param options - Parallel options (default is ParallelOptions())
+    \return Reduced value
+*/
+template <typename TIterator, typename T, class TReduce = std::plus<>>
+T ParallelReduce(ThreadPool& pool, TIterator first, TIterator last, T init, TReduce reduce = TReduce(), const ParallelOptions& options = ParallelOptions());
+
+//! Parallel sort
+/*!
+    Sorts range [first, last) with the given comparator. The range is split
+    into blocks sorted in parallel with std::sort(), then sorted blocks are
+    merged pairwise in parallel rounds with std::inplace_merge(). The sort is
+    not stable.
+
+    \param pool - Thread pool
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param compare - Comparator (default is std::less<>())
+    \param options - Parallel options (default is ParallelOptions())
+*/
+template <typename TIterator, class TCompare = std::less<>>
+void ParallelSort(ThreadPool& pool, TIterator first, TIterator last, TCompare compare = TCompare(), const ParallelOptions& options = ParallelOptions());
+
+//! Parallel inclusive scan (prefix sum)
+/*!
+    Writes init op x[0] op ... op x[i] into output[i] for each element of
+    range [first, last) with the associative operation. The input is scanned
+    twice: the first pass reduces chunks, the second pass scans chunks with
+    prefixes of preceding chunks. The operation must accept both range values
+    and chunk results. Output range could be the input range.
+
+    \param pool - Thread pool
+    \param first - First random access iterator
+    \param last - Last random access iterator
+    \param output - First random access output iterator
+    \param init - Initial value
+    \param op - Associative operation: T op(const T& accumulator, const value_type& value)
+    \param options - Parallel options (default is ParallelOptions())
+    \return Output iterator past the last written element
+*/
+template <typename TIterator, typename TOutputIterator, typename T, class TOperation = std::plus<>>
+TOutputIterator ParallelScan(ThreadPool& pool, TIterator first, TIterator last, TOutputIterator output, T init, TOperation op = TOperation(), const ParallelOptions& options = ParallelOptions());
+
+/*! \example threads_parallel.cpp Parallel algorithms example */
+
+} // namespace CppCommon
+
+#include "parallel.inl"
+
+#endif // CPPCOMMON_THREADS_PARALLEL_H
@@ -0,0 +1,300 @@
+/*!
+    \file parallel.inl
+    \brief Parallel algorithms inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Parallel loop plan
+struct ParallelPlan
+{
+    size_t count;       // Count of elements
+    size_t grain;       // Count of elements in the chunk
+    size_t chunks;      // Count of chunks
+    size_t threads;     // Count of threads including the calling thread
+};
+
+// Plan the parallel loop with the minimal automatic grain size
+inline ParallelPlan PlanParallel(const ThreadPool& pool, size_t count, const ParallelOptions& options, size_t minimal)
+{
+    size_t threads = (options.concurrency > 0) ? options.concurrency : (pool.threads() + 1);
+    if (options.physical)
+        threads = std::min(threads, std::max(CPUTopology::Current().cores().size(), (size_t)1));
+    if (pool.stopped())
+        threads = 1;
+    threads = std::max(threads, (size_t)1);
+
+    ParallelPlan plan;
+    plan.count = count;
+    plan.grain = (options.grain > 0) ? options.grain : std::max(count / (threads * 8), minimal);
+    plan.chunks = (count + plan.grain - 1) / plan.grain;
+    plan.threads = std::max(std::min(threads, plan.chunks), (size_t)1);
+    return plan;
+}
+
+// Parallel loop job shared by the calling thread and workers
+template <class TBody>
+class ParallelJob
+{
+public:
+    ParallelJob(const ParallelPlan& plan, TBody& body)
+        : _plan(plan),
+          _body(body),
+          _segments(std::make_unique<Segment[]>(plan.threads)),
+          _completed(0),
+          _failed(false)
+    {
+        // Split chunks into contiguous segments, one segment per thread
+        for (size_t i = 0; i < plan.threads; ++i)
+        {
+            _segments[i].cursor.store(plan.chunks * i / plan.threads, std::memory_order_relaxed);
+            _segments[i].end = plan.chunks * (i + 1) / plan.threads;
+        }
+    }
+
+    // Process chunks of the given segment and then steal chunks of other segments
+    void Run(size_t segment) noexcept
+    {
+        for (size_t i = 0; i < _plan.threads; ++i)
+        {
+            Segment& current = _segments[(segment + i) % _plan.threads];
+            for (;;)
+            {
+                // Chunks are claimed from the segment cursor, so late workers
+                // never touch the body after all chunks are completed
+                size_t chunk = current.cursor.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= current.end)
+                    break;
+
+                if (!_failed.load(std::memory_order_relaxed))
+                {
+                    size_t begin = chunk * _plan.grain;
+                    size_t end = std::min(begin + _plan.grain, _plan.count);
+                    try
+                    {
+                        _body(chunk, begin, end);
+                    }
+                    catch (...)
+                    {
+                        if (!_failed.exchange(true, std::memory_order_relaxed))
+                            _exception = std::current_exception();
+                    }
+                }
+
+                _completed.fetch_add(1, std::memory_order_release);
+            }
+        }
+    }
+
+    // Wait for all chunks are completed and rethrow the first exception
+    void Wait()
+    {
+        for (size_t spins = 0; _completed.load(std::memory_order_acquire) < _plan.chunks; ++spins)
+        {
+            if (spins < 64)
+                Thread::Pause();
+            else
+                Thread::Yield();
+        }
+
+        if (_exception)
+            std::rethrow_exception(_exception);
+    }
+
+private:
+    // Segment of chunks placed on its own cache line
+    struct alignas(128) Segment
+    {
+        std::atomic<size_t> cursor;
+        size_t end;
+    };
+
+    ParallelPlan _plan;
+    TBody& _body;
+    std::unique_ptr<Segment[]> _segments;
+    std::atomic<size_t> _completed;
+    std::atomic<bool> _failed;
+    std::exception_ptr _exception;
+};
+
+// Execute the body for all chunks of the plan: void body(size_t chunk, size_t begin, size_t end)
+template <class TBody>
+inline void ParallelExecute(ThreadPool& pool, const ParallelPlan& plan, TBody& body)
+{
+    if (plan.count == 0)
+        return;
+
+    // Execute all chunks in the calling thread
+    if (plan.threads <= 1)
+    {
+        for (size_t chunk = 0; chunk < plan.chunks; ++chunk)
+        {
+            size_t begin = chunk * plan.grain;
+            body(chunk, begin, std::min(begin + plan.grain, plan.count));
+        }
+        return;
+    }
+
+    // Segments of not posted tasks will be stolen by other threads
+    auto job = std::make_shared<ParallelJob<TBody>>(plan, body);
+    for (size_t i = 1; i < plan.threads; ++i)
+        pool.Post([job, i]() { job->Run(i); });
+
+    // Calling thread takes part in the loop
+    job->Run(0);
+    job->Wait();
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename TIndex, class TFunction>
+inline void ParallelFor(ThreadPool& pool, TIndex first, TIndex last, TFunction&& function, const ParallelOptions& options)
+{
+    if (!(first < last))
+        return;
+
+    auto plan = Internals::PlanParallel(pool, (size_t)(last - first), options, 1);
+    auto body = [first, &function](size_t, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+            function((TIndex)(first + i));
+    };
+    Internals::ParallelExecute(pool, plan, body);
+}
+
+template <typename TIndex, class TFunction>
+inline void ParallelForRange(ThreadPool& pool, TIndex first, TIndex last, TFunction&& function, const ParallelOptions& options)
+{
+    if (!(first < last))
+        return;
+
+    auto plan = Internals::PlanParallel(pool, (size_t)(last - first), options, 1);
+    auto body = [first, &function](size_t, size_t begin, size_t end)
+    {
+        function((TIndex)(first + begin), (TIndex)(first + end));
+    };
+    Internals::ParallelExecute(pool, plan, body);
+}
+
+template <typename TIterator, typename T, class TReduce>
+inline T ParallelReduce(ThreadPool& pool, TIterator first, TIterator last, T init, TReduce reduce, const ParallelOptions& options)
+{
+    size_t count = (size_t)std::distance(first, last);
+    if (count == 0)
+        return init;
+
+    auto plan = Internals::PlanParallel(pool, count, options, 1024);
+
+    // Reduce each chunk separately
+    std::vector<std::optional<T>> partials(plan.chunks);
+    auto body = [first, &reduce, &partials](size_t chunk, size_t begin, size_t end)
+    {
+        TIterator it = first + begin;
+        T accumulator = *it;
+        for (size_t i = begin + 1; i < end; ++i)
+            accumulator = reduce(std::move(accumulator), *(++it));
+        partials[chunk].emplace(std::move(accumulator));
+    };
+    Internals::ParallelExecute(pool, plan, body);
+
+    // Combine chunk results in order
+    for (auto& partial : partials)
+        init = reduce(std::move(init), std::move(*partial));
+    return init;
+}
+
+template <typename TIterator, class TCompare>
+inline void ParallelSort(ThreadPool& pool, TIterator first, TIterator last, TCompare compare, const ParallelOptions& options)
+{
+    size_t count = (size_t)std::distance(first, last);
+    auto plan = Internals::PlanParallel(pool, count, options, 4096);
+    if (plan.threads <= 1)
+    {
+        std::sort(first, last, compare);
+        return;
+    }
+
+    // Split the range into blocks, one block per thread
+    size_t blocks = plan.threads;
+    std::vector<size_t> bounds(blocks + 1);
+    for (size_t i = 0; i <= blocks; ++i)
+        bounds[i] = count * i / blocks;
+
+    // Sort blocks in parallel
+    Internals::ParallelPlan sort_plan = { blocks, 1, blocks, plan.threads };
+    auto sort = [first, &bounds, &compare](size_t block, size_t, size_t)
+    {
+        std::sort(first + bounds[block], first + bounds[block + 1], compare);
+    };
+    Internals::ParallelExecute(pool, sort_plan, sort);
+
+    // Merge sorted blocks pairwise in parallel rounds
+    for (size_t width = 1; width < blocks; width *= 2)
+    {
+        size_t pairs = (blocks + 2 * width - 1) / (2 * width);
+        Internals::ParallelPlan merge_plan = { pairs, 1, pairs, std::min(plan.threads, pairs) };
+        auto merge = [first, &bounds, &compare, blocks, width](size_t pair, size_t, size_t)
+        {
+            size_t left = pair * 2 * width;
+            size_t middle = left + width;
+            if (middle >= blocks)
+                return;
+            size_t right = std::min(left + 2 * width, blocks);
+            std::inplace_merge(first + bounds[left], first + bounds[middle], first + bounds[right], compare);
+        };
+        Internals::ParallelExecute(pool, merge_plan, merge);
+    }
+}
+
+template <typename TIterator, typename TOutputIterator, typename T, class TOperation>
+inline TOutputIterator ParallelScan(ThreadPool& pool, TIterator first, TIterator last, TOutputIterator output, T init, TOperation op, const ParallelOptions& options)
+{
+    size_t count = (size_t)std::distance(first, last);
+    if (count == 0)
+        return output;
+
+    auto plan = Internals::PlanParallel(pool, count, options, 1024);
+
+    // Reduce each chunk separately
+    std::vector<std::optional<T>> prefixes(plan.chunks);
+    auto reduce = [first, &op, &prefixes](size_t chunk, size_t begin, size_t end)
+    {
+        TIterator it = first + begin;
+        T accumulator = *it;
+        for (size_t i = begin + 1; i < end; ++i)
+            accumulator = op(std::move(accumulator), *(++it));
+        prefixes[chunk].emplace(std::move(accumulator));
+    };
+    Internals::ParallelExecute(pool, plan, reduce);
+
+    // Calculate exclusive prefixes of chunks
+    for (auto& prefix : prefixes)
+    {
+        T sum = op(init, std::move(*prefix));
+        prefix.emplace(std::move(init));
+        init = std::move(sum);
+    }
+
+    // Scan each chunk with its prefix
+    auto scan = [first, output, &op, &prefixes](size_t chunk, size_t begin, size_t end)
+    {
+        T accumulator = std::move(*prefixes[chunk]);
+        for (size_t i = begin; i < end; ++i)
+        {
+            accumulator = op(std::move(accumulator), first[i]);
+            output[i] = accumulator;
+        }
+    };
+    Internals::ParallelExecute(pool, plan, scan);
+
+    return output + count;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,201 @@
+/*!
+    \file sharded_counter.h
+    \brief Per-CPU sharded counter and gauge definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARDED_COUNTER_H
+#define CPPCOMMON_THREADS_SHARDED_COUNTER_H
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+namespace Internals {
+
+//! Per-CPU sharded slots
+/*!
+    Keeps signed values in per-CPU slots placed on separate cache lines.
+    The slot of the current CPU core is found with sched_getcpu() on Linux
+    (served from the restartable sequences area by the modern glibc without
+    a system call) and GetCurrentProcessorNumber() on Windows. On platforms
+    without the current CPU core query threads are spread over slots by
+    their identifiers.
+
+    Thread-safe.
+*/
+class ShardedSlots
+{
+public:
+    explicit ShardedSlots(size_t slots);
+    ShardedSlots(const ShardedSlots&) = delete;
+    ShardedSlots(ShardedSlots&&) = delete;
+    ~ShardedSlots() = default;
+
+    ShardedSlots& operator=(const ShardedSlots&) = delete;
+    ShardedSlots& operator=(ShardedSlots&&) = delete;
+
+    //! Get the count of slots
+    size_t slots() const noexcept { return _mask + 1; }
+
+    //! Add the value to the slot of the current CPU core
+    void Add(int64_t value) noexcept
+    { CurrentSlot().value.fetch_add(value, std::memory_order_relaxed); }
+
+    //! Get the sum of all slots
+    int64_t Sum() const noexcept;
+    //! Reset all slots to zero
+    void Reset() noexcept;
+
+    //! Get the shard index of the current CPU core (should be masked with the count of shards)
+    static size_t CurrentIndex() noexcept;
+
+private:
+    // Value slot placed on its own cache line
+    struct alignas(128) Slot
+    {
+        std::atomic<int64_t> value;
+    };
+
+    size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    //! Get the slot of the current CPU core
+    Slot& CurrentSlot() noexcept;
+};
+
+} // namespace Internals
+
+//! Per-CPU sharded counter
+/*!
+    Sharded counter is a monotonic statistics counter (operations, hits,
+    misses, allocations) designed for hot paths updated from many threads.
+    Increment is a single relaxed atomic add to the slot of the current CPU
+    core, so threads on different CPU cores never write the same cache line
+    and increment cost does not depend on the count of threads. Read sums
+    all slots and could be done concurrently with increments, the result is
+    not a linearizable snapshot.
+
+    Counter takes a cache line for each slot, so it is intended for a few
+    global counters rather than for a large count of fine grained objects.
+
+    Thread-safe.
+*/
+class ShardedCounter
+{
+public:
+    //! Default class constructor
+    /*!
+        \param slots - Count of slots rounded up to the power of two (default is 0 - count of logical CPU cores)
+    */
+    explicit ShardedCounter(size_t slots = 0) : _slots(slots) {}
+    ShardedCounter(const ShardedCounter&) = delete;
+    ShardedCounter(ShardedCounter&&) = delete;
+    ~ShardedCounter() = default;
+
+    ShardedCounter& operator=(const ShardedCounter&) = delete;
+    ShardedCounter& operator=(ShardedCounter&&) = delete;
+
+    //! Get the count of slots
+    size_t slots() const noexcept { return _slots.slots(); }
+    //! Get the aggregated counter value
+    uint64_t value() const noexcept { return (uint64_t)_slots.Sum(); }
+
+    //! Increment the counter
+    void Increment() noexcept { _slots.Add(1); }
+    //! Add the given value to the counter
+    /*!
+        \param value - Value to add
+    */
+    void Add(uint64_t value) noexcept { _slots.Add((int64_t)value); }
+
+    //! Reset the counter to zero
+    /*!
+        Increments concurrent with the reset could be lost.
+    */
+    void Reset() noexcept { _slots.Reset(); }
+
+    ShardedCounter& operator++() noexcept { Increment(); return *this; }
+    ShardedCounter& operator+=(uint64_t value) noexcept { Add(value); return *this; }
+
+private:
+    Internals::ShardedSlots _slots;
+};
+
+//! Per-CPU sharded gauge
+/*!
+    Sharded gauge is a statistics level (memory in use, items in queue, active
+    connections) which is increased and decreased on hot paths from many
+    threads. Gauge is updated with relaxed atomic operations on the slot of
+    the current CPU core like the sharded counter. The thread could increase
+    the gauge on one CPU core and decrease it on another one after the thread
+    migration, so slots could be negative, but the aggregated value is always
+    consistent with the completed updates.
+
+    Thread-safe.
+*/
+class ShardedGauge
+{
+public:
+    //! Default class constructor
+    /*!
+        \param slots - Count of slots rounded up to the power of two (default is 0 - count of logical CPU cores)
+    */
+    explicit ShardedGauge(size_t slots = 0) : _slots(slots) {}
+    ShardedGauge(const ShardedGauge&) = delete;
+    ShardedGauge(ShardedGauge&&) = delete;
+    ~ShardedGauge() = default;
+
+    ShardedGauge& operator=(const ShardedGauge&) = delete;
+    ShardedGauge& operator=(ShardedGauge&&) = delete;
+
+    //! Get the count of slots
+    size_t slots() const noexcept { return _slots.slots(); }
+    //! Get the aggregated gauge value
+    int64_t value() const noexcept { return _slots.Sum(); }
+
+    //! Increment the gauge
+    void Increment() noexcept { _slots.Add(1); }
+    //! Decrement the gauge
+    void Decrement() noexcept { _slots.Add(-1); }
+    //! Add the given value to the gauge
+    /*!
+        \param value - Value to add
+    */
+    void Add(int64_t value) noexcept { _slots.Add(value); }
+    //! Subtract the given value from the gauge
+    /*!
+        \param value - Value to subtract
+    */
+    void Sub(int64_t value) noexcept { _slots.Add(-value); }
+
+    //! Reset the gauge to zero
+    /*!
+        Updates concurrent with the reset could be lost.
+    */
+    void Reset() noexcept { _slots.Reset(); }
+
+    ShardedGauge& operator++() noexcept { Increment(); return *this; }
+    ShardedGauge& operator--() noexcept { Decrement(); return *this; }
+    ShardedGauge& operator+=(int64_t value) noexcept { Add(value); return *this; }
+    ShardedGauge& operator-=(int64_t value) noexcept { Sub(value); return *this; }
+
+private:
+    Internals::ShardedSlots _slots;
+};
+
+/*! \example threads_sharded_counter.cpp Per-CPU sharded counter and gauge example */
+
+} // namespace CppCommon
+
+#include "sharded_counter.inl"
+
+#endif // CPPCOMMON_THREADS_SHARDED_COUNTER_H
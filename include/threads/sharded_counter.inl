@@ -0,0 +1,61 @@
+/*!
+    \file sharded_counter.inl
+    \brief Per-CPU sharded counter and gauge inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+namespace Internals {
+
+inline ShardedSlots::ShardedSlots(size_t slots)
+{
+    if (slots == 0)
+        slots = (size_t)std::max(CPU::LogicalCores(), 1);
+
+    // Round up the count of slots to the power of two
+    size_t count = 1;
+    while (count < slots)
+        count <<= 1;
+
+    _mask = count - 1;
+    _slots = std::make_unique<Slot[]>(count);
+    for (size_t i = 0; i < count; ++i)
+        _slots[i].value.store(0, std::memory_order_relaxed);
+}
+
+inline int64_t ShardedSlots::Sum() const noexcept
+{
+    int64_t result = 0;
+    for (size_t i = 0; i <= _mask; ++i)
+        result += _slots[i].value.load(std::memory_order_relaxed);
+    return result;
+}
+
+inline void ShardedSlots::Reset() noexcept
+{
+    for (size_t i = 0; i <= _mask; ++i)
+        _slots[i].value.store(0, std::memory_order_relaxed);
+}
+
+inline size_t ShardedSlots::CurrentIndex() noexcept
+{
+#if defined(__APPLE__) || defined(__CYGWIN__)
+    // Spread threads over slots by their identifiers
+    static thread_local size_t index = (size_t)((Thread::CurrentThreadId() * 0x9E3779B97F4A7C15ull) >> 32);
+    return index;
+#else
+    return (size_t)Thread::CurrentThreadAffinity();
+#endif
+}
+
+inline ShardedSlots::Slot& ShardedSlots::CurrentSlot() noexcept
+{
+    return _slots[CurrentIndex() & _mask];
+}
+
+} // namespace Internals
+
+} // namespace CppCommon
@@ -0,0 +1,171 @@
+/*!
+    \file shared_mpsc_ring_queue.h
+    \brief Inter-process multiple producers / single consumer wait-free ring queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_MPSC_RING_QUEUE_H
+#define CPPCOMMON_THREADS_SHARED_MPSC_RING_QUEUE_H
+
+#include "system/shared_memory.h"
+#include "threads/named_wait_strategy.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Inter-process multiple producers / single consumer wait-free ring queue
+/*!
+    Inter-process multiple producers / single consumer wait-free ring queue is
+    placed in the named shared memory and could be shared between processes on
+    the same machine. The ring queue layout is position-independent: it holds
+    only cursors and slots with sequence numbers (no pointers), so each process
+    could map it at any address. Items must be trivially copyable.
+
+    Producers claim slots with a single CAS operation and publish them with
+    the slot sequence (Dmitry Vyukov's bounded queue). The single consumer
+    releases slots without atomic read-modify-write operations.
+
+    The first instance with a given name creates and initializes the ring
+    queue, other instances open it and must use the same capacity.
+
+    Enqueue() and Dequeue() never block. EnqueueWait() and DequeueWait() spin
+    for a while and then block on the named event while the ring queue is
+    full or empty.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    \see MPSCRingQueue
+    \see MPMCRingQueue
+*/
+template<typename T>
+class SharedMPSCRingQueue
+{
+public:
+    //! Create a new or open existing ring queue with a given name and capacity
+    /*!
+        \param name - Ring queue name
+        \param capacity - Ring queue capacity (must be a power of two)
+    */
+    explicit SharedMPSCRingQueue(const std::string& name, size_t capacity);
+    SharedMPSCRingQueue(const SharedMPSCRingQueue&) = delete;
+    SharedMPSCRingQueue(SharedMPSCRingQueue&&) = delete;
+    ~SharedMPSCRingQueue() = default;
+
+    SharedMPSCRingQueue& operator=(const SharedMPSCRingQueue&) = delete;
+    SharedMPSCRingQueue& operator=(SharedMPSCRingQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the ring queue name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the ring queue owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Is ring queue empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring queue capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get ring queue size
+    size_t size() const noexcept;
+
+    //! Enqueue an item into the ring queue (multiple producers threads method)
+    /*!
+        The item will be copied into the ring queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the ring queue and wait while the ring queue is full (multiple producers threads method)
+    /*!
+        The item will be copied into the ring queue.
+
+        Will block.
+
+        \param item - Item to enqueue
+    */
+    void EnqueueWait(const T& item);
+
+    //! Dequeue an item from the ring queue (single consumer thread method)
+    /*!
+        The item will be copied from the ring queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
+    */
+    bool Dequeue(T& item);
+    //! Dequeue an item from the ring queue and wait while the ring queue is empty (single consumer thread method)
+    /*!
+        The item will be copied from the ring queue.
+
+        Will block.
+
+        \param item - Item to dequeue
+    */
+    void DequeueWait(T& item);
+
+private:
+    static_assert(std::is_trivially_copyable<T>::value, "Shared ring queue items must be trivially copyable!");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "Shared ring queue cursors must be lock-free!");
+
+    typedef char cache_line_pad[128];
+
+    // Ring queue header placed at the beginning of the shared memory
+    struct Header
+    {
+        std::atomic<uint32_t> initialized;
+        uint32_t reserved;
+        size_t capacity;
+        cache_line_pad pad0;
+        std::atomic<size_t> head;
+        cache_line_pad pad1;
+        std::atomic<size_t> tail;
+        cache_line_pad pad2;
+        std::atomic<uint32_t> not_empty;
+        cache_line_pad pad3;
+        std::atomic<uint32_t> not_full;
+        cache_line_pad pad4;
+    };
+
+    // Ring queue slot
+    struct Node
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    SharedMemory _shared;
+    Header* const _header;
+    Node* const _buffer;
+    const size_t _capacity;
+    const size_t _mask;
+    NamedWaitStrategy _not_empty;
+    NamedWaitStrategy _not_full;
+
+    //! Initialize or open the ring queue header and slots
+    static Header* InitializeHeader(SharedMemory& shared, size_t capacity);
+};
+
+/*! \example threads_shared_mpsc_ring_queue.cpp Inter-process multiple producers / single consumer wait-free ring queue example */
+
+} // namespace CppCommon
+
+#include "shared_mpsc_ring_queue.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_MPSC_RING_QUEUE_H
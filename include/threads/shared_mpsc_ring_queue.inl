@@ -0,0 +1,161 @@
+/*!
+    \file shared_mpsc_ring_queue.inl
+    \brief Inter-process multiple producers / single consumer wait-free ring queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline SharedMPSCRingQueue<T>::SharedMPSCRingQueue(const std::string& name, size_t capacity)
+    : _shared(name, sizeof(Header) + capacity * sizeof(Node)),
+      _header(InitializeHeader(_shared, capacity)),
+      _buffer((Node*)((uint8_t*)_shared.ptr() + sizeof(Header))),
+      _capacity(capacity),
+      _mask(capacity - 1),
+      _not_empty(name + ".not_empty", _header->not_empty),
+      _not_full(name + ".not_full", _header->not_full)
+{
+    assert((capacity > 1) && "Ring queue capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
+}
+
+template<typename T>
+inline typename SharedMPSCRingQueue<T>::Header* SharedMPSCRingQueue<T>::InitializeHeader(SharedMemory& shared, size_t capacity)
+{
+    Header* header = (Header*)shared.ptr();
+
+    if (shared.owner())
+    {
+        // Initialize the ring queue header in place
+        new (header) Header();
+        header->capacity = capacity;
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->not_empty.store(0, std::memory_order_relaxed);
+        header->not_full.store(0, std::memory_order_relaxed);
+
+        // Populate the sequence initial values
+        Node* buffer = (Node*)((uint8_t*)shared.ptr() + sizeof(Header));
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (&buffer[i]) Node();
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        header->initialized.store(1, std::memory_order_release);
+    }
+    else
+    {
+        // Wait for the owner to initialize the ring queue header
+        while (header->initialized.load(std::memory_order_acquire) == 0)
+            Thread::Yield();
+
+        if (header->capacity != capacity)
+            throwex SystemException("Invalid shared ring queue capacity!");
+    }
+
+    return header;
+}
+
+template<typename T>
+inline size_t SharedMPSCRingQueue<T>::size() const noexcept
+{
+    const size_t head = _header->head.load(std::memory_order_acquire);
+    const size_t tail = _header->tail.load(std::memory_order_acquire);
+
+    return head - tail;
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::Enqueue(const T& item)
+{
+    size_t head_sequence = _header->head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Node* node = &_buffer[head_sequence & _mask];
+        size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+
+        // If node sequence and head sequence are the same then it means this slot is empty
+        int64_t diff = (int64_t)node_sequence - (int64_t)head_sequence;
+        if (diff == 0)
+        {
+            // Claim our spot by moving head
+            if (_header->head.compare_exchange_weak(head_sequence, head_sequence + 1, std::memory_order_relaxed))
+            {
+                // Store the item value
+                node->value = item;
+
+                // Increment the sequence so that the tail knows it's accessible
+                node->sequence.store(head_sequence + 1, std::memory_order_release);
+
+                // Notify the waiting consumer
+                _not_empty.Notify();
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // If node sequence is less than head sequence then it means this slot is full
+            // and therefore buffer is full
+            return false;
+        }
+        else
+        {
+            // Someone beat us to the punch
+            head_sequence = _header->head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+inline void SharedMPSCRingQueue<T>::EnqueueWait(const T& item)
+{
+    // Fast path without waiting
+    if (Enqueue(item))
+        return;
+
+    // Wait while the ring queue is full
+    _not_full.Wait([this, &item]() { return Enqueue(item); });
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::Dequeue(T& item)
+{
+    const size_t tail_sequence = _header->tail.load(std::memory_order_relaxed);
+
+    Node* node = &_buffer[tail_sequence & _mask];
+    size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+
+    // Check if the slot is not published yet and therefore buffer is empty
+    if (node_sequence != (tail_sequence + 1))
+        return false;
+
+    // Get the item value
+    item = node->value;
+
+    // Set the sequence to what the head sequence should be next time around.
+    // Single consumer moves the tail without the CAS operation.
+    node->sequence.store(tail_sequence + _mask + 1, std::memory_order_release);
+    _header->tail.store(tail_sequence + 1, std::memory_order_release);
+
+    // Notify waiting producers
+    _not_full.Notify();
+    return true;
+}
+
+template<typename T>
+inline void SharedMPSCRingQueue<T>::DequeueWait(T& item)
+{
+    // Fast path without waiting
+    if (Dequeue(item))
+        return;
+
+    // Wait while the ring queue is empty
+    _not_empty.Wait([this, &item]() { return Dequeue(item); });
+}
+
+} // namespace CppCommon
@@ -0,0 +1,163 @@
+/*!
+    \file shared_spsc_ring_buffer.h
+    \brief Inter-process single producer / single consumer wait-free ring buffer definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+#define CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+
+#include "system/shared_memory.h"
+#include "threads/named_wait_strategy.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace CppCommon {
+
+//! Inter-process single producer / single consumer wait-free ring buffer
+/*!
+    Inter-process single producer / single consumer wait-free ring buffer
+    behaves as a SPSCRingBuffer, but it is placed in the named shared memory
+    and could be shared between processes on the same machine. The ring buffer
+    layout is position-independent: it contains only cursors and data bytes,
+    so each process could map it at any address.
+
+    The first instance with a given name creates and initializes the ring
+    buffer, other instances open it and must use the same capacity.
+
+    Enqueue() and Dequeue() never block. EnqueueWait() and DequeueWait() spin
+    for a while and then block on the named event while the ring buffer is
+    full or empty.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    \see SPSCRingBuffer
+*/
+class SharedSPSCRingBuffer
+{
+public:
+    //! Create a new or open existing ring buffer with a given name and capacity
+    /*!
+        \param name - Ring buffer name
+        \param capacity - Ring buffer capacity (must be a power of two)
+    */
+    explicit SharedSPSCRingBuffer(const std::string& name, size_t capacity);
+    SharedSPSCRingBuffer(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer(SharedSPSCRingBuffer&&) = delete;
+    ~SharedSPSCRingBuffer() = default;
+
+    SharedSPSCRingBuffer& operator=(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer& operator=(SharedSPSCRingBuffer&&) = delete;
+
+    //! Check if the buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the ring buffer name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the ring buffer owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Is ring buffer empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring buffer capacity in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get ring buffer size in bytes
+    size_t size() const noexcept;
+
+    //! Enqueue a data into the ring buffer (single producer thread method)
+    /*!
+        The data will be copied into the ring buffer using 'memcpy()' function.
+        Data size should not be greater than ring buffer capacity!
+
+        Will not block.
+
+        \param data - Data buffer to enqueue
+        \param size - Data buffer size
+        \return 'true' if the data was successfully enqueue, 'false' if the ring buffer is full
+    */
+    bool Enqueue(const void* data, size_t size);
+    //! Enqueue a data into the ring buffer and wait while the ring buffer is full (single producer thread method)
+    /*!
+        The data will be copied into the ring buffer using 'memcpy()' function.
+        Data size should not be greater than ring buffer capacity!
+
+        Will block.
+
+        \param data - Data buffer to enqueue
+        \param size - Data buffer size
+    */
+    void EnqueueWait(const void* data, size_t size);
+
+    //! Dequeue a data from the ring buffer (single consumer thread method)
+    /*!
+        The data will be copied from the ring buffer using 'memcpy()' function.
+
+        Will not block.
+
+        \param data - Data buffer to dequeue
+        \param size - Data buffer size
+        \return 'true' if the data was successfully dequeue, 'false' if the ring buffer is empty
+    */
+    bool Dequeue(void* data, size_t& size);
+    //! Dequeue a data from the ring buffer and wait while the ring buffer is empty (single consumer thread method)
+    /*!
+        The data will be copied from the ring buffer using 'memcpy()' function.
+
+        Will block.
+
+        \param data - Data buffer to dequeue
+        \param size - Data buffer size
+    */
+    void DequeueWait(void* data, size_t& size);
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Ring buffer header placed at the beginning of the shared memory
+    struct Header
+    {
+        std::atomic<uint32_t> initialized;
+        uint32_t reserved;
+        size_t capacity;
+        cache_line_pad pad0;
+        std::atomic<size_t> head;
+        cache_line_pad pad1;
+        std::atomic<size_t> tail;
+        cache_line_pad pad2;
+        std::atomic<uint32_t> not_empty;
+        cache_line_pad pad3;
+        std::atomic<uint32_t> not_full;
+        cache_line_pad pad4;
+    };
+
+    static_assert(std::atomic<size_t>::is_always_lock_free, "Shared ring buffer cursors must be lock-free!");
+
+    SharedMemory _shared;
+    Header* const _header;
+    uint8_t* const _buffer;
+    const size_t _capacity;
+    const size_t _mask;
+    NamedWaitStrategy _not_empty;
+    NamedWaitStrategy _not_full;
+
+    //! Initialize or open the ring buffer header
+    static Header* InitializeHeader(SharedMemory& shared, size_t capacity);
+};
+
+/*! \example threads_shared_spsc_ring_buffer.cpp Inter-process single producer / single consumer wait-free ring buffer example */
+
+} // namespace CppCommon
+
+#include "shared_spsc_ring_buffer.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
@@ -0,0 +1,152 @@
+/*!
+    \file shared_spsc_ring_buffer.inl
+    \brief Inter-process single producer / single consumer wait-free ring buffer inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SharedSPSCRingBuffer::SharedSPSCRingBuffer(const std::string& name, size_t capacity)
+    : _shared(name, sizeof(Header) + capacity),
+      _header(InitializeHeader(_shared, capacity)),
+      _buffer((uint8_t*)_shared.ptr() + sizeof(Header)),
+      _capacity(capacity),
+      _mask(capacity - 1),
+      _not_empty(name + ".not_empty", _header->not_empty),
+      _not_full(name + ".not_full", _header->not_full)
+{
+    assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
+}
+
+inline SharedSPSCRingBuffer::Header* SharedSPSCRingBuffer::InitializeHeader(SharedMemory& shared, size_t capacity)
+{
+    Header* header = (Header*)shared.ptr();
+
+    if (shared.owner())
+    {
+        // Initialize the ring buffer header in place
+        new (header) Header();
+        header->capacity = capacity;
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->not_empty.store(0, std::memory_order_relaxed);
+        header->not_full.store(0, std::memory_order_relaxed);
+        header->initialized.store(1, std::memory_order_release);
+    }
+    else
+    {
+        // Wait for the owner to initialize the ring buffer header
+        while (header->initialized.load(std::memory_order_acquire) == 0)
+            Thread::Yield();
+
+        if (header->capacity != capacity)
+            throwex SystemException("Invalid shared ring buffer capacity!");
+    }
+
+    return header;
+}
+
+inline size_t SharedSPSCRingBuffer::size() const noexcept
+{
+    const size_t head = _header->head.load(std::memory_order_acquire);
+    const size_t tail = _header->tail.load(std::memory_order_acquire);
+
+    return head - tail;
+}
+
+inline bool SharedSPSCRingBuffer::Enqueue(const void* data, size_t size)
+{
+    assert((size <= _capacity) && "Data size should not be greater than ring buffer capacity!");
+    if (size > _capacity)
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((data != nullptr) && "Pointer to the data should not be null!");
+    if (data == nullptr)
+        return false;
+
+    const size_t head = _header->head.load(std::memory_order_relaxed);
+    const size_t tail = _header->tail.load(std::memory_order_acquire);
+
+    // Check if there is required free space in the ring buffer
+    if ((size + head - tail) > _capacity)
+        return false;
+
+    // Copy data into the ring buffer
+    size_t head_index = head & _mask;
+    size_t first = std::min(size, _capacity - head_index);
+    memcpy(&_buffer[head_index], (const uint8_t*)data, first);
+    memcpy(_buffer, (const uint8_t*)data + first, size - first);
+
+    // Increase the head cursor
+    _header->head.store(head + size, std::memory_order_release);
+
+    // Notify the waiting consumer
+    _not_empty.Notify();
+
+    return true;
+}
+
+inline void SharedSPSCRingBuffer::EnqueueWait(const void* data, size_t size)
+{
+    // Fast path without waiting
+    if (Enqueue(data, size))
+        return;
+
+    // Wait while the ring buffer is full
+    _not_full.Wait([this, data, size]() { return Enqueue(data, size); });
+}
+
+inline bool SharedSPSCRingBuffer::Dequeue(void* data, size_t& size)
+{
+    if (size == 0)
+        return true;
+
+    assert((data != nullptr) && "Pointer to the data should not be null!");
+    if (data == nullptr)
+        return false;
+
+    const size_t tail = _header->tail.load(std::memory_order_relaxed);
+    const size_t head = _header->head.load(std::memory_order_acquire);
+
+    // Get the ring buffer size
+    size_t available = head - tail;
+    if (size > available)
+        size = available;
+
+    // Check if the ring buffer is empty
+    if (size == 0)
+        return false;
+
+    // Copy data from the ring buffer
+    size_t tail_index = tail & _mask;
+    size_t first = std::min(size, _capacity - tail_index);
+    memcpy((uint8_t*)data, &_buffer[tail_index], first);
+    memcpy((uint8_t*)data + first, _buffer, size - first);
+
+    // Increase the tail cursor
+    _header->tail.store(tail + size, std::memory_order_release);
+
+    // Notify the waiting producer
+    _not_full.Notify();
+
+    return true;
+}
+
+inline void SharedSPSCRingBuffer::DequeueWait(void* data, size_t& size)
+{
+    // Fast path without waiting
+    size_t requested = size;
+    if ((requested == 0) || Dequeue(data, size))
+        return;
+
+    // Wait while the ring buffer is empty
+    _not_empty.Wait([this, data, requested, &size]() { return Dequeue(data, size = requested); });
+}
+
+} // namespace CppCommon
@@ -9,10 +9,13 @@
 #ifndef CPPCOMMON_THREADS_SPSC_RING_BUFFER_H
 #define CPPCOMMON_THREADS_SPSC_RING_BUFFER_H
 
+#include "memory/memory.h"
+
 #include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <span>
 
 namespace CppCommon {
 
@@ -23,6 +26,13 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    Zero-copy API allows the producer to serialize data directly into the ring
+    buffer (Prepare() / Commit()) and the consumer to parse data in place
+    (Peek() / Release()). Wrapped ranges are always contiguous: if the capacity
+    is a multiple of the mirror granularity (page size) the ring buffer storage
+    is mapped twice into adjacent virtual address ranges, otherwise the wrapped
+    part is copied to (from) the extra tail area of the storage.
+
     Thread-safe.
 
     A combination of the algorithms described by the circular buffers documentation found in the Linux kernel, and the
@@ -39,7 +49,7 @@ public:
     explicit SPSCRingBuffer(size_t capacity);
     SPSCRingBuffer(const SPSCRingBuffer&) = delete;
     SPSCRingBuffer(SPSCRingBuffer&&) = delete;
-    ~SPSCRingBuffer() { delete[] _buffer; }
+    ~SPSCRingBuffer();
 
     SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
     SPSCRingBuffer& operator=(SPSCRingBuffer&&) = delete;
@@ -53,6 +63,11 @@ public:
     size_t capacity() const noexcept { return _capacity; }
     //! Get ring buffer size in bytes
     size_t size() const noexcept;
+    //! Is ring buffer storage mirrored in the virtual memory?
+    bool mirrored() const noexcept { return _mirrored; }
+
+    //! Is the given pointer inside the ring buffer storage?
+    bool Owns(const void* ptr) const noexcept { return ((const uint8_t*)ptr >= _buffer) && ((const uint8_t*)ptr < (_buffer + 2 * _capacity)); }
 
     //! Enqueue a data into the ring buffer (single producer thread method)
     /*!
@@ -79,13 +94,50 @@ public:
     */
     bool Dequeue(void* data, size_t& size);
 
+    //! Prepare a contiguous free space in the ring buffer to write the data in place (single producer thread method)
+    /*!
+        Prepared space is not visible to the consumer until it is committed.
+        Data size should not be greater than ring buffer capacity!
+
+        Will not block.
+
+        \param size - Required free space size
+        \return Prepared free space or empty span if the ring buffer has not enough free space
+    */
+    std::span<uint8_t> Prepare(size_t size);
+    //! Commit the given size of the previously prepared space (single producer thread method)
+    /*!
+        Will not block.
+
+        \param size - Committed size (should not be greater than the prepared size)
+    */
+    void Commit(size_t size);
+
+    //! Peek all available data in the ring buffer as a contiguous memory block (single consumer thread method)
+    /*!
+        Peeked data stays in the ring buffer until it is released.
+
+        Will not block.
+
+        \return Available data or empty span if the ring buffer is empty
+    */
+    std::span<const uint8_t> Peek();
+    //! Release the given size of the previously peeked data (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param size - Released size (should not be greater than the peeked size)
+    */
+    void Release(size_t size);
+
 private:
     typedef char cache_line_pad[128];
 
     cache_line_pad _pad0;
     const size_t _capacity;
     const size_t _mask;
-    uint8_t* const _buffer;
+    bool _mirrored;
+    uint8_t* _buffer;
 
     cache_line_pad _pad1;
     std::atomic<size_t> _head;
@@ -8,17 +8,32 @@
 
 namespace CppCommon {
 
-inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]), _head(0), _tail(0)
+inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _mirrored(false), _buffer(nullptr), _head(0), _tail(0)
 {
     assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
 
+    // Try to map the mirrored storage, otherwise allocate the storage with the extra tail area
+    if ((capacity % Memory::MirrorGranularity()) == 0)
+        _buffer = (uint8_t*)Memory::MirrorAllocate(capacity);
+    _mirrored = (_buffer != nullptr);
+    if (!_mirrored)
+        _buffer = new uint8_t[2 * capacity];
+
     memset(_pad0, 0, sizeof(cache_line_pad));
     memset(_pad1, 0, sizeof(cache_line_pad));
     memset(_pad2, 0, sizeof(cache_line_pad));
     memset(_pad3, 0, sizeof(cache_line_pad));
 }
 
+inline SPSCRingBuffer::~SPSCRingBuffer()
+{
+    if (_mirrored)
+        Memory::MirrorFree(_buffer, _capacity);
+    else
+        delete[] _buffer;
+}
+
 inline size_t SPSCRingBuffer::size() const noexcept
 {
     const size_t head = _head.load(std::memory_order_acquire);
@@ -98,4 +113,70 @@ inline bool SPSCRingBuffer::Dequeue(void* data, size_t& size)
     return true;
 }
 
+inline std::span<uint8_t> SPSCRingBuffer::Prepare(size_t size)
+{
+    assert((size <= _capacity) && "Data size should not be greater than ring buffer capacity!");
+    if ((size == 0) || (size > _capacity))
+        return std::span<uint8_t>();
+
+    const size_t head = _head.load(std::memory_order_relaxed);
+    const size_t tail = _tail.load(std::memory_order_acquire);
+
+    // Check if there is required free space in the ring buffer
+    if ((size + head - tail) > _capacity)
+        return std::span<uint8_t>();
+
+    // Wrapped part will be written into the mirrored or the extra tail area
+    return std::span<uint8_t>(&_buffer[head & _mask], size);
+}
+
+inline void SPSCRingBuffer::Commit(size_t size)
+{
+    if (size == 0)
+        return;
+
+    const size_t head = _head.load(std::memory_order_relaxed);
+
+    assert(((size + head - _tail.load(std::memory_order_relaxed)) <= _capacity) && "Committed size should not be greater than the prepared size!");
+
+    // Copy the wrapped part from the extra tail area to the beginning of the ring buffer
+    size_t head_index = head & _mask;
+    if (!_mirrored && ((head_index + size) > _capacity))
+        memcpy(_buffer, &_buffer[_capacity], head_index + size - _capacity);
+
+    // Increase the head cursor
+    _head.store(head + size, std::memory_order_release);
+}
+
+inline std::span<const uint8_t> SPSCRingBuffer::Peek()
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    const size_t head = _head.load(std::memory_order_acquire);
+
+    // Check if the ring buffer is empty
+    size_t available = head - tail;
+    if (available == 0)
+        return std::span<const uint8_t>();
+
+    // Copy the wrapped part from the beginning of the ring buffer to the extra tail area
+    size_t tail_index = tail & _mask;
+    if (!_mirrored && ((tail_index + available) > _capacity))
+        memcpy(&_buffer[_capacity], _buffer, tail_index + available - _capacity);
+
+    return std::span<const uint8_t>(&_buffer[tail_index], available);
+}
+
+inline void SPSCRingBuffer::Release(size_t size)
+{
+    if (size == 0)
+        return;
+
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+
+    assert((size <= (_head.load(std::memory_order_relaxed) - tail)) && "Released size should not be greater than the peeked size!");
+
+    // Increase the tail cursor
+    _tail.store(tail + size, std::memory_order_release);
+}
+
 } // namespace CppCommon
@@ -9,10 +9,15 @@
 #ifndef CPPCOMMON_THREADS_SPSC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_SPSC_RING_QUEUE_H
 
+#include "memory/cache_padded.h"
+#include "threads/wait_strategy.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
 #include <utility>
 
 namespace CppCommon {
@@ -24,13 +29,19 @@ namespace CppCommon {
 
     FIFO order is guaranteed!
 
+    Enqueue() and Dequeue() never block. EnqueueWait() and DequeueWait() block
+    the calling thread with the pluggable wait strategy (SpinWaitStrategy,
+    YieldWaitStrategy, BlockingWaitStrategy) while the ring queue is full or
+    empty. The lock-free fast path is kept and the strategy is notified after
+    each successful operation, which costs nothing for spin and yield ones.
+
     Thread-safe.
 
     A combination of the algorithms described by the circular buffers documentation found in the Linux kernel, and the
     bounded MPMC queue by Dmitry Vyukov. Implemented in pure C++11. Should work across most CPU architectures.
     http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
 */
-template<typename T>
+template<typename T, class TWaitStrategy = SpinWaitStrategy>
 class SPSCRingQueue
 {
 public:
@@ -88,19 +99,69 @@ public:
     */
     bool Dequeue(T& item);
 
-private:
-    typedef char cache_line_pad[128];
+    //! Enqueue a range of items into the ring queue (single producer thread method)
+    /*!
+        Items will be copied into the ring queue. Enqueued items are published with one release store.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param last - Iterator to the item after the last one to enqueue
+        \return Count of successfully enqueued items (could be less than the range size if the ring queue is full)
+    */
+    template <class InputIterator>
+    size_t EnqueueBulk(InputIterator first, InputIterator last);
+    //! Dequeue a range of items from the ring queue (single consumer thread method)
+    /*!
+        Items will be moved from the ring queue into the given output iterator. Dequeued slots are released with one release store.
+
+        Will not block.
+
+        \param out - Output iterator to dequeue items into
+        \param max - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (0 if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator out, size_t max);
+
+    //! Enqueue an item into the ring queue and wait while the ring queue is full (single producer thread method)
+    /*!
+        The item will be copied into the ring queue.
+
+        Will block with the wait strategy.
 
-    cache_line_pad _pad0;
-    const size_t _capacity;
+        \param item - Item to enqueue
+    */
+    void EnqueueWait(const T& item);
+    //! Enqueue an item into the ring queue and wait while the ring queue is full (single producer thread method)
+    /*!
+        The item will be moved into the ring queue.
+
+        Will block with the wait strategy.
+
+        \param item - Item to enqueue
+    */
+    void EnqueueWait(T&& item);
+
+    //! Dequeue an item from the ring queue and wait while the ring queue is empty (single consumer thread method)
+    /*!
+        The item will be moved from the ring queue.
+
+        Will block with the wait strategy.
+
+        \param item - Item to dequeue
+    */
+    void DequeueWait(T& item);
+
+private:
+    alignas(hardware_destructive_interference_size) const size_t _capacity;
     const size_t _mask;
     T* const _buffer;
 
-    cache_line_pad _pad1;
-    std::atomic<size_t> _head;
-    cache_line_pad _pad2;
-    std::atomic<size_t> _tail;
-    cache_line_pad _pad3;
+    CachePadded<std::atomic<size_t>> _head;
+    CachePadded<std::atomic<size_t>> _tail;
+    CachePadded<TWaitStrategy> _not_empty;
+    CachePadded<TWaitStrategy> _not_full;
 };
 
 /*! \example threads_spsc_ring_queue.cpp Single producer / single consumer wait-free ring queue example */
@@ -8,39 +8,34 @@
 
 namespace CppCommon {
 
-template<typename T>
-inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity) : _capacity(capacity - 1), _mask(capacity - 1), _buffer(new T[capacity]), _head(0), _tail(0)
+template<typename T, class TWaitStrategy>
+inline SPSCRingQueue<T, TWaitStrategy>::SPSCRingQueue(size_t capacity) : _capacity(capacity - 1), _mask(capacity - 1), _buffer(new T[capacity]), _head(0), _tail(0)
 {
     assert((capacity > 1) && "Ring queue capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
-
-    memset(_pad0, 0, sizeof(cache_line_pad));
-    memset(_pad1, 0, sizeof(cache_line_pad));
-    memset(_pad2, 0, sizeof(cache_line_pad));
-    memset(_pad3, 0, sizeof(cache_line_pad));
 }
 
-template<typename T>
-inline size_t SPSCRingQueue<T>::size() const noexcept
+template<typename T, class TWaitStrategy>
+inline size_t SPSCRingQueue<T, TWaitStrategy>::size() const noexcept
 {
-    const size_t head = _head.load(std::memory_order_acquire);
-    const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t head = _head->load(std::memory_order_acquire);
+    const size_t tail = _tail->load(std::memory_order_acquire);
 
     return head - tail;
 }
 
-template<typename T>
-inline bool SPSCRingQueue<T>::Enqueue(const T& item)
+template<typename T, class TWaitStrategy>
+inline bool SPSCRingQueue<T, TWaitStrategy>::Enqueue(const T& item)
 {
     T temp = item;
     return Enqueue(std::forward<T>(temp));
 }
 
-template<typename T>
-inline bool SPSCRingQueue<T>::Enqueue(T&& item)
+template<typename T, class TWaitStrategy>
+inline bool SPSCRingQueue<T, TWaitStrategy>::Enqueue(T&& item)
 {
-    const size_t head = _head.load(std::memory_order_relaxed);
-    const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t head = _head->load(std::memory_order_relaxed);
+    const size_t tail = _tail->load(std::memory_order_acquire);
 
     // Check if the ring queue is full
     if (((head - tail + 1) & _mask) == 0)
@@ -50,16 +45,19 @@ inline bool SPSCRingQueue<T>::Enqueue(T&& item)
     _buffer[head & _mask] = std::move(item);
 
     // Increase the head cursor
-    _head.store(head + 1, std::memory_order_release);
+    _head->store(head + 1, std::memory_order_release);
+
+    // Notify the waiting consumer
+    _not_empty->Notify();
 
     return true;
 }
 
-template<typename T>
-inline bool SPSCRingQueue<T>::Dequeue(T& item)
+template<typename T, class TWaitStrategy>
+inline bool SPSCRingQueue<T, TWaitStrategy>::Dequeue(T& item)
 {
-    const size_t tail = _tail.load(std::memory_order_relaxed);
-    const size_t head = _head.load(std::memory_order_acquire);
+    const size_t tail = _tail->load(std::memory_order_relaxed);
+    const size_t head = _head->load(std::memory_order_acquire);
 
     // Check if the ring queue is empty
     if (((head - tail) & _mask) == 0)
@@ -69,9 +67,90 @@ inline bool SPSCRingQueue<T>::Dequeue(T& item)
     item = std::move(_buffer[tail & _mask]);
 
     // Increase the tail cursor
-    _tail.store(tail + 1, std::memory_order_release);
+    _tail->store(tail + 1, std::memory_order_release);
+
+    // Notify the waiting producer
+    _not_full->Notify();
 
     return true;
 }
 
+template<typename T, class TWaitStrategy>
+template <class InputIterator>
+inline size_t SPSCRingQueue<T, TWaitStrategy>::EnqueueBulk(InputIterator first, InputIterator last)
+{
+    const size_t head = _head->load(std::memory_order_relaxed);
+    const size_t tail = _tail->load(std::memory_order_acquire);
+
+    // Store item values into free slots
+    size_t available = _capacity - (head - tail);
+    size_t count = 0;
+    for (; (count < available) && (first != last); ++count, ++first)
+        _buffer[(head + count) & _mask] = *first;
+
+    // Increase the head cursor once for all stored items
+    if (count > 0)
+    {
+        _head->store(head + count, std::memory_order_release);
+
+        // Notify the waiting consumer
+        _not_empty->Notify();
+    }
+
+    return count;
+}
+
+template<typename T, class TWaitStrategy>
+template <class OutputIterator>
+inline size_t SPSCRingQueue<T, TWaitStrategy>::DequeueBulk(OutputIterator out, size_t max)
+{
+    const size_t tail = _tail->load(std::memory_order_relaxed);
+    const size_t head = _head->load(std::memory_order_acquire);
+
+    // Get item values from filled slots
+    size_t count = std::min(head - tail, max);
+    for (size_t i = 0; i < count; ++i)
+        *out++ = std::move(_buffer[(tail + i) & _mask]);
+
+    // Increase the tail cursor once for all dequeued items
+    if (count > 0)
+    {
+        _tail->store(tail + count, std::memory_order_release);
+
+        // Notify the waiting producer
+        _not_full->Notify();
+    }
+
+    return count;
+}
+
+template<typename T, class TWaitStrategy>
+inline void SPSCRingQueue<T, TWaitStrategy>::EnqueueWait(const T& item)
+{
+    T temp = item;
+    EnqueueWait(std::forward<T>(temp));
+}
+
+template<typename T, class TWaitStrategy>
+inline void SPSCRingQueue<T, TWaitStrategy>::EnqueueWait(T&& item)
+{
+    // Fast path without waiting
+    if (Enqueue(std::forward<T>(item)))
+        return;
+
+    // Wait while the ring queue is full
+    _not_full->Wait([this, &item]() { return Enqueue(std::forward<T>(item)); });
+}
+
+template<typename T, class TWaitStrategy>
+inline void SPSCRingQueue<T, TWaitStrategy>::DequeueWait(T& item)
+{
+    // Fast path without waiting
+    if (Dequeue(item))
+        return;
+
+    // Wait while the ring queue is empty
+    _not_empty->Wait([this, &item]() { return Dequeue(item); });
+}
+
 } // namespace CppCommon
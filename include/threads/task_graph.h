@@ -0,0 +1,179 @@
+/*!
+    \file task_graph.h
+    \brief Task graph executor definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TASK_GRAPH_H
+#define CPPCOMMON_THREADS_TASK_GRAPH_H
+
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Task graph executor
+/*!
+    Task graph is a directed acyclic graph of tasks with dependencies which
+    is executed on workers of the work-stealing thread pool. Each task has
+    the counter of not completed dependencies, the task which completes last
+    dependency posts its successor into the same worker deque, so the graph
+    runs stage after stage without global barriers and idle workers steal
+    ready tasks of any stage (fan-out and fan-in pipelines).
+
+    The graph is built once and could be run many times: nodes, edges and
+    dependency counters are reused by each run without reallocation.
+
+    Another task graph could be added as a node (nested subgraph). The
+    subgraph node is completed when all tasks of the subgraph are completed,
+    no worker thread is blocked while the subgraph is running.
+
+    Running graph could be canceled: already started tasks are completed,
+    and not started tasks (including tasks of nested subgraphs) are skipped.
+    Long tasks could check canceled() to stop earlier. If a task throws an
+    exception the graph is canceled and the first exception is rethrown by
+    Wait().
+
+    Not thread-safe, except Cancel() and canceled() which could be called
+    from any thread (e.g. from running tasks).
+*/
+class TaskGraph
+{
+public:
+    //! Task graph task
+    typedef std::function<void()> Task;
+
+    TaskGraph() : _validated(false), _pool(nullptr), _parent(nullptr), _parent_node(0), _running(false), _pending(0), _canceled(false) {}
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph(TaskGraph&&) = delete;
+    ~TaskGraph();
+
+    TaskGraph& operator=(const TaskGraph&) = delete;
+    TaskGraph& operator=(TaskGraph&&) = delete;
+
+    //! Is the task graph empty?
+    bool empty() const noexcept { return _nodes.empty(); }
+    //! Get the count of task graph nodes
+    size_t size() const noexcept { return _nodes.size(); }
+
+    //! Is the task graph running?
+    bool running() const;
+    //! Is the task graph canceled (or its parent graph)?
+    bool canceled() const noexcept;
+
+    //! Add the task node
+    /*!
+        \param task - Task to run
+        \return Index of the task node
+    */
+    size_t Add(Task task);
+    //! Add the nested subgraph node
+    /*!
+        The subgraph must outlive the task graph and must not be run
+        separately while the task graph is running.
+
+        \param subgraph - Nested subgraph
+        \return Index of the subgraph node
+    */
+    size_t Add(TaskGraph& subgraph);
+
+    //! Make the task node to run before the successor node
+    /*!
+        \param node - Index of the node
+        \param successor - Index of the successor node
+    */
+    void Precede(size_t node, size_t successor);
+    //! Make the task node to run after all the given nodes
+    /*!
+        \param node - Index of the node
+        \param dependencies - Indexes of dependency nodes
+    */
+    void Succeed(size_t node, std::initializer_list<size_t> dependencies);
+
+    //! Clear the task graph
+    void Clear();
+
+    //! Start the task graph execution with the given thread pool
+    /*!
+        Throws ArgumentException if the task graph contains a cycle.
+
+        Will not block.
+
+        \param pool - Thread pool
+    */
+    void Start(ThreadPool& pool);
+    //! Wait for the task graph execution is completed
+    /*!
+        Rethrows the first exception thrown by tasks.
+
+        Must not be called from worker threads of the thread pool.
+
+        Will block.
+    */
+    void Wait();
+    //! Run the task graph with the given thread pool and wait for its completion
+    /*!
+        \param pool - Thread pool
+    */
+    void Run(ThreadPool& pool) { Start(pool); Wait(); }
+
+    //! Cancel the running task graph
+    /*!
+        Not started tasks will be skipped. Does nothing if the task graph is not running.
+    */
+    void Cancel() noexcept { _canceled.store(true, std::memory_order_release); }
+
+private:
+    struct Node
+    {
+        Task task;
+        TaskGraph* subgraph{nullptr};
+        std::vector<size_t> successors;
+        size_t dependencies{0};
+        std::atomic<size_t> remaining{0};
+    };
+
+    std::vector<std::unique_ptr<Node>> _nodes;
+    bool _validated;
+
+    // Current execution
+    ThreadPool* _pool;
+    TaskGraph* _parent;
+    size_t _parent_node;
+    bool _running;
+    std::atomic<size_t> _pending;
+    std::atomic<bool> _canceled;
+    std::exception_ptr _exception;
+    mutable CriticalSection _cs;
+    ConditionVariable _cv;
+
+    //! Validate the task graph is acyclic
+    void Validate();
+    //! Launch the task graph execution as the node of the given parent graph
+    void Launch(ThreadPool& pool, TaskGraph* parent, size_t parent_node);
+    //! Schedule the ready node
+    void Schedule(size_t index);
+    //! Execute the node
+    void Execute(size_t index);
+    //! Finish the node and schedule its ready successors
+    void Finish(size_t index);
+    //! Complete the task graph execution
+    void Complete();
+    //! Fail the task graph execution with the given exception
+    void Fail(std::exception_ptr exception);
+};
+
+/*! \example threads_task_graph.cpp Task graph executor example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_TASK_GRAPH_H
@@ -9,7 +9,9 @@
 #ifndef CPPCOMMON_THREADS_THREAD_H
 #define CPPCOMMON_THREADS_THREAD_H
 
+#include "common/enum_strings.h"
 #include "errors/exceptions_handler.h"
+#include "system/cpu_set.h"
 #include "time/timestamp.h"
 
 #include <bitset>
@@ -35,6 +37,22 @@ enum class ThreadPriority : uint8_t
     REALTIME = 0xFF     //!< Realtime thread priority
 };
 
+//! Thread priority strings
+template <>
+struct EnumStrings<ThreadPriority>
+{
+    static constexpr std::pair<std::string_view, ThreadPriority> items[] =
+    {
+        { "IDLE", ThreadPriority::IDLE },
+        { "LOWEST", ThreadPriority::LOWEST },
+        { "LOW", ThreadPriority::LOW },
+        { "NORMAL", ThreadPriority::NORMAL },
+        { "HIGH", ThreadPriority::HIGH },
+        { "HIGHEST", ThreadPriority::HIGHEST },
+        { "REALTIME", ThreadPriority::REALTIME }
+    };
+};
+
 //! Stream output: Thread priorities
 /*!
     \param stream - Output stream
@@ -44,6 +62,28 @@ enum class ThreadPriority : uint8_t
 template <class TOutputStream>
 TOutputStream& operator<<(TOutputStream& stream, ThreadPriority priority);
 
+//! Thread resource usage
+struct ThreadUsage
+{
+    Timespan user;                      //!< CPU time spent in the user mode
+    Timespan system;                    //!< CPU time spent in the kernel mode
+    uint64_t voluntary_switches{0};     //!< Voluntary context switches (waits for a resource)
+    uint64_t involuntary_switches{0};   //!< Involuntary context switches (preemptions)
+    uint64_t minor_faults{0};           //!< Page faults serviced without I/O
+    uint64_t major_faults{0};           //!< Page faults serviced with I/O
+
+    //! Get the total CPU time
+    Timespan cpu() const noexcept { return user + system; }
+
+    ThreadUsage& operator+=(const ThreadUsage& usage) noexcept;
+    ThreadUsage& operator-=(const ThreadUsage& usage) noexcept;
+
+    friend ThreadUsage operator+(ThreadUsage usage1, const ThreadUsage& usage2) noexcept
+    { return usage1 += usage2; }
+    friend ThreadUsage operator-(ThreadUsage usage1, const ThreadUsage& usage2) noexcept
+    { return usage1 -= usage2; }
+};
+
 //! Thread abstraction
 /*!
     Thread contains different kinds of thread manipulation  functionality  such  as
@@ -105,8 +145,67 @@ public:
     static void SleepUntil(const UtcTimestamp& timestamp) noexcept
     { SleepFor(timestamp - UtcTimestamp()); }
 
+    //! Sleep the current thread for the given timespan with a high precision
+    /*!
+        Hybrid sleep for short pacing intervals: the bulk of the interval is
+        slept with the OS timer (high resolution waitable timer on Windows),
+        and the remainder is spin-waited on the calibrated TSC clock with
+        Pause(), so the wake up is not delayed by the kernel timer slack or
+        the Windows timer resolution (e.g. waits of TokenBucket pacers).
+
+        Spin timespan is the accuracy/CPU trade-off: longer spin tolerates
+        larger OS sleep overshoot, but burns more CPU time. Zero spin timespan
+        selects the adaptive mode where the spin interval follows the OS sleep
+        overshoot measured by the current thread.
+
+        \param timespan - Timespan to sleep
+        \param spin - Spin-wait timespan before the deadline (default is Timespan::zero() for adaptive mode)
+    */
+    static void SleepPrecise(const Timespan& timespan, const Timespan& spin = Timespan::zero()) noexcept
+    { SleepPreciseUntil(TscTimestamp() + timespan, spin); }
+    //! Sleep the current thread until the given calibrated TSC timestamp with a high precision
+    /*!
+        Absolute deadlines allow pacing loops without accumulated drift.
+
+        \param timestamp - Calibrated TSC timestamp to stop sleeping
+        \param spin - Spin-wait timespan before the deadline (default is Timespan::zero() for adaptive mode)
+    */
+    static void SleepPreciseUntil(const TscTimestamp& timestamp, const Timespan& spin = Timespan::zero()) noexcept;
+
     //! Yield to other threads
     static void Yield() noexcept;
+    //! Hint the CPU that the current thread is in a spin-wait loop
+    /*!
+        Executes 'pause' instruction on x86 and 'yield' instruction on ARM.
+        It reduces the power consumption and the memory order violation
+        penalty on the spin-wait loop exit, and gives resources to the sibling
+        hyper-thread. Does not enter the kernel.
+    */
+    static void Pause() noexcept;
+
+    //! Get the CPU time consumed by the current thread
+    /*!
+        Uses the thread CPU clock, so the call does not enter the kernel on
+        Linux platform (vDSO).
+
+        \return CPU time of the current thread or zero timespan if not supported
+    */
+    static Timespan CpuTime() noexcept;
+    //! Get the CPU time consumed by the given thread
+    /*!
+        \param thread - Thread
+        \return CPU time of the given thread
+    */
+    static Timespan CpuTime(std::thread& thread);
+
+    //! Get the resource usage of the current thread
+    /*!
+        Context switches and page faults are counted only on Linux platform,
+        other platforms report only CPU times.
+
+        \return Resource usage of the current thread
+    */
+    static ThreadUsage Usage();
 
     //! Get the current thread CPU affinity bitset
     /*!
@@ -132,6 +231,38 @@ public:
     */
     static void SetAffinity(std::thread& thread, const std::bitset<64>& affinity);
 
+    //! Get the current thread CPU affinity set
+    /*!
+        Unlike GetAffinity() the CPU affinity set is not limited by 64 CPUs.
+        On Windows platform the thread is affine to CPUs of a single
+        processor group.
+
+        \return CPU affinity set of the current thread
+    */
+    static CPUSet GetAffinitySet();
+    //! Get the given thread CPU affinity set
+    /*!
+        \param thread - Thread
+        \return CPU affinity set of the given thread
+    */
+    static CPUSet GetAffinitySet(std::thread& thread);
+
+    //! Set the current thread CPU affinity set
+    /*!
+        Unlike the CPU affinity bitset the CPU affinity set is not limited by
+        64 CPUs (e.g. CPUs of the cache domain from CPUTopology). On Windows
+        platform all CPUs of the set must belong to a single processor group.
+
+        \param affinity - Thread CPU affinity set
+    */
+    static void SetAffinity(const CPUSet& affinity);
+    //! Set the given thread CPU affinity set
+    /*!
+        \param thread - Thread
+        \param affinity - Thread CPU affinity set
+    */
+    static void SetAffinity(std::thread& thread, const CPUSet& affinity);
+
     //! Get the current thread priority
     /*!
         \return Priority of the current thread
@@ -6,6 +6,10 @@
     \copyright MIT License
 */
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace CppCommon {
 
 template <class TOutputStream>
@@ -54,4 +58,17 @@ inline std::thread Thread::Start(Fn&& fn, Args&&... args)
     });
 }
 
+inline void Thread::Pause() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+    __yield();
+#elif defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
 } // namespace CppCommon
@@ -0,0 +1,190 @@
+/*!
+    \file thread_local.h
+    \brief Thread local storage object definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_THREAD_LOCAL_H
+#define CPPCOMMON_THREADS_THREAD_LOCAL_H
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Thread local value entry
+struct ThreadLocalEntry
+{
+    void* owner{nullptr};
+    ThreadLocalEntry* prev{nullptr};
+    ThreadLocalEntry* next{nullptr};
+
+    virtual ~ThreadLocalEntry() = default;
+};
+
+//! Thread local slots of the current thread
+struct ThreadLocalSlots
+{
+    ThreadLocalEntry** data;
+    size_t size;
+};
+
+//! Thread local slots of the current thread (trivial, so the access does not need the initialization guard)
+inline thread_local ThreadLocalSlots thread_local_slots = { nullptr, 0 };
+
+//! Thread local object base
+/*!
+    Each thread local object takes a unique slot index. Each thread keeps
+    the array of slots with entries of thread local objects it has accessed.
+    Entries of the thread are retired and destroyed when the thread exits,
+    all entries of the thread local object are destroyed with it.
+
+    Thread-safe.
+*/
+class ThreadLocalBase
+{
+public:
+    ThreadLocalBase();
+    ThreadLocalBase(const ThreadLocalBase&) = delete;
+    ThreadLocalBase(ThreadLocalBase&&) = delete;
+    virtual ~ThreadLocalBase() = default;
+
+    ThreadLocalBase& operator=(const ThreadLocalBase&) = delete;
+    ThreadLocalBase& operator=(ThreadLocalBase&&) = delete;
+
+    //! Retire the entry of the exited thread
+    virtual void Retire(ThreadLocalEntry* entry) noexcept = 0;
+
+    //! Detach the entry of the exited thread
+    void Detach(ThreadLocalEntry* entry) noexcept;
+
+protected:
+    size_t _index;
+    mutable std::mutex _mutex;
+    ThreadLocalEntry* _head;
+    size_t _size;
+
+    //! Find the entry of the current thread
+    ThreadLocalEntry* Find() const noexcept
+    {
+        const ThreadLocalSlots& slots = thread_local_slots;
+        return (_index < slots.size) ? slots.data[_index] : nullptr;
+    }
+
+    //! Attach the new entry of the current thread
+    void Attach(ThreadLocalEntry* entry);
+    //! Destroy all entries and release the slot index
+    void Destroy() noexcept;
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Thread local storage object
+/*!
+    Thread local storage object keeps a separate value for each thread like
+    thread_local variables, but it could be created dynamically as a member
+    of another object (sharded statistics, per-thread caches, allocator
+    magazines).
+
+    Access to the value of the current thread costs a few loads from the
+    per-thread array of slots (O(1), no locks and no hash lookups). The value
+    is created with the factory on the first access from the thread. When
+    the thread exits its value is passed to the retire handler (e.g. to fold
+    statistics of the exited thread into the global total) and destroyed.
+    All values are destroyed when the thread local object is destroyed.
+
+    for_each() visits values of all live threads under the lock, so values
+    which are concurrently modified by their threads should be atomic or
+    protected by the user.
+
+    The thread local object must not be destroyed while other threads access
+    it. The retire handler must not access thread local objects.
+
+    Thread-safe.
+*/
+template <typename T>
+class ThreadLocal : private Internals::ThreadLocalBase
+{
+public:
+    //! Initialize the thread local object with default constructed values
+    ThreadLocal() = default;
+    //! Initialize the thread local object with values created by the given factory
+    /*!
+        \param factory - Value factory
+        \param retire - Retire handler called with the value of each exited thread (default is none)
+    */
+    explicit ThreadLocal(std::function<T()> factory, std::function<void(T&)> retire = nullptr)
+        : _factory(std::move(factory)), _retire(std::move(retire))
+    {}
+    ThreadLocal(const ThreadLocal&) = delete;
+    ThreadLocal(ThreadLocal&&) = delete;
+    ~ThreadLocal() { Destroy(); }
+
+    ThreadLocal& operator=(const ThreadLocal&) = delete;
+    ThreadLocal& operator=(ThreadLocal&&) = delete;
+
+    T& operator*() { return get(); }
+    T* operator->() { return &get(); }
+
+    //! Get the count of live thread values
+    size_t size() const;
+
+    //! Get the value of the current thread (created on the first access)
+    T& get()
+    {
+        Internals::ThreadLocalEntry* entry = Find();
+        return (entry != nullptr) ? static_cast<Entry*>(entry)->value : Create();
+    }
+    //! Find the value of the current thread
+    /*!
+        \return Pointer to the value of the current thread or nullptr if it is not created yet
+    */
+    T* find() noexcept
+    {
+        Internals::ThreadLocalEntry* entry = Find();
+        return (entry != nullptr) ? &static_cast<Entry*>(entry)->value : nullptr;
+    }
+
+    //! Visit values of all live threads
+    /*!
+        Registration of new threads and exit of threads are blocked while
+        visiting values.
+
+        \param visitor - Visitor function called with each value
+    */
+    template <class TVisitor>
+    void for_each(TVisitor&& visitor);
+    template <class TVisitor>
+    void for_each(TVisitor&& visitor) const;
+
+private:
+    // Thread local value entry
+    struct Entry : public Internals::ThreadLocalEntry
+    {
+        T value;
+
+        Entry() : value() {}
+        explicit Entry(const std::function<T()>& factory) : value(factory()) {}
+    };
+
+    std::function<T()> _factory;
+    std::function<void(T&)> _retire;
+
+    T& Create();
+    void Retire(Internals::ThreadLocalEntry* entry) noexcept override;
+};
+
+/*! \example threads_thread_local.cpp Thread local storage object example */
+
+} // namespace CppCommon
+
+#include "thread_local.inl"
+
+#endif // CPPCOMMON_THREADS_THREAD_LOCAL_H
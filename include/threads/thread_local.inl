@@ -0,0 +1,61 @@
+/*!
+    \file thread_local.inl
+    \brief Thread local storage object inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline size_t ThreadLocal<T>::size() const
+{
+    std::scoped_lock lock(_mutex);
+    return _size;
+}
+
+template <typename T>
+template <class TVisitor>
+inline void ThreadLocal<T>::for_each(TVisitor&& visitor)
+{
+    std::scoped_lock lock(_mutex);
+    for (Internals::ThreadLocalEntry* entry = _head; entry != nullptr; entry = entry->next)
+        visitor(static_cast<Entry*>(entry)->value);
+}
+
+template <typename T>
+template <class TVisitor>
+inline void ThreadLocal<T>::for_each(TVisitor&& visitor) const
+{
+    std::scoped_lock lock(_mutex);
+    for (const Internals::ThreadLocalEntry* entry = _head; entry != nullptr; entry = entry->next)
+        visitor(static_cast<const Entry*>(entry)->value);
+}
+
+template <typename T>
+inline T& ThreadLocal<T>::Create()
+{
+    // Create the value outside of locks, so the factory could access other thread local objects
+    Entry* entry = _factory ? new Entry(_factory) : new Entry();
+    try
+    {
+        Attach(entry);
+    }
+    catch (...)
+    {
+        delete entry;
+        throw;
+    }
+    return entry->value;
+}
+
+template <typename T>
+inline void ThreadLocal<T>::Retire(Internals::ThreadLocalEntry* entry) noexcept
+{
+    if (_retire)
+        _retire(static_cast<Entry*>(entry)->value);
+    delete entry;
+}
+
+} // namespace CppCommon
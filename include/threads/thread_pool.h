@@ -0,0 +1,138 @@
+/*!
+    \file thread_pool.h
+    \brief Work-stealing thread pool definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_THREAD_POOL_H
+#define CPPCOMMON_THREADS_THREAD_POOL_H
+
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/thread.h"
+#include "threads/work_stealing_deque.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Work-stealing thread pool
+/*!
+    Work-stealing thread pool executes posted tasks with a fixed set of worker
+    threads. Each worker has its own work-stealing deque for tasks posted from
+    the worker thread (nested fan-out), so the common path does not touch any
+    shared state. Tasks posted from other threads go to the global injection
+    queue. Idle worker takes tasks from its own deque (LIFO), then from the
+    injection queue, then steals from other workers (FIFO).
+
+    Idle workers spin for a while and then park on the auto-reset event
+    until new tasks are posted.
+
+    Worker threads could be optionally pinned to CPU cores.
+
+    Thread-safe.
+*/
+class ThreadPool
+{
+public:
+    //! Thread pool task
+    typedef std::function<void()> Task;
+
+    //! Initialize and start the thread pool
+    /*!
+        \param threads - Count of worker threads (default is 0 which means hardware concurrency)
+        \param capacity - Global injection queue capacity (must be a power of two, default is 4096)
+        \param pinning - Pin worker threads to CPU cores (default is false)
+    */
+    explicit ThreadPool(size_t threads = 0, size_t capacity = 4096, bool pinning = false);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ~ThreadPool() { Stop(); }
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    //! Get the count of worker threads
+    size_t threads() const noexcept { return _workers.size(); }
+    //! Get the count of posted and not completed tasks
+    size_t pending() const noexcept { return _pending.load(std::memory_order_acquire); }
+
+    //! Is the thread pool stopped?
+    bool stopped() const noexcept { return _stopping.load(std::memory_order_acquire); }
+
+    //! Get the index of the current worker thread of the thread pool
+    /*!
+        \return Index of the current worker thread or -1 if the current thread is not a worker of the thread pool
+    */
+    int current() const noexcept;
+
+    //! Post the task into the thread pool
+    /*!
+        Tasks posted from worker threads go to the worker deque and always
+        succeed. Tasks posted from other threads go to the global injection
+        queue and fail if the queue is full. Tasks must not throw exceptions.
+
+        Will not block.
+
+        \param task - Task to post
+        \return 'true' if the task was successfully posted, 'false' if the thread pool is stopped or the global injection queue is full
+    */
+    bool Post(Task task);
+
+    //! Wait for all posted tasks are completed
+    /*!
+        Must not be called from worker threads.
+
+        Will block.
+    */
+    void Wait();
+
+    //! Stop the thread pool
+    /*!
+        Completes all posted tasks and joins worker threads.
+
+        Will block.
+    */
+    void Stop();
+
+private:
+    // Worker thread
+    struct Worker
+    {
+        std::thread thread;
+        WorkStealingDeque<Task*> deque;
+        uint64_t random;
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    MPMCRingQueue<Task*> _queue;
+    EventAutoReset _wakeup;
+    std::atomic<size_t> _idle;
+    std::atomic<size_t> _pending;
+    std::atomic<bool> _stopping;
+    std::atomic<bool> _stopped;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+
+    //! Worker thread loop
+    void Execute(size_t index);
+    //! Fetch the next task for the given worker
+    bool Fetch(size_t index, Task*& task);
+    //! Run the task
+    void Run(Task* task);
+    //! Wake up one of idle workers
+    void Notify();
+};
+
+/*! \example threads_thread_pool.cpp Work-stealing thread pool example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_THREAD_POOL_H
@@ -0,0 +1,124 @@
+/*!
+    \file ticket_spin_lock.h
+    \brief Ticket spin-lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TICKET_SPIN_LOCK_H
+#define CPPCOMMON_THREADS_TICKET_SPIN_LOCK_H
+
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Ticket spin-lock synchronization primitive
+/*!
+    Ticket spin-lock grants the lock to waiting threads in the FIFO order, so
+    it is fair and starvation-free. Each thread takes the next ticket and spins
+    until the owner ticket reaches it. Waiting threads only read the owner
+    ticket and back off proportionally to their distance from the owner.
+    Ticket counters are placed on separate cache lines, so new arrivals do not
+    disturb waiting threads.
+
+    All waiting threads spin on the same cache line, so it fits the moderate
+    contention. Use MCSSpinLock for the high contention.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Ticket_lock
+*/
+class TicketSpinLock
+{
+public:
+    TicketSpinLock() noexcept : _next(0), _owner(0) {}
+    TicketSpinLock(const TicketSpinLock&) = delete;
+    TicketSpinLock(TicketSpinLock&&) = delete;
+    ~TicketSpinLock() = default;
+
+    TicketSpinLock& operator=(const TicketSpinLock&) = delete;
+    TicketSpinLock& operator=(TicketSpinLock&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock is already locked, 'false' if the spin-lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire spin-lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire spin-lock for the given spin count
+    /*!
+        Will block for the given spin count in the worst case.
+
+        \param spin - Spin count
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockSpin(int64_t spin) noexcept;
+
+    //! Try to acquire spin-lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire spin-lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire spin-lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock() noexcept;
+
+    //! Release spin-lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    static constexpr uint32_t PauseFactor = 32;
+    static constexpr uint32_t MaxBackoff = 1024;
+    static constexpr int MaxSpin = 64;
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<uint32_t> _next;
+    cache_line_pad _pad1;
+    std::atomic<uint32_t> _owner;
+    cache_line_pad _pad2;
+};
+
+/*! \example threads_ticket_spin_lock.cpp Ticket spin-lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "ticket_spin_lock.inl"
+
+#endif // CPPCOMMON_THREADS_TICKET_SPIN_LOCK_H
@@ -0,0 +1,98 @@
+/*!
+    \file ticket_spin_lock.inl
+    \brief Ticket spin-lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool TicketSpinLock::IsLocked() noexcept
+{
+    return (_next.load(std::memory_order_acquire) != _owner.load(std::memory_order_acquire));
+}
+
+inline bool TicketSpinLock::TryLock() noexcept
+{
+    // Take the next ticket only if it is the owner one
+    uint32_t owner = _owner.load(std::memory_order_acquire);
+    uint32_t next = owner;
+    return _next.compare_exchange_strong(next, owner + 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline bool TicketSpinLock::TryLockSpin(int64_t spin) noexcept
+{
+    uint32_t backoff = 1;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+
+        // Exponential backoff
+        for (uint32_t i = 0; i < backoff; ++i)
+            Thread::Pause();
+        backoff = std::min(backoff * 2, MaxBackoff);
+    } while (spin-- > 0);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline bool TicketSpinLock::TryLockFor(const Timespan& timespan) noexcept
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    uint32_t backoff = 1;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+
+        // Exponential backoff
+        for (uint32_t i = 0; i < backoff; ++i)
+            Thread::Pause();
+        backoff = std::min(backoff * 2, MaxBackoff);
+    } while (NanoTimestamp() < finish);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline void TicketSpinLock::Lock() noexcept
+{
+    uint32_t ticket = _next.fetch_add(1, std::memory_order_relaxed);
+
+    int spin = 0;
+    for (;;)
+    {
+        uint32_t owner = _owner.load(std::memory_order_acquire);
+        if (owner == ticket)
+            return;
+
+        // Proportional backoff: distant tickets wait longer
+        uint32_t backoff = std::min((ticket - owner) * PauseFactor, MaxBackoff);
+        for (uint32_t i = 0; i < backoff; ++i)
+            Thread::Pause();
+
+        // Yield to other threads if the lock owner seems to be preempted
+        if (++spin >= MaxSpin)
+        {
+            Thread::Yield();
+            spin = 0;
+        }
+    }
+}
+
+inline void TicketSpinLock::Unlock() noexcept
+{
+    // Only the lock owner changes the owner ticket
+    _owner.store(_owner.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,166 @@
+/*!
+    \file timer_service.h
+    \brief Timer service definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TIMER_SERVICE_H
+#define CPPCOMMON_THREADS_TIMER_SERVICE_H
+
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! Timer service
+/*!
+    Timer service schedules a large count of one-shot and periodic timers with
+    a single timer thread. Timers are kept in the 4-ary min-heap ordered by the
+    deadline, so schedule and cancel operations take O(log n) time.
+
+    Timer thread sleeps until the earliest deadline. Scheduling of a timer with
+    the later deadline does not wake it up. All timers expired within the given
+    slack are fired at once to coalesce wakeups.
+
+    Expired timer tasks are dispatched to the given executor (e.g. posted into
+    the thread pool) or executed in the timer thread if the executor is empty.
+    Periodic timer task could be dispatched once after its cancellation if it
+    is already expired.
+
+    Thread-safe.
+*/
+class TimerService
+{
+public:
+    //! Timer task
+    typedef std::function<void()> Task;
+    //! Timer tasks executor
+    typedef std::function<void(Task)> Executor;
+    //! Timer Id (zero is invalid Id)
+    typedef uint64_t TimerId;
+
+    //! Initialize and start the timer service
+    /*!
+        \param executor - Timer tasks executor (default is empty executor which means execution in the timer thread)
+        \param slack - Timers coalescing slack (default is 1 millisecond)
+    */
+    explicit TimerService(const Executor& executor = nullptr, const Timespan& slack = Timespan::milliseconds(1));
+    TimerService(const TimerService&) = delete;
+    TimerService(TimerService&&) = delete;
+    ~TimerService() { Stop(); }
+
+    TimerService& operator=(const TimerService&) = delete;
+    TimerService& operator=(TimerService&&) = delete;
+
+    //! Get the count of scheduled timers
+    size_t timers() const noexcept { return _count.load(std::memory_order_acquire); }
+
+    //! Is the timer service stopped?
+    bool stopped() const noexcept { return _stopped.load(std::memory_order_acquire); }
+
+    //! Schedule one-shot timer at the given timestamp
+    /*!
+        \param timestamp - Timer timestamp
+        \param task - Timer task
+        \return Timer Id or zero if the timer service is stopped
+    */
+    TimerId ScheduleAt(const UtcTimestamp& timestamp, Task task)
+    { return ScheduleAfter(timestamp - UtcTimestamp(), std::move(task)); }
+    //! Schedule one-shot timer after the given timespan
+    /*!
+        \param timespan - Timer timespan
+        \param task - Timer task
+        \return Timer Id or zero if the timer service is stopped
+    */
+    TimerId ScheduleAfter(const Timespan& timespan, Task task);
+    //! Schedule periodic timer with the given period
+    /*!
+        The first timer task is dispatched after the given period. Next timer
+        deadlines are calculated from the previous ones, so periodic timer does
+        not drift. Missed periods are skipped.
+
+        \param period - Timer period (must be greater than zero)
+        \param task - Timer task
+        \return Timer Id or zero if the timer service is stopped
+    */
+    TimerId ScheduleEvery(const Timespan& period, Task task);
+
+    //! Cancel the scheduled timer
+    /*!
+        \param timer - Timer Id
+        \return 'true' if the timer was successfully cancelled, 'false' if the timer is already expired or cancelled
+    */
+    bool Cancel(TimerId timer);
+
+    //! Stop the timer service
+    /*!
+        Drops all scheduled timers and joins the timer thread.
+
+        Will block.
+    */
+    void Stop();
+
+private:
+    // Timer
+    struct Timer
+    {
+        Task task;
+        int64_t period;
+        uint32_t generation;
+        uint32_t position;
+    };
+
+    // Timers heap entry
+    struct Entry
+    {
+        int64_t deadline;
+        uint32_t slot;
+    };
+
+    CriticalSection _cs;
+    EventAutoReset _wakeup;
+    Executor _executor;
+    int64_t _slack;
+    int64_t _armed;
+    std::vector<Timer> _timers;
+    std::vector<uint32_t> _free;
+    std::vector<Entry> _heap;
+    std::atomic<size_t> _count;
+    std::atomic<bool> _stopped;
+    std::thread _thread;
+
+    //! Schedule the timer with the given deadline
+    TimerId Schedule(int64_t deadline, int64_t period, Task&& task);
+    //! Release the timer slot
+    void Release(uint32_t slot);
+
+    //! Timer thread loop
+    void Execute();
+
+    //! Push the entry into the timers heap
+    void Push(const Entry& entry);
+    //! Remove the entry at the given position from the timers heap
+    void Remove(uint32_t position);
+    //! Move the entry at the given position up the timers heap
+    void SiftUp(uint32_t position);
+    //! Move the entry at the given position down the timers heap
+    void SiftDown(uint32_t position);
+    //! Place the entry at the given position of the timers heap
+    void Place(const Entry& entry, uint32_t position);
+};
+
+/*! \example threads_timer_service.cpp Timer service example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_TIMER_SERVICE_H
@@ -0,0 +1,107 @@
+/*!
+    \file tree_barrier.h
+    \brief Combining tree barrier synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TREE_BARRIER_H
+#define CPPCOMMON_THREADS_TREE_BARRIER_H
+
+#include "memory/cache_padded.h"
+#include "threads/combining_tree.h"
+#include "threads/wait_strategy.h"
+
+#include <atomic>
+#include <memory>
+
+namespace CppCommon {
+
+//! Combining tree barrier synchronization primitive
+/*!
+    Tree barrier is a scalable version of SpinBarrier for many-core systems.
+    Instead of a single counter shared by all threads each participant
+    arrives at its leaf node of the combining tree. The last thread arrived
+    at the node continues to the parent node, the last thread arrived at the
+    root node completes the phase. Wakeups propagate back down the tree:
+    each thread spins on the generation of its own node and releases nodes
+    it has completed. So each cache line is shared only by children of a
+    single node and the phase costs O(log N) cache line transfers on the
+    critical path. Topology-aware tree keeps nodes of the first levels
+    within physical cores and shared caches.
+
+    Each thread must use its own participant index in range [0, threads).
+
+    Spin version: threads spin and then yield the CPU while waiting.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Barrier_(computer_science)#Combining_tree_barrier
+*/
+class TreeBarrier
+{
+public:
+    //! Initialize the tree barrier for consecutive participants
+    /*!
+        \param threads - Count of threads to wait at the barrier
+        \param fanin - Maximal count of children of each tree node (default is CombiningTree::FANIN)
+    */
+    explicit TreeBarrier(int threads, int fanin = CombiningTree::FANIN) : TreeBarrier(CombiningTree(threads, fanin)) {}
+    //! Initialize the topology-aware tree barrier for participants pinned to the given CPUs
+    /*!
+        \param cpus - Logical CPU index of each participant
+        \param topology - CPU topology (default is CPUTopology::Current())
+        \param fanin - Maximal count of children of each tree node (default is CombiningTree::FANIN)
+    */
+    explicit TreeBarrier(const std::vector<int>& cpus, const CPUTopology& topology = CPUTopology::Current(), int fanin = CombiningTree::FANIN) : TreeBarrier(CombiningTree(cpus, topology, fanin)) {}
+    //! Initialize the tree barrier with the given combining tree
+    /*!
+        \param tree - Combining tree
+    */
+    explicit TreeBarrier(const CombiningTree& tree);
+    TreeBarrier(const TreeBarrier&) = delete;
+    TreeBarrier(TreeBarrier&&) = delete;
+    ~TreeBarrier() = default;
+
+    TreeBarrier& operator=(const TreeBarrier&) = delete;
+    TreeBarrier& operator=(TreeBarrier&&) = delete;
+
+    //! Get the count of threads to wait at the barrier
+    int threads() const noexcept { return _tree.participants(); }
+    //! Get the combining tree of the barrier
+    const CombiningTree& tree() const noexcept { return _tree; }
+
+    //! Wait at the barrier until all other threads reach this barrier
+    /*!
+        Will block.
+
+        \param participant - Participant index of the calling thread
+        \return 'true' for the last thread that reach barrier, 'false' for each of the remaining threads
+    */
+    bool Wait(int participant) noexcept;
+
+private:
+    // Tree node state in its own cache line
+    struct Node
+    {
+        std::atomic<int> counter;
+        std::atomic<int> generation;
+        int count;
+        int parent;
+    };
+
+    CombiningTree _tree;
+    std::unique_ptr<CachePadded<Node>[]> _nodes;
+    YieldWaitStrategy _wait;
+
+    bool Arrive(int node) noexcept;
+};
+
+/*! \example threads_tree_barrier.cpp Combining tree barrier synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "tree_barrier.inl"
+
+#endif // CPPCOMMON_THREADS_TREE_BARRIER_H
@@ -0,0 +1,58 @@
+/*!
+    \file tree_barrier.inl
+    \brief Combining tree barrier synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline TreeBarrier::TreeBarrier(const CombiningTree& tree) : _tree(tree), _nodes(std::make_unique<CachePadded<Node>[]>(tree.size()))
+{
+    for (int i = 0; i < _tree.size(); ++i)
+    {
+        Node& node = *_nodes[i];
+        node.counter = _tree.nodes()[i].count;
+        node.generation = 0;
+        node.count = _tree.nodes()[i].count;
+        node.parent = _tree.nodes()[i].parent;
+    }
+}
+
+inline bool TreeBarrier::Wait(int participant) noexcept
+{
+    return Arrive(_tree.leaf(participant));
+}
+
+inline bool TreeBarrier::Arrive(int index) noexcept
+{
+    Node& node = *_nodes[index];
+
+    // Remember the current node generation
+    int generation = node.generation.load(std::memory_order_relaxed);
+
+    // Decrease the count of waiting children
+    if (node.counter.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // The last child continues to the parent node
+        bool last = (node.parent < 0) ? true : Arrive(node.parent);
+
+        // Reset the node and release waiting children
+        node.counter.store(node.count, std::memory_order_relaxed);
+        node.generation.store(generation + 1, std::memory_order_release);
+
+        // Notify the last thread that reached the barrier
+        return last;
+    }
+    else
+    {
+        // Wait for the next node generation
+        _wait.Wait([&node, generation]() { return node.generation.load(std::memory_order_acquire) != generation; });
+
+        // Notify each of remaining threads
+        return false;
+    }
+}
+
+} // namespace CppCommon
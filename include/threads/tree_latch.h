@@ -0,0 +1,137 @@
+/*!
+    \file tree_latch.h
+    \brief Combining tree latch synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TREE_LATCH_H
+#define CPPCOMMON_THREADS_TREE_LATCH_H
+
+#include "memory/cache_padded.h"
+#include "threads/combining_tree.h"
+#include "threads/wait_strategy.h"
+
+#include <atomic>
+#include <memory>
+
+namespace CppCommon {
+
+//! Combining tree latch synchronization primitive
+/*!
+    Tree latch is a scalable version of Latch for many-core systems. Each
+    participant counts down its leaf node of the combining tree, the last
+    participant of the node counts down the parent node, and so on up to the
+    root node. The thread which counts down the root node releases the
+    latch in each node, so waiting threads spin on the cache line of their
+    own leaf node instead of a single shared counter.
+
+    Each participant must count down the latch once with its own participant
+    index in range [0, threads). Any thread may wait for the latch using any
+    participant index as a hint of the node to spin on.
+
+    Spin version: threads spin and then yield the CPU while waiting.
+
+    Thread-safe.
+*/
+class TreeLatch
+{
+public:
+    //! Initialize the tree latch for consecutive participants
+    /*!
+        \param threads - Count of threads to count down the latch
+        \param fanin - Maximal count of children of each tree node (default is CombiningTree::FANIN)
+    */
+    explicit TreeLatch(int threads, int fanin = CombiningTree::FANIN) : TreeLatch(CombiningTree(threads, fanin)) {}
+    //! Initialize the topology-aware tree latch for participants pinned to the given CPUs
+    /*!
+        \param cpus - Logical CPU index of each participant
+        \param topology - CPU topology (default is CPUTopology::Current())
+        \param fanin - Maximal count of children of each tree node (default is CombiningTree::FANIN)
+    */
+    explicit TreeLatch(const std::vector<int>& cpus, const CPUTopology& topology = CPUTopology::Current(), int fanin = CombiningTree::FANIN) : TreeLatch(CombiningTree(cpus, topology, fanin)) {}
+    //! Initialize the tree latch with the given combining tree
+    /*!
+        \param tree - Combining tree
+    */
+    explicit TreeLatch(const CombiningTree& tree);
+    TreeLatch(const TreeLatch&) = delete;
+    TreeLatch(TreeLatch&&) = delete;
+    ~TreeLatch() = default;
+
+    TreeLatch& operator=(const TreeLatch&) = delete;
+    TreeLatch& operator=(TreeLatch&&) = delete;
+
+    //! Get the count of threads to count down the latch
+    int threads() const noexcept { return _tree.participants(); }
+    //! Get the combining tree of the latch
+    const CombiningTree& tree() const noexcept { return _tree; }
+
+    //! Reset the latch
+    /*!
+        This method may only be invoked when there are no other threads currently
+        inside the waiting for the latch.
+
+        Will not block.
+    */
+    void Reset() noexcept;
+
+    //! Countdown the latch
+    /*!
+        If the latch counter reaches 0, any threads waiting for the latch will be released.
+
+        Will not block.
+
+        \param participant - Participant index of the calling thread
+    */
+    void CountDown(int participant) noexcept;
+
+    //! Countdown the latch and wait until the latch counter is zero
+    /*!
+        Will block.
+
+        \param participant - Participant index of the calling thread
+    */
+    void CountDownAndWait(int participant) noexcept
+    { CountDown(participant); Wait(participant); }
+
+    //! Wait for the latch
+    /*!
+        Will block.
+
+        \param participant - Participant index to spin on its leaf node
+    */
+    void Wait(int participant) noexcept;
+
+    //! Try to wait for the latch without block
+    /*!
+        Will not block.
+
+        \return 'true' if the latch counter is zero, 'false' if the latch counter is not zero
+    */
+    bool TryWait() const noexcept
+    { return _nodes[_tree.root()]->released.load(std::memory_order_acquire); }
+
+private:
+    // Tree node state in its own cache line
+    struct Node
+    {
+        std::atomic<int> counter;
+        std::atomic<bool> released;
+        int count;
+        int parent;
+    };
+
+    CombiningTree _tree;
+    std::unique_ptr<CachePadded<Node>[]> _nodes;
+    YieldWaitStrategy _wait;
+};
+
+/*! \example threads_tree_latch.cpp Combining tree latch synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "tree_latch.inl"
+
+#endif // CPPCOMMON_THREADS_TREE_LATCH_H
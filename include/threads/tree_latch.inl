@@ -0,0 +1,53 @@
+/*!
+    \file tree_latch.inl
+    \brief Combining tree latch synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline TreeLatch::TreeLatch(const CombiningTree& tree) : _tree(tree), _nodes(std::make_unique<CachePadded<Node>[]>(tree.size()))
+{
+    for (int i = 0; i < _tree.size(); ++i)
+    {
+        _nodes[i]->count = _tree.nodes()[i].count;
+        _nodes[i]->parent = _tree.nodes()[i].parent;
+    }
+    Reset();
+}
+
+inline void TreeLatch::Reset() noexcept
+{
+    for (int i = 0; i < _tree.size(); ++i)
+    {
+        _nodes[i]->counter.store(_nodes[i]->count, std::memory_order_relaxed);
+        _nodes[i]->released.store(false, std::memory_order_release);
+    }
+}
+
+inline void TreeLatch::CountDown(int participant) noexcept
+{
+    // Count down nodes up to the root node while the participant is the last one
+    int index = _tree.leaf(participant);
+    while (_nodes[index]->counter.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        index = _nodes[index]->parent;
+        if (index < 0)
+        {
+            // Release the latch in each node
+            for (int i = _tree.root(); i >= 0; --i)
+                _nodes[i]->released.store(true, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+inline void TreeLatch::Wait(int participant) noexcept
+{
+    Node& node = *_nodes[_tree.leaf(participant)];
+    _wait.Wait([&node]() { return node.released.load(std::memory_order_acquire); });
+}
+
+} // namespace CppCommon
@@ -10,8 +10,10 @@
 #define CPPCOMMON_THREADS_WAIT_BATCHER_H
 
 #include "condition_variable.h"
+#include "time/timestamp.h"
 
 #include <cassert>
+#include <iterator>
 #include <vector>
 
 namespace CppCommon {
@@ -23,6 +25,12 @@ namespace CppCommon {
     synchronization primitive (mutex with condition variable). It allows a consumer thread
     to process all items in queue in a batch mode.
 
+    Adaptive batching waits for the batch size threshold or the batch time threshold,
+    whichever comes first, so low traffic does not produce tiny batches. Producers wake
+    up the batching consumer only when the batch becomes non empty or reaches its size
+    threshold. Batch vectors are swapped with the consumer, so steady-state operation
+    does no allocations if the consumer reuses the same vector.
+
     FIFO order is guaranteed!
 
     https://en.wikipedia.org/wiki/Producer%E2%80%93consumer_problem
@@ -98,6 +106,22 @@ public:
         \return 'true' if all items was successfully dequeue, 'false' if the wait batcher is closed
     */
     bool Dequeue(std::vector<T>& items);
+    //! Dequeue the batch of items from the wait batcher with adaptive batching
+    /*!
+        Waits for the first item, then waits until the batch has the given count
+        of items or the given timespan from the first item observed by the consumer
+        is passed, whichever comes first. The batch is limited with the given
+        maximal count of items, remaining items are left for the next dequeue.
+
+        Will block.
+
+        \param items - Items to dequeue
+        \param threshold - Batch size threshold
+        \param timespan - Batch time threshold
+        \param limit - Maximal batch size (default is 0 for unlimited batch size)
+        \return 'true' if the batch was successfully dequeue, 'false' if the wait batcher is closed
+    */
+    bool Dequeue(std::vector<T>& items, size_t threshold, const Timespan& timespan, size_t limit = 0);
 
     //! Close the wait batcher
     /*!
@@ -112,6 +136,10 @@ private:
     ConditionVariable _cv1;
     ConditionVariable _cv2;
     std::vector<T> _batch;
+    size_t _threshold;
+
+    //! Notify waiting consumers about the batch grown from the given size
+    void Notify(size_t previous);
 };
 
 /*! \example threads_wait_batcher.cpp Multiple producers / multiple consumers wait batcher example */
@@ -9,7 +9,7 @@
 namespace CppCommon {
 
 template<typename T>
-inline WaitBatcher<T>::WaitBatcher(size_t capacity, size_t initial) : _closed(false),  _capacity(capacity)
+inline WaitBatcher<T>::WaitBatcher(size_t capacity, size_t initial) : _closed(false),  _capacity(capacity), _threshold(0)
 {
     _batch.reserve(initial);
 }
@@ -56,8 +56,9 @@ inline bool WaitBatcher<T>::Enqueue(const T& item)
     {
         if ((_capacity == 0) || (_batch.size() < _capacity))
         {
+            size_t previous = _batch.size();
             _batch.push_back(item);
-            _cv1.NotifyOne();
+            Notify(previous);
             return true;
         }
 
@@ -80,8 +81,9 @@ inline bool WaitBatcher<T>::Enqueue(T&& item)
     {
         if ((_capacity == 0) || (_batch.size() < _capacity))
         {
-            _batch.emplace_back(item);
-            _cv1.NotifyOne();
+            size_t previous = _batch.size();
+            _batch.emplace_back(std::move(item));
+            Notify(previous);
             return true;
         }
 
@@ -105,8 +107,9 @@ inline bool WaitBatcher<T>::Enqueue(InputIterator first, InputIterator last)
     {
         if ((_capacity == 0) || (_batch.size() < _capacity))
         {
+            size_t previous = _batch.size();
             _batch.insert(_batch.end(), first, last);
-            _cv1.NotifyOne();
+            Notify(previous);
             return true;
         }
 
@@ -145,6 +148,73 @@ inline bool WaitBatcher<T>::Dequeue(std::vector<T>& items)
     return false;
 }
 
+template<typename T>
+inline bool WaitBatcher<T>::Dequeue(std::vector<T>& items, size_t threshold, const Timespan& timespan, size_t limit)
+{
+    // Clear the result items vector
+    items.clear();
+
+    Locker<CriticalSection> locker(_cs);
+
+    for (;;)
+    {
+        // Wait for the first item
+        while (_batch.empty())
+        {
+            if (_closed)
+                return false;
+
+            _cv1.Wait(_cs);
+        }
+
+        // Wait for the batch size threshold or the batch time threshold
+        if ((_batch.size() < threshold) && !_closed)
+        {
+            int64_t deadline = NanoTimestamp().total() + timespan.total();
+            _threshold = threshold;
+            while ((_batch.size() < threshold) && !_closed)
+            {
+                int64_t timeout = deadline - NanoTimestamp().total();
+                if (timeout <= 0)
+                    break;
+
+                _cv1.TryWaitFor(_cs, Timespan(timeout));
+            }
+            _threshold = 0;
+        }
+
+        // The batch could be taken by another consumer
+        if (!_batch.empty())
+            break;
+    }
+
+    if ((limit == 0) || (_batch.size() <= limit))
+    {
+        // Swap batch items
+        std::swap(_batch, items);
+    }
+    else
+    {
+        // Take the limited batch of items
+        items.insert(items.end(), std::make_move_iterator(_batch.begin()), std::make_move_iterator(_batch.begin() + limit));
+        _batch.erase(_batch.begin(), _batch.begin() + limit);
+
+        // Hand over remaining items to another waiting consumer
+        _cv1.NotifyOne();
+    }
+
+    _cv2.NotifyOne();
+    return true;
+}
+
+template<typename T>
+inline void WaitBatcher<T>::Notify(size_t previous)
+{
+    // Wake up consumers waiting for the first item or the batching consumer waiting for its size threshold
+    if ((previous == 0) || ((previous < _threshold) && (_batch.size() >= _threshold)))
+        _cv1.NotifyOne();
+}
+
 template<typename T>
 inline void WaitBatcher<T>::Close()
 {
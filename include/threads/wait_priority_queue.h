@@ -0,0 +1,272 @@
+/*!
+    \file wait_priority_queue.h
+    \brief Multiple producers / multiple consumers wait priority queue definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WAIT_PRIORITY_QUEUE_H
+#define CPPCOMMON_THREADS_WAIT_PRIORITY_QUEUE_H
+
+#include "condition_variable.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers wait priority queue
+/*!
+    Multiple producers / multiple consumers wait priority queue provides a
+    classic solution for producer-consumer problem using priority queue and
+    monitor synchronization primitive (mutex with condition variable).
+
+    Dequeue returns the item with the highest priority first. As with
+    std::priority_queue the comparator defines the strict weak ordering and
+    'compare(a, b) == true' means the item 'a' has lower priority than 'b'.
+    Items with equal priorities are dequeued in FIFO order.
+
+    Items are kept in a cache-friendly implicit d-ary heap: with D = 4
+    children of each node are placed in one cache line for small items and
+    the heap depth is half of the binary heap one.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/D-ary_heap
+*/
+template<typename T, class TCompare = std::less<T>, size_t D = 4>
+class WaitPriorityQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Wait priority queue capacity (default is 0 for unlimited capacity)
+        \param compare - Items comparator (default is TCompare())
+    */
+    explicit WaitPriorityQueue(size_t capacity = 0, const TCompare& compare = TCompare());
+    WaitPriorityQueue(const WaitPriorityQueue&) = delete;
+    WaitPriorityQueue(WaitPriorityQueue&&) = delete;
+    ~WaitPriorityQueue();
+
+    WaitPriorityQueue& operator=(const WaitPriorityQueue&) = delete;
+    WaitPriorityQueue& operator=(WaitPriorityQueue&&) = delete;
+
+    //! Check if the wait priority queue is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is wait priority queue closed?
+    bool closed() const;
+
+    //! Is wait priority queue empty?
+    bool empty() const { return (size() == 0); }
+    //! Get wait priority queue capacity
+    size_t capacity() const;
+    //! Get wait priority queue size
+    size_t size() const;
+
+    //! Enqueue an item into the wait priority queue
+    /*!
+        The item will be copied into the wait priority queue.
+
+        Will block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the wait priority queue is closed
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the wait priority queue
+    /*!
+        The item will be moved into the wait priority queue.
+
+        Will block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the wait priority queue is closed
+    */
+    bool Enqueue(T&& item);
+
+    //! Dequeue the item with the highest priority from the wait priority queue
+    /*!
+        The item will be moved from the wait priority queue.
+
+        Will block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the wait priority queue is closed
+    */
+    bool Dequeue(T& item);
+    //! Try to dequeue the item with the highest priority from the wait priority queue
+    /*!
+        The item will be moved from the wait priority queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the wait priority queue is empty
+    */
+    bool TryDequeue(T& item);
+
+    //! Close the wait priority queue
+    /*!
+        Will block.
+    */
+    void Close();
+
+private:
+    struct Entry
+    {
+        T item;
+        uint64_t order;
+    };
+
+    bool _closed;
+    const size_t _capacity;
+    TCompare _compare;
+    mutable CriticalSection _cs;
+    ConditionVariable _cv1;
+    ConditionVariable _cv2;
+    uint64_t _order;
+    std::vector<Entry> _heap;
+
+    template <typename U>
+    bool EnqueueInternal(U&& item);
+    void Pop(T& item);
+
+    //! Check if the first entry has lower priority than the second one
+    bool Less(const Entry& entry1, const Entry& entry2) const;
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+};
+
+//! Multiple producers / multiple consumers wait deadline queue
+/*!
+    Multiple producers / multiple consumers wait deadline queue is a wait
+    priority queue in earliest-deadline-first mode: each item is enqueued
+    with its deadline timestamp and dequeue returns the item with the
+    earliest deadline first. Items with equal deadlines are dequeued in FIFO
+    order.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Earliest_deadline_first_scheduling
+*/
+template<typename T>
+class WaitDeadlineQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Wait deadline queue capacity (default is 0 for unlimited capacity)
+    */
+    explicit WaitDeadlineQueue(size_t capacity = 0) : _queue(capacity) {}
+    WaitDeadlineQueue(const WaitDeadlineQueue&) = delete;
+    WaitDeadlineQueue(WaitDeadlineQueue&&) = delete;
+    ~WaitDeadlineQueue() = default;
+
+    WaitDeadlineQueue& operator=(const WaitDeadlineQueue&) = delete;
+    WaitDeadlineQueue& operator=(WaitDeadlineQueue&&) = delete;
+
+    //! Check if the wait deadline queue is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is wait deadline queue closed?
+    bool closed() const { return _queue.closed(); }
+
+    //! Is wait deadline queue empty?
+    bool empty() const { return _queue.empty(); }
+    //! Get wait deadline queue capacity
+    size_t capacity() const { return _queue.capacity(); }
+    //! Get wait deadline queue size
+    size_t size() const { return _queue.size(); }
+
+    //! Enqueue an item with the given deadline into the wait deadline queue
+    /*!
+        The item will be copied into the wait deadline queue.
+
+        Will block.
+
+        \param deadline - Item deadline
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the wait deadline queue is closed
+    */
+    bool Enqueue(const Timestamp& deadline, const T& item) { return _queue.Enqueue(Deadline{ deadline, item }); }
+    //! Enqueue an item with the given deadline into the wait deadline queue
+    /*!
+        The item will be moved into the wait deadline queue.
+
+        Will block.
+
+        \param deadline - Item deadline
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the wait deadline queue is closed
+    */
+    bool Enqueue(const Timestamp& deadline, T&& item) { return _queue.Enqueue(Deadline{ deadline, std::move(item) }); }
+
+    //! Dequeue the item with the earliest deadline from the wait deadline queue
+    /*!
+        The item will be moved from the wait deadline queue.
+
+        Will block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the wait deadline queue is closed
+    */
+    bool Dequeue(T& item) { Timestamp deadline; return Dequeue(item, deadline); }
+    //! Dequeue the item with the earliest deadline from the wait deadline queue
+    /*!
+        The item will be moved from the wait deadline queue.
+
+        Will block.
+
+        \param item - Item to dequeue
+        \param deadline - Deadline of the dequeued item
+        \return 'true' if the item was successfully dequeue, 'false' if the wait deadline queue is closed
+    */
+    bool Dequeue(T& item, Timestamp& deadline);
+    //! Try to dequeue the item with the earliest deadline from the wait deadline queue
+    /*!
+        The item will be moved from the wait deadline queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \param deadline - Deadline of the dequeued item
+        \return 'true' if the item was successfully dequeue, 'false' if the wait deadline queue is empty
+    */
+    bool TryDequeue(T& item, Timestamp& deadline);
+
+    //! Close the wait deadline queue
+    /*!
+        Will block.
+    */
+    void Close() { _queue.Close(); }
+
+private:
+    struct Deadline
+    {
+        Timestamp deadline;
+        T item;
+    };
+
+    struct DeadlineCompare
+    {
+        // Later deadline has lower priority
+        bool operator()(const Deadline& deadline1, const Deadline& deadline2) const noexcept
+        { return (deadline2.deadline < deadline1.deadline); }
+    };
+
+    WaitPriorityQueue<Deadline, DeadlineCompare> _queue;
+};
+
+/*! \example threads_wait_priority_queue.cpp Multiple producers / multiple consumers wait priority queue example */
+
+} // namespace CppCommon
+
+#include "wait_priority_queue.inl"
+
+#endif // CPPCOMMON_THREADS_WAIT_PRIORITY_QUEUE_H
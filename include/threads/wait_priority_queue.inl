@@ -0,0 +1,225 @@
+/*!
+    \file wait_priority_queue.inl
+    \brief Multiple producers / multiple consumers wait priority queue inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T, class TCompare, size_t D>
+inline WaitPriorityQueue<T, TCompare, D>::WaitPriorityQueue(size_t capacity, const TCompare& compare) : _closed(false), _capacity(capacity), _compare(compare), _order(0)
+{
+    static_assert((D >= 2), "D-ary heap must have at least two children of each node!");
+
+    if (_capacity > 0)
+        _heap.reserve(_capacity);
+}
+
+template<typename T, class TCompare, size_t D>
+inline WaitPriorityQueue<T, TCompare, D>::~WaitPriorityQueue()
+{
+    Close();
+}
+
+template<typename T, class TCompare, size_t D>
+inline bool WaitPriorityQueue<T, TCompare, D>::closed() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _closed;
+}
+
+template<typename T, class TCompare, size_t D>
+inline size_t WaitPriorityQueue<T, TCompare, D>::capacity() const
+{
+    if (_capacity > 0)
+        return _capacity;
+
+    Locker<CriticalSection> locker(_cs);
+    return _heap.size();
+}
+
+template<typename T, class TCompare, size_t D>
+inline size_t WaitPriorityQueue<T, TCompare, D>::size() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _heap.size();
+}
+
+template<typename T, class TCompare, size_t D>
+inline bool WaitPriorityQueue<T, TCompare, D>::Enqueue(const T& item)
+{
+    return EnqueueInternal(item);
+}
+
+template<typename T, class TCompare, size_t D>
+inline bool WaitPriorityQueue<T, TCompare, D>::Enqueue(T&& item)
+{
+    return EnqueueInternal(std::move(item));
+}
+
+template<typename T, class TCompare, size_t D>
+template <typename U>
+inline bool WaitPriorityQueue<T, TCompare, D>::EnqueueInternal(U&& item)
+{
+    Locker<CriticalSection> locker(_cs);
+
+    if (_closed)
+        return false;
+
+    do
+    {
+        if ((_capacity == 0) || (_heap.size() < _capacity))
+        {
+            _heap.push_back(Entry{ std::forward<U>(item), _order++ });
+            SiftUp(_heap.size() - 1);
+            _cv1.NotifyOne();
+            return true;
+        }
+
+        _cv2.Wait(_cs, [this]() { return (_closed || (_capacity == 0) || (_heap.size() < _capacity)); });
+
+    } while (!_closed);
+
+    return false;
+}
+
+template<typename T, class TCompare, size_t D>
+inline bool WaitPriorityQueue<T, TCompare, D>::Dequeue(T& item)
+{
+    Locker<CriticalSection> locker(_cs);
+
+    if (_closed && _heap.empty())
+        return false;
+
+    do
+    {
+        if (!_heap.empty())
+        {
+            Pop(item);
+            _cv2.NotifyOne();
+            return true;
+        }
+
+        _cv1.Wait(_cs, [this]() { return (_closed || !_heap.empty()); });
+
+    } while (!_closed || !_heap.empty());
+
+    return false;
+}
+
+template<typename T, class TCompare, size_t D>
+inline bool WaitPriorityQueue<T, TCompare, D>::TryDequeue(T& item)
+{
+    Locker<CriticalSection> locker(_cs);
+
+    if (_heap.empty())
+        return false;
+
+    Pop(item);
+    _cv2.NotifyOne();
+    return true;
+}
+
+template<typename T, class TCompare, size_t D>
+inline void WaitPriorityQueue<T, TCompare, D>::Close()
+{
+    Locker<CriticalSection> locker(_cs);
+    _closed = true;
+    _cv1.NotifyAll();
+    _cv2.NotifyAll();
+}
+
+template<typename T, class TCompare, size_t D>
+inline void WaitPriorityQueue<T, TCompare, D>::Pop(T& item)
+{
+    item = std::move(_heap.front().item);
+    if (_heap.size() > 1)
+    {
+        _heap.front() = std::move(_heap.back());
+        _heap.pop_back();
+        SiftDown(0);
+    }
+    else
+        _heap.pop_back();
+}
+
+template<typename T, class TCompare, size_t D>
+inline bool WaitPriorityQueue<T, TCompare, D>::Less(const Entry& entry1, const Entry& entry2) const
+{
+    if (_compare(entry1.item, entry2.item))
+        return true;
+    if (_compare(entry2.item, entry1.item))
+        return false;
+
+    // Later enqueued item of the same priority has lower priority
+    return (entry1.order > entry2.order);
+}
+
+template<typename T, class TCompare, size_t D>
+inline void WaitPriorityQueue<T, TCompare, D>::SiftUp(size_t index)
+{
+    Entry entry = std::move(_heap[index]);
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / D;
+        if (!Less(_heap[parent], entry))
+            break;
+        _heap[index] = std::move(_heap[parent]);
+        index = parent;
+    }
+    _heap[index] = std::move(entry);
+}
+
+template<typename T, class TCompare, size_t D>
+inline void WaitPriorityQueue<T, TCompare, D>::SiftDown(size_t index)
+{
+    const size_t size = _heap.size();
+    Entry entry = std::move(_heap[index]);
+    for (;;)
+    {
+        size_t first = index * D + 1;
+        if (first >= size)
+            break;
+
+        // Find the child with the highest priority
+        size_t last = std::min(first + D, size);
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child)
+            if (Less(_heap[best], _heap[child]))
+                best = child;
+
+        if (!Less(entry, _heap[best]))
+            break;
+        _heap[index] = std::move(_heap[best]);
+        index = best;
+    }
+    _heap[index] = std::move(entry);
+}
+
+template<typename T>
+inline bool WaitDeadlineQueue<T>::Dequeue(T& item, Timestamp& deadline)
+{
+    Deadline entry{ Timestamp(0), T() };
+    if (!_queue.Dequeue(entry))
+        return false;
+
+    deadline = entry.deadline;
+    item = std::move(entry.item);
+    return true;
+}
+
+template<typename T>
+inline bool WaitDeadlineQueue<T>::TryDequeue(T& item, Timestamp& deadline)
+{
+    Deadline entry{ Timestamp(0), T() };
+    if (!_queue.TryDequeue(entry))
+        return false;
+
+    deadline = entry.deadline;
+    item = std::move(entry.item);
+    return true;
+}
+
+} // namespace CppCommon
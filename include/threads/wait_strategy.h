@@ -0,0 +1,163 @@
+/*!
+    \file wait_strategy.h
+    \brief Wait strategies for lock-free data structures definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WAIT_STRATEGY_H
+#define CPPCOMMON_THREADS_WAIT_STRATEGY_H
+
+#include "threads/futex.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Busy-spin wait strategy
+/*!
+    Busy-spin wait strategy re-checks the wait condition in a tight loop.
+    It provides the lowest latency, but burns the CPU core while waiting.
+    Notification is free.
+
+    Thread-safe.
+*/
+class SpinWaitStrategy
+{
+public:
+    SpinWaitStrategy() noexcept = default;
+    SpinWaitStrategy(const SpinWaitStrategy&) = delete;
+    SpinWaitStrategy(SpinWaitStrategy&&) = delete;
+    ~SpinWaitStrategy() = default;
+
+    SpinWaitStrategy& operator=(const SpinWaitStrategy&) = delete;
+    SpinWaitStrategy& operator=(SpinWaitStrategy&&) = delete;
+
+    //! Wait until the given condition becomes true
+    /*!
+        Will block.
+
+        \param condition - Wait condition functor which returns 'true' to stop waiting
+    */
+    template <class TCondition>
+    void Wait(TCondition&& condition);
+
+    //! Notify waiting threads about the condition change
+    /*!
+        Will not block.
+    */
+    void Notify() noexcept {}
+};
+
+//! Spin-then-yield wait strategy
+/*!
+    Spin-then-yield wait strategy re-checks the wait condition in a tight
+    loop for the given count of iterations and then yields the CPU to other
+    threads between checks. It is a compromise between latency and CPU usage.
+    Notification is free.
+
+    Thread-safe.
+*/
+class YieldWaitStrategy
+{
+public:
+    //! Default class constructor
+    /*!
+        \param spin - Count of spin iterations before yielding (default is 1024)
+    */
+    explicit YieldWaitStrategy(int spin = 1024) noexcept : _spin(spin) {}
+    YieldWaitStrategy(const YieldWaitStrategy&) = delete;
+    YieldWaitStrategy(YieldWaitStrategy&&) = delete;
+    ~YieldWaitStrategy() = default;
+
+    YieldWaitStrategy& operator=(const YieldWaitStrategy&) = delete;
+    YieldWaitStrategy& operator=(YieldWaitStrategy&&) = delete;
+
+    //! Get the count of spin iterations before yielding
+    int spin() const noexcept { return _spin; }
+
+    //! Wait until the given condition becomes true
+    /*!
+        Will block.
+
+        \param condition - Wait condition functor which returns 'true' to stop waiting
+    */
+    template <class TCondition>
+    void Wait(TCondition&& condition);
+
+    //! Notify waiting threads about the condition change
+    /*!
+        Will not block.
+    */
+    void Notify() noexcept {}
+
+private:
+    int _spin;
+};
+
+//! Spin-then-block wait strategy
+/*!
+    Spin-then-block wait strategy re-checks the wait condition in a tight
+    loop for the given count of iterations and then parks the thread in the
+    kernel (futex on Linux, WaitOnAddress on Windows) until notified. So it
+    enters the kernel only when the waiting thread is truly idle.
+
+    Notification costs one full memory fence and one load of the waiters
+    counter while nobody waits. The kernel is called to wake waiting threads
+    only if there are any.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Futex
+*/
+class BlockingWaitStrategy
+{
+public:
+    //! Default class constructor
+    /*!
+        \param spin - Count of spin iterations before blocking (default is 1024)
+    */
+    explicit BlockingWaitStrategy(int spin = 1024) noexcept : _spin(spin), _epoch(0), _waiters(0) {}
+    BlockingWaitStrategy(const BlockingWaitStrategy&) = delete;
+    BlockingWaitStrategy(BlockingWaitStrategy&&) = delete;
+    ~BlockingWaitStrategy() = default;
+
+    BlockingWaitStrategy& operator=(const BlockingWaitStrategy&) = delete;
+    BlockingWaitStrategy& operator=(BlockingWaitStrategy&&) = delete;
+
+    //! Get the count of spin iterations before blocking
+    int spin() const noexcept { return _spin; }
+    //! Get the count of blocked threads
+    uint32_t waiters() const noexcept { return _waiters.load(std::memory_order_relaxed); }
+
+    //! Wait until the given condition becomes true
+    /*!
+        Will block.
+
+        \param condition - Wait condition functor which returns 'true' to stop waiting
+    */
+    template <class TCondition>
+    void Wait(TCondition&& condition);
+
+    //! Notify waiting threads about the condition change
+    /*!
+        Will not block.
+    */
+    void Notify();
+
+private:
+    int _spin;
+    std::atomic<uint32_t> _epoch;
+    std::atomic<uint32_t> _waiters;
+};
+
+/*! \example threads_wait_strategy.cpp Wait strategies for lock-free data structures example */
+
+} // namespace CppCommon
+
+#include "wait_strategy.inl"
+
+#endif // CPPCOMMON_THREADS_WAIT_STRATEGY_H
@@ -0,0 +1,75 @@
+/*!
+    \file wait_strategy.inl
+    \brief Wait strategies for lock-free data structures inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TCondition>
+inline void SpinWaitStrategy::Wait(TCondition&& condition)
+{
+    while (!condition());
+}
+
+template <class TCondition>
+inline void YieldWaitStrategy::Wait(TCondition&& condition)
+{
+    // Spin for a while
+    for (int i = 0; i < _spin; ++i)
+        if (condition())
+            return;
+
+    // Yield the CPU between checks
+    while (!condition())
+        Thread::Yield();
+}
+
+template <class TCondition>
+inline void BlockingWaitStrategy::Wait(TCondition&& condition)
+{
+    // Spin for a while
+    for (int i = 0; i < _spin; ++i)
+        if (condition())
+            return;
+
+    for (;;)
+    {
+        // Remember the notification epoch before publishing the waiter
+        uint32_t epoch = _epoch.load(std::memory_order_acquire);
+
+        // Publish the waiter and check the condition again. Pairs with the fence
+        // in Notify(): either the notifier sees the waiter or we see the change.
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (condition())
+        {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Block until the epoch is changed by the notifier
+        Futex::Wait(_epoch, epoch);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+
+        if (condition())
+            return;
+    }
+}
+
+inline void BlockingWaitStrategy::Notify()
+{
+    // Pairs with the fence in Wait()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Enter the kernel only if there are blocked threads
+    if (_waiters.load(std::memory_order_relaxed) > 0)
+    {
+        _epoch.fetch_add(1, std::memory_order_release);
+        Futex::WakeAll(_epoch);
+    }
+}
+
+} // namespace CppCommon
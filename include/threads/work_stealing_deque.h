@@ -0,0 +1,119 @@
+/*!
+    \file work_stealing_deque.h
+    \brief Single owner / multiple thieves lock-free work-stealing deque definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+#define CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Single owner / multiple thieves lock-free work-stealing deque
+/*!
+    Work-stealing deque allows the owner thread to push and pop items at the
+    bottom end (LIFO order), while other threads steal items from the top end
+    (FIFO order). Deque grows by doubling its capacity when it is full. Old
+    buffers are retained until the deque destruction, because thieves could
+    still read from them.
+
+    Items must be trivially copyable (e.g. pointers to tasks).
+
+    Thread-safe.
+
+    C++ implementation of the Chase-Lev dynamic circular work-stealing deque
+    with memory orders from "Correct and Efficient Work-Stealing for Weak Memory Models"
+    https://www.di.ens.fr/~zappa/readings/ppopp13.pdf
+*/
+template<typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Work-stealing deque items must be trivially copyable!");
+
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Deque initial capacity (must be a power of two, default is 1024)
+    */
+    explicit WorkStealingDeque(size_t capacity = 1024);
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    ~WorkStealingDeque();
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    //! Check if the deque is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is deque empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get deque capacity
+    size_t capacity() const noexcept { return _buffer.load(std::memory_order_relaxed)->capacity; }
+    //! Get deque size
+    size_t size() const noexcept;
+
+    //! Push an item into the bottom of the deque (owner thread method)
+    /*!
+        Will not block. Grows the deque if it is full.
+
+        \param item - Item to push
+    */
+    void Push(const T& item);
+    //! Pop an item from the bottom of the deque (owner thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to pop
+        \return 'true' if the item was successfully popped, 'false' if the deque is empty
+    */
+    bool Pop(T& item);
+    //! Steal an item from the top of the deque (thieves threads method)
+    /*!
+        Will not block. Could fail if another thread steals or pops the same item concurrently.
+
+        \param item - Item to steal
+        \return 'true' if the item was successfully stolen, 'false' if the deque is empty or the race was lost
+    */
+    bool Steal(T& item);
+
+private:
+    struct Buffer
+    {
+        size_t capacity;
+        size_t mask;
+        std::atomic<T>* items;
+        Buffer* prev;
+
+        explicit Buffer(size_t size, Buffer* previous) : capacity(size), mask(size - 1), items(new std::atomic<T>[size]), prev(previous) {}
+        ~Buffer() { delete[] items; }
+    };
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<int64_t> _top;
+    cache_line_pad _pad1;
+    std::atomic<int64_t> _bottom;
+    std::atomic<Buffer*> _buffer;
+    cache_line_pad _pad2;
+
+    //! Grow the deque buffer twice
+    Buffer* Grow(Buffer* buffer, int64_t bottom, int64_t top);
+};
+
+/*! \example threads_work_stealing_deque.cpp Single owner / multiple thieves lock-free work-stealing deque example */
+
+} // namespace CppCommon
+
+#include "work_stealing_deque.inl"
+
+#endif // CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
@@ -0,0 +1,121 @@
+/*!
+    \file work_stealing_deque.inl
+    \brief Single owner / multiple thieves lock-free work-stealing deque inline implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : _top(0), _bottom(0), _buffer(new Buffer(capacity, nullptr))
+{
+    assert((capacity > 1) && "Deque capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Deque capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline WorkStealingDeque<T>::~WorkStealingDeque()
+{
+    // Delete the current and all retained buffers
+    Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+    while (buffer != nullptr)
+    {
+        Buffer* prev = buffer->prev;
+        delete buffer;
+        buffer = prev;
+    }
+}
+
+template<typename T>
+inline size_t WorkStealingDeque<T>::size() const noexcept
+{
+    const int64_t bottom = _bottom.load(std::memory_order_acquire);
+    const int64_t top = _top.load(std::memory_order_acquire);
+
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+template<typename T>
+inline void WorkStealingDeque<T>::Push(const T& item)
+{
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    const int64_t top = _top.load(std::memory_order_acquire);
+    Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+
+    // Grow the full deque
+    if ((bottom - top) > (int64_t)(buffer->capacity - 1))
+        buffer = Grow(buffer, bottom, top);
+
+    buffer->items[bottom & buffer->mask].store(item, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Pop(T& item)
+{
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    // Check if the deque is empty
+    if (top > bottom)
+    {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = buffer->items[bottom & buffer->mask].load(std::memory_order_relaxed);
+
+    // The last item races with thieves
+    if (top == bottom)
+    {
+        bool result = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return result;
+    }
+
+    return true;
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Steal(T& item)
+{
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    // Check if the deque is empty
+    if (top >= bottom)
+        return false;
+
+    Buffer* buffer = _buffer.load(std::memory_order_acquire);
+    T result = buffer->items[top & buffer->mask].load(std::memory_order_relaxed);
+
+    // Race with the owner and other thieves
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    item = result;
+    return true;
+}
+
+template<typename T>
+inline typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::Grow(Buffer* buffer, int64_t bottom, int64_t top)
+{
+    // Copy items into the new buffer. The old buffer is retained for thieves.
+    Buffer* result = new Buffer(2 * buffer->capacity, buffer);
+    for (int64_t i = top; i < bottom; ++i)
+        result->items[i & result->mask].store(buffer->items[i & buffer->mask].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _buffer.store(result, std::memory_order_release);
+    return result;
+}
+
+} // namespace CppCommon
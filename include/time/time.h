@@ -42,6 +42,13 @@ TOutputStream& operator<<(TOutputStream& stream, Weekday weekday);
     32-bit: time is limited in range 1970-01-01T00:00:00Z - 2038-01-18T23:59:59Z
     64-bit: time is limited in range 1970-01-01T00:00:00Z - 3000-12-31T23:59:59Z
 
+    UTC date & time is converted with pure arithmetic without calling
+    gmtime_r(). Local time converts with the local time offset, which is
+    cached per thread for the current local day (or for 15 minutes around
+    time zone transitions), so localtime_r() with its global lock is called
+    rarely. Therefore time zone changes of the running process are applied
+    to the local time not later than on the next day.
+
     Not thread-safe.
 */
 class Time
@@ -254,6 +261,15 @@ public:
     LocalTime(const Time& time) : Time(time) {}
     //! Initialize local time with another UTC time value
     LocalTime(const UtcTime& time);
+
+    //! Reload the local time zone and invalidate cached local time offsets
+    /*!
+        Local time offsets are cached per thread for the current local day or
+        time zone transition slot. Call this method after changing the local
+        time zone in the process (e.g. setenv("TZ") on Unix platforms), so all
+        threads will query new offsets.
+    */
+    static void UpdateTimezone();
 };
 
 /*! \example time_time.cpp Time example */
@@ -0,0 +1,109 @@
+/*!
+    \file time_format.h
+    \brief Time format utilities definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_TIME_TIME_FORMAT_H
+#define CPPCOMMON_TIME_TIME_FORMAT_H
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <string>
+#include <string_view>
+
+namespace CppCommon {
+
+//! Time format utilities
+/*!
+    Time format utilities contains methods to format and parse timestamps
+    in the fixed ISO-8601 / RFC 3339 layout "YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ"
+    or "YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+hh:mm" with up to nanoseconds precision.
+
+    Formatting converts digits with lookup tables and keeps the formatted
+    "YYYY-MM-DDTHH:MM:SS" prefix of the last second per thread, so formatting
+    of sequential timestamps (e.g. log lines) mostly copies the cached prefix.
+    Buffer overloads write into the caller provided memory, so no allocation
+    happens.
+
+    Parsing validates the date & time digits and separators with SSE2 or NEON
+    at once, accepts 'T', 't' or ' ' date & time separator, '.' or ',' before
+    fractional seconds of any length (extra digits after nanoseconds are
+    truncated) and 'Z', 'z' or numeric "+hh:mm" / "+hhmm" offsets.
+
+    Thread-safe.
+*/
+class TimeFormat
+{
+public:
+    //! Maximal size of the formatted ISO-8601 timestamp
+    static constexpr size_t ISO8601_SIZE = 35;
+
+    TimeFormat() = delete;
+    TimeFormat(const TimeFormat&) = delete;
+    TimeFormat(TimeFormat&&) = delete;
+    ~TimeFormat() = delete;
+
+    TimeFormat& operator=(const TimeFormat&) = delete;
+    TimeFormat& operator=(TimeFormat&&) = delete;
+
+    //! Format UTC timestamp as ISO-8601 string ("YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ")
+    /*!
+        \param utc - UTC timestamp
+        \param precision - Count of fractional seconds digits (0-9, default is 9)
+        \return ISO-8601 string
+    */
+    static std::string FormatISO8601(const Timestamp& utc, int precision = 9);
+    //! Format UTC timestamp as ISO-8601 string with the given timezone offset ("YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+hh:mm")
+    /*!
+        \param utc - UTC timestamp
+        \param offset - Timezone offset (truncated to minutes)
+        \param precision - Count of fractional seconds digits (0-9, default is 9)
+        \return ISO-8601 string
+    */
+    static std::string FormatISO8601(const Timestamp& utc, const Timespan& offset, int precision = 9);
+    //! Format UTC timestamp as ISO-8601 string into the given buffer
+    /*!
+        \param utc - UTC timestamp
+        \param buffer - Output buffer
+        \param size - Output buffer size
+        \param precision - Count of fractional seconds digits (0-9, default is 9)
+        \return Count of written characters (zero if the output buffer is too small)
+    */
+    static size_t FormatISO8601(const Timestamp& utc, char* buffer, size_t size, int precision = 9) noexcept;
+    //! Format UTC timestamp as ISO-8601 string with the given timezone offset into the given buffer
+    /*!
+        \param utc - UTC timestamp
+        \param offset - Timezone offset (truncated to minutes)
+        \param buffer - Output buffer
+        \param size - Output buffer size
+        \param precision - Count of fractional seconds digits (0-9, default is 9)
+        \return Count of written characters (zero if the output buffer is too small)
+    */
+    static size_t FormatISO8601(const Timestamp& utc, const Timespan& offset, char* buffer, size_t size, int precision = 9) noexcept;
+
+    //! Parse ISO-8601 string into UTC timestamp
+    /*!
+        \param str - ISO-8601 string to parse
+        \param utc - Parsed UTC timestamp
+        \return 'true' if the string is a valid ISO-8601 timestamp not before the epoch, 'false' otherwise
+    */
+    static bool ParseISO8601(std::string_view str, Timestamp& utc) noexcept;
+    //! Parse ISO-8601 string into UTC timestamp
+    /*!
+        Throws ArgumentException if the string is not a valid ISO-8601 timestamp.
+
+        \param str - ISO-8601 string to parse
+        \return Parsed UTC timestamp
+    */
+    static UtcTimestamp ParseISO8601(std::string_view str);
+};
+
+/*! \example time_time_format.cpp Time format utilities example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_TIME_TIME_FORMAT_H
@@ -209,6 +209,36 @@ public:
     */
     static uint64_t nano();
 
+    //! Get the coarse UTC timestamp
+    /*!
+        Coarse UTC timestamp is much cheaper than Timestamp::utc(), but its
+        resolution is limited by the system timer tick (usually 1-4 ms on
+        Linux with CLOCK_REALTIME_COARSE, 1-16 ms on Windows). On platforms
+        without coarse clocks the UTC timestamp is returned.
+
+        Coarse timestamp could lag behind the UTC timestamp at most by the
+        timer tick, so it is suitable for cache timeouts, rate limits and
+        logging, but not for time intervals measurement.
+
+        Thread-safe.
+
+        \return Coarse UTC timestamp
+    */
+    static uint64_t coarse_utc();
+
+    //! Get the coarse high resolution timestamp
+    /*!
+        Coarse high resolution timestamp has the same origin as Timestamp::nano(),
+        but it is updated only on the system timer tick (CLOCK_MONOTONIC_COARSE
+        on Linux, mach_approximate_time() on Apple). On other platforms the high
+        resolution timestamp is returned.
+
+        Thread-safe.
+
+        \return Coarse high resolution timestamp
+    */
+    static uint64_t coarse_nano();
+
     //! Get the current value of RDTS (Read Time Stamp Counter)
     /*!
         Counts the number of CPU cycles since reset. The Time Stamp Counter (TSC)
@@ -222,6 +252,27 @@ public:
     */
     static uint64_t rdts();
 
+    //! Get the calibrated TSC timestamp
+    /*!
+        Converts the current RDTS value into nanoseconds of the high resolution
+        timer with a fixed-point multiply-shift, so it is much cheaper than
+        Timestamp::nano() which performs a system call on some platforms.
+
+        Ticks to nanoseconds ratio is calibrated against the high resolution
+        timer on the first call (takes about one millisecond) and refined
+        about every second. Refinement steps forward to the high resolution
+        timer or slows down the ratio if it runs ahead, so calibrated TSC
+        timestamp follows the high resolution timer and never goes backwards.
+
+        If the CPU has no invariant TSC (see CPUFeatures::invariant_tsc)
+        the high resolution timestamp is returned.
+
+        Thread-safe.
+
+        \return Calibrated TSC timestamp in nanoseconds of the high resolution timer
+    */
+    static uint64_t tsc();
+
     //! Swap two instances
     void swap(Timestamp& timestamp) noexcept;
     friend void swap(Timestamp& timestamp1, Timestamp& timestamp2) noexcept;
@@ -279,6 +330,30 @@ public:
     NanoTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
 };
 
+//! Coarse UTC timestamp
+class CoarseUtcTimestamp : public Timestamp
+{
+public:
+    using Timestamp::Timestamp;
+
+    //! Initialize coarse UTC timestamp with a current coarse UTC time
+    CoarseUtcTimestamp() : Timestamp(Timestamp::coarse_utc()) {}
+    //! Initialize coarse UTC timestamp with another timestamp value
+    CoarseUtcTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
+};
+
+//! Coarse high resolution timestamp
+class CoarseNanoTimestamp : public Timestamp
+{
+public:
+    using Timestamp::Timestamp;
+
+    //! Initialize coarse high resolution timestamp with a current coarse high resolution time
+    CoarseNanoTimestamp() : Timestamp(Timestamp::coarse_nano()) {}
+    //! Initialize coarse high resolution timestamp with another timestamp value
+    CoarseNanoTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
+};
+
 //! RDTS timestamp
 class RdtsTimestamp : public Timestamp
 {
@@ -291,6 +366,18 @@ public:
     RdtsTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
 };
 
+//! Calibrated TSC timestamp
+class TscTimestamp : public Timestamp
+{
+public:
+    using Timestamp::Timestamp;
+
+    //! Initialize calibrated TSC timestamp with a current calibrated TSC time
+    TscTimestamp() : Timestamp(Timestamp::tsc()) {}
+    //! Initialize calibrated TSC timestamp with another timestamp value
+    TscTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
+};
+
 /*! \example time_timestamp.cpp Timestamp example */
 
 } // namespace CppCommon
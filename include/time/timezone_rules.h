@@ -0,0 +1,196 @@
+/*!
+    \file timezone_rules.h
+    \brief Timezone rules definition
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_TIME_TIMEZONE_RULES_H
+#define CPPCOMMON_TIME_TIMEZONE_RULES_H
+
+#include "filesystem/path.h"
+#include "time/timezone.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Timezone rules
+/*!
+    Timezone rules contain the whole history of the given timezone loaded
+    from the IANA time zone database (TZif files, RFC 8536) and allow to
+    convert any timestamp, not only the current one of the local timezone.
+
+    Transitions are kept in a compact table with a fixed-step bucket index,
+    so the offset lookup is O(1): at most a couple of transitions are checked
+    after the bucket is found. Timestamps after the last transition are
+    converted with the POSIX TZ rule from the TZif footer.
+
+    Timezone rules loaded by name with Find() are cached, so each zone file
+    is parsed only once.
+
+    Thread-safe.
+*/
+class TimezoneRules
+{
+public:
+    //! Initialize UTC timezone rules
+    TimezoneRules();
+    TimezoneRules(const TimezoneRules&) = default;
+    TimezoneRules(TimezoneRules&&) = default;
+    ~TimezoneRules() = default;
+
+    TimezoneRules& operator=(const TimezoneRules&) = default;
+    TimezoneRules& operator=(TimezoneRules&&) = default;
+
+    //! Get timezone name
+    const std::string& name() const noexcept { return _name; }
+    //! Get count of timezone transitions
+    size_t transitions() const noexcept { return _times.size(); }
+    //! Get POSIX TZ rule used after the last transition (empty if not present)
+    const std::string& rule() const noexcept { return _rule_string; }
+
+    //! Get the total timezone offset for the given UTC timestamp
+    /*!
+        \param utc - UTC timestamp
+        \return Total timezone offset (including daylight saving time)
+    */
+    Timespan Offset(const Timestamp& utc) const noexcept;
+    //! Get the timezone for the given UTC timestamp
+    /*!
+        \param utc - UTC timestamp
+        \return Timezone with the abbreviation, standard and daylight saving time offsets
+    */
+    Timezone At(const Timestamp& utc) const;
+
+    //! Convert UTC timestamp to local timestamp
+    /*!
+        \param utc - UTC timestamp
+        \return Local timestamp
+    */
+    LocalTimestamp Convert(const UtcTimestamp& utc) const noexcept
+    { return LocalTimestamp(utc + Offset(utc)); }
+    //! Convert local timestamp to UTC timestamp
+    /*!
+        Local time in the gap of the forward transition is shifted forward,
+        ambiguous local time of the backward transition is converted with
+        the offset before the transition.
+
+        \param local - Local timestamp
+        \return UTC timestamp
+    */
+    UtcTimestamp Convert(const LocalTimestamp& local) const noexcept;
+    //! Convert UTC time to local time
+    /*!
+        \param utctime - UTC time
+        \return Local time
+    */
+    LocalTime Convert(const UtcTime& utctime) const
+    { return LocalTime(utctime + Offset(utctime.utcstamp())); }
+    //! Convert local time to UTC time
+    /*!
+        \param localtime - Local time
+        \return UTC time
+    */
+    UtcTime Convert(const LocalTime& localtime) const
+    { return UtcTime(Convert(LocalTimestamp(localtime.utcstamp()))); }
+
+    //! Parse timezone rules from the TZif data
+    /*!
+        \param name - Timezone name
+        \param data - TZif data buffer
+        \param size - TZif data size
+        \return Timezone rules
+    */
+    static TimezoneRules Parse(std::string_view name, const void* data, size_t size);
+    //! Load timezone rules from the TZif file
+    /*!
+        \param name - Timezone name
+        \param path - TZif file path
+        \return Timezone rules
+    */
+    static TimezoneRules Load(std::string_view name, const Path& path);
+
+    //! Find timezone rules by the IANA timezone name (e.g. "Europe/London")
+    /*!
+        Zone files are loaded from the time zone database directory once
+        and cached.
+
+        \param name - IANA timezone name
+        \return Cached timezone rules or nullptr if the timezone is not found
+    */
+    static std::shared_ptr<const TimezoneRules> Find(std::string_view name);
+
+    //! Get the time zone database directory
+    /*!
+        Default directory is taken from TZDIR environment variable or
+        "/usr/share/zoneinfo" is used.
+
+        \return Time zone database directory
+    */
+    static Path database();
+    //! Set the time zone database directory and clear the cache of found timezone rules
+    /*!
+        \param path - Time zone database directory
+    */
+    static void SetDatabase(const Path& path);
+
+    //! Swap two instances
+    void swap(TimezoneRules& rules) noexcept;
+    friend void swap(TimezoneRules& rules1, TimezoneRules& rules2) noexcept
+    { rules1.swap(rules2); }
+
+private:
+    // Local time type
+    struct Type
+    {
+        int32_t offset;
+        int32_t daylight;
+        uint32_t abbreviation;
+        bool dst;
+    };
+
+    // POSIX TZ rule date
+    struct RuleDate
+    {
+        char kind;      // 'J' - Julian day (1-365), 'D' - zero-based day (0-365), 'M' - month, week and weekday
+        int day;
+        int week;
+        int month;
+        int32_t time;
+    };
+
+    std::string _name;
+    std::vector<int64_t> _times;
+    std::vector<uint8_t> _indexes;
+    std::vector<Type> _types;
+    std::string _abbreviations;
+    std::vector<uint32_t> _buckets;
+    int64_t _bucket_base;
+
+    std::string _rule_string;
+    bool _rule;
+    bool _rule_dst;
+    Type _rule_std_type;
+    Type _rule_dst_type;
+    RuleDate _rule_start;
+    RuleDate _rule_end;
+
+    // Bucket index step is 2^22 seconds (about 48.5 days)
+    static const int BUCKET_SHIFT = 22;
+
+    const Type& Lookup(int64_t seconds) const noexcept;
+    const Type& LookupRule(int64_t seconds) const noexcept;
+    void ParseRule(std::string_view rule);
+    void BuildIndex();
+};
+
+/*! \example time_timezone_rules.cpp Timezone rules example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_TIME_TIMEZONE_RULES_H
@@ -9,15 +9,38 @@
 #ifndef CPPCOMMON_UTILITY_ENDIAN_H
 #define CPPCOMMON_UTILITY_ENDIAN_H
 
+#include <bit>
 #include <cstdint>
 #include <cstring>
+#include <span>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Byte swap the array of elements with the given size (2, 4 or 8 bytes) from the source to the destination
+void ByteSwapCopy(const void* source, void* destination, size_t count, size_t size) noexcept;
+
+} // namespace Internals
+//! @endcond
+
 //! Big/Little-endian utilities
 /*!
     Big/Little-endian utilities contains methods for big<->little endian conversions.
 
+    Typed load & store methods read and write unaligned values with memcpy()
+    and a byte swap, which compilers turn into a single load or store (movbe
+    when it is enabled for the target, e.g. -mmovbe or -march=haswell). Batch
+    methods convert spans of values with SSSE3/AVX2 pshufb or NEON vrev
+    kernels selected at runtime. All conversions to the native byte order
+    are compile-time no-op paths which just copy memory.
+
     Thread-safe.
 */
 class Endian
@@ -32,9 +55,52 @@ public:
     Endian& operator=(Endian&&) = delete;
 
     //! Is big-endian system?
-    static bool IsBigEndian();
+    static constexpr bool IsBigEndian() noexcept { return (std::endian::native == std::endian::big); }
     //! Is little-endian system?
-    static bool IsLittleEndian();
+    static constexpr bool IsLittleEndian() noexcept { return (std::endian::native == std::endian::little); }
+
+    //! Reverse bytes of the given integer value
+    /*!
+        \param value - Integer value
+        \return Integer value with reversed bytes
+    */
+    template <typename T>
+    static constexpr T ByteSwap(T value) noexcept;
+    //! Reverse bytes of each integer value in the given span
+    /*!
+        \param values - Span of integer values to convert in place
+    */
+    template <typename T>
+    static void ByteSwap(std::span<T> values) noexcept;
+
+    //! Load big-endian integer value from the given unaligned buffer
+    /*!
+        \param buffer - Buffer to load
+        \return Integer value
+    */
+    template <typename T>
+    static T LoadBigEndian(const void* buffer) noexcept;
+    //! Load little-endian integer value from the given unaligned buffer
+    /*!
+        \param buffer - Buffer to load
+        \return Integer value
+    */
+    template <typename T>
+    static T LoadLittleEndian(const void* buffer) noexcept;
+    //! Store integer value into the given unaligned buffer in big-endian byte order
+    /*!
+        \param buffer - Buffer to store
+        \param value - Integer value
+    */
+    template <typename T>
+    static void StoreBigEndian(void* buffer, T value) noexcept;
+    //! Store integer value into the given unaligned buffer in little-endian byte order
+    /*!
+        \param buffer - Buffer to store
+        \param value - Integer value
+    */
+    template <typename T>
+    static void StoreLittleEndian(void* buffer, T value) noexcept;
 
     //! Read big-endian signed 16-bit integer value from the given buffer
     /*!
@@ -207,8 +273,43 @@ public:
         \return Count of written bytes
     */
     static size_t WriteLittleEndian(void* buffer, uint64_t value);
+
+    //! Read the array of big-endian integer values from the given buffer
+    /*!
+        \param buffer - Buffer to read
+        \param values - Span of integer values to fill
+        \return Count of read bytes
+    */
+    template <typename T>
+    static size_t ReadBigEndian(const void* buffer, std::span<T> values) noexcept;
+    //! Read the array of little-endian integer values from the given buffer
+    /*!
+        \param buffer - Buffer to read
+        \param values - Span of integer values to fill
+        \return Count of read bytes
+    */
+    template <typename T>
+    static size_t ReadLittleEndian(const void* buffer, std::span<T> values) noexcept;
+    //! Write the array of integer values into the given buffer in big-endian byte order
+    /*!
+        \param buffer - Buffer to write
+        \param values - Span of integer values
+        \return Count of written bytes
+    */
+    template <typename T>
+    static size_t WriteBigEndian(void* buffer, std::span<const T> values) noexcept;
+    //! Write the array of integer values into the given buffer in little-endian byte order
+    /*!
+        \param buffer - Buffer to write
+        \param values - Span of integer values
+        \return Count of written bytes
+    */
+    template <typename T>
+    static size_t WriteLittleEndian(void* buffer, std::span<const T> values) noexcept;
 };
 
+/*! \example utility_endian.cpp Big/Little-endian utilities example */
+
 } // namespace CppCommon
 
 #include "endian.inl"
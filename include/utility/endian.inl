@@ -8,526 +8,308 @@
 
 namespace CppCommon {
 
-inline bool Endian::IsBigEndian()
+//! @cond INTERNALS
+namespace Internals {
+
+constexpr uint16_t ByteSwap16(uint16_t value) noexcept
 {
-    return false;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(value);
+#else
+#if defined(_MSC_VER)
+    if (!std::is_constant_evaluated())
+        return _byteswap_ushort(value);
+#endif
+    return (uint16_t)((value << 8) | (value >> 8));
+#endif
 }
 
-inline bool Endian::IsLittleEndian()
+constexpr uint32_t ByteSwap32(uint32_t value) noexcept
 {
-    return true;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#else
+#if defined(_MSC_VER)
+    if (!std::is_constant_evaluated())
+        return _byteswap_ulong(value);
+#endif
+    return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) | ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
+#endif
 }
 
-inline size_t Endian::ReadBigEndian(const void* buffer, int16_t& value)
+constexpr uint64_t ByteSwap64(uint64_t value) noexcept
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+#if defined(_MSC_VER)
+    if (!std::is_constant_evaluated())
+        return _byteswap_uint64(value);
+#endif
+    return ((uint64_t)ByteSwap32((uint32_t)value) << 32) | ByteSwap32((uint32_t)(value >> 32));
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+constexpr T Endian::ByteSwap(T value) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Byte swap argument type must be an integer!");
+
+    if constexpr (sizeof(T) == 1)
+        return value;
+    else if constexpr (sizeof(T) == 2)
+        return (T)Internals::ByteSwap16((uint16_t)value);
+    else if constexpr (sizeof(T) == 4)
+        return (T)Internals::ByteSwap32((uint32_t)value);
     else
     {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
+        static_assert((sizeof(T) == 8), "Byte swap argument type size must be 1, 2, 4 or 8 bytes!");
+        return (T)Internals::ByteSwap64((uint64_t)value);
     }
+}
+
+template <typename T>
+inline void Endian::ByteSwap(std::span<T> values) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Byte swap argument type must be an integer!");
+
+    if constexpr (sizeof(T) > 1)
+        Internals::ByteSwapCopy(values.data(), values.data(), values.size(), sizeof(T));
+}
+
+template <typename T>
+inline T Endian::LoadBigEndian(const void* buffer) noexcept
+{
+    T value;
+    std::memcpy(&value, buffer, sizeof(T));
+    if constexpr (IsLittleEndian())
+        value = ByteSwap(value);
+    return value;
+}
+
+template <typename T>
+inline T Endian::LoadLittleEndian(const void* buffer) noexcept
+{
+    T value;
+    std::memcpy(&value, buffer, sizeof(T));
+    if constexpr (IsBigEndian())
+        value = ByteSwap(value);
+    return value;
+}
+
+template <typename T>
+inline void Endian::StoreBigEndian(void* buffer, T value) noexcept
+{
+    if constexpr (IsLittleEndian())
+        value = ByteSwap(value);
+    std::memcpy(buffer, &value, sizeof(T));
+}
 
+template <typename T>
+inline void Endian::StoreLittleEndian(void* buffer, T value) noexcept
+{
+    if constexpr (IsBigEndian())
+        value = ByteSwap(value);
+    std::memcpy(buffer, &value, sizeof(T));
+}
+
+inline size_t Endian::ReadBigEndian(const void* buffer, int16_t& value)
+{
+    value = LoadBigEndian<int16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, uint16_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<uint16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, int32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<int32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, uint32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<uint32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, int64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<int64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::ReadBigEndian(const void* buffer, uint64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-
+    value = LoadBigEndian<uint64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, int16_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-
+    value = LoadLittleEndian<int16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, uint16_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-    }
-
+    value = LoadLittleEndian<uint16_t>(buffer);
     return 2;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, int32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-
+    value = LoadLittleEndian<int32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, uint32_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-    }
-
+    value = LoadLittleEndian<uint32_t>(buffer);
     return 4;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, int64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-
+    value = LoadLittleEndian<int64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::ReadLittleEndian(const void* buffer, uint64_t& value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[7];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[0];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[3] = ((const uint8_t*)buffer)[3];
-        ((uint8_t*)&value)[4] = ((const uint8_t*)buffer)[4];
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[5];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[6];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[7];
-    }
-
+    value = LoadLittleEndian<uint64_t>(buffer);
     return 8;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, int16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, uint16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, int32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, uint32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, int64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 8;
 }
 
 inline size_t Endian::WriteBigEndian(void* buffer, uint64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-
+    StoreBigEndian(buffer, value);
     return 8;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, int16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, uint16_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 2;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, int32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, uint32_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 4;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, int64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
-    else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
-
+    StoreLittleEndian(buffer, value);
     return 8;
 }
 
 inline size_t Endian::WriteLittleEndian(void* buffer, uint64_t value)
 {
-    if (IsBigEndian())
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[7];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[0];
-    }
+    StoreLittleEndian(buffer, value);
+    return 8;
+}
+
+template <typename T>
+inline size_t Endian::ReadBigEndian(const void* buffer, std::span<T> values) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Read argument type must be an integer!");
+
+    if constexpr (IsBigEndian() || (sizeof(T) == 1))
+        std::memcpy(values.data(), buffer, values.size_bytes());
     else
-    {
-        ((uint8_t*)buffer)[0] = ((const uint8_t*)&value)[0];
-        ((uint8_t*)buffer)[1] = ((const uint8_t*)&value)[1];
-        ((uint8_t*)buffer)[2] = ((const uint8_t*)&value)[2];
-        ((uint8_t*)buffer)[3] = ((const uint8_t*)&value)[3];
-        ((uint8_t*)buffer)[4] = ((const uint8_t*)&value)[4];
-        ((uint8_t*)buffer)[5] = ((const uint8_t*)&value)[5];
-        ((uint8_t*)buffer)[6] = ((const uint8_t*)&value)[6];
-        ((uint8_t*)buffer)[7] = ((const uint8_t*)&value)[7];
-    }
+        Internals::ByteSwapCopy(buffer, values.data(), values.size(), sizeof(T));
 
-    return 8;
+    return values.size_bytes();
+}
+
+template <typename T>
+inline size_t Endian::ReadLittleEndian(const void* buffer, std::span<T> values) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Read argument type must be an integer!");
+
+    if constexpr (IsLittleEndian() || (sizeof(T) == 1))
+        std::memcpy(values.data(), buffer, values.size_bytes());
+    else
+        Internals::ByteSwapCopy(buffer, values.data(), values.size(), sizeof(T));
+
+    return values.size_bytes();
+}
+
+template <typename T>
+inline size_t Endian::WriteBigEndian(void* buffer, std::span<const T> values) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Write argument type must be an integer!");
+
+    if constexpr (IsBigEndian() || (sizeof(T) == 1))
+        std::memcpy(buffer, values.data(), values.size_bytes());
+    else
+        Internals::ByteSwapCopy(values.data(), buffer, values.size(), sizeof(T));
+
+    return values.size_bytes();
+}
+
+template <typename T>
+inline size_t Endian::WriteLittleEndian(void* buffer, std::span<const T> values) noexcept
+{
+    static_assert(std::is_integral<T>::value, "Write argument type must be an integer!");
+
+    if constexpr (IsLittleEndian() || (sizeof(T) == 1))
+        std::memcpy(buffer, values.data(), values.size_bytes());
+    else
+        Internals::ByteSwapCopy(values.data(), buffer, values.size(), sizeof(T));
+
+    return values.size_bytes();
 }
 
 } // namespace CppCommon
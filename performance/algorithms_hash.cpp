@@ -0,0 +1,89 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/crc32c.h"
+#include "algorithms/hash.h"
+#include "containers/hashmap.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+
+class HashFixture
+{
+protected:
+    std::vector<std::string> keys;
+    std::string buffer;
+    size_t index;
+
+    HashFixture() : buffer(65536, 'x'), index(0)
+    {
+        for (int i = 0; i < 10000; ++i)
+            keys.push_back("instrument-" + std::to_string(i));
+        for (size_t i = 0; i < buffer.size(); ++i)
+            buffer[i] = (char)(i * 7 + 13);
+    }
+};
+
+BENCHMARK_FIXTURE(HashFixture, "std::hash<std::string>()", operations)
+{
+    const std::string& key = keys[index++ % keys.size()];
+    std::hash<std::string>()(key);
+    context.metrics().AddBytes(key.size());
+}
+
+BENCHMARK_FIXTURE(HashFixture, "FastHash::Compute64(key)", operations)
+{
+    const std::string& key = keys[index++ % keys.size()];
+    FastHash::Compute64(key);
+    context.metrics().AddBytes(key.size());
+}
+
+BENCHMARK_FIXTURE(HashFixture, "FastHash::Compute64(buffer)", operations)
+{
+    FastHash::Compute64(buffer);
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(HashFixture, "FastHash::Compute128(buffer)", operations)
+{
+    FastHash::Compute128(buffer);
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(HashFixture, "CRC32C::Compute(buffer)", operations)
+{
+    CRC32C::Compute(buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
+template <class THash>
+class HashMapFixture : public HashFixture
+{
+protected:
+    HashMap<std::string, int, THash> map;
+
+    HashMapFixture()
+    {
+        for (size_t i = 0; i < keys.size(); ++i)
+            map.emplace(keys[i], (int)i);
+    }
+};
+
+BENCHMARK_FIXTURE(HashMapFixture<std::hash<std::string>>, "HashMap<std::string>::find() with std::hash", operations)
+{
+    map.find(keys[index++ % keys.size()]);
+}
+
+BENCHMARK_FIXTURE(HashMapFixture<FastHasher<std::string>>, "HashMap<std::string>::find() with FastHasher", operations)
+{
+    map.find(keys[index++ % keys.size()]);
+}
+
+BENCHMARK_MAIN()
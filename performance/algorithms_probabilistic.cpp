@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/bloom_filter.h"
+#include "algorithms/count_min_sketch.h"
+#include "algorithms/cuckoo_filter.h"
+#include "algorithms/hyperloglog.h"
+#include "containers/hashmap.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+const uint64_t keys = 1000000;
+
+class ProbabilisticFixture
+{
+protected:
+    BloomFilter<uint64_t> bloom;
+    CuckooFilter<uint64_t> cuckoo;
+    HashMap<uint64_t, uint64_t, FastHasher<uint64_t>> map;
+    std::vector<uint64_t> hashes;
+    std::vector<uint8_t> results;
+    uint64_t index;
+
+    ProbabilisticFixture() : bloom(keys), cuckoo(keys), map(keys * 2, (uint64_t)-1), hashes(1024), results(1024), index(0)
+    {
+        for (uint64_t i = 0; i < keys; ++i)
+        {
+            bloom.Insert(i);
+            cuckoo.Insert(i);
+            map.emplace(i, i);
+        }
+        for (uint64_t i = 0; i < hashes.size(); ++i)
+            hashes[i] = (uint64_t)FastHasher<uint64_t>()(i * 2);
+    }
+};
+
+BENCHMARK_FIXTURE(ProbabilisticFixture, "HashMap::find()", operations)
+{
+    map.find(index++ % (2 * keys));
+}
+
+BENCHMARK_FIXTURE(ProbabilisticFixture, "BloomFilter::Contains()", operations)
+{
+    bloom.Contains(index++ % (2 * keys));
+}
+
+BENCHMARK_FIXTURE(ProbabilisticFixture, "BloomFilter::ContainsHashes()", operations / 1024)
+{
+    bloom.ContainsHashes(hashes, std::span<bool>((bool*)results.data(), results.size()));
+    context.metrics().AddItems(hashes.size());
+}
+
+BENCHMARK_FIXTURE(ProbabilisticFixture, "CuckooFilter::Contains()", operations)
+{
+    cuckoo.Contains(index++ % (2 * keys));
+}
+
+BENCHMARK("HyperLogLog::Add()", operations)
+{
+    static HyperLogLog<uint64_t> hll;
+    static uint64_t key = 0;
+    hll.Add(key++);
+}
+
+BENCHMARK("CountMinSketch::Add()", operations)
+{
+    static CountMinSketch<uint64_t> sketch(2719, 5);
+    static uint64_t key = 0;
+    sketch.Add(key++ % keys);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,55 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/ddsketch.h"
+#include "algorithms/histogram.h"
+#include "algorithms/top_k.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+BENCHMARK("Histogram::Record()", operations)
+{
+    static Histogram histogram;
+    static uint64_t value = 0;
+    histogram.Record((value++ * 7919) % 1000000);
+}
+
+BENCHMARK("Histogram::Snapshot()", 10000)
+{
+    static Histogram histogram;
+    histogram.Snapshot().Quantile(0.99);
+}
+
+BENCHMARK("DDSketch::Add()", operations)
+{
+    static DDSketch sketch;
+    static uint64_t value = 0;
+    sketch.Add((double)((value++ * 7919) % 1000000 + 1));
+}
+
+BENCHMARK("TopK::Add()", operations)
+{
+    static TopK<uint64_t> topk(100);
+    static uint64_t value = 0;
+    ++value;
+    topk.Add(value % ((value & 1) ? 50 : 100000));
+}
+
+BENCHMARK("std::sort() quantile", 1000)
+{
+    static std::vector<uint64_t> values(10000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = (i * 7919) % 1000000;
+    std::sort(values.begin(), values.end());
+    context.metrics().AddItems(values.size());
+}
+
+BENCHMARK_MAIN()
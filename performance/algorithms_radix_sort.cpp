@@ -0,0 +1,102 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/radix_sort.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t items = 10000000;
+
+class RadixSortFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    ThreadPool pool;
+    std::vector<uint64_t> values;
+    std::vector<uint128_t> wide;
+    std::vector<std::string> strings;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::mt19937_64 random(0);
+        values.resize(items);
+        for (auto& value : values)
+            value = random();
+        wide.resize(items / 10);
+        for (auto& value : wide)
+            value = uint128_t(random(), random());
+        strings.resize(items / 10);
+        for (auto& string : strings)
+            string = "instrument-" + std::to_string(random() % 1000000);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        context.metrics().SetCustom("Threads", (uint32_t)pool.threads());
+    }
+};
+
+BENCHMARK_FIXTURE(RadixSortFixture, "std::sort(uint64_t)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint64_t> copy = values;
+    std::sort(copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "RadixSort(uint64_t)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint64_t> copy = values;
+    RadixSort(copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "ParallelSort(uint64_t)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint64_t> copy = values;
+    ParallelSort(pool, copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "ParallelRadixSort(uint64_t)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint64_t> copy = values;
+    ParallelRadixSort(pool, copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "std::sort(uint128_t)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint128_t> copy = wide;
+    std::sort(copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "ParallelRadixSort(uint128_t)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint128_t> copy = wide;
+    ParallelRadixSort(pool, copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "std::sort(std::string)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<std::string> copy = strings;
+    std::sort(copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_FIXTURE(RadixSortFixture, "ParallelRadixSort(std::string)", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<std::string> copy = strings;
+    ParallelRadixSort(pool, copy.begin(), copy.end());
+    context.metrics().AddItems(copy.size());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,48 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/concurrency_limiter.h"
+#include "algorithms/gcra.h"
+#include "algorithms/sliding_window.h"
+#include "algorithms/token_bucket.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+BENCHMARK("TokenBucket::Consume()", operations)
+{
+    static TokenBucket tb(1000000000, 1000000);
+    tb.Consume();
+}
+
+BENCHMARK("GCRA::Consume()", operations)
+{
+    static GCRA gcra(1000000000, 1000000);
+    gcra.Consume();
+}
+
+BENCHMARK("SlidingWindow::Consume()", operations)
+{
+    static SlidingWindow sw(SlidingWindow::MAX_LIMIT, Timespan::milliseconds(1));
+    sw.Consume();
+}
+
+BENCHMARK("ConcurrencyLimiter(AIMD)::TryAcquire()/Release()", operations)
+{
+    static ConcurrencyLimiter limiter(64, 1, 1024);
+    if (limiter.TryAcquire())
+        limiter.Release(Timespan::microseconds(10));
+}
+
+BENCHMARK("ConcurrencyLimiter(Gradient)::TryAcquire()/Release()", operations)
+{
+    static ConcurrencyLimiter limiter(64, 1, 1024, Timespan::milliseconds(1), ConcurrencyLimiterAlgorithm::Gradient);
+    if (limiter.TryAcquire())
+        limiter.Release(Timespan::microseconds(10));
+}
+
+BENCHMARK_MAIN()
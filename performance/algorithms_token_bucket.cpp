@@ -0,0 +1,45 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/token_bucket.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+const uint64_t tenants = 10000;
+
+BENCHMARK("TokenBucket::Consume(Nano)", operations)
+{
+    static TokenBucket tb(1000000000, 1000000, TokenBucketClock::Nano);
+    tb.Consume();
+}
+
+BENCHMARK("TokenBucket::Consume(CoarseNano)", operations)
+{
+    static TokenBucket tb(1000000000, 1000000, TokenBucketClock::CoarseNano);
+    tb.Consume();
+}
+
+BENCHMARK("TokenBucket::Consume(TSC)", operations)
+{
+    static TokenBucket tb(1000000000, 1000000, TokenBucketClock::TSC);
+    tb.Consume();
+}
+
+BENCHMARK("TokenBucket::ConsumeUpTo(16)", operations)
+{
+    static TokenBucket tb(1000000000, 1000000);
+    context.metrics().AddItems(tb.ConsumeUpTo(16));
+}
+
+BENCHMARK("TokenBucketSet::TryConsume()", operations)
+{
+    static TokenBucketSet<uint64_t> tbs(1000, 100, 0, tenants);
+    static uint64_t key = 0;
+    tbs.TryConsume((key++ % tenants) + 1);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,227 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "cache/filecache.h"
+#include "filesystem/directory.h"
+#include "filesystem/file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_process = 10000000;
+const size_t keys = 100000;
+const size_t samples = 1 << 20;
+const double zipf_skew = 0.99;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Directory tree of 10 levels: 16 directories with 64 files each
+const size_t tree_directories = 16;
+const size_t tree_files = 64;
+const size_t tree_depth = 10;
+const std::string tree_content(1024, 'x');
+
+std::string key_of(size_t key) { return "/static/file" + std::to_string(key) + ".html"; }
+
+// Zipfian distributed keys sampled with the inverse cumulative distribution
+const std::vector<std::string>& zipf_keys()
+{
+    static std::vector<std::string> result = []()
+    {
+        std::vector<double> cdf(keys);
+        double sum = 0.0;
+        for (size_t i = 0; i < keys; ++i)
+            cdf[i] = (sum += 1.0 / std::pow((double)(i + 1), zipf_skew));
+
+        std::vector<std::string> sampled(samples);
+        std::mt19937_64 random(0);
+        std::uniform_real_distribution<double> uniform(0.0, sum);
+        for (auto& key : sampled)
+            key = key_of((size_t)(std::lower_bound(cdf.begin(), cdf.end(), uniform(random)) - cdf.begin()));
+        return sampled;
+    }();
+    return result;
+}
+
+// Workload with the given percents of finds and inserts (the rest are removes).
+// The given percent of inserts has a short timeout, so entries keep expiring.
+struct Workload
+{
+    int finds;
+    int inserts;
+    int expiring;
+};
+
+void process(CppBenchmark::Context& context, FileCache& cache, const Workload& workload)
+{
+    const int threads_count = context.x();
+    const auto& sampled = zipf_keys();
+    std::atomic<uint64_t> crc(0);
+
+    // Warmup the cache with all keys
+    for (size_t key = 0; key < keys; ++key)
+        cache.insert(key_of(key), tree_content);
+    cache.reset_statistics();
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&cache, &sampled, &crc, &workload, thread, threads_count]()
+        {
+            uint64_t local = 0;
+            uint64_t items = (items_to_process / threads_count);
+            size_t offset = ((size_t)thread * samples) / threads_count;
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                const std::string& key = sampled[(offset + i) % samples];
+                int operation = (int)(i % 100);
+                if (operation < workload.finds)
+                {
+                    auto result = cache.find(key);
+                    if (result.first)
+                        local += result.second.size();
+                }
+                else if (operation < (workload.finds + workload.inserts))
+                {
+                    bool expiring = ((int)((i / 100) % 100) < workload.expiring);
+                    cache.insert(key, tree_content, expiring ? Timespan::milliseconds(1) : Timespan(0));
+                }
+                else
+                    cache.remove(key);
+            }
+            crc += local;
+        });
+    }
+
+    // Expire cache entries while threads are running
+    cache.start_watchdog(Timespan::milliseconds(10));
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    cache.stop_watchdog();
+
+    // Update benchmark metrics
+    CacheStatistics statistics = cache.statistics();
+    context.metrics().AddOperations(items_to_process - 1);
+    context.metrics().SetCustom("FileCache.hit_ratio", statistics.hit_ratio());
+    context.metrics().SetCustom("FileCache.expirations", statistics.expirations);
+    context.metrics().SetCustom("FileCache.find_p99", statistics.find_latency.percentile(0.99));
+    context.metrics().SetCustom("CRC", (uint64_t)crc);
+}
+
+BENCHMARK("FileCache: read-heavy (95% finds)", settings)
+{
+    FileCache cache;
+    process(context, cache, { 95, 5, 0 });
+}
+
+BENCHMARK("FileCache: mixed (50% finds)", settings)
+{
+    FileCache cache;
+    process(context, cache, { 50, 45, 0 });
+}
+
+BENCHMARK("FileCache: expiring (90% finds, 10% inserts with timeouts)", settings)
+{
+    FileCache cache;
+    process(context, cache, { 90, 10, 100 });
+}
+
+BENCHMARK("FileCache<coarse clock>: expiring (90% finds, 10% inserts with timeouts)", settings)
+{
+    FileCache cache;
+    cache.set_coarse_clock(true);
+    process(context, cache, { 90, 10, 100 });
+}
+
+// All cache entries expire at once and watchdog() removes them in one call
+class TTLStormFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    FileCache cache;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        for (size_t key = 0; key < keys; ++key)
+            cache.insert(key_of(key), tree_content, Timespan::seconds(1) + Timespan::microseconds(key % 1000));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        cache.clear();
+    }
+};
+
+BENCHMARK_FIXTURE(TTLStormFixture, "FileCache::watchdog(): TTL storm", CppBenchmark::Settings().Attempts(5).Operations(1))
+{
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(2));
+
+    // Update benchmark metrics
+    context.metrics().AddItems(keys);
+    context.metrics().SetCustom("FileCache.size", (uint64_t)cache.size());
+}
+
+// Large directory tree to warmup the file cache with insert_path()
+class DirectoryTreeFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    FileCache cache;
+    Path root;
+
+    DirectoryTreeFixture() : root(Path::temp() / Path::unique()) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        Path current = root;
+        for (size_t level = 0; level < tree_depth; ++level)
+        {
+            for (size_t directory = 0; directory < tree_directories; ++directory)
+            {
+                Path path = current / ("directory" + std::to_string(directory));
+                Directory::CreateTree(path);
+                for (size_t file = 0; file < tree_files; ++file)
+                    File::WriteAllText(path / ("file" + std::to_string(file) + ".html"), tree_content);
+            }
+            current /= "directory0";
+        }
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        cache.clear();
+        Path::RemoveAll(root);
+    }
+};
+
+BENCHMARK_FIXTURE(DirectoryTreeFixture, "FileCache::insert_path(): warmup", CppBenchmark::Settings().Attempts(5).Operations(1))
+{
+    cache.insert_path(root);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(cache.size());
+    context.metrics().AddBytes(cache.size() * tree_content.size());
+}
+
+BENCHMARK_FIXTURE(DirectoryTreeFixture, "FileCache::insert_path_mapped(): warmup", CppBenchmark::Settings().Attempts(5).Operations(1))
+{
+    cache.insert_path_mapped(root);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(cache.size());
+    context.metrics().AddBytes(cache.size() * tree_content.size());
+}
+
+BENCHMARK_MAIN()
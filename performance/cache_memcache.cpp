@@ -0,0 +1,182 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "cache/memcache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_process = 10000000;
+const size_t keys = 1000000;
+const size_t samples = 1 << 20;
+const double zipf_skew = 0.99;
+const size_t shards = 64;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Zipfian distributed keys sampled with the inverse cumulative distribution
+const std::vector<uint64_t>& zipf_keys()
+{
+    static std::vector<uint64_t> result = []()
+    {
+        std::vector<double> cdf(keys);
+        double sum = 0.0;
+        for (size_t i = 0; i < keys; ++i)
+            cdf[i] = (sum += 1.0 / std::pow((double)(i + 1), zipf_skew));
+
+        std::vector<uint64_t> sampled(samples);
+        std::mt19937_64 random(0);
+        std::uniform_real_distribution<double> uniform(0.0, sum);
+        for (auto& key : sampled)
+            key = (uint64_t)(std::lower_bound(cdf.begin(), cdf.end(), uniform(random)) - cdf.begin());
+        return sampled;
+    }();
+    return result;
+}
+
+// Workload with the given percents of finds and inserts (the rest are removes).
+// The given percent of inserts has a short timeout, so entries keep expiring.
+struct Workload
+{
+    int finds;
+    int inserts;
+    int expiring;
+};
+
+template <class TCache>
+void process(CppBenchmark::Context& context, TCache& cache, const Workload& workload)
+{
+    const int threads_count = context.x();
+    const auto& sampled = zipf_keys();
+    std::atomic<uint64_t> crc(0);
+
+    // Warmup the cache with all keys
+    for (uint64_t key = 0; key < keys; ++key)
+        cache.insert(key, key);
+    cache.reset_statistics();
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&cache, &sampled, &crc, &workload, thread, threads_count]()
+        {
+            uint64_t local = 0;
+            uint64_t items = (items_to_process / threads_count);
+            size_t offset = ((size_t)thread * samples) / threads_count;
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                uint64_t key = sampled[(offset + i) % samples];
+                int operation = (int)(i % 100);
+                if (operation < workload.finds)
+                {
+                    uint64_t value;
+                    if (cache.find(key, value))
+                        local += value;
+                }
+                else if (operation < (workload.finds + workload.inserts))
+                {
+                    bool expiring = ((int)((i / 100) % 100) < workload.expiring);
+                    cache.insert(key, i, expiring ? Timespan::milliseconds(1) : Timespan(0));
+                }
+                else
+                    cache.remove(key);
+            }
+            crc += local;
+        });
+    }
+
+    // Expire cache entries while threads are running
+    cache.start_watchdog(Timespan::milliseconds(10));
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    cache.stop_watchdog();
+
+    // Update benchmark metrics
+    CacheStatistics statistics = cache.statistics();
+    context.metrics().AddOperations(items_to_process - 1);
+    context.metrics().SetCustom("MemCache.hit_ratio", statistics.hit_ratio());
+    context.metrics().SetCustom("MemCache.evictions", statistics.evictions);
+    context.metrics().SetCustom("MemCache.expirations", statistics.expirations);
+    context.metrics().SetCustom("MemCache.find_p99", statistics.find_latency.percentile(0.99));
+    context.metrics().SetCustom("CRC", (uint64_t)crc);
+}
+
+BENCHMARK("MemCache: read-heavy (95% finds)", settings)
+{
+    MemCache<uint64_t, uint64_t> cache(shards);
+    process(context, cache, { 95, 5, 0 });
+}
+
+BENCHMARK("MemCache: mixed (50% finds)", settings)
+{
+    MemCache<uint64_t, uint64_t> cache(shards);
+    process(context, cache, { 50, 45, 0 });
+}
+
+BENCHMARK("MemCache: expiring (90% finds, 10% inserts with timeouts)", settings)
+{
+    MemCache<uint64_t, uint64_t> cache(shards);
+    process(context, cache, { 90, 10, 100 });
+}
+
+BENCHMARK("MemCache<LRU>: read-heavy (95% finds)", settings)
+{
+    MemCache<uint64_t, uint64_t> cache(shards, keys / 10, MemCacheEviction::LRU);
+    process(context, cache, { 95, 5, 0 });
+}
+
+BENCHMARK("MemCache<CLOCK>: read-heavy (95% finds)", settings)
+{
+    MemCache<uint64_t, uint64_t> cache(shards, keys / 10, MemCacheEviction::CLOCK);
+    process(context, cache, { 95, 5, 0 });
+}
+
+BENCHMARK("MemCache<TINYLFU>: read-heavy (95% finds)", settings)
+{
+    MemCache<uint64_t, uint64_t> cache(shards, keys / 10, MemCacheEviction::TINYLFU);
+    process(context, cache, { 95, 5, 0 });
+}
+
+// All cache entries expire at once and watchdog() removes them in one call
+class TTLStormFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    MemCache<uint64_t, uint64_t> cache;
+
+    TTLStormFixture() : cache(shards) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        for (uint64_t key = 0; key < keys; ++key)
+            cache.insert(key, key, Timespan::seconds(1) + Timespan::microseconds(key % 1000));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        cache.clear();
+    }
+};
+
+BENCHMARK_FIXTURE(TTLStormFixture, "MemCache::watchdog(): TTL storm", CppBenchmark::Settings().Attempts(5).Operations(1))
+{
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(2));
+
+    // Update benchmark metrics
+    context.metrics().AddItems(keys);
+    context.metrics().SetCustom("MemCache.size", (uint64_t)cache.size());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,61 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "common/binary_layout.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+typedef BinaryLayout<uint64_t, double, int32_t, uint8_t, BinaryString> Order;
+
+const std::string symbol = "EURUSD";
+
+volatile uint64_t sink;
+
+BENCHMARK("Endian::WriteLittleEndian() into std::vector")
+{
+    static std::vector<uint8_t> output(1024);
+    std::vector<uint8_t> buffer(Order::Size(symbol.size()));
+    size_t offset = 4;
+    offset += Endian::WriteLittleEndian(buffer.data() + offset, (uint64_t)context.metrics().total_operations());
+    offset += Endian::WriteLittleEndian(buffer.data() + offset, (uint64_t)12345);
+    offset += Endian::WriteLittleEndian(buffer.data() + offset, (int32_t)100);
+    buffer[offset++] = 1;
+    std::memcpy(buffer.data() + offset, symbol.data(), symbol.size());
+    std::memcpy(output.data(), buffer.data(), buffer.size());
+    sink = output[4];
+}
+
+BENCHMARK("BinaryBuilder::Set()")
+{
+    static std::vector<uint8_t> output(1024);
+    BinaryBuilder<Order> builder(output.data(), output.size());
+    builder.Set<0>(context.metrics().total_operations());
+    builder.Set<1>(1.2345);
+    builder.Set<2>(100);
+    builder.Set<3>(1);
+    builder.Set<4>(symbol);
+    sink = builder.size();
+}
+
+BENCHMARK("BinaryView::Get()")
+{
+    static std::vector<uint8_t> input(1024);
+    static bool initialized = false;
+    if (!initialized)
+    {
+        BinaryBuilder<Order> builder(input.data(), input.size());
+        builder.Set<0>(1);
+        builder.Set<4>(symbol);
+        initialized = true;
+    }
+    BinaryView<Order> view(input.data(), input.size());
+    sink = view.Get<0>() + view.Get<2>() + view.Get<4>().size();
+}
+
+BENCHMARK_MAIN()
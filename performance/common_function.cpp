@@ -6,6 +6,8 @@
 
 #include "common/function.h"
 
+#include <memory>
+
 using namespace CppCommon;
 
 class Class
@@ -57,4 +59,76 @@ BENCHMARK("CppCommon::Function: invoke")
     function(context.metrics().total_operations());
 }
 
+BENCHMARK("CppCommon::Function<32>: create & invoke")
+{
+    static Class instance;
+
+    // Create the function
+    CppCommon::Function<void (int64_t), 32> function = [&](int64_t data) { instance.test(data); };
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("CppCommon::Function<64>: create & invoke")
+{
+    static Class instance;
+
+    // Create the function
+    CppCommon::Function<void (int64_t), 64> function = std::bind(&Class::test, &instance, std::placeholders::_1);
+
+    // Call the function
+    function(context.metrics().total_operations());
+}
+
+BENCHMARK("std::function: move-only capture")
+{
+    static Class instance;
+
+    // Create the function (std::function requires copyable closures)
+    auto data = std::make_shared<int64_t>(context.metrics().total_operations());
+    std::function<void ()> function = [&instance, data]() { instance.test(*data); };
+
+    // Move and call the function
+    std::function<void ()> moved = std::move(function);
+    moved();
+}
+
+BENCHMARK("CppCommon::MoveFunction<64>: move-only capture")
+{
+    static Class instance;
+
+    // Create the function
+    auto data = std::make_unique<int64_t>(context.metrics().total_operations());
+    CppCommon::MoveFunction<void ()> function = [&instance, data = std::move(data)]() { instance.test(*data); };
+
+    // Move and call the function
+    CppCommon::MoveFunction<void ()> moved = std::move(function);
+    moved();
+}
+
+BENCHMARK("std::function: move")
+{
+    static Class instance;
+    static std::function<void (int64_t)> function1 = [&](int64_t data) { instance.test(data); };
+    static std::function<void (int64_t)> function2;
+
+    // Move the function back and forth
+    function2 = std::move(function1);
+    function1 = std::move(function2);
+    function1(context.metrics().total_operations());
+}
+
+BENCHMARK("CppCommon::Function<32>: move")
+{
+    static Class instance;
+    static CppCommon::Function<void (int64_t), 32> function1 = [&](int64_t data) { instance.test(data); };
+    static CppCommon::Function<void (int64_t), 32> function2;
+
+    // Move the function back and forth (trivially copyable closure is moved with memcpy())
+    function2 = std::move(function1);
+    function1 = std::move(function2);
+    function1(context.metrics().total_operations());
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,105 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "common/uint256.h"
+
+using namespace CppCommon;
+
+const uint128_t value128(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull);
+const uint256_t value256(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull);
+
+volatile uint64_t sink;
+
+BENCHMARK("uint128_t: multiply")
+{
+    static uint128_t result = value128;
+    result = result * value128 + context.metrics().total_operations();
+    sink = result.lower();
+}
+
+BENCHMARK("uint128_t: divide by 64-bit")
+{
+    uint128_t result = value128 / uint128_t((uint64_t)context.metrics().total_operations() | 1);
+    sink = result.lower();
+}
+
+BENCHMARK("uint128_t: divide by 128-bit")
+{
+    uint128_t result = value128 / uint128_t(1, (uint64_t)context.metrics().total_operations());
+    sink = result.lower();
+}
+
+BENCHMARK("uint128_t: to string")
+{
+    std::string result = uint128_t(value128 + context.metrics().total_operations()).string();
+    context.metrics().AddBytes(result.size());
+}
+
+BENCHMARK("uint128_t: to chars")
+{
+    char buffer[64];
+    std::to_chars_result result = uint128_t(value128 + context.metrics().total_operations()).to_chars(buffer, buffer + sizeof(buffer));
+    context.metrics().AddBytes(result.ptr - buffer);
+}
+
+BENCHMARK("uint128_t: to hex chars")
+{
+    char buffer[64];
+    std::to_chars_result result = uint128_t(value128 + context.metrics().total_operations()).to_chars(buffer, buffer + sizeof(buffer), 16);
+    context.metrics().AddBytes(result.ptr - buffer);
+}
+
+BENCHMARK("uint128_t: from chars")
+{
+    static const std::string text = value128.string();
+    uint128_t result;
+    uint128_t::from_chars(text.data(), text.data() + text.size(), result);
+    sink = result.lower();
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK("uint256_t: multiply")
+{
+    static uint256_t result = value256;
+    result = result * value256 + context.metrics().total_operations();
+    sink = result.lower().lower();
+}
+
+BENCHMARK("uint256_t: divide by 64-bit")
+{
+    uint256_t result = value256 / uint256_t((uint64_t)context.metrics().total_operations() | 1);
+    sink = result.lower().lower();
+}
+
+BENCHMARK("uint256_t: divide by 192-bit")
+{
+    uint256_t result = value256 / uint256_t(0, 1, 0, (uint64_t)context.metrics().total_operations());
+    sink = result.lower().lower();
+}
+
+BENCHMARK("uint256_t: to string")
+{
+    std::string result = uint256_t(value256 + context.metrics().total_operations()).string();
+    context.metrics().AddBytes(result.size());
+}
+
+BENCHMARK("uint256_t: to chars")
+{
+    char buffer[128];
+    std::to_chars_result result = uint256_t(value256 + context.metrics().total_operations()).to_chars(buffer, buffer + sizeof(buffer));
+    context.metrics().AddBytes(result.ptr - buffer);
+}
+
+BENCHMARK("uint256_t: from chars")
+{
+    static const std::string text = value256.string();
+    uint256_t result;
+    uint256_t::from_chars(text.data(), text.data() + text.size(), result);
+    sink = result.lower().lower();
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK_MAIN()
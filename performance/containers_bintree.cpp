@@ -9,6 +9,7 @@
 #include "containers/bintree_avl.h"
 #include "containers/bintree_rb.h"
 #include "containers/bintree_splay.h"
+#include "containers/bplustree.h"
 #include "memory/allocator.h"
 #include "memory/allocator_pool.h"
 
@@ -321,4 +322,110 @@ BENCHMARK_FIXTURE(FindFixture<BinTreeRB<MyBinTreeNode>>, "Remove: BinTreeRB")
     context.metrics().SetCustom("CRC", crc);
 }
 
+class BPlusTreeFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    BPlusTree<int> tree;
+    std::set<int> set;
+    std::vector<int> values;
+
+    BPlusTreeFixture()
+    {
+        for (int i = 0; i < items; ++i)
+            values.push_back(i);
+    }
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::default_random_engine random;
+        std::shuffle(values.begin(), values.end(), random);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        set.clear();
+        tree.clear();
+    }
+};
+
+class BPlusTreeFindFixture : public BPlusTreeFixture
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::default_random_engine random;
+        std::sort(this->values.begin(), this->values.end());
+        this->set.insert(this->values.begin(), this->values.end());
+        this->tree.load(this->values.begin(), this->values.end());
+        std::shuffle(this->values.begin(), this->values.end(), random);
+    }
+};
+
+BENCHMARK_FIXTURE(BPlusTreeFixture, "Insert: BPlusTree")
+{
+    for (const auto& value : this->values)
+        this->tree.insert(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(BPlusTreeFindFixture, "Find: BPlusTree")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += *this->tree.find(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(BPlusTreeFindFixture, "Remove: BPlusTree")
+{
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->tree.erase(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(BPlusTreeFindFixture, "Range scan: std::set")
+{
+    uint64_t crc = 0;
+
+    // Scan 100 items from each of 10000 random positions
+    for (int i = 0; i < 10000; ++i)
+    {
+        auto it = this->set.lower_bound(this->values[i]);
+        for (int j = 0; (j < 100) && (it != this->set.end()); ++j, ++it)
+            crc += *it;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(10000 * 100 - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(BPlusTreeFindFixture, "Range scan: BPlusTree")
+{
+    uint64_t crc = 0;
+
+    // Scan 100 items from each of 10000 random positions
+    for (int i = 0; i < 10000; ++i)
+    {
+        auto it = this->tree.lower_bound(this->values[i]);
+        for (int j = 0; (j < 100) && (it != this->tree.end()); ++j, ++it)
+            crc += *it;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(10000 * 100 - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,92 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/compressed_sequence.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 10000000;
+const int searches = 1000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).Param(items);
+
+class SequenceFixture
+{
+protected:
+    std::vector<uint64_t> values;
+    CompressedSequence sequence;
+
+    SequenceFixture()
+    {
+        // Nanosecond timestamps with microsecond gaps
+        std::mt19937_64 generator(0);
+        values.resize(items);
+        uint64_t timestamp = 1600000000000000000ull;
+        for (auto& value : values)
+            value = (timestamp += generator() % 2000);
+        sequence = CompressedSequence(values);
+    }
+};
+
+BENCHMARK_FIXTURE(SequenceFixture, "Scan: std::vector<uint64_t>", settings)
+{
+    uint64_t sum = 0;
+    for (uint64_t value : values)
+        sum += value;
+    context.metrics().AddItems(values.size());
+    context.metrics().AddBytes(values.size() * sizeof(uint64_t));
+    context.metrics().SetCustom("Sum", sum);
+}
+
+BENCHMARK_FIXTURE(SequenceFixture, "Scan: CompressedSequence::Decode()", settings)
+{
+    uint64_t sum = 0;
+    uint64_t block[CompressedSequence::BLOCK];
+    for (size_t i = 0; i < sequence.blocks(); ++i)
+    {
+        size_t count = sequence.Decode(i, block);
+        for (size_t j = 0; j < count; ++j)
+            sum += block[j];
+    }
+    context.metrics().AddItems(sequence.size());
+    context.metrics().AddBytes(sequence.data().size());
+    context.metrics().SetCustom("Sum", sum);
+}
+
+BENCHMARK_FIXTURE(SequenceFixture, "Scan: CompressedSequence iterator", settings)
+{
+    uint64_t sum = 0;
+    for (uint64_t value : sequence)
+        sum += value;
+    context.metrics().AddItems(sequence.size());
+    context.metrics().AddBytes(sequence.data().size());
+    context.metrics().SetCustom("Sum", sum);
+}
+
+BENCHMARK_FIXTURE(SequenceFixture, "Search: std::lower_bound()", settings)
+{
+    std::mt19937_64 generator(1);
+    size_t found = 0;
+    for (int i = 0; i < searches; ++i)
+        found += (size_t)(std::lower_bound(values.begin(), values.end(), values[generator() % values.size()]) - values.begin());
+    context.metrics().AddItems(searches);
+    context.metrics().SetCustom("Found", (uint64_t)found);
+}
+
+BENCHMARK_FIXTURE(SequenceFixture, "Search: CompressedSequence::lower_bound()", settings)
+{
+    std::mt19937_64 generator(1);
+    size_t found = 0;
+    for (int i = 0; i < searches; ++i)
+        found += sequence.lower_bound(values[generator() % values.size()]);
+    context.metrics().AddItems(searches);
+    context.metrics().SetCustom("Found", (uint64_t)found);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,113 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/concurrent_hashmap.h"
+#include "threads/rw_lock.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_process = 10000000;
+const int keys = 1000000;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+class LockedHashMap
+{
+public:
+    LockedHashMap() : _map(keys, -1) {}
+
+    bool find(int key, int& value) const
+    {
+        ReadLocker<RWLock> locker(_lock);
+        auto it = _map.find(key);
+        if (it == _map.end())
+            return false;
+        value = it->second;
+        return true;
+    }
+
+    bool insert_or_assign(int key, int value)
+    {
+        WriteLocker<RWLock> locker(_lock);
+        auto result = _map.emplace(key, value);
+        if (!result.second)
+            result.first->second = value;
+        return result.second;
+    }
+
+    bool erase(int key)
+    {
+        WriteLocker<RWLock> locker(_lock);
+        return _map.erase(key) > 0;
+    }
+
+private:
+    mutable RWLock _lock;
+    HashMap<int, int> _map;
+};
+
+// Each thread performs 90% finds, 9% inserts and 1% erases
+template <class T>
+void process(CppBenchmark::Context& context, T& map)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&map, &crc, thread, threads_count]()
+        {
+            uint64_t local = 0;
+            uint64_t items = (items_to_process / threads_count);
+            uint64_t seed = 0x9E3779B97F4A7C15ull * (thread + 1);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                int key = (int)((seed >> 33) % keys);
+                int operation = (int)(i % 100);
+                if (operation < 90)
+                {
+                    int value;
+                    if (map.find(key, value))
+                        local += value;
+                }
+                else if (operation < 99)
+                    map.insert_or_assign(key, (int)i);
+                else
+                    map.erase(key);
+            }
+            crc += local;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_process - 1);
+    context.metrics().SetCustom("CRC", (uint64_t)crc);
+}
+
+BENCHMARK("HashMap+RWLock", settings)
+{
+    LockedHashMap map;
+    process(context, map);
+}
+
+BENCHMARK("ConcurrentHashMap", settings)
+{
+    ConcurrentHashMap<int, int> map(keys, -1);
+    process(context, map);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,145 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/bintree_rb.h"
+#include "containers/concurrent_skiplist.h"
+#include "threads/critical_section.h"
+
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_process = 10000000;
+const int keys = 100000;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+struct MyNode : public ConcurrentSkipList<MyNode>::Node
+{
+    int value;
+    MyNode* parent;
+    MyNode* left;
+    MyNode* right;
+    bool rb;
+
+    MyNode(int v = 0) : value(v) {}
+    friend bool operator<(const MyNode& node1, const MyNode& node2) { return node1.value < node2.value; }
+};
+
+class LockedBinTree
+{
+public:
+    bool insert(MyNode& item)
+    {
+        Locker<CriticalSection> locker(_lock);
+        return _bintree.insert(item).second;
+    }
+
+    MyNode* erase(const MyNode& item)
+    {
+        Locker<CriticalSection> locker(_lock);
+        return _bintree.erase(item);
+    }
+
+    int lower_bound(const MyNode& item)
+    {
+        Locker<CriticalSection> locker(_lock);
+        auto it = _bintree.lower_bound(item);
+        return (it != _bintree.end()) ? it->value : 0;
+    }
+
+private:
+    CriticalSection _lock;
+    BinTreeRB<MyNode> _bintree;
+};
+
+class LockFreeSkipList
+{
+public:
+    bool insert(MyNode& item) { return _skiplist.insert(item).second; }
+    MyNode* erase(const MyNode& item) { return _skiplist.erase(item); }
+
+    int lower_bound(const MyNode& item)
+    {
+        auto it = _skiplist.lower_bound(item);
+        return (it != _skiplist.end()) ? it->value : 0;
+    }
+
+private:
+    ConcurrentSkipList<MyNode> _skiplist;
+};
+
+// Each thread performs 90% lower bound searches, 5% inserts and 5% erases of its own nodes
+template <class T>
+void process(CppBenchmark::Context& context, T& container)
+{
+    const int threads_count = context.x();
+    const uint64_t items = (items_to_process / threads_count);
+    std::atomic<uint64_t> crc(0);
+
+    // Preallocate nodes for each thread (erased nodes are never reused)
+    std::vector<std::vector<MyNode>> nodes(threads_count);
+    for (int thread = 0; thread < threads_count; ++thread)
+        for (uint64_t i = 0; i < (items / 10 + 1); ++i)
+            nodes[thread].emplace_back((int)(i * threads_count + thread) % keys);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&container, &nodes, &crc, thread, items]()
+        {
+            uint64_t local = 0;
+            uint64_t seed = 0x9E3779B97F4A7C15ull * (thread + 1);
+            std::deque<MyNode*> inserted;
+            size_t next = 0;
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                int operation = (int)(i % 100);
+                if (operation < 90)
+                    local += container.lower_bound(MyNode((int)((seed >> 33) % keys)));
+                else if ((operation % 2) == 0)
+                {
+                    MyNode& node = nodes[thread][next++];
+                    if (container.insert(node))
+                        inserted.push_back(&node);
+                }
+                else if (!inserted.empty())
+                {
+                    container.erase(*inserted.front());
+                    inserted.pop_front();
+                }
+            }
+            crc += local;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_process - 1);
+    context.metrics().SetCustom("CRC", (uint64_t)crc);
+}
+
+BENCHMARK("BinTreeRB+CriticalSection", settings)
+{
+    LockedBinTree container;
+    process(context, container);
+}
+
+BENCHMARK("ConcurrentSkipList", settings)
+{
+    LockFreeSkipList container;
+    process(context, container);
+}
+
+BENCHMARK_MAIN()
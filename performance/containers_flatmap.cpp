@@ -98,6 +98,41 @@ BENCHMARK_FIXTURE(FindFixture<Flat>, "Find: FlatMap")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK_FIXTURE(FindFixture<Flat>, "Find: FlatMap (read-optimized)")
+{
+    uint64_t crc = 0;
+
+    this->map.set_read_optimized(true);
+
+    for (const auto& value : this->values)
+        crc += this->map.find(value)->second;
+
+    this->map.set_read_optimized(false);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<Flat>, "Find: FlatMap (batch)")
+{
+    uint64_t crc = 0;
+
+    const size_t batch = 256;
+    std::vector<Flat::iterator> results(batch);
+    for (size_t i = 0; i < this->values.size(); i += batch)
+    {
+        size_t count = std::min(batch, this->values.size() - i);
+        this->map.find_many(std::span<const int>(this->values.data() + i, count), results);
+        for (size_t j = 0; j < count; ++j)
+            crc += results[j]->second;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_FIXTURE(FindFixture<Map>, "Remove: std::map")
 {
     uint64_t crc = 0;
@@ -4,7 +4,11 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "containers/dense_hashmap.h"
 #include "containers/hashmap.h"
+#include "containers/integer_hashmap.h"
+
+#include "perf_metrics.h"
 
 #include <algorithm>
 #include <map>
@@ -39,6 +43,8 @@ const int items = 1000000;
 typedef std::map<int, int> Map;
 typedef std::unordered_map<int, int> UnorderedMap;
 typedef CppCommon::HashMap<int, int> HashMap;
+typedef CppCommon::DenseHashMap<int, int> DenseHashMap;
+typedef CppCommon::IntegerHashMap<int, int> IntegerHashMap;
 typedef ska::flat_hash_map<int, int> FlatHash;
 typedef ska::bytell_hash_map<int, int> BytellHash;
 typedef tsl::bhopscotch_map<int, int> BHopscotchHash;
@@ -88,6 +94,8 @@ protected:
 
 BENCHMARK_FIXTURE(InsertFixture<Map>, "Insert: std::map")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -97,6 +105,8 @@ BENCHMARK_FIXTURE(InsertFixture<Map>, "Insert: std::map")
 
 BENCHMARK_FIXTURE(InsertFixture<UnorderedMap>, "Insert: std::unordered_map")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -106,6 +116,66 @@ BENCHMARK_FIXTURE(InsertFixture<UnorderedMap>, "Insert: std::unordered_map")
 
 BENCHMARK_FIXTURE(InsertFixture<HashMap>, "Insert: HashMap")
 {
+    PerfMetrics perf(context);
+
+    for (const auto& value : this->values)
+        this->map.emplace(value, value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+class BulkInsertFixture : public InsertFixture<HashMap>
+{
+protected:
+    std::vector<std::pair<int, int>> pairs;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        InsertFixture<HashMap>::Initialize(context);
+        pairs.clear();
+        for (const auto& value : this->values)
+            pairs.emplace_back(value, value);
+    }
+};
+
+BENCHMARK_FIXTURE(BulkInsertFixture, "Insert: HashMap (reserve)")
+{
+    PerfMetrics perf(context);
+
+    this->map.reserve(this->pairs.size());
+    for (const auto& pair : this->pairs)
+        this->map.insert(pair);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(BulkInsertFixture, "Insert: HashMap (parallel)")
+{
+    PerfMetrics perf(context);
+
+    this->map.parallel_insert(this->pairs.begin(), this->pairs.end());
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(InsertFixture<DenseHashMap>, "Insert: DenseHashMap")
+{
+    PerfMetrics perf(context);
+
+    for (const auto& value : this->values)
+        this->map.emplace(value, value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+}
+
+BENCHMARK_FIXTURE(InsertFixture<IntegerHashMap>, "Insert: IntegerHashMap")
+{
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -115,6 +185,8 @@ BENCHMARK_FIXTURE(InsertFixture<HashMap>, "Insert: HashMap")
 
 BENCHMARK_FIXTURE(InsertFixture<FlatHash>, "Insert: FlatHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -124,6 +196,8 @@ BENCHMARK_FIXTURE(InsertFixture<FlatHash>, "Insert: FlatHash")
 
 BENCHMARK_FIXTURE(InsertFixture<BytellHash>, "Insert: BytellHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -133,6 +207,8 @@ BENCHMARK_FIXTURE(InsertFixture<BytellHash>, "Insert: BytellHash")
 
 BENCHMARK_FIXTURE(InsertFixture<BHopscotchHash>, "Insert: BHopscotchHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -142,6 +218,8 @@ BENCHMARK_FIXTURE(InsertFixture<BHopscotchHash>, "Insert: BHopscotchHash")
 
 BENCHMARK_FIXTURE(InsertFixture<HopscotchHash>, "Insert: HopscotchHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -151,6 +229,8 @@ BENCHMARK_FIXTURE(InsertFixture<HopscotchHash>, "Insert: HopscotchHash")
 
 BENCHMARK_FIXTURE(InsertFixture<OrderedHash>, "Insert: OrderedHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -160,6 +240,8 @@ BENCHMARK_FIXTURE(InsertFixture<OrderedHash>, "Insert: OrderedHash")
 
 BENCHMARK_FIXTURE(InsertFixture<RobinHash>, "Insert: RobinHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -169,6 +251,8 @@ BENCHMARK_FIXTURE(InsertFixture<RobinHash>, "Insert: RobinHash")
 
 BENCHMARK_FIXTURE(InsertFixture<SparseHash>, "Insert: SparseHash")
 {
+    PerfMetrics perf(context);
+
     for (const auto& value : this->values)
         this->map.emplace(value, value);
 
@@ -178,6 +262,8 @@ BENCHMARK_FIXTURE(InsertFixture<SparseHash>, "Insert: SparseHash")
 
 BENCHMARK_FIXTURE(FindFixture<Map>, "Find: std::map")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -190,6 +276,8 @@ BENCHMARK_FIXTURE(FindFixture<Map>, "Find: std::map")
 
 BENCHMARK_FIXTURE(FindFixture<UnorderedMap>, "Find: std::unordered_map")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -202,6 +290,57 @@ BENCHMARK_FIXTURE(FindFixture<UnorderedMap>, "Find: std::unordered_map")
 
 BENCHMARK_FIXTURE(FindFixture<HashMap>, "Find: HashMap")
 {
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.find(value)->second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<HashMap>, "Find: HashMap (batch)")
+{
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    const size_t batch = 256;
+    std::vector<HashMap::iterator> results(batch);
+    for (size_t i = 0; i < this->values.size(); i += batch)
+    {
+        size_t count = std::min(batch, this->values.size() - i);
+        this->map.find_many(std::span<const int>(this->values.data() + i, count), results);
+        for (size_t j = 0; j < count; ++j)
+            crc += results[j]->second;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<DenseHashMap>, "Find: DenseHashMap")
+{
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.find(value)->second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<IntegerHashMap>, "Find: IntegerHashMap")
+{
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -214,6 +353,8 @@ BENCHMARK_FIXTURE(FindFixture<HashMap>, "Find: HashMap")
 
 BENCHMARK_FIXTURE(FindFixture<FlatHash>, "Find: FlatHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -226,6 +367,8 @@ BENCHMARK_FIXTURE(FindFixture<FlatHash>, "Find: FlatHash")
 
 BENCHMARK_FIXTURE(FindFixture<BytellHash>, "Find: BytellHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -238,6 +381,8 @@ BENCHMARK_FIXTURE(FindFixture<BytellHash>, "Find: BytellHash")
 
 BENCHMARK_FIXTURE(FindFixture<BHopscotchHash>, "Find: BHopscotchHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -250,6 +395,8 @@ BENCHMARK_FIXTURE(FindFixture<BHopscotchHash>, "Find: BHopscotchHash")
 
 BENCHMARK_FIXTURE(FindFixture<HopscotchHash>, "Find: HopscotchHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -262,6 +409,8 @@ BENCHMARK_FIXTURE(FindFixture<HopscotchHash>, "Find: HopscotchHash")
 
 BENCHMARK_FIXTURE(FindFixture<OrderedHash>, "Find: OrderedHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -274,6 +423,8 @@ BENCHMARK_FIXTURE(FindFixture<OrderedHash>, "Find: OrderedHash")
 
 BENCHMARK_FIXTURE(FindFixture<RobinHash>, "Find: RobinHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -286,6 +437,8 @@ BENCHMARK_FIXTURE(FindFixture<RobinHash>, "Find: RobinHash")
 
 BENCHMARK_FIXTURE(FindFixture<SparseHash>, "Find: SparseHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -298,6 +451,8 @@ BENCHMARK_FIXTURE(FindFixture<SparseHash>, "Find: SparseHash")
 
 BENCHMARK_FIXTURE(FindFixture<Map>, "Remove: std::map")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -310,6 +465,8 @@ BENCHMARK_FIXTURE(FindFixture<Map>, "Remove: std::map")
 
 BENCHMARK_FIXTURE(FindFixture<UnorderedMap>, "Remove: std::unordered_map")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -322,6 +479,36 @@ BENCHMARK_FIXTURE(FindFixture<UnorderedMap>, "Remove: std::unordered_map")
 
 BENCHMARK_FIXTURE(FindFixture<HashMap>, "Remove: HashMap")
 {
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.erase(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<DenseHashMap>, "Remove: DenseHashMap")
+{
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& value : this->values)
+        crc += this->map.erase(value);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(FindFixture<IntegerHashMap>, "Remove: IntegerHashMap")
+{
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -334,6 +521,8 @@ BENCHMARK_FIXTURE(FindFixture<HashMap>, "Remove: HashMap")
 
 BENCHMARK_FIXTURE(FindFixture<FlatHash>, "Remove: FlatHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -346,6 +535,8 @@ BENCHMARK_FIXTURE(FindFixture<FlatHash>, "Remove: FlatHash")
 
 BENCHMARK_FIXTURE(FindFixture<BytellHash>, "Remove: BytellHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -358,6 +549,8 @@ BENCHMARK_FIXTURE(FindFixture<BytellHash>, "Remove: BytellHash")
 
 BENCHMARK_FIXTURE(FindFixture<BHopscotchHash>, "Remove: BHopscotchHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -370,6 +563,8 @@ BENCHMARK_FIXTURE(FindFixture<BHopscotchHash>, "Remove: BHopscotchHash")
 
 BENCHMARK_FIXTURE(FindFixture<HopscotchHash>, "Remove: HopscotchHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -382,6 +577,8 @@ BENCHMARK_FIXTURE(FindFixture<HopscotchHash>, "Remove: HopscotchHash")
 
 BENCHMARK_FIXTURE(FindFixture<OrderedHash>, "Remove: OrderedHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -394,6 +591,8 @@ BENCHMARK_FIXTURE(FindFixture<OrderedHash>, "Remove: OrderedHash")
 
 BENCHMARK_FIXTURE(FindFixture<RobinHash>, "Remove: RobinHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -406,6 +605,8 @@ BENCHMARK_FIXTURE(FindFixture<RobinHash>, "Remove: RobinHash")
 
 BENCHMARK_FIXTURE(FindFixture<SparseHash>, "Remove: SparseHash")
 {
+    PerfMetrics perf(context);
+
     uint64_t crc = 0;
 
     for (const auto& value : this->values)
@@ -416,4 +617,60 @@ BENCHMARK_FIXTURE(FindFixture<SparseHash>, "Remove: SparseHash")
     context.metrics().SetCustom("CRC", crc);
 }
 
+template <class T>
+class ScanFixture : public FindFixture<T>
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Erase most of items to leave a low load factor
+        FindFixture<T>::Initialize(context);
+        for (size_t i = 0; i < this->values.size(); ++i)
+            if ((i % 10) != 0)
+                this->map.erase(this->values[i]);
+    }
+};
+
+BENCHMARK_FIXTURE(ScanFixture<HashMap>, "Scan: HashMap")
+{
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& item : this->map)
+        crc += item.second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(this->map.size());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(ScanFixture<DenseHashMap>, "Scan: DenseHashMap")
+{
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& item : this->map)
+        crc += item.second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(this->map.size());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(ScanFixture<OrderedHash>, "Scan: OrderedHash")
+{
+    PerfMetrics perf(context);
+
+    uint64_t crc = 0;
+
+    for (const auto& item : this->map)
+        crc += item.second;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(this->map.size());
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_MAIN()
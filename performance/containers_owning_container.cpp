@@ -0,0 +1,84 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/bintree_rb.h"
+#include "containers/list.h"
+#include "containers/owning_container.h"
+#include "memory/allocator_arena.h"
+#include "memory/allocator_pool.h"
+
+using namespace CppCommon;
+
+const int items = 10000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).Param(items);
+
+struct MyListNode : public List<MyListNode>::Node
+{
+    int value;
+    explicit MyListNode(int v) : value(v) {}
+};
+
+struct MyTreeNode : public BinTreeRB<MyTreeNode>::Node
+{
+    int value;
+    explicit MyTreeNode(int v) : value(v) {}
+    friend bool operator<(const MyTreeNode& node1, const MyTreeNode& node2) { return node1.value < node2.value; }
+};
+
+BENCHMARK("List: new/delete", settings)
+{
+    List<MyListNode> list;
+    for (int i = 0; i < context.x(); ++i)
+        list.push_back(*new MyListNode(i));
+    while (list)
+        delete list.pop_front();
+    context.metrics().AddItems(context.x());
+}
+
+BENCHMARK("List: OwningContainer<ArenaMemoryManager>", settings)
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+    OwningContainer<List<MyListNode>, ArenaMemoryManager<DefaultMemoryManager>> list(arena);
+    for (int i = 0; i < context.x(); ++i)
+        list.push_back(*list.create(i));
+    list.clear();
+    context.metrics().AddItems(context.x());
+}
+
+BENCHMARK("List: OwningContainer<PoolMemoryManager>", settings)
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> pool(auxiliary);
+    OwningContainer<List<MyListNode>, PoolMemoryManager<DefaultMemoryManager>> list(pool);
+    for (int i = 0; i < context.x(); ++i)
+        list.push_back(*list.create(i));
+    list.clear();
+    context.metrics().AddItems(context.x());
+}
+
+BENCHMARK("BinTreeRB: new/delete", settings)
+{
+    BinTreeRB<MyTreeNode> bintree;
+    for (int i = 0; i < context.x(); ++i)
+        bintree.insert(*new MyTreeNode(i));
+    while (bintree)
+        delete bintree.erase(*bintree.root());
+    context.metrics().AddItems(context.x());
+}
+
+BENCHMARK("BinTreeRB: OwningContainer<ArenaMemoryManager>", settings)
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+    OwningContainer<BinTreeRB<MyTreeNode>, ArenaMemoryManager<DefaultMemoryManager>> bintree(arena);
+    for (int i = 0; i < context.x(); ++i)
+        bintree.insert(*bintree.create(i));
+    bintree.clear();
+    context.metrics().AddItems(context.x());
+}
+
+BENCHMARK_MAIN()
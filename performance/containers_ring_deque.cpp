@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/queue.h"
+#include "containers/ring_deque.h"
+
+#include <deque>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 10000000;
+const int batch = 64;
+const auto settings = CppBenchmark::Settings().Attempts(3).Param(items);
+
+struct MyMessage
+{
+    int id;
+    double price;
+};
+
+struct MyQueueNode : public Queue<MyQueueNode>::Node
+{
+    MyMessage message;
+};
+
+BENCHMARK("Queue: push/pop", settings)
+{
+    std::vector<MyQueueNode> nodes(batch);
+    Queue<MyQueueNode> queue;
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); i += batch)
+    {
+        for (int j = 0; j < batch; ++j)
+        {
+            nodes[j].message.id = i + j;
+            queue.push(nodes[j]);
+        }
+        while (queue)
+            crc += queue.pop()->message.id;
+    }
+    context.metrics().AddItems(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("std::deque: push_back/pop_front", settings)
+{
+    std::deque<MyMessage> deque;
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); i += batch)
+    {
+        for (int j = 0; j < batch; ++j)
+            deque.push_back({ i + j, 0.0 });
+        while (!deque.empty())
+        {
+            crc += deque.front().id;
+            deque.pop_front();
+        }
+    }
+    context.metrics().AddItems(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("RingDeque: push_back/pop_front", settings)
+{
+    RingDeque<MyMessage> deque;
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); i += batch)
+    {
+        for (int j = 0; j < batch; ++j)
+            deque.push_back({ i + j, 0.0 });
+        while (deque)
+        {
+            crc += deque.front().id;
+            deque.pop_front();
+        }
+    }
+    context.metrics().AddItems(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("RingDeque: bulk push_back/pop_front", settings)
+{
+    std::vector<MyMessage> messages(batch);
+    RingDeque<MyMessage> deque;
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); i += batch)
+    {
+        for (int j = 0; j < batch; ++j)
+            messages[j].id = i + j;
+        deque.push_back(messages.data(), messages.size());
+        deque.pop_front(messages.data(), messages.size());
+        for (const auto& message : messages)
+            crc += message.id;
+    }
+    context.metrics().AddItems(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
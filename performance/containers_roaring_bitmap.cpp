@@ -0,0 +1,93 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/roaring_bitmap.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 10000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).Param(items);
+
+std::vector<uint32_t> Generate(int count, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<uint32_t> distribution(0, (uint32_t)count * 4);
+    std::vector<uint32_t> result(count);
+    for (auto& value : result)
+        value = distribution(generator);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+class SortedVectorFixture
+{
+protected:
+    std::vector<uint32_t> values1;
+    std::vector<uint32_t> values2;
+
+    SortedVectorFixture() : values1(Generate(items, 1)), values2(Generate(items, 2)) {}
+};
+
+class RoaringBitmapFixture : public SortedVectorFixture
+{
+protected:
+    RoaringBitmap bitmap1;
+    RoaringBitmap bitmap2;
+
+    RoaringBitmapFixture()
+    {
+        for (auto value : values1)
+            bitmap1.add(value);
+        for (auto value : values2)
+            bitmap2.add(value);
+    }
+};
+
+BENCHMARK_FIXTURE(SortedVectorFixture, "Intersection: sorted std::vector", settings)
+{
+    std::vector<uint32_t> result;
+    std::set_intersection(values1.begin(), values1.end(), values2.begin(), values2.end(), std::back_inserter(result));
+    context.metrics().AddItems(values1.size() + values2.size());
+    context.metrics().SetCustom("Cardinality", (unsigned)result.size());
+}
+
+BENCHMARK_FIXTURE(RoaringBitmapFixture, "Intersection: RoaringBitmap", settings)
+{
+    RoaringBitmap result = bitmap1 & bitmap2;
+    context.metrics().AddItems(values1.size() + values2.size());
+    context.metrics().SetCustom("Cardinality", (unsigned)result.cardinality());
+}
+
+BENCHMARK_FIXTURE(RoaringBitmapFixture, "Intersection cardinality: RoaringBitmap", settings)
+{
+    uint64_t cardinality = RoaringBitmap::and_cardinality(bitmap1, bitmap2);
+    context.metrics().AddItems(values1.size() + values2.size());
+    context.metrics().SetCustom("Cardinality", (unsigned)cardinality);
+}
+
+BENCHMARK_FIXTURE(RoaringBitmapFixture, "Union: RoaringBitmap", settings)
+{
+    RoaringBitmap result = bitmap1 | bitmap2;
+    context.metrics().AddItems(values1.size() + values2.size());
+    context.metrics().SetCustom("Cardinality", (unsigned)result.cardinality());
+}
+
+BENCHMARK_FIXTURE(RoaringBitmapFixture, "Iteration: RoaringBitmap", settings)
+{
+    uint64_t crc = 0;
+    for (uint32_t value : bitmap1)
+        crc += value;
+    context.metrics().AddItems(values1.size());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
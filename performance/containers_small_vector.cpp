@@ -0,0 +1,89 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "containers/small_vector.h"
+#include "string/small_string.h"
+#include "string/string_utils.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const int iterations = 1000000;
+const auto settings = CppBenchmark::Settings().Attempts(3).Param(iterations);
+
+const std::string_view line = "EURUSD,1.1050,1.1052,100000,BUY";
+
+BENCHMARK("std::vector<int>: 6 items", settings)
+{
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); ++i)
+    {
+        std::vector<int> vector;
+        for (int j = 0; j < 6; ++j)
+            vector.push_back(i + j);
+        crc += vector.back();
+    }
+    context.metrics().AddOperations(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("SmallVector<int, 8>: 6 items", settings)
+{
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); ++i)
+    {
+        SmallVector<int, 8> vector;
+        for (int j = 0; j < 6; ++j)
+            vector.push_back(i + j);
+        crc += vector.back();
+    }
+    context.metrics().AddOperations(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StringUtils::Split: std::vector<std::string>", settings)
+{
+    uint64_t crc = 0;
+    for (int i = 0; i < context.x(); ++i)
+    {
+        auto tokens = StringUtils::Split(line, ',');
+        crc += tokens.size();
+    }
+    context.metrics().AddOperations(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StringUtils::Split: SmallVector<SmallString<16>, 8>", settings)
+{
+    uint64_t crc = 0;
+    SmallVector<SmallString<16>, 8> tokens;
+    for (int i = 0; i < context.x(); ++i)
+    {
+        StringUtils::Split(line, ',', tokens);
+        crc += tokens.size();
+    }
+    context.metrics().AddOperations(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StringUtils::Join: SmallString<64>", settings)
+{
+    uint64_t crc = 0;
+    SmallVector<std::string_view, 8> tokens;
+    SmallString<64> result;
+    StringUtils::Split(line, ',', tokens);
+    for (int i = 0; i < context.x(); ++i)
+    {
+        StringUtils::Join(tokens, ';', result);
+        crc += result.size();
+    }
+    context.metrics().AddOperations(context.x());
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
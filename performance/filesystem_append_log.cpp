@@ -0,0 +1,79 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/append_log.h"
+#include "filesystem/file.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t records_to_commit = 100000;
+const int producers_from = 1;
+const int producers_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+const uint8_t record[100] = {};
+
+void commit(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    const Path path("test.log");
+
+    AppendLog log;
+    log.Open(path);
+
+    // Start producer threads committing durable records
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&log, producers_count]()
+        {
+            uint64_t records = (records_to_commit / producers_count);
+            for (uint64_t i = 0; i < records; ++i)
+                log.Commit(record, sizeof(record));
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddItems(records_to_commit);
+    context.metrics().AddBytes(records_to_commit * sizeof(record));
+    context.metrics().SetCustom("Groups", log.groups());
+
+    log.Close();
+    File::Remove(path);
+}
+
+BENCHMARK("AppendLog::Commit()", settings)
+{
+    commit(context);
+}
+
+BENCHMARK("File::Write() + File::Flush()")
+{
+    File file("test.log");
+    file.Create(false, true);
+
+    // Flush each record separately
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        file.Write(record, sizeof(record));
+        file.Flush();
+    }
+
+    context.metrics().AddItems(1000);
+    context.metrics().AddBytes(1000 * sizeof(record));
+
+    file.Close();
+    File::Remove(file);
+}
+
+BENCHMARK_MAIN()
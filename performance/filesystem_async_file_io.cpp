@@ -0,0 +1,84 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/async_file_io.h"
+#include "filesystem/file.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 100000;
+const size_t block = 4096;
+const size_t blocks = 16384;
+const auto settings = CppBenchmark::Settings().ParamRange(1, 256, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+class AsyncFileIOFixture
+{
+protected:
+    std::vector<uint8_t> buffer;
+
+    AsyncFileIOFixture() : buffer(block * 256)
+    {
+        // Create the test file
+        File file("test.tmp");
+        file.Create(false, true);
+        for (size_t i = 0; i < blocks; ++i)
+            file.Write(buffer.data(), block);
+        file.Close();
+    }
+
+    ~AsyncFileIOFixture()
+    {
+        File::Remove("test.tmp");
+    }
+};
+
+BENCHMARK_FIXTURE(AsyncFileIOFixture, "File::Read()-random")
+{
+    File file("test.tmp");
+    file.Open(true, false);
+    uint64_t seed = 0;
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        file.Seek((seed >> 33) % blocks * block);
+        file.Read(buffer.data(), block);
+    }
+    file.Close();
+    context.metrics().AddBytes(operations * block);
+}
+
+BENCHMARK_FIXTURE(AsyncFileIOFixture, "AsyncFileIO::Read()-random", settings)
+{
+    const size_t depth = context.x();
+
+    AsyncFileIO engine(depth);
+    AsyncFileIO::FileId file = engine.Open("test.tmp", true, false);
+    engine.RegisterBuffers({ std::span<uint8_t>(buffer) });
+
+    // Keep the queue full of random block reads
+    uint64_t seed = 0;
+    uint64_t queued = 0;
+    uint64_t completed = 0;
+    auto handler = [&completed](size_t, int) { ++completed; };
+    while (completed < operations)
+    {
+        while ((queued < operations) && ((queued - completed) < depth))
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            engine.Read(file, (seed >> 33) % blocks * block, buffer.data() + (queued % depth) * block, block, handler);
+            ++queued;
+        }
+        engine.Wait();
+    }
+
+    engine.UnregisterBuffers();
+    engine.Close(file);
+    context.metrics().AddBytes(operations * block);
+}
+
+BENCHMARK_MAIN()
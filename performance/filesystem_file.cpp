@@ -4,9 +4,12 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "common/line_reader.h"
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 
 #include <array>
+#include <memory>
 
 using namespace CppCommon;
 
@@ -38,6 +41,17 @@ protected:
     }
 };
 
+class DirectFileWriteFixture : public FileWriteFixture
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Open file for writing in direct I/O mode and preallocate the whole file
+        file.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 64 * page, true);
+        file.Preallocate(0, operations * page);
+    }
+};
+
 class FileReadFixture : public FileWriteFixture
 {
 protected:
@@ -59,16 +73,93 @@ private:
     }
 };
 
+class MappedFileReadFixture : public FileReadFixture
+{
+protected:
+    MappedFile mapped;
+    size_t position{0};
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FileReadFixture::Initialize(context);
+        file.Close();
+
+        // Map the whole test file for sequential reading
+        mapped.Map(file);
+        mapped.Advise(MappedFileAdvice::SEQUENTIAL);
+        position = 0;
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        mapped.Unmap();
+        File::Remove(file);
+    }
+};
+
+class LineReaderFixture : public FileReadFixture
+{
+protected:
+    std::unique_ptr<LineReader> reader;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FileReadFixture::Initialize(context);
+
+        // Test file contains a line delimiter every 256 bytes
+        reader = std::make_unique<LineReader>(file);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        reader.reset();
+        FileReadFixture::Cleanup(context);
+    }
+};
+
 BENCHMARK_FIXTURE(FileWriteFixture, "File::Write()", operations)
 {
     file.Write(buffer.data(), buffer.size());
     context.metrics().AddBytes(buffer.size());
 }
 
+BENCHMARK_FIXTURE(DirectFileWriteFixture, "File::Write() direct", operations)
+{
+    file.Write(buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
 BENCHMARK_FIXTURE(FileReadFixture, "File::Read()", operations)
 {
     file.Read(buffer.data(), buffer.size());
     context.metrics().AddBytes(buffer.size());
 }
 
+BENCHMARK_FIXTURE(MappedFileReadFixture, "MappedFile::view()", operations)
+{
+    // Touch the mapped page without copying it
+    const uint8_t* data = mapped.span().data() + (position % mapped.size());
+    uint64_t sum = 0;
+    for (size_t i = 0; i < buffer.size(); i += 64)
+        sum += data[i];
+    position += buffer.size();
+    context.metrics().AddBytes(buffer.size());
+    context.metrics().SetCustom("Checksum", sum);
+}
+
+BENCHMARK_FIXTURE(MappedFileReadFixture, "MappedFile::Read()", operations)
+{
+    mapped.Read(buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(LineReaderFixture, "LineReader::Next()", operations)
+{
+    // Read lines of one page
+    std::string_view line;
+    for (size_t i = 0; i < (page / 256); ++i)
+        if (reader->Next(line))
+            context.metrics().AddBytes(line.size() + 1);
+}
+
 BENCHMARK_MAIN()
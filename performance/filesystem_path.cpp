@@ -0,0 +1,54 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/path.h"
+
+using namespace CppCommon;
+
+const Path path("/home/user/projects/indexer/source/filesystem/path_view.cpp");
+
+BENCHMARK("Path::filename()")
+{
+    auto result = path.filename();
+    context.metrics().AddBytes(result.string().size());
+}
+
+BENCHMARK("PathView::filename()")
+{
+    auto result = PathView(path).filename();
+    context.metrics().AddBytes(result.size());
+}
+
+BENCHMARK("Path::parent()")
+{
+    auto result = path.parent().parent();
+    context.metrics().AddBytes(result.string().size());
+}
+
+BENCHMARK("PathView::parent()")
+{
+    auto result = PathView(path).parent().parent();
+    context.metrics().AddBytes(result.size());
+}
+
+BENCHMARK("Path::HasExtension()")
+{
+    context.metrics().AddItems(path.HasExtension() ? 1 : 0);
+}
+
+BENCHMARK("Path / Path")
+{
+    auto result = path / Path(std::string(PathView(path).filename().string()));
+    context.metrics().AddBytes(result.string().size());
+}
+
+BENCHMARK("Path / PathView")
+{
+    auto result = path / PathView(path).filename();
+    context.metrics().AddBytes(result.string().size());
+}
+
+BENCHMARK_MAIN()
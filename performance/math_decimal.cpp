@@ -0,0 +1,68 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "math/decimal.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+using Price = Decimal<4>;
+
+const Price price = Price::Parse("101.2575");
+const Price quantity = Price::Parse("3.5");
+
+volatile int64_t sink;
+
+BENCHMARK("Decimal: add")
+{
+    sink = (price + Price::FromRaw(context.metrics().total_operations())).raw();
+}
+
+BENCHMARK("Decimal: multiply")
+{
+    sink = (price * Price::FromRaw(context.metrics().total_operations())).raw();
+}
+
+BENCHMARK("Decimal: divide")
+{
+    sink = (price / Price::FromRaw(context.metrics().total_operations() | 1)).raw();
+}
+
+BENCHMARK("Decimal: string")
+{
+    char buffer[Price::STRING_SIZE];
+    context.metrics().AddBytes(Price::FromRaw(context.metrics().total_operations()).string(buffer, sizeof(buffer)));
+}
+
+BENCHMARK("Decimal: parse")
+{
+    Price result;
+    Price::Parse("-123456.7890", result);
+    sink = result.raw();
+}
+
+BENCHMARK("Decimal: batch add")
+{
+    static std::vector<Price> values(1000, price);
+    Price::Add(values, values, values);
+    Price::Subtract(values, values, values);
+    context.metrics().AddItems(values.size());
+}
+
+BENCHMARK("Decimal: batch multiply")
+{
+    static std::vector<Price> values(1000, price);
+    Price::Multiply(values, Price(1), values);
+    context.metrics().AddItems(values.size());
+}
+
+BENCHMARK("double: multiply")
+{
+    sink = (int64_t)(price.ToDouble() * (double)context.metrics().total_operations());
+}
+
+BENCHMARK_MAIN()
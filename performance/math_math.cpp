@@ -0,0 +1,73 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "math/math.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t items = 4096;
+
+volatile uint64_t sink;
+volatile double dsink;
+
+BENCHMARK("Math::MulDiv64()")
+{
+    sink = Math::MulDiv64(context.metrics().total_operations(), 6132198419878046132ull, 9156498145135109843ull);
+}
+
+BENCHMARK("Math::MulDivRound64() loop")
+{
+    static std::vector<uint64_t> values(items, 1012575);
+    static std::vector<uint64_t> result(items);
+    for (size_t i = 0; i < items; ++i)
+        Math::MulDivRound64(values[i], 35000, 10000, result[i]);
+    sink = result[context.metrics().total_operations() % items];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Math::MulDivRound64() span")
+{
+    static std::vector<uint64_t> values(items, 1012575);
+    static std::vector<uint64_t> result(items);
+    Math::MulDivRound64(values, 35000, 10000, result);
+    sink = result[context.metrics().total_operations() % items];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Math::Sum()")
+{
+    static std::vector<double> values(items, 1.5);
+    dsink = Math::Sum(std::span<const double>(values));
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Math::MinMax()")
+{
+    static std::vector<int64_t> values(items, 15);
+    sink = Math::MinMax(std::span<const int64_t>(values)).second;
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Math::Dot()")
+{
+    static std::vector<double> values1(items, 1.5);
+    static std::vector<double> values2(items, 2.5);
+    dsink = Math::Dot(std::span<const double>(values1), std::span<const double>(values2));
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Math::PrefixSum()")
+{
+    static std::vector<int64_t> values(items, 15);
+    static std::vector<int64_t> result(items);
+    Math::PrefixSum(values, result);
+    sink = result[items - 1];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK_MAIN()
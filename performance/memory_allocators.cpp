@@ -0,0 +1,405 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/allocator.h"
+#include "memory/allocator_arena.h"
+#include "memory/allocator_heap.h"
+#include "memory/allocator_pool.h"
+#include "memory/allocator_slab.h"
+#include "memory/allocator_thread_cache.h"
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+#include "threads/spsc_ring_queue.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+const size_t short_lived = 4096;
+const int long_lived_percent = 5;
+const int phases = 8;
+const auto settings = CppBenchmark::Settings().Attempts(3).ParamRange(1, 4, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Allocation sizes histogram of a typical server workload: mostly small
+// strings and nodes, some buffers and rare huge blocks
+const std::array<size_t, 15> sizes = { 8, 16, 24, 32, 48, 64, 96, 128, 256, 512, 1024, 2048, 4096, 16384, 65536 };
+const std::array<double, 15> weights = { 6.0, 18.0, 14.0, 16.0, 12.0, 10.0, 6.0, 5.0, 5.0, 3.0, 2.0, 1.5, 1.0, 0.4, 0.1 };
+
+// Pre-sampled allocation sizes, so the random generator is out of the measured loop
+const std::vector<size_t>& sampled_sizes()
+{
+    static std::vector<size_t> result = []()
+    {
+        std::vector<size_t> sampled(65536);
+        std::mt19937 random(0);
+        std::discrete_distribution<size_t> distribution(weights.begin(), weights.end());
+        for (auto& size : sampled)
+            size = sizes[distribution(random)];
+        return sampled;
+    }();
+    return result;
+}
+
+// Resident set size of the process in bytes
+size_t rss()
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    size_t pages = 0;
+    size_t resident = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> pages >> resident;
+    return resident * (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(_WIN32) || defined(_WIN64)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.WorkingSetSize;
+#else
+    return 0;
+#endif
+}
+
+// Memory manager with its auxiliary memory manager
+template <class TMemoryManager>
+struct MemoryManagerHolder
+{
+    DefaultMemoryManager auxiliary;
+    TMemoryManager manager;
+
+    MemoryManagerHolder() : manager(auxiliary) {}
+
+    // Memory taken from the auxiliary memory manager
+    size_t footprint() const noexcept { return auxiliary.allocated(); }
+};
+
+template <>
+struct MemoryManagerHolder<DefaultMemoryManager>
+{
+    DefaultMemoryManager manager;
+
+    size_t footprint() const noexcept { return manager.allocated(); }
+};
+
+template <>
+struct MemoryManagerHolder<HeapMemoryManager>
+{
+    HeapMemoryManager manager;
+
+    size_t footprint() const noexcept { return manager.allocated(); }
+};
+
+// Memory manager shared between threads. Single-threaded memory managers are protected with the spin-lock.
+template <class TMemoryManager, bool locked = true>
+class SharedMemoryManager
+{
+public:
+    void* malloc(size_t size)
+    {
+        if constexpr (locked)
+        {
+            Locker<SpinLock> locker(_lock);
+            return _holder.manager.malloc(size);
+        }
+        else
+            return _holder.manager.malloc(size);
+    }
+
+    void free(void* ptr, size_t size)
+    {
+        if constexpr (locked)
+        {
+            Locker<SpinLock> locker(_lock);
+            _holder.manager.free(ptr, size);
+        }
+        else
+            _holder.manager.free(ptr, size);
+    }
+
+    size_t footprint() const noexcept { return _holder.footprint(); }
+
+private:
+    SpinLock _lock;
+    MemoryManagerHolder<TMemoryManager> _holder;
+};
+
+// System allocator baseline
+class SystemMemoryManager
+{
+public:
+    void* malloc(size_t size) { return std::malloc(size); }
+    void free(void* ptr, size_t size) { std::free(ptr); }
+
+    // Memory taken from the system is tracked only with the resident set size
+    size_t footprint() const noexcept { return 0; }
+};
+
+typedef SharedMemoryManager<DefaultMemoryManager> DefaultManager;
+typedef SharedMemoryManager<HeapMemoryManager> HeapManager;
+typedef SharedMemoryManager<PoolMemoryManager<DefaultMemoryManager>> PoolManager;
+typedef SharedMemoryManager<ArenaMemoryManager<DefaultMemoryManager>> ArenaManager;
+typedef SharedMemoryManager<SlabMemoryManager<DefaultMemoryManager>> SlabManager;
+typedef SharedMemoryManager<ThreadCacheMemoryManager<DefaultMemoryManager>, false> ThreadCacheManager;
+
+struct Block
+{
+    void* ptr;
+    size_t size;
+};
+
+// Producers allocate blocks and pass them to consumers which free them
+template <class TManager>
+void cross_thread(CppBenchmark::Context& context)
+{
+    const int pairs = context.x();
+    const auto& sampled = sampled_sizes();
+
+    size_t rss_start = rss();
+    std::atomic<size_t> rss_peak(rss_start);
+
+    {
+        TManager manager;
+
+        std::vector<std::unique_ptr<SPSCRingQueue<Block>>> queues;
+        for (int i = 0; i < pairs; ++i)
+            queues.emplace_back(std::make_unique<SPSCRingQueue<Block>>(1024));
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < pairs; ++i)
+        {
+            SPSCRingQueue<Block>& queue = *queues[i];
+
+            // Producer thread
+            threads.emplace_back([&manager, &queue, &sampled, pairs, i]()
+            {
+                uint64_t items = operations / pairs;
+                for (uint64_t j = 0; j < items; ++j)
+                {
+                    size_t size = sampled[(i * 4096 + j) % sampled.size()];
+                    Block block = { manager.malloc(size), size };
+                    *(uint8_t*)block.ptr = (uint8_t)j;
+                    while (!queue.Enqueue(block))
+                        std::this_thread::yield();
+                }
+            });
+
+            // Consumer thread
+            threads.emplace_back([&manager, &queue, &rss_peak, pairs]()
+            {
+                uint64_t crc = 0;
+                uint64_t items = operations / pairs;
+                for (uint64_t j = 0; j < items; ++j)
+                {
+                    Block block;
+                    while (!queue.Dequeue(block))
+                        std::this_thread::yield();
+                    crc += *(uint8_t*)block.ptr;
+                    manager.free(block.ptr, block.size);
+
+                    // Track the peak resident set size
+                    if ((j % 65536) == 0)
+                    {
+                        size_t current = rss();
+                        size_t peak = rss_peak.load();
+                        while ((current > peak) && !rss_peak.compare_exchange_weak(peak, current)) {}
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * (operations / pairs) * pairs - 1);
+    context.metrics().SetCustom("RSS.peak growth (KB)", (uint64_t)((rss_peak - rss_start) / 1024));
+}
+
+// Threads allocate short-lived blocks in a sliding window and keep some long-lived blocks till the end
+template <class TManager>
+void mixed_lifetimes(CppBenchmark::Context& context)
+{
+    const int threads_count = context.x();
+    const auto& sampled = sampled_sizes();
+
+    size_t rss_start = rss();
+    std::atomic<size_t> rss_peak(rss_start);
+    std::atomic<size_t> live_peak(0);
+
+    {
+        TManager manager;
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < threads_count; ++i)
+        {
+            threads.emplace_back([&manager, &sampled, &rss_peak, &live_peak, threads_count, i]()
+            {
+                std::vector<Block> window(short_lived, Block{ nullptr, 0 });
+                std::vector<Block> long_lived;
+                size_t live = 0;
+
+                uint64_t items = operations / threads_count;
+                for (uint64_t j = 0; j < items; ++j)
+                {
+                    size_t size = sampled[(i * 4096 + j) % sampled.size()];
+                    Block block = { manager.malloc(size), size };
+                    live += size;
+
+                    if ((int)(j % 100) < long_lived_percent)
+                        long_lived.push_back(block);
+                    else
+                    {
+                        // Replace the oldest short-lived block
+                        Block& slot = window[j % short_lived];
+                        if (slot.ptr != nullptr)
+                        {
+                            manager.free(slot.ptr, slot.size);
+                            live -= slot.size;
+                        }
+                        slot = block;
+                    }
+                }
+
+                // Track peak live bytes and the resident set size
+                live_peak += live;
+                size_t current = rss();
+                size_t peak = rss_peak.load();
+                while ((current > peak) && !rss_peak.compare_exchange_weak(peak, current)) {}
+
+                for (auto& block : window)
+                    if (block.ptr != nullptr)
+                        manager.free(block.ptr, block.size);
+                for (auto& block : long_lived)
+                    manager.free(block.ptr, block.size);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    // Update benchmark metrics
+    size_t growth = rss_peak - rss_start;
+    context.metrics().AddOperations(2 * (operations / threads_count) * threads_count - 1);
+    context.metrics().SetCustom("Live peak (KB)", (uint64_t)(live_peak / 1024));
+    context.metrics().SetCustom("RSS.peak growth (KB)", (uint64_t)(growth / 1024));
+    context.metrics().SetCustom("RSS.overhead", (live_peak > 0) ? ((double)growth / (double)live_peak) : 0.0);
+}
+
+// Single thread churns blocks over phases and frees most of long-lived blocks between
+// phases, so fragmentation is measured by the ratio of memory taken by the memory
+// manager from its auxiliary memory manager to live bytes
+template <class TManager>
+void fragmentation(CppBenchmark::Context& context)
+{
+    const auto& sampled = sampled_sizes();
+
+    size_t rss_start = rss();
+
+    {
+        TManager manager;
+
+        std::vector<Block> window(short_lived, Block{ nullptr, 0 });
+        std::vector<Block> long_lived;
+        size_t live = 0;
+
+        uint64_t index = 0;
+        for (int phase = 0; phase < phases; ++phase)
+        {
+            for (uint64_t j = 0; j < (operations / phases); ++j, ++index)
+            {
+                size_t size = sampled[index % sampled.size()];
+                Block block = { manager.malloc(size), size };
+                live += size;
+
+                if ((int)(index % 100) < long_lived_percent)
+                    long_lived.push_back(block);
+                else
+                {
+                    Block& slot = window[index % short_lived];
+                    if (slot.ptr != nullptr)
+                    {
+                        manager.free(slot.ptr, slot.size);
+                        live -= slot.size;
+                    }
+                    slot = block;
+                }
+            }
+
+            // Free 3 of 4 long-lived blocks leaving holes between survivors
+            size_t survivors = 0;
+            for (size_t k = 0; k < long_lived.size(); ++k)
+            {
+                if ((k % 4) != 0)
+                {
+                    manager.free(long_lived[k].ptr, long_lived[k].size);
+                    live -= long_lived[k].size;
+                }
+                else
+                    long_lived[survivors++] = long_lived[k];
+            }
+            long_lived.resize(survivors);
+
+            if (manager.footprint() > 0)
+                context.metrics().SetCustom("Fragmentation.phase" + std::to_string(phase + 1), (live > 0) ? ((double)manager.footprint() / (double)live) : 0.0);
+        }
+
+        context.metrics().SetCustom("Live (KB)", (uint64_t)(live / 1024));
+        context.metrics().SetCustom("Footprint (KB)", (uint64_t)(manager.footprint() / 1024));
+        context.metrics().SetCustom("RSS.growth (KB)", (uint64_t)((rss() - rss_start) / 1024));
+
+        for (auto& block : window)
+            if (block.ptr != nullptr)
+                manager.free(block.ptr, block.size);
+        for (auto& block : long_lived)
+            manager.free(block.ptr, block.size);
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * operations - 1);
+}
+
+BENCHMARK("Cross-thread: std::malloc", settings) { cross_thread<SystemMemoryManager>(context); }
+BENCHMARK("Cross-thread: DefaultMemoryManager", settings) { cross_thread<DefaultManager>(context); }
+BENCHMARK("Cross-thread: HeapMemoryManager", settings) { cross_thread<HeapManager>(context); }
+BENCHMARK("Cross-thread: PoolMemoryManager", settings) { cross_thread<PoolManager>(context); }
+BENCHMARK("Cross-thread: ArenaMemoryManager", settings) { cross_thread<ArenaManager>(context); }
+BENCHMARK("Cross-thread: SlabMemoryManager", settings) { cross_thread<SlabManager>(context); }
+BENCHMARK("Cross-thread: ThreadCacheMemoryManager", settings) { cross_thread<ThreadCacheManager>(context); }
+
+BENCHMARK("Mixed lifetimes: std::malloc", settings) { mixed_lifetimes<SystemMemoryManager>(context); }
+BENCHMARK("Mixed lifetimes: DefaultMemoryManager", settings) { mixed_lifetimes<DefaultManager>(context); }
+BENCHMARK("Mixed lifetimes: HeapMemoryManager", settings) { mixed_lifetimes<HeapManager>(context); }
+BENCHMARK("Mixed lifetimes: PoolMemoryManager", settings) { mixed_lifetimes<PoolManager>(context); }
+BENCHMARK("Mixed lifetimes: ArenaMemoryManager", settings) { mixed_lifetimes<ArenaManager>(context); }
+BENCHMARK("Mixed lifetimes: SlabMemoryManager", settings) { mixed_lifetimes<SlabManager>(context); }
+BENCHMARK("Mixed lifetimes: ThreadCacheMemoryManager", settings) { mixed_lifetimes<ThreadCacheManager>(context); }
+
+BENCHMARK("Fragmentation: std::malloc", CppBenchmark::Settings().Attempts(1)) { fragmentation<SystemMemoryManager>(context); }
+BENCHMARK("Fragmentation: DefaultMemoryManager", CppBenchmark::Settings().Attempts(1)) { fragmentation<DefaultManager>(context); }
+BENCHMARK("Fragmentation: HeapMemoryManager", CppBenchmark::Settings().Attempts(1)) { fragmentation<HeapManager>(context); }
+BENCHMARK("Fragmentation: PoolMemoryManager", CppBenchmark::Settings().Attempts(1)) { fragmentation<PoolManager>(context); }
+BENCHMARK("Fragmentation: ArenaMemoryManager", CppBenchmark::Settings().Attempts(1)) { fragmentation<ArenaManager>(context); }
+BENCHMARK("Fragmentation: SlabMemoryManager", CppBenchmark::Settings().Attempts(1)) { fragmentation<SlabManager>(context); }
+BENCHMARK("Fragmentation: ThreadCacheMemoryManager", CppBenchmark::Settings().Attempts(1)) { fragmentation<ThreadCacheManager>(context); }
+
+BENCHMARK_MAIN()
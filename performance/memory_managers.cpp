@@ -7,7 +7,11 @@
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
 #include "memory/allocator_heap.h"
+#include "memory/allocator_huge_page.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_profiling.h"
+#include "memory/allocator_slab.h"
+#include "memory/allocator_thread_cache.h"
 
 #include <vector>
 
@@ -51,6 +55,17 @@ protected:
     void Reset() override { manager.reset(); }
 };
 
+class HugePageArenaMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    HugePageMemoryManager auxiliary;
+    ArenaMemoryManager<HugePageMemoryManager> manager;
+
+    HugePageArenaMemoryManagerFixture() : manager(auxiliary, HugePageMemoryManager::HugePageSize()) {}
+
+    void Reset() override { manager.reset(); }
+};
+
 class PoolMemoryManagerFixture : public MemoryManagerFixture
 {
 protected:
@@ -62,6 +77,39 @@ protected:
     void Reset() override { manager.reset(); }
 };
 
+class ProfilingMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    ProfilingMemoryManager<DefaultMemoryManager> manager;
+
+    ProfilingMemoryManagerFixture() : manager(auxiliary) {}
+
+    void Reset() override { manager.reset(); }
+};
+
+class SlabMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manager;
+
+    SlabMemoryManagerFixture() : manager(auxiliary) {}
+
+    void Reset() override { manager.reset(); }
+};
+
+class ThreadCacheMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager central;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manager;
+
+    ThreadCacheMemoryManagerFixture() : manager(central) {}
+
+    void Reset() override { manager.reset(); }
+};
+
 template <class TMemoryManagerFixture>
 class MallocFixture : public TMemoryManagerFixture
 {
@@ -165,6 +213,18 @@ BENCHMARK_FIXTURE(FreeFixture<ArenaMemoryManagerFixture>, "ArenaMemoryManager.fr
     context.metrics().AddBytes(context.y());
 }
 
+BENCHMARK_FIXTURE(MallocFixture<HugePageArenaMemoryManagerFixture>, "ArenaMemoryManager<HugePageMemoryManager>.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<HugePageArenaMemoryManagerFixture>, "ArenaMemoryManager<HugePageMemoryManager>.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
 BENCHMARK_FIXTURE(MallocFixture<PoolMemoryManagerFixture>, "PoolMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
 {
     this->pointers.push_back(this->manager.malloc(context.y()));
@@ -191,4 +251,82 @@ BENCHMARK_FIXTURE(FreeFixture<PoolMemoryManagerFixture>, "PoolMemoryManager.free
     context.metrics().AddBytes(context.y());
 }
 
+BENCHMARK_FIXTURE(MallocFixture<ProfilingMemoryManagerFixture>, "ProfilingMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ProfilingMemoryManagerFixture>, "ProfilingMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<ProfilingMemoryManagerFixture>, "ProfilingMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ProfilingMemoryManagerFixture>, "ProfilingMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
 BENCHMARK_MAIN()
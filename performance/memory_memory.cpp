@@ -0,0 +1,67 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/memory.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 100;
+
+class MemoryFixture
+{
+protected:
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> destination;
+
+    MemoryFixture() : source(16 * 1024 * 1024, 0), destination(16 * 1024 * 1024, 0) {}
+};
+
+BENCHMARK_FIXTURE(MemoryFixture, "memcpy()", operations)
+{
+    std::memcpy(destination.data(), source.data(), source.size());
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::StreamCopy()", operations)
+{
+    Memory::StreamCopy(destination.data(), source.data(), source.size());
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "memset()", operations)
+{
+    std::memset(destination.data(), 0, destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::StreamFill()", operations)
+{
+    Memory::StreamFill(destination.data(), 0, destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::ZeroFill()", operations)
+{
+    Memory::ZeroFill(destination.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::IsZero()", operations)
+{
+    Memory::IsZero(source.data(), source.size());
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::RandomFill()", operations)
+{
+    Memory::RandomFill(destination.data(), destination.size());
+    context.metrics().AddBytes(destination.size());
+}
+
+BENCHMARK_MAIN()
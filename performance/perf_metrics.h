@@ -0,0 +1,52 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#ifndef CPPCOMMON_PERFORMANCE_PERF_METRICS_H
+#define CPPCOMMON_PERFORMANCE_PERF_METRICS_H
+
+#include "benchmark/cppbenchmark.h"
+
+#include "system/perf_counters.h"
+
+// Report hardware performance counters of the benchmark scope as custom benchmark metrics
+class PerfMetrics
+{
+public:
+    explicit PerfMetrics(CppBenchmark::Context& context)
+        : _context(context), _counters(CppCommon::PerfCounters::thread()), _start(_counters.Read())
+    {}
+    PerfMetrics(const PerfMetrics&) = delete;
+    PerfMetrics(PerfMetrics&&) = delete;
+    ~PerfMetrics()
+    {
+        if (!_counters.available())
+            return;
+
+        CppCommon::PerfCounterValues values = _counters.Read() - _start;
+        if (_counters.available(CppCommon::PerfEvent::CYCLES))
+            _context.metrics().SetCustom("PMU.cycles", values.cycles);
+        if (_counters.available(CppCommon::PerfEvent::INSTRUCTIONS))
+            _context.metrics().SetCustom("PMU.instructions", values.instructions);
+        if (_counters.available(CppCommon::PerfEvent::CYCLES) && _counters.available(CppCommon::PerfEvent::INSTRUCTIONS))
+            _context.metrics().SetCustom("PMU.IPC", values.ipc());
+        if (_counters.available(CppCommon::PerfEvent::L1D_MISSES))
+            _context.metrics().SetCustom("PMU.L1D misses", values.l1d_misses);
+        if (_counters.available(CppCommon::PerfEvent::LLC_MISSES))
+            _context.metrics().SetCustom("PMU.LLC misses", values.llc_misses);
+        if (_counters.available(CppCommon::PerfEvent::BRANCH_MISSES))
+            _context.metrics().SetCustom("PMU.branch misses", values.branch_misses);
+        if (_counters.available(CppCommon::PerfEvent::CONTEXT_SWITCHES))
+            _context.metrics().SetCustom("PMU.context switches", values.context_switches);
+    }
+
+    PerfMetrics& operator=(const PerfMetrics&) = delete;
+    PerfMetrics& operator=(PerfMetrics&&) = delete;
+
+private:
+    CppBenchmark::Context& _context;
+    const CppCommon::PerfCounters& _counters;
+    CppCommon::PerfCounterValues _start;
+};
+
+#endif // CPPCOMMON_PERFORMANCE_PERF_METRICS_H
@@ -0,0 +1,124 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/encoding.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 100000;
+const size_t chunk = 65536;
+
+class EncodingFixture
+{
+protected:
+    std::string source;
+    std::string base16;
+    std::string base32;
+    std::string base64;
+    std::string utf8;
+    std::u16string utf16;
+    std::string query;
+    std::string url;
+    std::vector<char> buffer;
+    std::vector<char16_t> buffer16;
+
+    EncodingFixture() : source(chunk, 0), buffer(3 * chunk), buffer16(chunk)
+    {
+        for (size_t i = 0; i < source.size(); ++i)
+            source[i] = (char)(i * 7 + 13);
+
+        base16 = Encoding::Base16Encode(source);
+        base32 = Encoding::Base32Encode(source);
+        base64 = Encoding::Base64Encode(source);
+
+        // Mostly ASCII text with some two, three and four bytes characters
+        const char* words[] = { "encoding ", "\xC4\x8D\xCE\xA9 ", "\xE2\x84\xA6 ", "\xF0\x9D\x93\x83 ", "text ", "json " };
+        for (size_t i = 0; utf8.size() < chunk; ++i)
+            utf8 += words[(i * 7) % 6];
+        utf16 = Encoding::UTF8toUTF16(utf8);
+
+        // Typical query strings: mostly without escape sequences
+        while (query.size() < 4096)
+            query += "/api/v1/orders?symbol=EURUSD&side=buy&volume=100000&price=1.08525&";
+        url = Encoding::URLEncode(source.substr(0, 4096));
+    }
+};
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::Base16Encode()", operations)
+{
+    Encoding::Base16Encode(source, buffer.data(), buffer.size());
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::Base16Decode()", operations)
+{
+    Encoding::Base16Decode(base16, buffer.data(), buffer.size());
+    context.metrics().AddBytes(base16.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::Base32Encode()", operations)
+{
+    Encoding::Base32Encode(source, buffer.data(), buffer.size());
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::Base32Decode()", operations)
+{
+    Encoding::Base32Decode(base32, buffer.data(), buffer.size());
+    context.metrics().AddBytes(base32.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::Base64Encode()", operations)
+{
+    Encoding::Base64Encode(source, buffer.data(), buffer.size());
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::Base64Decode()", operations)
+{
+    Encoding::Base64Decode(base64, buffer.data(), buffer.size());
+    context.metrics().AddBytes(base64.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::ValidateUTF8()", operations)
+{
+    Encoding::ValidateUTF8(utf8);
+    context.metrics().AddBytes(utf8.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::UTF8toUTF16()", operations)
+{
+    Encoding::UTF8toUTF16(utf8, buffer16.data(), buffer16.size());
+    context.metrics().AddBytes(utf8.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::UTF16toUTF8()", operations)
+{
+    Encoding::UTF16toUTF8(utf16, buffer.data(), buffer.size());
+    context.metrics().AddBytes(utf16.size() * sizeof(char16_t));
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::URLEncode()", operations)
+{
+    Encoding::URLEncode(query, buffer.data(), buffer.size());
+    context.metrics().AddBytes(query.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::URLDecode()", operations)
+{
+    Encoding::URLDecode(url, buffer.data(), buffer.size());
+    context.metrics().AddBytes(url.size());
+}
+
+BENCHMARK_FIXTURE(EncodingFixture, "Encoding::URLDecodeInPlace()", operations)
+{
+    Encoding::URLDecodeInPlace(query);
+    context.metrics().AddBytes(query.size());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,72 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/encoding.h"
+#include "string/encoding_stream.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000;
+const size_t total = 1048576;
+const size_t chunk = 4096;
+
+class EncodingStreamFixture
+{
+protected:
+    std::string source;
+    std::string base64;
+    std::string utf8;
+    std::vector<char> buffer;
+
+    EncodingStreamFixture() : source(total, 0), buffer(3 * chunk)
+    {
+        for (size_t i = 0; i < source.size(); ++i)
+            source[i] = (char)(i * 7 + 13);
+        base64 = Encoding::Base64Encode(source);
+
+        // Mostly ASCII text with some multi bytes characters
+        const char* words[] = { "encoding ", "\xC4\x8D\xCE\xA9 ", "\xE2\x84\xA6 ", "\xF0\x9D\x93\x83 ", "text " };
+        for (size_t i = 0; utf8.size() < total; ++i)
+            utf8 += words[(i * 7) % 5];
+    }
+
+    // Transform the input by odd sized chunks to exercise carried state
+    void Transform(EncodingStream& stream, std::string_view input)
+    {
+        for (size_t offset = 0; offset < input.size(); offset += chunk - 1)
+        {
+            size_t size = std::min(chunk - 1, input.size() - offset);
+            stream.Update(input.data() + offset, size, buffer.data(), buffer.size());
+        }
+        stream.Finish(buffer.data(), buffer.size());
+    }
+};
+
+BENCHMARK_FIXTURE(EncodingStreamFixture, "BaseStreamEncoder(64)", operations)
+{
+    BaseStreamEncoder encoder(64);
+    Transform(encoder, source);
+    context.metrics().AddBytes(source.size());
+}
+
+BENCHMARK_FIXTURE(EncodingStreamFixture, "BaseStreamDecoder(64)", operations)
+{
+    BaseStreamDecoder decoder(64);
+    Transform(decoder, base64);
+    context.metrics().AddBytes(base64.size());
+}
+
+BENCHMARK_FIXTURE(EncodingStreamFixture, "UTFStreamTranscoder<char, char16_t>", operations)
+{
+    UTFStreamTranscoder<char, char16_t> transcoder;
+    Transform(transcoder, utf8);
+    context.metrics().AddBytes(utf8.size());
+}
+
+BENCHMARK_MAIN()
@@ -28,4 +28,35 @@ BENCHMARK("format(int, double, string)")
     context.metrics().AddBytes(CppCommon::format("test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()).size());
 }
 
+class FormatFixture
+{
+protected:
+    fmt::memory_buffer buffer;
+    char chars[128];
+};
+
+BENCHMARK_FIXTURE(FormatFixture, "format_to(buffer, int, double, string)")
+{
+    buffer.clear();
+    CppCommon::format_to(buffer, "test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "format_to(buffer, FMT_COMPILE, int, double, string)")
+{
+    buffer.clear();
+    CppCommon::format_to(buffer, FMT_COMPILE("test {}.{}.{} test"), context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(FormatFixture, "format_to_n(chars, int, double, string)")
+{
+    context.metrics().AddBytes(CppCommon::format_to_n(chars, sizeof(chars), "test {}.{}.{} test", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()));
+}
+
+BENCHMARK("format(FMT_COMPILE, int, double, string)")
+{
+    context.metrics().AddBytes(CppCommon::format(FMT_COMPILE("test {}.{}.{} test"), context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name()).size());
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,35 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/glob_pattern.h"
+#include "string/string_utils.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+
+class GlobPatternFixture
+{
+protected:
+    GlobPattern pattern;
+    std::string names[4];
+
+    GlobPatternFixture() : pattern("!*.tmp;*.txt;report-*.log"), names{ "notes.txt", "report-2026.log", "cache.tmp", "image.png" } {}
+};
+
+BENCHMARK_FIXTURE(GlobPatternFixture, "GlobPattern::Match()", operations)
+{
+    for (const auto& name : names)
+        pattern.Match(name);
+}
+
+BENCHMARK_FIXTURE(GlobPatternFixture, "StringUtils::IsPatternMatch()", operations)
+{
+    for (const auto& name : names)
+        StringUtils::IsPatternMatch("!.*\\.tmp;.*\\.txt;report-.*\\.log", name);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,42 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/string_interner.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+
+class StringInternerFixture
+{
+protected:
+    StringInterner interner;
+    std::vector<std::string> symbols;
+    size_t index;
+
+    StringInternerFixture() : index(0)
+    {
+        for (int i = 0; i < 100000; ++i)
+            symbols.push_back("SYMBOL-" + std::to_string(i));
+        for (const auto& symbol : symbols)
+            interner.Intern(symbol);
+    }
+};
+
+BENCHMARK_FIXTURE(StringInternerFixture, "StringInterner::Intern()", operations)
+{
+    interner.Intern(symbols[index++ % symbols.size()]);
+}
+
+BENCHMARK_FIXTURE(StringInternerFixture, "StringInterner::Find()", operations)
+{
+    interner.Find(symbols[index++ % symbols.size()]);
+}
+
+BENCHMARK_MAIN()
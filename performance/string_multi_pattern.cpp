@@ -0,0 +1,58 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/multi_pattern.h"
+#include "string/string_utils.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 100000;
+
+class MultiPatternFixture
+{
+protected:
+    std::vector<std::string> small;
+    std::vector<std::string> large;
+    MultiPattern small_pattern;
+    MultiPattern large_pattern;
+    std::string line;
+
+    MultiPatternFixture() : line("2026-10-14 12:00:00.000 INFO [worker-7] Request processed in 42 ms for client 10.0.0.1 with status OK")
+    {
+        for (int i = 0; i < 16; ++i)
+            small.push_back("secret" + std::to_string(i) + "=");
+        for (int i = 0; i < 500; ++i)
+            large.push_back("token" + std::to_string(i * 7919) + ";");
+        small_pattern = MultiPattern(small);
+        large_pattern = MultiPattern(large);
+    }
+};
+
+BENCHMARK_FIXTURE(MultiPatternFixture, "MultiPattern::Contains() 16 patterns", operations)
+{
+    small_pattern.Contains(line);
+}
+
+BENCHMARK_FIXTURE(MultiPatternFixture, "StringUtils::Contains() 16 patterns", operations)
+{
+    for (const auto& pattern : small)
+        if (StringUtils::Contains(line, pattern))
+            break;
+}
+
+BENCHMARK_FIXTURE(MultiPatternFixture, "MultiPattern::Contains() 500 patterns", operations)
+{
+    large_pattern.Contains(line);
+}
+
+BENCHMARK_FIXTURE(MultiPatternFixture, "StringUtils::Contains() 500 patterns", operations)
+{
+    for (const auto& pattern : large)
+        if (StringUtils::Contains(line, pattern))
+            break;
+}
+
+BENCHMARK_MAIN()
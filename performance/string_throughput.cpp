@@ -0,0 +1,386 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/encoding.h"
+#include "string/glob_pattern.h"
+#include "string/string_utils.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+// Every operation processes at least 1 MB repeating smaller inputs
+const size_t bytes_per_operation = 1 << 20;
+
+// Input sizes from 16 bytes to 16 megabytes
+const auto settings = CppBenchmark::Settings().Attempts(3).Operations(100).ParamRange(16, 16 * 1024 * 1024, [](int from, int to, int& result) { int r = result; result *= 16; return r; });
+
+// Text corpus of the given size: ASCII-only or mixed with two, three and four bytes UTF-8 characters
+template <bool unicode>
+class CorpusFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::string text;
+    std::string base16;
+    std::string base32;
+    std::string base64;
+    std::u16string utf16;
+    std::string url;
+    std::vector<std::string_view> lines;
+    std::vector<char> buffer;
+    std::vector<char16_t> buffer16;
+    GlobPattern pattern;
+    size_t repeats;
+    size_t crc;
+
+    CorpusFixture() : pattern("*error*;*GET /api/*"), repeats(1), crc(0) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        const size_t size = (size_t)context.x();
+
+        static const char* ascii[] = { "GET", "/api/v1/orders", "Request", "processed", "in", "12", "ms", "by", "worker-7", "ERROR", "symbol=EURUSD", "price=1.08525" };
+        static const char* mixed[] = { "GET", "/api/v1/orders", "\xC4\x8D\xCE\xA9", "processed", "\xE2\x84\xA6", "12", "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", "by", "\xF0\x9D\x93\x83", "ERROR", "\xE4\xBD\xA0\xE5\xA5\xBD", "price=1.08525" };
+        const char** words = unicode ? mixed : ascii;
+
+        // Lines of about 64 bytes with leading and trailing blanks
+        text.clear();
+        std::string line;
+        for (size_t i = 0; text.size() < size; ++i)
+        {
+            line = "  ";
+            while (line.size() < 60)
+            {
+                line += words[(i * 7 + line.size()) % 12];
+                line += ' ';
+            }
+            line += " \n";
+            text += line;
+        }
+
+        // Cut the corpus at the character boundary
+        size_t length = size;
+        while ((length > 0) && ((text[length] & 0xC0) == 0x80))
+            --length;
+        text.resize(length);
+
+        base16 = Encoding::Base16Encode(text);
+        base32 = Encoding::Base32Encode(text);
+        base64 = Encoding::Base64Encode(text);
+        utf16 = Encoding::UTF8toUTF16(text);
+        url = Encoding::URLEncode(text);
+
+        lines.clear();
+        for (auto token : StringUtils::SplitView(text, '\n', true))
+            lines.push_back(token);
+
+        buffer.resize(std::max(3 * url.size(), 2 * base16.size()) + 16);
+        buffer16.resize(text.size() + 16);
+
+        repeats = std::max((size_t)1, bytes_per_operation / std::max((size_t)1, text.size()));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        context.metrics().SetCustom("CRC", (uint64_t)crc);
+        context.metrics().SetCustom("Size", (uint64_t)text.size());
+    }
+};
+
+size_t count_tokens(std::string_view text)
+{
+    size_t result = 0;
+    for ([[maybe_unused]] auto token : StringUtils::SplitView(text, ' ', true))
+        ++result;
+    return result;
+}
+
+typedef CorpusFixture<false> AsciiFixture;
+typedef CorpusFixture<true> UnicodeFixture;
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::Base16Encode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base16Encode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::Base16Encode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base16Encode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::Base16Decode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base16Decode(base16, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * base16.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::Base16Decode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base16Decode(base16, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * base16.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::Base32Encode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base32Encode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::Base32Encode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base32Encode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::Base32Decode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base32Decode(base32, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * base32.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::Base32Decode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base32Decode(base32, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * base32.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::Base64Encode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base64Encode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::Base64Encode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base64Encode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::Base64Decode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base64Decode(base64, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * base64.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::Base64Decode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::Base64Decode(base64, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * base64.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::ValidateUTF8() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::ValidateUTF8(text));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::ValidateUTF8() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::ValidateUTF8(text));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::UTF8toUTF16() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::UTF8toUTF16(text, buffer16.data(), buffer16.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::UTF8toUTF16() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::UTF8toUTF16(text, buffer16.data(), buffer16.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::UTF16toUTF8() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::UTF16toUTF8(utf16, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::UTF16toUTF8() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::UTF16toUTF8(utf16, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::URLEncode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::URLEncode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::URLEncode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::URLEncode(text, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "Encoding::URLDecode() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::URLDecode(url, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * url.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "Encoding::URLDecode() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(Encoding::URLDecode(url, buffer.data(), buffer.size()));
+    context.metrics().AddBytes(repeats * url.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::ToLower() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::ToLower(text).size());
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::ToLower() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::ToLower(text).size());
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::ToUpper() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::ToUpper(text).size());
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::ToUpper() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::ToUpper(text).size());
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::CompareNoCase() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::CompareNoCase(text, text));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::CompareNoCase() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::CompareNoCase(text, text));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::Find() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::Find(text, "needle"));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::Find() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::Find(text, "needle"));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::CountAll() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::CountAll(text, "GET"));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::CountAll() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::CountAll(text, "GET"));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::Split() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::Split(text, ' ', true).size());
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::Split() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(StringUtils::Split(text, ' ', true).size());
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::SplitView() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(count_tokens(text));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::SplitView() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(count_tokens(text));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "StringUtils::ToTrim() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(std::count_if(lines.begin(), lines.end(), [](std::string_view line) { return !StringUtils::ToTrim(line).empty(); }));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "StringUtils::ToTrim() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(std::count_if(lines.begin(), lines.end(), [](std::string_view line) { return !StringUtils::ToTrim(line).empty(); }));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(AsciiFixture, "GlobPattern::Match() (ASCII)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(std::count_if(lines.begin(), lines.end(), [this](std::string_view line) { return pattern.Match(line); }));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_FIXTURE(UnicodeFixture, "GlobPattern::Match() (Unicode)", settings)
+{
+    for (size_t i = 0; i < repeats; ++i)
+        crc += (size_t)(std::count_if(lines.begin(), lines.end(), [this](std::string_view line) { return pattern.Match(line); }));
+    context.metrics().AddBytes(repeats * text.size());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,84 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/string_utils.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t operations = 100000;
+
+class StringUtilsFixture
+{
+protected:
+    std::string line;
+    std::string text;
+    std::string numbers;
+    std::vector<double> values;
+
+    StringUtilsFixture()
+    {
+        // Typical log line with a lot of spaces and frequent characters
+        line = "   2026-10-14 12:00:00.000 [INFO] Request GET /api/v1/items?id=42 processed in 12 ms by worker-7   ";
+        while (text.size() < 65536)
+            text += line;
+        text += "needle";
+
+        // Tick data column of prices
+        for (int i = 0; i < 1000; ++i)
+            numbers += StringUtils::ToString(1.0 + i * 0.0125) + ((i < 999) ? "," : "");
+        values.resize(1000);
+    }
+};
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::ToLower()", operations)
+{
+    std::string result = StringUtils::ToLower(text);
+    context.metrics().AddBytes(result.size());
+}
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::ToTrim()", operations)
+{
+    std::string result = StringUtils::ToTrim(line);
+    context.metrics().AddBytes(line.size());
+}
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::Contains()", operations)
+{
+    StringUtils::Contains(text, "needle");
+    context.metrics().AddBytes(text.size());
+}
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::Split()", operations)
+{
+    auto tokens = StringUtils::Split(line, ' ', true);
+    context.metrics().AddBytes(line.size());
+}
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::SplitView()", operations)
+{
+    size_t count = 0;
+    for (auto token : StringUtils::SplitView(line, ' ', true))
+        count += token.size();
+    context.metrics().AddBytes(count);
+}
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::ToChars()", operations)
+{
+    char buffer[32];
+    for (const auto& value : values)
+        StringUtils::ToChars(value, buffer, sizeof(buffer));
+    context.metrics().AddBytes(numbers.size());
+}
+
+BENCHMARK_FIXTURE(StringUtilsFixture, "StringUtils::FromStrings()", operations)
+{
+    StringUtils::FromStrings(numbers, ',', values.data(), values.size());
+    context.metrics().AddBytes(numbers.size());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,59 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/file.h"
+#include "system/async_logger.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10000000;
+
+class AsyncLoggerFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    // Large ring buffer keeps the writer thread from dropping records
+    AsyncLogger logger{16777216};
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        logger.Open("test.async.log", 0, 0, Timespan::milliseconds(1));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        logger.Close();
+        context.metrics().SetCustom("Records", logger.records());
+        context.metrics().SetCustom("Dropped", logger.dropped());
+        File::Remove("test.async.log");
+    }
+};
+
+BENCHMARK_FIXTURE(AsyncLoggerFixture, "AsyncLogger-integers", iterations)
+{
+    logger.Log("Order {} filled {} of {}", 42, 100, 1000);
+}
+
+BENCHMARK_FIXTURE(AsyncLoggerFixture, "AsyncLogger-double", iterations)
+{
+    logger.Log("Price {:.2f}", 101.25);
+}
+
+BENCHMARK_FIXTURE(AsyncLoggerFixture, "AsyncLogger-string", iterations)
+{
+    static const std::string symbol = "EURUSD";
+    logger.Log("Symbol {} side {}", symbol, "Buy");
+}
+
+BENCHMARK("format-integers", iterations)
+{
+    static fmt::memory_buffer buffer;
+    buffer.clear();
+    format_to(buffer, "Order {} filled {} of {}", 42, 100, 1000);
+}
+
+BENCHMARK_MAIN()
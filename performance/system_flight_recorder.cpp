@@ -0,0 +1,32 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "system/flight_recorder.h"
+
+using namespace CppCommon;
+
+const uint64_t iterations = 100000000;
+
+class FlightRecorderFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FlightRecorder::Setup("benchmark_flight_recorder");
+    }
+};
+
+BENCHMARK_FIXTURE(FlightRecorderFixture, "FlightRecorder::Record()", iterations)
+{
+    FlightRecorder::Record(1, 42);
+}
+
+BENCHMARK_FIXTURE(FlightRecorderFixture, "FlightRecorder::Record(message)", iterations)
+{
+    FlightRecorder::Record(2, "benchmark message", 42);
+}
+
+BENCHMARK_MAIN()
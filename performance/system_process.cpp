@@ -0,0 +1,42 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "system/process_pool.h"
+
+using namespace CppCommon;
+
+const uint64_t iterations = 1000;
+
+class ProcessPoolFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::unique_ptr<ProcessPool> pool;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // 'cat' worker echoes framed jobs back as results
+        pool = std::make_unique<ProcessPool>("cat", nullptr, 1);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        pool.reset();
+    }
+};
+
+BENCHMARK("Process::Run()", iterations)
+{
+    std::string output;
+    std::vector<std::string> arguments = { "job" };
+    Process::Run("echo", &arguments, nullptr, nullptr, nullptr, &output, nullptr);
+}
+
+BENCHMARK_FIXTURE(ProcessPoolFixture, "ProcessPool::Execute()", iterations)
+{
+    pool->Execute("job");
+}
+
+BENCHMARK_MAIN()
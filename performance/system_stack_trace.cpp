@@ -14,6 +14,18 @@ BENCHMARK("StackTrace")
 {
     uint64_t crc = 0;
 
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += StackTrace().addresses().size();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StackTrace.frames()")
+{
+    uint64_t crc = 0;
+
     for (uint64_t i = 0; i < operations; ++i)
         crc += StackTrace().frames().size();
 
@@ -0,0 +1,131 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "errors/exceptions_handler.h"
+#include "system/stack_trace.h"
+#include "system/stack_trace_manager.h"
+#include "time/timestamp.h"
+#include "utility/singleton.h"
+#include "utility/static_constructor.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000;
+
+class StartupClass
+{
+public:
+    static uint64_t timestamp;
+
+private:
+    static void StaticConstructor()
+    {
+        CppCommon::StaticConstructor<&StartupClass::StaticConstructor>::instance();
+
+        timestamp = Timestamp::nano();
+    }
+};
+
+uint64_t StartupClass::timestamp = 0;
+
+class StartupSingleton : public Singleton<StartupSingleton>
+{
+    friend Singleton<StartupSingleton>;
+
+public:
+    uint64_t value() const noexcept { return _value; }
+
+private:
+    uint64_t _value;
+
+    StartupSingleton() : _value(Timestamp::nano()) {}
+    ~StartupSingleton() = default;
+};
+
+BENCHMARK("StaticConstructor")
+{
+    // Measure the time passed from the static constructor call
+    uint64_t elapsed = Timestamp::nano() - StartupClass::timestamp;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(1);
+    context.metrics().SetCustom("Elapsed since static constructor (ns)", elapsed);
+}
+
+BENCHMARK("Singleton::GetInstance()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += StartupSingleton::GetInstance().value();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("ExceptionsHandler::SetupProcess()")
+{
+    uint64_t timestamp = Timestamp::nano();
+    ExceptionsHandler::SetupProcess();
+    ExceptionsHandler::SetupThread();
+    uint64_t elapsed = Timestamp::nano() - timestamp;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(1);
+    context.metrics().SetCustom("Elapsed (ns)", elapsed);
+}
+
+BENCHMARK("StackTraceManager::Initialize()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        StackTraceManager::Initialize();
+        StackTraceManager::Cleanup();
+        ++crc;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StackTraceManager::Initialize(lazy)")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        StackTraceManager::Initialize(true);
+        StackTraceManager::Cleanup();
+        ++crc;
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("StackTraceManager::Initialize(lazy) + first trace")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        StackTraceManager::Initialize(true);
+        StackTrace::ClearCache();
+        crc += StackTrace().frames().size();
+        StackTraceManager::Cleanup();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,46 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/file.h"
+#include "system/tracer.h"
+
+using namespace CppCommon;
+
+const uint64_t iterations = 10000000;
+
+class TracerFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Large ring buffer keeps the collector from dropping events
+        Tracer::Start("test.trace.json", TraceFormat::Chrome, 1048576, Timespan::milliseconds(10));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        Tracer::Stop();
+        context.metrics().SetCustom("Dropped", Tracer::dropped());
+        File::Remove("test.trace.json");
+    }
+};
+
+BENCHMARK("TRACE_SCOPE-disabled", iterations)
+{
+    TRACE_SCOPE("disabled");
+}
+
+BENCHMARK_FIXTURE(TracerFixture, "TRACE_SCOPE-enabled", iterations)
+{
+    TRACE_SCOPE("enabled");
+}
+
+BENCHMARK_FIXTURE(TracerFixture, "TRACE_INSTANT-enabled", iterations)
+{
+    TRACE_INSTANT("instant");
+}
+
+BENCHMARK_MAIN()
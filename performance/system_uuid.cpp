@@ -23,4 +23,27 @@ BENCHMARK("UUID::Random()")
     UUID::Random();
 }
 
+BENCHMARK("UUID::Secure()")
+{
+    UUID::Secure();
+}
+
+BENCHMARK("UUID::Ordered()")
+{
+    UUID::Ordered();
+}
+
+BENCHMARK("UUID::string()")
+{
+    static UUID uuid = UUID::Random();
+    char buffer[36];
+    uuid.string(buffer, sizeof(buffer));
+}
+
+BENCHMARK("UUID(std::string)")
+{
+    static std::string uuid = UUID::Random().string();
+    UUID result(uuid);
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,60 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/spin_barrier.h"
+#include "threads/tree_barrier.h"
+
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace CppCommon;
+
+const int phases = 100000;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TBarrier>
+void iterate(CppBenchmark::Context& context, TBarrier& barrier, int threads_count)
+{
+    // Start worker threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&barrier, thread]()
+        {
+            for (int phase = 0; phase < phases; ++phase)
+            {
+                if constexpr (std::is_same_v<TBarrier, SpinBarrier>)
+                    barrier.Wait();
+                else
+                    barrier.Wait(thread);
+            }
+        });
+    }
+
+    // Wait for all worker threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(phases);
+}
+
+BENCHMARK("SpinBarrier", settings)
+{
+    SpinBarrier barrier(context.x());
+    iterate(context, barrier, context.x());
+}
+
+BENCHMARK("TreeBarrier", settings)
+{
+    TreeBarrier barrier(context.x());
+    iterate(context, barrier, context.x());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,107 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/async_latch.h"
+#include "threads/async_queue.h"
+#include "threads/coroutine_scheduler.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int producers_from = 1;
+const int producers_to = 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+Task<void> Produce(AsyncQueue<uint64_t>& queue, AsyncLatch& latch, uint64_t from, uint64_t to)
+{
+    for (uint64_t i = from; i < to; ++i)
+    {
+        // Enqueue the item or end produce
+        bool enqueued = co_await queue.Enqueue(i);
+        if (!enqueued)
+            break;
+    }
+    latch.CountDown();
+}
+
+Task<void> Consume(AsyncQueue<uint64_t>& queue, AsyncLatch& latch, std::atomic<uint64_t>& crc)
+{
+    uint64_t sum = 0;
+    std::vector<uint64_t> items;
+
+    // Dequeue all items or end consume
+    while (co_await queue.DequeueAll(items))
+        for (auto item : items)
+            sum += item;
+
+    crc += sum;
+    latch.CountDown();
+}
+
+Task<void> Run(CoroutineScheduler& scheduler, int producers_count, std::atomic<uint64_t>& crc)
+{
+    // Create bounded awaitable queue
+    AsyncQueue<uint64_t> queue(1024);
+
+    // Spawn the consumer coroutine
+    AsyncLatch consumer(1);
+    scheduler.Spawn(Consume(queue, consumer, crc));
+
+    // Spawn producer coroutines
+    AsyncLatch producers(producers_count);
+    uint64_t items = (items_to_produce / producers_count);
+    for (int producer = 0; producer < producers_count; ++producer)
+        scheduler.Spawn(Produce(queue, producers, items * producer, items * (producer + 1)));
+
+    // Wait for all producer coroutines
+    co_await producers;
+
+    // Close the queue and wait for the consumer coroutine
+    queue.Close();
+    co_await consumer;
+}
+
+Task<void> RunAndStop(SingleThreadScheduler& scheduler, int producers_count, std::atomic<uint64_t>& crc)
+{
+    co_await Run(scheduler, producers_count, crc);
+    scheduler.Stop();
+}
+
+BENCHMARK("AsyncQueue-SingleThreadScheduler", settings)
+{
+    const int producers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    // Run all coroutines in the current thread
+    SingleThreadScheduler scheduler;
+    scheduler.Spawn(RunAndStop(scheduler, producers_count, crc));
+    scheduler.Run();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("AsyncQueue-MultiThreadScheduler", settings)
+{
+    const int producers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    MultiThreadScheduler scheduler(4);
+    SyncWait(Run(scheduler, producers_count, crc));
+    scheduler.Stop();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK_MAIN()
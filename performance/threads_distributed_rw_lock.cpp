@@ -0,0 +1,90 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/distributed_rw_lock.h"
+#include "threads/rw_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int readers_from = 1;
+const int readers_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TLock>
+void produce(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    std::atomic<uint64_t> readers_crc(0);
+    uint64_t writers_crc = 0;
+    uint64_t value = 0;
+    std::atomic<bool> stop(false);
+
+    // Create read/write lock synchronization primitive
+    TLock lock;
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&lock, &readers_crc, &value, readers_count]()
+        {
+            uint64_t crc = 0;
+            uint64_t items = (items_to_produce / readers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                ReadLocker<TLock> locker(lock);
+                crc += value;
+            }
+            readers_crc += crc;
+        });
+    }
+
+    // Start rare writer thread
+    std::thread writer([&lock, &writers_crc, &value, &stop]()
+    {
+        while (!stop)
+        {
+            {
+                WriteLocker<TLock> locker(lock);
+                writers_crc += ++value;
+            }
+
+            // Sleep for a while...
+            Thread::Sleep(1);
+        }
+    });
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Wait for the writer thread
+    stop = true;
+    writer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc.load());
+    context.metrics().SetCustom("CRC-Writers", writers_crc);
+}
+
+BENCHMARK("RWLock-readers", settings)
+{
+    produce<RWLock>(context);
+}
+
+BENCHMARK("DistributedRWLock-readers", settings)
+{
+    produce<DistributedRWLock>(context);
+}
+
+BENCHMARK_MAIN()
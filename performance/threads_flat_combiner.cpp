@@ -0,0 +1,90 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/critical_section.h"
+#include "threads/flat_combiner.h"
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items = 100000;
+const int threads_from = 1;
+const int threads_to = 32;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Update the order book price level
+inline void update(std::map<uint64_t, uint64_t>& levels, uint64_t price)
+{
+    auto it = levels.find(price);
+    if (it == levels.end())
+        levels.emplace(price, 10);
+    else if (it->second > 100)
+        levels.erase(it);
+    else
+        it->second += 10;
+}
+
+template <class TOperation>
+void iterate(CppBenchmark::Context& context, int threads_count, TOperation operation)
+{
+    // Start worker threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&operation, thread]()
+        {
+            for (uint64_t i = 0; i < items; ++i)
+                operation(1000 + ((i * 7919 + thread) % 256));
+        });
+    }
+
+    // Wait for all worker threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items * threads_count);
+}
+
+template <class TLock>
+void lock(CppBenchmark::Context& context)
+{
+    TLock lock;
+    std::map<uint64_t, uint64_t> levels;
+    iterate(context, context.x(), [&lock, &levels](uint64_t price)
+    {
+        Locker<TLock> locker(lock);
+        update(levels, price);
+    });
+}
+
+BENCHMARK("CriticalSection", settings)
+{
+    lock<CriticalSection>(context);
+}
+
+BENCHMARK("SpinLock", settings)
+{
+    lock<SpinLock>(context);
+}
+
+BENCHMARK("FlatCombiner", settings)
+{
+    FlatCombiner<std::map<uint64_t, uint64_t>> combiner;
+    iterate(context, context.x(), [&combiner](uint64_t price)
+    {
+        combiner.Execute([price](std::map<uint64_t, uint64_t>& levels) { update(levels, price); });
+    });
+    context.metrics().SetCustom("batch", (double)combiner.operations() / combiner.batches());
+}
+
+BENCHMARK_MAIN()
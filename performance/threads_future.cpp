@@ -0,0 +1,63 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/future.h"
+
+#include <future>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 1000000;
+
+BENCHMARK("Promise-Future")
+{
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        Promise<uint64_t> promise;
+        Future<uint64_t> future = promise.GetFuture();
+        promise.SetValue(i);
+        sum += future.Get();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddItems(iterations);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK("Promise-Future-Then")
+{
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        Promise<uint64_t> promise;
+        Future<uint64_t> future = promise.GetFuture().Then([](uint64_t value) { return value + 1; });
+        promise.SetValue(i);
+        sum += future.Get();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddItems(iterations);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK("std::promise-std::future")
+{
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        std::promise<uint64_t> promise;
+        std::future<uint64_t> future = promise.get_future();
+        promise.set_value(i);
+        sum += future.get();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddItems(iterations);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_MAIN()
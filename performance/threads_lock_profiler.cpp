@@ -0,0 +1,92 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/critical_section.h"
+#include "threads/lock_profiler.h"
+#include "threads/mutex.h"
+#include "threads/spin_lock.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int producers_from = 1;
+const int producers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TLock, bool profiled>
+void produce(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    uint64_t crc = 0;
+
+    TLock lock;
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, &crc, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                if constexpr (profiled)
+                {
+                    PROFILED_LOCKER(lock);
+                    crc += (producer * items) + i;
+                }
+                else
+                {
+                    Locker<TLock> locker(lock);
+                    crc += (producer * items) + i;
+                }
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("SpinLock", settings)
+{
+    produce<SpinLock, false>(context);
+}
+
+BENCHMARK("SpinLock-Profiled", settings)
+{
+    produce<SpinLock, true>(context);
+}
+
+BENCHMARK("CriticalSection", settings)
+{
+    produce<CriticalSection, false>(context);
+}
+
+BENCHMARK("CriticalSection-Profiled", settings)
+{
+    produce<CriticalSection, true>(context);
+}
+
+BENCHMARK("Mutex", settings)
+{
+    produce<Mutex, false>(context);
+}
+
+BENCHMARK("Mutex-Profiled", settings)
+{
+    produce<Mutex, true>(context);
+}
+
+BENCHMARK_MAIN()
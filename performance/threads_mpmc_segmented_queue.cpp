@@ -0,0 +1,121 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/mpmc_ring_queue.h"
+#include "threads/mpmc_segmented_queue.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<class TQueue>
+void produce_consume(CppBenchmark::Context& context, TQueue& queue)
+{
+    const int threads_count = context.x();
+    std::atomic<uint64_t> crc(0);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < threads_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &crc, threads_count]()
+        {
+            uint64_t sum = 0;
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Dequeue using yield waiting strategy
+                uint64_t item;
+                while (!queue.Dequeue(item))
+                    std::this_thread::yield();
+
+                // Consume the item
+                sum += item;
+            }
+            crc += sum;
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < threads_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, threads_count]()
+        {
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue using yield waiting strategy
+                while (!queue.Enqueue(items * producer + i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Wait for all producers and consumers threads
+    for (auto& producer : producers)
+        producer.join();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("MPMCRingQueue-producers-consumers", settings)
+{
+    MPMCRingQueue<uint64_t> queue(1048576);
+    produce_consume(context, queue);
+}
+
+BENCHMARK("MPMCSegmentedQueue-producers-consumers", settings)
+{
+    MPMCSegmentedQueue<uint64_t> queue(1024);
+    produce_consume(context, queue);
+    context.metrics().SetCustom("MPMCSegmentedQueue.segments", (uint64_t)queue.segments());
+}
+
+BENCHMARK("MPMCSegmentedQueue-burst", settings)
+{
+    const int threads_count = context.x();
+
+    // Enqueue the whole burst exceeding any fixed capacity and drain it
+    MPMCSegmentedQueue<uint64_t> queue(1024);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < threads_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, threads_count]()
+        {
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+                queue.Enqueue(items * producer + i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    uint64_t crc = 0;
+    uint64_t item;
+    while (queue.Dequeue(item))
+        crc += item;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
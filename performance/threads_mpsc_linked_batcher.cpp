@@ -7,6 +7,7 @@
 #include "threads/mpsc_linked_batcher.h"
 
 #include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
@@ -17,7 +18,9 @@ const int producers_from = 1;
 const int producers_to = 8;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
-template<typename T>
+enum class Handler { Function, Template, Span };
+
+template<typename T, Handler handler_type>
 void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
 {
     const int producers_count = context.x();
@@ -31,19 +34,55 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     {
         for (uint64_t i = 0; i < items_to_produce;)
         {
-            // Define the batcher handler
-            auto handler = [&crc, &i](const int& item)
+            if constexpr (handler_type == Handler::Function)
             {
-                // Consume the item
-                crc += item;
-
-                // Increase the items counter
-                ++i;
-            };
-
-            // Dequeue all available items using the given waiting strategy
-            while (!batcher.Dequeue(handler))
-                wait_strategy();
+                // Define the type-erased batcher handler
+                std::function<void(const T&)> handler = [&crc, &i](const T& item)
+                {
+                    // Consume the item
+                    crc += item;
+
+                    // Increase the items counter
+                    ++i;
+                };
+
+                // Dequeue all available items using the given waiting strategy
+                while (!batcher.Dequeue(handler))
+                    wait_strategy();
+            }
+            else if constexpr (handler_type == Handler::Template)
+            {
+                // Define the inlined batcher handler
+                auto handler = [&crc, &i](T&& item)
+                {
+                    // Consume the item
+                    crc += item;
+
+                    // Increase the items counter
+                    ++i;
+                };
+
+                // Dequeue all available items using the given waiting strategy
+                while (!batcher.Dequeue(handler))
+                    wait_strategy();
+            }
+            else
+            {
+                // Define the span batcher handler
+                auto handler = [&crc, &i](std::span<T> items)
+                {
+                    // Consume all items
+                    for (const auto& item : items)
+                        crc += item;
+
+                    // Increase the items counter
+                    i += items.size();
+                };
+
+                // Dequeue all available items using the given waiting strategy
+                while (!batcher.DequeueBatch(handler))
+                    wait_strategy();
+            }
         }
     });
 
@@ -77,14 +116,34 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
-BENCHMARK("MPSCLinkedBatcher<SpinWait>-producers", settings)
+BENCHMARK("MPSCLinkedBatcher<SpinWait, Function>-producers", settings)
+{
+    produce_consume<int, Handler::Function>(context, []{});
+}
+
+BENCHMARK("MPSCLinkedBatcher<SpinWait, Template>-producers", settings)
+{
+    produce_consume<int, Handler::Template>(context, []{});
+}
+
+BENCHMARK("MPSCLinkedBatcher<SpinWait, Span>-producers", settings)
+{
+    produce_consume<int, Handler::Span>(context, []{});
+}
+
+BENCHMARK("MPSCLinkedBatcher<YieldWait, Function>-producers", settings)
+{
+    produce_consume<int, Handler::Function>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPSCLinkedBatcher<YieldWait, Template>-producers", settings)
 {
-    produce_consume<int>(context, []{});
+    produce_consume<int, Handler::Template>(context, []{ std::this_thread::yield(); });
 }
 
-BENCHMARK("MPSCLinkedBatcher<YieldWait>-producers", settings)
+BENCHMARK("MPSCLinkedBatcher<YieldWait, Span>-producers", settings)
 {
-    produce_consume<int>(context, []{ std::this_thread::yield(); });
+    produce_consume<int, Handler::Span>(context, []{ std::this_thread::yield(); });
 }
 
 BENCHMARK_MAIN()
@@ -0,0 +1,94 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/multicast_ring.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int consumers_from = 1;
+const int consumers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(consumers_from, consumers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <MulticastClaim claim, class TWaitStrategy, uint64_t N>
+void multicast(CppBenchmark::Context& context, int producers_count)
+{
+    const int consumers_count = context.x();
+    uint64_t crc = 0;
+
+    // Create multicast ring with independent consumers
+    typedef MulticastRing<uint64_t, claim, TWaitStrategy> Ring;
+    Ring ring(N);
+    std::vector<std::unique_ptr<typename Ring::Consumer>> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+        consumers.emplace_back(std::make_unique<typename Ring::Consumer>(ring));
+
+    // Start consumer threads, each one sees every event
+    std::vector<uint64_t> crcs(consumers_count, 0);
+    std::vector<std::thread> threads;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        threads.emplace_back([&consumers, &crcs, consumer]()
+        {
+            uint64_t processed = 0;
+            uint64_t sum = 0;
+            while (processed < items_to_produce)
+                processed += consumers[consumer]->ProcessWait([&sum](uint64_t& item, int64_t sequence, bool end_of_batch) { sum += item; });
+            crcs[consumer] = sum;
+        });
+    }
+
+    // Start producer threads
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        threads.emplace_back([&ring, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+                ring.PublishEvent([value = items * producer + i](uint64_t& item, int64_t sequence) { item = value; });
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto value : crcs)
+        crc += value;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce * consumers_count);
+    context.metrics().AddBytes(items_to_produce * consumers_count * sizeof(uint64_t));
+    context.metrics().SetCustom("MulticastRing.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("MulticastRing<Single, YieldWait>-consumers", settings)
+{
+    multicast<MulticastClaim::SINGLE, YieldWaitStrategy, 65536>(context, 1);
+}
+
+BENCHMARK("MulticastRing<Single, BlockingWait>-consumers", settings)
+{
+    multicast<MulticastClaim::SINGLE, BlockingWaitStrategy, 65536>(context, 1);
+}
+
+BENCHMARK("MulticastRing<Multi, YieldWait>-consumers", settings)
+{
+    multicast<MulticastClaim::MULTI, YieldWaitStrategy, 65536>(context, 4);
+}
+
+BENCHMARK("MulticastRing<Multi, BlockingWait>-consumers", settings)
+{
+    multicast<MulticastClaim::MULTI, BlockingWaitStrategy, 65536>(context, 4);
+}
+
+BENCHMARK_MAIN()
@@ -6,6 +6,7 @@
 
 #include "threads/mutex.h"
 
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -16,13 +17,25 @@ const int producers_from = 1;
 const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+// Standard mutex adaptor used as a baseline
+class StdMutex
+{
+public:
+    void Lock() { _mutex.lock(); }
+    void Unlock() { _mutex.unlock(); }
+
+private:
+    std::mutex _mutex;
+};
+
+template <class TMutex>
 void produce(CppBenchmark::Context& context)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
     // Create mutex synchronization primitive
-    Mutex lock;
+    TMutex lock;
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -33,7 +46,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<Mutex> locker(lock);
+                Locker<TMutex> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +63,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("Mutex", settings)
 {
-    produce(context);
+    produce<Mutex>(context);
+}
+
+BENCHMARK("std::mutex", settings)
+{
+    produce<StdMutex>(context);
 }
 
 BENCHMARK_MAIN()
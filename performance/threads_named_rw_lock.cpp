@@ -4,6 +4,7 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/named_distributed_rw_lock.h"
 #include "threads/named_rw_lock.h"
 
 #include <thread>
@@ -19,6 +20,7 @@ const int writers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          writers_from, writers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
@@ -27,7 +29,7 @@ void produce(CppBenchmark::Context& context)
     uint64_t writers_crc = 0;
 
     // Create named read/write lock master
-    NamedRWLock lock_master("named_rw_lock_perf");
+    TLock lock_master("named_rw_lock_perf");
 
     // Start readers threads
     std::vector<std::thread> readers;
@@ -36,12 +38,12 @@ void produce(CppBenchmark::Context& context)
         readers.emplace_back([&readers_crc, reader, readers_count]()
         {
             // Create named read/write lock slave
-            NamedRWLock lock_slave("named_rw_lock_perf");
+            TLock lock_slave("named_rw_lock_perf");
 
             uint64_t items = (items_to_produce / readers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                ReadLocker<NamedRWLock> locker(lock_slave);
+                ReadLocker<TLock> locker(lock_slave);
                 readers_crc += (reader * items) + i;
             }
         });
@@ -54,12 +56,12 @@ void produce(CppBenchmark::Context& context)
         writers.emplace_back([&writers_crc, writer, writers_count]()
         {
             // Create named read/write lock slave
-            NamedRWLock lock("named_rw_lock_perf");
+            TLock lock("named_rw_lock_perf");
 
             uint64_t items = (items_to_produce / writers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                WriteLocker<NamedRWLock> locker(lock);
+                WriteLocker<TLock> locker(lock);
                 writers_crc += (writer * items) + i;
             }
         });
@@ -81,7 +83,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("NamedRWLock", settings)
 {
-    produce(context);
+    produce<NamedRWLock>(context);
+}
+
+BENCHMARK("NamedDistributedRWLock", settings)
+{
+    produce<NamedDistributedRWLock>(context);
 }
 
 BENCHMARK_MAIN()
@@ -0,0 +1,87 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/parallel.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t items = 10000000;
+
+class ParallelFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    ThreadPool pool;
+    std::vector<uint64_t> values;
+    std::vector<uint64_t> output;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        std::mt19937_64 random(0);
+        values.resize(items);
+        output.resize(items);
+        for (auto& value : values)
+            value = random();
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        context.metrics().AddItems(items);
+        context.metrics().SetCustom("Threads", (uint32_t)pool.threads());
+    }
+};
+
+BENCHMARK_FIXTURE(ParallelFixture, "std::for_each")
+{
+    std::for_each(values.begin(), values.end(), [](uint64_t& value) { value = value * 2654435761u + 1; });
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "ParallelForRange")
+{
+    ParallelForRange(pool, (size_t)0, values.size(), [this](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+            values[i] = values[i] * 2654435761u + 1;
+    });
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "std::accumulate")
+{
+    context.metrics().SetCustom("Sum", std::accumulate(values.begin(), values.end(), (uint64_t)0));
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "ParallelReduce")
+{
+    context.metrics().SetCustom("Sum", ParallelReduce(pool, values.begin(), values.end(), (uint64_t)0));
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "std::inclusive_scan")
+{
+    std::inclusive_scan(values.begin(), values.end(), output.begin());
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "ParallelScan")
+{
+    ParallelScan(pool, values.begin(), values.end(), output.begin(), (uint64_t)0);
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "std::sort", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint64_t> copy = values;
+    std::sort(copy.begin(), copy.end());
+}
+
+BENCHMARK_FIXTURE(ParallelFixture, "ParallelSort", CppBenchmark::Settings().Attempts(1).Operations(1))
+{
+    std::vector<uint64_t> copy = values;
+    ParallelSort(pool, copy.begin(), copy.end());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,280 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "algorithms/histogram.h"
+#include "system/cpu_topology.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/mpmc_segmented_queue.h"
+#include "threads/mpsc_linked_batcher.h"
+#include "threads/mpsc_linked_queue.h"
+#include "threads/mpsc_ring_buffer.h"
+#include "threads/mpsc_ring_queue.h"
+#include "threads/spsc_ring_buffer.h"
+#include "threads/spsc_ring_queue.h"
+#include "threads/thread.h"
+#include "threads/wait_batcher.h"
+#include "threads/wait_queue.h"
+#include "threads/wait_ring.h"
+#include "time/timestamp.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t warmup_rounds = 10000;
+const uint64_t measure_rounds = 100000;
+
+// Pinned threads placement: 0 - SMT siblings of the same core, 1 - different cores of the same socket, 2 - different sockets
+const auto settings = CppBenchmark::Settings().Attempts(1).ParamRange(0, 2, [](int from, int to, int& result) { return result++; });
+
+// Select the pair of CPUs for the given placement
+bool select_cpus(int placement, int& first, int& second)
+{
+    const CPUTopology& topology = CPUTopology::Current();
+
+    if (placement == 0)
+    {
+        for (const auto& core : topology.cores())
+        {
+            if (core.count() >= 2)
+            {
+                first = core.first();
+                second = core.next(first);
+                return true;
+            }
+        }
+    }
+    else if (placement == 1)
+    {
+        for (const auto& socket : topology.sockets())
+        {
+            first = socket.first();
+            const CPULocation* location1 = topology.Find(first);
+            for (int cpu = socket.next(first); cpu >= 0; cpu = socket.next(cpu))
+            {
+                const CPULocation* location2 = topology.Find(cpu);
+                if ((location1 != nullptr) && (location2 != nullptr) && (location1->core != location2->core))
+                {
+                    second = cpu;
+                    return true;
+                }
+            }
+        }
+    }
+    else if (placement == 2)
+    {
+        if (topology.sockets().size() >= 2)
+        {
+            first = topology.sockets()[0].first();
+            second = topology.sockets()[1].first();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Queue adapter with the common push/pop interface
+template <class TQueue>
+class QueueAdapter
+{
+public:
+    template <typename... Args>
+    explicit QueueAdapter(Args&&... args) : _queue(std::forward<Args>(args)...) {}
+
+    bool Push(uint64_t item) { return _queue.Enqueue(item); }
+    bool Pop(uint64_t& item) { return _queue.Dequeue(item); }
+
+private:
+    TQueue _queue;
+};
+
+// Ring buffer adapter
+template <class TBuffer>
+class BufferAdapter
+{
+public:
+    template <typename... Args>
+    explicit BufferAdapter(Args&&... args) : _buffer(std::forward<Args>(args)...) {}
+
+    bool Push(uint64_t item) { return _buffer.Enqueue(&item, sizeof(item)); }
+    bool Pop(uint64_t& item) { size_t size = sizeof(item); return _buffer.Dequeue(&item, size); }
+
+private:
+    TBuffer _buffer;
+};
+
+// Linked batcher adapter
+class LinkedBatcherAdapter
+{
+public:
+    bool Push(uint64_t item) { return _batcher.Enqueue(item); }
+    bool Pop(uint64_t& item) { return _batcher.Dequeue([&item](uint64_t&& value) { item = value; }); }
+
+private:
+    MPSCLinkedBatcher<uint64_t> _batcher;
+};
+
+// Wait batcher adapter
+class WaitBatcherAdapter
+{
+public:
+    bool Push(uint64_t item) { return _batcher.Enqueue(item); }
+    bool Pop(uint64_t& item)
+    {
+        if (!_batcher.Dequeue(_items) || _items.empty())
+            return false;
+        item = _items.back();
+        return true;
+    }
+
+private:
+    WaitBatcher<uint64_t> _batcher;
+    std::vector<uint64_t> _items;
+};
+
+void report(CppBenchmark::Context& context, const std::string& name, const HistogramSnapshot& histogram)
+{
+    context.metrics().SetCustom(name + ".p50 (ns)", histogram.Quantile(0.5));
+    context.metrics().SetCustom(name + ".p99 (ns)", histogram.Quantile(0.99));
+    context.metrics().SetCustom(name + ".p99.9 (ns)", histogram.Quantile(0.999));
+    context.metrics().SetCustom(name + ".max (ns)", histogram.max());
+}
+
+template <class TAdapter, typename... Args>
+void ping_pong(CppBenchmark::Context& context, Args&&... args)
+{
+    const char* placements[] = { "SMT siblings", "Same socket", "Cross socket" };
+    context.metrics().SetCustom("Placement", std::string(placements[context.x()]));
+
+    int cpu1 = -1;
+    int cpu2 = -1;
+    if (!select_cpus(context.x(), cpu1, cpu2))
+    {
+        context.metrics().SetCustom("Skipped", std::string("placement is not available"));
+        return;
+    }
+
+    // Ping queue delivers timestamps to the echo thread, pong queue returns them back
+    TAdapter ping(args...);
+    TAdapter pong(args...);
+
+    HistogramSnapshot oneway;
+    HistogramSnapshot rtt;
+
+    // Start echo thread
+    auto echo = std::thread([&ping, &pong, &oneway, cpu2]()
+    {
+        Thread::SetAffinity(CPUSet({ cpu2 }));
+
+        for (uint64_t i = 0; i < warmup_rounds + measure_rounds; ++i)
+        {
+            uint64_t timestamp;
+            while (!ping.Pop(timestamp))
+                ;
+
+            // Measure one-way latency
+            if (i >= warmup_rounds)
+                oneway.Record(Timestamp::tsc() - timestamp);
+
+            while (!pong.Push(timestamp))
+                ;
+        }
+    });
+
+    // Start initiator thread
+    auto initiator = std::thread([&ping, &pong, &rtt, cpu1]()
+    {
+        Thread::SetAffinity(CPUSet({ cpu1 }));
+
+        for (uint64_t i = 0; i < warmup_rounds + measure_rounds; ++i)
+        {
+            uint64_t timestamp = Timestamp::tsc();
+            while (!ping.Push(timestamp))
+                ;
+
+            uint64_t result;
+            while (!pong.Pop(result))
+                ;
+
+            // Measure round-trip latency
+            if (i >= warmup_rounds)
+                rtt.Record(Timestamp::tsc() - timestamp);
+        }
+    });
+
+    // Wait for the initiator thread
+    initiator.join();
+
+    // Wait for the echo thread
+    echo.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(measure_rounds - 1);
+    context.metrics().AddItems(2 * measure_rounds);
+    context.metrics().SetCustom("CPUs", std::to_string(cpu1) + "/" + std::to_string(cpu2));
+    report(context, "OneWay", oneway);
+    report(context, "RTT", rtt);
+}
+
+BENCHMARK("SPSCRingQueue", settings)
+{
+    ping_pong<QueueAdapter<SPSCRingQueue<uint64_t>>>(context, 1024);
+}
+
+BENCHMARK("SPSCRingBuffer", settings)
+{
+    ping_pong<BufferAdapter<SPSCRingBuffer>>(context, 65536);
+}
+
+BENCHMARK("MPSCRingQueue", settings)
+{
+    ping_pong<QueueAdapter<MPSCRingQueue<uint64_t>>>(context, 1024, 1);
+}
+
+BENCHMARK("MPSCRingBuffer", settings)
+{
+    ping_pong<BufferAdapter<MPSCRingBuffer>>(context, 65536, 1);
+}
+
+BENCHMARK("MPSCLinkedQueue", settings)
+{
+    ping_pong<QueueAdapter<MPSCLinkedQueue<uint64_t>>>(context);
+}
+
+BENCHMARK("MPSCLinkedBatcher", settings)
+{
+    ping_pong<LinkedBatcherAdapter>(context);
+}
+
+BENCHMARK("MPMCRingQueue", settings)
+{
+    ping_pong<QueueAdapter<MPMCRingQueue<uint64_t>>>(context, 1024);
+}
+
+BENCHMARK("MPMCSegmentedQueue", settings)
+{
+    ping_pong<QueueAdapter<MPMCSegmentedQueue<uint64_t>>>(context);
+}
+
+BENCHMARK("WaitQueue", settings)
+{
+    ping_pong<QueueAdapter<WaitQueue<uint64_t>>>(context);
+}
+
+BENCHMARK("WaitRing", settings)
+{
+    ping_pong<QueueAdapter<WaitRing<uint64_t>>>(context, 1024);
+}
+
+BENCHMARK("WaitBatcher", settings)
+{
+    ping_pong<WaitBatcherAdapter>(context);
+}
+
+BENCHMARK_MAIN()
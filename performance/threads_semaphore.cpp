@@ -6,6 +6,7 @@
 
 #include "threads/semaphore.h"
 
+#include <semaphore>
 #include <thread>
 #include <vector>
 
@@ -19,6 +20,20 @@ const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(semaphore_from, semaphore_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+// Standard counting semaphore adaptor used as a baseline
+class StdSemaphore
+{
+public:
+    explicit StdSemaphore(int resources) : _semaphore(resources) {}
+
+    void Lock() { _semaphore.acquire(); }
+    void Unlock() { _semaphore.release(); }
+
+private:
+    std::counting_semaphore<> _semaphore;
+};
+
+template <class TSemaphore>
 void produce(CppBenchmark::Context& context)
 {
     const int semaphore_count = context.x();
@@ -26,7 +41,7 @@ void produce(CppBenchmark::Context& context)
     uint64_t crc = 0;
 
     // Create semaphore synchronization primitive
-    Semaphore lock(semaphore_count);
+    TSemaphore lock(semaphore_count);
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -37,7 +52,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<Semaphore> locker(lock);
+                Locker<TSemaphore> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -54,7 +69,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("Semaphore", settings)
 {
-    produce(context);
+    produce<Semaphore>(context);
+}
+
+BENCHMARK("std::counting_semaphore", settings)
+{
+    produce<StdSemaphore>(context);
 }
 
 BENCHMARK_MAIN()
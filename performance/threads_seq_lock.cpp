@@ -4,6 +4,7 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/multi_seq_lock.h"
 #include "threads/seq_lock.h"
 #include "threads/thread.h"
 
@@ -13,6 +14,7 @@
 using namespace CppCommon;
 
 const uint64_t items_to_produce = 100000000;
+const uint64_t books_to_produce = 1000000;
 const int readers_from = 1;
 const int readers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
@@ -24,6 +26,12 @@ struct Data
     uint64_t c;
 };
 
+struct Book
+{
+    uint64_t version;
+    uint64_t levels[255];
+};
+
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
@@ -70,9 +78,70 @@ void produce(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC-Writer", writer_crc);
 }
 
+template <class TLock, class TReader>
+void produce_book(CppBenchmark::Context& context, const TReader& reader)
+{
+    const int readers_count = context.x();
+    uint64_t writer_crc = 0;
+
+    // Create sequential lock synchronization primitive
+    TLock lock;
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader_index = 0; reader_index < readers_count; ++reader_index)
+    {
+        readers.emplace_back([&lock, &reader]()
+        {
+            for (;;)
+            {
+                // Read the top of the book
+                if (reader(lock) == books_to_produce)
+                    return;
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Start writer threads
+    std::thread writer = std::thread([&lock, &writer_crc]()
+    {
+        Book book = {};
+        for (uint64_t i = 0; i <= books_to_produce; ++i)
+        {
+            book.version = i;
+            book.levels[0] = i;
+            lock.Write(book);
+            writer_crc += i;
+        }
+    });
+
+    // Wait for all readers threads
+    for (auto& reader_thread : readers)
+        reader_thread.join();
+
+    // Wait for the writer thread
+    writer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(books_to_produce - 1);
+    context.metrics().AddBytes(books_to_produce * sizeof(Book));
+    context.metrics().SetCustom("CRC-Writer", writer_crc);
+}
+
 BENCHMARK("SeqLock", settings)
 {
     produce(context);
 }
 
+BENCHMARK("SeqLock<Book>-Read", settings)
+{
+    produce_book<SeqLock<Book>>(context, [](const SeqLock<Book>& lock) { return lock.Read().levels[0]; });
+}
+
+BENCHMARK("MultiSeqLock<Book>-Visit", settings)
+{
+    produce_book<MultiSeqLock<Book>>(context, [](const MultiSeqLock<Book>& lock) { return lock.Visit([](const Book& book) { return book.levels[0]; }); });
+}
+
 BENCHMARK_MAIN()
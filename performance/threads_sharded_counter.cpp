@@ -0,0 +1,61 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/sharded_counter.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+uint64_t counter_value(const std::atomic<uint64_t>& counter) { return counter.load(); }
+uint64_t counter_value(const ShardedCounter& counter) { return counter.value(); }
+
+template <class TCounter>
+void produce(CppBenchmark::Context& context)
+{
+    const int threads_count = context.x();
+
+    TCounter counter;
+
+    // Start incrementing threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&counter, threads_count]()
+        {
+            uint64_t items = (items_to_produce / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+                ++counter;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce);
+    context.metrics().SetCustom("Value", counter_value(counter));
+}
+
+BENCHMARK("std::atomic-threads", settings)
+{
+    produce<std::atomic<uint64_t>>(context);
+}
+
+BENCHMARK("ShardedCounter-threads", settings)
+{
+    produce<ShardedCounter>(context);
+}
+
+BENCHMARK_MAIN()
@@ -82,6 +82,70 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<uint64_t N>
+void produce_consume_zero_copy(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int item_size = context.x();
+    const uint64_t items_to_produce = bytes_to_produce / item_size;
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring buffer
+    SPSCRingBuffer buffer(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Peek using the given waiting strategy
+            std::span<const uint8_t> items;
+            while ((items = buffer.Peek()).empty())
+                wait_strategy();
+
+            // Emulate consuming in place
+            for (uint64_t j = 0; j < items.size(); ++j)
+                crc += items[j];
+
+            // Release consumed items and increase the items counter
+            buffer.Release(items.size());
+            i += items.size() / item_size;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Prepare using the given waiting strategy
+            std::span<uint8_t> item;
+            while ((item = buffer.Prepare(item_size)).empty())
+                wait_strategy();
+
+            // Emulate producing in place
+            for (int j = 0; j < item_size; ++j)
+                item[j] = (uint8_t)j;
+
+            // Commit the produced item
+            buffer.Commit(item_size);
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * item_size);
+    context.metrics().SetCustom("SPSCRingBuffer.capacity", N);
+    context.metrics().SetCustom("SPSCRingBuffer.mirrored", buffer.mirrored() ? 1 : 0);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("SPSCRingBuffer<SpinWait>", settings)
 {
     produce_consume<1048576>(context, []{});
@@ -92,4 +156,14 @@ BENCHMARK("SPSCRingBuffer<YieldWait>", settings)
     produce_consume<1048576>(context, []{ std::this_thread::yield(); });
 }
 
+BENCHMARK("SPSCRingBuffer<SpinWait, ZeroCopy>", settings)
+{
+    produce_consume_zero_copy<1048576>(context, []{});
+}
+
+BENCHMARK("SPSCRingBuffer<YieldWait, ZeroCopy>", settings)
+{
+    produce_consume_zero_copy<1048576>(context, []{ std::this_thread::yield(); });
+}
+
 BENCHMARK_MAIN()
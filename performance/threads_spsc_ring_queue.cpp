@@ -6,6 +6,7 @@
 
 #include "threads/spsc_ring_queue.h"
 
+#include <algorithm>
 #include <functional>
 #include <thread>
 
@@ -61,6 +62,112 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N, size_t B>
+void produce_consume_bulk(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring queue
+    SPSCRingQueue<T> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc]()
+    {
+        T items[B];
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Dequeue the batch using the given waiting strategy
+            size_t count;
+            while ((count = queue.DequeueBulk(items, B)) == 0)
+                wait_strategy();
+
+            // Consume the batch
+            for (size_t j = 0; j < count; ++j)
+                crc += items[j];
+            i += count;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue, &wait_strategy]()
+    {
+        T items[B];
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Prepare the batch
+            size_t batch = (size_t)std::min((uint64_t)B, items_to_produce - i);
+            for (size_t j = 0; j < batch; ++j)
+                items[j] = (T)(i + j);
+
+            // Enqueue the batch using the given waiting strategy
+            size_t offset = 0;
+            while ((offset += queue.EnqueueBulk(items + offset, items + batch)) < batch)
+                wait_strategy();
+            i += batch;
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("SPSCRingQueue.capacity", N);
+    context.metrics().SetCustom("SPSCRingQueue.batch", (uint64_t)B);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+template<typename T, uint64_t N, class TWaitStrategy>
+void produce_consume_wait(CppBenchmark::Context& context)
+{
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring queue with the given wait strategy
+    SPSCRingQueue<T, TWaitStrategy> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue with the wait strategy
+            T item;
+            queue.DequeueWait(item);
+
+            // Consume the item
+            crc += item;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Enqueue with the wait strategy
+            queue.EnqueueWait((T)i);
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("SPSCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("SPSCRingQueue<SpinWait>")
 {
     produce_consume<int, 1048576>(context, []{});
@@ -71,4 +178,19 @@ BENCHMARK("SPSCRingQueue<YieldWait>")
     produce_consume<int, 1048576>(context, []{ std::this_thread::yield(); });
 }
 
+BENCHMARK("SPSCRingQueue<YieldWaitStrategy>")
+{
+    produce_consume_wait<int, 1048576, YieldWaitStrategy>(context);
+}
+
+BENCHMARK("SPSCRingQueue<BlockingWaitStrategy>")
+{
+    produce_consume_wait<int, 1048576, BlockingWaitStrategy>(context);
+}
+
+BENCHMARK("SPSCRingQueue<SpinWait, Bulk>")
+{
+    produce_consume_bulk<int, 1048576, 64>(context, []{});
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,63 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/parallel.h"
+#include "threads/task_graph.h"
+
+#include <atomic>
+
+using namespace CppCommon;
+
+const int iterations = 1000;
+const int stages = 8;
+const int width = 64;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+BENCHMARK("TaskGraph-stages", settings)
+{
+    std::atomic<uint64_t> counter(0);
+
+    // Stages of independent tasks connected through fan-in nodes
+    ThreadPool pool(context.x());
+    TaskGraph graph;
+    size_t previous = graph.Add([]() {});
+    for (int stage = 0; stage < stages; ++stage)
+    {
+        size_t join = graph.Add([]() {});
+        for (int i = 0; i < width; ++i)
+        {
+            size_t task = graph.Add([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            graph.Precede(previous, task);
+            graph.Precede(task, join);
+        }
+        previous = join;
+    }
+
+    // The same graph is reused for all iterations
+    for (int i = 0; i < iterations; ++i)
+        graph.Run(pool);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(counter);
+}
+
+BENCHMARK("ParallelFor-stages", settings)
+{
+    std::atomic<uint64_t> counter(0);
+
+    // Stages of independent tasks separated with barriers
+    ThreadPool pool(context.x());
+    for (int i = 0; i < iterations; ++i)
+        for (int stage = 0; stage < stages; ++stage)
+            ParallelFor(pool, 0, width, [&counter](int) { counter.fetch_add(1, std::memory_order_relaxed); });
+
+    // Update benchmark metrics
+    context.metrics().AddItems(counter);
+}
+
+BENCHMARK_MAIN()
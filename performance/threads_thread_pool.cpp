@@ -0,0 +1,86 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/thread_pool.h"
+#include "threads/wait_queue.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t tasks_to_execute = 1000000;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+void FanOut(ThreadPool& pool, std::atomic<uint64_t>& counter, int depth)
+{
+    counter.fetch_add(1, std::memory_order_relaxed);
+    if (depth > 0)
+    {
+        pool.Post([&pool, &counter, depth]() { FanOut(pool, counter, depth - 1); });
+        pool.Post([&pool, &counter, depth]() { FanOut(pool, counter, depth - 1); });
+    }
+}
+
+BENCHMARK("ThreadPool-fanout", settings)
+{
+    std::atomic<uint64_t> counter(0);
+
+    // Nested fan-out of 2^20 tasks from worker threads
+    ThreadPool pool(context.x());
+    pool.Post([&pool, &counter]() { FanOut(pool, counter, 19); });
+    pool.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddItems(counter);
+}
+
+BENCHMARK("ThreadPool-external", settings)
+{
+    std::atomic<uint64_t> counter(0);
+
+    // Post tasks from the external thread
+    ThreadPool pool(context.x(), 65536);
+    for (uint64_t i = 0; i < tasks_to_execute; ++i)
+        while (!pool.Post([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); }))
+            std::this_thread::yield();
+    pool.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddItems(counter);
+}
+
+BENCHMARK("WaitQueue-external", settings)
+{
+    std::atomic<uint64_t> counter(0);
+
+    // Shared wait queue executed by the given count of threads
+    WaitQueue<std::function<void()>> queue;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < context.x(); ++i)
+    {
+        threads.emplace_back([&queue]()
+        {
+            std::function<void()> task;
+            while (queue.Dequeue(task))
+                task();
+        });
+    }
+    for (uint64_t i = 0; i < tasks_to_execute; ++i)
+        queue.Enqueue([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+    queue.Close();
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddItems(counter);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/timer_service.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+const int timers_count = 500000;
+
+BENCHMARK("TimerService-Schedule")
+{
+    TimerService service;
+    std::vector<TimerService::TimerId> timers;
+    timers.reserve(timers_count);
+
+    // Schedule timers with random deadlines far in the future
+    uint64_t seed = 0;
+    for (int i = 0; i < timers_count; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        timers.push_back(service.ScheduleAfter(Timespan::seconds(60 + (int64_t)((seed >> 33) % 3600)), []() {}));
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(timers_count);
+    context.metrics().SetCustom("Timers", (uint64_t)service.timers());
+}
+
+BENCHMARK("TimerService-ScheduleCancel")
+{
+    TimerService service;
+    std::vector<TimerService::TimerId> timers;
+    timers.reserve(timers_count);
+
+    // Schedule timers with random deadlines far in the future
+    uint64_t seed = 0;
+    for (int i = 0; i < timers_count; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        timers.push_back(service.ScheduleAfter(Timespan::seconds(60 + (int64_t)((seed >> 33) % 3600)), []() {}));
+    }
+
+    // Cancel all timers in the schedule order (typical for timeouts)
+    uint64_t cancelled = 0;
+    for (auto timer : timers)
+        cancelled += service.Cancel(timer) ? 1 : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * timers_count);
+    context.metrics().SetCustom("Cancelled", cancelled);
+}
+
+BENCHMARK("TimerService-Fire")
+{
+    TimerService service;
+    std::atomic<uint64_t> fired(0);
+
+    // Schedule timers expired within the short interval
+    for (int i = 0; i < timers_count; ++i)
+        service.ScheduleAfter(Timespan::milliseconds(i % 100), [&fired]() { fired.fetch_add(1, std::memory_order_relaxed); });
+
+    // Wait for all timers
+    while (service.timers() > 0)
+        Thread::Sleep(1);
+    service.Stop();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(timers_count);
+    context.metrics().SetCustom("Fired", fired.load());
+}
+
+BENCHMARK_MAIN()
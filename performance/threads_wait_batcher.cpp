@@ -5,6 +5,7 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "threads/wait_batcher.h"
+#include "time/timespan.h"
 
 #include <functional>
 #include <thread>
@@ -18,7 +19,7 @@ const int producers_to = 8;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
 template<typename T>
-void produce_consume(CppBenchmark::Context& context)
+void produce_consume(CppBenchmark::Context& context, size_t threshold = 0)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
@@ -27,12 +28,12 @@ void produce_consume(CppBenchmark::Context& context)
     WaitBatcher<T> batcher;
 
     // Start consumer thread
-    auto consumer = std::thread([&batcher, &crc]()
+    auto consumer = std::thread([&batcher, &crc, threshold]()
     {
         std::vector<T> items;
 
         // Dequeue items or end consume
-        while (batcher.Dequeue(items))
+        while ((threshold > 0) ? batcher.Dequeue(items, threshold, Timespan::milliseconds(1)) : batcher.Dequeue(items))
         {
             // Consume items
             for (auto item : items)
@@ -78,4 +79,9 @@ BENCHMARK("WaitBatcher-producers", settings)
     produce_consume<int>(context);
 }
 
+BENCHMARK("WaitBatcher-adaptive-producers", settings)
+{
+    produce_consume<int>(context, 1024);
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,64 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/format.h"
+#include "time/time.h"
+#include "time/time_format.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+BENCHMARK("format(UtcTime)")
+{
+    uint64_t crc = 0;
+
+    // Sequential timestamps with the step of 1 microsecond
+    Timestamp timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        Timestamp current = timestamp + Timespan::microseconds(i);
+        UtcTime time(current);
+        crc += format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:09}Z", time.year(), time.month(), time.day(), time.hour(), time.minute(), time.second(), current.total() % 1000000000).size();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("TimeFormat::FormatISO8601()")
+{
+    uint64_t crc = 0;
+
+    // Sequential timestamps with the step of 1 microsecond
+    char buffer[TimeFormat::ISO8601_SIZE];
+    Timestamp timestamp = Timestamp::utc();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += TimeFormat::FormatISO8601(timestamp + Timespan::microseconds(i), buffer, sizeof(buffer));
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("TimeFormat::ParseISO8601()")
+{
+    uint64_t crc = 0;
+
+    Timestamp timestamp;
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        TimeFormat::ParseISO8601("2021-10-01T18:19:56.123456789+05:45", timestamp);
+        crc += timestamp.total();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
@@ -58,6 +58,30 @@ BENCHMARK("NanoTimestamp()")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK("CoarseUtcTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseUtcTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CoarseNanoTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseNanoTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("RdtsTimestamp()")
 {
     uint64_t crc = 0;
@@ -70,4 +94,16 @@ BENCHMARK("RdtsTimestamp()")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK("TscTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += TscTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,61 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "time/timezone_rules.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 10000000;
+
+BENCHMARK("TimezoneRules::Find()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += (TimezoneRules::Find("America/New_York") != nullptr) ? 1 : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("TimezoneRules::Convert(UtcTimestamp)")
+{
+    auto rules = TimezoneRules::Find("America/New_York");
+    if (rules == nullptr)
+        return;
+
+    uint64_t crc = 0;
+
+    // Timestamps from 1970 to 2100 with the step about three days
+    Timestamp timestamp;
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += rules->Convert(UtcTimestamp(timestamp + Timespan::seconds((i % 16000) * 256397))).total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("TimezoneRules::Convert(LocalTimestamp)")
+{
+    auto rules = TimezoneRules::Find("America/New_York");
+    if (rules == nullptr)
+        return;
+
+    uint64_t crc = 0;
+
+    // Timestamps from 1970 to 2100 with the step about three days
+    Timestamp timestamp;
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += rules->Convert(LocalTimestamp(timestamp + Timespan::seconds((i % 16000) * 256397))).total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
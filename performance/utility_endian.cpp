@@ -0,0 +1,59 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "utility/endian.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t items = 4096;
+
+volatile uint64_t sink;
+
+BENCHMARK("Endian::ReadBigEndian() scalar loop")
+{
+    static std::vector<uint8_t> buffer(items * sizeof(uint32_t) + 1);
+    static std::vector<uint32_t> values(items);
+    for (size_t i = 0; i < items; ++i)
+        Endian::ReadBigEndian(buffer.data() + 1 + i * sizeof(uint32_t), values[i]);
+    sink = values[context.metrics().total_operations() % items];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Endian::ReadBigEndian() span")
+{
+    static std::vector<uint8_t> buffer(items * sizeof(uint32_t) + 1);
+    static std::vector<uint32_t> values(items);
+    Endian::ReadBigEndian(buffer.data() + 1, std::span<uint32_t>(values));
+    sink = values[context.metrics().total_operations() % items];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Endian::WriteBigEndian() span")
+{
+    static std::vector<uint64_t> values(items);
+    static std::vector<uint8_t> buffer(items * sizeof(uint64_t) + 1);
+    Endian::WriteBigEndian(buffer.data() + 1, std::span<const uint64_t>(values));
+    sink = buffer[context.metrics().total_operations() % buffer.size()];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Endian::ByteSwap() span")
+{
+    static std::vector<uint16_t> values(items);
+    Endian::ByteSwap(std::span<uint16_t>(values));
+    sink = values[context.metrics().total_operations() % items];
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("Endian::LoadBigEndian()")
+{
+    static uint8_t buffer[9] = { 0 };
+    sink = Endian::LoadBigEndian<uint64_t>(buffer + 1);
+}
+
+BENCHMARK_MAIN()
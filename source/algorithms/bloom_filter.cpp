@@ -0,0 +1,116 @@
+/*!
+    \file bloom_filter.cpp
+    \brief Blocked Bloom filter implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/bloom_filter.h"
+
+#include "system/cpu_dispatch.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Odd salt multipliers select a bit of each block word
+alignas(32) static const uint32_t BloomSalts[8] = { 0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du, 0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u };
+
+// Select the block with the upper 32 bits of the hash
+static inline size_t BloomBlockIndex(uint64_t hash, size_t count) noexcept
+{
+    return (size_t)(((hash >> 32) * (uint64_t)count) >> 32);
+}
+
+// Get the bit mask of the block word with the lower 32 bits of the hash
+static inline uint32_t BloomMask(uint64_t hash, size_t word) noexcept
+{
+    return 1u << (((uint32_t)hash * BloomSalts[word]) >> 27);
+}
+
+void BloomInsert(BloomBlock* blocks, size_t count, uint64_t hash) noexcept
+{
+    BloomBlock& block = blocks[BloomBlockIndex(hash, count)];
+    for (size_t i = 0; i < 8; ++i)
+    {
+        uint32_t mask = BloomMask(hash, i);
+        // Avoid the cache line write if the bit is already set
+        if ((block.words[i].load(std::memory_order_relaxed) & mask) == 0)
+            block.words[i].fetch_or(mask, std::memory_order_relaxed);
+    }
+}
+
+bool BloomContains(const BloomBlock* blocks, size_t count, uint64_t hash) noexcept
+{
+    const BloomBlock& block = blocks[BloomBlockIndex(hash, count)];
+    uint32_t missed = 0;
+    for (size_t i = 0; i < 8; ++i)
+        missed |= ~block.words[i].load(std::memory_order_relaxed) & BloomMask(hash, i);
+    return (missed == 0);
+}
+
+size_t BloomContainsManyScalar(const BloomBlock* blocks, size_t count, const uint64_t* hashes, size_t size, bool* results) noexcept
+{
+    size_t positive = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        results[i] = BloomContains(blocks, count, hashes[i]);
+        positive += results[i] ? 1 : 0;
+    }
+    return positive;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+CPU_TARGET("avx2")
+size_t BloomContainsManyAVX2(const BloomBlock* blocks, size_t count, const uint64_t* hashes, size_t size, bool* results) noexcept
+{
+    const __m256i salts = _mm256_load_si256((const __m256i*)BloomSalts);
+    const __m256i ones = _mm256_set1_epi32(1);
+
+    size_t positive = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint64_t hash = hashes[i];
+
+        // Compute the masks of all eight block words at once
+        __m256i bits = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)(uint32_t)hash), salts), 27);
+        __m256i mask = _mm256_sllv_epi32(ones, bits);
+
+        // Block words are only ever set, so the plain vector load observes a valid state
+        __m256i block = _mm256_load_si256((const __m256i*)&blocks[BloomBlockIndex(hash, count)]);
+
+        bool result = (_mm256_testc_si256(block, mask) != 0);
+        results[i] = result;
+        positive += result ? 1 : 0;
+    }
+    return positive;
+}
+
+#endif
+
+size_t BloomContainsMany(const BloomBlock* blocks, size_t count, const uint64_t* hashes, size_t size, bool* results) noexcept
+{
+    static CPUDispatch<size_t(const BloomBlock*, size_t, const uint64_t*, size_t, bool*)> contains([]([[maybe_unused]] const CPUFeatures& features)
+    {
+        size_t (*function)(const BloomBlock*, size_t, const uint64_t*, size_t, bool*) = BloomContainsManyScalar;
+#if defined(__x86_64__) || defined(_M_X64)
+        if (features.avx2)
+            function = BloomContainsManyAVX2;
+#endif
+        return function;
+    });
+
+    return contains(blocks, count, hashes, size, results);
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
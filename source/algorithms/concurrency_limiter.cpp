@@ -0,0 +1,60 @@
+/*!
+    \file concurrency_limiter.cpp
+    \brief Adaptive concurrency limiter implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/concurrency_limiter.h"
+
+#include <cmath>
+
+namespace CppCommon {
+
+void ConcurrencyLimiter::Release(const Timespan& latency, bool dropped) noexcept
+{
+    uint64_t inflight = _inflight.fetch_sub(1, std::memory_order_release);
+    assert((inflight > 0) && "Concurrency limiter slot was released without acquire!");
+
+    uint64_t sample = (latency.total() > 0) ? (uint64_t)latency.total() : 0;
+
+    // Track the minimal observed latency
+    uint64_t minimal = _min_latency.load(std::memory_order_relaxed);
+    while ((sample < minimal) && !_min_latency.compare_exchange_weak(minimal, sample, std::memory_order_relaxed, std::memory_order_relaxed));
+
+    // Backoff on overload
+    if (dropped)
+    {
+        Update([](double limit) { return limit * 0.9; });
+        return;
+    }
+
+    // Do not grow the limit while the limiter is not saturated
+    bool saturated = ((2 * inflight) >= (uint64_t)_limit.load(std::memory_order_relaxed));
+
+    if (_algorithm == ConcurrencyLimiterAlgorithm::AIMD)
+    {
+        if (sample > _threshold)
+            Update([](double limit) { return limit * 0.9; });
+        else if (saturated)
+            Update([](double limit) { return limit + 1.0 / limit; });
+    }
+    else
+    {
+        // Latency within the tolerance never decreases the limit
+        uint64_t base = std::max(_min_latency.load(std::memory_order_relaxed), _threshold);
+        double gradient = (sample > 0) ? std::clamp((double)base / (double)sample, 0.5, 1.0) : 1.0;
+        if ((gradient < 1.0) || saturated)
+        {
+            Update([gradient](double limit)
+            {
+                // Smooth the new limit which allows the queue of square root of the limit
+                double target = limit * gradient + std::sqrt(limit);
+                return limit * 0.8 + target * 0.2;
+            });
+        }
+    }
+}
+
+} // namespace CppCommon
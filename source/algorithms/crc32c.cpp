@@ -0,0 +1,121 @@
+/*!
+    \file crc32c.cpp
+    \brief CRC32C checksum algorithm implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/crc32c.h"
+
+#include "system/cpu_dispatch.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Slicing-by-8 tables of the reflected Castagnoli polynomial
+struct CRC32CTables
+{
+    uint32_t table[8][256];
+
+    CRC32CTables() noexcept
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; ++j)
+                crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78 : 0);
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i)
+            for (int j = 1; j < 8; ++j)
+                table[j][i] = (table[j - 1][i] >> 8) ^ table[0][table[j - 1][i] & 0xFF];
+    }
+};
+
+uint32_t CRC32CScalar(uint32_t crc, const uint8_t* data, size_t size)
+{
+    static const CRC32CTables tables;
+    const auto& t = tables.table;
+
+    while (size >= 8)
+    {
+        uint32_t low = crc ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^ t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+        data += 8;
+        size -= 8;
+    }
+    while (size-- > 0)
+        crc = t[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+CPU_TARGET("sse4.2")
+uint32_t CRC32CSSE42(uint32_t crc, const uint8_t* data, size_t size)
+{
+    uint64_t crc64 = crc;
+    while (size >= 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+    crc = (uint32_t)crc64;
+    while (size-- > 0)
+        crc = _mm_crc32_u8(crc, *data++);
+    return crc;
+}
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+uint32_t CRC32CARM(uint32_t crc, const uint8_t* data, size_t size)
+{
+    while (size >= 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+        data += 8;
+        size -= 8;
+    }
+    while (size-- > 0)
+        crc = __crc32cb(crc, *data++);
+    return crc;
+}
+#endif
+
+typedef uint32_t (*CRC32CFunction)(uint32_t, const uint8_t*, size_t);
+
+CRC32CFunction ResolveCRC32C([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.sse42)
+        return CRC32CSSE42;
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    if (features.crc32)
+        return CRC32CARM;
+#endif
+    return CRC32CScalar;
+}
+
+} // namespace Internals
+//! @endcond
+
+uint32_t CRC32C::Compute(const void* buffer, size_t size, uint32_t crc) noexcept
+{
+    static CPUDispatch<uint32_t(uint32_t, const uint8_t*, size_t)> dispatch(Internals::ResolveCRC32C);
+    return ~dispatch(~crc, (const uint8_t*)buffer, size);
+}
+
+} // namespace CppCommon
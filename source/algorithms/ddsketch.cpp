@@ -0,0 +1,142 @@
+/*!
+    \file ddsketch.cpp
+    \brief DDSketch quantile estimator implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/ddsketch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CppCommon {
+
+DDSketch::DDSketch(double accuracy, size_t bins)
+    : _accuracy(accuracy),
+      _gamma((1.0 + accuracy) / (1.0 - accuracy)),
+      _log_gamma(std::log(_gamma)),
+      _max_bins(bins),
+      _offset(0),
+      _zero(0),
+      _count(0),
+      _sum(0.0),
+      _min(std::numeric_limits<double>::max()),
+      _max(0.0)
+{
+    assert(((accuracy > 0.0) && (accuracy < 1.0)) && "DDSketch accuracy must be in range (0, 1)!");
+    assert((bins > 0) && "DDSketch must have at least one bin!");
+}
+
+int64_t DDSketch::Key(double value) const noexcept
+{
+    return (int64_t)std::ceil(std::log(value) / _log_gamma);
+}
+
+double DDSketch::Value(int64_t key) const noexcept
+{
+    // Value with the minimal relative error for all values of the bin (gamma^(key-1), gamma^key]
+    return 2.0 * std::pow(_gamma, (double)key) / (_gamma + 1.0);
+}
+
+void DDSketch::AddBin(int64_t key, uint64_t count)
+{
+    if (_bins.empty())
+    {
+        _offset = key;
+        _bins.push_back(count);
+        return;
+    }
+
+    int64_t low = std::min(_offset, key);
+    int64_t high = std::max(_offset + (int64_t)_bins.size() - 1, key);
+
+    // Collapse the lowest bins to keep the count of bins bounded
+    if ((high - low + 1) > (int64_t)_max_bins)
+        low = high - (int64_t)_max_bins + 1;
+
+    if (low != _offset)
+    {
+        // Rebuild bins with the new lowest key
+        std::vector<uint64_t> bins((size_t)(high - low + 1), 0);
+        for (size_t i = 0; i < _bins.size(); ++i)
+            bins[(size_t)(std::max(_offset + (int64_t)i, low) - low)] += _bins[i];
+        _bins.swap(bins);
+        _offset = low;
+    }
+    else if (high >= (_offset + (int64_t)_bins.size()))
+        _bins.resize((size_t)(high - low + 1), 0);
+
+    _bins[(size_t)(std::max(key, low) - low)] += count;
+}
+
+void DDSketch::Add(double value, uint64_t count)
+{
+    assert((value >= 0.0) && "DDSketch values must be non-negative!");
+    if (!(value >= 0.0) || (count == 0))
+        return;
+
+    // Values too small for the logarithmic bins are counted as zeros
+    if (value < std::numeric_limits<double>::min())
+        _zero += count;
+    else
+        AddBin(Key(value), count);
+
+    _count += count;
+    _sum += value * (double)count;
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+}
+
+double DDSketch::Quantile(double quantile) const noexcept
+{
+    if (_count == 0)
+        return 0.0;
+
+    // Zero-based rank of the value at the given quantile
+    double rank = std::clamp(quantile, 0.0, 1.0) * (double)(_count - 1);
+
+    uint64_t cumulative = _zero;
+    if ((double)cumulative > rank)
+        return 0.0;
+
+    for (size_t i = 0; i < _bins.size(); ++i)
+    {
+        cumulative += _bins[i];
+        if ((double)cumulative > rank)
+            return std::clamp(Value(_offset + (int64_t)i), _min, _max);
+    }
+
+    return _max;
+}
+
+void DDSketch::Merge(const DDSketch& sketch)
+{
+    assert((_gamma == sketch._gamma) && "DDSketch sketches must have the same accuracy to merge!");
+    if ((_gamma != sketch._gamma) || (sketch._count == 0))
+        return;
+
+    for (size_t i = 0; i < sketch._bins.size(); ++i)
+        if (sketch._bins[i] > 0)
+            AddBin(sketch._offset + (int64_t)i, sketch._bins[i]);
+
+    _zero += sketch._zero;
+    _count += sketch._count;
+    _sum += sketch._sum;
+    _min = std::min(_min, sketch._min);
+    _max = std::max(_max, sketch._max);
+}
+
+void DDSketch::Clear() noexcept
+{
+    _bins.clear();
+    _offset = 0;
+    _zero = 0;
+    _count = 0;
+    _sum = 0.0;
+    _min = std::numeric_limits<double>::max();
+    _max = 0.0;
+}
+
+} // namespace CppCommon
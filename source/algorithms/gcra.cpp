@@ -0,0 +1,44 @@
+/*!
+    \file gcra.cpp
+    \brief Generic cell rate limit algorithm implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/gcra.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CppCommon {
+
+Timespan GCRA::TryConsume(uint64_t requests, uint64_t now)
+{
+    // Requested count will never fit into the burst tolerance
+    if ((_interval > 0) && (requests > (_tolerance / _interval)))
+        return Timespan(std::numeric_limits<int64_t>::max());
+
+    uint64_t increment = requests * _interval;
+    uint64_t tat = _tat.load(std::memory_order_relaxed);
+
+    // Lock-free update loop
+    for (;;)
+    {
+        // Theoretical arrival time in the past means the limiter is idle
+        uint64_t newTat = std::max(tat, now) + increment;
+
+        // Theoretical arrival time is too far ahead... Return the time until requests will be allowed.
+        uint64_t allowAt = newTat - _tolerance;
+        if ((newTat > _tolerance) && (allowAt > now))
+            return Timespan((int64_t)std::min(allowAt - now, (uint64_t)std::numeric_limits<int64_t>::max()));
+
+        // Try to update the theoretical arrival time atomically
+        if (_tat.compare_exchange_weak(tat, newTat, std::memory_order_relaxed, std::memory_order_relaxed))
+            return Timespan::zero();
+
+        // Failed... Then retry with a new theoretical arrival time
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,139 @@
+/*!
+    \file histogram.cpp
+    \brief Log-linear histogram implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CppCommon {
+
+HistogramSnapshot::HistogramSnapshot(size_t precision)
+    : _precision(precision), _counts(Buckets(precision), 0), _count(0), _sum(0)
+{
+    assert(((precision >= Histogram::MIN_PRECISION) && (precision <= Histogram::MAX_PRECISION)) && "Histogram precision must be in range [1, 10]!");
+}
+
+uint64_t HistogramSnapshot::min() const noexcept
+{
+    for (size_t i = 0; i < _counts.size(); ++i)
+        if (_counts[i] > 0)
+            return LowerBound(i, _precision);
+    return 0;
+}
+
+uint64_t HistogramSnapshot::max() const noexcept
+{
+    for (size_t i = _counts.size(); i-- > 0;)
+        if (_counts[i] > 0)
+            return UpperBound(i, _precision);
+    return 0;
+}
+
+uint64_t HistogramSnapshot::Quantile(double quantile) const noexcept
+{
+    if (_count == 0)
+        return 0;
+
+    // Rank of the value at the given quantile
+    uint64_t rank = (uint64_t)std::ceil(std::clamp(quantile, 0.0, 1.0) * (double)_count);
+    rank = std::clamp(rank, (uint64_t)1, _count);
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < _counts.size(); ++i)
+    {
+        cumulative += _counts[i];
+        if (cumulative >= rank)
+            return UpperBound(i, _precision);
+    }
+
+    return max();
+}
+
+void HistogramSnapshot::Merge(const HistogramSnapshot& snapshot) noexcept
+{
+    assert((_precision == snapshot._precision) && "Histogram snapshots must have the same precision to merge!");
+    if (_precision != snapshot._precision)
+        return;
+
+    for (size_t i = 0; i < _counts.size(); ++i)
+        _counts[i] += snapshot._counts[i];
+    _count += snapshot._count;
+    _sum += snapshot._sum;
+}
+
+void HistogramSnapshot::Subtract(const HistogramSnapshot& snapshot) noexcept
+{
+    assert((_precision == snapshot._precision) && "Histogram snapshots must have the same precision to subtract!");
+    if (_precision != snapshot._precision)
+        return;
+
+    // Counters of the earlier snapshot are never greater, but concurrent records might be observed partially
+    _count = 0;
+    for (size_t i = 0; i < _counts.size(); ++i)
+    {
+        _counts[i] = (_counts[i] > snapshot._counts[i]) ? (_counts[i] - snapshot._counts[i]) : 0;
+        _count += _counts[i];
+    }
+    _sum = (_sum > snapshot._sum) ? (_sum - snapshot._sum) : 0;
+}
+
+void HistogramSnapshot::Clear() noexcept
+{
+    std::fill(_counts.begin(), _counts.end(), 0);
+    _count = 0;
+    _sum = 0;
+}
+
+Histogram::Histogram(size_t precision, size_t shards)
+    : _precision(precision), _buckets(HistogramSnapshot::Buckets(precision))
+{
+    assert(((precision >= MIN_PRECISION) && (precision <= MAX_PRECISION)) && "Histogram precision must be in range [1, 10]!");
+
+    if (shards == 0)
+        shards = (size_t)std::max(CPU::LogicalCores(), 1);
+
+    // Round up the count of shards to the power of two
+    size_t count = 1;
+    while (count < shards)
+        count <<= 1;
+    _mask = count - 1;
+
+    // Each shard keeps bucket counters and the sum, rounded up to separate cache lines
+    _stride = ((_buckets + 1 + 15) / 16) * 16;
+
+    _counters = std::make_unique<std::atomic<uint64_t>[]>(count * _stride);
+    Reset();
+}
+
+HistogramSnapshot Histogram::Snapshot() const
+{
+    HistogramSnapshot snapshot(_precision);
+
+    for (size_t shard = 0; shard <= _mask; ++shard)
+    {
+        const std::atomic<uint64_t>* counters = &_counters[shard * _stride];
+        for (size_t i = 0; i < _buckets; ++i)
+        {
+            uint64_t count = counters[i].load(std::memory_order_relaxed);
+            snapshot._counts[i] += count;
+            snapshot._count += count;
+        }
+        snapshot._sum += counters[_buckets].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+void Histogram::Reset() noexcept
+{
+    for (size_t i = 0; i < ((_mask + 1) * _stride); ++i)
+        _counters[i].store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
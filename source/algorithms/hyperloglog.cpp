@@ -0,0 +1,77 @@
+/*!
+    \file hyperloglog.cpp
+    \brief HyperLogLog cardinality estimator implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/hyperloglog.h"
+
+#include <bit>
+#include <cmath>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+void HyperLogLogAdd(std::atomic<uint8_t>* registers, size_t precision, uint64_t hash) noexcept
+{
+    // Upper bits select the register
+    size_t index = (size_t)(hash >> (64 - precision));
+
+    // Rank is the position of the first set bit in the remaining bits
+    uint64_t remaining = (hash << precision) | ((uint64_t)1 << (precision - 1));
+    uint8_t rank = (uint8_t)(std::countl_zero(remaining) + 1);
+
+    // Atomic maximum
+    uint8_t current = registers[index].load(std::memory_order_relaxed);
+    while ((rank > current) && !registers[index].compare_exchange_weak(current, rank, std::memory_order_relaxed, std::memory_order_relaxed));
+}
+
+double HyperLogLogEstimate(const std::atomic<uint8_t>* registers, size_t precision) noexcept
+{
+    size_t count = (size_t)1 << precision;
+    double m = (double)count;
+
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t value = registers[i].load(std::memory_order_relaxed);
+        sum += std::ldexp(1.0, -(int)value);
+        zeros += (value == 0) ? 1 : 0;
+    }
+
+    // Bias correction constant
+    double alpha;
+    switch (count)
+    {
+        case 16:
+            alpha = 0.673;
+            break;
+        case 32:
+            alpha = 0.697;
+            break;
+        case 64:
+            alpha = 0.709;
+            break;
+        default:
+            alpha = 0.7213 / (1.0 + 1.079 / m);
+            break;
+    }
+
+    double estimate = alpha * m * m / sum;
+
+    // Small range correction with linear counting
+    if ((estimate <= (2.5 * m)) && (zeros > 0))
+        estimate = m * std::log(m / (double)zeros);
+
+    return estimate;
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
@@ -0,0 +1,247 @@
+/*!
+    \file lz4.cpp
+    \brief LZ4 block compression algorithm implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/lz4.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const size_t LZ4_MINMATCH = 4;
+const size_t LZ4_LASTLITERALS = 5;
+const size_t LZ4_MFLIMIT = 12;
+const size_t LZ4_DISTANCE = 65535;
+const size_t LZ4_HASH_LOG = 12;
+
+inline uint32_t LZ4Read32(const uint8_t* ptr) noexcept
+{
+    uint32_t result;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+inline uint32_t LZ4Hash(uint32_t sequence) noexcept
+{
+    return (sequence * 2654435761u) >> (32 - LZ4_HASH_LOG);
+}
+
+inline uint8_t* LZ4WriteLength(uint8_t* op, size_t length) noexcept
+{
+    for (; length >= 255; length -= 255)
+        *op++ = 255;
+    *op++ = (uint8_t)length;
+    return op;
+}
+
+// Emit the sequence of literals and the optional match
+inline bool LZ4Emit(uint8_t*& op, uint8_t* oend, const uint8_t* literals, size_t count, size_t offset, size_t match) noexcept
+{
+    // Check the worst case size of the sequence
+    if ((size_t)(oend - op) < (1 + (count / 255) + 1 + count + 2 + (match / 255) + 1))
+        return false;
+
+    uint8_t* token = op++;
+    *token = (uint8_t)((std::min(count, (size_t)15)) << 4);
+    if (count >= 15)
+        op = LZ4WriteLength(op, count - 15);
+    std::memcpy(op, literals, count);
+    op += count;
+
+    if (match == 0)
+        return true;
+
+    *op++ = (uint8_t)(offset & 0xFF);
+    *op++ = (uint8_t)(offset >> 8);
+
+    size_t length = match - LZ4_MINMATCH;
+    *token |= (uint8_t)std::min(length, (size_t)15);
+    if (length >= 15)
+        op = LZ4WriteLength(op, length - 15);
+    return true;
+}
+
+// Compress the range [start, end) of the buffer, where [0, start) is the dictionary prefix
+size_t LZ4CompressInternal(const uint8_t* base, size_t start, size_t end, uint8_t* destination, size_t capacity)
+{
+    uint32_t table[1 << LZ4_HASH_LOG] = {};
+
+    // Prefill the hash table with dictionary positions
+    for (size_t p = 0; (p + LZ4_MINMATCH) <= start; ++p)
+        table[LZ4Hash(LZ4Read32(base + p))] = (uint32_t)p;
+
+    uint8_t* op = destination;
+    uint8_t* oend = destination + capacity;
+    size_t anchor = start;
+    size_t ip = start;
+
+    if ((end - start) > LZ4_MFLIMIT)
+    {
+        size_t mflimit = end - LZ4_MFLIMIT;
+        size_t matchlimit = end - LZ4_LASTLITERALS;
+
+        while (ip < mflimit)
+        {
+            uint32_t sequence = LZ4Read32(base + ip);
+            uint32_t hash = LZ4Hash(sequence);
+            size_t ref = table[hash];
+            table[hash] = (uint32_t)ip;
+
+            // Skip faster over incompressible data
+            if ((ref >= ip) || ((ip - ref) > LZ4_DISTANCE) || (LZ4Read32(base + ref) != sequence))
+            {
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            // Extend the match backward and forward
+            while ((ip > anchor) && (ref > 0) && (base[ip - 1] == base[ref - 1]))
+            {
+                --ip;
+                --ref;
+            }
+            size_t match = LZ4_MINMATCH;
+            while (((ip + match) < matchlimit) && (base[ip + match] == base[ref + match]))
+                ++match;
+
+            if (!LZ4Emit(op, oend, base + anchor, ip - anchor, ip - ref, match))
+                return 0;
+
+            ip += match;
+            anchor = ip;
+
+            // Index the position inside the match
+            if (ip < mflimit)
+                table[LZ4Hash(LZ4Read32(base + ip - 2))] = (uint32_t)(ip - 2);
+        }
+    }
+
+    // Emit last literals
+    if (!LZ4Emit(op, oend, base + anchor, end - anchor, 0, 0))
+        return 0;
+
+    return (size_t)(op - destination);
+}
+
+} // namespace Internals
+//! @endcond
+
+size_t LZ4::Compress(const void* source, size_t size, void* destination, size_t capacity, const void* dictionary, size_t dictionary_size)
+{
+    // Use only the last window of the dictionary
+    if (dictionary_size > Internals::LZ4_DISTANCE)
+    {
+        dictionary = (const uint8_t*)dictionary + (dictionary_size - Internals::LZ4_DISTANCE);
+        dictionary_size = Internals::LZ4_DISTANCE;
+    }
+
+    if ((dictionary == nullptr) || (dictionary_size == 0))
+        return Internals::LZ4CompressInternal((const uint8_t*)source, 0, size, (uint8_t*)destination, capacity);
+
+    // Concatenate the dictionary and the source buffer
+    std::vector<uint8_t> buffer(dictionary_size + size);
+    std::memcpy(buffer.data(), dictionary, dictionary_size);
+    if (size > 0)
+        std::memcpy(buffer.data() + dictionary_size, source, size);
+    return Internals::LZ4CompressInternal(buffer.data(), dictionary_size, buffer.size(), (uint8_t*)destination, capacity);
+}
+
+size_t LZ4::Decompress(const void* source, size_t size, void* destination, size_t capacity, const void* dictionary, size_t dictionary_size) noexcept
+{
+    const uint8_t* ip = (const uint8_t*)source;
+    const uint8_t* iend = ip + size;
+    uint8_t* dst = (uint8_t*)destination;
+    size_t op = 0;
+
+    if (dictionary_size > Internals::LZ4_DISTANCE)
+    {
+        dictionary = (const uint8_t*)dictionary + (dictionary_size - Internals::LZ4_DISTANCE);
+        dictionary_size = Internals::LZ4_DISTANCE;
+    }
+    const uint8_t* dict = (const uint8_t*)dictionary;
+
+    while (ip < iend)
+    {
+        uint8_t token = *ip++;
+
+        // Copy literals
+        size_t count = token >> 4;
+        if (count == 15)
+        {
+            uint8_t byte;
+            do
+            {
+                if (ip >= iend)
+                    return SIZE_MAX;
+                byte = *ip++;
+                count += byte;
+            } while (byte == 255);
+        }
+        if (((size_t)(iend - ip) < count) || ((capacity - op) < count))
+            return SIZE_MAX;
+        std::memcpy(dst + op, ip, count);
+        ip += count;
+        op += count;
+
+        // The last sequence has no match
+        if (ip == iend)
+            break;
+
+        if ((iend - ip) < 2)
+            return SIZE_MAX;
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0)
+            return SIZE_MAX;
+
+        size_t match = token & 15;
+        if (match == 15)
+        {
+            uint8_t byte;
+            do
+            {
+                if (ip >= iend)
+                    return SIZE_MAX;
+                byte = *ip++;
+                match += byte;
+            } while (byte == 255);
+        }
+        match += Internals::LZ4_MINMATCH;
+        if ((capacity - op) < match)
+            return SIZE_MAX;
+
+        // Copy the part of the match from the dictionary
+        if (offset > op)
+        {
+            size_t back = offset - op;
+            if (back > dictionary_size)
+                return SIZE_MAX;
+            size_t part = std::min(back, match);
+            std::memcpy(dst + op, dict + dictionary_size - back, part);
+            op += part;
+            match -= part;
+            offset = op;
+        }
+
+        // Copy the match (could overlap with the output)
+        if (offset >= match)
+            std::memcpy(dst + op, dst + op - offset, match);
+        else
+            for (size_t i = 0; i < match; ++i)
+                dst[op + i] = dst[op + i - offset];
+        op += match;
+    }
+
+    return op;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,97 @@
+/*!
+    \file sliding_window.cpp
+    \brief Sliding window rate limit algorithm implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "algorithms/sliding_window.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace CppCommon {
+
+// Sliding window state layout: window number (32 bits), previous window counter (16 bits), current window counter (16 bits)
+uint64_t SlidingWindow::Actualize(uint64_t state, uint64_t number) noexcept
+{
+    uint32_t stored = (uint32_t)(state >> 32);
+    uint32_t actual = (uint32_t)number;
+
+    // Same window
+    if (stored == actual)
+        return state;
+
+    // Next window... The current counter becomes the previous one.
+    if ((uint32_t)(stored + 1) == actual)
+        return (((uint64_t)actual) << 32) | ((state & 0xFFFF) << 16);
+
+    // Both windows are expired
+    return (((uint64_t)actual) << 32);
+}
+
+uint64_t SlidingWindow::Estimate(uint64_t state, uint64_t elapsed) const noexcept
+{
+    uint64_t previous = (state >> 16) & 0xFFFF;
+    uint64_t current = state & 0xFFFF;
+
+    // Weight the previous window counter with its overlap with the sliding window
+    return current + (uint64_t)((double)previous * ((double)(_window - elapsed) / (double)_window));
+}
+
+uint64_t SlidingWindow::Count(uint64_t now) const noexcept
+{
+    uint64_t state = Actualize(_state.load(std::memory_order_relaxed), now / _window);
+    return Estimate(state, now % _window);
+}
+
+Timespan SlidingWindow::TryConsume(uint64_t requests, uint64_t now)
+{
+    // Requested count will never fit into the window
+    if (requests > _limit)
+        return Timespan(std::numeric_limits<int64_t>::max());
+
+    uint64_t number = now / _window;
+    uint64_t elapsed = now % _window;
+    uint64_t oldState = _state.load(std::memory_order_relaxed);
+
+    // Lock-free update loop
+    for (;;)
+    {
+        uint64_t state = Actualize(oldState, number);
+
+        if ((Estimate(state, elapsed) + requests) > _limit)
+        {
+            double previous = (double)((state >> 16) & 0xFFFF);
+            double current = (double)(state & 0xFFFF);
+            double window = (double)_window;
+            double remaining = (double)(_window - elapsed);
+            double room = (double)_limit - current - (double)requests;
+
+            double wait;
+            if (room >= 0)
+            {
+                // Wait until the previous window overlap decays enough in the current window
+                wait = std::ceil(remaining - room * window / previous);
+            }
+            else
+            {
+                // Wait until the next window and the current window overlap decays enough
+                double next = std::ceil(window - ((double)_limit - (double)requests) * window / current);
+                wait = remaining + std::max(next, 0.0);
+            }
+
+            return Timespan((int64_t)std::max(wait, 1.0));
+        }
+
+        // Try to update the state atomically
+        if (_state.compare_exchange_weak(oldState, state + requests, std::memory_order_relaxed, std::memory_order_relaxed))
+            return Timespan::zero();
+
+        // Failed... Then retry with a new state value
+    }
+}
+
+} // namespace CppCommon
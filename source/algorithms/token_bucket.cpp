@@ -10,37 +10,83 @@
 
 #include "time/timestamp.h"
 
+#include <algorithm>
+
 namespace CppCommon {
 
-bool TokenBucket::Consume(uint64_t tokens)
+//! @cond INTERNALS
+namespace Internals {
+
+uint64_t TokenBucketNow(TokenBucketClock clock)
 {
-    uint64_t now = Timestamp::nano();
-    uint64_t delay = tokens * _time_per_token.load(std::memory_order_relaxed);
-    uint64_t minTime = now - _time_per_burst.load(std::memory_order_relaxed);
-    uint64_t oldTime = _time.load(std::memory_order_relaxed);
-    uint64_t newTime = oldTime;
+    switch (clock)
+    {
+        case TokenBucketClock::Nano:
+            return Timestamp::nano();
+        case TokenBucketClock::CoarseNano:
+            return Timestamp::coarse_nano();
+        default:
+            return Timestamp::tsc();
+    }
+}
 
-    // Previous consume performed long time ago... Shift the new time to the start of a new burst.
-    if (minTime > oldTime)
-        newTime = minTime;
+uint64_t TokenBucketConsume(std::atomic<uint64_t>& time, uint64_t time_per_token, uint64_t time_per_burst, uint64_t tokens, uint64_t now) noexcept
+{
+    // Requested tokens will never fit into the bucket
+    if ((time_per_token > 0) && (tokens > (time_per_burst / time_per_token)))
+        return std::numeric_limits<uint64_t>::max();
+
+    uint64_t delay = tokens * time_per_token;
+    uint64_t minTime = (now > time_per_burst) ? (now - time_per_burst) : 0;
+    uint64_t oldTime = time.load(std::memory_order_relaxed);
 
     // Lock-free token consume loop
     for (;;)
     {
-        // Consume tokens
-        newTime += delay;
+        // Previous consume performed long time ago... Shift the new time to the start of a new burst.
+        uint64_t newTime = std::max(oldTime, minTime) + delay;
 
-        // No more tokens left in the bucket
+        // No more tokens left in the bucket... Return the time until required tokens are available.
         if (newTime > now)
-            return false;
+            return newTime - now;
+
+        // Try to update the current time atomically
+        if (time.compare_exchange_weak(oldTime, newTime, std::memory_order_relaxed, std::memory_order_relaxed))
+            return 0;
+
+        // Failed... Then retry consume tokens with a new time value
+    }
+}
+
+uint64_t TokenBucketConsumeUpTo(std::atomic<uint64_t>& time, uint64_t time_per_token, uint64_t time_per_burst, uint64_t tokens, uint64_t now) noexcept
+{
+    // Unlimited rate
+    if (time_per_token == 0)
+        return tokens;
+
+    uint64_t minTime = (now > time_per_burst) ? (now - time_per_burst) : 0;
+    uint64_t oldTime = time.load(std::memory_order_relaxed);
+
+    // Lock-free token consume loop
+    for (;;)
+    {
+        uint64_t baseTime = std::max(oldTime, minTime);
+
+        // Consume all available tokens but not more than requested
+        uint64_t available = (now > baseTime) ? ((now - baseTime) / time_per_token) : 0;
+        uint64_t consumed = std::min(tokens, available);
+        if (consumed == 0)
+            return 0;
 
         // Try to update the current time atomically
-        if (_time.compare_exchange_weak(oldTime, newTime, std::memory_order_relaxed, std::memory_order_relaxed))
-            return true;
+        if (time.compare_exchange_weak(oldTime, baseTime + consumed * time_per_token, std::memory_order_relaxed, std::memory_order_relaxed))
+            return consumed;
 
         // Failed... Then retry consume tokens with a new time value
-        newTime = oldTime;
     }
 }
 
+} // namespace Internals
+//! @endcond
+
 } // namespace CppCommon
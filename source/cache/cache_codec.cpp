@@ -0,0 +1,34 @@
+/*!
+    \file cache_codec.cpp
+    \brief Cache codec implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/cache_codec.h"
+
+#include "algorithms/lz4.h"
+
+namespace CppCommon {
+
+bool LZ4CacheCodec::compress(std::string_view value, std::string& buffer) const
+{
+    buffer.resize(LZ4::Bound(value.size()));
+    size_t size = LZ4::Compress(value.data(), value.size(), buffer.data(), buffer.size(), _dictionary.data(), _dictionary.size());
+    buffer.resize(size);
+    return (size > 0);
+}
+
+bool LZ4CacheCodec::decompress(std::string_view data, size_t size, std::string& value) const
+{
+    value.resize(size);
+    if (LZ4::Decompress(data.data(), data.size(), value.data(), value.size(), _dictionary.data(), _dictionary.size()) != size)
+    {
+        value.clear();
+        return false;
+    }
+    return true;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,162 @@
+/*!
+    \file cache_snapshot.cpp
+    \brief Cache snapshot implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/cache_snapshot.h"
+
+#include "algorithms/crc32c.h"
+#include "filesystem/exceptions.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Snapshot file magic "CCSNAP01"
+const uint64_t SNAPSHOT_MAGIC = 0x313050414E534343ull;
+
+} // namespace Internals
+//! @endcond
+
+CacheSnapshot::CacheSnapshot(const Path& path)
+    : _path(path),
+      _temp(path.string() + ".tmp"),
+      _file(_temp),
+      _count(0),
+      _crc(0),
+      _committed(false)
+{
+    // Reserve the snapshot header (records are buffered by the snapshot itself)
+    _file.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    _buffer.assign(HEADER_SIZE, 0);
+    _file.Write(_buffer.data(), _buffer.size());
+    _buffer.clear();
+}
+
+CacheSnapshot::~CacheSnapshot()
+{
+    if (_committed)
+        return;
+
+    try
+    {
+        // Remove the temporary file of the uncommitted snapshot
+        if (_file.IsFileOpened())
+            _file.Close();
+        Path::Remove(_temp);
+    }
+    catch (...) {}
+}
+
+size_t CacheSnapshot::Prepare()
+{
+    size_t offset = _buffer.size();
+    _buffer.resize(offset + RECORD_SIZE);
+    return offset;
+}
+
+void CacheSnapshot::Complete(size_t offset, size_t key, uint64_t expiry)
+{
+    size_t value = _buffer.size() - offset - RECORD_SIZE - key;
+    if ((key > std::numeric_limits<uint32_t>::max()) || (value > std::numeric_limits<uint32_t>::max()))
+        throwex FileSystemException("Cache snapshot record is too large!").Attach(_path);
+
+    uint32_t key32 = (uint32_t)key;
+    uint32_t value32 = (uint32_t)value;
+    std::memcpy(_buffer.data() + offset, &key32, 4);
+    std::memcpy(_buffer.data() + offset + 4, &value32, 4);
+    std::memcpy(_buffer.data() + offset + 8, &expiry, 8);
+    ++_count;
+}
+
+void CacheSnapshot::Append(std::string_view key, std::string_view value, uint64_t expiry)
+{
+    size_t offset = Prepare();
+    _buffer.append(key);
+    _buffer.append(value);
+    Complete(offset, key.size(), expiry);
+}
+
+void CacheSnapshot::Flush()
+{
+    if (_buffer.empty())
+        return;
+
+    _crc = CRC32C::Compute(_buffer.data(), _buffer.size(), _crc);
+    _file.Write(_buffer.data(), _buffer.size());
+    _buffer.clear();
+}
+
+void CacheSnapshot::Commit()
+{
+    Flush();
+
+    // Write the snapshot header
+    uint8_t header[HEADER_SIZE] = {};
+    std::memcpy(header, &Internals::SNAPSHOT_MAGIC, 8);
+    std::memcpy(header + 8, &_count, 8);
+    std::memcpy(header + 16, &_crc, 4);
+    _file.WriteAt(0, header, HEADER_SIZE);
+
+    // Make the snapshot durable and replace the previous one
+    _file.Flush();
+    _file.Close();
+    Path::Rename(_temp, _path);
+    _committed = true;
+}
+
+std::vector<CacheSnapshot::Record> CacheSnapshot::Read(const MappedFile& file)
+{
+    const char* data = (const char*)file.data();
+    size_t size = file.size();
+
+    // Validate the snapshot header
+    uint64_t magic = 0;
+    uint64_t count = 0;
+    uint32_t crc = 0;
+    if (size >= HEADER_SIZE)
+    {
+        std::memcpy(&magic, data, 8);
+        std::memcpy(&count, data + 8, 8);
+        std::memcpy(&crc, data + 16, 4);
+    }
+    if (magic != Internals::SNAPSHOT_MAGIC)
+        throwex FileSystemException("Invalid cache snapshot file!").Attach(file.path());
+    if (crc != CRC32C::Compute(data + HEADER_SIZE, size - HEADER_SIZE))
+        throwex FileSystemException("Corrupted cache snapshot file!").Attach(file.path());
+
+    // Read snapshot records
+    std::vector<Record> result;
+    result.reserve((size_t)std::min(count, (uint64_t)((size - HEADER_SIZE) / RECORD_SIZE)));
+    size_t offset = HEADER_SIZE;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        if ((size - offset) < RECORD_SIZE)
+            throwex FileSystemException("Truncated cache snapshot file!").Attach(file.path());
+
+        uint32_t key;
+        uint32_t value;
+        uint64_t expiry;
+        std::memcpy(&key, data + offset, 4);
+        std::memcpy(&value, data + offset + 4, 4);
+        std::memcpy(&expiry, data + offset + 8, 8);
+        offset += RECORD_SIZE;
+
+        if ((size - offset) < ((uint64_t)key + value))
+            throwex FileSystemException("Truncated cache snapshot file!").Attach(file.path());
+
+        result.push_back(Record{ std::string_view(data + offset, key), std::string_view(data + offset + key, value), expiry });
+        offset += (size_t)key + value;
+    }
+
+    return result;
+}
+
+} // namespace CppCommon
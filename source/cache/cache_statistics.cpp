@@ -0,0 +1,119 @@
+/*!
+    \file cache_statistics.cpp
+    \brief Cache statistics implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/cache_statistics.h"
+
+namespace CppCommon {
+
+uint64_t CacheHistogram::count() const noexcept
+{
+    uint64_t result = 0;
+    for (size_t i = 0; i < BUCKETS; ++i)
+        result += buckets[i];
+    return result;
+}
+
+uint64_t CacheHistogram::percentile(double percentile) const noexcept
+{
+    uint64_t total = count();
+    if (total == 0)
+        return 0;
+
+    // Find the bucket which contains the required rank
+    uint64_t rank = (uint64_t)(percentile * (double)total);
+    uint64_t current = 0;
+    for (size_t i = 0; i < BUCKETS; ++i)
+    {
+        current += buckets[i];
+        if ((current > rank) || (current == total))
+            return ((uint64_t)1 << (i + 1)) - 1;
+    }
+    return ((uint64_t)1 << BUCKETS) - 1;
+}
+
+size_t CacheHistogram::bucket(uint64_t nanoseconds) noexcept
+{
+    size_t result = 0;
+    while ((nanoseconds >>= 1) != 0)
+        ++result;
+    return (result < BUCKETS) ? result : (BUCKETS - 1);
+}
+
+CacheHistogram& CacheHistogram::operator+=(const CacheHistogram& histogram) noexcept
+{
+    for (size_t i = 0; i < BUCKETS; ++i)
+        buckets[i] += histogram.buckets[i];
+    return *this;
+}
+
+CacheStatistics& CacheStatistics::operator+=(const CacheStatistics& statistics) noexcept
+{
+    hits += statistics.hits;
+    misses += statistics.misses;
+    inserts += statistics.inserts;
+    rejections += statistics.rejections;
+    removals += statistics.removals;
+    evictions += statistics.evictions;
+    expirations += statistics.expirations;
+    entries += statistics.entries;
+    bytes += statistics.bytes;
+    lock_samples += statistics.lock_samples;
+    lock_wait += statistics.lock_wait;
+    lock_hold += statistics.lock_hold;
+    find_latency += statistics.find_latency;
+    insert_latency += statistics.insert_latency;
+    return *this;
+}
+
+void CacheCounters::collect(CacheStatistics& statistics) const noexcept
+{
+    statistics.hits += _hits.load(std::memory_order_relaxed);
+    statistics.misses += _misses.load(std::memory_order_relaxed);
+    statistics.inserts += _inserts.load(std::memory_order_relaxed);
+    statistics.rejections += _rejections.load(std::memory_order_relaxed);
+    statistics.removals += _removals.load(std::memory_order_relaxed);
+    statistics.evictions += _evictions.load(std::memory_order_relaxed);
+    statistics.expirations += _expirations.load(std::memory_order_relaxed);
+    statistics.lock_samples += _lock_samples.load(std::memory_order_relaxed);
+    statistics.lock_wait += _lock_wait.load(std::memory_order_relaxed);
+    statistics.lock_hold += _lock_hold.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < CacheHistogram::BUCKETS; ++i)
+    {
+        statistics.find_latency.buckets[i] += _find_latency[i].load(std::memory_order_relaxed);
+        statistics.insert_latency.buckets[i] += _insert_latency[i].load(std::memory_order_relaxed);
+    }
+}
+
+void CacheCounters::reset() noexcept
+{
+    _hits.store(0, std::memory_order_relaxed);
+    _misses.store(0, std::memory_order_relaxed);
+    _inserts.store(0, std::memory_order_relaxed);
+    _rejections.store(0, std::memory_order_relaxed);
+    _removals.store(0, std::memory_order_relaxed);
+    _evictions.store(0, std::memory_order_relaxed);
+    _expirations.store(0, std::memory_order_relaxed);
+    _lock_samples.store(0, std::memory_order_relaxed);
+    _lock_wait.store(0, std::memory_order_relaxed);
+    _lock_hold.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < CacheHistogram::BUCKETS; ++i)
+    {
+        _find_latency[i].store(0, std::memory_order_relaxed);
+        _insert_latency[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void CacheCounters::record(std::atomic<uint64_t>* histogram, uint64_t start, uint64_t locked, uint64_t finish) noexcept
+{
+    _lock_samples.fetch_add(1, std::memory_order_relaxed);
+    _lock_wait.fetch_add(locked - start, std::memory_order_relaxed);
+    _lock_hold.fetch_add(finish - locked, std::memory_order_relaxed);
+    histogram[CacheHistogram::bucket(finish - start)].fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
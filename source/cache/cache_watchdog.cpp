@@ -0,0 +1,70 @@
+/*!
+    \file cache_watchdog.cpp
+    \brief Cache background watchdog implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/cache_watchdog.h"
+
+#include "threads/thread.h"
+
+#include <chrono>
+
+namespace CppCommon {
+
+bool CacheWatchdog::running() const
+{
+    std::scoped_lock locker(_control);
+    return _thread.joinable();
+}
+
+bool CacheWatchdog::start(const Timespan& period, const std::function<void ()>& routine)
+{
+    std::scoped_lock locker(_control);
+
+    if (_thread.joinable())
+        return false;
+
+    _stop = false;
+    _thread = Thread::Start([this, period, routine]()
+    {
+        std::unique_lock<std::mutex> waiter(_lock);
+        while (!_stop)
+        {
+            // Wait for the next watchdog period or the stop signal
+            if (_cv.wait_for(waiter, std::chrono::nanoseconds(period.total()), [this]() { return _stop; }))
+                break;
+
+            // Call the watchdog routine without the lock
+            waiter.unlock();
+            routine();
+            waiter.lock();
+        }
+    });
+
+    return true;
+}
+
+bool CacheWatchdog::stop()
+{
+    std::scoped_lock locker(_control);
+
+    if (!_thread.joinable())
+        return false;
+
+    // Signal the watchdog thread to stop
+    {
+        std::scoped_lock waiter(_lock);
+        _stop = true;
+    }
+    _cv.notify_all();
+
+    // Wait for the watchdog thread
+    _thread.join();
+
+    return true;
+}
+
+} // namespace CppCommon
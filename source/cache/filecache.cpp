@@ -8,106 +8,362 @@
 
 #include "cache/filecache.h"
 
+#include <algorithm>
+#include <deque>
+
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Values decompressed by the last lookup of the current thread
+thread_local std::deque<std::string> decompressed;
+
+} // namespace Internals
+//! @endcond
+
+void FileCache::set_compression(const std::shared_ptr<const CacheCodec>& codec, size_t threshold, double ratio)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Keep all used codecs alive while their values are cached
+    if (codec && (std::find(_codecs.begin(), _codecs.end(), codec) == _codecs.end()))
+        _codecs.push_back(codec);
+
+    _codec = codec;
+    _threshold = threshold;
+    _ratio = ratio;
+}
+
+bool FileCache::compress_internal(std::string_view value, MemCacheEntry& entry) const
+{
+    if (!_codec || (value.size() < _threshold))
+        return false;
+
+    // Keep the compressed value only if it is small enough
+    std::string buffer;
+    if (!_codec->compress(value, buffer) || ((double)buffer.size() > ((double)value.size() * _ratio)))
+        return false;
+
+    entry.value = std::move(buffer);
+    entry.codec = _codec.get();
+    entry.size = value.size();
+    return true;
+}
+
+bool FileCache::decompress_internal(const MemCacheEntry& entry, std::string& value) const
+{
+    return entry.codec->decompress(entry.value, entry.size, value);
+}
+
+std::string_view FileCache::value_internal(const MemCacheEntry& entry) const
+{
+    if (entry.codec == nullptr)
+        return entry.view();
+
+    // Decompress the value into the thread local buffer
+    std::string& buffer = Internals::decompressed.emplace_back();
+    decompress_internal(entry, buffer);
+    return buffer;
+}
+
 bool FileCache::emplace(std::string&& key, std::string&& value, const Timespan& timeout)
 {
+    MemCacheEntry entry;
+    if (!compress_internal(value, entry))
+        entry.value = std::move(value);
+
     std::unique_lock<std::shared_mutex> locker(_lock);
 
     // Try to find and remove the previous key
     remove_internal(key);
 
     // Update the cache entry
+    _bytes += entry.view().size();
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        entry.timestamp = utc_internal();
+        entry.timespan = timeout;
+        entry.handle = _entries_by_timeout.insert(entry.timestamp + timeout, key);
     }
-    else
-        _entries_by_key.emplace(std::make_pair(std::move(key), MemCacheEntry(std::move(value))));
+    _entries_by_key.insert(key, std::move(entry));
 
+    _counters.insert();
     return true;
 }
 
 bool FileCache::insert(const std::string& key, const std::string& value, const Timespan& timeout)
 {
+    // Compress the value without the cache lock
+    MemCacheEntry entry;
+    if (!compress_internal(value, entry))
+        entry.value = value;
+
+    // Sample the operation latency and lock timings
+    bool sample = _counters.sample();
+    uint64_t start = sample ? Timestamp::nano() : 0;
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    uint64_t locked = sample ? Timestamp::nano() : 0;
+    bool result = insert_internal(key, std::move(entry), timeout, (timeout.total() > 0) ? utc_internal() : Timestamp(0));
+    if (sample)
+        _counters.record_insert(start, locked, Timestamp::nano());
+    return result;
+}
+
+size_t FileCache::insert_many(const std::pair<std::string, std::string>* items, size_t count, const Timespan& timeout)
+{
+    Timestamp current = (timeout.total() > 0) ? utc_internal() : Timestamp(0);
+
+    // Compress values without the cache lock
+    std::vector<MemCacheEntry> entries(count);
+    for (size_t i = 0; i < count; ++i)
+        if (!compress_internal(items[i].second, entries[i]))
+            entries[i].value = items[i].second;
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    size_t result = 0;
+    for (size_t i = 0; i < count; ++i)
+        if (insert_internal(items[i].first, std::move(entries[i]), timeout, current))
+            ++result;
+    return result;
+}
+
+bool FileCache::insert_internal(const std::string& key, MemCacheEntry&& entry, const Timespan& timeout, const Timestamp& current)
+{
+    // Try to find and remove the previous key
+    remove_internal(key);
+
+    // Update the cache entry
+    _bytes += entry.view().size();
+    if (timeout.total() > 0)
+    {
+        entry.timestamp = current;
+        entry.timespan = timeout;
+        entry.handle = _entries_by_timeout.insert(current + timeout, key);
+    }
+    _entries_by_key.insert(key, std::move(entry));
+
+    _counters.insert();
+    return true;
+}
+
+bool FileCache::insert_file(const std::string& key, const CppCommon::Path& file, const Timespan& timeout)
+{
+    MappedFile mapping;
+    try
+    {
+        // Map the cache file content
+        mapping.Map(file);
+    }
+    catch (const CppCommon::FileSystemException&) { return false; }
+
     std::unique_lock<std::shared_mutex> locker(_lock);
 
     // Try to find and remove the previous key
     remove_internal(key);
 
     // Update the cache entry
+    _bytes += mapping.size();
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value, _timestamp, timeout)));
-        _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
+        Timestamp current = utc_internal();
+        MemCacheEntry entry(std::move(mapping), current, timeout);
+        entry.handle = _entries_by_timeout.insert(current + timeout, key);
+        _entries_by_key.insert(key, std::move(entry));
     }
     else
-        _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value)));
+        _entries_by_key.insert(key, MemCacheEntry(std::move(mapping)));
 
+    _counters.insert();
     return true;
 }
 
-std::pair<bool, std::string_view> FileCache::find(const std::string& key)
+std::pair<bool, std::string_view> FileCache::find(std::string_view key)
+{
+    Timestamp timeout;
+    return find(key, timeout);
+}
+
+std::pair<bool, std::string_view> FileCache::find(std::string_view key, Timestamp& timeout)
 {
+    // Sample the operation latency and lock timings
+    bool sample = _counters.sample();
+    uint64_t start = sample ? Timestamp::nano() : 0;
+
+    // Release values decompressed by the previous lookup
+    Internals::decompressed.clear();
+
     std::shared_lock<std::shared_mutex> locker(_lock);
 
+    uint64_t locked = sample ? Timestamp::nano() : 0;
+    std::pair<bool, std::string_view> result(false, std::string_view());
+
     // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    const MemCacheEntry* entry = _entries_by_key.find(key);
+    if (entry != nullptr)
+    {
+        timeout = entry->timestamp + entry->timespan;
+        result = std::make_pair(true, value_internal(*entry));
+        _counters.hit();
+    }
+    else
+        _counters.miss();
+
+    if (sample)
+        _counters.record_find(start, locked, Timestamp::nano());
+    return result;
+}
+
+size_t FileCache::find_many(const std::string* keys, size_t count, std::pair<bool, std::string_view>* results)
+{
+    // Release values decompressed by the previous lookup
+    Internals::decompressed.clear();
+
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Try to find the given key
+        const MemCacheEntry* entry = _entries_by_key.find(keys[i]);
+        if (entry == nullptr)
+        {
+            results[i] = std::make_pair(false, std::string_view());
+            _counters.miss();
+        }
+        else
+        {
+            results[i] = std::make_pair(true, value_internal(*entry));
+            _counters.hit();
+            ++found;
+        }
+    }
+    return found;
+}
+
+std::pair<bool, std::string_view> FileCache::find_prefix(std::string_view key, std::string_view& prefix)
+{
+    // Release values decompressed by the previous lookup
+    Internals::decompressed.clear();
+
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    // Try to find the longest matched key
+    auto match = _entries_by_key.longest_prefix(key);
+    if (match.second == nullptr)
+    {
+        _counters.miss();
         return std::make_pair(false, std::string_view());
+    }
 
-    return std::make_pair(true, std::string_view(it->second.value));
+    prefix = match.first;
+    _counters.hit();
+    return std::make_pair(true, value_internal(*match.second));
 }
 
-std::pair<bool, std::string_view> FileCache::find(const std::string& key, Timestamp& timeout)
+size_t FileCache::walk(std::string_view prefix, const std::function<bool (std::string_view key, std::string_view value)>& visitor) const
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
 
-    // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    size_t result = 0;
+    std::string buffer;
+    _entries_by_key.walk(prefix, [this, &visitor, &buffer, &result](std::string_view key, const MemCacheEntry& entry)
+    {
+        ++result;
+        if (entry.codec == nullptr)
+            return visitor(key, entry.view());
+
+        // Decompress the value only for the visitor call
+        decompress_internal(entry, buffer);
+        return visitor(key, buffer);
+    });
+    return result;
+}
+
+std::pair<bool, std::string_view> FileCache::find_compressed(std::string_view key, std::string_view encoding)
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    // Try to find the given key compressed with the given encoding
+    const MemCacheEntry* entry = _entries_by_key.find(key);
+    if ((entry == nullptr) || (entry->codec == nullptr) || (entry->codec->name() != encoding))
         return std::make_pair(false, std::string_view());
 
-    timeout = it->second.timestamp + it->second.timespan;
-    return std::make_pair(true, std::string_view(it->second.value));
+    _counters.hit();
+    return std::make_pair(true, entry->view());
 }
 
-bool FileCache::remove(const std::string& key)
+bool FileCache::remove(std::string_view key)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
-    return remove_internal(key);
+    if (!remove_internal(key))
+        return false;
+
+    _counters.remove();
+    return true;
+}
+
+size_t FileCache::remove_many(const std::string* keys, size_t count)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    size_t result = 0;
+    for (size_t i = 0; i < count; ++i)
+        if (remove_internal(keys[i]))
+        {
+            _counters.remove();
+            ++result;
+        }
+    return result;
 }
 
-bool FileCache::remove_internal(const std::string& key)
+bool FileCache::remove_internal(std::string_view key)
 {
     // Try to find the given key
-    auto it = _entries_by_key.find(key);
-    if (it == _entries_by_key.end())
+    MemCacheEntry* entry = _entries_by_key.find(key);
+    if (entry == nullptr)
         return false;
 
-    // Try to erase cache entry by timestamp
-    if (it->second.timestamp.total() > 0)
-        _entries_by_timestamp.erase(it->second.timestamp);
+    // Try to erase cache entry by timeout
+    if (entry->timestamp.total() > 0)
+        _entries_by_timeout.remove(entry->handle);
 
     // Erase cache entry
-    _entries_by_key.erase(it);
+    _bytes -= entry->view().size();
+    _entries_by_key.erase(key);
 
     return true;
 }
 
 bool FileCache::insert_path(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler)
+{
+    return insert_path_common(path, prefix, timeout, handler, false, false);
+}
+
+bool FileCache::insert_path_mapped(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout)
+{
+    return insert_path_common(path, prefix, timeout, nullptr, true, false);
+}
+
+bool FileCache::insert_path_common(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler, bool mapped, bool watch)
 {
     // Try to find and remove the previous path
     remove_path_internal(path);
 
+    // Subscribe to the cache path changes before loading it
+    std::shared_ptr<DirectoryWatcher> watcher;
+    if (watch)
+    {
+        try { watcher = std::make_shared<DirectoryWatcher>(path); }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
     // Insert the cache path
-    if (!insert_path_internal(path, prefix, timeout, handler))
+    if (!insert_path_internal(path, prefix, timeout, handler, mapped))
         return false;
 
     std::unique_lock<std::shared_mutex> locker(_lock);
@@ -115,34 +371,47 @@ bool FileCache::insert_path(const CppCommon::Path& path, const std::string& pref
     // Update the cache path
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
-        _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
-        _paths_by_key.insert(std::make_pair(path, FileCacheEntry(prefix, handler, _timestamp, timeout)));
-        _paths_by_timestamp.insert(std::make_pair(_timestamp, path));
+        Timestamp current = utc_internal();
+        FileCacheEntry entry(prefix, handler, mapped, current, timeout);
+        entry.watcher = watcher;
+        entry.handle = _paths_by_timeout.insert(current + timeout, path);
+        _paths_by_key.insert(std::make_pair(path, std::move(entry)));
     }
     else
-        _paths_by_key.insert(std::make_pair(path, FileCacheEntry(prefix, handler)));
+    {
+        FileCacheEntry entry(prefix, handler, mapped);
+        entry.watcher = watcher;
+        _paths_by_key.insert(std::make_pair(path, std::move(entry)));
+    }
 
     return true;
 }
 
-bool FileCache::insert_path_internal(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler)
+bool FileCache::insert_path_internal(const CppCommon::Path& path, const std::string& prefix, const Timespan& timeout, const InsertHandler& handler, bool mapped)
 {
     try
     {
         const std::string key_prefix = (prefix.empty() || (prefix == "/")) ? "/" : (prefix + "/");
 
-        // Iterate through all directory entries
-        for (const auto& item : CppCommon::Directory(path))
+        // Iterate through all directory entries (entry types are taken from directory records)
+        bool result = true;
+        CppCommon::DirectoryWalkOptions options;
+        options.recursive = false;
+        options.symlinks = true;
+        CppCommon::Directory(path).Walk([&](const CppCommon::DirectoryEntry& item)
         {
-            const CppCommon::Path entry = item.IsSymlink() ? Symlink(item).target() : item;
-            const std::string key = key_prefix + CppCommon::Encoding::URLDecode(item.filename().string());
+            const CppCommon::Path entry = (item.type == CppCommon::FileType::SYMLINK) ? Symlink(item.path()).target() : item.path();
+            const std::string key = key_prefix + CppCommon::Encoding::URLDecode(item.name);
 
-            if (entry.IsDirectory())
+            if (item.target == CppCommon::FileType::DIRECTORY)
             {
                 // Recursively insert sub-directory
-                if (!insert_path_internal(entry, key, timeout, handler))
-                    return false;
+                result = insert_path_internal(entry, key, timeout, handler, mapped);
+            }
+            else if (mapped)
+            {
+                // Map the cache file content
+                result = insert_file(key, entry, timeout);
             }
             else
             {
@@ -151,14 +420,15 @@ bool FileCache::insert_path_internal(const CppCommon::Path& path, const std::str
                     // Load the cache file content
                     auto content = CppCommon::File::ReadAllBytes(entry);
                     std::string value(content.begin(), content.end());
-                    if (!handler(*this, key, value, timeout))
-                        return false;
+                    result = handler(*this, key, value, timeout);
                 }
-                catch (const CppCommon::FileSystemException&) { return false; }
+                catch (const CppCommon::FileSystemException&) { result = false; }
             }
-        }
 
-        return true;
+            return result;
+        }, options);
+
+        return result;
     }
     catch (const CppCommon::FileSystemException&) { return false; }
 }
@@ -202,9 +472,9 @@ bool FileCache::remove_path_internal(const CppCommon::Path& path)
     if (it == _paths_by_key.end())
         return false;
 
-    // Try to erase cache path by timestamp
+    // Try to erase cache path by timeout
     if (it->second.timestamp.total() > 0)
-        _paths_by_timestamp.erase(it->second.timestamp);
+        _paths_by_timeout.remove(it->second.handle);
 
     // Erase cache path
     _paths_by_key.erase(it);
@@ -218,69 +488,300 @@ void FileCache::clear()
 
     // Clear all cache entries
     _entries_by_key.clear();
-    _entries_by_timestamp.clear();
+    _entries_by_timeout.clear();
     _paths_by_key.clear();
-    _paths_by_timestamp.clear();
+    _paths_by_timeout.clear();
+    _bytes = 0;
 }
 
-void FileCache::watchdog(const UtcTimestamp& utc)
+uint64_t FileCache::snapshot(const CppCommon::Path& path) const
 {
-    std::unique_lock<std::shared_mutex> locker(_lock);
+    CacheSnapshot snapshot(path);
 
-    // Watchdog for cache entries
-    auto it_entry_by_timestamp = _entries_by_timestamp.begin();
-    while (it_entry_by_timestamp != _entries_by_timestamp.end())
+    // Copy cache entries under the shared cache lock
     {
-        // Check for the cache entry timeout
-        auto it_entry_by_key = _entries_by_key.find(it_entry_by_timestamp->second);
-        if ((it_entry_by_key->second.timestamp + it_entry_by_key->second.timespan) <= utc)
+        std::shared_lock<std::shared_mutex> locker(_lock);
+        std::string buffer;
+        _entries_by_key.walk("", [this, &snapshot, &buffer](std::string_view key, const MemCacheEntry& entry)
         {
-            // Erase the cache entry with timeout
-            _entries_by_key.erase(it_entry_by_key);
-            _entries_by_timestamp.erase(it_entry_by_timestamp);
-            it_entry_by_timestamp = _entries_by_timestamp.begin();
+            uint64_t expiry = (entry.timespan.total() > 0) ? (entry.timestamp + entry.timespan).total() : 0;
+
+            // Compressed values are saved decompressed
+            if (entry.codec != nullptr)
+            {
+                if (decompress_internal(entry, buffer))
+                    snapshot.Append(key, buffer, expiry);
+            }
+            else
+                snapshot.Append(key, entry.view(), expiry);
+            return true;
+        });
+    }
+
+    // Write cache records without the cache lock
+    snapshot.Commit();
+    return snapshot.count();
+}
+
+size_t FileCache::restore(const CppCommon::Path& path)
+{
+    MappedFile file(path);
+    file.Advise(MappedFileAdvice::SEQUENTIAL);
+    std::vector<CacheSnapshot::Record> records = CacheSnapshot::Read(file);
+
+    Timestamp current = utc_internal();
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    size_t result = 0;
+    for (const auto& record : records)
+    {
+        // Skip entries expired since the snapshot
+        if ((record.expiry > 0) && (record.expiry <= current.total()))
             continue;
+
+        MemCacheEntry entry;
+        if (!compress_internal(record.value, entry))
+            entry.value = record.value;
+
+        Timespan timeout((record.expiry > 0) ? (int64_t)(record.expiry - current.total()) : 0);
+        if (insert_internal(std::string(record.key), std::move(entry), timeout, current))
+            ++result;
+    }
+    return result;
+}
+
+CacheStatistics FileCache::statistics() const
+{
+    CacheStatistics result;
+    _counters.collect(result);
+
+    std::shared_lock<std::shared_mutex> locker(_lock);
+    result.entries = _entries_by_key.size();
+    result.bytes = _bytes;
+    return result;
+}
+
+void FileCache::reset_statistics()
+{
+    _counters.reset();
+}
+
+bool FileCache::watch_path(const CppCommon::Path& path)
+{
+    std::shared_ptr<DirectoryWatcher> watcher;
+    try { watcher = std::make_shared<DirectoryWatcher>(path); }
+    catch (const CppCommon::FileSystemException&) { return false; }
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Try to find the given path
+    auto it = _paths_by_key.find(path);
+    if (it == _paths_by_key.end())
+        return false;
+
+    it->second.watcher = watcher;
+    return true;
+}
+
+void FileCache::refresh()
+{
+    std::vector<std::tuple<CppCommon::Path, FileCacheEntry, std::vector<DirectoryWatcher::Change>>> pending;
+
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Poll changes of all watched cache paths
+    for (auto& item : _paths_by_key)
+    {
+        if (!item.second.watcher)
+            continue;
+
+        std::vector<DirectoryWatcher::Change> changes;
+        try { item.second.watcher->Poll(changes); }
+        catch (const CppCommon::FileSystemException&) { changes.emplace_back(DirectoryChange::RESCAN, item.first); }
+
+        if (!changes.empty())
+            pending.emplace_back(item.first, item.second, std::move(changes));
+    }
+
+    locker.unlock();
+
+    // Apply changes of watched cache paths
+    for (const auto& item : pending)
+        refresh_path_internal(std::get<0>(item), std::get<1>(item), std::get<2>(item));
+}
+
+void FileCache::refresh_path_internal(const CppCommon::Path& path, const FileCacheEntry& entry, const std::vector<DirectoryWatcher::Change>& changes)
+{
+    // Apply only the last change of each changed path
+    std::unordered_map<std::string, size_t> last;
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        if (changes[i].first == DirectoryChange::RESCAN)
+        {
+            // Reload the whole cache path
+            insert_path_common(path, entry.prefix, entry.timespan, entry.handler, entry.mapped, true);
+            return;
         }
-        else
-            break;
+        last[changes[i].second.string()] = i;
     }
 
-    // Watchdog for cache paths
-    auto it_path_by_timestamp = _paths_by_timestamp.begin();
-    while (it_path_by_timestamp != _paths_by_timestamp.end())
+    const std::string root = path.string();
+    const std::string key_prefix = (entry.prefix.empty() || (entry.prefix == "/")) ? "/" : (entry.prefix + "/");
+
+    for (size_t i = 0; i < changes.size(); ++i)
     {
-        // Check for the cache entry timeout
-        auto& it_path_by_key = _paths_by_key[it_path_by_timestamp->second];
-        if ((it_path_by_key.timestamp + it_path_by_key.timespan) <= utc)
+        const std::string changed = changes[i].second.string();
+        if ((last[changed] != i) || (changed.size() <= root.size()) || (changed.compare(0, root.size(), root) != 0))
+            continue;
+
+        // Build the cache key from relative path components
+        std::string key;
+        std::string component;
+        for (size_t j = root.size(); j <= changed.size(); ++j)
+        {
+            if ((j == changed.size()) || (changed[j] == '/') || (changed[j] == '\\'))
+            {
+                if (!component.empty())
+                {
+                    key = (key.empty() ? key_prefix : (key + "/")) + CppCommon::Encoding::URLDecode(component);
+                    component.clear();
+                }
+            }
+            else
+                component += changed[j];
+        }
+        if (key.empty())
+            continue;
+
+        if (changes[i].first == DirectoryChange::REMOVED)
         {
-            // Update the cache path with timeout
-            auto path = it_path_by_timestamp->second;
-            auto prefix = it_path_by_key.prefix;
-            auto timespan = it_path_by_key.timespan;
-            auto handler = it_path_by_key.handler;
-            _paths_by_timestamp.erase(it_path_by_timestamp);
-            locker.unlock();
-            insert_path(path, prefix, timespan, handler);
-            locker.lock();
-            it_path_by_timestamp = _paths_by_timestamp.begin();
+            // Drop the removed file or directory
+            std::unique_lock<std::shared_mutex> locker(_lock);
+            remove_internal(key);
+            remove_prefix_internal(key + "/");
             continue;
         }
-        else
-            break;
+
+        try
+        {
+            const CppCommon::Path target = changes[i].second.IsSymlink() ? Symlink(changes[i].second).target() : changes[i].second;
+            if (target.IsDirectory())
+            {
+                // Load the new sub-directory
+                insert_path_internal(target, key, entry.timespan, entry.handler, entry.mapped);
+            }
+            else if (entry.mapped)
+            {
+                // Map the changed file content
+                insert_file(key, target, entry.timespan);
+            }
+            else if (target.IsExists())
+            {
+                // Reload the changed file content
+                auto content = CppCommon::File::ReadAllBytes(target);
+                std::string value(content.begin(), content.end());
+                entry.handler(*this, key, value, entry.timespan);
+            }
+        }
+        catch (const CppCommon::FileSystemException&) {}
     }
 }
 
+void FileCache::remove_prefix_internal(const std::string& prefix)
+{
+    // Erase cache entries of the prefix subtree by timeout
+    _entries_by_key.walk(prefix, [this](std::string_view, MemCacheEntry& entry)
+    {
+        if (entry.timestamp.total() > 0)
+            _entries_by_timeout.remove(entry.handle);
+
+        _bytes -= entry.view().size();
+        return true;
+    });
+
+    _entries_by_key.erase_prefix(prefix);
+}
+
+void FileCache::watchdog(const UtcTimestamp& utc)
+{
+    // Apply changes of watched cache paths
+    refresh();
+
+    std::vector<MemCacheEntry> entries;
+    entries.reserve(WATCHDOG_CHUNK);
+
+    std::unique_lock<std::shared_mutex> locker(_lock, std::defer_lock);
+
+    // Watchdog for cache entries
+    size_t count;
+    do
+    {
+        locker.lock();
+
+        // Watchdog for the bounded chunk of cache entries
+        count = _entries_by_timeout.advance(utc, [this, &entries](std::string& key)
+        {
+            // Erase the cache entry with timeout
+            MemCacheEntry* entry = _entries_by_key.find(key);
+            if (entry != nullptr)
+            {
+                _bytes -= entry->view().size();
+                entries.emplace_back(std::move(*entry));
+                _entries_by_key.erase(key);
+                _counters.expire();
+            }
+        }, WATCHDOG_CHUNK);
+
+        locker.unlock();
+
+        // Free expired values and unmap expired files without the cache lock
+        entries.clear();
+    } while (count == WATCHDOG_CHUNK);
+
+    locker.lock();
+
+    // Watchdog for cache paths
+    std::vector<std::pair<CppCommon::Path, FileCacheEntry>> expired;
+    _paths_by_timeout.advance(utc, [this, &expired](CppCommon::Path& path)
+    {
+        auto it = _paths_by_key.find(path);
+        if (it != _paths_by_key.end())
+            expired.emplace_back(path, it->second);
+    });
+
+    locker.unlock();
+
+    // Update cache paths with timeout
+    for (const auto& item : expired)
+        insert_path_common(item.first, item.second.prefix, item.second.timespan, item.second.handler, item.second.mapped, (item.second.watcher != nullptr));
+}
+
+bool FileCache::start_watchdog(const Timespan& period)
+{
+    return _watchdog.start(period, [this]() { watchdog(); });
+}
+
+bool FileCache::stop_watchdog()
+{
+    return _watchdog.stop();
+}
+
 void FileCache::swap(FileCache& cache) noexcept
 {
     std::unique_lock<std::shared_mutex> locker1(_lock);
     std::unique_lock<std::shared_mutex> locker2(cache._lock);
 
     using std::swap;
-    swap(_timestamp, cache._timestamp);
     swap(_entries_by_key, cache._entries_by_key);
-    swap(_entries_by_timestamp, cache._entries_by_timestamp);
+    swap(_bytes, cache._bytes);
+    swap(_entries_by_timeout, cache._entries_by_timeout);
     swap(_paths_by_key, cache._paths_by_key);
-    swap(_paths_by_timestamp, cache._paths_by_timestamp);
+    swap(_paths_by_timeout, cache._paths_by_timeout);
+    swap(_codec, cache._codec);
+    swap(_codecs, cache._codecs);
+    swap(_threshold, cache._threshold);
+    swap(_ratio, cache._ratio);
 }
 
 } // namespace CppCommon
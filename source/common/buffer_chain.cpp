@@ -0,0 +1,274 @@
+/*!
+    \file buffer_chain.cpp
+    \brief Buffer chain implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/buffer_chain.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace CppCommon {
+
+BufferSlice::BufferSlice(std::shared_ptr<uint8_t[]> block, size_t offset, size_t size) noexcept
+    : _block(std::move(block)),
+      _data(_block ? (_block.get() + offset) : nullptr),
+      _size(_block ? size : 0)
+{
+}
+
+BufferSlice BufferSlice::Slice(size_t offset, size_t size) const noexcept
+{
+    offset = std::min(offset, _size);
+    size = std::min(size, _size - offset);
+
+    BufferSlice result;
+    if (size > 0)
+    {
+        result._block = _block;
+        result._data = _data + offset;
+        result._size = size;
+    }
+    return result;
+}
+
+BufferSlice BufferSlice::Copy(const void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return BufferSlice();
+
+    std::shared_ptr<uint8_t[]> block(new uint8_t[size]);
+    std::memcpy(block.get(), buffer, size);
+    return BufferSlice(std::move(block), 0, size);
+}
+
+const size_t BufferChain::DEFAULT_BLOCK_SIZE = 65536;
+
+BufferChain::BufferChain(size_t block) : _block(std::max(block, (size_t)1)), _size(0), _tail_used(0)
+{
+}
+
+BufferChain::BufferChain(const BufferChain& chain) : _block(chain._block), _size(chain._size), _slices(chain._slices), _tail_used(0)
+{
+    // Writable tail block is never shared between chains
+}
+
+BufferChain::BufferChain(BufferChain&& chain) noexcept
+    : _block(chain._block),
+      _size(chain._size),
+      _slices(std::move(chain._slices)),
+      _tail(std::move(chain._tail)),
+      _tail_used(chain._tail_used)
+{
+    chain._size = 0;
+    chain._slices.clear();
+    chain._tail_used = 0;
+}
+
+BufferChain& BufferChain::operator=(const BufferChain& chain)
+{
+    if (this != &chain)
+    {
+        BufferChain(chain).swap(*this);
+    }
+    return *this;
+}
+
+BufferChain& BufferChain::operator=(BufferChain&& chain) noexcept
+{
+    if (this != &chain)
+    {
+        BufferChain(std::move(chain)).swap(*this);
+    }
+    return *this;
+}
+
+std::vector<std::span<const uint8_t>> BufferChain::spans() const
+{
+    std::vector<std::span<const uint8_t>> result;
+    result.reserve(_slices.size());
+    for (const auto& slice : _slices)
+        result.emplace_back(slice.span());
+    return result;
+}
+
+void BufferChain::Append(const void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return;
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    while (size > 0)
+    {
+        std::span<uint8_t> space = Prepare(size);
+        std::memcpy(space.data(), bytes, space.size());
+        Commit(space.size());
+        bytes += space.size();
+        size -= space.size();
+    }
+}
+
+void BufferChain::Append(const BufferSlice& slice)
+{
+    if (slice.empty())
+        return;
+
+    _slices.push_back(slice);
+    _size += slice.size();
+}
+
+void BufferChain::Append(const BufferChain& chain)
+{
+    // Copy of the chain itself is appended to support self-append
+    std::deque<BufferSlice> slices(chain._slices);
+    for (auto& slice : slices)
+    {
+        _size += slice.size();
+        _slices.push_back(std::move(slice));
+    }
+}
+
+void BufferChain::Append(BufferChain&& chain)
+{
+    if (this == &chain)
+    {
+        Append((const BufferChain&)chain);
+        return;
+    }
+
+    if (_slices.empty())
+    {
+        _slices.swap(chain._slices);
+        _size = chain._size;
+    }
+    else
+    {
+        for (auto& slice : chain._slices)
+            _slices.push_back(std::move(slice));
+        _size += chain._size;
+    }
+
+    chain.Clear();
+}
+
+std::span<uint8_t> BufferChain::Prepare(size_t size)
+{
+    if (size == 0)
+        return std::span<uint8_t>();
+
+    // Allocate a new tail block if the current one is full
+    if (!_tail || (_tail_used == _block))
+    {
+        _tail.reset(new uint8_t[_block]);
+        _tail_used = 0;
+    }
+
+    return std::span<uint8_t>(_tail.get() + _tail_used, std::min(size, _block - _tail_used));
+}
+
+void BufferChain::Commit(size_t size)
+{
+    if (size == 0)
+        return;
+
+    assert((_tail && (size <= (_block - _tail_used))) && "Committed size exceeds the prepared space!");
+
+    const uint8_t* data = _tail.get() + _tail_used;
+
+    // Extend the last slice if it ends at the committed bytes of the same tail block
+    if (!_slices.empty() && (_slices.back()._block == _tail) && ((_slices.back()._data + _slices.back()._size) == data))
+        _slices.back()._size += size;
+    else
+        _slices.emplace_back(_tail, _tail_used, size);
+
+    _tail_used += size;
+    _size += size;
+}
+
+size_t BufferChain::CopyTo(void* buffer, size_t size) const
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    uint8_t* bytes = (uint8_t*)buffer;
+    size_t copied = 0;
+    for (const auto& slice : _slices)
+    {
+        if (copied == size)
+            break;
+
+        size_t num = std::min(slice.size(), size - copied);
+        std::memcpy(bytes + copied, slice.data(), num);
+        copied += num;
+    }
+    return copied;
+}
+
+size_t BufferChain::Consume(size_t size)
+{
+    size_t consumed = 0;
+    while ((consumed < size) && !_slices.empty())
+    {
+        BufferSlice& front = _slices.front();
+        size_t num = std::min(front.size(), size - consumed);
+        if (num == front.size())
+            _slices.pop_front();
+        else
+        {
+            front._data += num;
+            front._size -= num;
+        }
+        consumed += num;
+    }
+    _size -= consumed;
+    return consumed;
+}
+
+BufferChain BufferChain::Split(size_t size)
+{
+    BufferChain result(_block);
+    while ((result._size < size) && !_slices.empty())
+    {
+        BufferSlice& front = _slices.front();
+        size_t num = std::min(front.size(), size - result._size);
+        if (num == front.size())
+        {
+            result.Append(front);
+            _slices.pop_front();
+        }
+        else
+        {
+            result.Append(front.Slice(0, num));
+            front._data += num;
+            front._size -= num;
+        }
+    }
+    _size -= result._size;
+    return result;
+}
+
+std::vector<uint8_t> BufferChain::ToBytes() const
+{
+    std::vector<uint8_t> result(_size);
+    CopyTo(result.data(), result.size());
+    return result;
+}
+
+std::string BufferChain::ToString() const
+{
+    std::string result(_size, 0);
+    CopyTo(result.data(), result.size());
+    return result;
+}
+
+void BufferChain::Clear() noexcept
+{
+    _slices.clear();
+    _size = 0;
+}
+
+} // namespace CppCommon
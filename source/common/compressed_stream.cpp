@@ -0,0 +1,757 @@
+/*!
+    \file compressed_stream.cpp
+    \brief Compressing writer and decompressing reader implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/compressed_stream.h"
+
+#include "algorithms/lz4.h"
+#include "errors/exceptions.h"
+#include "filesystem/file.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// LZ4 frame format constants
+const uint32_t LZ4FrameMagic = 0x184D2204;
+const uint32_t LZ4SkippableMagic = 0x184D2A50;
+const uint32_t LZ4SkippableMask = 0xFFFFFFF0;
+const uint32_t LZ4Uncompressed = 0x80000000;
+
+// Seek table constants of the zstd seekable format
+const uint32_t SeekTableMagic = 0x184D2A5E;
+const uint32_t SeekTableFooterMagic = 0x8F92EAB1;
+const size_t SeekTableFooterSize = 9;
+
+// Maximal distance of LZ4 matches (size of the linked blocks dictionary)
+const size_t LZ4Window = 65536;
+
+const uint32_t XXH32Prime1 = 2654435761u;
+const uint32_t XXH32Prime2 = 2246822519u;
+const uint32_t XXH32Prime3 = 3266489917u;
+const uint32_t XXH32Prime4 = 668265263u;
+const uint32_t XXH32Prime5 = 374761393u;
+
+inline uint32_t Load32(const uint8_t* ptr) noexcept
+{
+    return (uint32_t)ptr[0] | ((uint32_t)ptr[1] << 8) | ((uint32_t)ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+}
+
+inline void Store32(uint8_t* ptr, uint32_t value) noexcept
+{
+    ptr[0] = (uint8_t)value;
+    ptr[1] = (uint8_t)(value >> 8);
+    ptr[2] = (uint8_t)(value >> 16);
+    ptr[3] = (uint8_t)(value >> 24);
+}
+
+inline uint32_t XXH32Round(uint32_t accumulator, uint32_t input) noexcept
+{
+    accumulator += input * XXH32Prime2;
+    accumulator = std::rotl(accumulator, 13);
+    return accumulator * XXH32Prime1;
+}
+
+void XXH32State::Reset(uint32_t seed) noexcept
+{
+    v[0] = seed + XXH32Prime1 + XXH32Prime2;
+    v[1] = seed + XXH32Prime2;
+    v[2] = seed;
+    v[3] = seed - XXH32Prime1;
+    total = 0;
+    size = 0;
+}
+
+void XXH32State::Update(const void* buffer, size_t length) noexcept
+{
+    const uint8_t* ptr = (const uint8_t*)buffer;
+    const uint8_t* end = ptr + length;
+    total += length;
+
+    // Keep the tail less than the stripe
+    if ((size + length) < 16)
+    {
+        std::memcpy(memory + size, ptr, length);
+        size += length;
+        return;
+    }
+
+    // Complete the stripe from the previous tail
+    if (size > 0)
+    {
+        std::memcpy(memory + size, ptr, 16 - size);
+        ptr += 16 - size;
+        for (size_t i = 0; i < 4; ++i)
+            v[i] = XXH32Round(v[i], Load32(memory + i * 4));
+        size = 0;
+    }
+
+    // Process 16-byte stripes
+    while ((end - ptr) >= 16)
+    {
+        for (size_t i = 0; i < 4; ++i)
+            v[i] = XXH32Round(v[i], Load32(ptr + i * 4));
+        ptr += 16;
+    }
+
+    if (ptr < end)
+    {
+        std::memcpy(memory, ptr, end - ptr);
+        size = end - ptr;
+    }
+}
+
+uint32_t XXH32State::Digest() const noexcept
+{
+    uint32_t hash;
+    if (total >= 16)
+        hash = std::rotl(v[0], 1) + std::rotl(v[1], 7) + std::rotl(v[2], 12) + std::rotl(v[3], 18);
+    else
+        hash = v[2] + XXH32Prime5;
+
+    hash += (uint32_t)total;
+
+    const uint8_t* ptr = memory;
+    const uint8_t* end = memory + size;
+    while ((end - ptr) >= 4)
+    {
+        hash += Load32(ptr) * XXH32Prime3;
+        hash = std::rotl(hash, 17) * XXH32Prime4;
+        ptr += 4;
+    }
+    while (ptr < end)
+    {
+        hash += (*ptr) * XXH32Prime5;
+        hash = std::rotl(hash, 11) * XXH32Prime1;
+        ++ptr;
+    }
+
+    hash ^= hash >> 15;
+    hash *= XXH32Prime2;
+    hash ^= hash >> 13;
+    hash *= XXH32Prime3;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+uint32_t XXH32State::Compute(const void* buffer, size_t size, uint32_t seed) noexcept
+{
+    XXH32State state(seed);
+    state.Update(buffer, size);
+    return state.Digest();
+}
+
+} // namespace Internals
+//! @endcond
+
+CompressedWriter::CompressedWriter(Writer& writer, const CompressedWriterOptions& options)
+    : _writer(writer),
+      _options(options),
+      _block(65536),
+      _closed(false),
+      _size(0),
+      _compressed(0),
+      _blocks(0),
+      _current(nullptr),
+      _busy(0),
+      _stop(false)
+{
+    // Round the block size up to the LZ4 frame block size (64 KiB, 256 KiB, 1 MiB or 4 MiB)
+    uint8_t code = 4;
+    while ((_block < options.block) && (code < 7))
+    {
+        _block <<= 2;
+        ++code;
+    }
+
+    // Prepare block buffers
+    size_t buffers = options.background ? std::max(options.buffers, (size_t)2) : 1;
+    for (size_t i = 0; i < buffers; ++i)
+    {
+        auto block = std::make_unique<Block>();
+        block->data.resize(_block);
+        block->output.resize(LZ4::Bound(_block) + 8);
+        block->size = 0;
+        _free.push_back(block.get());
+        _buffers.emplace_back(std::move(block));
+    }
+    _current = _free.back();
+    _free.pop_back();
+
+    // Write the LZ4 frame header with independent blocks
+    uint8_t header[7];
+    Internals::Store32(header, Internals::LZ4FrameMagic);
+    header[4] = 0x60 | (options.checksum ? 0x10 : 0x00) | (options.content ? 0x04 : 0x00);
+    header[5] = (uint8_t)(code << 4);
+    header[6] = (uint8_t)((Internals::XXH32State::Compute(header + 4, 2) >> 8) & 0xFF);
+    Output(header, sizeof(header));
+    _compressed.store(sizeof(header), std::memory_order_release);
+
+    if (options.background)
+        _thread = Thread::Start([this]() { Compressor(); });
+}
+
+CompressedWriter::~CompressedWriter() noexcept
+{
+    try
+    {
+        Close();
+    }
+    catch (...) {}
+}
+
+size_t CompressedWriter::Write(const void* buffer, size_t size)
+{
+    if (_closed)
+        throwex RuntimeException("Compressing writer is closed!");
+
+    const uint8_t* ptr = (const uint8_t*)buffer;
+    size_t remain = size;
+    while (remain > 0)
+    {
+        size_t chunk = std::min(remain, _block - _current->size);
+        std::memcpy(_current->data.data() + _current->size, ptr, chunk);
+        _current->size += chunk;
+        ptr += chunk;
+        remain -= chunk;
+
+        if (_current->size == _block)
+            Submit();
+    }
+
+    _size += size;
+    return size;
+}
+
+void CompressedWriter::Flush()
+{
+    if (_closed)
+        return;
+
+    if (_current->size > 0)
+        Submit();
+    Wait();
+    _writer.Flush();
+}
+
+void CompressedWriter::Close()
+{
+    if (_closed)
+        return;
+    _closed = true;
+
+    std::exception_ptr error;
+    try
+    {
+        if (_current->size > 0)
+            Submit();
+        Wait();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // Stop the background thread
+    if (_thread.joinable())
+    {
+        {
+            Locker<CriticalSection> locker(_lock);
+            _stop = true;
+        }
+        _cv.NotifyAll();
+        _thread.join();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    // Write the end mark and the content checksum
+    uint8_t trailer[8];
+    size_t size = 4;
+    Internals::Store32(trailer, 0);
+    if (_options.content)
+    {
+        Internals::Store32(trailer + 4, _content.Digest());
+        size += 4;
+    }
+    Output(trailer, size);
+    _compressed.fetch_add(size, std::memory_order_acq_rel);
+
+    // Write the seek table skippable frame
+    if (_options.index)
+    {
+        size_t table = _index.size() * 8 + Internals::SeekTableFooterSize;
+        std::vector<uint8_t> buffer(8 + table);
+        uint8_t* ptr = buffer.data();
+        Internals::Store32(ptr, Internals::SeekTableMagic);
+        Internals::Store32(ptr + 4, (uint32_t)table);
+        ptr += 8;
+        for (const auto& entry : _index)
+        {
+            Internals::Store32(ptr, entry.first);
+            Internals::Store32(ptr + 4, entry.second);
+            ptr += 8;
+        }
+        Internals::Store32(ptr, (uint32_t)_index.size());
+        ptr[4] = 0;
+        Internals::Store32(ptr + 5, Internals::SeekTableFooterMagic);
+        Output(buffer.data(), buffer.size());
+        _compressed.fetch_add(buffer.size(), std::memory_order_acq_rel);
+    }
+
+    _writer.Flush();
+}
+
+void CompressedWriter::Submit()
+{
+    if (!_options.background)
+    {
+        Process(*_current);
+        _current->size = 0;
+        return;
+    }
+
+    {
+        Locker<CriticalSection> locker(_lock);
+        if (_error)
+            std::rethrow_exception(_error);
+
+        _pending.push_back(_current);
+        _current = nullptr;
+        _cv.NotifyAll();
+
+        // Background thread returns all blocks even after errors
+        _cv.Wait(_lock, [this]() { return !_free.empty(); });
+        _current = _free.back();
+        _free.pop_back();
+
+        if (_error)
+            std::rethrow_exception(_error);
+    }
+}
+
+void CompressedWriter::Wait()
+{
+    if (!_options.background)
+        return;
+
+    Locker<CriticalSection> locker(_lock);
+    _cv.Wait(_lock, [this]() { return _pending.empty() && (_busy == 0); });
+    if (_error)
+        std::rethrow_exception(_error);
+}
+
+void CompressedWriter::Process(Block& block)
+{
+    if (_options.content)
+        _content.Update(block.data.data(), block.size);
+
+    // Store incompressible blocks as is
+    uint8_t* output = block.output.data();
+    size_t stored = LZ4::Compress(block.data.data(), block.size, output + 4, block.output.size() - 8);
+    if ((stored == 0) || (stored >= block.size))
+    {
+        std::memcpy(output + 4, block.data.data(), block.size);
+        stored = block.size;
+        Internals::Store32(output, (uint32_t)stored | Internals::LZ4Uncompressed);
+    }
+    else
+        Internals::Store32(output, (uint32_t)stored);
+
+    size_t record = 4 + stored;
+    if (_options.checksum)
+    {
+        Internals::Store32(output + record, Internals::XXH32State::Compute(output + 4, stored));
+        record += 4;
+    }
+
+    Output(output, record);
+
+    if (_options.index)
+        _index.emplace_back((uint32_t)record, (uint32_t)block.size);
+    _compressed.fetch_add(record, std::memory_order_acq_rel);
+    _blocks.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void CompressedWriter::Output(const void* buffer, size_t size)
+{
+    if (_writer.Write(buffer, size) != size)
+        throwex RuntimeException("Cannot write the compressed stream!");
+}
+
+void CompressedWriter::Compressor()
+{
+    for (;;)
+    {
+        Block* block;
+        bool failed;
+        {
+            Locker<CriticalSection> locker(_lock);
+            _cv.Wait(_lock, [this]() { return _stop || !_pending.empty(); });
+            if (_pending.empty())
+                return;
+
+            block = _pending.front();
+            _pending.pop_front();
+            failed = (bool)_error;
+            ++_busy;
+        }
+
+        // Blocks after the first error are dropped
+        std::exception_ptr error;
+        if (!failed)
+        {
+            try
+            {
+                Process(*block);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        }
+
+        {
+            Locker<CriticalSection> locker(_lock);
+            if (error && !_error)
+                _error = error;
+            block->size = 0;
+            _free.push_back(block);
+            --_busy;
+        }
+        _cv.NotifyAll();
+    }
+}
+
+CompressedReader::CompressedReader(Reader& reader)
+    : _reader(&reader),
+      _file(nullptr),
+      _position(0),
+      _offset(0),
+      _blocks(0),
+      _frame(false),
+      _header(0),
+      _block_max(0),
+      _block_checksum(false),
+      _content_checksum(false),
+      _linked(false),
+      _verify(true),
+      _output_offset(0),
+      _output_size(0)
+{
+}
+
+CompressedReader::CompressedReader(const File& file)
+    : _reader(nullptr),
+      _file(&file),
+      _position(0),
+      _offset(0),
+      _blocks(0),
+      _frame(false),
+      _header(0),
+      _block_max(0),
+      _block_checksum(false),
+      _content_checksum(false),
+      _linked(false),
+      _verify(true),
+      _output_offset(0),
+      _output_size(0)
+{
+    LoadIndex();
+}
+
+size_t CompressedReader::Read(void* buffer, size_t size)
+{
+    uint8_t* ptr = (uint8_t*)buffer;
+    size_t total = 0;
+    while (total < size)
+    {
+        if ((_output_offset == _output_size) && !ReadBlock())
+            break;
+
+        size_t chunk = std::min(size - total, _output_size - _output_offset);
+        std::memcpy(ptr + total, _output.data() + _output_offset, chunk);
+        _output_offset += chunk;
+        _offset += chunk;
+        total += chunk;
+    }
+    return total;
+}
+
+void CompressedReader::Seek(uint64_t offset)
+{
+    if (!IsSeekable())
+        throwex RuntimeException("Compressed stream is not seekable!");
+    if (offset > size())
+        throwex ArgumentException("Seek offset is out of the uncompressed content!");
+
+    // Content checksum could not be verified after the seek
+    _verify = false;
+    _frame = true;
+    _output_offset = 0;
+    _output_size = 0;
+
+    size_t index = (std::upper_bound(_offsets.begin(), _offsets.end(), offset) - _offsets.begin()) - 1;
+    _position = _positions[index];
+    _offset = offset;
+
+    // Seek to the end mark
+    if (index == (_offsets.size() - 1))
+        return;
+
+    if (!ReadBlock())
+        throwex RuntimeException("Unexpected end of the compressed stream!");
+    _output_offset = (size_t)(offset - _offsets[index]);
+}
+
+size_t CompressedReader::Input(void* buffer, size_t size)
+{
+    uint8_t* ptr = (uint8_t*)buffer;
+    size_t total = 0;
+    while (total < size)
+    {
+        size_t result = (_file != nullptr) ? _file->ReadAt(_position + total, ptr + total, size - total) : _reader->Read(ptr + total, size - total);
+        if (result == 0)
+            break;
+        total += result;
+    }
+    _position += total;
+    return total;
+}
+
+void CompressedReader::InputExact(void* buffer, size_t size)
+{
+    if (Input(buffer, size) != size)
+        throwex RuntimeException("Unexpected end of the compressed stream!");
+}
+
+void CompressedReader::Skip(uint64_t size)
+{
+    if (_file != nullptr)
+    {
+        _position += size;
+        return;
+    }
+
+    uint8_t buffer[4096];
+    while (size > 0)
+    {
+        size_t chunk = (size_t)std::min(size, (uint64_t)sizeof(buffer));
+        InputExact(buffer, chunk);
+        size -= chunk;
+    }
+}
+
+void CompressedReader::ReadHeader()
+{
+    uint8_t descriptor[11];
+    InputExact(descriptor, 2);
+
+    uint8_t flags = descriptor[0];
+    uint8_t block = descriptor[1];
+    if (((flags >> 6) != 1) || ((flags & 0x02) != 0) || ((block & 0x8F) != 0) || (((block >> 4) & 0x07) < 4))
+        throwex RuntimeException("Invalid LZ4 frame descriptor!");
+    if ((flags & 0x01) != 0)
+        throwex RuntimeException("LZ4 frames with dictionaries are not supported!");
+
+    // Skip the content size
+    size_t size = 2;
+    if ((flags & 0x08) != 0)
+    {
+        InputExact(descriptor + size, 8);
+        size += 8;
+    }
+
+    InputExact(descriptor + size, 1);
+    if (descriptor[size] != (uint8_t)((Internals::XXH32State::Compute(descriptor, size) >> 8) & 0xFF))
+        throwex RuntimeException("LZ4 frame header checksum mismatch!");
+
+    _frame = true;
+    _header = 4 + size + 1;
+    _block_max = (size_t)1 << (8 + 2 * ((block >> 4) & 0x07));
+    _block_checksum = ((flags & 0x10) != 0);
+    _content_checksum = ((flags & 0x04) != 0);
+    _linked = ((flags & 0x20) == 0);
+    _verify = true;
+    _content.Reset();
+    _dictionary.clear();
+}
+
+bool CompressedReader::ReadBlock()
+{
+    for (;;)
+    {
+        uint8_t buffer[4];
+
+        // Read the next frame
+        if (!_frame)
+        {
+            size_t size = Input(buffer, 4);
+            if (size == 0)
+                return false;
+            if (size != 4)
+                throwex RuntimeException("Unexpected end of the compressed stream!");
+
+            uint32_t magic = Internals::Load32(buffer);
+            if ((magic & Internals::LZ4SkippableMask) == Internals::LZ4SkippableMagic)
+            {
+                InputExact(buffer, 4);
+                Skip(Internals::Load32(buffer));
+                continue;
+            }
+            if (magic != Internals::LZ4FrameMagic)
+                throwex RuntimeException("Invalid LZ4 frame magic number!");
+
+            ReadHeader();
+            continue;
+        }
+
+        InputExact(buffer, 4);
+        uint32_t size = Internals::Load32(buffer);
+
+        // End mark of the frame
+        if (size == 0)
+        {
+            if (_content_checksum)
+            {
+                InputExact(buffer, 4);
+                if (_verify && (Internals::Load32(buffer) != _content.Digest()))
+                    throwex RuntimeException("LZ4 frame content checksum mismatch!");
+            }
+            _frame = false;
+            continue;
+        }
+
+        bool stored = ((size & Internals::LZ4Uncompressed) != 0);
+        size &= ~Internals::LZ4Uncompressed;
+        if (size > _block_max)
+            throwex RuntimeException("LZ4 block size is greater than the maximal block size!");
+
+        if (_input.size() < size)
+            _input.resize(size);
+        InputExact(_input.data(), size);
+
+        if (_block_checksum)
+        {
+            InputExact(buffer, 4);
+            if (Internals::Load32(buffer) != Internals::XXH32State::Compute(_input.data(), size))
+                throwex RuntimeException("LZ4 block checksum mismatch!");
+        }
+
+        if (_output.size() < _block_max)
+            _output.resize(_block_max);
+
+        if (stored)
+        {
+            std::memcpy(_output.data(), _input.data(), size);
+            _output_size = size;
+        }
+        else
+        {
+            _output_size = LZ4::Decompress(_input.data(), size, _output.data(), _block_max, _dictionary.data(), _dictionary.size());
+            if (_output_size == SIZE_MAX)
+                throwex RuntimeException("LZ4 block is malformed!");
+        }
+
+        // Linked blocks reference the previous 64 KiB of the content
+        if (_linked)
+        {
+            if (_output_size >= Internals::LZ4Window)
+                _dictionary.assign(_output.data() + _output_size - Internals::LZ4Window, _output.data() + _output_size);
+            else
+            {
+                size_t keep = std::min(_dictionary.size(), Internals::LZ4Window - _output_size);
+                _dictionary.erase(_dictionary.begin(), _dictionary.end() - keep);
+                _dictionary.insert(_dictionary.end(), _output.data(), _output.data() + _output_size);
+            }
+        }
+
+        if (_content_checksum && _verify)
+            _content.Update(_output.data(), _output_size);
+
+        _output_offset = 0;
+        ++_blocks;
+
+        if (_output_size > 0)
+            return true;
+    }
+}
+
+void CompressedReader::LoadIndex()
+{
+    // Read the seek table footer at the end of the file
+    uint64_t file_size = _file->size();
+    if (file_size < (7 + 4 + 8 + Internals::SeekTableFooterSize))
+        return;
+
+    uint8_t footer[Internals::SeekTableFooterSize];
+    if (_file->ReadAt(file_size - sizeof(footer), footer, sizeof(footer)) != sizeof(footer))
+        return;
+    if ((Internals::Load32(footer + 5) != Internals::SeekTableFooterMagic) || ((footer[4] & 0x7C) != 0))
+        return;
+
+    uint64_t count = Internals::Load32(footer);
+    uint64_t entry = ((footer[4] & 0x80) != 0) ? 12 : 8;
+    uint64_t table = count * entry + Internals::SeekTableFooterSize;
+    if ((table + 8) > file_size)
+        return;
+
+    uint64_t start = file_size - table - 8;
+    std::vector<uint8_t> buffer((size_t)(table + 8));
+    if (_file->ReadAt(start, buffer.data(), buffer.size()) != buffer.size())
+        return;
+    if ((Internals::Load32(buffer.data()) != Internals::SeekTableMagic) || (Internals::Load32(buffer.data() + 4) != table))
+        return;
+
+    // Read the frame header at the beginning of the file
+    uint8_t magic[4];
+    if ((Input(magic, 4) != 4) || (Internals::Load32(magic) != Internals::LZ4FrameMagic))
+    {
+        _position = 0;
+        return;
+    }
+    ReadHeader();
+    if (_linked)
+        return;
+
+    // Calculate positions of blocks
+    uint64_t position = _header;
+    uint64_t offset = 0;
+    const uint8_t* ptr = buffer.data() + 8;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        uint32_t compressed = Internals::Load32(ptr);
+        uint32_t decompressed = Internals::Load32(ptr + 4);
+        if (decompressed > _block_max)
+            break;
+
+        _positions.push_back(position);
+        _offsets.push_back(offset);
+        position += compressed;
+        offset += decompressed;
+        ptr += entry;
+    }
+    _positions.push_back(position);
+    _offsets.push_back(offset);
+
+    // Index must describe the whole frame
+    if ((_positions.size() != (count + 1)) || ((position + 4 + (_content_checksum ? 4 : 0)) != start))
+    {
+        _positions.clear();
+        _offsets.clear();
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,142 @@
+/*!
+    \file line_reader.cpp
+    \brief Streaming line reader implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "common/line_reader.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace CppCommon {
+
+const size_t LineReader::DEFAULT_BUFFER = 1048576;
+
+LineReader::LineReader(Reader& reader, std::string_view delimiter, size_t buffer)
+    : _reader(&reader),
+      _delimiter(delimiter),
+      _buffer(),
+      _capacity(std::max(buffer, delimiter.size() + 1)),
+      _begin(nullptr),
+      _cursor(nullptr),
+      _scan(nullptr),
+      _end(nullptr),
+      _eof(false),
+      _lines(0)
+{
+    assert(!delimiter.empty() && "Lines delimiter must not be empty!");
+    if (delimiter.empty())
+        throwex ArgumentException("Lines delimiter must not be empty!");
+
+    _buffer.reset(new char[_capacity]);
+    _begin = _cursor = _scan = _end = _buffer.get();
+}
+
+LineReader::LineReader(std::string_view content, std::string_view delimiter)
+    : _reader(nullptr),
+      _delimiter(delimiter),
+      _buffer(),
+      _capacity(0),
+      _begin(content.data()),
+      _cursor(content.data()),
+      _scan(content.data()),
+      _end(content.data() + content.size()),
+      _eof(true),
+      _lines(0)
+{
+    assert(!delimiter.empty() && "Lines delimiter must not be empty!");
+    if (delimiter.empty())
+        throwex ArgumentException("Lines delimiter must not be empty!");
+}
+
+const char* LineReader::Find(const char* first, const char* last) const noexcept
+{
+    const size_t size = _delimiter.size();
+    const char symbol = _delimiter[0];
+
+    while ((size_t)(last - first) >= size)
+    {
+        // Vectorized search of the first delimiter character
+        const char* found = (const char*)std::memchr(first, symbol, (last - first) - (size - 1));
+        if (found == nullptr)
+            return nullptr;
+        if ((size == 1) || (std::memcmp(found + 1, _delimiter.data() + 1, size - 1) == 0))
+            return found;
+        first = found + 1;
+    }
+    return nullptr;
+}
+
+void LineReader::Fill()
+{
+    size_t remain = _end - _cursor;
+    size_t scanned = _scan - _cursor;
+
+    // Grow the buffer if the current line does not fit into it
+    if ((_cursor == _begin) && (remain == _capacity))
+    {
+        size_t capacity = _capacity * 2;
+        std::unique_ptr<char[]> buffer(new char[capacity]);
+        std::memcpy(buffer.get(), _cursor, remain);
+        _buffer = std::move(buffer);
+        _capacity = capacity;
+    }
+    // Move the rest of the current line to the buffer beginning
+    else if ((remain > 0) && (_cursor != _begin))
+        std::memmove(_buffer.get(), _cursor, remain);
+
+    _begin = _buffer.get();
+    _cursor = _begin;
+    _scan = _begin + scanned;
+    _end = _begin + remain;
+
+    // Fill the free space of the buffer
+    size_t result = _reader->Read(_buffer.get() + remain, _capacity - remain);
+    if (result == 0)
+        _eof = true;
+    _end += result;
+}
+
+bool LineReader::Next(std::string_view& line)
+{
+    for (;;)
+    {
+        const char* found = Find(_scan, _end);
+        if (found != nullptr)
+        {
+            line = std::string_view(_cursor, found - _cursor);
+            _cursor = _scan = found + _delimiter.size();
+            break;
+        }
+
+        // Delimiter may be split between two reads, so its prefix is scanned again
+        _scan = std::max(_cursor, _end - std::min((size_t)(_end - _cursor), _delimiter.size() - 1));
+
+        if (_eof)
+        {
+            // Return the last line without delimiter
+            if (_cursor == _end)
+                return false;
+            line = std::string_view(_cursor, _end - _cursor);
+            _cursor = _scan = _end;
+            break;
+        }
+
+        Fill();
+    }
+
+    // Remove the trailing carriage return of Windows text lines
+    if ((_delimiter.size() == 1) && (_delimiter[0] == '\n') && !line.empty() && (line.back() == '\r'))
+        line.remove_suffix(1);
+
+    ++_lines;
+    return true;
+}
+
+} // namespace CppCommon
@@ -8,31 +8,36 @@
 
 #include "common/reader.h"
 
-#include "utility/countof.h"
 
 namespace CppCommon {
 
-std::vector<uint8_t> Reader::ReadAllBytes()
+size_t Reader::ReadInto(BufferChain& chain, size_t size)
 {
-    const size_t PAGE = 8192;
-
-    uint8_t buffer[PAGE];
-    std::vector<uint8_t> result;
-    size_t size = 0;
-
-    do
+    size_t total = 0;
+    while (total < size)
     {
-        size = Read(buffer, countof(buffer));
-        result.insert(result.end(), buffer, buffer + size);
-    } while (size == countof(buffer));
+        std::span<uint8_t> space = chain.Prepare(size - total);
+        size_t result = Read(space.data(), space.size());
+        chain.Commit(result);
+        total += result;
+        if (result < space.size())
+            break;
+    }
+    return total;
+}
 
-    return result;
+std::vector<uint8_t> Reader::ReadAllBytes()
+{
+    BufferChain chain;
+    while (ReadInto(chain, chain.block()) == chain.block()) {}
+    return chain.ToBytes();
 }
 
 std::string Reader::ReadAllText()
 {
-    std::vector<uint8_t> bytes = ReadAllBytes();
-    return std::string(bytes.begin(), bytes.end());
+    BufferChain chain;
+    while (ReadInto(chain, chain.block()) == chain.block()) {}
+    return chain.ToString();
 }
 
 std::vector<std::string> Reader::ReadAllLines()
@@ -8,138 +8,272 @@
 
 #include "common/uint128.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
 namespace CppCommon {
 
-uint128_t operator*(const uint128_t& value1, const uint128_t& value2) noexcept
+//! @cond INTERNALS
+namespace Internals {
+
+// Largest power of the base which fits into 64 bits with the count of its digits
+struct UIntChunk
 {
-    // Split values into four 32-bit parts
-    uint64_t top[4] = { value1._upper >> 32, value1._upper & 0xFFFFFFFF, value1._lower >> 32, value1._lower & 0xFFFFFFFF };
-    uint64_t bottom[4] = { value2._upper >> 32, value2._upper & 0xFFFFFFFF, value2._lower >> 32, value2._lower & 0xFFFFFFFF };
-    uint64_t products[4][4];
-
-    // Multiply each component of the values
-    for (int y = 3; y > -1; --y)
-        for (int x = 3; x > -1; --x)
-            products[3 - x][y] = top[x] * bottom[y];
-
-    // First row
-    uint64_t fourth32 = (products[0][3] & 0xFFFFFFFF);
-    uint64_t third32  = (products[0][2] & 0xFFFFFFFF) + (products[0][3] >> 32);
-    uint64_t second32 = (products[0][1] & 0xFFFFFFFF) + (products[0][2] >> 32);
-    uint64_t first32  = (products[0][0] & 0xFFFFFFFF) + (products[0][1] >> 32);
-
-    // Second row
-    third32  += (products[1][3] & 0xFFFFFFFF);
-    second32 += (products[1][2] & 0xFFFFFFFF) + (products[1][3] >> 32);
-    first32  += (products[1][1] & 0xFFFFFFFF) + (products[1][2] >> 32);
-
-    // Third row
-    second32 += (products[2][3] & 0xFFFFFFFF);
-    first32  += (products[2][2] & 0xFFFFFFFF) + (products[2][3] >> 32);
-
-    // Fourth row
-    first32  += (products[3][3] & 0xFFFFFFFF);
-
-    // Move carry to the next digit
-    third32  += fourth32 >> 32;
-    second32 += third32  >> 32;
-    first32  += second32 >> 32;
-
-    // Remove carry from the current digit
-    fourth32 &= 0xFFFFFFFF;
-    third32  &= 0xFFFFFFFF;
-    second32 &= 0xFFFFFFFF;
-    first32  &= 0xFFFFFFFF;
-
-    // Combine components
-    return uint128_t((first32 << 32) | second32, (third32 << 32) | fourth32);
-}
+    uint64_t divisor;
+    size_t digits;
+};
 
-uint128_t operator<<(const uint128_t& value1, const uint128_t& value2) noexcept
+constexpr std::array<UIntChunk, 17> UIntChunks = []()
 {
-    const uint64_t shift = value2._lower;
-
-    if (((bool)value2._upper) || (shift >= 128))
-        return 0;
-    else if (shift == 64)
-        return uint128_t(value1._lower, 0);
-    else if (shift == 0)
-        return value1;
-    else if (shift < 64)
-        return uint128_t((value1._upper << shift) + (value1._lower >> (64 - shift)), value1._lower << shift);
-    else if ((128 > shift) && (shift > 64))
-        return uint128_t(value1._lower << (shift - 64), 0);
-    else
-        return 0;
-}
+    std::array<UIntChunk, 17> result{};
+    for (uint64_t base = 2; base <= 16; ++base)
+    {
+        UIntChunk chunk = { 1, 0 };
+        while (chunk.divisor <= (UINT64_MAX / base))
+        {
+            chunk.divisor *= base;
+            ++chunk.digits;
+        }
+        result[base] = chunk;
+    }
+    return result;
+}();
 
-uint128_t operator>>(const uint128_t& value1, const uint128_t& value2) noexcept
+// Table of decimal digit pairs "00" .. "99"
+constexpr std::array<char, 200> UIntDecimalPairs = []()
 {
-    const uint64_t shift = value2._lower;
-
-    if (((bool)value2._upper) || (shift >= 128))
-        return 0;
-    else if (shift == 64)
-        return uint128_t(0, value1._upper);
-    else if (shift == 0)
-        return value1;
-    else if (shift < 64)
-        return uint128_t(value1._upper >> shift, (value1._upper << (64 - shift)) + (value1._lower >> shift));
-    else if ((128 > shift) && (shift > 64))
-        return uint128_t(0, (value1._upper >> (shift - 64)));
+    std::array<char, 200> result{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        result[i * 2 + 0] = (char)('0' + i / 10);
+        result[i * 2 + 1] = (char)('0' + i % 10);
+    }
+    return result;
+}();
+
+// Table of hexadecimal byte pairs "00" .. "ff"
+constexpr std::array<char, 512> UIntHexPairs = []()
+{
+    std::array<char, 512> result{};
+    for (size_t i = 0; i < 256; ++i)
+    {
+        result[i * 2 + 0] = "0123456789abcdef"[i >> 4];
+        result[i * 2 + 1] = "0123456789abcdef"[i & 0x0F];
+    }
+    return result;
+}();
+
+// Convert the 64-bit chunk into digits and return the count of written characters (zero padded up to the given count of digits)
+size_t UIntChunkToChars(uint64_t value, size_t base, size_t digits, char* buffer) noexcept
+{
+    char temp[64];
+    char* end = temp + sizeof(temp);
+    char* ptr = end;
+
+    if (base == 10)
+    {
+        // Convert two decimal digits at once with the 64-bit arithmetic
+        while (value >= 100)
+        {
+            ptr -= 2;
+            std::memcpy(ptr, UIntDecimalPairs.data() + (value % 100) * 2, 2);
+            value /= 100;
+        }
+        if (value >= 10)
+        {
+            ptr -= 2;
+            std::memcpy(ptr, UIntDecimalPairs.data() + value * 2, 2);
+        }
+        else if ((value > 0) || (ptr == end))
+            *--ptr = (char)('0' + value);
+    }
     else
-        return 0;
+    {
+        do
+        {
+            *--ptr = "0123456789abcdef"[value % base];
+            value /= base;
+        } while (value > 0);
+    }
+
+    while ((size_t)(end - ptr) < digits)
+        *--ptr = '0';
+
+    size_t size = end - ptr;
+    std::memcpy(buffer, ptr, size);
+    return size;
 }
 
-size_t uint128_t::bits() const noexcept
+size_t UIntToChars(const uint64_t* limbs, size_t count, size_t base, char* buffer) noexcept
 {
-    size_t result = 0;
+    assert(((base >= 2) && (base <= 16)) && "Base must be in the range [2, 16]!");
+    assert(((count > 0) && (count <= 4)) && "Count of limbs must be in the range [1, 4]!");
+
+    // Skip leading zero limbs
+    while ((count > 1) && (limbs[0] == 0))
+    {
+        ++limbs;
+        --count;
+    }
+
+    if ((count == 1) && (limbs[0] < base))
+    {
+        buffer[0] = "0123456789abcdef"[limbs[0]];
+        return 1;
+    }
+
+    const size_t bits = count * 64 - std::countl_zero(limbs[0]);
 
-    if (_upper)
+    // Convert hexadecimal digits by bytes
+    if (base == 16)
     {
-        result = 64;
-        uint64_t upper = _upper;
-        while (upper)
+        char* ptr = buffer;
+        for (size_t i = 0; i < count; ++i)
         {
-            upper >>= 1;
-            ++result;
+            for (int shift = 56; shift >= 0; shift -= 8)
+            {
+                std::memcpy(ptr, UIntHexPairs.data() + ((limbs[i] >> shift) & 0xFF) * 2, 2);
+                ptr += 2;
+            }
         }
+
+        size_t size = (bits + 3) / 4;
+        std::memmove(buffer, ptr - size, size);
+        return size;
     }
-    else
+
+    // Convert other power of two bases by bits
+    if ((base & (base - 1)) == 0)
     {
-        uint64_t lower = _lower;
-        while (lower)
+        const size_t shift = std::countr_zero(base);
+        const size_t size = (bits + shift - 1) / shift;
+        for (size_t i = 0; i < size; ++i)
         {
-            lower >>= 1;
-            ++result;
+            size_t position = i * shift;
+            size_t index = count - 1 - position / 64;
+            size_t offset = position % 64;
+            uint64_t value = limbs[index] >> offset;
+            if ((offset + shift > 64) && (index > 0))
+                value |= limbs[index - 1] << (64 - offset);
+            buffer[size - 1 - i] = "0123456789abcdef"[value & (base - 1)];
         }
+        return size;
     }
 
-    return result;
+    // Divide by the largest power of the base which fits into 64 bits,
+    // so each division produces many digits and they are converted with
+    // the 64-bit arithmetic
+    const UIntChunk& chunk = UIntChunks[base];
+    uint64_t value[4];
+    std::memcpy(value, limbs, count * sizeof(uint64_t));
+    uint64_t chunks[8];
+    size_t chunks_count = 0;
+    size_t top = 0;
+    while ((top < (count - 1)) || (value[top] >= chunk.divisor))
+    {
+        uint64_t remainder = 0;
+        for (size_t i = top; i < count; ++i)
+            value[i] = Divide128(remainder, value[i], chunk.divisor, remainder);
+        chunks[chunks_count++] = remainder;
+        while ((top < (count - 1)) && (value[top] == 0))
+            ++top;
+    }
+
+    // The most significant chunk is not zero padded
+    size_t size = UIntChunkToChars(value[top], base, 0, buffer);
+    while (chunks_count > 0)
+        size += UIntChunkToChars(chunks[--chunks_count], base, chunk.digits, buffer + size);
+    return size;
 }
 
-std::string uint128_t::string(size_t base, size_t length) const
+std::from_chars_result UIntFromChars(const char* first, const char* last, uint64_t* limbs, size_t count, size_t base) noexcept
 {
+    assert(((count > 0) && (count <= 4)) && "Count of limbs must be in the range [1, 4]!");
+
     if ((base < 2) || (base > 16))
-        throw std::invalid_argument("Base must be in the range [2, 16]");
+        return std::from_chars_result{ first, std::errc::invalid_argument };
 
-    std::string out;
+    const UIntChunk& chunk = UIntChunks[base];
+    uint64_t value[4] = { 0, 0, 0, 0 };
+    bool overflow = false;
 
-    if (!(*this))
-        out = "0";
-    else
+    const char* ptr = first;
+    while (ptr != last)
     {
-        std::pair<uint128_t, uint128_t> qr(*this, 0);
-        do
+        // Accumulate digits of the chunk with the 64-bit arithmetic
+        uint64_t part = 0;
+        uint64_t multiplier = 1;
+        size_t digits = 0;
+        while ((ptr != last) && (digits < chunk.digits))
+        {
+            char ch = *ptr;
+            uint64_t digit;
+            if ((ch >= '0') && (ch <= '9'))
+                digit = ch - '0';
+            else if ((ch >= 'a') && (ch <= 'f'))
+                digit = ch - 'a' + 10;
+            else if ((ch >= 'A') && (ch <= 'F'))
+                digit = ch - 'A' + 10;
+            else
+                break;
+            if (digit >= base)
+                break;
+
+            part = part * base + digit;
+            multiplier *= base;
+            ++digits;
+            ++ptr;
+        }
+
+        if (digits == 0)
+            break;
+
+        // Multiply limbs by the chunk multiplier and add the chunk
+        uint64_t carry = part;
+        for (size_t i = count; i-- > 0;)
         {
-            qr = uint128_t::divmod(qr.first, uint128_t(base));
-            out = "0123456789abcdef"[(uint8_t)qr.second] + out;
-        } while (qr.first != 0);
+            uint64_t upper;
+            uint64_t lower = Multiply64(value[i], multiplier, upper);
+            lower += carry;
+            upper += (lower < carry) ? 1 : 0;
+            value[i] = lower;
+            carry = upper;
+        }
+        if (carry != 0)
+            overflow = true;
+
+        if (digits < chunk.digits)
+            break;
     }
 
-    if (out.size() < length)
-        out = std::string(length - out.size(), '0') + out;
+    if (ptr == first)
+        return std::from_chars_result{ first, std::errc::invalid_argument };
+    if (overflow)
+        return std::from_chars_result{ ptr, std::errc::result_out_of_range };
+
+    std::memcpy(limbs, value, count * sizeof(uint64_t));
+    return std::from_chars_result{ ptr, std::errc() };
+}
+
+} // namespace Internals
+//! @endcond
+
+std::string uint128_t::string(size_t base, size_t length) const
+{
+    if ((base < 2) || (base > 16))
+        throw std::invalid_argument("Base must be in the range [2, 16]");
+
+    char buffer[128];
+    const uint64_t limbs[2] = { _upper, _lower };
+    size_t size = Internals::UIntToChars(limbs, 2, base, buffer);
 
+    std::string out;
+    out.reserve(std::max(size, length));
+    if (size < length)
+        out.append(length - size, '0');
+    out.append(buffer, size);
     return out;
 }
 
@@ -148,53 +282,53 @@ std::wstring uint128_t::wstring(size_t base, size_t length) const
     if ((base < 2) || (base > 16))
         throw std::invalid_argument("Base must be in the range [2, 16]");
 
+    char buffer[128];
+    const uint64_t limbs[2] = { _upper, _lower };
+    size_t size = Internals::UIntToChars(limbs, 2, base, buffer);
+
     std::wstring out;
+    out.reserve(std::max(size, length));
+    if (size < length)
+        out.append(length - size, L'0');
+    out.append(buffer, buffer + size);
+    return out;
+}
 
-    if (!(*this))
-        out = L"0";
-    else
-    {
-        std::pair<uint128_t, uint128_t> qr(*this, 0);
-        do
-        {
-            qr = uint128_t::divmod(qr.first, uint128_t(base));
-            out = L"0123456789abcdef"[(uint8_t)qr.second] + out;
-        } while (qr.first != 0);
-    }
+std::to_chars_result uint128_t::to_chars(char* first, char* last, size_t base) const noexcept
+{
+    if ((base < 2) || (base > 16))
+        return std::to_chars_result{ first, std::errc::invalid_argument };
 
-    if (out.size() < length)
-        out = std::wstring(length - out.size(), L'0') + out;
+    char buffer[128];
+    const uint64_t limbs[2] = { _upper, _lower };
+    size_t size = Internals::UIntToChars(limbs, 2, base, buffer);
+    if ((size_t)(last - first) < size)
+        return std::to_chars_result{ last, std::errc::value_too_large };
 
-    return out;
+    std::memcpy(first, buffer, size);
+    return std::to_chars_result{ first + size, std::errc() };
 }
 
-std::pair<uint128_t, uint128_t> uint128_t::divmod(const uint128_t& x, const uint128_t& y)
+std::from_chars_result uint128_t::from_chars(const char* first, const char* last, uint128_t& value, size_t base) noexcept
 {
-    if (y == 0)
-        throw std::domain_error("Division by 0");
-    else if (y == 1)
-        return std::pair<uint128_t, uint128_t>(x, 0);
-    else if (x == y)
-        return std::pair<uint128_t, uint128_t>(1, 0);
-    else if ((x == 0) || (x < y))
-        return std::pair<uint128_t, uint128_t>(0, x);
-
-    std::pair<uint128_t, uint128_t> result(0, 0);
-
-    for (size_t i = x.bits(); i > 0; --i)
-    {
-        result.first <<= 1;
-        result.second <<= 1;
+    uint64_t limbs[2];
+    std::from_chars_result result = Internals::UIntFromChars(first, last, limbs, 2, base);
+    if (result.ec == std::errc())
+        value = uint128_t(limbs[0], limbs[1]);
+    return result;
+}
 
-        if ((x >> (i - 1u)) & 1)
-            ++result.second;
+uint128_t uint128_t::parse(std::string_view str, size_t base)
+{
+    if ((base < 2) || (base > 16))
+        throw std::invalid_argument("Base must be in the range [2, 16]");
 
-        if (result.second >= y)
-        {
-            result.second -= y;
-            ++result.first;
-        }
-    }
+    uint128_t result;
+    std::from_chars_result parsed = from_chars(str.data(), str.data() + str.size(), result, base);
+    if (parsed.ec == std::errc::result_out_of_range)
+        throw std::out_of_range("Value is out of the 128-bit integer range");
+    if ((parsed.ec != std::errc()) || (parsed.ptr != (str.data() + str.size())))
+        throw std::invalid_argument("Invalid 128-bit integer string");
 
     return result;
 }
@@ -8,187 +8,80 @@
 
 #include "common/uint256.h"
 
-namespace CppCommon {
-
-uint256_t operator*(const uint256_t& value1, const uint256_t& value2) noexcept
-{
-    // Split values into four 32-bit parts
-    uint128_t top[4] = { value1.upper().upper(), value1.upper().lower(), value1.lower().upper(), value1.lower().lower() };
-    uint128_t bottom[4] = { value2.upper().upper(), value2.upper().lower(), value2.lower().upper(), value2.lower().lower() };
-    uint128_t products[4][4];
-
-    // Multiply each component of the values
-    for (int y = 3; y > -1; --y)
-        for (int x = 3; x > -1; --x)
-            products[3 - x][y] = top[x] * bottom[y];
-
-    // First row
-    uint128_t fourth64 = uint128_t(products[0][3].lower());
-    uint128_t third64  = uint128_t(products[0][2].lower()) + uint128_t(products[0][3].upper());
-    uint128_t second64 = uint128_t(products[0][1].lower()) + uint128_t(products[0][2].upper());
-    uint128_t first64  = uint128_t(products[0][0].lower()) + uint128_t(products[0][1].upper());
-
-    // Second row
-    third64  += uint128_t(products[1][3].lower());
-    second64 += uint128_t(products[1][2].lower()) + uint128_t(products[1][3].upper());
-    first64  += uint128_t(products[1][1].lower()) + uint128_t(products[1][2].upper());
-
-    // Third row
-    second64 += uint128_t(products[2][3].lower());
-    first64  += uint128_t(products[2][2].lower()) + uint128_t(products[2][3].upper());
-
-    // Fourth row
-    first64  += uint128_t(products[3][3].lower());
-
-    // Combines the values, taking care of carry over
-    return uint256_t(first64 << 64, 0) + uint256_t(third64.upper(), third64 << 64) + uint256_t(second64, 0) + uint256_t(fourth64);
-}
+#include <algorithm>
+#include <cstring>
 
-uint256_t operator<<(const uint256_t& value1, const uint256_t& value2) noexcept
-{
-    const uint128_t shift = value2._lower;
-
-    if (((bool)value2._upper) || (shift >= 256))
-        return 0;
-    else if (shift == 128)
-        return uint256_t(value1._lower, 0);
-    else if (shift == 0)
-        return value1;
-    else if (shift < 128)
-        return uint256_t((value1._upper << shift) + (value1._lower >> (128 - shift)), value1._lower << shift);
-    else if ((256 > shift) && (shift > 128))
-        return uint256_t(value1._lower << (shift - 128), 0);
-    else
-        return 0;
-}
+namespace CppCommon {
 
-uint256_t operator>>(const uint256_t& value1, const uint256_t& value2) noexcept
+std::string uint256_t::string(size_t base, size_t length) const
 {
-    const uint128_t shift = value2._lower;
-
-    if (((bool)value2._upper) || (shift >= 256))
-        return 0;
-    else if (shift == 128)
-        return uint256_t(value1._upper);
-    else if (shift == 0)
-        return value1;
-    else if (shift < 128)
-        return uint256_t(value1._upper >> shift, (value1._upper << (128 - shift)) + (value1._lower >> shift));
-    else if ((256 > shift) && (shift > 128))
-        return uint256_t(value1._upper >> (shift - 128));
-    else
-        return 0;
-}
+    if ((base < 2) || (base > 16))
+        throw std::invalid_argument("Base must be in the range [2, 16]");
 
-size_t uint256_t::bits() const noexcept
-{
-    size_t result = 0;
-
-    if (_upper)
-    {
-        result = 128;
-        uint128_t upper = _upper;
-        while (upper)
-        {
-            upper >>= 1;
-            ++result;
-        }
-    }
-    else
-    {
-        uint128_t lower = _lower;
-        while (lower)
-        {
-            lower >>= 1;
-            ++result;
-        }
-    }
+    char buffer[256];
+    const uint64_t limbs[4] = { _upper.upper(), _upper.lower(), _lower.upper(), _lower.lower() };
+    size_t size = Internals::UIntToChars(limbs, 4, base, buffer);
 
-    return result;
+    std::string out;
+    out.reserve(std::max(size, length));
+    if (size < length)
+        out.append(length - size, '0');
+    out.append(buffer, size);
+    return out;
 }
 
-std::string uint256_t::string(size_t base, size_t length) const
+std::wstring uint256_t::wstring(size_t base, size_t length) const
 {
     if ((base < 2) || (base > 16))
         throw std::invalid_argument("Base must be in the range [2, 16]");
 
-    std::string out;
-
-    if (!(*this))
-        out = "0";
-    else
-    {
-        std::pair<uint256_t, uint256_t> qr(*this, 0);
-        do
-        {
-            qr = uint256_t::divmod(qr.first, uint256_t(base));
-            out = "0123456789abcdef"[(uint8_t)qr.second] + out;
-        } while (qr.first != 0);
-    }
-
-    if (out.size() < length)
-        out = std::string(length - out.size(), '0') + out;
+    char buffer[256];
+    const uint64_t limbs[4] = { _upper.upper(), _upper.lower(), _lower.upper(), _lower.lower() };
+    size_t size = Internals::UIntToChars(limbs, 4, base, buffer);
 
+    std::wstring out;
+    out.reserve(std::max(size, length));
+    if (size < length)
+        out.append(length - size, L'0');
+    out.append(buffer, buffer + size);
     return out;
 }
 
-std::wstring uint256_t::wstring(size_t base, size_t length) const
+std::to_chars_result uint256_t::to_chars(char* first, char* last, size_t base) const noexcept
 {
     if ((base < 2) || (base > 16))
-        throw std::invalid_argument("Base must be in the range [2, 16]");
+        return std::to_chars_result{ first, std::errc::invalid_argument };
 
-    std::wstring out;
+    char buffer[256];
+    const uint64_t limbs[4] = { _upper.upper(), _upper.lower(), _lower.upper(), _lower.lower() };
+    size_t size = Internals::UIntToChars(limbs, 4, base, buffer);
+    if ((size_t)(last - first) < size)
+        return std::to_chars_result{ last, std::errc::value_too_large };
 
-    if (!(*this))
-        out = L"0";
-    else
-    {
-        std::pair<uint256_t, uint256_t> qr(*this, 0);
-        do
-        {
-            qr = uint256_t::divmod(qr.first, uint256_t(base));
-            out = L"0123456789abcdef"[(uint8_t)qr.second] + out;
-        } while (qr.first != 0);
-    }
-
-    if (out.size() < length)
-        out = std::wstring(length - out.size(), L'0') + out;
+    std::memcpy(first, buffer, size);
+    return std::to_chars_result{ first + size, std::errc() };
+}
 
-    return out;
+std::from_chars_result uint256_t::from_chars(const char* first, const char* last, uint256_t& value, size_t base) noexcept
+{
+    uint64_t limbs[4];
+    std::from_chars_result result = Internals::UIntFromChars(first, last, limbs, 4, base);
+    if (result.ec == std::errc())
+        value = uint256_t(limbs[0], limbs[1], limbs[2], limbs[3]);
+    return result;
 }
 
-std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& x, const uint256_t& y)
+uint256_t uint256_t::parse(std::string_view str, size_t base)
 {
-    if (y == 0)
-        throw std::domain_error("Division by 0");
-    else if (y == 1)
-        return std::pair<uint256_t, uint256_t>(x, 0);
-    else if (x == y)
-        return std::pair<uint256_t, uint256_t>(1, 0);
-    else if ((x == 0) || (x < y))
-        return std::pair<uint256_t, uint256_t>(0, x);
-
-    std::pair<uint256_t, uint256_t> result(0, x);
-    uint256_t delta = uint256_t(x.bits() - y.bits());
-    uint256_t copyd = y << delta;
-    uint256_t adder = 1 << delta;
-
-    if (copyd > result.second)
-    {
-        copyd >>= 1;
-        adder >>= 1;
-    }
-
-    while (result.second >= y)
-    {
-        if (result.second >= copyd)
-        {
-            result.second -= copyd;
-            result.first |= adder;
-        }
-        copyd >>= 1;
-        adder >>= 1;
-    }
+    if ((base < 2) || (base > 16))
+        throw std::invalid_argument("Base must be in the range [2, 16]");
+
+    uint256_t result;
+    std::from_chars_result parsed = from_chars(str.data(), str.data() + str.size(), result, base);
+    if (parsed.ec == std::errc::result_out_of_range)
+        throw std::out_of_range("Value is out of the 256-bit integer range");
+    if ((parsed.ec != std::errc()) || (parsed.ptr != (str.data() + str.size())))
+        throw std::invalid_argument("Invalid 256-bit integer string");
 
     return result;
 }
@@ -12,6 +12,21 @@
 
 namespace CppCommon {
 
+size_t Writer::WriteFrom(BufferChain& chain)
+{
+    size_t total = 0;
+    while (!chain.empty())
+    {
+        const BufferSlice& slice = chain.slices().front();
+        size_t size = slice.size();
+        size_t result = Write(slice.data(), size);
+        total += chain.Consume(result);
+        if (result < size)
+            break;
+    }
+    return total;
+}
+
 size_t Writer::Write(const std::string& text)
 {
     return Write(text.data(), text.size());
@@ -0,0 +1,519 @@
+/*!
+    \file compressed_sequence.cpp
+    \brief Compressed integer sequence container implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/compressed_sequence.h"
+
+#include "system/cpu_dispatch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Compressed sequence flat buffer header
+struct CompressedSequenceHeader
+{
+    uint8_t magic[8];
+    uint64_t size;
+    uint64_t blocks;
+    uint64_t words;
+};
+
+const uint8_t COMPRESSED_SEQUENCE_MAGIC[8] = { 'I', 'N', 'T', 'S', 'E', 'Q', '0', '1' };
+const size_t COMPRESSED_SEQUENCE_BLOCK = CompressedSequence::BLOCK;
+const uint32_t COMPRESSED_SEQUENCE_RAW = 64;
+
+// Get the count of packed words for the block
+inline size_t PackedWords(uint32_t bits, size_t count) noexcept
+{
+    return (bits == COMPRESSED_SEQUENCE_RAW) ? (count * 2) : (4 * (size_t)bits);
+}
+
+// Pack deltas into four interleaved 32-bit lanes: lane j keeps deltas j, j + 4, j + 8, ...
+void Pack(const uint32_t* deltas, uint32_t bits, uint32_t* output) noexcept
+{
+    if (bits == 0)
+        return;
+
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+        for (size_t m = 0; m < 32; ++m)
+        {
+            uint32_t value = deltas[m * 4 + lane];
+            size_t bit = m * bits;
+            size_t word = bit / 32;
+            size_t shift = bit % 32;
+            output[word * 4 + lane] |= value << shift;
+            if ((shift + bits) > 32)
+                output[(word + 1) * 4 + lane] |= value >> (32 - shift);
+        }
+    }
+}
+
+void UnpackScalar(const uint32_t* input, uint32_t bits, uint32_t* output) noexcept
+{
+    if (bits == 0)
+    {
+        std::memset(output, 0, COMPRESSED_SEQUENCE_BLOCK * sizeof(uint32_t));
+        return;
+    }
+
+    const uint32_t mask = (bits == 32) ? 0xFFFFFFFFu : ((1u << bits) - 1);
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+        for (size_t m = 0; m < 32; ++m)
+        {
+            size_t bit = m * bits;
+            size_t word = bit / 32;
+            size_t shift = bit % 32;
+            uint32_t value = input[word * 4 + lane] >> shift;
+            if ((shift + bits) > 32)
+                value |= input[(word + 1) * 4 + lane] << (32 - shift);
+            output[m * 4 + lane] = value & mask;
+        }
+    }
+}
+
+// Decode kernel restores values of the packed block
+typedef void (*DecodeFunction)(const uint32_t* words, uint32_t bits, uint64_t first, uint64_t* output, size_t count);
+
+void DecodeScalar(const uint32_t* words, uint32_t bits, uint64_t first, uint64_t* output, size_t count)
+{
+    uint32_t deltas[COMPRESSED_SEQUENCE_BLOCK];
+    UnpackScalar(words, bits, deltas);
+
+    uint64_t value = first;
+    for (size_t i = 0; i < count; ++i)
+        output[i] = (value += deltas[i]);
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Unpack four deltas of the given index in lanes
+template <uint32_t B, uint32_t M>
+CPU_TARGET("sse4.1")
+inline void UnpackStepSSE41(__m128i& current, const __m128i*& input, __m128i*& output)
+{
+    constexpr uint32_t shift = (M * B) % 32;
+
+    __m128i value = _mm_srli_epi32(current, shift);
+    if constexpr ((shift + B) >= 32)
+    {
+        if constexpr (M < 31)
+            current = _mm_loadu_si128(input++);
+        if constexpr ((shift + B) > 32)
+            value = _mm_or_si128(value, _mm_slli_epi32(current, 32 - shift));
+    }
+    if constexpr (B < 32)
+        value = _mm_and_si128(value, _mm_set1_epi32((int)((1u << B) - 1)));
+    _mm_storeu_si128(output++, value);
+}
+
+template <uint32_t B, uint32_t... M>
+CPU_TARGET("sse4.1")
+inline void UnpackStepsSSE41(const uint32_t* input, uint32_t* output, std::integer_sequence<uint32_t, M...>)
+{
+    const __m128i* in = (const __m128i*)input;
+    __m128i* out = (__m128i*)output;
+    __m128i current = _mm_loadu_si128(in++);
+    (UnpackStepSSE41<B, M>(current, in, out), ...);
+}
+
+template <uint32_t B>
+CPU_TARGET("sse4.1")
+void UnpackSSE41(const uint32_t* input, uint32_t* output)
+{
+    if constexpr (B == 0)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        for (size_t i = 0; i < COMPRESSED_SEQUENCE_BLOCK; i += 4)
+            _mm_storeu_si128((__m128i*)(output + i), zero);
+    }
+    else
+        UnpackStepsSSE41<B>(input, output, std::make_integer_sequence<uint32_t, 32>());
+}
+
+// Unpack kernels specialized for each bit width
+typedef void (*UnpackFunction)(const uint32_t* input, uint32_t* output);
+
+template <uint32_t... B>
+constexpr std::array<UnpackFunction, sizeof...(B)> UnpackTableSSE41(std::integer_sequence<uint32_t, B...>)
+{
+    return { UnpackSSE41<B>... };
+}
+
+const std::array<UnpackFunction, 33> UNPACK_SSE41 = UnpackTableSSE41(std::make_integer_sequence<uint32_t, 33>());
+
+CPU_TARGET("sse4.1")
+void DecodeSSE41(const uint32_t* words, uint32_t bits, uint64_t first, uint64_t* output, size_t count)
+{
+    alignas(16) uint32_t deltas[COMPRESSED_SEQUENCE_BLOCK];
+    UNPACK_SSE41[bits](words, deltas);
+
+    // Prefix sums of two 64-bit values
+    __m128i carry = _mm_set1_epi64x((long long)first);
+    size_t i = 0;
+    for (; (i + 2) <= count; i += 2)
+    {
+        __m128i v = _mm_cvtepu32_epi64(_mm_loadl_epi64((const __m128i*)(deltas + i)));
+        v = _mm_add_epi64(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi64(v, carry);
+        _mm_storeu_si128((__m128i*)(output + i), v);
+        carry = _mm_unpackhi_epi64(v, v);
+    }
+
+    uint64_t value = (uint64_t)_mm_cvtsi128_si64(carry);
+    for (; i < count; ++i)
+        output[i] = (value += deltas[i]);
+}
+
+CPU_TARGET("avx2")
+void DecodeAVX2(const uint32_t* words, uint32_t bits, uint64_t first, uint64_t* output, size_t count)
+{
+    alignas(32) uint32_t deltas[COMPRESSED_SEQUENCE_BLOCK];
+    UNPACK_SSE41[bits](words, deltas);
+
+    // Prefix sums of four 64-bit values
+    __m256i carry = _mm256_set1_epi64x((long long)first);
+    size_t i = 0;
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m256i v = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i*)(deltas + i)));
+        v = _mm256_add_epi64(v, _mm256_slli_si256(v, 8));
+        v = _mm256_add_epi64(v, _mm256_blend_epi32(_mm256_setzero_si256(), _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1, 1, 1, 1)), 0xF0));
+        v = _mm256_add_epi64(v, carry);
+        _mm256_storeu_si256((__m256i*)(output + i), v);
+        carry = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    uint64_t value = (uint64_t)_mm_cvtsi128_si64(_mm256_castsi256_si128(carry));
+    for (; i < count; ++i)
+        output[i] = (value += deltas[i]);
+}
+
+#endif
+
+DecodeFunction ResolveDecode([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return DecodeAVX2;
+    if (features.sse41)
+        return DecodeSSE41;
+#endif
+    return DecodeScalar;
+}
+
+} // namespace Internals
+//! @endcond
+
+CompressedSequence::CompressedSequence() : CompressedSequence(std::span<const uint64_t>())
+{
+}
+
+CompressedSequence::CompressedSequence(std::span<const uint64_t> values)
+{
+    using namespace Internals;
+
+    for (size_t i = 1; i < values.size(); ++i)
+        if (values[i] < values[i - 1])
+            throw std::invalid_argument("Compressed sequence values must be sorted!");
+
+    // Calculate bit widths and offsets of blocks
+    size_t blocks = (values.size() + BLOCK - 1) / BLOCK;
+    std::vector<Block> index(blocks);
+    size_t words = 0;
+    for (size_t block = 0; block < blocks; ++block)
+    {
+        size_t begin = block * BLOCK;
+        size_t end = std::min(begin + BLOCK, values.size());
+
+        uint64_t delta = 0;
+        for (size_t i = begin + 1; i < end; ++i)
+            delta = std::max(delta, values[i] - values[i - 1]);
+
+        uint32_t bits = (uint32_t)std::bit_width(delta);
+        if (bits > 32)
+            bits = COMPRESSED_SEQUENCE_RAW;
+
+        index[block].first = values[begin];
+        index[block].offset = (uint32_t)words;
+        index[block].bits = bits;
+        words += PackedWords(bits, end - begin);
+        if (words > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("Compressed sequence is too large!");
+    }
+
+    // Layout the flat buffer
+    size_t bytes = sizeof(CompressedSequenceHeader) + blocks * sizeof(Block) + words * sizeof(uint32_t);
+    _storage.assign((bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+    uint8_t* data = (uint8_t*)_storage.data();
+
+    CompressedSequenceHeader header;
+    std::memcpy(header.magic, COMPRESSED_SEQUENCE_MAGIC, sizeof(header.magic));
+    header.size = values.size();
+    header.blocks = blocks;
+    header.words = words;
+    std::memcpy(data, &header, sizeof(header));
+    if (blocks > 0)
+        std::memcpy(data + sizeof(header), index.data(), blocks * sizeof(Block));
+
+    // Pack blocks
+    uint32_t* packed = (uint32_t*)(data + sizeof(header) + blocks * sizeof(Block));
+    for (size_t block = 0; block < blocks; ++block)
+    {
+        size_t begin = block * BLOCK;
+        size_t end = std::min(begin + BLOCK, values.size());
+        uint32_t* output = packed + index[block].offset;
+
+        if (index[block].bits == COMPRESSED_SEQUENCE_RAW)
+        {
+            std::memcpy(output, values.data() + begin, (end - begin) * sizeof(uint64_t));
+            continue;
+        }
+
+        uint32_t deltas[BLOCK] = { 0 };
+        for (size_t i = begin + 1; i < end; ++i)
+            deltas[i - begin] = (uint32_t)(values[i] - values[i - 1]);
+        Pack(deltas, index[block].bits, output);
+    }
+
+    Attach(data, bytes);
+}
+
+CompressedSequence::CompressedSequence(const CompressedSequence& sequence) : _storage(sequence._storage)
+{
+    if (sequence.mapped())
+        Attach(sequence._data, sequence._bytes);
+    else
+        Attach((const uint8_t*)_storage.data(), sequence._bytes);
+}
+
+CompressedSequence::CompressedSequence(CompressedSequence&& sequence) noexcept
+    : _storage(std::move(sequence._storage)),
+      _data(sequence._data),
+      _bytes(sequence._bytes),
+      _size(sequence._size),
+      _blocks(sequence._blocks),
+      _index(sequence._index),
+      _words(sequence._words)
+{
+    sequence._storage.clear();
+    sequence._data = nullptr;
+    sequence._bytes = 0;
+    sequence._size = 0;
+    sequence._blocks = 0;
+    sequence._index = nullptr;
+    sequence._words = nullptr;
+}
+
+CompressedSequence& CompressedSequence::operator=(const CompressedSequence& sequence)
+{
+    CompressedSequence(sequence).swap(*this);
+    return *this;
+}
+
+CompressedSequence& CompressedSequence::operator=(CompressedSequence&& sequence) noexcept
+{
+    CompressedSequence(std::move(sequence)).swap(*this);
+    return *this;
+}
+
+void CompressedSequence::Attach(const uint8_t* data, size_t bytes) noexcept
+{
+    Internals::CompressedSequenceHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    _data = data;
+    _bytes = bytes;
+    _size = (size_t)header.size;
+    _blocks = (size_t)header.blocks;
+    _index = (const Block*)(data + sizeof(header));
+    _words = (const uint32_t*)(data + sizeof(header) + _blocks * sizeof(Block));
+}
+
+CompressedSequence CompressedSequence::Open(std::span<const uint8_t> buffer)
+{
+    using namespace Internals;
+
+    CompressedSequenceHeader header;
+    if ((buffer.size() < sizeof(header)) || (((uintptr_t)buffer.data() % alignof(uint64_t)) != 0))
+        throw std::invalid_argument("Invalid compressed sequence buffer!");
+
+    std::memcpy(&header, buffer.data(), sizeof(header));
+    if ((std::memcmp(header.magic, COMPRESSED_SEQUENCE_MAGIC, sizeof(header.magic)) != 0) ||
+        (header.blocks != ((header.size + BLOCK - 1) / BLOCK)) ||
+        (header.words > std::numeric_limits<uint32_t>::max()) ||
+        (header.blocks > ((buffer.size() - sizeof(header)) / sizeof(Block))) ||
+        ((buffer.size() - sizeof(header) - header.blocks * sizeof(Block)) / sizeof(uint32_t) < header.words))
+        throw std::invalid_argument("Invalid compressed sequence header!");
+
+    CompressedSequence result(buffer.data(), sizeof(header) + (size_t)header.blocks * sizeof(Block) + (size_t)header.words * sizeof(uint32_t));
+
+    // Validate the skip index
+    for (size_t block = 0; block < result._blocks; ++block)
+    {
+        const Block& current = result._index[block];
+        bool valid = ((current.bits <= 32) || (current.bits == COMPRESSED_SEQUENCE_RAW)) &&
+                     (((size_t)current.offset + PackedWords(current.bits, result.count(block))) <= header.words) &&
+                     ((block == 0) || (result._index[block - 1].first <= current.first));
+        if (!valid)
+            throw std::invalid_argument("Invalid compressed sequence block!");
+    }
+
+    return result;
+}
+
+uint64_t CompressedSequence::operator[](size_t index) const noexcept
+{
+    assert((index < _size) && "Index out of bounds!");
+
+    uint64_t values[BLOCK];
+    Decode(index / BLOCK, values);
+    return values[index % BLOCK];
+}
+
+uint64_t CompressedSequence::at(size_t index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of bounds of the compressed sequence!");
+
+    return operator[](index);
+}
+
+uint64_t CompressedSequence::front() const noexcept
+{
+    assert(!empty() && "Compressed sequence is empty!");
+
+    return _index[0].first;
+}
+
+uint64_t CompressedSequence::back() const noexcept
+{
+    assert(!empty() && "Compressed sequence is empty!");
+
+    return operator[](_size - 1);
+}
+
+size_t CompressedSequence::Decode(size_t block, uint64_t* output) const noexcept
+{
+    static CPUDispatch<void(const uint32_t*, uint32_t, uint64_t, uint64_t*, size_t)> dispatch(Internals::ResolveDecode);
+
+    assert((block < _blocks) && "Block index out of bounds!");
+
+    const Block& current = _index[block];
+    size_t values = count(block);
+    if (current.bits == Internals::COMPRESSED_SEQUENCE_RAW)
+        std::memcpy(output, _words + current.offset, values * sizeof(uint64_t));
+    else
+        dispatch(_words + current.offset, current.bits, current.first, output, values);
+    return values;
+}
+
+std::vector<uint64_t> CompressedSequence::Decode() const
+{
+    std::vector<uint64_t> result(_size);
+    for (size_t block = 0; block < _blocks; ++block)
+        Decode(block, result.data() + block * BLOCK);
+    return result;
+}
+
+size_t CompressedSequence::lower_bound(uint64_t value) const noexcept
+{
+    // Find the first block which starts with the value not less than the given one
+    const Block* block = std::lower_bound(_index, _index + _blocks, value, [](const Block& current, uint64_t key) { return current.first < key; });
+    size_t next = (size_t)(block - _index);
+    if (next == 0)
+        return 0;
+
+    // The previous block could contain the found value
+    uint64_t values[BLOCK];
+    size_t count = Decode(next - 1, values);
+    size_t position = (size_t)(std::lower_bound(values, values + count, value) - values);
+    return (next - 1) * BLOCK + position;
+}
+
+size_t CompressedSequence::upper_bound(uint64_t value) const noexcept
+{
+    // Find the first block which starts with the value greater than the given one
+    const Block* block = std::upper_bound(_index, _index + _blocks, value, [](uint64_t key, const Block& current) { return key < current.first; });
+    size_t next = (size_t)(block - _index);
+    if (next == 0)
+        return 0;
+
+    // The previous block could contain the found value
+    uint64_t values[BLOCK];
+    size_t count = Decode(next - 1, values);
+    size_t position = (size_t)(std::upper_bound(values, values + count, value) - values);
+    return (next - 1) * BLOCK + position;
+}
+
+bool CompressedSequence::contains(uint64_t value) const noexcept
+{
+    // The last block which starts with the value not greater than the given one contains it
+    const Block* block = std::upper_bound(_index, _index + _blocks, value, [](uint64_t key, const Block& current) { return key < current.first; });
+    size_t next = (size_t)(block - _index);
+    if (next == 0)
+        return false;
+
+    uint64_t values[BLOCK];
+    size_t count = Decode(next - 1, values);
+    return std::binary_search(values, values + count, value);
+}
+
+CompressedSequence::const_iterator CompressedSequence::begin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+CompressedSequence::const_iterator CompressedSequence::cbegin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+CompressedSequence::const_iterator CompressedSequence::end() const noexcept
+{
+    return const_iterator(this, _size);
+}
+
+CompressedSequence::const_iterator CompressedSequence::cend() const noexcept
+{
+    return const_iterator(this, _size);
+}
+
+void CompressedSequence::swap(CompressedSequence& sequence) noexcept
+{
+    using std::swap;
+    swap(_storage, sequence._storage);
+    swap(_data, sequence._data);
+    swap(_bytes, sequence._bytes);
+    swap(_size, sequence._size);
+    swap(_blocks, sequence._blocks);
+    swap(_index, sequence._index);
+    swap(_words, sequence._words);
+}
+
+CompressedSequenceIterator::CompressedSequenceIterator(const CompressedSequence* container, size_t index) noexcept
+    : _container(container), _index(index), _block(index / CompressedSequence::BLOCK), _count(0)
+{
+    if (_index < _container->size())
+        _count = _container->Decode(_block, _values.data());
+}
+
+} // namespace CppCommon
@@ -0,0 +1,1189 @@
+/*!
+    \file roaring_bitmap.cpp
+    \brief Roaring compressed bitmap container implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/roaring_bitmap.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+enum class BitmapOperation
+{
+    AND,
+    OR,
+    XOR,
+    ANDNOT
+};
+
+template <BitmapOperation operation>
+inline uint64_t BitmapWord(uint64_t word1, uint64_t word2) noexcept
+{
+    if constexpr (operation == BitmapOperation::AND)
+        return word1 & word2;
+    else if constexpr (operation == BitmapOperation::OR)
+        return word1 | word2;
+    else if constexpr (operation == BitmapOperation::XOR)
+        return word1 ^ word2;
+    else
+        return word1 & ~word2;
+}
+
+#if defined(__AVX2__)
+
+template <BitmapOperation operation>
+inline __m256i BitmapVector(__m256i vector1, __m256i vector2) noexcept
+{
+    if constexpr (operation == BitmapOperation::AND)
+        return _mm256_and_si256(vector1, vector2);
+    else if constexpr (operation == BitmapOperation::OR)
+        return _mm256_or_si256(vector1, vector2);
+    else if constexpr (operation == BitmapOperation::XOR)
+        return _mm256_xor_si256(vector1, vector2);
+    else
+        return _mm256_andnot_si256(vector2, vector1);
+}
+
+// Count bits of each 64-bit lane with the nibble lookup table (Wojciech Mula algorithm)
+inline __m256i BitmapPopcount(__m256i vector) noexcept
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    __m256i low = _mm256_and_si256(vector, mask);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(vector, 4), mask);
+    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+inline uint32_t BitmapSum(__m256i vector) noexcept
+{
+    return (uint32_t)(_mm256_extract_epi64(vector, 0) + _mm256_extract_epi64(vector, 1) + _mm256_extract_epi64(vector, 2) + _mm256_extract_epi64(vector, 3));
+}
+
+#endif
+
+//! Perform the operation on two bitmaps and return the result cardinality
+template <BitmapOperation operation>
+inline uint32_t BitmapCombine(const uint64_t* words1, const uint64_t* words2, uint64_t* result, size_t count) noexcept
+{
+    size_t i = 0;
+    uint32_t cardinality = 0;
+#if defined(__AVX2__)
+    __m256i counts = _mm256_setzero_si256();
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m256i vector = BitmapVector<operation>(_mm256_loadu_si256((const __m256i*)(words1 + i)), _mm256_loadu_si256((const __m256i*)(words2 + i)));
+        _mm256_storeu_si256((__m256i*)(result + i), vector);
+        counts = _mm256_add_epi64(counts, BitmapPopcount(vector));
+    }
+    cardinality += BitmapSum(counts);
+#endif
+    for (; i < count; ++i)
+    {
+        result[i] = BitmapWord<operation>(words1[i], words2[i]);
+        cardinality += (uint32_t)std::popcount(result[i]);
+    }
+    return cardinality;
+}
+
+//! Calculate the cardinality of the operation on two bitmaps without storing the result
+template <BitmapOperation operation>
+inline uint32_t BitmapCombineCardinality(const uint64_t* words1, const uint64_t* words2, size_t count) noexcept
+{
+    size_t i = 0;
+    uint32_t cardinality = 0;
+#if defined(__AVX2__)
+    __m256i counts = _mm256_setzero_si256();
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m256i vector = BitmapVector<operation>(_mm256_loadu_si256((const __m256i*)(words1 + i)), _mm256_loadu_si256((const __m256i*)(words2 + i)));
+        counts = _mm256_add_epi64(counts, BitmapPopcount(vector));
+    }
+    cardinality += BitmapSum(counts);
+#endif
+    for (; i < count; ++i)
+        cardinality += (uint32_t)std::popcount(BitmapWord<operation>(words1[i], words2[i]));
+    return cardinality;
+}
+
+//! Calculate the bitmap cardinality
+inline uint32_t BitmapCardinality(const uint64_t* words, size_t count) noexcept
+{
+    size_t i = 0;
+    uint32_t cardinality = 0;
+#if defined(__AVX2__)
+    __m256i counts = _mm256_setzero_si256();
+    for (; (i + 4) <= count; i += 4)
+        counts = _mm256_add_epi64(counts, BitmapPopcount(_mm256_loadu_si256((const __m256i*)(words + i))));
+    cardinality += BitmapSum(counts);
+#endif
+    for (; i < count; ++i)
+        cardinality += (uint32_t)std::popcount(words[i]);
+    return cardinality;
+}
+
+//! Set bits of the given inclusive range in the bitmap
+inline void BitmapSetRange(uint64_t* words, uint32_t first, uint32_t last) noexcept
+{
+    uint32_t first_word = first >> 6;
+    uint32_t last_word = last >> 6;
+    uint64_t first_mask = ~0ull << (first & 63);
+    uint64_t last_mask = ~0ull >> (63 - (last & 63));
+    if (first_word == last_word)
+    {
+        words[first_word] |= first_mask & last_mask;
+        return;
+    }
+    words[first_word] |= first_mask;
+    for (uint32_t i = first_word + 1; i < last_word; ++i)
+        words[i] = ~0ull;
+    words[last_word] |= last_mask;
+}
+
+inline bool BitmapTest(const uint64_t* words, uint16_t low) noexcept
+{
+    return ((words[low >> 6] >> (low & 63)) & 1) != 0;
+}
+
+//! Find the run which contains the given value in the array of run pairs
+inline bool RunsContain(const uint16_t* runs, size_t count, uint16_t low) noexcept
+{
+    // Find the last run which starts not after the given value
+    size_t first = 0;
+    size_t last = count;
+    while (first < last)
+    {
+        size_t middle = (first + last) / 2;
+        if (runs[2 * middle] <= low)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    return (first > 0) && ((uint32_t)low <= ((uint32_t)runs[2 * (first - 1)] + runs[2 * (first - 1) + 1]));
+}
+
+//! Intersect two sorted arrays and return the result size (result could be nullptr to count only)
+inline size_t ArrayIntersect(const uint16_t* array1, size_t size1, const uint16_t* array2, size_t size2, uint16_t* result) noexcept
+{
+    if (size1 > size2)
+    {
+        std::swap(array1, array2);
+        std::swap(size1, size2);
+    }
+
+    size_t count = 0;
+
+    // Gallop through the much bigger array with binary search
+    if ((size1 * 64) < size2)
+    {
+        const uint16_t* current = array2;
+        const uint16_t* end = array2 + size2;
+        for (size_t i = 0; i < size1; ++i)
+        {
+            current = std::lower_bound(current, end, array1[i]);
+            if (current == end)
+                break;
+            if (*current == array1[i])
+            {
+                if (result != nullptr)
+                    result[count] = array1[i];
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // Merge arrays
+    size_t i = 0;
+    size_t j = 0;
+    while ((i < size1) && (j < size2))
+    {
+        if (array1[i] < array2[j])
+            ++i;
+        else if (array2[j] < array1[i])
+            ++j;
+        else
+        {
+            if (result != nullptr)
+                result[count] = array1[i];
+            ++count;
+            ++i;
+            ++j;
+        }
+    }
+    return count;
+}
+
+struct SerializedHeader
+{
+    uint32_t magic;
+    uint32_t count;
+};
+
+struct SerializedContainer
+{
+    uint16_t key;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t cardinality;
+    uint32_t offset;
+    uint32_t length;
+};
+
+const uint32_t SERIALIZED_MAGIC = 0x314D4252; // "RBM1"
+
+inline size_t SerializedAlign(size_t offset) noexcept
+{
+    return (offset + 7) & ~(size_t)7;
+}
+
+//! Validate the serialized buffer and return the count of containers
+inline uint32_t SerializedValidate(const uint8_t* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size < sizeof(SerializedHeader)) || (((uintptr_t)buffer & 7) != 0))
+        throw std::invalid_argument("Invalid roaring bitmap serialized buffer!");
+
+    SerializedHeader header;
+    std::memcpy(&header, buffer, sizeof(header));
+    if ((header.magic != SERIALIZED_MAGIC) || (header.count > 65536) || ((sizeof(SerializedHeader) + header.count * sizeof(SerializedContainer)) > size))
+        throw std::invalid_argument("Invalid roaring bitmap serialized header!");
+
+    for (uint32_t i = 0; i < header.count; ++i)
+    {
+        SerializedContainer container;
+        std::memcpy(&container, buffer + sizeof(SerializedHeader) + i * sizeof(SerializedContainer), sizeof(container));
+
+        size_t item = (container.type == 1) ? sizeof(uint64_t) : sizeof(uint16_t);
+        bool valid = (container.type <= 2) && ((container.offset & 7) == 0) && (container.offset <= size) && ((container.length * item) <= (size - container.offset));
+        if (valid && (i > 0))
+        {
+            SerializedContainer previous;
+            std::memcpy(&previous, buffer + sizeof(SerializedHeader) + (i - 1) * sizeof(SerializedContainer), sizeof(previous));
+            valid = (previous.key < container.key);
+        }
+        if (!valid)
+            throw std::invalid_argument("Invalid roaring bitmap serialized container!");
+    }
+
+    return header.count;
+}
+
+inline SerializedContainer SerializedDescriptor(const uint8_t* buffer, size_t index) noexcept
+{
+    SerializedContainer container;
+    std::memcpy(&container, buffer + sizeof(SerializedHeader) + index * sizeof(SerializedContainer), sizeof(container));
+    return container;
+}
+
+} // namespace Internals
+//! @endcond
+
+RoaringBitmap::RoaringBitmap(std::initializer_list<uint32_t> values)
+{
+    for (uint32_t value : values)
+        add(value);
+}
+
+uint64_t RoaringBitmap::cardinality() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& container : _containers)
+        result += container.cardinality;
+    return result;
+}
+
+uint32_t RoaringBitmap::minimum() const noexcept
+{
+    assert(!empty() && "Roaring bitmap is empty!");
+
+    const Container& container = _containers.front();
+    uint32_t high = (uint32_t)container.key << 16;
+    if (container.type != ContainerType::BITMAP)
+        return high | container.values.front();
+
+    for (size_t i = 0; i < BITMAP_WORDS; ++i)
+        if (container.words[i] != 0)
+            return high | (uint32_t)(i * 64 + std::countr_zero(container.words[i]));
+    return high;
+}
+
+uint32_t RoaringBitmap::maximum() const noexcept
+{
+    assert(!empty() && "Roaring bitmap is empty!");
+
+    const Container& container = _containers.back();
+    uint32_t high = (uint32_t)container.key << 16;
+    if (container.type == ContainerType::ARRAY)
+        return high | container.values.back();
+    if (container.type == ContainerType::RUN)
+        return high | ((uint32_t)container.values[container.values.size() - 2] + container.values.back());
+
+    for (size_t i = BITMAP_WORDS; i-- > 0;)
+        if (container.words[i] != 0)
+            return high | (uint32_t)(i * 64 + 63 - std::countl_zero(container.words[i]));
+    return high;
+}
+
+RoaringBitmap::iterator RoaringBitmap::begin() const noexcept
+{
+    return iterator(this, 0);
+}
+
+RoaringBitmap::const_iterator RoaringBitmap::cbegin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+RoaringBitmap::iterator RoaringBitmap::end() const noexcept
+{
+    return iterator(this, _containers.size());
+}
+
+RoaringBitmap::const_iterator RoaringBitmap::cend() const noexcept
+{
+    return const_iterator(this, _containers.size());
+}
+
+size_t RoaringBitmap::find_internal(uint16_t key) const noexcept
+{
+    auto it = std::lower_bound(_containers.begin(), _containers.end(), key, [](const Container& container, uint16_t k) { return container.key < k; });
+    return it - _containers.begin();
+}
+
+bool RoaringBitmap::contains(uint32_t value) const noexcept
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    size_t index = find_internal(key);
+    if ((index == _containers.size()) || (_containers[index].key != key))
+        return false;
+
+    return contains_internal(_containers[index], (uint16_t)value);
+}
+
+bool RoaringBitmap::contains_internal(const Container& container, uint16_t low) noexcept
+{
+    switch (container.type)
+    {
+        case ContainerType::ARRAY:
+            return std::binary_search(container.values.begin(), container.values.end(), low);
+        case ContainerType::BITMAP:
+            return Internals::BitmapTest(container.words.data(), low);
+        case ContainerType::RUN:
+            return Internals::RunsContain(container.values.data(), container.values.size() / 2, low);
+    }
+    return false;
+}
+
+bool RoaringBitmap::add(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+
+    size_t index = find_internal(key);
+    if ((index == _containers.size()) || (_containers[index].key != key))
+    {
+        // Create a new array container
+        Container container{ key, ContainerType::ARRAY, 1, { low }, {} };
+        _containers.insert(_containers.begin() + index, std::move(container));
+        return true;
+    }
+
+    Container& container = _containers[index];
+
+    // Run container is expanded before modification
+    if (container.type == ContainerType::RUN)
+    {
+        if (contains_internal(container, low))
+            return false;
+        to_bitmap_internal(container);
+        normalize_internal(container);
+    }
+
+    if (container.type == ContainerType::ARRAY)
+    {
+        auto it = std::lower_bound(container.values.begin(), container.values.end(), low);
+        if ((it != container.values.end()) && (*it == low))
+            return false;
+        container.values.insert(it, low);
+        if (++container.cardinality > ARRAY_LIMIT)
+            to_bitmap_internal(container);
+        return true;
+    }
+
+    uint64_t& word = container.words[low >> 6];
+    uint64_t bit = 1ull << (low & 63);
+    if ((word & bit) != 0)
+        return false;
+    word |= bit;
+    ++container.cardinality;
+    return true;
+}
+
+void RoaringBitmap::add_range(uint32_t first, uint32_t last)
+{
+    if (first > last)
+        return;
+
+    for (uint32_t key = first >> 16; key <= (last >> 16); ++key)
+    {
+        uint16_t low = (key == (first >> 16)) ? (uint16_t)first : 0;
+        uint16_t high = (key == (last >> 16)) ? (uint16_t)last : 0xFFFF;
+
+        size_t index = find_internal((uint16_t)key);
+        if ((index == _containers.size()) || (_containers[index].key != key))
+        {
+            // Create a new run container with a single run
+            Container container{ (uint16_t)key, ContainerType::RUN, (uint32_t)(high - low + 1), { low, (uint16_t)(high - low) }, {} };
+            _containers.insert(_containers.begin() + index, std::move(container));
+        }
+        else
+        {
+            // Merge the range into the existing container
+            Container& container = _containers[index];
+            to_bitmap_internal(container);
+            Internals::BitmapSetRange(container.words.data(), low, high);
+            container.cardinality = Internals::BitmapCardinality(container.words.data(), BITMAP_WORDS);
+            normalize_internal(container);
+        }
+
+        // Avoid the overflow of the key counter
+        if (key == 0xFFFF)
+            break;
+    }
+}
+
+bool RoaringBitmap::remove(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+
+    size_t index = find_internal(key);
+    if ((index == _containers.size()) || (_containers[index].key != key))
+        return false;
+
+    Container& container = _containers[index];
+    if (!contains_internal(container, low))
+        return false;
+
+    // Run container is expanded before modification
+    if (container.type == ContainerType::RUN)
+    {
+        to_bitmap_internal(container);
+        normalize_internal(container);
+    }
+
+    if (container.type == ContainerType::ARRAY)
+        container.values.erase(std::lower_bound(container.values.begin(), container.values.end(), low));
+    else
+        container.words[low >> 6] &= ~(1ull << (low & 63));
+
+    if (--container.cardinality == 0)
+        _containers.erase(_containers.begin() + index);
+    else
+        normalize_internal(container);
+
+    return true;
+}
+
+void RoaringBitmap::to_bitmap_internal(Container& container)
+{
+    if (container.type == ContainerType::BITMAP)
+        return;
+
+    std::vector<uint64_t> words(BITMAP_WORDS, 0);
+    if (container.type == ContainerType::ARRAY)
+    {
+        for (uint16_t low : container.values)
+            words[low >> 6] |= 1ull << (low & 63);
+    }
+    else
+    {
+        for (size_t i = 0; i < container.values.size(); i += 2)
+            Internals::BitmapSetRange(words.data(), container.values[i], (uint32_t)container.values[i] + container.values[i + 1]);
+    }
+
+    container.type = ContainerType::BITMAP;
+    container.words.swap(words);
+    std::vector<uint16_t>().swap(container.values);
+}
+
+void RoaringBitmap::normalize_internal(Container& container)
+{
+    if ((container.type == ContainerType::ARRAY) && (container.cardinality > ARRAY_LIMIT))
+        to_bitmap_internal(container);
+    else if ((container.type == ContainerType::BITMAP) && (container.cardinality <= ARRAY_LIMIT))
+    {
+        // Convert the sparse bitmap into the array
+        std::vector<uint16_t> values;
+        values.reserve(container.cardinality);
+        for (size_t i = 0; i < BITMAP_WORDS; ++i)
+            for (uint64_t word = container.words[i]; word != 0; word &= (word - 1))
+                values.push_back((uint16_t)(i * 64 + std::countr_zero(word)));
+
+        container.type = ContainerType::ARRAY;
+        container.values.swap(values);
+        std::vector<uint64_t>().swap(container.words);
+    }
+}
+
+uint32_t RoaringBitmap::runs_internal(const Container& container) noexcept
+{
+    uint32_t runs = 0;
+    switch (container.type)
+    {
+        case ContainerType::ARRAY:
+            for (size_t i = 0; i < container.values.size(); ++i)
+                if ((i == 0) || (container.values[i] != (container.values[i - 1] + 1)))
+                    ++runs;
+            break;
+        case ContainerType::BITMAP:
+        {
+            // Count bits which start runs (set bits with unset previous bits)
+            uint64_t carry = 0;
+            for (size_t i = 0; i < BITMAP_WORDS; ++i)
+            {
+                uint64_t word = container.words[i];
+                runs += (uint32_t)std::popcount(word & ~((word << 1) | carry));
+                carry = word >> 63;
+            }
+            break;
+        }
+        case ContainerType::RUN:
+            runs = (uint32_t)(container.values.size() / 2);
+            break;
+    }
+    return runs;
+}
+
+bool RoaringBitmap::run_optimize()
+{
+    bool changed = false;
+    for (auto& container : _containers)
+    {
+        uint32_t runs = runs_internal(container);
+        size_t run_size = 4 * (size_t)runs;
+        size_t other_size = (container.cardinality <= ARRAY_LIMIT) ? (2 * (size_t)container.cardinality) : (8 * BITMAP_WORDS);
+
+        if (container.type == ContainerType::RUN)
+        {
+            // Expand the run container which is not compact anymore
+            if (run_size >= other_size)
+            {
+                to_bitmap_internal(container);
+                normalize_internal(container);
+                changed = true;
+            }
+            continue;
+        }
+
+        if (run_size < other_size)
+        {
+            to_bitmap_internal(container);
+
+            // Build runs from the bitmap
+            std::vector<uint16_t> values;
+            values.reserve(2 * (size_t)runs);
+            uint32_t low = 0;
+            while (low < 65536)
+            {
+                // Find the next set bit
+                size_t index = low >> 6;
+                uint64_t word = container.words[index] & (~0ull << (low & 63));
+                while ((word == 0) && (++index < BITMAP_WORDS))
+                    word = container.words[index];
+                if (word == 0)
+                    break;
+                uint32_t start = (uint32_t)(index * 64 + std::countr_zero(word));
+
+                // Find the next unset bit
+                index = start >> 6;
+                word = ~container.words[index] & (~0ull << (start & 63));
+                while ((word == 0) && (++index < BITMAP_WORDS))
+                    word = ~container.words[index];
+                uint32_t end = (word == 0) ? 65536 : (uint32_t)(index * 64 + std::countr_zero(word));
+
+                values.push_back((uint16_t)start);
+                values.push_back((uint16_t)(end - start - 1));
+                low = end;
+            }
+
+            container.type = ContainerType::RUN;
+            container.values.swap(values);
+            std::vector<uint64_t>().swap(container.words);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+void RoaringBitmap::shrink_to_fit()
+{
+    _containers.shrink_to_fit();
+    for (auto& container : _containers)
+        container.values.shrink_to_fit();
+}
+
+RoaringBitmap::Container RoaringBitmap::and_internal(const Container& container1, const Container& container2)
+{
+    Container result{ container1.key, ContainerType::ARRAY, 0, {}, {} };
+
+    if ((container1.type == ContainerType::ARRAY) && (container2.type == ContainerType::ARRAY))
+    {
+        result.values.resize(std::min(container1.values.size(), container2.values.size()));
+        result.cardinality = (uint32_t)Internals::ArrayIntersect(container1.values.data(), container1.values.size(), container2.values.data(), container2.values.size(), result.values.data());
+        result.values.resize(result.cardinality);
+    }
+    else if ((container1.type == ContainerType::ARRAY) || (container2.type == ContainerType::ARRAY))
+    {
+        // Filter array values by the bitmap
+        const Container& array = (container1.type == ContainerType::ARRAY) ? container1 : container2;
+        const Container& bitmap = (container1.type == ContainerType::ARRAY) ? container2 : container1;
+        result.values.reserve(array.values.size());
+        for (uint16_t low : array.values)
+            if (Internals::BitmapTest(bitmap.words.data(), low))
+                result.values.push_back(low);
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else
+    {
+        result.type = ContainerType::BITMAP;
+        result.words.resize(BITMAP_WORDS);
+        result.cardinality = Internals::BitmapCombine<Internals::BitmapOperation::AND>(container1.words.data(), container2.words.data(), result.words.data(), BITMAP_WORDS);
+        normalize_internal(result);
+    }
+
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::or_internal(const Container& container1, const Container& container2)
+{
+    Container result{ container1.key, ContainerType::ARRAY, 0, {}, {} };
+
+    if ((container1.type == ContainerType::ARRAY) && (container2.type == ContainerType::ARRAY) && ((container1.cardinality + container2.cardinality) <= ARRAY_LIMIT))
+    {
+        result.values.resize(container1.values.size() + container2.values.size());
+        auto it = std::set_union(container1.values.begin(), container1.values.end(), container2.values.begin(), container2.values.end(), result.values.begin());
+        result.values.resize(it - result.values.begin());
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else if ((container1.type == ContainerType::BITMAP) && (container2.type == ContainerType::BITMAP))
+    {
+        result.type = ContainerType::BITMAP;
+        result.words.resize(BITMAP_WORDS);
+        result.cardinality = Internals::BitmapCombine<Internals::BitmapOperation::OR>(container1.words.data(), container2.words.data(), result.words.data(), BITMAP_WORDS);
+    }
+    else
+    {
+        // Set array values in the bitmap
+        result = (container1.type == ContainerType::BITMAP) ? container1 : container2;
+        const Container& other = (container1.type == ContainerType::BITMAP) ? container2 : container1;
+        to_bitmap_internal(result);
+        for (uint16_t low : other.values)
+        {
+            uint64_t& word = result.words[low >> 6];
+            uint64_t bit = 1ull << (low & 63);
+            result.cardinality += ((word & bit) == 0) ? 1 : 0;
+            word |= bit;
+        }
+        result.key = container1.key;
+    }
+
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::xor_internal(const Container& container1, const Container& container2)
+{
+    Container result{ container1.key, ContainerType::ARRAY, 0, {}, {} };
+
+    if ((container1.type == ContainerType::ARRAY) && (container2.type == ContainerType::ARRAY))
+    {
+        result.values.resize(container1.values.size() + container2.values.size());
+        auto it = std::set_symmetric_difference(container1.values.begin(), container1.values.end(), container2.values.begin(), container2.values.end(), result.values.begin());
+        result.values.resize(it - result.values.begin());
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else if ((container1.type == ContainerType::BITMAP) && (container2.type == ContainerType::BITMAP))
+    {
+        result.type = ContainerType::BITMAP;
+        result.words.resize(BITMAP_WORDS);
+        result.cardinality = Internals::BitmapCombine<Internals::BitmapOperation::XOR>(container1.words.data(), container2.words.data(), result.words.data(), BITMAP_WORDS);
+    }
+    else
+    {
+        // Flip array values in the bitmap
+        result = (container1.type == ContainerType::BITMAP) ? container1 : container2;
+        const Container& other = (container1.type == ContainerType::BITMAP) ? container2 : container1;
+        for (uint16_t low : other.values)
+        {
+            uint64_t& word = result.words[low >> 6];
+            uint64_t bit = 1ull << (low & 63);
+            result.cardinality += ((word & bit) == 0) ? 1 : (uint32_t)-1;
+            word ^= bit;
+        }
+        result.key = container1.key;
+    }
+
+    normalize_internal(result);
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::andnot_internal(const Container& container1, const Container& container2)
+{
+    Container result{ container1.key, ContainerType::ARRAY, 0, {}, {} };
+
+    if (container1.type == ContainerType::ARRAY)
+    {
+        if (container2.type == ContainerType::ARRAY)
+        {
+            result.values.resize(container1.values.size());
+            auto it = std::set_difference(container1.values.begin(), container1.values.end(), container2.values.begin(), container2.values.end(), result.values.begin());
+            result.values.resize(it - result.values.begin());
+        }
+        else
+        {
+            // Filter array values not found in the bitmap
+            result.values.reserve(container1.values.size());
+            for (uint16_t low : container1.values)
+                if (!Internals::BitmapTest(container2.words.data(), low))
+                    result.values.push_back(low);
+        }
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else if (container2.type == ContainerType::BITMAP)
+    {
+        result.type = ContainerType::BITMAP;
+        result.words.resize(BITMAP_WORDS);
+        result.cardinality = Internals::BitmapCombine<Internals::BitmapOperation::ANDNOT>(container1.words.data(), container2.words.data(), result.words.data(), BITMAP_WORDS);
+        normalize_internal(result);
+    }
+    else
+    {
+        // Clear array values in the bitmap
+        result = container1;
+        for (uint16_t low : container2.values)
+        {
+            uint64_t& word = result.words[low >> 6];
+            uint64_t bit = 1ull << (low & 63);
+            result.cardinality -= ((word & bit) != 0) ? 1 : 0;
+            word &= ~bit;
+        }
+        normalize_internal(result);
+    }
+
+    return result;
+}
+
+uint32_t RoaringBitmap::and_cardinality_internal(const Container& container1, const Container& container2)
+{
+    if ((container1.type == ContainerType::ARRAY) && (container2.type == ContainerType::ARRAY))
+        return (uint32_t)Internals::ArrayIntersect(container1.values.data(), container1.values.size(), container2.values.data(), container2.values.size(), nullptr);
+
+    if ((container1.type == ContainerType::ARRAY) || (container2.type == ContainerType::ARRAY))
+    {
+        const Container& array = (container1.type == ContainerType::ARRAY) ? container1 : container2;
+        const Container& bitmap = (container1.type == ContainerType::ARRAY) ? container2 : container1;
+        uint32_t result = 0;
+        for (uint16_t low : array.values)
+            result += Internals::BitmapTest(bitmap.words.data(), low) ? 1 : 0;
+        return result;
+    }
+
+    return Internals::BitmapCombineCardinality<Internals::BitmapOperation::AND>(container1.words.data(), container2.words.data(), BITMAP_WORDS);
+}
+
+template <class TOperation>
+RoaringBitmap RoaringBitmap::combine_internal(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2, TOperation operation, bool left, bool right)
+{
+    RoaringBitmap result;
+
+    size_t i = 0;
+    size_t j = 0;
+    while ((i < bitmap1._containers.size()) || (j < bitmap2._containers.size()))
+    {
+        if ((j == bitmap2._containers.size()) || ((i < bitmap1._containers.size()) && (bitmap1._containers[i].key < bitmap2._containers[j].key)))
+        {
+            // Keep the container of the first bitmap only
+            if (left)
+                result._containers.push_back(bitmap1._containers[i]);
+            ++i;
+        }
+        else if ((i == bitmap1._containers.size()) || (bitmap2._containers[j].key < bitmap1._containers[i].key))
+        {
+            // Keep the container of the second bitmap only
+            if (right)
+                result._containers.push_back(bitmap2._containers[j]);
+            ++j;
+        }
+        else
+        {
+            // Expand run containers before the operation
+            Container expanded1;
+            Container expanded2;
+            const Container* container1 = &bitmap1._containers[i];
+            const Container* container2 = &bitmap2._containers[j];
+            if (container1->type == ContainerType::RUN)
+            {
+                expanded1 = *container1;
+                to_bitmap_internal(expanded1);
+                container1 = &expanded1;
+            }
+            if (container2->type == ContainerType::RUN)
+            {
+                expanded2 = *container2;
+                to_bitmap_internal(expanded2);
+                container2 = &expanded2;
+            }
+
+            Container container = operation(*container1, *container2);
+            if (container.cardinality > 0)
+                result._containers.push_back(std::move(container));
+            ++i;
+            ++j;
+        }
+    }
+
+    return result;
+}
+
+uint64_t RoaringBitmap::and_cardinality(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    uint64_t result = 0;
+
+    size_t i = 0;
+    size_t j = 0;
+    while ((i < bitmap1._containers.size()) && (j < bitmap2._containers.size()))
+    {
+        const Container& container1 = bitmap1._containers[i];
+        const Container& container2 = bitmap2._containers[j];
+        if (container1.key < container2.key)
+            ++i;
+        else if (container2.key < container1.key)
+            ++j;
+        else
+        {
+            if ((container1.type == ContainerType::RUN) || (container2.type == ContainerType::RUN))
+            {
+                Container expanded1 = container1;
+                Container expanded2 = container2;
+                to_bitmap_internal(expanded1);
+                to_bitmap_internal(expanded2);
+                result += and_cardinality_internal(expanded1, expanded2);
+            }
+            else
+                result += and_cardinality_internal(container1, container2);
+            ++i;
+            ++j;
+        }
+    }
+
+    return result;
+}
+
+RoaringBitmap operator&(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    return RoaringBitmap::combine_internal(bitmap1, bitmap2, RoaringBitmap::and_internal, false, false);
+}
+
+RoaringBitmap operator|(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    return RoaringBitmap::combine_internal(bitmap1, bitmap2, RoaringBitmap::or_internal, true, true);
+}
+
+RoaringBitmap operator^(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    return RoaringBitmap::combine_internal(bitmap1, bitmap2, RoaringBitmap::xor_internal, true, true);
+}
+
+RoaringBitmap operator-(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    return RoaringBitmap::combine_internal(bitmap1, bitmap2, RoaringBitmap::andnot_internal, true, false);
+}
+
+RoaringBitmap& RoaringBitmap::operator&=(const RoaringBitmap& bitmap)
+{
+    *this = *this & bitmap;
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator|=(const RoaringBitmap& bitmap)
+{
+    *this = *this | bitmap;
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator^=(const RoaringBitmap& bitmap)
+{
+    *this = *this ^ bitmap;
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator-=(const RoaringBitmap& bitmap)
+{
+    *this = *this - bitmap;
+    return *this;
+}
+
+bool operator==(const RoaringBitmap& bitmap1, const RoaringBitmap& bitmap2)
+{
+    if (bitmap1._containers.size() != bitmap2._containers.size())
+        return false;
+
+    // Containers are equal if they have the same cardinality and their intersection cardinality
+    for (size_t i = 0; i < bitmap1._containers.size(); ++i)
+    {
+        const RoaringBitmap::Container& container1 = bitmap1._containers[i];
+        const RoaringBitmap::Container& container2 = bitmap2._containers[i];
+        if ((container1.key != container2.key) || (container1.cardinality != container2.cardinality))
+            return false;
+        if ((container1.type == container2.type) && (container1.values == container2.values) && (container1.words == container2.words))
+            continue;
+
+        RoaringBitmap::Container expanded1 = container1;
+        RoaringBitmap::Container expanded2 = container2;
+        RoaringBitmap::to_bitmap_internal(expanded1);
+        RoaringBitmap::to_bitmap_internal(expanded2);
+        if (expanded1.words != expanded2.words)
+            return false;
+    }
+
+    return true;
+}
+
+size_t RoaringBitmap::serialized_size() const noexcept
+{
+    size_t size = sizeof(Internals::SerializedHeader) + _containers.size() * sizeof(Internals::SerializedContainer);
+    for (const auto& container : _containers)
+    {
+        size = Internals::SerializedAlign(size);
+        size += (container.type == ContainerType::BITMAP) ? (BITMAP_WORDS * sizeof(uint64_t)) : (container.values.size() * sizeof(uint16_t));
+    }
+    return Internals::SerializedAlign(size);
+}
+
+size_t RoaringBitmap::serialize(void* buffer) const
+{
+    uint8_t* output = (uint8_t*)buffer;
+
+    Internals::SerializedHeader header{ Internals::SERIALIZED_MAGIC, (uint32_t)_containers.size() };
+    std::memcpy(output, &header, sizeof(header));
+
+    size_t offset = sizeof(Internals::SerializedHeader) + _containers.size() * sizeof(Internals::SerializedContainer);
+    for (size_t i = 0; i < _containers.size(); ++i)
+    {
+        const Container& container = _containers[i];
+
+        // Align containers data by 8 bytes with zero padding
+        size_t aligned = Internals::SerializedAlign(offset);
+        std::memset(output + offset, 0, aligned - offset);
+        offset = aligned;
+
+        Internals::SerializedContainer descriptor{ container.key, (uint8_t)container.type, 0, container.cardinality, (uint32_t)offset, 0 };
+        if (container.type == ContainerType::BITMAP)
+        {
+            descriptor.length = (uint32_t)BITMAP_WORDS;
+            std::memcpy(output + offset, container.words.data(), BITMAP_WORDS * sizeof(uint64_t));
+            offset += BITMAP_WORDS * sizeof(uint64_t);
+        }
+        else
+        {
+            descriptor.length = (uint32_t)container.values.size();
+            if (!container.values.empty())
+                std::memcpy(output + offset, container.values.data(), container.values.size() * sizeof(uint16_t));
+            offset += container.values.size() * sizeof(uint16_t);
+        }
+        std::memcpy(output + sizeof(Internals::SerializedHeader) + i * sizeof(Internals::SerializedContainer), &descriptor, sizeof(descriptor));
+    }
+
+    size_t aligned = Internals::SerializedAlign(offset);
+    std::memset(output + offset, 0, aligned - offset);
+    return aligned;
+}
+
+std::vector<uint8_t> RoaringBitmap::serialize() const
+{
+    std::vector<uint8_t> result(serialized_size());
+    serialize(result.data());
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::deserialize(const void* buffer, size_t size)
+{
+    const uint8_t* input = (const uint8_t*)buffer;
+    uint32_t count = Internals::SerializedValidate(input, size);
+
+    RoaringBitmap result;
+    result._containers.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        Internals::SerializedContainer descriptor = Internals::SerializedDescriptor(input, i);
+
+        Container container{ descriptor.key, (ContainerType)descriptor.type, descriptor.cardinality, {}, {} };
+        if (container.type == ContainerType::BITMAP)
+        {
+            if (descriptor.length != BITMAP_WORDS)
+                throw std::invalid_argument("Invalid roaring bitmap serialized container!");
+            container.words.resize(BITMAP_WORDS);
+            std::memcpy(container.words.data(), input + descriptor.offset, BITMAP_WORDS * sizeof(uint64_t));
+        }
+        else
+        {
+            container.values.resize(descriptor.length);
+            if (descriptor.length > 0)
+                std::memcpy(container.values.data(), input + descriptor.offset, descriptor.length * sizeof(uint16_t));
+        }
+        result._containers.push_back(std::move(container));
+    }
+
+    return result;
+}
+
+void RoaringBitmap::swap(RoaringBitmap& bitmap) noexcept
+{
+    using std::swap;
+    swap(_containers, bitmap._containers);
+}
+
+void swap(RoaringBitmap& bitmap1, RoaringBitmap& bitmap2) noexcept
+{
+    bitmap1.swap(bitmap2);
+}
+
+RoaringBitmapIterator::RoaringBitmapIterator(const RoaringBitmap* bitmap, size_t container) noexcept
+    : _bitmap(bitmap), _container(container), _position(0), _offset(0), _value(0)
+{
+    seek();
+}
+
+RoaringBitmapIterator& RoaringBitmapIterator::operator++() noexcept
+{
+    assert((_bitmap != nullptr) && (_container < _bitmap->_containers.size()) && "Iterator must be valid!");
+
+    const RoaringBitmap::Container& container = _bitmap->_containers[_container];
+    if ((container.type == RoaringBitmap::ContainerType::RUN) && (_offset < container.values[2 * _position + 1]))
+        ++_offset;
+    else
+    {
+        ++_position;
+        _offset = 0;
+    }
+
+    seek();
+    return *this;
+}
+
+void RoaringBitmapIterator::seek() noexcept
+{
+    // Find the current or the next value starting from the current position
+    for (; _container < _bitmap->_containers.size(); ++_container, _position = 0, _offset = 0)
+    {
+        const RoaringBitmap::Container& container = _bitmap->_containers[_container];
+        uint32_t high = (uint32_t)container.key << 16;
+        switch (container.type)
+        {
+            case RoaringBitmap::ContainerType::ARRAY:
+                if (_position < container.values.size())
+                {
+                    _value = high | container.values[_position];
+                    return;
+                }
+                break;
+            case RoaringBitmap::ContainerType::BITMAP:
+                if (_position < 65536)
+                {
+                    size_t index = _position >> 6;
+                    uint64_t word = container.words[index] & (~0ull << (_position & 63));
+                    while ((word == 0) && (++index < RoaringBitmap::BITMAP_WORDS))
+                        word = container.words[index];
+                    if (word != 0)
+                    {
+                        _position = (uint32_t)(index * 64 + std::countr_zero(word));
+                        _value = high | _position;
+                        return;
+                    }
+                }
+                break;
+            case RoaringBitmap::ContainerType::RUN:
+                if ((2 * _position) < container.values.size())
+                {
+                    _value = high | ((uint32_t)container.values[2 * _position] + _offset);
+                    return;
+                }
+                break;
+        }
+    }
+
+    _position = 0;
+    _offset = 0;
+}
+
+RoaringBitmapView::RoaringBitmapView(const void* buffer, size_t size)
+    : _buffer((const uint8_t*)buffer), _size(size), _count(Internals::SerializedValidate((const uint8_t*)buffer, size))
+{
+}
+
+uint64_t RoaringBitmapView::cardinality() const noexcept
+{
+    uint64_t result = 0;
+    for (uint32_t i = 0; i < _count; ++i)
+        result += Internals::SerializedDescriptor(_buffer, i).cardinality;
+    return result;
+}
+
+bool RoaringBitmapView::contains(uint32_t value) const noexcept
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+
+    // Binary search of the container descriptor by the key
+    size_t first = 0;
+    size_t last = _count;
+    while (first < last)
+    {
+        size_t middle = (first + last) / 2;
+        if (Internals::SerializedDescriptor(_buffer, middle).key < key)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    if (first == _count)
+        return false;
+
+    Internals::SerializedContainer descriptor = Internals::SerializedDescriptor(_buffer, first);
+    if (descriptor.key != key)
+        return false;
+
+    switch ((RoaringBitmap::ContainerType)descriptor.type)
+    {
+        case RoaringBitmap::ContainerType::ARRAY:
+        {
+            const uint16_t* values = (const uint16_t*)(_buffer + descriptor.offset);
+            return std::binary_search(values, values + descriptor.length, low);
+        }
+        case RoaringBitmap::ContainerType::BITMAP:
+            return (descriptor.length == RoaringBitmap::BITMAP_WORDS) && Internals::BitmapTest((const uint64_t*)(_buffer + descriptor.offset), low);
+        case RoaringBitmap::ContainerType::RUN:
+            return Internals::RunsContain((const uint16_t*)(_buffer + descriptor.offset), descriptor.length / 2, low);
+    }
+    return false;
+}
+
+RoaringBitmap RoaringBitmapView::bitmap() const
+{
+    return RoaringBitmap::deserialize(_buffer, _size);
+}
+
+} // namespace CppCommon
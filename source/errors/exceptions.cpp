@@ -8,6 +8,8 @@
 
 #include "errors/exceptions.h"
 
+#include "system/stack_trace.h"
+
 #include <sstream>
 
 namespace CppCommon {
@@ -40,6 +42,21 @@ std::string Exception::string() const
     return _cache;
 }
 
+std::atomic<bool> SystemException::_capture(false);
+
+void SystemException::CaptureStackTrace()
+{
+    void* frames[64];
+    // Skip the capture method frame
+    int count = StackTrace::Capture(frames, (int)(sizeof(frames) / sizeof(frames[0])), 1);
+    _stack_trace.assign(frames, frames + count);
+}
+
+StackTrace SystemException::stack_trace() const
+{
+    return StackTrace(_stack_trace.data(), (int)_stack_trace.size());
+}
+
 std::string SystemException::string() const
 {
     if (_cache.empty())
@@ -51,6 +68,8 @@ std::string SystemException::string() const
         std::string location = _location.string();
         if (!location.empty())
             stream << "Source location: " << location << std::endl;
+        if (!_stack_trace.empty())
+            stream << "Stack trace: " << std::endl << stack_trace();
         _cache = stream.str();
     }
     return _cache;
@@ -14,13 +14,19 @@
 #include "utility/resource.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <atomic>
 #include <cstring>
 #include <exception>
 #include <iostream>
+#include <vector>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include "string/format.h"
 #include "utility/countof.h"
+#include <sys/mman.h>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
 #include <signal.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
@@ -50,7 +56,7 @@ namespace CppCommon {
 class ExceptionsHandler::Impl
 {
 public:
-    Impl() : _initialized(false), _handler(ExceptionsHandler::Impl::DefaultHandler) {}
+    Impl() : _initialized(false), _safe_fd(-1), _handler(ExceptionsHandler::Impl::DefaultHandler) {}
 
     static ExceptionsHandler::Impl& GetInstance()
     { return ExceptionsHandler::GetInstance().impl(); }
@@ -64,6 +70,15 @@ public:
         _handler = handler;
     }
 
+    void AddDumpHandler(const std::function<void ()>& handler)
+    {
+        assert((handler) && "Dump handler function must be valid!");
+        if (!handler)
+            return;
+
+        _dump_handlers.push_back(handler);
+    }
+
     void SetupProcess()
     {
         // Check for double initialization
@@ -101,11 +116,14 @@ public:
         // Catch a termination request
         signal(SIGTERM, SigtermHandler);
 #elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Setup the alternate signal stack of the current thread
+        SetupSignalStack();
+
         // Prepare signal action structure
         struct sigaction sa;
         memset(&sa, 0, sizeof(sa));
         sa.sa_sigaction = SignalHandler;
-        sa.sa_flags = SA_SIGINFO;
+        sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
 
         // Define signals to catch
         int signals[] =
@@ -169,14 +187,41 @@ public:
 
         // Catch an illegal storage access error
         signal(SIGSEGV, SigsegvHandler);
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Setup the alternate signal stack of the current thread
+        SetupSignalStack();
+#endif
+    }
+
+    void SetupSignalSafeDump(int fd)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Load the unwinder library before the crash, so the stack capture will not allocate memory in the signal handler
+        void* frames[1];
+        StackTrace::Capture(frames, 1);
+
+        _safe_fd.store(fd, std::memory_order_release);
 #endif
     }
 
 private:
     // Initialization flag for the current process
     bool _initialized;
+    // File descriptor for the async-signal-safe crash dump (-1 if disabled)
+    std::atomic<int> _safe_fd;
     // Exception handler function
     std::function<void (const SystemException&, const StackTrace&)> _handler;
+    // Dump handler functions
+    std::vector<std::function<void ()>> _dump_handlers;
+
+    // Call dump handlers and then the exception handler function
+    void Handle(const SystemException& exception, const StackTrace& trace)
+    {
+        for (auto& dump_handler : _dump_handlers)
+            dump_handler();
+
+        _handler(exception, trace);
+    }
 
     // Default exception handler function
     static void DefaultHandler(const SystemException& exception, const StackTrace& trace)
@@ -192,7 +237,7 @@ private:
     static LONG WINAPI SehHandler(PEXCEPTION_POINTERS pExceptionPtrs)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Unhandled SEH exception"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Unhandled SEH exception"), StackTrace(1));
 
         // Write dump file
         CreateDumpFile(pExceptionPtrs);
@@ -209,7 +254,7 @@ private:
     static void __cdecl TerminateHandler()
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Abnormal program termination (terminate() function was called)"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Abnormal program termination (terminate() function was called)"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -229,7 +274,7 @@ private:
     static void __cdecl UnexpectedHandler()
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Unexpected error (unexpected() function was called)"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Unexpected error (unexpected() function was called)"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -250,7 +295,7 @@ private:
     static void __cdecl PureCallHandler()
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Pure virtual function call"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Pure virtual function call"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -270,7 +315,7 @@ private:
     static void __cdecl InvalidParameterHandler(const wchar_t* expression, const wchar_t* function, const wchar_t* file, unsigned int line, uintptr_t pReserved)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Invalid parameter exception"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Invalid parameter exception"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -290,7 +335,7 @@ private:
     static int __cdecl NewHandler(size_t)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("'new' operator memory allocation exception"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("'new' operator memory allocation exception"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -313,7 +358,7 @@ private:
     static void SigabrtHandler(int signum)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Caught abort (SIGABRT) signal"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Caught abort (SIGABRT) signal"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -333,7 +378,7 @@ private:
     static void SigfpeHandler(int signum, int subcode)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Caught floating point exception (SIGFPE) signal"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Caught floating point exception (SIGFPE) signal"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = (PEXCEPTION_POINTERS)_pxcptinfoptrs;
@@ -349,7 +394,7 @@ private:
     static void SigillHandler(int signum)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Caught illegal instruction (SIGILL) signal"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Caught illegal instruction (SIGILL) signal"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -369,7 +414,7 @@ private:
     static void SigintHandler(int signum)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Caught interruption (SIGINT) signal"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Caught interruption (SIGINT) signal"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -389,7 +434,7 @@ private:
     static void SigsegvHandler(int signum)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Caught invalid storage access (SIGSEGV) signal"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Caught invalid storage access (SIGSEGV) signal"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -406,7 +451,7 @@ private:
     static void SigtermHandler(int signum)
     {
         // Output error
-        GetInstance()._handler(__LOCATION__ + SystemException("Caught termination request (SIGTERM) signal"), StackTrace(1));
+        GetInstance().Handle(__LOCATION__ + SystemException("Caught termination request (SIGTERM) signal"), StackTrace(1));
 
         // Retrieve exception information
         EXCEPTION_POINTERS* pExceptionPtrs = nullptr;
@@ -562,60 +607,198 @@ private:
 
 #elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 
-    // Signal handler
-    static void SignalHandler(int signo, siginfo_t* info, void* context)
+    // Get the description of the given signal
+    static const char* SignalDescription(int signo) noexcept
     {
-        // Output error
         switch (signo)
         {
             case SIGABRT:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught abnormal program termination (SIGABRT) signal"), StackTrace(1));
-                break;
+                return "Caught abnormal program termination (SIGABRT) signal";
             case SIGALRM:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught alarm clock (SIGALRM) signal"), StackTrace(1));
-                break;
+                return "Caught alarm clock (SIGALRM) signal";
             case SIGBUS:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught memory access error (SIGBUS) signal"), StackTrace(1));
-                break;
+                return "Caught memory access error (SIGBUS) signal";
             case SIGFPE:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught floating point exception (SIGFPE) signal"), StackTrace(1));
-                break;
+                return "Caught floating point exception (SIGFPE) signal";
             case SIGHUP:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught hangup instruction (SIGHUP) signal"), StackTrace(1));
-                break;
+                return "Caught hangup instruction (SIGHUP) signal";
             case SIGILL:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught illegal instruction (SIGILL) signal"), StackTrace(1));
-                break;
+                return "Caught illegal instruction (SIGILL) signal";
             case SIGINT:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught terminal interrupt (SIGINT) signal"), StackTrace(1));
-                break;
+                return "Caught terminal interrupt (SIGINT) signal";
             case SIGPIPE:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught pipe write error (SIGPIPE) signal"), StackTrace(1));
-                break;
+                return "Caught pipe write error (SIGPIPE) signal";
             case SIGPROF:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught profiling timer expired error (SIGPROF) signal"), StackTrace(1));
-                break;
+                return "Caught profiling timer expired error (SIGPROF) signal";
             case SIGQUIT:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught terminal quit (SIGQUIT) signal"), StackTrace(1));
-                break;
+                return "Caught terminal quit (SIGQUIT) signal";
             case SIGSEGV:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught illegal storage access error (SIGSEGV) signal"), StackTrace(1));
-                break;
+                return "Caught illegal storage access error (SIGSEGV) signal";
             case SIGSYS:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught bad system call (SIGSYS) signal"), StackTrace(1));
-                break;
+                return "Caught bad system call (SIGSYS) signal";
             case SIGTERM:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught termination request (SIGTERM) signal"), StackTrace(1));
-                break;
+                return "Caught termination request (SIGTERM) signal";
             case SIGXCPU:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught CPU time limit exceeded (SIGXCPU) signal"), StackTrace(1));
-                break;
+                return "Caught CPU time limit exceeded (SIGXCPU) signal";
             case SIGXFSZ:
-                GetInstance()._handler(__LOCATION__ + SystemException("Caught file size limit exceeded (SIGXFSZ) signal"), StackTrace(1));
-                break;
+                return "Caught file size limit exceeded (SIGXFSZ) signal";
             default:
-                GetInstance()._handler(__LOCATION__ + SystemException(format("Caught unknown signal - {}", signo)), StackTrace(1));
-                break;
+                return nullptr;
+        }
+    }
+
+    // Setup the preallocated alternate signal stack of the current thread
+    static void SetupSignalStack()
+    {
+        thread_local struct SignalStack
+        {
+            void* ptr = nullptr;
+            size_t size = 0;
+
+            ~SignalStack()
+            {
+                if (ptr == nullptr)
+                    return;
+
+                stack_t ss;
+                memset(&ss, 0, sizeof(ss));
+                ss.ss_flags = SS_DISABLE;
+                sigaltstack(&ss, nullptr);
+                munmap(ptr, size);
+            }
+        } stack;
+
+        // Check for double initialization
+        if (stack.ptr != nullptr)
+            return;
+
+        // The stack is large enough for symbols resolving of the default exceptions handler
+        size_t size = std::max((size_t)SIGSTKSZ, (size_t)256 * 1024);
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            throwex SystemException("Failed to allocate the alternate signal stack!");
+
+        stack_t ss;
+        memset(&ss, 0, sizeof(ss));
+        ss.ss_sp = ptr;
+        ss.ss_size = size;
+        if (sigaltstack(&ss, nullptr) != 0)
+        {
+            munmap(ptr, size);
+            throwex SystemException("Failed to setup the alternate signal stack!");
+        }
+
+        stack.ptr = ptr;
+        stack.size = size;
+    }
+
+    // Write the whole buffer into the file descriptor (async-signal-safe)
+    static void SafeWrite(int fd, const char* buffer, size_t size) noexcept
+    {
+        while (size > 0)
+        {
+            ssize_t written = write(fd, buffer, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return;
+            }
+            buffer += written;
+            size -= (size_t)written;
+        }
+    }
+
+    // Write the string into the file descriptor (async-signal-safe)
+    static void SafeWrite(int fd, const char* str) noexcept
+    {
+        SafeWrite(fd, str, strlen(str));
+    }
+
+    // Write the number with the given base into the file descriptor (async-signal-safe)
+    static void SafeWrite(int fd, uint64_t value, unsigned base) noexcept
+    {
+        char buffer[32];
+        char* ptr = buffer + sizeof(buffer);
+        do
+        {
+            *--ptr = "0123456789abcdef"[value % base];
+            value /= base;
+        } while (value > 0);
+        SafeWrite(fd, ptr, (size_t)(buffer + sizeof(buffer) - ptr));
+    }
+
+    // Write the crash dump into the file descriptor without memory allocations and locks (async-signal-safe)
+    static void SafeDump(int fd, int signo, siginfo_t* info) noexcept
+    {
+        // Only the first crashed thread writes the dump
+        static std::atomic<bool> dumping(false);
+        if (dumping.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        // Preserve errno of the interrupted code
+        int error = errno;
+
+        const char* description = SignalDescription(signo);
+        SafeWrite(fd, (description != nullptr) ? description : "Caught unknown signal");
+        SafeWrite(fd, " - ");
+        SafeWrite(fd, (uint64_t)signo, 10);
+        SafeWrite(fd, "\nProcess: ");
+        SafeWrite(fd, (uint64_t)getpid(), 10);
+        if ((info != nullptr) && ((signo == SIGBUS) || (signo == SIGFPE) || (signo == SIGILL) || (signo == SIGSEGV)))
+        {
+            SafeWrite(fd, "\nFault address: 0x");
+            SafeWrite(fd, (uint64_t)(uintptr_t)info->si_addr, 16);
+        }
+
+        // Capture raw frames addresses, symbols are resolved offline
+        void* frames[128];
+        int count = StackTrace::Capture(frames, (int)countof(frames));
+        SafeWrite(fd, "\nStack trace:\n");
+        for (int i = 0; i < count; ++i)
+        {
+            SafeWrite(fd, "#");
+            SafeWrite(fd, (uint64_t)i, 10);
+            SafeWrite(fd, " 0x");
+            SafeWrite(fd, (uint64_t)(uintptr_t)frames[i], 16);
+            SafeWrite(fd, "\n");
+        }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Copy the memory map of the process to resolve frames addresses with modules load addresses
+        int maps = open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+        if (maps >= 0)
+        {
+            SafeWrite(fd, "Memory map:\n");
+            char buffer[1024];
+            ssize_t size;
+            while (((size = read(maps, buffer, sizeof(buffer))) > 0) || ((size < 0) && (errno == EINTR)))
+                if (size > 0)
+                    SafeWrite(fd, buffer, (size_t)size);
+            close(maps);
+        }
+#endif
+
+        errno = error;
+    }
+
+    // Signal handler
+    static void SignalHandler(int signo, siginfo_t* info, [[maybe_unused]] void* context)
+    {
+        int fd = GetInstance()._safe_fd.load(std::memory_order_acquire);
+        if (fd >= 0)
+        {
+            // Write the crash dump without memory allocations
+            SafeDump(fd, signo, info);
+        }
+        else
+        {
+            // Output error
+            const char* description = SignalDescription(signo);
+            if (description != nullptr)
+                GetInstance().Handle(__LOCATION__ + SystemException(description), StackTrace(1));
+            else
+                GetInstance().Handle(__LOCATION__ + SystemException(format("Caught unknown signal - {}", signo)), StackTrace(1));
         }
 
         // Prepare signal action structure
@@ -654,7 +837,9 @@ ExceptionsHandler::~ExceptionsHandler()
 }
 
 void ExceptionsHandler::SetupHandler(const std::function<void (const SystemException&, const StackTrace&)>& handler) { GetInstance().impl().SetupHandler(handler); }
+void ExceptionsHandler::AddDumpHandler(const std::function<void ()>& handler) { GetInstance().impl().AddDumpHandler(handler); }
 void ExceptionsHandler::SetupProcess() { GetInstance().impl().SetupProcess(); }
 void ExceptionsHandler::SetupThread() { GetInstance().impl().SetupThread(); }
+void ExceptionsHandler::SetupSignalSafeDump(int fd) { GetInstance().impl().SetupSignalSafeDump(fd); }
 
 } // namespace CppCommon
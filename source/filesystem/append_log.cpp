@@ -0,0 +1,378 @@
+/*!
+    \file append_log.cpp
+    \brief Group-commit durable append log implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/append_log.h"
+
+#include "algorithms/crc32c.h"
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/locker.h"
+#include "threads/mpsc_ring_buffer.h"
+#include "threads/thread.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <limits>
+
+namespace CppCommon {
+
+const size_t AppendLog::HEADER_SIZE = 8;
+const size_t AppendLog::DEFAULT_CAPACITY = 262144;
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline void StoreLog32(uint8_t* buffer, uint32_t value) noexcept
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
+
+inline uint32_t LoadLog32(const uint8_t* buffer) noexcept
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+} // namespace Internals
+
+class AppendLog::Impl
+{
+public:
+    Impl(size_t capacity, size_t concurrency)
+        : _buffer(capacity, std::max(concurrency, (size_t)1)),
+          _opened(false), _running(false), _sleeping(false), _failed(false),
+          _started(0), _durable(0), _requested(0),
+          _preallocate(0), _offset(0), _allocated(0)
+    {
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            if (IsOpened())
+                Close();
+        }
+        catch (const FileSystemException& ex)
+        {
+            fatality(FileSystemException(ex.string()).Attach(path()));
+        }
+    }
+
+    const Path& path() const noexcept { return _file; }
+
+    size_t max_size() const noexcept
+    {
+        return std::min(_buffer.capacity() - AppendLog::HEADER_SIZE, (size_t)std::numeric_limits<uint32_t>::max());
+    }
+
+    uint64_t groups() const noexcept { return _durable.load(std::memory_order_acquire); }
+
+    bool IsOpened() const noexcept { return _opened.load(std::memory_order_acquire); }
+
+    void Open(const Path& path, const Handler& handler, uint64_t preallocate)
+    {
+        assert(!IsOpened() && "Append log is already opened!");
+        if (IsOpened())
+            throwex FileSystemException("Append log is already opened!").Attach(path);
+
+        // Recover valid records and cut the torn tail
+        uint64_t valid = AppendLog::Recover(path, handler);
+        _file = path;
+        _file.OpenOrCreate(false, true, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+        if (_file.size() > valid)
+        {
+            _file.Resize(valid);
+            _file.Flush();
+        }
+        _file.Seek(valid);
+
+        _preallocate = preallocate;
+        _offset = valid;
+        _allocated = valid;
+
+        _failed.store(false, std::memory_order_relaxed);
+        _error = nullptr;
+        _started.store(0, std::memory_order_relaxed);
+        _durable.store(0, std::memory_order_relaxed);
+        _requested.store(0, std::memory_order_relaxed);
+        _running.store(true, std::memory_order_relaxed);
+        _opened.store(true, std::memory_order_release);
+
+        // Start the writer thread
+        _writer = Thread::Start([this]() { Writer(); });
+    }
+
+    void Close()
+    {
+        assert(IsOpened() && "Append log is not opened!");
+        if (!IsOpened())
+            throwex FileSystemException("Append log is not opened!").Attach(path());
+
+        // Stop the writer thread after all appended records are written
+        _running.store(false, std::memory_order_seq_cst);
+        _wake.Signal();
+        _writer.join();
+
+        _opened.store(false, std::memory_order_release);
+        _file.Close();
+
+        // Report the failure of the writer thread
+        if (_failed.load(std::memory_order_acquire))
+            std::rethrow_exception(_error);
+    }
+
+    uint64_t Append(const void* data, size_t size)
+    {
+        assert(IsOpened() && "Append log is not opened!");
+        if (!IsOpened())
+            throwex FileSystemException("Append log is not opened!").Attach(path());
+        assert((size <= max_size()) && "Record size must not be greater than the maximal record size!");
+        if (size > max_size())
+            throwex ArgumentException("Record size must not be greater than the maximal record size!");
+
+        // Checksum the record out of the ring buffer lock
+        uint8_t header[8];
+        Internals::StoreLog32(header, (uint32_t)size);
+        uint32_t crc = CRC32C::Compute(header, 4);
+        crc = CRC32C::Compute(data, size, crc);
+        Internals::StoreLog32(header + 4, crc);
+
+        // Copy the record into one of producers' ring buffers
+        for (;;)
+        {
+            if (_failed.load(std::memory_order_acquire))
+                std::rethrow_exception(_error);
+
+            std::span<uint8_t> prepared = _buffer.Prepare(AppendLog::HEADER_SIZE + size);
+            if (!prepared.empty())
+            {
+                std::memcpy(prepared.data(), header, AppendLog::HEADER_SIZE);
+                if (size > 0)
+                    std::memcpy(prepared.data() + AppendLog::HEADER_SIZE, data, size);
+                _buffer.Commit(prepared, prepared.size());
+                break;
+            }
+
+            // Wake up the writer thread to drain the full ring buffer
+            _wake.Signal();
+            Thread::Yield();
+        }
+
+        // The record will be written by the next group started after the commit
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t ticket = _started.load(std::memory_order_relaxed) + 1;
+        if (_sleeping.load(std::memory_order_relaxed))
+            _wake.Signal();
+        return ticket;
+    }
+
+    void Wait(uint64_t ticket)
+    {
+        if (_durable.load(std::memory_order_acquire) >= ticket)
+            return;
+
+        // Request the writer thread to commit the group of the ticket
+        uint64_t requested = _requested.load(std::memory_order_relaxed);
+        while ((requested < ticket) && !_requested.compare_exchange_weak(requested, ticket, std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleeping.load(std::memory_order_relaxed))
+            _wake.Signal();
+
+        Locker<CriticalSection> locker(_cs);
+        _cv.Wait(_cs, [this, ticket]() { return (_durable.load(std::memory_order_acquire) >= ticket) || _failed.load(std::memory_order_acquire); });
+        if (_durable.load(std::memory_order_acquire) < ticket)
+            std::rethrow_exception(_error);
+    }
+
+    void Flush()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Wait(_started.load(std::memory_order_relaxed) + 1);
+    }
+
+private:
+    File _file;
+    MPSCRingBuffer _buffer;
+    std::thread _writer;
+    EventAutoReset _wake;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    std::exception_ptr _error;
+    std::atomic<bool> _opened;
+    std::atomic<bool> _running;
+    std::atomic<bool> _sleeping;
+    std::atomic<bool> _failed;
+    std::atomic<uint64_t> _started;
+    std::atomic<uint64_t> _durable;
+    std::atomic<uint64_t> _requested;
+    uint64_t _preallocate;
+    uint64_t _offset;
+    uint64_t _allocated;
+
+    bool IsPending() const
+    {
+        return !_buffer.empty() || (_requested.load(std::memory_order_relaxed) > _durable.load(std::memory_order_relaxed));
+    }
+
+    void Writer()
+    {
+        try
+        {
+            for (;;)
+            {
+                if (!IsPending())
+                {
+                    if (!_running.load(std::memory_order_seq_cst))
+                        break;
+
+                    // Sleep until producers append records or waiters request a group
+                    _sleeping.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (!IsPending() && _running.load(std::memory_order_relaxed))
+                        _wake.Wait();
+                    _sleeping.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+
+                // Start a new group
+                uint64_t group = _started.fetch_add(1, std::memory_order_relaxed) + 1;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                // Write all records of the group and make them durable at once
+                if (Drain() > 0)
+                    _file.Flush();
+
+                // Complete the group
+                {
+                    Locker<CriticalSection> locker(_cs);
+                    _durable.store(group, std::memory_order_release);
+                }
+                _cv.NotifyAll();
+            }
+        }
+        catch (...)
+        {
+            {
+                Locker<CriticalSection> locker(_cs);
+                _error = std::current_exception();
+                _failed.store(true, std::memory_order_release);
+            }
+            _cv.NotifyAll();
+        }
+    }
+
+    size_t Drain()
+    {
+        size_t written = 0;
+
+        // Visit each producer's ring buffer once, so the group is finite under the load
+        for (size_t i = 0; i < _buffer.concurrency(); ++i)
+        {
+            std::span<const uint8_t> data = _buffer.Peek();
+            if (data.empty())
+                break;
+
+            // Reserve disk space in advance
+            while ((_preallocate > 0) && ((_offset + data.size()) > _allocated))
+            {
+                _file.Preallocate(_allocated, _preallocate);
+                _allocated += _preallocate;
+            }
+
+            // Write peeked records directly from the ring buffer
+            std::span<const uint8_t> buffers[1] = { data };
+            if (_file.WriteV(buffers) != data.size())
+                throwex FileSystemException("Cannot write records into the append log!").Attach(path());
+
+            _buffer.Release(data.size());
+            _offset += data.size();
+            written += data.size();
+        }
+
+        return written;
+    }
+};
+
+//! @endcond
+
+AppendLog::AppendLog(size_t capacity, size_t concurrency)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "AppendLog::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "AppendLog::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(capacity, concurrency);
+}
+
+AppendLog::~AppendLog()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+const Path& AppendLog::path() const noexcept { return impl().path(); }
+size_t AppendLog::max_size() const noexcept { return impl().max_size(); }
+uint64_t AppendLog::groups() const noexcept { return impl().groups(); }
+
+bool AppendLog::IsOpened() const noexcept { return impl().IsOpened(); }
+
+void AppendLog::Open(const Path& path, const Handler& handler, uint64_t preallocate) { impl().Open(path, handler, preallocate); }
+void AppendLog::Close() { impl().Close(); }
+
+uint64_t AppendLog::Append(const void* data, size_t size) { return impl().Append(data, size); }
+void AppendLog::Wait(uint64_t ticket) { impl().Wait(ticket); }
+void AppendLog::Flush() { impl().Flush(); }
+
+uint64_t AppendLog::Recover(const Path& path, const Handler& handler)
+{
+    if (!path.IsExists())
+        return 0;
+
+    // Scan the log file through the memory mapping
+    MappedFile mapped(path);
+    mapped.Advise(MappedFileAdvice::SEQUENTIAL);
+    const uint8_t* data = (const uint8_t*)mapped.data();
+    size_t size = mapped.size();
+
+    size_t offset = 0;
+    while ((size - offset) >= HEADER_SIZE)
+    {
+        // Stop at the truncated record
+        size_t length = Internals::LoadLog32(data + offset);
+        if (length > (size - offset - HEADER_SIZE))
+            break;
+
+        // Stop at the corrupted record
+        uint32_t crc = CRC32C::Compute(data + offset, 4);
+        crc = CRC32C::Compute(data + offset + HEADER_SIZE, length, crc);
+        if (crc != Internals::LoadLog32(data + offset + 4))
+            break;
+
+        if (handler)
+            handler(offset, std::span<const uint8_t>(data + offset + HEADER_SIZE, length));
+
+        offset += HEADER_SIZE + length;
+    }
+
+    return offset;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,852 @@
+/*!
+    \file async_file_io.cpp
+    \brief Asynchronous file I/O engine implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_file_io.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <memory>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define CPPCOMMON_IO_URING
+#endif
+#endif
+#endif
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+const size_t AsyncFileIO::DEFAULT_DEPTH = 256;
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Asynchronous file operations
+enum AsyncFileOperation : uint8_t
+{
+    ASYNC_READ,
+    ASYNC_WRITE,
+    ASYNC_FSYNC,
+    ASYNC_DATASYNC
+};
+
+// Maximal size of a single operation (operations with bigger buffers are completed partially)
+const size_t ASYNC_MAX_SIZE = 0x7FFFF000;
+
+} // namespace Internals
+
+class AsyncFileIO::Impl
+{
+public:
+#if defined(_WIN32) || defined(_WIN64)
+    typedef HANDLE Native;
+#else
+    typedef int Native;
+#endif
+
+    explicit Impl(size_t depth) : _depth(std::max(depth, (size_t)1)), _inflight(0), _pending(0)
+    {
+#if defined(CPPCOMMON_IO_URING)
+        SetupRing();
+#elif defined(_WIN32) || defined(_WIN64)
+        _port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (_port == nullptr)
+            throwex FileSystemException("Cannot create the I/O completion port!");
+#endif
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            // Pending operations refer to user buffers and opened files
+            WaitAll();
+        }
+        catch (const FileSystemException& ex)
+        {
+            fatality(FileSystemException(ex.string()));
+        }
+
+        for (auto& file : _files)
+            if (file.opened)
+                CloseNative(file.native);
+
+#if defined(CPPCOMMON_IO_URING)
+        TeardownRing();
+#elif defined(_WIN32) || defined(_WIN64)
+        CloseHandle(_port);
+#endif
+    }
+
+    size_t depth() const noexcept { return _depth; }
+    size_t pending() const noexcept { return _pending; }
+
+    bool native() const noexcept
+    {
+#if defined(CPPCOMMON_IO_URING)
+        return (_ring >= 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    const Path& path(FileId file) const { return GetFile(file).path; }
+
+    FileId Open(const Path& path, bool read, bool write, bool create, bool direct)
+    {
+        assert((read || write) && "Async file must be opened for reading or writing!");
+        if (!read && !write)
+            throwex FileSystemException("Async file must be opened for reading or writing!").Attach(path);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flags = (read && write) ? O_RDWR : (write ? O_WRONLY : O_RDONLY);
+        if (create)
+            flags |= O_CREAT;
+#if defined(O_DIRECT)
+        if (direct)
+            flags |= O_DIRECT;
+#endif
+        Native native = open(path.string().c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (native < 0)
+            throwex FileSystemException("Cannot open the file for asynchronous I/O!").Attach(path);
+#if defined(__APPLE__)
+        // Direct I/O on macOS is enabled by disabling the file cache
+        if (direct && (fcntl(native, F_NOCACHE, 1) != 0))
+        {
+            close(native);
+            throwex FileSystemException("Cannot enable direct I/O for the file!").Attach(path);
+        }
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD access = (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0);
+        DWORD flags = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | (direct ? (FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH) : 0);
+        Native native = CreateFileW(path.wstring().c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, create ? OPEN_ALWAYS : OPEN_EXISTING, flags, nullptr);
+        if (native == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open the file for asynchronous I/O!").Attach(path);
+        if (CreateIoCompletionPort(native, _port, 0, 0) == nullptr)
+        {
+            CloseHandle(native);
+            throwex FileSystemException("Cannot associate the file with the I/O completion port!").Attach(path);
+        }
+#endif
+
+        size_t index;
+        if (!_free_files.empty())
+        {
+            index = _free_files.back();
+            _free_files.pop_back();
+        }
+        else
+        {
+            index = _files.size();
+            _files.emplace_back();
+        }
+
+        FileEntry& file = _files[index];
+        file.native = native;
+        file.path = path;
+        file.opened = true;
+        return (FileId)(index + 1);
+    }
+
+    void Close(FileId file)
+    {
+        FileEntry& entry = GetFile(file);
+        bool closed = CloseNative(entry.native);
+        Path path = entry.path;
+        entry.path.Clear();
+        entry.opened = false;
+        _free_files.push_back((size_t)(file - 1));
+        if (!closed)
+            throwex FileSystemException("Cannot close the async file!").Attach(path);
+    }
+
+    void RegisterBuffers(const std::vector<std::span<uint8_t>>& buffers)
+    {
+        UnregisterBuffers();
+
+#if defined(CPPCOMMON_IO_URING)
+        if ((_ring >= 0) && !buffers.empty())
+        {
+            std::vector<struct iovec> iovecs;
+            iovecs.reserve(buffers.size());
+            for (const auto& buffer : buffers)
+                iovecs.push_back({ buffer.data(), buffer.size() });
+            if (syscall(__NR_io_uring_register, _ring, IORING_REGISTER_BUFFERS, iovecs.data(), (unsigned)iovecs.size()) < 0)
+                throwex FileSystemException("Cannot register io_uring buffers!");
+        }
+#endif
+
+        _buffers = buffers;
+    }
+
+    void UnregisterBuffers()
+    {
+        assert((_pending == 0) && "Buffers cannot be changed with pending operations!");
+        if (_pending > 0)
+            throwex FileSystemException("Buffers cannot be changed with pending operations!");
+
+        if (_buffers.empty())
+            return;
+
+#if defined(CPPCOMMON_IO_URING)
+        if (_ring >= 0)
+            if (syscall(__NR_io_uring_register, _ring, IORING_UNREGISTER_BUFFERS, nullptr, 0) < 0)
+                throwex FileSystemException("Cannot unregister io_uring buffers!");
+#endif
+
+        _buffers.clear();
+    }
+
+    void Queue(FileId file, uint8_t operation, uint64_t offset, void* buffer, size_t size, Handler&& handler)
+    {
+        assert(handler && "Completion handler must be valid!");
+        if (!handler)
+            throwex ArgumentException("Completion handler must be valid!");
+
+        const FileEntry& entry = GetFile(file);
+
+        uint32_t slot;
+        if (!_free.empty())
+        {
+            slot = _free.back();
+            _free.pop_back();
+        }
+        else
+        {
+            slot = (uint32_t)_requests.size();
+            _requests.push_back(std::make_unique<Request>());
+        }
+
+        Request& request = *_requests[slot];
+        request.operation = operation;
+        request.native = entry.native;
+        request.offset = offset;
+        request.buffer = buffer;
+        request.size = std::min(size, Internals::ASYNC_MAX_SIZE);
+        request.index = FindBuffer(buffer, request.size);
+        request.handler = std::move(handler);
+
+        _queued.push_back(slot);
+        ++_pending;
+    }
+
+    size_t Submit()
+    {
+#if defined(CPPCOMMON_IO_URING)
+        if (_ring >= 0)
+            return SubmitRing();
+#endif
+#if defined(_WIN32) || defined(_WIN64)
+        return SubmitPort();
+#else
+        return SubmitSync();
+#endif
+    }
+
+    size_t Poll()
+    {
+        Reap(false);
+        size_t result = Dispatch();
+
+        // Submit operations which did not fit into the queue depth
+        if (!_queued.empty())
+            Submit();
+
+        return result;
+    }
+
+    size_t Wait()
+    {
+        Submit();
+        if (_completed.empty() && (_inflight > 0))
+            Reap(true);
+        return Poll();
+    }
+
+    void WaitAll()
+    {
+        while (_pending > 0)
+            Wait();
+    }
+
+private:
+    // Opened file
+    struct FileEntry
+    {
+        Native native;
+        Path path;
+        bool opened{false};
+    };
+
+#if defined(_WIN32) || defined(_WIN64)
+    // Overlapped structure which refers to the request slot
+    struct Overlapped
+    {
+        OVERLAPPED overlapped;
+        uint32_t slot;
+    };
+#endif
+
+    // Operation request
+    struct Request
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        Overlapped overlapped;
+#elif defined(CPPCOMMON_IO_URING)
+        struct iovec iov;
+#endif
+        uint8_t operation;
+        int index;
+        Native native;
+        uint64_t offset;
+        void* buffer;
+        size_t size;
+        Handler handler;
+    };
+
+    // Operation completion
+    struct Completion
+    {
+        uint32_t slot;
+        size_t size;
+        int error;
+    };
+
+    size_t _depth;
+    size_t _inflight;
+    size_t _pending;
+    std::vector<std::unique_ptr<Request>> _requests;
+    std::vector<uint32_t> _free;
+    std::deque<uint32_t> _queued;
+    std::vector<Completion> _completed;
+    std::vector<FileEntry> _files;
+    std::vector<size_t> _free_files;
+    std::vector<std::span<uint8_t>> _buffers;
+
+#if defined(CPPCOMMON_IO_URING)
+    int _ring{-1};
+    uint32_t _unsubmitted{0};
+    void* _sq_ptr{nullptr};
+    size_t _sq_size{0};
+    void* _cq_ptr{nullptr};
+    size_t _cq_size{0};
+    io_uring_sqe* _sqes{nullptr};
+    size_t _sqes_size{0};
+    uint32_t* _sq_head{nullptr};
+    uint32_t* _sq_tail{nullptr};
+    uint32_t* _sq_array{nullptr};
+    uint32_t _sq_mask{0};
+    uint32_t _sq_entries{0};
+    uint32_t* _cq_head{nullptr};
+    uint32_t* _cq_tail{nullptr};
+    io_uring_cqe* _cqes{nullptr};
+    uint32_t _cq_mask{0};
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _port;
+#endif
+
+    FileEntry& GetFile(FileId file)
+    {
+        if ((file == 0) || (file > _files.size()) || !_files[(size_t)(file - 1)].opened)
+            throwex FileSystemException("Invalid async file Id!");
+        return _files[(size_t)(file - 1)];
+    }
+
+    const FileEntry& GetFile(FileId file) const
+    {
+        if ((file == 0) || (file > _files.size()) || !_files[(size_t)(file - 1)].opened)
+            throwex FileSystemException("Invalid async file Id!");
+        return _files[(size_t)(file - 1)];
+    }
+
+    static bool CloseNative(Native native)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return (close(native) == 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        return (CloseHandle(native) != 0);
+#endif
+    }
+
+    // Find the registered buffer which contains the given memory
+    int FindBuffer(const void* buffer, size_t size) const noexcept
+    {
+        const uint8_t* ptr = (const uint8_t*)buffer;
+        for (size_t i = 0; i < _buffers.size(); ++i)
+        {
+            const uint8_t* begin = _buffers[i].data();
+            if ((ptr >= begin) && (size <= _buffers[i].size()) && ((size_t)(ptr - begin) <= (_buffers[i].size() - size)))
+                return (int)i;
+        }
+        return -1;
+    }
+
+    // Dispatch all completed operations
+    size_t Dispatch()
+    {
+        std::vector<Completion> completed;
+        completed.swap(_completed);
+
+        size_t index = 0;
+        try
+        {
+            for (; index < completed.size(); ++index)
+            {
+                const Completion& completion = completed[index];
+                Request& request = *_requests[completion.slot];
+                Handler handler = std::move(request.handler);
+                request.handler = nullptr;
+                _free.push_back(completion.slot);
+                --_pending;
+                handler(completion.size, completion.error);
+            }
+        }
+        catch (...)
+        {
+            // Keep not dispatched completions for the next call
+            _completed.insert(_completed.begin(), completed.begin() + index + 1, completed.end());
+            throw;
+        }
+
+        // Reuse the completions buffer
+        size_t result = completed.size();
+        if (_completed.empty())
+        {
+            completed.clear();
+            _completed.swap(completed);
+        }
+        return result;
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Perform queued operations synchronously
+    size_t SubmitSync()
+    {
+        size_t result = 0;
+        while (!_queued.empty())
+        {
+            uint32_t slot = _queued.front();
+            _queued.pop_front();
+
+            Request& request = *_requests[slot];
+            ssize_t transferred;
+            do
+            {
+                switch (request.operation)
+                {
+                    case Internals::ASYNC_READ:
+                        transferred = pread(request.native, request.buffer, request.size, (off_t)request.offset);
+                        break;
+                    case Internals::ASYNC_WRITE:
+                        transferred = pwrite(request.native, request.buffer, request.size, (off_t)request.offset);
+                        break;
+                    case Internals::ASYNC_DATASYNC:
+#if defined(__APPLE__)
+                        transferred = fsync(request.native);
+#else
+                        transferred = fdatasync(request.native);
+#endif
+                        break;
+                    default:
+                        transferred = fsync(request.native);
+                        break;
+                }
+            } while ((transferred < 0) && (errno == EINTR));
+
+            _completed.push_back({ slot, (transferred < 0) ? 0 : (size_t)transferred, (transferred < 0) ? errno : 0 });
+            ++result;
+        }
+        return result;
+    }
+#endif
+
+#if defined(CPPCOMMON_IO_URING)
+    void SetupRing()
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+#if defined(IORING_SETUP_CLAMP)
+        params.flags |= IORING_SETUP_CLAMP;
+#endif
+
+        // Fallback to synchronous I/O if io_uring is not supported or not permitted
+        int ring = (int)syscall(__NR_io_uring_setup, (unsigned)std::min(_depth, (size_t)32768), &params);
+        if (ring < 0)
+            return;
+
+        _sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        _cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0);
+        if (single)
+            _sq_size = _cq_size = std::max(_sq_size, _cq_size);
+
+        _sq_ptr = mmap(nullptr, _sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+        if (_sq_ptr == MAP_FAILED)
+        {
+            _sq_ptr = nullptr;
+            close(ring);
+            return;
+        }
+
+        _cq_ptr = single ? _sq_ptr : mmap(nullptr, _cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+        if (_cq_ptr == MAP_FAILED)
+        {
+            _cq_ptr = nullptr;
+            munmap(_sq_ptr, _sq_size);
+            _sq_ptr = nullptr;
+            close(ring);
+            return;
+        }
+
+        _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            if (_cq_ptr != _sq_ptr)
+                munmap(_cq_ptr, _cq_size);
+            munmap(_sq_ptr, _sq_size);
+            _sq_ptr = _cq_ptr = nullptr;
+            close(ring);
+            return;
+        }
+
+        uint8_t* sq = (uint8_t*)_sq_ptr;
+        uint8_t* cq = (uint8_t*)_cq_ptr;
+        _sqes = (io_uring_sqe*)sqes;
+        _sq_head = (uint32_t*)(sq + params.sq_off.head);
+        _sq_tail = (uint32_t*)(sq + params.sq_off.tail);
+        _sq_array = (uint32_t*)(sq + params.sq_off.array);
+        _sq_mask = *(uint32_t*)(sq + params.sq_off.ring_mask);
+        _sq_entries = *(uint32_t*)(sq + params.sq_off.ring_entries);
+        _cq_head = (uint32_t*)(cq + params.cq_off.head);
+        _cq_tail = (uint32_t*)(cq + params.cq_off.tail);
+        _cqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+        _cq_mask = *(uint32_t*)(cq + params.cq_off.ring_mask);
+
+        // Completion queue must never overflow
+        _depth = std::min(_depth, (size_t)std::min(params.sq_entries, params.cq_entries));
+        _ring = ring;
+    }
+
+    void TeardownRing()
+    {
+        if (_ring < 0)
+            return;
+
+        munmap(_sqes, _sqes_size);
+        if (_cq_ptr != _sq_ptr)
+            munmap(_cq_ptr, _cq_size);
+        munmap(_sq_ptr, _sq_size);
+        close(_ring);
+        _ring = -1;
+    }
+
+    // Pass prepared submission entries to the kernel and optionally wait for completions
+    void Enter(uint32_t wait)
+    {
+        for (;;)
+        {
+            int result = (int)syscall(__NR_io_uring_enter, _ring, _unsubmitted, wait, (wait > 0) ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+            if (result >= 0)
+            {
+                _unsubmitted -= std::min((uint32_t)result, _unsubmitted);
+                return;
+            }
+
+            // Interrupted wait is restarted
+            if ((errno == EINTR) && (wait > 0))
+                continue;
+            // Kernel resources are temporary exhausted, submission is retried by the next call
+            if ((errno == EINTR) || (errno == EAGAIN) || (errno == EBUSY))
+                return;
+
+            throwex FileSystemException("Cannot submit io_uring operations!");
+        }
+    }
+
+    size_t SubmitRing()
+    {
+        size_t result = 0;
+        uint32_t tail = *_sq_tail;
+        uint32_t head = __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+        while (!_queued.empty() && ((tail - head) < _sq_entries) && (_inflight < _depth))
+        {
+            uint32_t slot = _queued.front();
+            _queued.pop_front();
+
+            Request& request = *_requests[slot];
+            uint32_t index = tail & _sq_mask;
+            io_uring_sqe& sqe = _sqes[index];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.fd = request.native;
+            sqe.user_data = slot;
+            switch (request.operation)
+            {
+                case Internals::ASYNC_READ:
+                case Internals::ASYNC_WRITE:
+                    sqe.off = request.offset;
+                    if (request.index >= 0)
+                    {
+                        // Registered buffers are not mapped into the kernel for each operation
+                        sqe.opcode = (request.operation == Internals::ASYNC_READ) ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+                        sqe.addr = (uint64_t)(uintptr_t)request.buffer;
+                        sqe.len = (uint32_t)request.size;
+                        sqe.buf_index = (uint16_t)request.index;
+                    }
+                    else
+                    {
+                        sqe.opcode = (request.operation == Internals::ASYNC_READ) ? IORING_OP_READV : IORING_OP_WRITEV;
+                        request.iov.iov_base = request.buffer;
+                        request.iov.iov_len = request.size;
+                        sqe.addr = (uint64_t)(uintptr_t)&request.iov;
+                        sqe.len = 1;
+                    }
+                    break;
+                case Internals::ASYNC_FSYNC:
+                    sqe.opcode = IORING_OP_FSYNC;
+                    break;
+                case Internals::ASYNC_DATASYNC:
+                    sqe.opcode = IORING_OP_FSYNC;
+                    sqe.fsync_flags = IORING_FSYNC_DATASYNC;
+                    break;
+            }
+            _sq_array[index] = index;
+
+            ++tail;
+            ++_inflight;
+            ++_unsubmitted;
+            ++result;
+        }
+        __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+        if (_unsubmitted > 0)
+            Enter(0);
+
+        return result;
+    }
+#endif
+
+#if defined(_WIN32) || defined(_WIN64)
+    size_t SubmitPort()
+    {
+        size_t result = 0;
+        while (!_queued.empty() && (_inflight < _depth))
+        {
+            uint32_t slot = _queued.front();
+            _queued.pop_front();
+            ++result;
+
+            Request& request = *_requests[slot];
+
+            // Windows has no asynchronous flush
+            if ((request.operation == Internals::ASYNC_FSYNC) || (request.operation == Internals::ASYNC_DATASYNC))
+            {
+                BOOL flushed = FlushFileBuffers(request.native);
+                _completed.push_back({ slot, 0, flushed ? 0 : (int)GetLastError() });
+                continue;
+            }
+
+            std::memset(&request.overlapped.overlapped, 0, sizeof(OVERLAPPED));
+            request.overlapped.overlapped.Offset = (DWORD)(request.offset & 0xFFFFFFFF);
+            request.overlapped.overlapped.OffsetHigh = (DWORD)(request.offset >> 32);
+            request.overlapped.slot = slot;
+
+            BOOL started = (request.operation == Internals::ASYNC_READ) ?
+                ReadFile(request.native, request.buffer, (DWORD)request.size, nullptr, &request.overlapped.overlapped) :
+                WriteFile(request.native, request.buffer, (DWORD)request.size, nullptr, &request.overlapped.overlapped);
+            if (!started)
+            {
+                // Failed operations are not posted into the I/O completion port
+                DWORD error = GetLastError();
+                if (error != ERROR_IO_PENDING)
+                {
+                    _completed.push_back({ slot, 0, (error == ERROR_HANDLE_EOF) ? 0 : (int)error });
+                    continue;
+                }
+            }
+
+            ++_inflight;
+        }
+        return result;
+    }
+#endif
+
+    // Collect completions of submitted operations
+    void Reap(bool wait)
+    {
+#if defined(CPPCOMMON_IO_URING)
+        if (_ring < 0)
+            return;
+
+        if (wait)
+            Enter(1);
+
+        uint32_t head = *_cq_head;
+        uint32_t tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head)
+        {
+            const io_uring_cqe& cqe = _cqes[head & _cq_mask];
+            _completed.push_back({ (uint32_t)cqe.user_data, (cqe.res < 0) ? 0 : (size_t)cqe.res, (cqe.res < 0) ? -cqe.res : 0 });
+            --_inflight;
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD timeout = wait ? INFINITE : 0;
+        while (_inflight > 0)
+        {
+            OVERLAPPED_ENTRY entries[64];
+            ULONG count = 0;
+            if (!GetQueuedCompletionStatusEx(_port, entries, (ULONG)std::size(entries), &count, timeout, FALSE))
+            {
+                if (GetLastError() == WAIT_TIMEOUT)
+                    return;
+                throwex FileSystemException("Cannot get I/O completion port status!");
+            }
+
+            for (ULONG i = 0; i < count; ++i)
+            {
+                Overlapped* overlapped = (Overlapped*)entries[i].lpOverlapped;
+                Request& request = *_requests[overlapped->slot];
+                DWORD transferred = 0;
+                int error = 0;
+                if (!GetOverlappedResult(request.native, &overlapped->overlapped, &transferred, FALSE))
+                {
+                    error = (int)GetLastError();
+                    if (error == ERROR_HANDLE_EOF)
+                        error = 0;
+                }
+                _completed.push_back({ overlapped->slot, (size_t)transferred, error });
+                --_inflight;
+            }
+
+            // Drain the rest of completions without waiting
+            if (count < std::size(entries))
+                return;
+            timeout = 0;
+        }
+#else
+        (void)wait;
+#endif
+    }
+};
+
+//! @endcond
+
+AsyncFileIO::AsyncFileIO(size_t depth)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "AsyncFileIO::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "AsyncFileIO::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(depth);
+}
+
+AsyncFileIO::~AsyncFileIO()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+size_t AsyncFileIO::depth() const noexcept { return impl().depth(); }
+size_t AsyncFileIO::pending() const noexcept { return impl().pending(); }
+bool AsyncFileIO::native() const noexcept { return impl().native(); }
+
+AsyncFileIO::FileId AsyncFileIO::Open(const Path& path, bool read, bool write, bool create, bool direct) { return impl().Open(path, read, write, create, direct); }
+void AsyncFileIO::Close(FileId file) { impl().Close(file); }
+
+void AsyncFileIO::RegisterBuffers(const std::vector<std::span<uint8_t>>& buffers) { impl().RegisterBuffers(buffers); }
+void AsyncFileIO::UnregisterBuffers() { impl().UnregisterBuffers(); }
+
+void AsyncFileIO::Read(FileId file, uint64_t offset, void* buffer, size_t size, Handler handler)
+{
+    impl().Queue(file, Internals::ASYNC_READ, offset, buffer, size, std::move(handler));
+}
+
+std::future<size_t> AsyncFileIO::Read(FileId file, uint64_t offset, void* buffer, size_t size)
+{
+    auto promise = std::make_shared<std::promise<size_t>>();
+    std::future<size_t> result = promise->get_future();
+    Read(file, offset, buffer, size, [promise, path = impl().path(file)](size_t transferred, int error)
+    {
+        if (error == 0)
+            promise->set_value(transferred);
+        else
+            promise->set_exception(std::make_exception_ptr(FileSystemException("Cannot read the async file!", error).Attach(path)));
+    });
+    return result;
+}
+
+void AsyncFileIO::Write(FileId file, uint64_t offset, const void* buffer, size_t size, Handler handler)
+{
+    impl().Queue(file, Internals::ASYNC_WRITE, offset, const_cast<void*>(buffer), size, std::move(handler));
+}
+
+std::future<size_t> AsyncFileIO::Write(FileId file, uint64_t offset, const void* buffer, size_t size)
+{
+    auto promise = std::make_shared<std::promise<size_t>>();
+    std::future<size_t> result = promise->get_future();
+    Write(file, offset, buffer, size, [promise, path = impl().path(file)](size_t transferred, int error)
+    {
+        if (error == 0)
+            promise->set_value(transferred);
+        else
+            promise->set_exception(std::make_exception_ptr(FileSystemException("Cannot write the async file!", error).Attach(path)));
+    });
+    return result;
+}
+
+void AsyncFileIO::Fsync(FileId file, bool datasync, Handler handler)
+{
+    impl().Queue(file, datasync ? Internals::ASYNC_DATASYNC : Internals::ASYNC_FSYNC, 0, nullptr, 0, std::move(handler));
+}
+
+std::future<void> AsyncFileIO::Fsync(FileId file, bool datasync)
+{
+    auto promise = std::make_shared<std::promise<void>>();
+    std::future<void> result = promise->get_future();
+    Fsync(file, datasync, [promise, path = impl().path(file)](size_t, int error)
+    {
+        if (error == 0)
+            promise->set_value();
+        else
+            promise->set_exception(std::make_exception_ptr(FileSystemException("Cannot flush the async file!", error).Attach(path)));
+    });
+    return result;
+}
+
+size_t AsyncFileIO::Submit() { return impl().Submit(); }
+size_t AsyncFileIO::Poll() { return impl().Poll(); }
+size_t AsyncFileIO::Wait() { return impl().Wait(); }
+void AsyncFileIO::WaitAll() { impl().WaitAll(); }
+
+} // namespace CppCommon
@@ -8,23 +8,431 @@
 
 #include "filesystem/directory.h"
 
+#include "string/glob_pattern.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "threads/thread_pool.h"
 #include "utility/countof.h"
 #include "utility/resource.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <exception>
+#include <memory>
 #include <regex>
+#include <utility>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/stat.h>
 #include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+FileType StatusType(mode_t mode) noexcept
+{
+    if (S_ISREG(mode))
+        return FileType::REGULAR;
+    else if (S_ISDIR(mode))
+        return FileType::DIRECTORY;
+    else if (S_ISLNK(mode))
+        return FileType::SYMLINK;
+    else if (S_ISBLK(mode))
+        return FileType::BLOCK;
+    else if (S_ISCHR(mode))
+        return FileType::CHARACTER;
+    else if (S_ISFIFO(mode))
+        return FileType::FIFO;
+    else if (S_ISSOCK(mode))
+        return FileType::SOCKET;
+    else
+        return FileType::UNKNOWN;
+}
+
+FileType EntryType(int directory, const char* name, unsigned char type) noexcept
+{
+    switch (type)
+    {
+        case DT_REG:
+            return FileType::REGULAR;
+        case DT_DIR:
+            return FileType::DIRECTORY;
+        case DT_LNK:
+            return FileType::SYMLINK;
+        case DT_BLK:
+            return FileType::BLOCK;
+        case DT_CHR:
+            return FileType::CHARACTER;
+        case DT_FIFO:
+            return FileType::FIFO;
+        case DT_SOCK:
+            return FileType::SOCKET;
+        default:
+        {
+            // File system does not provide entry types, so request the entry status
+            struct stat status;
+            if (fstatat(directory, name, &status, AT_SYMLINK_NOFOLLOW) != 0)
+                return FileType::NONE;
+            return StatusType(status.st_mode);
+        }
+    }
+}
+
+FileType TargetType(int directory, const char* name) noexcept
+{
+    struct stat status;
+    if (fstatat(directory, name, &status, 0) != 0)
+        return FileType::NONE;
+    return StatusType(status.st_mode);
+}
+
+#endif
+
+// Directory walker scans directories and reports their entries
+class DirectoryWalker
+{
+public:
+    DirectoryWalker(const Directory::WalkHandler& handler, const DirectoryWalkOptions& options)
+        : _handler(handler),
+          _options(options),
+          _matcher(options.pattern),
+          _count(0),
+          _stopped(false)
+    {
+    }
+
+    size_t count() const noexcept { return _count.load(std::memory_order_acquire); }
+    bool stopped() const noexcept { return _stopped.load(std::memory_order_relaxed); }
+
+    void Stop() noexcept { _stopped.store(true, std::memory_order_relaxed); }
+
+    // Scan the directory and push its sub-directories to walk: void push(Path&& directory, size_t depth)
+    template <class TPush>
+    void Scan(const Path& parent, size_t depth, std::vector<uint8_t>& buffer, TPush&& push)
+    {
+#if defined(__linux__)
+        int directory = open(parent.string().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (directory < 0)
+            throwex FileSystemException("Cannot open a directory!").Attach(parent);
+
+        // Smart resource cleaner pattern
+        auto cleaner = resource(&directory, [](int* fd) { close(*fd); });
+
+        // Read directory records in large batches
+        buffer.resize(BUFFER_SIZE);
+        for (;;)
+        {
+            long size = syscall(SYS_getdents64, directory, buffer.data(), buffer.size());
+            if (size < 0)
+                throwex FileSystemException("Cannot read directory entries!").Attach(parent);
+            if (size == 0)
+                break;
+
+            for (long offset = 0; offset < size;)
+            {
+                const struct dirent64* pentry = (const struct dirent64*)(buffer.data() + offset);
+                offset += pentry->d_reclen;
+
+                if (IsSpecial(pentry->d_name))
+                    continue;
+
+                FileType type = EntryType(directory, pentry->d_name, pentry->d_type);
+                FileType target = ((type == FileType::SYMLINK) && _options.symlinks) ? TargetType(directory, pentry->d_name) : type;
+                auto status = [&parent, directory, pentry]() { return Status(parent, directory, pentry->d_name); };
+                if (!Report(parent, pentry->d_name, type, target, depth, (uint64_t)pentry->d_ino, status, push))
+                    return;
+            }
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        DIR* dir = opendir(parent.string().c_str());
+        if (dir == nullptr)
+            throwex FileSystemException("Cannot open a directory!").Attach(parent);
+
+        // Smart resource cleaner pattern
+        auto cleaner = resource(dir, [](DIR* dirp) { closedir(dirp); });
+
+        int directory = dirfd(dir);
+
+        struct dirent* pentry;
+        while ((pentry = readdir(dir)) != nullptr)
+        {
+            if (IsSpecial(pentry->d_name))
+                continue;
+
+            FileType type = EntryType(directory, pentry->d_name, pentry->d_type);
+            FileType target = ((type == FileType::SYMLINK) && _options.symlinks) ? TargetType(directory, pentry->d_name) : type;
+            auto status = [&parent, directory, pentry]() { return Status(parent, directory, pentry->d_name); };
+            if (!Report(parent, pentry->d_name, type, target, depth, (uint64_t)pentry->d_ino, status, push))
+                return;
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        WIN32_FIND_DATAW fd;
+        HANDLE hDirectory = FindFirstFileExW((parent / "*").wstring().c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+        if (hDirectory == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open a directory!").Attach(parent);
+
+        // Smart resource cleaner pattern
+        auto cleaner = resource(hDirectory, [](HANDLE hFindFile) { FindClose(hFindFile); });
+
+        do
+        {
+            if ((std::wcsncmp(fd.cFileName, L".", countof(fd.cFileName)) == 0) || (std::wcsncmp(fd.cFileName, L"..", countof(fd.cFileName)) == 0))
+                continue;
+
+            FileType type = FileType::REGULAR;
+            if ((fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) && (fd.dwReserved0 == IO_REPARSE_TAG_SYMLINK))
+                type = FileType::SYMLINK;
+            else if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                type = FileType::DIRECTORY;
+
+            // Symbolic link to directory has the directory attribute
+            FileType target = type;
+            if ((type == FileType::SYMLINK) && _options.symlinks)
+                target = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? FileType::DIRECTORY : FileType::REGULAR;
+
+            auto status = [&fd]()
+            {
+                ULARGE_INTEGER size;
+                size.LowPart = fd.nFileSizeLow;
+                size.HighPart = fd.nFileSizeHigh;
+                ULARGE_INTEGER created;
+                created.LowPart = fd.ftCreationTime.dwLowDateTime;
+                created.HighPart = fd.ftCreationTime.dwHighDateTime;
+                ULARGE_INTEGER modified;
+                modified.LowPart = fd.ftLastWriteTime.dwLowDateTime;
+                modified.HighPart = fd.ftLastWriteTime.dwHighDateTime;
+                return StatusFindData(fd.dwFileAttributes, size.QuadPart, created.QuadPart, modified.QuadPart);
+            };
+
+            std::string name = Encoding::ToUTF8(fd.cFileName);
+            if (!Report(parent, name.c_str(), type, target, depth, 0, status, push))
+                return;
+        } while (FindNextFileW(hDirectory, &fd) != 0);
+
+        if (GetLastError() != ERROR_NO_MORE_FILES)
+            throwex FileSystemException("Cannot read directory entries!").Attach(parent);
+#endif
+    }
+
+private:
+    // Directory records buffer size (64 KiB)
+    static const size_t BUFFER_SIZE = 65536;
+
+    const Directory::WalkHandler& _handler;
+    const DirectoryWalkOptions& _options;
+    const std::regex _matcher;
+    std::atomic<size_t> _count;
+    std::atomic<bool> _stopped;
+
+    static bool IsSpecial(const char* name) noexcept
+    {
+        return (name[0] == '.') && ((name[1] == 0) || ((name[1] == '.') && (name[2] == 0)));
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static PathStatus Status(const Path& parent, int directory, const char* name)
+    {
+        std::error_code ec;
+        PathStatus result = StatusAt(directory, name, ec);
+        if (ec)
+            throwex FileSystemException("Cannot get the status of the path!").Attach(parent / name);
+        return result;
+    }
+#endif
+
+    template <class TStatus, class TPush>
+    bool Report(const Path& parent, const char* name, FileType type, FileType target, size_t depth, uint64_t inode, TStatus& status, TPush& push)
+    {
+        if (stopped())
+            return false;
+
+        // Match the raw entry name before any path is constructed
+        std::string_view view(name);
+        if ((_options.pattern.empty() || std::regex_match(view.begin(), view.end(), _matcher)) && ((_options.glob == nullptr) || _options.glob->Match(view)))
+        {
+            _count.fetch_add(1, std::memory_order_relaxed);
+
+            // Request the entry status only for matched entries
+            PathStatus info;
+            if (_options.status)
+                info = status();
+
+            DirectoryEntry entry{ parent, view, type, target, depth, inode, _options.status ? &info : nullptr };
+            if (!_handler(entry))
+            {
+                Stop();
+                return false;
+            }
+        }
+
+        // Sub-directory is walked after its entry is reported
+        if (_options.recursive && (target == FileType::DIRECTORY))
+            push(parent / view, depth + 1);
+
+        return true;
+    }
+};
+
+// Parallel directory walk shared by the calling thread and workers of the thread pool
+class DirectoryWalkJob
+{
+public:
+    DirectoryWalkJob(DirectoryWalker& walker, const Path& root) : _walker(walker), _active(0)
+    {
+        _queue.emplace_back(root, 0);
+    }
+
+    // Walk queued directories until all of them are scanned
+    void Run() noexcept
+    {
+        std::vector<uint8_t> buffer;
+        std::vector<std::pair<Path, size_t>> found;
+
+        for (;;)
+        {
+            std::pair<Path, size_t> current;
+            {
+                Locker<CriticalSection> locker(_cs);
+
+                // Late workers never touch the walker after all directories are scanned
+                _cv.Wait(_cs, [this]() { return !_queue.empty() || (_active == 0); });
+                if (_queue.empty())
+                    return;
+
+                current = std::move(_queue.back());
+                _queue.pop_back();
+                ++_active;
+            }
+
+            if (!_walker.stopped())
+            {
+                try
+                {
+                    _walker.Scan(current.first, current.second, buffer, [&found](Path&& directory, size_t depth) { found.emplace_back(std::move(directory), depth); });
+                }
+                catch (...)
+                {
+                    Locker<CriticalSection> locker(_cs);
+                    if (!_exception)
+                        _exception = std::current_exception();
+                    _walker.Stop();
+                }
+            }
+
+            {
+                Locker<CriticalSection> locker(_cs);
+
+                // Stopped walk drops found sub-directories
+                if (!_walker.stopped())
+                    for (auto& directory : found)
+                        _queue.emplace_back(std::move(directory));
+                --_active;
+
+                if (!found.empty() || (_active == 0))
+                    _cv.NotifyAll();
+            }
+
+            found.clear();
+        }
+    }
+
+    // Rethrow the first exception of the walk
+    void Rethrow()
+    {
+        if (_exception)
+            std::rethrow_exception(_exception);
+    }
+
+private:
+    DirectoryWalker& _walker;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    std::vector<std::pair<Path, size_t>> _queue;
+    size_t _active;
+    std::exception_ptr _exception;
+};
+
+// Collect walked entries of the given type
+template <typename T, class TFilter>
+std::vector<T> CollectEntries(const Directory& directory, DirectoryWalkOptions& options, bool recursive, bool symlinks, TFilter filter)
+{
+    std::vector<T> result;
+    options.recursive = recursive;
+    options.symlinks = symlinks;
+    directory.Walk([&result, &filter](const DirectoryEntry& entry)
+    {
+        if (filter(entry))
+            result.emplace_back(entry.path());
+        return true;
+    }, options);
+    return result;
+}
+
+// List walked entries of the given type into the directory listing
+template <class TFilter>
+DirectoryListing ListEntries(const Directory& directory, const DirectoryWalkOptions& options, TFilter filter)
+{
+    DirectoryListing result;
+    CriticalSection cs;
+    bool concurrent = (options.pool != nullptr);
+    directory.Walk([&result, &cs, &filter, concurrent](const DirectoryEntry& entry)
+    {
+        if (filter(entry))
+        {
+            // Handler is called concurrently only with the thread pool
+            if (concurrent)
+            {
+                Locker<CriticalSection> locker(cs);
+                result.Add(entry.parent.string(), entry.name, entry.type, entry.target, entry.inode, entry.depth, entry.status);
+            }
+            else
+                result.Add(entry.parent.string(), entry.name, entry.type, entry.target, entry.inode, entry.depth, entry.status);
+        }
+        return true;
+    }, options);
+    return result;
+}
+
+inline bool IsAnyEntry(const DirectoryEntry&)
+{
+    return true;
+}
+
+inline bool IsDirectoryEntry(const DirectoryEntry& entry)
+{
+    // Special check for directory (including symbolic link directory)
+    return (entry.target == FileType::DIRECTORY);
+}
+
+inline bool IsFileEntry(const DirectoryEntry& entry)
+{
+    // Special check for directory (including symbolic link directory)
+    return (entry.target != FileType::DIRECTORY);
+}
+
+inline bool IsSymlinkEntry(const DirectoryEntry& entry)
+{
+    // Special check for symbolic link
+    return (entry.type == FileType::SYMLINK);
+}
+
+} // namespace Internals
+//! @endcond
+
 const Flags<FileAttributes> Directory::DEFAULT_ATTRIBUTES = FileAttributes::NORMAL;
 const Flags<FilePermissions> Directory::DEFAULT_PERMISSIONS = FilePermissions::IRUSR | FilePermissions::IWUSR | FilePermissions::IXUSR | FilePermissions::IRGRP | FilePermissions::IXGRP | FilePermissions::IROTH | FilePermissions::IXOTH;
 
@@ -136,126 +544,163 @@ DirectoryIterator Directory::rend() const
 
 std::vector<Path> Directory::GetEntries(const std::string& pattern)
 {
-    std::vector<Path> result;
-    std::regex matcher(pattern);
-    for (auto it = begin(); it != end(); ++it)
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-            result.push_back(*it);
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<Path>(*this, options, false, false, Internals::IsAnyEntry);
+}
+
+std::vector<Path> Directory::GetEntries(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<Path>(*this, options, false, false, Internals::IsAnyEntry);
 }
 
 std::vector<Path> Directory::GetEntriesRecursive(const std::string& pattern)
 {
-    std::vector<Path> result;
-    std::regex matcher(pattern);
-    for (auto it = rbegin(); it != rend(); ++it)
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-            result.push_back(Directory(*it));
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<Path>(*this, options, true, true, Internals::IsAnyEntry);
+}
+
+std::vector<Path> Directory::GetEntriesRecursive(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<Path>(*this, options, true, true, Internals::IsAnyEntry);
 }
 
 std::vector<Directory> Directory::GetDirectories(const std::string& pattern)
 {
-    std::vector<Directory> result;
-    std::regex matcher(pattern);
-    for (auto it = begin(); it != end(); ++it)
-    {
-        // Special check for symbolic link
-        Directory target(*it);
-        if (it->IsSymlink())
-            target = Symlink(target).target();
-
-        // Special check for directory
-        if (target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                result.emplace_back(*it);
-    }
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<Directory>(*this, options, false, true, Internals::IsDirectoryEntry);
+}
+
+std::vector<Directory> Directory::GetDirectories(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<Directory>(*this, options, false, true, Internals::IsDirectoryEntry);
 }
 
 std::vector<Directory> Directory::GetDirectoriesRecursive(const std::string& pattern)
 {
-    std::vector<Directory> result;
-    std::regex matcher(pattern);
-    for (auto it = rbegin(); it != rend(); ++it)
-    {
-        // Special check for symbolic link
-        Directory target(*it);
-        if (it->IsSymlink())
-            target = Symlink(target).target();
-
-        // Special check for directory
-        if (target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                result.emplace_back(*it);
-    }
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<Directory>(*this, options, true, true, Internals::IsDirectoryEntry);
+}
+
+std::vector<Directory> Directory::GetDirectoriesRecursive(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<Directory>(*this, options, true, true, Internals::IsDirectoryEntry);
 }
 
 std::vector<File> Directory::GetFiles(const std::string& pattern)
 {
-    std::vector<File> result;
-    std::regex matcher(pattern);
-    for (auto it = begin(); it != end(); ++it)
-    {
-        // Special check for symbolic link
-        File target(*it);
-        if (it->IsSymlink())
-            target = Symlink(target).target();
-
-        // Special check for directory
-        if (!target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                result.emplace_back(*it);
-    }
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<File>(*this, options, false, true, Internals::IsFileEntry);
+}
+
+std::vector<File> Directory::GetFiles(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<File>(*this, options, false, true, Internals::IsFileEntry);
 }
 
 std::vector<File> Directory::GetFilesRecursive(const std::string& pattern)
 {
-    std::vector<File> result;
-    std::regex matcher(pattern);
-    for (auto it = rbegin(); it != rend(); ++it)
-    {
-        // Special check for symbolic link
-        File target(*it);
-        if (it->IsSymlink())
-            target = Symlink(target).target();
-
-        // Special check for directory
-        if (!target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                result.emplace_back(*it);
-    }
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<File>(*this, options, true, true, Internals::IsFileEntry);
+}
+
+std::vector<File> Directory::GetFilesRecursive(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<File>(*this, options, true, true, Internals::IsFileEntry);
 }
 
 std::vector<Symlink> Directory::GetSymlinks(const std::string& pattern)
 {
-    std::vector<Symlink> result;
-    std::regex matcher(pattern);
-    for (auto it = begin(); it != end(); ++it)
-    {
-        // Special check for symbolic link
-        if (it->IsSymlink())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                result.emplace_back(*it);
-    }
-    return result;
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<Symlink>(*this, options, false, false, Internals::IsSymlinkEntry);
+}
+
+std::vector<Symlink> Directory::GetSymlinks(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<Symlink>(*this, options, false, false, Internals::IsSymlinkEntry);
 }
 
 std::vector<Symlink> Directory::GetSymlinksRecursive(const std::string& pattern)
 {
-    std::vector<Symlink> result;
-    std::regex matcher(pattern);
-    for (auto it = rbegin(); it != rend(); ++it)
+    DirectoryWalkOptions options;
+    options.pattern = pattern;
+    return Internals::CollectEntries<Symlink>(*this, options, true, true, Internals::IsSymlinkEntry);
+}
+
+std::vector<Symlink> Directory::GetSymlinksRecursive(const GlobPattern& pattern)
+{
+    DirectoryWalkOptions options;
+    options.glob = &pattern;
+    return Internals::CollectEntries<Symlink>(*this, options, true, true, Internals::IsSymlinkEntry);
+}
+
+size_t Directory::Walk(const WalkHandler& handler, const DirectoryWalkOptions& options) const
+{
+    Internals::DirectoryWalker walker(handler, options);
+
+    // Count of workers of the thread pool to take part in the walk
+    size_t workers = 0;
+    if (options.recursive && (options.pool != nullptr) && !options.pool->stopped())
     {
-        // Special check for symbolic link
-        if (it->IsSymlink())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                result.emplace_back(*it);
+        workers = options.pool->threads();
+        if (options.concurrency > 0)
+            workers = std::min(workers, options.concurrency - 1);
     }
-    return result;
+
+    // Walk sub-directories with workers of the thread pool and the calling thread
+    if (workers > 0)
+    {
+        // Not posted tasks are not required, the calling thread walks all queued directories
+        auto job = std::make_shared<Internals::DirectoryWalkJob>(walker, *this);
+        for (size_t i = 0; i < workers; ++i)
+            options.pool->Post([job]() { job->Run(); });
+
+        job->Run();
+        job->Rethrow();
+        return walker.count();
+    }
+
+    // Walk sub-directories in the calling thread
+    std::vector<uint8_t> buffer;
+    std::vector<std::pair<Path, size_t>> stack;
+    stack.emplace_back(*this, 0);
+    while (!stack.empty() && !walker.stopped())
+    {
+        std::pair<Path, size_t> current = std::move(stack.back());
+        stack.pop_back();
+        walker.Scan(current.first, current.second, buffer, [&stack](Path&& directory, size_t depth) { stack.emplace_back(std::move(directory), depth); });
+    }
+    return walker.count();
+}
+
+DirectoryListing Directory::ListEntries(const DirectoryWalkOptions& options) const
+{
+    return Internals::ListEntries(*this, options, Internals::IsAnyEntry);
+}
+
+DirectoryListing Directory::ListFiles(const DirectoryWalkOptions& options) const
+{
+    return Internals::ListEntries(*this, options, Internals::IsFileEntry);
 }
 
 Directory Directory::Create(const Path& path, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions)
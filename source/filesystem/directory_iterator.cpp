@@ -38,6 +38,7 @@ public:
     const Path& current() const noexcept { return _current; }
 
     virtual Path Next() = 0;
+    virtual PathStatus Status() const = 0;
 
 protected:
     Path _parent;
@@ -90,6 +91,12 @@ public:
                 continue;
             if (std::strncmp(pentry->d_name, "..", sizeof(pentry->d_name)) == 0)
                 continue;
+            // Keep the entry name and type for metadata queries
+            std::strncpy(_entry.d_name, pentry->d_name, sizeof(_entry.d_name) - 1);
+            _entry.d_name[sizeof(_entry.d_name) - 1] = '\0';
+#if defined(DT_UNKNOWN)
+            _entry.d_type = pentry->d_type;
+#endif
             _current = _parent / pentry->d_name;
             return _current;
         }
@@ -118,6 +125,67 @@ public:
         return _current;
     }
 
+    PathStatus Status() const override
+    {
+        if (_current.empty())
+            return PathStatus();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        std::error_code ec;
+        PathStatus result = Internals::StatusAt(dirfd(_directory), _entry.d_name, ec);
+        if (ec)
+            throwex FileSystemException("Cannot get the status of the path!").Attach(_current);
+        return result;
+#elif defined(_WIN32) || defined(_WIN64)
+        ULARGE_INTEGER size;
+        size.LowPart = _entry.nFileSizeLow;
+        size.HighPart = _entry.nFileSizeHigh;
+        ULARGE_INTEGER created;
+        created.LowPart = _entry.ftCreationTime.dwLowDateTime;
+        created.HighPart = _entry.ftCreationTime.dwHighDateTime;
+        ULARGE_INTEGER modified;
+        modified.LowPart = _entry.ftLastWriteTime.dwLowDateTime;
+        modified.HighPart = _entry.ftLastWriteTime.dwHighDateTime;
+        return Internals::StatusFindData(_entry.dwFileAttributes, size.QuadPart, created.QuadPart, modified.QuadPart);
+#endif
+    }
+
+    // Get the current entry type without system calls (FileType::UNKNOWN if not provided)
+    FileType Type() const noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#if defined(DT_UNKNOWN)
+        switch (_entry.d_type)
+        {
+            case DT_DIR:
+                return FileType::DIRECTORY;
+            case DT_LNK:
+                return FileType::SYMLINK;
+            case DT_REG:
+                return FileType::REGULAR;
+            case DT_BLK:
+                return FileType::BLOCK;
+            case DT_CHR:
+                return FileType::CHARACTER;
+            case DT_FIFO:
+                return FileType::FIFO;
+            case DT_SOCK:
+                return FileType::SOCKET;
+            default:
+                return FileType::UNKNOWN;
+        }
+#else
+        return FileType::UNKNOWN;
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+        if (_entry.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+            return FileType::SYMLINK;
+        else if (_entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            return FileType::DIRECTORY;
+        else
+            return FileType::REGULAR;
+#endif
+    }
+
     void Move(SimpleImpl& instance)
     {
         _parent = instance._parent;
@@ -179,13 +247,21 @@ public:
             return _current.current();
         }
 
+        // Directory entry type is usually known without system calls
+        FileType type = _current.Type();
+        if (type == FileType::UNKNOWN)
+            type = result.type();
+
         // Special check for symbolic link
         Path target(result);
-        if (result.IsSymlink())
+        if (type == FileType::SYMLINK)
+        {
             target = Symlink(target).target();
+            type = target.type();
+        }
 
         // Special check for directory
-        if (target.IsDirectory())
+        if (type == FileType::DIRECTORY)
         {
             // Put the current iterator to stack
             _stack.push(_current);
@@ -201,6 +277,8 @@ public:
         return result;
     }
 
+    PathStatus Status() const override { return _current.Status(); }
+
 private:
     SimpleImpl _current;
     std::stack<SimpleImpl> _stack;
@@ -254,6 +332,15 @@ DirectoryIterator& DirectoryIterator::operator++()
     return *this;
 }
 
+PathStatus DirectoryIterator::status() const
+{
+    if (_current.empty())
+        return PathStatus();
+    if (!_pimpl)
+        return _current.status();
+    return _pimpl->Status();
+}
+
 DirectoryIterator DirectoryIterator::operator++(int)
 {
     DirectoryIterator result(_current);
@@ -0,0 +1,290 @@
+/*!
+    \file directory_watcher.cpp
+    \brief Filesystem directory watcher implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/directory_watcher.h"
+
+#include "errors/fatal.h"
+#include "filesystem/directory.h"
+#include "filesystem/exceptions.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <errno.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class DirectoryWatcher::Impl
+{
+public:
+    explicit Impl(const Path& path)
+    {
+#if defined(__linux__)
+        _inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (_inotify < 0)
+            throwex FileSystemException("Cannot initialize the inotify instance!").Attach(path);
+
+        try
+        {
+            AddWatchTree(path);
+        }
+        catch (...)
+        {
+            close(_inotify);
+            throw;
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        _path = path;
+        _directory = CreateFileW(path.wstring().c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (_directory == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open the directory to watch!").Attach(path);
+
+        _event = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+        if (_event == nullptr)
+        {
+            CloseHandle(_directory);
+            throwex FileSystemException("Cannot create the directory watcher event!").Attach(path);
+        }
+
+        _buffer.resize(65536 / sizeof(DWORD));
+        if (!Read())
+        {
+            CloseHandle(_event);
+            CloseHandle(_directory);
+            throwex FileSystemException("Cannot subscribe to the directory changes!").Attach(path);
+        }
+#else
+        throwex FileSystemException("Directory change notifications are not supported!").Attach(path);
+#endif
+    }
+
+    ~Impl()
+    {
+#if defined(__linux__)
+        if (close(_inotify) != 0)
+            fatality(FileSystemException("Cannot close the inotify instance!"));
+#elif defined(_WIN32) || defined(_WIN64)
+        CancelIo(_directory);
+        DWORD bytes;
+        GetOverlappedResult(_directory, &_overlapped, &bytes, TRUE);
+        if (!CloseHandle(_event))
+            fatality(FileSystemException("Cannot close the directory watcher event!").Attach(_path));
+        if (!CloseHandle(_directory))
+            fatality(FileSystemException("Cannot close the watched directory!").Attach(_path));
+#endif
+    }
+
+    size_t Poll(std::vector<Change>& changes)
+    {
+        size_t count = 0;
+#if defined(__linux__)
+        alignas(struct inotify_event) char buffer[65536];
+        for (;;)
+        {
+            ssize_t size = read(_inotify, buffer, sizeof(buffer));
+            if (size < 0)
+            {
+                if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                    break;
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot read the inotify events!");
+            }
+            if (size == 0)
+                break;
+
+            for (char* ptr = buffer; ptr < (buffer + size);)
+            {
+                const struct inotify_event* event = (const struct inotify_event*)ptr;
+                ptr += sizeof(struct inotify_event) + event->len;
+
+                // Change notifications were lost
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    changes.emplace_back(DirectoryChange::RESCAN, _root);
+                    ++count;
+                    continue;
+                }
+
+                auto it = _watches.find(event->wd);
+                if (it == _watches.end())
+                    continue;
+
+                // Watched directory was removed
+                if (event->mask & IN_IGNORED)
+                {
+                    _watches.erase(it);
+                    continue;
+                }
+
+                if (event->len == 0)
+                    continue;
+
+                Path entry = it->second / event->name;
+                if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    if (event->mask & IN_ISDIR)
+                    {
+                        // Watch the new sub-directory tree
+                        try { AddWatchTree(entry); } catch (const FileSystemException&) {}
+                        changes.emplace_back(DirectoryChange::ADDED, entry);
+                        ++count;
+                    }
+                    else if (event->mask & IN_MOVED_TO)
+                    {
+                        changes.emplace_back(DirectoryChange::ADDED, entry);
+                        ++count;
+                    }
+                }
+                else if (event->mask & IN_CLOSE_WRITE)
+                {
+                    changes.emplace_back(DirectoryChange::MODIFIED, entry);
+                    ++count;
+                }
+                else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    changes.emplace_back(DirectoryChange::REMOVED, entry);
+                    ++count;
+                }
+            }
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        for (;;)
+        {
+            DWORD bytes = 0;
+            if (!GetOverlappedResult(_directory, &_overlapped, &bytes, FALSE))
+            {
+                if (GetLastError() == ERROR_IO_INCOMPLETE)
+                    break;
+                throwex FileSystemException("Cannot get the directory changes!").Attach(_path);
+            }
+
+            if (bytes == 0)
+            {
+                // Change notifications buffer overflow
+                changes.emplace_back(DirectoryChange::RESCAN, _path);
+                ++count;
+            }
+            else
+            {
+                const char* ptr = (const char*)_buffer.data();
+                for (;;)
+                {
+                    const FILE_NOTIFY_INFORMATION* info = (const FILE_NOTIFY_INFORMATION*)ptr;
+                    Path entry = _path / std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                    switch (info->Action)
+                    {
+                        case FILE_ACTION_ADDED:
+                        case FILE_ACTION_RENAMED_NEW_NAME:
+                            changes.emplace_back(DirectoryChange::ADDED, entry);
+                            ++count;
+                            break;
+                        case FILE_ACTION_MODIFIED:
+                            if (!entry.IsDirectory())
+                            {
+                                changes.emplace_back(DirectoryChange::MODIFIED, entry);
+                                ++count;
+                            }
+                            break;
+                        case FILE_ACTION_REMOVED:
+                        case FILE_ACTION_RENAMED_OLD_NAME:
+                            changes.emplace_back(DirectoryChange::REMOVED, entry);
+                            ++count;
+                            break;
+                    }
+                    if (info->NextEntryOffset == 0)
+                        break;
+                    ptr += info->NextEntryOffset;
+                }
+            }
+
+            // Subscribe to the next directory changes
+            if (!Read())
+                throwex FileSystemException("Cannot subscribe to the directory changes!").Attach(_path);
+        }
+#endif
+        return count;
+    }
+
+private:
+#if defined(__linux__)
+    int _inotify;
+    Path _root;
+    std::unordered_map<int, Path> _watches;
+
+    void AddWatchTree(const Path& path)
+    {
+        if (_root.empty())
+            _root = path;
+
+        int wd = inotify_add_watch(_inotify, path.string().c_str(), IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR);
+        if (wd < 0)
+            throwex FileSystemException("Cannot watch the directory!").Attach(path);
+        _watches[wd] = path;
+
+        // Watch all sub-directories
+        for (const auto& item : Directory(path).GetDirectories())
+            AddWatchTree(item);
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    Path _path;
+    HANDLE _directory;
+    HANDLE _event;
+    OVERLAPPED _overlapped;
+    std::vector<DWORD> _buffer;
+
+    bool Read()
+    {
+        std::memset(&_overlapped, 0, sizeof(_overlapped));
+        _overlapped.hEvent = _event;
+        DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+        return ReadDirectoryChangesW(_directory, _buffer.data(), (DWORD)(_buffer.size() * sizeof(DWORD)), TRUE, filter, nullptr, &_overlapped, nullptr) != 0;
+    }
+#endif
+};
+
+//! @endcond
+
+DirectoryWatcher::DirectoryWatcher(const Path& path) : _path(path)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "DirectoryWatcher::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "DirectoryWatcher::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(path);
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+size_t DirectoryWatcher::Poll(std::vector<Change>& changes) { return impl().Poll(changes); }
+
+bool DirectoryWatcher::IsSupported() noexcept
+{
+#if defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace CppCommon
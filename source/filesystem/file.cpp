@@ -9,13 +9,19 @@
 #include "filesystem/file.h"
 
 #include "errors/fatal.h"
+#include "memory/allocator_aligned.h"
+#include "system/pipe.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <errno.h>
+#include <limits.h>
 #include <fcntl.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
@@ -26,12 +32,40 @@ namespace CppCommon {
 
 //! @cond INTERNALS
 
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+namespace Internals {
+
+// Make I/O vectors from the given buffers skipping empty ones
+template <typename T>
+std::vector<struct iovec> MakeIOVectors(std::span<const std::span<T>> buffers)
+{
+    std::vector<struct iovec> result;
+    result.reserve(buffers.size());
+    for (const auto& buffer : buffers)
+        if (!buffer.empty())
+            result.push_back({ (void*)buffer.data(), buffer.size() });
+    return result;
+}
+
+// Get open flags of the direct I/O mode
+inline int DirectFlags(bool direct)
+{
+#if defined(O_DIRECT)
+    return direct ? O_DIRECT : 0;
+#else
+    return 0;
+#endif
+}
+
+} // namespace Internals
+#endif
+
 class File::Impl
 {
     friend class File;
 
 public:
-    explicit Impl(const Path* path) : _path(path), _read(false), _read_index(0), _read_size(0), _read_buffer(), _write(false), _write_index(0), _write_size(0), _write_buffer()
+    explicit Impl(const Path* path) : _path(path), _direct(false), _manager(alignof(std::max_align_t)), _read(false), _read_index(0), _read_size(0), _read_buffer(nullptr), _read_capacity(0), _write(false), _write_index(0), _write_size(0), _write_buffer(nullptr), _write_capacity(0)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         _file = -1;
@@ -135,8 +169,16 @@ public:
         return _write;
     }
 
-    void Create(bool read, bool write, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
+    bool IsFileDirect() const
     {
+        return _direct;
+    }
+
+    void Create(bool read, bool write, [[maybe_unused]] const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false)
+    {
+        // Validate the file buffer size
+        ValidateBuffer(buffer, direct);
+
         // Close previously opened file
         assert(!IsFileOpened() && "File is already opened!");
         if (IsFileOpened())
@@ -168,7 +210,7 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), O_CREAT | O_EXCL | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))), mode);
+        _file = open(path().string().c_str(), O_CREAT | O_EXCL | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | Internals::DirectFlags(direct), mode);
         if (_file < 0)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
 #elif defined(_WIN32) || defined(_WIN64)
@@ -189,28 +231,22 @@ public:
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_SYSTEM;
         if (attributes & FileAttributes::TEMPORARY)
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_TEMPORARY;
+        if (direct)
+            dwFlagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
 
         _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, CREATE_NEW, dwFlagsAndAttributes, nullptr);
         if (_file == INVALID_HANDLE_VALUE)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
 #endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
-
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Initialize file buffers
+        Initialize(read, write, buffer, direct);
     }
 
-    void Open(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
+    void Open(bool read, bool write, bool truncate = false, [[maybe_unused]] const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false, std::error_code* ec = nullptr)
     {
+        // Validate the file buffer size
+        ValidateBuffer(buffer, direct);
+
         // Close previously opened file
         assert(!IsFileOpened() && "File is already opened!");
         if (IsFileOpened())
@@ -242,9 +278,12 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0), mode);
+        _file = open(path().string().c_str(), ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0) | Internals::DirectFlags(direct), mode);
         if (_file < 0)
-            throwex FileSystemException("Cannot create a new file!").Attach(path());
+        {
+            Fail(ec, "Cannot open existing file!");
+            return;
+        }
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD dwFlagsAndAttributes = 0;
         if (attributes & FileAttributes::NORMAL)
@@ -263,28 +302,27 @@ public:
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_SYSTEM;
         if (attributes & FileAttributes::TEMPORARY)
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_TEMPORARY;
+        if (direct)
+            dwFlagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
 
         _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, (truncate ? TRUNCATE_EXISTING : OPEN_EXISTING), dwFlagsAndAttributes, nullptr);
         if (_file == INVALID_HANDLE_VALUE)
-            throwex FileSystemException("Cannot open existing file!").Attach(path());
+        {
+            Fail(ec, "Cannot open existing file!");
+            return;
+        }
 #endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
-
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Initialize file buffers
+        Initialize(read, write, buffer, direct);
+        if (ec != nullptr)
+            ec->clear();
     }
 
-    void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
+    void OpenOrCreate(bool read, bool write, bool truncate = false, [[maybe_unused]] const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER, bool direct = false)
     {
+        // Validate the file buffer size
+        ValidateBuffer(buffer, direct);
+
         // Close previously opened file
         assert(!IsFileOpened() && "File is already opened!");
         if (IsFileOpened())
@@ -316,7 +354,7 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), O_CREAT | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0), mode);
+        _file = open(path().string().c_str(), O_CREAT | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0) | Internals::DirectFlags(direct), mode);
         if (_file < 0)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
 #elif defined(_WIN32) || defined(_WIN64)
@@ -337,28 +375,21 @@ public:
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_SYSTEM;
         if (attributes & FileAttributes::TEMPORARY)
             dwFlagsAndAttributes |= FILE_ATTRIBUTE_TEMPORARY;
+        if (direct)
+            dwFlagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
 
         _file = CreateFileW(path().wstring().c_str(), (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, (truncate ? CREATE_ALWAYS : OPEN_ALWAYS), dwFlagsAndAttributes, nullptr);
         if (_file == INVALID_HANDLE_VALUE)
             throwex FileSystemException("Cannot open existing file!").Attach(path());
 #endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
-
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Initialize file buffers
+        Initialize(read, write, buffer, direct);
     }
 
-    size_t Read(void* buffer, size_t size)
+    size_t Read(void* buffer, size_t size, std::error_code* ec = nullptr)
     {
+        if (ec != nullptr)
+            ec->clear();
         if ((buffer == nullptr) || (size == 0))
             return 0;
 
@@ -367,17 +398,25 @@ public:
             throwex FileSystemException("File is not opened for reading!").Attach(path());
 
         // Read file with zero buffer
-        if (_read_buffer.empty())
+        if (_read_capacity == 0)
         {
+            if (_direct)
+                ValidateDirect(buffer, size, offset());
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
             ssize_t result = read(_file, buffer, size);
             if (result < 0)
-                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            {
+                Fail(ec, "Cannot read from the file!");
+                return 0;
+            }
             return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
             DWORD result;
             if (!ReadFile(_file, buffer, (DWORD)size, &result, nullptr))
-                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            {
+                Fail(ec, "Cannot read from the file!");
+                return 0;
+            }
             return (size_t)result;
 #endif
         }
@@ -390,16 +429,28 @@ public:
             // Update the local read buffer from the file
             if (_read_index == _read_size)
             {
+                // Stop after the unaligned read in direct I/O mode (end of file)
+                if (_direct && ((_read_size % File::DIRECT_ALIGNMENT) != 0))
+                    break;
+
                 _read_index = 0;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                ssize_t result = read(_file, _read_buffer.data(), _read_buffer.size());
+                ssize_t result = read(_file, _read_buffer, _read_capacity);
                 if (result < 0)
-                    throwex FileSystemException("Cannot read from the file!").Attach(path());
+                {
+                    _read_size = 0;
+                    Fail(ec, "Cannot read from the file!");
+                    break;
+                }
                 _read_size = (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
                 DWORD result;
-                if (!ReadFile(_file, _read_buffer.data(), (DWORD)_read_buffer.size(), &result, nullptr))
-                    throwex FileSystemException("Cannot read from the file!").Attach(path());
+                if (!ReadFile(_file, _read_buffer, (DWORD)_read_capacity, &result, nullptr))
+                {
+                    _read_size = 0;
+                    Fail(ec, "Cannot read from the file!");
+                    break;
+                }
                 _read_size = (size_t)result;
 #endif
                 // Stop if the end of file was met
@@ -410,7 +461,7 @@ public:
             // Read remaining data form the local read buffer
             size_t remain = _read_size - _read_index;
             size_t num = (size < remain) ? size : remain;
-            std::memcpy(bytes, _read_buffer.data() + _read_index, num);
+            std::memcpy(bytes, _read_buffer + _read_index, num);
             counter += num;
             _read_index += num;
             bytes += num;
@@ -420,8 +471,10 @@ public:
         return counter;
     }
 
-    size_t Write(const void* buffer, size_t size)
+    size_t Write(const void* buffer, size_t size, std::error_code* ec = nullptr)
     {
+        if (ec != nullptr)
+            ec->clear();
         if ((buffer == nullptr) || (size == 0))
             return 0;
 
@@ -430,17 +483,25 @@ public:
             throwex FileSystemException("File is not opened for writing!").Attach(path());
 
         // Write file with zero buffer
-        if (_write_buffer.empty())
+        if (_write_capacity == 0)
         {
+            if (_direct)
+                ValidateDirect(buffer, size, offset());
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
             ssize_t result = write(_file, buffer, size);
             if (result < 0)
-                throwex FileSystemException("Cannot write into the file!").Attach(path());
+            {
+                Fail(ec, "Cannot write into the file!");
+                return 0;
+            }
             return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
             DWORD result;
             if (!WriteFile(_file, buffer, (DWORD)size, &result, nullptr))
-                throwex FileSystemException("Cannot write into the file!").Attach(path());
+            {
+                Fail(ec, "Cannot write into the file!");
+                return 0;
+            }
             return (size_t)result;
 #endif
         }
@@ -451,17 +512,23 @@ public:
         while (size > 0)
         {
             // Update the local read buffer from the file
-            if (_write_size == _write_buffer.size())
+            if (_write_size == _write_capacity)
             {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                ssize_t result = write(_file, _write_buffer.data() + _write_index, (_write_size - _write_index));
+                ssize_t result = write(_file, _write_buffer + _write_index, (_write_size - _write_index));
                 if (result < 0)
-                    throwex FileSystemException("Cannot write into the file!").Attach(path());
+                {
+                    Fail(ec, "Cannot write into the file!");
+                    break;
+                }
                 _write_index += (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
                 DWORD result;
-                if (!WriteFile(_file, _write_buffer.data() + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
-                    throwex FileSystemException("Cannot write into the file!").Attach(path());
+                if (!WriteFile(_file, _write_buffer + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
+                {
+                    Fail(ec, "Cannot write into the file!");
+                    break;
+                }
                 _write_index += (size_t)result;
 #endif
                 // Stop if the buffer was not written completely
@@ -474,9 +541,9 @@ public:
             }
 
             // Write remaining data into the local write buffer
-            size_t remain = _write_buffer.size() - _write_size;
+            size_t remain = _write_capacity - _write_size;
             size_t num = (size < remain) ? size : remain;
-            std::memcpy(_write_buffer.data() + _write_size, bytes, num);
+            std::memcpy(_write_buffer + _write_size, bytes, num);
             counter += num;
             _write_size += num;
             bytes += num;
@@ -486,28 +553,389 @@ public:
         return counter;
     }
 
+    size_t ReadAt(uint64_t offset, void* buffer, size_t size) const
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        if (_direct)
+            ValidateDirect(buffer, size, offset);
+
+        uint8_t* bytes = (uint8_t*)buffer;
+        size_t counter = 0;
+
+        while (size > 0)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            ssize_t result = pread(_file, bytes, size, (off_t)(offset + counter));
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            }
+#elif defined(_WIN32) || defined(_WIN64)
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = (DWORD)((offset + counter) & 0xFFFFFFFF);
+            overlapped.OffsetHigh = (DWORD)((offset + counter) >> 32);
+            DWORD result;
+            if (!ReadFile(_file, bytes, (DWORD)std::min(size, (size_t)0xFFFFFFFF), &result, &overlapped))
+            {
+                if (GetLastError() == ERROR_HANDLE_EOF)
+                    break;
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            }
+#endif
+            // Stop if the end of file was met
+            if (result == 0)
+                break;
+
+            counter += (size_t)result;
+            bytes += (size_t)result;
+            size -= (size_t)result;
+
+            // Stop after the unaligned read in direct I/O mode (end of file)
+            if (_direct && (((size_t)result % File::DIRECT_ALIGNMENT) != 0))
+                break;
+        }
+
+        return counter;
+    }
+
+    size_t ReadAt(uint64_t offset, std::span<const std::span<uint8_t>> buffers) const
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        if (_direct)
+            ValidateDirect(buffers, offset);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        std::vector<struct iovec> iovecs = Internals::MakeIOVectors(buffers);
+        return TransferV(iovecs, [this, offset](const struct iovec* iov, int count, uint64_t counter)
+        {
+            return preadv(_file, iov, count, (off_t)(offset + counter));
+        }, "Cannot read from the file!");
+#else
+        size_t counter = 0;
+        for (const auto& buffer : buffers)
+        {
+            size_t result = ReadAt(offset + counter, buffer.data(), buffer.size());
+            counter += result;
+            // Stop if the end of file was met
+            if (result < buffer.size())
+                break;
+        }
+        return counter;
+#endif
+    }
+
+    size_t WriteAt(uint64_t offset, const void* buffer, size_t size)
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        if (_direct)
+            ValidateDirect(buffer, size, offset);
+
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        size_t counter = 0;
+
+        while (size > 0)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            ssize_t result = pwrite(_file, bytes, size, (off_t)(offset + counter));
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+            }
+#elif defined(_WIN32) || defined(_WIN64)
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = (DWORD)((offset + counter) & 0xFFFFFFFF);
+            overlapped.OffsetHigh = (DWORD)((offset + counter) >> 32);
+            DWORD result;
+            if (!WriteFile(_file, bytes, (DWORD)std::min(size, (size_t)0xFFFFFFFF), &result, &overlapped))
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+#endif
+            // Stop if nothing was written
+            if (result == 0)
+                break;
+
+            counter += (size_t)result;
+            bytes += (size_t)result;
+            size -= (size_t)result;
+        }
+
+        return counter;
+    }
+
+    size_t WriteAt(uint64_t offset, std::span<const std::span<const uint8_t>> buffers)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        if (_direct)
+            ValidateDirect(buffers, offset);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        std::vector<struct iovec> iovecs = Internals::MakeIOVectors(buffers);
+        return TransferV(iovecs, [this, offset](const struct iovec* iov, int count, uint64_t counter)
+        {
+            return pwritev(_file, iov, count, (off_t)(offset + counter));
+        }, "Cannot write into the file!");
+#else
+        size_t counter = 0;
+        for (const auto& buffer : buffers)
+        {
+            size_t result = WriteAt(offset + counter, buffer.data(), buffer.size());
+            counter += result;
+            if (result < buffer.size())
+                break;
+        }
+        return counter;
+#endif
+    }
+
+    size_t ReadV(std::span<const std::span<uint8_t>> buffers)
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        size_t counter = 0;
+        size_t index = 0;
+        size_t skip = 0;
+
+        // Consume data available in the local read buffer
+        while ((index < buffers.size()) && (_read_index < _read_size))
+        {
+            size_t remain = _read_size - _read_index;
+            size_t size = buffers[index].size() - skip;
+            size_t num = (size < remain) ? size : remain;
+            std::memcpy(buffers[index].data() + skip, _read_buffer + _read_index, num);
+            counter += num;
+            _read_index += num;
+            skip += num;
+            if (skip == buffers[index].size())
+            {
+                ++index;
+                skip = 0;
+            }
+        }
+
+        if (index == buffers.size())
+            return counter;
+
+        if (_direct)
+        {
+            if (skip > 0)
+                throwex FileSystemException("Cannot read the rest of the buffer partially filled from the read buffer in direct I/O mode!").Attach(path());
+            ValidateDirect(buffers.subspan(index), offset());
+        }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Read the rest directly into given buffers
+        std::vector<struct iovec> iovecs = Internals::MakeIOVectors(buffers.subspan(index));
+        if (skip > 0)
+        {
+            iovecs.front().iov_base = (uint8_t*)iovecs.front().iov_base + skip;
+            iovecs.front().iov_len -= skip;
+        }
+        return counter + TransferV(iovecs, [this](const struct iovec* iov, int count, uint64_t)
+        {
+            return readv(_file, iov, count);
+        }, "Cannot read from the file!");
+#elif defined(_WIN32) || defined(_WIN64)
+        for (; index < buffers.size(); ++index, skip = 0)
+        {
+            uint8_t* bytes = buffers[index].data() + skip;
+            size_t size = buffers[index].size() - skip;
+            while (size > 0)
+            {
+                DWORD result;
+                if (!ReadFile(_file, bytes, (DWORD)std::min(size, (size_t)0xFFFFFFFF), &result, nullptr))
+                    throwex FileSystemException("Cannot read from the file!").Attach(path());
+                // Stop if the end of file was met
+                if (result == 0)
+                    return counter;
+                counter += (size_t)result;
+                bytes += (size_t)result;
+                size -= (size_t)result;
+            }
+        }
+        return counter;
+#endif
+    }
+
+    size_t WriteV(std::span<const std::span<const uint8_t>> buffers)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        // Keep the order of buffered and vectored data
+        FlushBuffer();
+
+        // Unaligned tail of the write buffer is kept in direct I/O mode
+        if (_direct)
+            ValidateDirect(buffers, offset() + _write_size);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        std::vector<struct iovec> iovecs = Internals::MakeIOVectors(buffers);
+        return TransferV(iovecs, [this](const struct iovec* iov, int count, uint64_t)
+        {
+            return writev(_file, iov, count);
+        }, "Cannot write into the file!");
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t counter = 0;
+        for (const auto& buffer : buffers)
+        {
+            const uint8_t* bytes = buffer.data();
+            size_t size = buffer.size();
+            while (size > 0)
+            {
+                DWORD result;
+                if (!WriteFile(_file, bytes, (DWORD)std::min(size, (size_t)0xFFFFFFFF), &result, nullptr))
+                    throwex FileSystemException("Cannot write into the file!").Attach(path());
+                // Stop if nothing was written
+                if (result == 0)
+                    return counter;
+                counter += (size_t)result;
+                bytes += (size_t)result;
+                size -= (size_t)result;
+            }
+        }
+        return counter;
+#endif
+    }
+
+    size_t SpliceFrom(Pipe& pipe, size_t size)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+        if (_direct)
+            throwex FileSystemException("Cannot splice into the file opened in direct I/O mode!").Attach(path());
+
+        // Keep the order of buffered and spliced data
+        FlushBuffer();
+
+        size_t counter = 0;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int source = (int)(size_t)pipe.reader();
+        while (counter < size)
+        {
+            ssize_t result = splice(source, nullptr, _file, nullptr, size - counter, SPLICE_F_MOVE | SPLICE_F_MORE);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot splice the pipe into the file!").Attach(path());
+            }
+            // Stop if the write endpoint of the pipe was closed
+            if (result == 0)
+                break;
+            counter += (size_t)result;
+        }
+#else
+        uint8_t buffer[8192];
+        while (counter < size)
+        {
+            size_t result = pipe.Read(buffer, std::min(size - counter, sizeof(buffer)));
+            // Stop if the write endpoint of the pipe was closed
+            if (result == 0)
+                break;
+            std::span<const uint8_t> data(buffer, result);
+            if (WriteV(std::span<const std::span<const uint8_t>>(&data, 1)) != result)
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+            counter += result;
+        }
+#endif
+        return counter;
+    }
+
+    size_t SpliceTo(Pipe& pipe, size_t size)
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+        if (_direct)
+            throwex FileSystemException("Cannot splice from the file opened in direct I/O mode!").Attach(path());
+
+        size_t counter = 0;
+
+        // Write data available in the local read buffer
+        while ((counter < size) && (_read_index < _read_size))
+        {
+            size_t result = pipe.Write(_read_buffer + _read_index, std::min(size - counter, _read_size - _read_index));
+            _read_index += result;
+            counter += result;
+        }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int destination = (int)(size_t)pipe.writer();
+        while (counter < size)
+        {
+            ssize_t result = splice(_file, nullptr, destination, nullptr, size - counter, SPLICE_F_MOVE | SPLICE_F_MORE);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot splice the file into the pipe!").Attach(path());
+            }
+            // Stop if the end of file was met
+            if (result == 0)
+                break;
+            counter += (size_t)result;
+        }
+#else
+        uint8_t buffer[8192];
+        while (counter < size)
+        {
+            std::span<uint8_t> data(buffer, std::min(size - counter, sizeof(buffer)));
+            size_t result = ReadV(std::span<const std::span<uint8_t>>(&data, 1));
+            // Stop if the end of file was met
+            if (result == 0)
+                break;
+            for (size_t written = 0; written < result;)
+                written += pipe.Write(buffer + written, result - written);
+            counter += result;
+        }
+#endif
+        return counter;
+    }
+
     void Seek(uint64_t offset)
     {
         assert(IsFileOpened() && "File is not opened!");
         if (!IsFileOpened())
             throwex FileSystemException("File is not opened!").Attach(path());
+        if (_direct && ((offset % File::DIRECT_ALIGNMENT) != 0))
+            throwex FileSystemException("File offset must be aligned to File::DIRECT_ALIGNMENT in direct I/O mode!").Attach(path());
         // Flush write buffers
         if (IsFileWriteOpened())
+        {
             FlushBuffer();
+            // Drop the unaligned tail kept in direct I/O mode
+            _write_index = 0;
+            _write_size = 0;
+        }
         // Reset the read buffer cursor
         _read_index = 0;
         _read_size = 0;
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        off_t result = lseek(_file, (off_t)offset, SEEK_SET);
-        if (result == (off_t)-1)
-            throwex FileSystemException("Cannot seek the file!").Attach(path());
-#elif defined(_WIN32) || defined(_WIN64)
-        LARGE_INTEGER seek;
-        LARGE_INTEGER result;
-        seek.QuadPart = offset;
-        if (!SetFilePointerEx(_file, seek, &result, FILE_BEGIN))
-            throwex FileSystemException("Cannot seek the file!").Attach(path());
-#endif
+        SetOffset(offset);
     }
 
     void Resize(uint64_t size)
@@ -543,17 +971,509 @@ public:
 #endif
     }
 
+    void Advise(FileAdvice advice, uint64_t offset, uint64_t size)
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(path());
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+        int flags = POSIX_FADV_NORMAL;
+        switch (advice)
+        {
+            case FileAdvice::NORMAL:
+                flags = POSIX_FADV_NORMAL;
+                break;
+            case FileAdvice::SEQUENTIAL:
+                flags = POSIX_FADV_SEQUENTIAL;
+                break;
+            case FileAdvice::RANDOM:
+                flags = POSIX_FADV_RANDOM;
+                break;
+            case FileAdvice::NOREUSE:
+                flags = POSIX_FADV_NOREUSE;
+                break;
+            case FileAdvice::WILLNEED:
+                flags = POSIX_FADV_WILLNEED;
+                break;
+            case FileAdvice::DONTNEED:
+                flags = POSIX_FADV_DONTNEED;
+                break;
+        }
+        int result = posix_fadvise(_file, (off_t)offset, (off_t)size, flags);
+        if (result != 0)
+            throwex FileSystemException("Cannot advise the file access pattern!", result).Attach(path());
+#elif defined(__APPLE__)
+        // Only read-ahead advice is supported
+        if (advice == FileAdvice::WILLNEED)
+        {
+            uint64_t length = (size > 0) ? size : ((offset < this->size()) ? (this->size() - offset) : 0);
+            struct radvisory advisory;
+            advisory.ra_offset = (off_t)offset;
+            advisory.ra_count = (int)std::min(length, (uint64_t)INT_MAX);
+            if ((advisory.ra_count > 0) && (fcntl(_file, F_RDADVISE, &advisory) != 0))
+                throwex FileSystemException("Cannot advise the file access pattern!").Attach(path());
+        }
+#endif
+    }
+
+    void Preallocate(uint64_t offset, uint64_t size, bool keep_size)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        if (size == 0)
+            return;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int result = fallocate(_file, (keep_size ? FALLOC_FL_KEEP_SIZE : 0), (off_t)offset, (off_t)size);
+        if (result != 0)
+        {
+            // Reserving disk blocks is only a hint for filesystems without fallocate() support
+            if (errno != EOPNOTSUPP)
+                throwex FileSystemException("Cannot preallocate the file!").Attach(path());
+            if (!keep_size)
+            {
+                result = posix_fallocate(_file, (off_t)offset, (off_t)size);
+                if (result != 0)
+                    throwex FileSystemException("Cannot preallocate the file!", result).Attach(path());
+            }
+        }
+#elif defined(__APPLE__)
+        uint64_t current = this->size();
+        if ((offset + size) > current)
+        {
+            // Try to allocate contiguous disk space first
+            fstore_t store = { F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, (off_t)(offset + size - current), 0 };
+            if (fcntl(_file, F_PREALLOCATE, &store) != 0)
+            {
+                store.fst_flags = F_ALLOCATEALL;
+                if (fcntl(_file, F_PREALLOCATE, &store) != 0)
+                    throwex FileSystemException("Cannot preallocate the file!").Attach(path());
+            }
+            if (!keep_size)
+                SetSize(offset + size);
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+        if (!keep_size)
+        {
+            int result = posix_fallocate(_file, (off_t)offset, (off_t)size);
+            if (result != 0)
+                throwex FileSystemException("Cannot preallocate the file!", result).Attach(path());
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        uint64_t current = this->size();
+        if ((offset + size) > current)
+        {
+            FILE_ALLOCATION_INFO info;
+            info.AllocationSize.QuadPart = offset + size;
+            if (!SetFileInformationByHandle(_file, FileAllocationInfo, &info, sizeof(info)))
+                throwex FileSystemException("Cannot preallocate the file!").Attach(path());
+            if (!keep_size)
+                SetSize(offset + size);
+        }
+#endif
+    }
+
+    void PunchHole(uint64_t offset, uint64_t size)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        // Limit the range by the current file size
+        uint64_t end = std::min(offset + size, this->size());
+        if (offset >= end)
+            return;
+        size = end - offset;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if (fallocate(_file, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t)offset, (off_t)size) == 0)
+            return;
+        if (errno != EOPNOTSUPP)
+            throwex FileSystemException("Cannot punch a hole in the file!").Attach(path());
+#elif defined(__APPLE__) && defined(F_PUNCHHOLE)
+        fpunchhole_t hole = { 0, 0, (off_t)offset, (off_t)size };
+        if (fcntl(_file, F_PUNCHHOLE, &hole) == 0)
+            return;
+        if ((errno != ENOTSUP) && (errno != EINVAL))
+            throwex FileSystemException("Cannot punch a hole in the file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD bytes;
+        FILE_SET_SPARSE_BUFFER sparse;
+        sparse.SetSparse = TRUE;
+        if (DeviceIoControl(_file, FSCTL_SET_SPARSE, &sparse, sizeof(sparse), nullptr, 0, &bytes, nullptr))
+        {
+            FILE_ZERO_DATA_INFORMATION zero;
+            zero.FileOffset.QuadPart = offset;
+            zero.BeyondFinalZero.QuadPart = offset + size;
+            if (!DeviceIoControl(_file, FSCTL_SET_ZERO_DATA, &zero, sizeof(zero), nullptr, 0, &bytes, nullptr))
+                throwex FileSystemException("Cannot punch a hole in the file!").Attach(path());
+            return;
+        }
+#endif
+
+        // Fill the range with zeros if the filesystem does not support holes
+        std::vector<uint8_t> zeros((size_t)std::min(size, (uint64_t)65536), 0);
+        while (size > 0)
+        {
+            size_t count = (size_t)std::min(size, (uint64_t)zeros.size());
+            size_t written = WriteAt(offset, zeros.data(), count);
+            if (written == 0)
+                throwex FileSystemException("Cannot punch a hole in the file!").Attach(path());
+            offset += written;
+            size -= written;
+        }
+    }
+
+    std::vector<FileRegion> DataRegions(uint64_t offset, uint64_t size) const
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(path());
+
+        std::vector<FileRegion> regions;
+
+        // Limit the range by the current file size
+        uint64_t total = this->size();
+        uint64_t end = (size > 0) ? std::min(offset + size, total) : total;
+        if (offset >= end)
+            return regions;
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && defined(SEEK_DATA) && defined(SEEK_HOLE)
+        // Seek for data and holes and restore the current file offset
+        off_t current = lseek(_file, 0, SEEK_CUR);
+        if (current == (off_t)-1)
+            throwex FileSystemException("Cannot get the current file offset!").Attach(path());
+
+        bool supported = true;
+        uint64_t position = offset;
+        while (position < end)
+        {
+            off_t data = lseek(_file, (off_t)position, SEEK_DATA);
+            if (data == (off_t)-1)
+            {
+                // No more data till the end of file
+                if (errno == ENXIO)
+                    break;
+                supported = false;
+                break;
+            }
+            if ((uint64_t)data >= end)
+                break;
+
+            off_t hole = lseek(_file, data, SEEK_HOLE);
+            uint64_t finish = (hole == (off_t)-1) ? end : std::min((uint64_t)hole, end);
+            regions.push_back({ (uint64_t)data, finish - (uint64_t)data });
+            position = finish;
+        }
+
+        if (lseek(_file, current, SEEK_SET) == (off_t)-1)
+            throwex FileSystemException("Cannot restore the current file offset!").Attach(path());
+
+        if (!supported)
+        {
+            regions.clear();
+            regions.push_back({ offset, end - offset });
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        FILE_ALLOCATED_RANGE_BUFFER query;
+        query.FileOffset.QuadPart = offset;
+        query.Length.QuadPart = end - offset;
+        FILE_ALLOCATED_RANGE_BUFFER ranges[64];
+        for (;;)
+        {
+            DWORD bytes = 0;
+            BOOL result = DeviceIoControl(_file, FSCTL_QUERY_ALLOCATED_RANGES, &query, sizeof(query), ranges, sizeof(ranges), &bytes, nullptr);
+            DWORD error = result ? ERROR_SUCCESS : GetLastError();
+            if (!result && (error != ERROR_MORE_DATA))
+            {
+                // Not sparse aware filesystem
+                regions.clear();
+                regions.push_back({ offset, end - offset });
+                break;
+            }
+
+            size_t count = bytes / sizeof(FILE_ALLOCATED_RANGE_BUFFER);
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint64_t start = std::max((uint64_t)ranges[i].FileOffset.QuadPart, offset);
+                uint64_t finish = std::min((uint64_t)(ranges[i].FileOffset.QuadPart + ranges[i].Length.QuadPart), end);
+                if (start < finish)
+                    regions.push_back({ start, finish - start });
+            }
+
+            // Continue the query after the last returned range
+            if ((error != ERROR_MORE_DATA) || (count == 0))
+                break;
+            uint64_t next = ranges[count - 1].FileOffset.QuadPart + ranges[count - 1].Length.QuadPart;
+            query.FileOffset.QuadPart = next;
+            query.Length.QuadPart = end - next;
+        }
+#else
+        regions.push_back({ offset, end - offset });
+#endif
+
+        return regions;
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Transfer all vectored buffers until the end of file, restart after partial transfers
+    template <typename TTransfer>
+    size_t TransferV(std::vector<struct iovec>& iovecs, TTransfer transfer, const char* error) const
+    {
+        size_t counter = 0;
+        size_t index = 0;
+        while (index < iovecs.size())
+        {
+            int count = (int)std::min(iovecs.size() - index, (size_t)IOV_MAX);
+            ssize_t result = transfer(&iovecs[index], count, counter);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException(error).Attach(path());
+            }
+            // Stop if the end of file was met or nothing was written
+            if (result == 0)
+                break;
+
+            counter += (size_t)result;
+
+            // Skip completely transferred buffers
+            size_t done = (size_t)result;
+            while ((index < iovecs.size()) && (done >= iovecs[index].iov_len))
+                done -= iovecs[index++].iov_len;
+            if (done > 0)
+            {
+                iovecs[index].iov_base = (uint8_t*)iovecs[index].iov_base + done;
+                iovecs[index].iov_len -= done;
+            }
+
+            // Stop after the unaligned transfer in direct I/O mode (end of file)
+            if (_direct && (((size_t)result % File::DIRECT_ALIGNMENT) != 0))
+                break;
+        }
+        return counter;
+    }
+#endif
+
+    // Validate the file buffer size of the direct I/O mode
+    void ValidateBuffer(size_t buffer, bool direct) const
+    {
+        if (direct && ((buffer % File::DIRECT_ALIGNMENT) != 0))
+            throwex FileSystemException("File buffer size must be a multiple of File::DIRECT_ALIGNMENT in direct I/O mode!").Attach(path());
+    }
+
+    // Validate the buffer, its size and the file offset of the direct I/O operation
+    void ValidateDirect(const void* buffer, size_t size, uint64_t offset) const
+    {
+        if (((uintptr_t)buffer % File::DIRECT_ALIGNMENT) != 0)
+            throwex FileSystemException("Buffer address must be aligned to File::DIRECT_ALIGNMENT in direct I/O mode!").Attach(path());
+        if ((size % File::DIRECT_ALIGNMENT) != 0)
+            throwex FileSystemException("Buffer size must be a multiple of File::DIRECT_ALIGNMENT in direct I/O mode!").Attach(path());
+        if ((offset % File::DIRECT_ALIGNMENT) != 0)
+            throwex FileSystemException("File offset must be aligned to File::DIRECT_ALIGNMENT in direct I/O mode!").Attach(path());
+    }
+
+    // Validate vectored buffers and the file offset of the direct I/O operation
+    template <typename T>
+    void ValidateDirect(std::span<const std::span<T>> buffers, uint64_t offset) const
+    {
+        for (const auto& buffer : buffers)
+        {
+            ValidateDirect(buffer.data(), buffer.size(), offset);
+            offset += buffer.size();
+        }
+    }
+
+    // Initialize file buffers of the opened file
+    // Report the last system error into the given error code or raise the file system exception
+    void Fail(std::error_code* ec, const char* message) const
+    {
+        if (ec == nullptr)
+            throwex FileSystemException(message).Attach(path());
+        *ec = SystemError::GetLastCode();
+    }
+
+    void Initialize(bool read, bool write, size_t buffer, bool direct)
+    {
+#if defined(__APPLE__)
+        // Disable the system page cache for the file
+        if (direct && (fcntl(_file, F_NOCACHE, 1) != 0))
+        {
+            close(_file);
+            _file = -1;
+            throwex FileSystemException("Cannot enable the direct I/O mode of the file!").Attach(path());
+        }
+#endif
+        _direct = direct;
+
+        // Initialize file read buffer
+        _read = read;
+        _read_index = 0;
+        _read_size = 0;
+        if (read && (buffer > 0))
+        {
+            _read_buffer = Allocate(buffer);
+            _read_capacity = buffer;
+        }
+
+        // Initialize file write buffer
+        _write = write;
+        _write_index = 0;
+        _write_size = 0;
+        if (write && (buffer > 0))
+        {
+            _write_buffer = Allocate(buffer);
+            _write_capacity = buffer;
+        }
+    }
+
+    // Release file buffers of the closed file
+    void Release()
+    {
+        _direct = false;
+
+        // Clear file read buffer
+        _read = false;
+        _read_index = 0;
+        _read_size = 0;
+        if (_read_buffer != nullptr)
+            _manager.free(_read_buffer, _read_capacity);
+        _read_buffer = nullptr;
+        _read_capacity = 0;
+
+        // Clear file write buffer
+        _write = false;
+        _write_index = 0;
+        _write_size = 0;
+        if (_write_buffer != nullptr)
+            _manager.free(_write_buffer, _write_capacity);
+        _write_buffer = nullptr;
+        _write_capacity = 0;
+    }
+
+    // Allocate the file buffer aligned for the direct I/O mode
+    uint8_t* Allocate(size_t size)
+    {
+        uint8_t* result = (uint8_t*)_manager.malloc(size, _direct ? File::DIRECT_ALIGNMENT : alignof(std::max_align_t));
+        if (result == nullptr)
+        {
+            // Close the file to keep it consistent with failed open
+            Release();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            close(_file);
+            _file = -1;
+#elif defined(_WIN32) || defined(_WIN64)
+            CloseHandle(_file);
+            _file = INVALID_HANDLE_VALUE;
+#endif
+            throwex FileSystemException("Cannot allocate the file buffer!").Attach(path());
+        }
+        return result;
+    }
+
+    // Set the current file offset without flushing file buffers
+    void SetOffset(uint64_t offset)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        off_t result = lseek(_file, (off_t)offset, SEEK_SET);
+        if (result == (off_t)-1)
+            throwex FileSystemException("Cannot seek the file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        LARGE_INTEGER seek;
+        LARGE_INTEGER result;
+        seek.QuadPart = offset;
+        if (!SetFilePointerEx(_file, seek, &result, FILE_BEGIN))
+            throwex FileSystemException("Cannot seek the file!").Attach(path());
+#endif
+    }
+
+    // Set the file size without moving the current file offset
+    void SetSize(uint64_t size)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = ftruncate(_file, (off_t)size);
+        if (result != 0)
+            throwex FileSystemException("Cannot resize the current file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        FILE_END_OF_FILE_INFO info;
+        info.EndOfFile.QuadPart = size;
+        if (!SetFileInformationByHandle(_file, FileEndOfFileInfo, &info, sizeof(info)))
+            throwex FileSystemException("Cannot resize the current file!").Attach(path());
+#endif
+    }
+
+    // Flush the write buffer in direct I/O mode
+    void FlushDirect()
+    {
+        if (_write_size == 0)
+            return;
+
+        const size_t alignment = File::DIRECT_ALIGNMENT;
+        const uint64_t start = offset();
+        const size_t tail = _write_size % alignment;
+        const size_t full = _write_size - tail;
+        const size_t total = full + ((tail > 0) ? alignment : 0);
+        const uint64_t current = size();
+
+        // Merge the unaligned tail with the file content of the last block
+        if (tail > 0)
+        {
+            uint8_t* block = _write_buffer + full;
+            if ((start + _write_size) < current)
+            {
+                if (!IsFileReadOpened())
+                    throwex FileSystemException("Cannot write the unaligned tail into the middle of the write-only file in direct I/O mode!").Attach(path());
+                std::vector<uint8_t> data(block, block + tail);
+                std::memset(block, 0, alignment);
+                ReadAt(start + full, block, alignment);
+                std::memcpy(block, data.data(), tail);
+            }
+            else
+                std::memset(block + tail, 0, alignment - tail);
+        }
+
+        if (WriteAt(start, _write_buffer, total) != total)
+            throwex FileSystemException("Cannot write all remaining data into the file during the flush operation!").Attach(path());
+
+        if (tail > 0)
+        {
+            // Cut the padding of the last block beyond the end of file
+            uint64_t end = std::max(current, start + _write_size);
+            if (end < (start + total))
+                SetSize(end);
+
+            // Keep the unaligned tail to be continued by following writes
+            SetOffset(start + full);
+            std::memmove(_write_buffer, _write_buffer + full, tail);
+        }
+        else
+            SetOffset(start + total);
+
+        // Update the write buffer cursor
+        _write_index = 0;
+        _write_size = tail;
+    }
+
     void FlushBuffer()
     {
         assert(IsFileWriteOpened() && "File is not opened for writing!");
         if (!IsFileWriteOpened())
             throwex FileSystemException("File is not opened for writing!").Attach(path());
+        // Write whole aligned blocks in direct I/O mode
+        if (_direct)
+        {
+            FlushDirect();
+            return;
+        }
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         // Force to write all buffered data
         size_t remain = _write_size - _write_index;
         if (remain > 0)
         {
-            ssize_t result = write(_file, _write_buffer.data() + _write_index, (_write_size - _write_index));
+            ssize_t result = write(_file, _write_buffer + _write_index, (_write_size - _write_index));
             if (result < 0)
                 throwex FileSystemException("Cannot write into the file during the flush operation!").Attach(path());
             _write_index += (size_t)result;
@@ -570,7 +1490,7 @@ public:
         if (remain > 0)
         {
             DWORD result;
-            if (!WriteFile(_file, _write_buffer.data() + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
+            if (!WriteFile(_file, _write_buffer + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
                 throwex FileSystemException("Cannot write into the file during the flush operation!").Attach(path());
             _write_index += (size_t)result;
             if (_write_index != _write_size)
@@ -614,17 +1534,8 @@ public:
             throwex FileSystemException("Cannot close the file handle!").Attach(path());
         _file = INVALID_HANDLE_VALUE;
 #endif
-        // Clear file read buffer
-        _read = false;
-        _read_index = 0;
-        _read_size = 0;
-        _read_buffer.clear();
-
-        // Clear file write buffer
-        _write = false;
-        _write_index = 0;
-        _write_size = 0;
-        _write_buffer.clear();
+        // Release file buffers
+        Release();
     }
 
 private:
@@ -634,17 +1545,25 @@ private:
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _file;
 #endif
+    // Direct I/O mode
+    bool _direct;
+
+    // File buffers memory manager
+    AlignedMemoryManager _manager;
+
     // File read buffer
     bool _read;
     size_t _read_index;
     size_t _read_size;
-    std::vector<uint8_t> _read_buffer;
+    uint8_t* _read_buffer;
+    size_t _read_capacity;
 
     // File write buffer
     bool _write;
     size_t _write_index;
     size_t _write_size;
-    std::vector<uint8_t> _write_buffer;
+    uint8_t* _write_buffer;
+    size_t _write_capacity;
 };
 
 //! @endcond
@@ -652,6 +1571,7 @@ private:
 const Flags<FileAttributes> File::DEFAULT_ATTRIBUTES = FileAttributes::NORMAL;
 const Flags<FilePermissions> File::DEFAULT_PERMISSIONS = FilePermissions::IRUSR | FilePermissions::IWUSR | FilePermissions::IRGRP | FilePermissions::IROTH;
 const size_t File::DEFAULT_BUFFER = 8192;
+const size_t File::DIRECT_ALIGNMENT = 4096;
 
 File::File() : Path()
 {
@@ -751,16 +1671,64 @@ bool File::IsFileExists() const
 bool File::IsFileOpened() const { return impl().IsFileOpened(); }
 bool File::IsFileReadOpened() const { return impl().IsFileReadOpened(); }
 bool File::IsFileWriteOpened() const { return impl().IsFileWriteOpened(); }
+bool File::IsFileDirect() const { return impl().IsFileDirect(); }
 
-void File::Create(bool read, bool write, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { return impl().Create(read, write, attributes, permissions, buffer); }
-void File::Open(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { impl().Open(read, write, truncate, attributes, permissions, buffer); }
-void File::OpenOrCreate(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { impl().OpenOrCreate(read, write, truncate, attributes, permissions, buffer); }
+void File::Create(bool read, bool write, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer, bool direct) { return impl().Create(read, write, attributes, permissions, buffer, direct); }
+void File::Open(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer, bool direct) { impl().Open(read, write, truncate, attributes, permissions, buffer, direct); }
+void File::OpenOrCreate(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer, bool direct) { impl().OpenOrCreate(read, write, truncate, attributes, permissions, buffer, direct); }
+
+void File::Open(bool read, bool write, std::error_code& ec, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer, bool direct) { impl().Open(read, write, truncate, attributes, permissions, buffer, direct, &ec); }
 
 size_t File::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
+size_t File::Read(void* buffer, size_t size, std::error_code& ec) { return impl().Read(buffer, size, &ec); }
 size_t File::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t File::Write(const void* buffer, size_t size, std::error_code& ec) { return impl().Write(buffer, size, &ec); }
+
+size_t File::ReadAt(uint64_t offset, void* buffer, size_t size) const { return impl().ReadAt(offset, buffer, size); }
+size_t File::ReadAt(uint64_t offset, std::span<const std::span<uint8_t>> buffers) const { return impl().ReadAt(offset, buffers); }
+size_t File::WriteAt(uint64_t offset, const void* buffer, size_t size) { return impl().WriteAt(offset, buffer, size); }
+size_t File::WriteAt(uint64_t offset, std::span<const std::span<const uint8_t>> buffers) { return impl().WriteAt(offset, buffers); }
+size_t File::ReadV(std::span<const std::span<uint8_t>> buffers) { return impl().ReadV(buffers); }
+size_t File::WriteV(std::span<const std::span<const uint8_t>> buffers) { return impl().WriteV(buffers); }
+
+size_t File::ReadInto(BufferChain& chain, size_t size)
+{
+    // Memory of the buffer chain is not aligned for direct I/O mode
+    if (IsFileDirect())
+        return Reader::ReadInto(chain, size);
+
+    size_t total = 0;
+    while (total < size)
+    {
+        std::span<uint8_t> space = chain.Prepare(size - total);
+        size_t result = ReadV(std::span<const std::span<uint8_t>>(&space, 1));
+        chain.Commit(result);
+        total += result;
+        if (result < space.size())
+            break;
+    }
+    return total;
+}
+
+size_t File::WriteFrom(BufferChain& chain)
+{
+    // Memory of the buffer chain is not aligned for direct I/O mode
+    if (IsFileDirect())
+        return Writer::WriteFrom(chain);
+
+    std::vector<std::span<const uint8_t>> spans = chain.spans();
+    return chain.Consume(WriteV(spans));
+}
+
+size_t File::SpliceFrom(Pipe& pipe, size_t size) { return impl().SpliceFrom(pipe, size); }
+size_t File::SpliceTo(Pipe& pipe, size_t size) { return impl().SpliceTo(pipe, size); }
 
 void File::Seek(uint64_t offset) { return impl().Seek(offset); }
 void File::Resize(uint64_t size) { return impl().Resize(size); }
+void File::Advise(FileAdvice advice, uint64_t offset, uint64_t size) { impl().Advise(advice, offset, size); }
+void File::Preallocate(uint64_t offset, uint64_t size, bool keep_size) { impl().Preallocate(offset, size, keep_size); }
+void File::PunchHole(uint64_t offset, uint64_t size) { impl().PunchHole(offset, size); }
+std::vector<FileRegion> File::DataRegions(uint64_t offset, uint64_t size) const { return impl().DataRegions(offset, size); }
 void File::Flush() { impl().Flush(); }
 void File::Close() { impl().Close(); }
 
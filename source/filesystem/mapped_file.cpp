@@ -0,0 +1,434 @@
+/*!
+    \file mapped_file.cpp
+    \brief Filesystem memory-mapped file implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/mapped_file.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Mapping window offset must be aligned to the allocation granularity
+uint64_t MappingGranularity()
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static uint64_t granularity = (uint64_t)sysconf(_SC_PAGESIZE);
+#elif defined(_WIN32) || defined(_WIN64)
+    static uint64_t granularity = []() { SYSTEM_INFO si; GetSystemInfo(&si); return (uint64_t)si.dwAllocationGranularity; }();
+#endif
+    return granularity;
+}
+
+// Mapping window size to indicate the whole file
+const uint64_t WHOLE_FILE = std::numeric_limits<uint64_t>::max();
+
+// Map the window of the file and return the aligned base of the mapping
+void MapWindow(const Path& path, MappedFileMode mode, uint64_t offset, uint64_t& size, void*& base, size_t& length)
+{
+    base = nullptr;
+    length = 0;
+
+    uint64_t aligned = offset - (offset % MappingGranularity());
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int file = open(path.string().c_str(), (mode == MappedFileMode::READWRITE) ? O_RDWR : O_RDONLY);
+    if (file < 0)
+        throwex FileSystemException("Cannot open the file to map!").Attach(path);
+
+    struct stat st;
+    if (fstat(file, &st) != 0)
+    {
+        close(file);
+        throwex FileSystemException("Cannot get the file size to map!").Attach(path);
+    }
+
+    uint64_t total = (uint64_t)st.st_size;
+    if (size == WHOLE_FILE)
+    {
+        if (offset > total)
+        {
+            close(file);
+            throwex FileSystemException("The mapped window is out of the file!").Attach(path);
+        }
+        size = total - offset;
+    }
+    else if ((offset + size) > total)
+    {
+        if (mode != MappedFileMode::READWRITE)
+        {
+            close(file);
+            throwex FileSystemException("The mapped window is out of the file!").Attach(path);
+        }
+        if (ftruncate(file, (off_t)(offset + size)) != 0)
+        {
+            close(file);
+            throwex FileSystemException("Cannot extend the file to map!").Attach(path);
+        }
+    }
+
+    if ((offset - aligned + size) > std::numeric_limits<size_t>::max())
+    {
+        close(file);
+        throwex FileSystemException("The mapped window is too large!").Attach(path);
+    }
+
+    if (size > 0)
+    {
+        int protection = (mode == MappedFileMode::READONLY) ? PROT_READ : (PROT_READ | PROT_WRITE);
+        int flags = (mode == MappedFileMode::COPYONWRITE) ? MAP_PRIVATE : MAP_SHARED;
+        length = (size_t)(offset - aligned + size);
+        base = mmap(nullptr, length, protection, flags, file, (off_t)aligned);
+        if (base == MAP_FAILED)
+        {
+            base = nullptr;
+            length = 0;
+            close(file);
+            throwex FileSystemException("Cannot map the file!").Attach(path);
+        }
+    }
+
+    // Mapping stays valid after the file descriptor is closed
+    if (close(file) != 0)
+    {
+        if (base != nullptr)
+            munmap(base, length);
+        throwex FileSystemException("Cannot close the mapped file!").Attach(path);
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    DWORD access = (mode == MappedFileMode::READWRITE) ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    HANDLE file = CreateFileW(path.wstring().c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throwex FileSystemException("Cannot open the file to map!").Attach(path);
+
+    LARGE_INTEGER st;
+    if (!GetFileSizeEx(file, &st))
+    {
+        CloseHandle(file);
+        throwex FileSystemException("Cannot get the file size to map!").Attach(path);
+    }
+
+    uint64_t total = (uint64_t)st.QuadPart;
+    if (size == WHOLE_FILE)
+    {
+        if (offset > total)
+        {
+            CloseHandle(file);
+            throwex FileSystemException("The mapped window is out of the file!").Attach(path);
+        }
+        size = total - offset;
+    }
+    else if ((offset + size) > total)
+    {
+        if (mode != MappedFileMode::READWRITE)
+        {
+            CloseHandle(file);
+            throwex FileSystemException("The mapped window is out of the file!").Attach(path);
+        }
+        LARGE_INTEGER end;
+        end.QuadPart = (LONGLONG)(offset + size);
+        if (!SetFilePointerEx(file, end, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+        {
+            CloseHandle(file);
+            throwex FileSystemException("Cannot extend the file to map!").Attach(path);
+        }
+    }
+
+    if ((offset - aligned + size) > std::numeric_limits<size_t>::max())
+    {
+        CloseHandle(file);
+        throwex FileSystemException("The mapped window is too large!").Attach(path);
+    }
+
+    if (size > 0)
+    {
+        DWORD protection = (mode == MappedFileMode::READONLY) ? PAGE_READONLY : ((mode == MappedFileMode::READWRITE) ? PAGE_READWRITE : PAGE_WRITECOPY);
+        HANDLE mapping = CreateFileMappingW(file, nullptr, protection, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            throwex FileSystemException("Cannot create the file mapping!").Attach(path);
+        }
+
+        DWORD view = (mode == MappedFileMode::READONLY) ? FILE_MAP_READ : ((mode == MappedFileMode::READWRITE) ? FILE_MAP_WRITE : FILE_MAP_COPY);
+        length = (size_t)(offset - aligned + size);
+        base = MapViewOfFile(mapping, view, (DWORD)(aligned >> 32), (DWORD)(aligned & 0xFFFFFFFF), length);
+
+        // Mapped view keeps the file mapping alive
+        CloseHandle(mapping);
+        if (base == nullptr)
+        {
+            length = 0;
+            CloseHandle(file);
+            throwex FileSystemException("Cannot map the file!").Attach(path);
+        }
+    }
+
+    if (!CloseHandle(file))
+    {
+        if (base != nullptr)
+            UnmapViewOfFile(base);
+        throwex FileSystemException("Cannot close the mapped file!").Attach(path);
+    }
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+MappedFile::MappedFile() noexcept
+    : _mode(MappedFileMode::READONLY),
+      _offset(0),
+      _base(nullptr),
+      _length(0),
+      _ptr(nullptr),
+      _size(0),
+      _position(0)
+{
+}
+
+MappedFile::MappedFile(const Path& path, MappedFileMode mode) : MappedFile()
+{
+    Map(path, mode);
+}
+
+MappedFile::MappedFile(const Path& path, MappedFileMode mode, uint64_t offset, size_t size) : MappedFile()
+{
+    Map(path, mode, offset, size);
+}
+
+MappedFile::MappedFile(MappedFile&& file) noexcept : MappedFile()
+{
+    swap(file);
+}
+
+MappedFile::~MappedFile()
+{
+    try
+    {
+        if (IsMapped())
+            Unmap();
+    }
+    catch (const FileSystemException& ex)
+    {
+        fatality(FileSystemException(ex.string()).Attach(_path));
+    }
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+{
+    MappedFile(std::move(file)).swap(*this);
+    return *this;
+}
+
+void MappedFile::Map(const Path& path, MappedFileMode mode)
+{
+    // Map the new window before unmapping the current one
+    MappedFile mapping;
+    uint64_t size = Internals::WHOLE_FILE;
+    Internals::MapWindow(path, mode, 0, size, mapping._base, mapping._length);
+
+    mapping._path = path;
+    mapping._mode = mode;
+    mapping._ptr = mapping._base;
+    mapping._size = (size_t)size;
+    swap(mapping);
+}
+
+void MappedFile::Map(const Path& path, MappedFileMode mode, uint64_t offset, size_t size)
+{
+    // Map the new window before unmapping the current one
+    MappedFile mapping;
+    uint64_t length = size;
+    Internals::MapWindow(path, mode, offset, length, mapping._base, mapping._length);
+
+    mapping._path = path;
+    mapping._mode = mode;
+    mapping._offset = offset;
+    mapping._ptr = (mapping._base != nullptr) ? ((uint8_t*)mapping._base + (offset % Internals::MappingGranularity())) : nullptr;
+    mapping._size = size;
+    swap(mapping);
+}
+
+void MappedFile::Unmap()
+{
+    if (!IsMapped())
+        return;
+
+    if (_base != nullptr)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        if (munmap(_base, _length) != 0)
+            throwex FileSystemException("Cannot unmap the file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!UnmapViewOfFile(_base))
+            throwex FileSystemException("Cannot unmap the file!").Attach(_path);
+#endif
+    }
+
+    _path.Clear();
+    _mode = MappedFileMode::READONLY;
+    _offset = 0;
+    _base = nullptr;
+    _length = 0;
+    _ptr = nullptr;
+    _size = 0;
+    _position = 0;
+}
+
+void MappedFile::Resize(size_t size)
+{
+    assert(IsMapped() && "File is not mapped!");
+    if (!IsMapped())
+        throwex FileSystemException("File is not mapped!");
+
+    assert((_mode != MappedFileMode::COPYONWRITE) && "Copy-on-write mapping cannot be resized!");
+    if (_mode == MappedFileMode::COPYONWRITE)
+        throwex FileSystemException("Copy-on-write mapping cannot be resized!").Attach(_path);
+
+    size_t position = _position;
+    Path path = _path;
+    Map(path, _mode, _offset, size);
+    Seek(position);
+}
+
+void MappedFile::Advise(MappedFileAdvice advice, size_t offset, size_t size)
+{
+    assert(IsMapped() && "File is not mapped!");
+    if (!IsMapped())
+        throwex FileSystemException("File is not mapped!");
+
+    assert((offset <= _size) && (size <= (_size - offset)) && "Advice range is out of the mapped window!");
+    if ((offset > _size) || (size > (_size - offset)))
+        throwex FileSystemException("Advice range is out of the mapped window!").Attach(_path);
+
+    if (size == 0)
+        return;
+
+    // Extend the range to the page boundaries from the aligned mapping base
+    size_t delta = (size_t)((uint8_t*)_ptr - (uint8_t*)_base) + offset;
+    size_t page = (size_t)Internals::MappingGranularity();
+    size_t start = delta - (delta % page);
+    void* address = (uint8_t*)_base + start;
+    size_t length = delta - start + size;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int flag = MADV_NORMAL;
+    switch (advice)
+    {
+        case MappedFileAdvice::NORMAL:
+            flag = MADV_NORMAL;
+            break;
+        case MappedFileAdvice::SEQUENTIAL:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case MappedFileAdvice::RANDOM:
+            flag = MADV_RANDOM;
+            break;
+        case MappedFileAdvice::WILLNEED:
+            flag = MADV_WILLNEED;
+            break;
+        case MappedFileAdvice::DONTNEED:
+            flag = MADV_DONTNEED;
+            break;
+    }
+    if (madvise(address, length, flag) != 0)
+        throwex FileSystemException("Cannot advise the mapped file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+    // Windows has no access pattern hints for mapped views,
+    // only prefetching and working set trimming are supported
+    switch (advice)
+    {
+        case MappedFileAdvice::WILLNEED:
+        {
+#if (_WIN32_WINNT >= 0x0602)
+            WIN32_MEMORY_RANGE_ENTRY range = { address, length };
+            if (!PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0))
+                throwex FileSystemException("Cannot advise the mapped file!").Attach(_path);
+#endif
+            break;
+        }
+        case MappedFileAdvice::DONTNEED:
+            // Unlocking pages which are not locked removes them from the working set
+            VirtualUnlock(address, length);
+            break;
+        default:
+            break;
+    }
+#endif
+}
+
+void MappedFile::Flush(size_t offset, size_t size)
+{
+    assert((IsMapped() && (_mode == MappedFileMode::READWRITE)) && "File is not mapped in read-write mode!");
+    if (!IsMapped() || (_mode != MappedFileMode::READWRITE))
+        throwex FileSystemException("File is not mapped in read-write mode!").Attach(_path);
+
+    assert((offset <= _size) && (size <= (_size - offset)) && "Flush range is out of the mapped window!");
+    if ((offset > _size) || (size > (_size - offset)))
+        throwex FileSystemException("Flush range is out of the mapped window!").Attach(_path);
+
+    if (size == 0)
+        return;
+
+    // Extend the range to the page boundaries from the aligned mapping base
+    size_t delta = (size_t)((uint8_t*)_ptr - (uint8_t*)_base) + offset;
+    size_t page = (size_t)Internals::MappingGranularity();
+    size_t start = delta - (delta % page);
+    void* address = (uint8_t*)_base + start;
+    size_t length = delta - start + size;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (msync(address, length, MS_SYNC) != 0)
+        throwex FileSystemException("Cannot flush the mapped file!").Attach(_path);
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!FlushViewOfFile(address, length))
+        throwex FileSystemException("Cannot flush the mapped file!").Attach(_path);
+
+    // Flushed pages are written to the disk only after the file buffers are flushed
+    HANDLE file = CreateFileW(_path.wstring().c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throwex FileSystemException("Cannot open the mapped file to flush!").Attach(_path);
+    BOOL result = FlushFileBuffers(file);
+    CloseHandle(file);
+    if (!result)
+        throwex FileSystemException("Cannot flush the mapped file!").Attach(_path);
+#endif
+}
+
+size_t MappedFile::Read(void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    size_t available = _size - _position;
+    if (size > available)
+        size = available;
+    if (size > 0)
+    {
+        std::memcpy(buffer, (const uint8_t*)_ptr + _position, size);
+        _position += size;
+    }
+    return size;
+}
+
+} // namespace CppCommon
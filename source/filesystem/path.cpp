@@ -10,7 +10,11 @@
 
 #include "filesystem/directory.h"
 #include "filesystem/symlink.h"
+#include "string/glob_pattern.h"
 #include "system/uuid.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "threads/parallel.h"
 #include "utility/countof.h"
 #include "utility/resource.h"
 
@@ -23,8 +27,12 @@
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #if defined(__APPLE__)
 #include <libproc.h>
+#include <sys/clonefile.h>
 #elif defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
 #include <sys/sendfile.h>
+#include <sys/syscall.h>
 #endif
 #include <sys/statvfs.h>
 #include <sys/stat.h>
@@ -46,265 +54,420 @@ namespace Internals {
 
 Path initial = Path::current();
 
-std::pair<Path, size_t> root(const std::string& path)
+// Copy the regular file content and return the count of copied bytes
+uint64_t CopyContent(const Path& src, const Path& dst, [[maybe_unused]] bool exists)
 {
-    bool root_found = false;
-    size_t root_length = 0;
-
-    // Unix case 1: "/" or "/foo"
-    if (((path.size() == 1) && ((path[0] == '\\') || (path[0] == '/'))) || ((path.size() > 1) && ((path[0] == '\\') || (path[0] == '/')) && ((path[1] != '\\') && (path[1] != '/'))))
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#if defined(__APPLE__)
+    // Clone the file with shared data blocks (APFS)
+    if (!exists && (clonefile(src.string().c_str(), dst.string().c_str(), CLONE_NOFOLLOW) == 0))
     {
-        root_length = 1;
+        struct stat status;
+        if (stat(dst.string().c_str(), &status) == 0)
+            return (uint64_t)status.st_size;
+    }
+#endif
 
-        return std::make_pair(Path("/"), root_length);
+    // Open the source file for reading
+    int source = open(src.string().c_str(), O_RDONLY, 0);
+    if (source < 0)
+        throwex FileSystemException("Cannot open source file for copy!").Attach(src);
+
+    // Get the source file status
+    struct stat status;
+    int result = fstat(source, &status);
+    if (result != 0)
+    {
+        close(source);
+        throwex FileSystemException("Cannot get the source file status for copy!").Attach(src);
     }
 
-    // Unix case 2: "///foo"
-    if ((path.size() > 2) && ((path[0] == '\\') || (path[0] == '/')) && ((path[1] == '\\') || (path[1] == '/')) && ((path[2] == '\\') || (path[2] == '/')))
+    // Open the destination file for writing
+    int destination = open(dst.string().c_str(), O_CREAT | O_WRONLY | O_TRUNC, status.st_mode);
+    if (destination < 0)
     {
-        root_length = 3;
+        close(source);
+        throwex FileSystemException("Cannot open destination file for copy!").Attach(dst);
+    }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    off_t offset = 0;
+    size_t cur = 0;
+    size_t tot = status.st_size;
+
+#if defined(FICLONE)
+    // Clone the file with shared data blocks (XFS, btrfs)
+    if ((tot > 0) && (ioctl(destination, FICLONE, source) == 0))
+        cur = tot;
+#endif
 
-        // Find root position
-        while (root_length < path.size())
+#if defined(SYS_copy_file_range)
+    // Copy data inside the kernel, file systems may share data blocks or copy them on the server side (NFS, SMB)
+    off_t input = 0;
+    off_t output = 0;
+    while (cur < tot)
+    {
+        ssize_t copied = syscall(SYS_copy_file_range, source, &input, destination, &output, tot - cur, 0);
+        if (copied < 0)
         {
-            if ((path[root_length] != '\\') && (path[root_length] != '/'))
+            if (errno == EINTR)
+                continue;
+
+            // Copy between file systems or not supported copy, fallback to sendfile()
+            if ((cur == 0) && ((errno == EXDEV) || (errno == ENOSYS) || (errno == EINVAL) || (errno == EOPNOTSUPP) || (errno == EPERM)))
                 break;
-            ++root_length;
-        }
 
-        return std::make_pair(Path("/"), root_length);
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot copy the source file to the destination file!").Attach(src, dst);
+        }
+        if (copied == 0)
+        {
+            // Source file was truncated during the copy
+            tot = cur;
+            break;
+        }
+        cur += copied;
     }
+    offset = (off_t)cur;
+#endif
 
-    // Windows case 1: "\\net" or "//net"
-    if ((path.size() > 2) && ((path[0] == '\\') || (path[0] == '/')) && ((path[1] == '\\') || (path[1] == '/')) && ((path[2] != '\\') && (path[2] != '/') && (path[2] != '?')))
+    // Transfer data between source and destination file descriptors
+    while (cur < tot)
     {
-        root_length = 3;
-
-        // Find root position
-        while (root_length < path.size())
+        ssize_t sent;
+        if ((sent = sendfile(destination, source, &offset, tot - cur)) <= 0)
         {
-            if ((path[root_length] == '\\') || (path[root_length] == '/'))
+            if ((errno == EINTR) || (errno == EAGAIN))
             {
-                ++root_length;
-                break;
+                // Interrupted system call/try again
+                // Just skip to the top of the loop and try again
+                continue;
             }
-            ++root_length;
-        }
 
-        return std::make_pair(Path(path.substr(0, root_length)), root_length);
-    }
-
-    // Windows case 2: "\\?\"
-    if ((path.size() > 3) && ((path[0] == '\\') && (path[1] == '\\') && (path[2] == '?') && (path[3] == '\\')))
-    {
-        root_found = true;
-        root_length = 4;
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot send the source file to the destination file!").Attach(src, dst);
+        }
+        cur += sent;
     }
+    uint64_t copied = cur;
+#else
+    char buffer[BUFSIZ];
+    int size;
+    uint64_t copied = 0;
 
-    // Windows case 3: "C:" or "C:\"
-    while (root_length < path.size())
+    do
     {
-        if (path[root_length] == ':')
+        size = read(source, buffer, countof(buffer));
+        if (size < 0)
         {
-            root_found = true;
-
-            ++root_length;
-
-            while (root_length < path.size())
-            {
-                if ((path[root_length] != '\\') && (path[root_length] != '/'))
-                    break;
-                ++root_length;
-            }
-
-            break;
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot read from the file!").Attach(src);
         }
+        size = write(destination, buffer, size);
+        if (size < 0)
+        {
+            close(source);
+            close(destination);
+            throwex FileSystemException("Cannot write into the file!").Attach(dst);
+        }
+        copied += size;
+    } while (size > 0);
+#endif
 
-        ++root_length;
-    }
-
-    return (root_found && (root_length > 0)) ? std::make_pair(Path(path.substr(0, root_length)), root_length) : std::make_pair<Path, size_t>(Path(), 0);
+    // Close files
+    close(source);
+    close(destination);
+    return copied;
+#elif defined(_WIN32) || defined(_WIN64)
+    // CopyFile() clones block of ReFS volumes and Dev Drives by itself
+    if (!CopyFileW(src.wstring().c_str(), dst.wstring().c_str(), FALSE))
+        throwex FileSystemException("Cannot copy the file!").Attach(src, dst);
+
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(dst.wstring().c_str(), GetFileExInfoStandard, &data))
+        return 0;
+    return ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+#endif
 }
 
-} // namespace Internals
-//! @endcond
-
-Path Path::root() const
+// Remove the file or symbolic link without following it
+void Unlink(const Path& path)
 {
-    return Internals::root(_path).first;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int result = unlink(path.string().c_str());
+    if (result != 0)
+        throwex FileSystemException("Cannot unlink the path file!").Attach(path);
+#elif defined(_WIN32) || defined(_WIN64)
+    Path::Remove(path);
+#endif
 }
 
-Path Path::relative() const
+// Rebase the path of the source directory tree to the destination directory tree
+Path Rebase(const Path& path, const Path& src, const Path& dst)
 {
-    size_t root_length = Internals::root(_path).second;
-    size_t relative_length = _path.size() - root_length;
-    return Path(_path.substr(root_length, relative_length));
+    // Walked paths always start with the source path
+    std::string_view relative = std::string_view(path.string()).substr(std::min(src.string().size(), path.string().size()));
+    size_t separators = relative.find_first_not_of("\\/");
+    if (separators == std::string_view::npos)
+        return dst;
+    return dst / relative.substr(separators);
 }
 
-Path Path::parent() const
+// Progress of recursive copy and remove operations with serialized handler calls
+class TreeProgress
 {
-    bool parent_found = false;
-    size_t parent_length = _path.size();
+public:
+    explicit TreeProgress(const std::function<void(const Path&, uint64_t, uint64_t)>& handler) : _handler(handler), _entries(0), _bytes(0) {}
 
-    // Find parent path position
-    bool filepart = false;
-    while (parent_length > 0)
+    void Update(const Path& path, uint64_t bytes)
     {
-        --parent_length;
-        if ((_path[parent_length] == '\\') || (_path[parent_length] == '/'))
-        {
-            parent_found = true;
+        if (!_handler)
+            return;
 
-            // Windows case 1: "\\net" or "//net"
-            if ((parent_length == 1) && ((_path[parent_length - 1] == '\\') || (_path[parent_length - 1] == '/')))
-            {
-                parent_found = false;
-                break;
-            }
-            // Windows case 2: "\\?\"
-            if ((parent_length > 0) && (_path[parent_length - 1] == '?'))
-            {
-                parent_found = filepart;
-                ++parent_length;
-                break;
-            }
-            // Windows case 3: "C:\"
-            if ((parent_length > 0) && (_path[parent_length - 1] == ':'))
-            {
-                parent_found = filepart;
-                ++parent_length;
-                break;
-            }
+        Locker<CriticalSection> locker(_cs);
+        _handler(path, ++_entries, _bytes += bytes);
+    }
 
-            // Skip multiple path separators
-            while (parent_length > 0)
-            {
-                --parent_length;
-                if ((_path[parent_length] != '\\') && (_path[parent_length] != '/'))
-                {
-                    ++parent_length;
-                    break;
-                }
-            }
+private:
+    const std::function<void(const Path&, uint64_t, uint64_t)>& _handler;
+    CriticalSection _cs;
+    uint64_t _entries;
+    uint64_t _bytes;
+};
 
-            // Unix case 1: "/foo" -> "/", but "/" -> ""
-            if ((parent_length == 0) && (_path.size() > 1))
-                ++parent_length;
+// Copy all entries of the source path with matched file names
+template <class TMatcher>
+Path CopyIf(const Path& src, const Path& dst, bool overwrite, TMatcher&& matcher)
+{
+    // Check if the destination path exists
+    bool exists = dst.IsExists();
+    if (exists && !overwrite)
+        return Path();
 
-            break;
-        }
-        else if (_path[parent_length] == ':')
-        {
-            parent_found = false;
-            ++parent_length;
-            break;
-        }
+    // Copy symbolic link or regular file
+    if (src.IsSymlink() || !src.IsDirectory())
+    {
+        if (matcher(src.filename().string()))
+            return Path::Copy(src, dst, overwrite);
         else
-            filepart = true;
+            return Path();
     }
 
-    return (parent_found && (parent_length > 0)) ? Path(_path.substr(0, parent_length)) : Path();
+    // Create destination directory
+    if (!dst.IsExists() || !dst.IsDirectory())
+        Directory::Create(dst, src.attributes(), src.permissions());
+
+    // Copy all directory entries
+    Directory directory(src);
+    for (auto it = directory.begin(); it != directory.end(); ++it)
+    {
+        if (matcher(it->filename().string()))
+        {
+            // Copy symbolic link or regular file
+            if (it->IsSymlink() || !it->IsDirectory())
+                Path::Copy(src / it->filename(), dst / it->filename(), overwrite);
+            else
+                Path::CopyAll(src / it->filename(), dst / it->filename(), overwrite);
+        }
+    }
+    return dst;
 }
 
-Path Path::filename() const
+// Remove all entries of the path with matched file names
+template <class TMatcher>
+Path RemoveIf(const Path& path, TMatcher&& matcher)
 {
-    bool filename_found = false;
-    size_t filename_begin = _path.size();
-    size_t filename_end = _path.size();
+    bool is_directory = false;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (path.IsDirectory())
+        is_directory = true;
+#elif defined(_WIN32) || defined(_WIN64)
+    std::wstring wpath = path.wstring();
+    DWORD attributes = GetFileAttributesW(wpath.c_str());
+    if (attributes == INVALID_FILE_ATTRIBUTES)
+        throwex FileSystemException("Cannot get file attributes of the removed path!").Attach(path);
 
-    // Find filename position
-    while (filename_begin > 0)
+    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+        is_directory = true;
+#endif
+    if (is_directory)
     {
-        --filename_begin;
-        if ((_path[filename_begin] == '\\') || (_path[filename_begin] == '/') || (_path[filename_begin] == ':'))
-        {
-            filename_found = ((_path[filename_begin] == '\\') || (_path[filename_begin] == '/'));
-            ++filename_begin;
-            break;
-        }
+        // Remove all directory entries
+        Directory directory(path);
+        for (auto it = directory.begin(); it != directory.end(); ++it)
+            if (matcher(it->filename().string()))
+                Path::Remove(*it);
+        return path;
     }
 
-    size_t filename_length = (filename_end - filename_begin);
+    // Remove the path
+    if (matcher(path.filename().string()))
+        return Path::Remove(path);
+    else
+        return Path();
+}
 
-    return (filename_length > 0) ? Path(_path.substr(filename_begin, filename_length)) : (filename_found ? Path(".") : Path());
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+void StatusMode(unsigned mode, PathStatus& result) noexcept
+{
+    if (S_ISLNK(mode))
+        result.type = FileType::SYMLINK;
+    else if (S_ISDIR(mode))
+        result.type = FileType::DIRECTORY;
+    else if (S_ISREG(mode))
+        result.type = FileType::REGULAR;
+    else if (S_ISBLK(mode))
+        result.type = FileType::BLOCK;
+    else if (S_ISCHR(mode))
+        result.type = FileType::CHARACTER;
+    else if (S_ISFIFO(mode))
+        result.type = FileType::FIFO;
+    else if (S_ISSOCK(mode))
+        result.type = FileType::SOCKET;
+    else
+        result.type = FileType::UNKNOWN;
+
+    // Permission bits have the same values as FilePermissions
+    result.permissions = (FilePermissions)(mode & 07777);
 }
 
-Path Path::stem() const
+bool StatusFetch(int directory, const char* name, bool follow, PathStatus& result, std::error_code& ec) noexcept
 {
-    bool ext_found = false;
-    size_t ext_begin = _path.size();
-    size_t ext_end = _path.size();
+#if defined(STATX_BASIC_STATS)
+    struct statx status;
+    int flags = follow ? 0 : AT_SYMLINK_NOFOLLOW;
+    if (statx(directory, name, flags, STATX_BASIC_STATS | STATX_BTIME, &status) != 0)
+    {
+        if ((errno != ENOENT) && (errno != ENOTDIR))
+            ec = SystemError::GetLastCode();
+        return false;
+    }
 
-    // Find extension position
-    while (ext_begin > 0)
+    StatusMode(status.stx_mode, result);
+    result.size = (uint64_t)status.stx_size;
+    result.hardlinks = (size_t)status.stx_nlink;
+    result.modified = UtcTimestamp(Timestamp((status.stx_mtime.tv_sec * 1000000000) + status.stx_mtime.tv_nsec));
+    if (status.stx_mask & STATX_BTIME)
+        result.created = UtcTimestamp(Timestamp((status.stx_btime.tv_sec * 1000000000) + status.stx_btime.tv_nsec));
+    else
+        result.created = result.modified;
+#else
+    struct stat status;
+    int flags = follow ? 0 : AT_SYMLINK_NOFOLLOW;
+    if (fstatat(directory, name, &status, flags) != 0)
     {
-        --ext_begin;
-        if (_path[ext_begin] == '.')
-        {
-            ext_found = true;
-            if ((ext_begin > 0) && (_path[ext_begin - 1] == '.'))
-                ext_end = ext_begin;
-            break;
-        }
-        if ((_path[ext_begin] == '\\') || (_path[ext_begin] == '/') || (_path[ext_begin] == ':'))
-        {
-            ++ext_begin;
-            ext_end = ext_begin;
-            break;
-        }
+        if ((errno != ENOENT) && (errno != ENOTDIR))
+            ec = SystemError::GetLastCode();
+        return false;
     }
 
-    size_t ext_length = ext_end - ext_begin;
+    StatusMode(status.st_mode, result);
+    result.size = (uint64_t)status.st_size;
+    result.hardlinks = (size_t)status.st_nlink;
+#if defined(__APPLE__)
+    result.modified = UtcTimestamp(Timestamp((status.st_mtimespec.tv_sec * 1000000000) + status.st_mtimespec.tv_nsec));
+    result.created = UtcTimestamp(Timestamp((status.st_birthtimespec.tv_sec * 1000000000) + status.st_birthtimespec.tv_nsec));
+#else
+    result.modified = UtcTimestamp(Timestamp((status.st_mtim.tv_sec * 1000000000) + status.st_mtim.tv_nsec));
+    result.created = result.modified;
+#endif
+#endif
+    return true;
+}
 
-    bool stem_found = false;
-    size_t stem_begin = ext_begin;
-    size_t stem_end = (ext_found && (ext_length > 1)) ? ext_begin : _path.size();
+PathStatus StatusAt(int directory, const char* name, std::error_code& ec) noexcept
+{
+    ec.clear();
 
-    // Find stem position
-    while (stem_begin > 0)
+    PathStatus result;
+    if (!StatusFetch(directory, name, false, result, ec))
+        return result;
+
+    // Symbolic link is reported with the metadata of its target
+    if (result.type == FileType::SYMLINK)
     {
-        --stem_begin;
-        if ((_path[stem_begin] == '\\') || (_path[stem_begin] == '/') || (_path[stem_begin] == ':'))
+        std::error_code tec;
+        PathStatus target;
+        if (StatusFetch(directory, name, true, target, tec))
         {
-            stem_found = ((_path[stem_begin] == '\\') || (_path[stem_begin] == '/'));
-            ++stem_begin;
-            break;
+            result = target;
+            result.type = FileType::SYMLINK;
         }
     }
 
-    size_t stem_length = (stem_end - stem_begin);
+    return result;
+}
+#endif
 
-    return (stem_length > 0) ? Path(_path.substr(stem_begin, stem_length)) : (stem_found ? Path(".") : Path());
+PathStatus StatusFindData([[maybe_unused]] uint32_t attributes, [[maybe_unused]] uint64_t size, [[maybe_unused]] uint64_t created, [[maybe_unused]] uint64_t modified) noexcept
+{
+    PathStatus result;
+#if defined(_WIN32) || defined(_WIN64)
+    if (attributes & FILE_ATTRIBUTE_REPARSE_POINT)
+        result.type = FileType::SYMLINK;
+    else if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+        result.type = FileType::DIRECTORY;
+    else
+        result.type = FileType::REGULAR;
+
+    if (attributes & FILE_ATTRIBUTE_NORMAL)
+        result.attributes |= FileAttributes::NORMAL;
+    if (attributes & FILE_ATTRIBUTE_ARCHIVE)
+        result.attributes |= FileAttributes::ARCHIVED;
+    if (attributes & FILE_ATTRIBUTE_HIDDEN)
+        result.attributes |= FileAttributes::HIDDEN;
+    if (attributes & FILE_ATTRIBUTE_NOT_CONTENT_INDEXED)
+        result.attributes |= FileAttributes::INDEXED;
+    if (attributes & FILE_ATTRIBUTE_OFFLINE)
+        result.attributes |= FileAttributes::OFFLINE;
+    if (attributes & FILE_ATTRIBUTE_READONLY)
+        result.attributes |= FileAttributes::READONLY;
+    if (attributes & FILE_ATTRIBUTE_SYSTEM)
+        result.attributes |= FileAttributes::SYSTEM;
+    if (attributes & FILE_ATTRIBUTE_TEMPORARY)
+        result.attributes |= FileAttributes::TEMPORARY;
+
+    result.size = size;
+    result.created = UtcTimestamp(Timestamp((created - 116444736000000000ull) * 100));
+    result.modified = UtcTimestamp(Timestamp((modified - 116444736000000000ull) * 100));
+#endif
+    return result;
 }
 
-Path Path::extension() const
+} // namespace Internals
+//! @endcond
+
+Path Path::root() const
 {
-    bool ext_found = false;
-    size_t ext_begin = _path.size();
-    size_t ext_end = _path.size();
+    return Path(PathView(_path).root());
+}
 
-    // Find extension position
-    while (ext_begin > 0)
-    {
-        --ext_begin;
-        if (_path[ext_begin] == '.')
-        {
-            ext_found = true;
-            if ((ext_begin > 0) && (_path[ext_begin - 1] == '.'))
-                ext_end = ext_begin;
-            break;
-        }
-        if ((_path[ext_begin] == '\\') || (_path[ext_begin] == '/') || (_path[ext_begin] == ':'))
-        {
-            ++ext_begin;
-            ext_end = ext_begin;
-            break;
-        }
-    }
+Path Path::relative() const
+{
+    return Path(PathView(_path).relative());
+}
+
+Path Path::parent() const
+{
+    return Path(PathView(_path).parent());
+}
+
+Path Path::filename() const
+{
+    return Path(PathView(_path).filename());
+}
 
-    size_t ext_length = ext_end - ext_begin;
+Path Path::stem() const
+{
+    return Path(PathView(_path).stem());
+}
 
-    return (ext_found && (ext_length > 1)) ? Path(_path.substr(ext_begin, ext_length)) : Path();
+Path Path::extension() const
+{
+    return Path(PathView(_path).extension());
 }
 
 Path Path::absolute() const
@@ -370,9 +533,9 @@ Path Path::canonical() const
         if ((_path[length] == '\\') || (_path[length] == '/'))
         {
             // Append path file/directory part
-            std::string temp(_path.data() + index, length - index);
-            if (!temp.empty())
-                result /= temp;
+            PathView part(std::string_view(_path.data() + index, length - index));
+            if (!part.empty())
+                result /= part;
             index = length + 1;
             filepart = false;
         }
@@ -390,7 +553,8 @@ Path Path::canonical() const
 
            ++length;
 
-           result = result.parent();
+           // Parent path is always the prefix of the path
+           result._path.resize(PathView(result).parent().size());
            // If the parent directory is empty then also return an empty path
            if (result.empty())
                return result;
@@ -402,9 +566,9 @@ Path Path::canonical() const
     }
 
     // Append the last path file/directory part
-    std::string temp(_path.data() + index, length - index);
-    if (!temp.empty())
-        result /= temp;
+    PathView part(std::string_view(_path.data() + index, length - index));
+    if (!part.empty())
+        result /= part;
 
     return result;
 }
@@ -422,6 +586,16 @@ Path Path::validate(char placeholder) const
 
 FileType Path::type() const
 {
+    std::error_code ec;
+    FileType result = type(ec);
+    if (ec)
+        throwex FileSystemException("Cannot get the status of the path!").Attach(*this);
+    return result;
+}
+
+FileType Path::type(std::error_code& ec) const noexcept
+{
+    ec.clear();
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     // Special check for symlink
     struct stat lstatus;
@@ -433,10 +607,9 @@ FileType Path::type() const
     int result = stat(string().c_str(), &status);
     if (result != 0)
     {
-        if ((errno == ENOENT) || (errno == ENOTDIR))
-            return FileType::NONE;
-        else
-            throwex FileSystemException("Cannot get the status of the path!").Attach(*this);
+        if ((errno != ENOENT) && (errno != ENOTDIR))
+            ec = SystemError::GetLastCode();
+        return FileType::NONE;
     }
 
     if (S_ISLNK(status.st_mode))
@@ -641,6 +814,43 @@ size_t Path::hardlinks() const
 #endif
 }
 
+PathStatus Path::status() const
+{
+    std::error_code ec;
+    PathStatus result = status(ec);
+    if (ec)
+        throwex FileSystemException("Cannot get the status of the path!").Attach(*this);
+    return result;
+}
+
+PathStatus Path::status(std::error_code& ec) const noexcept
+{
+    ec.clear();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    return Internals::StatusAt(AT_FDCWD, string().c_str(), ec);
+#elif defined(_WIN32) || defined(_WIN64)
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(wstring().c_str(), GetFileExInfoStandard, &data))
+    {
+        DWORD error = GetLastError();
+        if ((error != ERROR_FILE_NOT_FOUND) && (error != ERROR_PATH_NOT_FOUND))
+            ec = SystemError::GetLastCode();
+        return PathStatus();
+    }
+
+    ULARGE_INTEGER size;
+    size.LowPart = data.nFileSizeLow;
+    size.HighPart = data.nFileSizeHigh;
+    ULARGE_INTEGER created;
+    created.LowPart = data.ftCreationTime.dwLowDateTime;
+    created.HighPart = data.ftCreationTime.dwHighDateTime;
+    ULARGE_INTEGER modified;
+    modified.LowPart = data.ftLastWriteTime.dwLowDateTime;
+    modified.HighPart = data.ftLastWriteTime.dwHighDateTime;
+    return Internals::StatusFindData(data.dwFileAttributes, size.QuadPart, created.QuadPart, modified.QuadPart);
+#endif
+}
+
 SpaceInfo Path::space() const
 {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -734,19 +944,24 @@ bool Path::IsEquivalent(const Path& path) const
 #endif
 }
 
-Path& Path::Append(const Path& path)
+Path& Path::Append(PathView path)
 {
+    // Path view of the current path is copied before it is modified
+    if (overlaps(path))
+        return Append(Path(path));
+
     if (_path.empty())
-        _path = path._path;
+        _path.assign(path.data(), path.size());
     else
     {
         char last = _path[_path.size() - 1];
         if ((last == '\\') || (last == '/'))
-            _path += path._path;
+            _path.append(path.data(), path.size());
         else
         {
+            _path.reserve(_path.size() + path.size() + 1);
             _path += separator();
-            _path += path._path;
+            _path.append(path.data(), path.size());
         }
     }
 
@@ -763,10 +978,14 @@ Path& Path::MakePreferred()
     return *this;
 }
 
-Path& Path::ReplaceFilename(const Path& filename)
+Path& Path::ReplaceFilename(PathView filename)
 {
+    // Path view of the current path is copied before it is modified
+    if (overlaps(filename))
+        return ReplaceFilename(Path(filename));
+
     if (_path.empty())
-        _path.append(filename._path);
+        _path.append(filename.data(), filename.size());
     else
     {
         size_t index = _path.size();
@@ -784,20 +1003,24 @@ Path& Path::ReplaceFilename(const Path& filename)
         }
 
         _path.resize(index);
-        _path.append(filename._path);
+        _path.append(filename.data(), filename.size());
     }
     return *this;
 }
 
-Path& Path::ReplaceExtension(const Path& extension)
+Path& Path::ReplaceExtension(PathView extension)
 {
-    bool dot_required = (!extension._path.empty() && (extension._path[0] != '.'));
+    // Path view of the current path is copied before it is modified
+    if (overlaps(extension))
+        return ReplaceExtension(Path(extension));
+
+    bool dot_required = (!extension.empty() && (extension.string()[0] != '.'));
 
     if (_path.empty())
     {
         if (dot_required)
             _path.append(".");
-        _path.append(extension._path);
+        _path.append(extension.data(), extension.size());
     }
     else
     {
@@ -823,7 +1046,7 @@ Path& Path::ReplaceExtension(const Path& extension)
         _path.resize(dot);
         if (dot_required)
             _path.append(".");
-        _path.append(extension._path);
+        _path.append(extension.data(), extension.size());
     }
     return *this;
 }
@@ -1035,82 +1258,7 @@ Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
     }
     else
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        // Open the source file for reading
-        int source = open(src.string().c_str(), O_RDONLY, 0);
-        if (source < 0)
-            throwex FileSystemException("Cannot open source file for copy!").Attach(src);
-
-        // Get the source file status
-        struct stat status;
-        int result = fstat(source, &status);
-        if (result != 0)
-        {
-            close(source);
-            throwex FileSystemException("Cannot get the source file status for copy!").Attach(src);
-        }
-
-        // Open the destination file for writing
-        int destination = open(dst.string().c_str(), O_CREAT | O_WRONLY | O_TRUNC, status.st_mode);
-        if (destination < 0)
-        {
-            close(source);
-            throwex FileSystemException("Cannot open destination file for copy!").Attach(dst);
-        }
-
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        // Transfer data between source and destination file descriptors
-        off_t offset = 0;
-        size_t cur = 0;
-        size_t tot = status.st_size;
-        while (cur < tot)
-        {
-            ssize_t sent;
-            if ((sent = sendfile(destination, source, &offset, tot - cur)) <= 0)
-            {
-                if ((errno == EINTR) || (errno == EAGAIN))
-                {
-                    // Interrupted system call/try again
-                    // Just skip to the top of the loop and try again
-                    continue;
-                }
-
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot send the source file to the destination file!").Attach(src, dst);
-            }
-            cur += sent;
-        }
-#else
-        char buffer[BUFSIZ];
-        int size;
-
-        do
-        {
-            size = read(source, buffer, countof(buffer));
-            if (size < 0)
-            {
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot read from the file!").Attach(src);
-            }
-            size = write(destination, buffer, size);
-            if (size < 0)
-            {
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot write into the file!").Attach(dst);
-            }
-        } while (size > 0);
-#endif
-
-        // Close files
-        close(source);
-        close(destination);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CopyFileW(src.wstring().c_str(), dst.wstring().c_str(), FALSE))
-            throwex FileSystemException("Cannot copy the file!").Attach(src, dst);
-#endif
+        Internals::CopyContent(src, dst, exists);
         return dst;
     }
 }
@@ -1118,78 +1266,95 @@ Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
 Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern, bool overwrite)
 {
     std::regex matcher(pattern);
+    return Internals::CopyIf(src, dst, overwrite, [&](const std::string& name) { return pattern.empty() || std::regex_match(name, matcher); });
+}
+
+Path Path::CopyIf(const Path& src, const Path& dst, const GlobPattern& pattern, bool overwrite)
+{
+    return Internals::CopyIf(src, dst, overwrite, [&](const std::string& name) { return pattern.Match(name); });
+}
 
+Path Path::CopyAll(const Path& src, const Path& dst, bool overwrite, const PathTreeOptions& options)
+{
     // Check if the destination path exists
     bool exists = dst.IsExists();
     if (exists && !overwrite)
         return Path();
 
+    Internals::TreeProgress progress(options.progress);
+
     // Copy symbolic link or regular file
-    if (src.IsSymlink() || !src.IsDirectory())
+    FileType type = src.type();
+    if (type != FileType::DIRECTORY)
     {
-        if (pattern.empty() || std::regex_match(src.filename().string(), matcher))
-            return Copy(src, dst, overwrite);
+        uint64_t bytes = 0;
+        if (type == FileType::REGULAR)
+            bytes = Internals::CopyContent(src, dst, exists);
         else
-            return Path();
+            Copy(src, dst, overwrite);
+        progress.Update(dst, bytes);
+        return dst;
     }
 
-    // Create destination directory
-    if (!dst.IsExists() || !dst.IsDirectory())
-        Directory::Create(dst, src.attributes(), src.permissions());
+    Directory::Create(dst, src.attributes(), src.permissions());
+    progress.Update(dst, 0);
 
-    // Copy all directory entries
-    Directory directory(src);
-    for (auto it = directory.begin(); it != directory.end(); ++it)
+    // Create the destination directory tree and collect files to copy
+    CriticalSection cs;
+    std::vector<std::tuple<Path, Path, FileType>> files;
+    DirectoryWalkOptions walk;
+    walk.pool = options.pool;
+    walk.concurrency = options.concurrency;
+    Directory(src).Walk([&](const DirectoryEntry& entry)
     {
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+        Path source = entry.path();
+        Path destination = Internals::Rebase(entry.parent, src, dst) / entry.name;
+
+        // Directories are reported before their entries, so the parent destination directory is always created
+        if (entry.type == FileType::DIRECTORY)
         {
-            // Copy symbolic link or regular file
-            if (it->IsSymlink() || !it->IsDirectory())
-                Copy(src / it->filename(), dst / it->filename(), overwrite);
-            else
-                CopyAll(src / it->filename(), dst / it->filename(), overwrite);
+            Directory::Create(destination, source.attributes(), source.permissions());
+            progress.Update(destination, 0);
         }
-    }
-    return dst;
-}
-
-Path Path::CopyAll(const Path& src, const Path& dst, bool overwrite)
-{
-    // Check if the destination path exists
-    bool exists = dst.IsExists();
-    if (exists && !overwrite)
-        return Path();
-
-    // Copy symbolic link or regular file
-    if (src.IsSymlink() || !src.IsDirectory())
-        return Copy(src, dst, overwrite);
-
-    // Add directory to copy stack
-    std::stack<std::tuple<Path, Path>> dirs;
-    dirs.push(std::make_tuple(src, dst));
+        else
+        {
+            Locker<CriticalSection> locker(cs);
+            files.emplace_back(std::move(source), std::move(destination), entry.type);
+        }
+        return true;
+    }, walk);
 
-    // Do we have anything to copy in stack?
-    while (!dirs.empty())
+    // Copy files with the bounded count of in-flight operations
+    auto copy = [&](size_t index)
     {
-        // Get the top directory
-        std::tuple<Path, Path> current = dirs.top();
-        Directory srcdir(std::get<0>(current));
-        Directory dstdir(std::get<1>(current));
-        dirs.pop();
+        const auto& [source, destination, file_type] = files[index];
 
-        // Create destination directory
-        Directory::Create(dstdir, srcdir.attributes(), srcdir.permissions());
-
-        // Copy all directory entries
-        for (auto it = srcdir.begin(); it != srcdir.end(); ++it)
+        uint64_t bytes = 0;
+        if (file_type == FileType::REGULAR)
         {
-            // Copy symbolic link or regular file
-            if (it->IsSymlink() || !it->IsDirectory())
-                Copy(srcdir / it->filename(), dstdir / it->filename(), overwrite);
-            else
-                dirs.push(std::make_tuple(srcdir / it->filename(), dstdir / it->filename()));
+            bool found = destination.IsExists();
+            if (!found || overwrite)
+                bytes = Internals::CopyContent(source, destination, found);
         }
+        else
+            Copy(source, destination, overwrite);
+
+        progress.Update(destination, bytes);
+    };
+
+    if (options.pool != nullptr)
+    {
+        ParallelOptions parallel;
+        parallel.grain = 1;
+        parallel.concurrency = options.concurrency;
+        ParallelFor(*options.pool, (size_t)0, files.size(), copy, parallel);
     }
+    else
+    {
+        for (size_t i = 0; i < files.size(); ++i)
+            copy(i);
+    }
+
     return dst;
 }
 
@@ -1248,42 +1413,20 @@ Path Path::Remove(const Path& path)
 Path Path::RemoveIf(const Path& path, const std::string& pattern)
 {
     std::regex matcher(pattern);
+    return Internals::RemoveIf(path, [&](const std::string& name) { return pattern.empty() || std::regex_match(name, matcher); });
+}
 
-    bool is_directory = false;
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (path.IsDirectory())
-        is_directory = true;
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring wpath = path.wstring();
-    DWORD attributes = GetFileAttributesW(wpath.c_str());
-    if (attributes == INVALID_FILE_ATTRIBUTES)
-        throwex FileSystemException("Cannot get file attributes of the removed path!").Attach(path);
-
-    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
-        is_directory = true;
-#endif
-    if (is_directory)
-    {
-        // Remove all directory entries
-        Directory directory(path);
-        for (auto it = directory.begin(); it != directory.end(); ++it)
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
-                Remove(*it);
-        return path;
-    }
-
-    // Remove the path
-    if (pattern.empty() || std::regex_match(path.filename().string(), matcher))
-        return Remove(path);
-    else
-        return Path();
+Path Path::RemoveIf(const Path& path, const GlobPattern& pattern)
+{
+    return Internals::RemoveIf(path, [&](const std::string& name) { return pattern.Match(name); });
 }
 
-Path Path::RemoveAll(const Path& path)
+Path Path::RemoveAll(const Path& path, const PathTreeOptions& options)
 {
     bool is_directory = false;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (path.IsDirectory())
+    struct stat status;
+    if ((lstat(path.string().c_str(), &status) == 0) && S_ISDIR(status.st_mode))
         is_directory = true;
 #elif defined(_WIN32) || defined(_WIN64)
     std::wstring wpath = path.wstring();
@@ -1291,19 +1434,54 @@ Path Path::RemoveAll(const Path& path)
     if (attributes == INVALID_FILE_ATTRIBUTES)
         throwex FileSystemException("Cannot get file attributes of the removed path!").Attach(path);
 
-    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+    if ((attributes & FILE_ATTRIBUTE_DIRECTORY) && !(attributes & FILE_ATTRIBUTE_REPARSE_POINT))
         is_directory = true;
 #endif
+
+    Internals::TreeProgress progress(options.progress);
+
     if (is_directory)
     {
-        // Recursively remove all directory entries
-        Directory directory(path);
-        for (auto it = directory.rbegin(); it != directory.rend(); ++it)
+        // Remove all non-directory entries during the walk, symbolic links are removed without following
+        CriticalSection cs;
+        std::vector<Path> directories;
+        DirectoryWalkOptions walk;
+        walk.pool = options.pool;
+        walk.concurrency = options.concurrency;
+        Directory(path).Walk([&](const DirectoryEntry& entry)
+        {
+            Path current = entry.path();
+            if (entry.type == FileType::DIRECTORY)
+            {
+                Locker<CriticalSection> locker(cs);
+                directories.emplace_back(std::move(current));
+                return true;
+            }
+
+            Internals::Unlink(current);
+            progress.Update(current, 0);
+            return true;
+        }, walk);
+
+        // Directories are reported before their entries, so remove them in the reverse order
+        for (auto it = directories.rbegin(); it != directories.rend(); ++it)
+        {
             Remove(*it);
+            progress.Update(*it, 0);
+        }
+    }
+    else
+    {
+        // Remove the symbolic link or file
+        Internals::Unlink(path);
+        progress.Update(path, 0);
+        return path.parent();
     }
 
     // Remove the path
-    return Remove(path);
+    Path result = Remove(path);
+    progress.Update(path, 0);
+    return result;
 }
 
 void Path::SetAttributes(const Path& path, const Flags<FileAttributes>& attributes)
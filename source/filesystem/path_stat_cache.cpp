@@ -0,0 +1,311 @@
+/*!
+    \file path_stat_cache.cpp
+    \brief Filesystem path metadata cache implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/path_stat_cache.h"
+
+#include "filesystem/directory.h"
+#include "filesystem/directory_watcher.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "threads/rw_lock.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class PathStatCache::Impl
+{
+public:
+    Impl(const Timespan& ttl)
+        : _ttl(ttl),
+          _hits(0),
+          _misses(0),
+          _shards(std::make_unique<Shard[]>(SHARDS)),
+          _watching(false),
+          _polled(0)
+    {
+    }
+
+    const Timespan& ttl() const noexcept { return _ttl; }
+
+    size_t size() const
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < SHARDS; ++i)
+        {
+            ReadLocker<RWLock> locker(_shards[i].lock);
+            result += _shards[i].entries.size();
+        }
+        return result;
+    }
+
+    uint64_t hits() const noexcept { return _hits.load(std::memory_order_relaxed); }
+    uint64_t misses() const noexcept { return _misses.load(std::memory_order_relaxed); }
+
+    void Watch(const Path& directory)
+    {
+        Locker<CriticalSection> locker(_cs);
+        _watchers.emplace_back(std::make_unique<DirectoryWatcher>(directory));
+        _watching.store(true, std::memory_order_release);
+    }
+
+    PathStatus Get(const Path& path)
+    {
+        PollLazy();
+
+        uint64_t timestamp = Timestamp::coarse_nano();
+
+        // Lookup the cached entry
+        Shard& shard = shard_of(path.string());
+        {
+            ReadLocker<RWLock> locker(shard.lock);
+            auto it = shard.entries.find(path.string());
+            if ((it != shard.entries.end()) && valid(it->second, timestamp))
+            {
+                _hits.fetch_add(1, std::memory_order_relaxed);
+                return it->second.status;
+            }
+        }
+
+        // Fetch metadata out of the lock
+        _misses.fetch_add(1, std::memory_order_relaxed);
+        PathStatus status = path.status();
+
+        WriteLocker<RWLock> locker(shard.lock);
+        shard.entries[path.string()] = Entry{ status, timestamp };
+        return status;
+    }
+
+    void Get(const std::vector<Path>& paths, std::vector<PathStatus>& result)
+    {
+        PollLazy();
+
+        uint64_t timestamp = Timestamp::coarse_nano();
+
+        result.resize(paths.size());
+        std::vector<size_t> missed;
+
+        // Lookup cached entries taking the lock of each shard only once
+        std::vector<std::vector<size_t>> groups(SHARDS);
+        for (size_t i = 0; i < paths.size(); ++i)
+            groups[index_of(paths[i].string())].push_back(i);
+        for (size_t i = 0; i < SHARDS; ++i)
+        {
+            if (groups[i].empty())
+                continue;
+
+            ReadLocker<RWLock> locker(_shards[i].lock);
+            for (size_t index : groups[i])
+            {
+                auto it = _shards[i].entries.find(paths[index].string());
+                if ((it != _shards[i].entries.end()) && valid(it->second, timestamp))
+                    result[index] = it->second.status;
+                else
+                    missed.push_back(index);
+            }
+        }
+
+        _hits.fetch_add(paths.size() - missed.size(), std::memory_order_relaxed);
+        if (missed.empty())
+            return;
+        _misses.fetch_add(missed.size(), std::memory_order_relaxed);
+
+        // Fetch metadata of missed paths out of locks
+        for (auto& group : groups)
+            group.clear();
+        for (size_t index : missed)
+        {
+            result[index] = paths[index].status();
+            groups[index_of(paths[index].string())].push_back(index);
+        }
+
+        // Store fetched metadata taking the lock of each shard only once
+        for (size_t i = 0; i < SHARDS; ++i)
+        {
+            if (groups[i].empty())
+                continue;
+
+            WriteLocker<RWLock> locker(_shards[i].lock);
+            for (size_t index : groups[i])
+                _shards[i].entries[paths[index].string()] = Entry{ result[index], timestamp };
+        }
+    }
+
+    void Put(const Path& path, const PathStatus& status)
+    {
+        Shard& shard = shard_of(path.string());
+        WriteLocker<RWLock> locker(shard.lock);
+        shard.entries[path.string()] = Entry{ status, Timestamp::coarse_nano() };
+    }
+
+    size_t Populate(const Path& directory, bool recursive)
+    {
+        size_t result = 0;
+        Directory dir(directory);
+        for (auto it = recursive ? dir.rbegin() : dir.begin(); it != (recursive ? dir.rend() : dir.end()); ++it)
+        {
+            Put(*it, it.status());
+            ++result;
+        }
+        return result;
+    }
+
+    bool Invalidate(const std::string& path)
+    {
+        Shard& shard = shard_of(path);
+        WriteLocker<RWLock> locker(shard.lock);
+        return shard.entries.erase(path) > 0;
+    }
+
+    void Clear()
+    {
+        for (size_t i = 0; i < SHARDS; ++i)
+        {
+            WriteLocker<RWLock> locker(_shards[i].lock);
+            _shards[i].entries.clear();
+        }
+    }
+
+    size_t Poll()
+    {
+        Locker<CriticalSection> locker(_cs);
+        return PollWatchers();
+    }
+
+private:
+    static const size_t SHARDS = 64;
+    static const uint64_t POLL_INTERVAL = 1000000;
+
+    struct Entry
+    {
+        PathStatus status;
+        uint64_t timestamp;
+    };
+
+    struct Shard
+    {
+        mutable RWLock lock;
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    Timespan _ttl;
+    std::atomic<uint64_t> _hits;
+    std::atomic<uint64_t> _misses;
+    std::unique_ptr<Shard[]> _shards;
+
+    CriticalSection _cs;
+    std::vector<std::unique_ptr<DirectoryWatcher>> _watchers;
+    std::vector<DirectoryWatcher::Change> _changes;
+    std::atomic<bool> _watching;
+    std::atomic<uint64_t> _polled;
+
+    static size_t index_of(const std::string& path) noexcept
+    { return std::hash<std::string>()(path) % SHARDS; }
+    Shard& shard_of(const std::string& path) const noexcept
+    { return _shards[index_of(path)]; }
+
+    bool valid(const Entry& entry, uint64_t timestamp) const noexcept
+    { return (_ttl.total() <= 0) || ((timestamp - entry.timestamp) < (uint64_t)_ttl.total()); }
+
+    void PollLazy()
+    {
+        if (!_watching.load(std::memory_order_acquire))
+            return;
+
+        // Poll change notifications at most once per the poll interval
+        uint64_t timestamp = Timestamp::coarse_nano();
+        uint64_t polled = _polled.load(std::memory_order_relaxed);
+        if ((timestamp - polled) < POLL_INTERVAL)
+            return;
+        if (!_polled.compare_exchange_strong(polled, timestamp, std::memory_order_relaxed))
+            return;
+
+        // Another thread is already polling change notifications
+        if (!_cs.TryLock())
+            return;
+
+        try
+        {
+            PollWatchers();
+        }
+        catch (...)
+        {
+            _cs.Unlock();
+            throw;
+        }
+        _cs.Unlock();
+    }
+
+    size_t PollWatchers()
+    {
+        size_t result = 0;
+        for (auto& watcher : _watchers)
+        {
+            _changes.clear();
+            result += watcher->Poll(_changes);
+            for (const auto& change : _changes)
+            {
+                if (change.first == DirectoryChange::RESCAN)
+                {
+                    Clear();
+                    continue;
+                }
+
+                // Both the changed entry and its parent directory are changed
+                Invalidate(change.second.string());
+                Invalidate(change.second.parent().string());
+            }
+        }
+        return result;
+    }
+};
+
+//! @endcond
+
+PathStatCache::PathStatCache(const Timespan& ttl)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "PathStatCache::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "PathStatCache::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(ttl);
+}
+
+PathStatCache::~PathStatCache()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+const Timespan& PathStatCache::ttl() const noexcept { return impl().ttl(); }
+size_t PathStatCache::size() const { return impl().size(); }
+uint64_t PathStatCache::hits() const noexcept { return impl().hits(); }
+uint64_t PathStatCache::misses() const noexcept { return impl().misses(); }
+
+void PathStatCache::Watch(const Path& directory) { impl().Watch(directory); }
+
+PathStatus PathStatCache::Get(const Path& path) { return impl().Get(path); }
+void PathStatCache::Get(const std::vector<Path>& paths, std::vector<PathStatus>& result) { impl().Get(paths, result); }
+
+void PathStatCache::Put(const Path& path, const PathStatus& status) { impl().Put(path, status); }
+size_t PathStatCache::Populate(const Path& directory, bool recursive) { return impl().Populate(directory, recursive); }
+
+bool PathStatCache::Invalidate(const Path& path) { return impl().Invalidate(path.string()); }
+void PathStatCache::Clear() { impl().Clear(); }
+
+size_t PathStatCache::Poll() { return impl().Poll(); }
+
+} // namespace CppCommon
@@ -0,0 +1,279 @@
+/*!
+    \file path_view.cpp
+    \brief Filesystem path view implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/path.h"
+
+#include <utility>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+std::pair<PathView, size_t> root(std::string_view path)
+{
+    bool root_found = false;
+    size_t root_length = 0;
+
+    // Unix case 1: "/" or "/foo"
+    if (((path.size() == 1) && ((path[0] == '\\') || (path[0] == '/'))) || ((path.size() > 1) && ((path[0] == '\\') || (path[0] == '/')) && ((path[1] != '\\') && (path[1] != '/'))))
+    {
+        root_length = 1;
+
+        return std::make_pair(PathView("/"), root_length);
+    }
+
+    // Unix case 2: "///foo"
+    if ((path.size() > 2) && ((path[0] == '\\') || (path[0] == '/')) && ((path[1] == '\\') || (path[1] == '/')) && ((path[2] == '\\') || (path[2] == '/')))
+    {
+        root_length = 3;
+
+        // Find root position
+        while (root_length < path.size())
+        {
+            if ((path[root_length] != '\\') && (path[root_length] != '/'))
+                break;
+            ++root_length;
+        }
+
+        return std::make_pair(PathView("/"), root_length);
+    }
+
+    // Windows case 1: "\\net" or "//net"
+    if ((path.size() > 2) && ((path[0] == '\\') || (path[0] == '/')) && ((path[1] == '\\') || (path[1] == '/')) && ((path[2] != '\\') && (path[2] != '/') && (path[2] != '?')))
+    {
+        root_length = 3;
+
+        // Find root position
+        while (root_length < path.size())
+        {
+            if ((path[root_length] == '\\') || (path[root_length] == '/'))
+            {
+                ++root_length;
+                break;
+            }
+            ++root_length;
+        }
+
+        return std::make_pair(PathView(path.substr(0, root_length)), root_length);
+    }
+
+    // Windows case 2: "\\?\"
+    if ((path.size() > 3) && ((path[0] == '\\') && (path[1] == '\\') && (path[2] == '?') && (path[3] == '\\')))
+    {
+        root_found = true;
+        root_length = 4;
+    }
+
+    // Windows case 3: "C:" or "C:\"
+    while (root_length < path.size())
+    {
+        if (path[root_length] == ':')
+        {
+            root_found = true;
+
+            ++root_length;
+
+            while (root_length < path.size())
+            {
+                if ((path[root_length] != '\\') && (path[root_length] != '/'))
+                    break;
+                ++root_length;
+            }
+
+            break;
+        }
+
+        ++root_length;
+    }
+
+    return (root_found && (root_length > 0)) ? std::make_pair(PathView(path.substr(0, root_length)), root_length) : std::make_pair<PathView, size_t>(PathView(), 0);
+}
+
+} // namespace Internals
+//! @endcond
+
+PathView PathView::root() const noexcept
+{
+    return Internals::root(_path).first;
+}
+
+PathView PathView::relative() const noexcept
+{
+    size_t root_length = Internals::root(_path).second;
+    size_t relative_length = _path.size() - root_length;
+    return PathView(_path.substr(root_length, relative_length));
+}
+
+PathView PathView::parent() const noexcept
+{
+    bool parent_found = false;
+    size_t parent_length = _path.size();
+
+    // Find parent path position
+    bool filepart = false;
+    while (parent_length > 0)
+    {
+        --parent_length;
+        if ((_path[parent_length] == '\\') || (_path[parent_length] == '/'))
+        {
+            parent_found = true;
+
+            // Windows case 1: "\\net" or "//net"
+            if ((parent_length == 1) && ((_path[parent_length - 1] == '\\') || (_path[parent_length - 1] == '/')))
+            {
+                parent_found = false;
+                break;
+            }
+            // Windows case 2: "\\?\"
+            if ((parent_length > 0) && (_path[parent_length - 1] == '?'))
+            {
+                parent_found = filepart;
+                ++parent_length;
+                break;
+            }
+            // Windows case 3: "C:\"
+            if ((parent_length > 0) && (_path[parent_length - 1] == ':'))
+            {
+                parent_found = filepart;
+                ++parent_length;
+                break;
+            }
+
+            // Skip multiple path separators
+            while (parent_length > 0)
+            {
+                --parent_length;
+                if ((_path[parent_length] != '\\') && (_path[parent_length] != '/'))
+                {
+                    ++parent_length;
+                    break;
+                }
+            }
+
+            // Unix case 1: "/foo" -> "/", but "/" -> ""
+            if ((parent_length == 0) && (_path.size() > 1))
+                ++parent_length;
+
+            break;
+        }
+        else if (_path[parent_length] == ':')
+        {
+            parent_found = false;
+            ++parent_length;
+            break;
+        }
+        else
+            filepart = true;
+    }
+
+    return (parent_found && (parent_length > 0)) ? PathView(_path.substr(0, parent_length)) : PathView();
+}
+
+PathView PathView::filename() const noexcept
+{
+    bool filename_found = false;
+    size_t filename_begin = _path.size();
+    size_t filename_end = _path.size();
+
+    // Find filename position
+    while (filename_begin > 0)
+    {
+        --filename_begin;
+        if ((_path[filename_begin] == '\\') || (_path[filename_begin] == '/') || (_path[filename_begin] == ':'))
+        {
+            filename_found = ((_path[filename_begin] == '\\') || (_path[filename_begin] == '/'));
+            ++filename_begin;
+            break;
+        }
+    }
+
+    size_t filename_length = (filename_end - filename_begin);
+
+    return (filename_length > 0) ? PathView(_path.substr(filename_begin, filename_length)) : (filename_found ? PathView(".") : PathView());
+}
+
+PathView PathView::stem() const noexcept
+{
+    bool ext_found = false;
+    size_t ext_begin = _path.size();
+    size_t ext_end = _path.size();
+
+    // Find extension position
+    while (ext_begin > 0)
+    {
+        --ext_begin;
+        if (_path[ext_begin] == '.')
+        {
+            ext_found = true;
+            if ((ext_begin > 0) && (_path[ext_begin - 1] == '.'))
+                ext_end = ext_begin;
+            break;
+        }
+        if ((_path[ext_begin] == '\\') || (_path[ext_begin] == '/') || (_path[ext_begin] == ':'))
+        {
+            ++ext_begin;
+            ext_end = ext_begin;
+            break;
+        }
+    }
+
+    size_t ext_length = ext_end - ext_begin;
+
+    bool stem_found = false;
+    size_t stem_begin = ext_begin;
+    size_t stem_end = (ext_found && (ext_length > 1)) ? ext_begin : _path.size();
+
+    // Find stem position
+    while (stem_begin > 0)
+    {
+        --stem_begin;
+        if ((_path[stem_begin] == '\\') || (_path[stem_begin] == '/') || (_path[stem_begin] == ':'))
+        {
+            stem_found = ((_path[stem_begin] == '\\') || (_path[stem_begin] == '/'));
+            ++stem_begin;
+            break;
+        }
+    }
+
+    size_t stem_length = (stem_end - stem_begin);
+
+    return (stem_length > 0) ? PathView(_path.substr(stem_begin, stem_length)) : (stem_found ? PathView(".") : PathView());
+}
+
+PathView PathView::extension() const noexcept
+{
+    bool ext_found = false;
+    size_t ext_begin = _path.size();
+    size_t ext_end = _path.size();
+
+    // Find extension position
+    while (ext_begin > 0)
+    {
+        --ext_begin;
+        if (_path[ext_begin] == '.')
+        {
+            ext_found = true;
+            if ((ext_begin > 0) && (_path[ext_begin - 1] == '.'))
+                ext_end = ext_begin;
+            break;
+        }
+        if ((_path[ext_begin] == '\\') || (_path[ext_begin] == '/') || (_path[ext_begin] == ':'))
+        {
+            ++ext_begin;
+            ext_end = ext_begin;
+            break;
+        }
+    }
+
+    size_t ext_length = ext_end - ext_begin;
+
+    return (ext_found && (ext_length > 1)) ? PathView(_path.substr(ext_begin, ext_length)) : PathView();
+}
+
+} // namespace CppCommon
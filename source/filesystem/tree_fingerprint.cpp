@@ -0,0 +1,354 @@
+/*!
+    \file tree_fingerprint.cpp
+    \brief Filesystem directory tree fingerprint implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/tree_fingerprint.h"
+
+#include "algorithms/hash.h"
+#include "containers/dense_hashmap.h"
+#include "filesystem/directory.h"
+#include "filesystem/exceptions.h"
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "threads/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Cache file format
+const uint32_t FingerprintMagic = 0x46544343;
+const uint32_t FingerprintVersion = 1;
+
+// Files modified closer than the coarsest timestamp granularity (FAT) to the scan are read again
+const uint64_t FingerprintRacyGuard = 2000000000;
+
+// Relative path of the walk entry with '/' separators
+std::string RelativePath(const std::string& root, const DirectoryEntry& entry)
+{
+    const std::string& parent = entry.parent.string();
+    size_t offset = std::min(root.size(), parent.size());
+    while ((offset < parent.size()) && ((parent[offset] == '/') || (parent[offset] == '\\')))
+        ++offset;
+
+    std::string result;
+    result.reserve(parent.size() - offset + 1 + entry.name.size());
+    result.append(parent, offset);
+    if (!result.empty())
+        result.push_back('/');
+    result.append(entry.name);
+
+    if (Path::separator() != '/')
+        std::replace(result.begin(), result.end(), Path::separator(), '/');
+    return result;
+}
+
+// Hash the file content and return the count of read bytes
+uint64_t HashContent(const Path& path, uint64_t size, size_t mapping, uint128_t& hash)
+{
+    if (size == 0)
+    {
+        hash = FastHash::Compute128(nullptr, 0);
+        return 0;
+    }
+
+    // Large files are hashed in place
+    if (size >= mapping)
+    {
+        MappedFile mapped(path);
+        mapped.Advise(MappedFileAdvice::SEQUENTIAL);
+        hash = FastHash::Compute128(mapped.data(), mapped.size());
+        return mapped.size();
+    }
+
+    // Small files are read into the per-thread buffer
+    thread_local std::vector<uint8_t> buffer;
+    buffer.resize((size_t)size);
+
+    File file(path);
+    file.Open(true, false);
+    size_t total = 0;
+    while (total < buffer.size())
+    {
+        size_t read = file.ReadAt(total, buffer.data() + total, buffer.size() - total);
+        if (read == 0)
+            break;
+        total += read;
+    }
+    file.Close();
+
+    hash = FastHash::Compute128(buffer.data(), total);
+    return total;
+}
+
+template <typename T>
+void Append(std::vector<uint8_t>& buffer, const T& value)
+{
+    const uint8_t* ptr = (const uint8_t*)&value;
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+bool Extract(const std::vector<uint8_t>& buffer, size_t& offset, T& value)
+{
+    if ((buffer.size() - offset) < sizeof(T))
+        return false;
+    std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+} // namespace Internals
+//! @endcond
+
+TreeFingerprint::TreeFingerprint() : _scanned(Timestamp(0)), _hashed(0), _reused(0), _bytes(0)
+{
+}
+
+uint128_t TreeFingerprint::hash() const noexcept
+{
+    std::vector<uint8_t> buffer;
+    for (const auto& file : _files)
+    {
+        buffer.insert(buffer.end(), file.path.begin(), file.path.end());
+        buffer.push_back(0);
+        Internals::Append(buffer, file.hash.upper());
+        Internals::Append(buffer, file.hash.lower());
+    }
+    return FastHash::Compute128(buffer.data(), buffer.size());
+}
+
+const FileFingerprint* TreeFingerprint::find(std::string_view path) const noexcept
+{
+    auto it = std::lower_bound(_files.begin(), _files.end(), path, [](const FileFingerprint& file, std::string_view value) { return file.path < value; });
+    return ((it != _files.end()) && (it->path == path)) ? &(*it) : nullptr;
+}
+
+void TreeFingerprint::Scan(const Path& directory, const TreeFingerprintOptions& options)
+{
+    UtcTimestamp scanned;
+    const std::string& root = directory.string();
+
+    // Walk the directory tree and collect regular files with their metadata
+    CriticalSection cs;
+    std::vector<FileFingerprint> files;
+    DirectoryWalkOptions walk;
+    walk.glob = options.glob;
+    walk.symlinks = options.symlinks;
+    walk.status = true;
+    walk.pool = options.pool;
+    walk.concurrency = options.concurrency;
+    Directory(directory).Walk([&](const DirectoryEntry& entry)
+    {
+        if (entry.target != FileType::REGULAR)
+            return true;
+
+        FileFingerprint file;
+        file.path = Internals::RelativePath(root, entry);
+        file.inode = entry.inode;
+        file.size = entry.status->size;
+        file.modified = entry.status->modified;
+
+        Locker<CriticalSection> locker(cs);
+        files.emplace_back(std::move(file));
+        return true;
+    }, walk);
+
+    std::sort(files.begin(), files.end(), [](const FileFingerprint& file1, const FileFingerprint& file2) { return file1.path < file2.path; });
+
+    // Previous files are found by inode (renamed files) or by relative path
+    DenseHashMap<uint64_t, size_t> inodes(_files.size() * 2);
+    for (size_t i = 0; i < _files.size(); ++i)
+        if (_files[i].inode != 0)
+            inodes.emplace(_files[i].inode, i);
+
+    auto cached = [this, &inodes](const FileFingerprint& file) -> const FileFingerprint*
+    {
+        const FileFingerprint* previous = nullptr;
+        if (file.inode != 0)
+        {
+            auto it = inodes.find(file.inode);
+            if (it != inodes.end())
+                previous = &_files[it->second];
+        }
+        else
+            previous = find(file.path);
+
+        if ((previous == nullptr) || (previous->inode != file.inode) || (previous->size != file.size) || (previous->modified != file.modified))
+            return nullptr;
+
+        // File could be changed after it was hashed within the same timestamp tick
+        if ((previous->modified.total() + Internals::FingerprintRacyGuard) >= _scanned.total())
+            return nullptr;
+
+        return previous;
+    };
+
+    std::vector<size_t> changed;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        const FileFingerprint* previous = cached(files[i]);
+        if (previous != nullptr)
+            files[i].hash = previous->hash;
+        else
+            changed.push_back(i);
+    }
+
+    // Hash new and changed files
+    std::atomic<uint64_t> bytes(0);
+    auto hash = [&](size_t index)
+    {
+        FileFingerprint& file = files[changed[index]];
+        uint64_t read = Internals::HashContent(directory / file.path, file.size, options.mapping, file.hash);
+        bytes.fetch_add(read, std::memory_order_relaxed);
+    };
+
+    if (options.pool != nullptr)
+    {
+        ParallelOptions parallel;
+        parallel.grain = 1;
+        parallel.concurrency = options.concurrency;
+        ParallelFor(*options.pool, (size_t)0, changed.size(), hash, parallel);
+    }
+    else
+    {
+        for (size_t i = 0; i < changed.size(); ++i)
+            hash(i);
+    }
+
+    _files = std::move(files);
+    _scanned = scanned;
+    _hashed = changed.size();
+    _reused = _files.size() - changed.size();
+    _bytes = bytes.load(std::memory_order_relaxed);
+}
+
+TreeDifference TreeFingerprint::Compare(const TreeFingerprint& source, const TreeFingerprint& target)
+{
+    TreeDifference result;
+
+    // Merge sorted files of both trees
+    auto it1 = source._files.begin();
+    auto it2 = target._files.begin();
+    while ((it1 != source._files.end()) || (it2 != target._files.end()))
+    {
+        if ((it2 == target._files.end()) || ((it1 != source._files.end()) && (it1->path < it2->path)))
+            result.removed.push_back((it1++)->path);
+        else if ((it1 == source._files.end()) || (it2->path < it1->path))
+            result.created.push_back((it2++)->path);
+        else
+        {
+            if ((it1->size != it2->size) || (it1->hash != it2->hash))
+                result.modified.push_back(it1->path);
+            ++it1;
+            ++it2;
+        }
+    }
+
+    return result;
+}
+
+bool TreeFingerprint::Load(const Path& path)
+{
+    clear();
+
+    if (!path.IsExists())
+        return false;
+
+    std::vector<uint8_t> buffer = File::ReadAllBytes(path);
+
+    size_t offset = 0;
+    uint32_t magic;
+    uint32_t version;
+    uint64_t scanned;
+    uint64_t count;
+    if (!Internals::Extract(buffer, offset, magic) || (magic != Internals::FingerprintMagic) ||
+        !Internals::Extract(buffer, offset, version) || (version != Internals::FingerprintVersion) ||
+        !Internals::Extract(buffer, offset, scanned) || !Internals::Extract(buffer, offset, count))
+        return false;
+
+    std::vector<FileFingerprint> files;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        FileFingerprint file;
+        uint32_t size;
+        uint64_t modified;
+        uint64_t upper;
+        uint64_t lower;
+        if (!Internals::Extract(buffer, offset, size) || ((buffer.size() - offset) < size))
+            return false;
+        file.path.assign((const char*)buffer.data() + offset, size);
+        offset += size;
+        if (!Internals::Extract(buffer, offset, file.inode) || !Internals::Extract(buffer, offset, file.size) ||
+            !Internals::Extract(buffer, offset, modified) || !Internals::Extract(buffer, offset, upper) || !Internals::Extract(buffer, offset, lower))
+            return false;
+        file.modified = UtcTimestamp(Timestamp(modified));
+        file.hash = uint128_t(upper, lower);
+
+        // Files must be sorted by their relative paths
+        if (!files.empty() && !(files.back().path < file.path))
+            return false;
+
+        files.emplace_back(std::move(file));
+    }
+
+    _files = std::move(files);
+    _scanned = UtcTimestamp(Timestamp(scanned));
+    return true;
+}
+
+void TreeFingerprint::Save(const Path& path) const
+{
+    std::vector<uint8_t> buffer;
+    Internals::Append(buffer, Internals::FingerprintMagic);
+    Internals::Append(buffer, Internals::FingerprintVersion);
+    Internals::Append(buffer, _scanned.total());
+    Internals::Append(buffer, (uint64_t)_files.size());
+    for (const auto& file : _files)
+    {
+        Internals::Append(buffer, (uint32_t)file.path.size());
+        buffer.insert(buffer.end(), file.path.begin(), file.path.end());
+        Internals::Append(buffer, file.inode);
+        Internals::Append(buffer, file.size);
+        Internals::Append(buffer, file.modified.total());
+        Internals::Append(buffer, file.hash.upper());
+        Internals::Append(buffer, file.hash.lower());
+    }
+
+    // Replace the previous cache file atomically
+    Path temp = path + ".tmp";
+    File::WriteAllBytes(temp, buffer.data(), buffer.size());
+    Path::Rename(temp, path);
+}
+
+void TreeFingerprint::clear() noexcept
+{
+    _files.clear();
+    _scanned = UtcTimestamp(Timestamp(0));
+    _hashed = 0;
+    _reused = 0;
+    _bytes = 0;
+}
+
+void TreeFingerprint::swap(TreeFingerprint& fingerprint) noexcept
+{
+    using std::swap;
+    swap(_files, fingerprint._files);
+    swap(_scanned, fingerprint._scanned);
+    swap(_hashed, fingerprint._hashed);
+    swap(_reused, fingerprint._reused);
+    swap(_bytes, fingerprint._bytes);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,155 @@
+/*!
+    \file decimal.cpp
+    \brief Fixed-point decimal type implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "math/decimal.h"
+
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Two digits lookup table
+const char Digits[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+size_t DecimalFormat(int64_t value, unsigned scale, char* buffer, size_t size) noexcept
+{
+    // Write digits backward from the end of the temporary buffer
+    char digits[32];
+    char* end = digits + sizeof(digits);
+    char* ptr = end;
+
+    uint64_t abs_value = (value < 0) ? (0 - (uint64_t)value) : (uint64_t)value;
+
+    // Fractional digits
+    if (scale > 0)
+    {
+        unsigned count = scale;
+        for (; count >= 2; count -= 2)
+        {
+            ptr -= 2;
+            std::memcpy(ptr, Digits + (abs_value % 100) * 2, 2);
+            abs_value /= 100;
+        }
+        if (count > 0)
+        {
+            *--ptr = (char)('0' + (abs_value % 10));
+            abs_value /= 10;
+        }
+        *--ptr = '.';
+    }
+
+    // Integer digits
+    while (abs_value >= 100)
+    {
+        ptr -= 2;
+        std::memcpy(ptr, Digits + (abs_value % 100) * 2, 2);
+        abs_value /= 100;
+    }
+    if (abs_value >= 10)
+    {
+        ptr -= 2;
+        std::memcpy(ptr, Digits + abs_value * 2, 2);
+    }
+    else
+        *--ptr = (char)('0' + abs_value);
+
+    if (value < 0)
+        *--ptr = '-';
+
+    const size_t length = end - ptr;
+    if (length > size)
+        return 0;
+
+    std::memcpy(buffer, ptr, length);
+    return length;
+}
+
+bool DecimalParse(std::string_view str, unsigned scale, int64_t& value) noexcept
+{
+    // Any value with more than 18 significant digits overflows after the next digit
+    const uint64_t threshold = 1000000000000000000ull;
+
+    size_t index = 0;
+    const size_t size = str.size();
+
+    bool negative = false;
+    if ((index < size) && ((str[index] == '-') || (str[index] == '+')))
+        negative = (str[index++] == '-');
+
+    uint64_t abs_value = 0;
+    size_t digits = 0;
+
+    // Integer digits
+    for (; (index < size) && (str[index] >= '0') && (str[index] <= '9'); ++index, ++digits)
+    {
+        if (abs_value >= threshold)
+            return false;
+        abs_value = abs_value * 10 + (str[index] - '0');
+    }
+
+    // Fractional digits
+    unsigned fraction = 0;
+    bool round = false;
+    if ((index < size) && (str[index] == '.'))
+    {
+        for (++index; (index < size) && (str[index] >= '0') && (str[index] <= '9'); ++index, ++digits)
+        {
+            if (fraction < scale)
+            {
+                if (abs_value >= threshold)
+                    return false;
+                abs_value = abs_value * 10 + (str[index] - '0');
+                ++fraction;
+            }
+            else if (fraction == scale)
+            {
+                // Only the first extra digit decides the rounding half away from zero
+                round = (str[index] >= '5');
+                ++fraction;
+            }
+        }
+    }
+
+    if ((index != size) || (digits == 0))
+        return false;
+
+    // Scale the value with missing fractional digits
+    for (; fraction < scale; ++fraction)
+    {
+        if (abs_value >= threshold)
+            return false;
+        abs_value *= 10;
+    }
+
+    if (round)
+        ++abs_value;
+
+    const uint64_t limit = negative ? 0x8000000000000000ull : 0x7FFFFFFFFFFFFFFFull;
+    if (abs_value > limit)
+        return false;
+
+    value = negative ? (int64_t)(0 - abs_value) : (int64_t)abs_value;
+    return true;
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
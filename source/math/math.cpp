@@ -8,304 +8,497 @@
 
 #include "math/math.h"
 
-#if defined(_MSC_VER)
-#include <intrin.h>
+#include "system/cpu_dispatch.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
 #endif
 
 namespace CppCommon {
 
-uint64_t Math::MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider)
+//! @cond INTERNALS
+namespace Internals {
+
+int64_t SumScalar(const int64_t* values, size_t size)
 {
-#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
-    __uint128_t a = operant;
-    __uint128_t b = multiplier;
-    __uint128_t c = divider;
-
-    return (uint64_t)(a * b / c);
-#elif defined(_MSC_VER)
-#if defined(_M_IX86)
-    // Declare 128bit storage
-    struct
+    // Unsigned accumulators wrap around on overflow
+    uint64_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
     {
-        unsigned long DW[4];
-    } var128, quotient;
+        sum0 += (uint64_t)values[i + 0];
+        sum1 += (uint64_t)values[i + 1];
+        sum2 += (uint64_t)values[i + 2];
+        sum3 += (uint64_t)values[i + 3];
+    }
+    for (; i < size; ++i)
+        sum0 += (uint64_t)values[i];
 
-    // Change semantics for intermediate results for Full Div by renaming the vars
-    #define REMAINDER quotient
-    #define QUOTIENT edi
+    return (int64_t)(sum0 + sum1 + sum2 + sum3);
+}
+
+double SumScalar(const double* values, size_t size)
+{
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
 
-    // Save combined sign on stack
-    _asm
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
     {
-        mov     eax, dword ptr[operant+4]
-        xor     eax, dword ptr[multiplier+4]
-        xor     eax, dword ptr[divider+4]
-        pushfd
+        sum0 += values[i + 0];
+        sum1 += values[i + 1];
+        sum2 += values[i + 2];
+        sum3 += values[i + 3];
     }
+    for (; i < size; ++i)
+        sum0 += values[i];
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
 
-    _asm
+template <typename T>
+std::pair<T, T> MinMaxScalar(const T* values, size_t size)
+{
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::lowest();
+
+    for (size_t i = 0; i < size; ++i)
     {
-        // First check divider for 0
-        mov     eax, dword ptr[divider+4]
-        or      eax, dword ptr[divider]
-        jnz     dividerOK
-        div     eax
-dividerOK:
-        lea     edi,[var128]                    // edi = &var128
-        // Check multiplier for 1 or 0
-        xor     eax, eax
-        cmp     eax, dword ptr[multiplier+4]
-        jnz     startMUL
-        cmp     eax, dword ptr[multiplier]
-        jnz     multiNotNUL
-        xor     edx, edx
-        popfd                                   // cleanup stack
-        jmp     done
-multiNotNUL:
-        // Set result HI part to 0
-        xor     eax,eax
-        mov     dword ptr[edi+12], eax
-        mov     dword ptr[edi+8], eax
-        mov     eax, 1
-        cmp     eax, dword ptr[multiplier]
-        jnz     smallMUL
-        // Multiplier is 1 so just copy operant to result
-        mov     eax, dword ptr[operant+4]
-        mov     dword ptr[edi+4], eax
-        mov     eax, dword ptr[operant]
-        mov     dword ptr[edi], eax
-        jmp     startDIV
-smallMUL:
-        // Test for 32/32 bit multiplication
-        xor     eax, eax
-        mov     ecx, dword ptr[operant+4]
-        or      ecx, eax         ;test for both hiwords zero.
-        jnz     startMUL
-        // Do 32/32 bit multiplication
-        mov     ecx, dword ptr[multiplier]
-        mov     eax, dword ptr[operant]
-        mul     ecx
-        mov     dword ptr[edi+4], edx
-        mov     dword ptr[edi], eax
-        jmp     startDIV
-startMUL:
-        // Check signs
-        // Multiply: var128 = operant * multiplier
-        mov     eax, dword ptr[multiplier]      // eax = LO(multiplier)
-        mul     dword ptr[operant]              // edx:eax = eax * LO(operant)
-        mov     dword ptr[edi], eax             // var128.DW0 = eax
-        mov     ecx, edx                        // ecx = edx
-
-        mov     eax, dword ptr[multiplier]      // eax = LO(multiplier)
-        mul     dword ptr[operant+4]            // edx:eax = eax * HI(operant)
-        add     eax, ecx                        // eax = eax + ecx
-        adc     edx, 0                          // edx = edx + 0 + carry
-        mov     ebx, eax
-        mov     ecx, edx
-
-        mov     eax, dword ptr[multiplier+4]
-        mul     dword ptr[operant]
-        add     eax, ebx
-        mov     dword ptr[edi+4], eax
-        adc     ecx, edx
-        pushfd
-
-        mov     eax, dword ptr[multiplier+4]
-        mul     dword ptr[operant+4]
-        popfd
-        adc     eax, ecx
-        adc     edx, 0
-        mov     dword ptr[edi+8], eax
-        mov     dword ptr[edi+12], edx
-startDIV:
-        // Divide: var128 = var128 / divider
-        //
-        // Test divider = 32bit value
-        mov     eax, dword ptr[divider+4]
-        cmp     eax, 0
-        jnz     fullDIV
-        mov     ecx, dword ptr[divider]
-        cmp     ecx, 1
-        jz      applySign
-
-        // Start 128/32 bit division
-        mov     eax, dword ptr[edi+12]
-        xor     edx, edx
-        div     ecx
-        mov     dword ptr[quotient+12], eax
-
-        mov     eax, dword ptr[edi+8]
-        div     ecx
-        mov     dword ptr[quotient+8], eax
-
-        mov     eax, dword ptr[edi+4]
-        div     ecx
-        mov     dword ptr[quotient+4], eax
-
-        mov     eax, dword ptr[edi]
-        div     ecx
-        mov     dword ptr[quotient], eax
-
-        // Copy the quotient to the result storage (var128)
-        mov     eax, dword ptr[quotient+12]
-        mov     dword ptr[edi+12], eax
-        mov     eax, dword ptr[quotient+8]
-        mov     dword ptr[edi+8], eax
-        mov     eax, dword ptr[quotient+4]
-        mov     dword ptr[edi+4], eax
-        mov     eax, dword ptr[quotient]
-        mov     dword ptr[edi], eax
-        // To sign correction and return
-        jmp     applySign
-
-fullDIV:
-        // Full 128/64 bit division
-        xor     eax, eax
-        mov     dword ptr[REMAINDER+12], eax
-        mov     dword ptr[REMAINDER+8], eax
-        mov     dword ptr[REMAINDER+4], eax
-        mov     dword ptr[REMAINDER], eax
-
-        mov     ecx, 128
-loop1:
-        // Compute REMAINDER:QUOTIENT = REMAINDER:QUOTIENT shl 1
-        shl     dword ptr[QUOTIENT], 1
-        rcl     dword ptr[QUOTIENT+4], 1
-        rcl     dword ptr[QUOTIENT+8], 1
-        rcl     dword ptr[QUOTIENT+12], 1
-        rcl     dword ptr[REMAINDER], 1
-        rcl     dword ptr[REMAINDER+4], 1
-        rcl     dword ptr[REMAINDER+8], 1
-        rcl     dword ptr[REMAINDER+12], 1
-
-        // Test (REMAINDER >= Divider)
-        xor     eax, eax
-        cmp     dword ptr[REMAINDER+12], eax
-        ja      iftrue
-        jb      iffalse
-
-        cmp     dword ptr[REMAINDER+8], eax
-        ja      iftrue
-        jb      iffalse
-
-        mov     eax, dword ptr[REMAINDER+4]
-        cmp     eax, dword ptr[divider+4]
-        ja      iftrue
-        jb      iffalse
-
-        mov     eax, dword ptr[REMAINDER]
-        cmp     eax, dword ptr[divider]
-        jb      iffalse
-iftrue:
-        // Remainder = remainder - divider
-        mov     eax, dword ptr[divider]
-        sub     dword ptr[REMAINDER], eax
-        mov     eax, dword ptr[divider+4]
-        sbb     dword ptr[REMAINDER+4], eax
-        xor     eax, eax
-        sbb     dword ptr[REMAINDER+8], eax
-        sbb     dword ptr[REMAINDER+12], eax
-        // Quotient = quotient +1
-        add     dword ptr[QUOTIENT], 1
-        adc     dword ptr[QUOTIENT+4], 0
-        adc     dword ptr[QUOTIENT+8], 0
-        adc     dword ptr[QUOTIENT+12], 0
-iffalse:
-        // Loop size = 101 bytes, is less than 127 so loop is possible
-        loop    loop1
-
-applySign:
-        // Correct the sign of the result based on the stored combined sign
-        popfd
-        jns     storeRes
-        not     dword ptr[edi+12]
-        not     dword ptr[edi+ 8]
-        not     dword ptr[edi+ 4]
-        not     dword ptr[edi]
-        add     dword ptr[edi], 1
-        adc     dword ptr[edi+ 4], 0
-        adc     dword ptr[edi+ 8], 0
-        adc     dword ptr[edi+12], 0
-
-storeRES:
-        // Get low order qword from var128
-        mov     edx, dword ptr[edi+4]
-        mov     eax, dword ptr[edi]
-done:
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
     }
-    // result is returned in edx:eax
-#elif defined (_M_X64 )
-#pragma warning(push)
-#pragma warning(disable: 4244) // C4244: 'conversion' conversion from 'type1' to 'type2', possible loss of data
-    uint64_t a = operant;
-    uint64_t b = multiplier;
-    uint64_t c = divider;
-
-    //  Normalize divisor
-    unsigned long shift;
-    _BitScanReverse64(&shift, c);
-    shift = 63 - shift;
-
-    c <<= shift;
-
-    // Multiply
-    a = _umul128(a, b, &b);
-    if (((b << shift) >> shift) != b)
+
+    return std::make_pair(min, max);
+}
+
+int64_t DotScalar(const int64_t* values1, const int64_t* values2, size_t size)
+{
+    // Unsigned accumulators wrap around on overflow
+    uint64_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
     {
-        // Overflow
-        return 0xFFFFFFFFFFFFFFFF;
+        sum0 += (uint64_t)values1[i + 0] * (uint64_t)values2[i + 0];
+        sum1 += (uint64_t)values1[i + 1] * (uint64_t)values2[i + 1];
+        sum2 += (uint64_t)values1[i + 2] * (uint64_t)values2[i + 2];
+        sum3 += (uint64_t)values1[i + 3] * (uint64_t)values2[i + 3];
     }
-    b = __shiftleft128(a, b, shift);
-    a <<= shift;
-
-    uint32_t div;
-    uint32_t q0, q1;
-    uint64_t t0, t1;
-
-    // 1st Reduction
-    div = (uint32_t)(c >> 32);
-    t0 = b / div;
-    if (t0 > 0xFFFFFFFF)
-        t0 = 0xFFFFFFFF;
-    q1 = (uint32_t)t0;
-    while (1)
+    for (; i < size; ++i)
+        sum0 += (uint64_t)values1[i] * (uint64_t)values2[i];
+
+    return (int64_t)(sum0 + sum1 + sum2 + sum3);
+}
+
+double DotScalar(const double* values1, const double* values2, size_t size)
+{
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
     {
-        t0 = _umul128(c, (uint64_t)q1 << 32, &t1);
-        if (t1 < b || (t1 == b && t0 <= a))
-            break;
-        q1--;
+        sum0 += values1[i + 0] * values2[i + 0];
+        sum1 += values1[i + 1] * values2[i + 1];
+        sum2 += values1[i + 2] * values2[i + 2];
+        sum3 += values1[i + 3] * values2[i + 3];
     }
-    b -= t1;
-    if (t0 > a)
-        b--;
-    a -= t0;
+    for (; i < size; ++i)
+        sum0 += values1[i] * values2[i];
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
 
-    if (b > 0xFFFFFFFF)
+CPU_TARGET("avx2")
+int64_t SumAVX2(const int64_t* values, size_t size)
+{
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; (i + 8) <= size; i += 8)
     {
-        // Overflow
-        return 0xFFFFFFFFFFFFFFFF;
+        sum0 = _mm256_add_epi64(sum0, _mm256_loadu_si256((const __m256i*)(values + i)));
+        sum1 = _mm256_add_epi64(sum1, _mm256_loadu_si256((const __m256i*)(values + i + 4)));
     }
 
-    // 2nd reduction
-    t0 = ((b << 32) | (a >> 32)) / div;
-    if (t0 > 0xFFFFFFFF)
-        t0 = 0xFFFFFFFF;
-    q0 = (uint32_t)t0;
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, _mm256_add_epi64(sum0, sum1));
+    uint64_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < size; ++i)
+        sum += (uint64_t)values[i];
+
+    return (int64_t)sum;
+}
+
+CPU_TARGET("avx2")
+double SumAVX2(const double* values, size_t size)
+{
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(values + i));
+        sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(values + i + 4));
+        sum2 = _mm256_add_pd(sum2, _mm256_loadu_pd(values + i + 8));
+        sum3 = _mm256_add_pd(sum3, _mm256_loadu_pd(values + i + 12));
+    }
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(_mm256_add_pd(sum0, sum1), _mm256_add_pd(sum2, sum3)));
+    double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < size; ++i)
+        sum += values[i];
+
+    return sum;
+}
+
+CPU_TARGET("avx2")
+std::pair<int64_t, int64_t> MinMaxAVX2(const int64_t* values, size_t size)
+{
+    __m256i min = _mm256_set1_epi64x(std::numeric_limits<int64_t>::max());
+    __m256i max = _mm256_set1_epi64x(std::numeric_limits<int64_t>::lowest());
 
-    while (1)
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
     {
-        t0 = _umul128(c, q0, &t1);
-        if (t1 < b || (t1 == b && t0 <= a))
-            break;
-        q0--;
+        __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+        min = _mm256_blendv_epi8(min, v, _mm256_cmpgt_epi64(min, v));
+        max = _mm256_blendv_epi8(max, v, _mm256_cmpgt_epi64(v, max));
     }
 
-    return ((uint64_t)q1 << 32) | q0;
-#pragma warning(pop)
+    alignas(32) int64_t mins[4];
+    alignas(32) int64_t maxs[4];
+    _mm256_store_si256((__m256i*)mins, min);
+    _mm256_store_si256((__m256i*)maxs, max);
+    auto result = MinMaxScalar(values + i, size - i);
+    for (size_t j = 0; j < 4; ++j)
+    {
+        result.first = std::min(result.first, mins[j]);
+        result.second = std::max(result.second, maxs[j]);
+    }
+
+    return result;
+}
+
+CPU_TARGET("avx2")
+std::pair<double, double> MinMaxAVX2(const double* values, size_t size)
+{
+    __m256d min = _mm256_set1_pd(std::numeric_limits<double>::max());
+    __m256d max = _mm256_set1_pd(std::numeric_limits<double>::lowest());
+
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
+    {
+        __m256d v = _mm256_loadu_pd(values + i);
+        min = _mm256_min_pd(min, v);
+        max = _mm256_max_pd(max, v);
+    }
+
+    alignas(32) double mins[4];
+    alignas(32) double maxs[4];
+    _mm256_store_pd(mins, min);
+    _mm256_store_pd(maxs, max);
+    auto result = MinMaxScalar(values + i, size - i);
+    for (size_t j = 0; j < 4; ++j)
+    {
+        result.first = std::min(result.first, mins[j]);
+        result.second = std::max(result.second, maxs[j]);
+    }
+
+    return result;
+}
+
+CPU_TARGET("avx2,fma")
+double DotAVX2(const double* values1, const double* values2, size_t size)
+{
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(values1 + i), _mm256_loadu_pd(values2 + i), sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(values1 + i + 4), _mm256_loadu_pd(values2 + i + 4), sum1);
+        sum2 = _mm256_fmadd_pd(_mm256_loadu_pd(values1 + i + 8), _mm256_loadu_pd(values2 + i + 8), sum2);
+        sum3 = _mm256_fmadd_pd(_mm256_loadu_pd(values1 + i + 12), _mm256_loadu_pd(values2 + i + 12), sum3);
+    }
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(_mm256_add_pd(sum0, sum1), _mm256_add_pd(sum2, sum3)));
+    double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < size; ++i)
+        sum += values1[i] * values2[i];
+
+    return sum;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+int64_t SumNEON(const int64_t* values, size_t size)
+{
+    uint64x2_t sum0 = vdupq_n_u64(0);
+    uint64x2_t sum1 = vdupq_n_u64(0);
+
+    size_t i = 0;
+    for (; (i + 4) <= size; i += 4)
+    {
+        sum0 = vaddq_u64(sum0, vld1q_u64((const uint64_t*)(values + i)));
+        sum1 = vaddq_u64(sum1, vld1q_u64((const uint64_t*)(values + i + 2)));
+    }
+
+    uint64_t sum = vaddvq_u64(vaddq_u64(sum0, sum1));
+    for (; i < size; ++i)
+        sum += (uint64_t)values[i];
+
+    return (int64_t)sum;
+}
+
+double SumNEON(const double* values, size_t size)
+{
+    float64x2_t sum0 = vdupq_n_f64(0.0);
+    float64x2_t sum1 = vdupq_n_f64(0.0);
+    float64x2_t sum2 = vdupq_n_f64(0.0);
+    float64x2_t sum3 = vdupq_n_f64(0.0);
+
+    size_t i = 0;
+    for (; (i + 8) <= size; i += 8)
+    {
+        sum0 = vaddq_f64(sum0, vld1q_f64(values + i));
+        sum1 = vaddq_f64(sum1, vld1q_f64(values + i + 2));
+        sum2 = vaddq_f64(sum2, vld1q_f64(values + i + 4));
+        sum3 = vaddq_f64(sum3, vld1q_f64(values + i + 6));
+    }
+
+    double sum = vaddvq_f64(vaddq_f64(vaddq_f64(sum0, sum1), vaddq_f64(sum2, sum3)));
+    for (; i < size; ++i)
+        sum += values[i];
+
+    return sum;
+}
+
+std::pair<int64_t, int64_t> MinMaxNEON(const int64_t* values, size_t size)
+{
+    int64x2_t min = vdupq_n_s64(std::numeric_limits<int64_t>::max());
+    int64x2_t max = vdupq_n_s64(std::numeric_limits<int64_t>::lowest());
+
+    size_t i = 0;
+    for (; (i + 2) <= size; i += 2)
+    {
+        int64x2_t v = vld1q_s64(values + i);
+        min = vbslq_s64(vcgtq_s64(min, v), v, min);
+        max = vbslq_s64(vcgtq_s64(v, max), v, max);
+    }
+
+    auto result = MinMaxScalar(values + i, size - i);
+    result.first = std::min({ result.first, vgetq_lane_s64(min, 0), vgetq_lane_s64(min, 1) });
+    result.second = std::max({ result.second, vgetq_lane_s64(max, 0), vgetq_lane_s64(max, 1) });
+    return result;
+}
+
+std::pair<double, double> MinMaxNEON(const double* values, size_t size)
+{
+    float64x2_t min = vdupq_n_f64(std::numeric_limits<double>::max());
+    float64x2_t max = vdupq_n_f64(std::numeric_limits<double>::lowest());
+
+    size_t i = 0;
+    for (; (i + 2) <= size; i += 2)
+    {
+        float64x2_t v = vld1q_f64(values + i);
+        min = vminq_f64(min, v);
+        max = vmaxq_f64(max, v);
+    }
+
+    auto result = MinMaxScalar(values + i, size - i);
+    result.first = std::min(result.first, vminvq_f64(min));
+    result.second = std::max(result.second, vmaxvq_f64(max));
+    return result;
+}
+
+double DotNEON(const double* values1, const double* values2, size_t size)
+{
+    float64x2_t sum0 = vdupq_n_f64(0.0);
+    float64x2_t sum1 = vdupq_n_f64(0.0);
+    float64x2_t sum2 = vdupq_n_f64(0.0);
+    float64x2_t sum3 = vdupq_n_f64(0.0);
+
+    size_t i = 0;
+    for (; (i + 8) <= size; i += 8)
+    {
+        sum0 = vfmaq_f64(sum0, vld1q_f64(values1 + i), vld1q_f64(values2 + i));
+        sum1 = vfmaq_f64(sum1, vld1q_f64(values1 + i + 2), vld1q_f64(values2 + i + 2));
+        sum2 = vfmaq_f64(sum2, vld1q_f64(values1 + i + 4), vld1q_f64(values2 + i + 4));
+        sum3 = vfmaq_f64(sum3, vld1q_f64(values1 + i + 6), vld1q_f64(values2 + i + 6));
+    }
+
+    double sum = vaddvq_f64(vaddq_f64(vaddq_f64(sum0, sum1), vaddq_f64(sum2, sum3)));
+    for (; i < size; ++i)
+        sum += values1[i] * values2[i];
+
+    return sum;
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+bool Math::MulDivRound64(std::span<const uint64_t> values, uint64_t multiplier, uint64_t divider, std::span<uint64_t> result) noexcept
+{
+    assert((values.size() == result.size()) && "Values and result spans must have the same size!");
+    assert((divider != 0) && "Divider must not be zero!");
+
+    // There is no vectorized 128/64-bit division, so the loop keeps a single
+    // divide per element and accumulates overflow flags without branches
+    bool success = true;
+    const size_t size = std::min(values.size(), result.size());
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint64_t value = 0;
+        bool fit = MulDivRound64(values[i], multiplier, divider, value);
+        result[i] = fit ? value : std::numeric_limits<uint64_t>::max();
+        success &= fit;
+    }
+
+    return success;
+}
+
+int64_t Math::Sum(std::span<const int64_t> values) noexcept
+{
+    static CPUDispatch<int64_t(const int64_t*, size_t)> sum([]([[maybe_unused]] const CPUFeatures& features)
+    {
+        int64_t (*function)(const int64_t*, size_t) = Internals::SumScalar;
+#if defined(__x86_64__) || defined(_M_X64)
+        if (features.avx2)
+            function = Internals::SumAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        if (features.neon)
+            function = Internals::SumNEON;
+#endif
+        return function;
+    });
+
+    return sum(values.data(), values.size());
+}
+
+double Math::Sum(std::span<const double> values) noexcept
+{
+    static CPUDispatch<double(const double*, size_t)> sum([]([[maybe_unused]] const CPUFeatures& features)
+    {
+        double (*function)(const double*, size_t) = Internals::SumScalar;
+#if defined(__x86_64__) || defined(_M_X64)
+        if (features.avx2)
+            function = Internals::SumAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        if (features.neon)
+            function = Internals::SumNEON;
+#endif
+        return function;
+    });
+
+    return sum(values.data(), values.size());
+}
+
+std::pair<int64_t, int64_t> Math::MinMax(std::span<const int64_t> values) noexcept
+{
+    static CPUDispatch<std::pair<int64_t, int64_t>(const int64_t*, size_t)> minmax([]([[maybe_unused]] const CPUFeatures& features)
+    {
+        std::pair<int64_t, int64_t> (*function)(const int64_t*, size_t) = Internals::MinMaxScalar<int64_t>;
+#if defined(__x86_64__) || defined(_M_X64)
+        if (features.avx2)
+            function = Internals::MinMaxAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        if (features.neon)
+            function = Internals::MinMaxNEON;
 #endif
-#else
-    #error MulDiv64 is no supported!
+        return function;
+    });
+
+    return minmax(values.data(), values.size());
+}
+
+std::pair<double, double> Math::MinMax(std::span<const double> values) noexcept
+{
+    static CPUDispatch<std::pair<double, double>(const double*, size_t)> minmax([]([[maybe_unused]] const CPUFeatures& features)
+    {
+        std::pair<double, double> (*function)(const double*, size_t) = Internals::MinMaxScalar<double>;
+#if defined(__x86_64__) || defined(_M_X64)
+        if (features.avx2)
+            function = Internals::MinMaxAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        if (features.neon)
+            function = Internals::MinMaxNEON;
+#endif
+        return function;
+    });
+
+    return minmax(values.data(), values.size());
+}
+
+int64_t Math::Dot(std::span<const int64_t> values1, std::span<const int64_t> values2) noexcept
+{
+    assert((values1.size() == values2.size()) && "Values spans must have the same size!");
+
+    // AVX2 and NEON have no 64-bit integer multiply, so the scalar kernel is used
+    return Internals::DotScalar(values1.data(), values2.data(), std::min(values1.size(), values2.size()));
+}
+
+double Math::Dot(std::span<const double> values1, std::span<const double> values2) noexcept
+{
+    assert((values1.size() == values2.size()) && "Values spans must have the same size!");
+
+    static CPUDispatch<double(const double*, const double*, size_t)> dot([]([[maybe_unused]] const CPUFeatures& features)
+    {
+        double (*function)(const double*, const double*, size_t) = Internals::DotScalar;
+#if defined(__x86_64__) || defined(_M_X64)
+        if (features.avx2 && features.fma)
+            function = Internals::DotAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        if (features.neon)
+            function = Internals::DotNEON;
 #endif
+        return function;
+    });
+
+    return dot(values1.data(), values2.data(), std::min(values1.size(), values2.size()));
+}
+
+void Math::PrefixSum(std::span<const int64_t> values, std::span<int64_t> result) noexcept
+{
+    assert((values.size() == result.size()) && "Values and result spans must have the same size!");
+
+    // Prefix sum is a sequential dependency chain, so the scalar loop is already bound by the addition latency
+    uint64_t sum = 0;
+    const size_t size = std::min(values.size(), result.size());
+    for (size_t i = 0; i < size; ++i)
+    {
+        sum += (uint64_t)values[i];
+        result[i] = (int64_t)sum;
+    }
+}
+
+void Math::PrefixSum(std::span<const double> values, std::span<double> result) noexcept
+{
+    assert((values.size() == result.size()) && "Values and result spans must have the same size!");
+
+    double sum = 0.0;
+    const size_t size = std::min(values.size(), result.size());
+    for (size_t i = 0; i < size; ++i)
+    {
+        sum += values[i];
+        result[i] = sum;
+    }
 }
 
 } // namespace CppCommon
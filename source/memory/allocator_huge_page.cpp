@@ -0,0 +1,242 @@
+/*!
+    \file allocator_huge_page.cpp
+    \brief Huge page memory allocator implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_huge_page.h"
+
+#if defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__)
+
+// Constants of <numaif.h> to avoid the dependency from libnuma
+const int MPOL_BIND_MODE = 2;
+const unsigned MPOL_MF_MOVE_FLAG = (1 << 1);
+
+bool BindNumaNode(void* ptr, size_t size, int node)
+{
+#if defined(SYS_mbind) && !defined(__APPLE__)
+    const size_t bits = 8 * sizeof(unsigned long);
+    unsigned long mask[1024 / bits] = { 0 };
+    if ((node < 0) || (node >= 1024))
+        return false;
+    mask[node / bits] |= 1ul << (node % bits);
+    return syscall(SYS_mbind, ptr, size, MPOL_BIND_MODE, mask, 1024 + 1, MPOL_MF_MOVE_FLAG) == 0;
+#else
+    return false;
+#endif
+}
+
+#elif defined(_WIN32) || defined(_WIN64)
+
+bool EnableLockMemoryPrivilege()
+{
+    HANDLE hToken;
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken))
+        return false;
+
+    TOKEN_PRIVILEGES privileges;
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+    bool result = LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                  AdjustTokenPrivileges(hToken, FALSE, &privileges, 0, nullptr, nullptr) &&
+                  (GetLastError() == ERROR_SUCCESS);
+
+    CloseHandle(hToken);
+    return result;
+}
+
+#endif
+
+size_t HugePageRound(size_t size)
+{
+    size_t page = HugePageMemoryManager::HugePageSize();
+    return ((size + page - 1) / page) * page;
+}
+
+} // namespace Internals
+//! @endcond
+
+size_t HugePageMemoryManager::HugePageSize()
+{
+    static size_t page = []()
+    {
+#if defined(__APPLE__)
+        return (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+        // Default huge page size from "/proc/meminfo"
+        size_t result = 0;
+        FILE* file = fopen("/proc/meminfo", "r");
+        if (file != nullptr)
+        {
+            char line[256];
+            while (fgets(line, sizeof(line), file) != nullptr)
+            {
+                unsigned long kb;
+                if (sscanf(line, "Hugepagesize: %lu kB", &kb) == 1)
+                {
+                    result = (size_t)kb * 1024;
+                    break;
+                }
+            }
+            fclose(file);
+        }
+        // Assume 2 MB transparent huge pages
+        return (result > 0) ? result : (size_t)(2 * 1024 * 1024);
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t result = GetLargePageMinimum();
+        if (result == 0)
+        {
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            result = si.dwPageSize;
+        }
+        return result;
+#else
+        #error Unsupported platform
+#endif
+    }();
+    return page;
+}
+
+int HugePageMemoryManager::NumaNodes()
+{
+#if defined(__APPLE__)
+    return 1;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    int result = 0;
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (dir != nullptr)
+    {
+        dirent* entry;
+        while ((entry = readdir(dir)) != nullptr)
+            if ((std::strncmp(entry->d_name, "node", 4) == 0) && (entry->d_name[4] >= '0') && (entry->d_name[4] <= '9'))
+                ++result;
+        closedir(dir);
+    }
+    return (result > 0) ? result : 1;
+#elif defined(_WIN32) || defined(_WIN64)
+    ULONG highest = 0;
+    if (!GetNumaHighestNodeNumber(&highest))
+        return 1;
+    return (int)highest + 1;
+#else
+    #error Unsupported platform
+#endif
+}
+
+void* HugePageMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+    assert((alignment <= HugePageSize()) && "Alignment must not be greater than the huge page size!");
+
+    size_t length = Internals::HugePageRound(size);
+
+#if defined(__APPLE__)
+    void* result = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if (result == MAP_FAILED)
+        return nullptr;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    void* result = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    // Try to map explicit huge pages of the reserved pool
+    result = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (result == MAP_FAILED)
+    {
+        // Map the huge page aligned region for transparent huge pages
+        size_t page = HugePageSize();
+        uint8_t* region = (uint8_t*)mmap(nullptr, length + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED)
+            return nullptr;
+
+        uint8_t* aligned = Memory::Align(region, page);
+        if (aligned > region)
+            munmap(region, aligned - region);
+        if (aligned < (region + page))
+            munmap(aligned + length, region + page - aligned);
+
+#if defined(MADV_HUGEPAGE)
+        madvise(aligned, length, MADV_HUGEPAGE);
+#endif
+        result = aligned;
+    }
+
+    // Bind pages to the NUMA node before the first touch
+    if (_node >= 0)
+        Internals::BindNumaNode(result, length, _node);
+#elif defined(_WIN32) || defined(_WIN64)
+    static bool privilege = Internals::EnableLockMemoryPrivilege();
+
+    void* result = nullptr;
+    if (privilege && (GetLargePageMinimum() > 0))
+    {
+        if (_node >= 0)
+            result = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, (DWORD)_node);
+        else
+            result = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+    if (result == nullptr)
+    {
+        if (_node >= 0)
+            result = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, (DWORD)_node);
+        else
+            result = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+    if (result == nullptr)
+        return nullptr;
+#endif
+
+    // Update allocation statistics
+    _allocated += size;
+    ++_allocations;
+
+    return result;
+}
+
+void HugePageMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        munmap(ptr, Internals::HugePageRound(size));
+#elif defined(_WIN32) || defined(_WIN64)
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#endif
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+    }
+}
+
+void HugePageMemoryManager::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
@@ -0,0 +1,176 @@
+/*!
+    \file allocator_profiling.cpp
+    \brief Profiling memory allocator implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_profiling.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <sstream>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+uint64_t ProfilerHash(void* const* frames, int size) noexcept
+{
+    // FNV-1a hash of frames addresses
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (int i = 0; i < size; ++i)
+    {
+        hash ^= (uint64_t)(uintptr_t)frames[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+} // namespace Internals
+//! @endcond
+
+AllocationProfiler::AllocationProfiler(size_t rate, size_t depth)
+    : _rate(std::max(rate, (size_t)1)),
+      _depth(std::clamp(depth, (size_t)1, (size_t)256)),
+      _samples(0),
+      _countdown(0),
+      _random(0x2545F4914F6CDD1Dull ^ (uint64_t)(uintptr_t)this),
+      _filter{}
+{
+    _countdown = NextInterval();
+}
+
+size_t AllocationProfiler::NextInterval() noexcept
+{
+    if (_rate == 1)
+        return 0;
+
+    // Xorshift random number generator
+    _random ^= _random << 13;
+    _random ^= _random >> 7;
+    _random ^= _random << 17;
+
+    // Exponentially distributed interval with the mean of sampling rate
+    double uniform = ((_random >> 11) + 1) * (1.0 / 9007199254740993.0);
+    double interval = -std::log(uniform) * (double)_rate;
+    return (interval < 1.0) ? 1 : std::min((size_t)interval, std::numeric_limits<size_t>::max() / 2);
+}
+
+void AllocationProfiler::record(void* ptr, size_t size, int skip)
+{
+    _countdown = NextInterval();
+    ++_samples;
+
+    // Capture callsite frames addresses without symbols resolving
+    void* frames[256];
+    int captured = StackTrace::Capture(frames, (int)_depth, skip + 1);
+
+    // Find or create the callsite. Hash collisions are resolved with the linear probing over hashes.
+    uint64_t hash = Internals::ProfilerHash(frames, captured);
+    size_t index;
+    for (;;)
+    {
+        auto it = _index.find(hash);
+        if (it == _index.end())
+        {
+            index = _callsites.size();
+            _callsites.emplace_back();
+            _callsites[index].frames.assign(frames, frames + captured);
+            _index.emplace(hash, index);
+            break;
+        }
+        const auto& callsite_frames = _callsites[it.value()].frames;
+        if ((callsite_frames.size() == (size_t)captured) && std::equal(callsite_frames.begin(), callsite_frames.end(), frames))
+        {
+            index = it.value();
+            break;
+        }
+        ++hash;
+    }
+
+    // Weight of the sample is the inverse probability of sampling
+    double probability = (_rate == 1) ? 1.0 : -std::expm1(-(double)size / (double)_rate);
+    uint64_t weight = std::max((uint64_t)std::llround(1.0 / probability), (uint64_t)1);
+
+    Callsite& callsite = _callsites[index];
+    callsite.samples += 1;
+    callsite.allocations += weight;
+    callsite.bytes += weight * size;
+    callsite.live_allocations += weight;
+    callsite.live_bytes += weight * size;
+    callsite.histogram[std::min((size_t)std::bit_width(size - 1), HISTOGRAM - 1)] += weight;
+
+    // Track the sampled allocation until free
+    auto result = _tracked.emplace((uintptr_t)ptr, Tracked{ index, size, weight });
+    if (result.second)
+        ++_filter[Filter(ptr)];
+    else
+        result.first.value() = Tracked{ index, size, weight };
+}
+
+bool AllocationProfiler::release(void* ptr)
+{
+    auto it = _tracked.find((uintptr_t)ptr);
+    if (it == _tracked.end())
+        return false;
+
+    Tracked tracked = it.value();
+    _tracked.erase(it);
+    --_filter[Filter(ptr)];
+
+    Callsite& callsite = _callsites[tracked.callsite];
+    callsite.live_allocations -= tracked.weight;
+    callsite.live_bytes -= tracked.weight * tracked.size;
+    return true;
+}
+
+std::vector<AllocationProfiler::Callsite> AllocationProfiler::callsites() const
+{
+    std::vector<Callsite> result(_callsites);
+    std::stable_sort(result.begin(), result.end(), [](const Callsite& c1, const Callsite& c2)
+    {
+        if (c1.live_bytes != c2.live_bytes)
+            return c1.live_bytes > c2.live_bytes;
+        return c1.bytes > c2.bytes;
+    });
+    return result;
+}
+
+std::string AllocationProfiler::report(size_t top) const
+{
+    std::vector<Callsite> sorted = callsites();
+
+    std::stringstream ss;
+    ss << "Allocation profile: sampling rate " << _rate << " bytes, " << _samples << " samples, " << sorted.size() << " callsites" << std::endl;
+    for (size_t i = 0; (i < top) && (i < sorted.size()); ++i)
+    {
+        const Callsite& callsite = sorted[i];
+        ss << '#' << (i + 1) << " live: " << callsite.live_bytes << " bytes in " << callsite.live_allocations << " allocations";
+        ss << ", total: " << callsite.bytes << " bytes in " << callsite.allocations << " allocations";
+        ss << ", samples: " << callsite.samples << std::endl;
+        ss << "    sizes:";
+        for (size_t j = 0; j < HISTOGRAM; ++j)
+            if (callsite.histogram[j] > 0)
+                ss << " <=" << ((uint64_t)1 << j) << ':' << callsite.histogram[j];
+        ss << std::endl;
+        StackTrace stack = callsite.stack();
+        for (const auto& frame : stack.frames())
+            ss << "    " << frame << std::endl;
+    }
+    return ss.str();
+}
+
+void AllocationProfiler::clear()
+{
+    _samples = 0;
+    _callsites.clear();
+    _index.clear();
+    _tracked.clear();
+    _filter.fill(0);
+}
+
+} // namespace CppCommon
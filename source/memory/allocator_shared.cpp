@@ -0,0 +1,224 @@
+/*!
+    \file allocator_shared.cpp
+    \brief Shared memory allocator implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_shared.h"
+
+#include <thread>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const uint64_t SHARED_HEAP_MAGIC = 0x5041454844524853ull; // "SHRDHEAP"
+const uint64_t SHARED_HEAP_GRANULE = 16;
+const uint64_t SHARED_HEAP_MIN_BLOCK = 32;
+const uint64_t SHARED_HEAP_HEADER = (sizeof(SharedHeap) + 63) & ~(uint64_t)63;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared heap requires lock-free 32-bit atomics!");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared heap requires lock-free 64-bit atomics!");
+
+// Free memory block
+struct SharedFreeBlock
+{
+    uint64_t size;  // Block size including the header
+    uint64_t next;  // Offset of the next free block (0 - the last free block)
+};
+
+// Allocated memory block header placed right before the user memory
+struct SharedUsedBlock
+{
+    uint64_t start; // Offset of the block start
+    uint64_t size;  // Block size including the header and the alignment gap
+};
+
+inline uint64_t SharedAlign(uint64_t value, uint64_t alignment) noexcept
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+SharedHeap* SharedHeap::Attach(void* buffer, size_t capacity)
+{
+    assert((buffer != nullptr) && "Shared memory region must be valid!");
+    if ((capacity < (SHARED_HEAP_HEADER + SHARED_HEAP_MIN_BLOCK)) || !Memory::IsAligned((const uint8_t*)buffer, alignof(SharedHeap)))
+        throwex ArgumentException("Shared memory region is too small or not aligned!");
+
+    SharedHeap* heap = (SharedHeap*)buffer;
+
+    // Format the new shared heap (new shared memory blocks are filled with zeros)
+    uint32_t expected = 0;
+    if (heap->state.compare_exchange_strong(expected, 1, std::memory_order_acq_rel))
+    {
+        uint64_t size = (capacity - SHARED_HEAP_HEADER) & ~(SHARED_HEAP_GRANULE - 1);
+
+        heap->magic = SHARED_HEAP_MAGIC;
+        heap->lock.store(0, std::memory_order_relaxed);
+        heap->capacity = capacity;
+        heap->allocated.store(0, std::memory_order_relaxed);
+        heap->allocations.store(0, std::memory_order_relaxed);
+        heap->available.store(size, std::memory_order_relaxed);
+        heap->root.store(0, std::memory_order_relaxed);
+        heap->head = SHARED_HEAP_HEADER;
+
+        SharedFreeBlock* block = (SharedFreeBlock*)(heap->base() + SHARED_HEAP_HEADER);
+        block->size = size;
+        block->next = 0;
+
+        heap->state.store(2, std::memory_order_release);
+        return heap;
+    }
+
+    if (expected > 2)
+        throwex RuntimeException("Shared memory region does not contain a valid shared heap!");
+
+    // Wait for another process formats the shared heap
+    while (heap->state.load(std::memory_order_acquire) != 2)
+        std::this_thread::yield();
+
+    if (heap->magic != SHARED_HEAP_MAGIC)
+        throwex RuntimeException("Shared memory region does not contain a valid shared heap!");
+    if (heap->capacity > capacity)
+        throwex RuntimeException("Shared memory region is smaller than the shared heap!");
+
+    return heap;
+}
+
+void SharedHeap::lock_heap() noexcept
+{
+    while (lock.exchange(1, std::memory_order_acquire) != 0)
+        while (lock.load(std::memory_order_relaxed) != 0)
+            std::this_thread::yield();
+}
+
+void SharedHeap::unlock_heap() noexcept
+{
+    lock.store(0, std::memory_order_release);
+}
+
+void* SharedHeap::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    if (size > capacity)
+        return nullptr;
+
+    alignment = std::max((uint64_t)alignment, SHARED_HEAP_GRANULE);
+
+    lock_heap();
+
+    // Find the first free block which fits the aligned memory block
+    uint64_t prev = 0;
+    uint64_t current = head;
+    while (current != 0)
+    {
+        SharedFreeBlock* block = (SharedFreeBlock*)(base() + current);
+        uint64_t user = SharedAlign((uint64_t)base() + current + sizeof(SharedUsedBlock), alignment) - (uint64_t)base();
+        uint64_t end = SharedAlign(user + size, SHARED_HEAP_GRANULE);
+        uint64_t limit = current + block->size;
+        if (end <= limit)
+        {
+            // Split the rest of the free block
+            uint64_t next = block->next;
+            if ((limit - end) >= SHARED_HEAP_MIN_BLOCK)
+            {
+                SharedFreeBlock* rest = (SharedFreeBlock*)(base() + end);
+                rest->size = limit - end;
+                rest->next = next;
+                next = end;
+            }
+            else
+                end = limit;
+
+            if (prev == 0)
+                head = next;
+            else
+                ((SharedFreeBlock*)(base() + prev))->next = next;
+
+            SharedUsedBlock* used = (SharedUsedBlock*)(base() + user - sizeof(SharedUsedBlock));
+            used->start = current;
+            used->size = end - current;
+
+            // Update allocation statistics
+            available.fetch_sub(end - current, std::memory_order_relaxed);
+            allocated.fetch_add(size, std::memory_order_relaxed);
+            allocations.fetch_add(1, std::memory_order_relaxed);
+
+            unlock_heap();
+            return base() + user;
+        }
+
+        prev = current;
+        current = block->next;
+    }
+
+    unlock_heap();
+    return nullptr;
+}
+
+void SharedHeap::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        const SharedUsedBlock* used = (const SharedUsedBlock*)((uint8_t*)ptr - sizeof(SharedUsedBlock));
+        uint64_t start = used->start;
+        uint64_t length = used->size;
+
+        lock_heap();
+
+        // Find the position of the block in the free list sorted by offsets
+        uint64_t prev = 0;
+        uint64_t current = head;
+        while ((current != 0) && (current < start))
+        {
+            prev = current;
+            current = ((SharedFreeBlock*)(base() + current))->next;
+        }
+
+        SharedFreeBlock* block = (SharedFreeBlock*)(base() + start);
+        block->size = length;
+        block->next = current;
+
+        // Coalesce with the next free block
+        if ((current != 0) && ((start + length) == current))
+        {
+            SharedFreeBlock* next = (SharedFreeBlock*)(base() + current);
+            block->size += next->size;
+            block->next = next->next;
+        }
+
+        // Coalesce with the previous free block
+        if (prev == 0)
+            head = start;
+        else
+        {
+            SharedFreeBlock* previous = (SharedFreeBlock*)(base() + prev);
+            if ((prev + previous->size) == start)
+            {
+                previous->size += block->size;
+                previous->next = block->next;
+            }
+            else
+                previous->next = start;
+        }
+
+        // Update allocation statistics
+        available.fetch_add(length, std::memory_order_relaxed);
+        allocated.fetch_sub(size, std::memory_order_relaxed);
+        allocations.fetch_sub(1, std::memory_order_relaxed);
+
+        unlock_heap();
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
@@ -19,7 +19,10 @@
 #include <sys/sysctl.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <cstdio>
+#include <sys/mman.h>
 #elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <sys/mman.h>
 #include <sys/sysinfo.h>
 #include <fcntl.h>
 #include <unistd.h>
@@ -28,8 +31,109 @@
 #include <wincrypt.h>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CPPCOMMON_MEMORY_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CPPCOMMON_MEMORY_NEON
+#include <arm_neon.h>
+#endif
+
+#include <atomic>
+
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Keep stores into the memory buffer which is not read anymore
+inline void CompilerBarrier(void* buffer) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r"(buffer) : "memory");
+#else
+    (void)buffer;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+#if defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+// Size of the block zeroed by 'dc zva' instruction (0 if the instruction is prohibited)
+size_t ZeroBlockSize() noexcept
+{
+    static const size_t block = []()
+    {
+        uint64_t dczid;
+        __asm__ __volatile__("mrs %0, dczid_el0" : "=r"(dczid));
+        return ((dczid & 16) != 0) ? (size_t)0 : (size_t)(4 << (dczid & 15));
+    }();
+    return block;
+}
+#endif
+
+void SystemRandomFill(void* buffer, size_t size)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int fd = open("/dev/urandom", O_RDONLY);
+    if (fd < 0)
+        throwex SystemException("Cannot open '/dev/urandom' file for reading!");
+    ssize_t count = read(fd, buffer, size);
+    if (count < 0)
+        throwex SystemException("Cannot read from '/dev/urandom' file!");
+    int result = close(fd);
+    if (result != 0)
+        throwex SystemException("Cannot close '/dev/urandom' file!");
+#elif defined(_WIN32) || defined(_WIN64)
+    char* ptr = (char*)buffer;
+    for(size_t i = 0; i < size; ++i)
+        ptr[i] = rand() % 256;
+#endif
+}
+
+// Four independent xoshiro256++ generators in the structure of arrays layout, so lanes are vectorized by the compiler
+class Xoshiro256x4
+{
+public:
+    static const size_t LANES = 4;
+
+    explicit Xoshiro256x4(const uint64_t seed[4 * LANES]) noexcept
+    {
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t lane = 0; lane < LANES; ++lane)
+                _s[i][lane] = seed[i * LANES + lane];
+
+        // The state of each lane must not be all zeros
+        for (size_t lane = 0; lane < LANES; ++lane)
+            if ((_s[0][lane] | _s[1][lane] | _s[2][lane] | _s[3][lane]) == 0)
+                _s[0][lane] = 0x9E3779B97F4A7C15ull + lane;
+    }
+
+    void next(uint64_t result[LANES]) noexcept
+    {
+        for (size_t lane = 0; lane < LANES; ++lane)
+            result[lane] = rotl(_s[0][lane] + _s[3][lane], 23) + _s[0][lane];
+
+        for (size_t lane = 0; lane < LANES; ++lane)
+        {
+            const uint64_t t = _s[1][lane] << 17;
+            _s[2][lane] ^= _s[0][lane];
+            _s[3][lane] ^= _s[1][lane];
+            _s[1][lane] ^= _s[2][lane];
+            _s[0][lane] ^= _s[3][lane];
+            _s[2][lane] ^= t;
+            _s[3][lane] = rotl(_s[3][lane], 45);
+        }
+    }
+
+private:
+    uint64_t _s[4][LANES];
+
+    static uint64_t rotl(uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+};
+
+} // namespace Internals
+//! @endcond
+
 int64_t Memory::RamTotal()
 {
 #if defined(__APPLE__)
@@ -94,15 +198,147 @@ int64_t Memory::RamFree()
 
 bool Memory::IsZero(const void* buffer, size_t size) noexcept
 {
-    const char* ptr = (const char*)buffer;
-    for (size_t i = 0; i < size; ++i)
-        if (ptr[i] != 0)
+    const uint8_t* ptr = (const uint8_t*)buffer;
+
+    // Check 64 bytes blocks with SIMD loads
+#if defined(CPPCOMMON_MEMORY_SSE2)
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(ptr + 0));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(ptr + 16));
+        __m128i v2 = _mm_loadu_si128((const __m128i*)(ptr + 32));
+        __m128i v3 = _mm_loadu_si128((const __m128i*)(ptr + 48));
+        __m128i v = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xFFFF)
+            return false;
+    }
+#elif defined(CPPCOMMON_MEMORY_NEON)
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        uint8x16_t v = vorrq_u8(vorrq_u8(vld1q_u8(ptr + 0), vld1q_u8(ptr + 16)), vorrq_u8(vld1q_u8(ptr + 32), vld1q_u8(ptr + 48)));
+        if (vmaxvq_u8(v) != 0)
+            return false;
+    }
+#endif
+
+    // Check the rest of the buffer by words and bytes
+    for (; size >= sizeof(uint64_t); ptr += sizeof(uint64_t), size -= sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, ptr, sizeof(word));
+        if (word != 0)
+            return false;
+    }
+    for (; size > 0; ++ptr, --size)
+        if (*ptr != 0)
             return false;
     return true;
 }
 
+void Memory::StreamCopy(void* destination, const void* source, size_t size) noexcept
+{
+#if defined(CPPCOMMON_MEMORY_SSE2)
+    if (size >= NON_TEMPORAL_THRESHOLD)
+    {
+        uint8_t* dst = (uint8_t*)destination;
+        const uint8_t* src = (const uint8_t*)source;
+
+        // Copy the head to align the destination
+        size_t head = (16 - ((uintptr_t)dst & 15)) & 15;
+        std::memcpy(dst, src, head);
+        dst += head;
+        src += head;
+        size -= head;
+
+        // Copy 64 bytes blocks with streaming stores
+        for (; size >= 64; dst += 64, src += 64, size -= 64)
+        {
+            __m128i v0 = _mm_loadu_si128((const __m128i*)(src + 0));
+            __m128i v1 = _mm_loadu_si128((const __m128i*)(src + 16));
+            __m128i v2 = _mm_loadu_si128((const __m128i*)(src + 32));
+            __m128i v3 = _mm_loadu_si128((const __m128i*)(src + 48));
+            _mm_stream_si128((__m128i*)(dst + 0), v0);
+            _mm_stream_si128((__m128i*)(dst + 16), v1);
+            _mm_stream_si128((__m128i*)(dst + 32), v2);
+            _mm_stream_si128((__m128i*)(dst + 48), v3);
+        }
+
+        // Order streaming stores with subsequent stores
+        _mm_sfence();
+
+        // Copy the tail
+        std::memcpy(dst, src, size);
+        return;
+    }
+#endif
+
+    std::memcpy(destination, source, size);
+}
+
+void Memory::StreamFill(void* buffer, uint8_t value, size_t size) noexcept
+{
+#if defined(CPPCOMMON_MEMORY_SSE2)
+    if (size >= NON_TEMPORAL_THRESHOLD)
+    {
+        uint8_t* ptr = (uint8_t*)buffer;
+
+        // Fill the head to align the buffer
+        size_t head = (16 - ((uintptr_t)ptr & 15)) & 15;
+        std::memset(ptr, value, head);
+        ptr += head;
+        size -= head;
+
+        // Fill 64 bytes blocks with streaming stores
+        __m128i v = _mm_set1_epi8((char)value);
+        for (; size >= 64; ptr += 64, size -= 64)
+        {
+            _mm_stream_si128((__m128i*)(ptr + 0), v);
+            _mm_stream_si128((__m128i*)(ptr + 16), v);
+            _mm_stream_si128((__m128i*)(ptr + 32), v);
+            _mm_stream_si128((__m128i*)(ptr + 48), v);
+        }
+
+        // Order streaming stores with subsequent stores
+        _mm_sfence();
+
+        // Fill the tail
+        std::memset(ptr, value, size);
+        return;
+    }
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    size_t block = Internals::ZeroBlockSize();
+    if ((value == 0) && (block > 0) && (size >= NON_TEMPORAL_THRESHOLD))
+    {
+        uint8_t* ptr = (uint8_t*)buffer;
+
+        // Zero the head to align the buffer to the zero block
+        size_t head = (block - ((uintptr_t)ptr & (block - 1))) & (block - 1);
+        std::memset(ptr, 0, head);
+        ptr += head;
+        size -= head;
+
+        // Zero whole blocks without reading them into the cache
+        for (; size >= block; ptr += block, size -= block)
+            __asm__ __volatile__("dc zva, %0" : : "r"(ptr) : "memory");
+
+        // Zero the tail
+        std::memset(ptr, 0, size);
+        return;
+    }
+#endif
+
+    std::memset(buffer, value, size);
+}
+
 void Memory::ZeroFill(void* buffer, size_t size)
 {
+    if (size >= NON_TEMPORAL_THRESHOLD)
+    {
+        StreamFill(buffer, 0, size);
+        Internals::CompilerBarrier(buffer);
+        return;
+    }
+
 #ifdef __STDC_LIB_EXT1__
     memset_s(buffer, size, 0, size);
 #elif defined(_WIN32) || defined(_WIN64)
@@ -116,21 +352,29 @@ void Memory::ZeroFill(void* buffer, size_t size)
 
 void Memory::RandomFill(void* buffer, size_t size)
 {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    int fd = open("/dev/urandom", O_RDONLY);
-    if (fd < 0)
-        throwex SystemException("Cannot open '/dev/urandom' file for reading!");
-    ssize_t count = read(fd, buffer, size);
-    if (count < 0)
-        throwex SystemException("Cannot read from '/dev/urandom' file!");
-    int result = close(fd);
-    if (result != 0)
-        throwex SystemException("Cannot close '/dev/urandom' file!");
-#elif defined(_WIN32) || defined(_WIN64)
-    char* ptr = (char*)buffer;
-    for(size_t i = 0; i < size; ++i)
-        ptr[i] = rand() % 256;
-#endif
+    if (size < RANDOM_THRESHOLD)
+    {
+        Internals::SystemRandomFill(buffer, size);
+        return;
+    }
+
+    // Seed the pseudo-random generator from the system entropy source
+    uint64_t seed[4 * Internals::Xoshiro256x4::LANES];
+    Internals::SystemRandomFill(seed, sizeof(seed));
+    Internals::Xoshiro256x4 generator(seed);
+
+    uint8_t* ptr = (uint8_t*)buffer;
+    uint64_t block[Internals::Xoshiro256x4::LANES];
+    for (; size >= sizeof(block); ptr += sizeof(block), size -= sizeof(block))
+    {
+        generator.next(block);
+        std::memcpy(ptr, block, sizeof(block));
+    }
+    if (size > 0)
+    {
+        generator.next(block);
+        std::memcpy(ptr, block, size);
+    }
 }
 
 void Memory::CryptoFill(void* buffer, size_t size)
@@ -156,4 +400,112 @@ void Memory::CryptoFill(void* buffer, size_t size)
 #endif
 }
 
+size_t Memory::MirrorGranularity()
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    return (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(_WIN32) || defined(_WIN64)
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (size_t)si.dwAllocationGranularity;
+#endif
+}
+
+void* Memory::MirrorAllocate(size_t size)
+{
+    assert((size > 0) && "Mirrored memory buffer size must be greater than zero!");
+    assert(((size % MirrorGranularity()) == 0) && "Mirrored memory buffer size must be a multiple of the mirror granularity!");
+    if ((size == 0) || ((size % MirrorGranularity()) != 0))
+        return nullptr;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Create an anonymous shared memory file
+#if defined(__APPLE__)
+    char name[64];
+    snprintf(name, sizeof(name), "/cppcommon-mirror-%d-%p", (int)getpid(), (void*)&name);
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+        return nullptr;
+    shm_unlink(name);
+#else
+    int fd = memfd_create("cppcommon-mirror", MFD_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+#endif
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    // Reserve the address space for both mappings
+    uint8_t* buffer = (uint8_t*)mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    // Map the same file twice into the reserved address space
+    void* first = mmap(buffer, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void* second = mmap(buffer + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+    if ((first == MAP_FAILED) || (second == MAP_FAILED))
+    {
+        munmap(buffer, 2 * size);
+        return nullptr;
+    }
+
+    return buffer;
+#elif defined(_WIN32) || defined(_WIN64)
+    // Create a page file backed memory mapping
+    HANDLE hMapping = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)(size & 0xFFFFFFFF), nullptr);
+    if (hMapping == nullptr)
+        return nullptr;
+
+    // Find the free address space and map the same memory twice. Another
+    // thread could take the found address space, so retry several times.
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        uint8_t* buffer = (uint8_t*)VirtualAlloc(nullptr, 2 * size, MEM_RESERVE, PAGE_NOACCESS);
+        if (buffer == nullptr)
+            break;
+        VirtualFree(buffer, 0, MEM_RELEASE);
+
+        void* first = MapViewOfFileEx(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, size, buffer);
+        if (first == nullptr)
+            continue;
+
+        void* second = MapViewOfFileEx(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, size, buffer + size);
+        if (second == nullptr)
+        {
+            UnmapViewOfFile(first);
+            continue;
+        }
+
+        // Mapped views keep the memory mapping alive
+        CloseHandle(hMapping);
+        return buffer;
+    }
+
+    CloseHandle(hMapping);
+    return nullptr;
+#endif
+}
+
+void Memory::MirrorFree(void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Mirrored memory buffer must be valid!");
+    if (buffer == nullptr)
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (munmap(buffer, 2 * size) != 0)
+        throwex SystemException("Failed to unmap the mirrored memory buffer!");
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!UnmapViewOfFile((uint8_t*)buffer + size) || !UnmapViewOfFile(buffer))
+        throwex SystemException("Failed to unmap the mirrored memory buffer!");
+#endif
+}
+
 } // namespace CppCommon
@@ -0,0 +1,319 @@
+/*!
+    \file memory_pressure.cpp
+    \brief Memory pressure monitor implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/memory_pressure.h"
+
+#include "filesystem/exceptions.h"
+#include "filesystem/file.h"
+#include "memory/memory.h"
+#include "threads/thread.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Read the whole text of the given pseudo file or return the empty string
+std::string ReadPressureFile(const std::string& path)
+{
+    try
+    {
+        return File::ReadAllText(path);
+    }
+    catch (const FileSystemException&) { return std::string(); }
+}
+
+// Parse the memory limit or usage value ("max" and unlimited values are -1)
+int64_t ParsePressureValue(const std::string& text)
+{
+    if (text.empty() || (text.compare(0, 3, "max") == 0))
+        return -1;
+
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(text.c_str(), &end, 10);
+    if (end == text.c_str())
+        return -1;
+
+    // Unlimited cgroup v1 memory limit is close to INT64_MAX rounded down to the page size
+    if (value >= (1ull << 60))
+        return -1;
+
+    return (int64_t)value;
+}
+
+// Find the value of the given key in "key value" lines
+int64_t ParsePressureStat(const std::string& text, const std::string& key)
+{
+    std::istringstream stream(text);
+    std::string name;
+    int64_t value;
+    while (stream >> name >> value)
+        if (name == key)
+            return value;
+    return -1;
+}
+
+// Find avg10 value of the given PSI line ("some avg10=0.00 avg60=0.00 avg300=0.00 total=0")
+bool ParsePressureStall(const std::string& text, const std::string& kind, double& value)
+{
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        if (line.compare(0, kind.size() + 1, kind + " ") != 0)
+            continue;
+
+        size_t pos = line.find("avg10=");
+        if (pos == std::string::npos)
+            return false;
+
+        value = std::strtod(line.c_str() + pos + 6, nullptr);
+        return true;
+    }
+    return false;
+}
+
+} // namespace Internals
+//! @endcond
+
+MemoryPressure::MemoryPressure(const std::string& cgroup)
+    : _cgroup(cgroup.empty() ? DetectCgroup() : cgroup),
+      _v2(false),
+      _level(MemoryPressureLevel::NORMAL),
+      _moderate(0.80),
+      _critical(0.95),
+      _stall_moderate(10.0),
+      _stall_critical(40.0),
+      _id(0),
+      _stop(false)
+{
+    // cgroup v2 has the unified memory.current file
+    if (!_cgroup.empty())
+        _v2 = !Internals::ReadPressureFile(_cgroup + "/memory.current").empty() || Internals::ReadPressureFile(_cgroup + "/memory.usage_in_bytes").empty();
+}
+
+std::string MemoryPressure::DetectCgroup()
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    std::istringstream stream(Internals::ReadPressureFile("/proc/self/cgroup"));
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        // Line format is "hierarchy-ID:controller-list:cgroup-path"
+        size_t first = line.find(':');
+        size_t second = (first != std::string::npos) ? line.find(':', first + 1) : std::string::npos;
+        if (second == std::string::npos)
+            continue;
+
+        std::string controllers = line.substr(first + 1, second - first - 1);
+        std::string path = line.substr(second + 1);
+        if (path == "/")
+            path.clear();
+
+        if (controllers.empty())
+        {
+            // cgroup v2 unified hierarchy
+            std::string directory = "/sys/fs/cgroup" + path;
+            if (!Internals::ReadPressureFile(directory + "/memory.current").empty())
+                return directory;
+        }
+        else if ((("," + controllers + ",").find(",memory,")) != std::string::npos)
+        {
+            // cgroup v1 memory controller hierarchy
+            std::string directory = "/sys/fs/cgroup/memory" + path;
+            if (!Internals::ReadPressureFile(directory + "/memory.usage_in_bytes").empty())
+                return directory;
+        }
+    }
+#endif
+    return std::string();
+}
+
+void MemoryPressure::set_thresholds(double moderate, double critical)
+{
+    std::scoped_lock locker(_state);
+    _moderate = moderate;
+    _critical = critical;
+}
+
+void MemoryPressure::set_stall_thresholds(double moderate, double critical)
+{
+    std::scoped_lock locker(_state);
+    _stall_moderate = moderate;
+    _stall_critical = critical;
+}
+
+size_t MemoryPressure::subscribe(const Handler& handler)
+{
+    std::scoped_lock locker(_state);
+    size_t id = ++_id;
+    _handlers.emplace(id, handler);
+    return id;
+}
+
+bool MemoryPressure::unsubscribe(size_t id)
+{
+    std::scoped_lock locker(_state);
+    return _handlers.erase(id) > 0;
+}
+
+MemoryPressureStatus MemoryPressure::status() const
+{
+    MemoryPressureStatus result;
+
+    // Host memory status
+    int64_t total = -1;
+    int64_t available = -1;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    std::string meminfo = Internals::ReadPressureFile("/proc/meminfo");
+    int64_t total_kb = Internals::ParsePressureStat(meminfo, "MemTotal:");
+    int64_t available_kb = Internals::ParsePressureStat(meminfo, "MemAvailable:");
+    if ((total_kb > 0) && (available_kb >= 0))
+    {
+        total = total_kb * 1024;
+        available = available_kb * 1024;
+    }
+#endif
+    if ((total < 0) || (available < 0))
+    {
+        total = Memory::RamTotal();
+        available = Memory::RamFree();
+    }
+
+    // cgroup memory status
+    int64_t limit = -1;
+    int64_t usage = -1;
+    int64_t inactive = -1;
+    bool stall = false;
+    if (!_cgroup.empty())
+    {
+        if (_v2)
+        {
+            limit = Internals::ParsePressureValue(Internals::ReadPressureFile(_cgroup + "/memory.max"));
+            usage = Internals::ParsePressureValue(Internals::ReadPressureFile(_cgroup + "/memory.current"));
+            inactive = Internals::ParsePressureStat(Internals::ReadPressureFile(_cgroup + "/memory.stat"), "inactive_file");
+            std::string pressure = Internals::ReadPressureFile(_cgroup + "/memory.pressure");
+            stall = Internals::ParsePressureStall(pressure, "some", result.some);
+            Internals::ParsePressureStall(pressure, "full", result.full);
+        }
+        else
+        {
+            limit = Internals::ParsePressureValue(Internals::ReadPressureFile(_cgroup + "/memory.limit_in_bytes"));
+            usage = Internals::ParsePressureValue(Internals::ReadPressureFile(_cgroup + "/memory.usage_in_bytes"));
+            std::string stat = Internals::ReadPressureFile(_cgroup + "/memory.stat");
+            inactive = Internals::ParsePressureStat(stat, "total_inactive_file");
+            if (inactive < 0)
+                inactive = Internals::ParsePressureStat(stat, "inactive_file");
+        }
+    }
+
+    if ((limit > 0) && (usage >= 0) && ((total <= 0) || (limit < total)))
+    {
+        // Limited cgroup without reclaimable inactive page cache
+        result.limit = limit;
+        result.usage = std::max<int64_t>(usage - std::max<int64_t>(inactive, 0), 0);
+        result.cgroup = true;
+    }
+    else if ((total > 0) && (available >= 0))
+    {
+        // Unlimited cgroup or host memory
+        result.limit = total;
+        result.usage = std::max<int64_t>(total - available, 0);
+    }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // System wide memory stall information
+    if (!stall)
+    {
+        std::string pressure = Internals::ReadPressureFile("/proc/pressure/memory");
+        Internals::ParsePressureStall(pressure, "some", result.some);
+        Internals::ParsePressureStall(pressure, "full", result.full);
+    }
+#endif
+
+    return result;
+}
+
+MemoryPressureLevel MemoryPressure::update()
+{
+    return update(status());
+}
+
+MemoryPressureLevel MemoryPressure::update(const MemoryPressureStatus& status)
+{
+    std::scoped_lock locker(_state);
+
+    // Pressure level is the highest level of the memory utilization and stalls
+    double utilization = status.utilization();
+    MemoryPressureLevel level = MemoryPressureLevel::NORMAL;
+    if ((utilization >= _critical) || (status.some >= _stall_critical))
+        level = MemoryPressureLevel::CRITICAL;
+    else if ((utilization >= _moderate) || (status.some >= _stall_moderate))
+        level = MemoryPressureLevel::MODERATE;
+
+    // Notify subscribers about the level change or the ongoing pressure
+    MemoryPressureLevel previous = _level.exchange(level, std::memory_order_acq_rel);
+    if ((level != previous) || (level != MemoryPressureLevel::NORMAL))
+        for (const auto& handler : _handlers)
+            handler.second(level, status);
+
+    return level;
+}
+
+bool MemoryPressure::start(const Timespan& period)
+{
+    std::scoped_lock locker(_control);
+
+    if (_thread.joinable())
+        return false;
+
+    _stop = false;
+    _thread = Thread::Start([this, period]()
+    {
+        std::unique_lock<std::mutex> waiter(_lock);
+        while (!_stop)
+        {
+            // Update the memory pressure without the lock
+            waiter.unlock();
+            update();
+            waiter.lock();
+
+            // Wait for the next update period or the stop signal
+            if (_cv.wait_for(waiter, std::chrono::nanoseconds(period.total()), [this]() { return _stop; }))
+                break;
+        }
+    });
+
+    return true;
+}
+
+bool MemoryPressure::stop()
+{
+    std::scoped_lock locker(_control);
+
+    if (!_thread.joinable())
+        return false;
+
+    // Signal the monitor thread to stop
+    {
+        std::scoped_lock waiter(_lock);
+        _stop = true;
+    }
+    _cv.notify_all();
+
+    // Wait for the monitor thread
+    _thread.join();
+
+    return true;
+}
+
+} // namespace CppCommon
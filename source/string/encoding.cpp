@@ -8,152 +8,1338 @@
 
 #include "string/encoding.h"
 
+#include "system/cpu_dispatch.h"
+
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
-#include <codecvt>
-#include <locale>
+#include <cstring>
+#include <type_traits>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace CppCommon {
 
-std::string Encoding::ToUTF8(std::wstring_view wstr)
+//! @cond INTERNALS
+namespace Internals {
+
+// Marker of the invalid code unit sequence
+const char32_t UTFInvalid = 0xFFFFFFFF;
+// Replacement character for invalid code unit sequences
+const char32_t UTFReplacement = 0xFFFD;
+
+// Size of ASCII blocks in code units
+const size_t ASCIIBlock = 16;
+
+// Check if the block contains only ASCII code units
+template <typename T>
+inline bool IsASCIIBlock(const T* data) noexcept
+{
+    uint32_t bits = 0;
+    for (size_t i = 0; i < ASCIIBlock; ++i)
+        bits |= (uint32_t)(std::make_unsigned_t<T>)data[i];
+    return (bits < 0x80);
+}
+
+// Copy ASCII block with widening or narrowing of code units (returns 'false' if the block contains other code units)
+template <typename TInput, typename TOutput>
+inline bool CopyASCIIBlock(const TInput* input, TOutput* output) noexcept
 {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(__MINGW64__)
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes((char16_t*)wstr.data(), (char16_t*)wstr.data() + wstr.size());
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
-    return convert.to_bytes(wstr.data(), wstr.data() + wstr.size());
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
-    return convert.to_bytes(wstr.data(), wstr.data() + wstr.size());
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is always available for x86-64
+    if constexpr ((sizeof(TInput) == 1) && (sizeof(TOutput) == 2))
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)input);
+        if (_mm_movemask_epi8(v) != 0)
+            return false;
+        _mm_storeu_si128((__m128i*)output, _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(output + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+        return true;
+    }
+    else if constexpr ((sizeof(TInput) == 1) && (sizeof(TOutput) == 4))
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)input);
+        if (_mm_movemask_epi8(v) != 0)
+            return false;
+        __m128i lo = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+        __m128i hi = _mm_unpackhi_epi8(v, _mm_setzero_si128());
+        _mm_storeu_si128((__m128i*)output, _mm_unpacklo_epi16(lo, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(output + 4), _mm_unpackhi_epi16(lo, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(output + 8), _mm_unpacklo_epi16(hi, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(output + 12), _mm_unpackhi_epi16(hi, _mm_setzero_si128()));
+        return true;
+    }
+    else if constexpr ((sizeof(TInput) == 2) && (sizeof(TOutput) == 1))
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)input);
+        __m128i b = _mm_loadu_si128((const __m128i*)(input + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16((short)0xFF80));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+            return false;
+        _mm_storeu_si128((__m128i*)output, _mm_packus_epi16(a, b));
+        return true;
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if constexpr ((sizeof(TInput) == 1) && (sizeof(TOutput) == 2))
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)input);
+        if (vmaxvq_u8(v) >= 0x80)
+            return false;
+        vst1q_u16((uint16_t*)output, vmovl_u8(vget_low_u8(v)));
+        vst1q_u16((uint16_t*)(output + 8), vmovl_high_u8(v));
+        return true;
+    }
+    else if constexpr ((sizeof(TInput) == 2) && (sizeof(TOutput) == 1))
+    {
+        uint16x8_t a = vld1q_u16((const uint16_t*)input);
+        uint16x8_t b = vld1q_u16((const uint16_t*)(input + 8));
+        if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80)
+            return false;
+        vst1q_u8((uint8_t*)output, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+        return true;
+    }
 #endif
+    if (!IsASCIIBlock(input))
+        return false;
+    for (size_t i = 0; i < ASCIIBlock; ++i)
+        output[i] = (TOutput)input[i];
+    return true;
 }
 
-std::wstring Encoding::FromUTF8(std::string_view str)
+// Get the count of leading ASCII code units
+template <typename T>
+inline size_t ASCIIPrefix(const T* data, size_t size) noexcept
+{
+    size_t i = 0;
+    while (((i + ASCIIBlock) <= size) && IsASCIIBlock(data + i))
+        i += ASCIIBlock;
+    while ((i < size) && ((uint32_t)(std::make_unsigned_t<T>)data[i] < 0x80))
+        ++i;
+    return i;
+}
+
+// Decode the next code point of UTF-8, UTF-16 or UTF-32 encoded string (depends on the code unit size)
+template <typename T>
+inline char32_t Decode(const T*& it, const T* end) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        uint8_t lead = (uint8_t)*it++;
+        if (lead < 0x80)
+            return lead;
+
+        // Allowed range of the second byte excludes overlong forms, surrogates and code points above U+10FFFF
+        size_t count;
+        char32_t cp;
+        uint8_t lower = 0x80;
+        uint8_t upper = 0xBF;
+        if (lead < 0xC2)
+            return UTFInvalid;
+        else if (lead < 0xE0)
+        {
+            count = 1;
+            cp = lead & 0x1F;
+        }
+        else if (lead < 0xF0)
+        {
+            count = 2;
+            cp = lead & 0x0F;
+            if (lead == 0xE0)
+                lower = 0xA0;
+            else if (lead == 0xED)
+                upper = 0x9F;
+        }
+        else if (lead < 0xF5)
+        {
+            count = 3;
+            cp = lead & 0x07;
+            if (lead == 0xF0)
+                lower = 0x90;
+            else if (lead == 0xF4)
+                upper = 0x8F;
+        }
+        else
+            return UTFInvalid;
+
+        // Invalid continuation byte is not consumed, so it starts the next sequence
+        for (; count > 0; --count)
+        {
+            if ((it == end) || ((uint8_t)*it < lower) || ((uint8_t)*it > upper))
+                return UTFInvalid;
+            cp = (cp << 6) | ((uint8_t)*it++ & 0x3F);
+            lower = 0x80;
+            upper = 0xBF;
+        }
+        return cp;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        char32_t unit = (char16_t)*it++;
+        if ((unit < 0xD800) || (unit > 0xDFFF))
+            return unit;
+        if ((unit <= 0xDBFF) && (it != end) && ((char16_t)*it >= 0xDC00) && ((char16_t)*it <= 0xDFFF))
+            return 0x10000 + ((unit - 0xD800) << 10) + ((char16_t)*it++ - 0xDC00);
+        return UTFInvalid;
+    }
+    else
+    {
+        char32_t cp = (char32_t)*it++;
+        if ((cp > 0x10FFFF) || ((cp >= 0xD800) && (cp <= 0xDFFF)))
+            return UTFInvalid;
+        return cp;
+    }
+}
+
+// Get the count of code units to encode the given code point
+template <typename T>
+inline size_t Length(char32_t cp) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+        return (cp < 0x80) ? 1 : ((cp < 0x800) ? 2 : ((cp < 0x10000) ? 3 : 4));
+    else if constexpr (sizeof(T) == 2)
+        return (cp < 0x10000) ? 1 : 2;
+    else
+        return 1;
+}
+
+// Encode the given code point into UTF-8, UTF-16 or UTF-32 code units (depends on the code unit size)
+template <typename T>
+inline T* Encode(char32_t cp, T* output) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        if (cp < 0x80)
+            *output++ = (T)cp;
+        else if (cp < 0x800)
+        {
+            *output++ = (T)(0xC0 | (cp >> 6));
+            *output++ = (T)(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000)
+        {
+            *output++ = (T)(0xE0 | (cp >> 12));
+            *output++ = (T)(0x80 | ((cp >> 6) & 0x3F));
+            *output++ = (T)(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            *output++ = (T)(0xF0 | (cp >> 18));
+            *output++ = (T)(0x80 | ((cp >> 12) & 0x3F));
+            *output++ = (T)(0x80 | ((cp >> 6) & 0x3F));
+            *output++ = (T)(0x80 | (cp & 0x3F));
+        }
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        if (cp < 0x10000)
+            *output++ = (T)cp;
+        else
+        {
+            *output++ = (T)(0xD800 + ((cp - 0x10000) >> 10));
+            *output++ = (T)(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        }
+    }
+    else
+        *output++ = (T)cp;
+    return output;
+}
+
+// Get the count of output code units of the transcoded string
+template <typename TOutput, typename TInput>
+size_t TranscodeLength(const TInput* input, size_t size) noexcept
 {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(__MINGW64__)
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::wstring(tmp.data(), tmp.data() + tmp.size());
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
+    const TInput* it = input;
+    const TInput* end = input + size;
+
+    size_t result = 0;
+    while (it != end)
+    {
+        size_t ascii = ASCIIPrefix(it, end - it);
+        it += ascii;
+        result += ascii;
+        if (it == end)
+            break;
+
+        char32_t cp = Decode(it, end);
+        result += Length<TOutput>((cp == UTFInvalid) ? UTFReplacement : cp);
+    }
+    return result;
+}
+
+// Transcode the string into the output buffer and return the count of written code units (zero if the output buffer is too small)
+template <typename TInput, typename TOutput>
+size_t Transcode(const TInput* input, size_t size, TOutput* output, size_t capacity) noexcept
+{
+    if ((size == 0) || (output == nullptr))
+        return 0;
+
+    const TInput* it = input;
+    const TInput* end = input + size;
+    TOutput* out = output;
+    TOutput* out_end = output + capacity;
+
+    while (it != end)
+    {
+        // Copy ASCII blocks at once
+        while (((size_t)(end - it) >= ASCIIBlock) && ((size_t)(out_end - out) >= ASCIIBlock) && CopyASCIIBlock(it, out))
+        {
+            it += ASCIIBlock;
+            out += ASCIIBlock;
+        }
+        if (it == end)
+            break;
+
+        char32_t cp = Decode(it, end);
+        if (cp == UTFInvalid)
+            cp = UTFReplacement;
+        if ((size_t)(out_end - out) < Length<TOutput>(cp))
+            return 0;
+        out = Encode(cp, out);
+    }
+    return out - output;
+}
+
+typedef bool (*ValidateFunction)(const uint8_t* data, size_t size);
+
+bool ValidateUTF8Scalar(const uint8_t* data, size_t size)
+{
+    const uint8_t* it = data;
+    const uint8_t* end = data + size;
+    while (it != end)
+    {
+        it += ASCIIPrefix(it, end - it);
+        if ((it != end) && (Decode(it, end) == UTFInvalid))
+            return false;
+    }
+    return true;
+}
+
+// UTF-8 validation lookup tables of the previous byte high nibble, the previous byte
+// low nibble and the current byte high nibble (Keiser and Lemire, "Validating UTF-8
+// In Less Than One Instruction Per Byte"). Error bits of all three lookups are matched
+// for invalid pairs of bytes.
+const uint8_t UTF8TooShort = 1 << 0;        // 11______ 0_______, 11______ 11______
+const uint8_t UTF8TooLong = 1 << 1;         // 0_______ 10______
+const uint8_t UTF8Overlong3 = 1 << 2;       // 11100000 100_____
+const uint8_t UTF8TooLarge = 1 << 3;        // 11110100 1001____, 11110100 101_____, 11110101+ 1001____, 101_____
+const uint8_t UTF8Surrogate = 1 << 4;       // 11101101 101_____
+const uint8_t UTF8Overlong2 = 1 << 5;       // 1100000_ 10______
+const uint8_t UTF8TooLarge1000 = 1 << 6;    // 11110101+ 1000____
+const uint8_t UTF8Overlong4 = 1 << 6;       // 11110000 1000____
+const uint8_t UTF8TwoConts = 1 << 7;        // 10______ 10______
+const uint8_t UTF8Carry = UTF8TooShort | UTF8TooLong | UTF8TwoConts;
+
+const uint8_t UTF8Byte1High[16] =
+{
+    UTF8TooLong, UTF8TooLong, UTF8TooLong, UTF8TooLong,
+    UTF8TooLong, UTF8TooLong, UTF8TooLong, UTF8TooLong,
+    UTF8TwoConts, UTF8TwoConts, UTF8TwoConts, UTF8TwoConts,
+    UTF8TooShort | UTF8Overlong2,
+    UTF8TooShort,
+    UTF8TooShort | UTF8Overlong3 | UTF8Surrogate,
+    UTF8TooShort | UTF8TooLarge | UTF8TooLarge1000 | UTF8Overlong4
+};
+
+const uint8_t UTF8Byte1Low[16] =
+{
+    UTF8Carry | UTF8Overlong3 | UTF8Overlong2 | UTF8Overlong4,
+    UTF8Carry | UTF8Overlong2,
+    UTF8Carry,
+    UTF8Carry,
+    UTF8Carry | UTF8TooLarge,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000 | UTF8Surrogate,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+    UTF8Carry | UTF8TooLarge | UTF8TooLarge1000
+};
+
+const uint8_t UTF8Byte2High[16] =
+{
+    UTF8TooShort, UTF8TooShort, UTF8TooShort, UTF8TooShort,
+    UTF8TooShort, UTF8TooShort, UTF8TooShort, UTF8TooShort,
+    UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Overlong3 | UTF8TooLarge1000 | UTF8Overlong4,
+    UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Overlong3 | UTF8TooLarge,
+    UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Surrogate | UTF8TooLarge,
+    UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Surrogate | UTF8TooLarge,
+    UTF8TooShort, UTF8TooShort, UTF8TooShort, UTF8TooShort
+};
+
+// Maximal values of the last three bytes of the block which do not start an incomplete sequence
+const uint8_t UTF8Incomplete[32] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+CPU_TARGET("avx2")
+inline void ValidateUTF8BlockAVX2(__m256i input, __m256i& prev_input, __m256i& prev_incomplete, __m256i& error)
+{
+    if (_mm256_movemask_epi8(input) == 0)
+    {
+        // ASCII block could not continue the previous incomplete sequence
+        error = _mm256_or_si256(error, prev_incomplete);
+        prev_incomplete = _mm256_setzero_si256();
+        prev_input = input;
+        return;
+    }
+
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i byte1_high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)UTF8Byte1High));
+    const __m256i byte1_low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)UTF8Byte1Low));
+    const __m256i byte2_high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)UTF8Byte2High));
+
+    // Previous bytes of each input byte
+    __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+    // Special cases of two bytes sequences
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(_mm256_shuffle_epi8(byte1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), mask)),
+                         _mm256_shuffle_epi8(byte1_low, _mm256_and_si256(prev1, mask))),
+        _mm256_shuffle_epi8(byte2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), mask)));
+
+    // Third and fourth bytes of sequences must be continuations
+    __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+
+    error = _mm256_or_si256(error, _mm256_xor_si256(must23, special));
+    prev_incomplete = _mm256_subs_epu8(input, _mm256_loadu_si256((const __m256i*)UTF8Incomplete));
+    prev_input = input;
+}
+
+CPU_TARGET("avx2")
+bool ValidateUTF8AVX2(const uint8_t* data, size_t size)
+{
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    __m256i error = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+        ValidateUTF8BlockAVX2(_mm256_loadu_si256((const __m256i*)(data + i)), prev_input, prev_incomplete, error);
+
+    // The tail is padded with zeros which are valid ASCII characters
+    if (i < size)
+    {
+        uint8_t tail[32] = { 0 };
+        std::memcpy(tail, data + i, size - i);
+        ValidateUTF8BlockAVX2(_mm256_loadu_si256((const __m256i*)tail), prev_input, prev_incomplete, error);
+    }
+
+    error = _mm256_or_si256(error, prev_incomplete);
+    return (_mm256_testz_si256(error, error) != 0);
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+inline void ValidateUTF8BlockNEON(uint8x16_t input, const uint8x16_t incomplete, uint8x16_t& prev_input, uint8x16_t& prev_incomplete, uint8x16_t& error)
+{
+    if (vmaxvq_u8(input) < 0x80)
+    {
+        // ASCII block could not continue the previous incomplete sequence
+        error = vorrq_u8(error, prev_incomplete);
+        prev_incomplete = vdupq_n_u8(0);
+        prev_input = input;
+        return;
+    }
+
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+
+    // Previous bytes of each input byte
+    uint8x16_t prev1 = vextq_u8(prev_input, input, 15);
+    uint8x16_t prev2 = vextq_u8(prev_input, input, 14);
+    uint8x16_t prev3 = vextq_u8(prev_input, input, 13);
+
+    // Special cases of two bytes sequences
+    uint8x16_t special = vandq_u8(
+        vandq_u8(vqtbl1q_u8(vld1q_u8(UTF8Byte1High), vshrq_n_u8(prev1, 4)),
+                 vqtbl1q_u8(vld1q_u8(UTF8Byte1Low), vandq_u8(prev1, mask))),
+        vqtbl1q_u8(vld1q_u8(UTF8Byte2High), vshrq_n_u8(input, 4)));
+
+    // Third and fourth bytes of sequences must be continuations
+    uint8x16_t third = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+    uint8x16_t fourth = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+    uint8x16_t must23 = vandq_u8(vorrq_u8(third, fourth), vdupq_n_u8(0x80));
+
+    error = vorrq_u8(error, veorq_u8(must23, special));
+    prev_incomplete = vqsubq_u8(input, incomplete);
+    prev_input = input;
+}
+
+bool ValidateUTF8NEON(const uint8_t* data, size_t size)
+{
+    const uint8x16_t incomplete = vld1q_u8(UTF8Incomplete + 16);
+
+    uint8x16_t prev_input = vdupq_n_u8(0);
+    uint8x16_t prev_incomplete = vdupq_n_u8(0);
+    uint8x16_t error = vdupq_n_u8(0);
+
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+        ValidateUTF8BlockNEON(vld1q_u8(data + i), incomplete, prev_input, prev_incomplete, error);
+
+    // The tail is padded with zeros which are valid ASCII characters
+    if (i < size)
+    {
+        uint8_t tail[16] = { 0 };
+        std::memcpy(tail, data + i, size - i);
+        ValidateUTF8BlockNEON(vld1q_u8(tail), incomplete, prev_input, prev_incomplete, error);
+    }
+
+    error = vorrq_u8(error, prev_incomplete);
+    return (vmaxvq_u8(error) == 0);
+}
+
 #endif
+
+ValidateFunction ResolveValidateUTF8([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return ValidateUTF8AVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return ValidateUTF8NEON;
+#endif
+    return ValidateUTF8Scalar;
+}
+
+} // namespace Internals
+//! @endcond
+
+bool Encoding::ValidateUTF8(std::string_view str) noexcept
+{
+    static CPUDispatch<bool(const uint8_t*, size_t)> dispatch(Internals::ResolveValidateUTF8);
+
+    return dispatch((const uint8_t*)str.data(), str.size());
+}
+
+std::string Encoding::ToUTF8(std::wstring_view wstr)
+{
+    std::string result(Internals::TranscodeLength<char>(wstr.data(), wstr.size()), 0);
+    Internals::Transcode(wstr.data(), wstr.size(), result.data(), result.size());
+    return result;
+}
+
+size_t Encoding::ToUTF8(std::wstring_view wstr, char* buffer, size_t size)
+{
+    return Internals::Transcode(wstr.data(), wstr.size(), buffer, size);
+}
+
+std::wstring Encoding::FromUTF8(std::string_view str)
+{
+    std::wstring result(str.size(), 0);
+    result.resize(Internals::Transcode(str.data(), str.size(), result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::FromUTF8(std::string_view str, wchar_t* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
 }
 
 std::u16string Encoding::UTF8toUTF16(std::string_view str)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8_utf16<uint16_t>, uint16_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::u16string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#endif
+    std::u16string result(str.size(), 0);
+    result.resize(Internals::Transcode(str.data(), str.size(), result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::UTF8toUTF16(std::string_view str, char16_t* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
 }
 
 std::u32string Encoding::UTF8toUTF32(std::string_view str)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::u32string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#endif
+    std::u32string result(str.size(), 0);
+    result.resize(Internals::Transcode(str.data(), str.size(), result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::UTF8toUTF32(std::string_view str, char32_t* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
 }
 
 std::string Encoding::UTF16toUTF8(std::u16string_view str)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8_utf16<uint16_t>, uint16_t> convert;
-    return convert.to_bytes((uint16_t*)str.data(), (uint16_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes(str.data(), str.data() + str.size());
-#endif
+    std::string result(Internals::TranscodeLength<char>(str.data(), str.size()), 0);
+    Internals::Transcode(str.data(), str.size(), result.data(), result.size());
+    return result;
+}
+
+size_t Encoding::UTF16toUTF8(std::u16string_view str, char* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
 }
 
 std::u32string Encoding::UTF16toUTF32(std::u16string_view str)
 {
-    std::string bytes;
-    bytes.reserve(str.size() * 2);
+    std::u32string result(str.size(), 0);
+    result.resize(Internals::Transcode(str.data(), str.size(), result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::UTF16toUTF32(std::u16string_view str, char32_t* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
+}
+
+std::string Encoding::UTF32toUTF8(std::u32string_view str)
+{
+    std::string result(Internals::TranscodeLength<char>(str.data(), str.size()), 0);
+    Internals::Transcode(str.data(), str.size(), result.data(), result.size());
+    return result;
+}
+
+size_t Encoding::UTF32toUTF8(std::u32string_view str, char* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
+}
+
+std::u16string Encoding::UTF32toUTF16(std::u32string_view str)
+{
+    std::u16string result(str.size() * 2, 0);
+    result.resize(Internals::Transcode(str.data(), str.size(), result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::UTF32toUTF16(std::u32string_view str, char16_t* buffer, size_t size)
+{
+    return Internals::Transcode(str.data(), str.size(), buffer, size);
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Codec kernel processes the bulk of the input and returns the count of processed input bytes
+typedef size_t (*CodecFunction)(const uint8_t* input, size_t size, uint8_t* output);
+
+size_t CodecScalar(const uint8_t*, size_t, uint8_t*)
+{
+    // Scalar implementation processes the whole input
+    return 0;
+}
 
-    for (const char16_t ch : str)
+const char Base16Alphabet[] = "0123456789ABCDEF";
+const char Base32Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567=";
+const char Base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Build ASCII to sextet table with the given mark of invalid characters
+struct Base64Table
+{
+    int8_t table[128];
+
+    explicit Base64Table(int8_t invalid) noexcept
+    {
+        for (auto& value : table)
+            value = invalid;
+        for (int i = 0; i < 64; ++i)
+            table[(uint8_t)Base64Alphabet[i]] = (int8_t)i;
+    }
+};
+
+// Build ASCII to quintet table with the given mark of invalid characters (lower case letters are allowed)
+struct Base32Table
+{
+    int8_t table[128];
+
+    explicit Base32Table(int8_t invalid) noexcept
+    {
+        for (auto& value : table)
+            value = invalid;
+        for (int i = 0; i < 32; ++i)
+        {
+            uint8_t ch = (uint8_t)Base32Alphabet[i];
+            table[ch] = (int8_t)i;
+            if ((ch >= 'A') && (ch <= 'Z'))
+                table[ch - 'A' + 'a'] = (int8_t)i;
+        }
+    }
+};
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+CPU_TARGET("avx2")
+size_t Base16EncodeAVX2(const uint8_t* input, size_t size, uint8_t* output)
+{
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)Base16Alphabet));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(input + i));
+        __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+        __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, mask));
+        __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i*)(output + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i*)(output + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t Base16DecodeAVX2(const uint8_t* input, size_t size, uint8_t* output)
+{
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(input + i));
+
+        // Validate and convert digits and letters of any case
+        __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+        __m256i l = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        __m256i dm = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+        __m256i lm = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+        if (_mm256_movemask_epi8(_mm256_or_si256(dm, lm)) != -1)
+            break;
+        __m256i n = _mm256_blendv_epi8(_mm256_add_epi8(l, _mm256_set1_epi8(10)), d, dm);
+
+        // Merge nibbles pairs into bytes
+        __m256i w = _mm256_maddubs_epi16(n, _mm256_set1_epi16(0x0110));
+        __m256i p = _mm256_permute4x64_epi64(_mm256_packus_epi16(w, w), 0x08);
+        _mm_storeu_si128((__m128i*)(output + i / 2), _mm256_castsi256_si128(p));
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t Base32EncodeAVX2(const uint8_t* input, size_t size, uint8_t* output)
+{
+    // Each 128-bit lane encodes two 5 bytes groups placed into 64-bit words
+    const __m256i spread = _mm256_setr_epi8(
+        4, 3, 2, 1, 0, -1, -1, -1, 9, 8, 7, 6, 5, -1, -1, -1,
+        4, 3, 2, 1, 0, -1, -1, -1, 9, 8, 7, 6, 5, -1, -1, -1);
+    const __m256i reverse = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 26) <= size; i += 20, j += 32)
+    {
+        __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(input + i))), _mm_loadu_si128((const __m128i*)(input + i + 10)), 1);
+        v = _mm256_shuffle_epi8(v, spread);
+
+        // Split 40 bits into 20, 10 and 5 bits fields
+        __m256i t = _mm256_or_si256(_mm256_and_si256(v, _mm256_set1_epi64x(0xFFFFF)), _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(v, 20), _mm256_set1_epi64x(0xFFFFF)), 32));
+        __m256i u = _mm256_or_si256(_mm256_and_si256(t, _mm256_set1_epi32(0x3FF)), _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(t, 10), _mm256_set1_epi32(0x3FF)), 16));
+        __m256i n = _mm256_or_si256(_mm256_and_si256(u, _mm256_set1_epi16(0x1F)), _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(u, 5), _mm256_set1_epi16(0x1F)), 8));
+        n = _mm256_shuffle_epi8(n, reverse);
+
+        // Translate quintets into ASCII
+        __m256i letters = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), n);
+        __m256i r = _mm256_add_epi8(n, _mm256_blendv_epi8(_mm256_set1_epi8('2' - 26), _mm256_set1_epi8('A'), letters));
+        _mm256_storeu_si256((__m256i*)(output + j), r);
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t Base32DecodeAVX2(const uint8_t* input, size_t size, uint8_t* output)
+{
+    const __m256i pack = _mm256_setr_epi8(
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 32) <= size; i += 32, j += 20)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(input + i));
+
+        // Validate and convert letters of any case and digits
+        __m256i l = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('2'));
+        __m256i lm = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(25)), l);
+        __m256i dm = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(5)), d);
+        if (_mm256_movemask_epi8(_mm256_or_si256(lm, dm)) != -1)
+            break;
+        __m256i n = _mm256_blendv_epi8(_mm256_add_epi8(d, _mm256_set1_epi8(26)), l, lm);
+
+        // Merge 5, 10 and 20 bits fields into 40 bits
+        __m256i w = _mm256_maddubs_epi16(n, _mm256_set1_epi16(0x0120));
+        __m256i t = _mm256_madd_epi16(w, _mm256_set1_epi32(0x00010400));
+        __m256i q = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi64(t, 20), _mm256_set1_epi64x(0xFFFFF00000)), _mm256_srli_epi64(t, 32));
+        q = _mm256_shuffle_epi8(q, pack);
+
+        alignas(32) uint8_t buffer[32];
+        _mm256_store_si256((__m256i*)buffer, q);
+        std::memcpy(output + j, buffer, 10);
+        std::memcpy(output + j + 10, buffer + 16, 10);
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t Base64EncodeAVX2(const uint8_t* input, size_t size, uint8_t* output)
+{
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i shift = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 28) <= size; i += 24, j += 32)
+    {
+        // Each 128-bit lane encodes 12 bytes
+        __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(input + i))), _mm_loadu_si128((const __m128i*)(input + i + 12)), 1);
+        v = _mm256_shuffle_epi8(v, shuffle);
+
+        // Split 24 bits into sextets with multiplications
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        __m256i n = _mm256_or_si256(t0, t1);
+
+        // Translate sextets into ASCII with the shifts of alphabet ranges
+        __m256i r = _mm256_subs_epu8(n, _mm256_set1_epi8(51));
+        r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), n), _mm256_set1_epi8(13)));
+        r = _mm256_add_epi8(_mm256_shuffle_epi8(shift, r), n);
+        _mm256_storeu_si256((__m256i*)(output + j), r);
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t Base64DecodeAVX2(const uint8_t* input, size_t size, uint8_t* output)
+{
+    // Nibble classification tables of valid characters
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask = _mm256_set1_epi8(0x2F);
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 32) <= size; i += 32, j += 24)
     {
-        bytes.push_back((uint8_t)(ch / 256));
-        bytes.push_back((uint8_t)(ch % 256));
+        __m256i v = _mm256_loadu_si256((const __m256i*)(input + i));
+
+        // Validate characters
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), mask);
+        __m256i lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(v, mask));
+        __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        if (!_mm256_testz_si256(lo, hi))
+            break;
+
+        // Translate ASCII into sextets
+        __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(v, mask), hi_nibbles));
+        __m256i n = _mm256_add_epi8(v, roll);
+
+        // Merge sextets into 24 bits
+        __m256i w = _mm256_maddubs_epi16(n, _mm256_set1_epi32(0x01400140));
+        __m256i t = _mm256_madd_epi16(w, _mm256_set1_epi32(0x00011000));
+        t = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(t, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+        _mm_storeu_si128((__m128i*)(output + j), _mm256_castsi256_si128(t));
+        _mm_storel_epi64((__m128i*)(output + j + 16), _mm256_extracti128_si256(t, 1));
     }
+    return i;
+}
+
+CPU_TARGET("avx512f,avx512bw")
+size_t Base16EncodeAVX512(const uint8_t* input, size_t size, uint8_t* output)
+{
+    const __m512i lut = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)Base16Alphabet));
+    const __m512i mask = _mm512_set1_epi8(0x0F);
+    const __m512i first = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+    const __m512i second = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+
+    size_t i = 0;
+    for (; (i + 64) <= size; i += 64)
+    {
+        __m512i v = _mm512_loadu_si512((const void*)(input + i));
+        __m512i hi = _mm512_shuffle_epi8(lut, _mm512_and_si512(_mm512_srli_epi16(v, 4), mask));
+        __m512i lo = _mm512_shuffle_epi8(lut, _mm512_and_si512(v, mask));
+        __m512i a = _mm512_unpacklo_epi8(hi, lo);
+        __m512i b = _mm512_unpackhi_epi8(hi, lo);
+        _mm512_storeu_si512((void*)(output + 2 * i), _mm512_permutex2var_epi64(a, first, b));
+        _mm512_storeu_si512((void*)(output + 2 * i + 64), _mm512_permutex2var_epi64(a, second, b));
+    }
+    return i;
+}
+
+CPU_TARGET("avx512f,avx512bw")
+size_t Base16DecodeAVX512(const uint8_t* input, size_t size, uint8_t* output)
+{
+    size_t i = 0;
+    for (; (i + 64) <= size; i += 64)
+    {
+        __m512i v = _mm512_loadu_si512((const void*)(input + i));
+
+        // Validate and convert digits and letters of any case
+        __m512i d = _mm512_sub_epi8(v, _mm512_set1_epi8('0'));
+        __m512i l = _mm512_sub_epi8(_mm512_or_si512(v, _mm512_set1_epi8(0x20)), _mm512_set1_epi8('a'));
+        __mmask64 dm = _mm512_cmple_epu8_mask(d, _mm512_set1_epi8(9));
+        __mmask64 lm = _mm512_cmple_epu8_mask(l, _mm512_set1_epi8(5));
+        if ((dm | lm) != ~(__mmask64)0)
+            break;
+        __m512i n = _mm512_mask_blend_epi8(dm, _mm512_add_epi8(l, _mm512_set1_epi8(10)), d);
+
+        // Merge nibbles pairs into bytes
+        __m512i w = _mm512_maddubs_epi16(n, _mm512_set1_epi16(0x0110));
+        _mm256_storeu_si256((__m256i*)(output + i / 2), _mm512_cvtepi16_epi8(w));
+    }
+    return i;
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi")
+size_t Base32EncodeAVX512(const uint8_t* input, size_t size, uint8_t* output)
+{
+    // Place each 5 bytes group into 64-bit word in the reversed order
+    alignas(64) static const uint8_t spread[64] =
+    {
+        4, 3, 2, 1, 0, 0, 0, 0, 9, 8, 7, 6, 5, 0, 0, 0,
+        14, 13, 12, 11, 10, 0, 0, 0, 19, 18, 17, 16, 15, 0, 0, 0,
+        24, 23, 22, 21, 20, 0, 0, 0, 29, 28, 27, 26, 25, 0, 0, 0,
+        34, 33, 32, 31, 30, 0, 0, 0, 39, 38, 37, 36, 35, 0, 0, 0
+    };
+
+    const __m512i permute = _mm512_load_si512((const void*)spread);
+    const __m512i lut = _mm512_broadcast_i64x4(_mm256_loadu_si256((const __m256i*)Base32Alphabet));
+    const __m512i shifts = _mm512_set1_epi64(0x00050A0F14191E23);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 40) <= size; i += 40, j += 64)
+    {
+        __m512i v = _mm512_maskz_loadu_epi8(0x000000FFFFFFFFFF, (const void*)(input + i));
+        v = _mm512_permutexvar_epi8(permute, v);
+        __m512i n = _mm512_and_si512(_mm512_multishift_epi64_epi8(shifts, v), _mm512_set1_epi8(0x1F));
+        _mm512_storeu_si512((void*)(output + j), _mm512_permutexvar_epi8(n, lut));
+    }
+    return i;
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi")
+size_t Base32DecodeAVX512(const uint8_t* input, size_t size, uint8_t* output)
+{
+    static const Base32Table table((int8_t)0x80);
+    alignas(64) static const uint8_t compact[64] =
+    {
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 20, 19, 18, 17, 16, 28,
+        27, 26, 25, 24, 36, 35, 34, 33, 32, 44, 43, 42, 41, 40, 52, 51,
+        50, 49, 48, 60, 59, 58, 57, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+
+    const __m512i lookup0 = _mm512_loadu_si512((const void*)table.table);
+    const __m512i lookup1 = _mm512_loadu_si512((const void*)(table.table + 64));
+    const __m512i pack = _mm512_load_si512((const void*)compact);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 64) <= size; i += 64, j += 40)
+    {
+        __m512i v = _mm512_loadu_si512((const void*)(input + i));
+        __m512i n = _mm512_permutex2var_epi8(lookup0, v, lookup1);
+        if (_mm512_movepi8_mask(_mm512_or_si512(n, v)) != 0)
+            break;
+
+        // Merge 5, 10 and 20 bits fields into 40 bits
+        __m512i w = _mm512_maddubs_epi16(n, _mm512_set1_epi16(0x0120));
+        __m512i t = _mm512_madd_epi16(w, _mm512_set1_epi32(0x00010400));
+        __m512i q = _mm512_or_si512(_mm512_and_si512(_mm512_slli_epi64(t, 20), _mm512_set1_epi64(0xFFFFF00000)), _mm512_srli_epi64(t, 32));
+        _mm512_mask_storeu_epi8((void*)(output + j), 0x000000FFFFFFFFFF, _mm512_permutexvar_epi8(pack, q));
+    }
+    return i;
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi")
+size_t Base64EncodeAVX512(const uint8_t* input, size_t size, uint8_t* output)
+{
+    const __m512i shuffle = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0A0B090A, 0x0D0E0C0D, 0x10110F10, 0x13141213, 0x16171516,
+        0x191A1819, 0x1C1D1B1C, 0x1F201E1F, 0x22232122, 0x25262425, 0x28292728, 0x2B2C2A2B, 0x2E2F2D2E);
+    const __m512i lut = _mm512_loadu_si512((const void*)Base64Alphabet);
+    const __m512i shifts = _mm512_set1_epi64(0x3036242A1016040A);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 48) <= size; i += 48, j += 64)
+    {
+        __m512i v = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFF, (const void*)(input + i));
+        v = _mm512_permutexvar_epi8(shuffle, v);
+        __m512i n = _mm512_multishift_epi64_epi8(shifts, v);
+        _mm512_storeu_si512((void*)(output + j), _mm512_permutexvar_epi8(n, lut));
+    }
+    return i;
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi")
+size_t Base64DecodeAVX512(const uint8_t* input, size_t size, uint8_t* output)
+{
+    static const Base64Table table((int8_t)0x80);
+    alignas(64) static const uint8_t compact[64] =
+    {
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 18, 17, 16, 22,
+        21, 20, 26, 25, 24, 30, 29, 28, 34, 33, 32, 38, 37, 36, 42, 41,
+        40, 46, 45, 44, 50, 49, 48, 54, 53, 52, 58, 57, 56, 62, 61, 60,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+
+    const __m512i lookup0 = _mm512_loadu_si512((const void*)table.table);
+    const __m512i lookup1 = _mm512_loadu_si512((const void*)(table.table + 64));
+    const __m512i pack = _mm512_load_si512((const void*)compact);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 64) <= size; i += 64, j += 48)
+    {
+        __m512i v = _mm512_loadu_si512((const void*)(input + i));
+        __m512i n = _mm512_permutex2var_epi8(lookup0, v, lookup1);
+        if (_mm512_movepi8_mask(_mm512_or_si512(n, v)) != 0)
+            break;
+
+        // Merge sextets into 24 bits
+        __m512i w = _mm512_maddubs_epi16(n, _mm512_set1_epi32(0x01400140));
+        __m512i t = _mm512_madd_epi16(w, _mm512_set1_epi32(0x00011000));
+        _mm512_mask_storeu_epi8((void*)(output + j), 0x0000FFFFFFFFFFFF, _mm512_permutexvar_epi8(pack, t));
+    }
+    return i;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+size_t Base16EncodeNEON(const uint8_t* input, size_t size, uint8_t* output)
+{
+    const uint8x16_t lut = vld1q_u8((const uint8_t*)Base16Alphabet);
+
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(input + i);
+        uint8x16x2_t r;
+        r.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(v, 4));
+        r.val[1] = vqtbl1q_u8(lut, vandq_u8(v, vdupq_n_u8(0x0F)));
+        vst2q_u8(output + 2 * i, r);
+    }
+    return i;
+}
+
+inline uint32_t Base16DecodeNibblesNEON(uint8x16_t v, uint8x16_t& n)
+{
+    // Validate and convert digits and letters of any case
+    uint8x16_t d = vsubq_u8(v, vdupq_n_u8('0'));
+    uint8x16_t l = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t dm = vcleq_u8(d, vdupq_n_u8(9));
+    uint8x16_t lm = vcleq_u8(l, vdupq_n_u8(5));
+    n = vbslq_u8(dm, d, vaddq_u8(l, vdupq_n_u8(10)));
+    return vminvq_u8(vorrq_u8(dm, lm));
+}
+
+size_t Base16DecodeNEON(const uint8_t* input, size_t size, uint8_t* output)
+{
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        uint8x16x2_t v = vld2q_u8(input + i);
+        uint8x16_t hi;
+        uint8x16_t lo;
+        if ((Base16DecodeNibblesNEON(v.val[0], hi) & Base16DecodeNibblesNEON(v.val[1], lo)) != 0xFF)
+            break;
+        vst1q_u8(output + i / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+    }
+    return i;
+}
+
+size_t Base32EncodeNEON(const uint8_t* input, size_t size, uint8_t* output)
+{
+    // Vector encodes two 5 bytes groups placed into 64-bit words
+    static const uint8_t spread[16] = { 4, 3, 2, 1, 0, 0xFF, 0xFF, 0xFF, 9, 8, 7, 6, 5, 0xFF, 0xFF, 0xFF };
+    const uint8x16_t permute = vld1q_u8(spread);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 16) <= size; i += 10, j += 16)
+    {
+        uint64x2_t v = vreinterpretq_u64_u8(vqtbl1q_u8(vld1q_u8(input + i), permute));
+
+        // Split 40 bits into 20, 10 and 5 bits fields
+        uint64x2_t t = vorrq_u64(vandq_u64(v, vdupq_n_u64(0xFFFFF)), vshlq_n_u64(vandq_u64(vshrq_n_u64(v, 20), vdupq_n_u64(0xFFFFF)), 32));
+        uint32x4_t t32 = vreinterpretq_u32_u64(t);
+        uint32x4_t u = vorrq_u32(vandq_u32(t32, vdupq_n_u32(0x3FF)), vshlq_n_u32(vandq_u32(vshrq_n_u32(t32, 10), vdupq_n_u32(0x3FF)), 16));
+        uint16x8_t u16 = vreinterpretq_u16_u32(u);
+        uint16x8_t w = vorrq_u16(vandq_u16(u16, vdupq_n_u16(0x1F)), vshlq_n_u16(vandq_u16(vshrq_n_u16(u16, 5), vdupq_n_u16(0x1F)), 8));
+        uint8x16_t n = vrev64q_u8(vreinterpretq_u8_u16(w));
+
+        // Translate quintets into ASCII
+        uint8x16_t r = vaddq_u8(n, vbslq_u8(vcltq_u8(n, vdupq_n_u8(26)), vdupq_n_u8('A'), vdupq_n_u8('2' - 26)));
+        vst1q_u8(output + j, r);
+    }
+    return i;
+}
+
+size_t Base32DecodeNEON(const uint8_t* input, size_t size, uint8_t* output)
+{
+    static const uint8_t compact[16] = { 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    const uint8x16_t pack = vld1q_u8(compact);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 16) <= size; i += 16, j += 10)
+    {
+        uint8x16_t v = vld1q_u8(input + i);
+
+        // Validate and convert letters of any case and digits
+        uint8x16_t l = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+        uint8x16_t d = vsubq_u8(v, vdupq_n_u8('2'));
+        uint8x16_t lm = vcleq_u8(l, vdupq_n_u8(25));
+        uint8x16_t dm = vcleq_u8(d, vdupq_n_u8(5));
+        if (vminvq_u8(vorrq_u8(lm, dm)) != 0xFF)
+            break;
+        uint8x16_t n = vbslq_u8(lm, l, vaddq_u8(d, vdupq_n_u8(26)));
+
+        // Merge 5, 10 and 20 bits fields into 40 bits
+        uint16x8_t n16 = vreinterpretq_u16_u8(n);
+        uint16x8_t w = vorrq_u16(vshlq_n_u16(vandq_u16(n16, vdupq_n_u16(0xFF)), 5), vshrq_n_u16(n16, 8));
+        uint32x4_t w32 = vreinterpretq_u32_u16(w);
+        uint32x4_t t = vorrq_u32(vshlq_n_u32(vandq_u32(w32, vdupq_n_u32(0xFFFF)), 10), vshrq_n_u32(w32, 16));
+        uint64x2_t t64 = vreinterpretq_u64_u32(t);
+        uint64x2_t q = vorrq_u64(vshlq_n_u64(vandq_u64(t64, vdupq_n_u64(0xFFFFFFFF)), 20), vshrq_n_u64(t64, 32));
+
+        uint8_t buffer[16];
+        vst1q_u8(buffer, vqtbl1q_u8(vreinterpretq_u8_u64(q), pack));
+        std::memcpy(output + j, buffer, 10);
+    }
+    return i;
+}
+
+size_t Base64EncodeNEON(const uint8_t* input, size_t size, uint8_t* output)
+{
+    uint8x16x4_t lut;
+    lut.val[0] = vld1q_u8((const uint8_t*)Base64Alphabet + 0);
+    lut.val[1] = vld1q_u8((const uint8_t*)Base64Alphabet + 16);
+    lut.val[2] = vld1q_u8((const uint8_t*)Base64Alphabet + 32);
+    lut.val[3] = vld1q_u8((const uint8_t*)Base64Alphabet + 48);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 48) <= size; i += 48, j += 64)
+    {
+        uint8x16x3_t v = vld3q_u8(input + i);
+        uint8x16x4_t r;
+        r.val[0] = vqtbl4q_u8(lut, vshrq_n_u8(v.val[0], 2));
+        r.val[1] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4), vshrq_n_u8(v.val[1], 4)), mask));
+        r.val[2] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2), vshrq_n_u8(v.val[2], 6)), mask));
+        r.val[3] = vqtbl4q_u8(lut, vandq_u8(v.val[2], mask));
+        vst4q_u8(output + j, r);
+    }
+    return i;
+}
+
+size_t Base64DecodeNEON(const uint8_t* input, size_t size, uint8_t* output)
+{
+    static const Base64Table table((int8_t)0xFF);
+    uint8x16x4_t lut0;
+    uint8x16x4_t lut1;
+    for (int k = 0; k < 4; ++k)
+    {
+        lut0.val[k] = vld1q_u8((const uint8_t*)table.table + 16 * k);
+        lut1.val[k] = vld1q_u8((const uint8_t*)table.table + 64 + 16 * k);
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    for (; (i + 64) <= size; i += 64, j += 48)
+    {
+        uint8x16x4_t v = vld4q_u8(input + i);
+
+        // Translate ASCII into sextets (each lookup gives zero for indexes out of its range)
+        uint8x16_t n[4];
+        uint8x16_t error = vdupq_n_u8(0);
+        for (int k = 0; k < 4; ++k)
+        {
+            n[k] = vorrq_u8(vqtbl4q_u8(lut0, v.val[k]), vqtbl4q_u8(lut1, veorq_u8(v.val[k], vdupq_n_u8(0x40))));
+            error = vorrq_u8(error, vorrq_u8(n[k], v.val[k]));
+        }
+        if (vmaxvq_u8(error) >= 0x80)
+            break;
+
+        uint8x16x3_t r;
+        r.val[0] = vorrq_u8(vshlq_n_u8(n[0], 2), vshrq_n_u8(n[1], 4));
+        r.val[1] = vorrq_u8(vshlq_n_u8(n[1], 4), vshrq_n_u8(n[2], 2));
+        r.val[2] = vorrq_u8(vshlq_n_u8(n[2], 6), n[3]);
+        vst3q_u8(output + j, r);
+    }
+    return i;
+}
 
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf16<uint32_t>, uint32_t> convert;
-    auto tmp = convert.from_bytes(bytes);
-    return std::u32string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> convert;
-    return convert.from_bytes(bytes);
 #endif
+
+CodecFunction ResolveBase16Encode([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx512bw)
+        return Base16EncodeAVX512;
+    if (features.avx2)
+        return Base16EncodeAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return Base16EncodeNEON;
+#endif
+    return CodecScalar;
 }
 
-std::string Encoding::UTF32toUTF8(std::u32string_view str)
+CodecFunction ResolveBase16Decode([[maybe_unused]] const CPUFeatures& features)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convert;
-    return convert.to_bytes((uint32_t*)str.data(), (uint32_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convert;
-    return convert.to_bytes(str.data(), str.data() + str.size());
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx512bw)
+        return Base16DecodeAVX512;
+    if (features.avx2)
+        return Base16DecodeAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return Base16DecodeNEON;
 #endif
+    return CodecScalar;
 }
 
-std::u16string Encoding::UTF32toUTF16(std::u32string_view str)
+CodecFunction ResolveBase32Encode([[maybe_unused]] const CPUFeatures& features)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf16<uint32_t>, uint32_t> convert;
-    std::string bytes = convert.to_bytes((uint32_t*)str.data(), (uint32_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> convert;
-    std::string bytes = convert.to_bytes(str.data(), str.data() + str.size());
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx512bw && features.avx512vbmi)
+        return Base32EncodeAVX512;
+    if (features.avx2)
+        return Base32EncodeAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return Base32EncodeNEON;
 #endif
+    return CodecScalar;
+}
 
-    std::u16string result;
-    result.reserve(bytes.size() / 2);
+CodecFunction ResolveBase32Decode([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx512bw && features.avx512vbmi)
+        return Base32DecodeAVX512;
+    if (features.avx2)
+        return Base32DecodeAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return Base32DecodeNEON;
+#endif
+    return CodecScalar;
+}
 
-    for (size_t i = 0; i < bytes.size(); i += 2)
-        result.push_back((char16_t)((uint8_t)(bytes[i]) * 256 + (uint8_t)(bytes[i + 1])));
+CodecFunction ResolveBase64Encode([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx512bw && features.avx512vbmi)
+        return Base64EncodeAVX512;
+    if (features.avx2)
+        return Base64EncodeAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return Base64EncodeNEON;
+#endif
+    return CodecScalar;
+}
 
-    return result;
+CodecFunction ResolveBase64Decode([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx512bw && features.avx512vbmi)
+        return Base64DecodeAVX512;
+    if (features.avx2)
+        return Base64DecodeAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return Base64DecodeNEON;
+#endif
+    return CodecScalar;
+}
+
+} // namespace Internals
+//! @endcond
+
+size_t Encoding::Base16DecodeSize(std::string_view str) noexcept
+{
+    size_t ilength = str.length();
+    return ((ilength % 2) == 0) ? (ilength / 2) : 0;
 }
 
 std::string Encoding::Base16Encode(std::string_view str)
 {
-    const char base16[] = "0123456789ABCDEF";
+    std::string result(Base16EncodeSize(str.length()), 0);
+    Base16Encode(str, result.data(), result.size());
+    return result;
+}
+
+size_t Encoding::Base16Encode(std::string_view str, char* buffer, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, uint8_t*)> dispatch(Internals::ResolveBase16Encode);
 
     size_t ilength = str.length();
-    size_t olength = ilength * 2;
+    size_t olength = Base16EncodeSize(ilength);
 
-    std::string result;
-    result.resize(olength, 0);
+    if ((buffer == nullptr) || (size < olength))
+        return 0;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
+
+    // Encode the bulk of the string with vectorized implementation
+    size_t i = dispatch(input, ilength, output);
+
+    for (size_t j = i * 2; i < ilength;)
     {
-        uint8_t ch = (uint8_t)str[i++];
+        uint8_t ch = input[i++];
 
-        result[j++] = base16[(ch & 0xF0) >> 4];
-        result[j++] = base16[(ch & 0x0F) >> 0];
+        output[j++] = Internals::Base16Alphabet[(ch & 0xF0) >> 4];
+        output[j++] = Internals::Base16Alphabet[(ch & 0x0F) >> 0];
     }
 
-    return result;
+    return olength;
 }
 
 std::string Encoding::Base16Decode(std::string_view str)
 {
+    std::string result(Base16DecodeSize(str), 0);
+    result.resize(Base16Decode(str, result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::Base16Decode(std::string_view str, char* buffer, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, uint8_t*)> dispatch(Internals::ResolveBase16Decode);
+
     static const unsigned char base16[128] =
     {
         0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -178,44 +1364,79 @@ std::string Encoding::Base16Decode(std::string_view str)
 
     assert(((ilength % 2) == 0) && "Invalid Base16 sting!");
     if ((ilength % 2) != 0)
-        return "";
+        return 0;
 
     size_t olength = ilength / 2;
 
-    std::string result;
-    result.resize(olength, 0);
+    if ((buffer == nullptr) || (size < olength))
+        return 0;
+
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    // Decode the bulk of the string with vectorized implementation (stops at invalid characters)
+    size_t i = dispatch(input, ilength, output);
+
+    for (size_t j = i / 2; i < ilength;)
     {
-        uint8_t a = (uint8_t)str[i++];
-        uint8_t b = (uint8_t)str[i++];
+        uint8_t a = input[i++];
+        uint8_t b = input[i++];
 
         // Validate ASCII
         assert(((a < 0x80) && (b < 0x80)) && "Invalid Base16 content!");
         if ((a >= 0x80) || (b >= 0x80))
-            return "";
+            return 0;
 
         // Convert ASCII to Base16
         a = base16[a];
         b = base16[b];
 
-        result[j++] = ((a << 4) | b);
+        output[j++] = ((a << 4) | b);
     }
 
-    return result;
+    return olength;
+}
+
+size_t Encoding::Base32DecodeSize(std::string_view str) noexcept
+{
+    size_t ilength = str.length();
+    if ((ilength % 8) != 0)
+        return 0;
+
+    size_t padding = 0;
+    while ((padding < std::min(ilength, (size_t)6)) && (str[ilength - 1 - padding] == '='))
+        ++padding;
+
+    // Padding of 1, 3, 4 and 6 characters removes one more decoded byte each
+    return (ilength / 8) * 5 - ((padding >= 1) + (padding >= 3) + (padding >= 4) + (padding >= 6));
 }
 
 std::string Encoding::Base32Encode(std::string_view str)
 {
-    const char base32[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567=";
+    std::string result(Base32EncodeSize(str.length()), 0);
+    Base32Encode(str, result.data(), result.size());
+    return result;
+}
+
+size_t Encoding::Base32Encode(std::string_view str, char* buffer, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, uint8_t*)> dispatch(Internals::ResolveBase32Encode);
+
+    const char* base32 = Internals::Base32Alphabet;
 
     size_t ilength = str.length();
-    size_t olength = ((ilength / 5) * 8) + ((ilength % 5) ? 8 : 0);
+    size_t olength = Base32EncodeSize(ilength);
 
-    std::string result;
-    result.resize(olength, 0);
+    if ((buffer == nullptr) || (size < olength))
+        return 0;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
+
+    // Encode the bulk of the string with vectorized implementation
+    size_t i = dispatch(input, ilength, output);
+
+    for (size_t j = (i / 5) * 8; i < ilength;)
     {
         size_t block = ((ilength - i) < 5 ? (ilength - i) : 5);
         uint8_t n1, n2, n3, n4, n5, n6, n7, n8;
@@ -224,22 +1445,22 @@ std::string Encoding::Base32Encode(std::string_view str)
         switch (block)
         {
             case 5:
-                n8  = (((uint8_t)str[i + 4] & 0x1F) >> 0);
-                n7  = (((uint8_t)str[i + 4] & 0xE0) >> 5);
+                n8  = ((input[i + 4] & 0x1F) >> 0);
+                n7  = ((input[i + 4] & 0xE0) >> 5);
             case 4:
-                n7 |= (((uint8_t)str[i + 3] & 0x03) << 3);
-                n6  = (((uint8_t)str[i + 3] & 0x7C) >> 2);
-                n5  = (((uint8_t)str[i + 3] & 0x80) >> 7);
+                n7 |= ((input[i + 3] & 0x03) << 3);
+                n6  = ((input[i + 3] & 0x7C) >> 2);
+                n5  = ((input[i + 3] & 0x80) >> 7);
             case 3:
-                n5 |= (((uint8_t)str[i + 2] & 0x0F) << 1);
-                n4  = (((uint8_t)str[i + 2] & 0xF0) >> 4);
+                n5 |= ((input[i + 2] & 0x0F) << 1);
+                n4  = ((input[i + 2] & 0xF0) >> 4);
             case 2:
-                n4 |= (((uint8_t)str[i + 1] & 0x01) << 4);
-                n3  = (((uint8_t)str[i + 1] & 0x3E) >> 1);
-                n2  = (((uint8_t)str[i + 1] & 0xC0) >> 6);
+                n4 |= ((input[i + 1] & 0x01) << 4);
+                n3  = ((input[i + 1] & 0x3E) >> 1);
+                n2  = ((input[i + 1] & 0xC0) >> 6);
             case 1:
-                n2 |= (((uint8_t)str[i + 0] & 0x07) << 2);
-                n1  = (((uint8_t)str[i + 0] & 0xF8) >> 3);
+                n2 |= ((input[i + 0] & 0x07) << 2);
+                n1  = ((input[i + 0] & 0xF8) >> 3);
                 break;
             default:
                 assert(false && "Invalid Base32 operation!");
@@ -270,21 +1491,30 @@ std::string Encoding::Base32Encode(std::string_view str)
         }
 
         // 8 outputs
-        result[j++] = base32[n1];
-        result[j++] = base32[n2];
-        result[j++] = base32[n3];
-        result[j++] = base32[n4];
-        result[j++] = base32[n5];
-        result[j++] = base32[n6];
-        result[j++] = base32[n7];
-        result[j++] = base32[n8];
+        output[j++] = base32[n1];
+        output[j++] = base32[n2];
+        output[j++] = base32[n3];
+        output[j++] = base32[n4];
+        output[j++] = base32[n5];
+        output[j++] = base32[n6];
+        output[j++] = base32[n7];
+        output[j++] = base32[n8];
     }
 
-    return result;
+    return olength;
 }
 
 std::string Encoding::Base32Decode(std::string_view str)
 {
+    std::string result(Base32DecodeSize(str), 0);
+    result.resize(Base32Decode(str, result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::Base32Decode(std::string_view str, char* buffer, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, uint8_t*)> dispatch(Internals::ResolveBase32Decode);
+
     static const unsigned char base32[128] =
     {
         0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -309,29 +1539,34 @@ std::string Encoding::Base32Decode(std::string_view str)
 
     assert(((ilength % 8) == 0) && "Invalid Base32 sting!");
     if ((ilength % 8) != 0)
-        return "";
+        return 0;
 
-    size_t olength = (ilength / 8) * 5;
+    if ((buffer == nullptr) || (size < Base32DecodeSize(str)))
+        return 0;
 
-    std::string result;
-    result.resize(olength, 0);
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    // Decode the bulk of the string without the last padded block with vectorized implementation (stops at invalid characters)
+    size_t i = (ilength > 8) ? dispatch(input, ilength - 8, output) : 0;
+    size_t j = (i / 8) * 5;
+
+    while (i < ilength)
     {
         // 8 inputs
-        uint8_t n1 = (uint8_t)str[i++];
-        uint8_t n2 = (uint8_t)str[i++];
-        uint8_t n3 = (uint8_t)str[i++];
-        uint8_t n4 = (uint8_t)str[i++];
-        uint8_t n5 = (uint8_t)str[i++];
-        uint8_t n6 = (uint8_t)str[i++];
-        uint8_t n7 = (uint8_t)str[i++];
-        uint8_t n8 = (uint8_t)str[i++];
+        uint8_t n1 = input[i++];
+        uint8_t n2 = input[i++];
+        uint8_t n3 = input[i++];
+        uint8_t n4 = input[i++];
+        uint8_t n5 = input[i++];
+        uint8_t n6 = input[i++];
+        uint8_t n7 = input[i++];
+        uint8_t n8 = input[i++];
 
         // Validate ASCII
         assert(((n1 < 0x80) && (n2 < 0x80) && (n3 < 0x80) && (n4 < 0x80) && (n5 < 0x80) && (n6 < 0x80) && (n7 < 0x80) && (n8 < 0x80)) && "Invalid Base32 content!");
         if ((n1 >= 0x80) || (n2 >= 0x80) || (n3 >= 0x80) || (n4 >= 0x80) || (n5 >= 0x80) || (n6 >= 0x80) || (n7 >= 0x80) || (n8 >= 0x80))
-            return "";
+            return 0;
 
         // Convert ASCII to Base32
         n1 = base32[n1];
@@ -346,77 +1581,124 @@ std::string Encoding::Base32Decode(std::string_view str)
         // Validate Base32
         assert(((n1 <= 31) && (n2 <= 31)) && "Invalid Base32 content!");
         if ((n1 > 31) || (n2 > 31))
-            return "";
+            return 0;
 
         // The following can be padding
         assert(((n3 <= 32) && (n4 <= 32) && (n5 <= 32) && (n6 <= 32) && (n7 <= 32) && (n8 <= 32)) && "Invalid Base32 content!");
         if ((n3 > 32) || (n4 > 32) || (n5 > 32) || (n6 > 32) || (n7 > 32) || (n8 > 32))
-            return "";
+            return 0;
 
         // 5 outputs
-        result[j++] = ((n1 & 0x1f) << 3) | ((n2 & 0x1c) >> 2);
-        result[j++] = ((n2 & 0x03) << 6) | ((n3 & 0x1f) << 1) | ((n4 & 0x10) >> 4);
-        result[j++] = ((n4 & 0x0f) << 4) | ((n5 & 0x1e) >> 1);
-        result[j++] = ((n5 & 0x01) << 7) | ((n6 & 0x1f) << 2) | ((n7 & 0x18) >> 3);
-        result[j++] = ((n7 & 0x07) << 5) | ((n8 & 0x1f));
+        uint8_t block[5];
+        block[0] = ((n1 & 0x1f) << 3) | ((n2 & 0x1c) >> 2);
+        block[1] = ((n2 & 0x03) << 6) | ((n3 & 0x1f) << 1) | ((n4 & 0x10) >> 4);
+        block[2] = ((n4 & 0x0f) << 4) | ((n5 & 0x1e) >> 1);
+        block[3] = ((n5 & 0x01) << 7) | ((n6 & 0x1f) << 2) | ((n7 & 0x18) >> 3);
+        block[4] = ((n7 & 0x07) << 5) | ((n8 & 0x1f));
 
         // Padding
+        size_t count = 5;
         if (n8 == 32)
         {
-            result.resize(result.size() - 1);
+            --count;
             assert((((n7 == 32) && (n6 == 32)) || (n7 != 32)) && "Invalid Base32 content!");
             if (n6 == 32)
             {
-                result.resize(result.size() - 1);
+                --count;
                 if (n5 == 32)
                 {
-                    result.resize(result.size() - 1);
+                    --count;
                     assert((((n4 == 32) && (n3 == 32)) || (n4 != 32)) && "Invalid Base32 content!");
                     if (n3 == 32)
                     {
-                        result.resize(result.size() - 1);
+                        --count;
                     }
                 }
             }
         }
+
+        // Constant size copy of full blocks is inlined
+        if (count == 5)
+            std::memcpy(output + j, block, 5);
+        else
+            std::memcpy(output + j, block, count);
+        j += count;
     }
 
-    return result;
+    return j;
+}
+
+size_t Encoding::Base64DecodeSize(std::string_view str) noexcept
+{
+    size_t ilength = str.length();
+    if ((ilength == 0) || ((ilength % 4) != 0))
+        return 0;
+
+    size_t olength = ilength / 4 * 3;
+
+    if (str[ilength - 1] == '=') olength--;
+    if (str[ilength - 2] == '=') olength--;
+
+    return olength;
 }
 
 std::string Encoding::Base64Encode(std::string_view str)
 {
-    const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result(Base64EncodeSize(str.length()), 0);
+    Base64Encode(str, result.data(), result.size());
+    return result;
+}
+
+size_t Encoding::Base64Encode(std::string_view str, char* buffer, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, uint8_t*)> dispatch(Internals::ResolveBase64Encode);
+
+    const char* base64 = Internals::Base64Alphabet;
     const size_t mods[] = { 0, 2, 1 };
 
     size_t ilength = str.length();
-    size_t olength = 4 * ((ilength + 2) / 3);
+    size_t olength = Base64EncodeSize(ilength);
 
-    std::string result;
-    result.resize(olength, 0);
+    if ((buffer == nullptr) || (size < olength))
+        return 0;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
+
+    // Encode the bulk of the string with vectorized implementation
+    size_t i = dispatch(input, ilength, output);
+
+    for (size_t j = (i / 3) * 4; i < ilength;)
     {
-        uint32_t octet_a = i < ilength ? (uint8_t)str[i++] : 0;
-        uint32_t octet_b = i < ilength ? (uint8_t)str[i++] : 0;
-        uint32_t octet_c = i < ilength ? (uint8_t)str[i++] : 0;
+        uint32_t octet_a = i < ilength ? input[i++] : 0;
+        uint32_t octet_b = i < ilength ? input[i++] : 0;
+        uint32_t octet_c = i < ilength ? input[i++] : 0;
 
         uint32_t triple = (octet_a << 0x10) + (octet_b << 0x08) + octet_c;
 
-        result[j++] = base64[(triple >> 3 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 2 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 1 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 0 * 6) & 0x3F];
+        output[j++] = base64[(triple >> 3 * 6) & 0x3F];
+        output[j++] = base64[(triple >> 2 * 6) & 0x3F];
+        output[j++] = base64[(triple >> 1 * 6) & 0x3F];
+        output[j++] = base64[(triple >> 0 * 6) & 0x3F];
     }
 
-    for (size_t i = 0; i < mods[ilength % 3]; ++i)
-        result[result.size() - 1 - i] = '=';
+    for (size_t k = 0; k < mods[ilength % 3]; ++k)
+        output[olength - 1 - k] = '=';
 
-    return result;
+    return olength;
 }
 
 std::string Encoding::Base64Decode(std::string_view str)
 {
+    std::string result(Base64DecodeSize(str), 0);
+    result.resize(Base64Decode(str, result.data(), result.size()));
+    return result;
+}
+
+size_t Encoding::Base64Decode(std::string_view str, char* buffer, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, uint8_t*)> dispatch(Internals::ResolveBase64Decode);
+
     static const unsigned char base64[256] =
     {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -440,100 +1722,297 @@ std::string Encoding::Base64Decode(std::string_view str)
     size_t ilength = str.length();
 
     if (ilength % 4 != 0)
-        return "";
+        return 0;
 
-    size_t olength = ilength / 4 * 3;
+    size_t olength = Base64DecodeSize(str);
 
-    if (str[ilength - 1] == '=') olength--;
-    if (str[ilength - 2] == '=') olength--;
+    if ((buffer == nullptr) || (size < olength))
+        return 0;
+
+    const uint8_t* input = (const uint8_t*)str.data();
+    uint8_t* output = (uint8_t*)buffer;
 
-    std::string result;
-    result.resize(olength, 0);
+    // Decode the bulk of the string without the last padded block with vectorized implementation (stops at invalid characters)
+    size_t i = (ilength > 4) ? dispatch(input, ilength - 4, output) : 0;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    for (size_t j = (i / 4) * 3; i < ilength;)
     {
-        uint32_t sextet_a = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_b = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_c = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_d = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
+        uint32_t sextet_a = input[i] == '=' ? 0 & i++ : base64[input[i++]];
+        uint32_t sextet_b = input[i] == '=' ? 0 & i++ : base64[input[i++]];
+        uint32_t sextet_c = input[i] == '=' ? 0 & i++ : base64[input[i++]];
+        uint32_t sextet_d = input[i] == '=' ? 0 & i++ : base64[input[i++]];
 
         uint32_t triple = (sextet_a << 3 * 6) + (sextet_b << 2 * 6) + (sextet_c << 1 * 6) + (sextet_d << 0 * 6);
 
-        if (j < olength) result[j++] = (triple >> 2 * 8) & 0xFF;
-        if (j < olength) result[j++] = (triple >> 1 * 8) & 0xFF;
-        if (j < olength) result[j++] = (triple >> 0 * 8) & 0xFF;
+        if (j < olength) output[j++] = (triple >> 2 * 8) & 0xFF;
+        if (j < olength) output[j++] = (triple >> 1 * 8) & 0xFF;
+        if (j < olength) output[j++] = (triple >> 0 * 8) & 0xFF;
+    }
+
+    return olength;
+}
+
+//! @cond INTERNALS
+namespace Internals {
 
+typedef size_t (*ScanFunction)(const uint8_t*, size_t);
+
+// URL unreserved characters are copied as is, all other are encoded
+constexpr std::array<bool, 256> URLPlain = []()
+{
+    std::array<bool, 256> table = {};
+    for (int ch = 0; ch < 256; ++ch)
+        table[ch] = ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || ((ch >= '0') && (ch <= '9')) ||
+                    (ch == '-') || (ch == '.') || (ch == '/') || (ch == '_') || (ch == '~');
+    return table;
+}();
+
+// Hexadecimal digit values (0xFF for invalid digits)
+constexpr std::array<uint8_t, 256> URLHex = []()
+{
+    std::array<uint8_t, 256> table = {};
+    for (int ch = 0; ch < 256; ++ch)
+        table[ch] = ((ch >= '0') && (ch <= '9')) ? (uint8_t)(ch - '0') : ((ch >= 'A') && (ch <= 'F')) ? (uint8_t)(ch - 'A' + 10) : ((ch >= 'a') && (ch <= 'f')) ? (uint8_t)(ch - 'a' + 10) : 0xFF;
+    return table;
+}();
+
+size_t ScanScalar(const uint8_t*, size_t)
+{
+    return 0;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+CPU_TARGET("avx2")
+inline __m256i InRangeAVX2(__m256i v, char lo, char hi)
+{
+    return _mm256_cmpeq_epi8(v, _mm256_max_epu8(_mm256_min_epu8(v, _mm256_set1_epi8(hi)), _mm256_set1_epi8(lo)));
+}
+
+CPU_TARGET("avx2")
+size_t URLEncodeScanAVX2(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i letters = InRangeAVX2(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+        __m256i digits = InRangeAVX2(v, '0', '9');
+        __m256i symbols = _mm256_or_si256(InRangeAVX2(v, '-', '/'), _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('~'))));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(letters, _mm256_or_si256(digits, symbols)));
+        if (mask != 0)
+            return i + std::countr_zero(mask);
     }
+    return i;
+}
 
-    return result;
+CPU_TARGET("avx2")
+size_t URLDecodeScanAVX2(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('%')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('+')));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(special);
+        if (mask != 0)
+            return i + std::countr_zero(mask);
+    }
+    return i;
 }
 
-std::string Encoding::URLEncode(std::string_view str)
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+inline uint8x16_t InRangeNEON(uint8x16_t v, uint8_t lo, uint8_t hi)
 {
-    std::string result;
-    result.reserve(str.size());
+    return vcleq_u8(vsubq_u8(v, vdupq_n_u8(lo)), vdupq_n_u8((uint8_t)(hi - lo)));
+}
 
-    for (char ch : str)
+size_t URLEncodeScanNEON(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
     {
-        if (isalnum(ch) || (ch == '-') || (ch == '.') || (ch == '/') || (ch == '_') || (ch == '~'))
-            result.push_back(ch);
-        else if (ch == ' ')
-            result.push_back('+');
+        uint8x16_t v = vld1q_u8(data + i);
+        uint8x16_t letters = InRangeNEON(vorrq_u8(v, vdupq_n_u8(0x20)), 'a', 'z');
+        uint8x16_t digits = InRangeNEON(v, '0', '9');
+        uint8x16_t symbols = vorrq_u8(InRangeNEON(v, '-', '/'), vorrq_u8(vceqq_u8(v, vdupq_n_u8('_')), vceqq_u8(v, vdupq_n_u8('~'))));
+        // Scalar tail finds the exact position inside the block
+        if (vminvq_u8(vorrq_u8(letters, vorrq_u8(digits, symbols))) == 0)
+            return i;
+    }
+    return i;
+}
+
+size_t URLDecodeScanNEON(const uint8_t* data, size_t size)
+{
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(data + i);
+        // Scalar tail finds the exact position inside the block
+        if (vmaxvq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('%')), vceqq_u8(v, vdupq_n_u8('+')))) != 0)
+            return i;
+    }
+    return i;
+}
+
+#endif
+
+ScanFunction ResolveURLEncodeScan([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return URLEncodeScanAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return URLEncodeScanNEON;
+#endif
+    return ScanScalar;
+}
+
+ScanFunction ResolveURLDecodeScan([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return URLDecodeScanAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return URLDecodeScanNEON;
+#endif
+    return ScanScalar;
+}
+
+size_t URLEncodeScan(const uint8_t* data, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t)> dispatch(ResolveURLEncodeScan);
+
+    size_t i = dispatch(data, size);
+    while ((i < size) && URLPlain[data[i]])
+        ++i;
+    return i;
+}
+
+size_t URLDecodeScan(const uint8_t* data, size_t size)
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t)> dispatch(ResolveURLDecodeScan);
+
+    size_t i = dispatch(data, size);
+    while ((i < size) && (data[i] != '%') && (data[i] != '+'))
+        ++i;
+    return i;
+}
+
+size_t URLEncode(const uint8_t* input, size_t size, uint8_t* output)
+{
+    static const char hex[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < size)
+    {
+        // Copy unreserved characters in bulk
+        size_t run = URLEncodeScan(input + i, size - i);
+        std::memcpy(output + j, input + i, run);
+        i += run;
+        j += run;
+        if (i == size)
+            break;
+
+        uint8_t ch = input[i++];
+        if (ch == ' ')
+            output[j++] = '+';
         else
         {
-            const char hex[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
-            result.push_back('%');
-            result.push_back(hex[(ch >> 4) & 0x0F]);
-            result.push_back(hex[(ch >> 0) & 0x0F]);
+            output[j++] = '%';
+            output[j++] = hex[ch >> 4];
+            output[j++] = hex[ch & 0x0F];
         }
     }
-
-    return result;
+    return j;
 }
 
-std::string Encoding::URLDecode(std::string_view str)
+size_t URLDecode(const uint8_t* input, size_t size, uint8_t* output)
 {
-    std::string result;
-    result.reserve(str.size());
-
-    for (size_t i = 0; i < str.size(); ++i)
+    size_t i = 0;
+    size_t j = 0;
+    while (i < size)
     {
-        char ch = str[i];
-        if (ch == '%')
+        // Copy not encoded characters in bulk (output could overlap input for in-place decoding)
+        size_t run = URLDecodeScan(input + i, size - i);
+        if ((output + j) != (input + i))
+            std::memmove(output + j, input + i, run);
+        i += run;
+        j += run;
+        if (i == size)
+            break;
+
+        if (input[i] == '+')
         {
-            const char hex[] = "0123456789ABCDEF";
+            output[j++] = ' ';
+            ++i;
+            continue;
+        }
 
-            if (++i == str.size())
-            {
-                result.push_back('?');
-                break;
-            }
+        // Invalid or incomplete escape sequence terminates decoding
+        uint8_t hi = ((size - i) > 1) ? URLHex[input[i + 1]] : 0xFF;
+        uint8_t lo = ((size - i) > 2) ? URLHex[input[i + 2]] : 0xFF;
+        if ((hi | lo) == 0xFF)
+        {
+            output[j++] = '?';
+            break;
+        }
 
-            int hi = (int)(std::find(hex, hex + 16, toupper(str[i])) - hex);
+        output[j++] = (uint8_t)((hi << 4) | lo);
+        i += 3;
+    }
+    return j;
+}
 
-            if (++i == str.size())
-            {
-                result.push_back('?');
-                break;
-            }
+} // namespace Internals
+//! @endcond
 
-            int lo = (int)(std::find(hex, hex + 16, toupper(str[i])) - hex);
+size_t Encoding::URLEncodeSize(std::string_view str) noexcept
+{
+    size_t result = 0;
+    for (char ch : str)
+        result += (Internals::URLPlain[(uint8_t)ch] || (ch == ' ')) ? 1 : 3;
+    return result;
+}
 
-            if ((hi >= 16) || (lo >= 16))
-            {
-                result.push_back('?');
-                break;
-            }
+std::string Encoding::URLEncode(std::string_view str)
+{
+    std::string result(str.size() * 3, 0);
+    result.resize(Internals::URLEncode((const uint8_t*)str.data(), str.size(), (uint8_t*)result.data()));
+    return result;
+}
 
-            result.push_back((char)((hi << 4) + lo));
-        }
-        else if (ch == '+')
-            result.push_back(' ');
-        else
-            result.push_back(ch);
-    }
+size_t Encoding::URLEncode(std::string_view str, char* buffer, size_t size)
+{
+    if ((buffer == nullptr) || ((size < (str.size() * 3)) && (size < URLEncodeSize(str))))
+        return 0;
 
+    return Internals::URLEncode((const uint8_t*)str.data(), str.size(), (uint8_t*)buffer);
+}
+
+std::string Encoding::URLDecode(std::string_view str)
+{
+    std::string result(str.size(), 0);
+    result.resize(Internals::URLDecode((const uint8_t*)str.data(), str.size(), (uint8_t*)result.data()));
     return result;
 }
 
+size_t Encoding::URLDecode(std::string_view str, char* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size < str.size()))
+        return 0;
+
+    return Internals::URLDecode((const uint8_t*)str.data(), str.size(), (uint8_t*)buffer);
+}
+
+void Encoding::URLDecodeInPlace(std::string& str)
+{
+    str.resize(Internals::URLDecode((const uint8_t*)str.data(), str.size(), (uint8_t*)str.data()));
+}
+
 } // namespace CppCommon
@@ -0,0 +1,457 @@
+/*!
+    \file encoding_stream.cpp
+    \brief Streaming encoding implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/encoding_stream.h"
+
+#include "errors/exceptions.h"
+#include "string/encoding.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <string_view>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline bool IsSupportedBase(int base) noexcept
+{
+    return (base == 16) || (base == 32) || (base == 64);
+}
+
+// Length of the prefix which consists of complete UTF sequences (the rest is at most 3 bytes)
+template <typename T>
+size_t CompleteUTF(const uint8_t* data, size_t size) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        for (size_t k = size; (k > 0) && ((size - k) < 3); --k)
+        {
+            uint8_t ch = data[k - 1];
+            if ((ch & 0xC0) == 0x80)
+                continue;
+            size_t length = (ch < 0xC2) ? 1 : (ch < 0xE0) ? 2 : (ch < 0xF0) ? 3 : (ch < 0xF5) ? 4 : 1;
+            return ((size - (k - 1)) < length) ? (k - 1) : size;
+        }
+        return size;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        size_t result = size & ~(size_t)1;
+        if (result > 0)
+        {
+            char16_t unit;
+            std::memcpy(&unit, data + result - 2, sizeof(unit));
+            if ((unit >= 0xD800) && (unit <= 0xDBFF))
+                result -= 2;
+        }
+        return result;
+    }
+    else
+        return size & ~(size_t)3;
+}
+
+// Maximal count of output code units for the single input code unit
+template <typename TInput, typename TOutput>
+constexpr size_t UTFExpansion() noexcept
+{
+    if constexpr (sizeof(TOutput) == 1)
+        return (sizeof(TInput) == 1) ? 1 : (sizeof(TInput) == 2) ? 3 : 4;
+    else if constexpr ((sizeof(TOutput) == 2) && (sizeof(TInput) == 4))
+        return 2;
+    else
+        return 1;
+}
+
+template <typename TInput, typename TOutput>
+size_t TranscodeUTF(const TInput* input, size_t size, TOutput* output, size_t capacity)
+{
+    if constexpr ((sizeof(TInput) == 1) && (sizeof(TOutput) == 2))
+        return Encoding::UTF8toUTF16(std::string_view(input, size), output, capacity);
+    else if constexpr ((sizeof(TInput) == 1) && (sizeof(TOutput) == 4))
+        return Encoding::UTF8toUTF32(std::string_view(input, size), output, capacity);
+    else if constexpr ((sizeof(TInput) == 2) && (sizeof(TOutput) == 1))
+        return Encoding::UTF16toUTF8(std::u16string_view(input, size), output, capacity);
+    else if constexpr ((sizeof(TInput) == 2) && (sizeof(TOutput) == 4))
+        return Encoding::UTF16toUTF32(std::u16string_view(input, size), output, capacity);
+    else if constexpr ((sizeof(TInput) == 4) && (sizeof(TOutput) == 1))
+        return Encoding::UTF32toUTF8(std::u32string_view(input, size), output, capacity);
+    else
+        return Encoding::UTF32toUTF16(std::u32string_view(input, size), output, capacity);
+}
+
+} // namespace Internals
+//! @endcond
+
+BaseStreamEncoder::BaseStreamEncoder(int base) : _base(base), _pending_size(0)
+{
+    assert(Internals::IsSupportedBase(base) && "Unsupported Base-N encoding base!");
+    if (!Internals::IsSupportedBase(base))
+        throwex ArgumentException("Unsupported Base-N encoding base!");
+
+    _block = (base == 16) ? 1 : (base == 32) ? 5 : 3;
+    _encoded = (base == 16) ? 2 : (base == 32) ? 8 : 4;
+}
+
+size_t BaseStreamEncoder::OutputSize(size_t size) const noexcept
+{
+    return ((size + _block - 1) / _block + 1) * _encoded;
+}
+
+size_t BaseStreamEncoder::Encode(const uint8_t* input, size_t size, uint8_t* output, size_t capacity) const
+{
+    std::string_view str((const char*)input, size);
+    if (_base == 16)
+        return Encoding::Base16Encode(str, (char*)output, capacity);
+    else if (_base == 32)
+        return Encoding::Base32Encode(str, (char*)output, capacity);
+    else
+        return Encoding::Base64Encode(str, (char*)output, capacity);
+}
+
+size_t BaseStreamEncoder::Update(const void* input, size_t size, void* output, size_t capacity)
+{
+    assert((capacity >= OutputSize(size)) && "Output buffer is too small!");
+    if (capacity < OutputSize(size))
+        throwex ArgumentException("Output buffer is too small!");
+
+    const uint8_t* data = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    size_t result = 0;
+
+    // Complete the pending block
+    if (_pending_size > 0)
+    {
+        size_t count = std::min(_block - _pending_size, size);
+        std::memcpy(_pending + _pending_size, data, count);
+        _pending_size += count;
+        data += count;
+        size -= count;
+        if (_pending_size < _block)
+            return 0;
+        result += Encode(_pending, _block, out, capacity);
+        _pending_size = 0;
+    }
+
+    // Encode the bulk of complete blocks directly from the input
+    size_t bulk = size - (size % _block);
+    if (bulk > 0)
+        result += Encode(data, bulk, out + result, capacity - result);
+
+    // Keep the incomplete block till the next chunk
+    std::memcpy(_pending, data + bulk, size - bulk);
+    _pending_size = size - bulk;
+    return result;
+}
+
+size_t BaseStreamEncoder::Finish(void* output, size_t capacity)
+{
+    assert((capacity >= OutputSize(0)) && "Output buffer is too small!");
+    if (capacity < OutputSize(0))
+        throwex ArgumentException("Output buffer is too small!");
+
+    size_t result = (_pending_size > 0) ? Encode(_pending, _pending_size, (uint8_t*)output, capacity) : 0;
+    Reset();
+    return result;
+}
+
+BaseStreamDecoder::BaseStreamDecoder(int base) : _base(base), _pending_size(0), _padded(false)
+{
+    assert(Internals::IsSupportedBase(base) && "Unsupported Base-N encoding base!");
+    if (!Internals::IsSupportedBase(base))
+        throwex ArgumentException("Unsupported Base-N encoding base!");
+
+    _block = (base == 16) ? 2 : (base == 32) ? 8 : 4;
+    _decoded = (base == 16) ? 1 : (base == 32) ? 5 : 3;
+}
+
+size_t BaseStreamDecoder::OutputSize(size_t size) const noexcept
+{
+    return ((size + _block - 1) / _block + 1) * _decoded;
+}
+
+size_t BaseStreamDecoder::Decode(const uint8_t* input, size_t size, uint8_t* output, size_t capacity)
+{
+    // Padding is allowed only in the last block of the encoded data
+    if (_padded)
+    {
+        Reset();
+        throwex ArgumentException("Invalid Base-N encoded data after the padding!");
+    }
+    const void* padding = std::memchr(input, '=', size);
+    if (padding != nullptr)
+    {
+        if ((size_t)((const uint8_t*)padding - input) < (size - _block))
+        {
+            Reset();
+            throwex ArgumentException("Invalid Base-N encoded data after the padding!");
+        }
+        _padded = true;
+    }
+
+    std::string_view str((const char*)input, size);
+    size_t result = (_base == 16) ? Encoding::Base16Decode(str, (char*)output, capacity) :
+                    (_base == 32) ? Encoding::Base32Decode(str, (char*)output, capacity) :
+                                    Encoding::Base64Decode(str, (char*)output, capacity);
+    if (result == 0)
+    {
+        Reset();
+        throwex ArgumentException("Invalid Base-N encoded data!");
+    }
+    return result;
+}
+
+size_t BaseStreamDecoder::Update(const void* input, size_t size, void* output, size_t capacity)
+{
+    assert((capacity >= OutputSize(size)) && "Output buffer is too small!");
+    if (capacity < OutputSize(size))
+        throwex ArgumentException("Output buffer is too small!");
+
+    const uint8_t* data = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    size_t result = 0;
+
+    // Complete the pending block
+    if (_pending_size > 0)
+    {
+        size_t count = std::min(_block - _pending_size, size);
+        std::memcpy(_pending + _pending_size, data, count);
+        _pending_size += count;
+        data += count;
+        size -= count;
+        if (_pending_size < _block)
+            return 0;
+        _pending_size = 0;
+        result += Decode(_pending, _block, out, capacity);
+    }
+
+    // Decode the bulk of complete blocks directly from the input
+    size_t bulk = size - (size % _block);
+    if (bulk > 0)
+        result += Decode(data, bulk, out + result, capacity - result);
+
+    // Keep the incomplete block till the next chunk
+    if ((size > bulk) && _padded)
+    {
+        Reset();
+        throwex ArgumentException("Invalid Base-N encoded data after the padding!");
+    }
+    std::memcpy(_pending, data + bulk, size - bulk);
+    _pending_size = size - bulk;
+    return result;
+}
+
+size_t BaseStreamDecoder::Finish([[maybe_unused]] void* output, size_t capacity)
+{
+    assert((capacity >= OutputSize(0)) && "Output buffer is too small!");
+    if (capacity < OutputSize(0))
+        throwex ArgumentException("Output buffer is too small!");
+
+    bool incomplete = (_pending_size > 0);
+    Reset();
+    if (incomplete)
+        throwex ArgumentException("Incomplete Base-N encoded data!");
+    return 0;
+}
+
+template <typename TInput, typename TOutput>
+size_t UTFStreamTranscoder<TInput, TOutput>::OutputSize(size_t size) const noexcept
+{
+    // Pending bytes and the partial code unit are at most 7 bytes
+    size_t units = (size + 7) / sizeof(TInput) + 1;
+    return units * Internals::UTFExpansion<TInput, TOutput>() * sizeof(TOutput);
+}
+
+template <typename TInput, typename TOutput>
+size_t UTFStreamTranscoder<TInput, TOutput>::Transcode(const uint8_t* input, size_t size, uint8_t* output, size_t capacity) const
+{
+    if (size == 0)
+        return 0;
+    return Internals::TranscodeUTF((const TInput*)input, size / sizeof(TInput), (TOutput*)output, capacity / sizeof(TOutput)) * sizeof(TOutput);
+}
+
+template <typename TInput, typename TOutput>
+size_t UTFStreamTranscoder<TInput, TOutput>::Update(const void* input, size_t size, void* output, size_t capacity)
+{
+    assert((capacity >= OutputSize(size)) && "Output buffer is too small!");
+    if (capacity < OutputSize(size))
+        throwex ArgumentException("Output buffer is too small!");
+
+    const uint8_t* data = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    size_t result = 0;
+
+    while (size > 0)
+    {
+        // Transcode complete sequences of the aligned input in place
+        if ((_pending_size == 0) && (((uintptr_t)data % alignof(TInput)) == 0))
+        {
+            size_t complete = Internals::CompleteUTF<TInput>(data, size);
+            result += Transcode(data, complete, out + result, capacity - result);
+            std::memcpy(_pending, data + complete, size - complete);
+            _pending_size = size - complete;
+            break;
+        }
+
+        // Pending sequence or misaligned input is transcoded through the aligned scratch buffer
+        alignas(8) uint8_t scratch[4096];
+        size_t count = std::min(size, sizeof(scratch) - _pending_size);
+        std::memcpy(scratch, _pending, _pending_size);
+        std::memcpy(scratch + _pending_size, data, count);
+        size_t total = _pending_size + count;
+        size_t complete = Internals::CompleteUTF<TInput>(scratch, total);
+        result += Transcode(scratch, complete, out + result, capacity - result);
+
+        if (complete > _pending_size)
+        {
+            // Not transcoded bytes of the input will be processed again
+            size_t consumed = complete - _pending_size;
+            _pending_size = 0;
+            data += consumed;
+            size -= consumed;
+        }
+        else
+        {
+            std::memmove(_pending, scratch + complete, total - complete);
+            _pending_size = total - complete;
+            data += count;
+            size -= count;
+        }
+    }
+
+    return result;
+}
+
+template <typename TInput, typename TOutput>
+size_t UTFStreamTranscoder<TInput, TOutput>::Finish(void* output, size_t capacity)
+{
+    assert((capacity >= OutputSize(0)) && "Output buffer is too small!");
+    if (capacity < OutputSize(0))
+        throwex ArgumentException("Output buffer is too small!");
+
+    // Incomplete sequence is decoded into replacement characters
+    alignas(8) uint8_t scratch[8];
+    std::memcpy(scratch, _pending, _pending_size);
+    size_t units = _pending_size - (_pending_size % sizeof(TInput));
+    size_t result = Transcode(scratch, units, (uint8_t*)output, capacity);
+
+    // Partial code unit is also replaced with U+FFFD replacement character
+    if (units < _pending_size)
+    {
+        const char32_t replacement = 0xFFFD;
+        if constexpr (sizeof(TOutput) == 4)
+        {
+            std::memcpy((uint8_t*)output + result, &replacement, sizeof(replacement));
+            result += sizeof(replacement);
+        }
+        else
+            result += Internals::TranscodeUTF(&replacement, 1, (TOutput*)((uint8_t*)output + result), (capacity - result) / sizeof(TOutput)) * sizeof(TOutput);
+    }
+
+    Reset();
+    return result;
+}
+
+//! @cond INTERNALS
+template class UTFStreamTranscoder<char, char16_t>;
+template class UTFStreamTranscoder<char, char32_t>;
+template class UTFStreamTranscoder<char16_t, char>;
+template class UTFStreamTranscoder<char16_t, char32_t>;
+template class UTFStreamTranscoder<char32_t, char>;
+template class UTFStreamTranscoder<char32_t, char16_t>;
+//! @endcond
+
+EncodingReader::EncodingReader(Reader& reader, EncodingStream& stream, size_t chunk)
+    : _reader(reader),
+      _stream(stream),
+      _input(std::max<size_t>(chunk, 1)),
+      _output(stream.OutputSize(std::max<size_t>(chunk, 1))),
+      _offset(0),
+      _size(0),
+      _eof(false)
+{
+}
+
+size_t EncodingReader::Read(void* buffer, size_t size)
+{
+    uint8_t* out = (uint8_t*)buffer;
+    size_t result = 0;
+
+    // Fill the whole buffer, so the short read means the end of the data
+    while (result < size)
+    {
+        if (_offset < _size)
+        {
+            size_t count = std::min(size - result, _size - _offset);
+            std::memcpy(out + result, _output.data() + _offset, count);
+            _offset += count;
+            result += count;
+            continue;
+        }
+
+        if (_eof)
+            break;
+
+        size_t read = _reader.Read(_input.data(), _input.size());
+        if (read == 0)
+        {
+            _eof = true;
+            _size = _stream.Finish(_output.data(), _output.size());
+        }
+        else
+            _size = _stream.Update(_input.data(), read, _output.data(), _output.size());
+        _offset = 0;
+    }
+
+    return result;
+}
+
+EncodingWriter::EncodingWriter(Writer& writer, EncodingStream& stream, size_t chunk)
+    : _writer(writer),
+      _stream(stream),
+      _chunk(std::max<size_t>(chunk, 1)),
+      _output(stream.OutputSize(_chunk))
+{
+}
+
+void EncodingWriter::WriteOutput(size_t size)
+{
+    size_t written = 0;
+    while (written < size)
+    {
+        size_t result = _writer.Write(_output.data() + written, size - written);
+        if (result == 0)
+            throwex RuntimeException("Cannot write encoded data into the target writer!");
+        written += result;
+    }
+}
+
+size_t EncodingWriter::Write(const void* buffer, size_t size)
+{
+    const uint8_t* data = (const uint8_t*)buffer;
+    for (size_t offset = 0; offset < size; offset += _chunk)
+    {
+        size_t count = std::min(_chunk, size - offset);
+        WriteOutput(_stream.Update(data + offset, count, _output.data(), _output.size()));
+    }
+    return size;
+}
+
+void EncodingWriter::Flush()
+{
+    _writer.Flush();
+}
+
+void EncodingWriter::Finish()
+{
+    WriteOutput(_stream.Finish(_output.data(), _output.size()));
+}
+
+} // namespace CppCommon
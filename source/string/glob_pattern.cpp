@@ -0,0 +1,267 @@
+/*!
+    \file glob_pattern.cpp
+    \brief Compiled glob pattern implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/glob_pattern.h"
+
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline char ToLowerASCII(char ch) noexcept
+{
+    return ((uint8_t)(ch - 'A') < 26) ? (char)(ch + ('a' - 'A')) : ch;
+}
+
+inline char ToUpperASCII(char ch) noexcept
+{
+    return ((uint8_t)(ch - 'a') < 26) ? (char)(ch - ('a' - 'A')) : ch;
+}
+
+inline void SetBit(std::array<uint64_t, 4>& bits, char ch) noexcept
+{
+    bits[(uint8_t)ch >> 6] |= (uint64_t)1 << ((uint8_t)ch & 63);
+}
+
+} // namespace Internals
+//! @endcond
+
+GlobPattern::GlobPattern(std::string_view patterns, bool ignore_case) : _patterns(patterns), _ignore_case(ignore_case)
+{
+    // Split patterns by not escaped ';' separators
+    size_t start = 0;
+    for (size_t i = 0; i <= patterns.size(); ++i)
+    {
+        if ((i < patterns.size()) && (patterns[i] == '\\'))
+        {
+            ++i;
+            continue;
+        }
+        if ((i == patterns.size()) || (patterns[i] == ';'))
+        {
+            if (i > start)
+                Compile(patterns.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+}
+
+void GlobPattern::Compile(std::string_view pattern)
+{
+    Rule rule{};
+
+    size_t i = 0;
+    if (pattern[0] == '!')
+    {
+        rule.negative = true;
+        ++i;
+    }
+
+    const size_t start = _tokens.size();
+    bool star = false;
+
+    while (i < pattern.size())
+    {
+        char ch = pattern[i++];
+        if ((ch == '\\') && (i < pattern.size()))
+            _tokens.push_back({ TokenType::LITERAL, _ignore_case ? Internals::ToLowerASCII(pattern[i++]) : pattern[i++], 0 });
+        else if (ch == '*')
+        {
+            // Sequence of stars is the same as a single star
+            if ((_tokens.size() == start) || (_tokens.back().type != TokenType::STAR))
+                _tokens.push_back({ TokenType::STAR, 0, 0 });
+            star = true;
+        }
+        else if (ch == '?')
+            _tokens.push_back({ TokenType::ANY, 0, 0 });
+        else if (ch == '[')
+        {
+            std::array<uint64_t, 4> bits = {};
+            size_t j = i;
+            bool negate = (j < pattern.size()) && ((pattern[j] == '!') || (pattern[j] == '^'));
+            if (negate)
+                ++j;
+
+            // The first ']' of the set is a set character
+            bool closed = false;
+            for (size_t k = j; j < pattern.size();)
+            {
+                char lo = pattern[j];
+                if ((lo == ']') && (j > k))
+                {
+                    closed = true;
+                    ++j;
+                    break;
+                }
+                if ((lo == '\\') && ((j + 1) < pattern.size()))
+                    lo = pattern[++j];
+                ++j;
+
+                char hi = lo;
+                if (((j + 1) < pattern.size()) && (pattern[j] == '-') && (pattern[j + 1] != ']'))
+                {
+                    hi = pattern[j + 1];
+                    j += 2;
+                    if ((hi == '\\') && (j < pattern.size()))
+                        hi = pattern[j++];
+                }
+
+                for (unsigned value = (uint8_t)lo; value <= (uint8_t)hi; ++value)
+                {
+                    Internals::SetBit(bits, (char)value);
+                    if (_ignore_case)
+                    {
+                        Internals::SetBit(bits, Internals::ToLowerASCII((char)value));
+                        Internals::SetBit(bits, Internals::ToUpperASCII((char)value));
+                    }
+                }
+            }
+
+            // Not closed set is a literal '[' character
+            if (!closed)
+                _tokens.push_back({ TokenType::LITERAL, '[', 0 });
+            else
+            {
+                if (negate)
+                    for (auto& word : bits)
+                        word = ~word;
+                _tokens.push_back({ TokenType::SET, 0, (uint32_t)_sets.size() });
+                _sets.push_back(bits);
+                i = j;
+            }
+        }
+        else
+            _tokens.push_back({ TokenType::LITERAL, _ignore_case ? Internals::ToLowerASCII(ch) : ch, 0 });
+    }
+
+    const size_t end = _tokens.size();
+
+    // Extract literal prefix and suffix of the pattern
+    size_t first = start;
+    while ((first < end) && (_tokens[first].type == TokenType::LITERAL))
+        rule.prefix.push_back(_tokens[first++].literal);
+    size_t last = end;
+    while ((last > first) && (_tokens[last - 1].type == TokenType::LITERAL))
+        rule.suffix.insert(rule.suffix.begin(), _tokens[--last].literal);
+
+    rule.fixed = !star;
+    rule.any = true;
+    rule.min_size = 0;
+    for (size_t k = start; k < end; ++k)
+        if (_tokens[k].type != TokenType::STAR)
+            ++rule.min_size;
+    for (size_t k = first; k < last; ++k)
+        if (_tokens[k].type != TokenType::STAR)
+            rule.any = false;
+    rule.first = first;
+    rule.last = last;
+
+    _rules.emplace_back(std::move(rule));
+}
+
+bool GlobPattern::Match(std::string_view str) const noexcept
+{
+    // Empty glob pattern matches all strings
+    if (_rules.empty())
+        return true;
+
+    bool result = false;
+    for (const auto& rule : _rules)
+    {
+        if (MatchRule(rule, str))
+            return !rule.negative;
+
+        // Last negative pattern should success result
+        result = rule.negative;
+    }
+    return result;
+}
+
+bool GlobPattern::MatchRule(const Rule& rule, std::string_view str) const noexcept
+{
+    // Reject by the size, literal prefix and suffix first
+    if ((str.size() < rule.min_size) || (rule.fixed && (str.size() != rule.min_size)))
+        return false;
+    if (!Equal(str.substr(0, rule.prefix.size()), rule.prefix))
+        return false;
+    if (!Equal(str.substr(str.size() - rule.suffix.size()), rule.suffix))
+        return false;
+    if (rule.any)
+        return true;
+
+    str = str.substr(rule.prefix.size(), str.size() - rule.prefix.size() - rule.suffix.size());
+
+    // Backtrack to the last star only, because it could absorb any characters
+    size_t token = rule.first;
+    size_t index = 0;
+    size_t star_token = std::string_view::npos;
+    size_t star_index = 0;
+    while (index < str.size())
+    {
+        if ((token < rule.last) && (_tokens[token].type == TokenType::STAR))
+        {
+            star_token = ++token;
+            star_index = index;
+        }
+        else if ((token < rule.last) && MatchToken(_tokens[token], str[index]))
+        {
+            ++token;
+            ++index;
+        }
+        else if (star_token != std::string_view::npos)
+        {
+            token = star_token;
+            index = ++star_index;
+        }
+        else
+            return false;
+    }
+    while ((token < rule.last) && (_tokens[token].type == TokenType::STAR))
+        ++token;
+    return (token == rule.last);
+}
+
+bool GlobPattern::MatchToken(const Token& token, char ch) const noexcept
+{
+    switch (token.type)
+    {
+        case TokenType::LITERAL:
+            return (token.literal == (_ignore_case ? Internals::ToLowerASCII(ch) : ch));
+        case TokenType::ANY:
+            return true;
+        case TokenType::SET:
+            return ((_sets[token.set][(uint8_t)ch >> 6] >> ((uint8_t)ch & 63)) & 1) != 0;
+        default:
+            return false;
+    }
+}
+
+bool GlobPattern::Equal(std::string_view str1, std::string_view str2) const noexcept
+{
+    if (!_ignore_case)
+        return (str1 == str2);
+
+    for (size_t i = 0; i < str1.size(); ++i)
+        if (Internals::ToLowerASCII(str1[i]) != str2[i])
+            return false;
+    return true;
+}
+
+void GlobPattern::swap(GlobPattern& pattern) noexcept
+{
+    using std::swap;
+    swap(_patterns, pattern._patterns);
+    swap(_ignore_case, pattern._ignore_case);
+    swap(_rules, pattern._rules);
+    swap(_tokens, pattern._tokens);
+    swap(_sets, pattern._sets);
+}
+
+} // namespace CppCommon
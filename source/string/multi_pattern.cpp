@@ -0,0 +1,469 @@
+/*!
+    \file multi_pattern.cpp
+    \brief Compiled multi-pattern substring matcher implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/multi_pattern.h"
+
+#include "errors/exceptions.h"
+#include "system/cpu_dispatch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
+#include <queue>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Teddy kernel returns the offset of the first block with candidates and their mask, or the first offset which was not scanned
+typedef size_t (*TeddyFunction)(const uint8_t* masks, size_t fingerprint, const char* data, size_t size, uint32_t* candidates);
+
+size_t TeddyScalar(const uint8_t*, size_t, const char*, size_t, uint32_t* candidates)
+{
+    // Scalar implementation processes the whole string
+    *candidates = 0;
+    return 0;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Get the buckets of 32 positions which match the fingerprint character with the given masks
+CPU_TARGET("avx2")
+inline __m256i TeddyBucketsAVX2(const char* data, const uint8_t* masks)
+{
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)masks));
+    const __m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(masks + 16)));
+
+    __m256i v = _mm256_loadu_si256((const __m256i*)data);
+    __m256i lo_buckets = _mm256_shuffle_epi8(lo, _mm256_and_si256(v, low));
+    __m256i hi_buckets = _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+    return _mm256_and_si256(lo_buckets, hi_buckets);
+}
+
+CPU_TARGET("avx2")
+size_t TeddyAVX2(const uint8_t* masks, size_t fingerprint, const char* data, size_t size, uint32_t* candidates)
+{
+    size_t i = 0;
+    for (; (i + fingerprint - 1 + 32) <= size; i += 32)
+    {
+        // Candidates have buckets of all fingerprint characters
+        __m256i buckets = TeddyBucketsAVX2(data + i, masks);
+        if (fingerprint > 1)
+            buckets = _mm256_and_si256(buckets, TeddyBucketsAVX2(data + i + 1, masks + 32));
+        if (fingerprint > 2)
+            buckets = _mm256_and_si256(buckets, TeddyBucketsAVX2(data + i + 2, masks + 64));
+
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(buckets, _mm256_setzero_si256()));
+        if (mask != 0)
+        {
+            *candidates = mask;
+            return i;
+        }
+    }
+    *candidates = 0;
+    return i;
+}
+
+#endif
+
+TeddyFunction ResolveTeddy([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return TeddyAVX2;
+#endif
+    return TeddyScalar;
+}
+
+CPUDispatch<size_t(const uint8_t*, size_t, const char*, size_t, uint32_t*)>& TeddyDispatch()
+{
+    static CPUDispatch<size_t(const uint8_t*, size_t, const char*, size_t, uint32_t*)> dispatch(ResolveTeddy);
+    return dispatch;
+}
+
+inline char ToLowerASCII(char ch) noexcept
+{
+    return ((uint8_t)(ch - 'A') < 26) ? (char)(ch + ('a' - 'A')) : ch;
+}
+
+inline char ToUpperASCII(char ch) noexcept
+{
+    return ((uint8_t)(ch - 'a') < 26) ? (char)(ch - ('a' - 'A')) : ch;
+}
+
+} // namespace Internals
+//! @endcond
+
+MultiPattern::MultiPattern(const std::vector<std::string>& patterns, bool ignore_case)
+    : _patterns(patterns), _ignore_case(ignore_case), _teddy(false), _min_length(0), _fingerprint(0), _masks{}, _classes(0), _class{}
+{
+    if (_patterns.empty())
+        return;
+
+    _min_length = std::string::npos;
+    for (const auto& pattern : _patterns)
+    {
+        if (pattern.empty())
+            throwex ArgumentException("Multi-pattern matcher patterns must not be empty!");
+        _min_length = std::min(_min_length, pattern.size());
+    }
+
+    // Small pattern sets are matched with vectorized Teddy engine
+    _teddy = (_patterns.size() <= TEDDY_PATTERNS) && (Internals::TeddyDispatch().function() != Internals::TeddyScalar);
+    if (_teddy)
+        CompileTeddy();
+    else
+        CompileAhoCorasick();
+}
+
+void MultiPattern::CompileTeddy()
+{
+    _fingerprint = std::min(_min_length, (size_t)3);
+
+    auto fingerprint = [this](uint32_t index)
+    {
+        std::string result = _patterns[index].substr(0, _fingerprint);
+        if (_ignore_case)
+            std::transform(result.begin(), result.end(), result.begin(), Internals::ToLowerASCII);
+        return result;
+    };
+
+    // Patterns with close fingerprints share buckets to reduce false candidates
+    std::vector<uint32_t> order(_patterns.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&fingerprint](uint32_t index1, uint32_t index2) { return fingerprint(index1) < fingerprint(index2); });
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        size_t bucket = (i * _buckets.size()) / order.size();
+        _buckets[bucket].push_back(order[i]);
+
+        const std::string& pattern = _patterns[order[i]];
+        for (size_t k = 0; k < _fingerprint; ++k)
+        {
+            char variants[2] = { pattern[k], pattern[k] };
+            if (_ignore_case)
+            {
+                variants[0] = Internals::ToLowerASCII(pattern[k]);
+                variants[1] = Internals::ToUpperASCII(pattern[k]);
+            }
+            for (char ch : variants)
+            {
+                _masks[k * 32 + ((uint8_t)ch & 0x0F)] |= (uint8_t)(1 << bucket);
+                _masks[k * 32 + 16 + ((uint8_t)ch >> 4)] |= (uint8_t)(1 << bucket);
+            }
+        }
+    }
+}
+
+void MultiPattern::CompileAhoCorasick()
+{
+    // Bytes which are not used in patterns share the same class
+    size_t classes = 1;
+    for (const auto& pattern : _patterns)
+    {
+        for (char ch : pattern)
+        {
+            char folded = _ignore_case ? Internals::ToLowerASCII(ch) : ch;
+            if (_class[(uint8_t)folded] == 0)
+                _class[(uint8_t)folded] = (uint16_t)classes++;
+        }
+    }
+    if (_ignore_case)
+        for (int ch = 'A'; ch <= 'Z'; ++ch)
+            _class[ch] = _class[ch - 'A' + 'a'];
+
+    // Round up classes to the power of two, so the state index is shifted from the transition offset
+    _classes = std::bit_ceil(classes);
+    const int shift = std::countr_zero(_classes);
+
+    // Build the trie of patterns
+    std::vector<uint32_t> trie(_classes, 0);
+    std::vector<std::vector<uint32_t>> outputs(1);
+    for (uint32_t index = 0; index < _patterns.size(); ++index)
+    {
+        uint32_t state = 0;
+        for (char ch : _patterns[index])
+        {
+            size_t offset = ((size_t)state << shift) + _class[(uint8_t)ch];
+            if (trie[offset] == 0)
+            {
+                trie[offset] = (uint32_t)outputs.size();
+                trie.resize(trie.size() + _classes, 0);
+                outputs.emplace_back();
+            }
+            state = trie[offset];
+        }
+        outputs[state].push_back(index);
+    }
+
+    // Complete DFA transitions and dictionary suffix links in the breadth-first order
+    size_t states = outputs.size();
+    std::vector<uint32_t> failure(states, 0);
+    _dictionary.assign(states, 0);
+    _transitions.assign(states * _classes, 0);
+
+    std::queue<uint32_t> queue;
+    for (size_t c = 0; c < _classes; ++c)
+    {
+        uint32_t child = trie[c];
+        _transitions[c] = (uint32_t)(child << shift);
+        if (child != 0)
+            queue.push(child);
+    }
+    while (!queue.empty())
+    {
+        uint32_t state = queue.front();
+        queue.pop();
+
+        for (size_t c = 0; c < _classes; ++c)
+        {
+            size_t offset = ((size_t)state << shift) + c;
+            uint32_t child = trie[offset];
+            uint32_t fallback = _transitions[((size_t)failure[state] << shift) + c];
+            if (child != 0)
+            {
+                uint32_t link = fallback >> shift;
+                failure[child] = link;
+                _dictionary[child] = !outputs[link].empty() ? link : _dictionary[link];
+                _transitions[offset] = (uint32_t)((size_t)child << shift);
+                queue.push(child);
+            }
+            else
+                _transitions[offset] = fallback;
+        }
+    }
+
+    // Flatten pattern outputs of states
+    _report.assign(states, 0);
+    _outputs.assign(states + 1, 0);
+    for (size_t state = 0; state < states; ++state)
+    {
+        _report[state] = !outputs[state].empty() ? (uint32_t)state : _dictionary[state];
+        _outputs[state + 1] = _outputs[state] + (uint32_t)outputs[state].size();
+        _output_patterns.insert(_output_patterns.end(), outputs[state].begin(), outputs[state].end());
+    }
+}
+
+bool MultiPattern::Verify(std::string_view str, size_t position, uint32_t pattern) const noexcept
+{
+    const std::string& substr = _patterns[pattern];
+    if (substr.size() > (str.size() - position))
+        return false;
+
+    if (!_ignore_case)
+        return (std::memcmp(str.data() + position, substr.data(), substr.size()) == 0);
+
+    for (size_t i = 0; i < substr.size(); ++i)
+        if (Internals::ToLowerASCII(str[position + i]) != Internals::ToLowerASCII(substr[i]))
+            return false;
+    return true;
+}
+
+template <typename TCallback>
+bool MultiPattern::SearchTeddy(std::string_view str, TCallback&& callback) const
+{
+    const size_t last = str.size() - _min_length;
+
+    // Verify candidate patterns of buckets matched at the given position
+    auto check = [this, &str, &callback](size_t position)
+    {
+        uint32_t buckets = 0xFF;
+        for (size_t k = 0; k < _fingerprint; ++k)
+        {
+            uint8_t ch = (uint8_t)str[position + k];
+            buckets &= _masks[k * 32 + (ch & 0x0F)] & _masks[k * 32 + 16 + (ch >> 4)];
+        }
+        for (; buckets != 0; buckets &= buckets - 1)
+            for (uint32_t pattern : _buckets[std::countr_zero(buckets)])
+                if (Verify(str, position, pattern) && callback(position, pattern))
+                    return true;
+        return false;
+    };
+
+    // Skip the bulk of the string with vectorized implementation
+    size_t i = 0;
+    while (i <= last)
+    {
+        uint32_t candidates;
+        i += Internals::TeddyDispatch()(_masks.data(), _fingerprint, str.data() + i, str.size() - i, &candidates);
+        if (candidates == 0)
+            break;
+
+        for (; candidates != 0; candidates &= candidates - 1)
+        {
+            size_t position = i + std::countr_zero(candidates);
+            if ((position <= last) && check(position))
+                return true;
+        }
+        i += 32;
+    }
+
+    for (; i <= last; ++i)
+        if (check(i))
+            return true;
+
+    return false;
+}
+
+template <typename TCallback>
+bool MultiPattern::SearchAhoCorasick(std::string_view str, TCallback&& callback) const
+{
+    const int shift = std::countr_zero(_classes);
+
+    uint32_t offset = 0;
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        offset = _transitions[offset + _class[(uint8_t)str[i]]];
+
+        // Report patterns of the state and all its dictionary suffixes
+        for (uint32_t state = _report[offset >> shift]; state != 0; state = _dictionary[state])
+        {
+            for (uint32_t k = _outputs[state]; k < _outputs[state + 1]; ++k)
+            {
+                uint32_t pattern = _output_patterns[k];
+                if (callback(i + 1 - _patterns[pattern].size(), pattern))
+                    return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+template <typename TCallback>
+bool MultiPattern::Search(std::string_view str, TCallback&& callback) const
+{
+    if (empty() || (str.size() < _min_length))
+        return false;
+
+    return _teddy ? SearchTeddy(str, callback) : SearchAhoCorasick(str, callback);
+}
+
+bool MultiPattern::Contains(std::string_view str) const noexcept
+{
+    return Search(str, [](size_t, uint32_t) { return true; });
+}
+
+std::vector<PatternMatch> MultiPattern::FindAll(std::string_view str) const
+{
+    std::vector<PatternMatch> result;
+    Search(str, [this, &result](size_t position, uint32_t pattern)
+    {
+        result.push_back(PatternMatch{ position, _patterns[pattern].size(), pattern });
+        return false;
+    });
+
+    std::sort(result.begin(), result.end(), [](const PatternMatch& match1, const PatternMatch& match2)
+    {
+        return (match1.position != match2.position) ? (match1.position < match2.position) : (match1.pattern < match2.pattern);
+    });
+    return result;
+}
+
+std::vector<PatternMatch> MultiPattern::Select(std::string_view str) const
+{
+    std::vector<PatternMatch> matches = FindAll(str);
+
+    // Select leftmost-longest not overlapping matches
+    std::vector<PatternMatch> result;
+    size_t cursor = 0;
+    for (size_t i = 0; i < matches.size();)
+    {
+        size_t position = matches[i].position;
+        size_t best = i;
+        for (; (i < matches.size()) && (matches[i].position == position); ++i)
+            if (matches[i].length > matches[best].length)
+                best = i;
+
+        if (position >= cursor)
+        {
+            result.push_back(matches[best]);
+            cursor = position + matches[best].length;
+        }
+    }
+    return result;
+}
+
+size_t MultiPattern::CountAll(std::string_view str) const
+{
+    return Select(str).size();
+}
+
+bool MultiPattern::ReplaceAll(std::string& str, std::string_view with) const
+{
+    std::vector<PatternMatch> matches = Select(str);
+    if (matches.empty())
+        return false;
+
+    std::string result;
+    result.reserve(str.size());
+    size_t cursor = 0;
+    for (const auto& match : matches)
+    {
+        result.append(str, cursor, match.position - cursor);
+        result.append(with);
+        cursor = match.position + match.length;
+    }
+    result.append(str, cursor, std::string::npos);
+
+    str.swap(result);
+    return true;
+}
+
+bool MultiPattern::ReplaceAll(std::string& str, const std::vector<std::string>& with) const
+{
+    if (with.size() != _patterns.size())
+        throwex ArgumentException("Count of replacements must be equal to the count of multi-pattern matcher patterns!");
+
+    std::vector<PatternMatch> matches = Select(str);
+    if (matches.empty())
+        return false;
+
+    std::string result;
+    result.reserve(str.size());
+    size_t cursor = 0;
+    for (const auto& match : matches)
+    {
+        result.append(str, cursor, match.position - cursor);
+        result.append(with[match.pattern]);
+        cursor = match.position + match.length;
+    }
+    result.append(str, cursor, std::string::npos);
+
+    str.swap(result);
+    return true;
+}
+
+void MultiPattern::swap(MultiPattern& pattern) noexcept
+{
+    using std::swap;
+    swap(_patterns, pattern._patterns);
+    swap(_ignore_case, pattern._ignore_case);
+    swap(_teddy, pattern._teddy);
+    swap(_min_length, pattern._min_length);
+    swap(_fingerprint, pattern._fingerprint);
+    swap(_masks, pattern._masks);
+    swap(_buckets, pattern._buckets);
+    swap(_classes, pattern._classes);
+    swap(_class, pattern._class);
+    swap(_transitions, pattern._transitions);
+    swap(_report, pattern._report);
+    swap(_dictionary, pattern._dictionary);
+    swap(_outputs, pattern._outputs);
+    swap(_output_patterns, pattern._output_patterns);
+}
+
+} // namespace CppCommon
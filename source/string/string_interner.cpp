@@ -0,0 +1,227 @@
+/*!
+    \file string_interner.cpp
+    \brief String interner implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "string/string_interner.h"
+
+#include "memory/allocator_arena.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class StringInterner::Impl
+{
+    typedef InternedString::Entry Entry;
+
+    struct alignas(64) Stripe
+    {
+        mutable std::shared_mutex lock;
+        DefaultMemoryManager auxiliary;
+        ArenaMemoryManager<DefaultMemoryManager> arena;
+        std::vector<const Entry*> index;
+        std::vector<const Entry*> entries;
+
+        explicit Stripe(size_t page) : arena(auxiliary, page) {}
+        // Interned strings are dropped all at once with arena pages
+        ~Stripe() { arena.free_all(); }
+
+        const Entry* Find(std::string_view str, size_t hash) const noexcept
+        {
+            if (index.empty())
+                return nullptr;
+
+            // Linear probing of the open address index
+            size_t mask = index.size() - 1;
+            for (size_t i = hash & mask;; i = (i + 1) & mask)
+            {
+                const Entry* entry = index[i];
+                if (entry == nullptr)
+                    return nullptr;
+                if ((entry->hash == hash) && (entry->size == str.size()) && (std::memcmp(entry->data, str.data(), str.size()) == 0))
+                    return entry;
+            }
+        }
+
+        void Insert(const Entry* entry)
+        {
+            // Keep the index load factor below 0.75
+            if (((entries.size() + 1) * 4) > (index.size() * 3))
+            {
+                std::vector<const Entry*> rehashed(std::max<size_t>(index.size() * 2, 64), nullptr);
+                size_t mask = rehashed.size() - 1;
+                for (auto item : entries)
+                {
+                    size_t i = item->hash & mask;
+                    while (rehashed[i] != nullptr)
+                        i = (i + 1) & mask;
+                    rehashed[i] = item;
+                }
+                index.swap(rehashed);
+            }
+
+            size_t mask = index.size() - 1;
+            size_t i = entry->hash & mask;
+            while (index[i] != nullptr)
+                i = (i + 1) & mask;
+            index[i] = entry;
+            entries.push_back(entry);
+        }
+    };
+
+public:
+    Impl(size_t stripes, size_t page) : _bits(0)
+    {
+        if (stripes == 0)
+            stripes = std::max<size_t>(std::thread::hardware_concurrency(), 1) * 4;
+
+        // Round the count of stripes up to the power of two
+        while (((size_t)1 << _bits) < stripes)
+            ++_bits;
+
+        _stripes.reserve((size_t)1 << _bits);
+        for (size_t i = 0; i < ((size_t)1 << _bits); ++i)
+            _stripes.emplace_back(std::make_unique<Stripe>(page));
+    }
+
+    size_t size() const
+    {
+        size_t result = 0;
+        for (const auto& stripe : _stripes)
+        {
+            std::shared_lock<std::shared_mutex> locker(stripe->lock);
+            result += stripe->entries.size();
+        }
+        return result;
+    }
+
+    size_t memory() const
+    {
+        size_t result = 0;
+        for (const auto& stripe : _stripes)
+        {
+            std::shared_lock<std::shared_mutex> locker(stripe->lock);
+            result += stripe->arena.allocated();
+        }
+        return result;
+    }
+
+    size_t stripes() const noexcept { return _stripes.size(); }
+
+    InternedString Intern(std::string_view str)
+    {
+        if (str.empty())
+            return InternedString();
+
+        size_t hash = std::hash<std::string_view>()(str);
+        size_t index = stripe(hash);
+        Stripe& current = *_stripes[index];
+
+        // Fast path for the already interned string
+        {
+            std::shared_lock<std::shared_mutex> locker(current.lock);
+            const Entry* entry = current.Find(str, hash);
+            if (entry != nullptr)
+                return InternedString(entry);
+        }
+
+        std::unique_lock<std::shared_mutex> locker(current.lock);
+
+        // The string could be interned by another thread meanwhile
+        const Entry* found = current.Find(str, hash);
+        if (found != nullptr)
+            return InternedString(found);
+
+        // Store the null-terminated string into the arena page
+        Entry* entry = (Entry*)current.arena.malloc(offsetof(Entry, data) + str.size() + 1, alignof(Entry));
+        if (entry == nullptr)
+            throw std::bad_alloc();
+        entry->hash = hash;
+        entry->id = ((uint64_t)(current.entries.size() + 1) << _bits) | index;
+        entry->size = str.size();
+        std::memcpy(entry->data, str.data(), str.size());
+        entry->data[str.size()] = 0;
+
+        current.Insert(entry);
+        return InternedString(entry);
+    }
+
+    InternedString Find(std::string_view str) const
+    {
+        if (str.empty())
+            return InternedString();
+
+        size_t hash = std::hash<std::string_view>()(str);
+        const Stripe& current = *_stripes[stripe(hash)];
+
+        std::shared_lock<std::shared_mutex> locker(current.lock);
+        return InternedString(current.Find(str, hash));
+    }
+
+    InternedString Get(uint64_t id) const
+    {
+        const Stripe& current = *_stripes[(size_t)(id & (((uint64_t)1 << _bits) - 1))];
+        uint64_t position = id >> _bits;
+
+        std::shared_lock<std::shared_mutex> locker(current.lock);
+        if ((position == 0) || (position > current.entries.size()))
+            return InternedString();
+        return InternedString(current.entries[(size_t)(position - 1)]);
+    }
+
+private:
+    size_t _bits;
+    std::vector<std::unique_ptr<Stripe>> _stripes;
+
+    size_t stripe(size_t hash) const noexcept
+    {
+        // Route by the high bits of the mixed hash, so each stripe index
+        // still receives well distributed low bits of the original hash
+        if (_bits == 0)
+            return 0;
+        return (size_t)(((uint64_t)hash * 0x9E3779B97F4A7C15ull) >> (64 - _bits));
+    }
+};
+
+//! @endcond
+
+StringInterner::StringInterner(size_t stripes, size_t page)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "StringInterner::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "StringInterner::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(stripes, page);
+}
+
+StringInterner::~StringInterner()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+size_t StringInterner::size() const { return impl().size(); }
+size_t StringInterner::memory() const { return impl().memory(); }
+size_t StringInterner::stripes() const noexcept { return impl().stripes(); }
+
+InternedString StringInterner::Intern(std::string_view str) { return impl().Intern(str); }
+InternedString StringInterner::Find(std::string_view str) const { return impl().Find(str); }
+InternedString StringInterner::Get(uint64_t id) const { return impl().Get(id); }
+
+} // namespace CppCommon
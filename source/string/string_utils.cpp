@@ -8,30 +8,321 @@
 
 #include "string/string_utils.h"
 
+#include "system/cpu_dispatch.h"
+
+#include <bit>
 #include <cassert>
+#include <cstring>
 #include <regex>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace CppCommon {
 
-bool StringUtils::IsBlank(const char* str)
+//! @cond INTERNALS
+namespace Internals {
+
+// Case kernel converts the bulk of the string in place and returns the count of processed characters
+typedef size_t (*CaseFunction)(char* data, size_t size);
+// Blank kernel returns the count of leading (or trailing) blank characters found in the bulk of the string
+typedef size_t (*BlankFunction)(const char* data, size_t size);
+// Search kernel returns the position of the substring candidate or the first position which was not scanned
+typedef size_t (*SearchFunction)(const char* data, size_t size, const char* substr, size_t length);
+
+size_t CaseScalar(char*, size_t)
 {
-    for (size_t i = 0; str[i] != 0; ++i)
-        if (!IsBlank(str[i]))
-            return false;
+    // Scalar implementation processes the whole string
+    return 0;
+}
 
-    return true;
+size_t BlankScalar(const char*, size_t)
+{
+    // Scalar implementation processes the whole string
+    return 0;
 }
 
-bool StringUtils::IsBlank(std::string_view str)
+size_t SearchScalar(const char*, size_t, const char*, size_t)
 {
-    if (str.empty())
-        return true;
+    // Scalar implementation processes the whole string
+    return 0;
+}
 
-    for (auto ch : str)
-        if (!IsBlank(ch))
-            return false;
+#if defined(__x86_64__) || defined(_M_X64)
 
-    return true;
+// Add the delta to characters in the range [first, first + 25]
+CPU_TARGET("avx2")
+inline size_t ShiftCaseAVX2(char* data, size_t size, char first, char delta)
+{
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8(first));
+        __m256i letters = _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(25)), t);
+        v = _mm256_add_epi8(v, _mm256_and_si256(letters, _mm256_set1_epi8(delta)));
+        _mm256_storeu_si256((__m256i*)(data + i), v);
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t LowerAVX2(char* data, size_t size)
+{
+    return ShiftCaseAVX2(data, size, 'A', 'a' - 'A');
+}
+
+CPU_TARGET("avx2")
+size_t UpperAVX2(char* data, size_t size)
+{
+    return ShiftCaseAVX2(data, size, 'a', (char)('A' - 'a'));
+}
+
+// Get the mask of not blank characters
+CPU_TARGET("avx2")
+inline uint32_t NotBlankAVX2(const char* data)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i*)data);
+    __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    __m256i blank = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(4)), t));
+    return ~(uint32_t)_mm256_movemask_epi8(blank);
+}
+
+CPU_TARGET("avx2")
+size_t LeadingBlankAVX2(const char* data, size_t size)
+{
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        uint32_t mask = NotBlankAVX2(data + i);
+        if (mask != 0)
+            return i + std::countr_zero(mask);
+    }
+    return i;
+}
+
+CPU_TARGET("avx2")
+size_t TrailingBlankAVX2(const char* data, size_t size)
+{
+    size_t count = 0;
+    for (; (count + 32) <= size; count += 32)
+    {
+        uint32_t mask = NotBlankAVX2(data + size - count - 32);
+        if (mask != 0)
+            return count + std::countl_zero(mask);
+    }
+    return count;
+}
+
+CPU_TARGET("avx2")
+size_t SearchAVX2(const char* data, size_t size, const char* substr, size_t length)
+{
+    const __m256i first = _mm256_set1_epi8(substr[0]);
+    const __m256i last = _mm256_set1_epi8(substr[length - 1]);
+
+    size_t i = 0;
+    for (; (i + length - 1 + 32) <= size; i += 32)
+    {
+        // Candidates have matched first and last characters of the substring
+        __m256i block_first = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i block_last = _mm256_loadu_si256((const __m256i*)(data + i + length - 1));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0)
+        {
+            size_t position = i + std::countr_zero(mask);
+            if (std::memcmp(data + position + 1, substr + 1, length - 2) == 0)
+                return position;
+            mask &= mask - 1;
+        }
+    }
+    return i;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+// Get the mask with four bits per each byte of the comparison result
+inline uint64_t MaskNEON(uint8x16_t v)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+}
+
+// Add the delta to characters in the range [first, first + 25]
+inline size_t ShiftCaseNEON(char* data, size_t size, char first, char delta)
+{
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)(data + i));
+        uint8x16_t letters = vcleq_u8(vsubq_u8(v, vdupq_n_u8((uint8_t)first)), vdupq_n_u8(25));
+        v = vaddq_u8(v, vandq_u8(letters, vdupq_n_u8((uint8_t)delta)));
+        vst1q_u8((uint8_t*)(data + i), v);
+    }
+    return i;
+}
+
+size_t LowerNEON(char* data, size_t size)
+{
+    return ShiftCaseNEON(data, size, 'A', 'a' - 'A');
+}
+
+size_t UpperNEON(char* data, size_t size)
+{
+    return ShiftCaseNEON(data, size, 'a', (char)('A' - 'a'));
+}
+
+// Get the mask of not blank characters
+inline uint64_t NotBlankNEON(const char* data)
+{
+    uint8x16_t v = vld1q_u8((const uint8_t*)data);
+    uint8x16_t blank = vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vcleq_u8(vsubq_u8(v, vdupq_n_u8('\t')), vdupq_n_u8(4)));
+    return ~MaskNEON(blank);
+}
+
+size_t LeadingBlankNEON(const char* data, size_t size)
+{
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        uint64_t mask = NotBlankNEON(data + i);
+        if (mask != 0)
+            return i + std::countr_zero(mask) / 4;
+    }
+    return i;
+}
+
+size_t TrailingBlankNEON(const char* data, size_t size)
+{
+    size_t count = 0;
+    for (; (count + 16) <= size; count += 16)
+    {
+        uint64_t mask = NotBlankNEON(data + size - count - 16);
+        if (mask != 0)
+            return count + std::countl_zero(mask) / 4;
+    }
+    return count;
+}
+
+size_t SearchNEON(const char* data, size_t size, const char* substr, size_t length)
+{
+    const uint8x16_t first = vdupq_n_u8((uint8_t)substr[0]);
+    const uint8x16_t last = vdupq_n_u8((uint8_t)substr[length - 1]);
+
+    size_t i = 0;
+    for (; (i + length - 1 + 16) <= size; i += 16)
+    {
+        // Candidates have matched first and last characters of the substring
+        uint8x16_t block_first = vld1q_u8((const uint8_t*)(data + i));
+        uint8x16_t block_last = vld1q_u8((const uint8_t*)(data + i + length - 1));
+        uint64_t mask = MaskNEON(vandq_u8(vceqq_u8(first, block_first), vceqq_u8(last, block_last))) & 0x8888888888888888ull;
+        while (mask != 0)
+        {
+            size_t position = i + std::countr_zero(mask) / 4;
+            if (std::memcmp(data + position + 1, substr + 1, length - 2) == 0)
+                return position;
+            mask &= mask - 1;
+        }
+    }
+    return i;
+}
+
+#endif
+
+CaseFunction ResolveLower([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return LowerAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return LowerNEON;
+#endif
+    return CaseScalar;
+}
+
+CaseFunction ResolveUpper([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return UpperAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return UpperNEON;
+#endif
+    return CaseScalar;
+}
+
+BlankFunction ResolveLeadingBlank([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return LeadingBlankAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return LeadingBlankNEON;
+#endif
+    return BlankScalar;
+}
+
+BlankFunction ResolveTrailingBlank([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return TrailingBlankAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return TrailingBlankNEON;
+#endif
+    return BlankScalar;
+}
+
+SearchFunction ResolveSearch([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return SearchAVX2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return SearchNEON;
+#endif
+    return SearchScalar;
+}
+
+// Get the count of leading blank characters
+size_t LeadingBlank(std::string_view str)
+{
+    static CPUDispatch<size_t(const char*, size_t)> dispatch(ResolveLeadingBlank);
+
+    size_t i = dispatch(str.data(), str.size());
+    while ((i < str.size()) && StringUtils::IsBlank(str[i]))
+        ++i;
+    return i;
+}
+
+// Get the count of trailing blank characters
+size_t TrailingBlank(std::string_view str)
+{
+    static CPUDispatch<size_t(const char*, size_t)> dispatch(ResolveTrailingBlank);
+
+    size_t count = dispatch(str.data(), str.size());
+    while ((count < str.size()) && StringUtils::IsBlank(str[str.size() - count - 1]))
+        ++count;
+    return count;
+}
+
+} // namespace Internals
+//! @endcond
+
+bool StringUtils::IsBlank(const char* str)
+{
+    return IsBlank(std::string_view(str));
+}
+
+bool StringUtils::IsBlank(std::string_view str)
+{
+    return (Internals::LeadingBlank(str) == str.size());
 }
 
 bool StringUtils::IsPatternMatch(const std::string& patterns, const std::string& str)
@@ -59,33 +350,54 @@ bool StringUtils::IsPatternMatch(const std::string& patterns, const std::string&
     return result;
 }
 
+std::string& StringUtils::Lower(std::string& str)
+{
+    static CPUDispatch<size_t(char*, size_t)> dispatch(Internals::ResolveLower);
+
+    // Convert the bulk of the string with vectorized implementation
+    size_t i = dispatch(str.data(), str.size());
+    for (; i < str.size(); ++i)
+        str[i] = ToLowerInternal(str[i]);
+    return str;
+}
+
+std::string& StringUtils::Upper(std::string& str)
+{
+    static CPUDispatch<size_t(char*, size_t)> dispatch(Internals::ResolveUpper);
+
+    // Convert the bulk of the string with vectorized implementation
+    size_t i = dispatch(str.data(), str.size());
+    for (; i < str.size(); ++i)
+        str[i] = ToUpperInternal(str[i]);
+    return str;
+}
+
 std::string StringUtils::ToLTrim(std::string_view str)
 {
-    return std::string(std::find_if(str.begin(), str.end(), [](int c) { return !std::isspace(c); }), str.end());
+    return std::string(str.substr(Internals::LeadingBlank(str)));
 }
 
 std::string StringUtils::ToRTrim(std::string_view str)
 {
-    return std::string(str.begin(), std::find_if(str.rbegin(), str.rend(), [](int c) { return !std::isspace(c); }).base());
+    return std::string(str.substr(0, str.size() - Internals::TrailingBlank(str)));
 }
 
 std::string StringUtils::ToTrim(std::string_view str)
 {
-    auto start = std::find_if(str.begin(), str.end(), [](int c) { return !std::isspace(c); });
-    auto end = std::find_if(str.rbegin(), str.rend(), [](int c) { return !std::isspace(c); }).base();
-
-    return (start != str.end()) ? std::string(start, end) : std::string();
+    str.remove_prefix(Internals::LeadingBlank(str));
+    str.remove_suffix(Internals::TrailingBlank(str));
+    return std::string(str);
 }
 
 std::string& StringUtils::LTrim(std::string& str)
 {
-    str.erase(str.begin(), std::find_if(str.begin(), str.end(), [](int c) { return !std::isspace(c); }));
+    str.erase(0, Internals::LeadingBlank(str));
     return str;
 }
 
 std::string& StringUtils::RTrim(std::string& str)
 {
-    str.erase(std::find_if(str.rbegin(), str.rend(), [](int c) { return !std::isspace(c); }).base(), str.end());
+    str.erase(str.size() - Internals::TrailingBlank(str));
     return str;
 }
 
@@ -101,12 +413,25 @@ bool StringUtils::CompareNoCase(std::string_view str1, std::string_view str2)
     return std::equal(str1.cbegin(), str1.cend(), str2.cbegin(), [](std::string::value_type l, std::string::value_type r) { return std::tolower(l) == std::tolower(r); });
 }
 
+size_t StringUtils::Find(std::string_view str, std::string_view substr, size_t pos) noexcept
+{
+    static CPUDispatch<size_t(const char*, size_t, const char*, size_t)> dispatch(Internals::ResolveSearch);
+
+    // Single characters are searched with memchr() based implementation
+    if ((substr.size() < 2) || (pos >= str.size()) || (substr.size() > (str.size() - pos)))
+        return str.find(substr, pos);
+
+    // Skip the bulk of the string with vectorized implementation
+    pos += dispatch(str.data() + pos, str.size() - pos, substr.data(), substr.size());
+    return str.find(substr, pos);
+}
+
 size_t StringUtils::CountAll(std::string_view str, std::string_view substr)
 {
     size_t count=0;
 
     size_t pos = 0;
-    while ((pos = str.find(substr, pos)) != std::string::npos)
+    while ((pos = Find(str, substr, pos)) != std::string::npos)
     {
         pos += substr.size();
         ++count;
@@ -117,7 +442,7 @@ size_t StringUtils::CountAll(std::string_view str, std::string_view substr)
 
 bool StringUtils::ReplaceFirst(std::string& str, std::string_view substr, std::string_view with)
 {
-    size_t pos = str.find(substr);
+    size_t pos = Find(str, substr);
     if (pos == std::string::npos)
         return false;
 
@@ -140,7 +465,7 @@ bool StringUtils::ReplaceAll(std::string& str, std::string_view substr, std::str
     bool result = false;
 
     size_t pos = 0;
-    while ((pos = str.find(substr, pos)) != std::string::npos)
+    while ((pos = Find(str, substr, pos)) != std::string::npos)
     {
         str.replace(pos, substr.size(), with);
         pos += with.size();
@@ -187,7 +512,7 @@ std::vector<std::string> StringUtils::Split(std::string_view str, std::string_vi
 
     while (true)
     {
-        pos_current = str.find(delimiter, pos_last);
+        pos_current = Find(str, delimiter, pos_last);
         if (pos_current == std::string::npos)
             pos_current = str.size();
 
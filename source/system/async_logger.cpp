@@ -0,0 +1,321 @@
+/*!
+    \file async_logger.cpp
+    \brief Asynchronous low-latency logger implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/async_logger.h"
+
+#include "errors/exceptions.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "time/time.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace CppCommon {
+
+AsyncLogger::AsyncLogger(size_t capacity)
+    : _capacity(capacity),
+      _rotation(0),
+      _backups(DEFAULT_BACKUPS),
+      _batch(DEFAULT_BATCH),
+      _opened(false),
+      _records(0),
+      _rotations(0),
+      _base_tsc(Timestamp::tsc()),
+      _base_utc(Timestamp::utc()),
+      _dropped(0),
+      _size(0),
+      _second(0),
+      _prefix(),
+      _stop(false),
+      _ring([this]() { return RegisterRing(); }, [](Internals::AsyncLogRing*& ring) { ring->finished.store(true, std::memory_order_release); })
+{
+    assert((capacity > 0) && ((capacity & (capacity - 1)) == 0) && "Async logger capacity must be a power of two!");
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0))
+        throwex ArgumentException("Async logger capacity must be a power of two!");
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    try
+    {
+        Close();
+    }
+    catch (...) {}
+}
+
+uint64_t AsyncLogger::dropped() const
+{
+    Locker<CriticalSection> locker(_lock);
+
+    uint64_t result = _dropped;
+    for (const auto& ring : _rings)
+        result += ring->dropped.load(std::memory_order_relaxed);
+    return result;
+}
+
+void AsyncLogger::Open(const Path& path, uint64_t rotation, size_t backups, const Timespan& period, size_t batch)
+{
+    Close();
+
+    {
+        Locker<CriticalSection> locker(_drain);
+
+        // Append records to the existing log file
+        _path = path;
+        _file = File(path);
+        _file.OpenOrCreate(false, true);
+        _size = _file.size();
+        _file.Seek(_size);
+        _rotation = rotation;
+        _backups = backups;
+        _batch = std::max(batch, (size_t)1);
+        _output.clear();
+        _error = nullptr;
+    }
+
+    _period = period;
+    _stop = false;
+    _opened.store(true, std::memory_order_release);
+    _writer = Thread::Start([this]() { Writer(); });
+}
+
+void AsyncLogger::Close()
+{
+    if (_writer.joinable())
+    {
+        _stop = true;
+        _wake.Signal();
+        _writer.join();
+    }
+
+    Locker<CriticalSection> locker(_drain);
+    if (!IsOpened())
+        return;
+
+    _opened.store(false, std::memory_order_release);
+
+    std::exception_ptr error = _error;
+    if (!error)
+    {
+        try
+        {
+            Drain();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+    _error = nullptr;
+    _output.clear();
+
+    if (_file.IsFileOpened())
+        _file.Close();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void AsyncLogger::Flush()
+{
+    Locker<CriticalSection> locker(_drain);
+    if (_error)
+        std::rethrow_exception(_error);
+    if (IsOpened())
+        Drain();
+}
+
+Internals::AsyncLogRing* AsyncLogger::RegisterRing()
+{
+    auto ring = std::make_shared<Internals::AsyncLogRing>(_capacity, Thread::CurrentThreadId());
+    Locker<CriticalSection> locker(_lock);
+    _rings.push_back(ring);
+    return ring.get();
+}
+
+void AsyncLogger::Drain()
+{
+    // Take the snapshot of ring buffers
+    std::vector<std::shared_ptr<Internals::AsyncLogRing>> rings;
+    {
+        Locker<CriticalSection> locker(_lock);
+        rings = _rings;
+    }
+
+    // Records committed after the snapshot are drained on the next pass
+    struct Cursor
+    {
+        std::span<const uint8_t> data;
+        size_t offset;
+        bool finished;
+    };
+    std::vector<Cursor> cursors(rings.size());
+    for (size_t i = 0; i < rings.size(); ++i)
+    {
+        // Finished flag is loaded before peeking, so the last records of the thread are not lost
+        cursors[i].finished = rings[i]->finished.load(std::memory_order_acquire);
+        cursors[i].data = rings[i]->buffer.Peek();
+        cursors[i].offset = 0;
+    }
+
+    // Merge records of all threads by their timestamps
+    for (;;)
+    {
+        size_t index = rings.size();
+        uint64_t timestamp = 0;
+        for (size_t i = 0; i < cursors.size(); ++i)
+        {
+            if (cursors[i].offset >= cursors[i].data.size())
+                continue;
+
+            // Records with string arguments are not aligned
+            uint64_t current;
+            std::memcpy(&current, cursors[i].data.data() + cursors[i].offset + offsetof(Internals::AsyncLogRecord, timestamp), sizeof(current));
+            if ((index == rings.size()) || (current < timestamp))
+            {
+                index = i;
+                timestamp = current;
+            }
+        }
+        if (index == rings.size())
+            break;
+
+        Cursor& cursor = cursors[index];
+        cursor.offset += Append(*rings[index], cursor.data.data() + cursor.offset);
+
+        // Release records of the ring buffer after they are written
+        if (_output.size() >= _batch)
+        {
+            WriteOutput();
+            for (size_t i = 0; i < cursors.size(); ++i)
+            {
+                rings[i]->buffer.Release(cursors[i].offset);
+                cursors[i].data = cursors[i].data.subspan(cursors[i].offset);
+                cursors[i].offset = 0;
+            }
+        }
+    }
+
+    WriteOutput();
+    _file.Flush();
+
+    for (size_t i = 0; i < cursors.size(); ++i)
+    {
+        rings[i]->buffer.Release(cursors[i].offset);
+
+        // Remove ring buffers of finished threads when they are drained
+        if (cursors[i].finished && rings[i]->buffer.empty())
+        {
+            Locker<CriticalSection> locker(_lock);
+            _dropped += rings[i]->dropped.load(std::memory_order_relaxed);
+            _rings.erase(std::remove(_rings.begin(), _rings.end(), rings[i]), _rings.end());
+        }
+    }
+}
+
+size_t AsyncLogger::Append(const Internals::AsyncLogRing& ring, const uint8_t* data)
+{
+    Internals::AsyncLogRecord record;
+    std::memcpy(&record, data, sizeof(record));
+
+    // Convert the monotonic timestamp into UTC nanoseconds
+    uint64_t timestamp = (record.timestamp >= _base_tsc) ? (_base_utc + (record.timestamp - _base_tsc)) : (_base_utc - std::min(_base_utc, _base_tsc - record.timestamp));
+
+    // Date and time are formatted once per second
+    uint64_t second = timestamp / 1000000000;
+    if ((second != _second) || (_prefix[0] == 0))
+    {
+        UtcTime time(Timestamp(second * 1000000000));
+        format_to_n(_prefix, sizeof(_prefix), "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}", time.year(), time.month(), time.day(), time.hour(), time.minute(), time.second());
+        _second = second;
+    }
+
+    size_t before = _output.size();
+    format_to(_output, "{}.{:09}Z [{}] ", std::string_view(_prefix, 19), timestamp % 1000000000, ring.thread);
+    try
+    {
+        record.formatter(_output, std::string_view(record.pattern, record.length), data + sizeof(record));
+    }
+    catch (const fmt::format_error& ex)
+    {
+        _output.resize(before);
+        format_to(_output, "{}.{:09}Z [{}] Format error: {}", std::string_view(_prefix, 19), timestamp % 1000000000, ring.thread, ex.what());
+    }
+    _output.push_back('\n');
+    _records.store(_records.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    // Rotate the log file at the line boundary
+    if ((_rotation > 0) && ((_size + _output.size()) >= _rotation))
+    {
+        WriteOutput();
+        Rotate();
+    }
+
+    return record.size;
+}
+
+void AsyncLogger::WriteOutput()
+{
+    if (_output.size() == 0)
+        return;
+
+    _file.Write(_output.data(), _output.size());
+    _size += _output.size();
+    _output.clear();
+}
+
+void AsyncLogger::Rotate()
+{
+    _file.Close();
+
+    // Shift backups: 'path.N-1' -> 'path.N', ..., 'path' -> 'path.1'
+    if (_backups > 0)
+    {
+        for (size_t i = _backups; i > 0; --i)
+        {
+            Path src = (i > 1) ? Path(_path.string() + "." + std::to_string(i - 1)) : _path;
+            Path dst = Path(_path.string() + "." + std::to_string(i));
+            if (src.IsExists())
+            {
+                if (dst.IsExists())
+                    Path::Remove(dst);
+                Path::Rename(src, dst);
+            }
+        }
+    }
+
+    _file = File(_path);
+    _file.OpenOrCreate(false, true, true);
+    _size = 0;
+    _rotations.store(_rotations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void AsyncLogger::Writer()
+{
+    while (!_stop)
+    {
+        _wake.TryWaitFor(_period);
+
+        Locker<CriticalSection> locker(_drain);
+        if (_error)
+            continue;
+
+        try
+        {
+            Drain();
+        }
+        catch (...)
+        {
+            _error = std::current_exception();
+        }
+    }
+}
+
+} // namespace CppCommon
@@ -8,61 +8,209 @@
 
 #include "system/console.h"
 
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include "errors/fatal.h"
+
 #include <cstdio>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+const char* const ConsoleColors[] =
+{
+    "\033[22;30m",  // Black color
+    "\033[22;34m",  // Blue color
+    "\033[22;32m",  // Green color
+    "\033[22;36m",  // Cyan color
+    "\033[22;31m",  // Red color
+    "\033[22;35m",  // Magenta color
+    "\033[22;33m",  // Brown color
+    "\033[22;37m",  // Grey color
+    "\033[01;30m",  // Dark grey color
+    "\033[01;34m",  // Light blue color
+    "\033[01;32m",  // Light green color
+    "\033[01;36m",  // Light cyan color
+    "\033[01;31m",  // Light red color
+    "\033[01;35m",  // Light magenta color
+    "\033[01;33m",  // Yellow color
+    "\033[01;37m"   // White color
+};
+
+const char* const ConsoleBackgrounds[] =
+{
+    "\033[00000m",  // Black color
+    "\033[02;44m",  // Blue color
+    "\033[02;42m",  // Green color
+    "\033[02;46m",  // Cyan color
+    "\033[02;41m",  // Red color
+    "\033[02;45m",  // Magenta color
+    "\033[02;43m",  // Brown color
+    "\033[02;47m",  // Grey color
+    "\033[00;40m",  // Dark grey color
+    "\033[00;44m",  // Light blue color
+    "\033[00;42m",  // Light green color
+    "\033[00;46m",  // Light cyan color
+    "\033[00;41m",  // Light red color
+    "\033[00;45m",  // Light magenta color
+    "\033[00;43m",  // Yellow color
+    "\033[00;47m"   // White color
+};
+
+} // namespace Internals
+//! @endcond
+
 void Console::SetColor(Color color, Color background)
 {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    const char* colors[] =
+    std::fwrite(Internals::ConsoleBackgrounds[(int)background - (int)Color::BLACK], 1, 8, stdout);
+    std::fwrite(Internals::ConsoleColors[(int)color - (int)Color::BLACK], 1, 8, stdout);
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    SetConsoleTextAttribute(hConsole, (((WORD)color) & 0x0F) + ((((WORD)background) & 0x0F) << 4));
+#endif
+}
+
+ConsoleBuffer::ConsoleBuffer(size_t capacity) : _color(-1), _background(-1)
+{
+    _buffer.reserve(capacity);
+}
+
+ConsoleBuffer::~ConsoleBuffer()
+{
+    try
     {
-        "\033[22;30m",  // Black color
-        "\033[22;34m",  // Blue color
-        "\033[22;32m",  // Green color
-        "\033[22;36m",  // Cyan color
-        "\033[22;31m",  // Red color
-        "\033[22;35m",  // Magenta color
-        "\033[22;33m",  // Brown color
-        "\033[22;37m",  // Grey color
-        "\033[01;30m",  // Dark grey color
-        "\033[01;34m",  // Light blue color
-        "\033[01;32m",  // Light green color
-        "\033[01;36m",  // Light cyan color
-        "\033[01;31m",  // Light red color
-        "\033[01;35m",  // Light magenta color
-        "\033[01;33m",  // Yellow color
-        "\033[01;37m"   // White color
-    };
-    const char* backgrounds[] =
+        Flush();
+    }
+    catch (const SystemException& ex)
     {
-        "\033[00000m",  // Black color
-        "\033[02;44m",  // Blue color
-        "\033[02;42m",  // Green color
-        "\033[02;46m",  // Cyan color
-        "\033[02;41m",  // Red color
-        "\033[02;45m",  // Magenta color
-        "\033[02;43m",  // Brown color
-        "\033[02;47m",  // Grey color
-        "\033[00;40m",  // Dark grey color
-        "\033[00;44m",  // Light blue color
-        "\033[00;42m",  // Light green color
-        "\033[00;46m",  // Light cyan color
-        "\033[00;41m",  // Light red color
-        "\033[00;45m",  // Light magenta color
-        "\033[00;43m",  // Yellow color
-        "\033[00;47m"   // White color
-    };
-    std::fwrite(backgrounds[(int)background - (int)Color::BLACK], 1, 8, stdout);
-    std::fwrite(colors[(int)color - (int)Color::BLACK], 1, 8, stdout);
+        fatality(SystemException(ex.string()));
+    }
+}
+
+size_t ConsoleBuffer::Write(const void* buffer, size_t size)
+{
+    _buffer.append((const char*)buffer, size);
+    return size;
+}
+
+ConsoleBuffer& ConsoleBuffer::SetColor(Color color, Color background)
+{
+    // Skip repeated changes to the current colors
+    if (((int)color == _color) && ((int)background == _background))
+        return *this;
+
+    // Background sequence resets attributes, so the text color is always written after it
+    _buffer.append(Internals::ConsoleBackgrounds[(int)background - (int)Color::BLACK], 8);
+    _buffer.append(Internals::ConsoleColors[(int)color - (int)Color::BLACK], 8);
+    _color = (int)color;
+    _background = (int)background;
+    return *this;
+}
+
+ConsoleBuffer& ConsoleBuffer::ResetColor()
+{
+    _buffer.append("\033[0m");
+    _color = -1;
+    _background = -1;
+    return *this;
+}
+
+ConsoleBuffer& ConsoleBuffer::MoveTo(int row, int column)
+{
+    return Print("\033[{};{}H", row + 1, column + 1);
+}
+
+ConsoleBuffer& ConsoleBuffer::Move(int count, char direction)
+{
+    if (count > 0)
+        Print("\033[{}{}", count, direction);
+    return *this;
+}
+
+void ConsoleBuffer::Flush()
+{
+    if (_buffer.empty())
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Keep the order with the content buffered in the standard output stream
+    std::fflush(stdout);
+
+    const char* data = _buffer.data();
+    size_t size = _buffer.size();
+    while (size > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            _buffer.clear();
+            throwex SystemException("Cannot write the console buffer into the standard output!");
+        }
+        data += written;
+        size -= (size_t)written;
+    }
 #elif defined(_WIN32) || defined(_WIN64)
+    // Keep the order with the content buffered in the standard output stream
+    std::fflush(stdout);
+
     HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    SetConsoleTextAttribute(hConsole, (((WORD)color) & 0x0F) + ((((WORD)background) & 0x0F) << 4));
+
+    DWORD mode;
+    if (GetConsoleMode(hConsole, &mode))
+    {
+        // Enable ANSI escape sequences processing
+        if ((mode & ENABLE_VIRTUAL_TERMINAL_PROCESSING) == 0)
+            SetConsoleMode(hConsole, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+
+        // Convert the whole console frame into UTF-16 and write it at once
+        int length = MultiByteToWideChar(CP_UTF8, 0, _buffer.data(), (int)_buffer.size(), nullptr, 0);
+        std::wstring wbuffer(length, L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, _buffer.data(), (int)_buffer.size(), wbuffer.data(), length);
+
+        const wchar_t* data = wbuffer.data();
+        DWORD size = (DWORD)wbuffer.size();
+        while (size > 0)
+        {
+            DWORD written;
+            if (!WriteConsoleW(hConsole, data, size, &written, nullptr))
+            {
+                _buffer.clear();
+                throwex SystemException("Cannot write the console buffer into the console!");
+            }
+            data += written;
+            size -= written;
+        }
+    }
+    else
+    {
+        // Redirected standard output is written as is
+        const char* data = _buffer.data();
+        DWORD size = (DWORD)_buffer.size();
+        while (size > 0)
+        {
+            DWORD written;
+            if (!WriteFile(hConsole, data, size, &written, nullptr))
+            {
+                _buffer.clear();
+                throwex SystemException("Cannot write the console buffer into the standard output!");
+            }
+            data += written;
+            size -= written;
+        }
+    }
 #endif
+
+    _buffer.clear();
 }
 
 } // namespace CppCommon
@@ -7,6 +7,7 @@
 */
 
 #include "system/cpu.h"
+#include "system/cpu_topology.h"
 #include "utility/resource.h"
 
 #if defined(__APPLE__)
@@ -19,6 +20,20 @@
 #include <windows.h>
 #endif
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CPPCOMMON_CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)
+#define CPPCOMMON_CPU_ARM
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(__aarch64__)
+#include <sys/auxv.h>
+#endif
+#endif
+
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -44,9 +59,197 @@ DWORD CountSetBits(ULONG_PTR pBitMask)
 
 #endif
 
+#if defined(CPPCOMMON_CPU_X86)
+
+// Helper function to execute CPUID instruction
+void CPUID(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+{
+#if defined(_MSC_VER)
+    int result[4];
+    __cpuidex(result, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; ++i)
+        registers[i] = (uint32_t)result[i];
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+// Helper function to read the extended control register XCR0 with the OS enabled registers state
+uint64_t XGETBV()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+#endif
+
+// Helper function to detect CPU features
+CPUFeatures DetectFeatures()
+{
+    CPUFeatures features;
+
+#if defined(CPPCOMMON_CPU_X86)
+    uint32_t registers[4] = { 0 };
+    CPUID(0, 0, registers);
+    uint32_t max_leaf = registers[0];
+
+    if (max_leaf >= 1)
+    {
+        CPUID(1, 0, registers);
+        uint32_t ecx = registers[2];
+        uint32_t edx = registers[3];
+
+        features.sse2 = (edx & (1u << 26)) != 0;
+        features.sse3 = (ecx & (1u << 0)) != 0;
+        features.pclmul = (ecx & (1u << 1)) != 0;
+        features.ssse3 = (ecx & (1u << 9)) != 0;
+        features.sse41 = (ecx & (1u << 19)) != 0;
+        features.sse42 = (ecx & (1u << 20)) != 0;
+        features.popcnt = (ecx & (1u << 23)) != 0;
+        features.aes = (ecx & (1u << 25)) != 0;
+
+        // CLFLUSH line size is reported in 8 bytes units
+        uint32_t clflush = ((registers[1] >> 8) & 0xFF) * 8;
+        if (clflush > 0)
+            features.cache_line = clflush;
+
+        // AVX registers state must be enabled by the OS
+        bool osxsave = (ecx & (1u << 27)) != 0;
+        uint64_t xcr0 = osxsave ? XGETBV() : 0;
+        bool avx_state = (xcr0 & 0x06) == 0x06;
+        bool avx512_state = (xcr0 & 0xE6) == 0xE6;
+
+        features.avx = avx_state && ((ecx & (1u << 28)) != 0);
+        features.fma = features.avx && ((ecx & (1u << 12)) != 0);
+
+        if (max_leaf >= 7)
+        {
+            CPUID(7, 0, registers);
+            uint32_t ebx7 = registers[1];
+            uint32_t ecx7 = registers[2];
+
+            features.bmi1 = (ebx7 & (1u << 3)) != 0;
+            features.avx2 = features.avx && ((ebx7 & (1u << 5)) != 0);
+            features.bmi2 = (ebx7 & (1u << 8)) != 0;
+            features.sha = (ebx7 & (1u << 29)) != 0;
+            features.avx512f = avx512_state && ((ebx7 & (1u << 16)) != 0);
+            features.avx512dq = features.avx512f && ((ebx7 & (1u << 17)) != 0);
+            features.avx512cd = features.avx512f && ((ebx7 & (1u << 28)) != 0);
+            features.avx512bw = features.avx512f && ((ebx7 & (1u << 30)) != 0);
+            features.avx512vl = features.avx512f && ((ebx7 & (1u << 31)) != 0);
+            features.avx512vbmi = features.avx512f && ((ecx7 & (1u << 1)) != 0);
+            features.avx512vpopcntdq = features.avx512f && ((ecx7 & (1u << 14)) != 0);
+        }
+    }
+
+    CPUID(0x80000000, 0, registers);
+    uint32_t max_extended_leaf = registers[0];
+
+    if (max_extended_leaf >= 0x80000001)
+    {
+        CPUID(0x80000001, 0, registers);
+        features.lzcnt = (registers[2] & (1u << 5)) != 0;
+    }
+    if (max_extended_leaf >= 0x80000007)
+    {
+        CPUID(0x80000007, 0, registers);
+        features.invariant_tsc = (registers[3] & (1u << 8)) != 0;
+    }
+#elif defined(CPPCOMMON_CPU_ARM)
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+    // Advanced SIMD is mandatory on AArch64
+    features.neon = true;
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    // Generic timer virtual counter runs at a fixed frequency
+    features.invariant_tsc = true;
+#endif
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(__aarch64__)
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    features.neon = (hwcap & (1ul << 1)) != 0;              // HWCAP_ASIMD
+    features.crypto = ((hwcap & (1ul << 3)) != 0) &&        // HWCAP_AES
+                      ((hwcap & (1ul << 4)) != 0);          // HWCAP_PMULL
+    features.crc32 = (hwcap & (1ul << 7)) != 0;             // HWCAP_CRC32
+    features.sve = (hwcap & (1ul << 22)) != 0;              // HWCAP_SVE
+    features.sve2 = (hwcap2 & (1ul << 1)) != 0;             // HWCAP2_SVE2
+#elif defined(__APPLE__)
+    int value = 0;
+    size_t size = sizeof(value);
+    features.crc32 = (sysctlbyname("hw.optional.armv8_crc32", &value, &size, nullptr, 0) == 0) && (value != 0);
+    value = 0;
+    size = sizeof(value);
+    features.crypto = (sysctlbyname("hw.optional.arm.FEAT_AES", &value, &size, nullptr, 0) == 0) && (value != 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    features.crc32 = IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != FALSE;
+    features.crypto = IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != FALSE;
+#endif
+#endif
+
+    // Prefer the L1 data cache line size reported by the OS
+    const CPUTopology& topology = CPUTopology::Current();
+    const CPUCache* cache = topology.FindCache(topology.online().first(), 1);
+    if ((cache != nullptr) && (cache->line_size > 0))
+        features.cache_line = cache->line_size;
+
+    return features;
+}
+
 } // namespace Internals
 //! @endcond
 
+std::ostream& operator<<(std::ostream& os, const CPUFeatures& features)
+{
+    const struct { bool enabled; const char* name; } list[] =
+    {
+        { features.sse2, "SSE2" },
+        { features.sse3, "SSE3" },
+        { features.ssse3, "SSSE3" },
+        { features.sse41, "SSE4.1" },
+        { features.sse42, "SSE4.2" },
+        { features.popcnt, "POPCNT" },
+        { features.pclmul, "PCLMUL" },
+        { features.aes, "AES" },
+        { features.sha, "SHA" },
+        { features.avx, "AVX" },
+        { features.avx2, "AVX2" },
+        { features.fma, "FMA" },
+        { features.bmi1, "BMI1" },
+        { features.bmi2, "BMI2" },
+        { features.lzcnt, "LZCNT" },
+        { features.avx512f, "AVX512F" },
+        { features.avx512cd, "AVX512CD" },
+        { features.avx512dq, "AVX512DQ" },
+        { features.avx512bw, "AVX512BW" },
+        { features.avx512vl, "AVX512VL" },
+        { features.avx512vbmi, "AVX512VBMI" },
+        { features.avx512vpopcntdq, "AVX512VPOPCNTDQ" },
+        { features.neon, "NEON" },
+        { features.crc32, "CRC32" },
+        { features.crypto, "CRYPTO" },
+        { features.sve, "SVE" },
+        { features.sve2, "SVE2" },
+        { features.invariant_tsc, "INVARIANT_TSC" }
+    };
+
+    bool first = true;
+    for (const auto& feature : list)
+    {
+        if (!feature.enabled)
+            continue;
+        if (!first)
+            os << ' ';
+        os << feature.name;
+        first = false;
+    }
+    return os;
+}
+
 std::string CPU::Architecture()
 {
 #if defined(__APPLE__)
@@ -137,7 +340,8 @@ std::pair<int, int> CPU::TotalCores()
     return std::make_pair(logical, physical);
 #elif defined(unix) || defined(__unix) || defined(__unix__)
     long processors = sysconf(_SC_NPROCESSORS_ONLN);
-    return std::make_pair(processors, processors);
+    long physical = (long)CPUTopology::Current().cores().size();
+    return std::make_pair(processors, ((physical > 0) && (physical <= processors)) ? physical : processors);
 #elif defined(_WIN32) || defined(_WIN64)
     BOOL allocated = FALSE;
     PSYSTEM_LOGICAL_PROCESSOR_INFORMATION pBuffer = nullptr;
@@ -243,4 +447,10 @@ bool CPU::HyperThreading()
     return (cores.first != cores.second);
 }
 
+const CPUFeatures& CPU::Features()
+{
+    static CPUFeatures features = Internals::DetectFeatures();
+    return features;
+}
+
 } // namespace CppCommon
@@ -0,0 +1,365 @@
+/*!
+    \file cpu_profiler.cpp
+    \brief Sampling CPU profiler implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/cpu_profiler.h"
+
+#include "algorithms/hash.h"
+#include "errors/exceptions.h"
+#include "filesystem/file.h"
+#include "system/stack_trace.h"
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/locker.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+namespace {
+
+// Fixed-size sample slot filled by the signal handler
+struct ProfilerSlot
+{
+    int size;
+    void* frames[CpuProfiler::MAX_FRAMES];
+};
+
+// Stack trace hasher of aggregated samples
+struct ProfilerHash
+{
+    size_t operator()(const std::vector<void*>& frames) const noexcept
+    { return (size_t)FastHash::Compute64(frames.data(), frames.size() * sizeof(void*)); }
+};
+
+// Collector thread drain period
+const Timespan ProfilerPeriod = Timespan::milliseconds(50);
+
+class ProfilerState
+{
+public:
+    CriticalSection control;                    // Start/stop lock
+    CriticalSection lock;                       // Aggregated samples lock
+    std::unordered_map<std::vector<void*>, uint64_t, ProfilerHash> stacks;
+    std::unique_ptr<MPMCRingQueue<ProfilerSlot>> queue;
+    std::atomic<MPMCRingQueue<ProfilerSlot>*> active{nullptr};
+    std::atomic<uint64_t> samples{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<size_t> frequency{0};
+    std::atomic<bool> stop{false};
+    EventAutoReset wake;
+    std::thread collector;
+    bool installed{false};
+
+    void Drain()
+    {
+        if (!queue)
+            return;
+
+        ProfilerSlot slot;
+        Locker<CriticalSection> locker(lock);
+        while (queue->Dequeue(slot))
+        {
+            ++stacks[std::vector<void*>(slot.frames, slot.frames + slot.size)];
+            samples.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+ProfilerState& State()
+{
+    static ProfilerState state;
+    return state;
+}
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+
+void ProfilerHandler([[maybe_unused]] int signo)
+{
+    // Late signals of the stopped timer are ignored
+    MPMCRingQueue<ProfilerSlot>* queue = State().active.load(std::memory_order_acquire);
+    if (queue == nullptr)
+        return;
+
+    int saved = errno;
+
+    // Skip the signal handler and the signal trampoline frames
+    ProfilerSlot slot;
+    slot.size = StackTrace::Capture(slot.frames, CpuProfiler::MAX_FRAMES, 2);
+    if ((slot.size > 0) && !queue->Enqueue(slot))
+        State().dropped.fetch_add(1, std::memory_order_relaxed);
+
+    errno = saved;
+}
+
+#endif
+
+// Function name of the frame or its address
+std::string FrameName(void* address, std::unordered_map<void*, std::string>& names)
+{
+    auto it = names.find(address);
+    if (it != names.end())
+        return it->second;
+
+    std::string name;
+    const auto& frames = StackTrace(&address, 1).frames();
+    if (!frames.empty())
+        name = frames.front().function;
+    if (name.empty())
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%p", address);
+        name = buffer;
+    }
+
+    // Separators of the folded stacks format are replaced
+    std::replace(name.begin(), name.end(), ';', ':');
+    std::replace(name.begin(), name.end(), '\n', ' ');
+
+    names.emplace(address, name);
+    return name;
+}
+
+} // namespace
+
+} // namespace Internals
+//! @endcond
+
+bool CpuProfiler::IsRunning() noexcept
+{
+    return (Internals::State().active.load(std::memory_order_acquire) != nullptr);
+}
+
+size_t CpuProfiler::frequency() noexcept
+{
+    return Internals::State().frequency.load(std::memory_order_relaxed);
+}
+
+uint64_t CpuProfiler::samples() noexcept
+{
+    return Internals::State().samples.load(std::memory_order_relaxed);
+}
+
+uint64_t CpuProfiler::dropped() noexcept
+{
+    return Internals::State().dropped.load(std::memory_order_relaxed);
+}
+
+void CpuProfiler::Start(size_t frequency, size_t capacity)
+{
+    if ((frequency == 0) || (frequency > 1000000))
+        throwex ArgumentException("Invalid CPU profiler sampling frequency!");
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0))
+        throwex ArgumentException("CPU profiler ring queue capacity must be a power of two!");
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    auto& state = Internals::State();
+    Locker<CriticalSection> locker(state.control);
+
+    if (IsRunning())
+        return;
+
+    // Ring queue is reused over restarts, so late signals never touch a deleted one
+    if (!state.queue || (state.queue->capacity() != capacity))
+        state.queue = std::make_unique<MPMCRingQueue<Internals::ProfilerSlot>>(capacity);
+
+    // Warm up the unwinder, so its lazy initialization never happens in the signal handler
+    void* frames[MAX_FRAMES];
+    StackTrace::Capture(frames, MAX_FRAMES);
+
+    // Install the signal handler
+    if (!state.installed)
+    {
+        struct sigaction action = {};
+        action.sa_handler = Internals::ProfilerHandler;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGPROF, &action, nullptr) != 0)
+            throwex SystemException("Failed to setup CPU profiler signal handler!");
+        state.installed = true;
+    }
+
+    state.frequency.store(frequency, std::memory_order_relaxed);
+    state.active.store(state.queue.get(), std::memory_order_release);
+
+    // Start the collector thread
+    state.stop = false;
+    state.collector = Thread::Start([&state]()
+    {
+        while (!state.stop)
+        {
+            state.wake.TryWaitFor(Internals::ProfilerPeriod);
+            state.Drain();
+        }
+    });
+
+    // Start the process CPU timer
+    size_t period = std::max((size_t)1, 1000000 / frequency);
+    struct itimerval timer = {};
+    timer.it_interval.tv_sec = (time_t)(period / 1000000);
+    timer.it_interval.tv_usec = (suseconds_t)(period % 1000000);
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0)
+    {
+        state.active.store(nullptr, std::memory_order_release);
+        state.stop = true;
+        state.wake.Signal();
+        state.collector.join();
+        throwex SystemException("Failed to start CPU profiler timer!");
+    }
+#else
+    throwex SystemException("CPU profiler is not supported!");
+#endif
+}
+
+void CpuProfiler::Stop()
+{
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    auto& state = Internals::State();
+    Locker<CriticalSection> locker(state.control);
+
+    if (!IsRunning())
+        return;
+
+    // Stop the process CPU timer
+    struct itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    state.active.store(nullptr, std::memory_order_release);
+
+    // Stop the collector thread
+    state.stop = true;
+    state.wake.Signal();
+    state.collector.join();
+
+    // Collect remaining samples
+    state.Drain();
+#endif
+}
+
+void CpuProfiler::Reset()
+{
+    auto& state = Internals::State();
+    Locker<CriticalSection> locker(state.lock);
+    state.stacks.clear();
+    state.samples.store(0, std::memory_order_relaxed);
+    state.dropped.store(0, std::memory_order_relaxed);
+}
+
+std::vector<CpuSample> CpuProfiler::Snapshot()
+{
+    auto& state = Internals::State();
+
+    std::vector<CpuSample> result;
+    {
+        Locker<CriticalSection> locker(state.lock);
+        result.reserve(state.stacks.size());
+        for (const auto& stack : state.stacks)
+            result.push_back(CpuSample{ stack.first, stack.second });
+    }
+
+    std::sort(result.begin(), result.end(), [](const CpuSample& sample1, const CpuSample& sample2)
+    {
+        return (sample1.count != sample2.count) ? (sample1.count > sample2.count) : (sample1.frames < sample2.frames);
+    });
+    return result;
+}
+
+std::string CpuProfiler::Folded()
+{
+    std::vector<CpuSample> samples = Snapshot();
+
+    // Symbols are resolved once per unique frame address
+    std::unordered_map<void*, std::string> names;
+
+    // Stack traces with the same function names are merged
+    std::vector<std::pair<std::string, uint64_t>> stacks;
+    std::unordered_map<std::string, size_t> indexes;
+    for (const auto& sample : samples)
+    {
+        std::string stack;
+        for (size_t i = sample.frames.size(); i-- > 0;)
+        {
+            stack.append(Internals::FrameName(sample.frames[i], names));
+            if (i > 0)
+                stack.push_back(';');
+        }
+
+        auto it = indexes.find(stack);
+        if (it != indexes.end())
+            stacks[it->second].second += sample.count;
+        else
+        {
+            indexes.emplace(stack, stacks.size());
+            stacks.emplace_back(std::move(stack), sample.count);
+        }
+    }
+
+    std::stable_sort(stacks.begin(), stacks.end(), [](const auto& stack1, const auto& stack2) { return stack1.second > stack2.second; });
+
+    std::string result;
+    for (const auto& stack : stacks)
+    {
+        result.append(stack.first);
+        result.push_back(' ');
+        result.append(std::to_string(stack.second));
+        result.push_back('\n');
+    }
+    return result;
+}
+
+void CpuProfiler::SavePprof(const Path& path)
+{
+    std::vector<CpuSample> samples = Snapshot();
+
+    // Header: header count, header words, version, sampling period (us), padding
+    size_t frequency = std::max((size_t)1, CpuProfiler::frequency());
+    std::vector<uintptr_t> words = { 0, 3, 0, (uintptr_t)(1000000 / frequency), 0 };
+
+    // Records: samples count, stack trace depth, frames addresses
+    for (const auto& sample : samples)
+    {
+        words.push_back((uintptr_t)sample.count);
+        words.push_back((uintptr_t)sample.frames.size());
+        for (void* frame : sample.frames)
+            words.push_back((uintptr_t)frame);
+    }
+
+    // Trailer
+    words.push_back(0);
+    words.push_back(1);
+    words.push_back(0);
+
+    File file(path);
+    file.Create(false, true);
+    file.Write(words.data(), words.size() * sizeof(uintptr_t));
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Memory mappings of loaded modules are used by pprof to resolve symbols
+    std::string maps = File::ReadAllText("/proc/self/maps");
+    file.Write(maps);
+#endif
+
+    file.Close();
+}
+
+} // namespace CppCommon
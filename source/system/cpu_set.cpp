@@ -0,0 +1,80 @@
+/*!
+    \file cpu_set.cpp
+    \brief CPU set implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/cpu_set.h"
+
+#include <cctype>
+#include <cstdlib>
+
+namespace CppCommon {
+
+std::string CPUSet::string() const
+{
+    std::string result;
+    int cpu = first();
+    while (cpu >= 0)
+    {
+        // Find the end of the current range of CPUs
+        int last = cpu;
+        int current = next(cpu);
+        while (current == (last + 1))
+        {
+            last = current;
+            current = next(current);
+        }
+
+        if (!result.empty())
+            result += ',';
+        result += std::to_string(cpu);
+        if (last > cpu)
+            result += '-' + std::to_string(last);
+
+        cpu = current;
+    }
+    return result;
+}
+
+CPUSet CPUSet::Parse(const std::string& list)
+{
+    CPUSet result;
+
+    const char* current = list.c_str();
+    while (*current != '\0')
+    {
+        // Skip separators and whitespaces
+        if (!std::isdigit((unsigned char)*current))
+        {
+            ++current;
+            continue;
+        }
+
+        // Parse the first CPU of the range
+        char* end = nullptr;
+        long from = std::strtol(current, &end, 10);
+        long to = from;
+        current = end;
+
+        // Parse the last CPU of the range
+        if ((*current == '-') && std::isdigit((unsigned char)current[1]))
+        {
+            to = std::strtol(current + 1, &end, 10);
+            current = end;
+        }
+
+        // Skip invalid or too large ranges
+        if ((from > to) || (to >= 65536))
+            continue;
+
+        for (long cpu = from; cpu <= to; ++cpu)
+            result.set((int)cpu);
+    }
+
+    return result;
+}
+
+} // namespace CppCommon
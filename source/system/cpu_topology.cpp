@@ -0,0 +1,414 @@
+/*!
+    \file cpu_topology.cpp
+    \brief CPU topology implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/cpu_topology.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <dirent.h>
+#include <unistd.h>
+#include <fstream>
+#include <map>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(__APPLE__)
+
+// Helper function to read the integer system control value
+int64_t ReadSysctl(const char* name, int64_t def)
+{
+    int64_t value64 = 0;
+    size_t size = sizeof(value64);
+    if (sysctlbyname(name, &value64, &size, nullptr, 0) != 0)
+        return def;
+    if (size == sizeof(int32_t))
+    {
+        int32_t value32;
+        std::memcpy(&value32, &value64, sizeof(value32));
+        return value32;
+    }
+    return value64;
+}
+
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+
+// Helper function to read the first line of the sysfs file
+bool ReadSysfs(const std::string& path, std::string& value)
+{
+    std::ifstream stream(path);
+    if (!stream)
+        return false;
+    return (bool)std::getline(stream, value);
+}
+
+// Helper function to parse the sysfs cache size (e.g. "32K")
+size_t ParseCacheSize(const std::string& value)
+{
+    char* end = nullptr;
+    size_t result = (size_t)std::strtoull(value.c_str(), &end, 10);
+    if ((end != nullptr) && ((*end == 'K') || (*end == 'k')))
+        result *= 1024;
+    else if ((end != nullptr) && ((*end == 'M') || (*end == 'm')))
+        result *= 1024 * 1024;
+    else if ((end != nullptr) && ((*end == 'G') || (*end == 'g')))
+        result *= 1024 * 1024 * 1024;
+    return result;
+}
+
+#elif defined(_WIN32) || defined(_WIN64)
+
+// Helper function to convert the processor group affinity into the CPU set
+void AddGroupAffinity(const std::vector<int>& bases, const GROUP_AFFINITY& affinity, CPUSet& cpuset)
+{
+    if (affinity.Group >= bases.size())
+        return;
+
+    for (int bit = 0; bit < (int)(sizeof(KAFFINITY) * 8); ++bit)
+        if ((affinity.Mask & ((KAFFINITY)1 << bit)) != 0)
+            cpuset.set(bases[affinity.Group] + bit);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+const CPULocation* CPUTopology::Find(int cpu) const noexcept
+{
+    auto it = std::lower_bound(_cpus.begin(), _cpus.end(), cpu, [](const CPULocation& location, int value) { return location.cpu < value; });
+    return ((it != _cpus.end()) && (it->cpu == cpu)) ? &(*it) : nullptr;
+}
+
+CPUSet CPUTopology::Siblings(int cpu) const
+{
+    const CPULocation* location = Find(cpu);
+    return ((location != nullptr) && (location->core >= 0)) ? _cores[location->core] : CPUSet();
+}
+
+CPUSet CPUTopology::SharedCache(int cpu, int level) const
+{
+    const CPUCache* cache = FindCache(cpu, level);
+    return (cache != nullptr) ? cache->cpus : CPUSet();
+}
+
+const CPUCache* CPUTopology::FindCache(int cpu, int level) const noexcept
+{
+    for (const auto& cache : _caches)
+        if ((cache.level == level) && (cache.type != CPUCacheType::Instruction) && cache.cpus.test(cpu))
+            return &cache;
+    return nullptr;
+}
+
+std::vector<CPUSet> CPUTopology::CacheDomains(int level) const
+{
+    std::vector<CPUSet> result;
+    for (const auto& cache : _caches)
+        if ((cache.level == level) && (cache.type != CPUCacheType::Instruction))
+            result.push_back(cache.cpus);
+    return result;
+}
+
+const CPUTopology& CPUTopology::Current()
+{
+    static CPUTopology topology = Discover();
+    return topology;
+}
+
+void CPUTopology::AddCache(const CPUCache& cache)
+{
+    for (const auto& current : _caches)
+        if ((current.level == cache.level) && (current.type == cache.type) && (current.cpus == cache.cpus))
+            return;
+
+    _caches.push_back(cache);
+}
+
+void CPUTopology::UpdateLocations()
+{
+    // Fallback to a single CPU per core, a single socket and a single NUMA node
+    if (_cores.empty())
+        for (int cpu = _online.first(); cpu >= 0; cpu = _online.next(cpu))
+            _cores.push_back(CPUSet({ cpu }));
+    if (_sockets.empty())
+        _sockets.push_back(_online);
+    if (_nodes.empty())
+        _nodes.push_back(_online);
+
+    // Order caches by level, type and the first CPU
+    std::sort(_caches.begin(), _caches.end(), [](const CPUCache& cache1, const CPUCache& cache2)
+    {
+        if (cache1.level != cache2.level)
+            return cache1.level < cache2.level;
+        if (cache1.type != cache2.type)
+            return cache1.type < cache2.type;
+        return cache1.cpus.first() < cache2.cpus.first();
+    });
+
+    // Find the index of the CPU set containing the given CPU
+    auto find = [](const std::vector<CPUSet>& cpusets, int cpu)
+    {
+        for (size_t i = 0; i < cpusets.size(); ++i)
+            if (cpusets[i].test(cpu))
+                return (int)i;
+        return -1;
+    };
+
+    _cpus.clear();
+    for (int cpu = _online.first(); cpu >= 0; cpu = _online.next(cpu))
+    {
+        CPULocation location;
+        location.cpu = cpu;
+        location.core = find(_cores, cpu);
+        location.socket = find(_sockets, cpu);
+        location.node = find(_nodes, cpu);
+        _cpus.push_back(location);
+    }
+}
+
+CPUTopology CPUTopology::Discover()
+{
+    CPUTopology result;
+
+#if defined(__APPLE__)
+    int logical = (int)Internals::ReadSysctl("hw.logicalcpu", 1);
+    int physical = (int)Internals::ReadSysctl("hw.physicalcpu", logical);
+    if (logical <= 0)
+        logical = 1;
+    if ((physical <= 0) || (physical > logical))
+        physical = logical;
+
+    for (int cpu = 0; cpu < logical; ++cpu)
+        result._online.set(cpu);
+
+    // Approximate physical cores with consecutive SMT siblings
+    int threads = logical / physical;
+    for (int core = 0; core < physical; ++core)
+    {
+        CPUSet siblings;
+        for (int thread = 0; thread < threads; ++thread)
+            siblings.set(core * threads + thread);
+        result._cores.push_back(siblings);
+    }
+
+    // Approximate caches: L1 caches per core, L2 and L3 caches shared by all CPUs
+    size_t line_size = (size_t)Internals::ReadSysctl("hw.cachelinesize", 64);
+    const struct { const char* name; int level; CPUCacheType type; } caches[] =
+    {
+        { "hw.l1dcachesize", 1, CPUCacheType::Data },
+        { "hw.l1icachesize", 1, CPUCacheType::Instruction },
+        { "hw.l2cachesize", 2, CPUCacheType::Unified },
+        { "hw.l3cachesize", 3, CPUCacheType::Unified }
+    };
+    for (const auto& info : caches)
+    {
+        int64_t size = Internals::ReadSysctl(info.name, 0);
+        if (size <= 0)
+            continue;
+
+        CPUCache cache;
+        cache.level = info.level;
+        cache.type = info.type;
+        cache.size = (size_t)size;
+        cache.line_size = line_size;
+        if (info.level == 1)
+        {
+            for (const auto& core : result._cores)
+            {
+                cache.cpus = core;
+                result.AddCache(cache);
+            }
+        }
+        else
+        {
+            cache.cpus = result._online;
+            result.AddCache(cache);
+        }
+    }
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    const std::string root = "/sys/devices/system/cpu/";
+
+    std::string value;
+    if (Internals::ReadSysfs(root + "online", value))
+        result._online = CPUSet::Parse(value);
+    if (result._online.empty())
+    {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        for (long cpu = 0; cpu < std::max(processors, 1l); ++cpu)
+            result._online.set((int)cpu);
+    }
+
+    std::map<long, int> packages;
+    for (int cpu = result._online.first(); cpu >= 0; cpu = result._online.next(cpu))
+    {
+        const std::string path = root + "cpu" + std::to_string(cpu) + "/";
+
+        // Physical core is registered by its first online SMT sibling
+        CPUSet siblings;
+        if (Internals::ReadSysfs(path + "topology/thread_siblings_list", value))
+            siblings = CPUSet::Parse(value) & result._online;
+        if (siblings.empty())
+            siblings.set(cpu);
+        if (siblings.first() == cpu)
+            result._cores.push_back(siblings);
+
+        // Socket
+        long package = 0;
+        if (Internals::ReadSysfs(path + "topology/physical_package_id", value))
+            package = std::max(std::strtol(value.c_str(), nullptr, 10), 0l);
+        auto it = packages.find(package);
+        if (it == packages.end())
+        {
+            it = packages.emplace(package, (int)result._sockets.size()).first;
+            result._sockets.emplace_back();
+        }
+        result._sockets[it->second].set(cpu);
+
+        // Caches
+        for (int index = 0; ; ++index)
+        {
+            const std::string cache_path = path + "cache/index" + std::to_string(index) + "/";
+            if (!Internals::ReadSysfs(cache_path + "level", value))
+                break;
+
+            CPUCache cache;
+            cache.level = std::atoi(value.c_str());
+            if (Internals::ReadSysfs(cache_path + "type", value))
+                cache.type = (value == "Data") ? CPUCacheType::Data : ((value == "Instruction") ? CPUCacheType::Instruction : CPUCacheType::Unified);
+            if (Internals::ReadSysfs(cache_path + "size", value))
+                cache.size = Internals::ParseCacheSize(value);
+            if (Internals::ReadSysfs(cache_path + "coherency_line_size", value))
+                cache.line_size = (size_t)std::strtoull(value.c_str(), nullptr, 10);
+            if (Internals::ReadSysfs(cache_path + "shared_cpu_list", value))
+                cache.cpus = CPUSet::Parse(value) & result._online;
+            if (cache.cpus.empty())
+                cache.cpus.set(cpu);
+            result.AddCache(cache);
+        }
+    }
+
+    // NUMA nodes ordered by the node index (memory only nodes are skipped)
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (dir != nullptr)
+    {
+        std::vector<long> indexes;
+        for (struct dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+        {
+            const char* name = entry->d_name;
+            if ((std::strncmp(name, "node", 4) == 0) && std::isdigit((unsigned char)name[4]))
+                indexes.push_back(std::strtol(name + 4, nullptr, 10));
+        }
+        closedir(dir);
+
+        std::sort(indexes.begin(), indexes.end());
+        for (long index : indexes)
+        {
+            if (!Internals::ReadSysfs("/sys/devices/system/node/node" + std::to_string(index) + "/cpulist", value))
+                continue;
+
+            CPUSet node = CPUSet::Parse(value) & result._online;
+            if (!node.empty())
+                result._nodes.push_back(node);
+        }
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    // Global logical CPU index of the first CPU in each processor group
+    std::vector<int> bases;
+    int base = 0;
+    WORD groups = GetActiveProcessorGroupCount();
+    for (WORD group = 0; group < groups; ++group)
+    {
+        bases.push_back(base);
+        base += (int)GetActiveProcessorCount(group);
+    }
+
+    DWORD dwLength = 0;
+    std::vector<uint8_t> buffer;
+    if (!GetLogicalProcessorInformationEx(RelationAll, nullptr, &dwLength) && (GetLastError() == ERROR_INSUFFICIENT_BUFFER))
+    {
+        buffer.resize(dwLength);
+        if (!GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)buffer.data(), &dwLength))
+            dwLength = 0;
+    }
+    else
+        dwLength = 0;
+
+    DWORD dwOffset = 0;
+    while (dwOffset < dwLength)
+    {
+        PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX pCurrent = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer.data() + dwOffset);
+        switch (pCurrent->Relationship)
+        {
+            case RelationProcessorCore:
+            {
+                CPUSet core;
+                for (WORD group = 0; group < pCurrent->Processor.GroupCount; ++group)
+                    Internals::AddGroupAffinity(bases, pCurrent->Processor.GroupMask[group], core);
+                result._online |= core;
+                result._cores.push_back(core);
+                break;
+            }
+            case RelationProcessorPackage:
+            {
+                CPUSet socket;
+                for (WORD group = 0; group < pCurrent->Processor.GroupCount; ++group)
+                    Internals::AddGroupAffinity(bases, pCurrent->Processor.GroupMask[group], socket);
+                result._sockets.push_back(socket);
+                break;
+            }
+            case RelationNumaNode:
+            {
+                CPUSet node;
+                Internals::AddGroupAffinity(bases, pCurrent->NumaNode.GroupMask, node);
+                if (!node.empty())
+                    result._nodes.push_back(node);
+                break;
+            }
+            case RelationCache:
+            {
+                if (pCurrent->Cache.Type == CacheTrace)
+                    break;
+
+                CPUCache cache;
+                cache.level = pCurrent->Cache.Level;
+                cache.type = (pCurrent->Cache.Type == CacheData) ? CPUCacheType::Data : ((pCurrent->Cache.Type == CacheInstruction) ? CPUCacheType::Instruction : CPUCacheType::Unified);
+                cache.size = pCurrent->Cache.CacheSize;
+                cache.line_size = pCurrent->Cache.LineSize;
+                Internals::AddGroupAffinity(bases, pCurrent->Cache.GroupMask, cache.cpus);
+                result.AddCache(cache);
+                break;
+            }
+            default:
+                break;
+        }
+        dwOffset += pCurrent->Size;
+    }
+
+    if (result._online.empty())
+        for (int cpu = 0; cpu < std::max(base, 1); ++cpu)
+            result._online.set(cpu);
+#else
+    #error Unsupported platform
+#endif
+
+    result.UpdateLocations();
+    return result;
+}
+
+} // namespace CppCommon
@@ -12,6 +12,7 @@
 #include "string/format.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <atomic>
 #include <cassert>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -24,6 +25,13 @@ namespace CppCommon {
 
 //! @cond INTERNALS
 
+namespace {
+
+// Generations of loaded libraries
+std::atomic<uint64_t> generations(0);
+
+} // namespace
+
 class DLL::Impl
 {
 public:
@@ -83,24 +91,32 @@ public:
             _path.Concat(DLL::extension());
     }
 
-    bool Load()
+    bool Load(const Flags<DLLFlags>& flags)
     {
         assert(!IsLoaded() && "DLL is already loaded!");
         if (IsLoaded())
             Unload();
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        _dll = dlopen(_path.string().c_str(), RTLD_NOW);
+        int mode = (flags & DLLFlags::LAZY) ? RTLD_LAZY : RTLD_NOW;
+        mode |= (flags & DLLFlags::GLOBAL) ? RTLD_GLOBAL : RTLD_LOCAL;
+        if (flags & DLLFlags::NODELETE)
+            mode |= RTLD_NODELETE;
+#if defined(RTLD_DEEPBIND)
+        if (flags & DLLFlags::DEEPBIND)
+            mode |= RTLD_DEEPBIND;
+#endif
+        _dll = dlopen(_path.string().c_str(), mode);
 #elif defined(_WIN32) || defined(_WIN64)
         _dll = LoadLibraryExW(_path.wstring().c_str(), nullptr, 0);
 #endif
         return (_dll != nullptr);
     }
 
-    bool Load(const Path& path)
+    bool Load(const Path& path, const Flags<DLLFlags>& flags)
     {
         Assign(path);
-        return Load();
+        return Load(flags);
     }
 
     void Unload()
@@ -144,7 +160,7 @@ private:
 
 //! @endcond
 
-DLL::DLL()
+DLL::DLL() : _generation(0)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -155,7 +171,7 @@ DLL::DLL()
     new(&_storage)Impl();
 }
 
-DLL::DLL(const Path& path, bool load)
+DLL::DLL(const Path& path, bool load, const Flags<DLLFlags>& flags) : _generation(0)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -168,10 +184,10 @@ DLL::DLL(const Path& path, bool load)
     impl().Assign(path);
 
     if (load)
-        impl().Load();
+        Load(flags);
 }
 
-DLL::DLL(const DLL& dll)
+DLL::DLL(const DLL& dll) : _generation(0)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -184,7 +200,7 @@ DLL::DLL(const DLL& dll)
     impl().Assign(dll.path());
 }
 
-DLL::DLL(DLL&& dll) noexcept
+DLL::DLL(DLL&& dll) noexcept : _generation(0)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -195,6 +211,7 @@ DLL::DLL(DLL&& dll) noexcept
     new(&_storage)Impl();
 
     std::swap(_storage, dll._storage);
+    std::swap(_generation, dll._generation);
 }
 
 DLL::~DLL()
@@ -206,18 +223,21 @@ DLL::~DLL()
 DLL& DLL::operator=(const Path& path)
 {
     impl().Assign(path);
+    _generation = 0;
     return *this;
 }
 
 DLL& DLL::operator=(const DLL& dll)
 {
     impl().Assign(dll.path());
+    _generation = 0;
     return *this;
 }
 
 DLL& DLL::operator=(DLL&& dll) noexcept
 {
     std::swap(_storage, dll._storage);
+    std::swap(_generation, dll._generation);
     return *this;
 }
 
@@ -226,9 +246,29 @@ const Path DLL::path() const { return impl().path(); }
 bool DLL::IsLoaded() const { return impl().IsLoaded(); }
 bool DLL::IsResolve(const std::string& name) const { return impl().IsResolve(name); }
 
-bool DLL::Load() { return impl().Load(); }
-bool DLL::Load(const Path& path) { return impl().Load(path); }
-void DLL::Unload() { impl().Unload(); }
+bool DLL::Load(const Flags<DLLFlags>& flags)
+{
+    _generation = 0;
+    bool result = impl().Load(flags);
+    if (result)
+        _generation = ++generations;
+    return result;
+}
+
+bool DLL::Load(const Path& path, const Flags<DLLFlags>& flags)
+{
+    _generation = 0;
+    bool result = impl().Load(path, flags);
+    if (result)
+        _generation = ++generations;
+    return result;
+}
+
+void DLL::Unload()
+{
+    impl().Unload();
+    _generation = 0;
+}
 
 void* DLL::ResolveAddress(const std::string& name) const { return impl().ResolveAddress(name); }
 
@@ -236,6 +276,7 @@ void DLL::swap(DLL& dll) noexcept
 {
     using std::swap;
     swap(_storage, dll._storage);
+    swap(_generation, dll._generation);
 }
 
 } // namespace CppCommon
@@ -11,9 +11,12 @@
 #include "string/encoding.h"
 #include "utility/resource.h"
 
+#include <atomic>
 #include <codecvt>
 #include <cstring>
 #include <locale>
+#include <memory>
+#include <mutex>
 #include <sstream>
 
 #if defined(__APPLE__)
@@ -499,6 +502,7 @@ void Environment::SetEnvar(const std::string name, const std::string value)
     if (!SetEnvironmentVariableW(Encoding::FromUTF8(name).c_str(), Encoding::FromUTF8(value).c_str()))
         throwex SystemException("Cannot set environment variable - " + name);
 #endif
+    Refresh();
 }
 
 void Environment::ClearEnvar(const std::string name)
@@ -509,6 +513,125 @@ void Environment::ClearEnvar(const std::string name)
 #elif defined(_WIN32) || defined(_WIN64)
     if (!SetEnvironmentVariableW(Encoding::FromUTF8(name).c_str(), nullptr))
         throwex SystemException("Cannot clear environment variable - " + name);
+#endif
+    Refresh();
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Published environment variables snapshot
+std::atomic<const EnvironmentSnapshot*> environment_snapshot(nullptr);
+
+// Environment variables snapshots are kept until the process exit, because their views might be still in use
+struct EnvironmentSnapshots
+{
+    std::mutex lock;
+    std::vector<std::unique_ptr<EnvironmentSnapshot>> snapshots;
+};
+
+EnvironmentSnapshots& GetEnvironmentSnapshots()
+{
+    static EnvironmentSnapshots instance;
+    return instance;
+}
+
+} // namespace Internals
+//! @endcond
+
+const EnvironmentSnapshot& Environment::Snapshot()
+{
+    const EnvironmentSnapshot* snapshot = Internals::environment_snapshot.load(std::memory_order_acquire);
+    if (snapshot == nullptr)
+    {
+        Refresh();
+        snapshot = Internals::environment_snapshot.load(std::memory_order_acquire);
+    }
+    return *snapshot;
+}
+
+void Environment::Refresh()
+{
+    auto& instance = Internals::GetEnvironmentSnapshots();
+    std::scoped_lock locker(instance.lock);
+
+    auto envars = Environment::envars();
+    auto snapshot = std::make_unique<EnvironmentSnapshot>(std::vector<EnvironmentSnapshot::Envar>(envars.begin(), envars.end()));
+    Internals::environment_snapshot.store(snapshot.get(), std::memory_order_release);
+    instance.snapshots.emplace_back(std::move(snapshot));
+}
+
+EnvironmentSnapshot::EnvironmentSnapshot(std::vector<Envar> envars)
+    : _envars(std::move(envars))
+{
+    // Hash table is kept at most half full
+    size_t capacity = 16;
+    while (capacity < (_envars.size() * 2))
+        capacity *= 2;
+    _mask = capacity - 1;
+
+    _hashes.reserve(_envars.size());
+    _buckets.resize(capacity, 0);
+    for (size_t i = 0; i < _envars.size(); ++i)
+    {
+        uint64_t hash = Hash(_envars[i].first);
+        _hashes.push_back(hash);
+
+        size_t bucket = (size_t)hash & _mask;
+        while (_buckets[bucket] != 0)
+            bucket = (bucket + 1) & _mask;
+        _buckets[bucket] = (uint32_t)(i + 1);
+    }
+}
+
+const std::string* EnvironmentSnapshot::Find(std::string_view name) const noexcept
+{
+    uint64_t hash = Hash(name);
+    for (size_t bucket = (size_t)hash & _mask; _buckets[bucket] != 0; bucket = (bucket + 1) & _mask)
+    {
+        size_t index = _buckets[bucket] - 1;
+        if ((_hashes[index] == hash) && Equals(_envars[index].first, name))
+            return &_envars[index].second;
+    }
+    return nullptr;
+}
+
+uint64_t EnvironmentSnapshot::Hash(std::string_view name) noexcept
+{
+    // FNV-1a hash
+    uint64_t hash = 14695981039346656037ull;
+    for (char ch : name)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        // Windows environment variable names are case-insensitive
+        if ((ch >= 'a') && (ch <= 'z'))
+            ch -= 'a' - 'A';
+#endif
+        hash ^= (uint8_t)ch;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool EnvironmentSnapshot::Equals(std::string_view name1, std::string_view name2) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (name1.size() != name2.size())
+        return false;
+    for (size_t i = 0; i < name1.size(); ++i)
+    {
+        char ch1 = name1[i];
+        char ch2 = name2[i];
+        if ((ch1 >= 'a') && (ch1 <= 'z'))
+            ch1 -= 'a' - 'A';
+        if ((ch2 >= 'a') && (ch2 <= 'z'))
+            ch2 -= 'a' - 'A';
+        if (ch1 != ch2)
+            return false;
+    }
+    return true;
+#else
+    return (name1 == name2);
 #endif
 }
 
@@ -0,0 +1,395 @@
+/*!
+    \file flight_recorder.cpp
+    \brief Crash-safe flight recorder implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/flight_recorder.h"
+
+#include "errors/exceptions.h"
+#include "errors/exceptions_handler.h"
+#include "memory/memory.h"
+#include "system/process.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "time/time_format.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+std::atomic<bool> flight_recorder_enabled(false);
+
+namespace {
+
+// Flight recorder segment magic ("FLRC") and layout version
+const uint32_t FlightMagic = 0x43524C46;
+const uint32_t FlightVersion = 1;
+
+// Segment header placed at the beginning of the shared memory
+struct alignas(64) FlightHeader
+{
+    std::atomic<uint32_t> initialized;
+    uint32_t version;
+    uint64_t threads;
+    uint64_t capacity;
+    uint64_t pid;
+    uint64_t base_nano;             // Timestamp::tsc() value at setup
+    uint64_t base_utc;              // UTC timestamp at setup
+    std::atomic<uint64_t> dropped;
+};
+
+// Thread ring header followed by the ring events
+struct alignas(64) FlightRing
+{
+    std::atomic<uint64_t> owner;    // Non-zero while the ring is claimed by the thread
+    std::atomic<uint64_t> thread;   // Thread Id of the last owner
+    std::atomic<uint64_t> position; // Count of recorded events
+};
+
+// Fixed-size ring event slot
+struct alignas(64) FlightSlot
+{
+    std::atomic<uint64_t> sequence; // Zero while the slot is written, position + 1 otherwise
+    uint64_t nano;
+    uint64_t argument;
+    uint32_t code;
+    uint32_t size;
+    char message[FlightRecorder::MESSAGE_SIZE];
+};
+
+static_assert((sizeof(FlightSlot) == 64), "Flight recorder slot must be 64 bytes!");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Flight recorder atomics must be lock-free!");
+
+// Flight recorder state
+struct FlightState
+{
+    CriticalSection lock;
+    std::unique_ptr<SharedMemory> shared;
+    FlightHeader* header{nullptr};
+    uint8_t* rings{nullptr};
+    size_t threads{0};
+    size_t capacity{0};
+    bool dump_handler{false};
+
+    ~FlightState()
+    {
+        // Stop recording before the shared memory is unmapped
+        flight_recorder_enabled.store(false, std::memory_order_release);
+    }
+};
+
+FlightState& GetFlightState()
+{
+    static FlightState state;
+    return state;
+}
+
+size_t RingSize(size_t capacity) noexcept
+{
+    return sizeof(FlightRing) + capacity * sizeof(FlightSlot);
+}
+
+FlightRing* GetRing(uint8_t* rings, size_t capacity, size_t index) noexcept
+{
+    return reinterpret_cast<FlightRing*>(rings + index * RingSize(capacity));
+}
+
+FlightSlot* GetSlots(FlightRing* ring) noexcept
+{
+    return reinterpret_cast<FlightSlot*>(reinterpret_cast<uint8_t*>(ring) + sizeof(FlightRing));
+}
+
+uint64_t CurrentFlightThreadId() noexcept
+{
+#if defined(__APPLE__)
+    uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    return tid;
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+    return (uint64_t)syscall(SYS_gettid);
+#elif defined(_WIN32) || defined(_WIN64)
+    return (uint64_t)GetCurrentThreadId();
+#else
+    return Thread::CurrentThreadId();
+#endif
+}
+
+// Flight recorder ring of the thread
+struct FlightThread
+{
+    FlightRing* ring{nullptr};
+    FlightSlot* slots{nullptr};
+    uint64_t mask{0};
+    bool claimed{false};
+
+    ~FlightThread()
+    {
+        // Release the ring for new threads, recorded events are kept
+        if ((ring != nullptr) && flight_recorder_enabled.load(std::memory_order_acquire))
+            ring->owner.store(0, std::memory_order_release);
+    }
+};
+
+thread_local FlightThread flight_thread;
+
+// Claim the ring for the current thread
+bool ClaimRing(FlightThread& current) noexcept
+{
+    FlightState& state = GetFlightState();
+    current.claimed = true;
+
+    // Prefer never used rings to keep events of finished threads longer
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < state.threads; ++i)
+        {
+            FlightRing* ring = GetRing(state.rings, state.capacity, i);
+            if ((pass == 0) && (ring->position.load(std::memory_order_relaxed) != 0))
+                continue;
+
+            uint64_t expected = 0;
+            if (ring->owner.compare_exchange_strong(expected, 1, std::memory_order_acq_rel))
+            {
+                FlightSlot* slots = GetSlots(ring);
+
+                // Reused ring is cleared, because events do not contain the thread Id
+                if (ring->position.load(std::memory_order_relaxed) != 0)
+                {
+                    for (size_t j = 0; j < state.capacity; ++j)
+                        slots[j].sequence.store(0, std::memory_order_relaxed);
+                    ring->position.store(0, std::memory_order_release);
+                }
+                ring->thread.store(CurrentFlightThreadId(), std::memory_order_release);
+
+                current.ring = ring;
+                current.slots = slots;
+                current.mask = state.capacity - 1;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void RecordEvent(uint32_t code, const char* message, size_t size, uint64_t argument) noexcept
+{
+    FlightThread& current = flight_thread;
+    if (current.ring == nullptr)
+    {
+        if (current.claimed || !ClaimRing(current))
+        {
+            GetFlightState().header->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    // Single writer of the ring publishes the slot with its sequence number
+    uint64_t position = current.ring->position.load(std::memory_order_relaxed);
+    FlightSlot& slot = current.slots[position & current.mask];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.nano = Timestamp::tsc();
+    slot.argument = argument;
+    slot.code = code;
+    slot.size = (uint32_t)std::min(size, FlightRecorder::MESSAGE_SIZE);
+    if (slot.size > 0)
+        std::memcpy(slot.message, message, slot.size);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    current.ring->position.store(position + 1, std::memory_order_release);
+}
+
+} // namespace
+} // namespace Internals
+//! @endcond
+
+std::ostream& operator<<(std::ostream& os, const FlightEvent& event)
+{
+    os << TimeFormat::FormatISO8601(event.timestamp) << " [" << event.thread << "] #" << event.sequence;
+    os << " code=" << event.code << " argument=" << event.argument;
+    if (!event.message.empty())
+        os << ' ' << event.message;
+    return os;
+}
+
+std::string FlightRecorder::name()
+{
+    Internals::FlightState& state = Internals::GetFlightState();
+    Locker<CriticalSection> locker(state.lock);
+    return state.shared ? state.shared->name() : std::string();
+}
+
+uint64_t FlightRecorder::dropped() noexcept
+{
+    Internals::FlightState& state = Internals::GetFlightState();
+    if (!enabled())
+        return 0;
+    return state.header->dropped.load(std::memory_order_relaxed);
+}
+
+size_t FlightRecorder::SegmentSize(size_t threads, size_t capacity) noexcept
+{
+    return sizeof(Internals::FlightHeader) + threads * Internals::RingSize(capacity);
+}
+
+void FlightRecorder::Setup(const std::string& name, size_t threads, size_t capacity)
+{
+    assert((threads > 0) && "Flight recorder threads count must be greater than zero!");
+    if (threads == 0)
+        throwex ArgumentException("Flight recorder threads count must be greater than zero!");
+    assert((capacity > 0) && ((capacity & (capacity - 1)) == 0) && "Flight recorder capacity must be a power of two!");
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0))
+        throwex ArgumentException("Flight recorder capacity must be a power of two!");
+
+    Internals::FlightState& state = Internals::GetFlightState();
+    Locker<CriticalSection> locker(state.lock);
+
+    // Check for double initialization
+    if (state.shared)
+        return;
+
+    auto shared = std::make_unique<SharedMemory>(name, SegmentSize(threads, capacity));
+
+    // Calibrate the TSC timestamp before the first record
+    uint64_t base_nano = Timestamp::tsc();
+    uint64_t base_utc = Timestamp::utc();
+
+    // Initialize the segment even if it was left by the crashed process with the same name
+    auto header = static_cast<Internals::FlightHeader*>(shared->ptr());
+    header->initialized.store(0, std::memory_order_relaxed);
+    Memory::StreamFill(static_cast<uint8_t*>(shared->ptr()) + sizeof(Internals::FlightHeader), 0, shared->size() - sizeof(Internals::FlightHeader));
+    header->version = Internals::FlightVersion;
+    header->threads = threads;
+    header->capacity = capacity;
+    header->pid = Process::CurrentProcessId();
+    header->base_nano = base_nano;
+    header->base_utc = base_utc;
+    header->dropped.store(0, std::memory_order_relaxed);
+    header->initialized.store(Internals::FlightMagic, std::memory_order_release);
+
+    state.header = header;
+    state.rings = static_cast<uint8_t*>(shared->ptr()) + sizeof(Internals::FlightHeader);
+    state.threads = threads;
+    state.capacity = capacity;
+    state.shared = std::move(shared);
+
+    if (!state.dump_handler)
+    {
+        ExceptionsHandler::AddDumpHandler([]() { FlightRecorder::Dump(); });
+        state.dump_handler = true;
+    }
+
+    Internals::flight_recorder_enabled.store(true, std::memory_order_release);
+}
+
+void FlightRecorder::Record(uint32_t code, uint64_t argument) noexcept
+{
+    if (enabled())
+        Internals::RecordEvent(code, nullptr, 0, argument);
+}
+
+void FlightRecorder::Record(uint32_t code, std::string_view message, uint64_t argument) noexcept
+{
+    if (enabled())
+        Internals::RecordEvent(code, message.data(), message.size(), argument);
+}
+
+std::vector<FlightEvent> FlightRecorder::Snapshot()
+{
+    Internals::FlightState& state = Internals::GetFlightState();
+    if (!enabled())
+        return std::vector<FlightEvent>();
+    return Read(*state.shared);
+}
+
+std::vector<FlightEvent> FlightRecorder::Read(const SharedMemory& shared)
+{
+    std::vector<FlightEvent> events;
+
+    auto data = static_cast<const uint8_t*>(shared.ptr());
+    if ((data == nullptr) || (shared.size() < sizeof(Internals::FlightHeader)))
+        return events;
+
+    auto header = reinterpret_cast<const Internals::FlightHeader*>(data);
+    if ((header->initialized.load(std::memory_order_acquire) != Internals::FlightMagic) || (header->version != Internals::FlightVersion))
+        return events;
+    size_t threads = (size_t)header->threads;
+    size_t capacity = (size_t)header->capacity;
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0) || (shared.size() < SegmentSize(threads, capacity)))
+        return events;
+
+    uint8_t* rings = const_cast<uint8_t*>(data) + sizeof(Internals::FlightHeader);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        Internals::FlightRing* ring = Internals::GetRing(rings, capacity, i);
+        uint64_t position = ring->position.load(std::memory_order_acquire);
+        if (position == 0)
+            continue;
+        uint64_t thread = ring->thread.load(std::memory_order_acquire);
+        Internals::FlightSlot* slots = Internals::GetSlots(ring);
+
+        uint64_t first = (position > capacity) ? (position - capacity) : 0;
+        for (uint64_t j = first; j < position; ++j)
+        {
+            Internals::FlightSlot& slot = slots[j & (capacity - 1)];
+
+            // Copy the slot and check that it was not overwritten meanwhile
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != (j + 1))
+                continue;
+            uint64_t nano = slot.nano;
+            uint64_t argument = slot.argument;
+            uint32_t code = slot.code;
+            uint32_t size = std::min(slot.size, (uint32_t)MESSAGE_SIZE);
+            char message[MESSAGE_SIZE];
+            std::memcpy(message, slot.message, size);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+                continue;
+
+            FlightEvent event;
+            event.thread = thread;
+            event.sequence = sequence;
+            uint64_t utc = header->base_utc + ((nano > header->base_nano) ? (nano - header->base_nano) : 0);
+            event.timestamp = UtcTimestamp(Timestamp(utc));
+            event.code = code;
+            event.argument = argument;
+            event.message.assign(message, size);
+            events.emplace_back(std::move(event));
+        }
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const FlightEvent& e1, const FlightEvent& e2) { return e1.timestamp < e2.timestamp; });
+    return events;
+}
+
+void FlightRecorder::Dump(std::ostream& stream)
+{
+    if (!enabled())
+        return;
+
+    std::vector<FlightEvent> events = Snapshot();
+    stream << "Flight recorder (" << events.size() << " events):" << std::endl;
+    for (const auto& event : events)
+        stream << event << std::endl;
+}
+
+} // namespace CppCommon
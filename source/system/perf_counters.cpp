@@ -0,0 +1,223 @@
+/*!
+    \file perf_counters.cpp
+    \brief Hardware performance counters implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/perf_counters.h"
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+int PerfEventOpen(uint32_t type, uint64_t config, int group)
+{
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (group < 0) ? 1 : 0;
+    attr.exclude_kernel = (type != PERF_TYPE_SOFTWARE) ? 1 : 0;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+uint64_t PerfCounterValues::value(PerfEvent event) const noexcept
+{
+    switch (event)
+    {
+        case PerfEvent::CYCLES:
+            return cycles;
+        case PerfEvent::INSTRUCTIONS:
+            return instructions;
+        case PerfEvent::L1D_MISSES:
+            return l1d_misses;
+        case PerfEvent::LLC_MISSES:
+            return llc_misses;
+        case PerfEvent::BRANCH_MISSES:
+            return branch_misses;
+        case PerfEvent::CONTEXT_SWITCHES:
+            return context_switches;
+        default:
+            return 0;
+    }
+}
+
+PerfCounterValues& PerfCounterValues::operator+=(const PerfCounterValues& values) noexcept
+{
+    cycles += values.cycles;
+    instructions += values.instructions;
+    l1d_misses += values.l1d_misses;
+    llc_misses += values.llc_misses;
+    branch_misses += values.branch_misses;
+    context_switches += values.context_switches;
+    return *this;
+}
+
+PerfCounterValues& PerfCounterValues::operator-=(const PerfCounterValues& values) noexcept
+{
+    cycles -= values.cycles;
+    instructions -= values.instructions;
+    l1d_misses -= values.l1d_misses;
+    llc_misses -= values.llc_misses;
+    branch_misses -= values.branch_misses;
+    context_switches -= values.context_switches;
+    return *this;
+}
+
+PerfCounters::PerfCounters() : _count(0)
+{
+    for (size_t i = 0; i < EVENTS; ++i)
+        _fds[i] = -1;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    const struct { uint32_t type; uint64_t config; } events[EVENTS] =
+    {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES }
+    };
+
+    // Open all supported events as a single group led by the first opened event
+    int leader = -1;
+    for (size_t i = 0; i < EVENTS; ++i)
+    {
+        int fd = Internals::PerfEventOpen(events[i].type, events[i].config, leader);
+        if (fd < 0)
+            continue;
+
+        if (leader < 0)
+            leader = fd;
+        _fds[i] = fd;
+        _order[_count++] = i;
+    }
+
+    // Start the group
+    if (leader >= 0)
+    {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Close group members before the group leader
+    for (size_t i = _count; i-- > 0;)
+        close(_fds[_order[i]]);
+#endif
+}
+
+PerfCounterValues PerfCounters::Read() const noexcept
+{
+    PerfCounterValues result;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    if (_count == 0)
+        return result;
+
+    // Group read format: count, time enabled, time running, values
+    uint64_t buffer[3 + EVENTS];
+    ssize_t size = read(_fds[_order[0]], buffer, sizeof(buffer));
+    if ((size < (ssize_t)(3 * sizeof(uint64_t))) || (buffer[0] != _count))
+        return result;
+
+    uint64_t enabled = buffer[1];
+    uint64_t running = buffer[2];
+
+    uint64_t* values[EVENTS] = { &result.cycles, &result.instructions, &result.l1d_misses, &result.llc_misses, &result.branch_misses, &result.context_switches };
+    for (size_t i = 0; i < _count; ++i)
+    {
+        uint64_t value = buffer[3 + i];
+
+        // Scale values of multiplexed counters
+        if ((running > 0) && (running < enabled))
+            value = (uint64_t)((double)value * ((double)enabled / (double)running));
+
+        *values[_order[i]] = value;
+    }
+#endif
+
+    return result;
+}
+
+PerfCounters& PerfCounters::thread()
+{
+    thread_local PerfCounters counters;
+    return counters;
+}
+
+PerfCounterValues PerfProbe::total() const noexcept
+{
+    PerfCounterValues result;
+    result.cycles = _values[0].load(std::memory_order_relaxed);
+    result.instructions = _values[1].load(std::memory_order_relaxed);
+    result.l1d_misses = _values[2].load(std::memory_order_relaxed);
+    result.llc_misses = _values[3].load(std::memory_order_relaxed);
+    result.branch_misses = _values[4].load(std::memory_order_relaxed);
+    result.context_switches = _values[5].load(std::memory_order_relaxed);
+    return result;
+}
+
+PerfCounterValues PerfProbe::average() const noexcept
+{
+    PerfCounterValues result = total();
+    uint64_t count = samples();
+    if (count > 0)
+    {
+        result.cycles /= count;
+        result.instructions /= count;
+        result.l1d_misses /= count;
+        result.llc_misses /= count;
+        result.branch_misses /= count;
+        result.context_switches /= count;
+    }
+    return result;
+}
+
+void PerfProbe::Record(const PerfCounterValues& values) noexcept
+{
+    _values[0].fetch_add(values.cycles, std::memory_order_relaxed);
+    _values[1].fetch_add(values.instructions, std::memory_order_relaxed);
+    _values[2].fetch_add(values.l1d_misses, std::memory_order_relaxed);
+    _values[3].fetch_add(values.llc_misses, std::memory_order_relaxed);
+    _values[4].fetch_add(values.branch_misses, std::memory_order_relaxed);
+    _values[5].fetch_add(values.context_switches, std::memory_order_relaxed);
+    _samples.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerfProbe::Reset() noexcept
+{
+    _calls.store(0, std::memory_order_relaxed);
+    _samples.store(0, std::memory_order_relaxed);
+    for (auto& value : _values)
+        value.store(0, std::memory_order_relaxed);
+}
+
+} // namespace CppCommon
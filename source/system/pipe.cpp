@@ -11,9 +11,15 @@
 #include "errors/fatal.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
@@ -26,14 +32,23 @@ namespace CppCommon {
 class Pipe::Impl
 {
 public:
-    Impl()
+    Impl(size_t capacity) : _eof(false), _blocking(true)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = pipe(_pipe);
         if (result != 0)
             throwex SystemException("Failed to create a new pipe!");
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        if ((capacity > 0) && (fcntl(_pipe[1], F_SETPIPE_SZ, (int)capacity) < 0))
+        {
+            SystemException ex("Failed to set the capacity of a new pipe!");
+            close(_pipe[0]);
+            close(_pipe[1]);
+            throwex ex;
+        }
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
-        if (!CreatePipe(&_pipe[0], &_pipe[1], nullptr, 0))
+        if (!CreatePipe(&_pipe[0], &_pipe[1], nullptr, (DWORD)capacity))
             throwex SystemException("Failed to create a new pipe!");
 #endif
     }
@@ -84,8 +99,83 @@ public:
 #endif
     }
 
-    size_t Read(void* buffer, size_t size)
+    bool IsPipeEOF() const noexcept
+    {
+        return _eof;
+    }
+
+    size_t capacity() const
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Cannot get the capacity of the closed pipe!");
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int result = fcntl(IsPipeWriteOpened() ? _pipe[1] : _pipe[0], F_GETPIPE_SZ);
+        if (result < 0)
+            throwex SystemException("Cannot get the capacity of the pipe!");
+        return (size_t)result;
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD output = 0;
+        DWORD input = 0;
+        if (!GetNamedPipeInfo(IsPipeWriteOpened() ? _pipe[1] : _pipe[0], nullptr, &output, &input, nullptr))
+            throwex SystemException("Cannot get the capacity of the pipe!");
+        return (size_t)std::max(output, input);
+#else
+        return 0;
+#endif
+    }
+
+    size_t SetCapacity(size_t capacity)
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Cannot set the capacity of the closed pipe!");
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        int result = fcntl(IsPipeWriteOpened() ? _pipe[1] : _pipe[0], F_SETPIPE_SZ, (int)capacity);
+        if (result < 0)
+            throwex SystemException("Cannot set the capacity of the pipe!");
+        return (size_t)result;
+#else
+        throwex SystemException("Pipe capacity change is not supported!");
+#endif
+    }
+
+    bool IsBlocking() const noexcept
+    {
+        return _blocking;
+    }
+
+    void SetBlocking(bool blocking)
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Cannot change the blocking mode of the closed pipe!");
+        for (int i = 0; i < 2; ++i)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            if (_pipe[i] < 0)
+                continue;
+            int flags = fcntl(_pipe[i], F_GETFL, 0);
+            if (flags < 0)
+                throwex SystemException("Cannot get the pipe endpoint flags!");
+            flags = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+            if (fcntl(_pipe[i], F_SETFL, flags) < 0)
+                throwex SystemException("Cannot change the blocking mode of the pipe!");
+#elif defined(_WIN32) || defined(_WIN64)
+            if (_pipe[i] == INVALID_HANDLE_VALUE)
+                continue;
+            DWORD mode = PIPE_READMODE_BYTE | (blocking ? PIPE_WAIT : PIPE_NOWAIT);
+            if (!SetNamedPipeHandleState(_pipe[i], &mode, nullptr, nullptr))
+                throwex SystemException("Cannot change the blocking mode of the pipe!");
+#endif
+        }
+        _blocking = blocking;
+    }
+
+    size_t Read(void* buffer, size_t size, std::error_code* ec = nullptr)
     {
+        if (ec != nullptr)
+            ec->clear();
         if ((buffer == nullptr) || (size == 0))
             return 0;
 
@@ -94,20 +184,31 @@ public:
             throwex SystemException("Cannot read from the closed pipe!");
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         ssize_t result = read(_pipe[0], buffer, size);
+        if ((result < 0) && !_blocking && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+            return 0;
         if (result < 0)
-            throwex SystemException("Cannot read from the pipe!");
+            return Fail(ec, "Cannot read from the pipe!");
+        if (result == 0)
+            _eof = true;
         return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD result = 0;
         if (!ReadFile(_pipe[0], buffer, (DWORD)size, &result, nullptr))
-            if (GetLastError() != ERROR_BROKEN_PIPE)
-                throwex SystemException("Cannot read from the pipe!");
+        {
+            DWORD error = GetLastError();
+            if (error == ERROR_BROKEN_PIPE)
+                _eof = true;
+            else if (_blocking || (error != ERROR_NO_DATA))
+                return Fail(ec, "Cannot read from the pipe!");
+        }
         return (size_t)result;
 #endif
     }
 
-    size_t Write(const void* buffer, size_t size)
+    size_t Write(const void* buffer, size_t size, std::error_code* ec = nullptr)
     {
+        if (ec != nullptr)
+            ec->clear();
         if ((buffer == nullptr) || (size == 0))
             return 0;
 
@@ -116,18 +217,150 @@ public:
             throwex SystemException("Cannot write into the closed pipe!");
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         ssize_t result = write(_pipe[1], buffer, size);
+        if ((result < 0) && !_blocking && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+            return 0;
         if (result < 0)
-            throwex SystemException("Cannot write into the pipe!");
+            return Fail(ec, "Cannot write into the pipe!");
         return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD result = 0;
         if (!WriteFile(_pipe[1], buffer, (DWORD)size, &result, nullptr))
             if (GetLastError() != ERROR_BROKEN_PIPE)
-                throwex SystemException("Cannot write into the pipe!");
+                return Fail(ec, "Cannot write into the pipe!");
         return (size_t)result;
 #endif
     }
 
+    size_t WriteFrom(BufferChain& chain)
+    {
+        if (chain.empty())
+            return 0;
+
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        std::vector<struct iovec> iovecs;
+        iovecs.reserve(std::min(chain.slices().size(), (size_t)IOV_MAX));
+        for (const auto& slice : chain.slices())
+        {
+            if (iovecs.size() == IOV_MAX)
+                break;
+            iovecs.push_back({ (void*)slice.data(), slice.size() });
+        }
+        ssize_t result = writev(_pipe[1], iovecs.data(), (int)iovecs.size());
+        if ((result < 0) && !_blocking && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+            return 0;
+        if (result < 0)
+            throwex SystemException("Cannot write into the pipe!");
+        return chain.Consume((size_t)result);
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t total = 0;
+        while (!chain.empty())
+        {
+            const BufferSlice& slice = chain.slices().front();
+            size_t size = slice.size();
+            size_t result = Write(slice.data(), size);
+            total += chain.Consume(result);
+            if (result < size)
+                break;
+        }
+        return total;
+#endif
+    }
+
+    size_t Tee(Impl& pipe, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot read from the closed pipe!");
+        assert(pipe.IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!pipe.IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        for (;;)
+        {
+            ssize_t result = tee(_pipe[0], pipe._pipe[1], size, Flags(pipe));
+            if ((result < 0) && (errno == EINTR))
+                continue;
+            if ((result < 0) && (errno == EAGAIN))
+                return 0;
+            if (result < 0)
+                throwex SystemException("Cannot duplicate the pipe!");
+            if (result == 0)
+                _eof = true;
+            return (size_t)result;
+        }
+#else
+        throwex SystemException("Pipe duplication is not supported!");
+#endif
+    }
+
+    size_t Splice(Impl& pipe, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot read from the closed pipe!");
+        assert(pipe.IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!pipe.IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        for (;;)
+        {
+            ssize_t result = splice(_pipe[0], nullptr, pipe._pipe[1], nullptr, size, SPLICE_F_MOVE | Flags(pipe));
+            if ((result < 0) && (errno == EINTR))
+                continue;
+            if ((result < 0) && (errno == EAGAIN))
+                return 0;
+            if (result < 0)
+                throwex SystemException("Cannot splice the pipe!");
+            if (result == 0)
+                _eof = true;
+            return (size_t)result;
+        }
+#else
+        // Copy bytes through the intermediate buffer
+        uint8_t buffer[8192];
+        size_t result = Read(buffer, std::min(size, sizeof(buffer)));
+        size_t written = 0;
+        while (written < result)
+            written += pipe.Write(buffer + written, result - written);
+        return result;
+#endif
+    }
+
+    size_t SpliceFrom(const void* buffer, size_t size)
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        struct iovec iov = { (void*)buffer, size };
+        for (;;)
+        {
+            ssize_t result = vmsplice(_pipe[1], &iov, 1, _blocking ? 0 : SPLICE_F_NONBLOCK);
+            if ((result < 0) && (errno == EINTR))
+                continue;
+            if ((result < 0) && (errno == EAGAIN))
+                return 0;
+            if (result < 0)
+                throwex SystemException("Cannot map the buffer into the pipe!");
+            return (size_t)result;
+        }
+#else
+        return Write(buffer, size);
+#endif
+    }
+
     void CloseRead()
     {
         assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
@@ -175,12 +408,31 @@ private:
     int _pipe[2];
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _pipe[2];
+#endif
+    bool _eof;
+    bool _blocking;
+
+    // Report the last system error into the given error code or raise the system exception
+    static size_t Fail(std::error_code* ec, const char* message)
+    {
+        if (ec == nullptr)
+            throwex SystemException(message);
+        *ec = SystemError::GetLastCode();
+        return 0;
+    }
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    unsigned int Flags(const Impl& pipe) const noexcept
+    {
+        // Splice operations do not wait if any of pipes is non-blocking
+        return (_blocking && pipe._blocking) ? 0 : SPLICE_F_NONBLOCK;
+    }
 #endif
 };
 
 //! @endcond
 
-Pipe::Pipe()
+Pipe::Pipe(size_t capacity)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -188,7 +440,7 @@ Pipe::Pipe()
     static_assert(((StorageAlign % alignof(Impl)) == 0), "Pipe::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl();
+    new(&_storage)Impl(capacity);
 }
 
 Pipe::~Pipe()
@@ -203,9 +455,23 @@ void* Pipe::writer() const noexcept { return impl().writer(); }
 bool Pipe::IsPipeOpened() const noexcept { return impl().IsPipeOpened(); }
 bool Pipe::IsPipeReadOpened() const noexcept { return impl().IsPipeReadOpened(); }
 bool Pipe::IsPipeWriteOpened() const noexcept { return impl().IsPipeWriteOpened(); }
+bool Pipe::IsPipeEOF() const noexcept { return impl().IsPipeEOF(); }
+
+size_t Pipe::capacity() const { return impl().capacity(); }
+size_t Pipe::SetCapacity(size_t capacity) { return impl().SetCapacity(capacity); }
+
+bool Pipe::IsBlocking() const noexcept { return impl().IsBlocking(); }
+void Pipe::SetBlocking(bool blocking) { return impl().SetBlocking(blocking); }
 
 size_t Pipe::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
+size_t Pipe::Read(void* buffer, size_t size, std::error_code& ec) { return impl().Read(buffer, size, &ec); }
 size_t Pipe::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t Pipe::Write(const void* buffer, size_t size, std::error_code& ec) { return impl().Write(buffer, size, &ec); }
+size_t Pipe::WriteFrom(BufferChain& chain) { return impl().WriteFrom(chain); }
+
+size_t Pipe::Tee(Pipe& pipe, size_t size) { return impl().Tee(pipe.impl(), size); }
+size_t Pipe::Splice(Pipe& pipe, size_t size) { return impl().Splice(pipe.impl(), size); }
+size_t Pipe::SpliceFrom(const void* buffer, size_t size) { return impl().SpliceFrom(buffer, size); }
 
 void Pipe::CloseRead() { return impl().CloseRead(); }
 void Pipe::CloseWrite() { return impl().CloseWrite(); }
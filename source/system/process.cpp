@@ -15,16 +15,37 @@
 #include "utility/resource.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
 #include <sys/wait.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
 #include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#include <mach/mach.h>
+#define CPPCOMMON_PROCESS_SPAWN
+#elif defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 34)
+#define CPPCOMMON_PROCESS_SPAWN
+#endif
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
+#include <psapi.h>
 #include <tlhelp32.h>
 #undef max
 #undef min
+#include <exception>
+#include <thread>
 #endif
 
 namespace CppCommon {
@@ -228,6 +249,86 @@ public:
 #endif
     }
 
+    static ProcessUsage CurrentUsage()
+    {
+        ProcessUsage usage;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct rusage ru;
+        if (getrusage(RUSAGE_SELF, &ru) != 0)
+            throwex SystemException("Failed to get the current process resource usage!");
+        usage.user = Timespan::seconds(ru.ru_utime.tv_sec) + Timespan::microseconds(ru.ru_utime.tv_usec);
+        usage.system = Timespan::seconds(ru.ru_stime.tv_sec) + Timespan::microseconds(ru.ru_stime.tv_usec);
+        usage.minor_faults = (uint64_t)ru.ru_minflt;
+        usage.major_faults = (uint64_t)ru.ru_majflt;
+        usage.voluntary_switches = (uint64_t)ru.ru_nvcsw;
+        usage.involuntary_switches = (uint64_t)ru.ru_nivcsw;
+#if defined(__APPLE__)
+        // Apple reports the peak resident set size in bytes
+        usage.peak_rss = (uint64_t)ru.ru_maxrss;
+
+        mach_task_basic_info_data_t info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+            usage.rss = (uint64_t)info.resident_size;
+#else
+        // Linux reports the peak resident set size in kilobytes
+        usage.peak_rss = (uint64_t)ru.ru_maxrss * 1024;
+
+        // Resident pages are the second field of /proc/self/statm
+        FILE* statm = fopen("/proc/self/statm", "r");
+        if (statm != nullptr)
+        {
+            unsigned long long size, resident;
+            if (fscanf(statm, "%llu %llu", &size, &resident) == 2)
+                usage.rss = (uint64_t)resident * (uint64_t)sysconf(_SC_PAGESIZE);
+            fclose(statm);
+        }
+
+        // I/O counters might be not readable in restricted containers
+        FILE* io = fopen("/proc/self/io", "r");
+        if (io != nullptr)
+        {
+            char name[64];
+            unsigned long long value;
+            while (fscanf(io, "%63s %llu", name, &value) == 2)
+            {
+                if (strcmp(name, "rchar:") == 0)
+                    usage.read_bytes = (uint64_t)value;
+                else if (strcmp(name, "wchar:") == 0)
+                    usage.write_bytes = (uint64_t)value;
+            }
+            fclose(io);
+        }
+#endif
+        // Peak resident set size is updated by the kernel lazily
+        usage.peak_rss = std::max(usage.peak_rss, usage.rss);
+#elif defined(_WIN32) || defined(_WIN64)
+        HANDLE hProcess = GetCurrentProcess();
+
+        FILETIME creation, exit, kernel, user;
+        if (!GetProcessTimes(hProcess, &creation, &exit, &kernel, &user))
+            throwex SystemException("Failed to get the current process resource usage!");
+        usage.user = Timespan::nanoseconds((int64_t)((((uint64_t)user.dwHighDateTime) << 32) | user.dwLowDateTime) * 100);
+        usage.system = Timespan::nanoseconds((int64_t)((((uint64_t)kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime) * 100);
+
+        PROCESS_MEMORY_COUNTERS pmc;
+        if (GetProcessMemoryInfo(hProcess, &pmc, sizeof(pmc)))
+        {
+            usage.rss = (uint64_t)pmc.WorkingSetSize;
+            usage.peak_rss = (uint64_t)pmc.PeakWorkingSetSize;
+            usage.minor_faults = (uint64_t)pmc.PageFaultCount;
+        }
+
+        IO_COUNTERS ioc;
+        if (GetProcessIoCounters(hProcess, &ioc))
+        {
+            usage.read_bytes = (uint64_t)ioc.ReadTransferCount;
+            usage.write_bytes = (uint64_t)ioc.WriteTransferCount;
+        }
+#endif
+        return usage;
+    }
+
     static void Exit(int result)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -256,6 +357,14 @@ public:
         // Prepare environment variables
         std::vector<char> environment = PrepareEnvars(envars);
 
+#if defined(CPPCOMMON_PROCESS_SPAWN)
+#if defined(__APPLE__)
+        // posix_spawn_file_actions_addchdir_np() is not available on all supported macOS versions
+        if (directory == nullptr)
+#endif
+            return Spawn(command, argv, environment, directory, input, output, error);
+#endif
+
         // Fork the current process
         pid_t pid = fork();
         if (pid < 0)
@@ -432,6 +541,281 @@ public:
 #endif
     }
 
+    static int Run(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, const std::string* input, std::string* output, std::string* error)
+    {
+        std::unique_ptr<Pipe> input_pipe((input != nullptr) ? new Pipe() : nullptr);
+        std::unique_ptr<Pipe> output_pipe((output != nullptr) ? new Pipe() : nullptr);
+        std::unique_ptr<Pipe> error_pipe((error != nullptr) ? new Pipe() : nullptr);
+
+        Process process = Execute(command, arguments, envars, directory, input_pipe.get(), output_pipe.get(), error_pipe.get());
+
+        try
+        {
+            Communicate(input_pipe.get(), input, output_pipe.get(), output, error_pipe.get(), error);
+        }
+        catch (...)
+        {
+            if (process.IsRunning())
+                process.Kill();
+            process.Wait();
+            throw;
+        }
+
+        return process.Wait();
+    }
+
+    static void Communicate(Pipe* input_pipe, const std::string* input, Pipe* output_pipe, std::string* output, Pipe* error_pipe, std::string* error)
+    {
+        const size_t chunk = 65536;
+
+        // Empty input is closed at once to signal the end of stream
+        if ((input_pipe != nullptr) && input->empty())
+            input_pipe->CloseWrite();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Block SIGPIPE signal in the current thread, because the process may exit without reading the whole input
+        sigset_t sigpipe;
+        sigset_t pending;
+        sigset_t previous;
+        sigemptyset(&sigpipe);
+        sigaddset(&sigpipe, SIGPIPE);
+        sigpending(&pending);
+        bool sigpipe_pending = (sigismember(&pending, SIGPIPE) == 1);
+        pthread_sigmask(SIG_BLOCK, &sigpipe, &previous);
+        auto restore = resource([&](void*)
+        {
+            // Discard SIGPIPE signal raised by the broken input pipe
+            if (!sigpipe_pending)
+            {
+                sigpending(&pending);
+                if (sigismember(&pending, SIGPIPE) == 1)
+                {
+                    int signal;
+                    sigwait(&sigpipe, &signal);
+                }
+            }
+            pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+        });
+
+        // Parent endpoints are switched into the non-blocking mode to be multiplexed
+        Pipe* pipes[3] = { input_pipe, output_pipe, error_pipe };
+        std::string* contents[3] = { nullptr, output, error };
+        for (auto pipe : pipes)
+            if ((pipe != nullptr) && pipe->IsPipeOpened())
+                pipe->SetBlocking(false);
+
+        size_t written = 0;
+        std::vector<char> buffer(chunk);
+        for (;;)
+        {
+            struct pollfd fds[3];
+            size_t indexes[3];
+            nfds_t count = 0;
+            if ((input_pipe != nullptr) && input_pipe->IsPipeWriteOpened())
+            {
+                fds[count] = { (int)(size_t)input_pipe->writer(), POLLOUT, 0 };
+                indexes[count++] = 0;
+            }
+            for (size_t i = 1; i < 3; ++i)
+            {
+                if ((pipes[i] != nullptr) && pipes[i]->IsPipeReadOpened())
+                {
+                    fds[count] = { (int)(size_t)pipes[i]->reader(), POLLIN, 0 };
+                    indexes[count++] = i;
+                }
+            }
+            if (count == 0)
+                break;
+
+            int result = poll(fds, count, -1);
+            if ((result < 0) && (errno == EINTR))
+                continue;
+            if (result < 0)
+                throwex SystemException("Failed to poll the process pipes!");
+
+            for (nfds_t i = 0; i < count; ++i)
+            {
+                if (fds[i].revents == 0)
+                    continue;
+
+                size_t index = indexes[i];
+                if (index == 0)
+                {
+                    // Write the next chunk of the input
+                    if ((fds[i].revents & POLLOUT) != 0)
+                    {
+                        ssize_t size = write(fds[i].fd, input->data() + written, std::min(chunk, input->size() - written));
+                        if (size > 0)
+                            written += (size_t)size;
+                        else if ((size < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR) && (errno != EPIPE))
+                            throwex SystemException("Failed to write the process input!");
+                        if ((size < 0) && (errno == EPIPE))
+                            written = input->size();
+                    }
+                    else
+                        written = input->size();
+                    if (written == input->size())
+                        input_pipe->CloseWrite();
+                }
+                else
+                {
+                    // Drain all available bytes of the output
+                    size_t size;
+                    while ((size = pipes[index]->Read(buffer.data(), buffer.size())) > 0)
+                        contents[index]->append(buffer.data(), size);
+                    if (pipes[index]->IsPipeEOF())
+                        pipes[index]->CloseRead();
+                }
+            }
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        // Each output pipe is drained in its own thread while the input is written in the current one
+        std::exception_ptr exceptions[2];
+        auto drain = [chunk](Pipe* pipe, std::string* content, std::exception_ptr& exception)
+        {
+            try
+            {
+                std::vector<char> buffer(chunk);
+                size_t size;
+                while ((size = pipe->Read(buffer.data(), buffer.size())) > 0)
+                    content->append(buffer.data(), size);
+                pipe->CloseRead();
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+        };
+
+        std::thread output_thread;
+        std::thread error_thread;
+        if (output_pipe != nullptr)
+            output_thread = std::thread(drain, output_pipe, output, std::ref(exceptions[0]));
+        if (error_pipe != nullptr)
+            error_thread = std::thread(drain, error_pipe, error, std::ref(exceptions[1]));
+
+        if ((input_pipe != nullptr) && input_pipe->IsPipeWriteOpened())
+        {
+            try
+            {
+                size_t written = 0;
+                while (written < input->size())
+                {
+                    size_t size = input_pipe->Write(input->data() + written, std::min(chunk, input->size() - written));
+                    if (size == 0)
+                        break;
+                    written += size;
+                }
+            }
+            catch (const SystemException&)
+            {
+                // The process may exit without reading the whole input
+            }
+            input_pipe->CloseWrite();
+        }
+
+        if (output_thread.joinable())
+            output_thread.join();
+        if (error_thread.joinable())
+            error_thread.join();
+
+        for (const auto& exception : exceptions)
+            if (exception)
+                std::rethrow_exception(exception);
+#endif
+    }
+
+#if defined(CPPCOMMON_PROCESS_SPAWN)
+    static Process Spawn(const std::string& command, std::vector<char*>& argv, std::vector<char>& environment, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
+    {
+        posix_spawn_file_actions_t actions;
+        int result = posix_spawn_file_actions_init(&actions);
+        if (result != 0)
+            throwex SystemException("Failed to initialize file actions of a new process!", result);
+
+        // Smart resource cleaner pattern
+        auto actions_cleaner = resource(&actions, [](posix_spawn_file_actions_t* pactions) { posix_spawn_file_actions_destroy(pactions); });
+
+        posix_spawnattr_t attributes;
+        result = posix_spawnattr_init(&attributes);
+        if (result != 0)
+            throwex SystemException("Failed to initialize attributes of a new process!", result);
+
+        // Smart resource cleaner pattern
+        auto attributes_cleaner = resource(&attributes, [](posix_spawnattr_t* pattributes) { posix_spawnattr_destroy(pattributes); });
+
+        // Prepare communication pipes
+        if ((result == 0) && (input != nullptr))
+            result = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)input->reader(), STDIN_FILENO);
+        if ((result == 0) && (output != nullptr))
+            result = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)output->writer(), STDOUT_FILENO);
+        if ((result == 0) && (error != nullptr))
+            result = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)error->writer(), STDERR_FILENO);
+
+#if defined(__APPLE__)
+        // Close all open file descriptors other than stdin, stdout, stderr
+        if (result == 0)
+            result = posix_spawnattr_setflags(&attributes, POSIX_SPAWN_CLOEXEC_DEFAULT);
+        if ((result == 0) && (input == nullptr))
+            result = posix_spawn_file_actions_addinherit_np(&actions, STDIN_FILENO);
+        if ((result == 0) && (output == nullptr))
+            result = posix_spawn_file_actions_addinherit_np(&actions, STDOUT_FILENO);
+        if ((result == 0) && (error == nullptr))
+            result = posix_spawn_file_actions_addinherit_np(&actions, STDERR_FILENO);
+        char** parent = *_NSGetEnviron();
+#else
+        // Close all open file descriptors other than stdin, stdout, stderr
+        if (result == 0)
+            result = posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+
+        // Change the current directory of the new process
+        if ((result == 0) && (directory != nullptr))
+            result = posix_spawn_file_actions_addchdir_np(&actions, directory->c_str());
+        char** parent = environ;
+#endif
+        if (result != 0)
+            throwex SystemException("Failed to prepare file actions of a new process!", result);
+
+        // Merge environment variables of the new process with the current ones
+        std::vector<char*> envp;
+        if (!environment.empty())
+        {
+            for (char* envar = environment.data(); *envar != '\0'; envar += strlen(envar) + 1)
+                envp.push_back(envar);
+            size_t overrides = envp.size();
+            for (char** envar = parent; (envar != nullptr) && (*envar != nullptr); ++envar)
+            {
+                const char* separator = strchr(*envar, '=');
+                size_t length = (separator != nullptr) ? (size_t)(separator - *envar + 1) : strlen(*envar);
+                bool overridden = false;
+                for (size_t i = 0; !overridden && (i < overrides); ++i)
+                    overridden = (strncmp(envp[i], *envar, length) == 0);
+                if (!overridden)
+                    envp.push_back(*envar);
+            }
+            envp.push_back(nullptr);
+        }
+
+        // Spawn a new process image
+        pid_t pid;
+        result = posix_spawnp(&pid, argv[0], &actions, &attributes, argv.data(), envp.empty() ? parent : envp.data());
+        if (result != 0)
+            throwex SystemException(format("Failed to execute a new process with command '{}'!", command), result);
+
+        // Close pipes endpoints
+        if (input != nullptr)
+            input->CloseRead();
+        if (output != nullptr)
+            output->CloseWrite();
+        if (error != nullptr)
+            error->CloseWrite();
+
+        // Return result process
+        Process process;
+        process.impl()._pid = pid;
+        return process;
+    }
+#endif
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     static std::vector<char> PrepareEnvars(const std::map<std::string, std::string>* envars)
 #elif defined(_WIN32) || defined(_WIN64)
@@ -544,6 +928,8 @@ int Process::WaitFor(const Timespan& timespan) { return impl().WaitFor(timespan)
 uint64_t Process::CurrentProcessId() noexcept { return Impl::CurrentProcessId(); }
 uint64_t Process::ParentProcessId() noexcept { return Impl::ParentProcessId(); }
 
+ProcessUsage Process::CurrentUsage() { return Impl::CurrentUsage(); }
+
 void Process::Exit(int result) { return Impl::Exit(result); }
 
 Process Process::Execute(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
@@ -551,6 +937,11 @@ Process Process::Execute(const std::string& command, const std::vector<std::stri
     return Impl::Execute(command, arguments, envars, directory, input, output, error);
 }
 
+int Process::Run(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, const std::string* input, std::string* output, std::string* error)
+{
+    return Impl::Run(command, arguments, envars, directory, input, output, error);
+}
+
 void Process::swap(Process& process) noexcept
 {
     using std::swap;
@@ -0,0 +1,432 @@
+/*!
+    \file process_pool.cpp
+    \brief Process pool implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/process_pool.h"
+
+#include "errors/fatal.h"
+#include "string/format.h"
+#include "system/cpu.h"
+#include "utility/endian.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace {
+
+// Write the whole frame into the pipe
+bool WriteFrame(Pipe& pipe, std::string_view payload)
+{
+    std::string frame(4 + payload.size(), '\0');
+    Endian::StoreLittleEndian((uint8_t*)frame.data(), (uint32_t)payload.size());
+    std::memcpy(frame.data() + 4, payload.data(), payload.size());
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Block SIGPIPE signal in the current thread, because the worker may crash without reading the job
+    sigset_t sigpipe;
+    sigset_t pending;
+    sigset_t previous;
+    sigemptyset(&sigpipe);
+    sigaddset(&sigpipe, SIGPIPE);
+    sigpending(&pending);
+    bool sigpipe_pending = (sigismember(&pending, SIGPIPE) == 1);
+    pthread_sigmask(SIG_BLOCK, &sigpipe, &previous);
+#endif
+
+    bool result = true;
+    size_t written = 0;
+    while (written < frame.size())
+    {
+        std::error_code ec;
+        size_t size = pipe.Write(frame.data() + written, frame.size() - written, ec);
+        if (ec && (ec == std::errc::interrupted))
+            continue;
+        if (ec || (size == 0))
+        {
+            result = false;
+            break;
+        }
+        written += size;
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Discard SIGPIPE signal raised by the broken job pipe
+    if (!sigpipe_pending)
+    {
+        sigpending(&pending);
+        if (sigismember(&pending, SIGPIPE) == 1)
+        {
+            int signal;
+            sigwait(&sigpipe, &signal);
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+#endif
+
+    return result;
+}
+
+// Read exactly the given count of bytes from the pipe
+bool ReadExact(Pipe& pipe, void* buffer, size_t size)
+{
+    size_t read = 0;
+    while (read < size)
+    {
+        std::error_code ec;
+        size_t result = pipe.Read((uint8_t*)buffer + read, size - read, ec);
+        if (ec && (ec == std::errc::interrupted))
+            continue;
+        if (ec || (result == 0))
+            return false;
+        read += result;
+    }
+    return true;
+}
+
+// Read the whole frame from the pipe
+bool ReadFrame(Pipe& pipe, std::string& payload)
+{
+    uint8_t header[4];
+    if (!ReadExact(pipe, header, sizeof(header)))
+        return false;
+
+    payload.resize(Endian::LoadLittleEndian<uint32_t>(header));
+    return ReadExact(pipe, payload.data(), payload.size());
+}
+
+} // namespace
+
+class ProcessPool::Impl
+{
+public:
+    Impl(const std::string& command, const std::vector<std::string>* arguments, size_t workers, const std::map<std::string, std::string>* envars, const std::string* directory)
+        : _command(command),
+          _directory((directory != nullptr) ? *directory : std::string()),
+          _has_arguments(arguments != nullptr),
+          _has_envars(envars != nullptr),
+          _has_directory(directory != nullptr),
+          _stopped(false),
+          _restarts(0),
+          _next(0)
+    {
+        if (arguments != nullptr)
+            _arguments = *arguments;
+        if (envars != nullptr)
+            _envars = *envars;
+        if (workers == 0)
+            workers = (size_t)std::max(1, CPU::Affinity());
+
+        try
+        {
+            _workers.reserve(workers);
+            for (size_t i = 0; i < workers; ++i)
+            {
+                auto worker = std::make_unique<Worker>();
+                Spawn(*worker);
+                _workers.emplace_back(std::move(worker));
+            }
+            for (auto& worker : _workers)
+                worker->reader = std::thread([this, current = worker.get()]() { Serve(*current); });
+        }
+        catch (...)
+        {
+            Stop();
+            throw;
+        }
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            Stop();
+        }
+        catch (...)
+        {
+            fatality(SystemException("Failed to stop the process pool!"));
+        }
+    }
+
+    size_t workers() const noexcept { return _workers.size(); }
+
+    size_t pending() const noexcept
+    {
+        size_t result = 0;
+        for (const auto& worker : _workers)
+            result += worker->depth.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    uint64_t restarts() const noexcept { return _restarts.load(std::memory_order_relaxed); }
+
+    uint64_t pid(size_t index) const
+    {
+        assert((index < _workers.size()) && "Worker index is out of bounds!");
+        if (index >= _workers.size())
+            throwex SystemException(format("Worker index {} is out of bounds!", index));
+
+        Worker& worker = *_workers[index];
+        std::scoped_lock locker(worker.jobs_lock);
+        return worker.process->pid();
+    }
+
+    std::future<std::string> Submit(std::string_view job)
+    {
+        if (job.size() > std::numeric_limits<uint32_t>::max())
+            throwex SystemException("Process pool job is too large!");
+
+        // Find the worker with the least queue depth starting from the next one in round-robin order
+        size_t count = _workers.size();
+        size_t start = _next.fetch_add(1, std::memory_order_relaxed);
+        Worker* worker = nullptr;
+        size_t depth = std::numeric_limits<size_t>::max();
+        for (size_t i = 0; (i < count) && (depth > 0); ++i)
+        {
+            Worker* current = _workers[(start + i) % count].get();
+            size_t current_depth = current->depth.load(std::memory_order_relaxed);
+            if (current_depth < depth)
+            {
+                worker = current;
+                depth = current_depth;
+            }
+        }
+
+        std::scoped_lock write_locker(worker->write_lock);
+        if (_stopped.load(std::memory_order_acquire))
+            throwex SystemException("Cannot submit a job into the stopped process pool!");
+
+        std::future<std::string> result;
+        {
+            std::scoped_lock jobs_locker(worker->jobs_lock);
+            worker->jobs.emplace_back();
+            worker->depth.fetch_add(1, std::memory_order_relaxed);
+            result = worker->jobs.back().get_future();
+        }
+
+        // Failed job is kept queued and fails together with other jobs of the crashed worker
+        WriteFrame(*worker->input, job);
+
+        return result;
+    }
+
+    void Stop()
+    {
+        if (_stopped.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        // Close standard input of all workers to signal the end of jobs
+        for (auto& worker : _workers)
+        {
+            std::scoped_lock locker(worker->write_lock);
+            if (worker->input && worker->input->IsPipeWriteOpened())
+                worker->input->CloseWrite();
+        }
+
+        for (auto& worker : _workers)
+        {
+            if (worker->reader.joinable())
+                worker->reader.join();
+            else if (worker->process)
+                Reap(*worker, false);
+        }
+    }
+
+private:
+    struct Worker
+    {
+        std::mutex write_lock;
+        std::mutex jobs_lock;
+        std::unique_ptr<Pipe> input;
+        std::unique_ptr<Pipe> output;
+        std::unique_ptr<Process> process;
+        std::deque<std::promise<std::string>> jobs;
+        std::atomic<size_t> depth{0};
+        std::thread reader;
+    };
+
+    std::string _command;
+    std::vector<std::string> _arguments;
+    std::map<std::string, std::string> _envars;
+    std::string _directory;
+    bool _has_arguments;
+    bool _has_envars;
+    bool _has_directory;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<bool> _stopped;
+    std::atomic<uint64_t> _restarts;
+    std::atomic<size_t> _next;
+
+    void Spawn(Worker& worker)
+    {
+        auto input = std::make_unique<Pipe>();
+        auto output = std::make_unique<Pipe>();
+        auto process = std::make_unique<Process>(Process::Execute(_command, _has_arguments ? &_arguments : nullptr, _has_envars ? &_envars : nullptr, _has_directory ? &_directory : nullptr, input.get(), output.get(), nullptr));
+        worker.input = std::move(input);
+        worker.output = std::move(output);
+        worker.process = std::move(process);
+    }
+
+    void Reap(Worker& worker, bool kill)
+    {
+        try
+        {
+            if (kill && worker.process->IsRunning())
+                worker.process->Kill();
+            worker.process->Wait();
+        }
+        catch (const SystemException&)
+        {
+            // Worker process might be killed by signal
+        }
+    }
+
+    void Serve(Worker& worker)
+    {
+        std::string result;
+        for (;;)
+        {
+            if (ReadFrame(*worker.output, result))
+            {
+                std::promise<std::string> job;
+                {
+                    std::scoped_lock locker(worker.jobs_lock);
+                    if (!worker.jobs.empty())
+                    {
+                        job = std::move(worker.jobs.front());
+                        worker.jobs.pop_front();
+                        worker.depth.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                }
+                job.set_value(std::move(result));
+                continue;
+            }
+
+            // Worker closed its standard output, so it is either crashed or stopped
+            bool stopped = _stopped.load(std::memory_order_acquire);
+            uint64_t pid = worker.process->pid();
+            Reap(worker, !stopped);
+
+            std::deque<std::promise<std::string>> failed;
+            {
+                std::scoped_lock write_locker(worker.write_lock);
+                std::scoped_lock jobs_locker(worker.jobs_lock);
+                failed.swap(worker.jobs);
+                worker.depth.store(0, std::memory_order_relaxed);
+
+                // Restart the crashed worker
+                stopped = _stopped.load(std::memory_order_acquire);
+                if (!stopped)
+                {
+                    try
+                    {
+                        Spawn(worker);
+                        _restarts.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    catch (const SystemException&)
+                    {
+                        stopped = true;
+                    }
+                }
+            }
+
+            // Fail pending jobs of the crashed worker
+            for (auto& job : failed)
+            {
+                try
+                {
+                    throwex SystemException(format("Worker process with Id {} exited before the job was completed!", pid));
+                }
+                catch (...)
+                {
+                    job.set_exception(std::current_exception());
+                }
+            }
+
+            if (stopped)
+                return;
+        }
+    }
+};
+
+//! @endcond
+
+ProcessPool::ProcessPool(const std::string& command, const std::vector<std::string>* arguments, size_t workers, const std::map<std::string, std::string>* envars, const std::string* directory)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "ProcessPool::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "ProcessPool::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(command, arguments, workers, envars, directory);
+}
+
+ProcessPool::~ProcessPool()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+size_t ProcessPool::workers() const noexcept { return impl().workers(); }
+size_t ProcessPool::pending() const noexcept { return impl().pending(); }
+uint64_t ProcessPool::restarts() const noexcept { return impl().restarts(); }
+
+uint64_t ProcessPool::pid(size_t index) const { return impl().pid(index); }
+
+std::future<std::string> ProcessPool::Submit(std::string_view job) { return impl().Submit(job); }
+
+void ProcessPool::Stop() { impl().Stop(); }
+
+void ProcessPool::Serve(const std::function<std::string(std::string_view)>& handler)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    // Switch standard streams into the binary mode
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+    std::string job;
+    uint8_t header[4];
+    while (std::fread(header, 1, sizeof(header), stdin) == sizeof(header))
+    {
+        job.resize(Endian::LoadLittleEndian<uint32_t>(header));
+        if (std::fread(job.data(), 1, job.size(), stdin) != job.size())
+            break;
+
+        std::string result = handler(job);
+
+        Endian::StoreLittleEndian(header, (uint32_t)result.size());
+        if ((std::fwrite(header, 1, sizeof(header), stdout) != sizeof(header)) ||
+            (std::fwrite(result.data(), 1, result.size(), stdout) != result.size()) ||
+            (std::fflush(stdout) != 0))
+            break;
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,571 @@
+/*!
+    \file reactor.cpp
+    \brief Reactor implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/reactor.h"
+
+#include "errors/fatal.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <errno.h>
+#include <unistd.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || defined(__DragonFly__)
+#include <sys/types.h>
+#include <sys/event.h>
+#include <sys/time.h>
+#include <errno.h>
+#include <unistd.h>
+#define CPPCOMMON_REACTOR_KQUEUE
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#define CPPCOMMON_REACTOR_POLL
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class Reactor::Impl
+{
+public:
+    Impl() : _generation(0), _notified(false), _stopped(false)
+    {
+#if defined(__linux__)
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll < 0)
+            throwex SystemException("Failed to create the epoll instance of the reactor!");
+        _event = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (_event < 0)
+        {
+            close(_epoll);
+            throwex SystemException("Failed to create the wakeup eventfd of the reactor!");
+        }
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = 0;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _event, &event) != 0)
+        {
+            close(_event);
+            close(_epoll);
+            throwex SystemException("Failed to register the wakeup eventfd of the reactor!");
+        }
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+        _kqueue = kqueue();
+        if (_kqueue < 0)
+            throwex SystemException("Failed to create the kqueue instance of the reactor!");
+        struct kevent event;
+        EV_SET(&event, 0, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, nullptr);
+        if (kevent(_kqueue, &event, 1, nullptr, 0, nullptr) != 0)
+        {
+            close(_kqueue);
+            throwex SystemException("Failed to register the wakeup event of the reactor!");
+        }
+#elif defined(CPPCOMMON_REACTOR_POLL)
+        if (pipe(_wakeup) != 0)
+            throwex SystemException("Failed to create the wakeup pipe of the reactor!");
+        for (int fd : _wakeup)
+        {
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        _iocp = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (_iocp == nullptr)
+            throwex SystemException("Failed to create the I/O completion port of the reactor!");
+#endif
+    }
+
+    ~Impl()
+    {
+        // Remove all registered handles
+        std::vector<std::shared_ptr<Registration>> registrations;
+        {
+            Locker<CriticalSection> locker(_cs);
+            for (auto& registration : _registrations)
+                registrations.emplace_back(std::move(registration.second));
+            _registrations.clear();
+            _handles.clear();
+        }
+        for (auto& registration : registrations)
+            Disarm(*registration);
+
+#if defined(__linux__)
+        if ((close(_event) != 0) || (close(_epoll) != 0))
+            fatality(SystemException("Failed to close the epoll instance of the reactor!"));
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+        if (close(_kqueue) != 0)
+            fatality(SystemException("Failed to close the kqueue instance of the reactor!"));
+#elif defined(CPPCOMMON_REACTOR_POLL)
+        if ((close(_wakeup[0]) != 0) || (close(_wakeup[1]) != 0))
+            fatality(SystemException("Failed to close the wakeup pipe of the reactor!"));
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!CloseHandle(_iocp))
+            fatality(SystemException("Failed to close the I/O completion port of the reactor!"));
+#endif
+    }
+
+    size_t handles() const
+    {
+        Locker<CriticalSection> locker(_cs);
+        return _registrations.size();
+    }
+
+    bool stopped() const noexcept { return _stopped.load(std::memory_order_acquire); }
+
+    void Add(void* handle, const Flags<ReactorEvents>& events, const Handler& handler, bool once)
+    {
+        auto registration = std::make_shared<Registration>();
+        registration->handle = handle;
+        registration->events = events;
+        registration->handler = handler;
+        registration->once = once;
+
+        Locker<CriticalSection> locker(_cs);
+        if (_handles.find(handle) != _handles.end())
+            throwex SystemException("The handle is already registered in the reactor!");
+
+        registration->id = ++_generation;
+        Arm(*registration, false);
+        _handles[handle] = registration->id;
+        _registrations[registration->id] = std::move(registration);
+    }
+
+    void Modify(void* handle, const Flags<ReactorEvents>& events)
+    {
+        Locker<CriticalSection> locker(_cs);
+        auto it = _handles.find(handle);
+        if (it == _handles.end())
+            throwex SystemException("The handle is not registered in the reactor!");
+
+        Registration& registration = *_registrations[it->second];
+        registration.events = events;
+        Arm(registration, true);
+    }
+
+    bool Remove(void* handle)
+    {
+        std::shared_ptr<Registration> registration;
+        {
+            Locker<CriticalSection> locker(_cs);
+            auto it = _handles.find(handle);
+            if (it == _handles.end())
+                return false;
+
+            auto registration_it = _registrations.find(it->second);
+            registration = std::move(registration_it->second);
+            _registrations.erase(registration_it);
+            _handles.erase(it);
+        }
+
+        Disarm(*registration);
+        return true;
+    }
+
+    void Post(Task&& task)
+    {
+        {
+            Locker<CriticalSection> locker(_cs);
+            _tasks.emplace_back(std::move(task));
+        }
+        Wakeup();
+    }
+
+    size_t Poll(int timeout)
+    {
+        // Do not wait if there are posted tasks
+        if (_notified.load(std::memory_order_acquire))
+            timeout = 0;
+
+        _ready.clear();
+        Wait(timeout);
+
+        size_t count = 0;
+
+        // Dispatch ready handles
+        for (const auto& ready : _ready)
+        {
+            std::shared_ptr<Registration> registration;
+            {
+                Locker<CriticalSection> locker(_cs);
+                auto it = _registrations.find(ready.first);
+                if (it == _registrations.end())
+                    continue;
+                registration = it->second;
+                if (registration->once)
+                {
+                    _registrations.erase(it);
+                    _handles.erase(registration->handle);
+                }
+            }
+
+            if (registration->once)
+                Disarm(*registration);
+
+            registration->handler(ready.second);
+            ++count;
+
+#if defined(_WIN32) || defined(_WIN64)
+            // Rearm the one-time wait of the persistent registration
+            if (!registration->once)
+            {
+                Locker<CriticalSection> locker(_cs);
+                if (_registrations.find(registration->id) != _registrations.end())
+                    Arm(*registration, true);
+            }
+#endif
+        }
+
+        // Execute posted tasks
+        _notified.store(false, std::memory_order_release);
+        {
+            Locker<CriticalSection> locker(_cs);
+            std::swap(_tasks, _batch);
+        }
+        for (auto& task : _batch)
+        {
+            task();
+            ++count;
+        }
+        _batch.clear();
+
+        return count;
+    }
+
+    void Run()
+    {
+        while (!stopped())
+            Poll(-1);
+    }
+
+    void Stop()
+    {
+        _stopped.store(true, std::memory_order_release);
+        Wakeup();
+    }
+
+private:
+    // Registered handle
+    struct Registration
+    {
+        void* handle;
+        uint64_t id;
+        Flags<ReactorEvents> events;
+        Handler handler;
+        bool once;
+#if defined(_WIN32) || defined(_WIN64)
+        Impl* reactor;
+        HANDLE wait;
+#endif
+    };
+
+    mutable CriticalSection _cs;
+    uint64_t _generation;
+    std::unordered_map<uint64_t, std::shared_ptr<Registration>> _registrations;
+    std::unordered_map<void*, uint64_t> _handles;
+    std::vector<Task> _tasks;
+    std::vector<Task> _batch;
+    std::vector<std::pair<uint64_t, Flags<ReactorEvents>>> _ready;
+    std::atomic<bool> _notified;
+    std::atomic<bool> _stopped;
+#if defined(__linux__)
+    int _epoll;
+    int _event;
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+    int _kqueue;
+#elif defined(CPPCOMMON_REACTOR_POLL)
+    int _wakeup[2];
+    std::vector<struct pollfd> _fds;
+    std::vector<uint64_t> _ids;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _iocp;
+#endif
+
+    // Wake up the reactor thread
+    void Wakeup()
+    {
+        if (_notified.exchange(true, std::memory_order_acq_rel))
+            return;
+
+#if defined(__linux__)
+        uint64_t value = 1;
+        [[maybe_unused]] ssize_t result = write(_event, &value, sizeof(value));
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+        struct kevent event;
+        EV_SET(&event, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+        kevent(_kqueue, &event, 1, nullptr, 0, nullptr);
+#elif defined(CPPCOMMON_REACTOR_POLL)
+        char value = 1;
+        [[maybe_unused]] ssize_t result = write(_wakeup[1], &value, sizeof(value));
+#elif defined(_WIN32) || defined(_WIN64)
+        PostQueuedCompletionStatus(_iocp, 0, 0, nullptr);
+#endif
+    }
+
+    // Start waiting for events of the registered handle
+    void Arm(Registration& registration, bool modify)
+    {
+#if defined(__linux__)
+        struct epoll_event event = {};
+        event.events = EPOLLET | EPOLLRDHUP | (registration.once ? (uint32_t)EPOLLONESHOT : 0u);
+        if (registration.events & ReactorEvents::READABLE)
+            event.events |= EPOLLIN;
+        if (registration.events & ReactorEvents::WRITABLE)
+            event.events |= EPOLLOUT;
+        event.data.u64 = registration.id;
+        if (epoll_ctl(_epoll, modify ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, (int)(size_t)registration.handle, &event) != 0)
+            throwex SystemException("Failed to register the handle in the reactor!");
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+        int fd = (int)(size_t)registration.handle;
+        if (modify)
+            Disarm(registration);
+        uint16_t flags = EV_ADD | EV_CLEAR | (registration.once ? EV_ONESHOT : 0);
+        struct kevent event;
+        if (registration.events & ReactorEvents::READABLE)
+        {
+            EV_SET(&event, fd, EVFILT_READ, flags, 0, 0, (void*)(uintptr_t)registration.id);
+            if (kevent(_kqueue, &event, 1, nullptr, 0, nullptr) != 0)
+                throwex SystemException("Failed to register the handle in the reactor!");
+        }
+        if (registration.events & ReactorEvents::WRITABLE)
+        {
+            EV_SET(&event, fd, EVFILT_WRITE, flags, 0, 0, (void*)(uintptr_t)registration.id);
+            if (kevent(_kqueue, &event, 1, nullptr, 0, nullptr) != 0)
+            {
+                Disarm(registration);
+                throwex SystemException("Failed to register the handle in the reactor!");
+            }
+        }
+#elif defined(CPPCOMMON_REACTOR_POLL)
+        // Poll descriptors are collected from registrations before each wait
+#elif defined(_WIN32) || defined(_WIN64)
+        if (modify)
+            Disarm(registration);
+        registration.reactor = this;
+        if (!RegisterWaitForSingleObject(&registration.wait, (HANDLE)registration.handle, Signaled, &registration, INFINITE, WT_EXECUTEONLYONCE))
+            throwex SystemException("Failed to register the handle in the reactor!");
+#endif
+    }
+
+    // Stop waiting for events of the registered handle
+    void Disarm(Registration& registration)
+    {
+#if defined(__linux__)
+        // Closed handle is already removed from the epoll instance
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, (int)(size_t)registration.handle, nullptr);
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+        // Filters which were not added or are already fired are missing
+        int fd = (int)(size_t)registration.handle;
+        struct kevent event;
+        EV_SET(&event, fd, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+        kevent(_kqueue, &event, 1, nullptr, 0, nullptr);
+        EV_SET(&event, fd, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+        kevent(_kqueue, &event, 1, nullptr, 0, nullptr);
+#elif defined(CPPCOMMON_REACTOR_POLL)
+        // Removed registration is not polled anymore
+#elif defined(_WIN32) || defined(_WIN64)
+        // Wait for the completion of the running wait callback
+        if (registration.wait != nullptr)
+        {
+            UnregisterWaitEx(registration.wait, INVALID_HANDLE_VALUE);
+            registration.wait = nullptr;
+        }
+#endif
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    // Signaled handle callback
+    static VOID CALLBACK Signaled(PVOID parameter, BOOLEAN timeout)
+    {
+        Registration* registration = (Registration*)parameter;
+        PostQueuedCompletionStatus(registration->reactor->_iocp, (DWORD)ReactorEvents::READABLE, (ULONG_PTR)registration->id, nullptr);
+    }
+#endif
+
+    // Wait for ready handles and collect them
+    void Wait(int timeout)
+    {
+#if defined(__linux__)
+        struct epoll_event events[256];
+        int count = epoll_wait(_epoll, events, 256, timeout);
+        if ((count < 0) && (errno != EINTR))
+            throwex SystemException("Failed to wait for the epoll events of the reactor!");
+
+        for (int i = 0; i < count; ++i)
+        {
+            // Drain the level-triggered wakeup eventfd
+            if (events[i].data.u64 == 0)
+            {
+                uint64_t value;
+                [[maybe_unused]] ssize_t result = read(_event, &value, sizeof(value));
+                continue;
+            }
+
+            Flags<ReactorEvents> ready;
+            if (events[i].events & EPOLLIN)
+                ready |= ReactorEvents::READABLE;
+            if (events[i].events & EPOLLOUT)
+                ready |= ReactorEvents::WRITABLE;
+            if (events[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))
+                ready |= ReactorEvents::HANGUP;
+            _ready.emplace_back((uint64_t)events[i].data.u64, ready);
+        }
+#elif defined(CPPCOMMON_REACTOR_KQUEUE)
+        struct timespec timespec = { timeout / 1000, (timeout % 1000) * 1000000 };
+        struct kevent events[256];
+        int count = kevent(_kqueue, nullptr, 0, events, 256, (timeout < 0) ? nullptr : &timespec);
+        if ((count < 0) && (errno != EINTR))
+            throwex SystemException("Failed to wait for the kqueue events of the reactor!");
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].filter == EVFILT_USER)
+                continue;
+
+            Flags<ReactorEvents> ready;
+            if (events[i].filter == EVFILT_READ)
+                ready |= ReactorEvents::READABLE;
+            if (events[i].filter == EVFILT_WRITE)
+                ready |= ReactorEvents::WRITABLE;
+            if (events[i].flags & (EV_EOF | EV_ERROR))
+                ready |= ReactorEvents::HANGUP;
+            _ready.emplace_back((uint64_t)(uintptr_t)events[i].udata, ready);
+        }
+#elif defined(CPPCOMMON_REACTOR_POLL)
+        _fds.clear();
+        _ids.clear();
+        _fds.push_back({ _wakeup[0], POLLIN, 0 });
+        _ids.push_back(0);
+        {
+            Locker<CriticalSection> locker(_cs);
+            for (const auto& registration : _registrations)
+            {
+                short events = 0;
+                if (registration.second->events & ReactorEvents::READABLE)
+                    events |= POLLIN;
+                if (registration.second->events & ReactorEvents::WRITABLE)
+                    events |= POLLOUT;
+                _fds.push_back({ (int)(size_t)registration.second->handle, events, 0 });
+                _ids.push_back(registration.first);
+            }
+        }
+
+        int count = poll(_fds.data(), (nfds_t)_fds.size(), timeout);
+        if ((count < 0) && (errno != EINTR))
+            throwex SystemException("Failed to poll handles of the reactor!");
+
+        for (size_t i = 0; (count > 0) && (i < _fds.size()); ++i)
+        {
+            if (_fds[i].revents == 0)
+                continue;
+
+            // Drain the wakeup pipe
+            if (_ids[i] == 0)
+            {
+                char buffer[256];
+                while (read(_wakeup[0], buffer, sizeof(buffer)) > 0) {}
+                continue;
+            }
+
+            Flags<ReactorEvents> ready;
+            if (_fds[i].revents & POLLIN)
+                ready |= ReactorEvents::READABLE;
+            if (_fds[i].revents & POLLOUT)
+                ready |= ReactorEvents::WRITABLE;
+            if (_fds[i].revents & (POLLERR | POLLHUP | POLLNVAL))
+                ready |= ReactorEvents::HANGUP;
+            _ready.emplace_back(_ids[i], ready);
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        OVERLAPPED_ENTRY entries[256];
+        ULONG count = 0;
+        if (!GetQueuedCompletionStatusEx(_iocp, entries, 256, &count, (timeout < 0) ? INFINITE : (DWORD)timeout, FALSE))
+        {
+            if (GetLastError() != WAIT_TIMEOUT)
+                throwex SystemException("Failed to wait for the I/O completion port of the reactor!");
+            count = 0;
+        }
+
+        for (ULONG i = 0; i < count; ++i)
+        {
+            if (entries[i].lpCompletionKey == 0)
+                continue;
+
+            _ready.emplace_back((uint64_t)entries[i].lpCompletionKey, Flags<ReactorEvents>((ReactorEvents)entries[i].dwNumberOfBytesTransferred));
+        }
+#endif
+    }
+};
+
+//! @endcond
+
+void ReactorAwaiter::await_suspend(std::coroutine_handle<> coroutine)
+{
+    CoroutineScheduler* scheduler = CoroutineScheduler::Current();
+    _reactor.AddOnce(_handle, _events, [this, scheduler, coroutine](Flags<ReactorEvents> events)
+    {
+        _result = events;
+        if (scheduler != nullptr)
+            scheduler->Post(coroutine);
+        else
+            coroutine.resume();
+    });
+}
+
+Reactor::Reactor()
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "Reactor::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "Reactor::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl();
+}
+
+Reactor::~Reactor()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+size_t Reactor::handles() const { return impl().handles(); }
+bool Reactor::stopped() const noexcept { return impl().stopped(); }
+
+void Reactor::Add(void* handle, const Flags<ReactorEvents>& events, const Handler& handler) { impl().Add(handle, events, handler, false); }
+void Reactor::AddOnce(void* handle, const Flags<ReactorEvents>& events, const Handler& handler) { impl().Add(handle, events, handler, true); }
+void Reactor::Modify(void* handle, const Flags<ReactorEvents>& events) { impl().Modify(handle, events); }
+bool Reactor::Remove(void* handle) { return impl().Remove(handle); }
+
+void Reactor::Post(Task task) { impl().Post(std::move(task)); }
+
+size_t Reactor::Poll(const Timespan& timeout)
+{
+    // Round the timeout up to milliseconds
+    int64_t milliseconds = (timeout.total() > 0) ? ((timeout.total() + 999999) / 1000000) : 0;
+    return impl().Poll((int)std::min(milliseconds, (int64_t)std::numeric_limits<int>::max()));
+}
+
+void Reactor::Run() { impl().Run(); }
+void Reactor::Stop() { impl().Stop(); }
+
+} // namespace CppCommon
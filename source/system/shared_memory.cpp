@@ -9,13 +9,16 @@
 #include "system/shared_memory.h"
 
 #include "errors/fatal.h"
+#include "memory/allocator_huge_page.h"
 #include "utility/validate_aligned_storage.h"
 
 #include <cassert>
+#include <cstdio>
 #include <cstring>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/mman.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
@@ -25,70 +28,192 @@
 namespace CppCommon {
 
 //! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__)
+// NUMA binding (implemented in allocator_huge_page.cpp)
+bool BindNumaNode(void* ptr, size_t size, int node);
+#elif defined(_WIN32) || defined(_WIN64)
+// Lock memory privilege (implemented in allocator_huge_page.cpp)
+bool EnableLockMemoryPrivilege();
+#endif
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+// Find the mount point of the hugetlbfs filesystem
+std::string HugeTLBMount()
+{
+    static std::string mount = []()
+    {
+        std::string result;
+        FILE* file = fopen("/proc/mounts", "r");
+        if (file != nullptr)
+        {
+            char line[1024];
+            while (fgets(line, sizeof(line), file) != nullptr)
+            {
+                char device[256], path[512], type[64];
+                if ((sscanf(line, "%255s %511s %63s", device, path, type) == 3) && (std::strcmp(type, "hugetlbfs") == 0))
+                {
+                    result = path;
+                    break;
+                }
+            }
+            fclose(file);
+        }
+        return result;
+    }();
+    return mount;
+}
+
+#endif
+
+size_t RoundUp(size_t size, size_t page)
+{
+    return ((size + page - 1) / page) * page;
+}
+
+// Touch each page of the mapped memory without changing its content
+void Prefault(void* ptr, size_t size)
+{
+#if defined(MADV_POPULATE_WRITE)
+    if (madvise(ptr, size, MADV_POPULATE_WRITE) == 0)
+        return;
+#endif
+    volatile uint8_t* data = (volatile uint8_t*)ptr;
+    for (size_t offset = 0; offset < size; offset += 4096)
+        data[offset] = data[offset];
+}
+
+} // namespace Internals
 
 class SharedMemory::Impl
 {
 public:
-    Impl(const std::string& name, size_t size)
+    Impl(const std::string& name, size_t size, const SharedMemoryOptions& options) : _huge(false), _locked(false)
     {
         assert(!name.empty() && "Shared memory buffer name must not be empty!");
         assert((size > 0) && "Shared memory buffer size must be greater than zero!");
 
         size_t total = SHARED_MEMORY_HEADER_SIZE + size;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        _name = "/" + name;
-        _owner = true;
+        // Pages must be bound to the NUMA node before the first touch
+        bool populate = options.prefault && (options.node < 0);
 
-        // Try to create a shared memory handler
-        _shared = shm_open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
-        if (_shared == -1)
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Try to create or open the shared memory file in the hugetlbfs mount
+        if (options.huge_pages)
+            _huge = OpenHugeTLB(name, total, populate);
+#endif
+
+        if (!_huge)
         {
-            // Try to open a shared memory handler
-            _shared = shm_open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR));
+            _name = "/" + name;
+            _owner = true;
+            _total = total;
+
+            // Try to create a shared memory handler
+            _shared = shm_open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
             if (_shared == -1)
-                throwex SystemException("Failed to create or open a shared memory handler!");
+            {
+                // Try to open a shared memory handler
+                _shared = shm_open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR));
+                if (_shared == -1)
+                    throwex SystemException("Failed to create or open a shared memory handler!");
+                else
+                    _owner = false;
+            }
             else
-                _owner = false;
-        }
-        else
-        {
-            // Truncate a shared memory handler
-            int result = ftruncate(_shared, total);
-            if (result != 0)
-                throwex SystemException("Failed to truncate a shared memory handler!");
-        }
+            {
+                // Truncate a shared memory handler
+                int result = ftruncate(_shared, total);
+                if (result != 0)
+                    throwex SystemException("Failed to truncate a shared memory handler!");
+            }
 
-        // Map a shared memory buffer
-        _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), MAP_SHARED, _shared, 0);
-        if (_ptr == MAP_FAILED)
-        {
-            close(_shared);
-            shm_unlink(_name.c_str());
-            throwex SystemException("Failed to map a shared memory buffer!");
+            // Map a shared memory buffer
+            _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), MAP_SHARED | MapFlags(populate), _shared, 0);
+            if (_ptr == MAP_FAILED)
+            {
+                close(_shared);
+                shm_unlink(_name.c_str());
+                throwex SystemException("Failed to map a shared memory buffer!");
+            }
+
+#if defined(MADV_HUGEPAGE)
+            // Fallback to transparent huge pages of the shared memory filesystem
+            if (options.huge_pages)
+                madvise(_ptr, total, MADV_HUGEPAGE);
+#endif
         }
+
+#if defined(unix) || defined(__unix) || defined(__unix__)
+        if (options.node >= 0)
+            Internals::BindNumaNode(_ptr, _total, options.node);
+#endif
+        if (options.prefault && !populate)
+            Internals::Prefault(_ptr, _total);
+        if (options.lock)
+            _locked = (mlock(_ptr, _total) == 0);
 #elif defined(_WIN32) || defined(_WIN64)
         _name = "Global\\" + name;
         _owner = false;
 
+        // Large pages section must be mapped with the size multiple of the large page size
+        size_t large = options.huge_pages ? GetLargePageMinimum() : 0;
+        if (large > 0)
+            total = Internals::RoundUp(total, large);
+
         // Try to open a shared memory handler
         _shared = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, _name.c_str());
         if (_shared == nullptr)
         {
+            // Try to create a shared memory handler with large pages
+            if ((large > 0) && Internals::EnableLockMemoryPrivilege())
+            {
+                _shared = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE | SEC_COMMIT | SEC_LARGE_PAGES, (DWORD)((uint64_t)total >> 32), (DWORD)total, _name.c_str());
+                _huge = (_shared != nullptr);
+            }
+
             // Try to create a shared memory handler
-            _shared = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)total, _name.c_str());
+            if (_shared == nullptr)
+                _shared = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)total >> 32), (DWORD)total, _name.c_str());
             if (_shared == nullptr)
                 throwex SystemException("Failed to create or open a shared memory handler!");
             else
                 _owner = true;
         }
+        else
+            _huge = (large > 0);
 
         // Map a shared memory buffer
-        _ptr = MapViewOfFile(_shared, FILE_MAP_ALL_ACCESS, 0, 0, total);
+        DWORD access = FILE_MAP_ALL_ACCESS;
+#if defined(FILE_MAP_LARGE_PAGES)
+        if (_huge)
+            access |= FILE_MAP_LARGE_PAGES;
+#endif
+        if (options.node >= 0)
+            _ptr = MapViewOfFileExNuma(_shared, access, 0, 0, total, nullptr, (DWORD)options.node);
+        else
+            _ptr = MapViewOfFile(_shared, access, 0, 0, total);
+        if ((_ptr == nullptr) && _huge && !_owner)
+        {
+            // Existing section was created with regular pages
+            _huge = false;
+            total = SHARED_MEMORY_HEADER_SIZE + size;
+            _ptr = MapViewOfFile(_shared, FILE_MAP_ALL_ACCESS, 0, 0, total);
+        }
         if (_ptr == nullptr)
         {
             CloseHandle(_shared);
             throwex SystemException("Failed to map a shared memory buffer!");
         }
+        _total = total;
+
+        if (options.prefault)
+            Internals::Prefault(_ptr, _total);
+        if (options.lock)
+            _locked = (VirtualLock(_ptr, _total) != FALSE);
 #endif
         static const char* SHARED_MEMORY_HEADER_PREFIX = "SHMM";
 
@@ -107,7 +232,7 @@ public:
             if (!is_valid_prefix || !is_valid_size)
             {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                munmap(_ptr, total);
+                munmap(_ptr, _total);
                 close(_shared);
 #elif defined(_WIN32) || defined(_WIN64)
                 UnmapViewOfFile(_ptr);
@@ -125,8 +250,7 @@ public:
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         // Unmap the shared memory buffer
-        size_t total = ((SharedMemoryHeader*)_ptr)->size + SHARED_MEMORY_HEADER_SIZE;
-        int result = munmap(_ptr, total);
+        int result = munmap(_ptr, _total);
         if (result != 0)
             fatality(SystemException("Failed to unmap a shared memory buffer!"));
 
@@ -138,7 +262,7 @@ public:
         // Unlink the shared memory handler (owner only)
         if (_owner)
         {
-            result = shm_unlink(_name.c_str());
+            result = _huge ? unlink(_name.c_str()) : shm_unlink(_name.c_str());
             if (result != 0)
                 fatality(SystemException("Failed to unlink a shared memory handler!"));
         }
@@ -154,8 +278,10 @@ public:
     }
 
     void* ptr() { return (uint8_t*)_ptr + SHARED_MEMORY_HEADER_SIZE; }
-    const void* ptr() const { return _ptr; }
+    const void* ptr() const { return (const uint8_t*)_ptr + SHARED_MEMORY_HEADER_SIZE; }
     bool owner() const { return _owner; }
+    bool huge_pages() const { return _huge; }
+    bool locked() const { return _locked; }
 
 private:
     // Shared memory header size
@@ -179,12 +305,67 @@ private:
     HANDLE _shared;
 #endif
     void* _ptr;
+    size_t _total;
     bool _owner;
+    bool _huge;
+    bool _locked;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static int MapFlags(bool populate)
+    {
+#if defined(MAP_POPULATE)
+        return populate ? MAP_POPULATE : 0;
+#else
+        return 0;
+#endif
+    }
+#endif
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    bool OpenHugeTLB(const std::string& name, size_t total, bool populate)
+    {
+        std::string mount = Internals::HugeTLBMount();
+        if (mount.empty())
+            return false;
+
+        // Files of the hugetlbfs must be truncated and mapped with the size multiple of the huge page size
+        _name = mount + "/" + name;
+        _owner = true;
+        _total = Internals::RoundUp(total, HugePageMemoryManager::HugePageSize());
+
+        _shared = open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
+        if ((_shared == -1) && (errno == EEXIST))
+        {
+            _shared = open(_name.c_str(), O_RDWR);
+            _owner = false;
+        }
+        if (_shared == -1)
+            return false;
+
+        if (_owner && (ftruncate(_shared, _total) != 0))
+        {
+            close(_shared);
+            unlink(_name.c_str());
+            return false;
+        }
+
+        // Mapping fails if there are not enough reserved huge pages
+        _ptr = mmap(nullptr, _total, (PROT_READ | PROT_WRITE), MAP_SHARED | MapFlags(populate), _shared, 0);
+        if (_ptr == MAP_FAILED)
+        {
+            close(_shared);
+            if (_owner)
+                unlink(_name.c_str());
+            return false;
+        }
+        return true;
+    }
+#endif
 };
 
 //! @endcond
 
-SharedMemory::SharedMemory(const std::string& name, size_t size) : _name(name), _size(size)
+SharedMemory::SharedMemory(const std::string& name, size_t size, const SharedMemoryOptions& options) : _name(name), _size(size), _options(options)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -192,7 +373,7 @@ SharedMemory::SharedMemory(const std::string& name, size_t size) : _name(name),
     static_assert(((StorageAlign % alignof(Impl)) == 0), "SharedMemory::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(name, size);
+    new(&_storage)Impl(name, size, options);
 }
 
 SharedMemory::~SharedMemory()
@@ -204,5 +385,7 @@ SharedMemory::~SharedMemory()
 void* SharedMemory::ptr() { return impl().ptr(); }
 const void* SharedMemory::ptr() const { return impl().ptr(); }
 bool SharedMemory::owner() const { return impl().owner(); }
+bool SharedMemory::huge_pages() const { return impl().huge_pages(); }
+bool SharedMemory::locked() const { return impl().locked(); }
 
 } // namespace CppCommon
@@ -12,13 +12,17 @@
 #define PACKAGE_VERSION "1.0.0.0"
 
 #include "system/stack_trace.h"
+#include "system/stack_trace_manager.h"
 
 #include "threads/critical_section.h"
 #include "utility/countof.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iomanip>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include <execinfo.h>
@@ -60,41 +64,117 @@ std::ostream& operator<<(std::ostream& os, const StackTrace::Frame& frame)
     return os;
 }
 
-StackTrace::StackTrace(int skip)
+//! @cond INTERNALS
+namespace Internals {
+
+// Shared symbols cache of the resolved frames
+class SymbolCache
 {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-    const int capacity = 1024;
-    void* frames[capacity];
+public:
+    static SymbolCache& GetInstance()
+    { static SymbolCache instance; return instance; }
 
-    // Capture the current stack trace
-    int captured = backtrace(frames, capacity);
-    int index = skip + 1;
-    int size = captured - index;
+    ~SymbolCache() { Clear(); }
 
-    // Check the current stack trace size
-    if (size <= 0)
-        return;
+    CriticalSection& lock() noexcept { return _cs; }
+
+    // Resolve the frame symbols with the cache (should be called under the cache lock)
+    void Resolve(void* address, StackTrace::Frame& frame)
+    {
+        auto it = _frames.find(address);
+        if (it != _frames.end())
+        {
+            frame = it->second;
+            return;
+        }
+
+        // Load debug symbols deferred by the lazy initialization
+        StackTraceManager::LoadSymbols();
+
+        frame.address = address;
+        frame.line = 0;
+        ResolveSymbols(frame);
 
-    // Resize stack trace frames vector
-    _frames.resize(size);
+        // Limit cache size for processes with a lot of distinct addresses
+        if (_frames.size() >= CAPACITY)
+            _frames.clear();
+        _frames.emplace(address, frame);
+    }
+
+    void Clear()
+    {
+        Locker<CriticalSection> locker(_cs);
+        _frames.clear();
+#if defined(LIBBFD_SUPPORT)
+        for (auto& module : _modules)
+        {
+            if (module.second.symbols != nullptr)
+                free(module.second.symbols);
+            if (module.second.abfd != nullptr)
+                bfd_close(module.second.abfd);
+        }
+        _modules.clear();
+#endif
+    }
+
+private:
+    static const size_t CAPACITY = 65536;
 
-    // Capture stack trace snapshot under the critical section
-    static CriticalSection cs;
-    Locker<CriticalSection> locker(cs);
+    CriticalSection _cs;
+    std::unordered_map<void*, StackTrace::Frame> _frames;
 
-    // Fill all captured frames with symbol information
-    for (int i = 0; i < size; ++i)
+#if defined(LIBBFD_SUPPORT)
+    // Opened module with loaded symbols
+    struct Module
+    {
+        bfd* abfd;
+        void* symbols;
+    };
+    std::unordered_map<std::string, Module> _modules;
+
+    // Get the cached module (nullptr if the module has no symbols)
+    Module* GetModule(const char* filename)
     {
-        auto& frame = _frames[i];
+        auto it = _modules.find(filename);
+        if (it != _modules.end())
+            return (it->second.abfd != nullptr) ? &it->second : nullptr;
+
+        Module module = { nullptr, nullptr };
+        bfd* abfd = bfd_openr(filename, nullptr);
+        if (abfd != nullptr)
+        {
+            char** matching = nullptr;
+            if (!bfd_check_format(abfd, bfd_archive) && bfd_check_format_matches(abfd, bfd_object, &matching) && ((bfd_get_file_flags(abfd) & HAS_SYMS) != 0))
+            {
+                void* symsptr = nullptr;
+                unsigned int symsize;
+                long symcount = bfd_read_minisymbols(abfd, FALSE, &symsptr, &symsize);
+                if (symcount == 0)
+                    symcount = bfd_read_minisymbols(abfd, TRUE, &symsptr, &symsize);
+                if (symcount >= 0)
+                    module = { abfd, symsptr };
+                else if (symsptr != nullptr)
+                    free(symsptr);
+            }
+            if (matching != nullptr)
+                free(matching);
+            if (module.abfd == nullptr)
+                bfd_close(abfd);
+        }
 
-        // Get the frame address
-        frame.address = frames[index + i];
+        auto& result = _modules[filename] = module;
+        return (result.abfd != nullptr) ? &result : nullptr;
+    }
+#endif
 
+    void ResolveSymbols([[maybe_unused]] StackTrace::Frame& frame)
+    {
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #if defined(LIBDL_SUPPORT)
         // Get the frame information
         Dl_info info;
-        if (dladdr(frames[index + i], &info) == 0)
-            continue;
+        if (dladdr(frame.address, &info) == 0)
+            return;
 
         // Get the frame module
         if (info.dli_fname != nullptr)
@@ -120,46 +200,20 @@ StackTrace::StackTrace(int skip)
         }
 #endif
 #if defined(LIBBFD_SUPPORT)
-        bfd* abfd = nullptr;
-        char** matching = nullptr;
+        if ((frame.address == nullptr) || (info.dli_fname == nullptr))
+            return;
 
-        void* symsptr = nullptr;
-        asymbol** syms = nullptr;
-        unsigned int symsize;
-        long symcount;
+        Module* module = GetModule(info.dli_fname);
+        if (module == nullptr)
+            return;
 
         const char* filename = nullptr;
         const char* functionname = nullptr;
         unsigned int line;
 
         bfd_boolean found = false;
-        bfd_vma pc;
-
-        if ((frame.address == nullptr) || (info.dli_fname == nullptr))
-            continue;
-
-        abfd = bfd_openr(info.dli_fname, nullptr);
-        if (abfd == nullptr)
-            continue;
-
-        if (bfd_check_format(abfd, bfd_archive))
-            goto cleanup;
-
-        if (!bfd_check_format_matches(abfd, bfd_object, &matching))
-            goto cleanup;
-
-        if ((bfd_get_file_flags(abfd) & HAS_SYMS) == 0)
-            goto cleanup;
-
-        symcount = bfd_read_minisymbols(abfd, FALSE, &symsptr, &symsize);
-        if (symcount == 0)
-            symcount = bfd_read_minisymbols(abfd, TRUE, &symsptr, &symsize);
-        if (symcount < 0)
-            goto cleanup;
-        syms = (asymbol**)symsptr;
-
-        pc = (bfd_vma)frame.address;
-        for (asection* section = abfd->sections; section != nullptr; section = section->next)
+        bfd_vma pc = (bfd_vma)frame.address;
+        for (asection* section = module->abfd->sections; section != nullptr; section = section->next)
         {
             if (found)
                 break;
@@ -175,46 +229,17 @@ StackTrace::StackTrace(int skip)
             if (pc >= vma + secsize)
                 continue;
 
-            found = bfd_find_nearest_line(abfd, section, syms, pc - vma, &filename, &functionname, &line);
+            found = bfd_find_nearest_line(module->abfd, section, (asymbol**)module->symbols, pc - vma, &filename, &functionname, &line);
         }
 
         if (!found)
-            goto cleanup;
+            return;
 
         if (filename != nullptr)
             frame.filename = filename;
         frame.line = line;
-
-cleanup:
-        if (symsptr != nullptr)
-            free(symsptr);
-
-        if (abfd != nullptr)
-            bfd_close(abfd);
 #endif
-    }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    const int capacity = 1024;
-    void* frames[capacity];
-
-    // Capture the current stack trace
-    USHORT captured = CaptureStackBackTrace(skip + 1, capacity, frames, nullptr);
-
-    // Resize stack trace frames vector
-    _frames.resize(captured);
-
-    // Capture stack trace snapshot under the critical section
-    static CriticalSection cs;
-    Locker<CriticalSection> locker(cs);
-
-    // Fill all captured frames with symbol information
-    for (int i = 0; i < captured; ++i)
-    {
-        auto& frame = _frames[i];
-
-        // Get the frame address
-        frame.address = frames[i];
-
 #if defined(DBGHELP_SUPPORT)
         // Get the current process handle
         HANDLE hProcess = GetCurrentProcess();
@@ -254,11 +279,152 @@ cleanup:
                 frame.filename = line.FileName;
             frame.line = line.LineNumber;
         }
+#endif
 #endif
     }
+};
+
+} // namespace Internals
+//! @endcond
+
+StackTrace::StackTrace(int skip) : _resolved(false)
+{
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    const int capacity = 1024;
+    void* frames[capacity];
+
+    // Capture the current stack trace
+    int captured = backtrace(frames, capacity);
+    int index = skip + 1;
+    int size = captured - index;
+
+    // Check the current stack trace size
+    if (size <= 0)
+        return;
+
+    // Symbols of captured frames are resolved on demand
+    _addresses.assign(frames + index, frames + index + size);
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    const int capacity = 1024;
+    void* frames[capacity];
+
+    // Capture the current stack trace
+    USHORT captured = CaptureStackBackTrace(skip + 1, capacity, frames, nullptr);
+
+    // Symbols of captured frames are resolved on demand
+    _addresses.assign(frames, frames + captured);
 #endif
 }
 
+StackTrace::StackTrace(void* const* frames, int size) : _resolved(false)
+{
+    if (size > 0)
+        _addresses.assign(frames, frames + size);
+}
+
+StackTrace::StackTrace(const StackTrace& stack_trace) : _addresses(stack_trace._addresses), _resolved(false)
+{
+    if (stack_trace.resolved())
+    {
+        _frames = stack_trace._frames;
+        _resolved.store(true, std::memory_order_relaxed);
+    }
+}
+
+StackTrace::StackTrace(StackTrace&& stack_trace) noexcept
+    : _addresses(std::move(stack_trace._addresses)),
+      _frames(std::move(stack_trace._frames)),
+      _resolved(stack_trace._resolved.load(std::memory_order_acquire))
+{
+    stack_trace._frames.clear();
+    stack_trace._resolved.store(false, std::memory_order_relaxed);
+}
+
+StackTrace& StackTrace::operator=(const StackTrace& stack_trace)
+{
+    if (this != &stack_trace)
+    {
+        _addresses = stack_trace._addresses;
+        bool resolved = stack_trace.resolved();
+        if (resolved)
+            _frames = stack_trace._frames;
+        else
+            _frames.clear();
+        _resolved.store(resolved, std::memory_order_release);
+    }
+    return *this;
+}
+
+StackTrace& StackTrace::operator=(StackTrace&& stack_trace) noexcept
+{
+    if (this != &stack_trace)
+    {
+        _addresses = std::move(stack_trace._addresses);
+        _frames = std::move(stack_trace._frames);
+        _resolved.store(stack_trace._resolved.load(std::memory_order_acquire), std::memory_order_release);
+        stack_trace._frames.clear();
+        stack_trace._resolved.store(false, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+const std::vector<StackTrace::Frame>& StackTrace::frames() const
+{
+    if (!_resolved.load(std::memory_order_acquire))
+        Resolve();
+    return _frames;
+}
+
+int StackTrace::Capture(void** frames, int capacity, int skip) noexcept
+{
+    if ((frames == nullptr) || (capacity <= 0))
+        return 0;
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    const int limit = 1024;
+    void* buffer[limit];
+
+    // Capture the current stack trace
+    int captured = backtrace(buffer, std::min(limit, capacity + skip + 1));
+    int index = skip + 1;
+    int size = std::min(captured - index, capacity);
+
+    // Check the current stack trace size
+    if (size <= 0)
+        return 0;
+
+    std::memcpy(frames, buffer + index, size * sizeof(void*));
+    return size;
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    return CaptureStackBackTrace(skip + 1, capacity, frames, nullptr);
+#else
+    return 0;
+#endif
+}
+
+void StackTrace::ClearCache()
+{
+    Internals::SymbolCache::GetInstance().Clear();
+}
+
+void StackTrace::Resolve() const
+{
+    // Resolve symbols under the shared symbols cache lock
+    auto& cache = Internals::SymbolCache::GetInstance();
+    Locker<CriticalSection> locker(cache.lock());
+
+    // Stack trace could be resolved by another thread
+    if (_resolved.load(std::memory_order_relaxed))
+        return;
+
+    std::vector<Frame> frames(_addresses.size());
+    for (size_t i = 0; i < _addresses.size(); ++i)
+        cache.Resolve(_addresses[i], frames[i]);
+
+    _frames = std::move(frames);
+    _resolved.store(true, std::memory_order_release);
+}
+
 std::ostream& operator<<(std::ostream& os, const StackTrace& stack_trace)
 {
     for (const auto& frame : stack_trace.frames())
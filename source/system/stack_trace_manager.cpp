@@ -8,8 +8,11 @@
 
 #include "system/stack_trace_manager.h"
 
+#include "threads/critical_section.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <atomic>
+
 #if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #if defined(DBGHELP_SUPPORT)
@@ -31,14 +34,33 @@ namespace CppCommon {
 class StackTraceManager::Impl
 {
 public:
-    Impl() : _initialized(false) {}
+    Impl() : _initialized(false), _loaded(false) {}
 
-    void Initialize()
+    void Initialize(bool lazy)
     {
         // Check for double initialization
         if (_initialized)
             return;
 
+        _initialized = true;
+
+        // Debug symbols will be loaded on the first symbols resolution
+        if (!lazy)
+            LoadSymbols();
+    }
+
+    void LoadSymbols()
+    {
+        // Fast check for already loaded symbols
+        if (_loaded.load(std::memory_order_acquire))
+            return;
+
+        Locker<CriticalSection> locker(_cs);
+
+        // Check for loaded symbols or not initialized manager under the lock
+        if (_loaded.load(std::memory_order_relaxed) || !_initialized)
+            return;
+
 #if defined(_WIN32) || defined(_WIN64)
 #if defined(DBGHELP_SUPPORT)
         // Provide required symbol options
@@ -53,7 +75,7 @@ public:
 #endif
 #endif
 
-        _initialized = true;
+        _loaded.store(true, std::memory_order_release);
     }
 
     void Cleanup()
@@ -62,22 +84,31 @@ public:
         if (!_initialized)
             return;
 
+        Locker<CriticalSection> locker(_cs);
+
+        // Cleanup symbols only if they were loaded
+        if (_loaded.load(std::memory_order_relaxed))
+        {
 #if defined(_WIN32) || defined(_WIN64)
 #if defined(DBGHELP_SUPPORT)
-        // Get the current process handle
-        HANDLE hProcess = GetCurrentProcess();
+            // Get the current process handle
+            HANDLE hProcess = GetCurrentProcess();
 
-        // Cleanup symbol handler for the current process
-        if (!SymCleanup(hProcess))
-            throwex SystemException("Cannot cleanup symbol handler for the current process!");
+            // Cleanup symbol handler for the current process
+            if (!SymCleanup(hProcess))
+                throwex SystemException("Cannot cleanup symbol handler for the current process!");
 #endif
 #endif
+            _loaded.store(false, std::memory_order_release);
+        }
 
         _initialized = false;
     }
 
 private:
     bool _initialized;
+    std::atomic<bool> _loaded;
+    CriticalSection _cs;
 
 #if defined(_WIN32) || defined(_WIN64)
 #if defined(DBGHELP_SUPPORT)
@@ -117,7 +148,8 @@ StackTraceManager::~StackTraceManager()
     reinterpret_cast<Impl*>(&_storage)->~Impl();
 }
 
-void StackTraceManager::Initialize() { GetInstance().impl().Initialize(); }
+void StackTraceManager::Initialize(bool lazy) { GetInstance().impl().Initialize(lazy); }
+void StackTraceManager::LoadSymbols() { GetInstance().impl().LoadSymbols(); }
 void StackTraceManager::Cleanup() { GetInstance().impl().Cleanup(); }
 
 } // namespace CppCommon
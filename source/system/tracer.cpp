@@ -0,0 +1,684 @@
+/*!
+    \file tracer.cpp
+    \brief In-process event tracer implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "system/tracer.h"
+
+#include "errors/exceptions.h"
+#include "errors/exceptions_handler.h"
+#include "filesystem/file.h"
+#include "string/format.h"
+#include "system/process.h"
+#include "threads/critical_section.h"
+#include "threads/event_auto_reset.h"
+#include "threads/locker.h"
+#include "threads/spsc_ring_buffer.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+std::atomic<bool> trace_enabled(false);
+
+namespace {
+
+// Trace event type
+enum TraceEventType : uint32_t
+{
+    TRACE_COMPLETE,
+    TRACE_INSTANT,
+    TRACE_COUNTER
+};
+
+// Fixed-size trace event record
+struct TraceEvent
+{
+    uint64_t timestamp;     // Timestamp::rdts() value
+    uint64_t value;         // Duration in ticks or counter value
+    const char* name;       // Static event name
+    uint32_t type;          // Trace event type
+    uint32_t reserved;
+};
+
+static_assert((sizeof(TraceEvent) == 32), "Trace event must be 32 bytes!");
+
+// Trace ring buffer of the thread
+struct TraceRing
+{
+    SPSCRingBuffer buffer;
+    uint64_t id;
+    uint64_t tid;
+    std::string name;               // Protected by the tracer lock
+    bool renamed;                   // Protected by the tracer lock
+    std::atomic<uint64_t> dropped;
+    std::atomic<bool> finished;
+
+    TraceRing(size_t capacity, uint64_t ring_id, uint64_t thread_id, const std::string& thread_name)
+        : buffer(capacity * sizeof(TraceEvent)), id(ring_id), tid(thread_id), name(thread_name), renamed(true), dropped(0), finished(false)
+    {}
+};
+
+// Trace ring buffers owner of the thread
+struct TraceThread
+{
+    std::shared_ptr<TraceRing> ring;
+    std::string name;
+
+    ~TraceThread();
+};
+
+// Tracer state
+struct TraceState
+{
+    // Protects rings and tracer setup
+    CriticalSection lock;
+    std::vector<std::shared_ptr<TraceRing>> rings;
+    size_t capacity{0};
+    uint64_t ids{0};
+    std::atomic<uint64_t> dropped{0};
+
+    // Protects the trace file (single consumer of all ring buffers)
+    CriticalSection drain;
+    File file;
+    TraceFormat format{TraceFormat::Chrome};
+    bool opened{false};
+    bool first{true};
+    uint64_t pid{0};
+    std::unordered_set<uint64_t> counters;
+    std::string output;
+
+    // Ticks to nanoseconds conversion
+    uint64_t base_ticks{0};
+    uint64_t base_nano{0};
+    uint64_t origin_nano{0};
+    double ratio{1.0};
+
+    // Collector thread
+    std::thread collector;
+    std::atomic<bool> stop{false};
+    EventAutoReset wake;
+    Timespan period;
+    bool dump_handler{false};
+
+    ~TraceState()
+    {
+        if (collector.joinable())
+        {
+            stop = true;
+            wake.Signal();
+            collector.join();
+        }
+    }
+};
+
+TraceState& GetTraceState()
+{
+    static TraceState state;
+    return state;
+}
+
+thread_local TraceRing* trace_ring = nullptr;
+thread_local bool trace_exited = false;
+thread_local TraceThread trace_thread;
+
+TraceThread::~TraceThread()
+{
+    // Ring buffer is removed by the collector when it is drained
+    trace_exited = true;
+    trace_ring = nullptr;
+    if (ring)
+        ring->finished.store(true, std::memory_order_release);
+}
+
+uint64_t CurrentTraceThreadId() noexcept
+{
+#if defined(__APPLE__)
+    uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    return tid;
+#elif defined(linux) || defined(__linux) || defined(__linux__)
+    return (uint64_t)syscall(SYS_gettid);
+#elif defined(_WIN32) || defined(_WIN64)
+    return (uint64_t)GetCurrentThreadId();
+#else
+    return Thread::CurrentThreadId();
+#endif
+}
+
+// Register the ring buffer of the current thread
+TraceRing* RegisterTraceRing() noexcept
+{
+    if (trace_exited)
+        return nullptr;
+
+    try
+    {
+        TraceState& state = GetTraceState();
+        Locker<CriticalSection> locker(state.lock);
+
+        // Tracer was never started
+        if (state.capacity == 0)
+            return nullptr;
+
+        uint64_t id = ++state.ids;
+        uint64_t tid = CurrentTraceThreadId();
+        std::string name = trace_thread.name.empty() ? format("Thread {}", tid) : trace_thread.name;
+        auto ring = std::make_shared<TraceRing>(state.capacity, id, tid, name);
+        state.rings.push_back(ring);
+        trace_thread.ring = ring;
+        trace_ring = ring.get();
+        return trace_ring;
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+inline void RecordTraceEvent(uint32_t type, const char* name, uint64_t timestamp, uint64_t value) noexcept
+{
+    TraceRing* ring = trace_ring;
+    if (ring == nullptr)
+    {
+        ring = RegisterTraceRing();
+        if (ring == nullptr)
+            return;
+    }
+
+    TraceEvent event = { timestamp, value, name, type, 0 };
+    if (!ring->buffer.Enqueue(&event, sizeof(event)))
+        ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// Update ticks to nanoseconds ratio with the whole elapsed interval
+void CalibrateTrace(TraceState& state)
+{
+    uint64_t ticks = Timestamp::rdts();
+    uint64_t nano = Timestamp::nano();
+    if ((ticks > state.base_ticks) && (nano > state.base_nano))
+        state.ratio = (double)(nano - state.base_nano) / (double)(ticks - state.base_ticks);
+}
+
+uint64_t TraceNano(const TraceState& state, uint64_t ticks)
+{
+    if (ticks >= state.base_ticks)
+        return state.base_nano + (uint64_t)((double)(ticks - state.base_ticks) * state.ratio);
+    else
+        return state.base_nano - std::min(state.base_nano, (uint64_t)((double)(state.base_ticks - ticks) * state.ratio));
+}
+
+void AppendJsonString(std::string& output, const char* str)
+{
+    output.push_back('"');
+    for (const char* ptr = (str != nullptr) ? str : ""; *ptr != 0; ++ptr)
+    {
+        char ch = *ptr;
+        if ((ch == '"') || (ch == '\\'))
+        {
+            output.push_back('\\');
+            output.push_back(ch);
+        }
+        else if ((unsigned char)ch < 0x20)
+            output.append(format("\\u{:04x}", (int)ch));
+        else
+            output.push_back(ch);
+    }
+    output.push_back('"');
+}
+
+void AppendVarint(std::string& output, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        output.push_back((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    output.push_back((char)value);
+}
+
+void AppendVarintField(std::string& output, uint32_t field, uint64_t value)
+{
+    AppendVarint(output, ((uint64_t)field << 3) | 0);
+    AppendVarint(output, value);
+}
+
+void AppendBytesField(std::string& output, uint32_t field, const void* data, size_t size)
+{
+    AppendVarint(output, ((uint64_t)field << 3) | 2);
+    AppendVarint(output, size);
+    output.append((const char*)data, size);
+}
+
+void AppendStringField(std::string& output, uint32_t field, const char* str)
+{
+    str = (str != nullptr) ? str : "";
+    AppendBytesField(output, field, str, std::strlen(str));
+}
+
+void AppendMessageField(std::string& output, uint32_t field, const std::string& message)
+{
+    AppendBytesField(output, field, message.data(), message.size());
+}
+
+// Perfetto protobuf field numbers
+enum PerfettoField : uint32_t
+{
+    TRACE_PACKET = 1,
+    PACKET_TIMESTAMP = 8,
+    PACKET_SEQUENCE_ID = 10,
+    PACKET_TRACK_EVENT = 11,
+    PACKET_SEQUENCE_FLAGS = 13,
+    PACKET_TRACK_DESCRIPTOR = 60,
+    EVENT_TYPE = 9,
+    EVENT_TRACK_UUID = 11,
+    EVENT_NAME = 23,
+    EVENT_COUNTER_VALUE = 30,
+    DESCRIPTOR_UUID = 1,
+    DESCRIPTOR_NAME = 2,
+    DESCRIPTOR_THREAD = 4,
+    DESCRIPTOR_COUNTER = 8,
+    THREAD_PID = 1,
+    THREAD_TID = 2,
+    THREAD_NAME = 5
+};
+
+// Perfetto track event types
+enum PerfettoEventType : uint64_t
+{
+    SLICE_BEGIN = 1,
+    SLICE_END = 2,
+    INSTANT = 3,
+    COUNTER = 4
+};
+
+// Perfetto trusted packet sequence of the tracer
+const uint64_t PERFETTO_SEQUENCE = 1;
+// Perfetto incremental state cleared sequence flag
+const uint64_t PERFETTO_INCREMENTAL_STATE_CLEARED = 1;
+
+uint64_t PerfettoCounterUuid(const char* name)
+{
+    // FNV-1a hash of the counter name with the bit which separates counter tracks from thread tracks
+    uint64_t hash = 14695981039346656037ull;
+    for (const char* ptr = name; *ptr != 0; ++ptr)
+        hash = (hash ^ (uint8_t)*ptr) * 1099511628211ull;
+    return hash | (1ull << 63);
+}
+
+void AppendPerfettoPacket(TraceState& state, const std::string& packet)
+{
+    if (state.first)
+    {
+        // The first packet clears the incremental state of the sequence
+        std::string flagged = packet;
+        AppendVarintField(flagged, PACKET_SEQUENCE_FLAGS, PERFETTO_INCREMENTAL_STATE_CLEARED);
+        AppendMessageField(state.output, TRACE_PACKET, flagged);
+        state.first = false;
+    }
+    else
+        AppendMessageField(state.output, TRACE_PACKET, packet);
+}
+
+void AppendPerfettoEvent(TraceState& state, uint64_t timestamp, uint64_t type, uint64_t track, const char* name, const int64_t* value)
+{
+    std::string event;
+    AppendVarintField(event, EVENT_TYPE, type);
+    AppendVarintField(event, EVENT_TRACK_UUID, track);
+    if (name != nullptr)
+        AppendStringField(event, EVENT_NAME, name);
+    if (value != nullptr)
+        AppendVarintField(event, EVENT_COUNTER_VALUE, (uint64_t)*value);
+
+    std::string packet;
+    AppendVarintField(packet, PACKET_TIMESTAMP, timestamp);
+    AppendVarintField(packet, PACKET_SEQUENCE_ID, PERFETTO_SEQUENCE);
+    AppendMessageField(packet, PACKET_TRACK_EVENT, event);
+    AppendPerfettoPacket(state, packet);
+}
+
+void AppendChromeEvent(TraceState& state, const std::string& event)
+{
+    if (!state.first)
+        state.output.append(",\n");
+    state.output.append(event);
+    state.first = false;
+}
+
+// Describe the thread of the ring buffer in the trace
+void DescribeTraceRing(TraceState& state, const TraceRing& ring, const std::string& name)
+{
+    if (state.format == TraceFormat::Chrome)
+    {
+        std::string event = format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":", state.pid, ring.tid);
+        AppendJsonString(event, name.c_str());
+        event.append("}}");
+        AppendChromeEvent(state, event);
+    }
+    else
+    {
+        std::string thread;
+        AppendVarintField(thread, THREAD_PID, state.pid);
+        AppendVarintField(thread, THREAD_TID, ring.tid);
+        AppendStringField(thread, THREAD_NAME, name.c_str());
+
+        std::string descriptor;
+        AppendVarintField(descriptor, DESCRIPTOR_UUID, ring.id);
+        AppendMessageField(descriptor, DESCRIPTOR_THREAD, thread);
+
+        std::string packet;
+        AppendVarintField(packet, PACKET_SEQUENCE_ID, PERFETTO_SEQUENCE);
+        AppendMessageField(packet, PACKET_TRACK_DESCRIPTOR, descriptor);
+        AppendPerfettoPacket(state, packet);
+    }
+}
+
+// Write the trace event of the ring buffer into the output
+void AppendTraceEvent(TraceState& state, const TraceRing& ring, const TraceEvent& event)
+{
+    uint64_t timestamp = TraceNano(state, event.timestamp);
+
+    if (state.format == TraceFormat::Chrome)
+    {
+        double ts = (double)(int64_t)(timestamp - state.origin_nano) / 1000.0;
+        std::string output = "{\"name\":";
+        AppendJsonString(output, event.name);
+        switch (event.type)
+        {
+            case TRACE_COMPLETE:
+                output.append(format(",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":{},\"tid\":{}}}", ts, ((double)event.value * state.ratio) / 1000.0, state.pid, ring.tid));
+                break;
+            case TRACE_INSTANT:
+                output.append(format(",\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},\"pid\":{},\"tid\":{}}}", ts, state.pid, ring.tid));
+                break;
+            case TRACE_COUNTER:
+                output.append(format(",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":{},\"tid\":{},\"args\":{{\"value\":{}}}}}", ts, state.pid, ring.tid, (int64_t)event.value));
+                break;
+        }
+        AppendChromeEvent(state, output);
+    }
+    else
+    {
+        switch (event.type)
+        {
+            case TRACE_COMPLETE:
+                AppendPerfettoEvent(state, timestamp, SLICE_BEGIN, ring.id, event.name, nullptr);
+                AppendPerfettoEvent(state, timestamp + (uint64_t)((double)event.value * state.ratio), SLICE_END, ring.id, nullptr, nullptr);
+                break;
+            case TRACE_INSTANT:
+                AppendPerfettoEvent(state, timestamp, INSTANT, ring.id, event.name, nullptr);
+                break;
+            case TRACE_COUNTER:
+            {
+                // Counters are placed on their own tracks described once
+                uint64_t uuid = PerfettoCounterUuid(event.name);
+                if (state.counters.insert(uuid).second)
+                {
+                    std::string descriptor;
+                    AppendVarintField(descriptor, DESCRIPTOR_UUID, uuid);
+                    AppendStringField(descriptor, DESCRIPTOR_NAME, event.name);
+                    AppendMessageField(descriptor, DESCRIPTOR_COUNTER, std::string());
+
+                    std::string packet;
+                    AppendVarintField(packet, PACKET_SEQUENCE_ID, PERFETTO_SEQUENCE);
+                    AppendMessageField(packet, PACKET_TRACK_DESCRIPTOR, descriptor);
+                    AppendPerfettoPacket(state, packet);
+                }
+                int64_t value = (int64_t)event.value;
+                AppendPerfettoEvent(state, timestamp, COUNTER, uuid, nullptr, &value);
+                break;
+            }
+        }
+    }
+}
+
+// Drain all ring buffers into the trace file (must be called under the drain lock)
+void DrainTrace(TraceState& state)
+{
+    if (!state.opened)
+        return;
+
+    CalibrateTrace(state);
+
+    // Take the snapshot of rings and thread names
+    std::vector<std::shared_ptr<TraceRing>> rings;
+    std::vector<std::string> names;
+    {
+        Locker<CriticalSection> locker(state.lock);
+        rings = state.rings;
+        names.resize(rings.size());
+        for (size_t i = 0; i < rings.size(); ++i)
+        {
+            if (rings[i]->renamed)
+            {
+                names[i] = rings[i]->name;
+                rings[i]->renamed = false;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < rings.size(); ++i)
+    {
+        TraceRing& ring = *rings[i];
+        bool finished = ring.finished.load(std::memory_order_acquire);
+
+        if (!names[i].empty())
+            DescribeTraceRing(state, ring, names[i]);
+
+        // Ring buffer contains whole records only, so the peeked data is aligned to records
+        auto data = ring.buffer.Peek();
+        const TraceEvent* events = (const TraceEvent*)data.data();
+        size_t count = data.size() / sizeof(TraceEvent);
+        for (size_t j = 0; j < count; ++j)
+            AppendTraceEvent(state, ring, events[j]);
+        ring.buffer.Release(count * sizeof(TraceEvent));
+
+        // Write the output in portions to keep the memory usage bounded
+        if (state.output.size() >= 65536)
+        {
+            state.file.Write(state.output.data(), state.output.size());
+            state.output.clear();
+        }
+
+        // Remove rings of finished threads when they are drained
+        if (finished && ring.buffer.empty())
+        {
+            Locker<CriticalSection> locker(state.lock);
+            state.dropped += ring.dropped.load(std::memory_order_relaxed);
+            state.rings.erase(std::remove(state.rings.begin(), state.rings.end(), rings[i]), state.rings.end());
+        }
+    }
+
+    if (!state.output.empty())
+    {
+        state.file.Write(state.output.data(), state.output.size());
+        state.output.clear();
+    }
+    state.file.Flush();
+}
+
+void CollectTrace()
+{
+    TraceState& state = GetTraceState();
+    while (!state.stop)
+    {
+        state.wake.TryWaitFor(state.period);
+
+        Locker<CriticalSection> locker(state.drain);
+        DrainTrace(state);
+    }
+}
+
+} // namespace
+} // namespace Internals
+//! @endcond
+
+uint64_t Tracer::dropped() noexcept
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+    Locker<CriticalSection> locker(state.lock);
+
+    uint64_t result = state.dropped;
+    for (const auto& ring : state.rings)
+        result += ring->dropped.load(std::memory_order_relaxed);
+    return result;
+}
+
+void Tracer::Start(const Path& path, TraceFormat format, size_t capacity, const Timespan& period)
+{
+    assert((capacity > 0) && ((capacity & (capacity - 1)) == 0) && "Tracer capacity must be a power of two!");
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0))
+        throwex ArgumentException("Tracer capacity must be a power of two!");
+
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    Stop();
+
+    {
+        Locker<CriticalSection> locker(state.drain);
+
+        state.file = File(path);
+        state.file.OpenOrCreate(false, true, true);
+        state.format = format;
+        state.opened = true;
+        state.first = true;
+        state.pid = Process::CurrentProcessId();
+        state.counters.clear();
+        state.output.clear();
+
+        // Calibrate ticks to nanoseconds ratio for one millisecond
+        state.base_ticks = Timestamp::rdts();
+        state.base_nano = Timestamp::nano();
+        state.origin_nano = state.base_nano;
+        while ((Timestamp::nano() - state.base_nano) < 1000000)
+            Thread::Pause();
+        Internals::CalibrateTrace(state);
+
+        if (format == TraceFormat::Chrome)
+            state.output.append("[\n");
+
+        // Describe all known threads again in the new trace file
+        Locker<CriticalSection> locker2(state.lock);
+        for (auto& ring : state.rings)
+            ring->renamed = true;
+    }
+
+    {
+        Locker<CriticalSection> locker(state.lock);
+        if (state.capacity == 0)
+            state.capacity = capacity;
+        if (!state.dump_handler)
+        {
+            ExceptionsHandler::AddDumpHandler([]() { Tracer::Dump(); });
+            state.dump_handler = true;
+        }
+    }
+
+    state.period = period;
+    state.stop = false;
+    state.collector = Thread::Start(Internals::CollectTrace);
+
+    Internals::trace_enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::Stop()
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    Internals::trace_enabled.store(false, std::memory_order_release);
+
+    if (state.collector.joinable())
+    {
+        state.stop = true;
+        state.wake.Signal();
+        state.collector.join();
+    }
+
+    Locker<CriticalSection> locker(state.drain);
+    if (state.opened)
+    {
+        Internals::DrainTrace(state);
+        if (state.format == TraceFormat::Chrome)
+        {
+            state.file.Write("\n]\n", 3);
+            state.file.Flush();
+        }
+        state.file.Close();
+        state.opened = false;
+    }
+}
+
+void Tracer::Flush()
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+    Locker<CriticalSection> locker(state.drain);
+    Internals::DrainTrace(state);
+}
+
+void Tracer::Dump()
+{
+    try
+    {
+        Internals::TraceState& state = Internals::GetTraceState();
+        if (!state.drain.TryLock())
+            return;
+
+        Internals::DrainTrace(state);
+        state.drain.Unlock();
+    }
+    catch (...) {}
+}
+
+void Tracer::SetThreadName(const std::string& name)
+{
+    Internals::trace_thread.name = name;
+
+    Internals::TraceState& state = Internals::GetTraceState();
+    Locker<CriticalSection> locker(state.lock);
+    if (Internals::trace_thread.ring)
+    {
+        Internals::trace_thread.ring->name = name;
+        Internals::trace_thread.ring->renamed = true;
+    }
+}
+
+void Tracer::Complete(const char* name, uint64_t start, uint64_t finish) noexcept
+{
+    if (enabled())
+        Internals::RecordTraceEvent(Internals::TRACE_COMPLETE, name, start, finish - start);
+}
+
+void Tracer::Instant(const char* name) noexcept
+{
+    if (enabled())
+        Internals::RecordTraceEvent(Internals::TRACE_INSTANT, name, Timestamp::rdts(), 0);
+}
+
+void Tracer::Counter(const char* name, int64_t value) noexcept
+{
+    if (enabled())
+        Internals::RecordTraceEvent(Internals::TRACE_COUNTER, name, Timestamp::rdts(), (uint64_t)value);
+}
+
+} // namespace CppCommon
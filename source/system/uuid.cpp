@@ -9,97 +9,298 @@
 #include "system/uuid.h"
 
 #include "memory/memory.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
 
 #if defined(__MSYS__) || defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <rpc.h>
 #elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
 #include <uuid/uuid.h>
 #endif
 
 namespace CppCommon {
 
-std::string UUID::string() const
+//! @cond INTERNALS
+namespace Internals {
+
+// Generation of random generators, incremented in the child process after fork
+std::atomic<uint64_t> RandomGeneration(0);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+void RandomAtFork()
 {
-    const char* digits = "0123456789abcdef";
+    RandomGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+#endif
 
-    std::string result(36, '0');
+inline uint32_t RotateLeft(uint32_t value, int count) noexcept
+{
+    return (value << count) | (value >> (32 - count));
+}
+
+inline void QuarterRound(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d) noexcept
+{
+    a += b; d = RotateLeft(d ^ a, 16);
+    c += d; b = RotateLeft(b ^ c, 12);
+    a += b; d = RotateLeft(d ^ a, 8);
+    c += d; b = RotateLeft(b ^ c, 7);
+}
 
-    int index = 0;
-    for (auto value : _data)
+// Buffered ChaCha20 random generator (RFC 8439 block function)
+class ChaChaRandom
+{
+public:
+    ChaChaRandom() { Seed(); }
+    ~ChaChaRandom() { std::memset(_state, 0, sizeof(_state)); std::memset(_buffer, 0, sizeof(_buffer)); }
+
+    void Fill(uint8_t* buffer, size_t size)
     {
-        result[index++] = digits[(value >> 4) & 0x0F];
-        result[index++] = digits[(value >> 0) & 0x0F];
-        if ((index == 8) || (index == 13) || (index == 18) || (index == 23))
-            result[index++] = '-';
+        // Child process must not repeat the parent random sequence
+        if (_generation != RandomGeneration.load(std::memory_order_relaxed))
+            Seed();
+
+        while (size > 0)
+        {
+            if (_position == sizeof(_buffer))
+                Refill();
+
+            // Consumed random bytes are erased from the buffer
+            size_t count = std::min(size, sizeof(_buffer) - _position);
+            std::memcpy(buffer, _buffer + _position, count);
+            std::memset(_buffer + _position, 0, count);
+            _position += count;
+            buffer += count;
+            size -= count;
+        }
     }
 
-    return result;
+private:
+    // Count of blocks generated at once
+    static const size_t BLOCKS = 4;
+    // Count of blocks generated before reseed (4 MiB of random data)
+    static const uint32_t RESEED = 1 << 16;
+
+    uint32_t _state[16];
+    uint8_t _buffer[64 * BLOCKS];
+    size_t _position;
+    uint32_t _blocks;
+    uint64_t _generation;
+
+    void Seed()
+    {
+        _generation = RandomGeneration.load(std::memory_order_relaxed);
+
+        // "expand 32-byte k" constants, 256-bit key, 32-bit counter and 96-bit nonce
+        _state[0] = 0x61707865;
+        _state[1] = 0x3320646E;
+        _state[2] = 0x79622D32;
+        _state[3] = 0x6B206574;
+        Memory::CryptoFill(_state + 4, 8 * sizeof(uint32_t));
+        _state[12] = 0;
+        Memory::CryptoFill(_state + 13, 3 * sizeof(uint32_t));
+
+        _position = sizeof(_buffer);
+        _blocks = 0;
+    }
+
+    void Refill()
+    {
+        if (_blocks >= RESEED)
+            Seed();
+
+        for (size_t i = 0; i < BLOCKS; ++i)
+        {
+            uint32_t x[16];
+            std::memcpy(x, _state, sizeof(x));
+            for (int round = 0; round < 10; ++round)
+            {
+                QuarterRound(x[0], x[4], x[8], x[12]);
+                QuarterRound(x[1], x[5], x[9], x[13]);
+                QuarterRound(x[2], x[6], x[10], x[14]);
+                QuarterRound(x[3], x[7], x[11], x[15]);
+                QuarterRound(x[0], x[5], x[10], x[15]);
+                QuarterRound(x[1], x[6], x[11], x[12]);
+                QuarterRound(x[2], x[7], x[8], x[13]);
+                QuarterRound(x[3], x[4], x[9], x[14]);
+            }
+            uint8_t* output = _buffer + i * 64;
+            for (size_t j = 0; j < 16; ++j)
+            {
+                uint32_t value = x[j] + _state[j];
+                output[j * 4 + 0] = (uint8_t)(value >> 0);
+                output[j * 4 + 1] = (uint8_t)(value >> 8);
+                output[j * 4 + 2] = (uint8_t)(value >> 16);
+                output[j * 4 + 3] = (uint8_t)(value >> 24);
+            }
+            ++_state[12];
+            ++_blocks;
+        }
+        _position = 0;
+    }
+};
+
+void RandomFill(uint8_t* buffer, size_t size)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    [[maybe_unused]] static int registered = pthread_atfork(nullptr, nullptr, RandomAtFork);
+#endif
+    thread_local ChaChaRandom random;
+    random.Fill(buffer, size);
 }
 
-UUID UUID::Sequential()
+// Convert 16 bytes into 32 lowercase hex digits
+void FormatHex(const uint8_t* data, char* hex) noexcept
 {
-    UUID result;
-#if defined(__MSYS__) || defined(_WIN32) || defined(_WIN64)
-    ::UUID uuid;
-    if (UuidCreateSequential(&uuid) != RPC_S_OK)
-        throwex SystemException("Cannot generate sequential UUID!");
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is always available for x86-64
+    auto digits = [](__m128i n) { return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10))); };
+    __m128i v = _mm_loadu_si128((const __m128i*)data);
+    __m128i hi = digits(_mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F)));
+    __m128i lo = digits(_mm_and_si128(v, _mm_set1_epi8(0x0F)));
+    _mm_storeu_si128((__m128i*)hex, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i*)(hex + 16), _mm_unpackhi_epi8(hi, lo));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    auto digits = [](uint8x16_t n) { return vaddq_u8(vaddq_u8(n, vdupq_n_u8('0')), vandq_u8(vcgtq_u8(n, vdupq_n_u8(9)), vdupq_n_u8('a' - '0' - 10))); };
+    uint8x16_t v = vld1q_u8(data);
+    uint8x16x2_t result = vzipq_u8(digits(vshrq_n_u8(v, 4)), digits(vandq_u8(v, vdupq_n_u8(0x0F))));
+    vst1q_u8((uint8_t*)hex, result.val[0]);
+    vst1q_u8((uint8_t*)(hex + 16), result.val[1]);
+#else
+    const char* digits = "0123456789abcdef";
+    for (size_t i = 0; i < 16; ++i)
+    {
+        hex[i * 2 + 0] = digits[data[i] >> 4];
+        hex[i * 2 + 1] = digits[data[i] & 0x0F];
+    }
+#endif
+}
 
-    result._data[0] = (uuid.Data1 >> 24) & 0xFF;
-    result._data[1] = (uuid.Data1 >> 16) & 0xFF;
-    result._data[2] = (uuid.Data1 >>  8) & 0xFF;
-    result._data[3] = (uuid.Data1 >>  0) & 0xFF;
+// Convert 32 hex digits into 16 bytes (returns 'false' if any character is not a hex digit)
+bool ParseHex(const char* hex, uint8_t* data) noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is always available for x86-64
+    __m128i result[2];
+    for (size_t i = 0; i < 2; ++i)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(hex + i * 16));
+        __m128i digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+        __m128i letters = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+        if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xFFFF)
+            return false;
+        __m128i values = _mm_or_si128(_mm_and_si128(is_digit, digits), _mm_and_si128(is_letter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+        // The first digit of each pair is the high nibble
+        result[i] = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(values, 8));
+    }
+    _mm_storeu_si128((__m128i*)data, _mm_packus_epi16(result[0], result[1]));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    uint8x8_t result[2];
+    for (size_t i = 0; i < 2; ++i)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)(hex + i * 16));
+        uint8x16_t digits = vsubq_u8(v, vdupq_n_u8('0'));
+        uint8x16_t letters = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+        uint8x16_t is_digit = vcleq_u8(digits, vdupq_n_u8(9));
+        uint8x16_t is_letter = vcleq_u8(letters, vdupq_n_u8(5));
+        if (vminvq_u8(vorrq_u8(is_digit, is_letter)) == 0)
+            return false;
+        uint16x8_t values = vreinterpretq_u16_u8(vbslq_u8(is_digit, digits, vaddq_u8(letters, vdupq_n_u8(10))));
+        // The first digit of each pair is the high nibble
+        result[i] = vmovn_u16(vorrq_u16(vshlq_n_u16(vandq_u16(values, vdupq_n_u16(0x00FF)), 4), vshrq_n_u16(values, 8)));
+    }
+    vst1q_u8(data, vcombine_u8(result[0], result[1]));
+#else
+    for (size_t i = 0; i < 16; ++i)
+    {
+        uint8_t values[2];
+        for (size_t j = 0; j < 2; ++j)
+        {
+            char ch = hex[i * 2 + j];
+            if ((ch >= '0') && (ch <= '9'))
+                values[j] = (uint8_t)(ch - '0');
+            else if (((ch | 0x20) >= 'a') && ((ch | 0x20) <= 'f'))
+                values[j] = (uint8_t)((ch | 0x20) - 'a' + 10);
+            else
+                return false;
+        }
+        data[i] = (uint8_t)((values[0] << 4) | values[1]);
+    }
+#endif
+    return true;
+}
 
-    result._data[4] = (uuid.Data2 >>  8) & 0xFF;
-    result._data[5] = (uuid.Data2 >>  0) & 0xFF;
+// Segments of the canonical UUID string: offset in the string and size
+const size_t Segments[5][2] = { { 0, 8 }, { 9, 4 }, { 14, 4 }, { 19, 4 }, { 24, 12 } };
 
-    result._data[6] = (uuid.Data3 >>  8) & 0xFF;
-    result._data[7] = (uuid.Data3 >>  0) & 0xFF;
+} // namespace Internals
+//! @endcond
 
-    result._data[8] = uuid.Data4[0];
-    result._data[9] = uuid.Data4[1];
+UUID::UUID(const std::string& uuid)
+{
+    // Fast path for the canonical UUID string
+    if ((uuid.size() == 36) && (uuid[8] == '-') && (uuid[13] == '-') && (uuid[18] == '-') && (uuid[23] == '-'))
+    {
+        char hex[32];
+        size_t index = 0;
+        for (const auto& segment : Internals::Segments)
+        {
+            std::memcpy(hex + index, uuid.data() + segment[0], segment[1]);
+            index += segment[1];
+        }
+        if (Internals::ParseHex(hex, _data.data()))
+            return;
+    }
 
-    result._data[10] = uuid.Data4[2];
-    result._data[11] = uuid.Data4[3];
-    result._data[12] = uuid.Data4[4];
-    result._data[13] = uuid.Data4[5];
-    result._data[14] = uuid.Data4[6];
-    result._data[15] = uuid.Data4[7];
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    uuid_t uuid;
-    uuid_generate_time(uuid);
+    *this = UUID(uuid.data(), uuid.size());
+}
 
-    result._data[0] = uuid[0];
-    result._data[1] = uuid[1];
-    result._data[2] = uuid[2];
-    result._data[3] = uuid[3];
+std::string UUID::string() const
+{
+    std::string result(36, '0');
+    string(result.data(), result.size());
+    return result;
+}
 
-    result._data[4] = uuid[4];
-    result._data[5] = uuid[5];
+size_t UUID::string(char* buffer, size_t size) const noexcept
+{
+    if ((buffer == nullptr) || (size < 36))
+        return 0;
 
-    result._data[6] = uuid[6];
-    result._data[7] = uuid[7];
+    char hex[32];
+    Internals::FormatHex(_data.data(), hex);
 
-    result._data[8] = uuid[8];
-    result._data[9] = uuid[9];
+    size_t index = 0;
+    for (const auto& segment : Internals::Segments)
+    {
+        std::memcpy(buffer + segment[0], hex + index, segment[1]);
+        if (segment[0] > 0)
+            buffer[segment[0] - 1] = '-';
+        index += segment[1];
+    }
 
-    result._data[10] = uuid[10];
-    result._data[11] = uuid[11];
-    result._data[12] = uuid[12];
-    result._data[13] = uuid[13];
-    result._data[14] = uuid[14];
-    result._data[15] = uuid[15];
-#endif
-    return result;
+    return 36;
 }
 
-UUID UUID::Random()
+UUID UUID::Sequential()
 {
     UUID result;
 #if defined(__MSYS__) || defined(_WIN32) || defined(_WIN64)
     ::UUID uuid;
-    if (UuidCreate(&uuid) != RPC_S_OK)
-        throwex SystemException("Cannot generate random UUID!");
+    if (UuidCreateSequential(&uuid) != RPC_S_OK)
+        throwex SystemException("Cannot generate sequential UUID!");
 
     result._data[0] = (uuid.Data1 >> 24) & 0xFF;
     result._data[1] = (uuid.Data1 >> 16) & 0xFF;
@@ -123,7 +324,7 @@ UUID UUID::Random()
     result._data[15] = uuid.Data4[7];
 #elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     uuid_t uuid;
-    uuid_generate_random(uuid);
+    uuid_generate_time(uuid);
 
     result._data[0] = uuid[0];
     result._data[1] = uuid[1];
@@ -149,6 +350,17 @@ UUID UUID::Random()
     return result;
 }
 
+UUID UUID::Random()
+{
+    UUID result;
+    Internals::RandomFill(result._data.data(), result._data.size());
+
+    // Version 4 and RFC 4122 variant
+    result._data[6] = (result._data[6] & 0x0F) | 0x40;
+    result._data[8] = (result._data[8] & 0x3F) | 0x80;
+    return result;
+}
+
 UUID UUID::Secure()
 {
     UUID result;
@@ -156,4 +368,41 @@ UUID UUID::Secure()
     return result;
 }
 
+UUID UUID::Ordered()
+{
+    // Last Unix time in milliseconds and the counter of the current thread
+    struct OrderedState
+    {
+        uint64_t milliseconds = 0;
+        uint32_t counter = 0;
+    };
+    thread_local OrderedState state;
+
+    uint8_t random[10];
+    Internals::RandomFill(random, sizeof(random));
+
+    // 12-bit counter keeps UUIDs monotonic in the same millisecond. It starts
+    // from a random value below 2048 and borrows the next millisecond on overflow.
+    uint64_t milliseconds = Timestamp::utc() / 1000000;
+    if (milliseconds > state.milliseconds)
+    {
+        state.milliseconds = milliseconds;
+        state.counter = ((random[0] << 8) | random[1]) & 0x07FF;
+    }
+    else if (++state.counter > 0x0FFF)
+    {
+        ++state.milliseconds;
+        state.counter = ((random[0] << 8) | random[1]) & 0x07FF;
+    }
+
+    UUID result;
+    for (size_t i = 0; i < 6; ++i)
+        result._data[i] = (uint8_t)(state.milliseconds >> (40 - i * 8));
+    result._data[6] = (uint8_t)(0x70 | (state.counter >> 8));
+    result._data[7] = (uint8_t)state.counter;
+    result._data[8] = (uint8_t)(0x80 | (random[2] & 0x3F));
+    std::memcpy(result._data.data() + 9, random + 3, 7);
+    return result;
+}
+
 } // namespace CppCommon
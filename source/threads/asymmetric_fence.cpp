@@ -0,0 +1,76 @@
+/*!
+    \file asymmetric_fence.cpp
+    \brief Asymmetric memory fence implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/asymmetric_fence.h"
+
+#include "errors/fatal.h"
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(SYS_membarrier)
+// Commands of membarrier() system call (linux/membarrier.h)
+const int MEMBARRIER_QUERY = 0;
+const int MEMBARRIER_PRIVATE_EXPEDITED = (1 << 3);
+const int MEMBARRIER_REGISTER_PRIVATE_EXPEDITED = (1 << 4);
+#endif
+
+bool AsymmetricFenceRegister() noexcept
+{
+    bool supported = false;
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(SYS_membarrier)
+    // Register the process for the private expedited command
+    long commands = syscall(SYS_membarrier, MEMBARRIER_QUERY, 0);
+    if ((commands > 0) && ((commands & MEMBARRIER_PRIVATE_EXPEDITED) != 0) && ((commands & MEMBARRIER_REGISTER_PRIVATE_EXPEDITED) != 0))
+        supported = (syscall(SYS_membarrier, MEMBARRIER_REGISTER_PRIVATE_EXPEDITED, 0) == 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    supported = true;
+#endif
+    asymmetric_fence_enabled.store(supported, std::memory_order_seq_cst);
+    return supported;
+}
+
+} // namespace Internals
+//! @endcond
+
+bool AsymmetricFence::Initialize() noexcept
+{
+    static bool supported = Internals::AsymmetricFenceRegister();
+    return supported;
+}
+
+void AsymmetricFence::Heavy() noexcept
+{
+    if (Initialize())
+    {
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(SYS_membarrier)
+        if (syscall(SYS_membarrier, Internals::MEMBARRIER_PRIVATE_EXPEDITED, 0) == 0)
+            return;
+
+        // Concurrent light fences are only compiler barriers, so the full fence cannot replace the heavy one
+        fatality("Failed to issue the heavy asymmetric fence of the registered process!");
+#elif defined(_WIN32) || defined(_WIN64)
+        FlushProcessWriteBuffers();
+        return;
+#endif
+    }
+
+    // Light fences are full fences without the operating system support
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+} // namespace CppCommon
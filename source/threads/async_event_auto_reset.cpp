@@ -0,0 +1,61 @@
+/*!
+    \file async_event_auto_reset.cpp
+    \brief Awaitable auto-reset event synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_event_auto_reset.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+AsyncEventAutoReset::~AsyncEventAutoReset()
+{
+    assert(_waiters.empty() && "Awaitable event is destroyed with suspended coroutines!");
+}
+
+void AsyncEventAutoReset::Signal()
+{
+    Internals::CoroutineWaiter* waiter;
+    {
+        Locker<CriticalSection> locker(_cs);
+        waiter = _waiters.Pop();
+        if (waiter == nullptr)
+        {
+            _signaled = true;
+            return;
+        }
+    }
+
+    // Resume the waiting coroutine outside the critical section
+    waiter->Resume();
+}
+
+bool AsyncEventAutoReset::TryWait()
+{
+    Locker<CriticalSection> locker(_cs);
+    bool result = _signaled;
+    _signaled = false;
+    return result;
+}
+
+bool AsyncEventAutoReset::Awaiter::await_suspend(std::coroutine_handle<> coroutine)
+{
+    Locker<CriticalSection> locker(_event._cs);
+
+    // Consume the signaled state without suspend
+    if (_event._signaled)
+    {
+        _event._signaled = false;
+        return false;
+    }
+
+    _waiter.Suspend(coroutine);
+    _event._waiters.Push(&_waiter);
+    return true;
+}
+
+} // namespace CppCommon
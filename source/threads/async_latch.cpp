@@ -0,0 +1,72 @@
+/*!
+    \file async_latch.cpp
+    \brief Awaitable latch synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_latch.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+AsyncLatch::AsyncLatch(int counter) noexcept : _counter(counter)
+{
+    assert((counter > 0) && "Latch counter must be greater than zero!");
+}
+
+AsyncLatch::~AsyncLatch()
+{
+    assert(_waiters.empty() && "Awaitable latch is destroyed with suspended coroutines!");
+}
+
+int AsyncLatch::counter() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _counter;
+}
+
+void AsyncLatch::Reset(int counter)
+{
+    assert((counter > 0) && "Latch counter must be greater than zero!");
+
+    Locker<CriticalSection> locker(_cs);
+    assert(_waiters.empty() && "Awaitable latch cannot be reset with suspended coroutines!");
+    _counter = counter;
+}
+
+void AsyncLatch::CountDown()
+{
+    Internals::CoroutineWaiter* waiters;
+    {
+        Locker<CriticalSection> locker(_cs);
+        if ((_counter == 0) || (--_counter > 0))
+            return;
+        waiters = _waiters.Release();
+    }
+
+    // Resume all waiting coroutines outside the critical section
+    while (waiters != nullptr)
+    {
+        // Take the next waiter before the resume which could destroy the current one
+        Internals::CoroutineWaiter* waiter = waiters;
+        waiters = waiters->next;
+        waiter->Resume();
+    }
+}
+
+bool AsyncLatch::Awaiter::await_suspend(std::coroutine_handle<> coroutine)
+{
+    Locker<CriticalSection> locker(_latch._cs);
+
+    if (_latch._counter == 0)
+        return false;
+
+    _waiter.Suspend(coroutine);
+    _latch._waiters.Push(&_waiter);
+    return true;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,132 @@
+/*!
+    \file combining_tree.cpp
+    \brief Combining tree layout implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/combining_tree.h"
+
+#include <algorithm>
+#include <map>
+
+namespace CppCommon {
+
+CombiningTree::CombiningTree(int participants, int fanin) : _leaves(participants, -1), _depth(0), _fanin(fanin)
+{
+    assert((participants > 0) && "Count of participants must be greater than zero!");
+    assert((fanin > 1) && "Fan-in of tree nodes must be greater than one!");
+
+    Build({});
+}
+
+CombiningTree::CombiningTree(const std::vector<int>& cpus, const CPUTopology& topology, int fanin) : _leaves(cpus.size(), -1), _depth(0), _fanin(fanin)
+{
+    assert(!cpus.empty() && "Count of participants must be greater than zero!");
+    assert((fanin > 1) && "Fan-in of tree nodes must be greater than one!");
+
+    // Grouping levels: physical core, L2 cache, L3 cache, socket
+    std::vector<std::vector<int>> levels(4, std::vector<int>(cpus.size()));
+    for (size_t i = 0; i < cpus.size(); ++i)
+    {
+        // Participants which are not pinned to the known CPU are not grouped
+        int unique = -(int)i - 1;
+        const CPULocation* location = (cpus[i] >= 0) ? topology.Find(cpus[i]) : nullptr;
+        if (location == nullptr)
+        {
+            for (auto& level : levels)
+                level[i] = unique;
+            continue;
+        }
+
+        int l2 = topology.SharedCache(cpus[i], 2).first();
+        int l3 = topology.SharedCache(cpus[i], 3).first();
+        levels[0][i] = (location->core >= 0) ? location->core : unique;
+        levels[1][i] = (l2 >= 0) ? l2 : unique;
+        levels[2][i] = (l3 >= 0) ? l3 : unique;
+        levels[3][i] = (location->socket >= 0) ? location->socket : unique;
+    }
+
+    Build(levels);
+}
+
+void CombiningTree::Build(const std::vector<std::vector<int>>& levels)
+{
+    std::vector<Unit> units;
+    units.reserve(_leaves.size());
+    for (int i = 0; i < participants(); ++i)
+        units.push_back({ i, -1 });
+
+    // Combine units of each group level by level
+    for (const auto& level : levels)
+    {
+        std::map<int, size_t> index;
+        std::vector<std::vector<Unit>> groups;
+        for (const auto& unit : units)
+        {
+            auto it = index.emplace(level[unit.participant], groups.size());
+            if (it.second)
+                groups.emplace_back();
+            groups[it.first->second].push_back(unit);
+        }
+
+        units.clear();
+        for (auto& group : groups)
+            units.push_back(Combine(group));
+    }
+
+    // Combine remaining units into the root node
+    Unit top = Combine(units);
+    if (top.node < 0)
+    {
+        _nodes.push_back({ -1, 1, 0 });
+        _leaves[top.participant] = 0;
+    }
+
+    // Parent nodes are always created after their children
+    for (int i = root(); i >= 0; --i)
+    {
+        int parent = _nodes[i].parent;
+        _nodes[i].depth = (parent < 0) ? 0 : (_nodes[parent].depth + 1);
+        _depth = std::max(_depth, _nodes[i].depth + 1);
+    }
+}
+
+CombiningTree::Unit CombiningTree::Combine(std::vector<Unit>& units)
+{
+    while (units.size() > 1)
+    {
+        // Split units into balanced chunks of at most fan-in units
+        size_t chunks = (units.size() + _fanin - 1) / _fanin;
+        std::vector<Unit> combined;
+        combined.reserve(chunks);
+        size_t first = 0;
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            size_t last = first + (units.size() - first) / (chunks - chunk);
+            if ((last - first) == 1)
+            {
+                combined.push_back(units[first]);
+                first = last;
+                continue;
+            }
+
+            int node = (int)_nodes.size();
+            _nodes.push_back({ -1, (int)(last - first), 0 });
+            for (size_t i = first; i < last; ++i)
+            {
+                if (units[i].node >= 0)
+                    _nodes[units[i].node].parent = node;
+                else
+                    _leaves[units[i].participant] = node;
+            }
+            combined.push_back({ units[first].participant, node });
+            first = last;
+        }
+        units.swap(combined);
+    }
+    return units.front();
+}
+
+} // namespace CppCommon
@@ -12,109 +12,279 @@
 
 #include <algorithm>
 
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-#include "errors/fatal.h"
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+#include "threads/futex.h"
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include "errors/exceptions.h"
 #include <pthread.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
+#include <time.h>
 #endif
 
 namespace CppCommon {
 
 //! @cond INTERNALS
 
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+
 class ConditionVariable::Impl
 {
 public:
-    Impl()
+    Impl() : _sequence(0), _waiters(0) {}
+
+    void NotifyOne()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_cond_init(&_cond, nullptr);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a condition variable!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        InitializeConditionVariable(&_cond);
-#endif
+        _sequence.fetch_add(1, std::memory_order_release);
+
+        // Pairs with the fence in Wait()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Enter the kernel only if there are blocked threads
+        if (_waiters.load(std::memory_order_relaxed) > 0)
+            Futex::WakeOne(_sequence);
     }
 
-    ~Impl()
+    void NotifyAll()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_cond_destroy(&_cond);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a condition variable!", result));
-#elif defined(_WIN32) || defined(_WIN64)
-        // Condition variables do not need to be explicitly destroyed.
-#endif
+        _sequence.fetch_add(1, std::memory_order_release);
+
+        // Pairs with the fence in Wait()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Enter the kernel only if there are blocked threads
+        if (_waiters.load(std::memory_order_relaxed) > 0)
+            Futex::WakeAll(_sequence);
     }
 
-    void NotifyOne()
+    void Wait(CriticalSection& cs)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_cond_signal(&_cond);
-        if (result != 0)
-            throwex SystemException("Failed to signal a condition variable!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        WakeConditionVariable(&_cond);
-#endif
+        // Register the blocked thread. Pairs with the fence in Notify()
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Sequence number is taken before the critical section is released, so notifications are not lost
+        uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+        uint32_t count = cs.ReleaseAll();
+        try
+        {
+            Futex::Wait(_sequence, sequence);
+        }
+        catch (...)
+        {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            cs.RestoreAll(count);
+            throw;
+        }
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        cs.RestoreAll(count);
     }
 
-    void NotifyAll()
+    bool TryWaitFor(CriticalSection& cs, const Timespan& timespan)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_cond_broadcast(&_cond);
-        if (result != 0)
-            throwex SystemException("Failed to broadcast a condition variable!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        WakeAllConditionVariable(&_cond);
-#endif
+        if (timespan < 0)
+            return false;
+
+        // Register the blocked thread. Pairs with the fence in Notify()
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Sequence number is taken before the critical section is released, so notifications are not lost
+        uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+        uint32_t count = cs.ReleaseAll();
+        bool result;
+        try
+        {
+            result = Futex::WaitFor(_sequence, sequence, timespan);
+        }
+        catch (...)
+        {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            cs.RestoreAll(count);
+            throw;
+        }
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        cs.RestoreAll(count);
+        return result;
     }
 
+private:
+    // Notification sequence number
+    std::atomic<uint32_t> _sequence;
+    // Count of blocked threads
+    std::atomic<uint32_t> _waiters;
+};
+
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+namespace Internals {
+
+// Mutex of condition variables waiting queues
+struct ConditionVariableBucket
+{
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+};
+
+// Condition variables are hashed by their addresses into the fixed table of mutex buckets
+ConditionVariableBucket& GetConditionVariableBucket(const void* address) noexcept
+{
+    static ConditionVariableBucket buckets[64];
+    return buckets[((uintptr_t)address >> 6) % 64];
+}
+
+// Waiting queue node of the blocked thread, each thread waits for one condition variable at a time
+struct ConditionVariableWaiter
+{
+    pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+    ConditionVariableWaiter* next = nullptr;
+    bool signaled = false;
+
+    ~ConditionVariableWaiter() { pthread_cond_destroy(&cond); }
+};
+
+thread_local ConditionVariableWaiter condition_variable_waiter;
+
+} // namespace Internals
+
+class ConditionVariable::Impl
+{
+public:
+    Impl() : _head(nullptr), _tail(nullptr) {}
+
+    void NotifyOne() { Notify(false); }
+    void NotifyAll() { Notify(true); }
+
     void Wait(CriticalSection& cs)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_cond_wait(&_cond, (pthread_mutex_t*)cs.native());
+        Internals::ConditionVariableBucket& bucket = Internals::GetConditionVariableBucket(this);
+        Internals::ConditionVariableWaiter& waiter = Internals::condition_variable_waiter;
+
+        // Bucket mutex is locked before the critical section is released, so notifications are not lost
+        int result = pthread_mutex_lock(&bucket.mutex);
         if (result != 0)
-            throwex SystemException("Failed to waiting a condition variable!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!SleepConditionVariableCS(&_cond, (CRITICAL_SECTION*)cs.native(), INFINITE))
-            throwex SystemException("Failed to waiting a condition variable!");
-#endif
+            throwex SystemException("Failed to lock a mutex!", result);
+        Enqueue(waiter);
+        uint32_t count = cs.ReleaseAll();
+        while (!waiter.signaled)
+        {
+            result = pthread_cond_wait(&waiter.cond, &bucket.mutex);
+            if (result != 0)
+                throwex SystemException("Failed to waiting a condition variable!", result);
+        }
+        result = pthread_mutex_unlock(&bucket.mutex);
+        if (result != 0)
+            throwex SystemException("Failed to unlock a mutex!", result);
+        cs.RestoreAll(count);
     }
 
     bool TryWaitFor(CriticalSection& cs, const Timespan& timespan)
     {
         if (timespan < 0)
             return false;
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         struct timespec timeout;
+#if defined(__APPLE__)
+        // Relative timeout
         timeout.tv_sec = timespan.seconds();
         timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_cond_timedwait(&_cond, (pthread_mutex_t*)cs.native(), &timeout);
-        if ((result != 0) && (result != ETIMEDOUT))
-            throwex SystemException("Failed to waiting a condition variable for the given timeout!", result);
-        return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!SleepConditionVariableCS(&_cond, (CRITICAL_SECTION*)cs.native(), std::max((DWORD)0, (DWORD)timespan.milliseconds())))
+#else
+        // Absolute timeout of the condition variable clock
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        int64_t deadline = (int64_t)timeout.tv_sec * 1000000000 + timeout.tv_nsec + timespan.total();
+        timeout.tv_sec = deadline / 1000000000;
+        timeout.tv_nsec = deadline % 1000000000;
+#endif
+        Internals::ConditionVariableBucket& bucket = Internals::GetConditionVariableBucket(this);
+        Internals::ConditionVariableWaiter& waiter = Internals::condition_variable_waiter;
+
+        // Bucket mutex is locked before the critical section is released, so notifications are not lost
+        int result = pthread_mutex_lock(&bucket.mutex);
+        if (result != 0)
+            throwex SystemException("Failed to lock a mutex!", result);
+        Enqueue(waiter);
+        uint32_t count = cs.ReleaseAll();
+        while (!waiter.signaled)
         {
-            if (GetLastError() != ERROR_TIMEOUT)
-                throwex SystemException("Failed to waiting a condition variable for the given timeout!");
-            return false;
-        }
-        return true;
+#if defined(__APPLE__)
+            result = pthread_cond_timedwait_relative_np(&waiter.cond, &bucket.mutex, &timeout);
+#else
+            result = pthread_cond_timedwait(&waiter.cond, &bucket.mutex, &timeout);
 #endif
+            if ((result != 0) && (result != ETIMEDOUT))
+                throwex SystemException("Failed to waiting a condition variable for the given timeout!", result);
+            if (result == ETIMEDOUT)
+                break;
+        }
+        bool notified = waiter.signaled;
+        if (!notified)
+            Dequeue(waiter);
+        result = pthread_mutex_unlock(&bucket.mutex);
+        if (result != 0)
+            throwex SystemException("Failed to unlock a mutex!", result);
+        cs.RestoreAll(count);
+        return notified;
     }
 
 private:
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    pthread_cond_t _cond;
-#elif defined(_WIN32) || defined(_WIN64)
-    CONDITION_VARIABLE _cond;
-#endif
+    // Queue of blocked threads in the waiting order (protected by the bucket mutex)
+    Internals::ConditionVariableWaiter* _head;
+    Internals::ConditionVariableWaiter* _tail;
+
+    void Enqueue(Internals::ConditionVariableWaiter& waiter) noexcept
+    {
+        waiter.next = nullptr;
+        waiter.signaled = false;
+        if (_tail != nullptr)
+            _tail->next = &waiter;
+        else
+            _head = &waiter;
+        _tail = &waiter;
+    }
+
+    void Dequeue(Internals::ConditionVariableWaiter& waiter) noexcept
+    {
+        Internals::ConditionVariableWaiter* previous = nullptr;
+        for (Internals::ConditionVariableWaiter* current = _head; current != nullptr; previous = current, current = current->next)
+        {
+            if (current == &waiter)
+            {
+                if (previous != nullptr)
+                    previous->next = current->next;
+                else
+                    _head = current->next;
+                if (_tail == current)
+                    _tail = previous;
+                return;
+            }
+        }
+    }
+
+    void Notify(bool all)
+    {
+        Internals::ConditionVariableBucket& bucket = Internals::GetConditionVariableBucket(this);
+
+        int result = pthread_mutex_lock(&bucket.mutex);
+        if (result != 0)
+            throwex SystemException("Failed to lock a mutex!", result);
+        // Wake only the dequeued threads, so other condition variables of the bucket are not disturbed
+        while (_head != nullptr)
+        {
+            Internals::ConditionVariableWaiter* waiter = _head;
+            _head = waiter->next;
+            if (_head == nullptr)
+                _tail = nullptr;
+            waiter->signaled = true;
+            result = pthread_cond_signal(&waiter->cond);
+            if (result != 0)
+                throwex SystemException("Failed to signal a condition variable!", result);
+            if (!all)
+                break;
+        }
+        result = pthread_mutex_unlock(&bucket.mutex);
+        if (result != 0)
+            throwex SystemException("Failed to unlock a mutex!", result);
+    }
 };
 
+#endif
+
 //! @endcond
 
 ConditionVariable::ConditionVariable()
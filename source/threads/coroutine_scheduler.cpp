@@ -0,0 +1,147 @@
+/*!
+    \file coroutine_scheduler.cpp
+    \brief Coroutine schedulers implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/coroutine_scheduler.h"
+
+#include "threads/timer_service.h"
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Coroutine scheduler of the current thread
+thread_local CoroutineScheduler* current_scheduler = nullptr;
+
+// Detached coroutine destroyed at its final suspend point
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+DetachedTask RunDetached(CoroutineScheduler& scheduler, Task<void> task)
+{
+    co_await scheduler.Schedule();
+    co_await task;
+}
+
+// Timer service shared by all sleeping coroutines
+TimerService& SleepTimers()
+{
+    static TimerService timers;
+    return timers;
+}
+
+} // namespace Internals
+//! @endcond
+
+CoroutineScheduler* CoroutineScheduler::Current() noexcept
+{
+    return Internals::current_scheduler;
+}
+
+void CoroutineScheduler::Spawn(Task<void> task)
+{
+    Internals::RunDetached(*this, std::move(task));
+}
+
+void CoroutineScheduler::Resume(std::coroutine_handle<> coroutine)
+{
+    CoroutineScheduler* previous = Internals::current_scheduler;
+    Internals::current_scheduler = this;
+    coroutine.resume();
+    Internals::current_scheduler = previous;
+}
+
+size_t SingleThreadScheduler::pending() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _ready.size();
+}
+
+void SingleThreadScheduler::Post(std::coroutine_handle<> coroutine)
+{
+    bool wakeup;
+    {
+        Locker<CriticalSection> locker(_cs);
+        wakeup = _ready.empty();
+        _ready.push_back(coroutine);
+    }
+
+    // Wake up the scheduler thread only for the first ready coroutine
+    if (wakeup)
+        _wakeup.Signal();
+}
+
+size_t SingleThreadScheduler::Poll()
+{
+    size_t result = 0;
+
+    for (;;)
+    {
+        {
+            Locker<CriticalSection> locker(_cs);
+            if (_ready.empty())
+                return result;
+            std::swap(_ready, _batch);
+        }
+
+        // Resume the batch of ready coroutines outside the critical section
+        for (auto coroutine : _batch)
+            Resume(coroutine);
+        result += _batch.size();
+        _batch.clear();
+    }
+}
+
+void SingleThreadScheduler::Run()
+{
+    while (!stopped())
+    {
+        if (Poll() == 0)
+            _wakeup.Wait();
+    }
+}
+
+void SingleThreadScheduler::Stop()
+{
+    _stopped.store(true, std::memory_order_release);
+    _wakeup.Signal();
+}
+
+void MultiThreadScheduler::Post(std::coroutine_handle<> coroutine)
+{
+    // Retry while the global injection queue of the thread pool is full
+    while (!_pool.Post([this, coroutine]() { Resume(coroutine); }))
+    {
+        if (_pool.stopped())
+            return;
+        Thread::Yield();
+    }
+}
+
+void SleepAwaiter::await_suspend(std::coroutine_handle<> coroutine)
+{
+    CoroutineScheduler* scheduler = CoroutineScheduler::Current();
+    Internals::SleepTimers().ScheduleAfter(_timespan, [scheduler, coroutine]()
+    {
+        if (scheduler != nullptr)
+            scheduler->Post(coroutine);
+        else
+            coroutine.resume();
+    });
+}
+
+} // namespace CppCommon
@@ -0,0 +1,186 @@
+/*!
+    \file cpu_sampler.cpp
+    \brief Thread CPU time sampler implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/cpu_sampler.h"
+
+#include "errors/exceptions.h"
+#include "time/timestamp.h"
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <pthread.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <pthread.h>
+#include <time.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Helper function to read the CPU clock of the registered thread
+bool ReadThreadClock(uint64_t clock, Timespan& cpu)
+{
+#if defined(__APPLE__)
+    thread_basic_info_data_t info;
+    mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+    if (thread_info((mach_port_t)clock, THREAD_BASIC_INFO, (thread_info_t)&info, &count) != KERN_SUCCESS)
+        return false;
+    cpu = Timespan::seconds(info.user_time.seconds + info.system_time.seconds) + Timespan::microseconds(info.user_time.microseconds + info.system_time.microseconds);
+    return true;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    struct timespec ts;
+    if (clock_gettime((clockid_t)clock, &ts) != 0)
+        return false;
+    cpu = Timespan::nanoseconds((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+    return true;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE hThread = (HANDLE)clock;
+    DWORD code;
+    if (!GetExitCodeThread(hThread, &code) || (code != STILL_ACTIVE))
+        return false;
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(hThread, &creation, &exit, &kernel, &user))
+        return false;
+    uint64_t total = ((((uint64_t)kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime) + ((((uint64_t)user.dwHighDateTime) << 32) | user.dwLowDateTime);
+    cpu = Timespan::nanoseconds((int64_t)total * 100);
+    return true;
+#endif
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+// Helper function to duplicate the thread handle, so it stays valid after the thread is joined
+uint64_t DuplicateThreadClock(HANDLE hThread)
+{
+    HANDLE hDuplicate;
+    if (!DuplicateHandle(GetCurrentProcess(), hThread, GetCurrentProcess(), &hDuplicate, THREAD_QUERY_LIMITED_INFORMATION, FALSE, 0))
+        throwex SystemException("Failed to duplicate the thread handle!");
+    return (uint64_t)hDuplicate;
+}
+#endif
+
+} // namespace Internals
+//! @endcond
+
+Timespan CpuSample::unattributed() const noexcept
+{
+    Timespan result = process.cpu();
+    for (const auto& thread : threads)
+        result -= thread.cpu;
+    return (result.total() > 0) ? result : Timespan::zero();
+}
+
+CpuSampler::CpuSampler() : _timestamp(Timestamp::nano()), _process(Process::CurrentUsage())
+{
+}
+
+CpuSampler::~CpuSampler()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    for (const auto& thread : _threads)
+        CloseHandle((HANDLE)thread.clock);
+#endif
+}
+
+size_t CpuSampler::size() const
+{
+    std::scoped_lock lock(_mutex);
+    return _threads.size();
+}
+
+void CpuSampler::Register(std::thread& thread, const std::string& name)
+{
+#if defined(__APPLE__)
+    Register(name, (uint64_t)pthread_mach_thread_np(thread.native_handle()));
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    clockid_t clock;
+    int result = pthread_getcpuclockid(thread.native_handle(), &clock);
+    if (result != 0)
+        throwex SystemException("Failed to get the given thread CPU clock!", result);
+    Register(name, (uint64_t)clock);
+#elif defined(_WIN32) || defined(_WIN64)
+    Register(name, Internals::DuplicateThreadClock((HANDLE)thread.native_handle()));
+#endif
+}
+
+void CpuSampler::RegisterCurrentThread(const std::string& name)
+{
+#if defined(__APPLE__)
+    Register(name, (uint64_t)pthread_mach_thread_np(pthread_self()));
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    clockid_t clock;
+    int result = pthread_getcpuclockid(pthread_self(), &clock);
+    if (result != 0)
+        throwex SystemException("Failed to get the current thread CPU clock!", result);
+    Register(name, (uint64_t)clock);
+#elif defined(_WIN32) || defined(_WIN64)
+    Register(name, Internals::DuplicateThreadClock(GetCurrentThread()));
+#endif
+}
+
+void CpuSampler::Register(std::string name, uint64_t clock)
+{
+    Entry entry{ std::move(name), clock, Timespan::zero(), true };
+    entry.alive = Internals::ReadThreadClock(clock, entry.last);
+
+    std::scoped_lock lock(_mutex);
+    _threads.emplace_back(std::move(entry));
+}
+
+CpuSample CpuSampler::Sample()
+{
+    CpuSample sample;
+
+    std::scoped_lock lock(_mutex);
+
+    // Read CPU clocks close to the timestamp
+    uint64_t timestamp = Timestamp::nano();
+    ProcessUsage process = Process::CurrentUsage();
+    sample.threads.reserve(_threads.size());
+    for (auto& thread : _threads)
+    {
+        CpuThreadSample result;
+        result.name = thread.name;
+        Timespan cpu;
+        if (thread.alive && Internals::ReadThreadClock(thread.clock, cpu))
+        {
+            result.cpu = cpu - thread.last;
+            thread.last = cpu;
+        }
+        else
+            thread.alive = false;
+        result.alive = thread.alive;
+        sample.threads.emplace_back(std::move(result));
+    }
+
+    sample.wall = Timespan::nanoseconds((int64_t)(timestamp - _timestamp));
+    for (auto& thread : sample.threads)
+        if (sample.wall.total() > 0)
+            thread.utilization = (double)thread.cpu.total() / (double)sample.wall.total();
+
+    // Process usage counters are differences, memory sizes are current
+    sample.process = process;
+    sample.process.user -= _process.user;
+    sample.process.system -= _process.system;
+    sample.process.minor_faults -= _process.minor_faults;
+    sample.process.major_faults -= _process.major_faults;
+    sample.process.voluntary_switches -= _process.voluntary_switches;
+    sample.process.involuntary_switches -= _process.involuntary_switches;
+    sample.process.read_bytes -= _process.read_bytes;
+    sample.process.write_bytes -= _process.write_bytes;
+
+    _timestamp = timestamp;
+    _process = process;
+
+    return sample;
+}
+
+} // namespace CppCommon
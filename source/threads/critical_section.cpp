@@ -8,151 +8,99 @@
 
 #include "threads/critical_section.h"
 
+#include "threads/futex.h"
 #include "threads/thread.h"
-#include "utility/validate_aligned_storage.h"
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-#include "errors/fatal.h"
-#include <pthread.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef Yield
-#endif
 
 namespace CppCommon {
 
 //! @cond INTERNALS
 
-class CriticalSection::Impl
-{
-public:
-    Impl()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        pthread_mutexattr_t mutex_attribute;
-        int result = pthread_mutexattr_init(&mutex_attribute);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a mutex attribute!", result);
-        result = pthread_mutexattr_settype(&mutex_attribute, PTHREAD_MUTEX_RECURSIVE);
-        if (result != 0)
-            throwex SystemException("Failed to set a mutex recursive attribute!", result);
-        result = pthread_mutex_init(&_lock, &mutex_attribute);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a mutex!", result);
-        result = pthread_mutexattr_destroy(&mutex_attribute);
-        if (result != 0)
-            throwex SystemException("Failed to destroy a mutex attribute!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        InitializeCriticalSection(&_lock);
-#endif
-    }
+namespace Internals {
 
-    ~Impl()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_destroy(&_lock);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a mutex!", result));
-#elif defined(_WIN32) || defined(_WIN64)
-        DeleteCriticalSection(&_lock);
-#endif
-    }
+static constexpr int CriticalSectionSpin = 100;
 
-    void* native() noexcept
-    {
-        return &_lock;
-    }
-
-    bool TryLock()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_trylock(&_lock);
-        if ((result != 0) && (result != EAGAIN) && (result != EBUSY) && (result != EDEADLK))
-            throwex SystemException("Failed to try lock a mutex!", result);
-        return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        return (TryEnterCriticalSection(&_lock) != 0);
-#endif
-    }
-
-    void Lock()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_lock);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        EnterCriticalSection(&_lock);
-#endif
-    }
-
-    void Unlock()
+// Try to acquire the critical section state with the bounded spinning
+bool CriticalSectionTryLockSpin(std::atomic<uint32_t>& state)
+{
+    for (int i = 0; i < CriticalSectionSpin; ++i)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_unlock(&_lock);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        LeaveCriticalSection(&_lock);
-#endif
+        uint32_t expected = 0;
+        if ((state.load(std::memory_order_relaxed) == 0) && state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+        Thread::Pause();
     }
+    return false;
+}
 
-private:
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    pthread_mutex_t _lock;
-#elif defined(_WIN32) || defined(_WIN64)
-    CRITICAL_SECTION _lock;
-#endif
-};
+} // namespace Internals
 
 //! @endcond
 
-CriticalSection::CriticalSection()
+CriticalSection::CriticalSection() : _state(0), _count(0), _owner(0)
 {
-    // Check implementation storage parameters
-    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
-    static_assert((StorageSize >= sizeof(Impl)), "CriticalSection::StorageSize must be increased!");
-    static_assert(((StorageAlign % alignof(Impl)) == 0), "CriticalSection::StorageAlign must be adjusted!");
-
-    // Create the implementation instance
-    new(&_storage)Impl();
 }
 
 CriticalSection::~CriticalSection()
 {
-    // Delete the implementation instance
-    reinterpret_cast<Impl*>(&_storage)->~Impl();
 }
 
-void* CriticalSection::native() noexcept { return impl().native(); }
-
-bool CriticalSection::TryLock() { return impl().TryLock(); }
-
 bool CriticalSection::TryLockFor(const Timespan& timespan)
 {
+    // Try to acquire critical section at least one time (also the recursive acquisition)
+    if (TryLock())
+        return true;
+
     // Calculate a finish timestamp
     Timestamp finish = NanoTimestamp() + timespan;
 
-    // Try to acquire critical section at least one time
-    if (TryLock())
-        return true;
-    else
+    // Try to acquire the critical section with the bounded spinning
+    if (!Internals::CriticalSectionTryLockSpin(_state))
     {
-        // Try lock or yield for the given timespan
-        while (NanoTimestamp() < finish)
+        // Mark the critical section as contended and block until it is released or the timeout expires
+        while (_state.exchange(2, std::memory_order_acquire) != 0)
         {
-            if (TryLock())
-                return true;
-            else
-                Thread::Yield();
-        }
+            Timestamp current = NanoTimestamp();
+            if (current >= finish)
+                return false;
 
-        // Failed to acquire critical section
-        return false;
+            Futex::WaitFor(_state, 2, finish - current);
+        }
     }
+
+    _owner.store(Internals::CurrentThreadTag(), std::memory_order_relaxed);
+    _count = 1;
+    return true;
+}
+
+void CriticalSection::LockSlow()
+{
+    if (Internals::CriticalSectionTryLockSpin(_state))
+        return;
+
+    // Mark the critical section as contended and block until it is released
+    while (_state.exchange(2, std::memory_order_acquire) != 0)
+        Futex::Wait(_state, 2);
+}
+
+void CriticalSection::UnlockSlow()
+{
+    Futex::WakeOne(_state);
+}
+
+uint32_t CriticalSection::ReleaseAll()
+{
+    assert((_owner.load(std::memory_order_relaxed) == Internals::CurrentThreadTag()) && "Critical section must be released by the owner thread!");
+
+    uint32_t count = _count;
+    _count = 1;
+    Unlock();
+    return count;
 }
 
-void CriticalSection::Lock() { impl().Lock(); }
-void CriticalSection::Unlock() { impl().Unlock(); }
+void CriticalSection::RestoreAll(uint32_t count)
+{
+    Lock();
+    _count = count;
+}
 
 } // namespace CppCommon
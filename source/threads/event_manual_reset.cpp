@@ -11,176 +11,189 @@
 #include "errors/fatal.h"
 #include "utility/validate_aligned_storage.h"
 
-#include <algorithm>
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+#include "threads/futex.h"
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <pthread.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
+#include <time.h>
 #endif
 
 namespace CppCommon {
 
 //! @cond INTERNALS
 
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+
+class EventManualReset::Impl
+{
+public:
+    void Signal(EventManualReset& event)
+    {
+        Futex::WakeAll(event._signaled);
+    }
+
+    bool TryWaitFor(EventManualReset& event, const Timespan& timespan)
+    {
+        // Calculate a finish timestamp
+        Timestamp finish = NanoTimestamp() + timespan;
+
+        // Register the blocked thread. Pairs with the fence in Signal()
+        event._waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Block until the event is signaled or the timeout expires
+        bool result = true;
+        while (!event.TryWait())
+        {
+            Timestamp current = NanoTimestamp();
+            if (current >= finish)
+            {
+                result = false;
+                break;
+            }
+
+            Futex::WaitFor(event._signaled, 0, finish - current);
+        }
+
+        event._waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    void Wait(EventManualReset& event)
+    {
+        // Register the blocked thread. Pairs with the fence in Signal()
+        event._waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Block until the event is signaled
+        while (!event.TryWait())
+            Futex::Wait(event._signaled, 0);
+
+        event._waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
 class EventManualReset::Impl
 {
 public:
-    Impl(bool signaled)
+    Impl()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = pthread_mutex_init(&_mutex, nullptr);
         if (result != 0)
             throwex SystemException("Failed to initialize a mutex for the manual-reset event!", result);
         result = pthread_cond_init(&_cond, nullptr);
         if (result != 0)
             throwex SystemException("Failed to initialize a conditional variable for the manual-reset event!", result);
-        _signaled = signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        _event = CreateEvent(nullptr, TRUE, signaled ? TRUE : FALSE, nullptr);
-        if (_event == nullptr)
-            throwex SystemException("Failed to create a manual-reset event!");
-#endif
     }
 
     ~Impl()
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = pthread_mutex_destroy(&_mutex);
         if (result != 0)
             fatality(SystemException("Failed to destroy a mutex for the manual-reset event!", result));
         result = pthread_cond_destroy(&_cond);
         if (result != 0)
             fatality(SystemException("Failed to destroy a conditional variable for the manual-reset event!", result));
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CloseHandle(_event))
-            fatality(SystemException("Failed to close a manual-reset event!"));
-#endif
     }
 
-    void Reset()
+    void Signal(EventManualReset&)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Blocked thread holds the parking mutex until it waits for the conditional variable
         int result = pthread_mutex_lock(&_mutex);
         if (result != 0)
             throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        _signaled = false;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!ResetEvent(_event))
-            throwex SystemException("Failed to reset a manual-reset event!");
-#endif
-    }
-
-    void Signal()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        _signaled = true;
-        result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
         result = pthread_cond_broadcast(&_cond);
         if (result != 0)
-            throwex SystemException("Failed to signal an manual-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!SetEvent(_event))
-            throwex SystemException("Failed to signal a manual-reset event!");
-#endif
-    }
-
-    bool TryWait()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        bool signaled = _signaled;
+            throwex SystemException("Failed to signal a manual-reset event!", result);
         result = pthread_mutex_unlock(&_mutex);
         if (result != 0)
             throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-        return signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a manual-reset event!");
-        return (result == WAIT_OBJECT_0);
-#endif
     }
 
-    bool TryWaitFor(const Timespan& timespan)
+    bool TryWaitFor(EventManualReset& event, const Timespan& timespan)
     {
-        if (timespan < 0)
-            return TryWait();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         struct timespec timeout;
+#if defined(__APPLE__)
+        // Relative timeout
         timeout.tv_sec = timespan.seconds();
         timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
+#else
+        // Absolute timeout of the conditional variable clock
+        clock_gettime(CLOCK_REALTIME, &timeout);
+        int64_t deadline = (int64_t)timeout.tv_sec * 1000000000 + timeout.tv_nsec + timespan.total();
+        timeout.tv_sec = deadline / 1000000000;
+        timeout.tv_nsec = deadline % 1000000000;
+#endif
         int result = pthread_mutex_lock(&_mutex);
         if (result != 0)
             throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
+
+        // Register the blocked thread. Pairs with the fence in Signal()
+        event._waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Block until the event is signaled or the timeout expires
         bool signaled = true;
-        while (!_signaled)
+        while (!event.TryWait())
         {
+#if defined(__APPLE__)
+            result = pthread_cond_timedwait_relative_np(&_cond, &_mutex, &timeout);
+#else
             result = pthread_cond_timedwait(&_cond, &_mutex, &timeout);
+#endif
             if ((result != 0) && (result != ETIMEDOUT))
                 throwex SystemException("Failed to timeout waiting a conditional variable for the manual-reset event!", result);
             if (result == ETIMEDOUT)
-                signaled = _signaled;
+            {
+                signaled = event.TryWait();
+                break;
+            }
         }
+
+        event._waiters.fetch_sub(1, std::memory_order_relaxed);
         result = pthread_mutex_unlock(&_mutex);
         if (result != 0)
             throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
         return signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a manual-reset event for the given timeout!");
-        return (result == WAIT_OBJECT_0);
-#endif
     }
 
-    void Wait()
+    void Wait(EventManualReset& event)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = pthread_mutex_lock(&_mutex);
         if (result != 0)
             throwex SystemException("Failed to lock a mutex for the manual-reset event!", result);
-        while (!_signaled)
+
+        // Register the blocked thread. Pairs with the fence in Signal()
+        event._waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Block until the event is signaled
+        while (!event.TryWait())
         {
             result = pthread_cond_wait(&_cond, &_mutex);
             if (result != 0)
                 throwex SystemException("Failed to waiting a conditional variable for the manual-reset event!", result);
         }
+
+        event._waiters.fetch_sub(1, std::memory_order_relaxed);
         result = pthread_mutex_unlock(&_mutex);
         if (result != 0)
             throwex SystemException("Failed to unlock a mutex for the manual-reset event!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_event, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock a manual-reset event!");
-#endif
     }
 
 private:
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Parking mutex and conditional variable of blocked threads
     pthread_mutex_t _mutex;
     pthread_cond_t _cond;
-    bool _signaled;
-#elif defined(_WIN32) || defined(_WIN64)
-    HANDLE _event;
-#endif
 };
 
+#endif
+
 //! @endcond
 
-EventManualReset::EventManualReset(bool signaled)
+EventManualReset::EventManualReset(bool signaled) : _signaled(signaled ? 1 : 0), _waiters(0)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -188,7 +201,7 @@ EventManualReset::EventManualReset(bool signaled)
     static_assert(((StorageAlign % alignof(Impl)) == 0), "EventManualReset::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(signaled);
+    new(&_storage)Impl();
 }
 
 EventManualReset::~EventManualReset()
@@ -197,12 +210,19 @@ EventManualReset::~EventManualReset()
     reinterpret_cast<Impl*>(&_storage)->~Impl();
 }
 
-void EventManualReset::Reset() { impl().Reset(); }
-void EventManualReset::Signal() { impl().Signal(); }
+bool EventManualReset::TryWaitFor(const Timespan& timespan)
+{
+    // Uncontended path is a single atomic operation
+    if (TryWait())
+        return true;
+
+    if (timespan < 0)
+        return false;
 
-bool EventManualReset::TryWait() { return impl().TryWait(); }
-bool EventManualReset::TryWaitFor(const Timespan& timespan) { return impl().TryWaitFor(timespan); }
+    return impl().TryWaitFor(*this, timespan);
+}
 
-void EventManualReset::Wait() { impl().Wait(); }
+void EventManualReset::SignalSlow() { impl().Signal(*this); }
+void EventManualReset::WaitSlow() { impl().Wait(*this); }
 
 } // namespace CppCommon
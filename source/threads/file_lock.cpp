@@ -9,13 +9,24 @@
 #include "threads/file_lock.h"
 
 #include "errors/fatal.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
 #include "threads/thread.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include <sys/file.h>
 #include <fcntl.h>
 #include <unistd.h>
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#endif
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef Yield
@@ -32,13 +43,126 @@ namespace CppCommon {
 #define F_OFD_SETLKW 38
 #endif
 
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+// Real-time signal used to interrupt blocking file-lock waits at the deadline
+#ifndef CPPCOMMON_FILE_LOCK_SIGNAL
+#define CPPCOMMON_FILE_LOCK_SIGNAL (SIGRTMAX - 1)
+#endif
+
+namespace Internals {
+
+void FileLockSignalHandler([[maybe_unused]] int signo) {}
+
+// Check if the blocking file-lock wait of the current thread might be interrupted by the timer signal
+bool FileLockInterruptible()
+{
+    static bool installed = []()
+    {
+        struct sigaction action;
+        if (sigaction(CPPCOMMON_FILE_LOCK_SIGNAL, nullptr, &action) != 0)
+            return false;
+        if (!(action.sa_flags & SA_SIGINFO) && (action.sa_handler == FileLockSignalHandler))
+            return true;
+
+        // Do not override the signal handler installed by the application
+        if ((action.sa_flags & SA_SIGINFO) || (action.sa_handler != SIG_DFL))
+            return false;
+
+        // Install the handler without SA_RESTART, so the blocking wait fails with EINTR
+        std::memset(&action, 0, sizeof(action));
+        action.sa_handler = FileLockSignalHandler;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = 0;
+        return (sigaction(CPPCOMMON_FILE_LOCK_SIGNAL, &action, nullptr) == 0);
+    }();
+
+    if (!installed)
+        return false;
+
+    // Blocked signal will never interrupt the wait
+    sigset_t mask;
+    if (pthread_sigmask(SIG_BLOCK, nullptr, &mask) != 0)
+        return false;
+    return (sigismember(&mask, CPPCOMMON_FILE_LOCK_SIGNAL) == 0);
+}
+
+//! Interrupter of the blocking file-lock wait of the current thread
+/*!
+    Helper thread sends the signal to the waiting thread at the deadline and
+    repeats it every millisecond till the wait is finished, so the signal
+    delivered right before the wait is blocked in the kernel is not lost.
+    Destructor stops the helper thread and drains pending signals, so they
+    never interrupt unrelated system calls of the waiting thread.
+*/
+class FileLockInterrupter
+{
+public:
+    explicit FileLockInterrupter(const Timespan& timespan) : _waiter(pthread_self()), _finished(false)
+    {
+        _helper = Thread::Start([this, timespan]() { Interrupt(timespan); });
+    }
+    FileLockInterrupter(const FileLockInterrupter&) = delete;
+    FileLockInterrupter(FileLockInterrupter&&) = delete;
+    ~FileLockInterrupter()
+    {
+        // Stop the helper thread
+        _cs.Lock();
+        _finished = true;
+        _cs.Unlock();
+        _cv.NotifyOne();
+        _helper.join();
+
+        // Drain pending signals sent to the current thread
+        sigset_t signals;
+        sigset_t mask;
+        sigemptyset(&signals);
+        sigaddset(&signals, CPPCOMMON_FILE_LOCK_SIGNAL);
+        if (pthread_sigmask(SIG_BLOCK, &signals, &mask) == 0)
+        {
+            struct timespec immediate = { 0, 0 };
+            while ((sigtimedwait(&signals, nullptr, &immediate) == CPPCOMMON_FILE_LOCK_SIGNAL) || (errno == EINTR)) {}
+            pthread_sigmask(SIG_SETMASK, &mask, nullptr);
+        }
+    }
+
+    FileLockInterrupter& operator=(const FileLockInterrupter&) = delete;
+    FileLockInterrupter& operator=(FileLockInterrupter&&) = delete;
+
+private:
+    pthread_t _waiter;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    bool _finished;
+    std::thread _helper;
+
+    void Interrupt(const Timespan& timespan)
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        // Wait for the deadline
+        if (_cv.TryWaitFor(_cs, timespan, [this]() { return _finished; }))
+            return;
+
+        // Interrupt the wait till it is finished
+        do
+        {
+            pthread_kill(_waiter, CPPCOMMON_FILE_LOCK_SIGNAL);
+        } while (!_cv.TryWaitFor(_cs, Timespan::milliseconds(1), [this]() { return _finished; }));
+    }
+};
+
+} // namespace Internals
+
+#endif
+
 class FileLock::Impl
 {
 public:
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-    Impl() : _file(0) {}
+    Impl() : _file(0), _temporary(true) {}
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    Impl() : _file(nullptr) {}
+    Impl() : _file(nullptr), _temporary(true) {}
 #endif
 
     ~Impl()
@@ -55,24 +179,28 @@ public:
 
     const Path& path() const noexcept { return _path; }
 
-    void Assign(const Path& path)
+    void Assign(const Path& path, bool temporary)
     {
         // Reset the previous file-lock
         Reset();
 
         _path = path;
+        _temporary = temporary;
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         _file = open(_path.string().c_str(), O_CREAT | O_RDWR, 0644);
         if (_file < 0)
             throwex FileSystemException("Cannot create or open file-lock file!").Attach(path);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+        // Overlapped handle is required to wait for the lock with a timeout
+        const DWORD flags = FILE_FLAG_OVERLAPPED | (_temporary ? (FILE_ATTRIBUTE_HIDDEN | FILE_FLAG_DELETE_ON_CLOSE) : FILE_ATTRIBUTE_NORMAL);
+
         // Retries in CreateFile, see http://support.microsoft.com/kb/316609
         const std::wstring wpath = _path.wstring();
         const int attempts = 1000;
         const int sleep = 100;
         for (int attempt = 0; attempt < attempts; ++attempt)
         {
-            _file = CreateFileW(wpath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_HIDDEN | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+            _file = CreateFileW(wpath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, flags, nullptr);
             if (_file == INVALID_HANDLE_VALUE)
             {
                 Sleep(sleep);
@@ -95,8 +223,9 @@ public:
             fatality(FileSystemException("Cannot close the file-lock descriptor!").Attach(_path));
         _file = 0;
 
-        // Remove the file-lock file
-        unlink(_path.string().c_str());
+        // Remove the temporary file-lock file
+        if (_temporary)
+            unlink(_path.string().c_str());
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!CloseHandle(_file))
             fatality(FileSystemException("Cannot close the file-lock handle!").Attach(_path));
@@ -104,182 +233,221 @@ public:
 #endif
     }
 
-    bool TryLockRead()
+    // Zero size means the whole file
+    bool TryLock(bool exclusive, uint64_t offset, uint64_t size)
     {
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        struct flock lock;
-        lock.l_type = F_RDLCK;
-        lock.l_whence = SEEK_SET;
-        lock.l_start = 0;
-        lock.l_len = 0;
-        lock.l_pid = 0;
-        int result = fcntl(_file, F_OFD_SETLK, &lock);
-        if (result == -1)
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if !defined(linux) && !defined(__linux) && !defined(__linux__)
+        if (size == 0)
         {
-           if  (errno == EAGAIN)
-               return false;
-           else
-               throwex FileSystemException("Failed to try lock for read!").Attach(_path);
-        }
-        else
+            int result = flock(_file, (exclusive ? LOCK_EX : LOCK_SH) | LOCK_NB);
+            if (result != 0)
+            {
+                if (errno == EWOULDBLOCK)
+                    return false;
+                else
+                    throwex FileSystemException(exclusive ? "Failed to try lock for write!" : "Failed to try lock for read!").Attach(_path);
+            }
             return true;
-#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = flock(_file, LOCK_SH | LOCK_NB);
-        if (result != 0)
+        }
+#endif
+        struct flock lock = Range(exclusive ? F_WRLCK : F_RDLCK, offset, size);
+        int result = fcntl(_file, SETLK, &lock);
+        if (result == -1)
         {
-           if  (errno == EWOULDBLOCK)
-               return false;
-           else
-               throwex FileSystemException("Failed to try lock for read!").Attach(_path);
+            if ((errno == EAGAIN) || (errno == EACCES))
+                return false;
+            else
+                throwex FileSystemException(exclusive ? "Failed to try lock for write!" : "Failed to try lock for read!").Attach(_path);
         }
-        else
-            return true;
+        return true;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        OVERLAPPED overlapped;
-        ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-        return LockFileEx(_file, LOCKFILE_FAIL_IMMEDIATELY, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+        return Wait((exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0) | LOCKFILE_FAIL_IMMEDIATELY, offset, size, INFINITE, exclusive ? "Failed to try lock for write!" : "Failed to try lock for read!");
 #endif
     }
 
-    bool TryLockWrite()
+    bool TryLockFor(bool exclusive, uint64_t offset, uint64_t size, const Timespan& timespan)
     {
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        struct flock lock;
-        lock.l_type = F_WRLCK;
-        lock.l_whence = SEEK_SET;
-        lock.l_start = 0;
-        lock.l_len = 0;
-        lock.l_pid = 0;
-        int result = fcntl(_file, F_OFD_SETLK, &lock);
-        if (result == -1)
-        {
-           if  (errno == EAGAIN)
-               return false;
-           else
-               throwex FileSystemException("Failed to try lock for write!").Attach(_path);
-        }
-        else
+        // Calculate a finish timestamp
+        Timestamp finish = NanoTimestamp() + timespan;
+
+        // Try to acquire the lock at least one time
+        if (TryLock(exclusive, offset, size))
             return true;
-#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = flock(_file, LOCK_EX | LOCK_NB);
-        if (result != 0)
+        if (timespan.total() <= 0)
+            return false;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        // Block in the kernel and interrupt the wait with the signal sent to the current thread at the deadline
+        if (Internals::FileLockInterruptible())
         {
-           if  (errno == EWOULDBLOCK)
-               return false;
-           else
-               throwex FileSystemException("Failed to try lock for write!").Attach(_path);
+            bool locked = false;
+            int error = 0;
+            {
+                Internals::FileLockInterrupter interrupter(finish - NanoTimestamp());
+                for (;;)
+                {
+                    struct flock lock = Range(exclusive ? F_WRLCK : F_RDLCK, offset, size);
+                    if (fcntl(_file, F_OFD_SETLKW, &lock) == 0)
+                    {
+                        locked = true;
+                        break;
+                    }
+                    if (errno != EINTR)
+                    {
+                        error = errno;
+                        break;
+                    }
+                    if (NanoTimestamp() >= finish)
+                        break;
+                }
+            }
+            if (error != 0)
+                throwex FileSystemException(exclusive ? "Failed to lock for write!" : "Failed to lock for read!", error).Attach(_path);
+            return locked;
         }
-        else
-            return true;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        OVERLAPPED overlapped;
-        ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-        return LockFileEx(_file, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+        // Wait for the overlapped lock request with a timeout
+        int64_t milliseconds = (timespan.total() + 999999) / 1000000;
+        return Wait(exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, offset, size, (DWORD)std::min<int64_t>(milliseconds, INFINITE - 1), exclusive ? "Failed to lock for write!" : "Failed to lock for read!");
 #endif
+
+        // Try lock or sleep with exponential backoff for the given timespan
+        int64_t backoff = Timespan::microseconds(50).total();
+        for (;;)
+        {
+            int64_t remaining = (finish - NanoTimestamp()).total();
+            if (remaining <= 0)
+                return false;
+            Thread::SleepFor(Timespan(std::min(backoff, remaining)));
+            if (TryLock(exclusive, offset, size))
+                return true;
+            backoff = std::min(backoff * 2, Timespan::milliseconds(10).total());
+        }
     }
 
-    void LockRead()
+    void Lock(bool exclusive, uint64_t offset, uint64_t size)
     {
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        struct flock lock;
-        lock.l_type = F_RDLCK;
-        lock.l_whence = SEEK_SET;
-        lock.l_start = 0;
-        lock.l_len = 0;
-        lock.l_pid = 0;
-        int result = fcntl(_file, F_OFD_SETLKW, &lock);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if !defined(linux) && !defined(__linux) && !defined(__linux__)
+        if (size == 0)
+        {
+            int result = flock(_file, exclusive ? LOCK_EX : LOCK_SH);
+            if (result != 0)
+                throwex FileSystemException(exclusive ? "Failed to lock for write!" : "Failed to lock for read!").Attach(_path);
+            return;
+        }
+#endif
+        struct flock lock = Range(exclusive ? F_WRLCK : F_RDLCK, offset, size);
+        int result;
+        do
+        {
+            result = fcntl(_file, SETLKW, &lock);
+        } while ((result == -1) && (errno == EINTR));
         if (result == -1)
-            throwex FileSystemException("Failed to lock for read!").Attach(_path);
-#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = flock(_file, LOCK_SH);
-        if (result != 0)
-            throwex FileSystemException("Failed to lock for read!").Attach(_path);
+            throwex FileSystemException(exclusive ? "Failed to lock for write!" : "Failed to lock for read!").Attach(_path);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        OVERLAPPED overlapped;
-        ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-        if (!LockFileEx(_file, 0, 0, MAXDWORD, MAXDWORD, &overlapped))
-            throwex FileSystemException("Failed to lock for read!").Attach(_path);
+        Wait(exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, offset, size, INFINITE, exclusive ? "Failed to lock for write!" : "Failed to lock for read!");
 #endif
     }
 
-    void LockWrite()
+    void Unlock(bool exclusive, uint64_t offset, uint64_t size)
     {
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        struct flock lock;
-        lock.l_type = F_WRLCK;
-        lock.l_whence = SEEK_SET;
-        lock.l_start = 0;
-        lock.l_len = 0;
-        lock.l_pid = 0;
-        int result = fcntl(_file, F_OFD_SETLKW, &lock);
-        if (result == -1)
-            throwex FileSystemException("Failed to lock for write!").Attach(_path);
-#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = flock(_file, LOCK_EX);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if !defined(linux) && !defined(__linux) && !defined(__linux__)
+        if (size == 0)
+        {
+            int result = flock(_file, LOCK_UN);
+            if (result != 0)
+                throwex FileSystemException(exclusive ? "Failed to unlock the write lock!" : "Failed to unlock the read lock!").Attach(_path);
+            return;
+        }
+#endif
+        struct flock lock = Range(F_UNLCK, offset, size);
+        int result = fcntl(_file, SETLK, &lock);
         if (result != 0)
-            throwex FileSystemException("Failed to lock for write!").Attach(_path);
+            throwex FileSystemException(exclusive ? "Failed to unlock the write lock!" : "Failed to unlock the read lock!").Attach(_path);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         OVERLAPPED overlapped;
         ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-        if (!LockFileEx(_file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped))
-            throwex FileSystemException("Failed to lock for write!").Attach(_path);
+        overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)(offset >> 32);
+        if (!UnlockFileEx(_file, 0, SizeLow(size), SizeHigh(size), &overlapped))
+            throwex FileSystemException(exclusive ? "Failed to unlock the write lock!" : "Failed to unlock the read lock!").Attach(_path);
 #endif
     }
 
-    void UnlockRead()
-    {
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        struct flock lock;
-        lock.l_type = F_UNLCK;
-        lock.l_whence = SEEK_SET;
-        lock.l_start = 0;
-        lock.l_len = 0;
-        lock.l_pid = 0;
-        int result = fcntl(_file, F_OFD_SETLK, &lock);
-        if (result != 0)
-            throwex FileSystemException("Failed to unlock the read lock!").Attach(_path);
-#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = flock(_file, LOCK_UN);
-        if (result != 0)
-            throwex FileSystemException("Failed to unlock the read lock!").Attach(_path);
+private:
+    Path _path;
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    int _file;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        OVERLAPPED overlapped;
-        ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-        if (!UnlockFileEx(_file, 0, MAXDWORD, MAXDWORD, &overlapped))
-            throwex FileSystemException("Failed to unlock the read lock!").Attach(_path);
+    HANDLE _file;
 #endif
-    }
+    bool _temporary;
 
-    void UnlockWrite()
-    {
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #if defined(linux) || defined(__linux) || defined(__linux__)
+    // Open file description locks are owned by the descriptor, so threads of one process exclude each other
+    static const int SETLK = F_OFD_SETLK;
+    static const int SETLKW = F_OFD_SETLKW;
+#else
+    // Classic record locks are owned by the process
+    static const int SETLK = F_SETLK;
+    static const int SETLKW = F_SETLKW;
+#endif
+
+    static struct flock Range(short type, uint64_t offset, uint64_t size) noexcept
+    {
         struct flock lock;
-        lock.l_type = F_UNLCK;
+        std::memset(&lock, 0, sizeof(lock));
+        lock.l_type = type;
         lock.l_whence = SEEK_SET;
-        lock.l_start = 0;
-        lock.l_len = 0;
+        lock.l_start = (off_t)offset;
+        lock.l_len = (off_t)size;
         lock.l_pid = 0;
-        int result = fcntl(_file, F_OFD_SETLK, &lock);
-        if (result != 0)
-            throwex FileSystemException("Failed to unlock the write lock!").Attach(_path);
-#elif (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = flock(_file, LOCK_UN);
-        if (result != 0)
-            throwex FileSystemException("Failed to unlock the write lock!").Attach(_path);
-#elif defined(_WIN32) || defined(_WIN64)  || defined(__CYGWIN__)
+        return lock;
+    }
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    static DWORD SizeLow(uint64_t size) noexcept { return (size == 0) ? MAXDWORD : (DWORD)(size & 0xFFFFFFFF); }
+    static DWORD SizeHigh(uint64_t size) noexcept { return (size == 0) ? MAXDWORD : (DWORD)(size >> 32); }
+
+    // Request the lock on the overlapped handle and wait for it with the given timeout in milliseconds
+    bool Wait(DWORD flags, uint64_t offset, uint64_t size, DWORD timeout, const char* message)
+    {
         OVERLAPPED overlapped;
         ZeroMemory(&overlapped, sizeof(OVERLAPPED));
-        if (!UnlockFileEx(_file, 0, MAXDWORD, MAXDWORD, &overlapped))
-            throwex FileSystemException("Failed to unlock the write lock!").Attach(_path);
-#endif
-    }
+        overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)(offset >> 32);
+        overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (overlapped.hEvent == nullptr)
+            throwex FileSystemException(message).Attach(_path);
+
+        bool locked = (LockFileEx(_file, flags, 0, SizeLow(size), SizeHigh(size), &overlapped) != 0);
+        if (!locked)
+        {
+            DWORD error = GetLastError();
+            if (error == ERROR_IO_PENDING)
+            {
+                if (WaitForSingleObject(overlapped.hEvent, timeout) == WAIT_TIMEOUT)
+                    CancelIoEx(_file, &overlapped);
+
+                // The lock might be granted concurrently with the cancellation
+                DWORD transferred;
+                locked = (GetOverlappedResult(_file, &overlapped, &transferred, TRUE) != 0);
+                if (!locked)
+                    error = GetLastError();
+            }
+            if (!locked && (error != ERROR_LOCK_VIOLATION) && (error != ERROR_OPERATION_ABORTED))
+            {
+                CloseHandle(overlapped.hEvent);
+                throwex FileSystemException(message).Attach(_path);
+            }
+        }
 
-private:
-    Path _path;
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-    int _file;
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    HANDLE _file;
+        CloseHandle(overlapped.hEvent);
+        return locked;
+    }
 #endif
 };
 
@@ -296,17 +464,9 @@ FileLock::FileLock()
     new(&_storage)Impl();
 }
 
-FileLock::FileLock(const Path& path) : FileLock()
+FileLock::FileLock(const Path& path, bool temporary) : FileLock()
 {
-    // Check implementation storage parameters
-    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
-    static_assert((StorageSize >= sizeof(Impl)), "FileLock::StorageSize must be increased!");
-    static_assert(((StorageAlign % alignof(Impl)) == 0), "FileLock::StorageAlign must be adjusted!");
-
-    // Create the implementation instance
-    new(&_storage)Impl();
-
-    Assign(path);
+    Assign(path, temporary);
 }
 
 FileLock::~FileLock()
@@ -323,63 +483,64 @@ FileLock& FileLock::operator=(const Path& path)
 
 const Path& FileLock::path() const noexcept { return impl().path(); }
 
-void FileLock::Assign(const Path& path) { impl().Assign(path); }
+void FileLock::Assign(const Path& path, bool temporary) { impl().Assign(path, temporary); }
 void FileLock::Reset() { impl().Reset(); }
 
-bool FileLock::TryLockRead() { return impl().TryLockRead(); }
-bool FileLock::TryLockWrite() { return impl().TryLockWrite(); }
+bool FileLock::TryLockRead() { return impl().TryLock(false, 0, 0); }
+bool FileLock::TryLockWrite() { return impl().TryLock(true, 0, 0); }
+bool FileLock::TryLockReadFor(const Timespan& timespan) { return impl().TryLockFor(false, 0, 0, timespan); }
+bool FileLock::TryLockWriteFor(const Timespan& timespan) { return impl().TryLockFor(true, 0, 0, timespan); }
+void FileLock::LockRead() { impl().Lock(false, 0, 0); }
+void FileLock::LockWrite() { impl().Lock(true, 0, 0); }
+void FileLock::UnlockRead() { impl().Unlock(false, 0, 0); }
+void FileLock::UnlockWrite() { impl().Unlock(true, 0, 0); }
 
-bool FileLock::TryLockReadFor(const Timespan& timespan)
+bool FileLock::TryLockRead(uint64_t offset, uint64_t size)
 {
-    // Calculate a finish timestamp
-    Timestamp finish = NanoTimestamp() + timespan;
+    assert((size > 0) && "File-lock range must not be empty!");
+    return impl().TryLock(false, offset, size);
+}
 
-    // Try to acquire read lock at least one time
-    if (TryLockRead())
-        return true;
-    else
-    {
-        // Try lock or yield for the given timespan
-        while (NanoTimestamp() < finish)
-        {
-            if (TryLockRead())
-                return true;
-            else
-                Thread::Yield();
-        }
+bool FileLock::TryLockWrite(uint64_t offset, uint64_t size)
+{
+    assert((size > 0) && "File-lock range must not be empty!");
+    return impl().TryLock(true, offset, size);
+}
 
-        // Failed to acquire read lock
-        return false;
-    }
+bool FileLock::TryLockReadFor(uint64_t offset, uint64_t size, const Timespan& timespan)
+{
+    assert((size > 0) && "File-lock range must not be empty!");
+    return impl().TryLockFor(false, offset, size, timespan);
 }
 
-bool FileLock::TryLockWriteFor(const Timespan& timespan)
+bool FileLock::TryLockWriteFor(uint64_t offset, uint64_t size, const Timespan& timespan)
 {
-    // Calculate a finish timestamp
-    Timestamp finish = NanoTimestamp() + timespan;
+    assert((size > 0) && "File-lock range must not be empty!");
+    return impl().TryLockFor(true, offset, size, timespan);
+}
 
-    // Try to acquire write lock at least one time
-    if (TryLockWrite())
-        return true;
-    else
-    {
-        // Try lock or yield for the given timespan
-        while (NanoTimestamp() < finish)
-        {
-            if (TryLockWrite())
-                return true;
-            else
-                Thread::Yield();
-        }
+void FileLock::LockRead(uint64_t offset, uint64_t size)
+{
+    assert((size > 0) && "File-lock range must not be empty!");
+    impl().Lock(false, offset, size);
+}
 
-        // Failed to acquire write lock
-        return false;
-    }
+void FileLock::LockWrite(uint64_t offset, uint64_t size)
+{
+    assert((size > 0) && "File-lock range must not be empty!");
+    impl().Lock(true, offset, size);
 }
 
-void FileLock::LockRead() { impl().LockRead(); }
-void FileLock::LockWrite() { impl().LockWrite(); }
-void FileLock::UnlockRead() { impl().UnlockRead(); }
-void FileLock::UnlockWrite() { impl().UnlockWrite(); }
+void FileLock::UnlockRead(uint64_t offset, uint64_t size)
+{
+    assert((size > 0) && "File-lock range must not be empty!");
+    impl().Unlock(false, offset, size);
+}
+
+void FileLock::UnlockWrite(uint64_t offset, uint64_t size)
+{
+    assert((size > 0) && "File-lock range must not be empty!");
+    impl().Unlock(true, offset, size);
+}
 
 } // namespace CppCommon
@@ -0,0 +1,463 @@
+/*!
+    \file futex.cpp
+    \brief Futex address wait/wake primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/futex.h"
+
+#include "errors/exceptions.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+#include <climits>
+#include <new>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <ctime>
+#endif
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <cerrno>
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#include <windows.h>
+#undef Yield
+#undef max
+#undef min
+#if defined(_MSC_VER)
+#pragma comment(lib, "synchronization.lib")
+#endif
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if !defined(linux) && !defined(__linux) && !defined(__linux__)
+
+// Poll the shared futex address with the sleeping backoff while it contains the expected value (negative timeout is infinite)
+bool FutexPollShared(std::atomic<uint32_t>& address, uint32_t expected, int64_t timeout)
+{
+    Timestamp finish = NanoTimestamp() + timeout;
+    int64_t backoff = Timespan::microseconds(1).total();
+    while (address.load(std::memory_order_acquire) == expected)
+    {
+        int64_t sleep = backoff;
+        if (timeout >= 0)
+        {
+            int64_t remaining = (finish - NanoTimestamp()).total();
+            if (remaining <= 0)
+                return false;
+            sleep = std::min(sleep, remaining);
+        }
+        Thread::SleepFor(Timespan(sleep));
+        backoff = std::min(backoff * 2, Timespan::milliseconds(1).total());
+    }
+    return true;
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+void Futex::Wait(std::atomic<uint32_t>& address, uint32_t expected, bool shared)
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    long result = syscall(SYS_futex, (uint32_t*)&address, shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+    if ((result != 0) && (errno != EAGAIN) && (errno != EINTR))
+        throwex SystemException("Failed to wait on the futex address!");
+#else
+    if (shared)
+    {
+        Internals::FutexPollShared(address, expected, -1);
+        return;
+    }
+#if defined(_WIN32) || defined(_WIN64)
+    if (!WaitOnAddress((volatile VOID*)&address, &expected, sizeof(uint32_t), INFINITE))
+        throwex SystemException("Failed to wait on the address!");
+#else
+    address.wait(expected, std::memory_order_acquire);
+#endif
+#endif
+}
+
+bool Futex::WaitFor(std::atomic<uint32_t>& address, uint32_t expected, const Timespan& timespan, bool shared)
+{
+    if (timespan <= 0)
+        return (address.load(std::memory_order_acquire) != expected);
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = timespan.seconds();
+    timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
+    long result = syscall(SYS_futex, (uint32_t*)&address, shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+    if ((result != 0) && (errno != EAGAIN) && (errno != EINTR) && (errno != ETIMEDOUT))
+        throwex SystemException("Failed to wait on the futex address for the given timeout!");
+    return ((result == 0) || (errno != ETIMEDOUT));
+#else
+    if (shared)
+        return Internals::FutexPollShared(address, expected, timespan.total());
+#if defined(_WIN32) || defined(_WIN64)
+    if (!WaitOnAddress((volatile VOID*)&address, &expected, sizeof(uint32_t), std::max((DWORD)1, (DWORD)timespan.milliseconds())))
+    {
+        if (GetLastError() != ERROR_TIMEOUT)
+            throwex SystemException("Failed to wait on the address for the given timeout!");
+        return false;
+    }
+    return true;
+#else
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Yield while the address contains the expected value
+    while (address.load(std::memory_order_acquire) == expected)
+    {
+        if (NanoTimestamp() >= finish)
+            return false;
+        Thread::Yield();
+    }
+    return true;
+#endif
+#endif
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& address, bool shared)
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    long result = syscall(SYS_futex, (uint32_t*)&address, shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    if (result < 0)
+        throwex SystemException("Failed to wake the futex address!");
+#else
+    // Shared addresses are polled by waiters
+    if (shared)
+        return;
+#if defined(_WIN32) || defined(_WIN64)
+    WakeByAddressSingle((PVOID)&address);
+#else
+    address.notify_one();
+#endif
+#endif
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& address, bool shared)
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    long result = syscall(SYS_futex, (uint32_t*)&address, shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    if (result < 0)
+        throwex SystemException("Failed to wake the futex address!");
+#else
+    // Shared addresses are polled by waiters
+    if (shared)
+        return;
+#if defined(_WIN32) || defined(_WIN64)
+    WakeByAddressAll((PVOID)&address);
+#else
+    address.notify_all();
+#endif
+#endif
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+pthread_mutex_t* FutexRobustNative(std::byte* storage) noexcept { return reinterpret_cast<pthread_mutex_t*>(storage); }
+
+// Handle the result of the robust mutex lock operation
+bool FutexRobustResult(pthread_mutex_t* mutex, int result, bool& abandoned, const char* message)
+{
+    if (result == 0)
+        return true;
+    // The mutex owned by the current thread is never released during the wait
+    if ((result == EBUSY) || (result == ETIMEDOUT) || (result == EDEADLK))
+        return false;
+
+    // Take over the mutex of the dead owner thread and make it consistent again
+    if (result == EOWNERDEAD)
+    {
+        result = pthread_mutex_consistent(mutex);
+        if (result != 0)
+            throwex SystemException("Failed to make the abandoned robust mutex consistent!", result);
+        abandoned = true;
+        return true;
+    }
+
+    throwex SystemException(message, result);
+}
+
+FutexRobustMutex::FutexRobustMutex()
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(pthread_mutex_t), alignof(pthread_mutex_t), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(pthread_mutex_t)), "FutexRobustMutex::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(pthread_mutex_t)) == 0), "FutexRobustMutex::StorageAlign must be adjusted!");
+
+    // Error checking type reports the recursive lock instead of the deadlock
+    pthread_mutexattr_t attribute;
+    int result = pthread_mutexattr_init(&attribute);
+    if (result != 0)
+        throwex SystemException("Failed to initialize a robust mutex attribute!", result);
+    result = pthread_mutexattr_settype(&attribute, PTHREAD_MUTEX_ERRORCHECK);
+    if (result != 0)
+        throwex SystemException("Failed to set a robust mutex type attribute!", result);
+    result = pthread_mutexattr_setpshared(&attribute, PTHREAD_PROCESS_SHARED);
+    if (result != 0)
+        throwex SystemException("Failed to set a robust mutex process shared attribute!", result);
+    result = pthread_mutexattr_setrobust(&attribute, PTHREAD_MUTEX_ROBUST);
+    if (result != 0)
+        throwex SystemException("Failed to set a robust mutex robust attribute!", result);
+    result = pthread_mutex_init(FutexRobustNative(_storage), &attribute);
+    if (result != 0)
+        throwex SystemException("Failed to initialize a robust mutex!", result);
+    result = pthread_mutexattr_destroy(&attribute);
+    if (result != 0)
+        throwex SystemException("Failed to destroy a robust mutex attribute!", result);
+}
+
+bool FutexRobustMutex::TryLock(bool& abandoned)
+{
+    abandoned = false;
+    return FutexRobustResult(FutexRobustNative(_storage), pthread_mutex_trylock(FutexRobustNative(_storage)), abandoned, "Failed to try lock a robust mutex!");
+}
+
+bool FutexRobustMutex::Acquire(uint32_t spin, int64_t timeout, bool& abandoned)
+{
+    abandoned = false;
+    pthread_mutex_t* mutex = FutexRobustNative(_storage);
+
+    // Calculate the monotonic deadline before spinning
+    struct timespec deadline;
+    if (timeout >= 0)
+    {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 30)))
+        clockid_t clock = CLOCK_MONOTONIC;
+#else
+        clockid_t clock = CLOCK_REALTIME;
+#endif
+        if (clock_gettime(clock, &deadline) != 0)
+            throwex SystemException("Failed to get the robust mutex deadline!");
+        int64_t nanoseconds = deadline.tv_nsec + (timeout % 1000000000);
+        deadline.tv_sec += (time_t)(timeout / 1000000000 + nanoseconds / 1000000000);
+        deadline.tv_nsec = (long)(nanoseconds % 1000000000);
+    }
+
+    // Spin, trying to get the uncontended mutex
+    for (uint32_t i = 0; i < spin; ++i)
+    {
+        int result = pthread_mutex_trylock(mutex);
+        if (result != EBUSY)
+            return FutexRobustResult(mutex, result, abandoned, "Failed to try lock a robust mutex!");
+        Thread::Pause();
+    }
+
+    // Block in the kernel on the robust futex
+    if (timeout < 0)
+    {
+        int result = pthread_mutex_lock(mutex);
+        if (result == EDEADLK)
+            throwex SystemException("Failed to lock a robust mutex owned by the current thread!", result);
+        return FutexRobustResult(mutex, result, abandoned, "Failed to lock a robust mutex!");
+    }
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 30)))
+    return FutexRobustResult(mutex, pthread_mutex_clocklock(mutex, CLOCK_MONOTONIC, &deadline), abandoned, "Failed to try lock a robust mutex for the given timeout!");
+#else
+    return FutexRobustResult(mutex, pthread_mutex_timedlock(mutex, &deadline), abandoned, "Failed to try lock a robust mutex for the given timeout!");
+#endif
+}
+
+bool FutexRobustMutex::Unlock()
+{
+    // Only the owner thread might release the mutex
+    return (pthread_mutex_unlock(FutexRobustNative(_storage)) == 0);
+}
+
+#else
+
+// Waiters flag of the robust mutex word
+const uint32_t FUTEX_ROBUST_WAITERS = 0x80000000;
+// Interval to check the owner process of the contended robust mutex
+const int64_t FUTEX_ROBUST_CHECK = 100000000;
+
+std::atomic<uint32_t>& FutexRobustState(std::byte* storage) noexcept { return *reinterpret_cast<std::atomic<uint32_t>*>(storage); }
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+
+// Process id is cached to keep the system call out of the uncontended path
+std::atomic<uint32_t> FutexRobustProcessId(0);
+
+void FutexRobustFork() { FutexRobustProcessId.store((uint32_t)getpid(), std::memory_order_relaxed); }
+
+uint32_t FutexRobustSelf()
+{
+    uint32_t pid = FutexRobustProcessId.load(std::memory_order_relaxed);
+    if (pid == 0)
+    {
+        static int registered = pthread_atfork(nullptr, nullptr, FutexRobustFork);
+        (void)registered;
+        FutexRobustFork();
+        pid = FutexRobustProcessId.load(std::memory_order_relaxed);
+    }
+    return pid;
+}
+
+bool FutexRobustAlive(uint32_t pid)
+{
+    return ((kill((pid_t)pid, 0) == 0) || (errno != ESRCH));
+}
+
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+
+uint32_t FutexRobustSelf()
+{
+    return (uint32_t)GetCurrentProcessId();
+}
+
+bool FutexRobustAlive(uint32_t pid)
+{
+    HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, (DWORD)pid);
+    if (process == nullptr)
+        return (GetLastError() != ERROR_INVALID_PARAMETER);
+    bool alive = (WaitForSingleObject(process, 0) == WAIT_TIMEOUT);
+    CloseHandle(process);
+    return alive;
+}
+
+#endif
+
+// Take over the robust mutex word with the given value if its owner process is dead
+bool FutexRobustRecover(std::atomic<uint32_t>& state, uint32_t value, uint32_t self, bool& abandoned)
+{
+    uint32_t owner = (value & ~FUTEX_ROBUST_WAITERS);
+    if ((owner == 0) || (owner == self) || FutexRobustAlive(owner))
+        return false;
+
+    // Keep the waiters flag, because other processes might wait for the mutex
+    if (!state.compare_exchange_strong(value, self | (value & FUTEX_ROBUST_WAITERS), std::memory_order_acquire, std::memory_order_relaxed))
+        return false;
+
+    abandoned = true;
+    return true;
+}
+
+FutexRobustMutex::FutexRobustMutex()
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(std::atomic<uint32_t>), alignof(std::atomic<uint32_t>), StorageSize, StorageAlign> _;
+
+    new(&_storage)std::atomic<uint32_t>(0);
+}
+
+bool FutexRobustMutex::TryLock(bool& abandoned)
+{
+    abandoned = false;
+    std::atomic<uint32_t>& state = FutexRobustState(_storage);
+    uint32_t self = FutexRobustSelf();
+
+    uint32_t value = 0;
+    if (state.compare_exchange_strong(value, self, std::memory_order_acquire, std::memory_order_relaxed))
+        return true;
+
+    // Released mutex with the waiters flag
+    if ((value == FUTEX_ROBUST_WAITERS) && state.compare_exchange_strong(value, self | FUTEX_ROBUST_WAITERS, std::memory_order_acquire, std::memory_order_relaxed))
+        return true;
+
+    return FutexRobustRecover(state, value, self, abandoned);
+}
+
+bool FutexRobustMutex::Acquire(uint32_t spin, int64_t timeout, bool& abandoned)
+{
+    abandoned = false;
+    std::atomic<uint32_t>& state = FutexRobustState(_storage);
+    uint32_t self = FutexRobustSelf();
+
+    // Spin, trying to get the uncontended mutex
+    for (uint32_t i = 0; i <= spin; ++i)
+    {
+        uint32_t value = state.load(std::memory_order_relaxed);
+        if ((value == 0) && state.compare_exchange_weak(value, self, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+        Thread::Pause();
+    }
+
+    Timestamp finish = NanoTimestamp() + timeout;
+    for (;;)
+    {
+        uint32_t value = state.load(std::memory_order_relaxed);
+
+        // Acquire the released mutex with the waiters flag, because other processes might wait for it
+        if ((value & ~FUTEX_ROBUST_WAITERS) == 0)
+        {
+            if (state.compare_exchange_weak(value, self | FUTEX_ROBUST_WAITERS, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+            continue;
+        }
+
+        if (FutexRobustRecover(state, value, self, abandoned))
+            return true;
+
+        // Mark the mutex as contended
+        if ((value & FUTEX_ROBUST_WAITERS) == 0)
+        {
+            if (!state.compare_exchange_weak(value, value | FUTEX_ROBUST_WAITERS, std::memory_order_relaxed, std::memory_order_relaxed))
+                continue;
+            value |= FUTEX_ROBUST_WAITERS;
+        }
+
+        // Wait for the release, but wake up periodically to check the owner process
+        int64_t wait = FUTEX_ROBUST_CHECK;
+        if (timeout >= 0)
+        {
+            int64_t remaining = (finish - NanoTimestamp()).total();
+            if (remaining <= 0)
+                return false;
+            wait = std::min(wait, remaining);
+        }
+        Futex::WaitFor(state, value, Timespan(wait), true);
+    }
+}
+
+bool FutexRobustMutex::Unlock()
+{
+    // Only the owner process might release the mutex
+    std::atomic<uint32_t>& state = FutexRobustState(_storage);
+    uint32_t value = state.load(std::memory_order_relaxed);
+    if ((value & ~FUTEX_ROBUST_WAITERS) != FutexRobustSelf())
+        return false;
+
+    value = state.exchange(0, std::memory_order_release);
+    if ((value & FUTEX_ROBUST_WAITERS) != 0)
+        Futex::WakeOne(state, true);
+    return true;
+}
+
+#endif
+
+bool FutexRobustMutex::TryLockFor(uint32_t spin, const Timespan& timespan, bool& abandoned)
+{
+    if (timespan <= 0)
+        return TryLock(abandoned);
+
+    return Acquire(spin, timespan.total(), abandoned);
+}
+
+void FutexRobustMutex::Lock(uint32_t spin, bool& abandoned)
+{
+    Acquire(spin, -1, abandoned);
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
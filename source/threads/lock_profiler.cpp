@@ -0,0 +1,218 @@
+/*!
+    \file lock_profiler.cpp
+    \brief Lock contention profiler implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/lock_profiler.h"
+
+#include "threads/critical_section.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+struct LockRegistry
+{
+    CriticalSection lock;
+    std::vector<LockSite*> sites;
+};
+
+LockRegistry& GetLockRegistry()
+{
+    static LockRegistry registry;
+    return registry;
+}
+
+} // namespace Internals
+//! @endcond
+
+LockSite::LockSite(const SourceLocation& location)
+    : _location(location),
+      _acquisitions(0),
+      _contentions(0),
+      _wait_total(0),
+      _wait_max(0),
+      _hold_samples(0),
+      _hold_total(0),
+      _hold_max(0),
+      _threshold(0)
+{
+    _worst.reserve(WORST);
+    LockProfiler::Register(this);
+}
+
+LockSite::~LockSite()
+{
+    LockProfiler::Unregister(this);
+}
+
+void LockSite::UpdateMax(std::atomic<uint64_t>& max, uint64_t value) noexcept
+{
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while ((value > current) && !max.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+void LockSite::Contended(uint64_t wait) noexcept
+{
+    _contentions.fetch_add(1, std::memory_order_relaxed);
+    _wait_total.fetch_add(wait, std::memory_order_relaxed);
+    UpdateMax(_wait_max, wait);
+
+    // Capture the stack trace only for the worst waits
+    if (wait <= _threshold.load(std::memory_order_relaxed))
+        return;
+
+    void* frames[DEPTH];
+    int size = StackTrace::Capture(frames, DEPTH, 1);
+
+    Locker<SpinLock> locker(_lock);
+
+    try
+    {
+        if (_worst.size() < WORST)
+            _worst.push_back(LockWait{ wait, std::vector<void*>(frames, frames + size) });
+        else
+        {
+            // Replace the best of the worst waits
+            auto it = std::min_element(_worst.begin(), _worst.end(), [](const LockWait& a, const LockWait& b) { return a.wait < b.wait; });
+            if (wait <= it->wait)
+                return;
+            it->wait = wait;
+            it->frames.assign(frames, frames + size);
+        }
+    }
+    catch (...)
+    {
+        // Skip the stack trace sample on allocation failure
+        return;
+    }
+
+    // Raise the threshold when all worst waits are collected
+    if (_worst.size() == WORST)
+    {
+        auto it = std::min_element(_worst.begin(), _worst.end(), [](const LockWait& a, const LockWait& b) { return a.wait < b.wait; });
+        _threshold.store(it->wait, std::memory_order_relaxed);
+    }
+}
+
+void LockSite::Held(uint64_t hold) noexcept
+{
+    _hold_samples.fetch_add(1, std::memory_order_relaxed);
+    _hold_total.fetch_add(hold, std::memory_order_relaxed);
+    UpdateMax(_hold_max, hold);
+}
+
+LockStatistics LockSite::statistics() const
+{
+    LockStatistics result(_location);
+    result.acquisitions = _acquisitions.load(std::memory_order_relaxed);
+    result.contentions = _contentions.load(std::memory_order_relaxed);
+    result.wait_total = _wait_total.load(std::memory_order_relaxed);
+    result.wait_max = _wait_max.load(std::memory_order_relaxed);
+    result.hold_samples = _hold_samples.load(std::memory_order_relaxed);
+    result.hold_total = _hold_total.load(std::memory_order_relaxed);
+    result.hold_max = _hold_max.load(std::memory_order_relaxed);
+
+    {
+        Locker<SpinLock> locker(_lock);
+        result.worst = _worst;
+    }
+
+    std::sort(result.worst.begin(), result.worst.end(), [](const LockWait& a, const LockWait& b) { return a.wait > b.wait; });
+
+    return result;
+}
+
+void LockSite::Reset()
+{
+    _acquisitions.store(0, std::memory_order_relaxed);
+    _contentions.store(0, std::memory_order_relaxed);
+    _wait_total.store(0, std::memory_order_relaxed);
+    _wait_max.store(0, std::memory_order_relaxed);
+    _hold_samples.store(0, std::memory_order_relaxed);
+    _hold_total.store(0, std::memory_order_relaxed);
+    _hold_max.store(0, std::memory_order_relaxed);
+
+    Locker<SpinLock> locker(_lock);
+    _worst.clear();
+    _threshold.store(0, std::memory_order_relaxed);
+}
+
+void LockProfiler::Register(LockSite* site)
+{
+    auto& registry = Internals::GetLockRegistry();
+    Locker<CriticalSection> locker(registry.lock);
+    registry.sites.push_back(site);
+}
+
+void LockProfiler::Unregister(LockSite* site)
+{
+    auto& registry = Internals::GetLockRegistry();
+    Locker<CriticalSection> locker(registry.lock);
+    auto it = std::find(registry.sites.begin(), registry.sites.end(), site);
+    if (it != registry.sites.end())
+        registry.sites.erase(it);
+}
+
+std::vector<LockStatistics> LockProfiler::statistics()
+{
+    std::vector<LockStatistics> result;
+
+    {
+        auto& registry = Internals::GetLockRegistry();
+        Locker<CriticalSection> locker(registry.lock);
+        result.reserve(registry.sites.size());
+        for (auto site : registry.sites)
+            result.emplace_back(site->statistics());
+    }
+
+    std::sort(result.begin(), result.end(), [](const LockStatistics& a, const LockStatistics& b)
+    {
+        if (a.wait_total != b.wait_total)
+            return a.wait_total > b.wait_total;
+        return a.acquisitions > b.acquisitions;
+    });
+
+    return result;
+}
+
+std::string LockProfiler::report(size_t top)
+{
+    std::vector<LockStatistics> sites = statistics();
+    if (sites.size() > top)
+        sites.erase(sites.begin() + top, sites.end());
+
+    std::stringstream ss;
+    for (const auto& site : sites)
+    {
+        ss << site.location << ": ";
+        ss << "acquisitions=" << site.acquisitions << ", ";
+        ss << "contentions=" << site.contentions << " (" << std::fixed << std::setprecision(2) << (site.contention_ratio() * 100.0) << "%), ";
+        ss << "wait_total=" << site.wait_total << "ns, ";
+        ss << "wait_avg=" << site.wait_average() << "ns, ";
+        ss << "wait_max=" << site.wait_max << "ns, ";
+        ss << "hold_avg=" << site.hold_average() << "ns, ";
+        ss << "hold_max=" << site.hold_max << "ns" << std::endl;
+        if (!site.worst.empty())
+            ss << "    worst wait " << site.worst.front().wait << "ns at:" << std::endl << site.worst.front().stack();
+    }
+    return ss.str();
+}
+
+void LockProfiler::Reset()
+{
+    auto& registry = Internals::GetLockRegistry();
+    Locker<CriticalSection> locker(registry.lock);
+    for (auto site : registry.sites)
+        site->Reset();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,261 @@
+/*!
+    \file low_latency_profile.cpp
+    \brief Low-latency thread profile implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/low_latency_profile.h"
+
+#include "errors/exceptions.h"
+#include "errors/system_error.h"
+#include "threads/thread.h"
+
+#include <fstream>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <malloc.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(SYS_sched_setattr)
+#if !defined(SCHED_DEADLINE)
+#define SCHED_DEADLINE 6
+#endif
+
+// Scheduling attributes of sched_setattr() system call
+struct SchedAttr
+{
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+};
+#endif
+
+// Helper function to set the real-time scheduling policy of the current thread
+bool SetRealtimePolicy(const LowLatencyOptions& options, std::string& error)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (options.policy == RealtimePolicy::DEADLINE)
+    {
+#if (defined(linux) || defined(__linux) || defined(__linux__)) && defined(SYS_sched_setattr)
+        SchedAttr attr = {};
+        attr.size = sizeof(SchedAttr);
+        attr.sched_policy = SCHED_DEADLINE;
+        attr.sched_runtime = (uint64_t)options.runtime.nanoseconds();
+        attr.sched_deadline = (uint64_t)options.period.nanoseconds();
+        attr.sched_period = (uint64_t)options.period.nanoseconds();
+        if (syscall(SYS_sched_setattr, 0, &attr, 0) != 0)
+        {
+            // Deadline threads must be allowed to run on all CPUs of the root domain
+            error = "Failed to set SCHED_DEADLINE policy: " + SystemError::Description();
+            return false;
+        }
+        return true;
+#else
+        error = "SCHED_DEADLINE policy is not supported";
+        return false;
+#endif
+    }
+
+    struct sched_param sched;
+    sched.sched_priority = options.priority;
+    int policy = (options.policy == RealtimePolicy::RR) ? SCHED_RR : SCHED_FIFO;
+    int result = pthread_setschedparam(pthread_self(), policy, &sched);
+    if (result != 0)
+    {
+        error = std::string("Failed to set ") + ((policy == SCHED_RR) ? "SCHED_RR" : "SCHED_FIFO") + " policy: " + SystemError::Description(result);
+        return false;
+    }
+    return true;
+#elif defined(_WIN32) || defined(_WIN64)
+    if (options.policy == RealtimePolicy::DEADLINE)
+    {
+        error = "SCHED_DEADLINE policy is not supported";
+        return false;
+    }
+
+    if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL))
+    {
+        error = "Failed to set the time critical thread priority: " + SystemError::Description();
+        return false;
+    }
+    return true;
+#endif
+}
+
+// Helper function to lock memory pages of the process
+bool LockMemory(std::string& error)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        error = "Failed to lock memory: " + SystemError::Description();
+        return false;
+    }
+    return true;
+#elif defined(_WIN32) || defined(_WIN64)
+    // Make the current working set size the hard minimum
+    SIZE_T minimum, maximum;
+    HANDLE hProcess = GetCurrentProcess();
+    if (!GetProcessWorkingSetSize(hProcess, &minimum, &maximum) || !SetProcessWorkingSetSizeEx(hProcess, maximum, maximum, QUOTA_LIMITS_HARDWS_MIN_ENABLE | QUOTA_LIMITS_HARDWS_MAX_DISABLE))
+    {
+        error = "Failed to lock the working set: " + SystemError::Description();
+        return false;
+    }
+    return true;
+#endif
+}
+
+// Helper function to disable returning of freed heap memory to the system
+bool DisableMallocTrim(std::string& error)
+{
+#if defined(__GLIBC__)
+    if ((mallopt(M_TRIM_THRESHOLD, -1) != 1) || (mallopt(M_MMAP_MAX, 0) != 1))
+    {
+        error = "Failed to disable malloc trimming";
+        return false;
+    }
+    return true;
+#else
+    error = "Disabling malloc trimming is not supported";
+    return false;
+#endif
+}
+
+// Helper function to disable the timer slack of the current thread
+bool DisableTimerSlack(std::string& error)
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    if (prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL) != 0)
+    {
+        error = "Failed to set the timer slack: " + SystemError::Description();
+        return false;
+    }
+    return true;
+#else
+    error = "Timer slack is not supported";
+    return false;
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+LowLatencyReport LowLatencyProfile::Apply(const LowLatencyOptions& options)
+{
+    LowLatencyReport report;
+    std::string error;
+
+    // Pin the thread to the given or isolated CPUs
+    CPUSet cpus = options.cpus.empty() ? IsolatedCPUs() : options.cpus;
+    if (!cpus.empty())
+    {
+        try
+        {
+            Thread::SetAffinity(cpus);
+            report.pinned = true;
+            report.cpus = cpus;
+        }
+        catch (const SystemException& ex)
+        {
+            report.failures.push_back(ex.message() + " " + ex.system_message());
+        }
+    }
+    else
+        report.failures.push_back("No CPUs to pin the thread to (there are no isolated CPUs)");
+
+    // Set the real-time scheduling policy
+    if (options.policy != RealtimePolicy::NONE)
+    {
+        report.realtime = Internals::SetRealtimePolicy(options, error);
+        if (!report.realtime)
+            report.failures.push_back(error);
+    }
+
+    // Disable malloc trimming before locking the memory
+    if (options.disable_malloc_trim)
+    {
+        report.malloc_trim_disabled = Internals::DisableMallocTrim(error);
+        if (!report.malloc_trim_disabled)
+            report.failures.push_back(error);
+    }
+
+    // Lock memory pages
+    if (options.lock_memory)
+    {
+        report.memory_locked = Internals::LockMemory(error);
+        if (!report.memory_locked)
+            report.failures.push_back(error);
+    }
+
+    // Prefault the thread stack (stays resident if the memory is locked)
+    if (options.prefault_stack > 0)
+    {
+        PrefaultStack(options.prefault_stack);
+        report.stack_prefaulted = true;
+    }
+
+    // Disable the timer slack
+    if (options.disable_timer_slack)
+    {
+        report.timer_slack_disabled = Internals::DisableTimerSlack(error);
+        if (!report.timer_slack_disabled)
+            report.failures.push_back(error);
+    }
+
+    return report;
+}
+
+CPUSet LowLatencyProfile::IsolatedCPUs()
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    std::ifstream stream("/sys/devices/system/cpu/isolated");
+    std::string value;
+    if (stream && std::getline(stream, value))
+        return CPUSet::Parse(value);
+#endif
+    return CPUSet();
+}
+
+void LowLatencyProfile::PrefaultStack(size_t size) noexcept
+{
+    if (size == 0)
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    volatile char* stack = (volatile char*)alloca(size);
+#elif defined(_WIN32) || defined(_WIN64)
+    volatile char* stack = (volatile char*)_alloca(size);
+#endif
+    // Touch each page of the allocated stack area
+    for (size_t i = 0; i < size; i += 4096)
+        stack[i] = 0;
+    stack[size - 1] = 0;
+}
+
+} // namespace CppCommon
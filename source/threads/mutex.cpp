@@ -8,146 +8,94 @@
 
 #include "threads/mutex.h"
 
-#include "errors/fatal.h"
+#include "threads/futex.h"
 #include "utility/validate_aligned_storage.h"
 
 #include <algorithm>
 
-#if defined(__APPLE__) || defined(__CYGWIN__)
-#include "threads/thread.h"
-#endif
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-#include <pthread.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
-#endif
-
 namespace CppCommon {
 
 //! @cond INTERNALS
 
-class Mutex::Impl
+namespace Internals {
+
+static constexpr int MutexMaxSpin = 200;
+
+// Try to acquire the mutex state with adaptive spinning
+bool MutexTryLockSpin(std::atomic<uint32_t>& state, std::atomic<int>& estimate)
 {
-public:
-    Impl()
+    // Spin up to twice of the recently measured lock hold time
+    int spin = estimate.load(std::memory_order_relaxed);
+    int limit = std::min(MutexMaxSpin, 2 * spin + 10);
+    int count = 0;
+    while (++count <= limit)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_init(&_mutex, nullptr);
-        if (result != 0)
-            throwex SystemException("Failed to initialize a mutex!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        _mutex = CreateMutex(nullptr, FALSE, nullptr);
-        if (_mutex == nullptr)
-            throwex SystemException("Failed to create a mutex!");
-#endif
+        uint32_t expected = 0;
+        if ((state.load(std::memory_order_relaxed) == 0) && state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            // Adjust the spin estimate with the measured count of iterations
+            estimate.store(spin + (count - spin) / 8, std::memory_order_relaxed);
+            return true;
+        }
     }
 
-    ~Impl()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_destroy(&_mutex);
-        if (result != 0)
-            fatality(SystemException("Failed to destroy a mutex!", result));
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CloseHandle(_mutex))
-            fatality(SystemException("Failed to close a mutex!"));
-#endif
-    }
+    // Adjust the spin estimate after the failed spinning
+    estimate.store(spin + (limit - spin) / 8, std::memory_order_relaxed);
+    return false;
+}
 
-    bool TryLock()
-    {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_trylock(&_mutex);
-        if ((result != 0) && (result != EAGAIN) && (result != EBUSY) && (result != EDEADLK))
-            throwex SystemException("Failed to try lock a mutex!", result);
-        return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_mutex, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a mutex!");
-        return (result == WAIT_OBJECT_0);
-#endif
-    }
+} // namespace Internals
+
+class Mutex::Impl
+{
+public:
+    Impl() : _spin(0) {}
 
-    bool TryLockFor(const Timespan& timespan)
+    bool TryLockFor(std::atomic<uint32_t>& state, const Timespan& timespan)
     {
-        if (timespan < 0)
-            return TryLock();
-#if defined(__APPLE__) || defined(__CYGWIN__)
         // Calculate a finish timestamp
         Timestamp finish = NanoTimestamp() + timespan;
 
-        // Try to acquire lock at least one time
-        if (TryLock())
+        // Try to acquire the mutex with adaptive spinning
+        if (Internals::MutexTryLockSpin(state, _spin))
             return true;
-        else
+
+        // Mark the mutex as contended and block until it is released or the timeout expires
+        while (state.exchange(2, std::memory_order_acquire) != 0)
         {
-            // Try lock or yield for the given timespan
-            while (NanoTimestamp() < finish)
-            {
-                if (TryLock())
-                    return true;
-                else
-                    Thread::Yield();
-            }
-
-            // Failed to acquire lock
-            return false;
+            Timestamp current = NanoTimestamp();
+            if (current >= finish)
+                return false;
+
+            Futex::WaitFor(state, 2, finish - current);
         }
-#elif defined(unix) || defined(__unix) || defined(__unix__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_mutex_timedlock(&_mutex, &timeout);
-        if ((result != 0) && (result != ETIMEDOUT))
-            throwex SystemException("Failed to try lock a mutex for the given timeout!", result);
-        return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_mutex, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a mutex for the given timeout!");
-        return (result == WAIT_OBJECT_0);
-#endif
+        return true;
     }
 
-    void Lock()
+    void Lock(std::atomic<uint32_t>& state)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_lock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_mutex, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock a mutex!");
-#endif
+        // Try to acquire the mutex with adaptive spinning
+        if (Internals::MutexTryLockSpin(state, _spin))
+            return;
+
+        // Mark the mutex as contended and block until it is released
+        while (state.exchange(2, std::memory_order_acquire) != 0)
+            Futex::Wait(state, 2);
     }
 
-    void Unlock()
+    void Unlock(std::atomic<uint32_t>& state)
     {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        int result = pthread_mutex_unlock(&_mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex!", result);
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!ReleaseMutex(_mutex))
-            throwex SystemException("Failed to unlock a mutex!");
-#endif
+        Futex::WakeOne(state);
     }
 
 private:
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    pthread_mutex_t _mutex;
-#elif defined(_WIN32) || defined(_WIN64)
-    HANDLE _mutex;
-#endif
+    // Estimated count of spin iterations to acquire the mutex
+    std::atomic<int> _spin;
 };
 
 //! @endcond
 
-Mutex::Mutex()
+Mutex::Mutex() : _state(0)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -164,10 +112,19 @@ Mutex::~Mutex()
     reinterpret_cast<Impl*>(&_storage)->~Impl();
 }
 
-bool Mutex::TryLock() { return impl().TryLock(); }
-bool Mutex::TryLockFor(const Timespan& timespan) { return impl().TryLockFor(timespan); }
+bool Mutex::TryLockFor(const Timespan& timespan)
+{
+    // Uncontended path is a single atomic operation
+    if (TryLock())
+        return true;
+
+    if (timespan < 0)
+        return false;
+
+    return impl().TryLockFor(_state, timespan);
+}
 
-void Mutex::Lock() { impl().Lock(); }
-void Mutex::Unlock() { impl().Unlock(); }
+void Mutex::LockSlow() { impl().Lock(_state); }
+void Mutex::UnlockSlow() { impl().Unlock(_state); }
 
 } // namespace CppCommon
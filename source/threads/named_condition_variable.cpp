@@ -13,9 +13,11 @@
 
 #include <algorithm>
 
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include "system/shared_type.h"
-#include <pthread.h>
+#include "threads/futex.h"
+#include "time/timestamp.h"
+#include <atomic>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include "system/shared_type.h"
 #include <windows.h>
@@ -30,48 +32,9 @@ namespace CppCommon {
 class NamedConditionVariable::Impl
 {
 public:
-    Impl(const std::string& name) : _name(name)
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
-        , _shared(name)
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        , _shared(name)
-#endif
+    Impl(const std::string& name) : _name(name), _shared(name)
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named condition variable is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should initializate a named condition variable
-        if (_shared.owner())
-        {
-            pthread_mutexattr_t mutex_attribute;
-            int result = pthread_mutexattr_init(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a mutex attribute for the named condition variable!", result);
-            result = pthread_mutexattr_setpshared(&mutex_attribute, PTHREAD_PROCESS_SHARED);
-            if (result != 0)
-                throwex SystemException("Failed to set a mutex process shared attribute for the named condition variable!", result);
-            result = pthread_mutex_init(&_shared->mutex, &mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a mutex for the named condition variable!", result);
-            result = pthread_mutexattr_destroy(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to destroy a mutex attribute for the named condition variable!", result);
-
-            pthread_condattr_t cond_attribute;
-            result = pthread_condattr_init(&cond_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a conditional variable attribute for the named condition variable!", result);
-            result = pthread_condattr_setpshared(&cond_attribute, PTHREAD_PROCESS_SHARED);
-            if (result != 0)
-                throwex SystemException("Failed to set a conditional variable process shared attribute for the named condition variable!", result);
-            result = pthread_cond_init(&_shared->cond, &cond_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a conditional variable for the named condition variable!", result);
-            result = pthread_condattr_destroy(&cond_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to destroy a conditional variable attribute for the named condition variable!", result);
-        }
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         // Owner of the condition variable should initialize its value
         if (_shared.owner())
             *_shared = 0;
@@ -86,20 +49,7 @@ public:
 
     ~Impl()
     {
-#if defined(__APPLE__)
-        fatality(SystemException("Named condition variable is not supported!"));
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should destroy a named condition variable
-        if (_shared.owner())
-        {
-            int result = pthread_mutex_destroy(&_shared->mutex);
-            if (result != 0)
-                fatality(SystemException("Failed to destroy a mutex for the named condition variable!", result));
-            result = pthread_cond_destroy(&_shared->cond);
-            if (result != 0)
-                fatality(SystemException("Failed to destroy a conditional variable for the named condition variable!", result));
-        }
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!CloseHandle(_mutex))
             fatality(SystemException("Failed to close a named mutex for the named condition variable!"));
         if (!CloseHandle(_semaphore))
@@ -114,12 +64,11 @@ public:
 
     void NotifyOne()
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named condition variable is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_cond_signal(&_shared->cond);
-        if (result != 0)
-            throwex SystemException("Failed to signal a named condition variable!", result);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        // Full fence pairs with the waiters counter increment before the wait
+        _shared->sequence.fetch_add(1, std::memory_order_seq_cst);
+        if (_shared->waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::WakeOne(_shared->sequence, true);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         // Lock the named mutex
         DWORD result = WaitForSingleObject(_mutex, INFINITE);
@@ -138,12 +87,10 @@ public:
 
     void NotifyAll()
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named condition variable is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_cond_broadcast(&_shared->cond);
-        if (result != 0)
-            throwex SystemException("Failed to broadcast a named condition variable!", result);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        _shared->sequence.fetch_add(1, std::memory_order_seq_cst);
+        if (_shared->waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::WakeAll(_shared->sequence, true);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         // Lock the named mutex
         DWORD result = WaitForSingleObject(_mutex, INFINITE);
@@ -162,12 +109,12 @@ public:
 
     void Wait()
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named condition variable is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_cond_wait(&_shared->cond, &_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to waiting a named condition variable!", result);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        uint32_t sequence = _shared->sequence.load(std::memory_order_acquire);
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        while (_shared->sequence.load(std::memory_order_acquire) == sequence)
+            Futex::Wait(_shared->sequence, sequence, true);
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         // Lock the named mutex
         DWORD result = WaitForSingleObject(_mutex, INFINITE);
@@ -190,16 +137,23 @@ public:
     {
         if (timespan < 0)
             return false;
-#if defined(__APPLE__)
-        throwex SystemException("Named condition variable is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_cond_timedwait(&_shared->cond, &_shared->mutex, &timeout);
-        if ((result != 0) && (result != ETIMEDOUT))
-            throwex SystemException("Failed to waiting a named condition variable for the given timeout!", result);
-        return (result == 0);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        Timestamp finish = NanoTimestamp() + timespan;
+        uint32_t sequence = _shared->sequence.load(std::memory_order_acquire);
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool result = true;
+        while (_shared->sequence.load(std::memory_order_acquire) == sequence)
+        {
+            int64_t remaining = (finish - NanoTimestamp()).total();
+            if (remaining <= 0)
+            {
+                result = false;
+                break;
+            }
+            Futex::WaitFor(_shared->sequence, sequence, Timespan(remaining), true);
+        }
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         // Lock the named mutex
         DWORD result = WaitForSingleObject(_mutex, INFINITE);
@@ -221,12 +175,14 @@ public:
 
 private:
     std::string _name;
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
     // Shared condition variable structure
     struct CondVar
     {
-        pthread_mutex_t mutex;
-        pthread_cond_t cond;
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> waiters;
+
+        CondVar() : sequence(0), waiters(0) {}
     };
 
     // Shared condition variable structure wrapper
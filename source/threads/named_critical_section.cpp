@@ -10,13 +10,15 @@
 
 #include "errors/fatal.h"
 #include "system/shared_type.h"
-#include "threads/named_event_auto_reset.h"
 #include "threads/thread.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <atomic>
+
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-#include <pthread.h>
+#include "threads/futex.h"
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#include "threads/named_event_auto_reset.h"
 #include <windows.h>
 #undef Yield
 #endif
@@ -28,7 +30,11 @@ namespace CppCommon {
 class NamedCriticalSection::Impl
 {
 public:
-    Impl(const std::string& name, uint32_t spin) : _shared(name), _event(name + "_event"), _spin(spin) {}
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    Impl(const std::string& name, uint32_t spin) : _shared(name), _spin(spin), _abandoned(false) {}
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    Impl(const std::string& name, uint32_t spin) : _shared(name), _event(name + "_event"), _spin(spin), _abandoned(false) {}
+#endif
 
     ~Impl()
     {
@@ -41,6 +47,55 @@ public:
         return _shared.name();
     }
 
+    bool abandoned() const noexcept
+    {
+        return _abandoned;
+    }
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    bool TryLock()
+    {
+        if (Recurse())
+            return true;
+        if (!_shared->mutex.TryLock(_abandoned))
+            return false;
+        Own();
+        return true;
+    }
+
+    bool TryLockFor(const Timespan& timespan)
+    {
+        if (Recurse())
+            return true;
+        if (!_shared->mutex.TryLockFor(_spin, timespan, _abandoned))
+            return false;
+        Own();
+        return true;
+    }
+
+    void Lock()
+    {
+        if (Recurse())
+            return;
+        _shared->mutex.Lock(_spin, _abandoned);
+        Own();
+    }
+
+    void Unlock()
+    {
+        if (_shared->thread_id != Thread::CurrentThreadId())
+            throwex SystemException("Named critical section can not be unlocked from other thread!");
+
+        // Reduce this thread's ownership of the named critical section
+        if (--_shared->recurse_count > 0)
+            return;
+
+        // We don't own the named critical section anymore
+        _shared->thread_id = 0;
+        if (!_shared->mutex.Unlock())
+            throwex SystemException("Failed to unlock a named critical section!");
+    }
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     bool TryLock()
     {
         return TryLock(0);
@@ -54,11 +109,7 @@ public:
         while (true)
         {
             // If lock count = 0, the named critical section is unowned, we can own it
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-            if (__sync_bool_compare_and_swap(&_shared->lock_count, 0, 1))
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
             if (InterlockedCompareExchange(&_shared->lock_count, 1, 0) == 0)
-#endif
             {
                 // The named critical section is unowned, let this thread own it once
                 _shared->thread_id = thread_id;
@@ -68,11 +119,7 @@ public:
             else if (_shared->thread_id == thread_id)
             {
                 // If the named critical section is owned by this thread, own it again
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                __sync_add_and_fetch(&_shared->lock_count, 1);
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                 InterlockedIncrement(&_shared->lock_count);
-#endif
                 _shared->recurse_count++;
                 return true;
             }
@@ -86,6 +133,30 @@ public:
         return false;
     }
 
+    bool TryLockFor(const Timespan& timespan)
+    {
+        // Calculate a finish timestamp
+        Timestamp finish = NanoTimestamp() + timespan;
+
+        // Try to acquire named critical section at least one time
+        if (TryLock())
+            return true;
+        else
+        {
+            // Try lock or yield for the given timespan
+            while (NanoTimestamp() < finish)
+            {
+                if (TryLock())
+                    return true;
+                else
+                    Thread::Yield();
+            }
+
+            // Failed to acquire named critical section
+            return false;
+        }
+    }
+
     void Lock()
     {
         // Spin, trying to get the named critical section
@@ -95,11 +166,7 @@ public:
         // We couldn't get the the named critical section, wait for it
         uint64_t thread_id = Thread::CurrentThreadId();
 
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        if (__sync_add_and_fetch(&_shared->lock_count, 1) == 1)
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (InterlockedIncrement(&_shared->lock_count) == 1)
-#endif
         {
             // The named critical section is unowned, let this thread own it once
             _shared->thread_id = thread_id;
@@ -133,30 +200,55 @@ public:
         if (--_shared->recurse_count > 0)
         {
             // We still own the named critical section
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-            __sync_sub_and_fetch(&_shared->lock_count, 1);
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
             InterlockedDecrement(&_shared->lock_count);
-#endif
         }
         else
         {
             // We don't own the named critical section anymore
             _shared->thread_id = 0;
 
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-            if (__sync_sub_and_fetch(&_shared->lock_count, 1) > 0)
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
             if (InterlockedDecrement(&_shared->lock_count) > 0)
-#endif
             {
                 // Other threads are waiting, the auto-reset event wakes one of them
                 _event.Signal();
             }
         }
     }
+#endif
 
 private:
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    // Shared critical section structure
+    struct CriticalSectionHeader
+    {
+        Internals::FutexRobustMutex mutex;
+        int recurse_count;
+        std::atomic<uint64_t> thread_id;
+
+        CriticalSectionHeader() : recurse_count(0), thread_id(0) {}
+    };
+
+    // Shared critical section structure wrapper
+    SharedType<CriticalSectionHeader> _shared;
+    uint32_t _spin;
+    bool _abandoned;
+
+    // If the named critical section is owned by this thread, own it again
+    bool Recurse()
+    {
+        if (_shared->thread_id != Thread::CurrentThreadId())
+            return false;
+        _shared->recurse_count++;
+        return true;
+    }
+
+    // The named critical section is unowned, let this thread own it once
+    void Own()
+    {
+        _shared->thread_id = Thread::CurrentThreadId();
+        _shared->recurse_count = 1;
+    }
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     // Shared critical section structure
     struct CriticalSectionHeader
     {
@@ -171,11 +263,13 @@ private:
     SharedType<CriticalSectionHeader> _shared;
     NamedEventAutoReset _event;
     uint32_t _spin;
+    bool _abandoned;
+#endif
 };
 
 //! @endcond
 
-NamedCriticalSection::NamedCriticalSection(const std::string& name)
+NamedCriticalSection::NamedCriticalSection(const std::string& name, uint32_t spin)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -183,7 +277,7 @@ NamedCriticalSection::NamedCriticalSection(const std::string& name)
     static_assert(((StorageAlign % alignof(Impl)) == 0), "NamedCriticalSection::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(name, 4000);
+    new(&_storage)Impl(name, spin);
 }
 
 NamedCriticalSection::~NamedCriticalSection()
@@ -193,32 +287,11 @@ NamedCriticalSection::~NamedCriticalSection()
 }
 
 const std::string& NamedCriticalSection::name() const { return impl().name(); }
+bool NamedCriticalSection::abandoned() const noexcept { return impl().abandoned(); }
 
 bool NamedCriticalSection::TryLock() { return impl().TryLock(); }
 
-bool NamedCriticalSection::TryLockFor(const Timespan& timespan)
-{
-    // Calculate a finish timestamp
-    Timestamp finish = NanoTimestamp() + timespan;
-
-    // Try to acquire named critical section at least one time
-    if (TryLock())
-        return true;
-    else
-    {
-        // Try lock or yield for the given timespan
-        while (NanoTimestamp() < finish)
-        {
-            if (TryLock())
-                return true;
-            else
-                Thread::Yield();
-        }
-
-        // Failed to acquire named critical section
-        return false;
-    }
-}
+bool NamedCriticalSection::TryLockFor(const Timespan& timespan) { return impl().TryLockFor(timespan); }
 
 void NamedCriticalSection::Lock() { impl().Lock(); }
 void NamedCriticalSection::Unlock() { impl().Unlock(); }
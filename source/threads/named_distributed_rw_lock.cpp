@@ -0,0 +1,268 @@
+/*!
+    \file named_distributed_rw_lock.cpp
+    \brief Named distributed reader-biased read/write lock synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/named_distributed_rw_lock.h"
+
+#include "errors/exceptions.h"
+#include "system/cpu.h"
+#include "system/shared_memory.h"
+#include "threads/futex.h"
+#include "threads/thread.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class NamedDistributedRWLock::Impl
+{
+public:
+    Impl(const std::string& name, size_t slots)
+        : _shared(name, SharedSize(Round(slots))),
+          _header((Header*)_shared.ptr()),
+          _slots((Slot*)((uint8_t*)_shared.ptr() + sizeof(Header))),
+          _mask(Round(slots) - 1)
+    {
+        // Owner of the named read/write lock should initialize its shared state
+        if (_shared.owner())
+        {
+            new (_header) Header();
+            for (size_t i = 0; i <= _mask; ++i)
+                new (&_slots[i]) Slot();
+            _header->slots.store(_mask + 1, std::memory_order_release);
+        }
+        else
+        {
+            uint64_t count = _header->slots.load(std::memory_order_acquire);
+            if ((count != 0) && (count != (_mask + 1)))
+                throwex SystemException("Named distributed read/write lock slots count mismatch!");
+        }
+    }
+
+    const std::string& name() const { return _shared.name(); }
+    size_t slots() const noexcept { return _mask + 1; }
+
+    bool TryLockRead() noexcept
+    {
+        Slot& slot = CurrentSlot();
+
+        // Register the reader in the current CPU slot. Pairs with the writer flag store in LockWrite()
+        slot.readers.fetch_add(1, std::memory_order_seq_cst);
+        if ((_header->writer.load(std::memory_order_seq_cst) & WRITER) == 0)
+            return true;
+
+        // Back off in favor of the writer
+        slot.readers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    bool TryLockWrite()
+    {
+        bool abandoned;
+        if (!_header->writers.TryLock(abandoned))
+            return false;
+
+        // Stop new readers and check for active ones
+        _header->writer.fetch_or(WRITER, std::memory_order_seq_cst);
+        if (IsDrained())
+            return true;
+
+        // Failed to acquire write lock
+        UnlockWrite();
+        return false;
+    }
+
+    bool TryLockReadFor(const Timespan& timespan)
+    {
+        Timestamp finish = NanoTimestamp() + timespan;
+        while (!TryLockRead())
+        {
+            int64_t remaining = (finish - NanoTimestamp()).total();
+            if (remaining <= 0)
+                return false;
+            WaitWriter(remaining);
+        }
+        return true;
+    }
+
+    bool TryLockWriteFor(const Timespan& timespan)
+    {
+        Timestamp finish = NanoTimestamp() + timespan;
+
+        bool abandoned;
+        if (!_header->writers.TryLockFor(SPIN, timespan, abandoned))
+            return false;
+
+        // Stop new readers and wait for active ones
+        _header->writer.fetch_or(WRITER, std::memory_order_seq_cst);
+        while (!IsDrained())
+        {
+            if (NanoTimestamp() >= finish)
+            {
+                // Failed to acquire write lock
+                UnlockWrite();
+                return false;
+            }
+            Thread::Yield();
+        }
+        return true;
+    }
+
+    void LockRead()
+    {
+        while (!TryLockRead())
+            WaitWriter(-1);
+    }
+
+    void LockWrite()
+    {
+        bool abandoned;
+        _header->writers.Lock(SPIN, abandoned);
+
+        // Stop new readers and wait for active ones
+        _header->writer.fetch_or(WRITER, std::memory_order_seq_cst);
+        while (!IsDrained())
+            Thread::Yield();
+    }
+
+    void UnlockRead() noexcept
+    {
+        CurrentSlot().readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    void UnlockWrite()
+    {
+        // Release readers blocked by the writer
+        uint32_t state = _header->writer.exchange(0, std::memory_order_seq_cst);
+        if ((state & WAITING) != 0)
+            Futex::WakeAll(_header->writer, true);
+
+        if (!_header->writers.Unlock())
+            throwex SystemException("Failed to unlock a named distributed read/write lock writer!");
+    }
+
+private:
+    // Writer flag bits
+    static const uint32_t WRITER = 1;
+    static const uint32_t WAITING = 2;
+    // Count of writer spin iterations before blocking
+    static const uint32_t SPIN = 1000;
+
+    // Shared read/write lock header
+    struct Header
+    {
+        alignas(128) std::atomic<uint32_t> writer;
+        alignas(128) Internals::FutexRobustMutex writers;
+        std::atomic<uint64_t> slots;
+
+        Header() : writer(0), slots(0) {}
+    };
+
+    // Readers slot placed on its own cache line
+    struct alignas(128) Slot
+    {
+        std::atomic<int64_t> readers;
+
+        Slot() : readers(0) {}
+    };
+
+    SharedMemory _shared;
+    Header* _header;
+    Slot* _slots;
+    size_t _mask;
+
+    // Round up the count of slots to the power of two
+    static size_t Round(size_t slots)
+    {
+        if (slots == 0)
+            slots = (size_t)std::max(CPU::LogicalCores(), 1);
+
+        size_t count = 1;
+        while (count < slots)
+            count <<= 1;
+        return count;
+    }
+
+    static size_t SharedSize(size_t slots) { return sizeof(Header) + slots * sizeof(Slot); }
+
+    Slot& CurrentSlot() noexcept
+    {
+        return _slots[Thread::CurrentThreadAffinity() & _mask];
+    }
+
+    bool IsDrained() const noexcept
+    {
+        int64_t readers = 0;
+        for (size_t i = 0; i <= _mask; ++i)
+            readers += _slots[i].readers.load(std::memory_order_seq_cst);
+        return (readers == 0);
+    }
+
+    // Block while the writer holds the lock with the given timeout in nanoseconds (negative timeout is infinite)
+    void WaitWriter(int64_t timeout)
+    {
+        uint32_t state = _header->writer.load(std::memory_order_acquire);
+        while ((state & WRITER) != 0)
+        {
+            // Mark blocked readers, so the writer wakes them on unlock
+            if ((state & WAITING) == 0)
+            {
+                if (!_header->writer.compare_exchange_weak(state, state | WAITING, std::memory_order_relaxed, std::memory_order_relaxed))
+                    continue;
+                state |= WAITING;
+            }
+
+            if (timeout < 0)
+                Futex::Wait(_header->writer, state, true);
+            else if (!Futex::WaitFor(_header->writer, state, Timespan(timeout), true))
+                return;
+
+            state = _header->writer.load(std::memory_order_acquire);
+        }
+    }
+};
+
+//! @endcond
+
+NamedDistributedRWLock::NamedDistributedRWLock(const std::string& name, size_t slots)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "NamedDistributedRWLock::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "NamedDistributedRWLock::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(name, slots);
+}
+
+NamedDistributedRWLock::~NamedDistributedRWLock()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+const std::string& NamedDistributedRWLock::name() const { return impl().name(); }
+size_t NamedDistributedRWLock::slots() const noexcept { return impl().slots(); }
+
+bool NamedDistributedRWLock::TryLockRead() noexcept { return impl().TryLockRead(); }
+bool NamedDistributedRWLock::TryLockWrite() { return impl().TryLockWrite(); }
+
+bool NamedDistributedRWLock::TryLockReadFor(const Timespan& timespan) { return impl().TryLockReadFor(timespan); }
+bool NamedDistributedRWLock::TryLockWriteFor(const Timespan& timespan) { return impl().TryLockWriteFor(timespan); }
+
+void NamedDistributedRWLock::LockRead() { impl().LockRead(); }
+void NamedDistributedRWLock::LockWrite() { impl().LockWrite(); }
+
+void NamedDistributedRWLock::UnlockRead() noexcept { impl().UnlockRead(); }
+void NamedDistributedRWLock::UnlockWrite() { impl().UnlockWrite(); }
+
+} // namespace CppCommon
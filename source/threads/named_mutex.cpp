@@ -13,12 +13,9 @@
 
 #include <algorithm>
 
-#if defined(__APPLE__)
-#include "threads/thread.h"
-#endif
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include "system/shared_type.h"
-#include <pthread.h>
+#include "threads/futex.h"
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef max
@@ -32,32 +29,12 @@ namespace CppCommon {
 class NamedMutex::Impl
 {
 public:
-    Impl(const std::string& name) : _name(name)
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+    Impl(const std::string& name, uint32_t spin) : _name(name), _spin(spin), _abandoned(false)
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
         , _shared(name)
 #endif
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named mutex is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should initializate a named mutex
-        if (_shared.owner())
-        {
-            pthread_mutexattr_t mutex_attribute;
-            int result = pthread_mutexattr_init(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a named mutex attribute!", result);
-            result = pthread_mutexattr_setpshared(&mutex_attribute, PTHREAD_PROCESS_SHARED);
-            if (result != 0)
-                throwex SystemException("Failed to set a named mutex process shared attribute!", result);
-            result = pthread_mutex_init(&_shared->mutex, &mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a named mutex!", result);
-            result = pthread_mutexattr_destroy(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to destroy a named mutex attribute!", result);
-        }
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         _mutex = CreateMutexA(nullptr, FALSE, name.c_str());
         if (_mutex == nullptr)
             throwex SystemException("Failed to create or open a named mutex!");
@@ -66,17 +43,7 @@ public:
 
     ~Impl()
     {
-#if defined(__APPLE__)
-        fatality(SystemException("Named mutex is not supported!"));
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should destroy a named mutex
-        if (_shared.owner())
-        {
-            int result = pthread_mutex_destroy(&_shared->mutex);
-            if (result != 0)
-                fatality(SystemException("Failed to destroy a named mutex!", result));
-        }
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!CloseHandle(_mutex))
             fatality(SystemException("Failed to close a named mutex!"));
 #endif
@@ -87,20 +54,22 @@ public:
         return _name;
     }
 
+    uint32_t spin() const noexcept
+    {
+        return _spin;
+    }
+
+    bool abandoned() const noexcept
+    {
+        return _abandoned;
+    }
+
     bool TryLock()
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named mutex is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_trylock(&_shared->mutex);
-        if ((result != 0) && (result != EAGAIN) && (result != EBUSY) && (result != EDEADLK))
-            throwex SystemException("Failed to try lock a named mutex!", result);
-        return (result == 0);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        return _shared->mutex.TryLock(_abandoned);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        DWORD result = WaitForSingleObject(_mutex, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a named mutex!");
-        return (result == WAIT_OBJECT_0);
+        return Wait(0, "Failed to try lock a named mutex!");
 #endif
     }
 
@@ -108,47 +77,27 @@ public:
     {
         if (timespan < 0)
             return TryLock();
-#if defined(__APPLE__)
-        throwex SystemException("Named mutex is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_mutex_timedlock(&_shared->mutex, &timeout);
-        if ((result != 0) && (result != ETIMEDOUT))
-            throwex SystemException("Failed to try lock a named mutex for the given timeout!", result);
-        return (result == 0);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        return _shared->mutex.TryLockFor(_spin, timespan, _abandoned);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        DWORD result = WaitForSingleObject(_mutex, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a named mutex for the given timeout!");
-        return (result == WAIT_OBJECT_0);
+        return Wait(std::max((DWORD)1, (DWORD)timespan.milliseconds()), "Failed to try lock a named mutex for the given timeout!");
 #endif
     }
 
     void Lock()
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named mutex is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_lock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a named mutex!", result);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        _shared->mutex.Lock(_spin, _abandoned);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-        DWORD result = WaitForSingleObject(_mutex, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock a named mutex!");
+        Wait(INFINITE, "Failed to lock a named mutex!");
 #endif
     }
 
     void Unlock()
     {
-#if defined(__APPLE__)
-        throwex SystemException("Named mutex is not supported!");
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_unlock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a named mutex!", result);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        if (!_shared->mutex.Unlock())
+            throwex SystemException("Failed to unlock a named mutex!");
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!ReleaseMutex(_mutex))
             throwex SystemException("Failed to unlock a named mutex!");
@@ -157,23 +106,34 @@ public:
 
 private:
     std::string _name;
-#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+    uint32_t _spin;
+    bool _abandoned;
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
     // Shared mutex structure
     struct MutexHeader
     {
-        pthread_mutex_t mutex;
+        Internals::FutexRobustMutex mutex;
     };
 
     // Shared mutex structure wrapper
     SharedType<MutexHeader> _shared;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     HANDLE _mutex;
+
+    bool Wait(DWORD timeout, const char* message)
+    {
+        DWORD result = WaitForSingleObject(_mutex, timeout);
+        if ((result != WAIT_OBJECT_0) && (result != WAIT_ABANDONED) && (result != WAIT_TIMEOUT))
+            throwex SystemException(message);
+        _abandoned = (result == WAIT_ABANDONED);
+        return (result != WAIT_TIMEOUT);
+    }
 #endif
 };
 
 //! @endcond
 
-NamedMutex::NamedMutex(const std::string& name)
+NamedMutex::NamedMutex(const std::string& name, uint32_t spin)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -181,7 +141,7 @@ NamedMutex::NamedMutex(const std::string& name)
     static_assert(((StorageAlign % alignof(Impl)) == 0), "NamedMutex::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(name);
+    new(&_storage)Impl(name, spin);
 }
 
 NamedMutex::~NamedMutex()
@@ -191,6 +151,8 @@ NamedMutex::~NamedMutex()
 }
 
 const std::string& NamedMutex::name() const { return impl().name(); }
+uint32_t NamedMutex::spin() const noexcept { return impl().spin(); }
+bool NamedMutex::abandoned() const noexcept { return impl().abandoned(); }
 
 bool NamedMutex::TryLock() { return impl().TryLock(); }
 bool NamedMutex::TryLockFor(const Timespan& timespan) { return impl().TryLockFor(timespan); }
@@ -14,12 +14,11 @@
 #include <algorithm>
 #include <cassert>
 
-#if defined(__APPLE__)
-#include "threads/thread.h"
-#endif
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-#include <fcntl.h>
-#include <semaphore.h>
+#include "system/shared_type.h"
+#include "threads/futex.h"
+#include "threads/thread.h"
+#include <atomic>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef Yield
@@ -34,22 +33,19 @@ namespace CppCommon {
 class NamedSemaphore::Impl
 {
 public:
-    Impl(const std::string& name, int resources) : _name(name), _resources(resources)
+    Impl(const std::string& name, int resources, uint32_t spin) : _name(name), _resources(resources), _spin(spin)
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        , _shared(name)
+#endif
     {
         assert((resources > 0) && "Named semaphore resources counter must be greater than zero!");
 
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        _owner = true;
-        // Try to create a named binary semaphore
-        _semaphore = sem_open(name.c_str(), (O_CREAT | O_EXCL), 0666, resources);
-        if (_semaphore == SEM_FAILED)
+        // Owner of the named semaphore should initialize its resources counter
+        if (_shared.owner())
         {
-            // Try to open a named binary semaphore
-            _semaphore = sem_open(name.c_str(), O_CREAT, 0666, resources);
-            if (_semaphore == SEM_FAILED)
-                throwex SystemException("Failed to initialize a named semaphore!");
-            else
-                _owner = false;
+            _shared->count.store((uint32_t)resources, std::memory_order_release);
+            Futex::WakeAll(_shared->count, true);
         }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         _semaphore = CreateSemaphoreA(nullptr, resources, resources, name.c_str());
@@ -60,18 +56,7 @@ public:
 
     ~Impl()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = sem_close(_semaphore);
-        if (result != 0)
-            fatality(SystemException("Failed to close a named semaphore!"));
-        // Unlink the named semaphore (owner only)
-        if (_owner)
-        {
-            result = sem_unlink(_name.c_str());
-            if (result != 0)
-                fatality(SystemException("Failed to unlink a named semaphore!"));
-        }
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!CloseHandle(_semaphore))
             fatality(SystemException("Failed to close a named semaphore!"));
 #endif
@@ -87,13 +72,19 @@ public:
         return _resources;
     }
 
+    uint32_t spin() const noexcept
+    {
+        return _spin;
+    }
+
     bool TryLock()
     {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = sem_trywait(_semaphore);
-        if ((result != 0) && (errno != EAGAIN))
-            throwex SystemException("Failed to try lock a named semaphore!");
-        return (result == 0);
+        uint32_t count = _shared->count.load(std::memory_order_relaxed);
+        while (count > 0)
+            if (_shared->count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_semaphore, 0);
         if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
@@ -106,35 +97,8 @@ public:
     {
         if (timespan < 0)
             return TryLock();
-#if defined(__APPLE__)
-        // Calculate a finish timestamp
-        Timestamp finish = NanoTimestamp() + timespan;
-
-        // Try to acquire lock at least one time
-        if (TryLock())
-            return true;
-        else
-        {
-            // Try lock or yield for the given timespan
-            while (NanoTimestamp() < finish)
-            {
-                if (TryLock())
-                    return true;
-                else
-                    Thread::Yield();
-            }
-
-            // Failed to acquire lock
-            return false;
-        }
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = sem_timedwait(_semaphore, &timeout);
-        if ((result != 0) && (errno != ETIMEDOUT))
-            throwex SystemException("Failed to try lock a named semaphore for the given timeout!");
-        return (result == 0);
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        return Acquire(timespan.total());
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_semaphore, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
         if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
@@ -146,9 +110,7 @@ public:
     void Lock()
     {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = sem_wait(_semaphore);
-        if (result != 0)
-            throwex SystemException("Failed to lock a named semaphore!");
+        Acquire(-1);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_semaphore, INFINITE);
         if (result != WAIT_OBJECT_0)
@@ -159,9 +121,10 @@ public:
     void Unlock()
     {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        int result = sem_post(_semaphore);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a named semaphore!");
+        // Full fence pairs with the waiters counter increment before the wait
+        _shared->count.fetch_add(1, std::memory_order_seq_cst);
+        if (_shared->waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::WakeOne(_shared->count, true);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!ReleaseSemaphore(_semaphore, 1, nullptr))
             throwex SystemException("Failed to unlock a named semaphore!");
@@ -171,9 +134,53 @@ public:
 private:
     std::string _name;
     int _resources;
+    uint32_t _spin;
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-    sem_t* _semaphore;
-    bool _owner;
+    // Shared semaphore structure
+    struct SemaphoreHeader
+    {
+        std::atomic<uint32_t> count;
+        std::atomic<uint32_t> waiters;
+
+        SemaphoreHeader() : count(0), waiters(0) {}
+    };
+
+    // Shared semaphore structure wrapper
+    SharedType<SemaphoreHeader> _shared;
+
+    // Acquire the semaphore with the given timeout in nanoseconds (negative timeout is infinite)
+    bool Acquire(int64_t timeout)
+    {
+        // Spin, trying to get the semaphore resource
+        for (uint32_t i = 0; i <= _spin; ++i)
+        {
+            if (TryLock())
+                return true;
+            Thread::Pause();
+        }
+
+        Timestamp finish = NanoTimestamp() + timeout;
+        _shared->waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool result = true;
+        while (!TryLock())
+        {
+            if (timeout < 0)
+            {
+                Futex::Wait(_shared->count, 0, true);
+                continue;
+            }
+
+            int64_t remaining = (finish - NanoTimestamp()).total();
+            if (remaining <= 0)
+            {
+                result = false;
+                break;
+            }
+            Futex::WaitFor(_shared->count, 0, Timespan(remaining), true);
+        }
+        _shared->waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     HANDLE _semaphore;
 #endif
@@ -181,7 +188,7 @@ private:
 
 //! @endcond
 
-NamedSemaphore::NamedSemaphore(const std::string& name, int resources)
+NamedSemaphore::NamedSemaphore(const std::string& name, int resources, uint32_t spin)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -189,7 +196,7 @@ NamedSemaphore::NamedSemaphore(const std::string& name, int resources)
     static_assert(((StorageAlign % alignof(Impl)) == 0), "NamedSemaphore::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(name, resources);
+    new(&_storage)Impl(name, resources, spin);
 }
 
 NamedSemaphore::~NamedSemaphore()
@@ -200,6 +207,7 @@ NamedSemaphore::~NamedSemaphore()
 
 const std::string& NamedSemaphore::name() const { return impl().name(); }
 int NamedSemaphore::resources() const noexcept { return impl().resources(); }
+uint32_t NamedSemaphore::spin() const noexcept { return impl().spin(); }
 
 bool NamedSemaphore::TryLock() { return impl().TryLock(); }
 bool NamedSemaphore::TryLockFor(const Timespan& timespan) { return impl().TryLockFor(timespan); }
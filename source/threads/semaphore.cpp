@@ -14,21 +14,126 @@
 #include <algorithm>
 #include <cassert>
 
-#if defined(__APPLE__)
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+#include "threads/futex.h"
+#include <atomic>
+#elif defined(__APPLE__)
 #include <dispatch/dispatch.h>
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#elif defined(unix) || defined(__unix) || defined(__unix__)
 #include <fcntl.h>
 #include <semaphore.h>
-#elif defined(_WIN32) || defined(_WIN64)
-#include <windows.h>
-#undef max
-#undef min
 #endif
 
 namespace CppCommon {
 
 //! @cond INTERNALS
 
+#if defined(linux) || defined(__linux) || defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+
+class Semaphore::Impl
+{
+public:
+    explicit Impl(int resources) : _resources(resources), _count(resources), _waiters(0)
+    {
+        assert((resources > 0) && "Semaphore resources counter must be greater than zero!");
+    }
+
+    int resources() const noexcept
+    {
+        return _resources;
+    }
+
+    bool TryLock()
+    {
+        uint32_t count = _count.load(std::memory_order_relaxed);
+        while (count > 0)
+            if (_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        return false;
+    }
+
+    bool TryLockFor(const Timespan& timespan)
+    {
+        if (timespan < 0)
+            return TryLock();
+
+        // Calculate a finish timestamp
+        Timestamp finish = NanoTimestamp() + timespan;
+
+        // Try to acquire the semaphore with spinning
+        if (TryLockSpin())
+            return true;
+
+        // Register the blocked thread. Pairs with the fence in Unlock()
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Block until the semaphore resource is available or the timeout expires
+        bool result = true;
+        while (!TryLock())
+        {
+            Timestamp current = NanoTimestamp();
+            if (current >= finish)
+            {
+                result = false;
+                break;
+            }
+
+            Futex::WaitFor(_count, 0, finish - current);
+        }
+
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    void Lock()
+    {
+        // Try to acquire the semaphore with spinning
+        if (TryLockSpin())
+            return;
+
+        // Register the blocked thread. Pairs with the fence in Unlock()
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Block until the semaphore resource is available
+        while (!TryLock())
+            Futex::Wait(_count, 0);
+
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void Unlock()
+    {
+        _count.fetch_add(1, std::memory_order_release);
+
+        // Pairs with the fence in Lock()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Enter the kernel only if there are blocked threads
+        if (_waiters.load(std::memory_order_relaxed) > 0)
+            Futex::WakeOne(_count);
+    }
+
+private:
+    static constexpr int MaxSpin = 100;
+
+    int _resources;
+    std::atomic<uint32_t> _count;
+    std::atomic<uint32_t> _waiters;
+
+    bool TryLockSpin()
+    {
+        // Uncontended path is a single atomic operation
+        for (int spin = 0; spin < MaxSpin; ++spin)
+            if (TryLock())
+                return true;
+        return false;
+    }
+};
+
+#else
+
 class Semaphore::Impl
 {
 public:
@@ -44,10 +149,6 @@ public:
         int result = sem_init(&_semaphore, 0, resources);
         if (result != 0)
             throwex SystemException("Failed to initialize a semaphore!");
-#elif defined(_WIN32) || defined(_WIN64)
-        _semaphore = CreateSemaphore(nullptr, resources, resources, nullptr);
-        if (_semaphore == nullptr)
-            throwex SystemException("Failed to create a semaphore!");
 #endif
     }
 
@@ -60,9 +161,6 @@ public:
         int result = sem_destroy(&_semaphore);
         if (result != 0)
             fatality(SystemException("Failed to destroy a semaphore!"));
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!CloseHandle(_semaphore))
-            fatality(SystemException("Failed to close a semaphore!"));
 #endif
     }
 
@@ -80,11 +178,6 @@ public:
         if ((result != 0) && (errno != EAGAIN))
             throwex SystemException("Failed to try lock a semaphore!");
         return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_semaphore, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a semaphore!");
-        return (result == WAIT_OBJECT_0);
 #endif
     }
 
@@ -103,11 +196,6 @@ public:
         if ((result != 0) && (errno != ETIMEDOUT))
             throwex SystemException("Failed to try lock a semaphore for the given timeout!");
         return (result == 0);
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_semaphore, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
-            throwex SystemException("Failed to try lock a semaphore for the given timeout!");
-        return (result == WAIT_OBJECT_0);
 #endif
     }
 
@@ -119,10 +207,6 @@ public:
         int result = sem_wait(&_semaphore);
         if (result != 0)
             throwex SystemException("Failed to lock a semaphore!");
-#elif defined(_WIN32) || defined(_WIN64)
-        DWORD result = WaitForSingleObject(_semaphore, INFINITE);
-        if (result != WAIT_OBJECT_0)
-            throwex SystemException("Failed to lock a semaphore!");
 #endif
     }
 
@@ -130,13 +214,10 @@ public:
     {
 #if defined(__APPLE__)
         dispatch_semaphore_signal(_semaphore);
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#elif defined(unix) || defined(__unix) || defined(__unix__)
         int result = sem_post(&_semaphore);
         if (result != 0)
             throwex SystemException("Failed to unlock a semaphore!");
-#elif defined(_WIN32) || defined(_WIN64)
-        if (!ReleaseSemaphore(_semaphore, 1, nullptr))
-            throwex SystemException("Failed to unlock a semaphore!");
 #endif
     }
 
@@ -146,11 +227,11 @@ private:
     dispatch_semaphore_t _semaphore;
 #elif defined(unix) || defined(__unix) || defined(__unix__)
     sem_t _semaphore;
-#elif defined(_WIN32) || defined(_WIN64)
-    HANDLE _semaphore;
 #endif
 };
 
+#endif
+
 //! @endcond
 
 Semaphore::Semaphore(int resources)
@@ -0,0 +1,260 @@
+/*!
+    \file task_graph.cpp
+    \brief Task graph executor implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/task_graph.h"
+
+#include "errors/exceptions.h"
+#include "threads/locker.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+TaskGraph::~TaskGraph()
+{
+    // Cancel and wait for the running task graph
+    if (running())
+    {
+        Cancel();
+        Locker<CriticalSection> locker(_cs);
+        _cv.Wait(_cs, [this]() { return !_running; });
+    }
+}
+
+bool TaskGraph::running() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _running;
+}
+
+bool TaskGraph::canceled() const noexcept
+{
+    for (const TaskGraph* graph = this; graph != nullptr; graph = graph->_parent)
+        if (graph->_canceled.load(std::memory_order_acquire))
+            return true;
+    return false;
+}
+
+size_t TaskGraph::Add(Task task)
+{
+    assert(!running() && "Task graph cannot be modified while running!");
+
+    auto node = std::make_unique<Node>();
+    node->task = std::move(task);
+    _nodes.emplace_back(std::move(node));
+    _validated = false;
+    return _nodes.size() - 1;
+}
+
+size_t TaskGraph::Add(TaskGraph& subgraph)
+{
+    assert(!running() && "Task graph cannot be modified while running!");
+
+    if (&subgraph == this)
+        throwex ArgumentException("Task graph cannot be nested into itself!");
+
+    auto node = std::make_unique<Node>();
+    node->subgraph = &subgraph;
+    _nodes.emplace_back(std::move(node));
+    _validated = false;
+    return _nodes.size() - 1;
+}
+
+void TaskGraph::Precede(size_t node, size_t successor)
+{
+    assert(!running() && "Task graph cannot be modified while running!");
+    assert(((node < _nodes.size()) && (successor < _nodes.size())) && "Invalid task graph node index!");
+
+    _nodes[node]->successors.push_back(successor);
+    ++_nodes[successor]->dependencies;
+    _validated = false;
+}
+
+void TaskGraph::Succeed(size_t node, std::initializer_list<size_t> dependencies)
+{
+    for (size_t dependency : dependencies)
+        Precede(dependency, node);
+}
+
+void TaskGraph::Clear()
+{
+    assert(!running() && "Task graph cannot be cleared while running!");
+
+    _nodes.clear();
+    _validated = false;
+}
+
+void TaskGraph::Validate()
+{
+    // Nested subgraphs might be modified independently
+    for (auto& node : _nodes)
+        if (node->subgraph != nullptr)
+            node->subgraph->Validate();
+
+    if (_validated)
+        return;
+
+    // Kahn's topological sort visits all nodes only if the graph is acyclic
+    std::vector<size_t> dependencies(_nodes.size());
+    std::vector<size_t> ready;
+    ready.reserve(_nodes.size());
+    for (size_t i = 0; i < _nodes.size(); ++i)
+    {
+        dependencies[i] = _nodes[i]->dependencies;
+        if (dependencies[i] == 0)
+            ready.push_back(i);
+    }
+    for (size_t i = 0; i < ready.size(); ++i)
+        for (size_t successor : _nodes[ready[i]]->successors)
+            if (--dependencies[successor] == 0)
+                ready.push_back(successor);
+
+    if (ready.size() != _nodes.size())
+        throwex ArgumentException("Task graph contains a cycle!");
+
+    _validated = true;
+}
+
+void TaskGraph::Start(ThreadPool& pool)
+{
+    assert(!running() && "Task graph is already running!");
+
+    Validate();
+    Launch(pool, nullptr, 0);
+}
+
+void TaskGraph::Wait()
+{
+    assert(((_pool == nullptr) || (_pool->current() < 0)) && "Task graph must not be waited from worker threads of its thread pool!");
+
+    std::exception_ptr exception;
+    {
+        Locker<CriticalSection> locker(_cs);
+        _cv.Wait(_cs, [this]() { return !_running; });
+        std::swap(exception, _exception);
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void TaskGraph::Launch(ThreadPool& pool, TaskGraph* parent, size_t parent_node)
+{
+    // Reset the execution state without reallocation
+    _pool = &pool;
+    _parent = parent;
+    _parent_node = parent_node;
+    _canceled.store(false, std::memory_order_relaxed);
+    _pending.store(_nodes.size(), std::memory_order_relaxed);
+    for (auto& node : _nodes)
+        node->remaining.store(node->dependencies, std::memory_order_relaxed);
+    {
+        Locker<CriticalSection> locker(_cs);
+        _exception = nullptr;
+        _running = true;
+    }
+
+    if (_nodes.empty())
+    {
+        Complete();
+        return;
+    }
+
+    // Schedule root nodes. Scheduling might complete the graph, so the count
+    // of nodes must not be accessed after the last root node is scheduled.
+    size_t count = _nodes.size();
+    size_t last = count;
+    for (size_t i = 0; i < count; ++i)
+        if (_nodes[i]->dependencies == 0)
+            last = i;
+    for (size_t i = 0; i < last; ++i)
+        if (_nodes[i]->dependencies == 0)
+            Schedule(i);
+    Schedule(last);
+}
+
+void TaskGraph::Schedule(size_t index)
+{
+    // Execute the node in place if the thread pool rejects it
+    if (!_pool->Post([this, index]() { Execute(index); }))
+        Execute(index);
+}
+
+void TaskGraph::Execute(size_t index)
+{
+    Node& node = *_nodes[index];
+
+    if (!canceled())
+    {
+        // Subgraph finishes its node when all its tasks are completed
+        if (node.subgraph != nullptr)
+        {
+            node.subgraph->Launch(*_pool, this, index);
+            return;
+        }
+
+        try
+        {
+            node.task();
+        }
+        catch (...)
+        {
+            Fail(std::current_exception());
+        }
+    }
+
+    Finish(index);
+}
+
+void TaskGraph::Finish(size_t index)
+{
+    Node& node = *_nodes[index];
+
+    for (size_t successor : node.successors)
+        if (_nodes[successor]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            Schedule(successor);
+
+    if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        Complete();
+}
+
+void TaskGraph::Complete()
+{
+    // The task graph might be destroyed by its waiter as soon as it is not running
+    TaskGraph* parent = _parent;
+    size_t parent_node = _parent_node;
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        // Propagate the exception to the parent graph
+        if ((parent != nullptr) && _exception)
+        {
+            parent->Fail(_exception);
+            _exception = nullptr;
+        }
+
+        _running = false;
+        _cv.NotifyAll();
+    }
+
+    if (parent != nullptr)
+        parent->Finish(parent_node);
+}
+
+void TaskGraph::Fail(std::exception_ptr exception)
+{
+    {
+        Locker<CriticalSection> locker(_cs);
+        if (!_exception)
+            _exception = exception;
+    }
+
+    Cancel();
+}
+
+} // namespace CppCommon
@@ -14,10 +14,15 @@
 #include <algorithm>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
 #include <errno.h>
 #include <pthread.h>
 #include <sched.h>
 #include <time.h>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <winternl.h>
@@ -25,6 +30,9 @@
 #undef max
 #undef min
 #define STATUS_SUCCESS 0x00000000
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 #endif
 
 namespace CppCommon {
@@ -32,6 +40,40 @@ namespace CppCommon {
 //! @cond INTERNALS
 namespace Internals {
 
+#if defined(__APPLE__)
+// Helper function to get CPU times of the given Mach thread
+bool GetMachThreadTimes(mach_port_t port, Timespan& user, Timespan& system)
+{
+    thread_basic_info_data_t info;
+    mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+    if (thread_info(port, THREAD_BASIC_INFO, (thread_info_t)&info, &count) != KERN_SUCCESS)
+        return false;
+    user = Timespan::seconds(info.user_time.seconds) + Timespan::microseconds(info.user_time.microseconds);
+    system = Timespan::seconds(info.system_time.seconds) + Timespan::microseconds(info.system_time.microseconds);
+    return true;
+}
+#elif defined(_WIN32) || defined(_WIN64)
+// Helper function to convert FILETIME duration in 100 nanoseconds units into timespan
+Timespan FileTimeToTimespan(const FILETIME& ft)
+{
+    ULARGE_INTEGER value;
+    value.LowPart = ft.dwLowDateTime;
+    value.HighPart = ft.dwHighDateTime;
+    return Timespan::nanoseconds((int64_t)value.QuadPart * 100);
+}
+
+// Helper function to get CPU times of the given thread
+bool GetWindowsThreadTimes(HANDLE hThread, Timespan& user, Timespan& system)
+{
+    FILETIME creation, exit, kernel, usermode;
+    if (!GetThreadTimes(hThread, &creation, &exit, &kernel, &usermode))
+        return false;
+    user = FileTimeToTimespan(usermode);
+    system = FileTimeToTimespan(kernel);
+    return true;
+}
+#endif
+
 #if defined(_WIN32) || defined(_WIN64)
 // Helper function to set minimum resolution of the Windows Timer
 uint64_t SetMinimumTimerResolution()
@@ -52,8 +94,162 @@ uint64_t SetMinimumTimerResolution()
     }
     return 1000000;
 }
+
+// Helper function to get the global logical CPU index of the first CPU in the given processor group
+int GetProcessorGroupBase(WORD group)
+{
+    int base = 0;
+    for (WORD i = 0; i < group; ++i)
+        base += (int)GetActiveProcessorCount(i);
+    return base;
+}
+
+// Helper function to get the CPU affinity set of the given thread
+bool GetThreadAffinitySet(HANDLE hThread, CPUSet& affinity)
+{
+    GROUP_AFFINITY ga;
+    ZeroMemory(&ga, sizeof(ga));
+    if (!GetThreadGroupAffinity(hThread, &ga))
+        return false;
+
+    int base = GetProcessorGroupBase(ga.Group);
+    for (int bit = 0; bit < (int)(sizeof(KAFFINITY) * 8); ++bit)
+        if ((ga.Mask & ((KAFFINITY)1 << bit)) != 0)
+            affinity.set(base + bit);
+    return true;
+}
+
+// Helper function to set the CPU affinity set of the given thread
+bool SetThreadAffinitySet(HANDLE hThread, const CPUSet& affinity)
+{
+    int first = affinity.first();
+    if (first < 0)
+        return false;
+
+    // Find the processor group of the first CPU
+    WORD groups = GetActiveProcessorGroupCount();
+    WORD group = 0;
+    int base = 0;
+    while (((group + 1) < groups) && (first >= (base + (int)GetActiveProcessorCount(group))))
+        base += (int)GetActiveProcessorCount(group++);
+
+    // All CPUs must belong to the same processor group
+    GROUP_AFFINITY ga;
+    ZeroMemory(&ga, sizeof(ga));
+    ga.Group = group;
+    for (int cpu = first; cpu >= 0; cpu = affinity.next(cpu))
+    {
+        int bit = cpu - base;
+        if ((bit < 0) || (bit >= (int)GetActiveProcessorCount(group)))
+            return false;
+        ga.Mask |= ((KAFFINITY)1 << bit);
+    }
+
+    return SetThreadGroupAffinity(hThread, &ga, nullptr) != FALSE;
+}
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+// Helper function to get the CPU affinity set of the given thread
+bool GetThreadAffinitySet(pthread_t thread, CPUSet& affinity)
+{
+    // Grow the dynamic CPU set until it fits all kernel CPUs
+    long configured = sysconf(_SC_NPROCESSORS_CONF);
+    for (size_t cpus = (size_t)std::max(configured, (long)CPU_SETSIZE); cpus <= 65536; cpus *= 2)
+    {
+        cpu_set_t* cpuset = CPU_ALLOC(cpus);
+        if (cpuset == nullptr)
+            return false;
+
+        size_t size = CPU_ALLOC_SIZE(cpus);
+        CPU_ZERO_S(size, cpuset);
+        int result = pthread_getaffinity_np(thread, size, cpuset);
+        if (result == 0)
+        {
+            affinity.clear();
+            for (size_t i = 0; i < cpus; ++i)
+                if (CPU_ISSET_S(i, size, cpuset))
+                    affinity.set((int)i);
+        }
+        CPU_FREE(cpuset);
+
+        if (result != EINVAL)
+            return (result == 0);
+    }
+    return false;
+}
+
+// Helper function to set the CPU affinity set of the given thread
+bool SetThreadAffinitySet(pthread_t thread, const CPUSet& affinity)
+{
+    size_t cpus = (size_t)std::max(affinity.size(), (int)CPU_SETSIZE);
+    cpu_set_t* cpuset = CPU_ALLOC(cpus);
+    if (cpuset == nullptr)
+        return false;
+
+    size_t size = CPU_ALLOC_SIZE(cpus);
+    CPU_ZERO_S(size, cpuset);
+    for (int cpu = affinity.first(); cpu >= 0; cpu = affinity.next(cpu))
+        CPU_SET_S(cpu, size, cpuset);
+    int result = pthread_setaffinity_np(thread, size, cpuset);
+    CPU_FREE(cpuset);
+    return (result == 0);
+}
 #endif
 
+#if defined(_WIN32) || defined(_WIN64)
+// Initial OS sleep overshoot estimation of the precise sleep in nanoseconds
+const int64_t PRECISE_SLEEP_OVERSHOOT = 1000000;
+// Minimal OS sleep overshoot estimation of the precise sleep in nanoseconds
+const int64_t PRECISE_SLEEP_OVERSHOOT_MIN = 50000;
+// Maximal OS sleep overshoot estimation of the precise sleep in nanoseconds
+const int64_t PRECISE_SLEEP_OVERSHOOT_MAX = 4000000;
+
+// High resolution waitable timer of the current thread
+class PreciseSleepTimer
+{
+public:
+    PreciseSleepTimer() : _timer(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS)) {}
+    ~PreciseSleepTimer() { if (_timer != nullptr) CloseHandle(_timer); }
+
+    // Sleep for the given nanoseconds and return false if the timer is not supported
+    bool Sleep(int64_t nanoseconds) noexcept
+    {
+        if (_timer == nullptr)
+            return false;
+
+        LARGE_INTEGER due;
+        due.QuadPart = -(nanoseconds / 100);
+        if (!SetWaitableTimerEx(_timer, &due, 0, nullptr, nullptr, nullptr, 0))
+            return false;
+
+        return (WaitForSingleObject(_timer, INFINITE) == WAIT_OBJECT_0);
+    }
+
+private:
+    HANDLE _timer;
+};
+#else
+// Initial OS sleep overshoot estimation of the precise sleep in nanoseconds
+const int64_t PRECISE_SLEEP_OVERSHOOT = 100000;
+// Minimal OS sleep overshoot estimation of the precise sleep in nanoseconds
+const int64_t PRECISE_SLEEP_OVERSHOOT_MIN = 10000;
+// Maximal OS sleep overshoot estimation of the precise sleep in nanoseconds
+const int64_t PRECISE_SLEEP_OVERSHOOT_MAX = 2000000;
+#endif
+
+// OS sleep overshoot estimation of the current thread in nanoseconds
+thread_local int64_t precise_sleep_overshoot = PRECISE_SLEEP_OVERSHOOT;
+
+// Helper function to sleep the bulk of the precise sleep interval with the OS timer
+void PreciseSleepOS(int64_t nanoseconds) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    thread_local PreciseSleepTimer timer;
+    if (timer.Sleep(nanoseconds))
+        return;
+#endif
+    Thread::SleepFor(Timespan::nanoseconds(nanoseconds));
+}
+
 } // namespace Internals
 //! @endcond
 
@@ -140,6 +336,43 @@ void Thread::SleepFor(const Timespan& timespan) noexcept
 #endif
 }
 
+void Thread::SleepPreciseUntil(const TscTimestamp& timestamp, const Timespan& spin) noexcept
+{
+    int64_t deadline = (int64_t)timestamp.total();
+    bool adaptive = (spin <= 0);
+
+    // Sleep with the OS timer while the remaining time exceeds the spin interval
+    for (;;)
+    {
+        int64_t now = (int64_t)Timestamp::tsc();
+        int64_t remaining = deadline - now;
+        if (remaining <= 0)
+            return;
+
+        int64_t margin = adaptive ? Internals::precise_sleep_overshoot : spin.total();
+        if (remaining <= margin)
+            break;
+
+        int64_t sleep = remaining - margin;
+        Internals::PreciseSleepOS(sleep);
+
+        // Follow the measured OS sleep overshoot: grow at once, decay slowly
+        if (adaptive)
+        {
+            int64_t overshoot = std::max((int64_t)Timestamp::tsc() - now - sleep, (int64_t)0);
+            int64_t& estimation = Internals::precise_sleep_overshoot;
+            if (overshoot > estimation)
+                estimation = std::min(overshoot, Internals::PRECISE_SLEEP_OVERSHOOT_MAX);
+            else
+                estimation = std::max(estimation - (estimation - overshoot) / 8, Internals::PRECISE_SLEEP_OVERSHOOT_MIN);
+        }
+    }
+
+    // Spin-wait the remainder on the calibrated TSC clock
+    while ((int64_t)Timestamp::tsc() < deadline)
+        Pause();
+}
+
 void Thread::Yield() noexcept
 {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -149,6 +382,95 @@ void Thread::Yield() noexcept
 #endif
 }
 
+ThreadUsage& ThreadUsage::operator+=(const ThreadUsage& usage) noexcept
+{
+    user += usage.user;
+    system += usage.system;
+    voluntary_switches += usage.voluntary_switches;
+    involuntary_switches += usage.involuntary_switches;
+    minor_faults += usage.minor_faults;
+    major_faults += usage.major_faults;
+    return *this;
+}
+
+ThreadUsage& ThreadUsage::operator-=(const ThreadUsage& usage) noexcept
+{
+    user -= usage.user;
+    system -= usage.system;
+    voluntary_switches -= usage.voluntary_switches;
+    involuntary_switches -= usage.involuntary_switches;
+    minor_faults -= usage.minor_faults;
+    major_faults -= usage.major_faults;
+    return *this;
+}
+
+Timespan Thread::CpuTime() noexcept
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return Timespan::zero();
+    return Timespan::nanoseconds((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+#elif defined(_WIN32) || defined(_WIN64)
+    Timespan user, system;
+    if (!Internals::GetWindowsThreadTimes(GetCurrentThread(), user, system))
+        return Timespan::zero();
+    return user + system;
+#endif
+}
+
+Timespan Thread::CpuTime(std::thread& thread)
+{
+#if defined(__APPLE__)
+    Timespan user, system;
+    if (!Internals::GetMachThreadTimes(pthread_mach_thread_np(thread.native_handle()), user, system))
+        throwex SystemException("Failed to get the given thread CPU time!");
+    return user + system;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    clockid_t clock;
+    int result = pthread_getcpuclockid(thread.native_handle(), &clock);
+    if (result != 0)
+        throwex SystemException("Failed to get the given thread CPU clock!", result);
+    struct timespec ts;
+    if (clock_gettime(clock, &ts) != 0)
+        throwex SystemException("Failed to get the given thread CPU time!");
+    return Timespan::nanoseconds((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+#elif defined(_WIN32) || defined(_WIN64)
+    Timespan user, system;
+    if (!Internals::GetWindowsThreadTimes((HANDLE)thread.native_handle(), user, system))
+        throwex SystemException("Failed to get the given thread CPU time!");
+    return user + system;
+#endif
+}
+
+ThreadUsage Thread::Usage()
+{
+    ThreadUsage usage;
+#if defined(__APPLE__)
+    mach_port_t port = mach_thread_self();
+    bool result = Internals::GetMachThreadTimes(port, usage.user, usage.system);
+    mach_port_deallocate(mach_task_self(), port);
+    if (!result)
+        throwex SystemException("Failed to get the current thread resource usage!");
+#elif defined(__CYGWIN__)
+    usage.user = CpuTime();
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    struct rusage ru;
+    if (getrusage(RUSAGE_THREAD, &ru) != 0)
+        throwex SystemException("Failed to get the current thread resource usage!");
+    usage.user = Timespan::seconds(ru.ru_utime.tv_sec) + Timespan::microseconds(ru.ru_utime.tv_usec);
+    usage.system = Timespan::seconds(ru.ru_stime.tv_sec) + Timespan::microseconds(ru.ru_stime.tv_usec);
+    usage.voluntary_switches = (uint64_t)ru.ru_nvcsw;
+    usage.involuntary_switches = (uint64_t)ru.ru_nivcsw;
+    usage.minor_faults = (uint64_t)ru.ru_minflt;
+    usage.major_faults = (uint64_t)ru.ru_majflt;
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!Internals::GetWindowsThreadTimes(GetCurrentThread(), usage.user, usage.system))
+        throwex SystemException("Failed to get the current thread resource usage!");
+#endif
+    return usage;
+}
+
 std::bitset<64> Thread::GetAffinity()
 {
 #if defined(__APPLE__) || defined(__CYGWIN__)
@@ -295,6 +617,76 @@ void Thread::SetAffinity(std::thread& thread, const std::bitset<64>& affinity)
 #endif
 }
 
+CPUSet Thread::GetAffinitySet()
+{
+#if defined(__APPLE__) || defined(__CYGWIN__)
+    CPUSet affinity;
+    for (int i = 0; i < CPU::Affinity(); ++i)
+        affinity.set(i);
+    return affinity;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    CPUSet affinity;
+    if (!Internals::GetThreadAffinitySet(pthread_self(), affinity))
+        throwex SystemException("Failed to get the current thread CPU affinity!");
+    return affinity;
+#elif defined(_WIN32) || defined(_WIN64)
+    CPUSet affinity;
+    if (!Internals::GetThreadAffinitySet(GetCurrentThread(), affinity))
+        throwex SystemException("Failed to get the current thread CPU affinity!");
+    return affinity;
+#endif
+}
+
+CPUSet Thread::GetAffinitySet(std::thread& thread)
+{
+#if defined(__APPLE__) || defined(__CYGWIN__)
+    CPUSet affinity;
+    for (int i = 0; i < CPU::Affinity(); ++i)
+        affinity.set(i);
+    return affinity;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    CPUSet affinity;
+    if (!Internals::GetThreadAffinitySet(thread.native_handle(), affinity))
+        throwex SystemException("Failed to get the given thread CPU affinity!");
+    return affinity;
+#elif defined(_WIN32) || defined(_WIN64)
+    CPUSet affinity;
+    if (!Internals::GetThreadAffinitySet((HANDLE)thread.native_handle(), affinity))
+        throwex SystemException("Failed to get the given thread CPU affinity!");
+    return affinity;
+#endif
+}
+
+void Thread::SetAffinity(const CPUSet& affinity)
+{
+#if defined(__APPLE__)
+    throwex SystemException("Apple platform does not allow to set the current thread CPU affinity!");
+#elif defined(__CYGWIN__)
+    throwex SystemException("Cygwin platform does not allow to set the current thread CPU affinity!");
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    if (!Internals::SetThreadAffinitySet(pthread_self(), affinity))
+        throwex SystemException("Failed to set the current thread CPU affinity!");
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!Internals::SetThreadAffinitySet(GetCurrentThread(), affinity))
+        throwex SystemException("Failed to set the current thread CPU affinity!");
+#endif
+}
+
+void Thread::SetAffinity(std::thread& thread, const CPUSet& affinity)
+{
+#if defined(__APPLE__)
+    throwex SystemException("Apple platform does not allow to set the given thread CPU affinity!");
+#elif defined(__CYGWIN__)
+    throwex SystemException("Cygwin platform does not allow to set the given thread CPU affinity!");
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    if (!Internals::SetThreadAffinitySet(thread.native_handle(), affinity))
+        throwex SystemException("Failed to set the given thread CPU affinity!");
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!Internals::SetThreadAffinitySet((HANDLE)thread.native_handle(), affinity))
+        throwex SystemException("Failed to set the given thread CPU affinity!");
+#endif
+}
+
 ThreadPriority Thread::GetPriority()
 {
 #if defined(__CYGWIN__)
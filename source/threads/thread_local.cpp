@@ -0,0 +1,156 @@
+/*!
+    \file thread_local.cpp
+    \brief Thread local storage object implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_local.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+namespace {
+
+// Slots owner of the thread
+class ThreadLocalOwner
+{
+public:
+    ThreadLocalOwner() = default;
+    ~ThreadLocalOwner();
+
+    std::vector<ThreadLocalEntry*> slots;
+};
+
+// Registry of thread local objects and threads
+struct ThreadLocalRegistry
+{
+    std::mutex mutex;
+    std::vector<ThreadLocalBase*> instances;
+    std::vector<size_t> free;
+};
+
+ThreadLocalRegistry& GetRegistry()
+{
+    static ThreadLocalRegistry registry;
+    return registry;
+}
+
+ThreadLocalOwner& GetOwner()
+{
+    thread_local ThreadLocalOwner owner;
+    return owner;
+}
+
+ThreadLocalOwner::~ThreadLocalOwner()
+{
+    ThreadLocalRegistry& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+
+    // Retire entries of the exited thread
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        ThreadLocalEntry* entry = slots[i];
+        if (entry == nullptr)
+            continue;
+        slots[i] = nullptr;
+        ThreadLocalBase* instance = registry.instances[i];
+        instance->Detach(entry);
+        instance->Retire(entry);
+    }
+
+    thread_local_slots = { nullptr, 0 };
+}
+
+} // namespace
+
+ThreadLocalBase::ThreadLocalBase() : _head(nullptr), _size(0)
+{
+    ThreadLocalRegistry& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+
+    // Reuse the free slot index
+    if (!registry.free.empty())
+    {
+        _index = registry.free.back();
+        registry.free.pop_back();
+        registry.instances[_index] = this;
+    }
+    else
+    {
+        _index = registry.instances.size();
+        registry.instances.push_back(this);
+    }
+}
+
+void ThreadLocalBase::Attach(ThreadLocalEntry* entry)
+{
+    // Owner of the current thread is created on the first access
+    ThreadLocalOwner& owner = GetOwner();
+
+    ThreadLocalRegistry& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+
+    if (owner.slots.size() <= _index)
+    {
+        owner.slots.resize(std::max(_index + 1, owner.slots.size() * 2), nullptr);
+        thread_local_slots = { owner.slots.data(), owner.slots.size() };
+    }
+    owner.slots[_index] = entry;
+    entry->owner = &owner;
+
+    std::scoped_lock lock_entries(_mutex);
+    entry->prev = nullptr;
+    entry->next = _head;
+    if (_head != nullptr)
+        _head->prev = entry;
+    _head = entry;
+    ++_size;
+}
+
+void ThreadLocalBase::Detach(ThreadLocalEntry* entry) noexcept
+{
+    std::scoped_lock lock(_mutex);
+    if (entry->prev != nullptr)
+        entry->prev->next = entry->next;
+    else
+        _head = entry->next;
+    if (entry->next != nullptr)
+        entry->next->prev = entry->prev;
+    entry->prev = entry->next = nullptr;
+    --_size;
+}
+
+void ThreadLocalBase::Destroy() noexcept
+{
+    ThreadLocalRegistry& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+
+    // Destroy entries of all threads
+    {
+        std::scoped_lock lock_entries(_mutex);
+        while (_head != nullptr)
+        {
+            ThreadLocalEntry* entry = _head;
+            _head = entry->next;
+            static_cast<ThreadLocalOwner*>(entry->owner)->slots[_index] = nullptr;
+            delete entry;
+        }
+        _size = 0;
+    }
+
+    // Release the slot index
+    registry.instances[_index] = nullptr;
+    registry.free.push_back(_index);
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
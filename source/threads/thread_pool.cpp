@@ -0,0 +1,230 @@
+/*!
+    \file thread_pool.cpp
+    \brief Work-stealing thread pool implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_pool.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Spin attempts of the idle worker before parking
+const int THREAD_POOL_SPINS = 64;
+
+// Current worker thread
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+} // namespace Internals
+//! @endcond
+
+ThreadPool::ThreadPool(size_t threads, size_t capacity, bool pinning)
+    : _queue(capacity),
+      _idle(0),
+      _pending(0),
+      _stopping(false),
+      _stopped(false)
+{
+    size_t cores = std::max((size_t)std::thread::hardware_concurrency(), (size_t)1);
+    if (threads == 0)
+        threads = cores;
+
+    // Create workers before start them, because workers steal from each other
+    _workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        _workers.emplace_back(std::make_unique<Worker>());
+        _workers.back()->random = 0x9E3779B97F4A7C15ull * (i + 1);
+    }
+
+    // Start worker threads
+    for (size_t i = 0; i < threads; ++i)
+    {
+        _workers[i]->thread = Thread::Start([this, i]() { Execute(i); });
+
+        // Pin the worker thread to the CPU core
+        if (pinning)
+        {
+            std::bitset<64> affinity;
+            affinity.set(i % std::min(cores, (size_t)64));
+            Thread::SetAffinity(_workers[i]->thread, affinity);
+        }
+    }
+}
+
+int ThreadPool::current() const noexcept
+{
+    return (Internals::current_pool == this) ? (int)Internals::current_worker : -1;
+}
+
+bool ThreadPool::Post(Task task)
+{
+    int index = current();
+
+    // Worker threads could post nested tasks until they are stopped
+    if ((index < 0) && _stopping.load(std::memory_order_acquire))
+        return false;
+
+    Task* instance = new Task(std::move(task));
+    _pending.fetch_add(1, std::memory_order_acq_rel);
+
+    if (index >= 0)
+    {
+        // Push the task into the deque of the current worker
+        _workers[index]->deque.Push(instance);
+    }
+    else if (!_queue.Enqueue(instance))
+    {
+        // Global injection queue is full
+        delete instance;
+        if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Locker<CriticalSection> locker(_cs);
+            _cv.NotifyAll();
+        }
+        return false;
+    }
+
+    Notify();
+    return true;
+}
+
+void ThreadPool::Wait()
+{
+    assert((current() < 0) && "Thread pool must not be waited from its worker threads!");
+
+    Locker<CriticalSection> locker(_cs);
+    _cv.Wait(_cs, [this]() { return _pending.load(std::memory_order_acquire) == 0; });
+}
+
+void ThreadPool::Stop()
+{
+    assert((current() < 0) && "Thread pool must not be stopped from its worker threads!");
+
+    if (_stopped.exchange(true))
+        return;
+
+    _stopping.store(true, std::memory_order_release);
+
+    // Wake up parked workers. Each stopped worker wakes up the next one.
+    _wakeup.Signal();
+    for (auto& worker : _workers)
+        if (worker->thread.joinable())
+            worker->thread.join();
+
+    // Complete tasks posted concurrently with the stop
+    Task* task;
+    while (_queue.Dequeue(task))
+        Run(task);
+    for (auto& worker : _workers)
+        while (worker->deque.Pop(task))
+            Run(task);
+}
+
+void ThreadPool::Execute(size_t index)
+{
+    Internals::current_pool = this;
+    Internals::current_worker = index;
+
+    Task* task;
+    for (;;)
+    {
+        // Fetch the next task or spin for a while
+        bool found = Fetch(index, task);
+        for (int i = 0; !found && (i < Internals::THREAD_POOL_SPINS); ++i)
+        {
+            Thread::Yield();
+            found = Fetch(index, task);
+        }
+
+        if (!found)
+        {
+            if (_stopping.load(std::memory_order_acquire))
+                break;
+
+            // Park the idle worker. Recheck tasks after the idle registration to avoid lost wake-ups.
+            _idle.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            found = Fetch(index, task);
+            if (!found && !_stopping.load(std::memory_order_acquire))
+                _wakeup.Wait();
+            _idle.fetch_sub(1, std::memory_order_seq_cst);
+
+            if (!found)
+                continue;
+        }
+
+        // Wake up another idle worker to share remaining tasks
+        if (!_queue.empty() || !_workers[index]->deque.empty())
+            Notify();
+
+        Run(task);
+    }
+
+    // Wake up the next parked worker to stop
+    _wakeup.Signal();
+
+    Internals::current_pool = nullptr;
+}
+
+bool ThreadPool::Fetch(size_t index, Task*& task)
+{
+    Worker& worker = *_workers[index];
+
+    // Take the task from the own deque
+    if (worker.deque.Pop(task))
+        return true;
+
+    // Take the task from the global injection queue
+    if (_queue.Dequeue(task))
+        return true;
+
+    // Steal the task from other workers starting from the random victim
+    size_t count = _workers.size();
+    if (count > 1)
+    {
+        worker.random ^= worker.random << 13;
+        worker.random ^= worker.random >> 7;
+        worker.random ^= worker.random << 17;
+
+        size_t start = (size_t)(worker.random % count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t victim = (start + i) % count;
+            if ((victim != index) && _workers[victim]->deque.Steal(task))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::Run(Task* task)
+{
+    std::unique_ptr<Task> instance(task);
+    (*instance)();
+    instance.reset();
+
+    // Notify waiters about all tasks are completed
+    if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Locker<CriticalSection> locker(_cs);
+        _cv.NotifyAll();
+    }
+}
+
+void ThreadPool::Notify()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_idle.load(std::memory_order_relaxed) > 0)
+        _wakeup.Signal();
+}
+
+} // namespace CppCommon
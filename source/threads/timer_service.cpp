@@ -0,0 +1,283 @@
+/*!
+    \file timer_service.cpp
+    \brief Timer service implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/timer_service.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const uint32_t INVALID_POSITION = std::numeric_limits<uint32_t>::max();
+const int64_t INFINITE_DEADLINE = std::numeric_limits<int64_t>::max();
+
+} // namespace Internals
+//! @endcond
+
+TimerService::TimerService(const Executor& executor, const Timespan& slack)
+    : _executor(executor),
+      _slack(std::max(slack.total(), (int64_t)0)),
+      _armed(Internals::INFINITE_DEADLINE),
+      _count(0),
+      _stopped(false)
+{
+    // Start the timer thread
+    _thread = Thread::Start([this]() { Execute(); });
+}
+
+TimerService::TimerId TimerService::ScheduleAfter(const Timespan& timespan, Task task)
+{
+    return Schedule(NanoTimestamp().total() + std::max(timespan.total(), (int64_t)0), 0, std::move(task));
+}
+
+TimerService::TimerId TimerService::ScheduleEvery(const Timespan& period, Task task)
+{
+    assert((period.total() > 0) && "Timer period must be greater than zero!");
+    if (period.total() <= 0)
+        return 0;
+
+    return Schedule(NanoTimestamp().total() + period.total(), period.total(), std::move(task));
+}
+
+TimerService::TimerId TimerService::Schedule(int64_t deadline, int64_t period, Task&& task)
+{
+    assert(task && "Timer task must be valid!");
+    if (!task)
+        return 0;
+
+    bool wakeup = false;
+    TimerId result;
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        if (stopped())
+            return 0;
+
+        // Get the free timer slot
+        uint32_t slot;
+        if (!_free.empty())
+        {
+            slot = _free.back();
+            _free.pop_back();
+        }
+        else
+        {
+            slot = (uint32_t)_timers.size();
+            _timers.push_back({ nullptr, 0, 1, Internals::INVALID_POSITION });
+        }
+
+        Timer& timer = _timers[slot];
+        timer.task = std::move(task);
+        timer.period = period;
+
+        // Push the timer into the timers heap
+        Push({ deadline, slot });
+        _count.store(_heap.size(), std::memory_order_release);
+
+        // Wake up the timer thread only if the new deadline is earlier than the armed one
+        if (deadline < _armed)
+        {
+            _armed = deadline;
+            wakeup = true;
+        }
+
+        result = ((TimerId)timer.generation << 32) | slot;
+    }
+
+    if (wakeup)
+        _wakeup.Signal();
+
+    return result;
+}
+
+bool TimerService::Cancel(TimerId timer)
+{
+    uint32_t slot = (uint32_t)(timer & 0xFFFFFFFF);
+    uint32_t generation = (uint32_t)(timer >> 32);
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Check the timer slot and its generation
+    if ((slot >= _timers.size()) || (_timers[slot].generation != generation) || (_timers[slot].position == Internals::INVALID_POSITION))
+        return false;
+
+    // Remove the timer from the timers heap. The timer thread is not woken up,
+    // so it will wake up once for nothing at the cancelled deadline.
+    Remove(_timers[slot].position);
+    _count.store(_heap.size(), std::memory_order_release);
+    Release(slot);
+    return true;
+}
+
+void TimerService::Stop()
+{
+    if (_stopped.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    // Wake up and join the timer thread
+    _wakeup.Signal();
+    if (_thread.joinable())
+        _thread.join();
+
+    // Drop all scheduled timers
+    Locker<CriticalSection> locker(_cs);
+    _heap.clear();
+    _free.clear();
+    _timers.clear();
+    _count.store(0, std::memory_order_release);
+}
+
+void TimerService::Release(uint32_t slot)
+{
+    Timer& timer = _timers[slot];
+    timer.task = nullptr;
+    timer.position = Internals::INVALID_POSITION;
+
+    // Invalidate all Ids of the released timer (zero generation is skipped to keep zero Id invalid)
+    if (++timer.generation == 0)
+        timer.generation = 1;
+
+    _free.push_back(slot);
+}
+
+void TimerService::Execute()
+{
+    std::vector<Task> expired;
+
+    while (!stopped())
+    {
+        int64_t timeout;
+        {
+            Locker<CriticalSection> locker(_cs);
+
+            // Collect all timers expired within the slack
+            int64_t now = NanoTimestamp().total();
+            while (!_heap.empty() && (_heap[0].deadline <= (now + _slack)))
+            {
+                uint32_t slot = _heap[0].slot;
+                Timer& timer = _timers[slot];
+                if (timer.period > 0)
+                {
+                    expired.push_back(timer.task);
+
+                    // Reschedule the periodic timer skipping missed periods
+                    int64_t deadline = _heap[0].deadline + timer.period;
+                    if (deadline <= now)
+                        deadline = now + timer.period;
+                    _heap[0].deadline = deadline;
+                    SiftDown(0);
+                }
+                else
+                {
+                    expired.push_back(std::move(timer.task));
+                    Remove(0);
+                    Release(slot);
+                }
+            }
+            _count.store(_heap.size(), std::memory_order_release);
+
+            // Arm the timer thread with the earliest deadline
+            _armed = _heap.empty() ? Internals::INFINITE_DEADLINE : _heap[0].deadline;
+            timeout = _heap.empty() ? -1 : (_armed - now);
+        }
+
+        // Dispatch expired timers tasks outside the critical section
+        for (auto& task : expired)
+        {
+            if (_executor)
+                _executor(std::move(task));
+            else
+                task();
+        }
+        expired.clear();
+
+        // Sleep until the earliest deadline or the earlier timer is scheduled
+        if (timeout < 0)
+            _wakeup.Wait();
+        else
+            _wakeup.TryWaitFor(Timespan(timeout));
+    }
+}
+
+void TimerService::Push(const Entry& entry)
+{
+    _heap.push_back(entry);
+    _timers[entry.slot].position = (uint32_t)(_heap.size() - 1);
+    SiftUp((uint32_t)(_heap.size() - 1));
+}
+
+void TimerService::Remove(uint32_t position)
+{
+    assert((position < _heap.size()) && "Invalid timers heap position!");
+
+    _timers[_heap[position].slot].position = Internals::INVALID_POSITION;
+
+    // Replace the removed entry with the last one and restore the heap order
+    size_t last = _heap.size() - 1;
+    if (position != last)
+    {
+        Place(_heap[last], position);
+        _heap.pop_back();
+        if ((position > 0) && (_heap[position].deadline < _heap[(position - 1) / 4].deadline))
+            SiftUp(position);
+        else
+            SiftDown(position);
+    }
+    else
+        _heap.pop_back();
+}
+
+void TimerService::SiftUp(uint32_t position)
+{
+    Entry entry = _heap[position];
+    while (position > 0)
+    {
+        uint32_t parent = (position - 1) / 4;
+        if (_heap[parent].deadline <= entry.deadline)
+            break;
+        Place(_heap[parent], position);
+        position = parent;
+    }
+    Place(entry, position);
+}
+
+void TimerService::SiftDown(uint32_t position)
+{
+    Entry entry = _heap[position];
+    size_t size = _heap.size();
+    for (;;)
+    {
+        // Find the earliest child of the current entry
+        size_t first = 4 * (size_t)position + 1;
+        if (first >= size)
+            break;
+        size_t last = std::min(first + 4, size);
+        size_t child = first;
+        for (size_t i = first + 1; i < last; ++i)
+            if (_heap[i].deadline < _heap[child].deadline)
+                child = i;
+
+        if (entry.deadline <= _heap[child].deadline)
+            break;
+        Place(_heap[child], position);
+        position = (uint32_t)child;
+    }
+    Place(entry, position);
+}
+
+void TimerService::Place(const Entry& entry, uint32_t position)
+{
+    _heap[position] = entry;
+    _timers[entry.slot].position = position;
+}
+
+} // namespace CppCommon
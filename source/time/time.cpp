@@ -10,30 +10,158 @@
 
 #include "string/format.h"
 
+#include <atomic>
 #include <cassert>
 
 #include <time.h>
 
 namespace CppCommon {
 
-Time::Time(const Timestamp& timestamp)
+//! @cond INTERNALS
+namespace Internals {
+
+// Seconds in one day
+const int64_t DAY_SECONDS = 86400;
+// Seconds in the local time offset cache slot (most of time zone transitions are aligned to 15 minutes)
+const int64_t SLOT_SECONDS = 900;
+
+int64_t FloorDiv(int64_t value, int64_t divisor) noexcept
+{
+    return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+}
+
+// Convert days since 1970-01-01 to the civil date (http://howardhinnant.github.io/date_algorithms.html)
+void CivilFromDays(int64_t days, int& year, int& month, int& day) noexcept
+{
+    days += 719468;
+    const int64_t era = FloorDiv(days, 146097);
+    const unsigned doe = (unsigned)(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    day = (int)(doy - (153 * mp + 2) / 5 + 1);
+    month = (int)((mp < 10) ? (mp + 3) : (mp - 9));
+    year = (int)(era * 400 + yoe + ((month <= 2) ? 1 : 0));
+}
+
+// Convert the civil date to days since 1970-01-01 (http://howardhinnant.github.io/date_algorithms.html)
+int64_t DaysFromCivil(int year, int month, int day) noexcept
+{
+    year -= (month <= 2) ? 1 : 0;
+    const int64_t era = FloorDiv(year, 400);
+    const unsigned yoe = (unsigned)(year - era * 400);
+    const unsigned doy = (153 * (unsigned)((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + (unsigned)day - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+// Per-thread cache of the last converted civil day
+struct CivilDayCache
+{
+    int64_t days{-1};
+    int year{1970};
+    int month{1};
+    int day{1};
+    int weekday{4};
+};
+
+thread_local CivilDayCache civil_day_cache;
+
+// Convert seconds since 1970-01-01 to the civil date & time
+void CivilFromSeconds(int64_t seconds, int& year, int& month, int& weekday, int& day, int& hour, int& minute, int& second) noexcept
+{
+    const int64_t days = FloorDiv(seconds, DAY_SECONDS);
+    const int64_t time = seconds - days * DAY_SECONDS;
+
+    CivilDayCache& cache = civil_day_cache;
+    if (cache.days != days)
+    {
+        CivilFromDays(days, cache.year, cache.month, cache.day);
+        // 1970-01-01 was Thursday
+        cache.weekday = (int)(days - FloorDiv(days + 4, 7) * 7 + 4);
+        cache.days = days;
+    }
+
+    year = cache.year;
+    month = cache.month;
+    weekday = cache.weekday;
+    day = cache.day;
+    hour = (int)(time / 3600);
+    minute = (int)((time / 60) % 60);
+    second = (int)(time % 60);
+}
+
+// Query the local time offset in seconds for the given UTC seconds
+int64_t QueryLocalOffset(int64_t seconds, uint64_t timestamp)
 {
     struct tm result;
-    time_t seconds = timestamp.seconds();
+    time_t utc = (time_t)seconds;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (gmtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to date & time structure!", timestamp.total()));
+    if (localtime_r(&utc, &result) != &result)
+        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp));
 #elif defined(_WIN32) || defined(_WIN64)
-    if (gmtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to date & time structure!", timestamp.total()));
+    if (localtime_s(&result, &utc))
+        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp));
 #endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
+    int64_t local = DaysFromCivil(result.tm_year + 1900, result.tm_mon + 1, result.tm_mday) * DAY_SECONDS + result.tm_hour * 3600 + result.tm_min * 60 + result.tm_sec % 60;
+    return local - seconds;
+}
+
+// Generation of the local time zone, changed by LocalTime::UpdateTimezone()
+std::atomic<uint64_t> local_offset_generation(0);
+
+// Per-thread cache of the local time offset with UTC seconds interval where it is valid
+struct LocalOffsetCache
+{
+    uint64_t generation{0};
+    int64_t begin{0};
+    int64_t end{0};
+    int64_t offset{0};
+};
+
+thread_local LocalOffsetCache local_offset_cache;
+
+// Get the local time offset in seconds for the given UTC seconds
+int64_t LocalOffset(int64_t seconds, uint64_t timestamp)
+{
+    LocalOffsetCache& cache = local_offset_cache;
+    uint64_t generation = local_offset_generation.load(std::memory_order_acquire);
+    if ((seconds >= cache.begin) && (seconds < cache.end) && (cache.generation == generation))
+        return cache.offset;
+
+    int64_t offset = QueryLocalOffset(seconds, timestamp);
+
+    // Cache the offset for the whole local day if it does not change during the day,
+    // otherwise only for the current slot if it does not change during the slot,
+    // otherwise only for the current second (transitions not aligned to slots).
+    // Both checks compare the offset only at interval bounds, so two transitions
+    // which restore the same offset inside a single interval are not detected.
+    int64_t begin = FloorDiv(seconds + offset, DAY_SECONDS) * DAY_SECONDS - offset;
+    int64_t end = begin + DAY_SECONDS;
+    if ((begin < 0) || (QueryLocalOffset(begin, timestamp) != offset) || (QueryLocalOffset(end - 1, timestamp) != offset))
+    {
+        begin = FloorDiv(seconds, SLOT_SECONDS) * SLOT_SECONDS;
+        end = begin + SLOT_SECONDS;
+        if ((begin < 0) || (QueryLocalOffset(begin, timestamp) != offset) || (QueryLocalOffset(end - 1, timestamp) != offset))
+        {
+            begin = seconds;
+            end = seconds + 1;
+        }
+    }
+
+    cache.generation = generation;
+    cache.begin = begin;
+    cache.end = end;
+    cache.offset = offset;
+    return offset;
+}
+
+} // namespace Internals
+//! @endcond
+
+Time::Time(const Timestamp& timestamp)
+{
+    Internals::CivilFromSeconds((int64_t)timestamp.seconds(), _year, _month, _weekday, _day, _hour, _minute, _second);
     _millisecond = timestamp.milliseconds() % 1000;
     _microsecond = timestamp.microseconds() % 1000;
     _nanosecond = timestamp.nanoseconds() % 1000;
@@ -99,23 +227,7 @@ Time::Time(int year, int month, int day, int hour, int minute, int second, int m
 
 UtcTimestamp Time::utcstamp() const
 {
-    struct tm result;
-    result.tm_year = _year - 1900;
-    result.tm_mon = _month - 1;
-    result.tm_mday = _day;
-    result.tm_hour = _hour;
-    result.tm_min = _minute;
-    result.tm_sec = _second;
-    result.tm_isdst = -1;
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    time_t seconds = timegm(&result);
-#elif defined(_WIN32) || defined(_WIN64)
-    time_t seconds = _mkgmtime(&result);
-#endif
-    if (seconds == -1)
-        throwex SystemException("Cannot convert date & time to UTC timestamp!");
-
+    int64_t seconds = Internals::DaysFromCivil(_year, _month, _day) * Internals::DAY_SECONDS + _hour * 3600 + _minute * 60 + _second;
     return UtcTimestamp(seconds * 1000000000ull + _millisecond * 1000000ull + _microsecond * 1000ull + _nanosecond);
 }
 
@@ -139,45 +251,26 @@ LocalTimestamp Time::localstamp() const
 
 UtcTime::UtcTime(const Timestamp& timestamp)
 {
-    struct tm result;
-    time_t seconds = timestamp.seconds();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (gmtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to UTC date & time structure!", timestamp.total()));
-#elif defined(_WIN32) || defined(_WIN64)
-    if (gmtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to UTC date & time structure!", timestamp.total()));
-#endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
+    Internals::CivilFromSeconds((int64_t)timestamp.seconds(), _year, _month, _weekday, _day, _hour, _minute, _second);
     _millisecond = timestamp.milliseconds() % 1000;
     _microsecond = timestamp.microseconds() % 1000;
     _nanosecond = timestamp.nanoseconds() % 1000;
 }
 
-LocalTime::LocalTime(const Timestamp& timestamp)
+void LocalTime::UpdateTimezone()
 {
-    struct tm result;
-    time_t seconds = timestamp.seconds();
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (localtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp.total()));
+    tzset();
 #elif defined(_WIN32) || defined(_WIN64)
-    if (localtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp.total()));
+    _tzset();
 #endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
+    Internals::local_offset_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+LocalTime::LocalTime(const Timestamp& timestamp)
+{
+    int64_t seconds = (int64_t)timestamp.seconds();
+    Internals::CivilFromSeconds(seconds + Internals::LocalOffset(seconds, timestamp.total()), _year, _month, _weekday, _day, _hour, _minute, _second);
     _millisecond = timestamp.milliseconds() % 1000;
     _microsecond = timestamp.microseconds() % 1000;
     _nanosecond = timestamp.nanoseconds() % 1000;
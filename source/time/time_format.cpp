@@ -0,0 +1,290 @@
+/*!
+    \file time_format.cpp
+    \brief Time format utilities implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/time_format.h"
+
+#include "errors/exceptions.h"
+#include "string/format.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Civil calendar conversions (implemented in time.cpp)
+int64_t FloorDiv(int64_t value, int64_t divisor) noexcept;
+void CivilFromDays(int64_t days, int& year, int& month, int& day) noexcept;
+int64_t DaysFromCivil(int year, int month, int day) noexcept;
+
+// Two digits lookup table
+const char Digits[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+inline void Write2(char* buffer, int value) noexcept
+{
+    std::memcpy(buffer, Digits + value * 2, 2);
+}
+
+// Size of "YYYY-MM-DDTHH:MM:SS" prefix
+const size_t PrefixSize = 19;
+
+// Formatted prefix of the last second
+struct PrefixCache
+{
+    int64_t seconds = INT64_MIN;
+    char prefix[PrefixSize];
+};
+
+void FormatPrefix(int64_t seconds, char* buffer) noexcept
+{
+    thread_local PrefixCache cache;
+
+    if (cache.seconds != seconds)
+    {
+        int64_t minutes = FloorDiv(seconds, 60);
+        int second = (int)(seconds - minutes * 60);
+
+        // Only seconds are changed in the same minute
+        if (FloorDiv(cache.seconds, 60) != minutes)
+        {
+            int64_t days = FloorDiv(minutes, 1440);
+            int minute = (int)(minutes - days * 1440);
+            int year, month, day;
+            CivilFromDays(days, year, month, day);
+
+            char* prefix = cache.prefix;
+            Write2(prefix + 0, (year / 100) % 100);
+            Write2(prefix + 2, year % 100);
+            prefix[4] = '-';
+            Write2(prefix + 5, month);
+            prefix[7] = '-';
+            Write2(prefix + 8, day);
+            prefix[10] = 'T';
+            Write2(prefix + 11, minute / 60);
+            prefix[13] = ':';
+            Write2(prefix + 14, minute % 60);
+            prefix[16] = ':';
+        }
+        Write2(cache.prefix + 17, second);
+        cache.seconds = seconds;
+    }
+
+    std::memcpy(buffer, cache.prefix, PrefixSize);
+}
+
+size_t FormatFraction(int nanoseconds, int precision, char* buffer) noexcept
+{
+    if (precision <= 0)
+        return 0;
+
+    char digits[10];
+    int rest = nanoseconds % 100000000;
+    digits[0] = (char)('0' + nanoseconds / 100000000);
+    Write2(digits + 1, rest / 1000000);
+    Write2(digits + 3, (rest / 10000) % 100);
+    Write2(digits + 5, (rest / 100) % 100);
+    Write2(digits + 7, rest % 100);
+
+    size_t count = (size_t)((precision < 9) ? precision : 9);
+    buffer[0] = '.';
+    std::memcpy(buffer + 1, digits, count);
+    return count + 1;
+}
+
+size_t FormatISO8601(const Timestamp& utc, int64_t offset, bool zulu, char* buffer, size_t size, int precision) noexcept
+{
+    // Prefix, fraction and offset size
+    size_t required = PrefixSize + ((precision > 0) ? ((precision < 9) ? precision : 9) + 1 : 0) + (zulu ? 1 : 6);
+    if ((buffer == nullptr) || (size < required))
+        return 0;
+
+    int64_t minutes = offset / 60;
+    FormatPrefix((int64_t)utc.seconds() + minutes * 60, buffer);
+    size_t result = PrefixSize + FormatFraction((int)(utc.total() % 1000000000), precision, buffer + PrefixSize);
+
+    if (zulu)
+        buffer[result++] = 'Z';
+    else
+    {
+        buffer[result] = (minutes < 0) ? '-' : '+';
+        if (minutes < 0)
+            minutes = -minutes;
+        Write2(buffer + result + 1, (int)((minutes / 60) % 100));
+        buffer[result + 3] = ':';
+        Write2(buffer + result + 4, (int)(minutes % 60));
+        result += 6;
+    }
+    return result;
+}
+
+// Validate "YYYY-MM-DDTHH:MM:SS" digits and separators and store digits values
+bool ValidatePrefix(const char* str, uint8_t* digits) noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is always available for x86-64
+    const __m128i separators = _mm_setr_epi8('0', '0', '0', '0', '-', '0', '0', '-', '0', '0', 'T', '0', '0', ':', '0', '0');
+    const __m128i mask = _mm_setr_epi8(0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0);
+    __m128i v = _mm_loadu_si128((const __m128i*)str);
+    __m128i values = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i numbers = _mm_cmpeq_epi8(_mm_min_epu8(values, _mm_set1_epi8(9)), values);
+    __m128i valid = _mm_or_si128(_mm_andnot_si128(mask, numbers), _mm_and_si128(mask, _mm_cmpeq_epi8(v, separators)));
+    _mm_storeu_si128((__m128i*)digits, values);
+    // Date & time separator is checked separately
+    if ((_mm_movemask_epi8(valid) | 0x0400) != 0xFFFF)
+        return false;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    static const uint8_t separators_data[16] = { '0', '0', '0', '0', '-', '0', '0', '-', '0', '0', 'T', '0', '0', ':', '0', '0' };
+    static const uint8_t mask_data[16] = { 0, 0, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0 };
+    uint8x16_t v = vld1q_u8((const uint8_t*)str);
+    uint8x16_t mask = vld1q_u8(mask_data);
+    uint8x16_t values = vsubq_u8(v, vdupq_n_u8('0'));
+    uint8x16_t numbers = vcleq_u8(values, vdupq_n_u8(9));
+    uint8x16_t valid = vbslq_u8(mask, vceqq_u8(v, vld1q_u8(separators_data)), numbers);
+    vst1q_u8(digits, values);
+    // Date & time separator is checked separately
+    valid = vsetq_lane_u8(0xFF, valid, 10);
+    if (vminvq_u8(valid) != 0xFF)
+        return false;
+#else
+    for (size_t i = 0; i < 16; ++i)
+    {
+        digits[i] = (uint8_t)(str[i] - '0');
+        bool separator = (i == 4) || (i == 7) || (i == 10) || (i == 13);
+        if (!separator && (digits[i] > 9))
+            return false;
+    }
+    if ((str[4] != '-') || (str[7] != '-') || (str[13] != ':'))
+        return false;
+#endif
+    digits[16] = (uint8_t)(str[16] - '0');
+    digits[17] = (uint8_t)(str[17] - '0');
+    digits[18] = (uint8_t)(str[18] - '0');
+    return ((str[10] == 'T') || (str[10] == 't') || (str[10] == ' ')) && (str[16] == ':') && (digits[17] <= 9) && (digits[18] <= 9);
+}
+
+} // namespace Internals
+//! @endcond
+
+std::string TimeFormat::FormatISO8601(const Timestamp& utc, int precision)
+{
+    char buffer[ISO8601_SIZE];
+    return std::string(buffer, Internals::FormatISO8601(utc, 0, true, buffer, sizeof(buffer), precision));
+}
+
+std::string TimeFormat::FormatISO8601(const Timestamp& utc, const Timespan& offset, int precision)
+{
+    char buffer[ISO8601_SIZE];
+    return std::string(buffer, Internals::FormatISO8601(utc, offset.seconds(), false, buffer, sizeof(buffer), precision));
+}
+
+size_t TimeFormat::FormatISO8601(const Timestamp& utc, char* buffer, size_t size, int precision) noexcept
+{
+    return Internals::FormatISO8601(utc, 0, true, buffer, size, precision);
+}
+
+size_t TimeFormat::FormatISO8601(const Timestamp& utc, const Timespan& offset, char* buffer, size_t size, int precision) noexcept
+{
+    return Internals::FormatISO8601(utc, offset.seconds(), false, buffer, size, precision);
+}
+
+bool TimeFormat::ParseISO8601(std::string_view str, Timestamp& utc) noexcept
+{
+    // The shortest valid string is "YYYY-MM-DDTHH:MM:SSZ"
+    uint8_t d[Internals::PrefixSize];
+    if ((str.size() < (Internals::PrefixSize + 1)) || !Internals::ValidatePrefix(str.data(), d))
+        return false;
+
+    int year = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+    int month = d[5] * 10 + d[6];
+    int day = d[8] * 10 + d[9];
+    int hour = d[11] * 10 + d[12];
+    int minute = d[14] * 10 + d[15];
+    int second = d[17] * 10 + d[18];
+    if ((month < 1) || (month > 12) || (day < 1) || (hour > 23) || (minute > 59) || (second > 60))
+        return false;
+    int64_t days = Internals::DaysFromCivil(year, month, day);
+    if ((day > 28) && (Internals::DaysFromCivil((month == 12) ? year + 1 : year, (month == 12) ? 1 : month + 1, 1) <= days))
+        return false;
+
+    // Fractional seconds
+    size_t i = Internals::PrefixSize;
+    int64_t nanoseconds = 0;
+    if ((str[i] == '.') || (str[i] == ','))
+    {
+        size_t start = ++i;
+        int64_t scale = 100000000;
+        while ((i < str.size()) && ((uint8_t)(str[i] - '0') <= 9))
+        {
+            nanoseconds += (str[i++] - '0') * scale;
+            scale /= 10;
+        }
+        if (i == start)
+            return false;
+    }
+
+    // Timezone offset
+    if (i >= str.size())
+        return false;
+    int64_t offset = 0;
+    if ((str[i] == 'Z') || (str[i] == 'z'))
+        ++i;
+    else if ((str[i] == '+') || (str[i] == '-'))
+    {
+        bool negative = (str[i++] == '-');
+        bool colon = ((i + 2) < str.size()) && (str[i + 2] == ':');
+        if ((str.size() - i) != (colon ? 5u : 4u))
+            return false;
+        uint8_t h1 = (uint8_t)(str[i] - '0');
+        uint8_t h2 = (uint8_t)(str[i + 1] - '0');
+        uint8_t m1 = (uint8_t)(str[i + (colon ? 3 : 2)] - '0');
+        uint8_t m2 = (uint8_t)(str[i + (colon ? 4 : 3)] - '0');
+        if ((h1 > 9) || (h2 > 9) || (m1 > 5) || (m2 > 9) || ((h1 * 10 + h2) > 23))
+            return false;
+        offset = ((h1 * 10 + h2) * 60 + m1 * 10 + m2) * 60;
+        if (negative)
+            offset = -offset;
+        i = str.size();
+    }
+    if (i != str.size())
+        return false;
+
+    // Timestamp is limited by the epoch and the maximal count of nanoseconds
+    int64_t seconds = days * 86400 + hour * 3600 + minute * 60 + second - offset;
+    if ((seconds < 0) || (seconds >= (int64_t)(UINT64_MAX / 1000000000)))
+        return false;
+
+    utc = Timestamp((uint64_t)seconds * 1000000000 + (uint64_t)nanoseconds);
+    return true;
+}
+
+UtcTimestamp TimeFormat::ParseISO8601(std::string_view str)
+{
+    Timestamp result;
+    if (!ParseISO8601(str, result))
+        throwex ArgumentException(format("Invalid ISO-8601 timestamp '{}'!", str));
+    return UtcTimestamp(result);
+}
+
+} // namespace CppCommon
@@ -9,6 +9,10 @@
 #include "time/timestamp.h"
 
 #include "math/math.h"
+#include "system/cpu.h"
+
+#include <algorithm>
+#include <atomic>
 
 #if defined(__APPLE__)
 #include <mach/mach.h>
@@ -99,6 +103,176 @@ uint64_t PrepareTimebaseInfo(mach_timebase_info_data_t& tb)
 
 #endif
 
+// Calibrated TSC clock
+class TscClock
+{
+public:
+    // Calibration interval of the first call in nanoseconds
+    static const uint64_t CALIBRATION = 1000000;
+    // Refinement period in nanoseconds
+    static const uint64_t PERIOD = 1000000000;
+
+    TscClock() : _invariant(CPU::Features().invariant_tsc), _period(0), _origin_ticks(0), _origin_nano(0), _last_ticks(0), _last_nano(0), _refining(false), _sequence(0), _base_ticks(0), _base_nano(0), _multiplier(0)
+    {
+        if (!_invariant)
+            return;
+
+        // Measure ticks to nanoseconds ratio for the calibration interval
+        Sample(_origin_ticks, _origin_nano);
+        uint64_t ticks = 0;
+        uint64_t nano = 0;
+        do
+        {
+            Sample(ticks, nano);
+        } while ((nano - _origin_nano) < CALIBRATION);
+
+        if (ticks <= _origin_ticks)
+        {
+            _invariant = false;
+            return;
+        }
+
+        _last_ticks = ticks;
+        _last_nano = nano;
+        double ratio = (double)(nano - _origin_nano) / (double)(ticks - _origin_ticks);
+        _period = (uint64_t)(PERIOD / ratio);
+        Update(ticks, nano, ratio);
+    }
+
+    uint64_t Now()
+    {
+        if (!_invariant)
+            return Timestamp::nano();
+
+        // Read conversion parameters consistently with the sequence lock
+        uint32_t sequence;
+        uint64_t base_ticks;
+        uint64_t base_nano;
+        uint64_t multiplier;
+        do
+        {
+            sequence = _sequence.load(std::memory_order_acquire);
+            base_ticks = _base_ticks.load(std::memory_order_relaxed);
+            base_nano = _base_nano.load(std::memory_order_relaxed);
+            multiplier = _multiplier.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while (((sequence & 1) != 0) || (sequence != _sequence.load(std::memory_order_relaxed)));
+
+        // Another core may read a bit smaller ticks value than the refinement base
+        uint64_t ticks = Timestamp::rdts();
+        uint64_t delta = (ticks > base_ticks) ? (ticks - base_ticks) : 0;
+        uint64_t result = base_nano + Scale(delta, multiplier);
+        return (delta < _period) ? result : Refine(result);
+    }
+
+private:
+    bool _invariant;
+    uint64_t _period;
+    uint64_t _origin_ticks;
+    uint64_t _origin_nano;
+    uint64_t _last_ticks;
+    uint64_t _last_nano;
+    std::atomic<bool> _refining;
+    std::atomic<uint32_t> _sequence;
+    std::atomic<uint64_t> _base_ticks;
+    std::atomic<uint64_t> _base_nano;
+    std::atomic<uint64_t> _multiplier;
+
+    // Multiply ticks by 32.32 fixed-point multiplier without 128-bit overflow
+    static uint64_t Scale(uint64_t ticks, uint64_t multiplier) noexcept
+    {
+        uint64_t high = ticks >> 32;
+        uint64_t low = ticks & 0xFFFFFFFF;
+        return (high * multiplier) + (low * (multiplier >> 32)) + ((low * (multiplier & 0xFFFFFFFF)) >> 32);
+    }
+
+    // Sample ticks and nanoseconds pair with the smallest gap between them (less affected by preemption)
+    static void Sample(uint64_t& ticks, uint64_t& nano)
+    {
+        uint64_t gap = (uint64_t)-1;
+        ticks = nano = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            uint64_t before = Timestamp::rdts();
+            uint64_t timestamp = Timestamp::nano();
+            uint64_t after = Timestamp::rdts();
+            if ((after - before) < gap)
+            {
+                gap = after - before;
+                ticks = before + gap / 2;
+                nano = timestamp;
+            }
+        }
+    }
+
+    void Update(uint64_t ticks, uint64_t nano, double ratio) noexcept
+    {
+        uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+        _sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _base_ticks.store(ticks, std::memory_order_relaxed);
+        _base_nano.store(nano, std::memory_order_relaxed);
+        _multiplier.store((uint64_t)(ratio * 4294967296.0), std::memory_order_relaxed);
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Refine the ratio and return the refined timestamp (or the given one if another thread refines it)
+    uint64_t Refine(uint64_t timestamp)
+    {
+        if (_refining.exchange(true, std::memory_order_acquire))
+            return timestamp;
+
+        uint64_t ticks = 0;
+        uint64_t nano = 0;
+        try
+        {
+            Sample(ticks, nano);
+        }
+        catch (...)
+        {
+            _refining.store(false, std::memory_order_release);
+            throw;
+        }
+
+        uint64_t base_ticks = _base_ticks.load(std::memory_order_relaxed);
+        uint64_t base_nano = _base_nano.load(std::memory_order_relaxed);
+        uint64_t multiplier = _multiplier.load(std::memory_order_relaxed);
+        uint64_t current = base_nano + Scale((ticks > base_ticks) ? (ticks - base_ticks) : 0, multiplier);
+
+        // Restart the calibration from the last refinement if the counter
+        // and the timer diverged (inaccurate calibration, suspend, etc.)
+        uint64_t error = (nano > current) ? (nano - current) : (current - nano);
+        if ((error > (PERIOD / 16)) || (ticks <= _origin_ticks) || (nano <= _origin_nano))
+        {
+            _origin_ticks = _last_ticks;
+            _origin_nano = _last_nano;
+        }
+        _last_ticks = ticks;
+        _last_nano = nano;
+
+        // Measure the ratio for the whole interval since the calibration origin
+        double ratio = ((ticks > _origin_ticks) && (nano > _origin_nano)) ? ((double)(nano - _origin_nano) / (double)(ticks - _origin_ticks)) : (multiplier / 4294967296.0);
+
+        uint64_t result;
+        if (nano >= current)
+        {
+            // Step forward to the high resolution timer
+            Update(ticks, nano, ratio);
+            result = nano;
+        }
+        else
+        {
+            // Never step back, but slow down to compensate the error during the next period
+            ratio *= 1.0 - (double)std::min(error, PERIOD / 16) / PERIOD;
+            Update(ticks, current, ratio);
+            result = current;
+        }
+
+        _refining.store(false, std::memory_order_release);
+        return std::max(result, timestamp);
+    }
+};
+
 } // namespace Internals
 //! @endcond
 
@@ -202,6 +376,42 @@ uint64_t Timestamp::nano()
 #endif
 }
 
+uint64_t Timestamp::coarse_utc()
+{
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && defined(CLOCK_REALTIME_COARSE)
+    struct timespec timestamp;
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &timestamp) != 0)
+        throwex SystemException("Cannot get value of CLOCK_REALTIME_COARSE timer!");
+    return (timestamp.tv_sec * 1000000000) + timestamp.tv_nsec;
+#elif defined(_WIN32) || defined(_WIN64)
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+
+    ULARGE_INTEGER result;
+    result.LowPart = ft.dwLowDateTime;
+    result.HighPart = ft.dwHighDateTime;
+    return (result.QuadPart - 116444736000000000ull) * 100;
+#else
+    return utc();
+#endif
+}
+
+uint64_t Timestamp::coarse_nano()
+{
+#if defined(__APPLE__)
+    static mach_timebase_info_data_t info;
+    static uint64_t bias = Internals::PrepareTimebaseInfo(info);
+    return ((mach_approximate_time() - bias) * info.numer) / info.denom;
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && defined(CLOCK_MONOTONIC_COARSE)
+    struct timespec timestamp;
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &timestamp) != 0)
+        throwex SystemException("Cannot get value of CLOCK_MONOTONIC_COARSE timer!");
+    return (timestamp.tv_sec * 1000000000) + timestamp.tv_nsec;
+#else
+    return nano();
+#endif
+}
+
 uint64_t Timestamp::rdts()
 {
 #if defined(__APPLE__)
@@ -295,4 +505,10 @@ uint64_t Timestamp::rdts()
 #endif
 }
 
+uint64_t Timestamp::tsc()
+{
+    static Internals::TscClock clock;
+    return clock.Now();
+}
+
 } // namespace CppCommon
@@ -0,0 +1,511 @@
+/*!
+    \file timezone_rules.cpp
+    \brief Timezone rules implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "time/timezone_rules.h"
+
+#include "filesystem/file.h"
+#include "string/format.h"
+#include "system/environment.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Civil calendar conversions (implemented in time.cpp)
+int64_t FloorDiv(int64_t value, int64_t divisor) noexcept;
+void CivilFromDays(int64_t days, int& year, int& month, int& day) noexcept;
+int64_t DaysFromCivil(int year, int month, int day) noexcept;
+
+// Seconds of 1900-01-01T00:00:00Z, the bucket index does not cover earlier transitions
+const int64_t INDEX_BASE = -2208988800ll;
+
+uint32_t ReadUInt32(const uint8_t* data) noexcept
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+uint64_t ReadUInt64(const uint8_t* data) noexcept
+{
+    return ((uint64_t)ReadUInt32(data) << 32) | ReadUInt32(data + 4);
+}
+
+// TZif header (RFC 8536)
+struct TZifHeader
+{
+    char version;
+    uint32_t isutcnt;
+    uint32_t isstdcnt;
+    uint32_t leapcnt;
+    uint32_t timecnt;
+    uint32_t typecnt;
+    uint32_t charcnt;
+
+    size_t size(size_t time_size) const noexcept
+    { return timecnt * time_size + timecnt + typecnt * 6 + charcnt + leapcnt * (time_size + 4) + isstdcnt + isutcnt; }
+};
+
+bool ReadTZifHeader(const uint8_t* data, size_t size, TZifHeader& header) noexcept
+{
+    if ((size < 44) || (std::memcmp(data, "TZif", 4) != 0))
+        return false;
+    header.version = (char)data[4];
+    header.isutcnt = ReadUInt32(data + 20);
+    header.isstdcnt = ReadUInt32(data + 24);
+    header.leapcnt = ReadUInt32(data + 28);
+    header.timecnt = ReadUInt32(data + 32);
+    header.typecnt = ReadUInt32(data + 36);
+    header.charcnt = ReadUInt32(data + 40);
+    return (header.typecnt > 0) && (header.typecnt <= 256) && (header.charcnt > 0) &&
+           ((header.isutcnt == 0) || (header.isutcnt == header.typecnt)) &&
+           ((header.isstdcnt == 0) || (header.isstdcnt == header.typecnt)) &&
+           (header.timecnt <= (1u << 20)) && (header.leapcnt <= (1u << 20)) && (header.charcnt <= (1u << 20));
+}
+
+// POSIX TZ rule parser
+class TZRuleParser
+{
+public:
+    explicit TZRuleParser(std::string_view rule) : _rule(rule), _position(0) {}
+
+    bool end() const noexcept { return _position >= _rule.size(); }
+    bool skip(char ch) noexcept
+    {
+        if (end() || (_rule[_position] != ch))
+            return false;
+        ++_position;
+        return true;
+    }
+
+    bool name(std::string& result)
+    {
+        size_t start = _position;
+        if (skip('<'))
+        {
+            while (!end() && (_rule[_position] != '>'))
+                ++_position;
+            result = _rule.substr(start + 1, _position - start - 1);
+            return skip('>') && (result.size() >= 3);
+        }
+        while (!end() && (((_rule[_position] >= 'A') && (_rule[_position] <= 'Z')) || ((_rule[_position] >= 'a') && (_rule[_position] <= 'z'))))
+            ++_position;
+        result = _rule.substr(start, _position - start);
+        return (result.size() >= 3);
+    }
+
+    bool number(int& result, int max)
+    {
+        size_t start = _position;
+        result = 0;
+        while (!end() && (_rule[_position] >= '0') && (_rule[_position] <= '9') && ((_position - start) < 3))
+            result = result * 10 + (_rule[_position++] - '0');
+        return (_position > start) && (result <= max);
+    }
+
+    // [+|-]hh[:mm[:ss]] with hours up to 167 in transition times
+    bool time(int32_t& result, int max_hours)
+    {
+        bool negative = skip('-');
+        if (!negative)
+            skip('+');
+        int hours = 0, minutes = 0, seconds = 0;
+        if (!number(hours, max_hours))
+            return false;
+        if (skip(':') && (!number(minutes, 59) || (skip(':') && !number(seconds, 59))))
+            return false;
+        result = hours * 3600 + minutes * 60 + seconds;
+        if (negative)
+            result = -result;
+        return true;
+    }
+
+    bool date(char& kind, int& day, int& week, int& month)
+    {
+        if (skip('J'))
+        {
+            kind = 'J';
+            return number(day, 365) && (day >= 1);
+        }
+        if (skip('M'))
+        {
+            kind = 'M';
+            return number(month, 12) && (month >= 1) && skip('.') && number(week, 5) && (week >= 1) && skip('.') && number(day, 6);
+        }
+        kind = 'D';
+        return number(day, 365);
+    }
+
+private:
+    std::string_view _rule;
+    size_t _position;
+};
+
+} // namespace Internals
+//! @endcond
+
+TimezoneRules::TimezoneRules()
+    : _name("UTC"),
+      _types(1, Type{ 0, 0, 0, false }),
+      _abbreviations("UTC", 4),
+      _bucket_base(0),
+      _rule(false),
+      _rule_dst(false),
+      _rule_std_type(),
+      _rule_dst_type(),
+      _rule_start(),
+      _rule_end()
+{
+}
+
+TimezoneRules TimezoneRules::Parse(std::string_view name, const void* data, size_t size)
+{
+    const uint8_t* buffer = (const uint8_t*)data;
+
+    Internals::TZifHeader header;
+    if ((buffer == nullptr) || !Internals::ReadTZifHeader(buffer, size, header) || ((44 + header.size(4)) > size))
+        throwex ArgumentException(format("Invalid TZif data of the timezone '{}'!", name));
+
+    // Prefer 64-bit data block of the version 2 and later
+    size_t time_size = 4;
+    const uint8_t* block = buffer + 44;
+    if (header.version >= '2')
+    {
+        const uint8_t* second = block + header.size(4);
+        if (!Internals::ReadTZifHeader(second, size - (second - buffer), header) || ((44 + header.size(8)) > (size_t)(size - (second - buffer))))
+            throwex ArgumentException(format("Invalid TZif data of the timezone '{}'!", name));
+        time_size = 8;
+        block = second + 44;
+    }
+
+    TimezoneRules result;
+    result._name = name;
+    result._types.clear();
+    result._abbreviations.clear();
+
+    // Transition times and types
+    const uint8_t* times = block;
+    const uint8_t* indexes = times + header.timecnt * time_size;
+    const uint8_t* types = indexes + header.timecnt;
+    const uint8_t* chars = types + header.typecnt * 6;
+    result._times.reserve(header.timecnt);
+    result._indexes.reserve(header.timecnt);
+    for (size_t i = 0; i < header.timecnt; ++i)
+    {
+        int64_t time = (time_size == 8) ? (int64_t)Internals::ReadUInt64(times + i * 8) : (int64_t)(int32_t)Internals::ReadUInt32(times + i * 4);
+        if ((indexes[i] >= header.typecnt) || (!result._times.empty() && (time <= result._times.back())))
+            throwex ArgumentException(format("Invalid TZif data of the timezone '{}'!", name));
+        result._times.push_back(time);
+        result._indexes.push_back(indexes[i]);
+    }
+    for (size_t i = 0; i < header.typecnt; ++i)
+    {
+        const uint8_t* type = types + i * 6;
+        int32_t offset = (int32_t)Internals::ReadUInt32(type);
+        if ((type[5] >= header.charcnt) || (offset <= -89400) || (offset >= 93600))
+            throwex ArgumentException(format("Invalid TZif data of the timezone '{}'!", name));
+        result._types.push_back(Type{ offset, 0, type[5], (type[4] != 0) });
+    }
+    result._abbreviations.assign((const char*)chars, header.charcnt);
+    result._abbreviations.push_back('\0');
+
+    // Daylight saving time offset is the difference with the previous standard time type
+    int32_t standard = result._types[0].dst ? (result._types[0].offset - 3600) : result._types[0].offset;
+    for (size_t i = 0; i < result._indexes.size(); ++i)
+    {
+        Type& type = result._types[result._indexes[i]];
+        if (!type.dst)
+            standard = type.offset;
+        else if (type.daylight == 0)
+            type.daylight = (type.offset != standard) ? (type.offset - standard) : 3600;
+    }
+    for (auto& type : result._types)
+        if (type.dst && (type.daylight == 0))
+            type.daylight = 3600;
+
+    // POSIX TZ rule footer of the version 2 and later
+    if (time_size == 8)
+    {
+        const char* footer = (const char*)(block + header.size(8));
+        const char* end = (const char*)buffer + size;
+        if ((footer < end) && (*footer == '\n'))
+        {
+            const char* last = std::find(footer + 1, end, '\n');
+            if (last == end)
+                throwex ArgumentException(format("Invalid TZif footer of the timezone '{}'!", name));
+            if (last > (footer + 1))
+                result.ParseRule(std::string_view(footer + 1, last - footer - 1));
+        }
+    }
+
+    result.BuildIndex();
+    return result;
+}
+
+void TimezoneRules::ParseRule(std::string_view rule)
+{
+    Internals::TZRuleParser parser(rule);
+
+    std::string std_name;
+    std::string dst_name;
+    int32_t std_offset = 0;
+    int32_t dst_offset = 0;
+    if (!parser.name(std_name) || !parser.time(std_offset, 24))
+        throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+
+    // POSIX offsets are positive to the west of Greenwich
+    std_offset = -std_offset;
+
+    _rule_string = rule;
+    _rule = true;
+    _rule_dst = !parser.end();
+    _rule_std_type = Type{ std_offset, 0, (uint32_t)_abbreviations.size(), false };
+    _abbreviations.append(std_name);
+    _abbreviations.push_back('\0');
+    if (!_rule_dst)
+        return;
+
+    if (!parser.name(dst_name))
+        throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+    dst_offset = std_offset + 3600;
+    if (!parser.end() && !parser.skip(','))
+    {
+        if (!parser.time(dst_offset, 24))
+            throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+        dst_offset = -dst_offset;
+        if (!parser.end() && !parser.skip(','))
+            throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+    }
+    _rule_dst_type = Type{ dst_offset, dst_offset - std_offset, (uint32_t)_abbreviations.size(), true };
+    _abbreviations.append(dst_name);
+    _abbreviations.push_back('\0');
+
+    // Default transitions rules are the United States ones
+    _rule_start = RuleDate{ 'M', 0, 2, 3, 7200 };
+    _rule_end = RuleDate{ 'M', 0, 1, 11, 7200 };
+    if (parser.end())
+        return;
+
+    for (RuleDate* date : { &_rule_start, &_rule_end })
+    {
+        if (!parser.date(date->kind, date->day, date->week, date->month))
+            throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+        date->time = 7200;
+        if (parser.skip('/') && !parser.time(date->time, 167))
+            throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+        if ((date == &_rule_start) && !parser.skip(','))
+            throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+    }
+    if (!parser.end())
+        throwex ArgumentException(format("Invalid POSIX TZ rule '{}' of the timezone '{}'!", rule, _name));
+}
+
+void TimezoneRules::BuildIndex()
+{
+    _buckets.clear();
+    if (_times.empty())
+        return;
+
+    // Each bucket keeps the index of the last transition before the bucket start
+    _bucket_base = std::max(_times.front(), Internals::INDEX_BASE);
+    size_t count = (size_t)((_times.back() - _bucket_base) >> BUCKET_SHIFT) + 1;
+    _buckets.resize(count);
+    size_t index = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        int64_t start = _bucket_base + ((int64_t)i << BUCKET_SHIFT);
+        while (((index + 1) < _times.size()) && (_times[index + 1] <= start))
+            ++index;
+        _buckets[i] = (uint32_t)index;
+    }
+}
+
+const TimezoneRules::Type& TimezoneRules::Lookup(int64_t seconds) const noexcept
+{
+    if (_times.empty())
+        return _rule ? LookupRule(seconds) : _types[0];
+    if (seconds < _times.front())
+        return _types[0];
+    if (seconds >= _times.back())
+        return _rule ? LookupRule(seconds) : _types[_indexes.back()];
+
+    size_t index;
+    if (seconds < _bucket_base)
+        index = (std::upper_bound(_times.begin(), _times.end(), seconds) - _times.begin()) - 1;
+    else
+    {
+        index = _buckets[(size_t)((seconds - _bucket_base) >> BUCKET_SHIFT)];
+        while (_times[index + 1] <= seconds)
+            ++index;
+    }
+    return _types[_indexes[index]];
+}
+
+const TimezoneRules::Type& TimezoneRules::LookupRule(int64_t seconds) const noexcept
+{
+    if (!_rule_dst)
+        return _rule_std_type;
+
+    // Year of the local standard time
+    int year, month, day;
+    Internals::CivilFromDays(Internals::FloorDiv(seconds + _rule_std_type.offset, 86400), year, month, day);
+
+    // Local midnight seconds of the rule date in the given year
+    auto transition = [year](const RuleDate& date)
+    {
+        int64_t days = Internals::DaysFromCivil(year, 1, 1);
+        bool leap = ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+        if (date.kind == 'J')
+            days += date.day - 1 + ((leap && (date.day >= 60)) ? 1 : 0);
+        else if (date.kind == 'D')
+            days += date.day;
+        else
+        {
+            int64_t first = Internals::DaysFromCivil(year, date.month, 1);
+            int64_t next = (date.month == 12) ? Internals::DaysFromCivil(year + 1, 1, 1) : Internals::DaysFromCivil(year, date.month + 1, 1);
+            // 1970-01-01 was Thursday
+            int weekday = (int)(first - Internals::FloorDiv(first + 4, 7) * 7 + 4);
+            days = first + ((date.day - weekday + 7) % 7) + (date.week - 1) * 7;
+            while (days >= next)
+                days -= 7;
+        }
+        return days * 86400 + date.time;
+    };
+
+    // Start time is given in the local standard time, end time is given in the local daylight saving time
+    int64_t start = transition(_rule_start) - _rule_std_type.offset;
+    int64_t end = transition(_rule_end) - _rule_dst_type.offset;
+    bool dst = (start < end) ? ((seconds >= start) && (seconds < end)) : ((seconds < end) || (seconds >= start));
+    return dst ? _rule_dst_type : _rule_std_type;
+}
+
+Timespan TimezoneRules::Offset(const Timestamp& utc) const noexcept
+{
+    return Timespan::seconds(Lookup((int64_t)utc.seconds()).offset);
+}
+
+Timezone TimezoneRules::At(const Timestamp& utc) const
+{
+    const Type& type = Lookup((int64_t)utc.seconds());
+    return Timezone(std::string(_abbreviations.c_str() + type.abbreviation), Timespan::seconds(type.offset - type.daylight), Timespan::seconds(type.daylight));
+}
+
+UtcTimestamp TimezoneRules::Convert(const LocalTimestamp& local) const noexcept
+{
+    int64_t seconds = (int64_t)local.seconds();
+    uint64_t fraction = local.total() % 1000000000;
+
+    // Offsets before and after the possible transition near the local time
+    int64_t guess = seconds - Lookup(seconds).offset;
+    int64_t before = Lookup(guess - 86400).offset;
+    int64_t after = Lookup(guess + 86400).offset;
+
+    // Prefer the offset before the transition for ambiguous local time and for the gap
+    int64_t offset = before;
+    if ((before != after) && (Lookup(seconds - before).offset != before) && (Lookup(seconds - after).offset == after))
+        offset = after;
+
+    return UtcTimestamp((uint64_t)(seconds - offset) * 1000000000 + fraction);
+}
+
+TimezoneRules TimezoneRules::Load(std::string_view name, const Path& path)
+{
+    std::vector<uint8_t> data = File::ReadAllBytes(path);
+    return Parse(name, data.data(), data.size());
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Cache of found timezone rules
+struct TimezoneDatabase
+{
+    std::mutex lock;
+    Path path;
+    std::map<std::string, std::shared_ptr<const TimezoneRules>, std::less<>> rules;
+
+    TimezoneDatabase()
+    {
+        std::string tzdir = Environment::GetEnvar("TZDIR");
+        path = tzdir.empty() ? Path("/usr/share/zoneinfo") : Path(tzdir);
+    }
+
+    static TimezoneDatabase& Instance()
+    {
+        static TimezoneDatabase instance;
+        return instance;
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+std::shared_ptr<const TimezoneRules> TimezoneRules::Find(std::string_view name)
+{
+    auto& database = Internals::TimezoneDatabase::Instance();
+    std::scoped_lock locker(database.lock);
+
+    auto it = database.rules.find(name);
+    if (it != database.rules.end())
+        return it->second;
+
+    // Zone names are relative paths inside the database directory
+    std::shared_ptr<const TimezoneRules> result;
+    if (!name.empty() && (name.front() != '/') && (name.find("..") == std::string_view::npos))
+    {
+        Path path = database.path / Path(std::string(name));
+        if (path.IsExists() && !path.IsDirectory())
+            result = std::make_shared<const TimezoneRules>(Load(name, path));
+        else if ((name == "UTC") || (name == "Etc/UTC"))
+            result = std::make_shared<const TimezoneRules>();
+    }
+
+    // Not found timezones are cached as well
+    database.rules.emplace(std::string(name), result);
+    return result;
+}
+
+Path TimezoneRules::database()
+{
+    auto& database = Internals::TimezoneDatabase::Instance();
+    std::scoped_lock locker(database.lock);
+    return database.path;
+}
+
+void TimezoneRules::SetDatabase(const Path& path)
+{
+    auto& database = Internals::TimezoneDatabase::Instance();
+    std::scoped_lock locker(database.lock);
+    database.path = path;
+    database.rules.clear();
+}
+
+void TimezoneRules::swap(TimezoneRules& rules) noexcept
+{
+    using std::swap;
+    swap(_name, rules._name);
+    swap(_times, rules._times);
+    swap(_indexes, rules._indexes);
+    swap(_types, rules._types);
+    swap(_abbreviations, rules._abbreviations);
+    swap(_buckets, rules._buckets);
+    swap(_bucket_base, rules._bucket_base);
+    swap(_rule_string, rules._rule_string);
+    swap(_rule, rules._rule);
+    swap(_rule_dst, rules._rule_dst);
+    swap(_rule_std_type, rules._rule_std_type);
+    swap(_rule_dst_type, rules._rule_dst_type);
+    swap(_rule_start, rules._rule_start);
+    swap(_rule_end, rules._rule_end);
+}
+
+} // namespace CppCommon
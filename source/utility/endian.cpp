@@ -0,0 +1,174 @@
+/*!
+    \file endian.cpp
+    \brief Big/Little-endian utilities implementation
+    \author Ivan Shynkarenka
+    \date 14.10.2026
+    \copyright MIT License
+*/
+
+#include "utility/endian.h"
+
+#include "system/cpu_dispatch.h"
+
+#include <cassert>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Byte swap kernel converts the bulk of elements and returns the count of processed elements
+typedef size_t (*SwapFunction)(const uint8_t* source, uint8_t* destination, size_t count);
+
+size_t SwapScalar(const uint8_t*, uint8_t*, size_t)
+{
+    // Scalar implementation processes all elements
+    return 0;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Shuffle masks reverse bytes of each 2, 4 or 8 bytes element in 16 bytes lane
+template <size_t Size>
+inline __m128i SwapMaskSSE()
+{
+    if constexpr (Size == 2)
+        return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if constexpr (Size == 4)
+        return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else
+        return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+template <size_t Size>
+CPU_TARGET("ssse3")
+size_t SwapSSSE3(const uint8_t* source, uint8_t* destination, size_t count)
+{
+    const __m128i mask = SwapMaskSSE<Size>();
+    const size_t size = count * Size;
+
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(source + i));
+        _mm_storeu_si128((__m128i*)(destination + i), _mm_shuffle_epi8(v, mask));
+    }
+    return i / Size;
+}
+
+template <size_t Size>
+CPU_TARGET("avx2")
+size_t SwapAVX2(const uint8_t* source, uint8_t* destination, size_t count)
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(SwapMaskSSE<Size>());
+    const size_t size = count * Size;
+
+    size_t i = 0;
+    for (; (i + 64) <= size; i += 64)
+    {
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(source + i));
+        __m256i v2 = _mm256_loadu_si256((const __m256i*)(source + i + 32));
+        _mm256_storeu_si256((__m256i*)(destination + i), _mm256_shuffle_epi8(v1, mask));
+        _mm256_storeu_si256((__m256i*)(destination + i + 32), _mm256_shuffle_epi8(v2, mask));
+    }
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(source + i));
+        _mm256_storeu_si256((__m256i*)(destination + i), _mm256_shuffle_epi8(v, mask));
+    }
+    return i / Size;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+template <size_t Size>
+inline uint8x16_t SwapNEON(uint8x16_t v)
+{
+    if constexpr (Size == 2)
+        return vrev16q_u8(v);
+    else if constexpr (Size == 4)
+        return vrev32q_u8(v);
+    else
+        return vrev64q_u8(v);
+}
+
+template <size_t Size>
+size_t SwapNEON(const uint8_t* source, uint8_t* destination, size_t count)
+{
+    const size_t size = count * Size;
+
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        uint8x16_t v1 = vld1q_u8(source + i);
+        uint8x16_t v2 = vld1q_u8(source + i + 16);
+        vst1q_u8(destination + i, SwapNEON<Size>(v1));
+        vst1q_u8(destination + i + 16, SwapNEON<Size>(v2));
+    }
+    for (; (i + 16) <= size; i += 16)
+        vst1q_u8(destination + i, SwapNEON<Size>(vld1q_u8(source + i)));
+    return i / Size;
+}
+
+#endif
+
+template <size_t Size>
+SwapFunction ResolveSwap([[maybe_unused]] const CPUFeatures& features)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    if (features.avx2)
+        return SwapAVX2<Size>;
+    if (features.ssse3)
+        return SwapSSSE3<Size>;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (features.neon)
+        return SwapNEON<Size>;
+#endif
+    return SwapScalar;
+}
+
+template <typename T>
+void SwapCopy(const uint8_t* source, uint8_t* destination, size_t count)
+{
+    static CPUDispatch<size_t(const uint8_t*, uint8_t*, size_t)> dispatch(ResolveSwap<sizeof(T)>);
+
+    // Vectorized kernel converts the bulk of elements and the rest is converted one by one
+    for (size_t i = dispatch(source, destination, count); i < count; ++i)
+    {
+        T value;
+        std::memcpy(&value, source + i * sizeof(T), sizeof(T));
+        value = Endian::ByteSwap(value);
+        std::memcpy(destination + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+void ByteSwapCopy(const void* source, void* destination, size_t count, size_t size) noexcept
+{
+    assert(((size == 2) || (size == 4) || (size == 8)) && "Byte swap element size must be 2, 4 or 8 bytes!");
+
+    switch (size)
+    {
+        case 2:
+            SwapCopy<uint16_t>((const uint8_t*)source, (uint8_t*)destination, count);
+            break;
+        case 4:
+            SwapCopy<uint32_t>((const uint8_t*)source, (uint8_t*)destination, count);
+            break;
+        case 8:
+            SwapCopy<uint64_t>((const uint8_t*)source, (uint8_t*)destination, count);
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
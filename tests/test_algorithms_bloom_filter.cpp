@@ -0,0 +1,71 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/bloom_filter.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Bloom filter", "[CppCommon][Algorithms]")
+{
+    BloomFilter<uint64_t> filter(10000, 0.01);
+    REQUIRE(filter.blocks() > 0);
+    REQUIRE(filter.bytes() == (filter.blocks() * 32));
+
+    for (uint64_t i = 0; i < 10000; ++i)
+        filter.Insert(i);
+
+    // No false negatives
+    for (uint64_t i = 0; i < 10000; ++i)
+        REQUIRE(filter.Contains(i));
+
+    // False positive rate is close to the expected one
+    size_t positive = 0;
+    for (uint64_t i = 10000; i < 110000; ++i)
+        positive += filter.Contains(i) ? 1 : 0;
+    REQUIRE(positive < 2000);
+
+    // Batched probe gives the same results
+    std::vector<uint64_t> hashes;
+    for (uint64_t i = 0; i < 20000; ++i)
+        hashes.push_back((uint64_t)FastHasher<uint64_t>()(i));
+    std::vector<uint8_t> storage(hashes.size());
+    std::span<bool> results((bool*)storage.data(), storage.size());
+    size_t count = filter.ContainsHashes(hashes, results);
+    size_t expected = 0;
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        REQUIRE(results[i] == filter.ContainsHash(hashes[i]));
+        expected += results[i] ? 1 : 0;
+    }
+    REQUIRE(count == expected);
+    REQUIRE(count >= 10000);
+
+    filter.Clear();
+    REQUIRE(!filter.Contains(1));
+}
+
+TEST_CASE("Bloom filter merge and concurrent inserts", "[CppCommon][Algorithms]")
+{
+    BloomFilter<std::string> filter1(1000);
+    BloomFilter<std::string> filter2(1000);
+
+    std::thread thread1([&]() { for (int i = 0; i < 1000; ++i) filter1.Insert("key-" + std::to_string(i)); });
+    std::thread thread2([&]() { for (int i = 1000; i < 2000; ++i) filter1.Insert("key-" + std::to_string(i)); });
+    thread1.join();
+    thread2.join();
+
+    for (int i = 0; i < 2000; ++i)
+        REQUIRE(filter1.Contains("key-" + std::to_string(i)));
+
+    filter2.Insert("other");
+    filter2.Merge(filter1);
+    REQUIRE(filter2.Contains("other"));
+    REQUIRE(filter2.Contains("key-1999"));
+}
@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/concurrency_limiter.h"
+
+using namespace CppCommon;
+
+TEST_CASE("Concurrency limiter AIMD", "[CppCommon][Algorithms]")
+{
+    ConcurrencyLimiter limiter(4, 2, 8, Timespan::milliseconds(10));
+    REQUIRE(limiter.limit() == 4);
+
+    // Shed requests over the limit
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(limiter.TryAcquire());
+    REQUIRE(!limiter.TryAcquire());
+    REQUIRE(limiter.inflight() == 4);
+
+    // Fast responses of the saturated limiter increase the limit
+    for (int i = 0; i < 4; ++i)
+        limiter.Release(Timespan::milliseconds(1));
+    REQUIRE(limiter.inflight() == 0);
+    REQUIRE(limiter.latency() == Timespan::milliseconds(1));
+    for (int i = 0; i < 100; ++i)
+    {
+        for (uint64_t j = 0; j < limiter.limit(); ++j)
+            REQUIRE(limiter.TryAcquire());
+        while (limiter.inflight() > 0)
+            limiter.Release(Timespan::milliseconds(1));
+    }
+    REQUIRE(limiter.limit() == 8);
+
+    // Slow responses and drops decrease the limit down to the minimal one
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(limiter.TryAcquire());
+        limiter.Release(Timespan::milliseconds(100), (i % 2) == 0);
+    }
+    REQUIRE(limiter.limit() == 2);
+}
+
+TEST_CASE("Concurrency limiter gradient", "[CppCommon][Algorithms]")
+{
+    ConcurrencyLimiter limiter(16, 1, 100, Timespan::milliseconds(1), ConcurrencyLimiterAlgorithm::Gradient);
+    REQUIRE(limiter.algorithm() == ConcurrencyLimiterAlgorithm::Gradient);
+
+    // Minimal latency is observed
+    REQUIRE(limiter.TryAcquire());
+    limiter.Release(Timespan::milliseconds(1));
+
+    // Latency growth decreases the limit
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(limiter.TryAcquire());
+        limiter.Release(Timespan::milliseconds(10));
+    }
+    uint64_t limit = limiter.limit();
+    REQUIRE(limit < 16);
+    REQUIRE(limit >= 1);
+
+    // Latency back to normal increases the limit of the saturated limiter
+    for (int i = 0; i < 100; ++i)
+    {
+        for (uint64_t j = 0; j < limiter.limit(); ++j)
+            REQUIRE(limiter.TryAcquire());
+        while (limiter.inflight() > 0)
+            limiter.Release(Timespan::milliseconds(1));
+    }
+    REQUIRE(limiter.limit() > limit);
+
+    // Release with the start time of the limiter clock
+    REQUIRE(limiter.TryAcquire());
+    limiter.Release(limiter.now());
+    REQUIRE(limiter.inflight() == 0);
+}
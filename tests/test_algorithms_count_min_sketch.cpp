@@ -0,0 +1,57 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/count_min_sketch.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("Count-Min sketch", "[CppCommon][Algorithms]")
+{
+    auto dimensions = CountMinSketch<uint64_t>::Dimensions(0.001, 0.01);
+    REQUIRE(dimensions.first == 2719);
+    REQUIRE(dimensions.second == 5);
+
+    CountMinSketch<uint64_t> sketch(dimensions.first, dimensions.second);
+    REQUIRE(sketch.width() == 2719);
+    REQUIRE(sketch.depth() == 5);
+
+    // Heavy hitters and the long tail
+    for (uint64_t i = 0; i < 10; ++i)
+        sketch.Add(i, 1000);
+    for (uint64_t i = 10; i < 10000; ++i)
+        sketch.Add(i);
+    REQUIRE(sketch.total() == 19990);
+
+    // Estimation is never less than the actual frequency and the error is bounded
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        REQUIRE(sketch.Estimate(i) >= 1000);
+        REQUIRE(sketch.Estimate(i) <= 1000 + 20);
+    }
+    for (uint64_t i = 10; i < 10000; ++i)
+        REQUIRE(sketch.Estimate(i) >= 1);
+
+    // Merge sketches
+    CountMinSketch<uint64_t> other(dimensions.first, dimensions.second);
+    other.Add(0, 500);
+    sketch.Merge(other);
+    REQUIRE(sketch.Estimate(0) >= 1500);
+    REQUIRE(sketch.total() == 20490);
+
+    sketch.Clear();
+    REQUIRE(sketch.Estimate(0) == 0);
+    REQUIRE(sketch.total() == 0);
+}
+
+TEST_CASE("Count-Min sketch saturation", "[CppCommon][Algorithms]")
+{
+    CountMinSketch<std::string> sketch(16, 2);
+    sketch.Add("key", 0xFFFFFFF0);
+    sketch.Add("key", 0xFF);
+    REQUIRE(sketch.Estimate("key") == 0xFFFFFFFF);
+}
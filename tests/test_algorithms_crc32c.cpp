@@ -0,0 +1,50 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/crc32c.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+uint32_t ReferenceCRC32C(const uint8_t* data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; ++i)
+    {
+        crc ^= data[i];
+        for (int j = 0; j < 8; ++j)
+            crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78 : 0);
+    }
+    return ~crc;
+}
+
+} // namespace
+
+TEST_CASE("CRC32C", "[CppCommon][Algorithms]")
+{
+    // Check values
+    REQUIRE(CRC32C::Compute("", 0) == 0);
+    REQUIRE(CRC32C::Compute("123456789", 9) == 0xE3069283);
+    std::vector<uint8_t> zeros(32, 0);
+    REQUIRE(CRC32C::Compute(zeros.data(), zeros.size()) == 0x8A9136AA);
+
+    // Unaligned buffers of different sizes
+    std::vector<uint8_t> buffer(1000);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = (uint8_t)(i * 31 + 7);
+    for (size_t offset = 0; offset < 8; ++offset)
+        for (size_t size = 0; size < 100; ++size)
+            REQUIRE(CRC32C::Compute(buffer.data() + offset, size) == ReferenceCRC32C(buffer.data() + offset, size));
+
+    // Chained checksum
+    uint32_t crc = CRC32C::Compute(buffer.data(), 333);
+    crc = CRC32C::Compute(buffer.data() + 333, buffer.size() - 333, crc);
+    REQUIRE(crc == CRC32C::Compute(buffer.data(), buffer.size()));
+}
@@ -0,0 +1,90 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/cuckoo_filter.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Cuckoo filter", "[CppCommon][Algorithms]")
+{
+    CuckooFilter<uint64_t> filter(10000);
+    REQUIRE(filter.empty());
+    REQUIRE(filter.capacity() >= 10000);
+
+    for (uint64_t i = 0; i < 10000; ++i)
+        REQUIRE(filter.Insert(i));
+    REQUIRE(filter.size() == 10000);
+
+    // No false negatives
+    for (uint64_t i = 0; i < 10000; ++i)
+        REQUIRE(filter.Contains(i));
+
+    // False positive rate is close to the expected one
+    size_t positive = 0;
+    for (uint64_t i = 10000; i < 110000; ++i)
+        positive += filter.Contains(i) ? 1 : 0;
+    REQUIRE(positive < 100);
+
+    // Erase half of keys
+    for (uint64_t i = 0; i < 10000; i += 2)
+        REQUIRE(filter.Erase(i));
+    REQUIRE(filter.size() == 5000);
+    for (uint64_t i = 1; i < 10000; i += 2)
+        REQUIRE(filter.Contains(i));
+    size_t erased = 0;
+    for (uint64_t i = 0; i < 10000; i += 2)
+        erased += filter.Contains(i) ? 0 : 1;
+    REQUIRE(erased > 4900);
+
+    filter.Clear();
+    REQUIRE(filter.empty());
+    REQUIRE(!filter.Contains(1));
+}
+
+TEST_CASE("Cuckoo filter overflow", "[CppCommon][Algorithms]")
+{
+    CuckooFilter<uint64_t> filter(1000);
+
+    // Insert until the filter is full
+    uint64_t inserted = 0;
+    while (filter.Insert(inserted))
+        ++inserted;
+    REQUIRE(inserted > (filter.capacity() * 95 / 100));
+    REQUIRE(filter.size() == inserted);
+
+    // Failed insert keeps all previous keys
+    for (uint64_t i = 0; i < inserted; ++i)
+        REQUIRE(filter.Contains(i));
+}
+
+TEST_CASE("Cuckoo filter concurrent lookups", "[CppCommon][Algorithms]")
+{
+    CuckooFilter<uint64_t> filter(100000);
+
+    for (uint64_t i = 0; i < 1000; ++i)
+        REQUIRE(filter.Insert(i));
+
+    // Lookups of existing keys never fail while other keys are inserted
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> missed(0);
+    std::thread reader([&]()
+    {
+        while (!stop)
+            for (uint64_t i = 0; i < 1000; ++i)
+                if (!filter.Contains(i))
+                    ++missed;
+    });
+
+    for (uint64_t i = 1000; i < 90000; ++i)
+        filter.Insert(i);
+
+    stop = true;
+    reader.join();
+    REQUIRE(missed == 0);
+}
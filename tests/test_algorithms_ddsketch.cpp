@@ -0,0 +1,66 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/ddsketch.h"
+
+#include <cmath>
+
+using namespace CppCommon;
+
+TEST_CASE("DDSketch", "[CppCommon][Algorithms]")
+{
+    DDSketch sketch(0.01);
+    REQUIRE(sketch.empty());
+    REQUIRE(sketch.Quantile(0.5) == 0.0);
+
+    for (int i = 1; i <= 100000; ++i)
+        sketch.Add((double)i);
+    REQUIRE(sketch.count() == 100000);
+    REQUIRE(sketch.min() == 1.0);
+    REQUIRE(sketch.max() == 100000.0);
+    REQUIRE(sketch.mean() == Approx(50000.5));
+
+    // Quantiles are within the relative accuracy
+    for (double q : { 0.0, 0.1, 0.5, 0.9, 0.99, 0.999, 1.0 })
+    {
+        double expected = 1.0 + q * 99999.0;
+        REQUIRE(std::abs(sketch.Quantile(q) - expected) <= (0.01 * expected + 1.0));
+    }
+
+    // Zero values
+    sketch.Add(0.0, 100000);
+    REQUIRE(sketch.Quantile(0.25) == 0.0);
+    REQUIRE(sketch.min() == 0.0);
+
+    sketch.Clear();
+    REQUIRE(sketch.empty());
+    REQUIRE(sketch.bins() == 0);
+}
+
+TEST_CASE("DDSketch merge and collapse", "[CppCommon][Algorithms]")
+{
+    DDSketch sketch1(0.02);
+    DDSketch sketch2(0.02);
+
+    for (int i = 1; i <= 1000; ++i)
+        sketch1.Add((double)i);
+    for (int i = 1001; i <= 2000; ++i)
+        sketch2.Add((double)i);
+
+    sketch1.Merge(sketch2);
+    REQUIRE(sketch1.count() == 2000);
+    REQUIRE(sketch1.max() == 2000.0);
+    REQUIRE(std::abs(sketch1.Quantile(0.5) - 1000.0) <= 25.0);
+    REQUIRE(std::abs(sketch1.Quantile(0.99) - 1980.0) <= 45.0);
+
+    // Lowest bins are collapsed, but high quantiles keep the accuracy
+    DDSketch bounded(0.01, 100);
+    for (int i = 0; i < 10000; ++i)
+        bounded.Add(std::pow(10.0, -6.0 + 12.0 * i / 10000.0));
+    REQUIRE(bounded.bins() == 100);
+    double expected = std::pow(10.0, -6.0 + 12.0 * 0.99);
+    REQUIRE(std::abs(bounded.Quantile(0.99) - expected) <= (0.011 * expected));
+}
@@ -0,0 +1,43 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/gcra.h"
+
+#include <limits>
+
+using namespace CppCommon;
+
+TEST_CASE("Generic cell rate algorithm", "[CppCommon][Algorithms]")
+{
+    // Ten requests per second with a burst of five requests
+    GCRA gcra(10, 5);
+    REQUIRE(gcra.interval() == 100000000);
+    REQUIRE(gcra.tolerance() == 500000000);
+
+    uint64_t now = Timespan::seconds(100).total();
+
+    // Consume the whole burst
+    REQUIRE(gcra.TryConsume(5, now) == Timespan::zero());
+    REQUIRE(gcra.TryConsume(1, now) == Timespan::milliseconds(100));
+    REQUIRE(gcra.TryConsume(2, now) == Timespan::milliseconds(200));
+
+    // Requests are allowed after the wait time
+    now += Timespan::milliseconds(200).total();
+    REQUIRE(gcra.TryConsume(2, now) == Timespan::zero());
+    REQUIRE(gcra.TryConsume(1, now) == Timespan::milliseconds(100));
+
+    // Requests more than the burst are never allowed
+    REQUIRE(gcra.TryConsume(6, now) == Timespan(std::numeric_limits<int64_t>::max()));
+
+    // Idle limiter restores the full burst
+    now += Timespan::seconds(10).total();
+    REQUIRE(gcra.TryConsume(5, now) == Timespan::zero());
+    REQUIRE(gcra.TryConsume(1, now) != Timespan::zero());
+
+    gcra.Reset();
+    REQUIRE(gcra.Consume(5));
+    REQUIRE(!gcra.Consume());
+}
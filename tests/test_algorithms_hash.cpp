@@ -0,0 +1,96 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/hash.h"
+#include "containers/hashmap.h"
+
+#include <bit>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Fast hash", "[CppCommon][Algorithms]")
+{
+    // Deterministic and seeded
+    REQUIRE(FastHash::Compute64("hello") == FastHash::Compute64("hello", 5));
+    REQUIRE(FastHash::Compute64("hello") != FastHash::Compute64("hello", 1));
+    REQUIRE(FastHash::Compute64("hello") != FastHash::Compute64("hellp"));
+    REQUIRE(FastHash::Compute64("") != FastHash::Compute64(std::string_view("\0", 1)));
+
+    // No collisions for all sizes and unaligned buffers
+    std::vector<uint8_t> buffer(300);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = (uint8_t)(i * 31 + 7);
+    std::unordered_set<uint64_t> hashes;
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+        for (size_t size = 0; size <= 256; ++size)
+        {
+            std::vector<uint8_t> copy(buffer.begin() + offset, buffer.begin() + offset + size);
+            uint64_t hash = FastHash::Compute64(buffer.data() + offset, size);
+            REQUIRE(hash == FastHash::Compute64(copy.data(), copy.size()));
+            hashes.insert(hash);
+        }
+    }
+    REQUIRE(hashes.size() == 8 * 257 - 7);
+
+    // Single bit flip changes about half of hash bits
+    for (size_t size : { 3, 8, 16, 17, 48, 49, 100 })
+    {
+        uint64_t original = FastHash::Compute64(buffer.data(), size);
+        for (size_t bit = 0; bit < size * 8; ++bit)
+        {
+            std::vector<uint8_t> copy(buffer.begin(), buffer.begin() + size);
+            copy[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+            int changed = std::popcount(original ^ FastHash::Compute64(copy.data(), copy.size()));
+            REQUIRE(changed > 8);
+            REQUIRE(changed < 56);
+        }
+    }
+
+    // 128-bit hash
+    uint128_t hash128 = FastHash::Compute128("hello");
+    REQUIRE(hash128.lower() == FastHash::Compute64("hello"));
+    REQUIRE(hash128.upper() != hash128.lower());
+    REQUIRE(FastHash::Compute128("hello") != FastHash::Compute128("hellp"));
+
+    // Integer mixers are bijective
+    std::set<uint32_t> mixed32;
+    std::set<uint64_t> mixed64;
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        mixed32.insert(FastHash::Mix32(i));
+        mixed64.insert(FastHash::Mix64(i));
+    }
+    REQUIRE(mixed32.size() == 10000);
+    REQUIRE(mixed64.size() == 10000);
+    REQUIRE(FastHash::Mix64(0) == 0);
+    REQUIRE(FastHash::Mix64(1) != 1);
+}
+
+TEST_CASE("Fast hasher", "[CppCommon][Algorithms]")
+{
+    REQUIRE(FastHasher<std::string>()("key") == FastHash::Compute64("key"));
+    REQUIRE(FastHasher<std::string>()(std::string_view("key")) == FastHash::Compute64("key"));
+    REQUIRE(FastHasher<std::string_view>()("key") == FastHash::Compute64("key"));
+    REQUIRE(FastHasher<int>()(42) == FastHash::Mix64(42));
+
+    HashMap<std::string, int, FastHasher<std::string>> map;
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(map.emplace("key" + std::to_string(i), i).second);
+    REQUIRE(map.size() == 1000);
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(map.find("key" + std::to_string(i))->second == i);
+
+    HashMap<uint64_t, int, FastHasher<uint64_t>> integers(128, (uint64_t)-1);
+    for (uint64_t i = 0; i < 1000; ++i)
+        integers.emplace(i << 32, (int)i);
+    REQUIRE(integers.size() == 1000);
+    REQUIRE(integers.find((uint64_t)500 << 32)->second == 500);
+}
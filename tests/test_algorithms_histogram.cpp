@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/histogram.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Histogram buckets", "[CppCommon][Algorithms]")
+{
+    // Small values are recorded exactly
+    for (uint64_t value = 0; value < 32; ++value)
+    {
+        REQUIRE(HistogramSnapshot::Index(value, 5) == value);
+        REQUIRE(HistogramSnapshot::LowerBound((size_t)value, 5) == value);
+        REQUIRE(HistogramSnapshot::UpperBound((size_t)value, 5) == value);
+    }
+
+    // Bucket bounds contain the value with the bounded relative error
+    for (uint64_t value : { 32ull, 33ull, 63ull, 64ull, 1000ull, 123456789ull, 0xFFFFFFFFFFFFFFFFull })
+    {
+        size_t index = HistogramSnapshot::Index(value, 5);
+        REQUIRE(index < HistogramSnapshot::Buckets(5));
+        REQUIRE(HistogramSnapshot::LowerBound(index, 5) <= value);
+        REQUIRE(HistogramSnapshot::UpperBound(index, 5) >= value);
+        REQUIRE((HistogramSnapshot::UpperBound(index, 5) - HistogramSnapshot::LowerBound(index, 5)) <= (value / 32));
+    }
+    REQUIRE(HistogramSnapshot::Index(0xFFFFFFFFFFFFFFFFull, 5) == (HistogramSnapshot::Buckets(5) - 1));
+
+    // Buckets are continuous
+    for (size_t index = 1; index < HistogramSnapshot::Buckets(5); ++index)
+        REQUIRE(HistogramSnapshot::LowerBound(index, 5) == (HistogramSnapshot::UpperBound(index - 1, 5) + 1));
+}
+
+TEST_CASE("Histogram quantiles", "[CppCommon][Algorithms]")
+{
+    Histogram histogram(7, 4);
+    REQUIRE(histogram.precision() == 7);
+    REQUIRE(histogram.shards() == 4);
+
+    // Record latencies from 1 to 100000 microseconds
+    for (uint64_t i = 1; i <= 100000; ++i)
+        histogram.Record(Timespan::microseconds(i));
+
+    HistogramSnapshot snapshot = histogram.Snapshot();
+    REQUIRE(snapshot.count() == 100000);
+    REQUIRE(snapshot.mean() == Approx(50000500.0));
+    REQUIRE(snapshot.min() <= 1000);
+    REQUIRE(snapshot.max() >= 100000000);
+
+    // Quantiles are within the relative error
+    REQUIRE(snapshot.Quantile(0.5) == Approx(50000000.0).epsilon(0.01));
+    REQUIRE(snapshot.Quantile(0.99) == Approx(99000000.0).epsilon(0.01));
+    REQUIRE(snapshot.Quantile(0.999) == Approx(99900000.0).epsilon(0.01));
+    REQUIRE(snapshot.Quantile(1.0) == snapshot.max());
+
+    histogram.Reset();
+    REQUIRE(histogram.Snapshot().empty());
+    REQUIRE(histogram.Snapshot().Quantile(0.5) == 0);
+}
+
+TEST_CASE("Histogram rolling window and merge", "[CppCommon][Algorithms]")
+{
+    Histogram histogram;
+
+    // Concurrent records
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&histogram]() { for (int i = 0; i < 10000; ++i) histogram.Record(10); });
+    for (auto& thread : threads)
+        thread.join();
+
+    HistogramSnapshot previous = histogram.Snapshot();
+    REQUIRE(previous.count() == 40000);
+    REQUIRE(previous.sum() == 400000);
+
+    // Rolling window is the difference of snapshots
+    for (int i = 0; i < 100; ++i)
+        histogram.Record(1000000);
+    HistogramSnapshot window = histogram.Snapshot();
+    window.Subtract(previous);
+    REQUIRE(window.count() == 100);
+    REQUIRE(window.Quantile(0.5) >= 1000000);
+    REQUIRE(window.Quantile(0.5) <= 1031250);
+
+    // Merge snapshots
+    HistogramSnapshot merged;
+    merged.Merge(previous);
+    merged.Merge(window);
+    REQUIRE(merged.count() == 40100);
+    REQUIRE(merged.Quantile(0.5) == 10);
+    merged.Record(5, 100);
+    REQUIRE(merged.count() == 40200);
+    merged.Clear();
+    REQUIRE(merged.empty());
+}
@@ -0,0 +1,59 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/hyperloglog.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("HyperLogLog", "[CppCommon][Algorithms]")
+{
+    HyperLogLog<uint64_t> hll;
+    REQUIRE(hll.precision() == 14);
+    REQUIRE(hll.registers() == 16384);
+    REQUIRE(hll.Estimate() == 0.0);
+
+    // Small cardinality is estimated with linear counting
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        hll.Add(i);
+        hll.Add(i);
+    }
+    REQUIRE(std::abs(hll.Estimate() - 100) < 3);
+
+    // Large cardinality is estimated within several standard errors
+    for (uint64_t i = 0; i < 1000000; ++i)
+        hll.Add(i);
+    REQUIRE(std::abs(hll.Estimate() - 1000000) < 30000);
+
+    hll.Clear();
+    REQUIRE(hll.Estimate() == 0.0);
+}
+
+TEST_CASE("HyperLogLog merge", "[CppCommon][Algorithms]")
+{
+    HyperLogLog<std::string> hll1(12);
+    HyperLogLog<std::string> hll2(12);
+
+    for (int i = 0; i < 50000; ++i)
+        hll1.Add("key-" + std::to_string(i));
+    for (int i = 25000; i < 75000; ++i)
+        hll2.Add("key-" + std::to_string(i));
+
+    hll1.Merge(hll2);
+    REQUIRE(std::abs(hll1.Estimate() - 75000) < 5000);
+
+    // Export and import registers
+    std::vector<uint8_t> registers(hll1.registers());
+    REQUIRE(hll1.Export(registers) == registers.size());
+    HyperLogLog<std::string> hll3(12);
+    REQUIRE(hll3.Import(registers));
+    REQUIRE(hll3.Estimate() == hll1.Estimate());
+    REQUIRE(!hll3.Import(std::span<const uint8_t>(registers.data(), 10)));
+}
@@ -0,0 +1,88 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/lz4.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::string RoundTrip(const std::string& source, const std::string& dictionary = "")
+{
+    std::string compressed(LZ4::Bound(source.size()), 0);
+    size_t size = LZ4::Compress(source.data(), source.size(), compressed.data(), compressed.size(), dictionary.data(), dictionary.size());
+    REQUIRE(size > 0);
+    compressed.resize(size);
+
+    std::string result(source.size(), 0);
+    REQUIRE(LZ4::Decompress(compressed.data(), compressed.size(), result.data(), result.size(), dictionary.data(), dictionary.size()) == source.size());
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("LZ4", "[CppCommon][Algorithms]")
+{
+    // Empty, short and repetitive buffers
+    REQUIRE(RoundTrip("") == "");
+    REQUIRE(RoundTrip("a") == "a");
+    REQUIRE(RoundTrip("Hello, World!") == "Hello, World!");
+    std::string repeated(100000, 'x');
+    REQUIRE(RoundTrip(repeated) == repeated);
+
+    // Text compresses well
+    std::string text;
+    for (int i = 0; i < 1000; ++i)
+        text += "{\"id\":" + std::to_string(i) + ",\"name\":\"item\",\"tags\":[\"cache\",\"json\"]}";
+    REQUIRE(RoundTrip(text) == text);
+    std::string compressed(LZ4::Bound(text.size()), 0);
+    REQUIRE(LZ4::Compress(text.data(), text.size(), compressed.data(), compressed.size()) < (text.size() / 4));
+
+    // Random buffers fit into the bound
+    std::mt19937 generator(42);
+    for (size_t length : { 15, 100, 4096, 70000 })
+    {
+        std::string random(length, 0);
+        for (auto& ch : random)
+            ch = (char)(generator() % ((length % 2) ? 256 : 4));
+        REQUIRE(RoundTrip(random) == random);
+    }
+
+    // Small destination buffer is rejected
+    std::string small(8, 0);
+    REQUIRE(LZ4::Compress(text.data(), text.size(), small.data(), small.size()) == 0);
+
+    // Malformed blocks are rejected
+    std::string result(16, 0);
+    REQUIRE(LZ4::Decompress("\xF0", 1, result.data(), result.size()) == SIZE_MAX);
+    REQUIRE(LZ4::Decompress("\x14" "a\x05\x00", 4, result.data(), result.size()) == SIZE_MAX);
+}
+
+TEST_CASE("LZ4 with dictionary", "[CppCommon][Algorithms]")
+{
+    std::string dictionary = "<html><head><title></title></head><body><div class=\"content\"></div></body></html>";
+    std::string source = "<html><head><title>Page</title></head><body><div class=\"content\">Hello</div></body></html>";
+    REQUIRE(RoundTrip(source, dictionary) == source);
+
+    // Dictionary improves the compression of small buffers
+    std::string compressed(LZ4::Bound(source.size()), 0);
+    size_t plain = LZ4::Compress(source.data(), source.size(), compressed.data(), compressed.size());
+    size_t shared = LZ4::Compress(source.data(), source.size(), compressed.data(), compressed.size(), dictionary.data(), dictionary.size());
+    REQUIRE(shared < plain);
+
+    // Block compressed with the dictionary could not be decompressed without it
+    std::string result(source.size(), 0);
+    REQUIRE(LZ4::Decompress(compressed.data(), shared, result.data(), result.size()) == SIZE_MAX);
+
+    // Large dictionary uses only the last window
+    std::string large(100000, 'y');
+    large += dictionary;
+    REQUIRE(RoundTrip(source, large) == source);
+}
@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/radix_sort.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Record
+{
+    int64_t key;
+    size_t order;
+};
+
+std::string RandomString(std::mt19937_64& generator)
+{
+    std::string result(generator() % 12, ' ');
+    for (auto& ch : result)
+        ch = (char)('a' + generator() % 4);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Radix sort", "[CppCommon][Algorithms]")
+{
+    std::mt19937_64 generator(1);
+
+    // Small and large ranges of unsigned keys
+    for (size_t count : { 0, 1, 100, 100000 })
+    {
+        std::vector<uint64_t> values(count);
+        for (auto& value : values)
+            value = generator();
+        std::vector<uint64_t> expected(values);
+        std::sort(expected.begin(), expected.end());
+        RadixSort(values.begin(), values.end());
+        REQUIRE(values == expected);
+    }
+
+    // Signed and floating point keys
+    std::vector<int32_t> integers(10000);
+    for (auto& value : integers)
+        value = (int32_t)generator();
+    RadixSort(integers.begin(), integers.end());
+    REQUIRE(std::is_sorted(integers.begin(), integers.end()));
+
+    std::vector<double> doubles(10000);
+    for (auto& value : doubles)
+        value = ((double)(int64_t)generator()) / 1000.0;
+    RadixSort(doubles.begin(), doubles.end());
+    REQUIRE(std::is_sorted(doubles.begin(), doubles.end()));
+
+    // 128-bit keys
+    std::vector<uint128_t> wide(10000);
+    for (auto& value : wide)
+        value = uint128_t(generator() % 16, generator());
+    RadixSort(wide.begin(), wide.end());
+    REQUIRE(std::is_sorted(wide.begin(), wide.end()));
+
+    // UUID keys
+    std::vector<UUID> uuids(1000);
+    for (auto& uuid : uuids)
+        uuid = UUID::Random();
+    RadixSort(uuids.begin(), uuids.end());
+    REQUIRE(std::is_sorted(uuids.begin(), uuids.end()));
+}
+
+TEST_CASE("Radix sort key projection", "[CppCommon][Algorithms]")
+{
+    std::mt19937_64 generator(2);
+
+    // Sort of records with few distinct keys is stable
+    std::vector<Record> records(50000);
+    for (size_t i = 0; i < records.size(); ++i)
+        records[i] = Record{ (int64_t)(generator() % 100) - 50, i };
+    DefaultMemoryManager manager;
+    RadixSort(records.begin(), records.end(), [](const Record& record) { return record.key; }, manager);
+    REQUIRE(manager.allocations() == 0);
+    bool stable = true;
+    for (size_t i = 1; i < records.size(); ++i)
+        stable = stable && ((records[i - 1].key < records[i].key) || ((records[i - 1].key == records[i].key) && (records[i - 1].order < records[i].order)));
+    REQUIRE(stable);
+
+    // String keys
+    std::vector<std::string> strings(20000);
+    for (auto& string : strings)
+        string = RandomString(generator);
+    std::vector<std::string> expected(strings);
+    std::sort(expected.begin(), expected.end());
+    RadixSort(strings.begin(), strings.end());
+    REQUIRE(strings == expected);
+}
+
+TEST_CASE("Parallel radix sort", "[CppCommon][Algorithms]")
+{
+    ThreadPool pool(4);
+    std::mt19937_64 generator(3);
+
+    std::vector<uint64_t> values(1000000);
+    for (auto& value : values)
+        value = generator() >> 8;
+    std::vector<uint64_t> expected(values);
+    std::sort(expected.begin(), expected.end());
+    ParallelRadixSort(pool, values.begin(), values.end());
+    REQUIRE(values == expected);
+
+    // Stable sort of records
+    std::vector<Record> records(500000);
+    for (size_t i = 0; i < records.size(); ++i)
+        records[i] = Record{ (int64_t)(generator() % 1000), i };
+    ParallelOptions options;
+    options.concurrency = 3;
+    ParallelRadixSort(pool, records.begin(), records.end(), [](const Record& record) { return record.key; }, options);
+    bool stable = true;
+    for (size_t i = 1; i < records.size(); ++i)
+        stable = stable && ((records[i - 1].key < records[i].key) || ((records[i - 1].key == records[i].key) && (records[i - 1].order < records[i].order)));
+    REQUIRE(stable);
+
+    // String keys
+    std::vector<std::string> strings(200000);
+    for (auto& string : strings)
+        string = RandomString(generator);
+    std::vector<std::string> sorted(strings);
+    std::sort(sorted.begin(), sorted.end());
+    ParallelRadixSort(pool, strings.begin(), strings.end());
+    REQUIRE(strings == sorted);
+}
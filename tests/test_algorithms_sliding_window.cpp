@@ -0,0 +1,51 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/sliding_window.h"
+
+#include <limits>
+
+using namespace CppCommon;
+
+TEST_CASE("Sliding window", "[CppCommon][Algorithms]")
+{
+    // Ten requests per one second window
+    SlidingWindow sw(10, Timespan::seconds(1));
+    REQUIRE(sw.limit() == 10);
+    REQUIRE(sw.window() == Timespan::seconds(1));
+
+    uint64_t now = Timespan::seconds(100).total();
+
+    // Consume all requests in the current window
+    REQUIRE(sw.TryConsume(10, now) == Timespan::zero());
+    REQUIRE(sw.Count(now) == 10);
+
+    // Next request waits until the next window and the overlap decays for one request
+    REQUIRE(sw.TryConsume(1, now) == Timespan::milliseconds(1100));
+
+    // Half of the previous window overlaps the sliding window
+    now += Timespan::milliseconds(1500).total();
+    REQUIRE(sw.Count(now) == 5);
+    REQUIRE(sw.TryConsume(5, now) == Timespan::zero());
+    REQUIRE(sw.Count(now) == 10);
+
+    // Wait until the previous window overlap decays for one request
+    REQUIRE(sw.TryConsume(1, now) == Timespan::milliseconds(100));
+    now += Timespan::milliseconds(100).total();
+    REQUIRE(sw.TryConsume(1, now) == Timespan::zero());
+
+    // Requests more than the limit are never allowed
+    REQUIRE(sw.TryConsume(11, now) == Timespan(std::numeric_limits<int64_t>::max()));
+
+    // Both windows are expired after the long idle period
+    now += Timespan::seconds(10).total();
+    REQUIRE(sw.Count(now) == 0);
+    REQUIRE(sw.TryConsume(10, now) == Timespan::zero());
+
+    sw.Reset();
+    REQUIRE(sw.Consume(10));
+    REQUIRE(!sw.Consume());
+}
@@ -0,0 +1,118 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/timing_wheel.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Timing wheel", "[CppCommon][Algorithms]")
+{
+    Timestamp start(Timespan::hours(1000).total());
+    TimingWheel<int> wheel(start);
+    REQUIRE(wheel.empty());
+
+    std::vector<int> expired;
+    auto handler = [&expired](int& value) { expired.push_back(value); };
+
+    // Insert deadlines into different levels of the timing wheel
+    wheel.insert(start + Timespan::milliseconds(10), 1);
+    wheel.insert(start + Timespan::milliseconds(10), 2);
+    auto handle = wheel.insert(start + Timespan::seconds(5), 3);
+    wheel.insert(start + Timespan::minutes(5), 4);
+    wheel.insert(start + Timespan::hours(5), 5);
+    wheel.insert(start + Timespan::days(5), 6);
+    REQUIRE(wheel.size() == 6);
+
+    // Nothing is expired yet
+    REQUIRE(wheel.advance(start + Timespan::milliseconds(9), handler) == 0);
+
+    // Entries with the same deadline are both expired
+    REQUIRE(wheel.advance(start + Timespan::milliseconds(10), handler) == 2);
+    REQUIRE(expired == std::vector<int>({ 2, 1 }));
+
+    // Remove the deadline
+    REQUIRE(wheel.remove(handle));
+    REQUIRE(!wheel.remove(handle));
+    REQUIRE(wheel.size() == 3);
+
+    REQUIRE(wheel.advance(start + Timespan::minutes(5) - Timespan::milliseconds(1), handler) == 0);
+    REQUIRE(wheel.advance(start + Timespan::minutes(5), handler) == 1);
+    REQUIRE(expired.back() == 4);
+    REQUIRE(wheel.advance(start + Timespan::hours(5), handler) == 1);
+    REQUIRE(expired.back() == 5);
+    REQUIRE(wheel.advance(start + Timespan::days(5) - Timespan::milliseconds(1), handler) == 0);
+    REQUIRE(wheel.advance(start + Timespan::days(5), handler) == 1);
+    REQUIRE(expired.back() == 6);
+    REQUIRE(wheel.empty());
+
+    // Deadlines in the past are expired with the next advance
+    wheel.insert(start, 7);
+    REQUIRE(wheel.advance(wheel.current(), handler) == 1);
+    REQUIRE(expired.back() == 7);
+}
+
+TEST_CASE("Timing wheel random deadlines", "[CppCommon][Algorithms]")
+{
+    Timestamp start(0);
+    TimingWheel<uint64_t> wheel(start);
+
+    // Insert many deadlines with pseudo-random offsets up to two hours
+    uint64_t seed = 1;
+    for (int i = 0; i < 10000; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t deadline = (seed >> 33) % Timespan::hours(2).milliseconds();
+        wheel.insert(Timestamp(Timespan::milliseconds(deadline).total()), deadline);
+    }
+
+    // Advance the timing wheel and check all deadlines are expired in time
+    uint64_t now = 0;
+    size_t expired = 0;
+    while (now <= (uint64_t)Timespan::hours(2).milliseconds())
+    {
+        now += 777;
+        expired += wheel.advance(Timestamp(Timespan::milliseconds(now).total()), [now](uint64_t& deadline)
+        {
+            REQUIRE(deadline <= now);
+            REQUIRE(deadline > (now - 777));
+        });
+    }
+    REQUIRE(expired == 10000);
+    REQUIRE(wheel.empty());
+}
+
+TEST_CASE("Timing wheel bounded advance", "[CppCommon][Algorithms]")
+{
+    Timestamp start(0);
+    TimingWheel<int> wheel(start);
+
+    // Insert many values into the same slot and several slots behind it
+    std::vector<TimingWheel<int>::Handle> handles;
+    for (int i = 0; i < 100; ++i)
+        handles.push_back(wheel.insert(Timestamp(Timespan::milliseconds(10).total()), i));
+    for (int i = 100; i < 110; ++i)
+        wheel.insert(Timestamp(Timespan::milliseconds(20).total()), i);
+
+    std::vector<int> expired;
+    auto handler = [&expired](int& value) { expired.push_back(value); };
+
+    // Expire values in bounded chunks
+    REQUIRE(wheel.advance(Timestamp(Timespan::milliseconds(30).total()), handler, 30) == 30);
+    REQUIRE(wheel.size() == 80);
+
+    // Cancel values waiting in the detached slot
+    for (int i = 0; i < 100; ++i)
+        wheel.remove(handles[i]);
+    REQUIRE(wheel.size() == 10);
+
+    REQUIRE(wheel.advance(Timestamp(Timespan::milliseconds(30).total()), handler, 30) == 10);
+    REQUIRE(wheel.empty());
+    REQUIRE(expired.size() == 40);
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(expired[30 + i] >= 100);
+}
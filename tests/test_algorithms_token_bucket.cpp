@@ -8,6 +8,8 @@
 #include "threads/thread.h"
 #include "time/timestamp.h"
 
+#include <limits>
+
 using namespace CppCommon;
 
 TEST_CASE("Token bucket", "[CppCommon][Algorithms]")
@@ -38,3 +40,66 @@ TEST_CASE("Token bucket", "[CppCommon][Algorithms]")
     REQUIRE(!tb.Consume(1));
     REQUIRE(!tb.Consume(10));
 }
+
+TEST_CASE("Token bucket wait time", "[CppCommon][Algorithms]")
+{
+    // Ten tokens per second with a burst of five tokens
+    TokenBucket tb(10, 5, TokenBucketClock::CoarseNano);
+    REQUIRE(tb.clock() == TokenBucketClock::CoarseNano);
+
+    uint64_t now = Timespan::seconds(100).total();
+
+    REQUIRE(tb.TryConsume(5, now) == Timespan::zero());
+    REQUIRE(tb.TryConsume(1, now) == Timespan::milliseconds(100));
+    REQUIRE(tb.TryConsume(3, now) == Timespan::milliseconds(300));
+
+    // Tokens are available after the wait time
+    now += Timespan::milliseconds(300).total();
+    REQUIRE(tb.TryConsume(3, now) == Timespan::zero());
+    REQUIRE(tb.TryConsume(1, now) == Timespan::milliseconds(100));
+
+    // More tokens than the burst will never be available
+    REQUIRE(tb.TryConsume(6, now) == Timespan(std::numeric_limits<int64_t>::max()));
+}
+
+TEST_CASE("Token bucket batched consume", "[CppCommon][Algorithms]")
+{
+    TokenBucket tb(1, 10);
+
+    // Consume all available tokens but not more than requested
+    REQUIRE(tb.ConsumeUpTo(4) == 4);
+    REQUIRE(tb.ConsumeUpTo(100) == 6);
+    REQUIRE(tb.ConsumeUpTo(100) == 0);
+    REQUIRE(!tb.Consume());
+}
+
+TEST_CASE("Token bucket set", "[CppCommon][Algorithms]")
+{
+    // Ten tokens per second with a burst of two tokens for each key
+    TokenBucketSet<uint64_t> tbs(10, 2, 0, 16);
+    REQUIRE(tbs.empty());
+
+    uint64_t now = Timespan::seconds(100).total();
+
+    // Each key has its own token bucket
+    for (uint64_t key = 1; key <= 100; ++key)
+    {
+        REQUIRE(tbs.TryConsume(key, 2, now) == Timespan::zero());
+        REQUIRE(tbs.TryConsume(key, 1, now) == Timespan::milliseconds(100));
+    }
+    REQUIRE(tbs.size() == 100);
+
+    now += Timespan::milliseconds(100).total();
+    REQUIRE(tbs.TryConsume(1, 1, now) == Timespan::zero());
+    REQUIRE(tbs.TryConsume(1, 1, now) == Timespan::milliseconds(100));
+
+    // Erased key gets a full token bucket
+    REQUIRE(tbs.Erase(2));
+    REQUIRE(!tbs.Erase(2));
+    REQUIRE(tbs.TryConsume(2, 2, now) == Timespan::zero());
+
+    tbs.Clear();
+    REQUIRE(tbs.empty());
+    REQUIRE(tbs.Consume(1));
+    REQUIRE(tbs.size() == 1);
+}
@@ -0,0 +1,80 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "algorithms/top_k.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("Top-K", "[CppCommon][Algorithms]")
+{
+    TopK<std::string> topk(10);
+    REQUIRE(topk.empty());
+    REQUIRE(topk.capacity() == 10);
+
+    // Heavy hitters in the long tail of unique keys
+    for (int i = 0; i < 10000; ++i)
+    {
+        topk.Add("hot1");
+        if ((i % 2) == 0)
+            topk.Add("hot2");
+        if ((i % 4) == 0)
+            topk.Add("hot3");
+        topk.Add("cold" + std::to_string(i));
+    }
+    REQUIRE(topk.size() == 10);
+    REQUIRE(topk.total() == 27500);
+
+    auto top = topk.Top(3);
+    REQUIRE(top.size() == 3);
+    REQUIRE(top[0].key == "hot1");
+    REQUIRE(top[1].key == "hot2");
+    REQUIRE(top[2].key == "hot3");
+
+    // Counts are never less than the actual ones and the error is bounded
+    for (const auto& item : top)
+    {
+        REQUIRE(item.count >= item.error);
+        REQUIRE(item.error <= topk.total() / topk.capacity());
+    }
+    REQUIRE(topk.Estimate("hot1") >= 10000);
+    REQUIRE(topk.Estimate("hot1") <= 10000 + topk.total() / topk.capacity());
+    REQUIRE(topk.Estimate("unknown") == 0);
+
+    topk.Clear();
+    REQUIRE(topk.empty());
+}
+
+TEST_CASE("Top-K merge", "[CppCommon][Algorithms]")
+{
+    TopK<int> topk1(4);
+    TopK<int> topk2(4);
+
+    topk1.Add(1, 100);
+    topk1.Add(2, 50);
+    topk2.Add(2, 80);
+    topk2.Add(3, 60);
+    topk2.Add(4, 10);
+
+    topk1.Merge(topk2);
+    REQUIRE(topk1.total() == 300);
+    REQUIRE(topk1.size() == 4);
+
+    auto top = topk1.Top();
+    REQUIRE(top.size() == 4);
+    REQUIRE(top[0].key == 2);
+    REQUIRE(top[0].count == 130);
+    REQUIRE(top[1].key == 1);
+    REQUIRE(top[1].count == 100);
+    REQUIRE(top[2].key == 3);
+    REQUIRE(top[3].key == 4);
+
+    // Merged estimator keeps tracking
+    topk1.Add(5, 1000);
+    REQUIRE(topk1.Top(1)[0].key == 5);
+    REQUIRE(topk1.Estimate(4) == 0);
+}
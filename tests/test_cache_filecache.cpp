@@ -7,6 +7,9 @@
 #include "cache/filecache.h"
 #include "threads/thread.h"
 
+#include <random>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("File cache", "[CppCommon][Cache]")
@@ -63,3 +66,321 @@ TEST_CASE("File cache", "[CppCommon][Cache]")
     REQUIRE(cache.empty());
     REQUIRE(cache.size() == 0);
 }
+
+TEST_CASE("File cache with memory-mapped files", "[CppCommon][Cache]")
+{
+    Directory test = Directory::Create(Path::current() / "cache");
+    Directory::Create(test / "static");
+    File::WriteAllText(test / "index.html", "<html></html>");
+    File::WriteAllText(test / "static" / "app.js", "app();");
+
+    FileCache cache;
+
+    // Map the cache path
+    REQUIRE(cache.insert_path_mapped(test, "/", Timespan::milliseconds(100)));
+    REQUIRE(cache.find_path(test));
+    REQUIRE(cache.size() == 2);
+
+    auto result = cache.find("/index.html");
+    REQUIRE(result.first);
+    REQUIRE(result.second == "<html></html>");
+    result = cache.find("/static/app.js");
+    REQUIRE(result.first);
+    REQUIRE(result.second == "app();");
+
+    // Insert a single memory-mapped file
+    REQUIRE(cache.insert_file("/app.js", test / "static" / "app.js"));
+    REQUIRE(cache.find("/app.js").second == "app();");
+    REQUIRE(!cache.insert_file("/missing.js", test / "missing.js"));
+
+    // Cache path is refreshed by the watchdog in the memory-mapped mode
+    File::WriteAllText(test / "index.html", "<html>updated</html>");
+    Thread::SleepFor(Timespan::milliseconds(200));
+    cache.watchdog();
+    REQUIRE(cache.find_path(test));
+    REQUIRE(cache.find("/index.html").second == "<html>updated</html>");
+
+    cache.clear();
+    Directory::RemoveAll(test);
+}
+
+TEST_CASE("File cache with watched path", "[CppCommon][Cache]")
+{
+    if (!DirectoryWatcher::IsSupported())
+        return;
+
+    Directory test = Directory::Create(Path::current() / "watch");
+    Directory::Create(test / "static");
+    File::WriteAllText(test / "index.html", "<html></html>");
+    File::WriteAllText(test / "static" / "app.js", "app();");
+    File::WriteAllText(test / "static" / "old.js", "old();");
+
+    FileCache cache;
+
+    size_t inserted = 0;
+    auto handler = [&inserted](FileCache& cache, const std::string& key, const std::string& value, const Timespan& timeout)
+    {
+        ++inserted;
+        return cache.insert(key, value, timeout);
+    };
+
+    // Insert and watch the cache path
+    REQUIRE(cache.insert_path(test, "/", Timespan(0), handler));
+    REQUIRE(cache.watch_path(test));
+    REQUIRE(!cache.watch_path(test / "missing"));
+    REQUIRE(cache.size() == 3);
+    REQUIRE(inserted == 3);
+
+    // Change the watched path
+    File::WriteAllText(test / "index.html", "<html>updated</html>");
+    File::WriteAllText(test / "static" / "new.js", "new();");
+    File::Remove(test / "static" / "old.js");
+    Directory::Create(test / "images");
+    File::WriteAllText(test / "images" / "logo.svg", "<svg/>");
+
+    // Apply changes
+    cache.refresh();
+
+    // Handler is called only for changed and new files
+    REQUIRE(cache.find("/index.html").second == "<html>updated</html>");
+    REQUIRE(cache.find("/static/app.js").second == "app();");
+    REQUIRE(cache.find("/static/new.js").second == "new();");
+    REQUIRE(!cache.find("/static/old.js").first);
+    REQUIRE(cache.find("/images/logo.svg").second == "<svg/>");
+    REQUIRE(cache.size() == 4);
+    REQUIRE(inserted >= 6);
+    REQUIRE(inserted <= 7);
+
+    // Remove the sub-directory
+    Directory::RemoveAll(test / "static");
+    cache.refresh();
+    REQUIRE(!cache.find("/static/app.js").first);
+    REQUIRE(!cache.find("/static/new.js").first);
+    REQUIRE(cache.size() == 2);
+
+    cache.clear();
+    Directory::RemoveAll(test);
+}
+
+TEST_CASE("File cache batch operations", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    std::pair<std::string, std::string> items[] = { { "a", "1" }, { "b", "2" }, { "c", "3" } };
+    REQUIRE(cache.insert_many(items, 3) == 3);
+    REQUIRE(cache.size() == 3);
+
+    std::string keys[] = { "a", "c", "d" };
+    std::pair<bool, std::string_view> results[3];
+    REQUIRE(cache.find_many(keys, 3, results) == 2);
+    REQUIRE((results[0].first && (results[0].second == "1")));
+    REQUIRE((results[1].first && (results[1].second == "3")));
+    REQUIRE(!results[2].first);
+
+    REQUIRE(cache.remove_many(keys, 3) == 2);
+    REQUIRE(cache.size() == 1);
+}
+
+TEST_CASE("File cache heterogeneous lookup", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    REQUIRE(cache.insert("/index.html", "<html></html>"));
+
+    std::string_view request = "GET /index.html HTTP/1.1";
+    std::string_view key = request.substr(4, 11);
+    REQUIRE(cache.find(key).second == "<html></html>");
+    REQUIRE(cache.find("/index.html").first);
+    REQUIRE(!cache.find(request).first);
+    REQUIRE(cache.remove(key));
+    REQUIRE(cache.empty());
+}
+
+TEST_CASE("File cache with coarse clock", "[CppCommon][Cache]")
+{
+    FileCache cache;
+    REQUIRE(!cache.coarse_clock());
+    cache.set_coarse_clock(true);
+    REQUIRE(cache.coarse_clock());
+
+    REQUIRE(cache.insert("/index.html", "<html></html>"));
+    REQUIRE(cache.insert("/temp.html", "<html></html>", Timespan::milliseconds(100)));
+
+    Timestamp timeout;
+    REQUIRE(cache.find("/temp.html", timeout).first);
+    REQUIRE(timeout > CoarseUtcTimestamp());
+
+    // Watchdog the file cache to erase entries with timeout
+    cache.watchdog(UtcTimestamp() + Timespan::milliseconds(200));
+    REQUIRE(cache.find("/index.html").first);
+    REQUIRE(!cache.find("/temp.html").first);
+}
+
+TEST_CASE("File cache statistics", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    REQUIRE(cache.insert("a", "1234"));
+    REQUIRE(cache.insert("b", "12", Timespan::milliseconds(10)));
+    REQUIRE(cache.find("a").first);
+    REQUIRE(!cache.find("c").first);
+
+    CacheStatistics statistics = cache.statistics();
+    REQUIRE(statistics.inserts == 2);
+    REQUIRE(statistics.hits == 1);
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.entries == 2);
+    REQUIRE(statistics.bytes == 6);
+
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(1));
+    REQUIRE(cache.remove("a"));
+
+    statistics = cache.statistics();
+    REQUIRE(statistics.expirations == 1);
+    REQUIRE(statistics.removals == 1);
+    REQUIRE(statistics.entries == 0);
+    REQUIRE(statistics.bytes == 0);
+    REQUIRE(statistics.lock_samples > 0);
+}
+
+TEST_CASE("File cache background watchdog", "[CppCommon][Cache]")
+{
+    FileCache cache;
+
+    // Expire many entries at once
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(std::to_string(i), "value", Timespan::milliseconds(10));
+    cache.insert("key", "value");
+
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(1));
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.statistics().bytes == 5);
+
+    cache.insert("1", "1", Timespan::milliseconds(10));
+    REQUIRE(cache.start_watchdog(Timespan::milliseconds(10)));
+
+    // Wait for the background watchdog
+    for (int i = 0; (i < 1000) && (cache.size() > 1); ++i)
+        Thread::Sleep(10);
+    REQUIRE(cache.size() == 1);
+
+    REQUIRE(cache.stop_watchdog());
+}
+
+TEST_CASE("File cache snapshot", "[CppCommon][Cache]")
+{
+    Path path = Path::temp() / "test_cache_filecache.snapshot";
+
+    FileCache cache;
+    cache.insert("123", "123");
+    cache.insert("456", "456", Timespan::seconds(100));
+    cache.insert("789", "789", Timespan::milliseconds(1));
+    REQUIRE(cache.snapshot(path) == 3);
+
+    // Sleep for a while...
+    Thread::SleepFor(Timespan::milliseconds(10));
+
+    // Restore the snapshot with remaining timeouts
+    FileCache restored;
+    REQUIRE(restored.restore(path) == 2);
+    REQUIRE(restored.size() == 2);
+    REQUIRE(restored.find("123").second == "123");
+    Timestamp timeout;
+    REQUIRE(restored.find("456", timeout).second == "456");
+    REQUIRE(timeout > UtcTimestamp() + Timespan::seconds(90));
+    REQUIRE(!restored.find("789").first);
+
+    // Corrupted snapshot is rejected
+    File::WriteAllText(path, "corrupted");
+    REQUIRE_THROWS_AS(restored.restore(path), FileSystemException);
+    Path::Remove(path);
+}
+
+TEST_CASE("File cache compression", "[CppCommon][Cache]")
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "{\"id\":" + std::to_string(i) + ",\"name\":\"item\"}";
+    std::mt19937 generator(42);
+    std::string random(2048, 0);
+    for (auto& ch : random)
+        ch = (char)generator();
+
+    auto codec = std::make_shared<LZ4CacheCodec>();
+
+    FileCache cache;
+    cache.set_compression(codec, 64);
+    cache.insert("text", text);
+    cache.insert("small", "small");
+    cache.insert("random", random);
+    REQUIRE(cache.statistics().bytes < (text.size() / 2 + 5 + random.size()));
+
+    // Compressed values are decompressed transparently
+    REQUIRE(cache.find("text").second == text);
+    REQUIRE(cache.find("small").second == "small");
+    REQUIRE(cache.find("random").second == random);
+    std::string keys[] = { "text", "random" };
+    std::pair<bool, std::string_view> results[2];
+    REQUIRE(cache.find_many(keys, 2, results) == 2);
+    REQUIRE(results[0].second == text);
+    REQUIRE(results[1].second == random);
+
+    // Compressed bytes are served as is
+    auto compressed = cache.find_compressed("text", "lz4");
+    REQUIRE(compressed.first);
+    std::string value;
+    REQUIRE(codec->decompress(compressed.second, text.size(), value));
+    REQUIRE(value == text);
+    REQUIRE(!cache.find_compressed("text", "zstd").first);
+    REQUIRE(!cache.find_compressed("small", "lz4").first);
+    REQUIRE(!cache.find_compressed("random", "lz4").first);
+
+    // Compressed values are saved into the snapshot decompressed
+    Path path = Path::temp() / "test_cache_filecache_compression.snapshot";
+    REQUIRE(cache.snapshot(path) == 3);
+    FileCache restored;
+    REQUIRE(restored.restore(path) == 3);
+    REQUIRE(restored.find("text").second == text);
+    REQUIRE(!restored.find_compressed("text", "lz4").first);
+    Path::Remove(path);
+
+    // Values keep their codecs when the compression is disabled
+    cache.set_compression(nullptr);
+    cache.insert("plain", text);
+    REQUIRE(cache.find("text").second == text);
+    REQUIRE(cache.find_compressed("text", "lz4").first);
+    REQUIRE(!cache.find_compressed("plain", "lz4").first);
+}
+
+TEST_CASE("File cache prefixes", "[CppCommon][Cache]")
+{
+    FileCache cache;
+    cache.insert("/", "index");
+    cache.insert("/api", "api");
+    cache.insert("/api/users", "users");
+    cache.insert("/static/css/main.css", "css");
+    cache.insert("/static/js/main.js", "js", Timespan::seconds(100));
+
+    // Longest prefix match
+    std::string_view prefix;
+    auto result = cache.find_prefix("/api/users/42", prefix);
+    REQUIRE(result.first);
+    REQUIRE(prefix == "/api/users");
+    REQUIRE(result.second == "users");
+    REQUIRE(cache.find_prefix("/about", prefix).second == "index");
+    REQUIRE(prefix == "/");
+    REQUIRE(!cache.find_prefix("about", prefix).first);
+
+    // Walk the virtual directory
+    std::vector<std::string> items;
+    REQUIRE(cache.walk("/static/", [&items](std::string_view key, std::string_view value) { items.emplace_back(std::string(key) + "=" + std::string(value)); return true; }) == 2);
+    REQUIRE(items == std::vector<std::string>({ "/static/css/main.css=css", "/static/js/main.js=js" }));
+    REQUIRE(cache.walk("/missing/", [](std::string_view, std::string_view) { return true; }) == 0);
+
+    // Remove and expire keys of the virtual directory
+    REQUIRE(cache.remove("/static/css/main.css"));
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(200));
+    REQUIRE(!cache.find("/static/js/main.js").first);
+    REQUIRE(cache.find("/api").first);
+    REQUIRE(cache.size() == 3);
+}
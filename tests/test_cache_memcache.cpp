@@ -7,6 +7,11 @@
 #include "cache/memcache.h"
 #include "threads/thread.h"
 
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Memory cache", "[CppCommon][Cache]")
@@ -63,3 +68,435 @@ TEST_CASE("Memory cache", "[CppCommon][Cache]")
     REQUIRE(cache.empty());
     REQUIRE(cache.size() == 0);
 }
+
+TEST_CASE("Memory cache with shards", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(8);
+    REQUIRE(cache.shards() == 8);
+    REQUIRE(cache.empty());
+
+    // Fill the memory cache
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(i, i * 10, (i % 2) ? CppCommon::Timespan::milliseconds(100) : CppCommon::Timespan(0));
+    REQUIRE(cache.size() == 1000);
+
+    // Get the memory cache values
+    int result = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        REQUIRE(cache.find(i, result));
+        REQUIRE(result == i * 10);
+    }
+
+    // Sleep for a while...
+    Thread::SleepFor(Timespan::milliseconds(200));
+
+    // Watchdog the memory cache to erase entries with timeout
+    cache.watchdog();
+    REQUIRE(cache.size() == 500);
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(cache.find(i) == ((i % 2) == 0));
+
+    // Swap memory caches
+    MemCache<int, int> other;
+    swap(cache, other);
+    REQUIRE(cache.empty());
+    REQUIRE(cache.shards() == 1);
+    REQUIRE(other.size() == 500);
+    REQUIRE(other.shards() == 8);
+
+    // Swap memory caches in opposite directions concurrently
+    std::thread swapper([&cache, &other]() { for (int i = 0; i < 1000; ++i) cache.swap(other); });
+    for (int i = 0; i < 1001; ++i)
+        other.swap(cache);
+    swapper.join();
+    REQUIRE(cache.size() == 500);
+    REQUIRE(cache.shards() == 8);
+    REQUIRE(other.empty());
+    REQUIRE(other.shards() == 1);
+
+    // Swap the memory cache with itself
+    cache.swap(cache);
+    REQUIRE(cache.size() == 500);
+
+    // Clear the memory cache
+    cache.clear();
+    REQUIRE(cache.empty());
+}
+
+TEST_CASE("Memory cache with LRU eviction", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(1, 3, MemCacheEviction::LRU);
+    REQUIRE(cache.capacity() == 3);
+    REQUIRE(cache.eviction() == MemCacheEviction::LRU);
+
+    REQUIRE(cache.insert(1, 1));
+    REQUIRE(cache.insert(2, 2));
+    REQUIRE(cache.insert(3, 3));
+    REQUIRE(cache.find(1));
+    REQUIRE(cache.insert(4, 4));
+    REQUIRE(cache.size() == 3);
+    REQUIRE(cache.find(1));
+    REQUIRE(!cache.find(2));
+    REQUIRE(cache.find(3));
+    REQUIRE(cache.find(4));
+
+    // Update the existing key should not evict anything
+    REQUIRE(cache.insert(3, 30));
+    REQUIRE(cache.size() == 3);
+    REQUIRE(cache.remove(1));
+    REQUIRE(cache.size() == 2);
+}
+
+TEST_CASE("Memory cache with CLOCK eviction", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(1, 3, MemCacheEviction::CLOCK);
+
+    REQUIRE(cache.insert(1, 1));
+    REQUIRE(cache.insert(2, 2));
+    REQUIRE(cache.insert(3, 3));
+    REQUIRE(cache.find(1));
+    REQUIRE(cache.find(3));
+    REQUIRE(cache.insert(4, 4));
+    REQUIRE(cache.size() == 3);
+    REQUIRE(cache.find(1));
+    REQUIRE(!cache.find(2));
+    REQUIRE(cache.find(3));
+    REQUIRE(cache.find(4));
+
+    for (int i = 5; i < 100; ++i)
+        REQUIRE(cache.insert(i, i));
+    REQUIRE(cache.size() == 3);
+}
+
+TEST_CASE("Memory cache with TinyLFU admission", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(1, 2, MemCacheEviction::TINYLFU);
+
+    REQUIRE(cache.insert(1, 1));
+    REQUIRE(cache.insert(2, 2));
+    for (int i = 0; i < 5; ++i)
+    {
+        REQUIRE(cache.find(1));
+        REQUIRE(cache.find(2));
+    }
+
+    // Rarely accessed key should be rejected by the admission filter
+    REQUIRE(!cache.insert(3, 3));
+    REQUIRE(cache.size() == 2);
+    REQUIRE(!cache.find(3));
+
+    // Frequently requested key should be admitted
+    for (int i = 0; i < 10; ++i)
+        cache.find(4);
+    REQUIRE(cache.insert(4, 4));
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(4));
+}
+
+TEST_CASE("Memory cache with bytes budget", "[CppCommon][Cache]")
+{
+    MemCache<std::string, std::string> cache(1, 0, MemCacheEviction::LRU, 10, [](const std::string& key, const std::string& value) { return key.size() + value.size(); });
+    REQUIRE(cache.budget() == 10);
+
+    REQUIRE(cache.insert("a", "1234"));
+    REQUIRE(cache.insert("b", "1234"));
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.insert("c", "12345678"));
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.find("c"));
+}
+
+TEST_CASE("Memory cache batch operations", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(4, 100);
+
+    std::pair<int, int> items[200];
+    for (int i = 0; i < 200; ++i)
+        items[i] = std::make_pair(i, i * 10);
+    REQUIRE(cache.insert_many(items, 10) == 10);
+    REQUIRE(cache.size() == 10);
+
+    int keys[] = { 0, 5, 9, 42 };
+    int values[4] = { 0 };
+    bool found[4] = { false };
+    REQUIRE(cache.find_many(keys, 4, values, found) == 3);
+    REQUIRE((found[0] && (values[0] == 0)));
+    REQUIRE((found[1] && (values[1] == 50)));
+    REQUIRE((found[2] && (values[2] == 90)));
+    REQUIRE(!found[3]);
+
+    REQUIRE(cache.remove_many(keys, 4) == 3);
+    REQUIRE(cache.size() == 7);
+
+    // Batch larger than a routing chunk
+    MemCache<int, int> unbounded(4);
+    int many[200];
+    int results[200];
+    for (int i = 0; i < 200; ++i)
+        many[i] = i;
+    REQUIRE(unbounded.insert_many(items, 150) == 150);
+    REQUIRE(unbounded.find_many(many, 200, results) == 150);
+    for (int i = 0; i < 150; ++i)
+        REQUIRE(results[i] == i * 10);
+    REQUIRE(unbounded.remove_many(many, 200) == 150);
+    REQUIRE(unbounded.empty());
+}
+
+TEST_CASE("Memory cache heterogeneous lookup", "[CppCommon][Cache]")
+{
+    MemCache<std::string, int> cache(2);
+
+    REQUIRE(cache.insert("key", 42));
+
+    int value = 0;
+    std::string_view view = "key";
+    REQUIRE(cache.find(view, value));
+    REQUIRE(value == 42);
+    REQUIRE(cache.find("key"));
+    REQUIRE(!cache.find(std::string_view("other")));
+    REQUIRE(cache.remove(view));
+    REQUIRE(cache.empty());
+}
+
+TEST_CASE("Memory cache with coarse clock", "[CppCommon][Cache]")
+{
+    MemCache<std::string, int> cache;
+    REQUIRE(!cache.coarse_clock());
+    cache.set_coarse_clock(true);
+    REQUIRE(cache.coarse_clock());
+
+    cache.insert("123", 123);
+    cache.insert("456", 456, CppCommon::Timespan::milliseconds(100));
+
+    int result = 0;
+    Timestamp timeout;
+    REQUIRE(cache.find("456", result, timeout));
+    REQUIRE(result == 456);
+    REQUIRE(timeout > CoarseUtcTimestamp());
+
+    // Watchdog the memory cache to erase entries with timeout
+    cache.watchdog(UtcTimestamp() + Timespan::milliseconds(200));
+    REQUIRE(cache.find("123"));
+    REQUIRE(!cache.find("456"));
+}
+
+TEST_CASE("Memory cache statistics", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(1, 2, MemCacheEviction::LRU);
+
+    REQUIRE(cache.insert(1, 1));
+    REQUIRE(cache.insert(2, 2, Timespan::milliseconds(10)));
+    REQUIRE(cache.insert(3, 3));
+    REQUIRE(cache.insert(4, 4, Timespan::milliseconds(10)));
+    REQUIRE(cache.find(4));
+    REQUIRE(!cache.find(1));
+    REQUIRE(cache.remove(3));
+
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(1));
+
+    CacheStatistics statistics = cache.statistics();
+    REQUIRE(statistics.inserts == 4);
+    REQUIRE(statistics.hits == 1);
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.hit_ratio() == 0.5);
+    REQUIRE(statistics.evictions == 2);
+    REQUIRE(statistics.removals == 1);
+    REQUIRE(statistics.expirations == 1);
+    REQUIRE(statistics.entries == 0);
+
+    // One of SAMPLING operations is sampled
+    for (uint32_t i = 0; i < CacheCounters::SAMPLING; ++i)
+        cache.find(1);
+    statistics = cache.statistics();
+    REQUIRE(statistics.lock_samples > 0);
+    REQUIRE(statistics.find_latency.count() > 0);
+    REQUIRE(statistics.insert_latency.count() > 0);
+    REQUIRE(statistics.find_latency.percentile(0.5) <= statistics.find_latency.percentile(0.99));
+
+    cache.reset_statistics();
+    statistics = cache.statistics();
+    REQUIRE(statistics.inserts == 0);
+    REQUIRE(statistics.hits == 0);
+    REQUIRE(statistics.lock_samples == 0);
+    REQUIRE(statistics.find_latency.count() == 0);
+}
+
+TEST_CASE("Memory cache background watchdog", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(4);
+
+    // Expire many entries at once
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(i, i, Timespan::milliseconds(10));
+    cache.insert(-1, -1);
+
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(1));
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.statistics().expirations == 1000);
+
+    cache.insert(1, 1, Timespan::milliseconds(10));
+    REQUIRE(cache.start_watchdog(Timespan::milliseconds(10)));
+    REQUIRE(!cache.start_watchdog(Timespan::milliseconds(10)));
+
+    // Wait for the background watchdog
+    for (int i = 0; (i < 1000) && (cache.size() > 1); ++i)
+        Thread::Sleep(10);
+    REQUIRE(cache.size() == 1);
+
+    REQUIRE(cache.stop_watchdog());
+    REQUIRE(!cache.stop_watchdog());
+}
+
+TEST_CASE("Memory cache single-flight loader", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache(4);
+    std::atomic<int> loads(0);
+    std::atomic<bool> failed(false);
+
+    // Concurrent misses of the same key are coalesced into one loader call
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back([&cache, &loads, &failed]()
+        {
+            int value = cache.get_or_compute(1, [&loads](int key) { ++loads; Thread::Sleep(50); return key * 10; }, Timespan::seconds(10));
+            if (value != 10)
+                failed = true;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(!failed);
+    REQUIRE(loads == 1);
+    REQUIRE(cache.get_or_compute(1, [&loads](int key) { ++loads; return 0; }) == 10);
+    REQUIRE(loads == 1);
+
+    // Loader exception is propagated and the key is not cached
+    REQUIRE_THROWS(cache.get_or_compute(2, [](int) -> int { throw std::runtime_error("failed"); }));
+    REQUIRE(!cache.find(2));
+    REQUIRE(cache.get_or_compute(2, [](int key) { return key * 10; }) == 20);
+
+    // Expired value is reloaded
+    cache.insert(3, 0, Timespan::milliseconds(1));
+    Thread::Sleep(10);
+    REQUIRE(cache.get_or_compute(3, [](int key) { return key * 10; }) == 30);
+}
+
+TEST_CASE("Memory cache stale-while-revalidate", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache;
+    cache.set_stale_while_revalidate(Timespan::seconds(10));
+    REQUIRE(cache.stale_while_revalidate() == Timespan::seconds(10));
+
+    cache.insert(1, 1, Timespan::milliseconds(1));
+    Thread::Sleep(10);
+
+    // Stale entry is kept by the watchdog within the stale period
+    cache.watchdog();
+    REQUIRE(cache.find(1));
+
+    // Concurrent callers get the stale value while the single loader call reloads it
+    std::atomic<bool> loading(false);
+    std::atomic<int> stale(0);
+    auto loader = std::thread([&cache, &loading]()
+    {
+        cache.get_or_compute(1, [&loading](int) { loading = true; Thread::Sleep(100); return 2; }, Timespan::seconds(10));
+    });
+    while (!loading)
+        Thread::Yield();
+    for (int i = 0; i < 4; ++i)
+        if (cache.get_or_compute(1, [](int) { return 3; }, Timespan::seconds(10)) == 1)
+            ++stale;
+    loader.join();
+    REQUIRE(stale == 4);
+    REQUIRE(cache.get_or_compute(1, [](int) { return 3; }) == 2);
+}
+
+TEST_CASE("Memory cache probabilistic early refresh", "[CppCommon][Cache]")
+{
+    MemCache<int, int> cache;
+    cache.set_early_refresh(1000000.0);
+    REQUIRE(cache.early_refresh() == 1000000.0);
+
+    // Huge factor makes a loaded value to be refreshed before its timeout
+    int loads = 0;
+    auto loader = [&loads](int) { Thread::Sleep(1); return ++loads; };
+    REQUIRE(cache.get_or_compute(1, loader, Timespan::seconds(10)) == 1);
+    REQUIRE(cache.get_or_compute(1, loader, Timespan::seconds(10)) == 2);
+
+    // Early refresh is disabled by default
+    cache.set_early_refresh(0.0);
+    REQUIRE(cache.get_or_compute(1, loader, Timespan::seconds(10)) == 2);
+}
+
+TEST_CASE("Memory cache snapshot", "[CppCommon][Cache]")
+{
+    Path path = Path::temp() / "test_cache_memcache.snapshot";
+
+    MemCache<std::string, int> cache(4);
+    for (int i = 0; i < 10000; ++i)
+        cache.insert(std::to_string(i), i, (i % 2) ? Timespan::seconds(100) : Timespan(0));
+    cache.insert("expired", -1, Timespan::milliseconds(1));
+    REQUIRE(cache.snapshot(path) == 10001);
+
+    // Sleep for a while...
+    Thread::SleepFor(Timespan::milliseconds(10));
+
+    // Restore the snapshot in parallel with remaining timeouts
+    MemCache<std::string, int> restored(8);
+    REQUIRE(restored.restore(path, 4) == 10000);
+    REQUIRE(restored.size() == 10000);
+    REQUIRE(!restored.find("expired"));
+
+    int value;
+    Timestamp timeout;
+    REQUIRE((restored.find("42", value) && (value == 42)));
+    REQUIRE((restored.find("43", value, timeout) && (value == 43)));
+    REQUIRE(timeout > UtcTimestamp() + Timespan::seconds(90));
+
+    // Values are kept by the watchdog until their timeouts
+    restored.watchdog(UtcTimestamp() + Timespan::seconds(200));
+    REQUIRE(restored.size() == 5000);
+
+    Path::Remove(path);
+}
+
+TEST_CASE("Memory cache compression", "[CppCommon][Cache]")
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "<div class=\"item\">" + std::to_string(i) + "</div>";
+
+    auto codec = std::make_shared<LZ4CacheCodec>("<div class=\"item\"></div>");
+
+    std::vector<std::string> evicted;
+    MemCache<std::string, std::string> cache(1, 2, MemCacheEviction::LRU, 0, [](const std::string&, const std::string& value) { return value.size(); });
+    cache.set_compression(codec, 64);
+    cache.set_eviction_handler([&evicted](const std::string&, std::string&& value, const Timestamp&) { evicted.push_back(std::move(value)); });
+    cache.insert("text", text);
+    cache.insert("small", "small");
+    REQUIRE(cache.statistics().bytes < (text.size() / 2));
+
+    // Compressed values are decompressed transparently
+    std::string value;
+    REQUIRE((cache.find("text", value) && (value == text)));
+    REQUIRE((cache.find("small", value) && (value == "small")));
+    REQUIRE(cache.get_or_compute("text", [](const std::string&) { return std::string(); }) == text);
+
+    // Compressed bytes are served as is
+    std::string compressed;
+    REQUIRE(cache.find_compressed("text", "lz4", compressed));
+    REQUIRE(compressed.size() < text.size());
+    REQUIRE((codec->decompress(compressed, text.size(), value) && (value == text)));
+    REQUIRE(!cache.find_compressed("small", "lz4", compressed));
+    REQUIRE(!cache.find_compressed("text", "gzip", compressed));
+
+    // Evicted values are decompressed
+    cache.insert("other", "other");
+    REQUIRE(evicted.size() == 1);
+    REQUIRE(evicted[0] == "small");
+    cache.insert("another", "another");
+    REQUIRE(evicted.size() == 2);
+    REQUIRE(evicted[1] == text);
+}
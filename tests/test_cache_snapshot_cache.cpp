@@ -0,0 +1,114 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "cache/snapshot_cache.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Snapshot cache", "[CppCommon][Cache]")
+{
+    SnapshotCache<std::string, int> cache;
+    REQUIRE(cache.empty());
+    REQUIRE(cache.size() == 0);
+
+    // Fill the memory cache
+    cache.insert("123", 123);
+    cache.insert("456", 456, CppCommon::Timespan::milliseconds(100));
+    cache.emplace("789", 789, CppCommon::Timespan::milliseconds(1000));
+
+    int result = 0;
+    Timestamp timeout;
+
+    // Get the memory cache values
+    REQUIRE(cache.find("123", result));
+    REQUIRE(result == 123);
+    REQUIRE(cache.find("456"));
+    REQUIRE(cache.find("789", result, timeout));
+    REQUIRE(result == 789);
+    REQUIRE(timeout > UtcTimestamp());
+
+    // Sleep for a while...
+    Thread::SleepFor(Timespan::milliseconds(200));
+
+    // Watchdog the memory cache to erase entries with timeout
+    cache.watchdog();
+    REQUIRE(cache.find("123"));
+    REQUIRE(!cache.find("456"));
+    REQUIRE(cache.find("789"));
+    REQUIRE(cache.size() == 2);
+
+    // Remove the memory cache values
+    REQUIRE(cache.remove("789"));
+    REQUIRE(!cache.remove("789"));
+    REQUIRE(cache.size() == 1);
+
+    // Clear the memory cache
+    cache.clear();
+    REQUIRE(cache.empty());
+}
+
+TEST_CASE("Snapshot cache batch publish", "[CppCommon][Cache]")
+{
+    SnapshotCache<int, int> cache(0);
+
+    // Updates are not visible until published
+    cache.insert(1, 1);
+    cache.insert(2, 2);
+    REQUIRE(cache.pending() == 2);
+    REQUIRE(!cache.find(1));
+
+    cache.publish();
+    REQUIRE(cache.pending() == 0);
+    REQUIRE(cache.find(1));
+    REQUIRE(cache.find(2));
+    REQUIRE(cache.size() == 2);
+}
+
+TEST_CASE("Snapshot cache concurrent readers", "[CppCommon][Cache]")
+{
+    SnapshotCache<int, int> cache(16);
+    for (int i = 0; i < 100; ++i)
+        cache.insert(i, i);
+    cache.publish();
+
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> errors(0);
+
+    // Start reader threads
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&cache, &stop, &errors]()
+        {
+            while (!stop)
+            {
+                for (int i = 0; i < 100; ++i)
+                {
+                    int value = -1;
+                    if (!cache.find(i, value) || (value != i))
+                        ++errors;
+                }
+            }
+        });
+    }
+
+    // Update the cache in batches
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(100 + i, i);
+    cache.publish();
+
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    REQUIRE(errors == 0);
+    REQUIRE(cache.size() == 1100);
+}
@@ -0,0 +1,91 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "cache/tiered_cache.h"
+#include "threads/thread.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("Tiered cache", "[CppCommon][Cache]")
+{
+    Path path = Path::temp() / "test_cache_tiered_cache.log";
+    {
+        TieredCache<int, int> cache(path, 4);
+        REQUIRE(cache.empty());
+        REQUIRE(path.IsExists());
+
+        // Overflow the memory tier
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(cache.insert(i, i * 10));
+        REQUIRE(cache.size() == 10);
+        REQUIRE(cache.memory_size() == 4);
+        REQUIRE(cache.disk_size() == 6);
+        REQUIRE(cache.demotions() == 6);
+        REQUIRE(cache.disk_bytes() == 6 * (TieredCache<int, int>::HEADER_SIZE + sizeof(int)));
+
+        // Cold entries are promoted from the disk tier
+        int value = -1;
+        REQUIRE((cache.find(0, value) && (value == 0)));
+        REQUIRE(cache.promotions() == 1);
+        REQUIRE(cache.memory_size() == 4);
+        REQUIRE(cache.disk_size() == 6);
+        REQUIRE(cache.garbage_bytes() == (TieredCache<int, int>::HEADER_SIZE + sizeof(int)));
+
+        for (int i = 0; i < 10; ++i)
+            REQUIRE((cache.find(i, value) && (value == i * 10)));
+        REQUIRE(!cache.find(10));
+        REQUIRE(cache.size() == 10);
+
+        // Overwritten and removed entries leave a single tier
+        REQUIRE(cache.insert(0, 1000));
+        REQUIRE(cache.remove(1));
+        REQUIRE(!cache.remove(1));
+        REQUIRE(cache.size() == 9);
+        REQUIRE((cache.find(0, value) && (value == 1000)));
+
+        // Compaction drops garbage records
+        cache.compact();
+        REQUIRE(cache.garbage_bytes() == 0);
+        REQUIRE(cache.disk_bytes() == cache.disk_size() * (TieredCache<int, int>::HEADER_SIZE + sizeof(int)));
+        for (int i = 2; i < 10; ++i)
+            REQUIRE((cache.find(i, value) && (value == i * 10)));
+
+        cache.clear();
+        REQUIRE(cache.empty());
+        REQUIRE(cache.disk_bytes() == 0);
+    }
+    REQUIRE(!path.IsExists());
+}
+
+TEST_CASE("Tiered cache with timeouts and string values", "[CppCommon][Cache]")
+{
+    Path path = Path::temp() / "test_cache_tiered_cache_strings.log";
+    TieredCache<std::string, std::string> cache(path, 1);
+    cache.set_compaction_threshold(1);
+
+    REQUIRE(cache.insert("hot", std::string(100, 'h')));
+    REQUIRE(cache.insert("cold", std::string(1000, 'c'), Timespan::seconds(100)));
+    REQUIRE(cache.insert("expired", "e", Timespan::milliseconds(1)));
+    REQUIRE(cache.insert("last", "l"));
+    REQUIRE(cache.disk_size() == 3);
+
+    // Wait for the expired entry
+    Thread::SleepFor(Timespan::milliseconds(10));
+    REQUIRE(!cache.find("expired"));
+
+    std::string value;
+    REQUIRE((cache.find("cold", value) && (value == std::string(1000, 'c'))));
+    REQUIRE((cache.find("hot", value) && (value == std::string(100, 'h'))));
+
+    // Log file is compacted automatically
+    REQUIRE(cache.garbage_bytes() < cache.disk_bytes());
+
+    cache.watchdog(UtcTimestamp() + Timespan::seconds(1000));
+    REQUIRE(!cache.find("cold"));
+    REQUIRE((cache.find("last", value) && (value == "l")));
+}
@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "common/binary_layout.h"
+#include "threads/spsc_ring_buffer.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+enum class Side : uint8_t { Buy, Sell };
+
+typedef BinaryLayout<uint64_t, double, int32_t, Side, bool, BinaryString, BinaryBytes> Order;
+
+} // namespace
+
+TEST_CASE("Binary layout", "[CppCommon][Common]")
+{
+    static_assert(Order::FIELDS == 7);
+    static_assert(Order::Offset<0>() == 4);
+    static_assert(Order::Offset<1>() == 12);
+    static_assert(Order::Offset<2>() == 20);
+    static_assert(Order::Offset<3>() == 24);
+    static_assert(Order::Offset<4>() == 25);
+    static_assert(Order::Offset<5>() == 26);
+    static_assert(Order::Offset<6>() == 34);
+    static_assert(Order::FIXED_SIZE == 42);
+    static_assert(!Order::IsVariable<0>() && Order::IsVariable<5>());
+    static_assert(Order::Size(3, 2) == 47);
+
+    const uint8_t payload[] = { 0xAA, 0xBB };
+
+    // Build the message in the unaligned buffer
+    std::vector<uint8_t> buffer(Order::Size(3, 2) + 1);
+    BinaryBuilder<Order> builder(buffer.data() + 1, buffer.size() - 1);
+    REQUIRE(builder.size() == Order::FIXED_SIZE);
+    REQUIRE(builder.Set<0>(0x0102030405060708ull));
+    REQUIRE(builder.Set<1>(123.456));
+    REQUIRE(builder.Set<2>(-100));
+    REQUIRE(builder.Set<3>(Side::Sell));
+    REQUIRE(builder.Set<4>(true));
+    REQUIRE(builder.Set<5>("ABC"));
+    REQUIRE(builder.Set<6>(std::span<const uint8_t>(payload)));
+    REQUIRE(builder.size() == Order::Size(3, 2));
+    REQUIRE(!builder.Set<5>("X"));
+
+    // Fields are stored in little-endian byte order
+    REQUIRE(buffer[1] == 47);
+    REQUIRE(buffer[1 + Order::Offset<0>()] == 0x08);
+
+    // Read the message in place
+    BinaryView<Order> view(buffer.data() + 1, buffer.size() - 1);
+    REQUIRE(view);
+    REQUIRE(view.size() == builder.size());
+    REQUIRE(view.Get<0>() == 0x0102030405060708ull);
+    REQUIRE(view.Get<1>() == 123.456);
+    REQUIRE(view.Get<2>() == -100);
+    REQUIRE(view.Get<3>() == Side::Sell);
+    REQUIRE(view.Get<4>());
+    REQUIRE(view.Get<5>() == "ABC");
+    REQUIRE(view.Get<5>().data() == (const char*)buffer.data() + 1 + Order::FIXED_SIZE);
+    REQUIRE(view.Get<6>().size() == 2);
+    REQUIRE(view.Get<6>()[1] == 0xBB);
+
+    // Unset fields are zero-initialized
+    std::vector<uint8_t> empty(Order::FIXED_SIZE);
+    BinaryBuilder<Order> empty_builder(empty.data(), empty.size());
+    auto empty_view = empty_builder.view();
+    REQUIRE(empty_view);
+    REQUIRE(empty_view.Get<0>() == 0);
+    REQUIRE(empty_view.Get<5>().empty());
+    REQUIRE(empty_view.Get<6>().empty());
+}
+
+TEST_CASE("Binary layout validation", "[CppCommon][Common]")
+{
+    std::vector<uint8_t> buffer(Order::Size(4));
+    BinaryBuilder<Order> builder(buffer.data(), buffer.size());
+    REQUIRE(builder.Set<5>("TEST"));
+    REQUIRE(BinaryView<Order>(std::span<const uint8_t>(buffer)));
+
+    // Truncated buffer
+    REQUIRE(!BinaryView<Order>());
+    REQUIRE(!BinaryView<Order>(buffer.data(), Order::FIXED_SIZE - 1));
+    REQUIRE(!BinaryView<Order>(buffer.data(), buffer.size() - 1));
+
+    // Corrupted message size
+    std::vector<uint8_t> corrupted = buffer;
+    Endian::StoreLittleEndian(corrupted.data(), (uint32_t)(Order::FIXED_SIZE - 1));
+    REQUIRE(!BinaryView<Order>(std::span<const uint8_t>(corrupted)));
+
+    // Corrupted variable-length field
+    corrupted = buffer;
+    Endian::StoreLittleEndian(corrupted.data() + Order::Offset<5>() + 4, (uint32_t)5);
+    REQUIRE(!BinaryView<Order>(std::span<const uint8_t>(corrupted)));
+    corrupted = buffer;
+    Endian::StoreLittleEndian(corrupted.data() + Order::Offset<5>(), (uint32_t)0xFFFFFFFF);
+    REQUIRE(!BinaryView<Order>(std::span<const uint8_t>(corrupted)));
+}
+
+TEST_CASE("Binary layout in the ring buffer", "[CppCommon][Common]")
+{
+    typedef BinaryLayout<uint32_t, BinaryString> Message;
+
+    SPSCRingBuffer ring(1024);
+
+    // Build messages directly in the ring buffer reservations
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        std::string text(i, 'x');
+        BinaryBuilder<Message> builder(ring.Prepare(Message::Size(text.size())));
+        REQUIRE(builder.Set<0>(i));
+        REQUIRE(builder.Set<1>(text));
+        ring.Commit(builder.size());
+    }
+
+    // Read messages in place
+    auto data = ring.Peek();
+    size_t total = 0;
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        BinaryView<Message> view(data.subspan(total));
+        REQUIRE(view);
+        REQUIRE(view.Get<0>() == i);
+        REQUIRE(view.Get<1>() == std::string(i, 'x'));
+        total += view.size();
+    }
+    REQUIRE(total == data.size());
+    ring.Release(total);
+    REQUIRE(ring.empty());
+}
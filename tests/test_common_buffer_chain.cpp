@@ -0,0 +1,98 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "common/buffer_chain.h"
+#include "filesystem/filesystem.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+TEST_CASE("Buffer chain", "[CppCommon][Common]")
+{
+    BufferChain chain(16);
+    REQUIRE(chain.empty());
+    REQUIRE(chain.block() == 16);
+
+    // Append bytes across several blocks
+    std::string text("The quick brown fox jumps over the lazy dog");
+    chain.Append(text.data(), text.size());
+    REQUIRE(chain.size() == text.size());
+    REQUIRE(chain.slices().size() == 3);
+    REQUIRE(chain.ToString() == text);
+
+    // Appended bytes are merged into the last slice of the same block
+    chain.Append("!", 1);
+    REQUIRE(chain.slices().size() == 3);
+    REQUIRE(chain.ToString() == text + "!");
+
+    // Shared copy is not modified by following appends
+    BufferChain copy(chain);
+    REQUIRE(copy.slices().front().block() == chain.slices().front().block());
+    chain.Append("?", 1);
+    REQUIRE(copy.ToString() == text + "!");
+    REQUIRE(chain.ToString() == text + "!?");
+
+    // Split the front without copying
+    BufferChain front = chain.Split(10);
+    REQUIRE(front.ToString() == "The quick ");
+    REQUIRE(chain.ToString() == text.substr(10) + "!?");
+    REQUIRE(front.slices().front().block() == chain.slices().front().block());
+
+    // Consume and copy the front
+    char buffer[5];
+    REQUIRE(chain.Consume(6) == 6);
+    REQUIRE(chain.CopyTo(buffer, sizeof(buffer)) == sizeof(buffer));
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "fox j");
+    REQUIRE(chain.Consume(1000) == text.size() - 16 + 2);
+    REQUIRE(chain.empty());
+
+    // Append chains and slices without copying
+    BufferSlice slice = BufferSlice::Copy("slice", 5);
+    chain.Append(front);
+    chain.Append(slice.Slice(1, 3));
+    chain.Append(std::move(copy));
+    REQUIRE(copy.empty());
+    REQUIRE(chain.ToString() == "The quick lic" + text + "!");
+    REQUIRE(chain.spans().size() == chain.slices().size());
+
+    // Prepare and commit the writable tail
+    BufferChain tail;
+    std::span<uint8_t> space = tail.Prepare(100);
+    REQUIRE(space.size() == 100);
+    std::memcpy(space.data(), "tail", 4);
+    tail.Commit(4);
+    REQUIRE(tail.ToString() == "tail");
+}
+
+TEST_CASE("Buffer chain reader and writer", "[CppCommon][Common]")
+{
+    std::string text(200000, 0);
+    for (size_t i = 0; i < text.size(); ++i)
+        text[i] = (char)('a' + (i % 26));
+
+    File file(Path::unique() + ".tmp");
+    file.Create(false, true);
+    BufferChain chain(4096);
+    chain.Append(text.data(), text.size());
+    REQUIRE(file.WriteFrom(chain) == text.size());
+    REQUIRE(chain.empty());
+    file.Close();
+
+    // Read the file into the buffer chain
+    file.Open(true, false);
+    REQUIRE(file.ReadInto(chain, 100000) == 100000);
+    REQUIRE(file.ReadInto(chain, 1000000) == text.size() - 100000);
+    REQUIRE(chain.ToString() == text);
+    file.Close();
+
+    // Read all bytes of the file
+    file.Open(true, false);
+    REQUIRE(file.ReadAllText() == text);
+    file.Close();
+
+    File::Remove(file);
+}
@@ -0,0 +1,206 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "common/compressed_stream.h"
+#include "errors/exceptions.h"
+#include "filesystem/file.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+class MemoryWriter : public Writer
+{
+public:
+    std::vector<uint8_t> data;
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        data.insert(data.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + size);
+        return size;
+    }
+    using Writer::Write;
+};
+
+class MemoryReader : public Reader
+{
+public:
+    explicit MemoryReader(const std::vector<uint8_t>& data) : _data(data), _offset(0) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size = std::min(size, _data.size() - _offset);
+        std::memcpy(buffer, _data.data() + _offset, size);
+        _offset += size;
+        return size;
+    }
+
+private:
+    const std::vector<uint8_t>& _data;
+    size_t _offset;
+};
+
+std::vector<uint8_t> Content(size_t size, bool random)
+{
+    std::vector<uint8_t> result(size);
+    std::mt19937 generator(42);
+    for (size_t i = 0; i < size; ++i)
+        result[i] = random ? (uint8_t)generator() : (uint8_t)("Compressed stream content "[(i / 7) % 26]);
+    return result;
+}
+
+}
+
+TEST_CASE("Compressed stream checksum", "[CppCommon][Common]")
+{
+    REQUIRE(Internals::XXH32State::Compute("", 0) == 0x02CC5D05);
+    REQUIRE(Internals::XXH32State::Compute("a", 1) == 0x550D7456);
+    REQUIRE(Internals::XXH32State::Compute("abc", 3) == 0x32D153FF);
+
+    // Streaming hash is the same as the hash of the whole buffer
+    std::vector<uint8_t> content = Content(1000, true);
+    Internals::XXH32State state;
+    for (size_t i = 0; i < content.size(); i += 13)
+        state.Update(content.data() + i, std::min((size_t)13, content.size() - i));
+    REQUIRE(state.Digest() == Internals::XXH32State::Compute(content.data(), content.size()));
+}
+
+TEST_CASE("Compressed stream empty frame", "[CppCommon][Common]")
+{
+    MemoryWriter output;
+    {
+        CompressedWriterOptions options;
+        options.block = 65536;
+        options.checksum = false;
+        CompressedWriter writer(output, options);
+    }
+
+    // Empty LZ4 frame is the same as produced by the lz4 command line tool
+    const uint8_t expected[] = { 0x04, 0x22, 0x4D, 0x18, 0x64, 0x40, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5D, 0xCC, 0x02 };
+    REQUIRE(output.data == std::vector<uint8_t>(expected, expected + sizeof(expected)));
+
+    MemoryReader input(output.data);
+    CompressedReader reader(input);
+    uint8_t buffer[16];
+    REQUIRE(reader.Read(buffer, sizeof(buffer)) == 0);
+}
+
+TEST_CASE("Compressed stream round trip", "[CppCommon][Common]")
+{
+    for (bool background : { true, false })
+    {
+        for (bool random : { false, true })
+        {
+            std::vector<uint8_t> content = Content(1000000, random);
+
+            MemoryWriter output;
+            CompressedWriterOptions options;
+            options.block = 65536;
+            options.background = background;
+            {
+                CompressedWriter writer(output, options);
+                for (size_t i = 0; i < content.size(); i += 10007)
+                    REQUIRE(writer.Write(content.data() + i, std::min((size_t)10007, content.size() - i)) == std::min((size_t)10007, content.size() - i));
+                writer.Close();
+                REQUIRE(writer.IsClosed());
+                REQUIRE(writer.size() == content.size());
+                REQUIRE(writer.blocks() == 16);
+                REQUIRE(writer.compressed() == output.data.size());
+                if (random)
+                    REQUIRE(output.data.size() > content.size());
+                else
+                    REQUIRE(output.data.size() < content.size() / 10);
+            }
+
+            MemoryReader input(output.data);
+            CompressedReader reader(input);
+            std::vector<uint8_t> result(content.size() + 1);
+            size_t size = 0;
+            for (size_t read; (read = reader.Read(result.data() + size, std::min((size_t)4096, result.size() - size))) > 0;)
+                size += read;
+            REQUIRE(size == content.size());
+            REQUIRE(std::memcmp(result.data(), content.data(), size) == 0);
+            REQUIRE(reader.blocks() == 16);
+            REQUIRE(!reader.IsSeekable());
+        }
+    }
+}
+
+TEST_CASE("Compressed stream corruption", "[CppCommon][Common]")
+{
+    std::vector<uint8_t> content = Content(200000, false);
+
+    MemoryWriter output;
+    {
+        CompressedWriter writer(output);
+        writer.Write(content.data(), content.size());
+    }
+
+    // Corrupt the first compressed block
+    output.data[20] ^= 0x01;
+
+    MemoryReader input(output.data);
+    CompressedReader reader(input);
+    std::vector<uint8_t> result(content.size());
+    REQUIRE_THROWS_AS(reader.Read(result.data(), result.size()), RuntimeException);
+}
+
+TEST_CASE("Compressed stream seek", "[CppCommon][Common]")
+{
+    std::vector<uint8_t> content = Content(1000000, false);
+    for (size_t i = 0; i < content.size(); i += 1000)
+        std::memcpy(content.data() + i, &i, sizeof(i));
+
+    {
+        File file("test.lz4");
+        file.Create(false, true);
+        CompressedWriterOptions options;
+        options.block = 65536;
+        options.index = true;
+        CompressedWriter writer(file, options);
+        writer.Write(content.data(), content.size());
+        writer.Close();
+        file.Close();
+    }
+
+    File file("test.lz4");
+    file.Open(true, false);
+    CompressedReader reader(file);
+    REQUIRE(reader.IsSeekable());
+    REQUIRE(reader.size() == content.size());
+
+    for (size_t offset : { (size_t)654321, (size_t)0, (size_t)65536, (size_t)65535, (size_t)999000 })
+    {
+        reader.Seek(offset);
+        REQUIRE(reader.offset() == offset);
+        uint8_t buffer[1000];
+        size_t size = std::min(sizeof(buffer), content.size() - offset);
+        REQUIRE(reader.Read(buffer, sizeof(buffer)) == size);
+        REQUIRE(std::memcmp(buffer, content.data() + offset, size) == 0);
+    }
+
+    reader.Seek(content.size());
+    uint8_t buffer[16];
+    REQUIRE(reader.Read(buffer, sizeof(buffer)) == 0);
+    REQUIRE_THROWS_AS(reader.Seek(content.size() + 1), ArgumentException);
+
+    // Sequential read of the seekable stream skips the index frame
+    reader.Seek(0);
+    std::vector<uint8_t> result(content.size() + 1);
+    size_t size = 0;
+    for (size_t read; (read = reader.Read(result.data() + size, result.size() - size)) > 0;)
+        size += read;
+    REQUIRE(size == content.size());
+    REQUIRE(std::memcmp(result.data(), content.data(), size) == 0);
+
+    file.Close();
+    File::Remove("test.lz4");
+}
@@ -0,0 +1,38 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/path.h"
+#include "threads/thread.h"
+
+using namespace CppCommon;
+
+static_assert(EnumToString(FileType::DIRECTORY) == "DIRECTORY");
+static_assert(EnumFromString<ThreadPriority>("REALTIME") == ThreadPriority::REALTIME);
+
+TEST_CASE("Enum strings", "[CppCommon][Common]")
+{
+    for (const auto& item : EnumStrings<FileType>::items)
+    {
+        REQUIRE(EnumToString(item.second) == item.first);
+        REQUIRE(EnumFromString<FileType>(item.first) == item.second);
+    }
+    for (const auto& item : EnumStrings<FileAttributes>::items)
+    {
+        REQUIRE(EnumToString(item.second) == item.first);
+        REQUIRE(EnumFromString<FileAttributes>(item.first) == item.second);
+    }
+    for (const auto& item : EnumStrings<ThreadPriority>::items)
+    {
+        REQUIRE(EnumToString(item.second) == item.first);
+        REQUIRE(EnumFromString<ThreadPriority>(item.first) == item.second);
+    }
+
+    // Unknown values and names
+    REQUIRE(EnumToString((FileAttributes)0x03).empty());
+    REQUIRE(EnumToString((ThreadPriority)0x01).empty());
+    REQUIRE(!EnumFromString<FileType>("regular").has_value());
+    REQUIRE(!EnumFromString<ThreadPriority>("").has_value());
+}
@@ -6,6 +6,12 @@
 
 #include "common/function.h"
 
+#include <array>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+
 using namespace CppCommon;
 
 namespace {
@@ -52,3 +58,71 @@ TEST_CASE("Function", "[CppCommon][Common]")
     function = lambda;
     REQUIRE(function(55) == 555);
 }
+
+TEST_CASE("Function capacity", "[CppCommon][Common]")
+{
+    static_assert(sizeof(CppCommon::Function<void (), 32>) == 32);
+    static_assert(sizeof(CppCommon::Function<void (), 64>) == 64);
+    static_assert(sizeof(CppCommon::MoveFunction<void ()>) == 64);
+    static_assert(CppCommon::Function<void (), 32>::storage() == 16);
+
+    int value = 0;
+    int* pointer = &value;
+    auto small = [pointer]() { ++*pointer; };
+    auto large = [pointer, a = std::array<int64_t, 8>()]() { *pointer += (int)a.size(); };
+    static_assert(CppCommon::Function<void (), 32>::fits<decltype(small)>());
+    static_assert(!CppCommon::Function<void (), 32>::fits<decltype(large)>());
+    static_assert(CppCommon::Function<void (), 128>::fits<decltype(large)>());
+
+    // Trivially copyable closures are relocatable
+    CppCommon::Function<void (), 32> function1 = small;
+    REQUIRE(function1.relocatable());
+    CppCommon::Function<void (), 32> function2 = function1;
+    function2();
+    REQUIRE(value == 1);
+    CppCommon::Function<void (), 32> function3 = std::move(function1);
+    REQUIRE(!function1);
+    function3();
+    REQUIRE(value == 2);
+
+    // Relocate the function object with memcpy()
+    alignas(CppCommon::Function<void (), 32>) std::byte buffer[sizeof(CppCommon::Function<void (), 32>)];
+    std::memcpy(buffer, (const void*)&function3, sizeof(function3));
+    (*std::launder(reinterpret_cast<CppCommon::Function<void (), 32>*>(buffer)))();
+    REQUIRE(value == 3);
+
+    // Closures with non-trivial captures are not relocatable
+    std::string text = "A long string which does not fit into the small string buffer";
+    CppCommon::Function<size_t (), 64> function4 = [text]() { return text.size(); };
+    REQUIRE(!function4.relocatable());
+    CppCommon::Function<size_t (), 64> function5;
+    function5.swap(function4);
+    REQUIRE(!function4);
+    REQUIRE(function5() == text.size());
+    function4 = function5;
+    REQUIRE(function4() == text.size());
+    REQUIRE(function5() == text.size());
+}
+
+TEST_CASE("Move-only function", "[CppCommon][Common]")
+{
+    auto data = std::make_unique<int>(123);
+    CppCommon::MoveFunction<int (int)> function1 = [data = std::move(data)](int v) { return *data + v; };
+    REQUIRE(!function1.relocatable());
+    REQUIRE(function1(1) == 124);
+
+    CppCommon::MoveFunction<int (int)> function2 = std::move(function1);
+    REQUIRE(!function1);
+    REQUIRE(function2(2) == 125);
+
+    function1 = std::move(function2);
+    REQUIRE(!function2);
+    REQUIRE(function1(3) == 126);
+
+    function1 = nullptr;
+    REQUIRE(!function1);
+    REQUIRE_THROWS_AS(function1(4), std::bad_function_call);
+
+    static_assert(!std::is_copy_constructible<CppCommon::MoveFunction<int (int)>>::value);
+    static_assert(std::is_copy_constructible<CppCommon::Function<int (int)>>::value);
+}
@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "common/line_reader.h"
+#include "filesystem/filesystem.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+class ChunkReader : public Reader
+{
+public:
+    ChunkReader(std::string_view content, size_t chunk) : _content(content), _chunk(chunk) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size_t result = std::min(std::min(size, _chunk), _content.size());
+        std::memcpy(buffer, _content.data(), result);
+        _content.remove_prefix(result);
+        return result;
+    }
+
+private:
+    std::string_view _content;
+    size_t _chunk;
+};
+
+} // namespace
+
+TEST_CASE("Line reader", "[CppCommon][Common]")
+{
+    std::string text("first\r\nsecond\n\nthird line which is longer than the buffer\nlast");
+
+    // Read lines from the memory region
+    LineReader memory(text);
+    std::vector<std::string> lines;
+    for (auto line : memory)
+        lines.emplace_back(line);
+    REQUIRE(lines == std::vector<std::string>({ "first", "second", "", "third line which is longer than the buffer", "last" }));
+    REQUIRE(memory.lines() == 5);
+
+    // Read lines from the reader with small chunks and the small growing buffer
+    for (size_t chunk = 1; chunk < 8; ++chunk)
+    {
+        ChunkReader reader(text, chunk);
+        LineReader stream(reader, "\n", 4);
+        std::vector<std::string> result;
+        std::string_view line;
+        while (stream.Next(line))
+            result.emplace_back(line);
+        REQUIRE(result == lines);
+    }
+
+    // Read records with the multi-character delimiter split between reads
+    std::string records("a||bb||||ccc||");
+    for (size_t chunk = 1; chunk < 4; ++chunk)
+    {
+        ChunkReader reader(records, chunk);
+        LineReader stream(reader, "||", 3);
+        std::vector<std::string> result;
+        for (auto record : stream)
+            result.emplace_back(record);
+        REQUIRE(result == std::vector<std::string>({ "a", "bb", "", "ccc" }));
+    }
+}
+
+TEST_CASE("Line reader file", "[CppCommon][Common]")
+{
+    File file(Path::unique() + ".tmp");
+    file.Create(false, true);
+    for (int i = 0; i < 100000; ++i)
+        file.Write(std::to_string(i) + "\n");
+    file.Close();
+
+    // Stream lines of the file
+    file.Open(true, false);
+    LineReader reader(file, "\n", 4096);
+    int expected = 0;
+    bool valid = true;
+    for (auto line : reader)
+        valid = valid && (line == std::to_string(expected++));
+    REQUIRE(valid);
+    REQUIRE(reader.lines() == 100000);
+    file.Close();
+
+    // Stream lines of the memory-mapped file
+    MappedFile mapped(file);
+    LineReader region(mapped.view());
+    size_t count = 0;
+    for (auto line : region)
+        count += line.empty() ? 0 : 1;
+    REQUIRE(count == 100000);
+    mapped.Unmap();
+
+    File::Remove(file);
+}
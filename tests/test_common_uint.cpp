@@ -8,6 +8,7 @@
 
 #include <limits>
 #include <map>
+#include <random>
 #include <sstream>
 
 using namespace CppCommon;
@@ -1075,3 +1076,168 @@ TEST_CASE("uint256: Type cast", "[CppCommon][Common]")
     REQUIRE(static_cast<uint32_t>(val) == (uint32_t)0xAAAAAAAAull);
     REQUIRE(static_cast<uint64_t>(val) == (uint64_t)0xAAAAAAAAAAAAAAAAull);
 }
+
+TEST_CASE("uint256: Chars conversion", "[CppCommon][Common]")
+{
+    // Reference conversion with the digit by digit division
+    auto reference = [](uint256_t value, size_t base)
+    {
+        std::string result;
+        do
+        {
+            auto qr = uint256_t::divmod(value, base);
+            result.insert(result.begin(), "0123456789abcdef"[(uint8_t)qr.second]);
+            value = qr.first;
+        } while (value != 0);
+        return result;
+    };
+
+    std::mt19937_64 generator(0);
+    for (int i = 0; i < 2000; ++i)
+    {
+        uint256_t value256((generator() % 2) ? generator() : 0, (generator() % 2) ? generator() : 0, (generator() % 2) ? generator() : 0, generator() >> (generator() % 64));
+        uint128_t value128 = value256.lower();
+        for (size_t base = 2; base <= 16; ++base)
+        {
+            std::string result256 = value256.string(base);
+            REQUIRE(result256 == reference(value256, base));
+            REQUIRE(uint256_t::parse(result256, base) == value256);
+
+            std::string result128 = value128.string(base);
+            REQUIRE(result128 == reference(value128, base));
+            REQUIRE(uint128_t::parse(result128, base) == value128);
+        }
+    }
+
+    // Maximal values
+    const uint128_t max128(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+    const uint256_t max256(max128, max128);
+    REQUIRE(max128.string() == "340282366920938463463374607431768211455");
+    REQUIRE(max256.string() == "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    REQUIRE(max256.string(16) == std::string(64, 'f'));
+    REQUIRE(max256.string(2) == std::string(256, '1'));
+    REQUIRE(uint128_t::parse("340282366920938463463374607431768211455") == max128);
+    REQUIRE(uint256_t::parse("115792089237316195423570985008687907853269984665640564039457584007913129639935") == max256);
+    REQUIRE(uint256_t::parse("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", 16) == max256);
+    REQUIRE(uint128_t::parse("0000000000000000000000000000000000000000000042") == 42);
+    REQUIRE(format("{}", max128) == max128.string());
+    REQUIRE(format("{}", max256) == max256.string());
+
+    // Convert into the buffer
+    char buffer[40];
+    std::to_chars_result to = max128.to_chars(buffer, buffer + sizeof(buffer));
+    REQUIRE(to.ec == std::errc());
+    REQUIRE(std::string(buffer, to.ptr) == max128.string());
+    REQUIRE(max128.to_chars(buffer, buffer + 38).ec == std::errc::value_too_large);
+    REQUIRE(max128.to_chars(buffer, buffer + sizeof(buffer), 17).ec == std::errc::invalid_argument);
+    REQUIRE(uint128_t(0).to_chars(buffer, buffer + 1).ptr == buffer + 1);
+
+    // Parse from the buffer
+    uint128_t value = 42;
+    std::string text = "12345abc";
+    std::from_chars_result from = uint128_t::from_chars(text.data(), text.data() + text.size(), value);
+    REQUIRE(from.ec == std::errc());
+    REQUIRE(from.ptr == text.data() + 5);
+    REQUIRE(value == 12345);
+    text = "xyz";
+    REQUIRE(uint128_t::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc::invalid_argument);
+    text = "340282366920938463463374607431768211456";
+    from = uint128_t::from_chars(text.data(), text.data() + text.size(), value);
+    REQUIRE(from.ec == std::errc::result_out_of_range);
+    REQUIRE(from.ptr == text.data() + text.size());
+    REQUIRE(value == 12345);
+
+    // Parse errors
+    REQUIRE_THROWS_AS(uint128_t::parse(""), std::invalid_argument);
+    REQUIRE_THROWS_AS(uint128_t::parse("123 "), std::invalid_argument);
+    REQUIRE_THROWS_AS(uint128_t::parse("12", 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(uint128_t::parse("340282366920938463463374607431768211456"), std::out_of_range);
+    REQUIRE_THROWS_AS(uint256_t::parse(std::string(257, '1'), 2), std::out_of_range);
+}
+
+TEST_CASE("uint128: Random multiplication and division", "[CppCommon][Common]")
+{
+    std::mt19937_64 generator(0);
+    auto random = [&generator]() -> uint64_t
+    {
+        // Mix values of different bit widths
+        uint64_t value = generator();
+        return (value >> (generator() % 64)) | ((generator() % 8) == 0 ? 0x8000000000000000ull : 0);
+    };
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint128_t x(((generator() % 4) == 0) ? 0 : random(), random());
+        uint128_t y(((generator() % 2) == 0) ? 0 : random(), random());
+        if (y == 0)
+            y = 1;
+
+        auto result = uint128_t::divmod(x, y);
+        REQUIRE(result.second < y);
+        REQUIRE(result.first * y + result.second == x);
+        REQUIRE((x / y) == result.first);
+        REQUIRE((x % y) == result.second);
+
+#if defined(__SIZEOF_INT128__)
+        Internals::NativeUInt128 nx = ((Internals::NativeUInt128)x.upper() << 64) | x.lower();
+        Internals::NativeUInt128 ny = ((Internals::NativeUInt128)y.upper() << 64) | y.lower();
+        Internals::NativeUInt128 product = nx * ny;
+        Internals::NativeUInt128 quotient = nx / ny;
+        REQUIRE((x * y).upper() == (uint64_t)(product >> 64));
+        REQUIRE((x * y).lower() == (uint64_t)product);
+        REQUIRE(result.first.upper() == (uint64_t)(quotient >> 64));
+        REQUIRE(result.first.lower() == (uint64_t)quotient);
+#endif
+    }
+}
+
+TEST_CASE("uint256: Random multiplication and division", "[CppCommon][Common]")
+{
+    std::mt19937_64 generator(0);
+    auto random = [&generator]() -> uint64_t
+    {
+        // Each 64-bit limb is zero, small, full or has the highest bit set
+        switch (generator() % 4)
+        {
+            case 0: return (uint64_t)0;
+            case 1: return generator() % 1000;
+            case 2: return generator();
+            default: return generator() | 0x8000000000000000ull;
+        }
+    };
+
+    // Reference shift and add multiplication
+    auto multiply = [](uint256_t x, uint256_t y)
+    {
+        uint256_t result = 0;
+        while (y)
+        {
+            if (y & 1)
+                result += x;
+            x <<= 1;
+            y >>= 1;
+        }
+        return result;
+    };
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        uint256_t x(random(), random(), random(), random());
+        uint256_t y(random(), random(), random(), random());
+        if (y == 0)
+            y = 1;
+
+        auto result = uint256_t::divmod(x, y);
+        REQUIRE(result.second < y);
+        REQUIRE(result.first * y + result.second == x);
+        REQUIRE(x * y == multiply(x, y));
+        REQUIRE(y * x == x * y);
+    }
+
+    // Maximal values
+    const uint256_t max(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+    REQUIRE(max * max == 1);
+    REQUIRE(max / max == 1);
+    REQUIRE(max % uint256_t(0x8000000000000000ull, 0, 0, 1) == uint256_t(0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull));
+    REQUIRE(max / uint256_t(0xFFFFFFFFFFFFFFFFull) == uint256_t(1ull, 1ull, 1ull, 1ull));
+}
@@ -10,6 +10,10 @@
 #include "containers/bintree_rb.h"
 #include "containers/bintree_splay.h"
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 using namespace CppCommon;
 
 namespace {
@@ -203,6 +207,99 @@ void test()
     REQUIRE(bintree.empty());
 }
 
+struct MyAugmentedNode
+{
+    int value;
+
+    MyAugmentedNode* parent;
+    MyAugmentedNode* left;
+    MyAugmentedNode* right;
+    char balance;
+    bool rb;
+    size_t count;
+    int sum;
+
+    MyAugmentedNode(int v) : value(v) {}
+    friend bool operator<(const MyAugmentedNode& node1, const MyAugmentedNode& node2)
+    { return node1.value < node2.value; }
+};
+
+struct MySumAugment : public BinTreeOrderStatistic<MyAugmentedNode>
+{
+    static int value(const MyAugmentedNode& node) noexcept { return node.value; }
+    static int aggregate(const MyAugmentedNode* node) noexcept { return (node != nullptr) ? node->sum : 0; }
+    static void update(MyAugmentedNode& node) noexcept
+    {
+        BinTreeOrderStatistic<MyAugmentedNode>::update(node);
+        node.sum = value(node) + aggregate(node.left) + aggregate(node.right);
+    }
+};
+
+template <class TBinTree>
+void test_augment()
+{
+    TBinTree bintree;
+    std::vector<MyAugmentedNode> nodes;
+    for (int i = 0; i < 1000; ++i)
+        nodes.emplace_back(i);
+
+    std::mt19937 generator(42);
+    std::vector<int> expected;
+
+    auto check = [&]()
+    {
+        REQUIRE(bintree.size() == expected.size());
+        REQUIRE(((bintree.root() == nullptr) || (bintree.root()->count == expected.size())));
+        for (size_t i = 0; i < expected.size(); i += 7)
+        {
+            REQUIRE(bintree.select(i)->value == expected[i]);
+            REQUIRE(bintree.rank(MyAugmentedNode(expected[i])) == i);
+        }
+        REQUIRE(bintree.select(expected.size()) == bintree.end());
+
+        for (int i = 0; i < 1000; i += 37)
+        {
+            int sum = 0;
+            for (int value : expected)
+                if ((value >= i) && (value < i + 100))
+                    sum += value;
+            REQUIRE(bintree.range_aggregate(MyAugmentedNode(i), MyAugmentedNode(i + 100)) == sum);
+        }
+    };
+
+    // Insert items in random order
+    std::vector<int> order(nodes.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = (int)i;
+    std::shuffle(order.begin(), order.end(), generator);
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        REQUIRE(bintree.insert(nodes[order[i]]).second);
+        expected.insert(std::lower_bound(expected.begin(), expected.end(), order[i]), order[i]);
+        if ((i % 100) == 0)
+            check();
+    }
+    check();
+
+    // Erase half of items in random order
+    std::shuffle(order.begin(), order.end(), generator);
+    for (size_t i = 0; i < order.size() / 2; ++i)
+    {
+        REQUIRE(bintree.erase(nodes[order[i]]) != nullptr);
+        expected.erase(std::lower_bound(expected.begin(), expected.end(), order[i]));
+        if ((i % 50) == 0)
+            check();
+    }
+    check();
+
+    // Erase the rest items
+    for (size_t i = order.size() / 2; i < order.size(); ++i)
+        REQUIRE(bintree.erase(nodes[order[i]]) != nullptr);
+    expected.clear();
+    check();
+    REQUIRE(bintree.empty());
+}
+
 } // namespace
 
 TEST_CASE("Intrusive non balanced binary tree", "[CppCommon][Containers]")
@@ -229,3 +326,13 @@ TEST_CASE("Intrusive balanced Splay binary tree", "[CppCommon][Containers]")
 {
     test<BinTreeSplay<MyBinTreeNode>>();
 }
+
+TEST_CASE("Intrusive balanced AVL binary tree with order statistic", "[CppCommon][Containers]")
+{
+    test_augment<BinTreeAVL<MyAugmentedNode, std::less<MyAugmentedNode>, MySumAugment>>();
+}
+
+TEST_CASE("Intrusive balanced Reb-Black binary tree with order statistic", "[CppCommon][Containers]")
+{
+    test_augment<BinTreeRB<MyAugmentedNode, std::less<MyAugmentedNode>, MySumAugment>>();
+}
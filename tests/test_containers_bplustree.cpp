@@ -0,0 +1,151 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/bplustree.h"
+
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+template <class TTree>
+void check(const TTree& tree, const std::set<int>& reference)
+{
+    REQUIRE(tree.size() == reference.size());
+    REQUIRE(tree.empty() == reference.empty());
+
+    // Forward iteration through linked leaves
+    auto it = reference.begin();
+    for (const auto& item : tree)
+        REQUIRE(item == *it++);
+    REQUIRE(it == reference.end());
+
+    // Reverse iteration through linked leaves
+    auto rit = reference.rbegin();
+    for (auto tit = tree.rbegin(); tit != tree.rend(); ++tit)
+        REQUIRE(*tit == *rit++);
+    REQUIRE(rit == reference.rend());
+
+    if (!reference.empty())
+    {
+        REQUIRE(*tree.lowest() == *reference.begin());
+        REQUIRE(*tree.highest() == *reference.rbegin());
+    }
+}
+
+} // namespace
+
+TEST_CASE("B+ tree", "[CppCommon][Containers]")
+{
+    BPlusTree<int> tree;
+    REQUIRE(tree.empty());
+    REQUIRE(tree.size() == 0);
+    REQUIRE(tree.height() == 0);
+    REQUIRE(tree.lowest() == nullptr);
+    REQUIRE(tree.begin() == tree.end());
+
+    REQUIRE(tree.insert(6).second);
+    REQUIRE(tree.insert(3).second);
+    REQUIRE(tree.insert(7).second);
+    REQUIRE(!tree.insert(3).second);
+    REQUIRE(tree.size() == 3);
+    REQUIRE(*tree.insert(2).first == 2);
+
+    REQUIRE(*tree.find(6) == 6);
+    REQUIRE(tree.find(5) == tree.end());
+    REQUIRE(*tree.lower_bound(4) == 6);
+    REQUIRE(*tree.lower_bound(6) == 6);
+    REQUIRE(*tree.upper_bound(6) == 7);
+    REQUIRE(tree.upper_bound(7) == tree.end());
+
+    REQUIRE(tree.erase(3) == 1);
+    REQUIRE(tree.erase(3) == 0);
+    REQUIRE(*tree.erase(tree.find(6)) == 7);
+    REQUIRE(tree.erase(tree.find(7)) == tree.end());
+    REQUIRE(tree.size() == 1);
+
+    tree.clear();
+    REQUIRE(tree.empty());
+}
+
+TEST_CASE("B+ tree random test", "[CppCommon][Containers]")
+{
+    // Small nodes to exercise splits, borrows and merges
+    BPlusTree<int, std::less<int>, 64> tree;
+    std::set<int> reference;
+
+    std::mt19937 random(13);
+    std::uniform_int_distribution<int> distribution(0, 2000);
+    for (int i = 0; i < 20000; ++i)
+    {
+        int item = distribution(random);
+        if ((i % 3) == 0)
+            REQUIRE(tree.erase(item) == reference.erase(item));
+        else
+            REQUIRE(tree.insert(item).second == reference.insert(item).second);
+
+        if ((i % 1000) == 0)
+            check(tree, reference);
+    }
+    check(tree, reference);
+
+    for (int item = -1; item <= 2001; ++item)
+    {
+        auto lower = tree.lower_bound(item);
+        auto upper = tree.upper_bound(item);
+        auto rlower = reference.lower_bound(item);
+        auto rupper = reference.upper_bound(item);
+        REQUIRE((lower == tree.end()) == (rlower == reference.end()));
+        REQUIRE((upper == tree.end()) == (rupper == reference.end()));
+        if (lower != tree.end())
+            REQUIRE(*lower == *rlower);
+        if (upper != tree.end())
+            REQUIRE(*upper == *rupper);
+    }
+
+    // Copy and erase everything
+    BPlusTree<int, std::less<int>, 64> copy(tree);
+    check(copy, reference);
+    while (!reference.empty())
+    {
+        int item = *reference.begin();
+        REQUIRE(copy.erase(item) == 1);
+        reference.erase(item);
+    }
+    check(copy, reference);
+    REQUIRE(copy.height() == 0);
+}
+
+TEST_CASE("B+ tree bulk load", "[CppCommon][Containers]")
+{
+    for (int count : { 0, 1, 7, 8, 9, 100, 10000 })
+    {
+        std::vector<int> items;
+        std::set<int> reference;
+        for (int i = 0; i < count; ++i)
+        {
+            items.push_back(i * 2);
+            reference.insert(i * 2);
+        }
+
+        BPlusTree<int, std::less<int>, 64> tree;
+        tree.load(items.begin(), items.end());
+        check(tree, reference);
+
+        // Modify the loaded tree
+        for (int i = 0; i < count; i += 3)
+        {
+            REQUIRE(tree.insert(i * 2 + 1).second);
+            reference.insert(i * 2 + 1);
+            REQUIRE(tree.erase(i * 2) == 1);
+            reference.erase(i * 2);
+        }
+        check(tree, reference);
+    }
+}
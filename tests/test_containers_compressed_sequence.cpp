@@ -0,0 +1,107 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/compressed_sequence.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Compressed sequence", "[CppCommon][Containers]")
+{
+    CompressedSequence empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.begin() == empty.end());
+    REQUIRE(empty.lower_bound(10) == 0);
+    REQUIRE(!empty.contains(10));
+
+    CompressedSequence sequence = { 10, 10, 20, 30, 1000000, 1000000000000 };
+    REQUIRE(sequence.size() == 6);
+    REQUIRE(sequence.blocks() == 1);
+    REQUIRE(sequence.front() == 10);
+    REQUIRE(sequence.back() == 1000000000000);
+    REQUIRE(sequence[3] == 30);
+    REQUIRE_THROWS_AS(sequence.at(6), std::out_of_range);
+    REQUIRE(sequence.lower_bound(10) == 0);
+    REQUIRE(sequence.upper_bound(10) == 2);
+    REQUIRE(sequence.lower_bound(11) == 2);
+    REQUIRE(sequence.lower_bound(2000000000000) == 6);
+    REQUIRE(sequence.contains(1000000));
+    REQUIRE(!sequence.contains(1000001));
+
+    std::vector<uint64_t> values(sequence.begin(), sequence.end());
+    REQUIRE(values == std::vector<uint64_t>({ 10, 10, 20, 30, 1000000, 1000000000000 }));
+
+    REQUIRE_THROWS_AS(CompressedSequence({ 2, 1 }), std::invalid_argument);
+}
+
+TEST_CASE("Compressed sequence random test", "[CppCommon][Containers]")
+{
+    std::mt19937_64 generator(1);
+
+    // Deltas of all bit widths including raw blocks
+    std::vector<uint64_t> values;
+    uint64_t value = 1600000000000000000ull;
+    for (size_t bits = 0; bits <= 40; ++bits)
+    {
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            values.push_back(value);
+            value += (bits == 0) ? 0 : (generator() & ((1ull << bits) - 1));
+        }
+    }
+
+    CompressedSequence sequence(values);
+    REQUIRE(sequence.size() == values.size());
+    REQUIRE(sequence.Decode() == values);
+    REQUIRE(sequence.data().size() < values.size() * sizeof(uint64_t));
+
+    std::vector<uint64_t> scanned;
+    for (uint64_t item : sequence)
+        scanned.push_back(item);
+    REQUIRE(scanned == values);
+
+    bool found = true;
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        size_t index = generator() % values.size();
+        uint64_t key = values[index] + (generator() % 3) - 1;
+        found = found && (sequence[index] == values[index]);
+        found = found && (sequence.lower_bound(key) == (size_t)(std::lower_bound(values.begin(), values.end(), key) - values.begin()));
+        found = found && (sequence.upper_bound(key) == (size_t)(std::upper_bound(values.begin(), values.end(), key) - values.begin()));
+        found = found && (sequence.contains(key) == std::binary_search(values.begin(), values.end(), key));
+    }
+    REQUIRE(found);
+}
+
+TEST_CASE("Compressed sequence flat buffer", "[CppCommon][Containers]")
+{
+    std::vector<uint64_t> values(1000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = 1000 + i * 3;
+    CompressedSequence sequence(values);
+
+    // Open the copy of the flat buffer without deserialization
+    std::vector<uint64_t> buffer((sequence.data().size() + 7) / 8);
+    std::memcpy(buffer.data(), sequence.data().data(), sequence.data().size());
+    CompressedSequence opened = CompressedSequence::Open(std::span<const uint8_t>((const uint8_t*)buffer.data(), sequence.data().size()));
+    REQUIRE(opened.mapped());
+    REQUIRE(opened.size() == values.size());
+    REQUIRE(opened.Decode() == values);
+    REQUIRE(opened.lower_bound(2000) == 334);
+
+    CompressedSequence copy(opened);
+    REQUIRE(copy.mapped());
+    REQUIRE(copy[999] == values[999]);
+
+    // Invalid buffers
+    REQUIRE_THROWS_AS(CompressedSequence::Open(std::span<const uint8_t>((const uint8_t*)buffer.data(), 16)), std::invalid_argument);
+    buffer[0] = 0;
+    REQUIRE_THROWS_AS(CompressedSequence::Open(std::span<const uint8_t>((const uint8_t*)buffer.data(), sequence.data().size())), std::invalid_argument);
+}
@@ -0,0 +1,97 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/concurrent_hashmap.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Concurrent hash map", "[CppCommon][Containers]")
+{
+    ConcurrentHashMap<int, int> hashmap(128, -1, 4);
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.size() == 0);
+    REQUIRE(hashmap.stripes() == 4);
+
+    REQUIRE(hashmap.insert(1, 10));
+    REQUIRE(!hashmap.insert(1, 11));
+    REQUIRE(hashmap.size() == 1);
+
+    int value = 0;
+    REQUIRE(hashmap.find(1, value));
+    REQUIRE(value == 10);
+    REQUIRE(!hashmap.find(2, value));
+    REQUIRE(hashmap.contains(1));
+    REQUIRE(!hashmap.contains(2));
+
+    REQUIRE(!hashmap.insert_or_assign(1, 12));
+    REQUIRE(hashmap.insert_or_assign(2, 20));
+    REQUIRE(hashmap.size() == 2);
+    REQUIRE(hashmap.visit(1, [](const int& item) { REQUIRE(item == 12); }));
+
+    REQUIRE(hashmap.erase(1));
+    REQUIRE(!hashmap.erase(1));
+    REQUIRE(hashmap.size() == 1);
+
+    hashmap.clear();
+    REQUIRE(hashmap.empty());
+}
+
+TEST_CASE("Concurrent hash map multithreading", "[CppCommon][Containers]")
+{
+    const int threads_count = 8;
+    const int items = 10000;
+
+    ConcurrentHashMap<int, int> hashmap(128, -1);
+
+    // Insert disjoint key ranges and find keys of the other threads
+    std::atomic<int> found(0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&hashmap, &found, thread, threads_count, items]()
+        {
+            for (int i = 0; i < items; ++i)
+                hashmap.insert_or_assign(thread * items + i, i);
+            for (int i = 0; i < items; ++i)
+            {
+                int value;
+                if (hashmap.find(((thread + 1) % threads_count) * items + i, value) && (value == i))
+                    ++found;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(hashmap.size() == (size_t)(threads_count * items));
+    REQUIRE(found <= threads_count * items);
+
+    for (int key = 0; key < threads_count * items; ++key)
+    {
+        int value;
+        REQUIRE(hashmap.find(key, value));
+        REQUIRE(value == (key % items));
+    }
+
+    // Erase all keys concurrently
+    threads.clear();
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&hashmap, thread, items]()
+        {
+            for (int i = 0; i < items; ++i)
+                hashmap.erase(thread * items + i);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(hashmap.empty());
+}
@@ -0,0 +1,164 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/concurrent_skiplist.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct MySkipListNode : public ConcurrentSkipList<MySkipListNode>::Node
+{
+    int value;
+
+    MySkipListNode(int v) : value(v) {}
+    friend bool operator<(const MySkipListNode& node1, const MySkipListNode& node2)
+    { return node1.value < node2.value; }
+};
+
+} // namespace
+
+TEST_CASE("Intrusive lock-free concurrent skip list", "[CppCommon][Containers]")
+{
+    ConcurrentSkipList<MySkipListNode> skiplist;
+    REQUIRE(skiplist.empty());
+    REQUIRE(skiplist.size() == 0);
+    REQUIRE(skiplist.begin() == skiplist.end());
+
+    std::vector<MySkipListNode> items;
+    for (int i = 0; i < 10; ++i)
+        items.emplace_back(i * 10);
+
+    for (int i : { 5, 2, 8, 0, 9, 1, 7, 3, 6, 4 })
+    {
+        REQUIRE(skiplist.insert(items[i]).second);
+        REQUIRE(!skiplist.insert(items[i]).second);
+    }
+    REQUIRE(!skiplist.empty());
+    REQUIRE(skiplist.size() == 10);
+
+    int expected = 0;
+    for (auto& item : skiplist)
+    {
+        REQUIRE(item.value == expected);
+        expected += 10;
+    }
+    REQUIRE(expected == 100);
+
+    REQUIRE(skiplist.find(MySkipListNode(30))->value == 30);
+    REQUIRE(skiplist.find(MySkipListNode(31)) == skiplist.end());
+    REQUIRE(skiplist.contains(MySkipListNode(90)));
+    REQUIRE(!skiplist.contains(MySkipListNode(91)));
+    REQUIRE(skiplist.lower_bound(MySkipListNode(30))->value == 30);
+    REQUIRE(skiplist.lower_bound(MySkipListNode(31))->value == 40);
+    REQUIRE(skiplist.lower_bound(MySkipListNode(91)) == skiplist.end());
+    REQUIRE(skiplist.upper_bound(MySkipListNode(30))->value == 40);
+    REQUIRE(skiplist.upper_bound(MySkipListNode(-1))->value == 0);
+    REQUIRE(skiplist.upper_bound(MySkipListNode(90)) == skiplist.end());
+
+    REQUIRE(skiplist.erase(MySkipListNode(30)) == &items[3]);
+    REQUIRE(skiplist.erase(MySkipListNode(30)) == nullptr);
+    REQUIRE(skiplist.erase(MySkipListNode(0)) == &items[0]);
+    REQUIRE(skiplist.erase(MySkipListNode(90)) == &items[9]);
+    REQUIRE(skiplist.size() == 7);
+    REQUIRE(skiplist.begin()->value == 10);
+    REQUIRE(skiplist.lower_bound(MySkipListNode(21))->value == 40);
+
+    // Erased item can be inserted again
+    REQUIRE(skiplist.insert(items[3]).second);
+    REQUIRE(skiplist.lower_bound(MySkipListNode(21))->value == 30);
+    REQUIRE(skiplist.size() == 8);
+
+    skiplist.clear();
+    REQUIRE(skiplist.empty());
+    REQUIRE(skiplist.size() == 0);
+}
+
+TEST_CASE("Intrusive lock-free concurrent skip list multi-threaded", "[CppCommon][Containers]")
+{
+    const int threads_count = 4;
+    const int items_per_thread = 10000;
+
+    ConcurrentSkipList<MySkipListNode> skiplist;
+
+    std::vector<MySkipListNode> items;
+    items.reserve(threads_count * items_per_thread);
+    for (int i = 0; i < threads_count * items_per_thread; ++i)
+        items.emplace_back(i);
+
+    std::atomic<bool> done(false);
+    std::atomic<bool> ordered(true);
+
+    // Concurrent reader checks the sort order of the skip list
+    std::thread reader([&skiplist, &done, &ordered]()
+    {
+        while (!done)
+        {
+            int previous = -1;
+            for (auto& item : skiplist)
+            {
+                if (item.value <= previous)
+                    ordered = false;
+                previous = item.value;
+            }
+        }
+    });
+
+    // Each writer inserts interleaved items and erases odd ones
+    std::vector<std::thread> writers;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        writers.emplace_back([&skiplist, &items, thread]()
+        {
+            for (int i = thread; i < threads_count * items_per_thread; i += threads_count)
+                skiplist.insert(items[i]);
+            for (int i = thread; i < threads_count * items_per_thread; i += threads_count)
+                if ((i % 2) != 0)
+                    skiplist.erase(items[i]);
+        });
+    }
+    for (auto& writer : writers)
+        writer.join();
+
+    done = true;
+    reader.join();
+
+    REQUIRE(ordered);
+    REQUIRE(skiplist.size() == (size_t)(threads_count * items_per_thread / 2));
+
+    int expected = 0;
+    for (auto& item : skiplist)
+    {
+        REQUIRE(item.value == expected);
+        expected += 2;
+    }
+    REQUIRE(expected == threads_count * items_per_thread);
+    for (int i = 0; i < threads_count * items_per_thread; ++i)
+        REQUIRE(skiplist.contains(items[i]) == ((i % 2) == 0));
+
+    // All threads compete to erase the same items
+    std::atomic<int> erased(0);
+    std::vector<std::thread> erasers;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        erasers.emplace_back([&skiplist, &items, &erased]()
+        {
+            for (int i = 0; i < threads_count * items_per_thread; i += 2)
+                if (skiplist.erase(items[i]) != nullptr)
+                    ++erased;
+        });
+    }
+    for (auto& eraser : erasers)
+        eraser.join();
+
+    REQUIRE(erased == threads_count * items_per_thread / 2);
+    REQUIRE(skiplist.empty());
+    REQUIRE(skiplist.size() == 0);
+}
@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/dense_hashmap.h"
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace CppCommon;
+
+TEST_CASE("Dense hash map", "[CppCommon][Containers]")
+{
+    DenseHashMap<int, std::string> hashmap;
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.begin() == hashmap.end());
+
+    REQUIRE(hashmap.insert(std::make_pair(1, "1")).second);
+    REQUIRE(hashmap.emplace(2, "2").second);
+    REQUIRE(!hashmap.emplace(2, "22").second);
+    hashmap[3] = "3";
+    hashmap[4] = "4";
+    REQUIRE(hashmap.size() == 4);
+    REQUIRE(hashmap.at(2) == "2");
+    REQUIRE_THROWS_AS(hashmap.at(5), std::out_of_range);
+    REQUIRE(hashmap.find(5) == hashmap.end());
+    REQUIRE(hashmap.contains(3));
+
+    // Items are iterated in the insert order
+    std::string order;
+    for (const auto& item : hashmap)
+        order += item.second;
+    REQUIRE(order == "1234");
+    REQUIRE(hashmap.data()[2].first == 3);
+
+    // Erase moves the last item into the erased position
+    REQUIRE(hashmap.erase(1) == 1);
+    REQUIRE(hashmap.erase(1) == 0);
+    REQUIRE(hashmap.front().first == 4);
+    REQUIRE(hashmap.back().first == 3);
+    REQUIRE(hashmap.at(4) == "4");
+    REQUIRE(hashmap.find(4) == hashmap.begin());
+
+    // Erase in the forward loop
+    for (auto it = hashmap.begin(); it != hashmap.end();)
+    {
+        if (it->first != 2)
+            it = hashmap.erase(it);
+        else
+            ++it;
+    }
+    REQUIRE(hashmap.size() == 1);
+    REQUIRE(hashmap.at(2) == "2");
+
+    auto last = hashmap.pop_back();
+    REQUIRE(last.first == 2);
+    REQUIRE(hashmap.empty());
+
+    hashmap[5] = "5";
+    hashmap.clear();
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.count(5) == 0);
+}
+
+TEST_CASE("Dense hash map random", "[CppCommon][Containers]")
+{
+    // Compare with the reference std::unordered_map
+    DenseHashMap<size_t, size_t> hashmap(8);
+    std::unordered_map<size_t, size_t> reference;
+
+    std::mt19937 generator(12345);
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        size_t key = generator() % 5000;
+        if ((generator() % 3) == 0)
+            REQUIRE(hashmap.erase(key) == reference.erase(key));
+        else
+        {
+            REQUIRE(hashmap.emplace(key, i).second == reference.emplace(key, i).second);
+            REQUIRE(hashmap.at(key) == reference.at(key));
+        }
+    }
+
+    REQUIRE(hashmap.size() == reference.size());
+    for (const auto& item : hashmap)
+        REQUIRE(reference.at(item.first) == item.second);
+    for (const auto& item : reference)
+        REQUIRE(hashmap.at(item.first) == item.second);
+
+    // Shrink the index table and check all items again
+    size_t buckets = hashmap.bucket_count();
+    while (hashmap.size() > 10)
+        hashmap.erase(hashmap.begin());
+    hashmap.shrink_to_fit();
+    REQUIRE(hashmap.bucket_count() < buckets);
+    for (const auto& item : hashmap)
+        REQUIRE(hashmap.find(item.first)->second == item.second);
+}
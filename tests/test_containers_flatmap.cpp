@@ -6,6 +6,10 @@
 
 #include "containers/flatmap.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Flat map", "[CppCommon][Containers]")
@@ -150,3 +154,139 @@ TEST_CASE("Flat map", "[CppCommon][Containers]")
 
     REQUIRE(flatmap.empty());
 }
+
+TEST_CASE("Flat map bulk insert and merge", "[CppCommon][Containers]")
+{
+    FlatMap<int, int> flatmap;
+    flatmap.emplace(5, 50);
+    flatmap.emplace(1, 10);
+
+    // Bulk insert keeps existing items and the first of duplicates
+    std::vector<std::pair<int, int>> items = { { 9, 9 }, { 3, 3 }, { 5, 5 }, { 7, 7 }, { 3, 30 }, { 0, 0 } };
+    flatmap.insert(items.begin(), items.end());
+    REQUIRE(flatmap.size() == 6);
+    REQUIRE(std::is_sorted(flatmap.begin(), flatmap.end()));
+    REQUIRE(flatmap.at(5) == 50);
+    REQUIRE(flatmap.at(3) == 3);
+    REQUIRE(flatmap.at(1) == 10);
+
+    FlatMap<int, int> constructed(items.begin(), items.end(), true);
+    REQUIRE(constructed.size() == 5);
+    REQUIRE(constructed.at(5) == 5);
+
+    FlatMap<int, int> other;
+    other.emplace(2, 2);
+    other.emplace(5, 500);
+    other.emplace(10, 10);
+    flatmap.merge(std::move(other));
+    REQUIRE(other.empty());
+    REQUIRE(flatmap.size() == 8);
+    REQUIRE(std::is_sorted(flatmap.begin(), flatmap.end()));
+    REQUIRE(flatmap.at(5) == 50);
+    REQUIRE(flatmap.at(2) == 2);
+    REQUIRE(flatmap.at(10) == 10);
+
+    FlatMap<int, int> empty;
+    empty.merge(std::move(flatmap));
+    REQUIRE(empty.size() == 8);
+
+    // Large unsorted input
+    std::vector<std::pair<int, int>> large;
+    for (int i = 0; i < 100000; ++i)
+        large.emplace_back((i * 7919) % 100000, i);
+    FlatMap<int, int> loaded(large.begin(), large.end(), true);
+    REQUIRE(loaded.size() == 100000);
+    for (int i = 0; i < 100000; ++i)
+        REQUIRE(loaded.find(i) != loaded.end());
+}
+
+TEST_CASE("Flat map read-optimized layout", "[CppCommon][Containers]")
+{
+    for (int count : { 0, 1, 2, 3, 7, 8, 100, 1000 })
+    {
+        FlatMap<int, int> flatmap;
+        FlatMap<int, int> reference;
+        flatmap.set_read_optimized(true);
+        REQUIRE(flatmap.read_optimized());
+        for (int i = 0; i < count; ++i)
+        {
+            flatmap.emplace(i * 2, i);
+            reference.emplace(i * 2, i);
+        }
+
+        // Compare bounds with the regular binary search
+        for (int key = -1; key <= count * 2; ++key)
+        {
+            REQUIRE((flatmap.lower_bound(key) - flatmap.begin()) == (reference.lower_bound(key) - reference.begin()));
+            REQUIRE((flatmap.upper_bound(key) - flatmap.begin()) == (reference.upper_bound(key) - reference.begin()));
+            REQUIRE((flatmap.find(key) == flatmap.end()) == (reference.find(key) == reference.end()));
+        }
+
+        // Modifications invalidate the layout
+        flatmap[-5] = 5;
+        flatmap.erase(0);
+        REQUIRE(flatmap.find(-5)->second == 5);
+        REQUIRE(flatmap.find(0) == flatmap.end());
+        if (count > 1)
+            REQUIRE(flatmap.at(2) == 1);
+    }
+
+    FlatMap<int, int> flatmap;
+    flatmap.set_read_optimized(true);
+    for (int i = 0; i < 10; ++i)
+        flatmap.emplace(i, i);
+
+    // Concurrent lookups do not modify the read-optimized layout
+    const FlatMap<int, int>& readonly = flatmap;
+    std::vector<std::thread> readers;
+    std::atomic<int> found(0);
+    for (int thread = 0; thread < 4; ++thread)
+        readers.emplace_back([&readonly, &found]() { for (int i = 0; i < 10; ++i) if (readonly.find(i)->second == i) ++found; });
+    for (auto& reader : readers)
+        reader.join();
+    REQUIRE(found == 40);
+
+    flatmap.set_read_optimized(false);
+    REQUIRE(!flatmap.read_optimized());
+    REQUIRE(flatmap.find(5)->second == 5);
+}
+
+TEST_CASE("Flat map batched lookups", "[CppCommon][Containers]")
+{
+    for (bool optimized : { false, true })
+    {
+        for (int count : { 0, 1, 2, 3, 17, 1000 })
+        {
+            FlatMap<int, int> flatmap;
+            flatmap.set_read_optimized(optimized);
+            for (int i = 0; i < count; ++i)
+                flatmap.emplace(i * 2, i);
+
+            // Batch does not fit the lookup group and contains missing keys
+            std::vector<int> keys;
+            for (int key = -1; key <= count * 2; ++key)
+                keys.push_back((key * 7) % (count * 2 + 2));
+
+            std::vector<FlatMap<int, int>::iterator> results(keys.size());
+            size_t found = flatmap.find_many(keys, results);
+
+            size_t expected = 0;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                REQUIRE(results[i] == flatmap.find(keys[i]));
+                if (results[i] != flatmap.end())
+                {
+                    REQUIRE(results[i]->first == keys[i]);
+                    ++expected;
+                }
+            }
+            REQUIRE(found == expected);
+
+            const FlatMap<int, int>& constant = flatmap;
+            std::vector<FlatMap<int, int>::const_iterator> constants(keys.size());
+            REQUIRE(constant.find_many(keys, constants) == expected);
+            for (size_t i = 0; i < keys.size(); ++i)
+                REQUIRE(constants[i] == constant.find(keys[i]));
+        }
+    }
+}
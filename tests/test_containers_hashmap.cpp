@@ -6,6 +6,9 @@
 
 #include "containers/hashmap.h"
 
+#include <unordered_map>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Hash map", "[CppCommon][Containers]")
@@ -100,3 +103,234 @@ TEST_CASE("Hash map", "[CppCommon][Containers]")
 
     REQUIRE(hashmap.empty());
 }
+
+TEST_CASE("Hash map random operations", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(4, -1);
+    std::unordered_map<int, int> expected;
+
+    // Mix inserts and erases across rehashes and small tables
+    uint64_t seed = 1;
+    for (int i = 0; i < 100000; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        int key = (int)((seed >> 33) % 1000);
+        if ((seed >> 32) & 1)
+        {
+            hashmap.insert(std::make_pair(key, i));
+            expected.insert(std::make_pair(key, i));
+        }
+        else
+            REQUIRE(hashmap.erase(key) == expected.erase(key));
+    }
+
+    REQUIRE(hashmap.size() == expected.size());
+    for (int key = 0; key < 1000; ++key)
+    {
+        auto it = hashmap.find(key);
+        auto expected_it = expected.find(key);
+        REQUIRE((it == hashmap.end()) == (expected_it == expected.end()));
+        if (it != hashmap.end())
+            REQUIRE(it->second == expected_it->second);
+    }
+
+    size_t count = 0;
+    for (auto it = hashmap.begin(); it != hashmap.end(); ++it)
+        ++count;
+    REQUIRE(count == expected.size());
+}
+
+namespace {
+
+struct CountingHash
+{
+    static size_t calls;
+
+    size_t operator()(int key) const noexcept { ++calls; return (size_t)key; }
+};
+
+size_t CountingHash::calls = 0;
+
+} // namespace
+
+TEST_CASE("Hash map stored hashes", "[CppCommon][Containers]")
+{
+    HashMap<int, int, CountingHash> hashmap(16, -1);
+
+    // Colliding keys produce long probe sequences for backward shift
+    for (int i = 0; i < 100; ++i)
+        hashmap.insert(std::make_pair(i * 64, i));
+    REQUIRE(hashmap.size() == 100);
+
+    // Rehash does not call the key hasher
+    CountingHash::calls = 0;
+    hashmap.rehash(4096);
+    REQUIRE(CountingHash::calls == 0);
+
+    // Erase calls the key hasher only to find the erased key
+    for (int i = 0; i < 100; i += 2)
+        REQUIRE(hashmap.erase(i * 64) == 1);
+    REQUIRE(CountingHash::calls == 50);
+
+    for (int i = 0; i < 100; ++i)
+        REQUIRE((hashmap.find(i * 64) != hashmap.end()) == ((i % 2) == 1));
+}
+
+TEST_CASE("Hash map incremental rehashing", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(4, -1);
+    hashmap.set_incremental(true);
+    REQUIRE(hashmap.incremental());
+
+    std::unordered_map<int, int> expected;
+
+    // Mix inserts, lookups and erases while old buckets are migrated
+    bool rehashing = false;
+    uint64_t seed = 1;
+    for (int i = 0; i < 100000; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        int key = (int)((seed >> 33) % 5000);
+        if (((seed >> 32) & 3) != 0)
+        {
+            auto result = hashmap.insert(std::make_pair(key, i));
+            REQUIRE(result.second == expected.insert(std::make_pair(key, i)).second);
+            REQUIRE(result.first->first == key);
+        }
+        else
+            REQUIRE(hashmap.erase(key) == expected.erase(key));
+
+        rehashing |= hashmap.rehashing();
+        auto it = hashmap.find(key);
+        REQUIRE((it != hashmap.end()) == (expected.find(key) != expected.end()));
+    }
+    REQUIRE(rehashing);
+    REQUIRE(hashmap.size() == expected.size());
+
+    // Iterate over both new and old buckets
+    size_t count = 0;
+    for (const auto& item : hashmap)
+    {
+        REQUIRE(expected[item.first] == item.second);
+        ++count;
+    }
+    REQUIRE(count == expected.size());
+
+    // Copy and disabling finish the pending migration
+    HashMap<int, int> copy(hashmap);
+    REQUIRE(copy.size() == expected.size());
+    hashmap.set_incremental(false);
+    REQUIRE(!hashmap.rehashing());
+    for (const auto& item : expected)
+    {
+        REQUIRE(hashmap.at(item.first) == item.second);
+        REQUIRE(copy.at(item.first) == item.second);
+    }
+}
+
+TEST_CASE("Hash map parallel insert and rehash", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(16, -1);
+    std::unordered_map<int, int> expected;
+
+    // Existing items must not be replaced by the parallel insert
+    for (int i = 0; i < 1000; ++i)
+    {
+        hashmap.insert(std::make_pair(i * 7, -i));
+        expected.insert(std::make_pair(i * 7, -i));
+    }
+    hashmap.reserve(100000);
+    int buckets = (int)hashmap.bucket_count();
+
+    // Random items with duplicates and colliding items which probe sequences leave their bucket ranges
+    std::vector<std::pair<int, int>> items;
+    uint64_t seed = 1;
+    for (int i = 0; i < 90000; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        items.emplace_back((int)((seed >> 33) % 200000), i);
+    }
+    for (int range = 1; range <= 8; ++range)
+        for (int i = 0; i < 40; ++i)
+            items.emplace_back(range * 4096 - 8 + i * buckets, i);
+    for (const auto& item : items)
+        expected.insert(item);
+
+    hashmap.parallel_insert(items.begin(), items.end(), 4);
+    REQUIRE(hashmap.size() == expected.size());
+    REQUIRE(hashmap.bucket_count() == (size_t)buckets);
+    for (const auto& item : expected)
+        REQUIRE(hashmap.at(item.first) == item.second);
+
+    // Parallel rehash into the bigger hash map
+    hashmap.parallel_rehash(4 * hashmap.bucket_count(), 3);
+    REQUIRE(hashmap.size() == expected.size());
+    REQUIRE(hashmap.bucket_count() == 4 * (size_t)buckets);
+    size_t count = 0;
+    for (const auto& item : hashmap)
+    {
+        REQUIRE(expected[item.first] == item.second);
+        ++count;
+    }
+    REQUIRE(count == expected.size());
+
+    // Erase half of items with backward shift
+    for (int i = 0; i < 200000; i += 2)
+        REQUIRE(hashmap.erase(i) == expected.erase(i));
+    REQUIRE(hashmap.size() == expected.size());
+    for (const auto& item : expected)
+        REQUIRE(hashmap.at(item.first) == item.second);
+
+    // Parallel insert into the growing hash map under incremental migration
+    HashMap<int, int> incremental(4, -1);
+    incremental.set_incremental(true);
+    for (int i = 0; i < 1000; ++i)
+        incremental.insert(std::make_pair(i, i));
+    incremental.parallel_insert(items.begin(), items.end());
+    REQUIRE(!incremental.rehashing());
+    std::unordered_map<int, int> merged;
+    for (int i = 0; i < 1000; ++i)
+        merged.insert(std::make_pair(i, i));
+    for (const auto& item : items)
+        merged.insert(item);
+    REQUIRE(incremental.size() == merged.size());
+    for (const auto& item : merged)
+        REQUIRE(incremental.at(item.first) == item.second);
+}
+
+TEST_CASE("Hash map batched lookups", "[CppCommon][Containers]")
+{
+    HashMap<int, int> hashmap(16, -1);
+    hashmap.set_incremental(true);
+    for (int i = 0; i < 10000; ++i)
+        hashmap.insert(std::make_pair(i * 3, i));
+    REQUIRE(hashmap.rehashing());
+
+    // Batch does not fit the prefetch group and contains missing keys
+    std::vector<int> keys;
+    for (int i = 0; i < 1003; ++i)
+        keys.push_back((i * 7919) % 30000);
+
+    std::vector<HashMap<int, int>::iterator> results(keys.size());
+    size_t found = hashmap.find_many(keys, results);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        REQUIRE(results[i] == hashmap.find(keys[i]));
+        if ((keys[i] % 3) == 0)
+        {
+            REQUIRE(results[i]->second == keys[i] / 3);
+            ++expected;
+        }
+    }
+    REQUIRE(found == expected);
+
+    const HashMap<int, int>& constant = hashmap;
+    std::vector<HashMap<int, int>::const_iterator> constants(keys.size());
+    REQUIRE(constant.find_many(keys, constants) == expected);
+    for (size_t i = 0; i < keys.size(); ++i)
+        REQUIRE(constants[i] == constant.find(keys[i]));
+
+    REQUIRE(hashmap.find_many(std::span<const int>(), results) == 0);
+}
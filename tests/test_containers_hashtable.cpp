@@ -0,0 +1,159 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/hashtable.h"
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Order : public HashTableNode<Order, struct OrderById>, public HashTableNode<Order, struct OrderByClient>
+{
+    uint64_t id;
+    uint32_t client;
+
+    Order() : id(0), client(0) {}
+    Order(uint64_t i, uint32_t c) : id(i), client(c) {}
+};
+
+struct OrderById { uint64_t operator()(const Order& order) const noexcept { return order.id; } };
+struct OrderByClient { uint32_t operator()(const Order& order) const noexcept { return order.client; } };
+
+} // namespace
+
+TEST_CASE("Intrusive hash table", "[CppCommon][Containers]")
+{
+    HashTable<Order, OrderById> hashtable(8);
+    REQUIRE(hashtable.empty());
+    REQUIRE(hashtable.begin() == hashtable.end());
+
+    Order order1(1, 10);
+    Order order2(2, 10);
+    Order order3(3, 20);
+    Order duplicate(2, 30);
+
+    REQUIRE(hashtable.insert(order1).second);
+    REQUIRE(hashtable.insert(order2).second);
+    REQUIRE(hashtable.insert(order3).second);
+    auto result = hashtable.insert(duplicate);
+    REQUIRE(!result.second);
+    REQUIRE(&*result.first == &order2);
+    REQUIRE(hashtable.size() == 3);
+
+    REQUIRE(hashtable.find(1)->client == 10);
+    REQUIRE(hashtable.find(4) == hashtable.end());
+    REQUIRE(hashtable.contains(3));
+    REQUIRE(hashtable.count(2) == 1);
+
+    uint64_t sum = 0;
+    for (const auto& order : hashtable)
+        sum += order.id;
+    REQUIRE(sum == 6);
+
+    REQUIRE(hashtable.erase(2) == &order2);
+    REQUIRE(hashtable.erase(2) == nullptr);
+    REQUIRE(hashtable.unlink(order3));
+    REQUIRE(!hashtable.unlink(order3));
+    auto it = hashtable.erase(hashtable.find(1));
+    REQUIRE(it == hashtable.end());
+    REQUIRE(hashtable.empty());
+}
+
+TEST_CASE("Intrusive hash table with several indexes", "[CppCommon][Containers]")
+{
+    std::vector<Order> pool(10000);
+    HashTable<Order, OrderById> by_id;
+    HashTable<Order, OrderByClient> by_client;
+    std::unordered_multimap<uint32_t, uint64_t> expected;
+
+    for (size_t i = 0; i < pool.size(); ++i)
+    {
+        pool[i] = Order(i + 1, (uint32_t)(i % 100));
+        REQUIRE(by_id.insert(pool[i]).second);
+        by_client.insert_equal(pool[i]);
+        expected.emplace(pool[i].client, pool[i].id);
+
+        // Both indexes must be consistent during the incremental resize
+        if ((i % 997) == 0)
+        {
+            REQUIRE(by_id.find(i / 2 + 1) != by_id.end());
+            REQUIRE(by_client.count(pool[i].client) == expected.count(pool[i].client));
+        }
+    }
+    REQUIRE(by_id.size() == 10000);
+    REQUIRE(by_client.size() == 10000);
+
+    size_t count = 0;
+    for (auto it = by_id.begin(); it != by_id.end(); ++it)
+        ++count;
+    REQUIRE(count == 10000);
+
+    // Items with equal keys are adjacent
+    auto range = by_client.equal_range(42);
+    count = 0;
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        REQUIRE(it->client == 42);
+        ++count;
+    }
+    REQUIRE(count == 100);
+
+    // Unlink orders of the client from both indexes
+    std::vector<Order*> orders;
+    for (auto it = range.first; it != range.second; ++it)
+        orders.push_back(&*it);
+    for (Order* order : orders)
+    {
+        REQUIRE(by_client.unlink(*order));
+        REQUIRE(by_id.unlink(*order));
+    }
+    REQUIRE(by_client.count(42) == 0);
+    REQUIRE(by_id.size() == 9900);
+    REQUIRE(by_id.find(43) == by_id.end());
+
+    // Random erases and inserts
+    std::mt19937 generator(12345);
+    std::vector<bool> linked(pool.size(), true);
+    for (Order* order : orders)
+        linked[order->id - 1] = false;
+    for (int i = 0; i < 50000; ++i)
+    {
+        size_t index = generator() % pool.size();
+        if (linked[index])
+        {
+            REQUIRE(by_id.erase(pool[index].id) == &pool[index]);
+            REQUIRE(by_client.unlink(pool[index]));
+        }
+        else
+        {
+            REQUIRE(by_id.insert(pool[index]).second);
+            by_client.insert_equal(pool[index]);
+        }
+        linked[index] = !linked[index];
+    }
+    size_t total = 0;
+    for (size_t i = 0; i < pool.size(); ++i)
+    {
+        REQUIRE(by_id.contains(pool[i].id) == linked[i]);
+        total += linked[i] ? 1 : 0;
+    }
+    REQUIRE(by_id.size() == total);
+    size_t clients = 0;
+    for (uint32_t client = 0; client < 100; ++client)
+        clients += by_client.count(client);
+    REQUIRE(clients == total);
+
+    by_id.rehash(100000);
+    REQUIRE(!by_id.rehashing());
+    REQUIRE(by_id.size() == total);
+    by_id.clear();
+    by_client.clear();
+    REQUIRE(by_id.empty());
+}
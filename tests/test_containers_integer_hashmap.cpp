@@ -0,0 +1,100 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/integer_hashmap.h"
+
+#include <unordered_map>
+
+using namespace CppCommon;
+
+TEST_CASE("Integer hash map", "[CppCommon][Containers]")
+{
+    IntegerHashMap<uint64_t, uint32_t> hashmap;
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.size() == 0);
+    REQUIRE(hashmap.blank() == std::numeric_limits<uint64_t>::max());
+
+    hashmap[6] = 6;
+    hashmap[3] = 3;
+    hashmap[7] = 7;
+    REQUIRE(hashmap.size() == 3);
+    REQUIRE(hashmap.insert(std::make_pair(2, 2)).second);
+    REQUIRE(!hashmap.insert(std::make_pair(2, 20)).second);
+    REQUIRE(hashmap.emplace(0, 0).second);
+    REQUIRE(hashmap.size() == 5);
+
+    REQUIRE(hashmap.find(6)->second == 6);
+    REQUIRE(hashmap.find(0)->second == 0);
+    REQUIRE(hashmap.find(2).key() == 2);
+    REQUIRE(hashmap.find(5) == hashmap.end());
+    REQUIRE(hashmap.count(3) == 1);
+    REQUIRE(hashmap.count(4) == 0);
+    REQUIRE(hashmap.at(7) == 7);
+    REQUIRE_THROWS_AS(hashmap.at(8), std::out_of_range);
+
+    hashmap.find(7)->second = 70;
+    REQUIRE(hashmap[7] == 70);
+
+    uint64_t keys = 0;
+    uint64_t values = 0;
+    for (auto item : hashmap)
+    {
+        keys += item.first;
+        values += item.second;
+    }
+    REQUIRE(keys == 18);
+    REQUIRE(values == 81);
+
+    REQUIRE(hashmap.erase(6) == 1);
+    REQUIRE(hashmap.erase(6) == 0);
+    hashmap.erase(hashmap.find(3));
+    REQUIRE(hashmap.size() == 3);
+
+    hashmap.clear();
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.begin() == hashmap.end());
+}
+
+TEST_CASE("Integer hash map random test", "[CppCommon][Containers]")
+{
+    IntegerHashMap<int64_t, int> hashmap(16);
+    std::unordered_map<int64_t, int> reference;
+
+    // Strided keys cluster badly with the identity hash and the power of two mask
+    uint64_t seed = 1;
+    for (int i = 0; i < 100000; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        int64_t key = (int64_t)((seed >> 40) % 4096) * 1024 - 100000;
+        if ((seed >> 32) % 3 == 0)
+            REQUIRE(hashmap.erase(key) == reference.erase(key));
+        else
+        {
+            hashmap[key] = i;
+            reference[key] = i;
+        }
+    }
+
+    REQUIRE(hashmap.size() == reference.size());
+    for (const auto& item : reference)
+    {
+        auto it = hashmap.find(item.first);
+        REQUIRE(it != hashmap.end());
+        REQUIRE(it->second == item.second);
+    }
+
+    size_t count = 0;
+    const auto& constmap = hashmap;
+    for (auto it = constmap.begin(); it != constmap.end(); ++it, ++count)
+        REQUIRE(reference[it->first] == it->second);
+    REQUIRE(count == reference.size());
+
+    IntegerHashMap<int64_t, int> copy(hashmap);
+    copy.rehash(1 << 16);
+    REQUIRE(copy.size() == hashmap.size());
+    for (const auto& item : reference)
+        REQUIRE(copy.at(item.first) == item.second);
+}
@@ -0,0 +1,117 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/linked_hashmap.h"
+
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace CppCommon;
+
+TEST_CASE("Linked hash map", "[CppCommon][Containers]")
+{
+    LinkedHashMap<int, std::string> hashmap;
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.begin() == hashmap.end());
+
+    REQUIRE(hashmap.insert(std::make_pair(1, "1")).second);
+    REQUIRE(hashmap.emplace(2, "2").second);
+    REQUIRE(!hashmap.emplace(2, "22").second);
+    hashmap[3] = "3";
+    REQUIRE(hashmap.size() == 3);
+    REQUIRE(hashmap.at(2) == "2");
+    REQUIRE_THROWS_AS(hashmap.at(4), std::out_of_range);
+    REQUIRE(hashmap.oldest().first == 1);
+    REQUIRE(hashmap.newest().first == 3);
+
+    // Touch items to change the access order
+    REQUIRE(hashmap.touch(1)->first == 1);
+    REQUIRE(hashmap.touch(4) == hashmap.end());
+    hashmap.touch(hashmap.find(2));
+    std::string order;
+    for (const auto& item : hashmap)
+        order += item.second;
+    REQUIRE(order == "312");
+    order.clear();
+    for (auto it = hashmap.rbegin(); it != hashmap.rend(); ++it)
+        order += it->second;
+    REQUIRE(order == "213");
+
+    // Pop the oldest and the newest items
+    auto oldest = hashmap.pop_oldest();
+    REQUIRE(oldest.first == 3);
+    REQUIRE(oldest.second == "3");
+    auto newest = hashmap.pop_newest();
+    REQUIRE(newest.first == 2);
+    REQUIRE(hashmap.size() == 1);
+    REQUIRE(!hashmap.contains(3));
+
+    // Erase by the iterator
+    auto it = hashmap.erase(hashmap.begin());
+    REQUIRE(it == hashmap.end());
+    REQUIRE(hashmap.empty());
+
+    hashmap[5] = "5";
+    hashmap.clear();
+    REQUIRE(hashmap.empty());
+    REQUIRE(hashmap.count(5) == 0);
+}
+
+TEST_CASE("Linked hash map LRU", "[CppCommon][Containers]")
+{
+    const size_t capacity = 1000;
+
+    // Compare with the reference LRU cache of std::list and std::unordered_map
+    LinkedHashMap<int, int> lru;
+    std::list<std::pair<int, int>> order;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+
+    std::mt19937 generator(12345);
+    for (int i = 0; i < 100000; ++i)
+    {
+        int key = (int)(generator() % 3000);
+        auto found = index.find(key);
+        auto touched = lru.touch(key);
+        REQUIRE((touched != lru.end()) == (found != index.end()));
+        if (found != index.end())
+        {
+            REQUIRE(touched->second == found->second->second);
+            order.splice(order.end(), order, found->second);
+            continue;
+        }
+
+        if (lru.size() == capacity)
+        {
+            auto evicted = lru.pop_oldest();
+            REQUIRE(evicted == order.front());
+            index.erase(order.front().first);
+            order.pop_front();
+        }
+
+        lru.emplace(key, i);
+        order.emplace_back(key, i);
+        index[key] = std::prev(order.end());
+
+        if ((generator() % 10) == 0)
+        {
+            int removed = (int)(generator() % 3000);
+            auto item = index.find(removed);
+            REQUIRE(lru.erase(removed) == ((item != index.end()) ? 1 : 0));
+            if (item != index.end())
+            {
+                order.erase(item->second);
+                index.erase(item);
+            }
+        }
+    }
+
+    REQUIRE(lru.size() == order.size());
+    auto expected = order.begin();
+    for (const auto& item : lru)
+        REQUIRE(item == *expected++);
+}
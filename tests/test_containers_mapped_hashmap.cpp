@@ -0,0 +1,120 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/mapped_hashmap.h"
+
+#include <random>
+#include <unordered_map>
+
+using namespace CppCommon;
+
+namespace {
+
+template <MappedHashMapLayout layout>
+void TestMappedHashMap()
+{
+    std::unordered_map<uint64_t, uint32_t> expected;
+    MappedHashMapBuilder<uint64_t, uint32_t> builder(123);
+    std::mt19937_64 generator(12345);
+    while (expected.size() < 10000)
+    {
+        uint64_t key = generator();
+        if (expected.emplace(key, (uint32_t)expected.size()).second)
+            builder.insert(key, (uint32_t)(expected.size() - 1));
+    }
+    REQUIRE(builder.size() == 10000);
+
+    std::vector<uint8_t> image = builder.Build(layout);
+    MappedHashMap<uint64_t, uint32_t> hashmap(image, true);
+    REQUIRE(hashmap);
+    REQUIRE(hashmap.layout() == layout);
+    REQUIRE(hashmap.size() == 10000);
+    if (layout == MappedHashMapLayout::PERFECT)
+        REQUIRE(hashmap.bucket_count() == 10000);
+
+    // Lookup all existing and some missing keys
+    for (const auto& item : expected)
+    {
+        auto it = hashmap.find(item.first);
+        REQUIRE(it != hashmap.end());
+        REQUIRE(it->first == item.first);
+        REQUIRE(hashmap.at(item.first) == item.second);
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        uint64_t key = generator();
+        REQUIRE(hashmap.contains(key) == (expected.count(key) > 0));
+    }
+    REQUIRE_THROWS_AS(hashmap.at(generator()), std::out_of_range);
+
+    // Iterate through all items
+    size_t count = 0;
+    for (const auto& item : hashmap)
+    {
+        REQUIRE(expected.at(item.first) == item.second);
+        ++count;
+    }
+    REQUIRE(count == 10000);
+
+    // Duplicate keys
+    builder.insert(expected.begin()->first, 0);
+    REQUIRE_THROWS_AS(builder.Build(layout), ArgumentException);
+
+    // Empty hash map
+    MappedHashMapBuilder<uint64_t, uint32_t> empty;
+    std::vector<uint8_t> empty_image = empty.Build(layout);
+    MappedHashMap<uint64_t, uint32_t> empty_hashmap(empty_image, true);
+    REQUIRE(empty_hashmap.empty());
+    REQUIRE(empty_hashmap.begin() == empty_hashmap.end());
+    REQUIRE(!empty_hashmap.contains(0));
+}
+
+} // namespace
+
+TEST_CASE("Memory-mapped hash map", "[CppCommon][Containers]")
+{
+    TestMappedHashMap<MappedHashMapLayout::OPEN_ADDRESSING>();
+}
+
+TEST_CASE("Memory-mapped perfect hash map", "[CppCommon][Containers]")
+{
+    TestMappedHashMap<MappedHashMapLayout::PERFECT>();
+}
+
+TEST_CASE("Memory-mapped hash map file", "[CppCommon][Containers]")
+{
+    MappedHashMapBuilder<uint32_t, double> builder;
+    for (uint32_t i = 0; i < 1000; ++i)
+        builder.insert(i, i / 10.0);
+    builder.Save("test.hashmap", MappedHashMapLayout::PERFECT);
+
+    // Open the hash map file
+    MappedHashMap<uint32_t, double> hashmap("test.hashmap", true);
+    REQUIRE(hashmap.size() == 1000);
+    REQUIRE(hashmap.at(500) == 50.0);
+    REQUIRE(!hashmap.contains(1000));
+
+    // Move the hash map
+    MappedHashMap<uint32_t, double> moved(std::move(hashmap));
+    REQUIRE(!hashmap);
+    REQUIRE(moved.at(999) == 99.9);
+    moved.Close();
+    REQUIRE(!moved);
+
+    // Different key/value types
+    REQUIRE_THROWS_AS((MappedHashMap<uint64_t, double>("test.hashmap")), FileSystemException);
+
+    // Corrupted hash map file
+    std::vector<uint8_t> image = File::ReadAllBytes("test.hashmap");
+    image[image.size() - 1] ^= 0xFF;
+    REQUIRE_NOTHROW(MappedHashMap<uint32_t, double>(image));
+    REQUIRE_THROWS_AS((MappedHashMap<uint32_t, double>(image, true)), ArgumentException);
+    image[8] ^= 0xFF;
+    REQUIRE_THROWS_AS((MappedHashMap<uint32_t, double>(image)), ArgumentException);
+    REQUIRE_THROWS_AS((MappedHashMap<uint32_t, double>(std::span<const uint8_t>(image.data(), 16))), ArgumentException);
+
+    File::Remove("test.hashmap");
+}
@@ -0,0 +1,152 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/bintree_avl.h"
+#include "containers/bintree_rb.h"
+#include "containers/list.h"
+#include "containers/owning_container.h"
+#include "containers/queue.h"
+#include "containers/stack.h"
+#include "memory/allocator_arena.h"
+#include "memory/allocator_pool.h"
+
+using namespace CppCommon;
+
+namespace {
+
+int destroyed = 0;
+
+struct MyListNode : public List<MyListNode>::Node
+{
+    int value;
+
+    explicit MyListNode(int v) : value(v) {}
+};
+
+struct MyCountedNode : public List<MyCountedNode>::Node
+{
+    int value;
+
+    explicit MyCountedNode(int v) : value(v) {}
+    ~MyCountedNode() { ++destroyed; }
+};
+
+struct MyTreeNode : public BinTreeRB<MyTreeNode>::Node
+{
+    int value;
+    signed char balance;
+
+    explicit MyTreeNode(int v) : value(v) {}
+    ~MyTreeNode() { ++destroyed; }
+    friend bool operator<(const MyTreeNode& node1, const MyTreeNode& node2) { return node1.value < node2.value; }
+};
+
+} // namespace
+
+TEST_CASE("Owning intrusive list with arena memory manager", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary, 1024);
+
+    OwningContainer<List<MyListNode>, ArenaMemoryManager<DefaultMemoryManager>> list(arena);
+    for (int i = 0; i < 1000; ++i)
+        list.push_back(*list.create(i));
+    REQUIRE(list.size() == 1000);
+    REQUIRE(arena.allocations() == 1000);
+
+    int expected = 0;
+    for (auto& node : list)
+        REQUIRE(node.value == expected++);
+
+    // Released node memory is returned to the memory manager
+    list.release(list.pop_front());
+    REQUIRE(list.size() == 999);
+    REQUIRE(arena.allocations() == 999);
+
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(arena.allocated() == 0);
+    REQUIRE(arena.allocations() == 0);
+
+    // Container is ready for new nodes after clear
+    list.push_back(*list.create(1));
+    REQUIRE(list.size() == 1);
+    REQUIRE(arena.allocations() == 1);
+}
+
+TEST_CASE("Owning intrusive queue and stack with pool memory manager", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> pool(auxiliary, 4096);
+
+    destroyed = 0;
+    {
+        OwningContainer<Queue<MyCountedNode>, PoolMemoryManager<DefaultMemoryManager>> queue(pool);
+        for (int i = 0; i < 1000; ++i)
+            queue.push(*queue.create(i));
+        REQUIRE(queue.size() == 1000);
+        REQUIRE(queue.front()->value == 0);
+        REQUIRE(pool.allocations() == 1000);
+
+        queue.clear();
+        REQUIRE(queue.empty());
+        REQUIRE(destroyed == 1000);
+        REQUIRE(pool.allocations() == 0);
+
+        for (int i = 0; i < 10; ++i)
+            queue.push(*queue.create(i));
+    }
+    REQUIRE(destroyed == 1010);
+    REQUIRE(pool.allocations() == 0);
+
+    destroyed = 0;
+    {
+        OwningContainer<Stack<MyCountedNode>, PoolMemoryManager<DefaultMemoryManager>> stack(pool);
+        for (int i = 0; i < 1000; ++i)
+            stack.push(*stack.create(i));
+        REQUIRE(stack.size() == 1000);
+        REQUIRE(stack.top()->value == 999);
+        stack.release(stack.pop());
+        REQUIRE(destroyed == 1);
+    }
+    REQUIRE(destroyed == 1000);
+    REQUIRE(pool.allocations() == 0);
+}
+
+TEST_CASE("Owning intrusive binary trees with arena memory manager", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary, 1024);
+
+    destroyed = 0;
+    {
+        OwningContainer<BinTreeRB<MyTreeNode>, ArenaMemoryManager<DefaultMemoryManager>> bintree(arena);
+        for (int i = 0; i < 1000; ++i)
+            bintree.insert(*bintree.create((i * 7919) % 1000));
+        REQUIRE(bintree.size() == 1000);
+        REQUIRE(bintree.lowest()->value == 0);
+        REQUIRE(bintree.highest()->value == 999);
+
+        bintree.release(bintree.erase(MyTreeNode(500)));
+        REQUIRE(bintree.size() == 999);
+        REQUIRE(destroyed == 2);
+
+        bintree.clear();
+        REQUIRE(bintree.empty());
+        REQUIRE(destroyed == 1001);
+        REQUIRE(arena.allocations() == 0);
+    }
+
+    destroyed = 0;
+    {
+        OwningContainer<BinTreeAVL<MyTreeNode>, ArenaMemoryManager<DefaultMemoryManager>> bintree(arena);
+        for (int i = 0; i < 1000; ++i)
+            bintree.insert(*bintree.create(i));
+        REQUIRE(bintree.size() == 1000);
+    }
+    REQUIRE(destroyed == 1000);
+    REQUIRE(arena.allocations() == 0);
+}
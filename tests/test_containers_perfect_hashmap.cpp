@@ -0,0 +1,95 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/perfect_hashmap.h"
+
+#include <memory>
+#include <string>
+
+using namespace CppCommon;
+
+namespace {
+
+constexpr std::pair<std::string_view, int> headers[] =
+{
+    { "Accept", 1 }, { "Accept-Encoding", 2 }, { "Accept-Language", 3 }, { "Authorization", 4 },
+    { "Cache-Control", 5 }, { "Connection", 6 }, { "Content-Encoding", 7 }, { "Content-Length", 8 },
+    { "Content-Type", 9 }, { "Cookie", 10 }, { "Date", 11 }, { "ETag", 12 },
+    { "Expires", 13 }, { "Host", 14 }, { "If-Modified-Since", 15 }, { "If-None-Match", 16 },
+    { "Last-Modified", 17 }, { "Location", 18 }, { "Origin", 19 }, { "Pragma", 20 },
+    { "Range", 21 }, { "Referer", 22 }, { "Server", 23 }, { "Set-Cookie", 24 },
+    { "Transfer-Encoding", 25 }, { "Upgrade", 26 }, { "User-Agent", 27 }, { "Vary", 28 },
+    { "Via", 29 }, { "WWW-Authenticate", 30 }
+};
+
+// Built at compile time
+constexpr PerfectHashMap<std::string_view, int, std::size(headers)> map(headers);
+
+static_assert(map.size() == 30);
+static_assert(map.at("Host") == 14);
+static_assert(map.contains("Via"));
+static_assert(!map.contains("host"));
+static_assert(!map.contains(""));
+
+}
+
+TEST_CASE("Perfect hash map", "[CppCommon][Containers]")
+{
+    REQUIRE(map.size() == std::size(headers));
+    REQUIRE(map.bucket_count() >= map.size());
+
+    // All keys are found at runtime
+    for (const auto& header : headers)
+    {
+        std::string key(header.first);
+        auto it = map.find(key);
+        REQUIRE(it != map.end());
+        REQUIRE(it->first == header.first);
+        REQUIRE(it->second == header.second);
+        REQUIRE(map.at(key) == header.second);
+        REQUIRE(map.count(key) == 1);
+    }
+
+    // Missing keys are not found
+    for (std::string_view key : { "accept", "Accept ", "X-Forwarded-For", "Content", "Hos" })
+    {
+        REQUIRE(map.find(key) == map.end());
+        REQUIRE(!map.contains(key));
+    }
+    REQUIRE_THROWS_AS(map.at("Unknown"), std::out_of_range);
+
+    // Items are iterated in the build order
+    size_t index = 0;
+    for (const auto& item : map)
+        REQUIRE(item == headers[index++]);
+    REQUIRE(index == map.size());
+
+    // Integer keys
+    constexpr auto codes = MakePerfectHashMap<int, std::string_view>({ { 200, "OK" }, { 301, "Moved Permanently" }, { 404, "Not Found" }, { 500, "Internal Server Error" } });
+    static_assert(codes.at(404) == "Not Found");
+    REQUIRE(codes.at(200) == "OK");
+    REQUIRE(!codes.contains(201));
+}
+
+TEST_CASE("Perfect hash map runtime build", "[CppCommon][Containers]")
+{
+    static std::pair<int, int> items[10000];
+    for (int i = 0; i < 10000; ++i)
+        items[i] = std::make_pair(i * 7 + 3, i);
+
+    typedef PerfectHashMap<int, int, 10000> IntegerMap;
+
+    auto map = std::make_unique<IntegerMap>(items);
+    for (int i = 0; i < 10000; ++i)
+        REQUIRE(map->at(i * 7 + 3) == i);
+    for (int key = 0; key < 70000; ++key)
+        if ((key % 7) != 3)
+            REQUIRE(!map->contains(key));
+
+    // Duplicate keys are rejected
+    items[5000].first = items[10].first;
+    REQUIRE_THROWS_AS(std::make_unique<IntegerMap>(items), std::invalid_argument);
+}
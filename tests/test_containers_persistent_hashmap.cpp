@@ -0,0 +1,196 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/persistent_hashmap.h"
+
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+// Weak hash to force hash collisions and deep tries
+struct WeakHash
+{
+    size_t operator()(int key) const noexcept { return (size_t)(key % 7); }
+};
+
+} // namespace
+
+TEST_CASE("Persistent hash map", "[CppCommon][Containers]")
+{
+    PersistentHashMap<int, std::string> empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.begin() == empty.end());
+    REQUIRE(empty.find(1) == empty.end());
+
+    auto hashmap1 = empty.set(1, "1").set(2, "2").set(3, "3");
+    auto hashmap2 = hashmap1.set(2, "22").erase(3).set(4, "4");
+
+    // Previous versions stay unchanged
+    REQUIRE(empty.empty());
+    REQUIRE(hashmap1.size() == 3);
+    REQUIRE(hashmap1.at(2) == "2");
+    REQUIRE(hashmap1.contains(3));
+    REQUIRE(!hashmap1.contains(4));
+    REQUIRE(hashmap2.size() == 3);
+    REQUIRE(hashmap2.at(2) == "22");
+    REQUIRE(!hashmap2.contains(3));
+    REQUIRE(hashmap2.find(4)->second == "4");
+    REQUIRE_THROWS_AS(hashmap2.at(3), std::out_of_range);
+
+    // Erase of the missing key keeps the same version
+    REQUIRE(hashmap2.erase(5).same(hashmap2));
+
+    std::string items;
+    for (const auto& item : hashmap1)
+        items += item.second;
+    REQUIRE(items.size() == 3);
+}
+
+TEST_CASE("Persistent hash map random test", "[CppCommon][Containers]")
+{
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> keys(0, 5000);
+
+    std::unordered_map<int, int> expected;
+    std::vector<std::pair<PersistentHashMap<int, int>, std::unordered_map<int, int>>> versions;
+    PersistentHashMap<int, int> hashmap;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        int key = keys(generator);
+        if ((i % 3) == 0)
+        {
+            hashmap = hashmap.erase(key);
+            expected.erase(key);
+        }
+        else
+        {
+            hashmap = hashmap.set(key, i);
+            expected[key] = i;
+        }
+        if ((i % 2000) == 0)
+            versions.emplace_back(hashmap, expected);
+    }
+    versions.emplace_back(hashmap, expected);
+
+    // Every snapshot must contain exactly its own items
+    for (const auto& version : versions)
+    {
+        REQUIRE(version.first.size() == version.second.size());
+        size_t count = 0;
+        for (const auto& item : version.first)
+        {
+            REQUIRE(version.second.at(item.first) == item.second);
+            ++count;
+        }
+        REQUIRE(count == version.second.size());
+        for (const auto& item : version.second)
+        {
+            auto it = version.first.find(item.first);
+            REQUIRE(it != version.first.end());
+            REQUIRE(it->second == item.second);
+        }
+    }
+}
+
+TEST_CASE("Persistent hash map collisions", "[CppCommon][Containers]")
+{
+    PersistentHashMap<int, int, WeakHash> hashmap;
+    for (int i = 0; i < 100; ++i)
+        hashmap = std::move(hashmap).set(i, i * 10);
+    REQUIRE(hashmap.size() == 100);
+    REQUIRE(hashmap.at(42) == 420);
+
+    // Iteration continues from the found item
+    size_t count = 0;
+    for (auto it = hashmap.begin(); it != hashmap.end(); ++it)
+        ++count;
+    REQUIRE(count == 100);
+    count = 0;
+    for (auto it = hashmap.find(hashmap.begin()->first); it != hashmap.end(); ++it)
+        ++count;
+    REQUIRE(count == 100);
+
+    for (int i = 0; i < 100; i += 2)
+        hashmap = hashmap.erase(i);
+    REQUIRE(hashmap.size() == 50);
+    REQUIRE(!hashmap.contains(42));
+    REQUIRE(hashmap.at(43) == 430);
+}
+
+TEST_CASE("Persistent hash map transient", "[CppCommon][Containers]")
+{
+    PersistentHashMap<int, int> base = PersistentHashMap<int, int>().set(1, 1).set(2, 2);
+
+    auto transient = base.transient();
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(transient.set(i, i) == ((i == 0) || (i > 2)));
+    REQUIRE(!transient.set(1, 10));
+    REQUIRE(transient.erase(0));
+    REQUIRE(!transient.erase(0));
+
+    auto snapshot = transient.persistent();
+    REQUIRE(transient.erase(1));
+    REQUIRE(transient.set(5, 50) == false);
+
+    REQUIRE(base.size() == 2);
+    REQUIRE(base.at(1) == 1);
+    REQUIRE(snapshot.size() == 999);
+    REQUIRE(snapshot.at(1) == 10);
+    REQUIRE(snapshot.at(5) == 5);
+    REQUIRE(transient.size() == 998);
+    REQUIRE(!transient.contains(1));
+    REQUIRE(transient.at(5) == 50);
+}
+
+TEST_CASE("Atomic persistent hash map", "[CppCommon][Containers]")
+{
+    AtomicPersistentHashMap<int, int> hashmap;
+
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t)
+    {
+        writers.emplace_back([&hashmap, t]()
+        {
+            for (int i = 0; i < 500; ++i)
+                hashmap.update([t, i](const PersistentHashMap<int, int>& current) { return current.set(t * 1000 + i, i); });
+        });
+    }
+
+    // Readers see consistent snapshots
+    std::thread reader([&hashmap, &failed]()
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto snapshot = hashmap.load();
+            size_t count = 0;
+            for (auto it = snapshot.begin(); it != snapshot.end(); ++it)
+                ++count;
+            if (count != snapshot.size())
+                failed = true;
+        }
+    });
+
+    for (auto& writer : writers)
+        writer.join();
+    reader.join();
+
+    REQUIRE(!failed);
+    auto result = hashmap.load();
+    REQUIRE(result.size() == 2000);
+    REQUIRE(result.at(3499) == 499);
+
+    hashmap.store(PersistentHashMap<int, int>());
+    REQUIRE(hashmap.load().empty());
+}
@@ -0,0 +1,157 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/radix_tree.h"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+void check(const RadixTree<int>& tree, const std::map<std::string, int>& reference)
+{
+    REQUIRE(tree.size() == reference.size());
+    REQUIRE(tree.empty() == reference.empty());
+
+    // Lexicographical iteration
+    auto it = reference.begin();
+    REQUIRE(tree.walk("", [&it](std::string_view key, const int& value)
+    {
+        REQUIRE(key == it->first);
+        REQUIRE(value == it->second);
+        ++it;
+        return true;
+    }));
+    REQUIRE(it == reference.end());
+
+    for (const auto& item : reference)
+    {
+        const int* value = tree.find(item.first);
+        REQUIRE(value != nullptr);
+        REQUIRE(*value == item.second);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Radix tree", "[CppCommon][Containers]")
+{
+    RadixTree<int> tree;
+    REQUIRE(tree.empty());
+    REQUIRE(tree.find("") == nullptr);
+
+    REQUIRE(tree.insert("romane", 1).second);
+    REQUIRE(tree.insert("romanus", 2).second);
+    REQUIRE(tree.insert("romulus", 3).second);
+    REQUIRE(tree.insert("rubens", 4).second);
+    REQUIRE(tree.insert("ruber", 5).second);
+    REQUIRE(tree.insert("rubicon", 6).second);
+    REQUIRE(tree.insert("rubicundus", 7).second);
+    REQUIRE(tree.insert("rom", 8).second);
+    REQUIRE(tree.insert("", 9).second);
+    REQUIRE(!tree.insert("ruber", 10).second);
+    REQUIRE(*tree.find("ruber") == 5);
+    REQUIRE(tree.size() == 9);
+
+    // Missing keys and inner prefixes
+    REQUIRE(tree.find("r") == nullptr);
+    REQUIRE(tree.find("roman") == nullptr);
+    REQUIRE(tree.find("romanes") == nullptr);
+    REQUIRE(*tree.find("rom") == 8);
+    REQUIRE(*tree.find("") == 9);
+
+    // Erase keys and merge nodes
+    REQUIRE(!tree.erase("roman"));
+    REQUIRE(tree.erase("romane"));
+    REQUIRE(tree.erase("rom"));
+    REQUIRE(tree.find("romanus") != nullptr);
+    REQUIRE(tree.find("romane") == nullptr);
+    REQUIRE(tree.size() == 7);
+
+    tree.clear();
+    REQUIRE(tree.empty());
+    REQUIRE(tree.nodes() == 0);
+}
+
+TEST_CASE("Radix tree prefixes", "[CppCommon][Containers]")
+{
+    RadixTree<int> tree;
+    tree.insert("/", 1);
+    tree.insert("/api", 2);
+    tree.insert("/api/users", 3);
+    tree.insert("/static/css/main.css", 4);
+    tree.insert("/static/css/print.css", 5);
+    tree.insert("/static/js/main.js", 6);
+
+    // Longest prefix match
+    auto match = tree.longest_prefix("/api/users/42");
+    REQUIRE(match.first == "/api/users");
+    REQUIRE(*match.second == 3);
+    match = tree.longest_prefix("/api/items");
+    REQUIRE(match.first == "/api");
+    REQUIRE(*match.second == 2);
+    match = tree.longest_prefix("/about");
+    REQUIRE(match.first == "/");
+    REQUIRE(tree.longest_prefix("about").second == nullptr);
+
+    // Walk the virtual directory
+    std::vector<std::string> keys;
+    tree.walk("/static/", [&keys](std::string_view key, int&) { keys.emplace_back(key); return true; });
+    REQUIRE(keys == std::vector<std::string>({ "/static/css/main.css", "/static/css/print.css", "/static/js/main.js" }));
+    keys.clear();
+    tree.walk("/static/c", [&keys](std::string_view key, int&) { keys.emplace_back(key); return false; });
+    REQUIRE(keys == std::vector<std::string>({ "/static/css/main.css" }));
+    REQUIRE(tree.walk("/missing", [](std::string_view, int&) { return false; }));
+
+    // Erase the virtual directory
+    REQUIRE(tree.erase_prefix("/static/css") == 2);
+    REQUIRE(tree.find("/static/css/main.css") == nullptr);
+    REQUIRE(*tree.find("/static/js/main.js") == 6);
+    REQUIRE(tree.erase_prefix("/missing") == 0);
+    REQUIRE(tree.size() == 4);
+    REQUIRE(tree.erase_prefix("") == 4);
+    REQUIRE(tree.empty());
+}
+
+TEST_CASE("Radix tree random", "[CppCommon][Containers]")
+{
+    std::mt19937 generator(42);
+    RadixTree<int> tree;
+    std::map<std::string, int> reference;
+
+    // Random keys over the small alphabet to produce many shared prefixes
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::string key(generator() % 8, 'a');
+        for (auto& ch : key)
+            ch = (char)('a' + generator() % 3);
+        if (generator() % 3)
+        {
+            bool inserted = reference.emplace(key, i).second;
+            REQUIRE(tree.insert(key, i).second == inserted);
+        }
+        else
+            REQUIRE(tree.erase(key) == (reference.erase(key) > 0));
+    }
+    check(tree, reference);
+
+    // Erase random prefixes
+    for (const auto& prefix : { "ab", "c", "bba" })
+    {
+        size_t count = 0;
+        for (auto it = reference.lower_bound(prefix); (it != reference.end()) && (it->first.compare(0, std::string(prefix).size(), prefix) == 0);)
+        {
+            it = reference.erase(it);
+            ++count;
+        }
+        REQUIRE(tree.erase_prefix(prefix) == count);
+    }
+    check(tree, reference);
+}
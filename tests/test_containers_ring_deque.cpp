@@ -0,0 +1,136 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/ring_deque.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct MyMessage
+{
+    int id;
+    double price;
+};
+
+} // namespace
+
+TEST_CASE("Ring deque", "[CppCommon][Containers]")
+{
+    RingDeque<MyMessage> deque(3);
+    REQUIRE(deque.empty());
+    REQUIRE(deque.size() == 0);
+    REQUIRE(deque.capacity() == 4);
+    REQUIRE(deque.begin() == deque.end());
+
+    size_t index1 = deque.push_back({ 1, 1.0 });
+    size_t index2 = deque.push_back({ 2, 2.0 });
+    size_t index0 = deque.push_front({ 0, 0.0 });
+    REQUIRE(deque.size() == 3);
+    REQUIRE(deque.front().id == 0);
+    REQUIRE(deque.back().id == 2);
+    REQUIRE(deque.head() == index0);
+    REQUIRE(deque.tail() == index2 + 1);
+    REQUIRE(deque[1].id == 1);
+    REQUIRE(deque.at(2).id == 2);
+    REQUIRE_THROWS_AS(deque.at(3), std::out_of_range);
+
+    // Stable indices survive the buffer growth
+    for (int i = 3; i < 100; ++i)
+        deque.push_back({ i, (double)i });
+    REQUIRE(deque.size() == 100);
+    REQUIRE(deque.capacity() == 128);
+    REQUIRE(deque.slot(index0).id == 0);
+    REQUIRE(deque.slot(index1).id == 1);
+    REQUIRE(deque.slot(index2).id == 2);
+
+    int expected = 0;
+    for (const auto& item : deque)
+        REQUIRE(item.id == expected++);
+    REQUIRE(expected == 100);
+    for (auto it = deque.rbegin(); it != deque.rend(); ++it)
+        REQUIRE(it->id == --expected);
+    REQUIRE((deque.end() - deque.begin()) == 100);
+    REQUIRE(std::lower_bound(deque.begin(), deque.end(), 42, [](const MyMessage& item, int id) { return item.id < id; })->id == 42);
+
+    deque.pop_front();
+    deque.pop_back();
+    REQUIRE(!deque.valid(index0));
+    REQUIRE(deque.valid(index1));
+    REQUIRE(deque.front().id == 1);
+    REQUIRE(deque.back().id == 98);
+
+    RingDeque<MyMessage> copy(deque);
+    REQUIRE(copy.size() == 98);
+    REQUIRE(copy.slot(index1).id == 1);
+
+    deque.clear();
+    REQUIRE(deque.empty());
+    REQUIRE(deque.capacity() == 128);
+    REQUIRE(!deque.valid(index1));
+
+    RingDeque<MyMessage> moved(std::move(copy));
+    REQUIRE(moved.size() == 98);
+    REQUIRE(copy.empty());
+    copy.push_back({ 7, 7.0 });
+    REQUIRE(copy.front().id == 7);
+}
+
+TEST_CASE("Ring deque bulk operations", "[CppCommon][Containers]")
+{
+    RingDeque<int> deque(8);
+    std::deque<int> expected;
+
+    std::vector<int> items(100);
+    std::vector<int> popped(100);
+
+    // Push and pop random spans of items wrapping around the buffer
+    uint64_t seed = 1;
+    int value = 0;
+    for (int i = 0; i < 10000; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        size_t count = (size_t)((seed >> 33) % 40);
+        if (((seed >> 32) & 1) != 0)
+        {
+            for (size_t j = 0; j < count; ++j)
+            {
+                items[j] = value++;
+                expected.push_back(items[j]);
+            }
+            size_t index = deque.push_back(items.data(), count);
+            REQUIRE(index + count == deque.tail());
+        }
+        else if (((seed >> 31) & 1) != 0)
+        {
+            size_t result = deque.pop_front(popped.data(), count);
+            REQUIRE(result == std::min(count, expected.size()));
+            for (size_t j = 0; j < result; ++j)
+            {
+                REQUIRE(popped[j] == expected.front());
+                expected.pop_front();
+            }
+        }
+        else
+        {
+            size_t result = deque.skip_front(count);
+            REQUIRE(result == std::min(count, expected.size()));
+            expected.erase(expected.begin(), expected.begin() + result);
+        }
+
+        REQUIRE(deque.size() == expected.size());
+        if (!expected.empty())
+        {
+            REQUIRE(deque.front() == expected.front());
+            REQUIRE(deque.back() == expected.back());
+        }
+    }
+    REQUIRE(std::equal(deque.begin(), deque.end(), expected.begin(), expected.end()));
+}
@@ -0,0 +1,210 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/roaring_bitmap.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+RoaringBitmap Generate(std::mt19937& generator, std::set<uint32_t>& values, size_t count, uint32_t range)
+{
+    RoaringBitmap result;
+    std::uniform_int_distribution<uint32_t> distribution(0, range);
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t value = distribution(generator);
+        REQUIRE(result.add(value) == values.insert(value).second);
+    }
+    return result;
+}
+
+bool Equal(const RoaringBitmap& bitmap, const std::set<uint32_t>& values)
+{
+    return (bitmap.cardinality() == values.size()) && std::equal(bitmap.begin(), bitmap.end(), values.begin(), values.end());
+}
+
+} // namespace
+
+TEST_CASE("Roaring bitmap", "[CppCommon][Containers]")
+{
+    RoaringBitmap bitmap;
+    REQUIRE(bitmap.empty());
+    REQUIRE(bitmap.cardinality() == 0);
+    REQUIRE(bitmap.begin() == bitmap.end());
+
+    REQUIRE(bitmap.add(5));
+    REQUIRE(bitmap.add(1));
+    REQUIRE(bitmap.add(0x10000));
+    REQUIRE(bitmap.add(0xFFFFFFFF));
+    REQUIRE(!bitmap.add(5));
+    REQUIRE(bitmap.cardinality() == 4);
+    REQUIRE(bitmap.containers() == 3);
+    REQUIRE(bitmap.minimum() == 1);
+    REQUIRE(bitmap.maximum() == 0xFFFFFFFF);
+    REQUIRE(bitmap.contains(5));
+    REQUIRE(!bitmap.contains(6));
+    REQUIRE(std::vector<uint32_t>(bitmap.begin(), bitmap.end()) == std::vector<uint32_t>({ 1, 5, 0x10000, 0xFFFFFFFF }));
+
+    REQUIRE(bitmap.remove(0x10000));
+    REQUIRE(!bitmap.remove(0x10000));
+    REQUIRE(bitmap.containers() == 2);
+    REQUIRE(bitmap == RoaringBitmap({ 1, 5, 0xFFFFFFFF }));
+    REQUIRE(bitmap != RoaringBitmap({ 1, 5 }));
+
+    // Dense chunk converts into the bitmap container and back
+    for (uint32_t i = 0; i < 10000; ++i)
+        bitmap.add(i * 2);
+    REQUIRE(bitmap.cardinality() == 10003);
+    REQUIRE(bitmap.contains(19998));
+    REQUIRE(!bitmap.contains(19999));
+    for (uint32_t i = 0; i < 10000; ++i)
+        bitmap.remove(i * 2);
+    REQUIRE(bitmap == RoaringBitmap({ 1, 5, 0xFFFFFFFF }));
+
+    bitmap.clear();
+    REQUIRE(bitmap.empty());
+}
+
+TEST_CASE("Roaring bitmap set operations", "[CppCommon][Containers]")
+{
+    std::mt19937 generator(1);
+
+    // Sparse, dense and mixed chunks
+    for (size_t count : { 100, 5000, 50000, 300000 })
+    {
+        std::set<uint32_t> values1;
+        std::set<uint32_t> values2;
+        RoaringBitmap bitmap1 = Generate(generator, values1, count, 0x3FFFF);
+        RoaringBitmap bitmap2 = Generate(generator, values2, count / 2, 0x5FFFF);
+        REQUIRE(Equal(bitmap1, values1));
+        REQUIRE(Equal(bitmap2, values2));
+
+        std::set<uint32_t> expected;
+        std::set_intersection(values1.begin(), values1.end(), values2.begin(), values2.end(), std::inserter(expected, expected.end()));
+        REQUIRE(Equal(bitmap1 & bitmap2, expected));
+        REQUIRE(RoaringBitmap::and_cardinality(bitmap1, bitmap2) == expected.size());
+
+        expected.clear();
+        std::set_union(values1.begin(), values1.end(), values2.begin(), values2.end(), std::inserter(expected, expected.end()));
+        REQUIRE(Equal(bitmap1 | bitmap2, expected));
+
+        expected.clear();
+        std::set_symmetric_difference(values1.begin(), values1.end(), values2.begin(), values2.end(), std::inserter(expected, expected.end()));
+        REQUIRE(Equal(bitmap1 ^ bitmap2, expected));
+
+        expected.clear();
+        std::set_difference(values1.begin(), values1.end(), values2.begin(), values2.end(), std::inserter(expected, expected.end()));
+        REQUIRE(Equal(bitmap1 - bitmap2, expected));
+
+        RoaringBitmap bitmap = bitmap1;
+        bitmap -= bitmap2;
+        bitmap |= bitmap2;
+        REQUIRE(bitmap == (bitmap1 | bitmap2));
+        bitmap ^= bitmap2;
+        REQUIRE(bitmap == (bitmap1 - bitmap2));
+        bitmap &= bitmap2;
+        REQUIRE(bitmap.empty());
+    }
+}
+
+TEST_CASE("Roaring bitmap runs", "[CppCommon][Containers]")
+{
+    RoaringBitmap bitmap;
+    bitmap.add_range(10, 0x2000F);
+    bitmap.add_range(0x30000, 0x30005);
+    bitmap.add_range(0x30003, 0x30009);
+    REQUIRE(bitmap.cardinality() == (0x20006 + 10));
+    REQUIRE(bitmap.containers() == 4);
+    REQUIRE(bitmap.minimum() == 10);
+    REQUIRE(bitmap.maximum() == 0x30009);
+    REQUIRE(!bitmap.contains(9));
+    REQUIRE(bitmap.contains(0x1FFFF));
+    REQUIRE(!bitmap.contains(0x20010));
+
+    std::set<uint32_t> values;
+    for (uint32_t i = 10; i <= 0x2000F; ++i)
+        values.insert(i);
+    for (uint32_t i = 0x30000; i <= 0x30009; ++i)
+        values.insert(i);
+    REQUIRE(Equal(bitmap, values));
+
+    // Runs of every 100 values
+    RoaringBitmap sparse;
+    for (uint32_t i = 0; i < 20000; ++i)
+        if ((i % 200) < 100)
+            sparse.add(i);
+    RoaringBitmap optimized = sparse;
+    REQUIRE(optimized.run_optimize());
+    REQUIRE(!optimized.run_optimize());
+    REQUIRE(optimized == sparse);
+    REQUIRE(std::equal(optimized.begin(), optimized.end(), sparse.begin(), sparse.end()));
+    REQUIRE(optimized.serialized_size() < sparse.serialized_size());
+    REQUIRE((optimized & bitmap) == (sparse & bitmap));
+    REQUIRE((optimized | bitmap) == (sparse | bitmap));
+    REQUIRE(RoaringBitmap::and_cardinality(optimized, bitmap) == RoaringBitmap::and_cardinality(sparse, bitmap));
+
+    // Modification of the run container
+    REQUIRE(optimized.add(150));
+    REQUIRE(optimized.remove(0));
+    REQUIRE(sparse.add(150));
+    REQUIRE(sparse.remove(0));
+    REQUIRE(optimized == sparse);
+
+    // Full chunk
+    RoaringBitmap full;
+    full.add_range(0xFFFF0000, 0xFFFFFFFF);
+    REQUIRE(full.cardinality() == 65536);
+    REQUIRE(full.maximum() == 0xFFFFFFFF);
+    REQUIRE(std::distance(full.begin(), full.end()) == 65536);
+}
+
+TEST_CASE("Roaring bitmap serialization", "[CppCommon][Containers]")
+{
+    std::mt19937 generator(2);
+    std::set<uint32_t> values;
+    RoaringBitmap bitmap = Generate(generator, values, 100000, 0x7FFFF);
+    bitmap.add_range(0x100000, 0x10FFFF);
+    bitmap.add_range(0x200000, 0x200010);
+    bitmap.run_optimize();
+    for (uint32_t i = 0x100000; i <= 0x10FFFF; ++i)
+        values.insert(i);
+    for (uint32_t i = 0x200000; i <= 0x200010; ++i)
+        values.insert(i);
+
+    std::vector<uint8_t> buffer = bitmap.serialize();
+    REQUIRE(buffer.size() == bitmap.serialized_size());
+    REQUIRE((buffer.size() % 8) == 0);
+
+    RoaringBitmap deserialized = RoaringBitmap::deserialize(buffer.data(), buffer.size());
+    REQUIRE(deserialized == bitmap);
+    REQUIRE(Equal(deserialized, values));
+
+    RoaringBitmapView view(buffer.data(), buffer.size());
+    REQUIRE(!view.empty());
+    REQUIRE(view.cardinality() == values.size());
+    for (uint32_t i = 0; i < 0x210000; i += 7)
+        REQUIRE(view.contains(i) == (values.find(i) != values.end()));
+    REQUIRE(view.bitmap() == bitmap);
+
+    // Corrupted buffers
+    REQUIRE_THROWS_AS(RoaringBitmap::deserialize(buffer.data(), 4), std::invalid_argument);
+    REQUIRE_THROWS_AS(RoaringBitmapView(buffer.data(), buffer.size() - 8), std::invalid_argument);
+    buffer[0] ^= 0xFF;
+    REQUIRE_THROWS_AS(RoaringBitmap::deserialize(buffer.data(), buffer.size()), std::invalid_argument);
+
+    // Empty bitmap
+    RoaringBitmap empty;
+    std::vector<uint8_t> empty_buffer = empty.serialize();
+    REQUIRE(RoaringBitmapView(empty_buffer.data(), empty_buffer.size()).empty());
+    REQUIRE(RoaringBitmap::deserialize(empty_buffer.data(), empty_buffer.size()).empty());
+}
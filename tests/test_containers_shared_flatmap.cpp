@@ -0,0 +1,96 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/shared_flatmap.h"
+
+#include <map>
+#include <random>
+
+using namespace CppCommon;
+
+TEST_CASE("Shared flat map", "[CppCommon][Containers]")
+{
+    std::vector<uint64_t> region(4 * 1024 * 1024 / sizeof(uint64_t), 0);
+    SharedMemoryManager manager(region.data(), region.size() * sizeof(uint64_t));
+
+    SharedAllocator<SharedFlatMap<int, int>> alloc(manager);
+    SharedFlatMap<int, int>* flatmap = alloc.Create(manager, 16);
+    REQUIRE(flatmap->empty());
+    REQUIRE(flatmap->capacity() == 16);
+
+    REQUIRE(flatmap->insert(std::make_pair(3, 30)).second);
+    REQUIRE(flatmap->emplace(1, 10).second);
+    REQUIRE(!flatmap->emplace(1, 100).second);
+    (*flatmap)[2] = 20;
+    REQUIRE(flatmap->size() == 3);
+    REQUIRE(flatmap->begin()->first == 1);
+    REQUIRE(flatmap->find(2)->second == 20);
+    REQUIRE(flatmap->lower_bound(2)->first == 2);
+    REQUIRE(flatmap->upper_bound(2)->first == 3);
+    REQUIRE(flatmap->find(4) == flatmap->end());
+
+    // Compare with the standard container
+    std::map<int, int> expected = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+    std::mt19937 generator(12345);
+    for (int i = 0; i < 20000; ++i)
+    {
+        int key = (int)(generator() % 2000);
+        if ((generator() % 3) == 0)
+            REQUIRE(flatmap->erase(key) == expected.erase(key));
+        else
+            REQUIRE(flatmap->emplace(key, i).second == expected.emplace(key, i).second);
+    }
+    REQUIRE(flatmap->size() == expected.size());
+    auto it = expected.begin();
+    for (const auto& item : *flatmap)
+    {
+        REQUIRE(item.first == it->first);
+        REQUIRE(item.second == it->second);
+        ++it;
+    }
+
+    flatmap->shrink_to_fit();
+    REQUIRE(flatmap->capacity() == flatmap->size());
+    flatmap->clear();
+    REQUIRE(flatmap->empty());
+
+    alloc.Release(flatmap);
+    REQUIRE(manager.allocated() == 0);
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("Shared flat map in shared memory", "[CppCommon][Containers]")
+{
+    const char* name = "shared_flatmap_test";
+    size_t size = 4 * 1024 * 1024;
+
+    // Build the flat map in the first mapping of the shared memory block
+    SharedMemory shared1(name, size);
+    REQUIRE(shared1.owner());
+    SharedMemoryManager manager1(shared1);
+    auto flatmap1 = SharedAllocator<SharedFlatMap<uint64_t, double>>(manager1).Create(manager1);
+    flatmap1->reserve(10000);
+    for (uint64_t i = 10000; i > 0; --i)
+        flatmap1->emplace(i, i / 2.0);
+    manager1.set_root(flatmap1);
+
+    // Read the flat map from the second mapping at the different address
+    SharedMemory shared2(name, size);
+    REQUIRE(!shared2.owner());
+    REQUIRE(shared2.ptr() != shared1.ptr());
+    SharedMemoryManager manager2(shared2);
+    auto flatmap2 = (const SharedFlatMap<uint64_t, double>*)manager2.root();
+    REQUIRE(flatmap2 != nullptr);
+    REQUIRE(flatmap2->size() == 10000);
+    uint64_t key = 1;
+    for (const auto& item : *flatmap2)
+    {
+        REQUIRE(item.first == key);
+        REQUIRE(item.second == key / 2.0);
+        ++key;
+    }
+    REQUIRE(flatmap2->find(5000)->second == 2500.0);
+}
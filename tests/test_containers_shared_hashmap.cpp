@@ -0,0 +1,106 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/shared_hashmap.h"
+
+#include <map>
+#include <random>
+#include <unordered_map>
+
+using namespace CppCommon;
+
+TEST_CASE("Shared hash map", "[CppCommon][Containers]")
+{
+    std::vector<uint64_t> region(4 * 1024 * 1024 / sizeof(uint64_t), 0);
+    SharedMemoryManager manager(region.data(), region.size() * sizeof(uint64_t));
+
+    SharedAllocator<SharedHashMap<int, int>> alloc(manager);
+    SharedHashMap<int, int>* hashmap = alloc.Create(manager, 16);
+    REQUIRE(hashmap->empty());
+    REQUIRE(hashmap->bucket_count() == 16);
+
+    REQUIRE(hashmap->insert(std::make_pair(1, 10)).second);
+    REQUIRE(hashmap->emplace(2, 20).second);
+    REQUIRE(!hashmap->emplace(2, 200).second);
+    (*hashmap)[3] = 30;
+    REQUIRE(hashmap->size() == 3);
+    REQUIRE(hashmap->find(2)->second == 20);
+    REQUIRE(hashmap->contains(3));
+    REQUIRE(hashmap->count(4) == 0);
+    REQUIRE(hashmap->find(4) == hashmap->end());
+
+    // Compare with the standard container
+    std::unordered_map<int, int> expected = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+    std::mt19937 generator(12345);
+    for (int i = 0; i < 100000; ++i)
+    {
+        int key = (int)(generator() % 10000);
+        if ((generator() % 3) == 0)
+            REQUIRE(hashmap->erase(key) == expected.erase(key));
+        else
+            REQUIRE(hashmap->emplace(key, i).second == expected.emplace(key, i).second);
+    }
+    REQUIRE(hashmap->size() == expected.size());
+    size_t count = 0;
+    for (const auto& item : *hashmap)
+    {
+        REQUIRE(expected.at(item.first) == item.second);
+        ++count;
+    }
+    REQUIRE(count == expected.size());
+
+    // Erase all items by iterators
+    while (!hashmap->empty())
+        hashmap->erase(hashmap->begin());
+    REQUIRE(hashmap->begin() == hashmap->end());
+
+    hashmap->reserve(1000);
+    REQUIRE(hashmap->bucket_count() >= 2000);
+    hashmap->clear();
+
+    alloc.Release(hashmap);
+    REQUIRE(manager.allocated() == 0);
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("Shared hash map in shared memory", "[CppCommon][Containers]")
+{
+    const char* name = "shared_hashmap_test";
+    size_t size = 4 * 1024 * 1024;
+
+    // Build the hash map in the first mapping of the shared memory block
+    SharedMemory shared1(name, size);
+    REQUIRE(shared1.owner());
+    SharedMemoryManager manager1(shared1);
+    auto hashmap1 = SharedAllocator<SharedHashMap<uint64_t, uint64_t>>(manager1).Create(manager1);
+    for (uint64_t i = 0; i < 10000; ++i)
+        hashmap1->emplace(i, i * i);
+    manager1.set_root(hashmap1);
+
+    // Read the hash map from the second mapping at the different address
+    SharedMemory shared2(name, size);
+    REQUIRE(!shared2.owner());
+    REQUIRE(shared2.ptr() != shared1.ptr());
+    SharedMemoryManager manager2(shared2);
+    auto hashmap2 = (const SharedHashMap<uint64_t, uint64_t>*)manager2.root();
+    REQUIRE(hashmap2 != nullptr);
+    REQUIRE((const void*)hashmap2 != (const void*)hashmap1);
+    REQUIRE(hashmap2->size() == 10000);
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        auto it = hashmap2->find(i);
+        REQUIRE(it != hashmap2->end());
+        REQUIRE(it->second == i * i);
+    }
+    REQUIRE(hashmap2->find(10000) == hashmap2->end());
+
+    // Modify the hash map in the second mapping
+    auto hashmap3 = (SharedHashMap<uint64_t, uint64_t>*)manager2.root();
+    for (uint64_t i = 10000; i < 20000; ++i)
+        hashmap3->emplace(i, i);
+    REQUIRE(hashmap1->size() == 20000);
+    REQUIRE(hashmap1->find(19999)->second == 19999);
+}
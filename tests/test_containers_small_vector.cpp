@@ -0,0 +1,154 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "containers/small_vector.h"
+#include "memory/allocator_arena.h"
+#include "string/small_string.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Small vector", "[CppCommon][Containers]")
+{
+    SmallVector<int, 4> vector;
+    REQUIRE(vector.empty());
+    REQUIRE(vector.size() == 0);
+    REQUIRE(vector.capacity() == 4);
+    REQUIRE(vector.is_inline());
+    REQUIRE((((uintptr_t)vector.data() >= (uintptr_t)&vector) && ((uintptr_t)vector.data() < (uintptr_t)(&vector + 1))));
+
+    for (int i = 0; i < 4; ++i)
+        vector.push_back(i);
+    REQUIRE(vector.size() == 4);
+    REQUIRE(vector.is_inline());
+
+    // Spill into the allocated memory
+    vector.push_back(vector[0]);
+    REQUIRE(vector.size() == 5);
+    REQUIRE(!vector.is_inline());
+    REQUIRE(vector.capacity() == 8);
+    REQUIRE(vector.back() == 0);
+
+    vector.insert(vector.begin() + 1, 10);
+    vector.erase(vector.begin() + 3, vector.begin() + 5);
+    REQUIRE(vector == SmallVector<int, 4>({ 0, 10, 1, 0 }));
+    REQUIRE(vector.at(1) == 10);
+    REQUIRE_THROWS_AS(vector.at(4), std::out_of_range);
+
+    // Return into the inline buffer
+    vector.shrink_to_fit();
+    REQUIRE(vector.is_inline());
+    REQUIRE(vector == SmallVector<int, 4>({ 0, 10, 1, 0 }));
+
+    vector.resize(6, 7);
+    REQUIRE(!vector.is_inline());
+    REQUIRE(vector[5] == 7);
+    vector.resize(2);
+    REQUIRE(vector.size() == 2);
+    vector.pop_back();
+    REQUIRE(vector.front() == 0);
+
+    SmallVector<int, 4> copy(vector);
+    REQUIRE(copy == vector);
+    vector.clear();
+    REQUIRE(vector.empty());
+    REQUIRE(copy.size() == 1);
+}
+
+TEST_CASE("Small vector move and swap", "[CppCommon][Containers]")
+{
+    SmallVector<std::unique_ptr<std::string>, 2> small;
+    small.emplace_back(std::make_unique<std::string>("inline"));
+    SmallVector<std::unique_ptr<std::string>, 2> large;
+    for (int i = 0; i < 10; ++i)
+        large.emplace_back(std::make_unique<std::string>(std::to_string(i)));
+
+    // Move inline items one by one
+    SmallVector<std::unique_ptr<std::string>, 2> moved(std::move(small));
+    REQUIRE(small.empty());
+    REQUIRE(moved.is_inline());
+    REQUIRE(*moved[0] == "inline");
+
+    // Steal spilled items
+    const void* data = large.data();
+    SmallVector<std::unique_ptr<std::string>, 2> stolen(std::move(large));
+    REQUIRE(large.empty());
+    REQUIRE(large.is_inline());
+    REQUIRE(stolen.data() == data);
+    REQUIRE(*stolen[9] == "9");
+
+    swap(moved, stolen);
+    REQUIRE(moved.size() == 10);
+    REQUIRE(stolen.size() == 1);
+    REQUIRE(*stolen[0] == "inline");
+
+    stolen = std::move(moved);
+    REQUIRE(stolen.size() == 10);
+    REQUIRE(moved.empty());
+
+    stolen.insert(stolen.begin(), std::make_unique<std::string>("first"));
+    REQUIRE(*stolen[0] == "first");
+    REQUIRE(*stolen[10] == "9");
+}
+
+TEST_CASE("Small vector with spill memory manager", "[CppCommon][Containers]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+    ArenaAllocator<int, DefaultMemoryManager> allocator(arena);
+
+    {
+        SmallVector<int, 8, ArenaAllocator<int, DefaultMemoryManager>> vector(allocator);
+        for (int i = 0; i < 8; ++i)
+            vector.push_back(i);
+        REQUIRE(arena.allocations() == 0);
+        vector.push_back(8);
+        REQUIRE(arena.allocations() == 1);
+        REQUIRE(vector[8] == 8);
+    }
+    REQUIRE(arena.allocations() == 0);
+}
+
+TEST_CASE("Small string", "[CppCommon][String]")
+{
+    SmallString<8> str;
+    REQUIRE(str.empty());
+    REQUIRE(str.size() == 0);
+    REQUIRE(str.capacity() == 8);
+    REQUIRE(std::string(str.c_str()).empty());
+
+    str = "short";
+    REQUIRE(str == "short");
+    REQUIRE(str.is_inline());
+    str += '!';
+    str += "!!";
+    REQUIRE(str.size() == 8);
+    REQUIRE(str.is_inline());
+    REQUIRE(std::string(str.c_str()) == "short!!!");
+
+    // Spill into the allocated memory appending the string itself
+    str += str;
+    REQUIRE(!str.is_inline());
+    REQUIRE(str == "short!!!short!!!");
+    REQUIRE(str.string() == "short!!!short!!!");
+
+    str.assign(std::string_view(str).substr(5, 3));
+    REQUIRE(str == "!!!");
+    str.pop_back();
+    str.resize(4, '?');
+    REQUIRE(str == "!!??");
+    REQUIRE(std::string(str.c_str()) == "!!??");
+
+    SmallString<8> copy(str);
+    REQUIRE(copy == str);
+    REQUIRE(!(copy < str));
+    copy.clear();
+    REQUIRE(copy.empty());
+    REQUIRE(copy != str);
+}
@@ -0,0 +1,60 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions_handler.h"
+
+#include <string>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+TEST_CASE("Exceptions handler signal-safe dump", "[CppCommon][Errors]")
+{
+    int pipes[2];
+    REQUIRE(pipe(pipes) == 0);
+
+    pid_t pid = fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0)
+    {
+        // Crash the child process without the core dump
+        close(pipes[0]);
+        struct rlimit limit = { 0, 0 };
+        setrlimit(RLIMIT_CORE, &limit);
+        ExceptionsHandler::SetupProcess();
+        ExceptionsHandler::SetupSignalSafeDump(pipes[1]);
+        raise(SIGSEGV);
+        _exit(0);
+    }
+    close(pipes[1]);
+
+    // Read the crash dump of the child process
+    std::string dump;
+    char buffer[4096];
+    ssize_t size;
+    while ((size = read(pipes[0], buffer, sizeof(buffer))) > 0)
+        dump.append(buffer, (size_t)size);
+    close(pipes[0]);
+
+    int status = 0;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFSIGNALED(status));
+    REQUIRE(WTERMSIG(status) == SIGSEGV);
+
+    REQUIRE(dump.find("(SIGSEGV) signal") != std::string::npos);
+    REQUIRE(dump.find("Stack trace:\n#0 0x") != std::string::npos);
+    REQUIRE(dump.find("Memory map:\n") != std::string::npos);
+}
+
+#endif
@@ -4,7 +4,9 @@
 
 #include "test.h"
 
+#include "errors/exceptions.h"
 #include "errors/system_error.h"
+#include "system/stack_trace.h"
 
 using namespace CppCommon;
 
@@ -19,3 +21,29 @@ TEST_CASE("System error", "[CppCommon][Errors]")
     REQUIRE(SystemError::Description().size() >= 0);
     REQUIRE(SystemError::Description(SystemError::GetLast()).size() >= 0);
 }
+
+TEST_CASE("System error code", "[CppCommon][Errors]")
+{
+    SystemError::SetLast(ENOENT);
+    std::error_code ec = SystemError::GetLastCode();
+    REQUIRE(ec.value() == ENOENT);
+    REQUIRE(ec.category() == std::system_category());
+    SystemError::ClearLast();
+    REQUIRE(!SystemError::GetLastCode());
+}
+
+TEST_CASE("System exception stack trace", "[CppCommon][Errors]")
+{
+    REQUIRE(!SystemException::IsCaptureStackTrace());
+    SystemException cheap("Test", 1);
+    REQUIRE(cheap.stack_trace().addresses().empty());
+    REQUIRE(cheap.string().find("Stack trace") == std::string::npos);
+
+    SystemException::SetCaptureStackTrace(true);
+    SystemException captured("Test", 1);
+    SystemException::SetCaptureStackTrace(false);
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__) || defined(_WIN32) || defined(_WIN64)
+    REQUIRE(!captured.stack_trace().addresses().empty());
+    REQUIRE(captured.string().find("Stack trace") != std::string::npos);
+#endif
+}
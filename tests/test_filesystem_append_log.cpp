@@ -0,0 +1,117 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/append_log.h"
+#include "filesystem/file.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Append log", "[CppCommon][FileSystem]")
+{
+    Path path("test.log");
+    if (path.IsExists())
+        File::Remove(path);
+
+    const int producers = 4;
+    const int records = 1000;
+
+    // Commit records from multiple producers
+    {
+        AppendLog log(4096, 4);
+        log.Open(path);
+        REQUIRE(log.IsOpened());
+        REQUIRE(log.max_size() > 0);
+
+        std::vector<std::thread> threads;
+        for (int producer = 0; producer < producers; ++producer)
+        {
+            threads.emplace_back([&log, producer]()
+            {
+                for (int i = 0; i < records; ++i)
+                {
+                    std::string record = std::to_string(producer) + ":" + std::to_string(i);
+                    log.Commit(record.data(), record.size());
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        // Records of concurrent producers share fsync() calls
+        REQUIRE(log.groups() > 0);
+        REQUIRE(log.groups() < (uint64_t)(producers * records));
+
+        // Records could be appended without waiting
+        for (int i = 0; i < records; ++i)
+            log.Append("async", 5);
+        log.Flush();
+        log.Close();
+        REQUIRE(!log.IsOpened());
+    }
+
+    // Recover all records in the order of each producer
+    std::vector<int> next(producers, 0);
+    int asyncs = 0;
+    uint64_t valid = AppendLog::Recover(path, [&](uint64_t offset, std::span<const uint8_t> record)
+    {
+        std::string text((const char*)record.data(), record.size());
+        if (text == "async")
+        {
+            ++asyncs;
+            return;
+        }
+        int producer = std::stoi(text.substr(0, text.find(':')));
+        int index = std::stoi(text.substr(text.find(':') + 1));
+        REQUIRE(index == next[producer]);
+        ++next[producer];
+    });
+    REQUIRE(asyncs == records);
+    for (int producer = 0; producer < producers; ++producer)
+        REQUIRE(next[producer] == records);
+    REQUIRE(valid == File(path).size());
+
+    // Simulate the torn tail of the last group
+    {
+        File file(path);
+        file.Open(false, true);
+        file.Seek(valid);
+        const uint8_t torn[] = { 100, 0, 0, 0, 1, 2, 3, 4, 'x', 'y' };
+        file.Write(torn, sizeof(torn));
+        file.Close();
+        REQUIRE(File(path).size() == (valid + sizeof(torn)));
+    }
+
+    // Reopen the log: the torn tail is truncated and new records are appended
+    {
+        size_t recovered = 0;
+        AppendLog log;
+        log.Open(path, [&recovered](uint64_t, std::span<const uint8_t>) { ++recovered; }, 65536);
+        REQUIRE(recovered == (size_t)(producers * records + records));
+        REQUIRE(File(path).size() == valid);
+        log.Commit("last", 4);
+        log.Close();
+    }
+    REQUIRE(AppendLog::Recover(path, nullptr) == (valid + AppendLog::HEADER_SIZE + 4));
+
+    // Corrupted record stops the recovery
+    {
+        File file(path);
+        file.Open(false, true);
+        file.Seek(AppendLog::HEADER_SIZE);
+        file.Write("#", 1);
+        file.Close();
+    }
+    size_t recovered = 0;
+    REQUIRE(AppendLog::Recover(path, [&recovered](uint64_t, std::span<const uint8_t>) { ++recovered; }) == 0);
+    REQUIRE(recovered == 0);
+
+    File::Remove(path);
+}
@@ -0,0 +1,87 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/async_file_io.h"
+#include "filesystem/file.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Asynchronous file I/O", "[CppCommon][FileSystem]")
+{
+    const size_t blocks = 64;
+    const size_t block = 4096;
+
+    AsyncFileIO engine(16);
+    REQUIRE(engine.depth() <= 16);
+    REQUIRE(engine.pending() == 0);
+
+    AsyncFileIO::FileId file = engine.Open("test.tmp", true, true, true);
+    REQUIRE(file != 0);
+
+    // Write blocks in reverse order with more operations than the queue depth
+    std::vector<uint8_t> output(blocks * block);
+    for (size_t i = 0; i < output.size(); ++i)
+        output[i] = (uint8_t)(i / block);
+
+    size_t written = 0;
+    for (size_t i = blocks; i-- > 0;)
+    {
+        engine.Write(file, i * block, output.data() + i * block, block, [&written, block](size_t size, int error)
+        {
+            REQUIRE(error == 0);
+            REQUIRE(size == block);
+            written += size;
+        });
+    }
+    REQUIRE(engine.pending() == blocks);
+    engine.WaitAll();
+    REQUIRE(written == output.size());
+    REQUIRE(engine.pending() == 0);
+
+    // Flush the file
+    std::future<void> flushed = engine.Fsync(file, true);
+    engine.WaitAll();
+    flushed.get();
+
+    // Read blocks into registered buffers
+    std::vector<uint8_t> input(blocks * block);
+    engine.RegisterBuffers({ std::span<uint8_t>(input) });
+    std::vector<std::future<size_t>> reads;
+    for (size_t i = 0; i < blocks; ++i)
+        reads.push_back(engine.Read(file, i * block, input.data() + i * block, block));
+    REQUIRE(engine.Submit() > 0);
+    engine.WaitAll();
+    for (auto& read : reads)
+        REQUIRE(read.get() == block);
+    REQUIRE(input == output);
+    engine.UnregisterBuffers();
+
+    // Read at the end of the file
+    uint8_t buffer[16];
+    std::future<size_t> eof = engine.Read(file, output.size() - 4, buffer, sizeof(buffer));
+    while (engine.pending() > 0)
+        engine.Wait();
+    REQUIRE(eof.get() == 4);
+    REQUIRE(std::memcmp(buffer, output.data() + output.size() - 4, 4) == 0);
+
+    engine.Close(file);
+    REQUIRE(File("test.tmp").size() == output.size());
+
+    // Failed operations
+    REQUIRE_THROWS_AS(engine.Open("missing.tmp", true, false), FileSystemException);
+    REQUIRE_THROWS_AS(engine.Read(file, 0, buffer, sizeof(buffer)), FileSystemException);
+
+    file = engine.Open("test.tmp", true, false);
+    std::future<size_t> failed = engine.Write(file, 0, buffer, sizeof(buffer));
+    engine.WaitAll();
+    REQUIRE_THROWS_AS(failed.get(), FileSystemException);
+    engine.Close(file);
+
+    File::Remove("test.tmp");
+}
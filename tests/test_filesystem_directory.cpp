@@ -5,6 +5,11 @@
 #include "test.h"
 
 #include "filesystem/filesystem.h"
+#include "string/glob_pattern.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <set>
 
 using namespace CppCommon;
 
@@ -99,6 +104,146 @@ TEST_CASE("Directory iterator", "[CppCommon][FileSystem]")
     REQUIRE(test.GetSymlinksRecursive().size() == 2);
     REQUIRE(test.GetSymlinksRecursive("test4.*").size() == 1);
 
+    // Check directory entries with compiled glob patterns
+    REQUIRE(test.GetEntries(GlobPattern("test1*")).size() == 2);
+    REQUIRE(test.GetEntriesRecursive(GlobPattern("test2*")).size() == 9);
+    REQUIRE(test.GetFiles(GlobPattern("*.tmp")).size() == 3);
+    REQUIRE(test.GetFilesRecursive(GlobPattern("!test2*;*.tmp")).size() == 7);
+    REQUIRE(test.GetDirectoriesRecursive(GlobPattern("TEST[23]*", true)).size() == 4);
+
     // Remove complex directory structure
     REQUIRE(Directory::RemoveAll(test) == Path::current());
 }
+
+TEST_CASE("Directory walk", "[CppCommon][FileSystem]")
+{
+    std::string text("test");
+
+    // Create directory tree
+    Directory test = Directory::Create(Path::current() / "test");
+    for (int i = 0; i < 4; ++i)
+    {
+        Directory level1 = Directory::Create(test / ("dir" + std::to_string(i)));
+        for (int j = 0; j < 4; ++j)
+        {
+            Directory level2 = Directory::Create(level1 / ("dir" + std::to_string(j)));
+            for (int k = 0; k < 8; ++k)
+                REQUIRE(File::WriteAllText(level2 / ("file" + std::to_string(k) + ".tmp"), text) == text.size());
+        }
+        REQUIRE(File::WriteAllText(level1 / "file.log", text) == text.size());
+    }
+    Symlink link = Symlink::CreateSymlink(test / "dir0", test / "link");
+
+    // Walk without following symbolic links
+    size_t directories = 0;
+    size_t files = 0;
+    size_t symlinks = 0;
+    size_t depth = 0;
+    REQUIRE(test.Walk([&](const DirectoryEntry& entry)
+    {
+        if (entry.type == FileType::DIRECTORY)
+            ++directories;
+        else if (entry.type == FileType::REGULAR)
+            ++files;
+        else if (entry.type == FileType::SYMLINK)
+            ++symlinks;
+        depth = std::max(depth, entry.depth);
+        return true;
+    }) == 153);
+    REQUIRE(directories == 20);
+    REQUIRE(files == 132);
+    REQUIRE(symlinks == 1);
+    REQUIRE(depth == 2);
+
+    // Walk with pattern and following symbolic links
+    DirectoryWalkOptions options;
+    options.pattern = ".*\\.tmp";
+    options.symlinks = true;
+    std::set<std::string> paths;
+    REQUIRE(test.Walk([&](const DirectoryEntry& entry)
+    {
+        REQUIRE(entry.type == FileType::REGULAR);
+        paths.insert(entry.path().string());
+        return true;
+    }, options) == 160);
+    REQUIRE(paths.size() == 160);
+    REQUIRE(paths.count((test / "link" / "dir1" / "file7.tmp").string()) == 1);
+
+    // Walk only the current directory
+    options = DirectoryWalkOptions();
+    options.recursive = false;
+    options.symlinks = true;
+    REQUIRE(test.Walk([](const DirectoryEntry& entry) { REQUIRE(entry.target == FileType::DIRECTORY); return true; }, options) == 5);
+
+    // Stop the walk
+    size_t count = 0;
+    test.Walk([&count](const DirectoryEntry&) { return ++count < 10; });
+    REQUIRE(count == 10);
+
+    // Parallel walk with the thread pool
+    ThreadPool pool(4);
+    options = DirectoryWalkOptions();
+    options.pool = &pool;
+    std::atomic<size_t> parallel(0);
+    REQUIRE(test.Walk([&parallel](const DirectoryEntry& entry) { if (entry.type == FileType::REGULAR) ++parallel; return true; }, options) == 153);
+    REQUIRE(parallel == 132);
+
+    // Parallel walk rethrows the handler exception
+    REQUIRE_THROWS_AS(test.Walk([](const DirectoryEntry& entry) { if (entry.name == "file5.tmp") throw std::runtime_error("walk"); return true; }, options), std::runtime_error);
+
+    // Remove directory tree without following symbolic links
+    REQUIRE(Directory::RemoveAll(test) == Path::current());
+    REQUIRE(!test.IsExists());
+}
+
+TEST_CASE("Directory listing", "[CppCommon][FileSystem]")
+{
+    std::string text("test");
+
+    // Create directory tree
+    Directory test = Directory::Create(Path::current() / "test");
+    for (int i = 0; i < 4; ++i)
+    {
+        Directory level1 = Directory::Create(test / ("dir" + std::to_string(i)));
+        for (int j = 0; j < 8; ++j)
+            REQUIRE(File::WriteAllText(level1 / ("file" + std::to_string(j) + ".tmp"), text) == text.size());
+    }
+
+    // List all entries
+    DirectoryListing entries = test.ListEntries();
+    REQUIRE(entries.size() == 36);
+    REQUIRE(entries.parents() == 5);
+    REQUIRE(entries[0].status == nullptr);
+
+    // List files with statuses
+    DirectoryWalkOptions options;
+    options.pattern = "file[0-3]\\.tmp";
+    options.status = true;
+    DirectoryListing files = test.ListFiles(options);
+    REQUIRE(files.size() == 16);
+    std::set<std::string> paths;
+    for (const auto& entry : files)
+    {
+        REQUIRE(entry.type == FileType::REGULAR);
+        REQUIRE(entry.depth == 1);
+        REQUIRE(entry.status != nullptr);
+        REQUIRE(entry.status->size == text.size());
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        REQUIRE(entry.inode != 0);
+#endif
+        paths.insert(entry.path().string());
+    }
+    REQUIRE(paths.size() == 16);
+    REQUIRE(paths.count((test / "dir2" / "file3.tmp").string()) == 1);
+    REQUIRE(files.path(0).IsRegularFile());
+
+    // Parallel listing with the thread pool
+    ThreadPool pool(4);
+    options = DirectoryWalkOptions();
+    options.pool = &pool;
+    REQUIRE(test.ListFiles(options).size() == 32);
+
+    // Remove directory tree
+    REQUIRE(Directory::RemoveAll(test) == Path::current());
+    REQUIRE(!test.IsExists());
+}
@@ -0,0 +1,50 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+using namespace CppCommon;
+
+TEST_CASE("Directory watcher", "[CppCommon][FileSystem]")
+{
+    if (!DirectoryWatcher::IsSupported())
+        return;
+
+    Directory test = Directory::Create(Path::current() / "watcher");
+    File::WriteAllText(test / "modified.txt", "test");
+    File::WriteAllText(test / "removed.txt", "test");
+
+    DirectoryWatcher watcher(test);
+    REQUIRE(watcher.path() == test);
+
+    // No changes yet
+    std::vector<DirectoryWatcher::Change> changes;
+    REQUIRE(watcher.Poll(changes) == 0);
+
+    // Change the watched directory
+    File::WriteAllText(test / "modified.txt", "modified");
+    File::WriteAllText(test / "added.txt", "added");
+    File::Remove(test / "removed.txt");
+
+    REQUIRE(watcher.Poll(changes) > 0);
+
+    bool added = false, modified = false, removed = false;
+    for (const auto& change : changes)
+    {
+        if ((change.first == DirectoryChange::ADDED) || (change.first == DirectoryChange::MODIFIED))
+        {
+            added |= (change.second.filename() == "added.txt");
+            modified |= (change.second.filename() == "modified.txt");
+        }
+        if (change.first == DirectoryChange::REMOVED)
+            removed |= (change.second.filename() == "removed.txt");
+    }
+    REQUIRE(added);
+    REQUIRE(modified);
+    REQUIRE(removed);
+
+    Directory::RemoveAll(test);
+}
@@ -5,8 +5,14 @@
 #include "test.h"
 
 #include "filesystem/filesystem.h"
+#include "memory/allocator_aligned.h"
 #include "utility/countof.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 using namespace CppCommon;
 
 TEST_CASE("File common", "[CppCommon][FileSystem]")
@@ -120,3 +126,222 @@ TEST_CASE("File read/write static methods", "[CppCommon][FileSystem]")
     REQUIRE(File::ReadAllText("test.tmp") == text);
     File::Remove("test.tmp");
 }
+
+TEST_CASE("File positional and vectored read/write", "[CppCommon][FileSystem]")
+{
+    File file("test.tmp");
+    file.Create(true, true);
+
+    // Write a header and a payload with a single call
+    std::string header = "HEAD";
+    std::string payload = "payload";
+    std::vector<std::span<const uint8_t>> output = { std::span<const uint8_t>((const uint8_t*)header.data(), header.size()), std::span<const uint8_t>((const uint8_t*)payload.data(), payload.size()) };
+    REQUIRE(file.WriteV(output) == 11);
+    REQUIRE(file.offset() == 11);
+
+    // Positional writes do not change the file offset
+    REQUIRE(file.WriteAt(11, "-tail", 5) == 5);
+    REQUIRE(file.WriteAt(0, output) == 11);
+    REQUIRE(file.offset() == 11);
+    REQUIRE(file.size() == 16);
+
+    // Positional reads from multiple threads
+    std::vector<std::thread> threads;
+    std::atomic<int> matches(0);
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&file, &matches]()
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                char buffer[7];
+                if ((file.ReadAt(4, buffer, sizeof(buffer)) == 7) && (std::string(buffer, 7) == "payload"))
+                    ++matches;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(matches == 400);
+
+    // Scatter positional read stops at the end of file
+    uint8_t head[4];
+    uint8_t body[32];
+    std::vector<std::span<uint8_t>> input = { std::span<uint8_t>(head), std::span<uint8_t>(body) };
+    REQUIRE(file.ReadAt(0, input) == 16);
+    REQUIRE(std::string((char*)head, 4) == "HEAD");
+    REQUIRE(std::string((char*)body, 12) == "payload-tail");
+    REQUIRE(file.ReadAt(16, body, sizeof(body)) == 0);
+    file.Close();
+
+    // Scatter read consumes the read buffer first
+    file.Open(true, false);
+    char first[2];
+    REQUIRE(file.Read(first, 2) == 2);
+    REQUIRE(file.ReadV(input) == 14);
+    REQUIRE(std::string((char*)head, 4) == "ADpa");
+    REQUIRE(std::string((char*)body, 10) == "yload-tail");
+    file.Close();
+
+    // Scatter read without the read buffer
+    file.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    REQUIRE(file.ReadV(input) == 16);
+    REQUIRE(std::string((char*)body, 12) == "payload-tail");
+    file.Close();
+
+    File::Remove(file);
+}
+
+TEST_CASE("File direct I/O and preallocation", "[CppCommon][FileSystem]")
+{
+    File file("test.tmp");
+
+    // File buffer size must be a multiple of the direct I/O alignment
+    REQUIRE_THROWS_AS(file.Create(true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 1000, true), FileSystemException);
+    REQUIRE(!file.IsFileExists());
+
+    try
+    {
+        file.Create(true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, File::DEFAULT_BUFFER, true);
+    }
+    catch (const FileSystemException&)
+    {
+        WARN("Direct I/O is not supported by the filesystem!");
+        if (file.IsFileExists())
+            File::Remove(file);
+        return;
+    }
+    REQUIRE(file.IsFileDirect());
+
+    // Buffered writes could have any size
+    std::string data;
+    for (int i = 0; i < 1000; ++i)
+        data += "0123456789";
+    REQUIRE(file.Write(data) == 10000);
+    file.Flush();
+    REQUIRE(file.size() == 10000);
+    REQUIRE(file.Write("!", 1) == 1);
+    file.Close();
+    REQUIRE(file.size() == 10001);
+
+    // Positional reads with an aligned buffer
+    AlignedMemoryManager manager(File::DIRECT_ALIGNMENT);
+    uint8_t* block = (uint8_t*)manager.malloc(File::DIRECT_ALIGNMENT);
+    REQUIRE(block != nullptr);
+    file.Open(true, true, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, File::DEFAULT_BUFFER, true);
+    REQUIRE(file.ReadAt(0, block, File::DIRECT_ALIGNMENT) == File::DIRECT_ALIGNMENT);
+    REQUIRE(std::memcmp(block, data.data(), File::DIRECT_ALIGNMENT) == 0);
+    REQUIRE(file.ReadAt(2 * File::DIRECT_ALIGNMENT, block, File::DIRECT_ALIGNMENT) == 1809);
+    REQUIRE(block[1808] == '!');
+
+    // Unaligned operations are rejected
+    REQUIRE_THROWS_AS(file.ReadAt(1, block, File::DIRECT_ALIGNMENT), FileSystemException);
+    REQUIRE_THROWS_AS(file.ReadAt(0, block + 1, File::DIRECT_ALIGNMENT - 1), FileSystemException);
+    REQUIRE_THROWS_AS(file.WriteAt(0, block, 100), FileSystemException);
+    REQUIRE_THROWS_AS(file.Seek(100), FileSystemException);
+
+    // Buffered reads from the aligned offset
+    file.Seek(File::DIRECT_ALIGNMENT);
+    std::vector<uint8_t> rest = file.ReadAllBytes();
+    REQUIRE(rest.size() == (10001 - File::DIRECT_ALIGNMENT));
+    REQUIRE(rest.back() == '!');
+
+    // Unaligned tail in the middle of the file is merged with the file content
+    file.Seek(0);
+    REQUIRE(file.Write("abc", 3) == 3);
+    file.Close();
+    manager.free(block, File::DIRECT_ALIGNMENT);
+    std::string text = File::ReadAllText(file);
+    REQUIRE(text.size() == 10001);
+    REQUIRE(text.substr(0, 5) == "abc34");
+    REQUIRE(text.back() == '!');
+
+    // Preallocation keeps the file size by default
+    file.Open(false, true, true);
+    file.Preallocate(0, 1024 * 1024);
+    REQUIRE(file.size() == 0);
+    file.Preallocate(0, 65536, false);
+    REQUIRE(file.size() == 65536);
+    file.Advise(FileAdvice::SEQUENTIAL);
+    file.Advise(FileAdvice::DONTNEED, 0, 4096);
+    file.Close();
+
+    File::Remove(file);
+}
+
+TEST_CASE("File hole punching", "[CppCommon][FileSystem]")
+{
+    const size_t segment = 65536;
+
+    // Write four segments of the circular log
+    File file("test.tmp");
+    file.Create(true, true);
+    std::vector<uint8_t> data(4 * segment, 'A');
+    REQUIRE(file.WriteAt(0, data.data(), data.size()) == data.size());
+
+    std::vector<FileRegion> regions = file.DataRegions();
+    REQUIRE(regions.size() == 1);
+    REQUIRE(regions[0].offset == 0);
+    REQUIRE(regions[0].size == data.size());
+
+    // Drop the first two segments
+    file.PunchHole(0, 2 * segment);
+    REQUIRE(file.size() == data.size());
+
+    std::vector<uint8_t> buffer(data.size());
+    REQUIRE(file.ReadAt(0, buffer.data(), buffer.size()) == buffer.size());
+    REQUIRE(std::all_of(buffer.begin(), buffer.begin() + 2 * segment, [](uint8_t byte) { return byte == 0; }));
+    REQUIRE(std::all_of(buffer.begin() + 2 * segment, buffer.end(), [](uint8_t byte) { return byte == 'A'; }));
+
+    // Data regions still cover the remaining segments
+    regions = file.DataRegions();
+    REQUIRE(!regions.empty());
+    REQUIRE(regions.back().offset + regions.back().size == data.size());
+    REQUIRE(regions.back().offset <= 2 * segment);
+
+    // Range is limited by the file size
+    regions = file.DataRegions(3 * segment, 10 * segment);
+    REQUIRE(regions.size() == 1);
+    REQUIRE(regions[0].offset == 3 * segment);
+    REQUIRE(regions[0].size == segment);
+    file.PunchHole(data.size(), segment);
+    REQUIRE(file.size() == data.size());
+    file.Close();
+
+    File::Remove(file);
+}
+
+TEST_CASE("File error codes", "[CppCommon][FileSystem]")
+{
+    std::error_code ec;
+
+    // Open of the missing file reports the error code without exception
+    File missing("missing.tmp");
+    missing.Open(true, false, ec);
+    REQUIRE(ec);
+    REQUIRE(ec == std::errc::no_such_file_or_directory);
+    REQUIRE(!missing.IsFileOpened());
+    REQUIRE_THROWS_AS(missing.Open(true, false), FileSystemException);
+
+    // Successful operations clear the error code
+    File file("test.tmp");
+    file.Create(false, true);
+    file.Close();
+    file.Open(true, true, ec);
+    REQUIRE(!ec);
+    REQUIRE(file.IsFileOpened());
+    REQUIRE(file.Write("test", 4, ec) == 4);
+    REQUIRE(!ec);
+    file.Flush();
+    file.Seek(0);
+    char buffer[4];
+    REQUIRE(file.Read(buffer, sizeof(buffer), ec) == 4);
+    REQUIRE(!ec);
+    REQUIRE(std::memcmp(buffer, "test", 4) == 0);
+    file.Close();
+    File::Remove(file);
+
+    // Path type reports only real system errors
+    REQUIRE(missing.type(ec) == FileType::NONE);
+    REQUIRE(!ec);
+}
@@ -0,0 +1,118 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+TEST_CASE("Memory-mapped file", "[CppCommon][FileSystem]")
+{
+    File::WriteAllText("test.tmp", "test content");
+    File::WriteEmpty("empty.tmp");
+
+    // Map the file
+    MappedFile mapped("test.tmp");
+    REQUIRE(mapped);
+    REQUIRE(mapped.IsMapped());
+    REQUIRE(mapped.size() == 12);
+    REQUIRE(mapped.view() == "test content");
+
+    // Move the mapped file
+    MappedFile moved(std::move(mapped));
+    REQUIRE(!mapped);
+    REQUIRE(moved.view() == "test content");
+
+    // Map the empty file
+    moved.Map("empty.tmp");
+    REQUIRE(moved.IsMapped());
+    REQUIRE(moved.size() == 0);
+    REQUIRE(moved.view().empty());
+
+    // Unmap the file
+    moved.Unmap();
+    REQUIRE(!moved);
+
+    // Map the missing file
+    REQUIRE_THROWS_AS(moved.Map("missing.tmp"), FileSystemException);
+
+    File::Remove("test.tmp");
+    File::Remove("empty.tmp");
+}
+
+TEST_CASE("Memory-mapped file window", "[CppCommon][FileSystem]")
+{
+    std::string content;
+    for (int i = 0; i < 10000; ++i)
+        content += (char)('a' + (i % 26));
+    File::WriteAllText("test.tmp", content);
+
+    // Map the unaligned window of the file
+    MappedFile mapped("test.tmp", MappedFileMode::READONLY, 5000, 100);
+    REQUIRE(mapped.offset() == 5000);
+    REQUIRE(mapped.size() == 100);
+    REQUIRE(mapped.view() == std::string_view(content).substr(5000, 100));
+    REQUIRE(mapped.span().size() == 100);
+    REQUIRE(!mapped.IsWritable());
+
+    // Advise the access pattern
+    mapped.Advise(MappedFileAdvice::SEQUENTIAL);
+    mapped.Advise(MappedFileAdvice::WILLNEED, 10, 20);
+
+    // Grow the read-only window up to the end of the file
+    mapped.Resize(5000);
+    REQUIRE(mapped.view() == std::string_view(content).substr(5000));
+    REQUIRE_THROWS_AS(mapped.Resize(5001), FileSystemException);
+
+    // Read the window through the reader interface
+    mapped.Seek(4990);
+    REQUIRE(mapped.ReadAllText() == content.substr(9990));
+    REQUIRE(mapped.position() == 5000);
+
+    // Map the window out of the read-only file
+    REQUIRE_THROWS_AS(mapped.Map("test.tmp", MappedFileMode::READONLY, 9000, 2000), FileSystemException);
+
+    mapped.Unmap();
+    File::Remove("test.tmp");
+}
+
+TEST_CASE("Memory-mapped file read-write and copy-on-write", "[CppCommon][FileSystem]")
+{
+    File::WriteAllText("test.tmp", "0123456789");
+
+    // Modify the private copy of the file
+    {
+        MappedFile mapped("test.tmp", MappedFileMode::COPYONWRITE);
+        REQUIRE(mapped.IsWritable());
+        std::memcpy(mapped.data(), "ABC", 3);
+        REQUIRE(mapped.view() == "ABC3456789");
+    }
+    REQUIRE(File::ReadAllText("test.tmp") == "0123456789");
+
+    // Modify the file and append through the mapping
+    {
+        MappedFile mapped("test.tmp", MappedFileMode::READWRITE);
+        std::memcpy(mapped.data(), "ABC", 3);
+        mapped.Flush(0, 3);
+
+        mapped.Resize(15);
+        REQUIRE(mapped.view().substr(0, 10) == "ABC3456789");
+        std::memcpy(mapped.span().data() + 10, "XYZ!!", 5);
+        mapped.Flush();
+    }
+    REQUIRE(File::ReadAllText("test.tmp") == "ABC3456789XYZ!!");
+
+    // Map the read-write window out of the file to extend it
+    {
+        MappedFile mapped("test.tmp", MappedFileMode::READWRITE, 20, 5);
+        std::memcpy(mapped.data(), "tail!", 5);
+    }
+    REQUIRE(File("test.tmp").size() == 25);
+    REQUIRE(File::ReadAllText("test.tmp").substr(20) == "tail!");
+
+    File::Remove("test.tmp");
+}
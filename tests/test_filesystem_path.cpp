@@ -5,6 +5,7 @@
 #include "test.h"
 
 #include "filesystem/filesystem.h"
+#include "threads/thread_pool.h"
 
 using namespace CppCommon;
 
@@ -451,6 +452,60 @@ TEST_CASE("Path manipulations", "[CppCommon][FileSystem]")
 }
 
 #if defined(unix) || defined(__unix) || defined(__unix__)
+TEST_CASE("Path view", "[CppCommon][FileSystem]")
+{
+    // Test path view decompositions
+    std::string path = "/foo/bar/test.tar.gz";
+    PathView view(path);
+    REQUIRE(view.root() == "/");
+    REQUIRE(view.relative() == "foo/bar/test.tar.gz");
+    REQUIRE(view.parent() == "/foo/bar");
+    REQUIRE(view.filename() == "test.tar.gz");
+    REQUIRE(view.stem() == "test.tar");
+    REQUIRE(view.extension() == ".gz");
+    REQUIRE(view.parent().parent().filename() == "foo");
+    REQUIRE(PathView("foo/").filename() == ".");
+    REQUIRE(PathView("foo").parent().empty());
+    REQUIRE(view.IsAbsolute());
+    REQUIRE(PathView("foo/bar").IsRelative());
+
+    // Decompositions reference the viewed string
+    REQUIRE(view.filename().data() == path.data() + 9);
+    REQUIRE(view.parent().data() == path.data());
+
+    // Test path view decompositions match path decompositions
+    for (const char* value : { "", ".", "..", "/", "//", "///foo", "foo", "foo.", "foo..", ".foo", "foo/bar.txt", "C:", "C:\\", "C:\\foo\\bar.txt", "\\\\net\\foo", "\\\\?\\C:\\foo" })
+    {
+        Path current(value);
+        PathView view(current);
+        REQUIRE(Path(view.root()) == current.root());
+        REQUIRE(Path(view.relative()) == current.relative());
+        REQUIRE(Path(view.parent()) == current.parent());
+        REQUIRE(Path(view.filename()) == current.filename());
+        REQUIRE(Path(view.stem()) == current.stem());
+        REQUIRE(Path(view.extension()) == current.extension());
+    }
+
+    // Test path manipulations with path views
+    Path test("/foo/bar/test.txt");
+    REQUIRE((Path("/foo") / PathView("bar")).MakePreferred() == Path("/foo/bar").MakePreferred());
+    REQUIRE((Path("/foo") / std::string_view("bar/test", 3)).MakePreferred() == Path("/foo/bar").MakePreferred());
+    REQUIRE((Path("test") + PathView(".txt")) == Path("test.txt"));
+    REQUIRE(view.path() == Path(path));
+
+    // Test path manipulations with views of the same path
+    Path self("/foo/bar");
+    self /= PathView(self).filename();
+    REQUIRE(self.MakePreferred() == Path("/foo/bar/bar").MakePreferred());
+    self.ReplaceFilename(PathView(self).parent().filename());
+    REQUIRE(self.MakePreferred() == Path("/foo/bar/bar").MakePreferred());
+    self.Concat(PathView(self).relative());
+    REQUIRE(self.MakePreferred() == Path("/foo/bar/barfoo/bar/bar").MakePreferred());
+    self.ReplaceExtension(PathView("test.txt").extension());
+    REQUIRE(PathView(self).extension() == ".txt");
+    REQUIRE(self == PathView(self));
+}
+
 TEST_CASE("Path permissions", "[CppCommon][FileSystem]")
 {
     Path current = Path::current();
@@ -588,6 +643,62 @@ TEST_CASE("Path copy & remove", "[CppCommon][FileSystem]")
     REQUIRE(Path::RemoveAll(test) == Path::current());
 }
 
+TEST_CASE("Path parallel copy & remove", "[CppCommon][FileSystem]")
+{
+    // Create directory tree with files of different sizes
+    uint64_t total = 0;
+    Directory test = Directory::Create(Path::current() / "test");
+    for (int i = 0; i < 4; ++i)
+    {
+        Directory level1 = Directory::Create(test / ("dir" + std::to_string(i)));
+        for (int j = 0; j < 8; ++j)
+        {
+            std::string text((i * 8 + j) * 4099, (char)('a' + j));
+            REQUIRE(File::WriteAllText(level1 / ("file" + std::to_string(j) + ".tmp"), text) == text.size());
+            total += text.size();
+        }
+    }
+    Symlink link = Symlink::CreateSymlink(test / "dir0", test / "link");
+
+    ThreadPool pool(4);
+    PathTreeOptions options;
+    options.pool = &pool;
+    options.concurrency = 3;
+
+    // Copy directory tree
+    bool ordered = true;
+    uint64_t entries = 0;
+    uint64_t bytes = 0;
+    options.progress = [&](const Path& path, uint64_t processed, uint64_t copied)
+    {
+        // Progress handler is called from workers of the thread pool, so check the results later
+        ordered = ordered && (processed == (entries + 1)) && (copied >= bytes);
+        entries = processed;
+        bytes = copied;
+    };
+    Directory copy = Path::CopyAll(test, Path::current() / "copy", false, options);
+    REQUIRE(ordered);
+    REQUIRE(entries == 38);
+    REQUIRE(bytes == total);
+    REQUIRE(copy.GetFilesRecursive().size() == 40);
+    REQUIRE(copy.GetSymlinks().size() == 1);
+    REQUIRE(File::ReadAllText(copy / "dir3" / "file7.tmp") == File::ReadAllText(test / "dir3" / "file7.tmp"));
+
+    // Copy into the existing destination is skipped without overwrite
+    REQUIRE(Path::CopyAll(test, copy, false, options).empty());
+
+    // Remove directory trees
+    entries = 0;
+    bytes = 0;
+    REQUIRE(Path::RemoveAll(copy, options) == Path::current());
+    REQUIRE(ordered);
+    REQUIRE(entries == 38);
+    REQUIRE(!copy.IsExists());
+    REQUIRE(!test.IsDirectoryEmpty());
+    REQUIRE(Path::RemoveAll(test, options) == Path::current());
+    REQUIRE(!test.IsExists());
+}
+
 TEST_CASE("Path constants of the current process", "[CppCommon][FileSystem]")
 {
     Path initial = Path::initial();
@@ -0,0 +1,127 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+#include "threads/thread.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Path status", "[CppCommon][FileSystem]")
+{
+    Directory test = Directory::Create(Path::current() / "status");
+    File::WriteAllText(test / "file.txt", "test");
+
+    PathStatus status = (test / "file.txt").status();
+    REQUIRE(status.IsExists());
+    REQUIRE(status.type == FileType::REGULAR);
+    REQUIRE(status.size == 4);
+    REQUIRE(status.modified == (test / "file.txt").modified());
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    REQUIRE(status.permissions == (test / "file.txt").permissions());
+    REQUIRE(status.hardlinks == 1);
+#endif
+
+    REQUIRE(test.status().type == FileType::DIRECTORY);
+    REQUIRE(!(test / "missing.txt").status().IsExists());
+
+    // Directory iterator provides the status of entries
+    size_t count = 0;
+    for (auto it = test.begin(); it != test.end(); ++it)
+    {
+        REQUIRE(it.status().type == FileType::REGULAR);
+        REQUIRE(it.status().size == 4);
+        ++count;
+    }
+    REQUIRE(count == 1);
+
+    Directory::RemoveAll(test);
+}
+
+TEST_CASE("Path metadata cache", "[CppCommon][FileSystem]")
+{
+    Directory test = Directory::Create(Path::current() / "stat_cache");
+    File::WriteAllText(test / "file1.txt", "test");
+    File::WriteAllText(test / "file2.txt", "test test");
+
+    PathStatCache cache(Timespan::zero());
+    REQUIRE(cache.size() == 0);
+
+    // The first lookup calls the filesystem, the next one is served from the cache
+    REQUIRE(cache.Get(test / "file1.txt").size == 4);
+    REQUIRE(cache.Get(test / "file1.txt").size == 4);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(cache.misses() == 1);
+
+    // Stale entry is kept until the invalidation
+    File::WriteAllText(test / "file1.txt", "modified");
+    REQUIRE(cache.Get(test / "file1.txt").size == 4);
+    REQUIRE(cache.Invalidate(test / "file1.txt"));
+    REQUIRE(!cache.Invalidate(test / "file1.txt"));
+    REQUIRE(cache.Get(test / "file1.txt").size == 8);
+
+    // Batched lookup
+    std::vector<Path> paths = { test / "file1.txt", test / "file2.txt", test / "missing.txt" };
+    std::vector<PathStatus> result;
+    cache.Get(paths, result);
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[0].size == 8);
+    REQUIRE(result[1].size == 9);
+    REQUIRE(!result[2].IsExists());
+    REQUIRE(cache.size() == 3);
+
+    // Populate the cache with directory entries
+    cache.Clear();
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.Populate(test) == 2);
+    uint64_t misses = cache.misses();
+    REQUIRE(cache.Get(test / "file2.txt").size == 9);
+    REQUIRE(cache.misses() == misses);
+
+    // Concurrent lookups
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&cache, &paths]() { for (int j = 0; j < 1000; ++j) cache.Get(paths[j % paths.size()]); });
+    for (auto& thread : threads)
+        thread.join();
+
+    Directory::RemoveAll(test);
+}
+
+TEST_CASE("Path metadata cache time to live", "[CppCommon][FileSystem]")
+{
+    Directory test = Directory::Create(Path::current() / "stat_cache_ttl");
+    File::WriteAllText(test / "file.txt", "test");
+
+    PathStatCache cache(Timespan::milliseconds(10));
+    REQUIRE(cache.Get(test / "file.txt").size == 4);
+    File::WriteAllText(test / "file.txt", "modified");
+    Thread::Sleep(50);
+    REQUIRE(cache.Get(test / "file.txt").size == 8);
+
+    Directory::RemoveAll(test);
+}
+
+TEST_CASE("Path metadata cache watching", "[CppCommon][FileSystem]")
+{
+    if (!DirectoryWatcher::IsSupported())
+        return;
+
+    Directory test = Directory::Create(Path::current().absolute() / "stat_cache_watch");
+    File::WriteAllText(test / "file.txt", "test");
+
+    PathStatCache cache(Timespan::zero());
+    cache.Watch(test);
+    REQUIRE(cache.Get(test / "file.txt").size == 4);
+
+    File::WriteAllText(test / "file.txt", "modified");
+    REQUIRE(cache.Poll() > 0);
+    REQUIRE(cache.Get(test / "file.txt").size == 8);
+
+    Directory::RemoveAll(test);
+}
@@ -0,0 +1,97 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+#include "threads/thread_pool.h"
+
+#include <string>
+
+using namespace CppCommon;
+
+namespace {
+
+void Write(const Path& path, const std::string& text)
+{
+    File::WriteAllText(path, text);
+
+    // Move the modified timestamp into the past, so the file is not considered as recently modified
+    Path::SetModified(path, UtcTimestamp(Timestamp(UtcTimestamp().total() - Timespan::minutes(1).total())));
+}
+
+}
+
+TEST_CASE("Tree fingerprint", "[CppCommon][FileSystem]")
+{
+    Directory source = Directory::CreateTree(Path::current() / "fingerprint" / "source" / "nested");
+    source = source.parent();
+    Write(source / "a.txt", "a");
+    Write(source / "b.txt", std::string(200000, 'b'));
+    Write(source / "nested" / "c.txt", "c");
+    Write(source / "empty.txt", "");
+
+    ThreadPool pool(2);
+    TreeFingerprintOptions options;
+    options.pool = &pool;
+
+    TreeFingerprint fingerprint;
+    fingerprint.Scan(source, options);
+    REQUIRE(fingerprint.size() == 4);
+    REQUIRE(fingerprint.hashed() == 4);
+    REQUIRE(fingerprint.reused() == 0);
+    REQUIRE(fingerprint.bytes() == 200002);
+    REQUIRE(fingerprint.files()[0].path == "a.txt");
+    REQUIRE(fingerprint.files()[3].path == "nested/c.txt");
+    REQUIRE(fingerprint.find("nested/c.txt") != nullptr);
+    REQUIRE(fingerprint.find("c.txt") == nullptr);
+    REQUIRE(fingerprint.find("b.txt")->size == 200000);
+
+    // Unchanged files are not read again
+    uint128_t hash = fingerprint.hash();
+    TreeFingerprint previous = fingerprint;
+    fingerprint.Scan(source, options);
+    REQUIRE(fingerprint.hashed() == 0);
+    REQUIRE(fingerprint.reused() == 4);
+    REQUIRE(fingerprint.hash() == hash);
+
+    // Changed and renamed files
+    Write(source / "a.txt", "aa");
+    Path::Rename(source / "nested" / "c.txt", source / "nested" / "d.txt");
+    fingerprint.Scan(source, options);
+    REQUIRE(fingerprint.hashed() == 1);
+    REQUIRE(fingerprint.reused() == 3);
+    REQUIRE(fingerprint.hash() != hash);
+
+    TreeDifference difference = TreeFingerprint::Compare(previous, fingerprint);
+    REQUIRE(difference.created == std::vector<std::string>{ "nested/d.txt" });
+    REQUIRE(difference.removed == std::vector<std::string>{ "nested/c.txt" });
+    REQUIRE(difference.modified == std::vector<std::string>{ "a.txt" });
+    REQUIRE(TreeFingerprint::Compare(fingerprint, fingerprint).empty());
+
+    // Cache file keeps fingerprints between runs
+    Path cache = Path::current() / "fingerprint" / "cache.bin";
+    fingerprint.Save(cache);
+    TreeFingerprint loaded;
+    REQUIRE(loaded.Load(cache));
+    REQUIRE(loaded.size() == 4);
+    REQUIRE(loaded.hash() == fingerprint.hash());
+    loaded.Scan(source);
+    REQUIRE(loaded.hashed() == 0);
+    REQUIRE(TreeFingerprint::Compare(loaded, fingerprint).empty());
+
+    // Recently modified files are read again
+    File::WriteAllText(source / "a.txt", "ab");
+    loaded.Scan(source);
+    loaded.Scan(source);
+    REQUIRE(loaded.hashed() == 1);
+
+    // Corrupted cache file is ignored
+    File::WriteAllText(cache, "corrupted");
+    REQUIRE(!loaded.Load(cache));
+    REQUIRE(loaded.empty());
+    REQUIRE(!loaded.Load(Path::current() / "fingerprint" / "missing.bin"));
+
+    Directory::RemoveAll(Path::current() / "fingerprint");
+}
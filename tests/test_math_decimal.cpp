@@ -0,0 +1,181 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "math/decimal.h"
+
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Decimal arithmetic", "[CppCommon][Math]")
+{
+    using Price = Decimal<4>;
+
+    REQUIRE(Price::SCALE == 4);
+    REQUIRE(Price::FACTOR == 10000);
+    REQUIRE(Price().raw() == 0);
+    REQUIRE(Price(12).raw() == 120000);
+    REQUIRE(Price::FromRaw(-1234567).integer() == -123);
+    REQUIRE(Price::FromRaw(-1234567).fraction() == -4567);
+
+    // Addition and subtraction are exact
+    REQUIRE((Price::Parse("0.1") + Price::Parse("0.2")) == Price::Parse("0.3"));
+    REQUIRE((Price::Parse("1.5") - Price::Parse("2.25")) == Price::Parse("-0.75"));
+    REQUIRE(-Price::Parse("1.5") == Price::Parse("-1.5"));
+
+    // Multiplication and division round half away from zero
+    REQUIRE((Price::Parse("1.2345") * Price::Parse("2")) == Price::Parse("2.469"));
+    REQUIRE((Price::Parse("0.0001") * Price::Parse("0.5")) == Price::Parse("0.0001"));
+    REQUIRE((Price::Parse("-0.0001") * Price::Parse("0.5")) == Price::Parse("-0.0001"));
+    REQUIRE((Price::Parse("0.0001") * Price::Parse("0.4999")) == Price());
+    REQUIRE((Price::Parse("1") / Price::Parse("3")) == Price::Parse("0.3333"));
+    REQUIRE((Price::Parse("2") / Price::Parse("3")) == Price::Parse("0.6667"));
+    REQUIRE((Price::Parse("-2") / Price::Parse("3")) == Price::Parse("-0.6667"));
+    REQUIRE((Price::Parse("10") / 4) == Price::Parse("2.5"));
+    REQUIRE((3 * Price::Parse("1.1")) == Price::Parse("3.3"));
+
+    // Large values use the full 128-bit intermediate product
+    REQUIRE((Price::Parse("900000000000000") * Price::Parse("1.0001")) == Price::Parse("900090000000000"));
+    REQUIRE((Price::Parse("900000000000000") / Price::Parse("1.5")) == Price::Parse("600000000000000"));
+
+    // Rescale
+    REQUIRE(Price::Parse("1.23456").rescale<2>() == Decimal<2>::Parse("1.23"));
+    REQUIRE(Price::Parse("1.235").rescale<2>() == Decimal<2>::Parse("1.24"));
+    REQUIRE(Price::Parse("-1.235").rescale<2>() == Decimal<2>::Parse("-1.24"));
+    REQUIRE(Price::Parse("1.235").rescale<8>() == Decimal<8>::Parse("1.235"));
+
+    // Double conversion
+    REQUIRE(Price::FromDouble(0.1 + 0.2) == Price::Parse("0.3"));
+    REQUIRE(Price::FromDouble(-2.71828) == Price::Parse("-2.7183"));
+    REQUIRE(Price::Parse("1.25").ToDouble() == 1.25);
+
+    // Overflow and division by zero
+    const Price max = Price::FromRaw(0x7FFFFFFFFFFFFFFFll);
+    const Price min = Price::FromRaw(-0x7FFFFFFFFFFFFFFFll - 1);
+    REQUIRE_THROWS_AS(max + Price::FromRaw(1), DomainException);
+    REQUIRE_THROWS_AS(min - Price::FromRaw(1), DomainException);
+    REQUIRE_THROWS_AS(-min, DomainException);
+    REQUIRE_THROWS_AS(max * Price(2), DomainException);
+    REQUIRE_THROWS_AS(max / Price::Parse("0.5"), DomainException);
+    REQUIRE_THROWS_AS(Price(1) / Price(), DomainException);
+    REQUIRE_THROWS_AS(Price(1) / 0, DomainException);
+    REQUIRE_THROWS_AS(Price(1000000000000000ll), DomainException);
+    REQUIRE_THROWS_AS(Price::FromDouble(1e300), DomainException);
+    REQUIRE_THROWS_AS(Price::FromDouble(std::nan("")), DomainException);
+    REQUIRE((min + max) == Price::FromRaw(-1));
+    REQUIRE((max * Price(1)) == max);
+    REQUIRE((min / Price(1)) == min);
+}
+
+TEST_CASE("Decimal string conversion", "[CppCommon][Math]")
+{
+    REQUIRE(Decimal<4>::Parse("123.45").string() == "123.4500");
+    REQUIRE(Decimal<4>::Parse("-0.0012").string() == "-0.0012");
+    REQUIRE(Decimal<4>::Parse("+7").string() == "7.0000");
+    REQUIRE(Decimal<4>::Parse(".5").string() == "0.5000");
+    REQUIRE(Decimal<4>::Parse("5.").string() == "5.0000");
+    REQUIRE(Decimal<4>::Parse("0.00005").string() == "0.0001");
+    REQUIRE(Decimal<4>::Parse("0.000049999").string() == "0.0000");
+    REQUIRE(Decimal<4>::Parse("-0.00005").string() == "-0.0001");
+    REQUIRE(Decimal<0>::Parse("-9223372036854775808").string() == "-9223372036854775808");
+    REQUIRE(Decimal<0>::Parse("9223372036854775807").string() == "9223372036854775807");
+    REQUIRE(Decimal<1>::FromRaw(-0x7FFFFFFFFFFFFFFFll - 1).string() == "-922337203685477580.8");
+    REQUIRE(Decimal<18>::FromRaw(-0x7FFFFFFFFFFFFFFFll - 1).string() == "-9.223372036854775808");
+    REQUIRE(Decimal<18>::FromRaw(5).string() == "0.000000000000000005");
+    REQUIRE(Decimal<3>::Parse("922337203685477.580").raw() == 922337203685477580ll);
+
+    // Buffer overload
+    char buffer[Decimal<2>::STRING_SIZE];
+    REQUIRE(Decimal<2>::Parse("-12.5").string(buffer, sizeof(buffer)) == 6);
+    REQUIRE(std::string(buffer, 6) == "-12.50");
+    REQUIRE(Decimal<2>::Parse("-12.5").string(buffer, 5) == 0);
+
+    // Output stream
+    std::stringstream ss; ss << Decimal<2>::Parse("3.14159");
+    REQUIRE(ss.str() == "3.14");
+
+    // Invalid strings
+    Decimal<4> value;
+    for (const char* str : { "", "-", "+", ".", "1..2", "1.2.3", "1e5", " 1", "1 ", "0x10", "--1", "922337203685477.5808", "-922337203685477.5809", "100000000000000000000" })
+        REQUIRE(!Decimal<4>::Parse(str, value));
+    REQUIRE(Decimal<4>::Parse("-922337203685477.5808", value));
+    REQUIRE(value.raw() == (-0x7FFFFFFFFFFFFFFFll - 1));
+    REQUIRE_THROWS_AS(Decimal<4>::Parse("abc"), ArgumentException);
+
+    // Round trip of random values
+    std::mt19937_64 generator(0);
+    for (int i = 0; i < 10000; ++i)
+    {
+        Decimal<6> random = Decimal<6>::FromRaw((int64_t)generator() >> (generator() % 64));
+        REQUIRE(Decimal<6>::Parse(random.string()) == random);
+    }
+}
+
+TEST_CASE("Decimal batch operations", "[CppCommon][Math]")
+{
+    using Price = Decimal<4>;
+
+    std::mt19937_64 generator(0);
+    std::vector<Price> values1(1000);
+    std::vector<Price> values2(1000);
+    for (size_t i = 0; i < values1.size(); ++i)
+    {
+        values1[i] = Price::FromRaw((int64_t)(generator() % 2000000000) - 1000000000);
+        values2[i] = Price::FromRaw((int64_t)(generator() % 2000000000) - 1000000000);
+    }
+
+    std::vector<Price> results(1000);
+    Price::Add(values1, values2, results);
+    for (size_t i = 0; i < results.size(); ++i)
+        REQUIRE(results[i] == (values1[i] + values2[i]));
+
+    Price::Subtract(values1, values2, results);
+    for (size_t i = 0; i < results.size(); ++i)
+        REQUIRE(results[i] == (values1[i] - values2[i]));
+
+    const Price multiplier = Price::Parse("1.2345");
+    Price::Multiply(values1, multiplier, results);
+    for (size_t i = 0; i < results.size(); ++i)
+        REQUIRE(results[i] == (values1[i] * multiplier));
+
+    Price sum;
+    for (const auto& value : values1)
+        sum += value;
+    REQUIRE(Price::Sum(values1) == sum);
+    REQUIRE(Price::Sum({}) == Price());
+
+    // In-place operation
+    std::vector<Price> copy = values1;
+    Price::Add(copy, values2, copy);
+    for (size_t i = 0; i < copy.size(); ++i)
+        REQUIRE(copy[i] == (values1[i] + values2[i]));
+
+    // Overflow in any element
+    values1[500] = Price::FromRaw(0x7FFFFFFFFFFFFFFFll);
+    values2[500] = Price::FromRaw(1);
+    REQUIRE_THROWS_AS(Price::Add(values1, values2, results), DomainException);
+    REQUIRE_THROWS_AS(Price::Sum(values1), DomainException);
+    REQUIRE_THROWS_AS(Price::Multiply(values1, Price(2), results), DomainException);
+    values2[500] = Price::FromRaw(-1);
+    REQUIRE_THROWS_AS(Price::Subtract(values1, values2, results), DomainException);
+}
+
+TEST_CASE("Math MulDivRound64", "[CppCommon][Math]")
+{
+    uint64_t result;
+    REQUIRE(Math::MulDivRound64(10, 1, 4, result));
+    REQUIRE(result == 3);
+    REQUIRE(Math::MulDivRound64(9, 1, 4, result));
+    REQUIRE(result == 2);
+    REQUIRE(Math::MulDivRound64(4984198405165151231ull, 6132198419878046132ull, 9156498145135109843ull, result));
+    REQUIRE(result == 3337967539561099935ull);
+    REQUIRE(Math::MulDivRound64(18446744073709551615ull, 18446744073709551615ull, 18446744073709551615ull, result));
+    REQUIRE(result == 18446744073709551615ull);
+    REQUIRE(!Math::MulDivRound64(18446744073709551615ull, 2, 1, result));
+    REQUIRE(!Math::MulDivRound64(18446744073709551615ull, 3, 2, result));
+}
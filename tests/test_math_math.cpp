@@ -6,23 +6,16 @@
 
 #include "math/math.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Math", "[CppCommon][Math]")
 {
-#if defined(_M_IX86)
-    REQUIRE(Math::MulDiv64(4984198405165151231ull, 6132198419878046132ull, 9156498145135109843ull) == 3337967539561099935ull);
-    REQUIRE(Math::MulDiv64(11540173641653250113ull, 10150593219136339683ull, 13592284235543989460ull) == 9223372036854775809ull);
-    REQUIRE(Math::MulDiv64(449033535071450778ull, 3155170653582908051ull, 4945421831474875872ull) == 286482625873293138ull);
-    REQUIRE(Math::MulDiv64(303601908757ull, 829267376026ull, 659820219978ull) == 381569328444ull);
-    REQUIRE(Math::MulDiv64(449033535071450778ull, 829267376026ull, 659820219978ull) == 564348969767547451ull);
-    REQUIRE(Math::MulDiv64(1234568ull, 829267376026ull, 1ull) == 1023786965885666768ull);
-    REQUIRE(Math::MulDiv64(6991754535226557229ull, 7798003721120799096ull, 4923601287520449332ull) == 11073546515850664288ull);
-    REQUIRE(Math::MulDiv64(9223372036854775808ull, 2147483648ull, 18446744073709551615ull) == 2147483647ull);
-    REQUIRE(Math::MulDiv64(9223372032559808512ull, 9223372036854775807ull, 9223372036854775807ull) == 9223372032559808512ull);
-    REQUIRE(Math::MulDiv64(9223372032559808512ull, 9223372036854775807ull, 12ull) == 11529215046426383701ull);
-    REQUIRE(Math::MulDiv64(18446744073709551615ull, 18446744073709551615ull, 9223372036854775808ull) == 8589934594ull);
-#else
     REQUIRE(Math::MulDiv64(4984198405165151231ull, 6132198419878046132ull, 9156498145135109843ull) == 3337967539561099935ull);
     REQUIRE(Math::MulDiv64(11540173641653250113ull, 10150593219136339683ull, 13592284235543989460ull) == 8618095846487663363ull);
     REQUIRE(Math::MulDiv64(449033535071450778ull, 3155170653582908051ull, 4945421831474875872ull) == 286482625873293138ull);
@@ -38,5 +31,97 @@ TEST_CASE("Math", "[CppCommon][Math]")
     REQUIRE(((overflow == 11529215046426383701ull) || (overflow == 0xFFFFFFFFFFFFFFFFull)));
     overflow = Math::MulDiv64(18446744073709551615ull, 18446744073709551615ull, 9223372036854775808ull);
     REQUIRE(((overflow == 18446744073709551612ull) || (overflow == 0xFFFFFFFFFFFFFFFFull)));
-#endif
+
+    // Compile time calculations
+    static_assert(Math::GCD(12, 18) == 6);
+    static_assert(Math::GCD(17u, 5u) == 1);
+    static_assert(Math::RoundUp(13, 8) == 16);
+    static_assert(Math::RoundUp(16, 8) == 16);
+    static_assert(Math::MulDiv64(4984198405165151231ull, 6132198419878046132ull, 9156498145135109843ull) == 3337967539561099935ull);
+    static_assert(Math::MulDiv64(1ull << 63, 4, 2) == (1ull << 63) * 2);
+
+    uint64_t result = 0;
+    REQUIRE(Math::MulDivRound64(10, 1, 4, result));
+    REQUIRE(result == 3);
+    REQUIRE(!Math::MulDivRound64(18446744073709551615ull, 2, 1, result));
+}
+
+
+TEST_CASE("Math batch", "[CppCommon][Math]")
+{
+    std::mt19937_64 generator(0);
+    std::uniform_int_distribution<int64_t> integers(-1000000, 1000000);
+
+    for (size_t size = 0; size < 100; ++size)
+    {
+        std::vector<int64_t> values1(size);
+        std::vector<int64_t> values2(size);
+        std::vector<double> doubles1(size);
+        std::vector<double> doubles2(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            values1[i] = integers(generator);
+            values2[i] = integers(generator);
+            // Integer valued doubles are summed exactly in any order
+            doubles1[i] = (double)values1[i];
+            doubles2[i] = (double)(values2[i] % 1000);
+        }
+
+        // Sum
+        int64_t sum = std::accumulate(values1.begin(), values1.end(), (int64_t)0);
+        REQUIRE(Math::Sum(std::span<const int64_t>(values1)) == sum);
+        REQUIRE(Math::Sum(std::span<const double>(doubles1)) == (double)sum);
+
+        // Min & max
+        auto minmax = Math::MinMax(std::span<const int64_t>(values1));
+        auto dminmax = Math::MinMax(std::span<const double>(doubles1));
+        if (size == 0)
+        {
+            REQUIRE(minmax.first == std::numeric_limits<int64_t>::max());
+            REQUIRE(minmax.second == std::numeric_limits<int64_t>::lowest());
+        }
+        else
+        {
+            auto expected = std::minmax_element(values1.begin(), values1.end());
+            REQUIRE(minmax.first == *expected.first);
+            REQUIRE(minmax.second == *expected.second);
+            REQUIRE(dminmax.first == (double)*expected.first);
+            REQUIRE(dminmax.second == (double)*expected.second);
+        }
+
+        // Dot product
+        int64_t dot = std::inner_product(values1.begin(), values1.end(), values2.begin(), (int64_t)0);
+        REQUIRE(Math::Dot(std::span<const int64_t>(values1), std::span<const int64_t>(values2)) == dot);
+        double ddot = std::inner_product(doubles1.begin(), doubles1.end(), doubles2.begin(), 0.0);
+        REQUIRE(Math::Dot(std::span<const double>(doubles1), std::span<const double>(doubles2)) == ddot);
+
+        // Prefix sum in place
+        std::vector<int64_t> prefix(size);
+        std::partial_sum(values1.begin(), values1.end(), prefix.begin());
+        Math::PrefixSum(std::span<const int64_t>(values1), std::span<int64_t>(values1));
+        REQUIRE(values1 == prefix);
+        std::vector<double> dprefix(size);
+        Math::PrefixSum(std::span<const double>(doubles1), std::span<double>(dprefix));
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE(dprefix[i] == (double)prefix[i]);
+    }
+}
+
+TEST_CASE("Math batch scale and round", "[CppCommon][Math]")
+{
+    std::vector<uint64_t> values = { 0, 1, 2, 3, 10, 1000000007, 18446744073709551615ull };
+    std::vector<uint64_t> result(values.size());
+
+    REQUIRE(Math::MulDivRound64(std::span<const uint64_t>(values).first(6), 3, 4, std::span<uint64_t>(result).first(6)));
+    for (size_t i = 0; i < 6; ++i)
+    {
+        uint64_t expected = 0;
+        REQUIRE(Math::MulDivRound64(values[i], 3, 4, expected));
+        REQUIRE(result[i] == expected);
+    }
+
+    // Overflowed values are saturated
+    REQUIRE(!Math::MulDivRound64(std::span<const uint64_t>(values), 2, 1, std::span<uint64_t>(result)));
+    REQUIRE(result[5] == 2000000014);
+    REQUIRE(result[6] == std::numeric_limits<uint64_t>::max());
 }
@@ -4,20 +4,59 @@
 
 #include "test.h"
 
+#include "containers/small_vector.h"
 #include "memory/allocator.h"
+#include "memory/allocator_aligned.h"
 #include "memory/allocator_arena.h"
 #include "memory/allocator_heap.h"
+#include "memory/allocator_huge_page.h"
 #include "memory/allocator_null.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_profiling.h"
+#include "memory/allocator_scratch.h"
+#include "memory/allocator_shared.h"
+#include "memory/allocator_slab.h"
 #include "memory/allocator_stack.h"
+#include "memory/allocator_thread_cache.h"
 
+#include <cstring>
 #include <list>
 #include <map>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
 using namespace CppCommon;
 
+namespace {
+
+// Free blocks left by the failed requirement before the profiling memory manager checks for leaks
+class ProfilingBlocksGuard
+{
+public:
+    ProfilingBlocksGuard(ProfilingMemoryManager<DefaultMemoryManager>& manager, std::vector<void*>& blocks, size_t size)
+        : _manager(manager), _blocks(blocks), _size(size)
+    {}
+    ProfilingBlocksGuard(const ProfilingBlocksGuard&) = delete;
+    ~ProfilingBlocksGuard() { Free(); }
+
+    ProfilingBlocksGuard& operator=(const ProfilingBlocksGuard&) = delete;
+
+    void Free()
+    {
+        for (auto ptr : _blocks)
+            _manager.free(ptr, _size);
+        _blocks.clear();
+    }
+
+private:
+    ProfilingMemoryManager<DefaultMemoryManager>& _manager;
+    std::vector<void*>& _blocks;
+    size_t _size;
+};
+
+} // namespace
+
 TEST_CASE("Default memory manager", "[CppCommon][Memory]")
 {
     DefaultMemoryManager manger;
@@ -64,6 +103,129 @@ TEST_CASE("Heap memory manager", "[CppCommon][Memory]")
     REQUIRE(manger.allocations() == 0);
 }
 
+TEST_CASE("Aligned memory manager", "[CppCommon][Memory]")
+{
+    AlignedMemoryManager manger(512);
+    REQUIRE(manger.alignment() == 512);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    void* ptr = manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(((uintptr_t)ptr % 512) == 0);
+    REQUIRE(manger.allocated() == 1);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Greater alignment of the block should be respected
+    ptr = manger.malloc(10, 8192);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(((uintptr_t)ptr % 8192) == 0);
+    REQUIRE(manger.allocated() == 10);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 10);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Aligned allocator with stl containers
+    AlignedMemoryManager page;
+    AlignedAllocator<uint8_t> alloc(page);
+    std::vector<uint8_t, AlignedAllocator<uint8_t>> buffer(alloc);
+    buffer.resize(10000);
+    REQUIRE(((uintptr_t)buffer.data() % AlignedMemoryManager::DEFAULT_ALIGNMENT) == 0);
+    REQUIRE(page.allocations() == 1);
+
+    // Huge page aligned blocks
+    AlignedMemoryManager huge(AlignedMemoryManager::HUGE_PAGE_ALIGNMENT);
+    ptr = huge.malloc(100);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(((uintptr_t)ptr % AlignedMemoryManager::HUGE_PAGE_ALIGNMENT) == 0);
+    huge.free(ptr, 100);
+
+    // Cache aligned allocator with stl containers
+    std::vector<uint8_t, CacheAlignedAllocator<uint8_t>> cache;
+    for (size_t i = 1; i <= 1000; ++i)
+    {
+        cache.push_back((uint8_t)i);
+        REQUIRE(((uintptr_t)cache.data() % hardware_destructive_interference_size) == 0);
+    }
+    std::vector<uint64_t, CacheAlignedAllocator<uint64_t, AlignedMemoryManager::PAGE_ALIGNMENT>> pages(1000);
+    REQUIRE(((uintptr_t)pages.data() % AlignedMemoryManager::PAGE_ALIGNMENT) == 0);
+    REQUIRE(CacheAlignedAllocator<uint8_t>() == CacheAlignedAllocator<uint64_t>());
+}
+
+TEST_CASE("Shared memory allocator", "[CppCommon][Memory]")
+{
+    std::vector<uint64_t> region(1024 * 1024 / sizeof(uint64_t), 0);
+
+    SharedMemoryManager manger(region.data(), region.size() * sizeof(uint64_t));
+    REQUIRE(manger.capacity() == region.size() * sizeof(uint64_t));
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    size_t available = manger.available();
+    REQUIRE(available > 0);
+
+    void* ptr1 = manger.malloc(100);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(Memory::IsAligned((uint8_t*)ptr1, alignof(std::max_align_t)));
+    void* ptr2 = manger.malloc(1000, 4096);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned((uint8_t*)ptr2, 4096));
+    void* ptr3 = manger.malloc(10);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(manger.allocated() == 1110);
+    REQUIRE(manger.allocations() == 3);
+    std::memset(ptr1, 1, 100);
+    std::memset(ptr2, 2, 1000);
+    std::memset(ptr3, 3, 10);
+
+    // Attach to the existing shared heap
+    SharedMemoryManager attached(region.data(), region.size() * sizeof(uint64_t));
+    REQUIRE(attached.allocated() == 1110);
+    REQUIRE(attached.allocations() == 3);
+    REQUIRE(attached.offset(ptr2) == manger.offset(ptr2));
+
+    // Freed blocks must be coalesced
+    attached.free(ptr2, 1000);
+    manger.free(ptr1, 100);
+    manger.free(ptr3, 10);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.available() == available);
+
+    // Too big memory block
+    REQUIRE(manger.malloc(available + 1) == nullptr);
+    ptr1 = manger.malloc(available - 16);
+    REQUIRE(ptr1 != nullptr);
+    manger.free(ptr1, available - 16);
+
+    // Root object
+    REQUIRE(manger.root() == nullptr);
+    SharedAllocator<uint64_t> alloc(manger);
+    uint64_t* root = alloc.Create(12345);
+    manger.set_root(root);
+    REQUIRE(attached.root() == root);
+    REQUIRE(*(uint64_t*)attached.root() == 12345);
+    alloc.Release(root);
+    manger.set_root(nullptr);
+
+    // Shared memory allocator with stl containers
+    std::vector<int, SharedAllocator<int>> vector(alloc);
+    for (int i = 0; i < 1000; ++i)
+        vector.push_back(i);
+    REQUIRE(manger.allocations() == 1);
+    vector.clear();
+    vector.shrink_to_fit();
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.available() == available);
+
+    // Not formatted memory region
+    std::vector<uint64_t> garbage(1024, 0xFFFFFFFFFFFFFFFFull);
+    REQUIRE_THROWS(SharedMemoryManager(garbage.data(), garbage.size() * sizeof(uint64_t)));
+}
+
 TEST_CASE("Null memory manager", "[CppCommon][Memory]")
 {
     NullMemoryManager manger;
@@ -248,6 +410,76 @@ TEST_CASE("Arena memory manager with a dynamic buffer", "[CppCommon][Memory]")
     REQUIRE(manger.allocations() == 0);
 }
 
+TEST_CASE("Arena memory manager savepoints", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+
+    // Nested phases with a dynamic buffer
+    {
+        ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 1024);
+
+        void* result = manger.malloc(100);
+        REQUIRE(result != nullptr);
+
+        size_t pages = 0;
+        for (int request = 0; request < 10; ++request)
+        {
+            ArenaScope<DefaultMemoryManager> parse(manger);
+            uint8_t* first = (uint8_t*)manger.malloc(3000);
+            REQUIRE(first != nullptr);
+            std::memset(first, 1, 3000);
+
+            {
+                ArenaScope<DefaultMemoryManager> plan(manger);
+                for (int i = 0; i < 10; ++i)
+                    REQUIRE(manger.malloc(1000) != nullptr);
+                REQUIRE(manger.allocations() == 12);
+            }
+            REQUIRE(manger.allocations() == 2);
+            REQUIRE(manger.allocated() == 3100);
+
+            // Data allocated before the nested scope is kept
+            REQUIRE(first[2999] == 1);
+
+            // Arena pages are reused by next requests without growing
+            if (request == 0)
+                pages = auxiliary.allocations();
+            REQUIRE(auxiliary.allocations() == pages);
+        }
+        REQUIRE(manger.allocations() == 1);
+        REQUIRE(manger.allocated() == 100);
+
+        // Rollback to the explicit savepoint
+        auto mark = manger.mark();
+        void* ptr1 = manger.malloc(10);
+        manger.rollback(mark);
+        void* ptr2 = manger.malloc(10);
+        REQUIRE(ptr1 == ptr2);
+        manger.free(ptr2, 10);
+
+        manger.free(result, 100);
+        manger.reset();
+    }
+    REQUIRE(auxiliary.allocations() == 0);
+
+    // Nested phases with a fixed buffer
+    {
+        uint8_t buffer[1024];
+        ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, buffer, sizeof(buffer));
+
+        REQUIRE(manger.malloc(100) != nullptr);
+        {
+            ArenaScope<DefaultMemoryManager> scope(manger);
+            REQUIRE(manger.malloc(500) != nullptr);
+            REQUIRE(manger.size() >= 600);
+        }
+        REQUIRE(manger.size() >= 100);
+        REQUIRE(manger.size() < 600);
+        REQUIRE(manger.allocations() == 1);
+        manger.free_all();
+    }
+}
+
 TEST_CASE("Arena allocator with stl direct access containers", "[CppCommon][Memory]")
 {
     DefaultMemoryManager auxiliary;
@@ -286,6 +518,63 @@ TEST_CASE("Arena allocator with stl associative containers", "[CppCommon][Memory
     u.clear();
 }
 
+TEST_CASE("Scratch allocator", "[CppCommon][Memory]")
+{
+    REQUIRE(ScratchArena::depth() == 0);
+
+    size_t pages = 0;
+    for (int request = 0; request < 10; ++request)
+    {
+        ScratchScope scope;
+        REQUIRE(ScratchArena::depth() == 1);
+
+        std::vector<int, ScratchAllocator<int>> v;
+        for (int i = 0; i < 10000; ++i)
+            v.push_back(i);
+        REQUIRE(v.get_allocator().arena().allocations() > 0);
+
+        {
+            ScratchScope nested;
+            REQUIRE(ScratchArena::depth() == 2);
+
+            SmallVector<int, 4, ScratchAllocator<int>> sv;
+            for (int i = 0; i < 100; ++i)
+                sv.push_back(v[i]);
+            REQUIRE(sv.size() == 100);
+            REQUIRE(sv[99] == 99);
+        }
+        REQUIRE(ScratchArena::depth() == 1);
+
+        std::list<int, ScratchAllocator<int>> l;
+        l.push_back(0);
+        l.push_back(1);
+        REQUIRE(l.back() == 1);
+
+        // Arena pages are reused by next requests without growing
+        if (request == 0)
+            pages = scope.arena().auxiliary().allocations();
+        REQUIRE(scope.arena().auxiliary().allocations() == pages);
+    }
+    REQUIRE(ScratchArena::depth() == 0);
+    REQUIRE(ScratchArena::Current().allocations() == 0);
+    REQUIRE(ScratchArena::Current().allocated() == 0);
+
+    // Each thread has its own scratch arena
+    ArenaMemoryManager<>* arena = &ScratchArena::Current();
+    ArenaMemoryManager<>* other = nullptr;
+    std::thread([&other]()
+    {
+        ScratchScope scope;
+        std::vector<int, ScratchAllocator<int>> v(100, 1);
+        other = &v.get_allocator().arena();
+    }).join();
+    REQUIRE(other != nullptr);
+    REQUIRE(other != arena);
+
+    ScratchArena::Reset();
+    REQUIRE(ScratchArena::Current().allocations() == 0);
+}
+
 TEST_CASE("Pool memory manager with a fixed buffer", "[CppCommon][Memory]")
 {
     DefaultMemoryManager auxiliary;
@@ -403,6 +692,15 @@ TEST_CASE("Pool memory manager with a dynamic buffer", "[CppCommon][Memory]")
     REQUIRE(manger.allocated() == 0);
     REQUIRE(manger.allocations() == 0);
     REQUIRE(manger.page() == 80);
+
+    // Blocks which do not fit into the page with the header are huge
+    ptr = manger.malloc(80);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 80);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 80);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
 }
 
 TEST_CASE("Pool allocator with stl direct access containers", "[CppCommon][Memory]")
@@ -442,3 +740,429 @@ TEST_CASE("Pool allocator with stl associative containers", "[CppCommon][Memory]
     u[2] = 20;
     u.clear();
 }
+
+TEST_CASE("Arena and pool memory managers free all blocks at once", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary, 16);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(arena.malloc(10, 1) != nullptr);
+    REQUIRE(arena.allocated() == 1000);
+    REQUIRE(arena.allocations() == 100);
+    arena.free_all();
+    REQUIRE(arena.allocated() == 0);
+    REQUIRE(arena.allocations() == 0);
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.malloc(10, 1) != nullptr);
+    arena.free_all();
+
+    uint8_t buffer[1024];
+    ArenaMemoryManager<DefaultMemoryManager> fixed(auxiliary, buffer, sizeof(buffer));
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(fixed.malloc(10, 1) != nullptr);
+    fixed.free_all();
+    REQUIRE(fixed.allocations() == 0);
+    REQUIRE(fixed.size() == 0);
+
+    PoolMemoryManager<DefaultMemoryManager> pool(auxiliary, 256);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(pool.malloc(10, 1) != nullptr);
+    REQUIRE(pool.allocated() == 1000);
+    REQUIRE(pool.allocations() == 100);
+    pool.free_all();
+    REQUIRE(pool.allocated() == 0);
+    REQUIRE(pool.allocations() == 0);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(pool.malloc(10, 1) != nullptr);
+    pool.free_all();
+
+    PoolMemoryManager<DefaultMemoryManager> fixed_pool(auxiliary, buffer, sizeof(buffer));
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(fixed_pool.malloc(10, 1) != nullptr);
+    fixed_pool.free_all();
+    REQUIRE(fixed_pool.allocations() == 0);
+    REQUIRE(fixed_pool.malloc(10, 1) != nullptr);
+    fixed_pool.free_all();
+}
+
+TEST_CASE("Stack memory manager alignment", "[CppCommon][Memory]")
+{
+    StackMemoryManager<64> manger;
+
+    uint8_t* ptr1 = (uint8_t*)manger.malloc(1, 1);
+    uint8_t* ptr2 = (uint8_t*)manger.malloc(8, 8);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr2, 8));
+    REQUIRE(ptr2 >= ptr1 + 1);
+    REQUIRE(manger.size() == (size_t)(ptr2 + 8 - manger.buffer()));
+
+    // Aligned blocks must not overlap each other
+    uint8_t* ptr3 = (uint8_t*)manger.malloc(1, 1);
+    REQUIRE(ptr3 == ptr2 + 8);
+
+    manger.free(ptr3, 1);
+    manger.free(ptr2, 8);
+    manger.free(ptr1, 1);
+    manger.reset();
+    REQUIRE(manger.size() == 0);
+}
+
+TEST_CASE("Thread cache memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager central;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manger(central, 4, 8);
+    REQUIRE(manger.batch() == 4);
+    REQUIRE(manger.capacity() == 8);
+
+    // Small blocks of all size classes
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t size = 1; size <= 2048; size += 7)
+    {
+        void* ptr = manger.malloc(size);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(Memory::IsAligned(ptr, alignof(std::max_align_t)));
+        std::memset(ptr, (int)size, size);
+        blocks.emplace_back(ptr, size);
+    }
+    REQUIRE(manger.allocations() == blocks.size());
+    for (auto& block : blocks)
+    {
+        REQUIRE(((uint8_t*)block.first)[block.second - 1] == (uint8_t)block.second);
+        manger.free(block.first, block.second);
+    }
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Freed block is reused from the thread free list
+    void* ptr = manger.malloc(100);
+    manger.free(ptr, 100);
+    REQUIRE(manger.malloc(100) == ptr);
+    manger.free(ptr, 100);
+
+    // Aligned small blocks
+    for (size_t alignment = 32; alignment <= 2048; alignment *= 2)
+    {
+        ptr = manger.malloc(24, alignment);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(Memory::IsAligned(ptr, alignment));
+        manger.free(ptr, 24);
+    }
+
+    // Huge blocks
+    ptr = manger.malloc(100000);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 100000);
+    REQUIRE(central.allocated() >= 100000);
+    manger.free(ptr, 100000);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.reset();
+    REQUIRE(central.allocations() == 0);
+}
+
+TEST_CASE("Thread cache allocator with stl containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager central;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manger(central);
+
+    ThreadCacheAllocator<int, DefaultMemoryManager> alloc(manger);
+    std::vector<int, decltype(alloc)> v(alloc);
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(i);
+    v.clear();
+    v.shrink_to_fit();
+
+    ThreadCacheAllocator<std::pair<const int, int>, DefaultMemoryManager> map_alloc(manger);
+    std::map<int, int, std::less<>, decltype(map_alloc)> m(map_alloc);
+    for (int i = 0; i < 1000; ++i)
+        m[i] = i * 10;
+    REQUIRE(m[500] == 5000);
+    m.clear();
+
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Thread cache memory manager with multiple threads", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager central;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manger(central, 16, 64);
+
+    const size_t threads = 4;
+    const size_t items = 10000;
+
+    // Several rounds to adopt thread caches of exited threads
+    for (size_t round = 0; round < 3; ++round)
+    {
+        std::vector<std::vector<uint64_t*>> blocks(threads);
+
+        // Each thread allocates its blocks
+        std::vector<std::thread> producers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            producers.emplace_back([&manger, &blocks, t, items]()
+            {
+                for (size_t i = 0; i < items; ++i)
+                {
+                    size_t size = 8 + ((i * 8) % 256);
+                    uint64_t* ptr = (uint64_t*)manger.malloc(size);
+                    ptr[0] = t * items + i;
+                    blocks[t].push_back(ptr);
+                }
+            });
+        }
+        for (auto& producer : producers)
+            producer.join();
+        REQUIRE(manger.allocations() == threads * items);
+
+        // Other threads free blocks concurrently with new allocations
+        std::vector<std::thread> consumers;
+        std::atomic<size_t> errors(0);
+        for (size_t t = 0; t < threads; ++t)
+        {
+            consumers.emplace_back([&manger, &blocks, &errors, t, threads, items]()
+            {
+                size_t source = (t + 1) % threads;
+                for (size_t i = 0; i < items; ++i)
+                {
+                    size_t size = 8 + ((i * 8) % 256);
+                    uint64_t* ptr = blocks[source][i];
+                    if (ptr[0] != (source * items + i))
+                        ++errors;
+                    manger.free(ptr, size);
+
+                    // Allocate and free the own block
+                    void* own = manger.malloc(size);
+                    manger.free(own, size);
+                }
+            });
+        }
+        for (auto& consumer : consumers)
+            consumer.join();
+        REQUIRE(errors == 0);
+        REQUIRE(manger.allocated() == 0);
+        REQUIRE(manger.allocations() == 0);
+    }
+}
+
+TEST_CASE("Huge page memory manager", "[CppCommon][Memory]")
+{
+    size_t page = HugePageMemoryManager::HugePageSize();
+    REQUIRE(page > 0);
+    REQUIRE(Memory::IsValidAlignment(page));
+    REQUIRE(HugePageMemoryManager::NumaNodes() > 0);
+
+    HugePageMemoryManager manger;
+    REQUIRE(manger.node() < 0);
+
+    uint8_t* ptr = (uint8_t*)manger.malloc(3 * page / 2, 64);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(Memory::IsAligned(ptr, 4096));
+    REQUIRE(manger.allocated() == (3 * page / 2));
+    REQUIRE(manger.allocations() == 1);
+    std::memset(ptr, 0xAB, 3 * page / 2);
+    REQUIRE(ptr[3 * page / 2 - 1] == 0xAB);
+    manger.free(ptr, 3 * page / 2);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Bind memory blocks to the first NUMA node
+    HugePageMemoryManager numa(0);
+    REQUIRE(numa.node() == 0);
+    ptr = (uint8_t*)numa.malloc(100);
+    REQUIRE(ptr != nullptr);
+    ptr[99] = 1;
+    numa.free(ptr, 100);
+
+    // Huge page memory manager as an auxiliary memory manager of the arena
+    {
+        ArenaMemoryManager<HugePageMemoryManager> arena(manger, page);
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE(arena.malloc(1000) != nullptr);
+        REQUIRE(manger.allocations() > 0);
+        arena.free_all();
+        REQUIRE(arena.allocations() == 0);
+    }
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Slab memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manger(auxiliary, 4096);
+    REQUIRE(manger.slab() == 4096);
+    REQUIRE(manger.slabs() == 0);
+
+    // Mixed blocks with random lifetimes
+    std::vector<std::pair<uint8_t*, size_t>> blocks;
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        seed = seed * 1664525 + 1013904223;
+        if (!blocks.empty() && ((seed >> 28) < 7))
+        {
+            size_t index = (seed >> 8) % blocks.size();
+            auto block = blocks[index];
+            REQUIRE(block.first[0] == (uint8_t)block.second);
+            REQUIRE(block.first[block.second - 1] == (uint8_t)block.second);
+            manger.free(block.first, block.second);
+            blocks[index] = blocks.back();
+            blocks.pop_back();
+        }
+        else
+        {
+            size_t size = 16 + (seed >> 8) % 497;
+            uint8_t* ptr = (uint8_t*)manger.malloc(size);
+            REQUIRE(ptr != nullptr);
+            REQUIRE(Memory::IsAligned(ptr, alignof(std::max_align_t)));
+            std::memset(ptr, (int)size, size);
+            blocks.emplace_back(ptr, size);
+        }
+    }
+    REQUIRE(manger.allocations() == blocks.size());
+    for (auto& block : blocks)
+    {
+        REQUIRE(block.first[0] == (uint8_t)block.second);
+        REQUIRE(block.first[block.second - 1] == (uint8_t)block.second);
+        manger.free(block.first, block.second);
+    }
+    blocks.clear();
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Empty slabs are returned to the auxiliary memory manager except one for each size class
+    for (size_t i = 0; i < 1000; ++i)
+        blocks.emplace_back((uint8_t*)manger.malloc(64), 64);
+    size_t slabs = manger.slabs();
+    REQUIRE(slabs > 10);
+    for (auto& block : blocks)
+        manger.free(block.first, block.second);
+    blocks.clear();
+    REQUIRE(manger.slabs() < slabs);
+    REQUIRE(auxiliary.allocations() == manger.slabs());
+
+    // Aligned small blocks
+    for (size_t alignment = 32; alignment <= 1024; alignment *= 2)
+    {
+        void* ptr = manger.malloc(24, alignment);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(Memory::IsAligned(ptr, alignment));
+        manger.free(ptr, 24);
+    }
+
+    // Huge blocks
+    void* ptr = manger.malloc(100000);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 100000);
+    manger.free(ptr, 100000);
+    REQUIRE(manger.allocations() == 0);
+
+    // Free all blocks at once
+    for (size_t i = 0; i < 1000; ++i)
+        REQUIRE(manger.malloc(16 + i % 1000) != nullptr);
+    manger.free_all();
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.slabs() == 0);
+    REQUIRE(auxiliary.allocations() == 0);
+}
+
+TEST_CASE("Slab allocator with stl containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manger(auxiliary);
+
+    SlabAllocator<int, DefaultMemoryManager> list_alloc(manger);
+    std::list<int, decltype(list_alloc)> l(list_alloc);
+    for (int i = 0; i < 1000; ++i)
+        l.push_back(i);
+    REQUIRE(l.size() == 1000);
+
+    SlabAllocator<std::pair<const int, int>, DefaultMemoryManager> map_alloc(manger);
+    std::map<int, int, std::less<>, decltype(map_alloc)> m(map_alloc);
+    for (int i = 0; i < 1000; ++i)
+        m[i] = i * 10;
+    REQUIRE(m[500] == 5000);
+
+    l.clear();
+    m.clear();
+    REQUIRE(manger.allocations() == 0);
+
+    manger.reset();
+    REQUIRE(auxiliary.allocations() == 0);
+}
+
+TEST_CASE("Profiling memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+
+    // Sample all allocations
+    {
+        ProfilingMemoryManager<DefaultMemoryManager> manger(auxiliary, 1);
+        REQUIRE(manger.profiler().rate() == 1);
+
+        std::vector<void*> small;
+        ProfilingBlocksGuard small_guard(manger, small, 64);
+        for (int i = 0; i < 100; ++i)
+            small.push_back(manger.malloc(64));
+        std::vector<void*> big;
+        ProfilingBlocksGuard big_guard(manger, big, 1000);
+        for (int i = 0; i < 10; ++i)
+            big.push_back(manger.malloc(1000));
+        REQUIRE(manger.profiler().samples() == 110);
+        REQUIRE(manger.profiler().tracked() == 110);
+
+        auto callsites = manger.profiler().callsites();
+        REQUIRE(callsites.size() == 2);
+        REQUIRE(!callsites[0].frames.empty());
+        REQUIRE(callsites[0].live_bytes == 10000);
+        REQUIRE(callsites[0].live_allocations == 10);
+        REQUIRE(callsites[0].histogram[10] == 10);
+        REQUIRE(callsites[1].live_bytes == 6400);
+        REQUIRE(callsites[1].live_allocations == 100);
+        REQUIRE(callsites[1].histogram[6] == 100);
+
+        // Released allocations keep the churn statistics
+        big_guard.Free();
+        callsites = manger.profiler().callsites();
+        REQUIRE(callsites[0].live_bytes == 6400);
+        REQUIRE(callsites[1].live_bytes == 0);
+        REQUIRE(callsites[1].bytes == 10000);
+        REQUIRE(callsites[1].allocations == 10);
+
+        std::string report = manger.profiler().report(1);
+        REQUIRE(report.find("Allocation profile") == 0);
+        REQUIRE(report.find("#1 live: 6400 bytes in 100 allocations") != std::string::npos);
+        REQUIRE(report.find("#2") == std::string::npos);
+
+        small_guard.Free();
+        REQUIRE(manger.profiler().tracked() == 0);
+        REQUIRE(manger.allocations() == 0);
+
+        manger.profiler().clear();
+        REQUIRE(manger.profiler().callsites().empty());
+    }
+
+    // Sampled allocations estimate allocated bytes
+    {
+        ProfilingMemoryManager<DefaultMemoryManager> manger(auxiliary, 4096);
+
+        std::vector<void*> blocks;
+        ProfilingBlocksGuard guard(manger, blocks, 64);
+        for (int i = 0; i < 100000; ++i)
+            blocks.push_back(manger.malloc(64));
+        REQUIRE(manger.profiler().samples() > 0);
+        REQUIRE(manger.profiler().samples() < 100000);
+
+        auto callsites = manger.profiler().callsites();
+        REQUIRE(callsites.size() == 1);
+        REQUIRE(callsites[0].bytes > 5760000);
+        REQUIRE(callsites[0].bytes < 7040000);
+
+        guard.Free();
+        REQUIRE(manger.profiler().tracked() == 0);
+        REQUIRE(manger.profiler().callsites()[0].live_bytes == 0);
+    }
+
+    REQUIRE(auxiliary.allocations() == 0);
+}
@@ -0,0 +1,59 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "memory/cache_padded.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Counters
+{
+    CachePadded<std::atomic<size_t>> head;
+    CachePadded<std::atomic<size_t>> tail;
+};
+
+} // namespace
+
+TEST_CASE("Cache padded", "[CppCommon][Memory]")
+{
+    REQUIRE(hardware_destructive_interference_size >= hardware_constructive_interference_size);
+    REQUIRE((hardware_destructive_interference_size & (hardware_destructive_interference_size - 1)) == 0);
+
+    // Padded values are aligned and never share a cache line
+    REQUIRE(alignof(CachePadded<char>) == hardware_destructive_interference_size);
+    REQUIRE(sizeof(CachePadded<char>) == hardware_destructive_interference_size);
+    REQUIRE(sizeof(Counters) == 2 * hardware_destructive_interference_size);
+
+    Counters counters;
+    REQUIRE(((uintptr_t)&counters.head % hardware_destructive_interference_size) == 0);
+    REQUIRE(((uintptr_t)&counters.tail - (uintptr_t)&counters.head) >= hardware_destructive_interference_size);
+    counters.head->store(10);
+    counters.tail->fetch_add(5);
+    REQUIRE(counters.head->load() == 10);
+    REQUIRE(counters.tail.get().load() == 5);
+
+    // Padded values in containers
+    std::vector<CachePadded<std::string>> values;
+    for (int i = 0; i < 100; ++i)
+        values.emplace_back(std::to_string(i));
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(((uintptr_t)&values[i] % hardware_destructive_interference_size) == 0);
+        REQUIRE(*values[i] == std::to_string(i));
+    }
+
+    // Padded values on the heap
+    auto padded = std::make_unique<CachePadded<uint64_t>>(42);
+    REQUIRE(((uintptr_t)padded.get() % hardware_destructive_interference_size) == 0);
+    REQUIRE(**padded == 42);
+}
@@ -6,6 +6,9 @@
 
 #include "memory/memory.h"
 
+#include <cstring>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Memory management", "[CppCommon][Memory]")
@@ -46,3 +49,63 @@ TEST_CASE("Memory align", "[CppCommon][Memory]")
     REQUIRE(Memory::Align((void*)0x7fff5ebcf47e, 32, false) == (void*)0x7fff5ebcf460);
     REQUIRE(Memory::Align((void*)0x7fff5ebcf4af, 64, false) == (void*)0x7fff5ebcf480);
 }
+
+TEST_CASE("Memory bulk operations", "[CppCommon][Memory]")
+{
+    // Check both regular and non-temporal paths with unaligned buffers
+    for (size_t size : { (size_t)0, (size_t)1, (size_t)63, (size_t)1000, Memory::NON_TEMPORAL_THRESHOLD + 77 })
+    {
+        std::vector<uint8_t> source(size + 1);
+        std::vector<uint8_t> destination(size + 1);
+        for (size_t i = 0; i < source.size(); ++i)
+            source[i] = (uint8_t)(i * 7 + 1);
+
+        Memory::StreamCopy(destination.data() + 1, source.data() + 1, size);
+        REQUIRE(std::memcmp(destination.data() + 1, source.data() + 1, size) == 0);
+
+        Memory::StreamFill(destination.data() + 1, 0xAB, size);
+        for (size_t i = 1; i < destination.size(); ++i)
+            REQUIRE(destination[i] == 0xAB);
+
+        Memory::ZeroFill(destination.data() + 1, size);
+        REQUIRE(Memory::IsZero(destination.data() + 1, size));
+        if (size > 0)
+        {
+            // Non-zero byte at any position must be found
+            for (size_t i : { (size_t)0, size / 2, size - 1 })
+            {
+                destination[1 + i] = 1;
+                REQUIRE(!Memory::IsZero(destination.data() + 1, size));
+                destination[1 + i] = 0;
+            }
+        }
+
+        Memory::PrefetchRange(source.data(), source.size());
+        Memory::PrefetchRange(destination.data(), destination.size(), true);
+    }
+}
+
+TEST_CASE("Memory random fill", "[CppCommon][Memory]")
+{
+    for (size_t size : { (size_t)16, Memory::RANDOM_THRESHOLD, (size_t)100001 })
+    {
+        std::vector<uint8_t> buffer1(size);
+        std::vector<uint8_t> buffer2(size);
+        Memory::RandomFill(buffer1.data(), buffer1.size());
+        Memory::RandomFill(buffer2.data(), buffer2.size());
+        REQUIRE(!Memory::IsZero(buffer1.data(), buffer1.size()));
+        REQUIRE(buffer1 != buffer2);
+    }
+
+    // Random bytes should be evenly distributed
+    std::vector<uint8_t> buffer(1 << 20);
+    Memory::RandomFill(buffer.data(), buffer.size());
+    size_t counts[256] = {};
+    for (uint8_t byte : buffer)
+        ++counts[byte];
+    for (size_t count : counts)
+    {
+        REQUIRE(count > 3500);
+        REQUIRE(count < 4700);
+    }
+}
@@ -0,0 +1,129 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "memory/object_pool.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Message
+{
+    static std::atomic<int> alive;
+
+    int id;
+    std::string text;
+
+    Message(int i, const std::string& t) : id(i), text(t) { ++alive; }
+    ~Message() { --alive; }
+};
+
+std::atomic<int> Message::alive(0);
+
+} // namespace
+
+TEST_CASE("Object pool", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager manager;
+    {
+        ObjectPool<Message> pool(manager, 4);
+        REQUIRE(pool.magazine() == 4);
+        REQUIRE(pool.capacity() == 0);
+
+        Message* message = pool.Create(1, "test");
+        REQUIRE(message != nullptr);
+        REQUIRE(message->id == 1);
+        REQUIRE(message->text == "test");
+        REQUIRE(Message::alive == 1);
+        REQUIRE(pool.capacity() == 4);
+        REQUIRE(manager.allocations() == 1);
+
+        // Released slot is reused
+        pool.Release(message);
+        REQUIRE(Message::alive == 0);
+        REQUIRE(pool.Create(2, "reused") == message);
+        pool.Release(message);
+
+        // Steady state does not touch the memory manager
+        std::vector<Message*> messages;
+        for (int i = 0; i < 16; ++i)
+            messages.push_back(pool.Create(i, "batch"));
+        REQUIRE(pool.capacity() == 16);
+        REQUIRE(pool.chunks() == 4);
+        for (int j = 0; j < 100; ++j)
+        {
+            for (auto ptr : messages)
+                pool.Release(ptr);
+            for (auto& ptr : messages)
+                ptr = pool.Create(j, "batch");
+        }
+        REQUIRE(pool.capacity() == 16);
+        REQUIRE(manager.allocations() == 4);
+        for (auto ptr : messages)
+            pool.Release(ptr);
+        REQUIRE(Message::alive == 0);
+    }
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("Object pool multithreaded", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager manager;
+    ObjectPool<Message> pool(manager, 16);
+
+    const int threads_count = 4;
+    const int iterations = 10000;
+    const int batch = 100;
+
+    // Objects are created and released by different threads
+    std::atomic<Message*> exchange[threads_count];
+    for (auto& slot : exchange)
+        slot = nullptr;
+
+    std::atomic<bool> failed(false);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&pool, &exchange, &failed, t]()
+        {
+            std::vector<Message*> messages;
+            for (int i = 0; i < iterations; ++i)
+            {
+                for (int j = 0; j < batch / 10; ++j)
+                    messages.push_back(pool.Create(i, "message"));
+
+                // Hand over one object to the other thread
+                Message* other = exchange[(t + 1) % threads_count].exchange(messages.back());
+                messages.pop_back();
+                if (other != nullptr)
+                    messages.push_back(other);
+
+                for (auto ptr : messages)
+                {
+                    if (ptr->text != "message")
+                        failed = true;
+                    pool.Release(ptr);
+                }
+                messages.clear();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& slot : exchange)
+        pool.Release(slot.exchange(nullptr));
+
+    REQUIRE(!failed);
+    REQUIRE(Message::alive == 0);
+    REQUIRE(pool.capacity() <= (size_t)(threads_count * (batch + 64)));
+}
@@ -0,0 +1,117 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "cache/memcache.h"
+#include "filesystem/directory.h"
+#include "filesystem/file.h"
+#include "memory/memory_pressure.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Memory pressure status", "[CppCommon][Memory]")
+{
+    MemoryPressure pressure;
+    MemoryPressureStatus status = pressure.status();
+    REQUIRE(status.limit > 0);
+    REQUIRE(status.usage >= 0);
+    REQUIRE(status.available() >= 0);
+    REQUIRE(status.utilization() >= 0.0);
+    REQUIRE(status.utilization() <= 1.0);
+}
+
+TEST_CASE("Memory pressure cgroup", "[CppCommon][Memory]")
+{
+    Path path = Path::temp() / "test_memory_pressure";
+    Directory::CreateTree(path);
+    File::WriteAllText(path / "memory.max", "1000000\n");
+    File::WriteAllText(path / "memory.current", "900000\n");
+    File::WriteAllText(path / "memory.stat", "anon 500000\nfile 400000\nactive_file 200000\ninactive_file 200000\n");
+    File::WriteAllText(path / "memory.pressure", "some avg10=1.50 avg60=0.50 avg300=0.10 total=100\nfull avg10=0.25 avg60=0.00 avg300=0.00 total=10\n");
+
+    // Inactive page cache is not counted as used memory
+    MemoryPressure pressure(path.string());
+    MemoryPressureStatus status = pressure.status();
+    REQUIRE(status.cgroup);
+    REQUIRE(status.limit == 1000000);
+    REQUIRE(status.usage == 700000);
+    REQUIRE(status.available() == 300000);
+    REQUIRE(status.some == 1.5);
+    REQUIRE(status.full == 0.25);
+    REQUIRE(pressure.update() == MemoryPressureLevel::NORMAL);
+
+    // Unlimited cgroup falls back to the host memory
+    File::WriteAllText(path / "memory.max", "max\n");
+    REQUIRE(!pressure.status().cgroup);
+
+    Path::RemoveAll(path);
+}
+
+TEST_CASE("Memory pressure levels", "[CppCommon][Memory]")
+{
+    MemoryPressure pressure("/nonexistent");
+
+    std::vector<MemoryPressureLevel> levels;
+    size_t id = pressure.subscribe([&levels](MemoryPressureLevel level, const MemoryPressureStatus&) { levels.push_back(level); });
+
+    MemoryPressureStatus status;
+    status.limit = 1000;
+    status.usage = 100;
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::NORMAL);
+    REQUIRE(levels.empty());
+
+    // Subscribers are notified while the pressure lasts
+    status.usage = 850;
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::MODERATE);
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::MODERATE);
+    status.usage = 990;
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::CRITICAL);
+    REQUIRE(pressure.level() == MemoryPressureLevel::CRITICAL);
+
+    // Memory stalls raise the pressure level
+    status.usage = 100;
+    status.some = 20.0;
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::MODERATE);
+    status.some = 0.0;
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::NORMAL);
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::NORMAL);
+    REQUIRE(levels == std::vector<MemoryPressureLevel>({ MemoryPressureLevel::MODERATE, MemoryPressureLevel::MODERATE, MemoryPressureLevel::CRITICAL, MemoryPressureLevel::MODERATE, MemoryPressureLevel::NORMAL }));
+
+    // Custom thresholds
+    pressure.set_thresholds(0.05, 0.5);
+    REQUIRE(pressure.update(status) == MemoryPressureLevel::MODERATE);
+
+    REQUIRE(pressure.unsubscribe(id));
+    REQUIRE(!pressure.unsubscribe(id));
+}
+
+TEST_CASE("Memory pressure cache shedding", "[CppCommon][Memory]")
+{
+    MemCache<int, int> cache(4, 1000);
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(i, i);
+
+    MemoryPressure pressure("/nonexistent");
+    pressure.subscribe([&cache](MemoryPressureLevel level, const MemoryPressureStatus&)
+    {
+        if (level == MemoryPressureLevel::MODERATE)
+            cache.evict(cache.size() / 10);
+    });
+
+    MemoryPressureStatus status;
+    status.limit = 100;
+    status.usage = 90;
+    pressure.update(status);
+    REQUIRE(cache.size() == 900);
+    pressure.update(status);
+    REQUIRE(cache.size() == 810);
+
+    // Unbounded caches have no eviction order
+    MemCache<int, int> unbounded;
+    unbounded.insert(1, 1);
+    REQUIRE(unbounded.evict(1) == 0);
+}
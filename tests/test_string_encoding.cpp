@@ -6,6 +6,10 @@
 
 #include "string/encoding.h"
 
+#include <cctype>
+#include <random>
+#include <vector>
+
 using namespace CppCommon;
 
 namespace {
@@ -24,6 +28,29 @@ void test(const std::string& utf8, const std::u16string& utf16, const std::u32st
     REQUIRE(str == utf8);
 }
 
+// Reference bitwise encoder of the power of two base
+std::string reference(const std::string& str, const char* alphabet, int bits, size_t block)
+{
+    std::string result;
+    uint32_t buffer = 0;
+    int count = 0;
+    for (unsigned char ch : str)
+    {
+        buffer = (buffer << 8) | ch;
+        count += 8;
+        while (count >= bits)
+        {
+            count -= bits;
+            result.push_back(alphabet[(buffer >> count) & ((1 << bits) - 1)]);
+        }
+    }
+    if (count > 0)
+        result.push_back(alphabet[(buffer << (bits - count)) & ((1 << bits) - 1)]);
+    while ((result.size() % block) != 0)
+        result.push_back('=');
+    return result;
+}
+
 } // namespace
 
 TEST_CASE("Encoding", "[CppCommon][String]")
@@ -39,6 +66,90 @@ TEST_CASE("Encoding", "[CppCommon][String]")
     test("\xF0\x9D\x93\x83", u"\xD835\xDCC3", U"\x0001D4C3");
 }
 
+TEST_CASE("Encoding invalid sequences", "[CppCommon][String]")
+{
+    // Overlong forms, surrogates, truncated sequences and too large code points
+    REQUIRE(Encoding::UTF8toUTF16("a\xC0\xAF" "b") == u"a\xFFFD\xFFFD" u"b");
+    REQUIRE(Encoding::UTF8toUTF16("a\xE2\x82" "b") == u"a\xFFFD" u"b");
+    REQUIRE(Encoding::UTF8toUTF16("\xED\xA0\x80") == u"\xFFFD\xFFFD\xFFFD");
+    REQUIRE(Encoding::UTF8toUTF32("\xF4\x90\x80\x80") == U"\x0000FFFD\x0000FFFD\x0000FFFD\x0000FFFD");
+    REQUIRE(Encoding::UTF8toUTF32("\xF0\x9D\x93") == U"\x0000FFFD");
+    REQUIRE(Encoding::UTF8toUTF32("\x80\xFF") == U"\x0000FFFD\x0000FFFD");
+
+    // Unpaired surrogates and invalid code points
+    REQUIRE(Encoding::UTF16toUTF8(u"a\xD835") == "a\xEF\xBF\xBD");
+    REQUIRE(Encoding::UTF16toUTF8(u"\xDCC3\xD835\xDCC3") == "\xEF\xBF\xBD\xF0\x9D\x93\x83");
+    REQUIRE(Encoding::UTF16toUTF32(u"\xDCC3" u"a") == U"\x0000FFFD\x00000061");
+    REQUIRE(Encoding::UTF32toUTF8(U"\x0000D800") == "\xEF\xBF\xBD");
+    REQUIRE(Encoding::UTF32toUTF16(std::u32string(1, (char32_t)0x110000)) == u"\xFFFD");
+
+    // Validation
+    REQUIRE(Encoding::ValidateUTF8(""));
+    REQUIRE(Encoding::ValidateUTF8("Hello, World!"));
+    REQUIRE(Encoding::ValidateUTF8("\xC4\x8D\xE2\x84\xA6\xF0\x9D\x93\x83\xEF\xBF\xBD"));
+    REQUIRE(!Encoding::ValidateUTF8("\xC0\xAF"));
+    REQUIRE(!Encoding::ValidateUTF8("\xE0\x80\xAF"));
+    REQUIRE(!Encoding::ValidateUTF8("\xED\xA0\x80"));
+    REQUIRE(!Encoding::ValidateUTF8("\xF4\x90\x80\x80"));
+    REQUIRE(!Encoding::ValidateUTF8("\xF8\x88\x80\x80\x80"));
+    REQUIRE(!Encoding::ValidateUTF8("abc\xE2\x82"));
+    REQUIRE(!Encoding::ValidateUTF8("abc\x80"));
+}
+
+TEST_CASE("Encoding buffers", "[CppCommon][String]")
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> kinds(0, 9);
+    std::uniform_int_distribution<uint32_t> points(0, 0x10FFFF);
+    std::uniform_int_distribution<int> bytes(0, 255);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        // Random text with long ASCII runs and all kinds of other code points
+        std::u32string utf32;
+        size_t length = generator() % 300;
+        for (size_t j = 0; j < length; ++j)
+        {
+            uint32_t cp = (kinds(generator) < 6) ? (uint32_t)('a' + (j % 26)) : points(generator);
+            if ((cp >= 0xD800) && (cp <= 0xDFFF))
+                cp -= 0x800;
+            utf32.push_back((char32_t)cp);
+        }
+
+        std::string utf8 = Encoding::UTF32toUTF8(utf32);
+        std::u16string utf16 = Encoding::UTF32toUTF16(utf32);
+        REQUIRE(Encoding::ValidateUTF8(utf8));
+        test(utf8, utf16, utf32);
+
+        // Exact and too small output buffers
+        std::vector<char> buffer8(utf8.size());
+        std::vector<char16_t> buffer16(utf16.size());
+        std::vector<char32_t> buffer32(utf32.size());
+        REQUIRE(Encoding::UTF16toUTF8(utf16, buffer8.data(), buffer8.size()) == utf8.size());
+        REQUIRE(std::string(buffer8.begin(), buffer8.end()) == utf8);
+        REQUIRE(Encoding::UTF8toUTF16(utf8, buffer16.data(), buffer16.size()) == utf16.size());
+        REQUIRE(std::u16string(buffer16.begin(), buffer16.end()) == utf16);
+        REQUIRE(Encoding::UTF8toUTF32(utf8, buffer32.data(), buffer32.size()) == utf32.size());
+        REQUIRE(std::u32string(buffer32.begin(), buffer32.end()) == utf32);
+        if (!utf32.empty())
+        {
+            REQUIRE(Encoding::UTF32toUTF8(utf32, buffer8.data(), buffer8.size() - 1) == 0);
+            REQUIRE(Encoding::UTF32toUTF16(utf32, buffer16.data(), buffer16.size() - 1) == 0);
+            REQUIRE(Encoding::UTF16toUTF32(utf16, buffer32.data(), buffer32.size() - 1) == 0);
+        }
+
+        // Corrupted text is valid only if it survives the round trip
+        std::string corrupted = utf8;
+        if (!corrupted.empty())
+            corrupted[generator() % corrupted.size()] = (char)bytes(generator);
+        if (kinds(generator) < 3)
+            corrupted.push_back((char)(0x80 + bytes(generator) % 0x80));
+        bool valid = (Encoding::UTF32toUTF8(Encoding::UTF8toUTF32(corrupted)) == corrupted);
+        REQUIRE(Encoding::ValidateUTF8(corrupted) == valid);
+        REQUIRE(Encoding::ValidateUTF8(Encoding::UTF16toUTF8(Encoding::UTF8toUTF16(corrupted))));
+    }
+}
+
 TEST_CASE("Base16 Encoding", "[CppCommon][String]")
 {
     REQUIRE(Encoding::Base16Encode("") == "");
@@ -78,8 +189,106 @@ TEST_CASE("Base64 Encoding", "[CppCommon][String]")
     REQUIRE(Encoding::Base64Decode("U2FtcGxlIEJhc2U2NCBlbmNvZGluZzogfmAnIiE/QCMkJV4mKigpe31bXTw+LC46Oy0rPV98L1w=") == "Sample Base64 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
 }
 
+TEST_CASE("Base encodings buffers", "[CppCommon][String]")
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    // Sizes cover scalar tails and all vectorized blocks
+    for (size_t size = 0; size < 1000; size += ((size < 300) ? 1 : 97))
+    {
+        std::string str(size, 0);
+        for (auto& ch : str)
+            ch = (char)distribution(generator);
+
+        std::string base16 = Encoding::Base16Encode(str);
+        std::string base32 = Encoding::Base32Encode(str);
+        std::string base64 = Encoding::Base64Encode(str);
+        REQUIRE(base16 == reference(str, "0123456789ABCDEF", 4, 1));
+        REQUIRE(base32 == reference(str, "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567", 5, 8));
+        REQUIRE(base64 == reference(str, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", 6, 4));
+        REQUIRE(Encoding::Base16Decode(base16) == str);
+        REQUIRE(Encoding::Base32Decode(base32) == str);
+        REQUIRE(Encoding::Base64Decode(base64) == str);
+
+        // Lower case letters are decoded as well
+        std::string lower16 = base16;
+        std::string lower32 = base32;
+        for (auto& ch : lower16)
+            ch = (char)std::tolower(ch);
+        for (auto& ch : lower32)
+            ch = (char)std::tolower(ch);
+        REQUIRE(Encoding::Base16Decode(lower16) == str);
+        REQUIRE(Encoding::Base32Decode(lower32) == str);
+
+        // Buffers of the exact size
+        std::vector<char> buffer(std::max(base16.size(), (size_t)1));
+        REQUIRE(Encoding::Base16Encode(str, buffer.data(), base16.size()) == base16.size());
+        REQUIRE(std::string(buffer.data(), base16.size()) == base16);
+        REQUIRE(Encoding::Base16Decode(base16, buffer.data(), Encoding::Base16DecodeSize(base16)) == size);
+        REQUIRE(std::string(buffer.data(), size) == str);
+        REQUIRE(Encoding::Base32Encode(str, buffer.data(), Encoding::Base32EncodeSize(size)) == base32.size());
+        REQUIRE(std::string(buffer.data(), base32.size()) == base32);
+        REQUIRE(Encoding::Base32DecodeSize(base32) == size);
+        REQUIRE(Encoding::Base32Decode(base32, buffer.data(), size) == size);
+        REQUIRE(std::string(buffer.data(), size) == str);
+        REQUIRE(Encoding::Base64Encode(str, buffer.data(), Encoding::Base64EncodeSize(size)) == base64.size());
+        REQUIRE(std::string(buffer.data(), base64.size()) == base64);
+        REQUIRE(Encoding::Base64DecodeSize(base64) == size);
+        REQUIRE(Encoding::Base64Decode(base64, buffer.data(), size) == size);
+        REQUIRE(std::string(buffer.data(), size) == str);
+
+        // Too small buffers
+        if (size > 0)
+        {
+            REQUIRE(Encoding::Base16Encode(str, buffer.data(), base16.size() - 1) == 0);
+            REQUIRE(Encoding::Base32Encode(str, buffer.data(), base32.size() - 1) == 0);
+            REQUIRE(Encoding::Base64Encode(str, buffer.data(), base64.size() - 1) == 0);
+            REQUIRE(Encoding::Base32Decode(base32, buffer.data(), size - 1) == 0);
+            REQUIRE(Encoding::Base64Decode(base64, buffer.data(), size - 1) == 0);
+        }
+    }
+}
+
 TEST_CASE("URL Encoding", "[CppCommon][String]")
 {
     REQUIRE(Encoding::URLEncode("Sample URL encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\") == "Sample+URL+encoding%3A+~%60%27%22%21%3F%40%23%24%25%5E%26%2A%28%29%7B%7D%5B%5D%3C%3E%2C.%3A%3B-%2B%3D_%7C/%5C");
     REQUIRE(Encoding::URLDecode("Sample+URL+encoding%3A+~%60%27%22%21%3F%40%23%24%25%5E%26%2A%28%29%7B%7D%5B%5D%3C%3E%2C.%3A%3B-%2B%3D_%7C/%5C") == "Sample URL encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
+
+    // Invalid escape sequences
+    REQUIRE(Encoding::URLDecode("abc%") == "abc?");
+    REQUIRE(Encoding::URLDecode("abc%4") == "abc?");
+    REQUIRE(Encoding::URLDecode("abc%4G%41") == "abc?");
+    REQUIRE(Encoding::URLDecode("%7e%7E") == "~~");
+
+    // Buffers and in-place decoding
+    char buffer[64];
+    REQUIRE(Encoding::URLEncodeSize("a b&c") == 7);
+    REQUIRE(Encoding::URLEncode("a b&c", buffer, 7) == 7);
+    REQUIRE(std::string(buffer, 7) == "a+b%26c");
+    REQUIRE(Encoding::URLEncode("a b&c", buffer, 6) == 0);
+    REQUIRE(Encoding::URLDecode("a+b%26c", buffer, sizeof(buffer)) == 5);
+    REQUIRE(std::string(buffer, 5) == "a b&c");
+    REQUIRE(Encoding::URLDecode("a+b%26c", buffer, 6) == 0);
+    std::string inplace = "/path/to/resource?query=a%20b+c";
+    Encoding::URLDecodeInPlace(inplace);
+    REQUIRE(inplace == "/path/to/resource?query=a b c");
+
+    // Long strings with sparse and dense escape sequences
+    std::mt19937 generator(1);
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string source(generator() % 300, 0);
+        bool dense = (i % 2) == 0;
+        for (auto& ch : source)
+            ch = dense ? (char)(generator() % 256) : (((generator() % 50) == 0) ? ' ' : (char)('a' + generator() % 26));
+
+        std::string encoded = Encoding::URLEncode(source);
+        REQUIRE(encoded.size() == Encoding::URLEncodeSize(source));
+        for (char ch : encoded)
+            REQUIRE((std::isalnum((unsigned char)ch) || std::string_view("-./_~+%").find(ch) != std::string_view::npos));
+        REQUIRE(Encoding::URLDecode(encoded) == source);
+        Encoding::URLDecodeInPlace(encoded);
+        REQUIRE(encoded == source);
+    }
 }
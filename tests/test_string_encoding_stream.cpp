@@ -0,0 +1,164 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions.h"
+#include "string/encoding.h"
+#include "string/encoding_stream.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+// Transform the input splitted into random chunks
+std::string Transform(EncodingStream& stream, std::string_view input, std::mt19937& generator)
+{
+    std::string result;
+    std::vector<char> buffer;
+    // Unaligned chunks of the aligned storage
+    std::vector<char32_t> storage(input.size() / sizeof(char32_t) + 2);
+    char* data = (char*)storage.data() + 1;
+    std::memcpy(data, input.data(), input.size());
+    size_t offset = 0;
+    while (offset < input.size())
+    {
+        size_t size = std::min<size_t>(generator() % 17, input.size() - offset);
+        buffer.resize(stream.OutputSize(size));
+        result.append(buffer.data(), stream.Update(data + offset, size, buffer.data(), buffer.size()));
+        offset += size;
+    }
+    buffer.resize(stream.OutputSize(0));
+    result.append(buffer.data(), stream.Finish(buffer.data(), buffer.size()));
+    return result;
+}
+
+template <typename T>
+std::string_view Bytes(const std::basic_string<T>& str)
+{
+    return std::string_view((const char*)str.data(), str.size() * sizeof(T));
+}
+
+class StringReader : public Reader
+{
+public:
+    explicit StringReader(std::string_view data) : _data(data) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        // Short reads of the source reader
+        size_t count = std::min(std::min<size_t>(size, 7), _data.size());
+        std::memcpy(buffer, _data.data(), count);
+        _data.remove_prefix(count);
+        return count;
+    }
+
+private:
+    std::string_view _data;
+};
+
+class StringWriter : public Writer
+{
+public:
+    std::string data;
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        data.append((const char*)buffer, size);
+        return size;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Streaming Base-N encoding", "[CppCommon][String]")
+{
+    std::mt19937 generator(1);
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string source(generator() % 200, 0);
+        for (auto& ch : source)
+            ch = (char)generator();
+
+        BaseStreamEncoder encoder16(16), encoder32(32), encoder64(64);
+        BaseStreamDecoder decoder16(16), decoder32(32), decoder64(64);
+        std::string base16 = Transform(encoder16, source, generator);
+        std::string base32 = Transform(encoder32, source, generator);
+        std::string base64 = Transform(encoder64, source, generator);
+        REQUIRE(base16 == Encoding::Base16Encode(source));
+        REQUIRE(base32 == Encoding::Base32Encode(source));
+        REQUIRE(base64 == Encoding::Base64Encode(source));
+        REQUIRE(Transform(decoder16, base16, generator) == source);
+        REQUIRE(Transform(decoder32, base32, generator) == source);
+        REQUIRE(Transform(decoder64, base64, generator) == source);
+    }
+
+    // Invalid encoded data
+    BaseStreamDecoder decoder(64);
+    std::mt19937 generator2(2);
+    REQUIRE_THROWS_AS(Transform(decoder, "QUJDQQ", generator2), ArgumentException);
+    REQUIRE_THROWS_AS(Transform(decoder, "QQ==QUJD", generator2), ArgumentException);
+    REQUIRE(Transform(decoder, "QUJDQQ==", generator2) == "ABCA");
+}
+
+TEST_CASE("Streaming UTF transcoding", "[CppCommon][String]")
+{
+    std::mt19937 generator(1);
+    const char* words[] = { "text ", "\xC4\x8D\xCE\xA9 ", "\xE2\x84\xA6", "\xF0\x9D\x93\x83", "\xFF", "\xE2\x84", "\xED\xA0\x80" };
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string utf8;
+        while (utf8.size() < (generator() % 300))
+            utf8 += words[generator() % 7];
+        std::u16string utf16 = Encoding::UTF8toUTF16(utf8);
+        std::u32string utf32 = Encoding::UTF8toUTF32(utf8);
+
+        UTFStreamTranscoder<char, char16_t> utf8to16;
+        UTFStreamTranscoder<char, char32_t> utf8to32;
+        UTFStreamTranscoder<char16_t, char> utf16to8;
+        UTFStreamTranscoder<char16_t, char32_t> utf16to32;
+        UTFStreamTranscoder<char32_t, char> utf32to8;
+        UTFStreamTranscoder<char32_t, char16_t> utf32to16;
+        REQUIRE(Transform(utf8to16, utf8, generator) == Bytes(utf16));
+        REQUIRE(Transform(utf8to32, utf8, generator) == Bytes(utf32));
+        REQUIRE(Transform(utf16to8, Bytes(utf16), generator) == Encoding::UTF16toUTF8(utf16));
+        REQUIRE(Transform(utf16to32, Bytes(utf16), generator) == Bytes(utf32));
+        REQUIRE(Transform(utf32to8, Bytes(utf32), generator) == Encoding::UTF32toUTF8(utf32));
+        REQUIRE(Transform(utf32to16, Bytes(utf32), generator) == Bytes(utf16));
+    }
+
+    // Incomplete sequences at the end
+    UTFStreamTranscoder<char, char32_t> utf8to32;
+    UTFStreamTranscoder<char16_t, char> utf16to8;
+    REQUIRE(Transform(utf8to32, "A\xE2\x84", generator) == Bytes(std::u32string(U"A\uFFFD")));
+    REQUIRE(Transform(utf16to8, std::string_view("A\0\x3D", 3), generator) == "A\xEF\xBF\xBD");
+}
+
+TEST_CASE("Streaming encoding reader and writer", "[CppCommon][String]")
+{
+    std::string source(100000, 0);
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = (char)(i * 7 + 13);
+
+    // Encode with the writer
+    StringWriter target;
+    BaseStreamEncoder encoder(64);
+    EncodingWriter writer(target, encoder, 1000);
+    for (size_t offset = 0; offset < source.size(); offset += 333)
+        writer.Write(source.data() + offset, std::min<size_t>(333, source.size() - offset));
+    writer.Finish();
+    REQUIRE(target.data == Encoding::Base64Encode(source));
+
+    // Decode with the reader
+    StringReader input(target.data);
+    BaseStreamDecoder decoder(64);
+    EncodingReader reader(input, decoder, 1000);
+    std::vector<uint8_t> result = reader.ReadAllBytes();
+    REQUIRE(std::string(result.begin(), result.end()) == source);
+}
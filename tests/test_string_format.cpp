@@ -4,6 +4,7 @@
 
 #include "test.h"
 
+#include "memory/allocator_arena.h"
 #include "string/format.h"
 
 using namespace CppCommon;
@@ -57,3 +58,49 @@ TEST_CASE("Format", "[CppCommon][String]")
     REQUIRE(format("The date is {}", Date(2012, 12, 9)) == "The date is 2012-12-9");
     REQUIRE(format("Elapsed time: {s:.2f} seconds", "s"_a = 1.23) == "Elapsed time: 1.23 seconds");
 }
+
+TEST_CASE("Format to buffer", "[CppCommon][String]")
+{
+    REQUIRE(format(FMT_COMPILE("{}.{}.{}"), 1, 2.5, "three") == "1.2.5.three");
+    REQUIRE(format(FMT_COMPILE(L"{}-{}"), 1, L"two") == L"1-two");
+
+    fmt::memory_buffer buffer;
+    format_to(buffer, "{0}, {1}, {2}", -1, 0, 1);
+    REQUIRE(fmt::to_string(buffer) == "-1, 0, 1");
+    format_to(buffer, FMT_COMPILE(" {}"), 2);
+    REQUIRE(fmt::to_string(buffer) == "-1, 0, 1 2");
+    buffer.clear();
+    format_to(buffer, "The date is {}", Date(2012, 12, 9));
+    REQUIRE(fmt::to_string(buffer) == "The date is 2012-12-9");
+
+    fmt::wmemory_buffer wbuffer;
+    format_to(wbuffer, L"{}{}", L"wide", 1);
+    REQUIRE(std::wstring(wbuffer.data(), wbuffer.size()) == L"wide1");
+
+    std::string str = "prefix:";
+    format_to(str, "{:>5}", 42);
+    REQUIRE(str == "prefix:   42");
+    format_to(str, FMT_COMPILE("{:x}"), 255);
+    REQUIRE(str == "prefix:   42ff");
+
+    // Arena-backed string
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+    ArenaAllocator<char, DefaultMemoryManager> allocator(arena);
+    std::basic_string<char, std::char_traits<char>, ArenaAllocator<char, DefaultMemoryManager>> astr(allocator);
+    format_to(astr, "{} {}", "arena", std::string(32, 'x'));
+    REQUIRE(astr.size() == 38);
+    REQUIRE(arena.allocations() > 0);
+
+    std::wstring wstr;
+    format_to(wstr, L"{}", 3.5);
+    REQUIRE(wstr == L"3.5");
+
+    char chars[8];
+    REQUIRE(format_to_n(chars, sizeof(chars), "{}", 1234) == 4);
+    REQUIRE(std::string(chars, 4) == "1234");
+    REQUIRE(format_to_n(chars, sizeof(chars), "{}", "long formatted string") == 21);
+    REQUIRE(std::string(chars, 8) == "long for");
+    REQUIRE(format_to_n(chars, sizeof(chars), FMT_COMPILE("{}{}"), 'a', 7) == 2);
+    REQUIRE(std::string(chars, 2) == "a7");
+}
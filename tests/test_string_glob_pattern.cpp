@@ -0,0 +1,72 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "string/glob_pattern.h"
+
+using namespace CppCommon;
+
+TEST_CASE("Glob pattern", "[CppCommon][String]")
+{
+    // Empty glob pattern matches all strings
+    REQUIRE(GlobPattern().Match(""));
+    REQUIRE(GlobPattern().Match("anything"));
+    REQUIRE(GlobPattern("").empty());
+
+    // Literals and wildcards
+    REQUIRE(GlobPattern("file.txt").Match("file.txt"));
+    REQUIRE(!GlobPattern("file.txt").Match("file.txt2"));
+    REQUIRE(GlobPattern("*").Match(""));
+    REQUIRE(GlobPattern("*").Match("abc"));
+    REQUIRE(GlobPattern("*.txt").Match(".txt"));
+    REQUIRE(GlobPattern("*.txt").Match("file.txt"));
+    REQUIRE(!GlobPattern("*.txt").Match("file.txt.bak"));
+    REQUIRE(GlobPattern("log-*.txt").Match("log-2026.txt"));
+    REQUIRE(!GlobPattern("log-*.txt").Match("log.txt"));
+    REQUIRE(GlobPattern("a?c").Match("abc"));
+    REQUIRE(!GlobPattern("a?c").Match("ac"));
+    REQUIRE(GlobPattern("*a*b*c*").Match("xxaxxbxxcxx"));
+    REQUIRE(!GlobPattern("*a*b*c*").Match("xxcxxbxxaxx"));
+    REQUIRE(GlobPattern("a*a*a*a*b").Match("aaaaaaaaaaaaaaaaaaaab"));
+    REQUIRE(!GlobPattern("a*a*a*a*b").Match("aaaaaaaaaaaaaaaaaaaaa"));
+    REQUIRE(GlobPattern("**x**").Match("x"));
+    REQUIRE(GlobPattern("*abc").Match("ababc"));
+
+    // Character sets
+    REQUIRE(GlobPattern("file[0-9].txt").Match("file5.txt"));
+    REQUIRE(!GlobPattern("file[0-9].txt").Match("fileA.txt"));
+    REQUIRE(GlobPattern("file[!0-9].txt").Match("fileA.txt"));
+    REQUIRE(!GlobPattern("file[^0-9].txt").Match("file5.txt"));
+    REQUIRE(GlobPattern("[]x]").Match("]"));
+    REQUIRE(GlobPattern("[a\\-z]").Match("-"));
+    REQUIRE(!GlobPattern("[a\\-z]").Match("b"));
+    REQUIRE(GlobPattern("[abc").Match("[abc"));
+
+    // Escapes
+    REQUIRE(GlobPattern("\\*").Match("*"));
+    REQUIRE(!GlobPattern("\\*").Match("a"));
+    REQUIRE(GlobPattern("a\\;b").Match("a;b"));
+    REQUIRE(GlobPattern("\\!a").Match("!a"));
+
+    // Case insensitive patterns
+    REQUIRE(GlobPattern("*.TXT", true).Match("file.txt"));
+    REQUIRE(GlobPattern("[A-C]?", true).Match("bX"));
+    REQUIRE(!GlobPattern("*.TXT").Match("file.txt"));
+
+    // Pattern sets with negative patterns
+    GlobPattern set("*.txt;*.log");
+    REQUIRE(set.size() == 2);
+    REQUIRE(set.Match("error.log"));
+    REQUIRE(set.Match("notes.txt"));
+    REQUIRE(!set.Match("image.png"));
+    REQUIRE(!GlobPattern("!*.tmp;*").Match("data.tmp"));
+    REQUIRE(GlobPattern("!*.tmp;*").Match("data.bin"));
+    REQUIRE(GlobPattern("!*.tmp").Match("data.bin"));
+    REQUIRE(!GlobPattern("!*.tmp").Match("data.tmp"));
+    REQUIRE(GlobPattern("Demo*;Live*").Match("DemoAccount"));
+    REQUIRE(!GlobPattern("Demo*;Live*").Match("UnknownAccount"));
+    REQUIRE(!GlobPattern("!Demo*;!Live*").Match("LiveAccount"));
+    REQUIRE(GlobPattern("!Demo*;!Live*").Match("UnknownAccount"));
+}
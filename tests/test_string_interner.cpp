@@ -0,0 +1,94 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "string/string_interner.h"
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("String interner", "[CppCommon][String]")
+{
+    StringInterner interner(4);
+    REQUIRE(interner.stripes() == 4);
+    REQUIRE(interner.size() == 0);
+
+    InternedString empty = interner.Intern("");
+    REQUIRE(empty.empty());
+    REQUIRE(empty == InternedString());
+    REQUIRE(empty.id() == 0);
+    REQUIRE(std::string(empty.c_str()) == "");
+
+    InternedString key1 = interner.Intern("EURUSD");
+    InternedString key2 = interner.Intern(std::string("EUR") + "USD");
+    InternedString key3 = interner.Intern("GBPUSD");
+    REQUIRE(key1);
+    REQUIRE(key1 == key2);
+    REQUIRE(key1 != key3);
+    REQUIRE(key1.view() == "EURUSD");
+    REQUIRE(std::string(key1.c_str()) == "EURUSD");
+    REQUIRE(key1.size() == 6);
+    REQUIRE(key1.hash() == std::hash<std::string_view>()("EURUSD"));
+    REQUIRE(key1.id() != key3.id());
+    REQUIRE(interner.size() == 2);
+    REQUIRE(interner.memory() > 0);
+
+    REQUIRE(interner.Find("EURUSD") == key1);
+    REQUIRE(interner.Find("USDJPY").empty());
+    REQUIRE(interner.Get(key1.id()) == key1);
+    REQUIRE(interner.Get(key3.id()) == key3);
+    REQUIRE(interner.Get(0).empty());
+    REQUIRE(interner.Get(key3.id() + 1024).empty());
+
+    std::unordered_map<InternedString, int> map;
+    map[key1] = 1;
+    map[key3] = 3;
+    REQUIRE(map[interner.Intern("EURUSD")] == 1);
+    REQUIRE(map.size() == 2);
+
+    // Interned strings never move while the interner grows
+    const char* data = key1.data();
+    for (int i = 0; i < 10000; ++i)
+        interner.Intern("symbol-" + std::to_string(i));
+    REQUIRE(interner.size() == 10002);
+    REQUIRE(key1.data() == data);
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::string symbol = "symbol-" + std::to_string(i);
+        InternedString interned = interner.Find(symbol);
+        REQUIRE(interned.view() == symbol);
+        REQUIRE(interner.Get(interned.id()) == interned);
+    }
+}
+
+TEST_CASE("String interner multithreading", "[CppCommon][String]")
+{
+    StringInterner interner;
+
+    const int threads_count = 8;
+    const int symbols = 5000;
+
+    std::vector<std::vector<InternedString>> results(threads_count);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&interner, &results, t]()
+        {
+            for (int i = 0; i < symbols; ++i)
+                results[t].push_back(interner.Intern("symbol-" + std::to_string((i * 7 + t) % symbols)));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(interner.size() == symbols);
+    for (int t = 0; t < threads_count; ++t)
+        for (int i = 0; i < symbols; ++i)
+            REQUIRE(results[t][i] == interner.Find("symbol-" + std::to_string((i * 7 + t) % symbols)));
+}
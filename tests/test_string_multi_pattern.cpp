@@ -0,0 +1,128 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions.h"
+#include "string/multi_pattern.h"
+
+#include <random>
+
+using namespace CppCommon;
+
+namespace {
+
+// Find all matches with the naive search
+std::vector<PatternMatch> NaiveFindAll(const std::vector<std::string>& patterns, std::string_view str)
+{
+    std::vector<PatternMatch> result;
+    for (size_t position = 0; position < str.size(); ++position)
+        for (size_t pattern = 0; pattern < patterns.size(); ++pattern)
+            if (str.substr(position, patterns[pattern].size()) == patterns[pattern])
+                result.push_back(PatternMatch{ position, patterns[pattern].size(), pattern });
+    return result;
+}
+
+bool Equal(const std::vector<PatternMatch>& matches1, const std::vector<PatternMatch>& matches2)
+{
+    if (matches1.size() != matches2.size())
+        return false;
+    for (size_t i = 0; i < matches1.size(); ++i)
+        if ((matches1[i].position != matches2[i].position) || (matches1[i].length != matches2[i].length) || (matches1[i].pattern != matches2[i].pattern))
+            return false;
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Multi-pattern matcher", "[CppCommon][String]")
+{
+    // Empty multi-pattern matcher matches nothing
+    REQUIRE(MultiPattern().empty());
+    REQUIRE(!MultiPattern().Contains("anything"));
+    REQUIRE(MultiPattern().FindAll("anything").empty());
+    REQUIRE_THROWS_AS(MultiPattern({ "abc", "" }), ArgumentException);
+
+    MultiPattern pattern({ "he", "she", "his", "hers" });
+    REQUIRE(pattern.size() == 4);
+    REQUIRE(pattern.Contains("ushers"));
+    REQUIRE(!pattern.Contains("usual"));
+    REQUIRE(!pattern.Contains("h"));
+
+    // Overlapping matches are reported
+    auto matches = pattern.FindAll("ushers");
+    REQUIRE(matches.size() == 3);
+    REQUIRE(((matches[0].position == 1) && (matches[0].pattern == 1)));
+    REQUIRE(((matches[1].position == 2) && (matches[1].pattern == 0)));
+    REQUIRE(((matches[2].position == 2) && (matches[2].pattern == 3)));
+
+    // Not overlapping leftmost-longest matches are counted and replaced
+    REQUIRE(pattern.CountAll("ushers his") == 2);
+    std::string str = "ushers, his and hers";
+    REQUIRE(pattern.ReplaceAll(str, "*"));
+    REQUIRE(str == "u*rs, * and *");
+    str = "she said his";
+    REQUIRE(pattern.ReplaceAll(str, std::vector<std::string>{ "HE", "SHE", "HIS", "HERS" }));
+    REQUIRE(str == "SHE said HIS");
+    REQUIRE(!pattern.ReplaceAll(str, "*"));
+    REQUIRE_THROWS_AS(pattern.ReplaceAll(str, std::vector<std::string>{ "x" }), ArgumentException);
+
+    // Case insensitive matching
+    MultiPattern nocase({ "Error", "FATAL" }, true);
+    REQUIRE(nocase.Contains("some error happened"));
+    REQUIRE(nocase.Contains("Fatal: disk"));
+    REQUIRE(!nocase.Contains("warning"));
+    REQUIRE(nocase.CountAll("ERROR error fatal") == 3);
+}
+
+TEST_CASE("Multi-pattern matcher engines", "[CppCommon][String]")
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> letter('a', 'd');
+    auto random_string = [&](size_t size)
+    {
+        std::string result(size, 'a');
+        for (auto& ch : result)
+            ch = (char)letter(generator);
+        return result;
+    };
+
+    for (size_t count : { 1, 3, 8, 20, 64, 65, 500 })
+    {
+        std::vector<std::string> patterns;
+        std::uniform_int_distribution<size_t> length(1, 6);
+        for (size_t i = 0; i < count; ++i)
+            patterns.push_back(random_string(length(generator)));
+
+        MultiPattern pattern(patterns);
+        if (count > MultiPattern::TEDDY_PATTERNS)
+            REQUIRE(!pattern.teddy());
+
+        // Both engines find the same matches as the naive search
+        for (size_t size : { 0, 1, 5, 31, 32, 33, 100, 1000 })
+        {
+            std::string str = random_string(size);
+            REQUIRE(Equal(pattern.FindAll(str), NaiveFindAll(patterns, str)));
+            REQUIRE(pattern.Contains(str) == !NaiveFindAll(patterns, str).empty());
+        }
+    }
+
+    // Large set with long patterns
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 500; ++i)
+        patterns.push_back("token" + std::to_string(i * 7919) + ";");
+    MultiPattern pattern(patterns);
+    REQUIRE(!pattern.teddy());
+    std::string line = "prefix token15838; middle token7919; suffix token1;";
+    auto matches = pattern.FindAll(line);
+    REQUIRE(matches.size() == 2);
+    REQUIRE(matches[0].pattern == 2);
+    REQUIRE(matches[1].pattern == 1);
+    REQUIRE(pattern.ReplaceAll(line, "<redacted>"));
+    REQUIRE(line == "prefix <redacted> middle <redacted> suffix token1;");
+
+    // Large case insensitive set
+    MultiPattern nocase(patterns, true);
+    REQUIRE(nocase.CountAll("TOKEN0; Token7919;") == 2);
+}
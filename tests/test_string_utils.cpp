@@ -6,6 +6,8 @@
 
 #include "string/string_utils.h"
 
+#include <random>
+
 using namespace CppCommon;
 
 TEST_CASE("String utilities", "[CppCommon][String]")
@@ -116,3 +118,165 @@ TEST_CASE("String utilities", "[CppCommon][String]")
     REQUIRE(StringUtils::FromString<int>("100") == 100);
     REQUIRE(StringUtils::FromString<double>("123.456") == 123.456);
 }
+
+TEST_CASE("String utilities with small containers", "[CppCommon][String]")
+{
+    SmallVector<SmallString<8>, 8> tokens;
+    StringUtils::Split("a foo a bar a baz", ' ', tokens);
+    REQUIRE(tokens.size() == 6);
+    REQUIRE(tokens.is_inline());
+    REQUIRE(tokens[1] == "foo");
+    REQUIRE(tokens[1].is_inline());
+
+    SmallString<32> result;
+    StringUtils::Join(tokens, '+', result);
+    REQUIRE(result == "a+foo+a+bar+a+baz");
+    REQUIRE(result.is_inline());
+
+    SmallVector<std::string_view, 2> views;
+    StringUtils::Split("a foo a bar a baz", "a ", views, true);
+    REQUIRE(views.size() == 3);
+    REQUIRE(!views.is_inline());
+    StringUtils::Join(views, "the ", result);
+    REQUIRE(result == "foo the bar the baz");
+
+    // Skip empty and blank tokens
+    StringUtils::Split(",a,, ,b", ',', tokens);
+    REQUIRE(tokens.size() == 5);
+    StringUtils::Join(tokens, ';', result, true, true);
+    REQUIRE(result == "a;b");
+}
+
+TEST_CASE("String utilities with long strings", "[CppCommon][String]")
+{
+    std::mt19937 generator(42);
+    const char alphabet[] = "aAbBzZ@[`{ \t\n\v\f\r\x80\xFF";
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string str;
+        size_t length = generator() % 200;
+        for (size_t j = 0; j < length; ++j)
+            str.push_back(alphabet[generator() % (sizeof(alphabet) - 1)]);
+
+        // Case conversions of ASCII letters only
+        std::string lower = str;
+        std::string upper = str;
+        for (auto& ch : lower)
+            if ((ch >= 'A') && (ch <= 'Z'))
+                ch = ch - 'A' + 'a';
+        for (auto& ch : upper)
+            if ((ch >= 'a') && (ch <= 'z'))
+                ch = ch - 'a' + 'A';
+        REQUIRE(StringUtils::ToLower(str) == lower);
+        REQUIRE(StringUtils::ToUpper(str) == upper);
+
+        // Trimming of blank prefix and suffix
+        std::string padded = std::string(generator() % 70, ' ') + "x" + str + "x" + std::string(generator() % 70, '\t');
+        std::string trimmed = "x" + str + "x";
+        REQUIRE(StringUtils::ToTrim(padded) == trimmed);
+        REQUIRE(StringUtils::ToLTrim(padded) == padded.substr(padded.find('x')));
+        REQUIRE(StringUtils::ToRTrim(padded) == padded.substr(0, padded.rfind('x') + 1));
+        REQUIRE(StringUtils::IsBlank(std::string(padded.find('x'), ' ')));
+        REQUIRE(!StringUtils::IsBlank(padded));
+
+        // Substring search
+        std::string substr = str.substr(generator() % (str.size() + 1), generator() % 5);
+        for (size_t pos = 0; pos <= str.size(); pos += 7)
+            REQUIRE(StringUtils::Find(str, substr, pos) == str.find(substr, pos));
+        REQUIRE(StringUtils::Find(str, "not found") == std::string::npos);
+    }
+
+    // Substring with frequent first character
+    std::string text = std::string(1000, 'a') + "ab";
+    REQUIRE(StringUtils::Find(text, "ab") == 1000);
+    REQUIRE(StringUtils::Find(text, "aab") == 999);
+    REQUIRE(StringUtils::CountAll(text, "aa") == 500);
+    REQUIRE(StringUtils::Contains(text, "b"));
+    REQUIRE(!StringUtils::Contains(text, "ba"));
+}
+
+TEST_CASE("String utilities split views", "[CppCommon][String]")
+{
+    std::vector<std::string_view> tokens;
+    for (auto token : StringUtils::SplitView("a,b,,c,", ','))
+        tokens.push_back(token);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "b", "", "c", "" }));
+
+    tokens.clear();
+    for (auto token : StringUtils::SplitView("a,b,,c,", ',', true))
+        tokens.push_back(token);
+    REQUIRE(tokens == std::vector<std::string_view>({ "a", "b", "c" }));
+
+    tokens.clear();
+    for (auto token : StringUtils::SplitView("key => value => => end", " => ", true))
+        tokens.push_back(token);
+    REQUIRE(tokens == std::vector<std::string_view>({ "key", "value", "=> end" }));
+
+    // Split views have the same tokens as split strings
+    std::string str = "GET /index.html HTTP/1.1  200 OK ";
+    auto range = StringUtils::SplitView(str, ' ');
+    auto split = StringUtils::Split(str, ' ');
+    REQUIRE(std::equal(range.begin(), range.end(), split.begin(), split.end()));
+
+    int count = 0;
+    for (auto token : StringUtils::SplitView("", ','))
+        count += token.empty() ? 1 : 0;
+    REQUIRE(count == 1);
+    REQUIRE(StringUtils::SplitView("", ',', true).begin() == StringUtils::SplitView("", ',', true).end());
+}
+
+TEST_CASE("String utilities numbers", "[CppCommon][String]")
+{
+    char buffer[32];
+    REQUIRE(StringUtils::ToChars(-12345, buffer, sizeof(buffer)) == 6);
+    REQUIRE(std::string(buffer, 6) == "-12345");
+    REQUIRE(StringUtils::ToChars(-12345, buffer, 3) == 0);
+    REQUIRE(StringUtils::ToChars(0.1, buffer, sizeof(buffer)) == 3);
+    REQUIRE(StringUtils::ToString(0.1) == "0.1");
+    REQUIRE(StringUtils::ToString(1e100) == "1e+100");
+    REQUIRE(StringUtils::ToString(UINT64_MAX) == "18446744073709551615");
+    REQUIRE(StringUtils::ToString(INT64_MIN) == "-9223372036854775808");
+
+    REQUIRE(StringUtils::FromString<int>("  +42") == 42);
+    REQUIRE(StringUtils::FromString<int>("42ms") == 42);
+    REQUIRE(StringUtils::FromString<int>("abc") == 0);
+    REQUIRE(StringUtils::FromString<double>("-1.5e3") == -1500.0);
+
+    int integer = 7;
+    REQUIRE(StringUtils::TryFromString(" -15 ", integer));
+    REQUIRE(integer == -15);
+    REQUIRE(!StringUtils::TryFromString("15x", integer));
+    REQUIRE(!StringUtils::TryFromString("", integer));
+    REQUIRE(!StringUtils::TryFromString("+-1", integer));
+    REQUIRE(!StringUtils::TryFromString("300", *(uint8_t*)buffer));
+    REQUIRE(integer == -15);
+
+    // Round-trip of random floating point numbers
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<double> distribution(-1e12, 1e12);
+    for (int i = 0; i < 10000; ++i)
+    {
+        double value = distribution(generator);
+        double result = 0.0;
+        REQUIRE(StringUtils::TryFromString(StringUtils::ToString(value), result));
+        REQUIRE(result == value);
+    }
+
+    // Delimited numeric columns
+    double values[4];
+    size_t position = 0;
+    REQUIRE(StringUtils::FromStrings("1.5,2,-3.25", ',', values, 4, &position) == 3);
+    REQUIRE(position == 11);
+    REQUIRE(values[0] == 1.5);
+    REQUIRE(values[1] == 2.0);
+    REQUIRE(values[2] == -3.25);
+    REQUIRE(StringUtils::FromStrings("1, x,3", ',', values, 4, &position) == 1);
+    REQUIRE(position == 2);
+    REQUIRE(StringUtils::FromStrings("1,2,", ',', values, 4, &position) == 2);
+    REQUIRE(position == 4);
+    REQUIRE(StringUtils::FromStrings("1;2;3;4;5", ';', values, 4, &position) == 4);
+    REQUIRE(position == 8);
+    REQUIRE(StringUtils::FromStrings("", ',', values, 4, &position) == 0);
+    REQUIRE(position == 0);
+}
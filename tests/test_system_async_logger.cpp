@@ -0,0 +1,120 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/file.h"
+#include "system/async_logger.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Async logger", "[CppCommon][System]")
+{
+    {
+        AsyncLogger logger;
+        REQUIRE(!logger.IsOpened());
+
+        // Records logged before the open are kept in the ring buffer
+        REQUIRE(logger.Log("Before open"));
+
+        logger.Open("test.async.log");
+        REQUIRE(logger.IsOpened());
+
+        std::string text = "temporary";
+        REQUIRE(logger.Log("Integer {} double {:.2f} char {} bool {}", 42, 101.25, 'x', true));
+        REQUIRE(logger.Log("String '{}' literal '{}' view '{}'", text, "literal", std::string_view("view")));
+        text = "changed";
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&logger, i]()
+            {
+                for (int j = 0; j < 100; ++j)
+                    logger.Log("Thread {} record {}", i, j);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        logger.Close();
+        REQUIRE(!logger.IsOpened());
+        REQUIRE(logger.records() == 403);
+        REQUIRE(logger.dropped() == 0);
+    }
+
+    std::string log = File::ReadAllText("test.async.log");
+    REQUIRE(log.find("Z [") != std::string::npos);
+    REQUIRE(log.find("] Before open\n") != std::string::npos);
+    REQUIRE(log.find("] Integer 42 double 101.25 char x bool true\n") != std::string::npos);
+    REQUIRE(log.find("] String 'temporary' literal 'literal' view 'view'\n") != std::string::npos);
+    REQUIRE(log.find("] Thread 3 record 99\n") != std::string::npos);
+    REQUIRE(std::count(log.begin(), log.end(), '\n') == 403);
+
+    // Records are appended to the existing log file
+    {
+        AsyncLogger logger;
+        logger.Open("test.async.log");
+        logger.Log("Appended");
+        logger.Flush();
+        REQUIRE(File::ReadAllText("test.async.log").find("] Appended\n") != std::string::npos);
+    }
+    REQUIRE(File::ReadAllText("test.async.log").find("] Before open\n") != std::string::npos);
+
+    File::Remove("test.async.log");
+}
+
+TEST_CASE("Async logger overflow", "[CppCommon][System]")
+{
+    AsyncLogger logger(256);
+
+    // Ring buffer is not drained while the logger is closed
+    size_t logged = 0;
+    for (int i = 0; i < 100; ++i)
+        if (logger.Log("Record {}", i))
+            ++logged;
+    REQUIRE(logged > 0);
+    REQUIRE(logged < 100);
+    REQUIRE(logger.dropped() == (100 - logged));
+
+    // Records greater than the ring buffer are dropped
+    REQUIRE(!logger.Log("{}", std::string(1024, 'x')));
+
+    logger.Open("test.async.log");
+    logger.Close();
+    REQUIRE(logger.records() == logged);
+
+    File::Remove("test.async.log");
+}
+
+TEST_CASE("Async logger rotation", "[CppCommon][System]")
+{
+    {
+        AsyncLogger logger;
+        logger.Open("test.async.log", 1024, 2);
+        for (int i = 0; i < 200; ++i)
+            logger.Log("Rotated record {}", i);
+        logger.Close();
+        REQUIRE(logger.rotations() > 2);
+    }
+
+    REQUIRE(Path("test.async.log").IsExists());
+    REQUIRE(Path("test.async.log.1").IsExists());
+    REQUIRE(Path("test.async.log.2").IsExists());
+    REQUIRE(!Path("test.async.log.3").IsExists());
+
+    // Rotated files are limited by the rotation size and the last line
+    REQUIRE(File("test.async.log.1").size() < 1024 + 128);
+    REQUIRE(File::ReadAllText("test.async.log").find("] Rotated record 199\n") != std::string::npos);
+    REQUIRE(File::ReadAllText("test.async.log.1").find("] Rotated record 0\n") == std::string::npos);
+
+    File::Remove("test.async.log");
+    File::Remove("test.async.log.1");
+    File::Remove("test.async.log.2");
+}
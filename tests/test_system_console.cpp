@@ -0,0 +1,43 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/console.h"
+
+using namespace CppCommon;
+
+TEST_CASE("Console buffer", "[CppCommon][System]")
+{
+    ConsoleBuffer buffer(1024);
+    REQUIRE(buffer.empty());
+
+    // Text, characters and numbers
+    buffer << "Value: " << 42 << ' ' << 1.5;
+    REQUIRE(buffer.buffer() == "Value: 42 1.5");
+    buffer.Discard();
+    REQUIRE(buffer.empty());
+
+    // Repeated color changes are skipped
+    buffer << Color::RED << "A" << Color::RED << "B";
+    REQUIRE(buffer.buffer() == "\033[00000m\033[22;31mA" "B");
+    buffer << std::make_pair(Color::RED, Color::BLUE) << "C";
+    REQUIRE(buffer.buffer() == "\033[00000m\033[22;31mAB\033[02;44m\033[22;31mC");
+    buffer.Discard();
+
+    // Reset color forces the next color change
+    buffer.ResetColor().SetColor(Color::RED, Color::BLUE);
+    REQUIRE(buffer.buffer() == "\033[0m\033[02;44m\033[22;31m");
+    buffer.Discard();
+
+    // Cursor movements
+    buffer.MoveTo(0, 0).MoveUp(2).MoveDown().MoveRight(3).MoveLeft(0).ClearLine();
+    REQUIRE(buffer.buffer() == "\033[1;1H\033[2A\033[1B\033[3C\033[K");
+    buffer.Discard();
+
+    // Formatted text
+    buffer.Print("{:>5}|{}", 7, "x");
+    REQUIRE(buffer.buffer() == "    7|x");
+    buffer.Discard();
+}
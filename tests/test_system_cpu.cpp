@@ -5,6 +5,9 @@
 #include "test.h"
 
 #include "system/cpu.h"
+#include "system/cpu_dispatch.h"
+
+#include <sstream>
 
 using namespace CppCommon;
 
@@ -19,3 +22,58 @@ TEST_CASE("CPU management", "[CppCommon][System]")
     REQUIRE(CPU::ClockSpeed() > 0);
     REQUIRE((CPU::HyperThreading() || !CPU::HyperThreading()));
 }
+
+TEST_CASE("CPU features", "[CppCommon][System]")
+{
+    const CPUFeatures& features = CPU::Features();
+
+    // Features are detected once
+    REQUIRE(&CPU::Features() == &features);
+
+    REQUIRE(features.cache_line >= 16);
+    REQUIRE(((features.cache_line & (features.cache_line - 1)) == 0));
+
+    // Feature implications
+    REQUIRE((!features.avx2 || features.avx));
+    REQUIRE((!features.fma || features.avx));
+    REQUIRE((!features.avx512bw || features.avx512f));
+    REQUIRE((!features.avx512vl || features.avx512f));
+    REQUIRE((!features.sve2 || features.sve));
+#if defined(__x86_64__) || defined(_M_X64)
+    REQUIRE(features.sse2);
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    REQUIRE(features.neon);
+#endif
+
+    std::ostringstream stream;
+    stream << features;
+    REQUIRE((stream.str().empty() || (stream.str().front() != ' ')));
+}
+
+namespace {
+
+int resolutions = 0;
+
+int DispatchScalar(int value) { return value + 1; }
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+CPU_TARGET("popcnt") int DispatchPopcnt(int value) { return value + 1 + 0 * __builtin_popcount((unsigned)value); }
+#else
+int DispatchPopcnt(int value) { return value + 1; }
+#endif
+
+} // namespace
+
+TEST_CASE("CPU dispatch", "[CppCommon][System]")
+{
+    static CPUDispatch<int(int)> dispatch([](const CPUFeatures& features)
+    {
+        ++resolutions;
+        return features.popcnt ? DispatchPopcnt : DispatchScalar;
+    });
+
+    REQUIRE(dispatch(1) == 2);
+    REQUIRE(dispatch(2) == 3);
+    REQUIRE(resolutions == 1);
+    REQUIRE(dispatch.function() == (CPU::Features().popcnt ? DispatchPopcnt : DispatchScalar));
+    REQUIRE(resolutions == 1);
+}
@@ -0,0 +1,90 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/file.h"
+#include "system/cpu_profiler.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+__attribute__((noinline)) double CpuProfilerBurn(uint64_t nanoseconds)
+{
+    volatile double result = 0.0;
+    uint64_t finish = Timestamp::nano() + nanoseconds;
+    while (Timestamp::nano() < finish)
+        for (int i = 1; i < 1000; ++i)
+            result = result + 1.0 / i;
+    return result;
+}
+
+}
+
+TEST_CASE("CPU profiler", "[CppCommon][System]")
+{
+    REQUIRE_THROWS_AS(CpuProfiler::Start(0), ArgumentException);
+    REQUIRE_THROWS_AS(CpuProfiler::Start(100, 1000), ArgumentException);
+
+    CpuProfiler::Reset();
+    REQUIRE(!CpuProfiler::IsRunning());
+
+    CpuProfiler::Start(1000);
+    REQUIRE(CpuProfiler::IsRunning());
+    REQUIRE(CpuProfiler::frequency() == 1000);
+    CpuProfilerBurn(300000000);
+    CpuProfiler::Stop();
+    REQUIRE(!CpuProfiler::IsRunning());
+
+    uint64_t samples = CpuProfiler::samples();
+    REQUIRE(samples > 0);
+
+    // Samples are aggregated by stack traces with the interrupted frame first
+    uint64_t total = 0;
+    uint64_t burn = 0;
+    std::vector<CpuSample> snapshot = CpuProfiler::Snapshot();
+    for (size_t i = 0; i < snapshot.size(); ++i)
+    {
+        REQUIRE(!snapshot[i].frames.empty());
+        REQUIRE(snapshot[i].frames.size() <= (size_t)CpuProfiler::MAX_FRAMES);
+        if (i > 0)
+            REQUIRE(snapshot[i - 1].count >= snapshot[i].count);
+        total += snapshot[i].count;
+        uintptr_t leaf = (uintptr_t)snapshot[i].frames.front();
+        if ((leaf >= (uintptr_t)&CpuProfilerBurn) && (leaf < ((uintptr_t)&CpuProfilerBurn + 1024)))
+            burn += snapshot[i].count;
+    }
+    REQUIRE(total == samples);
+    REQUIRE(burn > 0);
+
+    // Stopped profiler collects nothing
+    CpuProfilerBurn(50000000);
+    REQUIRE(CpuProfiler::samples() == samples);
+
+    // Folded stacks report has a line per unique stack trace of function names
+    std::string folded = CpuProfiler::Folded();
+    size_t lines = (size_t)std::count(folded.begin(), folded.end(), '\n');
+    REQUIRE(lines > 0);
+    REQUIRE(lines <= snapshot.size());
+    REQUIRE(folded.back() == '\n');
+
+    CpuProfiler::SavePprof("test.prof");
+    std::vector<uint8_t> profile = File::ReadAllBytes("test.prof");
+    REQUIRE(profile.size() > 8 * sizeof(uintptr_t));
+    const uintptr_t* header = (const uintptr_t*)profile.data();
+    REQUIRE(header[0] == 0);
+    REQUIRE(header[1] == 3);
+    REQUIRE(header[3] == 1000);
+    File::Remove("test.prof");
+
+    CpuProfiler::Reset();
+    REQUIRE(CpuProfiler::samples() == 0);
+    REQUIRE(CpuProfiler::Snapshot().empty());
+}
@@ -0,0 +1,102 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/cpu.h"
+#include "system/cpu_topology.h"
+
+using namespace CppCommon;
+
+TEST_CASE("CPU set", "[CppCommon][System]")
+{
+    CPUSet cpuset;
+    REQUIRE(cpuset.empty());
+    REQUIRE(!cpuset);
+    REQUIRE(cpuset.count() == 0);
+    REQUIRE(cpuset.size() == 0);
+    REQUIRE(cpuset.first() == -1);
+    REQUIRE(cpuset.string().empty());
+
+    // Test CPUs above 64
+    cpuset.set(1).set(2).set(3).set(70).set(127).set(200);
+    REQUIRE(cpuset);
+    REQUIRE(cpuset.count() == 6);
+    REQUIRE(cpuset.size() == 201);
+    REQUIRE(cpuset.test(70));
+    REQUIRE(!cpuset.test(71));
+    REQUIRE(cpuset.first() == 1);
+    REQUIRE(cpuset.next(3) == 70);
+    REQUIRE(cpuset.next(127) == 200);
+    REQUIRE(cpuset.next(200) == -1);
+    REQUIRE(cpuset.cpus() == std::vector<int>({ 1, 2, 3, 70, 127, 200 }));
+    REQUIRE(cpuset.string() == "1-3,70,127,200");
+    REQUIRE(cpuset.bitset().to_ullong() == 0xEull);
+
+    cpuset.reset(200);
+    REQUIRE(cpuset.size() == 128);
+    REQUIRE(cpuset == CPUSet({ 1, 2, 3, 70, 127 }));
+
+    // Test parse
+    CPUSet parsed = CPUSet::Parse("0-3,8,10-11\n");
+    REQUIRE(parsed.string() == "0-3,8,10-11");
+    REQUIRE(parsed.count() == 7);
+    REQUIRE(CPUSet::Parse("").empty());
+    REQUIRE(CPUSet::Parse("5-2,7").string() == "7");
+
+    // Test operators
+    REQUIRE((parsed & CPUSet({ 2, 8, 9, 100 })).string() == "2,8");
+    REQUIRE((parsed | CPUSet({ 4, 100 })).string() == "0-4,8,10-11,100");
+    REQUIRE(CPUSet(std::bitset<64>(0x5ull)) == CPUSet({ 0, 2 }));
+    REQUIRE(CPUSet({ 1 }) != CPUSet({ 2 }));
+}
+
+TEST_CASE("CPU topology", "[CppCommon][System]")
+{
+    const CPUTopology& topology = CPUTopology::Current();
+
+    REQUIRE(!topology.online().empty());
+    REQUIRE(topology.cpus().size() == topology.online().count());
+    REQUIRE(!topology.cores().empty());
+    REQUIRE(!topology.sockets().empty());
+    REQUIRE(!topology.nodes().empty());
+    REQUIRE((int)topology.cores().size() == CPU::PhysicalCores());
+
+    // Each online CPU belongs to exactly one core, socket and NUMA node
+    CPUSet cores;
+    size_t count = 0;
+    for (const auto& core : topology.cores())
+    {
+        count += core.count();
+        cores |= core;
+    }
+    REQUIRE(count == topology.online().count());
+    REQUIRE(cores == topology.online());
+
+    for (const auto& location : topology.cpus())
+    {
+        REQUIRE(topology.Find(location.cpu) == &location);
+        REQUIRE(location.core >= 0);
+        REQUIRE(location.socket >= 0);
+        REQUIRE(location.node >= 0);
+        REQUIRE(topology.Siblings(location.cpu).test(location.cpu));
+        REQUIRE(topology.sockets()[location.socket].test(location.cpu));
+        REQUIRE(topology.nodes()[location.node].test(location.cpu));
+    }
+    REQUIRE(topology.Find(-1) == nullptr);
+    REQUIRE(topology.Siblings(-1).empty());
+
+    // Caches are shared at least by SMT siblings
+    for (const auto& cache : topology.caches())
+    {
+        REQUIRE(cache.level > 0);
+        REQUIRE(!cache.cpus.empty());
+        if ((cache.level <= 2) && (cache.type != CPUCacheType::Instruction))
+        {
+            int cpu = cache.cpus.first();
+            REQUIRE(topology.FindCache(cpu, cache.level) != nullptr);
+            REQUIRE(topology.SharedCache(cpu, cache.level) == cache.cpus);
+        }
+    }
+}
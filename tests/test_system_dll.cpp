@@ -68,3 +68,39 @@ TEST_CASE("DLL plugin interface", "[CppCommon][System]")
     REQUIRE(!plugin);
     REQUIRE(!plugin.IsLoaded());
 }
+
+TEST_CASE("DLL plugin symbols", "[CppCommon][System]")
+{
+    // Load the plugin with lazy binding
+    DLL plugin("plugin-interface", true, DLLFlags::LAZY | DLLFlags::GLOBAL);
+    REQUIRE(plugin);
+
+    // Resolve the plugin symbol table at once
+    DLL::Symbol<bool (IRandom**)> create(plugin, "PluginRandomCreate");
+    DLL::Symbol<bool (IRandom*)> release(plugin, "PluginRandomRelease");
+    DLL::Symbol<void ()> missing(plugin, "PluginMissing");
+    REQUIRE(!plugin.ResolveAll(create, release, missing));
+    REQUIRE(plugin.ResolveAll(create, release));
+    REQUIRE(create);
+    REQUIRE(release);
+    REQUIRE(!missing);
+
+    // Call cached plugin symbols
+    for (int i = 0; i < 10; ++i)
+    {
+        IRandom *pRandom = nullptr;
+        REQUIRE(create(&pRandom));
+        REQUIRE(pRandom->random() >= 0);
+        REQUIRE(release(pRandom));
+    }
+
+    // Unloaded plugin invalidates cached symbols
+    plugin.Unload();
+    REQUIRE(!create);
+    REQUIRE(!release);
+
+    // Reloaded plugin resolves cached symbols again
+    REQUIRE(plugin.Load());
+    REQUIRE(create);
+    REQUIRE(release);
+}
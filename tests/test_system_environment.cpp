@@ -33,3 +33,29 @@ TEST_CASE("Environment variables", "[CppCommon][System]")
     Environment::ClearEnvar("TestEnvar");
     REQUIRE(Environment::GetEnvar("TestEnvar") == "");
 }
+
+TEST_CASE("Environment snapshot", "[CppCommon][System]")
+{
+    const EnvironmentSnapshot& snapshot = Environment::Snapshot();
+    REQUIRE(snapshot.size() == Environment::envars().size());
+    for (const auto& envar : snapshot.envars())
+        REQUIRE(snapshot.Get(envar.first) == envar.second);
+    REQUIRE(!snapshot.Contains("TestSnapshotEnvar"));
+
+    // Changed environment variables are published in a new snapshot
+    Environment::SetEnvar("TestSnapshotEnvar", "123");
+    REQUIRE(Environment::Envar("TestSnapshotEnvar") == "123");
+    REQUIRE(Environment::Envar<int>("TestSnapshotEnvar", 0) == 123);
+    REQUIRE(Environment::Envar<double>("TestSnapshotEnvar", 0.0) == 123.0);
+    REQUIRE(Environment::Envar<bool>("TestSnapshotEnvar", true) == true);
+    REQUIRE(Environment::Envar<std::string>("TestSnapshotEnvar", "") == "123");
+    REQUIRE(!snapshot.Contains("TestSnapshotEnvar"));
+
+    Environment::SetEnvar("TestSnapshotEnvar", "Off");
+    REQUIRE(Environment::Envar<bool>("TestSnapshotEnvar", true) == false);
+    REQUIRE(Environment::Envar<int>("TestSnapshotEnvar", 42) == 42);
+
+    Environment::ClearEnvar("TestSnapshotEnvar");
+    REQUIRE(Environment::Envar("TestSnapshotEnvar").empty());
+    REQUIRE(Environment::Envar<int>("TestSnapshotEnvar", 42) == 42);
+}
@@ -0,0 +1,86 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/flight_recorder.h"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Flight recorder", "[CppCommon][System]")
+{
+    // Records before the setup are ignored
+    FlightRecorder::Record(1);
+    REQUIRE(FlightRecorder::Snapshot().empty());
+
+    FlightRecorder::Setup("test_flight_recorder", 4, 16);
+    REQUIRE(FlightRecorder::enabled());
+    REQUIRE(FlightRecorder::name() == "test_flight_recorder");
+
+    // Ring keeps only the most recent events
+    for (uint64_t i = 0; i < 100; ++i)
+        FlightRecorder::Record(2, i);
+    FlightRecorder::Record(3, "message which is longer than the maximal message size", 42);
+
+    auto events = FlightRecorder::Snapshot();
+    REQUIRE(events.size() == 16);
+    REQUIRE(events.front().code == 2);
+    REQUIRE(events.front().argument == 85);
+    REQUIRE(events.front().sequence == 86);
+    REQUIRE(events.back().code == 3);
+    REQUIRE(events.back().argument == 42);
+    REQUIRE(events.back().message.size() == FlightRecorder::MESSAGE_SIZE);
+    REQUIRE(events.back().message == std::string("message which is longer than the maximal message size").substr(0, FlightRecorder::MESSAGE_SIZE));
+    for (size_t i = 1; i < events.size(); ++i)
+        REQUIRE(events[i - 1].timestamp <= events[i].timestamp);
+
+    // Watchdog reads the same segment
+    SharedMemory shared("test_flight_recorder", FlightRecorder::SegmentSize(4, 16));
+    REQUIRE(!shared.owner());
+    auto watched = FlightRecorder::Read(shared);
+    REQUIRE(watched.size() == events.size());
+    REQUIRE(watched.back().message == events.back().message);
+    REQUIRE(watched.back().thread == events.back().thread);
+
+    // Dump recent events
+    std::stringstream stream;
+    FlightRecorder::Dump(stream);
+    REQUIRE(stream.str().find("Flight recorder (16 events)") != std::string::npos);
+    REQUIRE(stream.str().find("code=3 argument=42") != std::string::npos);
+
+    // Rings of finished threads are reused
+    for (int i = 0; i < 8; ++i)
+        std::thread([i]() { FlightRecorder::Record(4, i); }).join();
+    REQUIRE(FlightRecorder::dropped() == 0);
+
+    // Records of threads without free rings are dropped
+    std::atomic<int> recorded(0);
+    std::atomic<bool> finish(false);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 5; ++i)
+    {
+        threads.emplace_back([&recorded, &finish]()
+        {
+            FlightRecorder::Record(5, "thread");
+            ++recorded;
+            while (!finish)
+                std::this_thread::yield();
+        });
+    }
+    while (recorded < 5)
+        std::this_thread::yield();
+    finish = true;
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(FlightRecorder::dropped() == 2);
+
+    // Setup again is ignored
+    FlightRecorder::Setup("test_flight_recorder_other");
+    REQUIRE(FlightRecorder::name() == "test_flight_recorder");
+}
@@ -0,0 +1,107 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/perf_counters.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+uint64_t Work(uint64_t iterations)
+{
+    volatile uint64_t result = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+        result = result + i * i;
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Performance counters values", "[CppCommon][System]")
+{
+    PerfCounterValues values1;
+    values1.cycles = 100;
+    values1.instructions = 250;
+    values1.branch_misses = 5;
+
+    PerfCounterValues values2;
+    values2.cycles = 40;
+    values2.instructions = 50;
+    values2.branch_misses = 1;
+
+    PerfCounterValues sum = values1 + values2;
+    REQUIRE(sum.cycles == 140);
+    REQUIRE(sum.instructions == 300);
+    REQUIRE(sum.value(PerfEvent::BRANCH_MISSES) == 6);
+
+    PerfCounterValues difference = values1 - values2;
+    REQUIRE(difference.cycles == 60);
+    REQUIRE(difference.value(PerfEvent::INSTRUCTIONS) == 200);
+
+    REQUIRE(values1.ipc() == 2.5);
+    REQUIRE(PerfCounterValues().ipc() == 0.0);
+}
+
+TEST_CASE("Performance counters", "[CppCommon][System]")
+{
+    PerfCounters counters;
+
+    // Unavailable counters are read as zero
+    PerfCounterValues values;
+    {
+        PerfScope scope(counters, values);
+        Work(100000);
+    }
+    if (counters.available(PerfEvent::INSTRUCTIONS))
+        REQUIRE(values.instructions > 100000);
+    else
+        REQUIRE(values.instructions == 0);
+    if (!counters.available(PerfEvent::CYCLES))
+        REQUIRE(values.cycles == 0);
+
+    // Counters values are accumulated
+    PerfCounterValues start = counters.Read();
+    Work(1000);
+    PerfCounterValues finish = counters.Read();
+    REQUIRE(finish.cycles >= start.cycles);
+    REQUIRE(finish.instructions >= start.instructions);
+    REQUIRE(finish.context_switches >= start.context_switches);
+}
+
+TEST_CASE("Performance probe", "[CppCommon][System]")
+{
+    PerfProbe probe("test", 10);
+    REQUIRE(std::string(probe.name()) == "test");
+    REQUIRE(probe.sampling() == 10);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&probe]()
+        {
+            for (int j = 0; j < 250; ++j)
+            {
+                PERF_PROBE(probe);
+                Work(100);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(probe.calls() == 1000);
+    REQUIRE(probe.samples() == 100);
+    if (PerfCounters::thread().available(PerfEvent::INSTRUCTIONS))
+        REQUIRE(probe.average().instructions > 100);
+
+    probe.Reset();
+    REQUIRE(probe.calls() == 0);
+    REQUIRE(probe.samples() == 0);
+    REQUIRE(probe.total().instructions == 0);
+}
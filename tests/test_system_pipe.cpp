@@ -4,8 +4,11 @@
 
 #include "test.h"
 
+#include "filesystem/filesystem.h"
 #include "system/pipe.h"
 
+#include <cstring>
+
 #include <thread>
 
 using namespace CppCommon;
@@ -61,3 +64,134 @@ TEST_CASE("Pipe threads", "[CppCommon][System]")
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Pipe buffer chain", "[CppCommon][System]")
+{
+    Pipe pipe;
+
+    BufferChain chain(8);
+    chain.Append("Hello, World!", 13);
+    REQUIRE(pipe.WriteFrom(chain) == 13);
+    REQUIRE(chain.empty());
+    REQUIRE(pipe.ReadInto(chain, 13) == 13);
+    REQUIRE(chain.ToString() == "Hello, World!");
+}
+
+TEST_CASE("Pipe splice", "[CppCommon][System]")
+{
+    std::string text(100000, 0);
+    for (size_t i = 0; i < text.size(); ++i)
+        text[i] = (char)('0' + (i % 10));
+
+    Path source = Path::unique() + ".tmp";
+    Path destination = Path::unique() + ".tmp";
+    REQUIRE(File::WriteAllText(source, text) == text.size());
+
+    // Transfer the file through the pipe into another file
+    File input(source);
+    input.Open(true, false);
+    File output(destination);
+    output.Create(false, true);
+    output.Write("header", 6);
+
+    Pipe pipe;
+    auto producer = std::thread([&pipe, &input, &text]()
+    {
+        input.SpliceTo(pipe, text.size());
+        pipe.CloseWrite();
+    });
+    REQUIRE(output.SpliceFrom(pipe, text.size() * 2) == text.size());
+    producer.join();
+
+    input.Close();
+    output.Close();
+    REQUIRE(File::ReadAllText(destination) == "header" + text);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Duplicate pipe content without consuming it
+    Pipe pipe1;
+    Pipe pipe2;
+    REQUIRE(pipe1.Write("tee", 3) == 3);
+    REQUIRE(pipe1.Tee(pipe2, 3) == 3);
+    char buffer1[3];
+    char buffer2[3];
+    REQUIRE(pipe1.Read(buffer1, 3) == 3);
+    REQUIRE(pipe2.Read(buffer2, 3) == 3);
+    REQUIRE(std::memcmp(buffer1, "tee", 3) == 0);
+    REQUIRE(std::memcmp(buffer2, "tee", 3) == 0);
+#endif
+
+    File::Remove(source);
+    File::Remove(destination);
+}
+
+TEST_CASE("Pipe non-blocking", "[CppCommon][System]")
+{
+    Pipe pipe;
+    REQUIRE(pipe.IsBlocking());
+    pipe.SetBlocking(false);
+    REQUIRE(!pipe.IsBlocking());
+
+    // Empty non-blocking pipe does not wait
+    char buffer[16];
+    REQUIRE(pipe.Read(buffer, sizeof(buffer)) == 0);
+    REQUIRE(!pipe.IsPipeEOF());
+
+    // Full non-blocking pipe does not wait
+    std::vector<char> data(65536, 'x');
+    size_t written = 0;
+    size_t result;
+    while ((result = pipe.Write(data.data(), data.size())) > 0)
+        written += result;
+    REQUIRE(written > 0);
+
+    // End of stream is reported after the write endpoint is closed
+    pipe.CloseWrite();
+    size_t read = 0;
+    while ((result = pipe.Read(data.data(), data.size())) > 0)
+        read += result;
+    REQUIRE(read == written);
+    REQUIRE(pipe.IsPipeEOF());
+}
+
+TEST_CASE("Pipe capacity", "[CppCommon][System]")
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    Pipe pipe(262144);
+    REQUIRE(pipe.capacity() >= 262144);
+    REQUIRE(pipe.SetCapacity(131072) == 131072);
+    REQUIRE(pipe.capacity() == 131072);
+#endif
+
+    // Move and map bytes between pipes
+    Pipe pipe1;
+    Pipe pipe2;
+    static const char text[] = "splice";
+    REQUIRE(pipe1.SpliceFrom(text, 6) == 6);
+    REQUIRE(pipe1.Splice(pipe2, 6) == 6);
+    char buffer[6];
+    REQUIRE(pipe2.Read(buffer, 6) == 6);
+    REQUIRE(std::memcmp(buffer, "splice", 6) == 0);
+
+    pipe1.CloseWrite();
+    REQUIRE(pipe1.Splice(pipe2, 6) == 0);
+    REQUIRE(pipe1.IsPipeEOF());
+}
+
+TEST_CASE("Pipe error codes", "[CppCommon][System]")
+{
+    Pipe pipe;
+    std::error_code ec;
+
+    REQUIRE(pipe.Write("test", 4, ec) == 4);
+    REQUIRE(!ec);
+    pipe.CloseWrite();
+
+    char buffer[8];
+    REQUIRE(pipe.Read(buffer, sizeof(buffer), ec) == 4);
+    REQUIRE(!ec);
+    REQUIRE(std::memcmp(buffer, "test", 4) == 0);
+    REQUIRE(pipe.Read(buffer, sizeof(buffer), ec) == 0);
+    REQUIRE(!ec);
+    REQUIRE(pipe.IsPipeEOF());
+}
@@ -17,3 +17,32 @@ TEST_CASE("Process", "[CppCommon][System]")
     REQUIRE(Process::CurrentProcess().IsRunning());
     REQUIRE(Process::ParentProcess().IsRunning());
 }
+
+TEST_CASE("Process usage", "[CppCommon][System]")
+{
+    ProcessUsage usage = Process::CurrentUsage();
+    REQUIRE(usage.cpu() > Timespan::zero());
+    REQUIRE(usage.rss > 0);
+    REQUIRE(usage.peak_rss >= usage.rss);
+    REQUIRE(usage.minor_faults > 0);
+}
+
+TEST_CASE("Process run", "[CppCommon][System]")
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Large input, output and error streams must not deadlock
+    std::string input(1048576, 'x');
+    std::string output;
+    std::string error;
+    std::vector<std::string> arguments = { "-c", "cat; head -c 1048576 /dev/zero >&2; exit 3" };
+    REQUIRE(Process::Run("/bin/sh", &arguments, nullptr, nullptr, &input, &output, &error) == 3);
+    REQUIRE(output == input);
+    REQUIRE(error == std::string(1048576, '\0'));
+
+    // Process may exit without reading its input
+    output.clear();
+    arguments = { "-c", "echo done" };
+    REQUIRE(Process::Run("/bin/sh", &arguments, nullptr, nullptr, &input, &output, nullptr) == 0);
+    REQUIRE(output == "done\n");
+#endif
+}
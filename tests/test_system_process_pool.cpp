@@ -0,0 +1,55 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/process_pool.h"
+#include "threads/thread.h"
+
+using namespace CppCommon;
+
+TEST_CASE("Process pool", "[CppCommon][System]")
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // 'cat' worker echoes framed jobs back as results
+    ProcessPool pool("cat", nullptr, 2);
+    REQUIRE(pool.workers() == 2);
+    REQUIRE(pool.pid(0) != pool.pid(1));
+
+    REQUIRE(pool.Execute("test") == "test");
+    REQUIRE(pool.Execute("") == "");
+
+    // Large jobs must not deadlock
+    std::string large(1048576, 'x');
+    REQUIRE(pool.Execute(large) == large);
+
+    // Results of each worker are delivered in the order of submission
+    std::vector<std::future<std::string>> results;
+    for (int i = 0; i < 100; ++i)
+        results.emplace_back(pool.Submit(std::to_string(i)));
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(results[i].get() == std::to_string(i));
+    REQUIRE(pool.pending() == 0);
+
+    pool.Stop();
+    REQUIRE_THROWS_AS(pool.Submit("test"), SystemException);
+#endif
+}
+
+TEST_CASE("Process pool restart", "[CppCommon][System]")
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Worker which exits after reading the job header
+    std::vector<std::string> arguments = { "-c", "exec head -c 4 >/dev/null" };
+    ProcessPool pool("/bin/sh", &arguments, 1);
+    uint64_t pid = pool.pid(0);
+
+    // Crashed worker fails its pending jobs and is restarted
+    REQUIRE_THROWS_AS(pool.Execute("test"), SystemException);
+    while (pool.restarts() == 0)
+        Thread::Yield();
+    REQUIRE(pool.pid(0) != pid);
+    REQUIRE(pool.pending() == 0);
+#endif
+}
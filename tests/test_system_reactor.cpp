@@ -0,0 +1,138 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "system/pipe.h"
+#include "system/reactor.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<void> Read(Reactor& reactor, Pipe& pipe, std::string& content)
+{
+    char buffer[64];
+    for (;;)
+    {
+        size_t size = pipe.Read(buffer, sizeof(buffer));
+        if (size > 0)
+        {
+            content.append(buffer, size);
+            continue;
+        }
+        if (pipe.IsPipeEOF())
+            co_return;
+        co_await reactor.Wait(pipe.reader(), ReactorEvents::READABLE);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Reactor", "[CppCommon][System]")
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    Reactor reactor;
+    REQUIRE(reactor.handles() == 0);
+    REQUIRE(reactor.Poll() == 0);
+
+    // Multiplex many pipes in the single thread
+    const size_t count = 100;
+    std::vector<std::unique_ptr<Pipe>> pipes;
+    std::string content;
+    size_t hangups = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        pipes.emplace_back(std::make_unique<Pipe>());
+        Pipe* pipe = pipes.back().get();
+        pipe->SetBlocking(false);
+        reactor.Add(pipe->reader(), ReactorEvents::READABLE, [&, pipe](Flags<ReactorEvents> events)
+        {
+            char buffer[64];
+            size_t size;
+            while ((size = pipe->Read(buffer, sizeof(buffer))) > 0)
+                content.append(buffer, size);
+            if (pipe->IsPipeEOF())
+            {
+                ++hangups;
+                reactor.Remove(pipe->reader());
+            }
+        });
+    }
+    REQUIRE(reactor.handles() == count);
+
+    for (size_t i = 0; i < count; ++i)
+        pipes[i]->Write("x", 1);
+    while (content.size() < count)
+        reactor.Poll(Timespan::seconds(1));
+    REQUIRE(content == std::string(count, 'x'));
+
+    for (auto& pipe : pipes)
+        pipe->CloseWrite();
+    while (hangups < count)
+        reactor.Poll(Timespan::seconds(1));
+    REQUIRE(reactor.handles() == 0);
+
+    // Single notification of the writable pipe
+    Pipe pipe;
+    Flags<ReactorEvents> result;
+    reactor.AddOnce(pipe.writer(), ReactorEvents::WRITABLE, [&result](Flags<ReactorEvents> events) { result = events; });
+    REQUIRE(reactor.Poll(Timespan::seconds(1)) == 1);
+    REQUIRE((result & ReactorEvents::WRITABLE));
+    REQUIRE(reactor.handles() == 0);
+#endif
+}
+
+TEST_CASE("Reactor tasks", "[CppCommon][System]")
+{
+    Reactor reactor;
+
+    // Posted tasks wake up the reactor thread
+    std::atomic<int> counter(0);
+    std::thread thread([&reactor]() { reactor.Run(); });
+    for (int i = 0; i < 100; ++i)
+        reactor.Post([&counter]() { counter.fetch_add(1); });
+
+    // Timer service dispatches timers into the reactor thread
+    TimerService timers(reactor.executor());
+    std::atomic<bool> fired(false);
+    timers.ScheduleAfter(Timespan::milliseconds(10), [&fired]() { fired = true; });
+    while (!fired)
+        std::this_thread::yield();
+
+    reactor.Post([&reactor]() { reactor.Stop(); });
+    thread.join();
+    REQUIRE(counter == 100);
+    REQUIRE(reactor.stopped());
+}
+
+TEST_CASE("Reactor coroutines", "[CppCommon][System]")
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    Reactor reactor;
+    SingleThreadScheduler scheduler;
+
+    Pipe pipe;
+    pipe.SetBlocking(false);
+    std::string content;
+    scheduler.Spawn(Read(reactor, pipe, content));
+    scheduler.Poll();
+    REQUIRE(reactor.handles() == 1);
+
+    pipe.Write("test", 4);
+    pipe.CloseWrite();
+    while (!pipe.IsPipeEOF())
+    {
+        reactor.Poll(Timespan::seconds(1));
+        scheduler.Poll();
+    }
+    REQUIRE(content == "test");
+    REQUIRE(reactor.handles() == 0);
+#endif
+}
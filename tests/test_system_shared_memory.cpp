@@ -31,3 +31,35 @@ TEST_CASE("Shared memory manager", "[CppCommon][System]")
     // Read from the shared memory buffer
     REQUIRE(std::memcmp(shared1.ptr(), shared2.ptr(), size) == 0);
 }
+
+TEST_CASE("Shared memory manager options", "[CppCommon][System]")
+{
+    const char* name = "shared_memory_options_test";
+    size_t size = 4 * 1024 * 1024 + 123;
+
+    // Options are a best effort, so the shared memory must work even if they are not supported
+    SharedMemoryOptions options;
+    options.huge_pages = true;
+    options.prefault = true;
+    options.lock = true;
+    options.node = 0;
+
+    SharedMemory shared1(name, size, options);
+    REQUIRE(shared1.owner());
+    REQUIRE(shared1.ptr() != nullptr);
+    REQUIRE(shared1.size() == size);
+    REQUIRE(shared1.options().huge_pages);
+    REQUIRE(shared1.options().node == 0);
+
+    // Write into the whole shared memory buffer
+    std::memset(shared1.ptr(), 0x5A, size);
+
+    SharedMemory shared2(name, size, options);
+    REQUIRE(!shared2.owner());
+    REQUIRE(shared2.huge_pages() == shared1.huge_pages());
+
+    // Prefault of the opened shared memory keeps its content
+    REQUIRE(((const uint8_t*)shared2.ptr())[0] == 0x5A);
+    REQUIRE(((const uint8_t*)shared2.ptr())[size - 1] == 0x5A);
+    REQUIRE(std::memcmp(shared1.ptr(), shared2.ptr(), size) == 0);
+}
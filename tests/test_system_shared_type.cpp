@@ -31,3 +31,19 @@ TEST_CASE("Shared memory type", "[CppCommon][System]")
     // Check the value of the shared memory type
     REQUIRE(shared1.ref() == *shared2);
 }
+
+TEST_CASE("Shared memory type options", "[CppCommon][System]")
+{
+    SharedMemoryOptions options;
+    options.prefault = true;
+
+    SharedType<int64_t> shared1("shared_type_options_test", options);
+    REQUIRE(shared1.owner());
+    REQUIRE(!shared1.huge_pages());
+    REQUIRE(*shared1 == 0);
+    *shared1 = 123;
+
+    SharedType<int64_t> shared2("shared_type_options_test", options);
+    REQUIRE(!shared2.owner());
+    REQUIRE(*shared2 == 123);
+}
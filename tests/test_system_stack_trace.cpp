@@ -8,6 +8,7 @@
 #include "system/stack_trace_manager.h"
 
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -73,3 +74,88 @@ TEST_CASE("Stack trace snapshot provider", "[CppCommon][System]")
 
     StackTraceManager::Cleanup();
 }
+
+TEST_CASE("Stack trace frames capture", "[CppCommon][System]")
+{
+    StackTraceManager::Initialize();
+
+    void* frames[64];
+    int captured = StackTrace::Capture(frames, 64);
+    REQUIRE(captured > 0);
+
+    auto trace = StackTrace(frames, captured);
+    REQUIRE(trace.frames().size() == (size_t)captured);
+    validate(trace.frames());
+    REQUIRE(trace.frames()[0].address == frames[0]);
+
+    REQUIRE(StackTrace::Capture(frames, 1) == 1);
+    REQUIRE(StackTrace::Capture(frames, 0) == 0);
+
+    StackTraceManager::Cleanup();
+}
+
+TEST_CASE("Stack trace lazy symbols resolving", "[CppCommon][System]")
+{
+    StackTraceManager::Initialize();
+
+    // Stack trace captures only frames addresses
+    auto trace = function3();
+    REQUIRE(!trace.resolved());
+    REQUIRE(!trace.addresses().empty());
+
+    // Copy of not resolved stack trace is not resolved
+    auto copy = trace;
+    REQUIRE(!copy.resolved());
+
+    // Symbols are resolved on the first access
+    validate(trace.frames());
+    REQUIRE(trace.resolved());
+    REQUIRE(trace.frames().size() == trace.addresses().size());
+    for (size_t i = 0; i < trace.addresses().size(); ++i)
+        REQUIRE(trace.frames()[i].address == trace.addresses()[i]);
+
+    // Copy of resolved stack trace is resolved
+    auto resolved = trace;
+    REQUIRE(resolved.resolved());
+    equal(resolved.frames(), trace.frames(), (int)trace.frames().size());
+
+    // Cached symbols are the same for the same addresses
+    REQUIRE(copy.string() == trace.string());
+    StackTrace::ClearCache();
+    REQUIRE(StackTrace(trace.addresses().data(), (int)trace.addresses().size()).string() == trace.string());
+
+    // Concurrent resolving of the same stack trace
+    auto shared = function3();
+    std::vector<std::thread> threads;
+    std::vector<std::string> results(4);
+    for (auto& result : results)
+        threads.emplace_back([&shared, &result]() { result = shared.string(); });
+    for (auto& thread : threads)
+        thread.join();
+    for (const auto& result : results)
+        REQUIRE(result == results[0]);
+
+    StackTraceManager::Cleanup();
+}
+
+TEST_CASE("Stack trace manager lazy initialization", "[CppCommon][System]")
+{
+    StackTraceManager::Initialize(true);
+
+    // Debug symbols are loaded on the first symbols resolution
+    StackTrace::ClearCache();
+    auto trace = function3();
+    validate(trace.frames());
+
+    // Concurrent symbols loading is safe
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([]() { StackTraceManager::LoadSymbols(); });
+    for (auto& thread : threads)
+        thread.join();
+
+    StackTraceManager::Cleanup();
+
+    // Loading symbols of not initialized manager does nothing
+    StackTraceManager::LoadSymbols();
+}
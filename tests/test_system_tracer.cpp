@@ -0,0 +1,89 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/file.h"
+#include "system/tracer.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Tracer Chrome trace", "[CppCommon][System]")
+{
+    REQUIRE(!Tracer::enabled());
+
+    // Disabled tracepoints are not recorded
+    {
+        TRACE_SCOPE("disabled");
+    }
+
+    Tracer::Start("test.trace.json", TraceFormat::Chrome);
+    REQUIRE(Tracer::enabled());
+
+    Tracer::SetThreadName("Main \"thread\"");
+    {
+        TRACE_SCOPE("main");
+        TRACE_INSTANT("instant");
+        TRACE_COUNTER("counter", -42);
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 2; ++i)
+    {
+        threads.emplace_back([]()
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                TRACE_SCOPE("worker");
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    Tracer::Stop();
+    REQUIRE(!Tracer::enabled());
+    REQUIRE(Tracer::dropped() == 0);
+
+    std::string trace = File::ReadAllText("test.trace.json");
+    REQUIRE(trace.front() == '[');
+    REQUIRE(trace.find("\n]\n") != std::string::npos);
+    REQUIRE(trace.find("\"disabled\"") == std::string::npos);
+    REQUIRE(trace.find("{\"name\":\"main\",\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(trace.find("{\"name\":\"instant\",\"ph\":\"i\"") != std::string::npos);
+    REQUIRE(trace.find("\"args\":{\"value\":-42}") != std::string::npos);
+    REQUIRE(trace.find("\"args\":{\"name\":\"Main \\\"thread\\\"\"}") != std::string::npos);
+
+    // Count worker scopes of both threads
+    size_t workers = 0;
+    for (size_t pos = trace.find("\"worker\""); pos != std::string::npos; pos = trace.find("\"worker\"", pos + 1))
+        ++workers;
+    REQUIRE(workers == 200);
+
+    File::Remove("test.trace.json");
+}
+
+TEST_CASE("Tracer Perfetto trace", "[CppCommon][System]")
+{
+    Tracer::Start("test.trace.pftrace", TraceFormat::Perfetto);
+    {
+        TRACE_SCOPE("perfetto-scope");
+        TRACE_COUNTER("perfetto-counter", 7);
+    }
+    Tracer::Flush();
+    Tracer::Stop();
+
+    std::vector<uint8_t> trace = File::ReadAllBytes("test.trace.pftrace");
+    std::string text(trace.begin(), trace.end());
+    REQUIRE(trace.size() > 0);
+    // Trace message consists of length-delimited packets (field 1)
+    REQUIRE(trace[0] == 0x0A);
+    REQUIRE(text.find("perfetto-scope") != std::string::npos);
+    REQUIRE(text.find("perfetto-counter") != std::string::npos);
+
+    File::Remove("test.trace.pftrace");
+}
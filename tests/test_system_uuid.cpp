@@ -5,6 +5,11 @@
 #include "test.h"
 
 #include "system/uuid.h"
+#include "time/timestamp.h"
+
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -14,6 +19,26 @@ TEST_CASE("UUID common", "[CppCommon][System]")
     REQUIRE("{01234567-89ab-cdef-FEDC-BA9876543210}"_uuid.string() == "01234567-89ab-cdef-fedc-ba9876543210");
     REQUIRE(UUID("01234567-89ab-cdef-fedc-ba9876543210").string() == "01234567-89ab-cdef-fedc-ba9876543210");
     REQUIRE(UUID(std::string("01234567-89ab-cdef-fedc-ba9876543210")).string() == "01234567-89ab-cdef-fedc-ba9876543210");
+    REQUIRE(UUID(std::string("01234567-89AB-CDEF-FEDC-BA9876543210")).string() == "01234567-89ab-cdef-fedc-ba9876543210");
+    REQUIRE(UUID(std::string("{01234567-89ab-cdef-fedc-ba9876543210}")).string() == "01234567-89ab-cdef-fedc-ba9876543210");
+    REQUIRE(UUID(std::string("0123456789abcdeffedcba9876543210")).string() == "01234567-89ab-cdef-fedc-ba9876543210");
+    REQUIRE(UUID(std::string("01234567-89ab")).string() == "01234567-89ab-0000-0000-000000000000");
+    REQUIRE_THROWS_AS(UUID(std::string("01234567-89ab-cdef-fedc-ba987654321g")), DomainException);
+
+    char buffer[36];
+    REQUIRE("ffffffff-0000-0000-0000-000000000000"_uuid.string(buffer, sizeof(buffer)) == 36);
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "ffffffff-0000-0000-0000-000000000000");
+    REQUIRE(UUID().string(buffer, 35) == 0);
+
+    // Round trip of all byte values
+    for (int i = 0; i < 256; i += 16)
+    {
+        std::array<uint8_t, 16> data;
+        for (int j = 0; j < 16; ++j)
+            data[j] = (uint8_t)(i + j);
+        UUID uuid(data);
+        REQUIRE(UUID(uuid.string()) == uuid);
+    }
 }
 
 void test_uuid(const UUID& uuid)
@@ -34,4 +59,53 @@ TEST_CASE("UUID generate", "[CppCommon][System]")
     test_uuid(UUID::Sequential());
     test_uuid(UUID::Random());
     test_uuid(UUID::Secure());
+    test_uuid(UUID::Ordered());
+
+    REQUIRE(UUID::Nil().version() == 0);
+    REQUIRE(UUID::Sequential().version() == 1);
+    REQUIRE(UUID::Random().version() == 4);
+    REQUIRE(UUID::Ordered().version() == 7);
+    REQUIRE((UUID::Random().data()[8] & 0xC0) == 0x80);
+    REQUIRE((UUID::Ordered().data()[8] & 0xC0) == 0x80);
+}
+
+TEST_CASE("UUID random and ordered generators", "[CppCommon][System]")
+{
+    // Generated UUIDs are unique in all threads and ordered UUIDs are monotonic in each thread
+    std::vector<std::vector<UUID>> results(4);
+    std::vector<int> monotonic(results.size(), 1);
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        threads.emplace_back([&result = results[index], &ordered = monotonic[index]]()
+        {
+            UUID previous;
+            for (int i = 0; i < 50000; ++i)
+            {
+                UUID current = UUID::Ordered();
+                if (!(previous < current))
+                    ordered = 0;
+                previous = current;
+                result.push_back(current);
+                result.push_back(UUID::Random());
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (int ordered : monotonic)
+        REQUIRE(ordered == 1);
+
+    std::set<UUID> unique;
+    for (const auto& result : results)
+        unique.insert(result.begin(), result.end());
+    REQUIRE(unique.size() == 400000);
+
+    // Unix time in milliseconds is stored in the first 48 bits
+    uint64_t milliseconds = 0;
+    UUID ordered = UUID::Ordered();
+    for (size_t i = 0; i < 6; ++i)
+        milliseconds = (milliseconds << 8) | ordered.data()[i];
+    REQUIRE(milliseconds >= (Timestamp::utc() / 1000000) - 1000);
+    REQUIRE(milliseconds <= (Timestamp::utc() / 1000000) + 1000);
 }
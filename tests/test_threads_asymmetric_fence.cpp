@@ -0,0 +1,69 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/asymmetric_fence.h"
+#include "threads/barrier.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Asymmetric fence", "[CppCommon][Threads]")
+{
+    bool supported = AsymmetricFence::Initialize();
+    REQUIRE(AsymmetricFence::IsSupported() == supported);
+
+    AsymmetricFence::Light();
+    AsymmetricFence::Heavy();
+}
+
+TEST_CASE("Asymmetric fence Dekker protocol", "[CppCommon][Threads]")
+{
+    int rounds = 1000;
+
+    AsymmetricFence::Initialize();
+
+    // Light and heavy threads publish their flags and check the flag of each other
+    std::atomic<int> light_flag(0);
+    std::atomic<int> heavy_flag(0);
+    std::vector<char> light_seen(rounds + 1, 0);
+    std::vector<char> heavy_seen(rounds + 1, 0);
+    Barrier barrier(2);
+
+    std::thread light([&]()
+    {
+        for (int round = 1; round <= rounds; ++round)
+        {
+            barrier.Wait();
+            light_flag.store(round, std::memory_order_relaxed);
+            AsymmetricFence::Light();
+            light_seen[round] = (heavy_flag.load(std::memory_order_relaxed) >= round);
+        }
+    });
+
+    std::thread heavy([&]()
+    {
+        for (int round = 1; round <= rounds; ++round)
+        {
+            barrier.Wait();
+            heavy_flag.store(round, std::memory_order_relaxed);
+            AsymmetricFence::Heavy();
+            heavy_seen[round] = (light_flag.load(std::memory_order_relaxed) >= round);
+        }
+    });
+
+    light.join();
+    heavy.join();
+
+    // At least one of threads must observe the flag of the other one in each round
+    int violations = 0;
+    for (int round = 1; round <= rounds; ++round)
+        if (!light_seen[round] && !heavy_seen[round])
+            ++violations;
+    REQUIRE(violations == 0);
+}
@@ -5,8 +5,12 @@
 #include "test.h"
 
 #include "threads/condition_variable.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -94,3 +98,113 @@ TEST_CASE("Condition variable notify all", "[CppCommon][Threads]")
     // Check result
     REQUIRE(result == concurrency);
 }
+
+TEST_CASE("Condition variable timed wait", "[CppCommon][Threads]")
+{
+    CriticalSection cs;
+    ConditionVariable cv;
+    bool finish = false;
+
+    // Timed wait without notification expires after the given timespan
+    {
+        Locker<CriticalSection> locker(cs);
+        auto start = NanoTimestamp();
+        REQUIRE(!cv.TryWaitFor(cs, Timespan::milliseconds(20), [&finish]() { return finish; }));
+        REQUIRE((NanoTimestamp() - start).milliseconds() >= 19);
+    }
+
+    // Timed wait with notification returns before the timeout
+    auto thread = std::thread([&cs, &cv, &finish]()
+    {
+        Thread::Sleep(10);
+        Locker<CriticalSection> locker(cs);
+        finish = true;
+        cv.NotifyOne();
+    });
+    {
+        Locker<CriticalSection> locker(cs);
+        REQUIRE(cv.TryWaitFor(cs, Timespan::seconds(10), [&finish]() { return finish; }));
+    }
+    thread.join();
+}
+
+TEST_CASE("Condition variable with the recursive critical section", "[CppCommon][Threads]")
+{
+    CriticalSection cs;
+    ConditionVariable cv;
+    bool ready = false;
+    bool busy = true;
+
+    // Waiting thread holds the recursive critical section three times
+    auto thread = std::thread([&cs, &cv, &ready, &busy]()
+    {
+        cs.Lock();
+        cs.Lock();
+        cs.Lock();
+        cv.Wait(cs, [&ready]() { return ready; });
+
+        // The recursion count is restored after the wait
+        cs.Unlock();
+        cs.Unlock();
+        busy = !cs.TryLock();
+        cs.Unlock();
+        cs.Unlock();
+    });
+
+    // All recursive acquisitions are released during the wait
+    Thread::Sleep(50);
+    cs.Lock();
+    ready = true;
+    cv.NotifyOne();
+    cs.Unlock();
+    thread.join();
+    REQUIRE(!busy);
+
+    // Critical section is released by the waiting thread
+    REQUIRE(cs.TryLock());
+    cs.Unlock();
+}
+
+TEST_CASE("Condition variable wake counts", "[CppCommon][Threads]")
+{
+    int concurrency = 4;
+    int waiting = 0;
+    std::atomic<int> woken(0);
+
+    CriticalSection cs;
+    ConditionVariable cv;
+
+    // Start waiting threads without predicates
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&cs, &cv, &waiting, &woken]()
+        {
+            Locker<CriticalSection> locker(cs);
+            ++waiting;
+            cv.Wait(cs);
+            ++woken;
+        });
+    }
+
+    // Wait for all threads are blocked
+    for (;;)
+    {
+        Locker<CriticalSection> locker(cs);
+        if (waiting == concurrency)
+            break;
+        Thread::Yield();
+    }
+    Thread::Sleep(50);
+
+    // One-thread notification wakes one thread
+    cv.NotifyOne();
+    Thread::Sleep(50);
+    REQUIRE(woken == 1);
+
+    // All-threads notification wakes all remaining threads
+    cv.NotifyAll();
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(woken == concurrency);
+}
@@ -0,0 +1,202 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_event_auto_reset.h"
+#include "threads/async_latch.h"
+#include "threads/async_queue.h"
+#include "threads/coroutine_scheduler.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<int> Value(int value)
+{
+    co_return value;
+}
+
+Task<int> Sum(int count)
+{
+    int result = 0;
+    for (int i = 1; i <= count; ++i)
+        result += co_await Value(i);
+    co_return result;
+}
+
+Task<std::string> Throw()
+{
+    throw std::runtime_error("task error");
+    co_return std::string();
+}
+
+Task<void> Wait(AsyncEventAutoReset& event, std::atomic<int>& counter)
+{
+    co_await event;
+    counter.fetch_add(1);
+}
+
+Task<void> Wait(AsyncLatch& latch, std::atomic<int>& counter)
+{
+    co_await latch;
+    counter.fetch_add(1);
+}
+
+Task<void> Produce(AsyncQueue<int>& queue, int from, int to)
+{
+    for (int i = from; i < to; ++i)
+    {
+        bool enqueued = co_await queue.Enqueue(i);
+        REQUIRE(enqueued);
+    }
+}
+
+Task<void> Consume(AsyncQueue<int>& queue, std::atomic<int64_t>& sum, std::atomic<int>& count)
+{
+    int item;
+    while (co_await queue.Dequeue(item))
+    {
+        sum.fetch_add(item);
+        count.fetch_add(1);
+    }
+}
+
+Task<void> Sleep(std::atomic<int>& counter)
+{
+    co_await SleepFor(Timespan::milliseconds(10));
+    counter.fetch_add(1);
+}
+
+} // namespace
+
+TEST_CASE("Coroutine tasks", "[CppCommon][Threads]")
+{
+    REQUIRE(SyncWait(Value(42)) == 42);
+    REQUIRE(SyncWait(Sum(1000)) == 500500);
+    REQUIRE_THROWS_AS(SyncWait(Throw()), std::runtime_error);
+
+    Task<int> task = Value(1);
+    REQUIRE(task);
+    REQUIRE(!task.done());
+    Task<int> moved = std::move(task);
+    REQUIRE(!task);
+    REQUIRE(SyncWait(std::move(moved)) == 1);
+}
+
+TEST_CASE("Coroutine single-threaded scheduler", "[CppCommon][Threads]")
+{
+    SingleThreadScheduler scheduler;
+    REQUIRE(scheduler.Current() == nullptr);
+
+    // Awaitable auto-reset event resumes one coroutine per signal
+    AsyncEventAutoReset event;
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 3; ++i)
+        scheduler.Spawn(Wait(event, counter));
+    REQUIRE(scheduler.Poll() == 3);
+    REQUIRE(counter == 0);
+    event.Signal();
+    event.Signal();
+    REQUIRE(scheduler.Poll() == 2);
+    REQUIRE(counter == 2);
+    event.Signal();
+    scheduler.Poll();
+    REQUIRE(counter == 3);
+    event.Signal();
+    REQUIRE(event.TryWait());
+    REQUIRE(!event.TryWait());
+
+    // Awaitable latch resumes all coroutines at once
+    AsyncLatch latch(2);
+    counter = 0;
+    for (int i = 0; i < 5; ++i)
+        scheduler.Spawn(Wait(latch, counter));
+    scheduler.Poll();
+    latch.CountDown();
+    scheduler.Poll();
+    REQUIRE(counter == 0);
+    latch.CountDown();
+    REQUIRE(latch.TryWait());
+    REQUIRE(scheduler.Poll() == 5);
+    REQUIRE(counter == 5);
+
+    // Bounded awaitable queue with suspended producers and consumers
+    AsyncQueue<int> queue(4);
+    std::atomic<int64_t> sum(0);
+    std::atomic<int> count(0);
+    for (int i = 0; i < 2; ++i)
+        scheduler.Spawn(Consume(queue, sum, count));
+    for (int i = 0; i < 4; ++i)
+        scheduler.Spawn(Produce(queue, i * 1000, (i + 1) * 1000));
+    scheduler.Poll();
+    REQUIRE(count == 4000);
+    REQUIRE(sum == (3999 * 4000 / 2));
+    queue.Close();
+    scheduler.Poll();
+    REQUIRE(!queue.TryEnqueue(0));
+
+    // Sleeping coroutines are resumed by the scheduler
+    counter = 0;
+    for (int i = 0; i < 100; ++i)
+        scheduler.Spawn(Sleep(counter));
+    std::thread stopper([&scheduler, &counter]()
+    {
+        while (counter < 100)
+            Thread::Sleep(1);
+        scheduler.Stop();
+    });
+    scheduler.Run();
+    stopper.join();
+    REQUIRE(counter == 100);
+}
+
+TEST_CASE("Coroutine multi-threaded scheduler", "[CppCommon][Threads]")
+{
+    MultiThreadScheduler scheduler(4);
+    REQUIRE(scheduler.threads() == 4);
+
+    const int consumers = 100;
+    const int producers = 10;
+    const int items = 1000;
+
+    // Many consumer coroutines share a few worker threads
+    AsyncQueue<int> queue(16);
+    std::atomic<int64_t> sum(0);
+    std::atomic<int> count(0);
+    for (int i = 0; i < consumers; ++i)
+        scheduler.Spawn(Consume(queue, sum, count));
+    for (int i = 0; i < producers; ++i)
+        scheduler.Spawn(Produce(queue, i * items, (i + 1) * items));
+    while (count < (producers * items))
+        Thread::Yield();
+    queue.Close();
+    scheduler.Wait();
+    REQUIRE(count == (producers * items));
+    REQUIRE(sum == ((int64_t)(producers * items - 1) * (producers * items) / 2));
+
+    // Batch dequeue from the regular thread producer
+    AsyncQueue<std::string> batcher;
+    std::atomic<int> batched(0);
+    auto consumer = [](AsyncQueue<std::string>& batcher, std::atomic<int>& batched) -> Task<void>
+    {
+        std::vector<std::string> batch;
+        while (co_await batcher.DequeueAll(batch))
+            batched.fetch_add((int)batch.size());
+    };
+    scheduler.Spawn(consumer(batcher, batched));
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(batcher.TryEnqueue(std::to_string(i)));
+    while (batched < 1000)
+        Thread::Yield();
+    batcher.Close();
+    scheduler.Stop();
+    REQUIRE(batched == 1000);
+}
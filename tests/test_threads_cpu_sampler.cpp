@@ -0,0 +1,53 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/cpu_sampler.h"
+
+#include <atomic>
+
+using namespace CppCommon;
+
+TEST_CASE("CPU sampler", "[CppCommon][Threads]")
+{
+    CpuSampler sampler;
+    sampler.RegisterCurrentThread("main");
+
+    std::atomic<bool> stop(false);
+    std::thread sleeper = Thread::Start([&stop]()
+    {
+        while (!stop)
+            Thread::Sleep(1);
+    });
+    sampler.Register(sleeper, "sleeper");
+    REQUIRE(sampler.size() == 2);
+
+    // Burn some CPU time in the current thread
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < 20000000; ++i)
+        sum = sum + i;
+
+    CpuSample sample = sampler.Sample();
+    REQUIRE(sample.wall > Timespan::zero());
+    REQUIRE(sample.threads.size() == 2);
+    REQUIRE(sample.threads[0].name == "main");
+    REQUIRE(sample.threads[0].alive);
+    REQUIRE(sample.threads[0].cpu > Timespan::zero());
+    REQUIRE(sample.threads[0].utilization > 0.0);
+    REQUIRE(sample.threads[1].name == "sleeper");
+    REQUIRE(sample.threads[1].alive);
+    REQUIRE(sample.threads[1].cpu < sample.threads[0].cpu);
+    REQUIRE(sample.process.cpu() >= sample.threads[0].cpu);
+    REQUIRE(sample.utilization() > 0.0);
+    REQUIRE(sample.process.rss > 0);
+
+    // Finished thread is not alive
+    stop = true;
+    sleeper.join();
+    sample = sampler.Sample();
+    REQUIRE(sample.threads[0].alive);
+    REQUIRE(!sample.threads[1].alive);
+    REQUIRE(sample.threads[1].cpu == Timespan::zero());
+}
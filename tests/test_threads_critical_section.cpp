@@ -5,8 +5,12 @@
 #include "test.h"
 
 #include "threads/critical_section.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -21,6 +25,69 @@ TEST_CASE("Critical section", "[CppCommon][Threads]")
     // Test Lock()/Unlock() methods
     lock.Lock();
     lock.Unlock();
+
+    // Test recursive acquisitions
+    lock.Lock();
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.TryLockFor(Timespan::milliseconds(10)));
+    lock.Unlock();
+    lock.Unlock();
+    bool locked = true;
+    std::thread thread([&lock, &locked]() { locked = lock.TryLock(); });
+    thread.join();
+    REQUIRE(!locked);
+    lock.Unlock();
+    thread = std::thread([&lock, &locked]() { locked = lock.TryLock(); if (locked) lock.Unlock(); });
+    thread.join();
+    REQUIRE(locked);
+}
+
+TEST_CASE("Critical section timed lock", "[CppCommon][Threads]")
+{
+    CriticalSection lock;
+
+    // Timed lock of the busy critical section expires after the given timespan
+    lock.Lock();
+    bool locked = true;
+    Timestamp start = NanoTimestamp();
+    std::thread thread([&lock, &locked]() { locked = lock.TryLockFor(Timespan::milliseconds(50)); });
+    thread.join();
+    REQUIRE(!locked);
+    REQUIRE((NanoTimestamp() - start).milliseconds() >= 49);
+
+    // Timed lock blocked on the contended critical section is woken by the release
+    thread = std::thread([&lock, &locked]() { locked = lock.TryLockFor(Timespan::seconds(10)); if (locked) lock.Unlock(); });
+    Thread::Sleep(50);
+    start = NanoTimestamp();
+    lock.Unlock();
+    thread.join();
+    REQUIRE(locked);
+    REQUIRE((NanoTimestamp() - start).seconds() < 5);
+}
+
+TEST_CASE("Critical section contended handoff", "[CppCommon][Threads]")
+{
+    int waiters = 8;
+    CriticalSection lock;
+    std::atomic<int> acquired(0);
+
+    // Waiters block on the contended critical section held by the current thread
+    lock.Lock();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < waiters; ++i)
+        threads.emplace_back([&lock, &acquired]() { lock.Lock(); ++acquired; lock.Unlock(); });
+    Thread::Sleep(50);
+    REQUIRE(acquired == 0);
+
+    // Each release of the contended critical section wakes the next waiter
+    lock.Unlock();
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(acquired == waiters);
+
+    // Critical section is uncontended again
+    REQUIRE(lock.TryLock());
+    lock.Unlock();
 }
 
 TEST_CASE("Critical section locker", "[CppCommon][Threads]")
@@ -50,3 +50,26 @@ TEST_CASE("Auto-reset event", "[CppCommon][Threads]")
     // Check results
     REQUIRE(count == concurrency);
 }
+
+TEST_CASE("Auto-reset event timeout", "[CppCommon][Threads]")
+{
+    EventAutoReset event;
+
+    // Test TryWaitFor() method on the non-signaled event
+    REQUIRE(!event.TryWait());
+    REQUIRE(!event.TryWaitFor(Timespan::milliseconds(10)));
+
+    // Test TryWaitFor() method on the signaled event
+    event.Signal();
+    REQUIRE(event.TryWaitFor(Timespan::milliseconds(10)));
+    REQUIRE(!event.TryWait());
+
+    // Test the blocked thread is woken by signal
+    bool signaled = false;
+    std::thread waiter([&event, &signaled]() { signaled = event.TryWaitFor(Timespan::seconds(10)); });
+    Thread::Sleep(10);
+    event.Signal();
+    waiter.join();
+    REQUIRE(signaled);
+    REQUIRE(!event.TryWait());
+}
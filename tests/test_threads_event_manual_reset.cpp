@@ -49,3 +49,26 @@ TEST_CASE("Manual-reset event", "[CppCommon][Threads]")
     // Check results
     REQUIRE(count == concurrency);
 }
+
+TEST_CASE("Manual-reset event timeout", "[CppCommon][Threads]")
+{
+    EventManualReset event;
+
+    // Test TryWaitFor() method on the non-signaled event
+    REQUIRE(!event.TryWait());
+    REQUIRE(!event.TryWaitFor(Timespan::milliseconds(10)));
+
+    // Test the blocked thread is woken by signal
+    bool signaled = false;
+    std::thread waiter([&event, &signaled]() { signaled = event.TryWaitFor(Timespan::seconds(10)); });
+    Thread::Sleep(10);
+    event.Signal();
+    waiter.join();
+    REQUIRE(signaled);
+
+    // Test the event stays signaled until reset
+    REQUIRE(event.TryWait());
+    REQUIRE(event.TryWaitFor(Timespan::milliseconds(10)));
+    event.Reset();
+    REQUIRE(!event.TryWait());
+}
@@ -10,6 +10,10 @@
 #include <thread>
 #include <vector>
 
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <signal.h>
+#endif
+
 using namespace CppCommon;
 
 TEST_CASE("File-lock", "[CppCommon][Threads]")
@@ -38,6 +42,76 @@ TEST_CASE("File-lock", "[CppCommon][Threads]")
     lock1.UnlockWrite();
 }
 
+TEST_CASE("File-lock timed wait", "[CppCommon][Threads]")
+{
+    FileLock lock1(".lock");
+    FileLock lock2(".lock");
+
+    // Test timeout of the blocked wait
+    lock1.LockWrite();
+    Timestamp start = NanoTimestamp();
+    REQUIRE(!lock2.TryLockReadFor(Timespan::milliseconds(50)));
+    REQUIRE((NanoTimestamp() - start) >= Timespan::milliseconds(50));
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Test the interrupting signal is not left pending after the timeout
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(!lock2.TryLockReadFor(Timespan::milliseconds(1)));
+    sigset_t pending;
+    sigemptyset(&pending);
+    REQUIRE(sigpending(&pending) == 0);
+    REQUIRE(sigismember(&pending, SIGRTMAX - 1) == 0);
+#endif
+
+    // Test the lock released during the blocked wait
+    std::thread thread = std::thread([&lock1]()
+    {
+        Thread::Sleep(20);
+        lock1.UnlockWrite();
+    });
+    REQUIRE(lock2.TryLockWriteFor(Timespan::seconds(10)));
+    thread.join();
+    lock2.UnlockWrite();
+}
+
+TEST_CASE("File-lock byte ranges", "[CppCommon][Threads]")
+{
+    FileLock lock1(".data", false);
+    FileLock lock2(".data", false);
+
+    // Test disjoint byte ranges
+    REQUIRE(lock1.TryLockWrite(0, 100));
+    REQUIRE(lock2.TryLockWrite(100, 100));
+    REQUIRE(!lock2.TryLockRead(50, 100));
+    REQUIRE(!lock1.TryLockWriteFor(150, 10, Timespan::milliseconds(10)));
+    lock1.UnlockWrite(0, 100);
+    lock2.UnlockWrite(100, 100);
+
+    // Test shared byte ranges
+    lock1.LockRead(0, 100);
+    REQUIRE(lock2.TryLockRead(0, 100));
+    REQUIRE(!lock2.TryLockWrite(0, 1));
+    lock1.UnlockRead(0, 100);
+    lock2.UnlockRead(0, 100);
+
+    // Test the byte range released during the blocked wait
+    lock1.LockWrite(0, 100);
+    std::thread thread = std::thread([&lock1]()
+    {
+        Thread::Sleep(20);
+        lock1.UnlockWrite(0, 100);
+    });
+    REQUIRE(lock2.TryLockWriteFor(0, 100, Timespan::seconds(10)));
+    thread.join();
+    lock2.UnlockWrite(0, 100);
+
+    // Data file is not temporary
+    lock1.Reset();
+    lock2.Reset();
+    REQUIRE(File(".data").IsFileExists());
+    File::Remove(".data");
+}
+
 TEST_CASE("File-locker", "[CppCommon][Threads]")
 {
     int items_to_produce = 10;
@@ -0,0 +1,73 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/flat_combiner.h"
+
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Flat combiner", "[CppCommon][Threads]")
+{
+    FlatCombiner<std::map<int, int>> combiner;
+
+    // Operations with results
+    REQUIRE(combiner.Execute([](std::map<int, int>& map) { return map.emplace(1, 10).second; }));
+    REQUIRE(!combiner.Execute([](std::map<int, int>& map) { return map.emplace(1, 20).second; }));
+    int& value = combiner.Execute([](std::map<int, int>& map) -> int& { return map[1]; });
+    REQUIRE(value == 10);
+    combiner.Execute([](std::map<int, int>& map) { map[2] = 20; });
+    REQUIRE(combiner.unsafe().size() == 2);
+    REQUIRE(combiner.slots() == 1);
+    REQUIRE(combiner.operations() == 4);
+
+    // Exceptions are rethrown in the calling thread
+    REQUIRE_THROWS_AS(combiner.Execute([](std::map<int, int>& map) { return map.at(3); }), std::out_of_range);
+    REQUIRE(combiner.Execute([](std::map<int, int>& map) { return map.at(2); }) == 20);
+}
+
+TEST_CASE("Flat combiner multiple threads", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    int items = 10000;
+
+    FlatCombiner<std::vector<int>> combiner;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&combiner, items, thread]()
+        {
+            for (int i = 0; i < items; ++i)
+                combiner.Execute([thread, i](std::vector<int>& vector) { vector.push_back(thread * 1000000 + i); });
+        });
+    }
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    std::vector<int>& result = combiner.unsafe();
+    REQUIRE(result.size() == (size_t)(concurrency * items));
+    REQUIRE(combiner.operations() == (uint64_t)(concurrency * items));
+    REQUIRE(combiner.batches() <= combiner.operations());
+    REQUIRE(combiner.slots() <= (size_t)concurrency);
+
+    // Operations of each thread are executed in order
+    std::vector<int> next(concurrency, 0);
+    bool ordered = true;
+    for (int item : result)
+    {
+        int thread = item / 1000000;
+        ordered = ordered && ((item % 1000000) == next[thread]++);
+    }
+    REQUIRE(ordered);
+}
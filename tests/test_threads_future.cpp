@@ -0,0 +1,218 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/future.h"
+#include "threads/thread.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<int> AwaitSum(Future<int> future1, Future<int> future2)
+{
+    int value1 = co_await future1;
+    int value2 = co_await future2;
+    co_return value1 + value2;
+}
+
+Task<std::string> AwaitFailed(Future<int> future)
+{
+    try
+    {
+        co_await future;
+    }
+    catch (const std::runtime_error& ex)
+    {
+        co_return ex.what();
+    }
+    co_return "";
+}
+
+} // namespace
+
+TEST_CASE("Future and promise", "[CppCommon][Threads]")
+{
+    // Promise value
+    Promise<int> promise;
+    Future<int> future = promise.GetFuture();
+    REQUIRE(future.valid());
+    REQUIRE(!future.ready());
+    REQUIRE_THROWS_AS(promise.GetFuture(), RuntimeException);
+    promise.SetValue(42);
+    REQUIRE(promise.satisfied());
+    REQUIRE(future.ready());
+    REQUIRE(future.Get() == 42);
+    REQUIRE(!future.valid());
+    REQUIRE_THROWS_AS(promise.SetValue(43), RuntimeException);
+
+    // Move-only values
+    Promise<std::unique_ptr<int>> unique;
+    auto unique_future = unique.GetFuture();
+    unique.SetValue(std::make_unique<int>(7));
+    REQUIRE(*unique_future.Get() == 7);
+
+    // Exceptions
+    Promise<void> failed;
+    auto failed_future = failed.GetFuture();
+    failed.SetException(std::make_exception_ptr(std::runtime_error("failed")));
+    REQUIRE_THROWS_AS(failed_future.Get(), std::runtime_error);
+
+    // Broken promise
+    Future<std::string> broken;
+    {
+        Promise<std::string> abandoned;
+        broken = abandoned.GetFuture();
+    }
+    REQUIRE(broken.ready());
+    REQUIRE_THROWS_AS(broken.Get(), RuntimeException);
+
+    // Promise without retrieved future
+    {
+        Promise<std::string> unused;
+        unused.SetValue("unused");
+    }
+
+    // Ready futures
+    REQUIRE(MakeReadyFuture<std::string>("ready").Get() == "ready");
+    REQUIRE_NOTHROW(MakeReadyFuture<void>().Get());
+    REQUIRE_THROWS_AS(MakeExceptionalFuture<int>(std::make_exception_ptr(std::runtime_error("failed"))).Get(), std::runtime_error);
+
+    // Blocking wait for the value from another thread
+    for (int i = 0; i < 100; ++i)
+    {
+        Promise<int> async;
+        auto async_future = async.GetFuture();
+        std::thread thread([&async, i]() { async.SetValue(i); });
+        REQUIRE(async_future.Get() == i);
+        thread.join();
+    }
+}
+
+TEST_CASE("Future continuations", "[CppCommon][Threads]")
+{
+    // Continuations of the pending future are called when the promise is satisfied
+    Promise<int> promise;
+    auto result = promise.GetFuture()
+        .Then([](int value) { return value * 2; })
+        .Then([](int value) { return std::to_string(value); })
+        .Then([](std::string value) { return value + "!"; });
+    REQUIRE(!result.ready());
+    promise.SetValue(21);
+    REQUIRE(result.ready());
+    REQUIRE(result.Get() == "42!");
+
+    // Continuations of the ready future are called in place
+    int called = 0;
+    MakeReadyFuture<void>().Then([&called]() { ++called; }).Get();
+    REQUIRE(called == 1);
+
+    // Exceptions are propagated through the chain without calling continuations
+    auto failed = MakeReadyFuture<int>(1)
+        .Then([](int value) -> int { throw std::runtime_error("failed"); })
+        .Then([&called](int value) { ++called; return value; });
+    REQUIRE_THROWS_AS(failed.Get(), std::runtime_error);
+    REQUIRE(called == 1);
+
+    // Continuations in the thread pool executor
+    ThreadPool pool(4);
+    std::vector<Future<int>> futures;
+    std::vector<Promise<int>> promises(100);
+    for (auto& p : promises)
+        futures.emplace_back(p.GetFuture().Then(pool, [&pool](int value) { return (pool.current() >= 0) ? value : -1; }));
+    for (int i = 0; i < 100; ++i)
+        promises[i].SetValue(i);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(futures[i].Get() == i);
+}
+
+TEST_CASE("Future combinators", "[CppCommon][Threads]")
+{
+    // WhenAll() collects values in the order of futures
+    std::vector<Promise<int>> promises(3);
+    std::vector<Future<int>> futures;
+    for (auto& promise : promises)
+        futures.emplace_back(promise.GetFuture());
+    auto all = WhenAll(std::move(futures));
+    promises[2].SetValue(3);
+    promises[0].SetValue(1);
+    REQUIRE(!all.ready());
+    promises[1].SetValue(2);
+    REQUIRE(all.ready());
+    REQUIRE(all.Get() == std::vector<int>({ 1, 2, 3 }));
+
+    // WhenAll() of empty and void futures
+    REQUIRE(WhenAll(std::vector<Future<int>>()).Get().empty());
+    std::vector<Future<void>> voids;
+    voids.emplace_back(MakeReadyFuture<void>());
+    voids.emplace_back(MakeReadyFuture<void>());
+    REQUIRE_NOTHROW(WhenAll(std::move(voids)).Get());
+
+    // WhenAll() fails with the exception of the failed future
+    std::vector<Future<int>> failed;
+    failed.emplace_back(MakeReadyFuture<int>(1));
+    failed.emplace_back(MakeExceptionalFuture<int>(std::make_exception_ptr(std::runtime_error("failed"))));
+    REQUIRE_THROWS_AS(WhenAll(std::move(failed)).Get(), std::runtime_error);
+
+    // WhenAny() completes with the first ready future
+    std::vector<Promise<std::string>> strings(3);
+    std::vector<Future<std::string>> string_futures;
+    for (auto& promise : strings)
+        string_futures.emplace_back(promise.GetFuture());
+    auto any = WhenAny(std::move(string_futures));
+    REQUIRE(!any.ready());
+    strings[1].SetValue("second");
+    strings[0].SetValue("first");
+    auto first = any.Get();
+    REQUIRE(first.first == 1);
+    REQUIRE(first.second == "second");
+    strings[2].SetValue("third");
+
+    // WhenAny() of void futures
+    std::vector<Promise<void>> signals(2);
+    std::vector<Future<void>> signal_futures;
+    for (auto& promise : signals)
+        signal_futures.emplace_back(promise.GetFuture());
+    auto signaled = WhenAny(std::move(signal_futures));
+    signals[0].SetValue();
+    REQUIRE(signaled.Get() == 0);
+    REQUIRE_THROWS_AS(WhenAny(std::vector<Future<int>>()), ArgumentException);
+
+    // Concurrent completion in the thread pool
+    ThreadPool pool(4);
+    std::vector<Promise<int>> concurrent(1000);
+    std::vector<Future<int>> concurrent_futures;
+    for (auto& promise : concurrent)
+        concurrent_futures.emplace_back(promise.GetFuture());
+    auto sum = WhenAll(std::move(concurrent_futures)).Then([](std::vector<int> values) { int result = 0; for (int value : values) result += value; return result; });
+    for (int i = 0; i < 1000; ++i)
+        pool.Post([&concurrent, i]() { concurrent[i].SetValue(i); });
+    REQUIRE(sum.Get() == 499500);
+}
+
+TEST_CASE("Future coroutines", "[CppCommon][Threads]")
+{
+    // Awaiting coroutine is resumed by the thread which completes the future
+    Promise<int> promise1;
+    Promise<int> promise2;
+    auto future1 = promise1.GetFuture();
+    auto future2 = promise2.GetFuture();
+    std::thread thread([&]() { Thread::Sleep(10); promise1.SetValue(1); promise2.SetValue(2); });
+    REQUIRE(SyncWait(AwaitSum(std::move(future1), std::move(future2))) == 3);
+    thread.join();
+
+    // Ready futures are awaited without suspension
+    REQUIRE(SyncWait(AwaitSum(MakeReadyFuture<int>(40), MakeReadyFuture<int>(2))) == 42);
+
+    // Exceptions are rethrown in the awaiting coroutine
+    REQUIRE(SyncWait(AwaitFailed(MakeExceptionalFuture<int>(std::make_exception_ptr(std::runtime_error("failed"))))) == "failed");
+}
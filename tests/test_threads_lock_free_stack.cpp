@@ -0,0 +1,123 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/lock_free_stack.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Item
+{
+    std::atomic<Item*> next;
+    int value;
+
+    explicit Item(int v = 0) : next(nullptr), value(v) {}
+};
+
+} // namespace
+
+TEST_CASE("Lock-free stack", "[CppCommon][Threads]")
+{
+    LockFreeStack<Item> stack;
+    REQUIRE(stack.empty());
+    REQUIRE(stack.Pop() == nullptr);
+    REQUIRE(stack.PopAll() == nullptr);
+
+    Item items[5] = { Item(0), Item(1), Item(2), Item(3), Item(4) };
+
+    // Test LIFO order
+    stack.Push(items[0]);
+    stack.Push(items[1]);
+    stack.Push(items[2]);
+    REQUIRE(!stack.empty());
+    REQUIRE(stack.top() == &items[2]);
+    REQUIRE(stack.Pop() == &items[2]);
+    REQUIRE(stack.Pop() == &items[1]);
+
+    // Test chain push
+    items[3].next = &items[4];
+    stack.Push(items[3], items[4]);
+    REQUIRE(stack.Pop() == &items[3]);
+    REQUIRE(stack.Pop() == &items[4]);
+    REQUIRE(stack.Pop() == &items[0]);
+    REQUIRE(stack.empty());
+
+    // Test pop all
+    for (auto& item : items)
+        stack.Push(item);
+    Item* chain = stack.PopAll();
+    REQUIRE(stack.empty());
+    int count = 0;
+    for (Item* item = chain; item != nullptr; item = item->next)
+    {
+        REQUIRE(item->value == 4 - count);
+        ++count;
+    }
+    REQUIRE(count == 5);
+}
+
+TEST_CASE("Lock-free stack multithreaded", "[CppCommon][Threads]")
+{
+    const int threads_count = 4;
+    const int items_count = 64;
+    const int iterations = 100000;
+
+    LockFreeStack<Item> stack;
+    std::vector<Item> items(items_count);
+    for (int i = 0; i < items_count; ++i)
+    {
+        items[i].value = i;
+        stack.Push(items[i]);
+    }
+
+    // Pop and push back items concurrently to provoke the ABA problem
+    std::atomic<int> owned[items_count];
+    for (auto& flag : owned)
+        flag = 0;
+    std::atomic<bool> failed(false);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&stack, &owned, &failed]()
+        {
+            for (int i = 0; i < iterations; ++i)
+            {
+                Item* first = stack.Pop();
+                Item* second = stack.Pop();
+                if ((first != nullptr) && (owned[first->value].fetch_add(1) != 0))
+                    failed = true;
+                if ((second != nullptr) && (owned[second->value].fetch_add(1) != 0))
+                    failed = true;
+                if (first != nullptr)
+                {
+                    owned[first->value].fetch_sub(1);
+                    stack.Push(*first);
+                }
+                if (second != nullptr)
+                {
+                    owned[second->value].fetch_sub(1);
+                    stack.Push(*second);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(!failed);
+
+    // All items must be in the stack exactly once
+    int count = 0;
+    while (stack.Pop() != nullptr)
+        ++count;
+    REQUIRE(count == items_count);
+}
@@ -0,0 +1,110 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/critical_section.h"
+#include "threads/lock_profiler.h"
+#include "threads/mutex.h"
+#include "threads/rw_lock.h"
+#include "threads/spin_lock.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+LockStatistics FindSite(int line)
+{
+    auto sites = LockProfiler::statistics();
+    auto it = std::find_if(sites.begin(), sites.end(), [line](const LockStatistics& site)
+    {
+        return (site.location.line() == line) && (std::strstr(site.location.filename(), "test_threads_lock_profiler") != nullptr);
+    });
+    REQUIRE(it != sites.end());
+    return *it;
+}
+
+} // namespace
+
+TEST_CASE("Lock profiler uncontended", "[CppCommon][Threads]")
+{
+    Mutex mutex;
+    SpinLock spin;
+    RWLock rwlock;
+
+    int mutex_line = 0;
+    int spin_line = 0;
+    int read_line = 0;
+    int write_line = 0;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        { mutex_line = __LINE__; PROFILED_LOCKER(mutex); }
+        { spin_line = __LINE__; PROFILED_LOCKER(spin); }
+        { read_line = __LINE__; PROFILED_READ_LOCKER(rwlock); }
+        { write_line = __LINE__; PROFILED_WRITE_LOCKER(rwlock); }
+    }
+
+    for (int line : { mutex_line, spin_line, read_line, write_line })
+    {
+        auto site = FindSite(line);
+        REQUIRE(site.acquisitions == 1000);
+        REQUIRE(site.contentions == 0);
+        REQUIRE(site.wait_total == 0);
+        REQUIRE(site.worst.empty());
+        REQUIRE(site.hold_samples == (1000 + LockSite::SAMPLING - 1) / LockSite::SAMPLING);
+    }
+
+    // Test statistics reset
+    LockProfiler::Reset();
+    REQUIRE(FindSite(mutex_line).acquisitions == 0);
+    REQUIRE(FindSite(mutex_line).hold_samples == 0);
+}
+
+TEST_CASE("Lock profiler contended", "[CppCommon][Threads]")
+{
+    CriticalSection lock;
+    std::atomic<int> line(0);
+
+    // Hold the lock while other threads wait for it
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&lock, &line]()
+        {
+            for (int j = 0; j < 10; ++j)
+            {
+                line.store(__LINE__); PROFILED_LOCKER(lock);
+                Thread::Sleep(1);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    auto site = FindSite(line);
+    REQUIRE(site.acquisitions == 40);
+    REQUIRE(site.contentions > 0);
+    REQUIRE(site.contention_ratio() > 0.0);
+    REQUIRE(site.wait_total > 0);
+    REQUIRE(site.wait_max >= site.wait_average());
+    REQUIRE(site.hold_max >= 1000000);
+    REQUIRE(!site.worst.empty());
+    REQUIRE(site.worst.size() <= (size_t)LockSite::WORST);
+    REQUIRE(site.worst.front().wait == site.wait_max);
+    REQUIRE(std::is_sorted(site.worst.begin(), site.worst.end(), [](const LockWait& a, const LockWait& b) { return a.wait > b.wait; }));
+    REQUIRE(!site.worst.front().frames.empty());
+
+    // Test the report
+    std::string report = LockProfiler::report(1);
+    REQUIRE(report.find("test_threads_lock_profiler") != std::string::npos);
+    REQUIRE(report.find("contentions=") != std::string::npos);
+}
@@ -0,0 +1,45 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/low_latency_profile.h"
+#include "system/cpu_topology.h"
+#include "threads/thread.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Low-latency profile", "[CppCommon][Threads]")
+{
+    CPUSet isolated = LowLatencyProfile::IsolatedCPUs();
+    REQUIRE(((isolated & CPUTopology::Current().online()) == isolated));
+
+    LowLatencyProfile::PrefaultStack(64 * 1024);
+
+    LowLatencyReport report;
+
+    // Apply the profile in a separate thread with optimizations which do not affect the process
+    std::thread thread = Thread::Start([&report]()
+    {
+        LowLatencyOptions options;
+        options.cpus = Thread::GetAffinitySet();
+        options.policy = RealtimePolicy::NONE;
+        options.lock_memory = false;
+        options.disable_malloc_trim = false;
+        report = LowLatencyProfile::Apply(options);
+    });
+    thread.join();
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    REQUIRE(report.pinned);
+    REQUIRE(report.timer_slack_disabled);
+    REQUIRE(report.complete());
+#endif
+    REQUIRE(report.stack_prefaulted);
+    REQUIRE(!report.realtime);
+    REQUIRE(!report.memory_locked);
+    REQUIRE(report.failures.size() <= 2);
+}
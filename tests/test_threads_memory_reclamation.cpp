@@ -0,0 +1,211 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "memory/allocator_pool.h"
+#include "threads/memory_reclamation.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Node
+{
+    static std::atomic<int> alive;
+
+    int value;
+    Node* next;
+
+    explicit Node(int v) : value(v), next(nullptr) { ++alive; }
+    ~Node() { --alive; }
+};
+
+std::atomic<int> Node::alive(0);
+
+// Treiber stack protected with hazard pointers
+template <class TDomain>
+bool PopHazard(TDomain& domain, std::atomic<Node*>& head, int& value)
+{
+    typename TDomain::Guard guard(domain);
+    for (;;)
+    {
+        Node* node = guard.Protect(0, head);
+        if (node == nullptr)
+            return false;
+        if (head.compare_exchange_weak(node, node->next))
+        {
+            value = node->value;
+            guard.Clear(0);
+            guard.Retire(node);
+            return true;
+        }
+    }
+}
+
+// Treiber stack protected with epoch-based reclamation
+template <class TDomain>
+bool PopEpoch(TDomain& domain, std::atomic<Node*>& head, int& value)
+{
+    typename TDomain::Guard guard(domain);
+    Node* node = head.load();
+    while (node != nullptr)
+    {
+        if (head.compare_exchange_weak(node, node->next))
+        {
+            value = node->value;
+            guard.Retire(node);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Push(std::atomic<Node*>& head, Node* node)
+{
+    node->next = head.load();
+    while (!head.compare_exchange_weak(node->next, node));
+}
+
+template <class TDomain, class TPop>
+void Stress(TDomain& domain, TPop pop)
+{
+    const int threads_count = 4;
+    const int items = 10000;
+
+    std::atomic<Node*> head(nullptr);
+    std::atomic<int64_t> sum(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&domain, &head, &sum, &pop, t]()
+        {
+            for (int i = 0; i < items; ++i)
+            {
+                Push(head, domain.template Create<Node>(t * items + i));
+                int value;
+                if (pop(domain, head, value))
+                    sum += value;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Drain the stack
+    int value;
+    while (pop(domain, head, value))
+        sum += value;
+
+    int64_t total = (int64_t)threads_count * items;
+    REQUIRE(sum == (total * (total - 1)) / 2);
+    REQUIRE(Node::alive == (int)domain.retired());
+
+    domain.Reclaim();
+    domain.Reclaim();
+    domain.Reclaim();
+    REQUIRE(domain.retired() == 0);
+    REQUIRE(Node::alive == 0);
+}
+
+} // namespace
+
+TEST_CASE("Hazard pointers", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager manager;
+    {
+        HazardPointers<> domain(manager, 1);
+
+        Node* protected_node = domain.Create<Node>(1);
+        Node* unprotected_node = domain.Create<Node>(2);
+        std::atomic<Node*> source(protected_node);
+        REQUIRE(Node::alive == 2);
+
+        {
+            HazardPointers<>::Guard reader(domain);
+            REQUIRE(reader.Protect(0, source) == protected_node);
+
+            // Only the unprotected node could be freed
+            domain.Retire(protected_node);
+            domain.Retire(unprotected_node);
+            domain.Reclaim();
+            REQUIRE(domain.retired() == 1);
+            REQUIRE(Node::alive == 1);
+            REQUIRE(protected_node->value == 1);
+        }
+
+        domain.Reclaim();
+        REQUIRE(domain.retired() == 0);
+        REQUIRE(Node::alive == 0);
+
+        // Unpublished nodes are destroyed immediately
+        domain.Destroy(domain.Create<Node>(3));
+        REQUIRE(Node::alive == 0);
+
+        // Retired nodes are freed with the domain
+        domain.Retire(domain.Create<Node>(4));
+    }
+    REQUIRE(Node::alive == 0);
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("Hazard pointers multithreaded", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    HazardPointers<PoolMemoryManager<DefaultMemoryManager>> domain(manager);
+
+    Stress(domain, PopHazard<HazardPointers<PoolMemoryManager<DefaultMemoryManager>>>);
+
+    // Garbage is bounded by the count of records
+    REQUIRE(domain.records() <= 8);
+}
+
+TEST_CASE("Epoch-based reclamation", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager manager;
+    {
+        EpochReclamation<> domain(manager, 1);
+        REQUIRE(domain.epoch() == 1);
+
+        {
+            EpochReclamation<>::Guard reader(domain);
+            REQUIRE(reader.epoch() == 1);
+
+            // Pinned guard does not allow to pass the grace period
+            domain.Retire(domain.Create<Node>(1));
+            domain.Reclaim();
+            domain.Reclaim();
+            domain.Reclaim();
+            REQUIRE(domain.epoch() == 2);
+            REQUIRE(domain.retired() == 1);
+            REQUIRE(Node::alive == 1);
+        }
+
+        domain.Reclaim();
+        domain.Reclaim();
+        REQUIRE(domain.retired() == 0);
+        REQUIRE(Node::alive == 0);
+
+        // Retired nodes are freed with the domain
+        domain.Retire(domain.Create<Node>(2));
+        REQUIRE(Node::alive == 1);
+    }
+    REQUIRE(Node::alive == 0);
+    REQUIRE(manager.allocations() == 0);
+}
+
+TEST_CASE("Epoch-based reclamation multithreaded", "[CppCommon][Threads]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    EpochReclamation<PoolMemoryManager<DefaultMemoryManager>> domain(manager);
+
+    Stress(domain, PopEpoch<EpochReclamation<PoolMemoryManager<DefaultMemoryManager>>>);
+}
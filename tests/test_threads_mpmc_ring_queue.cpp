@@ -6,6 +6,11 @@
 
 #include "threads/mpmc_ring_queue.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppCommon][Threads]")
@@ -48,3 +53,115 @@ TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppC
     REQUIRE(queue.capacity() == 4);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue (bulk mode)", "[CppCommon][Threads]")
+{
+    MPMCRingQueue<int> queue(8);
+
+    std::vector<int> input = { 0, 1, 2, 3, 4, 5 };
+    std::vector<int> output;
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(output), 10) == 0);
+
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 6);
+    REQUIRE(queue.size() == 6);
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 2);
+    REQUIRE(queue.size() == 8);
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 0);
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(output), 5) == 5);
+    REQUIRE(queue.DequeueBulk(std::back_inserter(output), 10) == 3);
+    REQUIRE(output == std::vector<int>({ 0, 1, 2, 3, 4, 5, 0, 1 }));
+    REQUIRE(queue.size() == 0);
+
+    // Bulk producers and consumers threads
+    const int producers = 2;
+    const int consumers = 2;
+    const int items = 100000;
+
+    std::atomic<int64_t> sum(0);
+    std::atomic<int> count(0);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([&queue, i]()
+        {
+            int batch[32];
+            for (int item = i * items; item < (i + 1) * items;)
+            {
+                int size = std::min(32, (i + 1) * items - item);
+                for (int j = 0; j < size; ++j)
+                    batch[j] = item + j + 1;
+                size_t enqueued = queue.EnqueueBulk(batch, batch + size);
+                if (enqueued == 0)
+                    std::this_thread::yield();
+                item += (int)enqueued;
+            }
+        });
+    }
+    for (int i = 0; i < consumers; ++i)
+    {
+        threads.emplace_back([&queue, &sum, &count]()
+        {
+            int batch[16];
+            while (count < (producers * items))
+            {
+                size_t dequeued = queue.DequeueBulk(batch, 16);
+                if (dequeued == 0)
+                    std::this_thread::yield();
+                for (size_t j = 0; j < dequeued; ++j)
+                    sum += batch[j];
+                count += (int)dequeued;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(count == (producers * items));
+    REQUIRE(sum == ((int64_t)(producers * items) * (producers * items + 1) / 2));
+}
+
+template <class TWaitStrategy>
+static void ProduceConsumeWait(int producers, int consumers, int items)
+{
+    MPMCRingQueue<int, TWaitStrategy> queue(8);
+
+    std::atomic<int64_t> sum(0);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([&queue, i, items]()
+        {
+            for (int item = i * items; item < (i + 1) * items; ++item)
+                queue.EnqueueWait(item + 1);
+        });
+    }
+    for (int i = 0; i < consumers; ++i)
+    {
+        threads.emplace_back([&queue, &sum, producers, consumers, items]()
+        {
+            for (int j = 0; j < (producers * items / consumers); ++j)
+            {
+                int item;
+                queue.DequeueWait(item);
+                sum += item;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(sum == ((int64_t)(producers * items) * (producers * items + 1) / 2));
+    REQUIRE(queue.size() == 0);
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue (wait strategies)", "[CppCommon][Threads]")
+{
+    ProduceConsumeWait<SpinWaitStrategy>(2, 2, 500);
+    ProduceConsumeWait<YieldWaitStrategy>(2, 2, 5000);
+    ProduceConsumeWait<BlockingWaitStrategy>(2, 2, 5000);
+    ProduceConsumeWait<BlockingWaitStrategy>(4, 1, 2000);
+}
@@ -0,0 +1,107 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/mpmc_segmented_queue.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Multiple producers / multiple consumers lock-free segmented queue", "[CppCommon][Threads]")
+{
+    MPMCSegmentedQueue<int> queue(4, 1);
+
+    REQUIRE(queue.segment() == 4);
+    REQUIRE(queue.segments() == 1);
+    REQUIRE(queue.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!queue.Dequeue(v));
+
+    // Grow the queue over several segments
+    for (int i = 0; i < 10; ++i)
+        REQUIRE((queue.Enqueue(i) && (queue.size() == (size_t)(i + 1))));
+    REQUIRE(queue.segments() == 3);
+
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(((queue.Dequeue(v) && (v == i)) && (queue.size() == (size_t)(9 - i))));
+    REQUIRE(!queue.Dequeue(v));
+
+    // Drained segments are reused
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(queue.Enqueue(i));
+        REQUIRE(((queue.Dequeue(v) && (v == i))));
+    }
+    REQUIRE(queue.segments() <= 5);
+    REQUIRE(queue.size() == 0);
+
+    // Remaining items are destroyed with the queue
+    MPMCSegmentedQueue<std::string> strings(2);
+    for (int i = 0; i < 5; ++i)
+        REQUIRE(strings.Enqueue(std::string(100, (char)('a' + i))));
+    std::string s;
+    REQUIRE(((strings.Dequeue(s) && (s == std::string(100, 'a')))));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free segmented queue threads", "[CppCommon][Threads]")
+{
+    MPMCSegmentedQueue<uint64_t> queue(16, 4);
+
+    const int producers = 4;
+    const int consumers = 4;
+    const uint64_t items = 100000;
+
+    std::atomic<uint64_t> sum(0);
+    std::atomic<uint64_t> count(0);
+    std::atomic<bool> ordered(true);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([&queue, i]()
+        {
+            // Encode the producer index into the item high bits
+            for (uint64_t item = 1; item <= items; ++item)
+                queue.Enqueue(((uint64_t)i << 32) | item);
+        });
+    }
+    for (int i = 0; i < consumers; ++i)
+    {
+        threads.emplace_back([&queue, &sum, &count, &ordered]()
+        {
+            // Items of each producer must be dequeued in FIFO order
+            uint64_t last[producers] = { 0 };
+            while (count < (producers * items))
+            {
+                uint64_t item;
+                if (!queue.Dequeue(item))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                uint64_t producer = item >> 32;
+                uint64_t value = item & 0xFFFFFFFF;
+                if (value <= last[producer])
+                    ordered = false;
+                last[producer] = value;
+                sum += value;
+                ++count;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(ordered);
+    REQUIRE(count == (producers * items));
+    REQUIRE(sum == (producers * (items * (items + 1) / 2)));
+    REQUIRE(queue.size() == 0);
+}
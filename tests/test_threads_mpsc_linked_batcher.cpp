@@ -6,6 +6,11 @@
 
 #include "threads/mpsc_linked_batcher.h"
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free linked batcher", "[CppCommon][Threads]")
@@ -32,3 +37,135 @@ TEST_CASE("Multiple producers / single consumer wait-free linked batcher", "[Cpp
     REQUIRE(batcher.Dequeue());
     REQUIRE(!batcher.Dequeue());
 }
+
+namespace {
+
+struct PooledItem
+{
+    static std::atomic<int> nodes;
+
+    int value;
+
+    PooledItem() : value(0) { ++nodes; }
+    PooledItem(int v) : value(v) {}
+    PooledItem(const PooledItem&) = default;
+    PooledItem& operator=(const PooledItem&) = default;
+};
+
+std::atomic<int> PooledItem::nodes(0);
+
+} // namespace
+
+TEST_CASE("Multiple producers / single consumer wait-free linked batcher (node pooling)", "[CppCommon][Threads]")
+{
+    MPSCLinkedBatcher<PooledItem> batcher;
+
+    // Warm up the node freelist
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(batcher.Enqueue(PooledItem(i)));
+    REQUIRE(batcher.Dequeue([](const PooledItem&){}));
+    REQUIRE(PooledItem::nodes == 100);
+
+    // Steady-state operation reuses nodes without heap allocations
+    for (int cycle = 0; cycle < 10; ++cycle)
+    {
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(batcher.Enqueue(PooledItem(i)));
+        int sum = 0;
+        REQUIRE(batcher.Dequeue([&sum](const PooledItem& item) { sum += item.value; }));
+        REQUIRE(sum == 4950);
+    }
+    REQUIRE(PooledItem::nodes == 100);
+
+    // Multiple producers threads
+    const int producers = 4;
+    const int items = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([&batcher, i]()
+        {
+            for (int item = i * items; item < (i + 1) * items; ++item)
+                batcher.Enqueue(PooledItem(item + 1));
+        });
+    }
+
+    int64_t sum = 0;
+    int count = 0;
+    while (count < (producers * items))
+        batcher.Dequeue([&sum, &count](const PooledItem& item) { sum += item.value; ++count; });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(count == (producers * items));
+    REQUIRE(sum == ((int64_t)(producers * items) * (producers * items + 1) / 2));
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free linked batcher (templated handlers)", "[CppCommon][Threads]")
+{
+    MPSCLinkedBatcher<std::string> batcher;
+
+    // Visit items by rvalue
+    REQUIRE(!batcher.Dequeue([](std::string&&){}));
+    REQUIRE(batcher.Enqueue(std::string("one")));
+    REQUIRE(batcher.Enqueue(std::string("two")));
+    REQUIRE(batcher.Enqueue(std::string("three")));
+    std::vector<std::string> items;
+    REQUIRE(batcher.Dequeue([&items](std::string&& item) { items.emplace_back(std::move(item)); }));
+    REQUIRE(items == std::vector<std::string>({ "one", "two", "three" }));
+    REQUIRE(!batcher.Dequeue([](std::string&&){}));
+
+    // Visit items as a contiguous span
+    REQUIRE(!batcher.DequeueBatch([](std::span<std::string>){}));
+    for (int cycle = 0; cycle < 3; ++cycle)
+    {
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(batcher.Enqueue(std::to_string(i)));
+        size_t calls = 0;
+        REQUIRE(batcher.DequeueBatch([&calls](std::span<std::string> batch)
+        {
+            ++calls;
+            REQUIRE(batch.size() == 10);
+            for (size_t i = 0; i < batch.size(); ++i)
+                REQUIRE(batch[i] == std::to_string(i));
+        }));
+        REQUIRE(calls == 1);
+        REQUIRE(!batcher.DequeueBatch([](std::span<std::string>){}));
+    }
+
+    // Multiple producers threads
+    MPSCLinkedBatcher<int> numbers;
+
+    const int producers = 4;
+    const int total = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([&numbers, i]()
+        {
+            for (int item = i * total; item < (i + 1) * total; ++item)
+                numbers.Enqueue(item + 1);
+        });
+    }
+
+    int64_t sum = 0;
+    int count = 0;
+    while (count < (producers * total))
+    {
+        numbers.DequeueBatch([&sum, &count](std::span<int> batch)
+        {
+            for (int item : batch)
+                sum += item;
+            count += (int)batch.size();
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(count == (producers * total));
+    REQUIRE(sum == ((int64_t)(producers * total) * (producers * total + 1) / 2));
+}
@@ -6,6 +6,10 @@
 
 #include "threads/mpsc_linked_queue.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free linked queue", "[CppCommon][Threads]")
@@ -36,3 +40,78 @@ TEST_CASE("Multiple producers / single consumer wait-free linked queue", "[CppCo
     REQUIRE((queue.Dequeue(v) && (v == 5)));
     REQUIRE(!queue.Dequeue(v));
 }
+
+namespace {
+
+struct PooledItem
+{
+    static std::atomic<int> nodes;
+
+    int value;
+
+    PooledItem() : value(0) { ++nodes; }
+    PooledItem(int v) : value(v) {}
+    PooledItem(const PooledItem&) = default;
+    PooledItem& operator=(const PooledItem&) = default;
+};
+
+std::atomic<int> PooledItem::nodes(0);
+
+} // namespace
+
+TEST_CASE("Multiple producers / single consumer wait-free linked queue (node pooling)", "[CppCommon][Threads]")
+{
+    MPSCLinkedQueue<PooledItem> queue;
+
+    PooledItem v;
+    PooledItem::nodes = 0;
+
+    // Warm up the node freelist
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(queue.Enqueue(PooledItem(i)));
+    while (queue.Dequeue(v)) {}
+    REQUIRE(PooledItem::nodes == 100);
+
+    // Steady-state operation reuses nodes without heap allocations
+    for (int cycle = 0; cycle < 10; ++cycle)
+    {
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(queue.Enqueue(PooledItem(i)));
+        int sum = 0;
+        while (queue.Dequeue(v))
+            sum += v.value;
+        REQUIRE(sum == 4950);
+    }
+    REQUIRE(PooledItem::nodes == 100);
+
+    // Multiple producers threads
+    const int producers = 4;
+    const int items = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([&queue, i]()
+        {
+            for (int item = i * items; item < (i + 1) * items; ++item)
+                queue.Enqueue(PooledItem(item + 1));
+        });
+    }
+
+    int64_t sum = 0;
+    int count = 0;
+    while (count < (producers * items))
+    {
+        if (queue.Dequeue(v))
+        {
+            sum += v.value;
+            ++count;
+        }
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(count == (producers * items));
+    REQUIRE(sum == ((int64_t)(producers * items) * (producers * items + 1) / 2));
+}
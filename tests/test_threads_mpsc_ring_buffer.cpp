@@ -43,3 +43,42 @@ TEST_CASE("Multiple producers / single consumer wait-free ring buffer", "[CppCom
     REQUIRE(buffer.capacity() == 3);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring buffer (zero-copy mode)", "[CppCommon][Threads]")
+{
+    MPSCRingBuffer buffer(16, 4);
+
+    REQUIRE(buffer.Peek().empty());
+
+    // Write the data in place into several producers' ring buffers
+    size_t committed = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto prepared = buffer.Prepare(8);
+        if (prepared.empty())
+            continue;
+        for (auto& byte : prepared)
+            byte = (uint8_t)i;
+        buffer.Commit(prepared, 4);
+        committed += 4;
+    }
+    REQUIRE(committed > 0);
+    REQUIRE(buffer.size() == committed);
+
+    // Discard the prepared space
+    auto prepared = buffer.Prepare(4);
+    REQUIRE(prepared.size() == 4);
+    buffer.Commit(prepared, 0);
+    REQUIRE(buffer.size() == committed);
+
+    // Parse the data in place
+    size_t released = 0;
+    for (auto peeked = buffer.Peek(); !peeked.empty(); peeked = buffer.Peek())
+    {
+        REQUIRE((peeked.size() % 4) == 0);
+        buffer.Release(peeked.size());
+        released += peeked.size();
+    }
+    REQUIRE(released == committed);
+    REQUIRE(buffer.size() == 0);
+}
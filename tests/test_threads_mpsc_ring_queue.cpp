@@ -6,6 +6,8 @@
 
 #include "threads/mpsc_ring_queue.h"
 
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free ring queue", "[CppCommon][Threads]")
@@ -71,3 +73,33 @@ TEST_CASE("Multiple producers / single consumer wait-free ring queue (batch mode
     REQUIRE(batcher.capacity() == 3);
     REQUIRE(batcher.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue (bulk mode)", "[CppCommon][Threads]")
+{
+    MPSCRingQueue<int> queue(8, 1);
+
+    std::vector<int> input = { 0, 1, 2, 3, 4, 5 };
+    int output[16];
+
+    REQUIRE(queue.DequeueBulk(output, 16) == 0);
+
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 6);
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 1);
+    REQUIRE(queue.size() == 7);
+
+    REQUIRE(queue.DequeueBulk(output, 4) == 4);
+    REQUIRE(queue.DequeueBulk(output + 4, 16) == 3);
+    REQUIRE(std::vector<int>(output, output + 7) == std::vector<int>({ 0, 1, 2, 3, 4, 5, 0 }));
+    REQUIRE(queue.size() == 0);
+
+    // Bulk dequeue from many producers' ring queues
+    MPSCRingQueue<int> batcher(8, 4);
+    size_t enqueued = 0;
+    for (int i = 0; i < 8; ++i)
+        enqueued += batcher.EnqueueBulk(input.begin(), input.begin() + 2);
+    REQUIRE(batcher.size() == enqueued);
+    std::vector<int> items;
+    REQUIRE(batcher.DequeueBulk(std::back_inserter(items), 100) == enqueued);
+    REQUIRE(items.size() == enqueued);
+    REQUIRE(batcher.size() == 0);
+}
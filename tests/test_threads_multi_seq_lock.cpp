@@ -0,0 +1,127 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/multi_seq_lock.h"
+#include "threads/thread.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Book
+{
+    int version;
+    int levels[256];
+};
+
+} // namespace
+
+TEST_CASE("MultiSeqLock base", "[CppCommon][Threads]")
+{
+    MultiSeqLock<Book> lock;
+    REQUIRE(lock.slots() == 3);
+    REQUIRE(lock.version() == 0);
+    REQUIRE(lock.Read().version == 0);
+
+    Book book = {};
+    book.version = 1;
+    book.levels[255] = 123;
+    lock.Write(book);
+    REQUIRE(lock.version() == 1);
+    REQUIRE(lock.Visit([](const Book& data) { return data.levels[255]; }) == 123);
+
+    // Update the copy of the current version in place
+    lock.Update([](Book& data) { data.version = 2; data.levels[0] = 456; });
+    REQUIRE(lock.version() == 2);
+    REQUIRE(lock.Read().version == 2);
+    REQUIRE(lock.Read().levels[0] == 456);
+    REQUIRE(lock.Read().levels[255] == 123);
+
+    // Visit with the void visitor
+    int sum = 0;
+    lock.Visit([&sum](const Book& data) { sum = data.levels[0] + data.levels[255]; });
+    REQUIRE(sum == 579);
+
+    // Wrap around all slots
+    for (int i = 3; i < 10; ++i)
+    {
+        book.version = i;
+        lock = book;
+        REQUIRE(lock.Read().version == i);
+    }
+    REQUIRE(lock.version() == 9);
+}
+
+TEST_CASE("MultiSeqLock random", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int consumers_count = 4;
+
+    MultiSeqLock<Book, 4> lock;
+
+    // Start producer thread
+    std::thread producer = std::thread([&lock, items_to_produce]()
+    {
+        for (int i = 1; i <= items_to_produce; ++i)
+        {
+            // Update all book levels with the new version
+            lock.Update([i](Book& data)
+            {
+                data.version = i;
+                for (auto& level : data.levels)
+                    level = i;
+            });
+
+            // Yield to another thread...
+            if ((i % 100) == 0)
+                Thread::Yield();
+        }
+    });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    std::vector<int> errors(consumers_count, 0);
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&lock, &errors, consumer, items_to_produce]()
+        {
+            int last = 0;
+            while (last < items_to_produce)
+            {
+                // Visit the current version and check its consistency
+                auto result = lock.Visit([](const Book& data)
+                {
+                    bool consistent = true;
+                    for (auto level : data.levels)
+                        consistent &= (level == data.version);
+                    return std::make_pair(data.version, consistent);
+                });
+
+                // Versions must be consistent and must not go back
+                if (!result.second || (result.first < last))
+                    ++errors[consumer];
+                last = result.first;
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check results
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+        REQUIRE(errors[consumer] == 0);
+}
@@ -0,0 +1,148 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/multicast_ring.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Event
+{
+    int64_t value;
+    int64_t decoded;
+    int64_t checked;
+};
+
+// Run decoder -> risk -> journal pipeline and validate all stages see all events in order
+template <MulticastClaim claim, class TWaitStrategy>
+bool Pipeline(int producers_count, int64_t items)
+{
+    MulticastRing<Event, claim, TWaitStrategy> ring(1024);
+    typename MulticastRing<Event, claim, TWaitStrategy>::Consumer decoder(ring);
+    typename MulticastRing<Event, claim, TWaitStrategy>::Consumer risk(ring, { &decoder });
+    typename MulticastRing<Event, claim, TWaitStrategy>::Consumer journal(ring, { &risk });
+    typename MulticastRing<Event, claim, TWaitStrategy>::Consumer publisher(ring, { &decoder });
+
+    const int64_t total = producers_count * items;
+    std::atomic<bool> failed(false);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers_count; ++p)
+    {
+        threads.emplace_back([&ring, items]()
+        {
+            for (int64_t i = 0; i < items; ++i)
+                ring.PublishEvent([](Event& event, int64_t sequence) { event.value = sequence; event.decoded = -1; event.checked = -1; });
+        });
+    }
+
+    threads.emplace_back([&decoder, &failed, total]()
+    {
+        int64_t processed = 0;
+        while (processed < total)
+            processed += decoder.ProcessWait([&failed, &processed](Event& event, int64_t sequence, bool end_of_batch)
+            {
+                if (event.value != sequence)
+                    failed = true;
+                event.decoded = event.value * 2;
+            });
+    });
+    threads.emplace_back([&risk, &failed, total]()
+    {
+        int64_t processed = 0;
+        while (processed < total)
+            processed += risk.ProcessWait([&failed](Event& event, int64_t sequence, bool end_of_batch)
+            {
+                if (event.decoded != sequence * 2)
+                    failed = true;
+                event.checked = event.decoded + 1;
+            });
+    });
+    threads.emplace_back([&journal, &failed, total]()
+    {
+        int64_t expected = 0;
+        while (expected < total)
+            journal.ProcessWait([&failed, &expected](Event& event, int64_t sequence, bool end_of_batch)
+            {
+                if ((sequence != expected++) || (event.checked != sequence * 2 + 1))
+                    failed = true;
+            });
+    });
+    threads.emplace_back([&publisher, &failed, total]()
+    {
+        int64_t expected = 0;
+        while (expected < total)
+            publisher.ProcessWait([&failed, &expected](Event& event, int64_t sequence, bool end_of_batch)
+            {
+                if ((sequence != expected++) || (event.decoded != sequence * 2))
+                    failed = true;
+            }, 16);
+    });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    return !failed && (journal.sequence() == total - 1) && (publisher.sequence() == total - 1);
+}
+
+} // namespace
+
+TEST_CASE("Multicast ring", "[CppCommon][Threads]")
+{
+    MulticastRing<int> ring(4);
+    MulticastRing<int>::Consumer first(ring);
+    MulticastRing<int>::Consumer second(ring, { &first });
+    REQUIRE(ring.capacity() == 4);
+    REQUIRE(ring.consumers() == 2);
+    REQUIRE(ring.cursor() == -1);
+
+    // Claim and publish a batch of events
+    int64_t sequence;
+    REQUIRE(ring.TryClaim(sequence, 3));
+    REQUIRE(sequence == 2);
+    for (int64_t i = 0; i <= 2; ++i)
+        ring[i] = (int)(i * 10);
+    REQUIRE(first.Available() == -1);
+    ring.Publish(0, 2);
+    REQUIRE(first.Available() == 2);
+    REQUIRE(second.Available() == -1);
+
+    // Producers are gated by consumers
+    REQUIRE(ring.TryClaim(sequence));
+    REQUIRE(sequence == 3);
+    ring[3] = 30;
+    ring.Publish(3);
+    REQUIRE(!ring.TryClaim(sequence));
+
+    // Process the batch by the first consumer
+    std::vector<int> batch;
+    std::vector<bool> ends;
+    REQUIRE(first.Process([&](int& event, int64_t, bool end_of_batch) { batch.push_back(event); ends.push_back(end_of_batch); }, 2) == 2);
+    REQUIRE(batch == std::vector<int>({ 0, 10 }));
+    REQUIRE(ends == std::vector<bool>({ false, true }));
+    REQUIRE(first.sequence() == 1);
+    REQUIRE(second.Available() == 1);
+
+    // Slowest consumer gates producers
+    REQUIRE(!ring.TryClaim(sequence));
+    REQUIRE(second.Process([](int& event, int64_t, bool) {}) == 2);
+    REQUIRE(ring.TryClaim(sequence, 2));
+    REQUIRE(sequence == 5);
+    REQUIRE(!ring.TryClaim(sequence));
+}
+
+TEST_CASE("Multicast ring pipeline", "[CppCommon][Threads]")
+{
+    REQUIRE(Pipeline<MulticastClaim::SINGLE, YieldWaitStrategy>(1, 100000));
+    REQUIRE(Pipeline<MulticastClaim::SINGLE, BlockingWaitStrategy>(1, 100000));
+    REQUIRE(Pipeline<MulticastClaim::MULTI, YieldWaitStrategy>(4, 25000));
+    REQUIRE(Pipeline<MulticastClaim::MULTI, BlockingWaitStrategy>(4, 25000));
+}
@@ -58,3 +58,27 @@ TEST_CASE("Mutex locker", "[CppCommon][Threads]")
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Mutex timeout", "[CppCommon][Threads]")
+{
+    Mutex lock;
+
+    // Test TryLockFor() method on the busy mutex
+    lock.Lock();
+    bool locked = true;
+    std::thread([&lock, &locked]() { locked = lock.TryLockFor(Timespan::milliseconds(10)); }).join();
+    REQUIRE(!locked);
+    lock.Unlock();
+
+    // Test TryLockFor() method on the free mutex
+    REQUIRE(lock.TryLockFor(Timespan::milliseconds(10)));
+    lock.Unlock();
+
+    // Test the blocked thread is woken by unlock
+    lock.Lock();
+    std::thread waiter([&lock, &locked]() { locked = lock.TryLockFor(Timespan::seconds(10)); if (locked) lock.Unlock(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    lock.Unlock();
+    waiter.join();
+    REQUIRE(locked);
+}
@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/named_distributed_rw_lock.h"
+#include "threads/thread.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Named distributed read/write lock", "[CppCommon][Threads]")
+{
+    NamedDistributedRWLock lock1("named_distributed_rw_lock_test");
+    NamedDistributedRWLock lock2("named_distributed_rw_lock_test");
+
+    REQUIRE(lock1.slots() > 0);
+    REQUIRE(((lock1.slots() & (lock1.slots() - 1)) == 0));
+    REQUIRE(lock1.slots() == lock2.slots());
+
+    // Test TryLockRead() method
+    REQUIRE(lock1.TryLockRead());
+    REQUIRE(lock2.TryLockRead());
+    REQUIRE(!lock2.TryLockWrite());
+    lock1.UnlockRead();
+    REQUIRE(!lock1.TryLockWrite());
+    lock2.UnlockRead();
+
+    // Test TryLockWrite() method
+    REQUIRE(lock1.TryLockWrite());
+    REQUIRE(!lock2.TryLockRead());
+    REQUIRE(!lock2.TryLockWrite());
+    REQUIRE(!lock2.TryLockReadFor(Timespan::milliseconds(10)));
+    REQUIRE(!lock2.TryLockWriteFor(Timespan::milliseconds(10)));
+    lock1.UnlockWrite();
+
+    // Test LockRead()/UnlockRead() methods
+    lock1.LockRead();
+    REQUIRE(!lock2.TryLockWriteFor(Timespan::milliseconds(10)));
+    REQUIRE(lock2.TryLockReadFor(Timespan::milliseconds(10)));
+    lock2.UnlockRead();
+    lock1.UnlockRead();
+
+    // Test LockWrite()/UnlockWrite() methods
+    lock1.LockWrite();
+    REQUIRE(!lock2.TryLockRead());
+    lock1.UnlockWrite();
+    REQUIRE(lock2.TryLockRead());
+    lock2.UnlockRead();
+}
+
+TEST_CASE("Named distributed read/write locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10;
+    int consumers_count = 4;
+    int crc = 0;
+    std::vector<int> crcs;
+    int current = 0;
+
+    // Use few slots to check readers migrated between slots
+    NamedDistributedRWLock lock_master("named_distributed_rw_locker_test", 2);
+
+    // Reset consumers' results
+    for (int i = 0; i < consumers_count; ++i)
+        crcs.push_back(0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producer thread
+    std::thread producer = std::thread([&crc, &current, items_to_produce]()
+    {
+        NamedDistributedRWLock lock_slave("named_distributed_rw_locker_test", 2);
+
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            // Use a write locker to produce the item
+            {
+                WriteLocker<NamedDistributedRWLock> locker(lock_slave);
+
+                // Update the current produced item and produced crc
+                current = i;
+                crc += current;
+            }
+
+            // Sleep for a while...
+            Thread::Sleep(10);
+        }
+    });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&crcs, &current, consumer, items_to_produce]()
+        {
+            NamedDistributedRWLock lock_slave("named_distributed_rw_locker_test", 2);
+
+            int item = 0;
+            while (item < (items_to_produce - 1))
+            {
+                // Use a read locker to consume the item
+                {
+                    ReadLocker<NamedDistributedRWLock> locker(lock_slave);
+
+                    // Check for the current item changed
+                    if (item != current)
+                    {
+                        // Update consumed crc
+                        item = current;
+                        crcs[consumer] += item;
+                    }
+                }
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+    for (int i = 0; i < consumers_count; ++i)
+        REQUIRE(crcs[i] > 0);
+}
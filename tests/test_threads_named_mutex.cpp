@@ -5,12 +5,16 @@
 #include "test.h"
 
 #include "threads/named_mutex.h"
+#include "threads/thread.h"
 
 #include <thread>
 
-using namespace CppCommon;
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
-#if !defined(__APPLE__)
+using namespace CppCommon;
 
 TEST_CASE("Named mutex locker", "[CppCommon][Threads]")
 {
@@ -52,4 +56,79 @@ TEST_CASE("Named mutex locker", "[CppCommon][Threads]")
     REQUIRE(crc == result);
 }
 
+
+TEST_CASE("Named mutex timed lock", "[CppCommon][Threads]")
+{
+    NamedMutex mutex1("named_mutex_timed_test");
+    NamedMutex mutex2("named_mutex_timed_test");
+
+    mutex1.Lock();
+    REQUIRE(!mutex1.abandoned());
+    REQUIRE(!mutex2.TryLock());
+    bool locked = true;
+    Timestamp start = NanoTimestamp();
+    std::thread thread([&mutex2, &locked]() { locked = mutex2.TryLockFor(Timespan::milliseconds(50)); });
+    thread.join();
+    REQUIRE(!locked);
+    REQUIRE((NanoTimestamp() - start) >= Timespan::milliseconds(50));
+
+    // Test the mutex released during the blocked wait
+    thread = std::thread([&mutex2, &locked]() { locked = mutex2.TryLockFor(Timespan::seconds(10)); if (locked) mutex2.Unlock(); });
+    Thread::Sleep(20);
+    mutex1.Unlock();
+    thread.join();
+    REQUIRE(locked);
+}
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+
+TEST_CASE("Named mutex abandoned by the dead owner process", "[CppCommon][Threads]")
+{
+    NamedMutex mutex("named_mutex_robust_test");
+
+    // Child process locks the mutex and dies without unlocking
+    pid_t child = fork();
+    if (child == 0)
+    {
+        NamedMutex owner("named_mutex_robust_test");
+        owner.Lock();
+        _exit(0);
+    }
+    REQUIRE(child > 0);
+    int status;
+    REQUIRE(waitpid(child, &status, 0) == child);
+
+    mutex.Lock();
+    REQUIRE(mutex.abandoned());
+    mutex.Unlock();
+
+    mutex.Lock();
+    REQUIRE(!mutex.abandoned());
+    mutex.Unlock();
+}
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+TEST_CASE("Named mutex abandoned by the dead owner thread", "[CppCommon][Threads]")
+{
+    NamedMutex mutex("named_mutex_robust_thread_test");
+
+    // Thread locks the mutex and exits without unlocking
+    NamedMutex owner("named_mutex_robust_thread_test");
+    std::thread thread([&owner]() { owner.Lock(); });
+    thread.join();
+
+    mutex.Lock();
+    REQUIRE(mutex.abandoned());
+    mutex.Unlock();
+
+    // Only the owner thread might unlock the mutex
+    mutex.Lock();
+    std::thread other([&mutex]() { REQUIRE_THROWS_AS(mutex.Unlock(), SystemException); });
+    other.join();
+    mutex.Unlock();
+}
+
+#endif
+
 #endif
@@ -0,0 +1,99 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/named_seq_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Data
+{
+    int a;
+    int b;
+    int c;
+
+    friend bool operator==(const Data& data1, const Data& data2)
+    { return ((data1.a == data2.a) && (data1.b == data2.b) && (data1.c == data2.c)); }
+};
+
+} // namespace
+
+TEST_CASE("Named SeqLock base", "[CppCommon][Threads]")
+{
+    NamedSeqLock<Data> lock1("named_seq_lock_test");
+    NamedSeqLock<Data> lock2("named_seq_lock_test");
+
+    REQUIRE(lock2.Read() == Data{ 0, 0, 0 });
+    REQUIRE(lock2.sequence() == 0);
+
+    Data data = { 123, 456, 789 };
+    lock1.Write(data);
+    REQUIRE(lock2.Read() == data);
+    REQUIRE(lock2.sequence() == 2);
+
+    data = { 987, 654, 321 };
+    lock2 = data;
+    REQUIRE(lock1.Read() == data);
+    REQUIRE(lock1.sequence() == 4);
+}
+
+TEST_CASE("Named SeqLock random", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int producers_count = 2;
+    int consumers_count = 4;
+    std::atomic<bool> stop(false);
+    std::atomic<int> invalid(0);
+
+    NamedSeqLock<Data> lock_master("named_seq_lock_random_test");
+    lock_master.Write(Data{ 0, 100, 200 });
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([items_to_produce]()
+        {
+            NamedSeqLock<Data> lock_slave("named_seq_lock_random_test");
+            for (int i = 0; i < items_to_produce; ++i)
+                lock_slave.Write(Data{ i, i + 100, i + 200 });
+        });
+    }
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&stop, &invalid]()
+        {
+            NamedSeqLock<Data> lock_slave("named_seq_lock_random_test");
+            while (!stop)
+            {
+                Data data = lock_slave.Read();
+                if ((data.b != data.a + 100) || (data.c != data.b + 100))
+                    ++invalid;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumers threads
+    stop = true;
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    REQUIRE(invalid == 0);
+    REQUIRE(lock_master.sequence() == (uint64_t)(2 * (1 + producers_count * items_to_produce)));
+}
@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/numa_replicated.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("NUMA-replicated data", "[CppCommon][Threads]")
+{
+    NumaReplicated<std::vector<int>> replicated(std::vector<int>(100, 1));
+    REQUIRE(replicated.replicas() >= 1);
+    REQUIRE(replicated.version() == 1);
+    REQUIRE(((replicated.CurrentNode() >= 0) && (replicated.CurrentNode() < (int)replicated.replicas())));
+
+    // Read the local replica
+    {
+        auto guard = replicated.Read();
+        REQUIRE(guard.node() == replicated.CurrentNode());
+        REQUIRE(guard->size() == 100);
+        REQUIRE((*guard)[0] == 1);
+    }
+
+    // Store the new value into all replicas
+    replicated.Store(std::vector<int>(10, 2));
+    REQUIRE(replicated.version() == 2);
+    for (int node = 0; node < (int)replicated.replicas(); ++node)
+    {
+        auto guard = replicated.Read(node);
+        REQUIRE(guard.node() == node);
+        REQUIRE(*guard == std::vector<int>(10, 2));
+    }
+
+    // Update the value of all replicas
+    replicated.Update([](std::vector<int>& value) { value.push_back(3); });
+    REQUIRE(replicated.version() == 3);
+    REQUIRE(replicated.Load().size() == 11);
+    REQUIRE(replicated.Load().back() == 3);
+
+    // Old replicas are freed without readers
+    replicated.Reclaim();
+    REQUIRE(replicated.retired() == 0);
+}
+
+TEST_CASE("NUMA-replicated data guards old replicas", "[CppCommon][Threads]")
+{
+    NumaReplicated<std::vector<int>> replicated(std::vector<int>(10, 1));
+
+    auto guard = replicated.Read(0);
+    replicated.Store(std::vector<int>(10, 2));
+    replicated.Reclaim();
+
+    // Pinned replica is still alive
+    REQUIRE(replicated.retired() > 0);
+    REQUIRE(*guard == std::vector<int>(10, 1));
+    REQUIRE(replicated.Read(0)->front() == 2);
+}
+
+TEST_CASE("NUMA-replicated data multithreading", "[CppCommon][Threads]")
+{
+    NumaReplicated<std::vector<int>> replicated(std::vector<int>(64, 0));
+
+    const int updates = 200;
+    std::atomic<bool> stop(false);
+    std::atomic<bool> consistent(true);
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&replicated, &stop, &consistent]()
+        {
+            while (!stop)
+            {
+                auto guard = replicated.Read();
+
+                // Every replica is published whole
+                const std::vector<int>& value = *guard;
+                for (int item : value)
+                    if (item != value.front())
+                        consistent = false;
+            }
+        });
+    }
+
+    for (int i = 1; i <= updates; ++i)
+        replicated.Update([](std::vector<int>& value) { for (auto& item : value) ++item; });
+
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    REQUIRE(consistent);
+    REQUIRE(replicated.version() == updates + 1);
+    REQUIRE(replicated.Load() == std::vector<int>(64, updates));
+}
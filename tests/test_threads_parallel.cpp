@@ -0,0 +1,176 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/parallel.h"
+
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Parallel for", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    // Each index is visited exactly once
+    std::vector<std::atomic<int>> visits(100000);
+    ParallelFor(pool, (size_t)0, visits.size(), [&visits](size_t i) { visits[i].fetch_add(1); });
+    bool once = true;
+    for (auto& visit : visits)
+        once = once && (visit.load() == 1);
+    REQUIRE(once);
+
+    // Signed index ranges and the custom grain size
+    std::atomic<int64_t> sum(0);
+    ParallelOptions options;
+    options.grain = 7;
+    ParallelFor(pool, -100, 101, [&sum](int i) { sum += i; }, options);
+    REQUIRE(sum == 0);
+
+    // Empty range
+    std::atomic<int> calls(0);
+    ParallelFor(pool, 10, 10, [&calls](int) { ++calls; });
+    REQUIRE(calls == 0);
+
+    // Chunks cover the range without overlaps
+    std::atomic<size_t> count(0);
+    std::atomic<size_t> chunks(0);
+    std::atomic<size_t> largest(0);
+    options.grain = 1000;
+    ParallelForRange(pool, (size_t)0, (size_t)123456, [&count, &chunks, &largest](size_t begin, size_t end)
+    {
+        size_t size = end - begin;
+        size_t current = largest.load();
+        while ((size > current) && !largest.compare_exchange_weak(current, size));
+        count += size;
+        ++chunks;
+    }, options);
+    REQUIRE(count == 123456);
+    REQUIRE(largest == 1000);
+    REQUIRE(chunks == 124);
+
+    // Single thread concurrency
+    options.concurrency = 1;
+    std::vector<int> order;
+    ParallelFor(pool, 0, 5000, [&order](int i) { order.push_back(i); }, options);
+    REQUIRE(order.size() == 5000);
+    REQUIRE(std::is_sorted(order.begin(), order.end()));
+
+    // Physical cores concurrency
+    ParallelOptions physical;
+    physical.physical = true;
+    count = 0;
+    ParallelFor(pool, 0, 10000, [&count](int) { ++count; }, physical);
+    REQUIRE(count == 10000);
+}
+
+TEST_CASE("Parallel for nested and exceptions", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    // Nested parallel loops from workers of the same thread pool
+    std::atomic<int> count(0);
+    ParallelFor(pool, 0, 16, [&pool, &count](int)
+    {
+        ParallelFor(pool, 0, 1000, [&count](int) { ++count; });
+    });
+    REQUIRE(count == 16000);
+
+    // The first exception is rethrown in the calling thread
+    bool thrown = false;
+    try
+    {
+        ParallelFor(pool, 0, 100000, [](int i) { if (i == 5000) throw std::runtime_error("failed"); });
+    }
+    catch (const std::runtime_error& ex)
+    {
+        thrown = (std::string(ex.what()) == "failed");
+    }
+    REQUIRE(thrown);
+
+    // Thread pool is still usable
+    count = 0;
+    ParallelFor(pool, 0, 1000, [&count](int) { ++count; });
+    REQUIRE(count == 1000);
+}
+
+TEST_CASE("Parallel reduce", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    std::vector<uint64_t> values(1000000);
+    std::iota(values.begin(), values.end(), 1);
+
+    uint64_t sum = ParallelReduce(pool, values.begin(), values.end(), (uint64_t)0);
+    REQUIRE(sum == (uint64_t)1000000 * 1000001 / 2);
+
+    uint64_t max = ParallelReduce(pool, values.begin(), values.end(), (uint64_t)0, [](uint64_t a, uint64_t b) { return std::max(a, b); });
+    REQUIRE(max == 1000000);
+
+    // Non-commutative associative operation keeps the order
+    std::vector<std::string> words;
+    for (int i = 0; i < 5000; ++i)
+        words.push_back(std::to_string(i % 10));
+    std::string expected = std::accumulate(words.begin(), words.end(), std::string(">"));
+    ParallelOptions options;
+    options.grain = 100;
+    std::string concatenated = ParallelReduce(pool, words.begin(), words.end(), std::string(">"), std::plus<>(), options);
+    REQUIRE(concatenated == expected);
+
+    REQUIRE(ParallelReduce(pool, values.begin(), values.begin(), (uint64_t)42) == 42);
+}
+
+TEST_CASE("Parallel sort", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    std::mt19937_64 random(123);
+    for (size_t size : { (size_t)0, (size_t)1, (size_t)1000, (size_t)100000, (size_t)1000003 })
+    {
+        std::vector<uint64_t> values(size);
+        for (auto& value : values)
+            value = random() % 100000;
+        std::vector<uint64_t> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        ParallelSort(pool, values.begin(), values.end());
+        REQUIRE(values == expected);
+    }
+
+    // Custom comparator and odd count of blocks
+    std::vector<int> values(500000);
+    for (auto& value : values)
+        value = (int)(random() % 1000);
+    ParallelOptions options;
+    options.concurrency = 3;
+    ParallelSort(pool, values.begin(), values.end(), std::greater<>(), options);
+    REQUIRE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+}
+
+TEST_CASE("Parallel scan", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    std::vector<uint64_t> values(300001);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i % 7;
+
+    std::vector<uint64_t> expected(values.size());
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(), std::plus<>(), (uint64_t)10);
+
+    std::vector<uint64_t> output(values.size());
+    auto end = ParallelScan(pool, values.begin(), values.end(), output.begin(), (uint64_t)10);
+    REQUIRE(end == output.end());
+    REQUIRE(output == expected);
+
+    // In-place scan
+    ParallelScan(pool, values.begin(), values.end(), values.begin(), (uint64_t)10);
+    REQUIRE(values == expected);
+}
@@ -75,3 +75,27 @@ TEST_CASE("Semaphore locker", "[CppCommon][Threads]")
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Semaphore timeout", "[CppCommon][Threads]")
+{
+    Semaphore lock(2);
+
+    // Test TryLockFor() method on the busy semaphore
+    lock.Lock();
+    lock.Lock();
+    bool locked = true;
+    std::thread([&lock, &locked]() { locked = lock.TryLockFor(Timespan::milliseconds(10)); }).join();
+    REQUIRE(!locked);
+
+    // Test the blocked thread is woken by unlock
+    std::thread waiter([&lock, &locked]() { locked = lock.TryLockFor(Timespan::seconds(10)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    lock.Unlock();
+    waiter.join();
+    REQUIRE(locked);
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+    lock.Unlock();
+    REQUIRE(lock.TryLockFor(Timespan::milliseconds(10)));
+    lock.Unlock();
+}
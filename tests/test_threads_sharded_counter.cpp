@@ -0,0 +1,85 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/sharded_counter.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Sharded counter", "[CppCommon][Threads]")
+{
+    ShardedCounter counter;
+
+    REQUIRE(counter.slots() > 0);
+    REQUIRE(((counter.slots() & (counter.slots() - 1)) == 0));
+    REQUIRE(counter.value() == 0);
+
+    counter.Increment();
+    ++counter;
+    counter.Add(10);
+    counter += 5;
+    REQUIRE(counter.value() == 17);
+
+    counter.Reset();
+    REQUIRE(counter.value() == 0);
+
+    ShardedCounter small(3);
+    REQUIRE(small.slots() == 4);
+}
+
+TEST_CASE("Sharded gauge", "[CppCommon][Threads]")
+{
+    ShardedGauge gauge;
+
+    REQUIRE(gauge.value() == 0);
+
+    gauge.Increment();
+    ++gauge;
+    gauge.Add(10);
+    gauge += 5;
+    REQUIRE(gauge.value() == 17);
+
+    gauge.Decrement();
+    --gauge;
+    gauge.Sub(20);
+    gauge -= 5;
+    REQUIRE(gauge.value() == -10);
+
+    gauge.Reset();
+    REQUIRE(gauge.value() == 0);
+}
+
+TEST_CASE("Sharded counter and gauge multithreaded", "[CppCommon][Threads]")
+{
+    const int threads_count = 8;
+    const int items_to_produce = 100000;
+
+    ShardedCounter counter;
+    ShardedGauge gauge;
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&counter, &gauge]()
+        {
+            for (int i = 0; i < items_to_produce; ++i)
+            {
+                counter.Increment();
+                gauge.Increment();
+                if ((i % 2) == 0)
+                    gauge.Decrement();
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(counter.value() == (uint64_t)(threads_count * items_to_produce));
+    REQUIRE(gauge.value() == (int64_t)(threads_count * items_to_produce / 2));
+}
@@ -0,0 +1,84 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_mpsc_ring_queue.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+#if !defined(__APPLE__)
+
+TEST_CASE("Inter-process multiple producers / single consumer wait-free ring queue", "[CppCommon][Threads]")
+{
+    SharedMPSCRingQueue<int> producer("shared_mpsc_ring_queue_test", 4);
+    SharedMPSCRingQueue<int> consumer("shared_mpsc_ring_queue_test", 4);
+
+    REQUIRE(producer.owner());
+    REQUIRE(!consumer.owner());
+    REQUIRE(consumer.capacity() == 4);
+
+    int v = -1;
+
+    REQUIRE(!consumer.Dequeue(v));
+
+    REQUIRE((producer.Enqueue(0) && (consumer.size() == 1)));
+    REQUIRE((producer.Enqueue(1) && (consumer.size() == 2)));
+    REQUIRE((producer.Enqueue(2) && (consumer.size() == 3)));
+    REQUIRE((producer.Enqueue(3) && (consumer.size() == 4)));
+    REQUIRE(!producer.Enqueue(4));
+
+    REQUIRE(((consumer.Dequeue(v) && (v == 0)) && (consumer.size() == 3)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 1)) && (consumer.size() == 2)));
+
+    REQUIRE((producer.Enqueue(4) && (consumer.size() == 3)));
+    REQUIRE((producer.Enqueue(5) && (consumer.size() == 4)));
+    REQUIRE(!producer.Enqueue(6));
+
+    REQUIRE(((consumer.Dequeue(v) && (v == 2)) && (consumer.size() == 3)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 3)) && (consumer.size() == 2)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 4)) && (consumer.size() == 1)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 5)) && (consumer.size() == 0)));
+    REQUIRE(!consumer.Dequeue(v));
+}
+
+TEST_CASE("Inter-process multiple producers / single consumer wait-free ring queue (wait mode)", "[CppCommon][Threads]")
+{
+    const int producers = 4;
+    const int items = 5000;
+
+    SharedMPSCRingQueue<int> consumer("shared_mpsc_ring_queue_wait_test", 16);
+
+    // Start producer threads with their own ring queue instances
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([i, items]()
+        {
+            SharedMPSCRingQueue<int> queue("shared_mpsc_ring_queue_wait_test", 16);
+            for (int item = i * items; item < (i + 1) * items; ++item)
+                queue.EnqueueWait(item + 1);
+        });
+    }
+
+    int64_t sum = 0;
+    for (int i = 0; i < (producers * items); ++i)
+    {
+        int item;
+        consumer.DequeueWait(item);
+        sum += item;
+    }
+
+    // Wait for producer threads
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(sum == ((int64_t)(producers * items) * (producers * items + 1) / 2));
+    REQUIRE(consumer.empty());
+}
+
+#endif
@@ -0,0 +1,90 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+#if !defined(__APPLE__)
+
+TEST_CASE("Inter-process single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
+{
+    SharedSPSCRingBuffer producer("shared_spsc_ring_buffer_test", 4);
+    SharedSPSCRingBuffer consumer("shared_spsc_ring_buffer_test", 4);
+
+    REQUIRE(producer.owner());
+    REQUIRE(!consumer.owner());
+    REQUIRE(producer.capacity() == 4);
+    REQUIRE(consumer.capacity() == 4);
+
+    char data[5] = { 1, 2, 3, 4, 5 };
+    char output[5];
+    size_t size;
+
+    REQUIRE(!consumer.Dequeue(output, size = 4));
+
+    REQUIRE(producer.Enqueue(data, 3));
+    REQUIRE(consumer.size() == 3);
+    REQUIRE(!producer.Enqueue(data, 2));
+
+    REQUIRE((consumer.Dequeue(output, size = 2) && (size == 2)));
+    REQUIRE(((output[0] == 1) && (output[1] == 2)));
+
+    // Wrap the data around the ring buffer end
+    REQUIRE(producer.Enqueue(data + 3, 2));
+    REQUIRE(producer.size() == 3);
+    REQUIRE((consumer.Dequeue(output, size = 5) && (size == 3)));
+    REQUIRE(((output[0] == 3) && (output[1] == 4) && (output[2] == 5)));
+    REQUIRE(consumer.empty());
+
+    // Opening with another capacity is not allowed
+    REQUIRE_THROWS(SharedSPSCRingBuffer("shared_spsc_ring_buffer_test", 8));
+}
+
+TEST_CASE("Inter-process single producer / single consumer wait-free ring buffer (wait mode)", "[CppCommon][Threads]")
+{
+    const uint64_t items = 10000;
+
+    SharedSPSCRingBuffer producer("shared_spsc_ring_buffer_wait_test", 64);
+
+    uint64_t sum = 0;
+
+    // Start consumer thread with its own ring buffer instance
+    auto consumer = std::thread([&sum, items]()
+    {
+        SharedSPSCRingBuffer buffer("shared_spsc_ring_buffer_wait_test", 64);
+
+        uint64_t received = 0;
+        while (received < items * sizeof(uint64_t))
+        {
+            uint8_t data[64];
+            size_t size = sizeof(data);
+            buffer.DequeueWait(data, size);
+            for (size_t i = 0; i < size; ++i)
+                sum += data[i];
+            received += size;
+        }
+    });
+
+    uint64_t expected = 0;
+    for (uint64_t i = 0; i < items; ++i)
+    {
+        uint8_t data[sizeof(uint64_t)];
+        for (size_t j = 0; j < sizeof(data); ++j)
+            expected += (data[j] = (uint8_t)(i + j));
+        producer.EnqueueWait(data, sizeof(data));
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    REQUIRE(sum == expected);
+    REQUIRE(producer.empty());
+}
+
+#endif
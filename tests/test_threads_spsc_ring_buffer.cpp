@@ -6,6 +6,9 @@
 
 #include "threads/spsc_ring_buffer.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
@@ -59,3 +62,63 @@ TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon
     REQUIRE(buffer.capacity() == 4);
     REQUIRE(buffer.size() == 0);
 }
+
+static void ZeroCopyWrap(SPSCRingBuffer& buffer)
+{
+    const size_t capacity = buffer.capacity();
+    const size_t chunk = capacity / 2 + capacity / 4;
+
+    for (int round = 0; round < 8; ++round)
+    {
+        // Serialize the data directly into the ring buffer
+        auto prepared = buffer.Prepare(chunk);
+        REQUIRE(prepared.size() == chunk);
+        for (size_t i = 0; i < chunk; ++i)
+            prepared[i] = (uint8_t)(round + i);
+        REQUIRE(buffer.size() == 0);
+        buffer.Commit(chunk);
+        REQUIRE(buffer.size() == chunk);
+
+        // Not enough free space
+        REQUIRE(buffer.Prepare(chunk).empty());
+
+        // Parse the data in place
+        auto peeked = buffer.Peek();
+        REQUIRE(peeked.size() == chunk);
+        bool valid = true;
+        for (size_t i = 0; i < chunk; ++i)
+            valid &= (peeked[i] == (uint8_t)(round + i));
+        REQUIRE(valid);
+        buffer.Release(chunk);
+        REQUIRE(buffer.size() == 0);
+        REQUIRE(buffer.Peek().empty());
+    }
+
+    // Mix zero-copy and copy APIs over the wrapped range
+    std::vector<uint8_t> data(chunk);
+    for (size_t i = 0; i < chunk; ++i)
+        data[i] = (uint8_t)i;
+    REQUIRE(buffer.Enqueue(data.data(), data.size()));
+    auto peeked = buffer.Peek();
+    REQUIRE(std::vector<uint8_t>(peeked.begin(), peeked.end()) == data);
+    buffer.Release(1);
+    auto prepared = buffer.Prepare(1);
+    REQUIRE(prepared.size() == 1);
+    prepared[0] = 0xFF;
+    buffer.Commit(1);
+    std::vector<uint8_t> output(capacity);
+    size_t size = output.size();
+    REQUIRE((buffer.Dequeue(output.data(), size) && (size == chunk)));
+    REQUIRE(std::equal(data.begin() + 1, data.end(), output.begin()));
+    REQUIRE(output[chunk - 1] == 0xFF);
+}
+
+TEST_CASE("Single producer / single consumer wait-free ring buffer (zero-copy mode)", "[CppCommon][Threads]")
+{
+    SPSCRingBuffer small(16);
+    REQUIRE(!small.mirrored());
+    ZeroCopyWrap(small);
+
+    SPSCRingBuffer large(Memory::MirrorGranularity() * 4);
+    ZeroCopyWrap(large);
+}
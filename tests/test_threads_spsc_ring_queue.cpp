@@ -6,6 +6,9 @@
 
 #include "threads/spsc_ring_queue.h"
 
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring queue", "[CppCommon][Threads]")
@@ -44,3 +47,60 @@ TEST_CASE("Single producer / single consumer wait-free ring queue", "[CppCommon]
     REQUIRE(queue.capacity() == 3);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Single producer / single consumer wait-free ring queue (bulk mode)", "[CppCommon][Threads]")
+{
+    SPSCRingQueue<int> queue(8);
+
+    std::vector<int> input = { 0, 1, 2, 3, 4, 5 };
+    std::vector<int> output;
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(output), 10) == 0);
+
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 6);
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 1);
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 0);
+    REQUIRE(queue.size() == 7);
+
+    REQUIRE(queue.DequeueBulk(std::back_inserter(output), 3) == 3);
+    REQUIRE(queue.EnqueueBulk(input.begin(), input.end()) == 3);
+    REQUIRE(queue.DequeueBulk(std::back_inserter(output), 10) == 7);
+    REQUIRE(output == std::vector<int>({ 0, 1, 2, 3, 4, 5, 0, 0, 1, 2 }));
+    REQUIRE(queue.size() == 0);
+}
+
+template <class TWaitStrategy>
+static void ProduceConsumeWait(uint64_t items)
+{
+    SPSCRingQueue<uint64_t, TWaitStrategy> queue(8);
+
+    uint64_t sum = 0;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &sum, items]()
+    {
+        for (uint64_t i = 0; i < items; ++i)
+        {
+            uint64_t item;
+            queue.DequeueWait(item);
+            sum += item;
+        }
+    });
+
+    // Produce items with waiting while the ring queue is full
+    for (uint64_t i = 0; i < items; ++i)
+        queue.EnqueueWait(i);
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    REQUIRE(sum == (items * (items - 1) / 2));
+    REQUIRE(queue.size() == 0);
+}
+
+TEST_CASE("Single producer / single consumer wait-free ring queue (wait strategies)", "[CppCommon][Threads]")
+{
+    ProduceConsumeWait<SpinWaitStrategy>(1000);
+    ProduceConsumeWait<YieldWaitStrategy>(10000);
+    ProduceConsumeWait<BlockingWaitStrategy>(10000);
+}
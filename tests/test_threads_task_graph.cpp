@@ -0,0 +1,180 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions.h"
+#include "threads/task_graph.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Task graph", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    // Empty task graph completes immediately
+    TaskGraph empty;
+    REQUIRE(empty.empty());
+    empty.Run(pool);
+    REQUIRE(!empty.running());
+
+    // Diamond graph: a -> (b, c) -> d
+    std::atomic<int> step(0);
+    int a = -1, b = -1, c = -1, d = -1;
+    TaskGraph graph;
+    size_t ta = graph.Add([&]() { a = step++; });
+    size_t tb = graph.Add([&]() { b = step++; });
+    size_t tc = graph.Add([&]() { c = step++; });
+    size_t td = graph.Add([&]() { d = step++; });
+    graph.Precede(ta, tb);
+    graph.Precede(ta, tc);
+    graph.Succeed(td, { tb, tc });
+    REQUIRE(graph.size() == 4);
+
+    // The same graph is reused for many iterations
+    for (int i = 0; i < 100; ++i)
+    {
+        step = 0;
+        graph.Run(pool);
+        REQUIRE(a == 0);
+        REQUIRE(((b > a) && (c > a)));
+        REQUIRE(((d > b) && (d > c)));
+        REQUIRE(d == 3);
+    }
+
+    // Wide fan-out and fan-in
+    std::atomic<int> counter(0);
+    std::atomic<int> result(0);
+    TaskGraph wide;
+    size_t source = wide.Add([]() {});
+    size_t sink = wide.Add([&]() { result = counter.load(); });
+    for (int i = 0; i < 1000; ++i)
+    {
+        size_t task = wide.Add([&]() { counter.fetch_add(1); });
+        wide.Precede(source, task);
+        wide.Precede(task, sink);
+    }
+    for (int i = 1; i <= 10; ++i)
+    {
+        wide.Run(pool);
+        REQUIRE(result == 1000 * i);
+    }
+
+    // Cycles are rejected
+    TaskGraph cycle;
+    size_t t1 = cycle.Add([]() {});
+    size_t t2 = cycle.Add([]() {});
+    cycle.Precede(t1, t2);
+    cycle.Precede(t2, t1);
+    REQUIRE_THROWS_AS(cycle.Run(pool), ArgumentException);
+    REQUIRE(!cycle.running());
+    REQUIRE_THROWS_AS(cycle.Add(cycle), ArgumentException);
+}
+
+TEST_CASE("Task graph with nested subgraphs", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    std::vector<int> order;
+    std::mutex mutex;
+    auto record = [&](int value) { return [&, value]() { std::lock_guard<std::mutex> lock(mutex); order.push_back(value); }; };
+
+    // Subgraph with a chain of two stages
+    TaskGraph subgraph;
+    subgraph.Precede(subgraph.Add(record(2)), subgraph.Add(record(3)));
+
+    // Subgraph runs between the first and the last tasks of the parent graph
+    TaskGraph graph;
+    size_t first = graph.Add(record(1));
+    size_t nested = graph.Add(subgraph);
+    size_t last = graph.Add(record(4));
+    graph.Precede(first, nested);
+    graph.Precede(nested, last);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        order.clear();
+        graph.Run(pool);
+        REQUIRE(order == std::vector<int>({ 1, 2, 3, 4 }));
+    }
+
+    // Subgraphs are nested into each other
+    std::atomic<int> counter(0);
+    TaskGraph inner;
+    for (int i = 0; i < 8; ++i)
+        inner.Add([&]() { counter.fetch_add(1); });
+    TaskGraph middle;
+    middle.Precede(middle.Add(inner), middle.Add([&]() { counter.fetch_add(100); }));
+    TaskGraph outer;
+    outer.Add(middle);
+    outer.Add([&]() { counter.fetch_add(1000); });
+    outer.Run(pool);
+    REQUIRE(counter == 1108);
+
+    // Subgraph modified between runs is validated again
+    inner.Precede(0, 0);
+    REQUIRE_THROWS_AS(outer.Run(pool), ArgumentException);
+}
+
+TEST_CASE("Task graph cancellation", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    // Canceled graph skips not started tasks
+    std::atomic<int> counter(0);
+    TaskGraph graph;
+    size_t previous = graph.Add([&]() { counter.fetch_add(1); });
+    size_t cancel = graph.Add([&]() { graph.Cancel(); });
+    graph.Precede(previous, cancel);
+    previous = cancel;
+    for (int i = 0; i < 100; ++i)
+    {
+        size_t task = graph.Add([&]() { counter.fetch_add(1); });
+        graph.Precede(previous, task);
+        previous = task;
+    }
+    graph.Run(pool);
+    REQUIRE(counter == 1);
+
+    // Canceled graph is restarted from the beginning
+    graph.Run(pool);
+    REQUIRE(counter == 2);
+
+    // Cancellation of the parent graph is propagated to nested subgraphs
+    std::atomic<bool> started(false);
+    std::atomic<bool> propagated(false);
+    TaskGraph subgraph;
+    size_t wait = subgraph.Add([&]() { started = true; while (!subgraph.canceled()) {} propagated = true; });
+    subgraph.Precede(wait, subgraph.Add([&]() { counter.fetch_add(1); }));
+    TaskGraph parent;
+    parent.Add(subgraph);
+    parent.Add([&]() { while (!started) {} parent.Cancel(); });
+    counter = 0;
+    parent.Run(pool);
+    REQUIRE(propagated);
+    REQUIRE(counter == 0);
+
+    // The first exception cancels the graph and is rethrown by the waiter
+    TaskGraph failed;
+    size_t fail = failed.Add([]() { throw std::runtime_error("task failed"); });
+    failed.Precede(fail, failed.Add([&]() { counter.fetch_add(1); }));
+    REQUIRE_THROWS_AS(failed.Run(pool), std::runtime_error);
+    REQUIRE(counter == 0);
+
+    // Exceptions of nested subgraphs are propagated to the parent graph
+    TaskGraph nested;
+    nested.Add(failed);
+    REQUIRE_THROWS_AS(nested.Run(pool), std::runtime_error);
+
+    // Completed graph could be run again without exception
+    TaskGraph normal;
+    normal.Add([&]() { counter.fetch_add(1); });
+    normal.Run(pool);
+    REQUIRE(counter == 1);
+}
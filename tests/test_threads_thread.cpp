@@ -41,6 +41,31 @@ TEST_CASE("Thread", "[CppCommon][Threads]")
         REQUIRE(((stop - start) >= 0));
     }
 
+    // Test SleepPrecise() method
+    for (int64_t i = 1; i <= 1000000; i *= 10)
+    {
+        int64_t start = Timestamp::tsc();
+        Thread::SleepPrecise(Timespan::nanoseconds(i));
+        int64_t stop = Timestamp::tsc();
+        REQUIRE(((stop - start) >= i));
+    }
+    for (int64_t i = 0; i < 10; ++i)
+    {
+        int64_t start = Timestamp::tsc();
+        Thread::SleepPrecise(Timespan::microseconds(20), Timespan::microseconds(5));
+        int64_t stop = Timestamp::tsc();
+        REQUIRE(((stop - start) >= 20000));
+    }
+
+    // Test SleepPreciseUntil() method
+    TscTimestamp deadline;
+    for (int64_t i = 0; i < 10; ++i)
+    {
+        deadline += Timespan::microseconds(20);
+        Thread::SleepPreciseUntil(deadline);
+        REQUIRE(Timestamp::tsc() >= deadline.total());
+    }
+
     // Test Yield() method
     for (int64_t i = 0; i < 10; ++i)
     {
@@ -54,7 +79,50 @@ TEST_CASE("Thread", "[CppCommon][Threads]")
     std::bitset<64> affinity = Thread::GetAffinity();
     REQUIRE(affinity.to_ullong() > 0);
 
+    // Test thread CPU affinity set
+    CPUSet affinity_set = Thread::GetAffinitySet();
+    REQUIRE(!affinity_set.empty());
+    REQUIRE(affinity_set.bitset() == affinity);
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    CPUSet single({ affinity_set.first() });
+    Thread::SetAffinity(single);
+    REQUIRE(Thread::GetAffinitySet() == single);
+    REQUIRE(Thread::CurrentThreadAffinity() == (uint32_t)affinity_set.first());
+    Thread::SetAffinity(affinity_set);
+    REQUIRE(Thread::GetAffinitySet() == affinity_set);
+#endif
+
     // Test thread priority
     ThreadPriority priority = Thread::GetPriority();
     REQUIRE(priority == ThreadPriority::NORMAL);
 }
+
+TEST_CASE("Thread CPU time", "[CppCommon][Threads]")
+{
+    // Burn some CPU time in the current thread
+    Timespan start = Thread::CpuTime();
+    ThreadUsage usage1 = Thread::Usage();
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < 10000000; ++i)
+        sum = sum + i;
+    Timespan stop = Thread::CpuTime();
+    ThreadUsage usage2 = Thread::Usage();
+    REQUIRE(stop > start);
+    REQUIRE((usage2 - usage1).cpu() >= Timespan::zero());
+    REQUIRE(usage2.cpu() > Timespan::zero());
+
+    // Sleeping thread does not consume CPU time, but switches context
+    ThreadUsage sleeping;
+    std::thread thread = Thread::Start([&sleeping]()
+    {
+        ThreadUsage before = Thread::Usage();
+        Thread::Sleep(10);
+        sleeping = Thread::Usage() - before;
+    });
+    REQUIRE(Thread::CpuTime(thread) >= Timespan::zero());
+    thread.join();
+    REQUIRE(sleeping.cpu() < Timespan::milliseconds(10));
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    REQUIRE(sleeping.voluntary_switches > 0);
+#endif
+}
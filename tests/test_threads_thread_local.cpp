@@ -0,0 +1,83 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/thread_local.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Thread local", "[CppCommon][Threads]")
+{
+    ThreadLocal<int> value;
+    REQUIRE(value.find() == nullptr);
+    REQUIRE(value.size() == 0);
+    REQUIRE(*value == 0);
+    *value = 10;
+    REQUIRE(value.get() == 10);
+    REQUIRE(value.find() != nullptr);
+    REQUIRE(value.size() == 1);
+
+    // Each thread has its own value
+    int other = -1;
+    std::thread thread([&value, &other]() { other = value.get(); value.get() = 20; });
+    thread.join();
+    REQUIRE(other == 0);
+    REQUIRE(value.get() == 10);
+    REQUIRE(value.size() == 1);
+
+    // Dynamic instances have independent values
+    auto instance = std::make_unique<ThreadLocal<int>>([]() { return 5; });
+    REQUIRE(instance->get() == 5);
+    instance->get() = 6;
+    instance.reset();
+    ThreadLocal<int> reused([]() { return 7; });
+    REQUIRE(reused.get() == 7);
+    REQUIRE(value.get() == 10);
+}
+
+TEST_CASE("Thread local values of multiple threads", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<uint64_t> retired(0);
+    std::atomic<int> ready(0);
+    std::atomic<bool> stop(false);
+
+    ThreadLocal<std::atomic<uint64_t>> counter([]() { return 0; }, [&retired](std::atomic<uint64_t>& value) { retired += value; });
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&counter, &ready, &stop, thread]()
+        {
+            for (int i = 0; i <= thread; ++i)
+                counter->fetch_add(1, std::memory_order_relaxed);
+            ++ready;
+            while (!stop)
+                std::this_thread::yield();
+        });
+    }
+
+    while (ready < concurrency)
+        std::this_thread::yield();
+
+    // Aggregate values of all live threads
+    uint64_t total = 0;
+    counter.for_each([&total](const std::atomic<uint64_t>& value) { total += value; });
+    REQUIRE(counter.size() == (size_t)concurrency);
+    REQUIRE(total == 36);
+
+    // Values of exited threads are retired
+    stop = true;
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(counter.size() == 0);
+    REQUIRE(retired == 36);
+}
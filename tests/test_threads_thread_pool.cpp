@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/thread_pool.h"
+
+#include <atomic>
+
+using namespace CppCommon;
+
+namespace {
+
+void FanOut(ThreadPool& pool, std::atomic<int>& counter, int depth)
+{
+    counter.fetch_add(1);
+    if (depth > 0)
+    {
+        for (int i = 0; i < 2; ++i)
+            REQUIRE(pool.Post([&pool, &counter, depth]() { FanOut(pool, counter, depth - 1); }));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Work-stealing thread pool", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4, 1024);
+    REQUIRE(pool.threads() == 4);
+    REQUIRE(pool.current() < 0);
+    REQUIRE(!pool.stopped());
+
+    // Tasks posted from an external thread
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(pool.Post([&counter]() { counter.fetch_add(1); }));
+    pool.Wait();
+    REQUIRE(counter == 1000);
+    REQUIRE(pool.pending() == 0);
+
+    // Nested fan-out from worker threads
+    counter = 0;
+    REQUIRE(pool.Post([&pool, &counter]() { FanOut(pool, counter, 12); }));
+    pool.Wait();
+    REQUIRE(counter == ((1 << 13) - 1));
+
+    // Current worker index
+    std::atomic<int> index(-1);
+    REQUIRE(pool.Post([&pool, &index]() { index = pool.current(); }));
+    pool.Wait();
+    REQUIRE(index >= 0);
+    REQUIRE(index < 4);
+
+    // Stop completes all posted tasks
+    counter = 0;
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(pool.Post([&counter]() { Thread::Yield(); counter.fetch_add(1); }));
+    pool.Stop();
+    REQUIRE(pool.stopped());
+    REQUIRE(counter == 100);
+    REQUIRE(!pool.Post([]() {}));
+}
+
+TEST_CASE("Work-stealing thread pool with pinned workers", "[CppCommon][Threads]")
+{
+    ThreadPool pool(2, 16, true);
+
+    // Global injection queue overflow
+    std::atomic<int> counter(0);
+    int posted = 0;
+    for (int i = 0; i < 10000; ++i)
+        if (pool.Post([&counter]() { counter.fetch_add(1); }))
+            ++posted;
+    pool.Wait();
+    REQUIRE(posted > 0);
+    REQUIRE(counter == posted);
+}
@@ -0,0 +1,104 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/latch.h"
+#include "threads/thread_pool.h"
+#include "threads/timer_service.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Timer service one-shot timers", "[CppCommon][Threads]")
+{
+    TimerService service;
+    REQUIRE(!service.stopped());
+    REQUIRE(service.timers() == 0);
+
+    // Timers are fired in the deadline order
+    CriticalSection cs;
+    std::vector<int> order;
+    Latch latch(3);
+    REQUIRE(service.ScheduleAfter(Timespan::milliseconds(30), [&]() { Locker<CriticalSection> locker(cs); order.push_back(3); latch.CountDown(); }) != 0);
+    REQUIRE(service.ScheduleAfter(Timespan::milliseconds(10), [&]() { Locker<CriticalSection> locker(cs); order.push_back(1); latch.CountDown(); }) != 0);
+    REQUIRE(service.ScheduleAt(UtcTimestamp() + Timespan::milliseconds(20), [&]() { Locker<CriticalSection> locker(cs); order.push_back(2); latch.CountDown(); }) != 0);
+    latch.Wait();
+    REQUIRE(order == std::vector<int>({ 1, 2, 3 }));
+    REQUIRE(service.timers() == 0);
+
+    // Cancelled timer is never fired
+    std::atomic<int> fired(0);
+    TimerService::TimerId timer = service.ScheduleAfter(Timespan::milliseconds(20), [&]() { fired.fetch_add(1); });
+    REQUIRE(service.timers() == 1);
+    REQUIRE(service.Cancel(timer));
+    REQUIRE(!service.Cancel(timer));
+    REQUIRE(service.timers() == 0);
+    Thread::Sleep(50);
+    REQUIRE(fired == 0);
+
+    // Expired timer cannot be cancelled
+    Latch expired(1);
+    timer = service.ScheduleAfter(Timespan::zero(), [&]() { expired.CountDown(); });
+    expired.Wait();
+    Thread::Sleep(10);
+    REQUIRE(!service.Cancel(timer));
+    REQUIRE(!service.Cancel(0));
+
+    // Stopped timer service does not schedule timers
+    service.Stop();
+    REQUIRE(service.stopped());
+    REQUIRE(service.ScheduleAfter(Timespan::milliseconds(10), [&]() { fired.fetch_add(1); }) == 0);
+}
+
+TEST_CASE("Timer service periodic timers", "[CppCommon][Threads]")
+{
+    TimerService service;
+
+    std::atomic<int> fired(0);
+    Latch latch(5);
+    TimerService::TimerId timer = service.ScheduleEvery(Timespan::milliseconds(5), [&]()
+    {
+        if (fired.fetch_add(1) < 5)
+            latch.CountDown();
+    });
+    latch.Wait();
+    REQUIRE(service.timers() == 1);
+    REQUIRE(service.Cancel(timer));
+    REQUIRE(service.timers() == 0);
+
+    // Periodic timer could be fired at most once after the cancellation
+    Thread::Sleep(10);
+    int count = fired;
+    Thread::Sleep(30);
+    REQUIRE(fired == count);
+    REQUIRE(count >= 5);
+}
+
+TEST_CASE("Timer service with the thread pool executor", "[CppCommon][Threads]")
+{
+    ThreadPool pool(2, 1024);
+    TimerService service([&pool](TimerService::Task task) { pool.Post(std::move(task)); });
+
+    const int timers = 10000;
+
+    // Schedule many timers and cancel each second one
+    std::atomic<int> fired(0);
+    std::vector<TimerService::TimerId> ids;
+    for (int i = 0; i < timers; ++i)
+        ids.push_back(service.ScheduleAfter(Timespan::milliseconds(200 + (i % 20)), [&fired]() { fired.fetch_add(1); }));
+    REQUIRE(service.timers() == timers);
+    for (int i = 0; i < timers; i += 2)
+        REQUIRE(service.Cancel(ids[i]));
+    REQUIRE(service.timers() == (timers / 2));
+
+    // Wait for all remaining timers
+    while (service.timers() > 0)
+        Thread::Sleep(5);
+    service.Stop();
+    pool.Wait();
+    REQUIRE(fired == (timers / 2));
+}
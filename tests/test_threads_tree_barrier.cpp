@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/thread.h"
+#include "threads/tree_barrier.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Combining tree", "[CppCommon][Threads]")
+{
+    CombiningTree single(1);
+    REQUIRE(single.participants() == 1);
+    REQUIRE(single.size() == 1);
+    REQUIRE(single.depth() == 1);
+    REQUIRE(single.leaf(0) == single.root());
+
+    // Balanced tree of 9 participants: three leaves of 3 participants and the root
+    CombiningTree tree(9, 4);
+    REQUIRE(tree.size() == 4);
+    REQUIRE(tree.depth() == 2);
+    REQUIRE(tree.nodes()[tree.root()].count == 3);
+    REQUIRE(tree.nodes()[tree.root()].parent == -1);
+    for (int i = 0; i < 9; ++i)
+    {
+        REQUIRE(tree.leaf(i) == tree.leaf(i - i % 3));
+        REQUIRE(tree.nodes()[tree.leaf(i)].count == 3);
+        REQUIRE(tree.nodes()[tree.leaf(i)].parent == tree.root());
+    }
+
+    // Topology-aware tree groups participants of the same CPU together
+    int cpu = CPUTopology::Current().online().first();
+    CombiningTree pinned({ cpu, -1, cpu, -1, cpu });
+    REQUIRE(pinned.participants() == 5);
+    REQUIRE(pinned.leaf(0) == pinned.leaf(2));
+    REQUIRE(pinned.leaf(0) == pinned.leaf(4));
+    REQUIRE(pinned.nodes()[pinned.leaf(0)].count == 3);
+    REQUIRE(pinned.leaf(1) == pinned.root());
+    REQUIRE(pinned.leaf(3) == pinned.root());
+}
+
+TEST_CASE("Tree barrier single thread", "[CppCommon][Threads]")
+{
+    TreeBarrier barrier(1);
+
+    // Test Wait() method
+    REQUIRE(barrier.Wait(0));
+    REQUIRE(barrier.Wait(0));
+}
+
+TEST_CASE("Tree barrier multiple threads", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    int phases = 100;
+    std::atomic<bool> failed(false);
+    std::atomic<int> count(0);
+    std::atomic<int> last(0);
+
+    TreeBarrier barrier(concurrency, 2);
+    REQUIRE(barrier.threads() == concurrency);
+    REQUIRE(barrier.tree().depth() == 3);
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&barrier, &count, &last, &failed, concurrency, phases, thread]()
+        {
+            for (int phase = 1; phase <= phases; ++phase)
+            {
+                // Increment threads counter
+                ++count;
+
+                // Wait for all other threads at the barrier
+                if (barrier.Wait(thread))
+                    ++last;
+
+                // Check result in each thread
+                if (count < phase * concurrency)
+                    failed = true;
+
+                // Wait for all other threads to check the result
+                barrier.Wait(thread);
+            }
+        });
+    }
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency * phases);
+    REQUIRE(last == phases);
+    REQUIRE(!failed);
+}
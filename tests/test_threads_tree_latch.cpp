@@ -0,0 +1,53 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/tree_latch.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Tree latch", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+    std::atomic<bool> failed(false);
+
+    TreeLatch latch(concurrency, 2);
+    REQUIRE(latch.threads() == concurrency);
+
+    for (int attempt = 0; attempt < 10; ++attempt)
+    {
+        REQUIRE(!latch.TryWait());
+
+        // Start some threads
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < concurrency; ++thread)
+        {
+            threads.emplace_back([&latch, &count, &failed, concurrency, attempt, thread]()
+            {
+                ++count;
+                latch.CountDownAndWait(thread);
+                if (count < (attempt + 1) * concurrency)
+                    failed = true;
+            });
+        }
+
+        // Wait for the latch
+        latch.Wait(0);
+        REQUIRE(latch.TryWait());
+
+        // Wait for all threads to complete
+        for (auto& thread : threads)
+            thread.join();
+
+        latch.Reset();
+    }
+
+    REQUIRE(count == 10 * concurrency);
+    REQUIRE(!failed);
+}
@@ -5,6 +5,7 @@
 #include "test.h"
 
 #include "threads/wait_batcher.h"
+#include "time/timestamp.h"
 
 #include <thread>
 
@@ -93,3 +94,52 @@ TEST_CASE("Multiple producers / multiple consumers wait batcher threads", "[CppC
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Multiple producers / multiple consumers wait batcher adaptive batching", "[CppCommon][Threads]")
+{
+    WaitBatcher<int> batcher;
+
+    std::vector<int> v;
+
+    // Batch time threshold returns a partial batch
+    REQUIRE(batcher.Enqueue(0));
+    auto start = NanoTimestamp();
+    REQUIRE(((batcher.Dequeue(v, 10, Timespan::milliseconds(20)) && (v.size() == 1))));
+    REQUIRE((NanoTimestamp() - start).milliseconds() >= 19);
+
+    // Batch size threshold returns without waiting
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(batcher.Enqueue(i));
+    start = NanoTimestamp();
+    REQUIRE(((batcher.Dequeue(v, 10, Timespan::seconds(10)) && (v.size() == 10))));
+    REQUIRE((NanoTimestamp() - start).seconds() < 5);
+
+    // Maximal batch size leaves remaining items for the next dequeue
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(batcher.Enqueue(i));
+    REQUIRE(((batcher.Dequeue(v, 1, Timespan::zero(), 4) && (v == std::vector<int>({ 0, 1, 2, 3 })))));
+    REQUIRE(((batcher.Dequeue(v, 1, Timespan::zero(), 4) && (v == std::vector<int>({ 4, 5, 6, 7 })))));
+    REQUIRE(((batcher.Dequeue(v, 1, Timespan::zero(), 4) && (v == std::vector<int>({ 8, 9 })))));
+    REQUIRE(batcher.size() == 0);
+
+    // Producer reaches the batch size threshold
+    auto producer = std::thread([&batcher]()
+    {
+        for (int i = 0; i < 100; ++i)
+            batcher.Enqueue(i);
+    });
+    int count = 0;
+    while (count < 100)
+    {
+        REQUIRE(batcher.Dequeue(v, 50, Timespan::seconds(10)));
+        count += (int)v.size();
+    }
+    producer.join();
+    REQUIRE(count == 100);
+
+    // Closed wait batcher returns remaining items and then fails
+    REQUIRE(batcher.Enqueue(1));
+    batcher.Close();
+    REQUIRE(((batcher.Dequeue(v, 10, Timespan::seconds(10)) && (v.size() == 1))));
+    REQUIRE(!batcher.Dequeue(v, 10, Timespan::seconds(10)));
+}
@@ -0,0 +1,181 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/wait_priority_queue.h"
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Multiple producers / multiple consumers wait priority queue", "[CppCommon][Threads]")
+{
+    WaitPriorityQueue<int> queue;
+
+    REQUIRE(!queue.closed());
+    REQUIRE(queue.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!queue.TryDequeue(v));
+
+    // Items are dequeued in the priority order
+    for (int item : { 5, 1, 9, 3, 7, 0, 8, 2, 6, 4 })
+        REQUIRE(queue.Enqueue(item));
+    REQUIRE(queue.size() == 10);
+    for (int i = 9; i >= 0; --i)
+        REQUIRE(((queue.Dequeue(v) && (v == i)) && (queue.size() == (size_t)i)));
+
+    // Items with inverted comparator are dequeued in the ascending order
+    WaitPriorityQueue<int, std::greater<int>, 2> min_queue;
+    for (int item : { 3, 1, 2 })
+        REQUIRE(min_queue.Enqueue(item));
+    REQUIRE(((min_queue.TryDequeue(v) && (v == 1))));
+    REQUIRE(((min_queue.TryDequeue(v) && (v == 2))));
+    REQUIRE(((min_queue.TryDequeue(v) && (v == 3))));
+    REQUIRE(!min_queue.TryDequeue(v));
+
+    queue.Close();
+
+    REQUIRE(queue.closed());
+    REQUIRE(!queue.Enqueue(0));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait priority queue FIFO order of equal priorities", "[CppCommon][Threads]")
+{
+    struct PriorityCompare
+    {
+        bool operator()(const std::pair<int, int>& item1, const std::pair<int, int>& item2) const noexcept
+        { return (item1.first < item2.first); }
+    };
+
+    WaitPriorityQueue<std::pair<int, int>, PriorityCompare> queue;
+
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(queue.Enqueue(std::make_pair(i % 3, i)));
+
+    std::pair<int, int> item;
+    int priority = 2;
+    int last = -1;
+    while (queue.TryDequeue(item))
+    {
+        if (item.first != priority)
+        {
+            REQUIRE(item.first == priority - 1);
+            priority = item.first;
+            last = -1;
+        }
+        REQUIRE(item.second > last);
+        last = item.second;
+    }
+    REQUIRE(priority == 0);
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait priority queue close", "[CppCommon][Threads]")
+{
+    WaitPriorityQueue<int> queue(2);
+
+    REQUIRE(queue.capacity() == 2);
+    REQUIRE(queue.Enqueue(1));
+    REQUIRE(queue.Enqueue(2));
+
+    // Blocked producer is released by the consumer
+    auto producer = std::thread([&queue]() { queue.Enqueue(3); });
+
+    int v = -1;
+    REQUIRE((queue.Dequeue(v) && (v == 2)));
+    producer.join();
+    REQUIRE(queue.size() == 2);
+
+    // Items enqueued before close are still dequeued
+    queue.Close();
+    REQUIRE(!queue.Enqueue(4));
+    REQUIRE((queue.Dequeue(v) && (v == 3)));
+    REQUIRE((queue.Dequeue(v) && (v == 1)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait deadline queue", "[CppCommon][Threads]")
+{
+    WaitDeadlineQueue<int> queue;
+
+    Timestamp now(1000000);
+    REQUIRE(queue.Enqueue(now + 300, 3));
+    REQUIRE(queue.Enqueue(now + 100, 1));
+    REQUIRE(queue.Enqueue(now + 200, 2));
+    REQUIRE(queue.Enqueue(now + 100, 4));
+    REQUIRE(queue.size() == 4);
+
+    int v = -1;
+    Timestamp deadline;
+    REQUIRE(((queue.TryDequeue(v, deadline) && (v == 1)) && (deadline == now + 100)));
+    REQUIRE(((queue.TryDequeue(v, deadline) && (v == 4)) && (deadline == now + 100)));
+    REQUIRE(((queue.Dequeue(v, deadline) && (v == 2)) && (deadline == now + 200)));
+    REQUIRE((queue.Dequeue(v) && (v == 3)));
+    REQUIRE(!queue.TryDequeue(v, deadline));
+
+    queue.Close();
+
+    REQUIRE(queue.closed());
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait priority queue threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int consumers_count = 2;
+    std::atomic<int> crc(0);
+
+    WaitPriorityQueue<int> queue(100);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &crc]()
+        {
+            int item;
+            while (queue.Dequeue(item))
+                crc += item;
+        });
+    }
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                if (!queue.Enqueue((producer * items) + i))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the wait priority queue
+    queue.Close();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "threads/work_stealing_deque.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Work-stealing deque", "[CppCommon][Threads]")
+{
+    WorkStealingDeque<int> deque(4);
+
+    REQUIRE(deque.capacity() == 4);
+    REQUIRE(deque.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!deque.Pop(v));
+    REQUIRE(!deque.Steal(v));
+
+    // Owner pops in LIFO order, thieves steal in FIFO order
+    deque.Push(0);
+    deque.Push(1);
+    deque.Push(2);
+    REQUIRE(deque.size() == 3);
+    REQUIRE(((deque.Pop(v) && (v == 2)) && (deque.size() == 2)));
+    REQUIRE(((deque.Steal(v) && (v == 0)) && (deque.size() == 1)));
+    REQUIRE(((deque.Pop(v) && (v == 1)) && (deque.size() == 0)));
+    REQUIRE(!deque.Pop(v));
+    REQUIRE(!deque.Steal(v));
+
+    // Deque grows when it is full
+    for (int i = 0; i < 100; ++i)
+        deque.Push(i);
+    REQUIRE(deque.size() == 100);
+    REQUIRE(deque.capacity() >= 100);
+    for (int i = 0; i < 50; ++i)
+        REQUIRE((deque.Steal(v) && (v == i)));
+    for (int i = 99; i >= 50; --i)
+        REQUIRE((deque.Pop(v) && (v == i)));
+    REQUIRE(deque.empty());
+}
+
+TEST_CASE("Work-stealing deque threads", "[CppCommon][Threads]")
+{
+    const int items = 100000;
+    const int thieves = 3;
+
+    WorkStealingDeque<int> deque(16);
+    std::atomic<int64_t> sum(0);
+    std::atomic<int> count(0);
+    std::atomic<bool> done(false);
+
+    // Start thieves threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thieves; ++i)
+    {
+        threads.emplace_back([&deque, &sum, &count, &done]()
+        {
+            int item;
+            while (!done.load() || !deque.empty())
+            {
+                if (deque.Steal(item))
+                {
+                    sum += item;
+                    ++count;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Owner pushes all items and pops some of them
+    int item;
+    for (int i = 1; i <= items; ++i)
+    {
+        deque.Push(i);
+        if (((i % 3) == 0) && deque.Pop(item))
+        {
+            sum += item;
+            ++count;
+        }
+    }
+    while (deque.Pop(item))
+    {
+        sum += item;
+        ++count;
+    }
+    done = true;
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Each item is taken exactly once
+    REQUIRE(count == items);
+    REQUIRE(sum == ((int64_t)items * (items + 1) / 2));
+}
@@ -6,8 +6,11 @@
 
 #include "time/time.h"
 
+#include <random>
 #include <thread>
 
+#include <time.h>
+
 using namespace CppCommon;
 
 TEST_CASE("Time", "[CppCommon][Time]")
@@ -45,3 +48,100 @@ TEST_CASE("Time", "[CppCommon][Time]")
     UtcTime time9(std::chrono::system_clock::now() + std::chrono::milliseconds(10));
     std::this_thread::sleep_until(time9.chrono());
 }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+// Compare with the standard library conversion
+void CompareTimeConversion(uint64_t seed)
+{
+    std::mt19937_64 generator(seed);
+    for (int i = 0; i < 20000; ++i)
+    {
+        // Up to the year 2300 with many day boundaries
+        time_t seconds = (time_t)(generator() % 10413792000ull);
+        if (i % 4 == 0)
+            seconds -= seconds % 86400;
+        else if (i % 4 == 1)
+            seconds += 86399 - (seconds % 86400);
+        else if (i % 4 == 2)
+            seconds += (generator() % 3) * 3600;
+
+        Timestamp timestamp(seconds * 1000000000ull + generator() % 1000000000ull);
+
+        struct tm utc;
+        REQUIRE(gmtime_r(&seconds, &utc) == &utc);
+        UtcTime time_utc(timestamp);
+        REQUIRE(time_utc.year() == utc.tm_year + 1900);
+        REQUIRE(time_utc.month() == utc.tm_mon + 1);
+        REQUIRE(time_utc.day() == utc.tm_mday);
+        REQUIRE((int)time_utc.weekday() == utc.tm_wday);
+        REQUIRE(time_utc.hour() == utc.tm_hour);
+        REQUIRE(time_utc.minute() == utc.tm_min);
+        REQUIRE(time_utc.second() == utc.tm_sec);
+        REQUIRE(time_utc.utcstamp() == timestamp);
+
+        struct tm local;
+        REQUIRE(localtime_r(&seconds, &local) == &local);
+        LocalTime time_local(timestamp);
+        REQUIRE(time_local.year() == local.tm_year + 1900);
+        REQUIRE(time_local.month() == local.tm_mon + 1);
+        REQUIRE(time_local.day() == local.tm_mday);
+        REQUIRE((int)time_local.weekday() == local.tm_wday);
+        REQUIRE(time_local.hour() == local.tm_hour);
+        REQUIRE(time_local.minute() == local.tm_min);
+        REQUIRE(time_local.second() == local.tm_sec);
+    }
+}
+
+TEST_CASE("Time conversion", "[CppCommon][Time]")
+{
+    CompareTimeConversion(0);
+
+    // Time zones with daylight saving time transitions, 45 minutes offset and
+    // transitions not aligned to 15 minutes are checked in the current thread
+    // with invalidated per-thread caches and in separate threads
+    const char* tz = getenv("TZ");
+    std::string previous = (tz != nullptr) ? tz : "";
+    for (const char* zone : { "CET-1CEST,M3.5.0,M10.5.0/3", "NZST-12NZDT,M9.5.0,M4.1.0/3", "EST5EDT,M3.2.0,M11.1.0", "<+0545>-5:45", "<-0044>0:44:30<+0016>,M3.5.0/1:07:13,M10.5.0/2:33:41" })
+    {
+        setenv("TZ", zone, 1);
+        LocalTime::UpdateTimezone();
+        CompareTimeConversion(1);
+        std::thread thread([]() { CompareTimeConversion(2); });
+        thread.join();
+    }
+
+    // Sequential seconds around the transition not aligned to 15 minutes
+    setenv("TZ", "<-0044>0:44:30<+0016>,M3.5.0/1:07:13,M10.5.0/2:33:41", 1);
+    LocalTime::UpdateTimezone();
+    time_t transition = (time_t)(UtcTime(2024, 3, 31, 1, 51, 43).utcstamp().seconds());
+    for (time_t seconds = transition - 1000; seconds < transition + 1000; ++seconds)
+    {
+        struct tm local;
+        REQUIRE(localtime_r(&seconds, &local) == &local);
+        LocalTime time_local(Timestamp(seconds * 1000000000ull));
+        REQUIRE(time_local.hour() == local.tm_hour);
+        REQUIRE(time_local.minute() == local.tm_min);
+        REQUIRE(time_local.second() == local.tm_sec);
+    }
+    if (tz != nullptr)
+        setenv("TZ", previous.c_str(), 1);
+    else
+        unsetenv("TZ");
+    LocalTime::UpdateTimezone();
+}
+
+#endif
+
+TEST_CASE("Time conversion of sequential timestamps", "[CppCommon][Time]")
+{
+    // Sequential conversions within the same day use the cached day
+    Timestamp base(Time(2024, 2, 28, 23, 59, 59).utcstamp());
+    REQUIRE(UtcTime(base).day() == 28);
+    REQUIRE(UtcTime(base + Timespan::seconds(1)).month() == 2);
+    REQUIRE(UtcTime(base + Timespan::seconds(1)).day() == 29);
+    REQUIRE(UtcTime(base + Timespan::days(1) + Timespan::seconds(1)).month() == 3);
+    REQUIRE(UtcTime(base + Timespan::days(1) + Timespan::seconds(1)).day() == 1);
+    REQUIRE(Time(2100, 3, 1).utcstamp() - Time(2100, 2, 28).utcstamp() == Timespan::days(1));
+    REQUIRE(Time(2000, 3, 1).utcstamp() - Time(2000, 2, 28).utcstamp() == Timespan::days(2));
+}
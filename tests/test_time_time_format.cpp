@@ -0,0 +1,95 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "string/format.h"
+#include "time/time.h"
+#include "time/time_format.h"
+
+#include <random>
+
+using namespace CppCommon;
+
+TEST_CASE("ISO-8601 formatting", "[CppCommon][Time]")
+{
+    Timestamp timestamp(Timestamp::seconds(1633046400 + 12 * 3600 + 34 * 60 + 56) + 123456789);
+    REQUIRE(TimeFormat::FormatISO8601(timestamp) == "2021-10-01T12:34:56.123456789Z");
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, 3) == "2021-10-01T12:34:56.123Z");
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, 0) == "2021-10-01T12:34:56Z");
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, Timespan::minutes(345), 6) == "2021-10-01T18:19:56.123456+05:45");
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, Timespan::hours(-13), 0) == "2021-09-30T23:34:56-13:00");
+    REQUIRE(TimeFormat::FormatISO8601(Timestamp()) == "1970-01-01T00:00:00.000000000Z");
+    REQUIRE(TimeFormat::FormatISO8601(Timestamp(), Timespan::hours(-1), 0) == "1969-12-31T23:00:00-01:00");
+
+    // Buffer overloads
+    char buffer[TimeFormat::ISO8601_SIZE];
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, buffer, sizeof(buffer)) == 30);
+    REQUIRE(std::string(buffer, 30) == "2021-10-01T12:34:56.123456789Z");
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, Timespan::zero(), buffer, sizeof(buffer)) == TimeFormat::ISO8601_SIZE);
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "2021-10-01T12:34:56.123456789+00:00");
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, buffer, 29) == 0);
+    REQUIRE(TimeFormat::FormatISO8601(timestamp, buffer, 20, 0) == 20);
+
+    // Compare with the time components formatting
+    std::mt19937_64 generator(0);
+    Timestamp sequential = timestamp;
+    for (int i = 0; i < 10000; ++i)
+    {
+        Timestamp random(generator() % 16000000000000000000ull);
+        sequential += Timespan::milliseconds(generator() % 5000);
+        for (const Timestamp& current : { random, sequential })
+        {
+            UtcTime time(current);
+            std::string expected = format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:09}Z", time.year(), time.month(), time.day(), time.hour(), time.minute(), time.second(), current.total() % 1000000000);
+            REQUIRE(TimeFormat::FormatISO8601(current) == expected);
+        }
+    }
+}
+
+TEST_CASE("ISO-8601 parsing", "[CppCommon][Time]")
+{
+    Timestamp timestamp(Timestamp::seconds(1633091696) + 123456789);
+
+    Timestamp result;
+    REQUIRE(TimeFormat::ParseISO8601("2021-10-01T12:34:56.123456789Z", result));
+    REQUIRE(result == timestamp);
+    REQUIRE(TimeFormat::ParseISO8601("2021-10-01t12:34:56,123456789z", result));
+    REQUIRE(result == timestamp);
+    REQUIRE(TimeFormat::ParseISO8601("2021-10-01 18:19:56.1234567891234+05:45", result));
+    REQUIRE(result == timestamp);
+    REQUIRE(TimeFormat::ParseISO8601("2021-10-01T02:34:56.123456789-1000", result));
+    REQUIRE(result == timestamp);
+    REQUIRE(TimeFormat::ParseISO8601("2021-10-01T12:34:56.5Z", result));
+    REQUIRE(result == Timestamp(Timestamp::seconds(1633091696) + 500000000));
+    REQUIRE(TimeFormat::ParseISO8601("2021-10-01T12:34:56Z", result));
+    REQUIRE(result == Timestamp::seconds(1633091696));
+    REQUIRE(TimeFormat::ParseISO8601("2024-02-29T00:00:00Z", result));
+    REQUIRE(TimeFormat::ParseISO8601("1970-01-01T00:00:00Z", result));
+    REQUIRE(result == Timestamp());
+    REQUIRE(TimeFormat::ParseISO8601("1970-01-01T00:00:00Z") == Timestamp());
+
+    // Invalid strings
+    for (const char* str : {
+        "", "2021-10-01T12:34:56", "2021-10-01T12:34:56.Z", "2021-10-01T12:34:56.123", "2021-10-01T12:34:56Zx",
+        "2021-10-01X12:34:56Z", "2021/10/01T12:34:56Z", "2021-10-01T12-34-56Z", "2021-1a-01T12:34:56Z", "2021-10-01T12:34:5aZ",
+        "2021-13-01T12:34:56Z", "2021-00-01T12:34:56Z", "2021-04-31T12:34:56Z", "2023-02-29T00:00:00Z", "2021-10-00T12:34:56Z",
+        "2021-10-01T24:00:00Z", "2021-10-01T12:60:00Z", "2021-10-01T12:34:56+24:00", "2021-10-01T12:34:56+05:60", "2021-10-01T12:34:56+5:45",
+        "2021-10-01T12:34:56+05:45:00", "1969-12-31T23:59:59Z", "1970-01-01T00:00:00+00:01", "9999-12-31T23:59:59Z" })
+    {
+        REQUIRE(!TimeFormat::ParseISO8601(str, result));
+    }
+    REQUIRE_THROWS_AS(TimeFormat::ParseISO8601("2021-10-01T12:34:56"), ArgumentException);
+
+    // Round trip of formatted timestamps
+    std::mt19937_64 generator(0);
+    for (int i = 0; i < 10000; ++i)
+    {
+        Timestamp random(generator() % 16000000000000000000ull);
+        Timespan offset = Timespan::minutes((int64_t)(generator() % 1440) - 720);
+        REQUIRE(TimeFormat::ParseISO8601(TimeFormat::FormatISO8601(random)) == random);
+        REQUIRE(TimeFormat::ParseISO8601(TimeFormat::FormatISO8601(random, offset)) == random);
+        REQUIRE(TimeFormat::ParseISO8601(TimeFormat::FormatISO8601(random, offset, 3)) == Timestamp(random.total() - random.total() % 1000000));
+    }
+}
@@ -17,28 +17,75 @@ TEST_CASE("Timestamp", "[CppCommon][Time]")
     REQUIRE((Timestamp::local() > 0));
     REQUIRE((Timestamp::nano() > 0));
     REQUIRE((Timestamp::rdts() > 0));
+    REQUIRE((Timestamp::tsc() > 0));
 
     uint64_t prev_utc = 0;
     uint64_t prev_local = 0;
     uint64_t prev_nano = 0;
     uint64_t prev_rdts = 0;
+    uint64_t prev_tsc = 0;
     for (int i = 0; i < 1000; ++i)
     {
         uint64_t next_utc = Timestamp::utc();
         uint64_t next_local = Timestamp::local();
         uint64_t next_nano = Timestamp::nano();
         uint64_t next_rdts = Timestamp::rdts();
+        uint64_t next_tsc = Timestamp::tsc();
         REQUIRE(prev_utc <= next_utc);
         REQUIRE(prev_local <= next_local);
         REQUIRE(prev_nano <= next_nano);
         REQUIRE(prev_rdts <= next_rdts);
+        REQUIRE(prev_tsc <= next_tsc);
         prev_utc = next_utc;
         prev_local = next_local;
         prev_nano = next_nano;
         prev_rdts = next_rdts;
+        prev_tsc = next_tsc;
     }
 
     // Compatibility with std::chrono
     Timestamp timestamp(std::chrono::system_clock::now() + std::chrono::milliseconds(10));
     std::this_thread::sleep_until(timestamp.chrono());
 }
+
+TEST_CASE("Calibrated TSC timestamp", "[CppCommon][Time]")
+{
+    // Calibrated TSC timestamp follows the high resolution timer
+    uint64_t nano1 = Timestamp::nano();
+    uint64_t tsc = TscTimestamp().total();
+    uint64_t nano2 = Timestamp::nano();
+    REQUIRE((tsc + 1000000 >= nano1));
+    REQUIRE((tsc <= nano2 + 1000000));
+
+    // Measured intervals are close to the high resolution timer ones
+    uint64_t tsc_start = Timestamp::tsc();
+    uint64_t nano_start = Timestamp::nano();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint64_t tsc_elapsed = Timestamp::tsc() - tsc_start;
+    uint64_t nano_elapsed = Timestamp::nano() - nano_start;
+    REQUIRE((tsc_elapsed + 5000000 >= nano_elapsed));
+    REQUIRE((tsc_elapsed <= nano_elapsed + 5000000));
+}
+
+TEST_CASE("Coarse timestamp", "[CppCommon][Time]")
+{
+    uint64_t prev_utc = 0;
+    uint64_t prev_nano = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        uint64_t next_utc = Timestamp::coarse_utc();
+        uint64_t next_nano = Timestamp::coarse_nano();
+        REQUIRE(prev_utc <= next_utc);
+        REQUIRE(prev_nano <= next_nano);
+        prev_utc = next_utc;
+        prev_nano = next_nano;
+    }
+
+    // Coarse timestamps lag behind precise ones at most by the timer tick
+    uint64_t utc = CoarseUtcTimestamp().total();
+    REQUIRE((utc <= Timestamp::utc()));
+    REQUIRE((utc + 100000000 >= Timestamp::utc()));
+    uint64_t nano = CoarseNanoTimestamp().total();
+    REQUIRE((nano <= Timestamp::nano()));
+    REQUIRE((nano + 100000000 >= Timestamp::nano()));
+}
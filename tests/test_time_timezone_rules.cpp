@@ -0,0 +1,164 @@
+//
+// Created by Ivan Shynkarenka on 14.10.2026
+//
+
+#include "test.h"
+
+#include "time/timezone_rules.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+void WriteUInt32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+        buffer.push_back((uint8_t)(value >> shift));
+}
+
+void WriteHeader(std::vector<uint8_t>& buffer, uint32_t typecnt, uint32_t charcnt)
+{
+    buffer.insert(buffer.end(), { 'T', 'Z', 'i', 'f', '2' });
+    buffer.resize(buffer.size() + 15, 0);
+    for (uint32_t count : { 0u, 0u, 0u, 0u, typecnt, charcnt })
+        WriteUInt32(buffer, count);
+}
+
+// Build TZif data without transitions and with the given POSIX TZ rule footer
+std::vector<uint8_t> BuildTZif(const std::string& rule, int32_t offset, const std::string& abbreviation)
+{
+    std::vector<uint8_t> buffer;
+    for (int i = 0; i < 2; ++i)
+    {
+        WriteHeader(buffer, 1, (uint32_t)abbreviation.size() + 1);
+        WriteUInt32(buffer, (uint32_t)offset);
+        buffer.push_back(0);
+        buffer.push_back(0);
+        buffer.insert(buffer.end(), abbreviation.begin(), abbreviation.end());
+        buffer.push_back(0);
+    }
+    buffer.push_back('\n');
+    buffer.insert(buffer.end(), rule.begin(), rule.end());
+    buffer.push_back('\n');
+    return buffer;
+}
+
+} // namespace
+
+TEST_CASE("Timezone rules", "[CppCommon][Time]")
+{
+    TimezoneRules utc;
+    REQUIRE(utc.name() == "UTC");
+    REQUIRE(utc.transitions() == 0);
+    REQUIRE(utc.Offset(UtcTimestamp()) == Timespan::zero());
+    REQUIRE(utc.At(UtcTimestamp()).name() == "UTC");
+
+    // Zone with POSIX TZ rule only
+    auto data = BuildTZif("EST5EDT,M3.2.0,M11.1.0", -18000, "EST");
+    TimezoneRules rules = TimezoneRules::Parse("Test/Eastern", data.data(), data.size());
+    REQUIRE(rules.name() == "Test/Eastern");
+    REQUIRE(rules.rule() == "EST5EDT,M3.2.0,M11.1.0");
+
+    // 2021-03-14 07:00:00 UTC is the start of the daylight saving time
+    UtcTimestamp start(Timestamp::seconds(1615705200));
+    REQUIRE(rules.Offset(start - Timespan::seconds(1)) == Timespan::hours(-5));
+    REQUIRE(rules.Offset(start) == Timespan::hours(-4));
+    REQUIRE(rules.At(start).name() == "EDT");
+    REQUIRE(rules.At(start).offset() == Timespan::hours(-5));
+    REQUIRE(rules.At(start).daylight() == Timespan::hours(1));
+    REQUIRE(rules.At(start - Timespan::seconds(1)).name() == "EST");
+
+    // 2021-11-07 06:00:00 UTC is the end of the daylight saving time
+    UtcTimestamp end(Timestamp::seconds(1636264800));
+    REQUIRE(rules.Offset(end - Timespan::seconds(1)) == Timespan::hours(-4));
+    REQUIRE(rules.Offset(end) == Timespan::hours(-5));
+
+    // Local time in the gap is shifted forward
+    LocalTimestamp gap(Timestamp::seconds(1615689000));
+    REQUIRE(rules.Convert(gap) == UtcTimestamp(Timestamp::seconds(1615707000)));
+
+    // Ambiguous local time is converted with the offset before the transition
+    LocalTimestamp ambiguous(Timestamp::seconds(1636248600));
+    REQUIRE(rules.Convert(ambiguous) == UtcTimestamp(Timestamp::seconds(1636263000)));
+
+    // Round trip of the local time outside transitions
+    UtcTimestamp summer(Timestamp::seconds(1625140800) + 123);
+    REQUIRE(rules.Convert(rules.Convert(summer)) == summer);
+
+    // Zone with rule without daylight saving time and quoted names
+    data = BuildTZif("<+0545>-5:45", 20700, "+0545");
+    rules = TimezoneRules::Parse("Test/Kathmandu", data.data(), data.size());
+    REQUIRE(rules.Offset(summer) == Timespan::minutes(345));
+    REQUIRE(rules.At(summer).name() == "+0545");
+
+    // Invalid data
+    const char garbage[] = "TZif2 invalid timezone data";
+    REQUIRE_THROWS_AS(TimezoneRules::Parse("Invalid", garbage, sizeof(garbage)), ArgumentException);
+    data = BuildTZif("EST5EDT,M3", -18000, "EST");
+    REQUIRE_THROWS_AS(TimezoneRules::Parse("Invalid", data.data(), data.size()), ArgumentException);
+    data.resize(data.size() - 1);
+    REQUIRE_THROWS_AS(TimezoneRules::Parse("Invalid", data.data(), data.size()), ArgumentException);
+}
+
+TEST_CASE("Timezone rules find", "[CppCommon][Time]")
+{
+    REQUIRE(TimezoneRules::Find("../etc/passwd") == nullptr);
+    REQUIRE(TimezoneRules::Find("/etc/passwd") == nullptr);
+    REQUIRE(TimezoneRules::Find("Unknown/Timezone") == nullptr);
+
+    auto utc1 = TimezoneRules::Find("UTC");
+    auto utc2 = TimezoneRules::Find("UTC");
+    REQUIRE(utc1 != nullptr);
+    REQUIRE(utc1 == utc2);
+    REQUIRE(utc1->Offset(UtcTimestamp()) == Timespan::zero());
+}
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+TEST_CASE("Timezone rules conversion", "[CppCommon][Time]")
+{
+    const char* tz = getenv("TZ");
+    std::string previous = (tz != nullptr) ? tz : "";
+
+    // Compare with the standard library conversion of the same zone files
+    for (const char* zone : { "Europe/London", "America/New_York", "Australia/Lord_Howe", "Asia/Kathmandu", "America/Sao_Paulo" })
+    {
+        auto rules = TimezoneRules::Find(zone);
+        if (rules == nullptr)
+            continue;
+
+        std::string value = std::string(":") + zone;
+        setenv("TZ", value.c_str(), 1);
+        tzset();
+
+        std::mt19937_64 generator(0);
+        for (int i = 0; i < 20000; ++i)
+        {
+            // Up to the year 2100
+            time_t seconds = (time_t)(generator() % 4102444800ull);
+            UtcTimestamp timestamp(Timestamp::seconds(seconds));
+
+            struct tm local;
+            REQUIRE(localtime_r(&seconds, &local) == &local);
+            REQUIRE(rules->Offset(timestamp).seconds() == local.tm_gmtoff);
+            Timezone timezone = rules->At(timestamp);
+            REQUIRE(timezone.name() == local.tm_zone);
+            REQUIRE((timezone.daylight() != Timespan::zero()) == (local.tm_isdst > 0));
+
+            LocalTimestamp localstamp = rules->Convert(timestamp);
+            REQUIRE(rules->Convert(rules->Convert(localstamp)) == localstamp);
+        }
+    }
+
+    if (tz != nullptr)
+        setenv("TZ", previous.c_str(), 1);
+    else
+        unsetenv("TZ");
+    tzset();
+}
+
+#endif
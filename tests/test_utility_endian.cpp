@@ -7,6 +7,9 @@
 #include "system/environment.h"
 #include "utility/endian.h"
 
+#include <cstring>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Endian", "[CppCommon][Utility]")
@@ -15,3 +18,88 @@ TEST_CASE("Endian", "[CppCommon][Utility]")
     REQUIRE((Endian::IsBigEndian() == Environment::IsBigEndian()));
     REQUIRE((Endian::IsLittleEndian() == Environment::IsLittleEndian()));
 }
+
+TEST_CASE("Endian byte swap", "[CppCommon][Utility]")
+{
+    // Compile time byte swap
+    static_assert(Endian::ByteSwap((uint8_t)0x12) == 0x12);
+    static_assert(Endian::ByteSwap((uint16_t)0x1234) == 0x3412);
+    static_assert(Endian::ByteSwap((uint32_t)0x12345678) == 0x78563412);
+    static_assert(Endian::ByteSwap((uint64_t)0x0123456789ABCDEFull) == 0xEFCDAB8967452301ull);
+    static_assert(Endian::ByteSwap((int16_t)-2) == (int16_t)0xFEFF);
+
+    const uint8_t buffer[9] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+    // Unaligned loads
+    REQUIRE(Endian::LoadBigEndian<uint16_t>(buffer + 1) == 0x0102);
+    REQUIRE(Endian::LoadBigEndian<uint32_t>(buffer + 1) == 0x01020304);
+    REQUIRE(Endian::LoadBigEndian<uint64_t>(buffer + 1) == 0x0102030405060708ull);
+    REQUIRE(Endian::LoadLittleEndian<uint16_t>(buffer + 1) == 0x0201);
+    REQUIRE(Endian::LoadLittleEndian<uint32_t>(buffer + 1) == 0x04030201);
+    REQUIRE(Endian::LoadLittleEndian<uint64_t>(buffer + 1) == 0x0807060504030201ull);
+    REQUIRE(Endian::LoadBigEndian<int16_t>(buffer + 1) == 0x0102);
+
+    // Unaligned stores
+    uint8_t output[9] = { 0 };
+    Endian::StoreBigEndian(output + 1, (uint32_t)0x01020304);
+    REQUIRE(std::memcmp(output + 1, buffer + 1, 4) == 0);
+    Endian::StoreLittleEndian(output + 1, (uint64_t)0x0807060504030201ull);
+    REQUIRE(std::memcmp(output + 1, buffer + 1, 8) == 0);
+
+    // Scalar read & write
+    int32_t value32;
+    REQUIRE(Endian::ReadBigEndian(buffer, value32) == 4);
+    REQUIRE(value32 == 0x00010203);
+    uint64_t value64;
+    REQUIRE(Endian::ReadLittleEndian(buffer, value64) == 8);
+    REQUIRE(value64 == 0x0706050403020100ull);
+    REQUIRE(Endian::WriteBigEndian(output, (int16_t)0x0102) == 2);
+    REQUIRE(((output[0] == 0x01) && (output[1] == 0x02)));
+    REQUIRE(Endian::WriteLittleEndian(output, (uint16_t)0x0102) == 2);
+    REQUIRE(((output[0] == 0x02) && (output[1] == 0x01)));
+}
+
+template <typename T>
+void TestEndianBatch(size_t count)
+{
+    std::vector<uint8_t> buffer(count * sizeof(T) + 1);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = (uint8_t)(i * 7 + 3);
+
+    // Read from the unaligned buffer
+    std::vector<T> values(count);
+    REQUIRE(Endian::ReadBigEndian(buffer.data() + 1, std::span<T>(values)) == count * sizeof(T));
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(values[i] == Endian::LoadBigEndian<T>(buffer.data() + 1 + i * sizeof(T)));
+    REQUIRE(Endian::ReadLittleEndian(buffer.data() + 1, std::span<T>(values)) == count * sizeof(T));
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(values[i] == Endian::LoadLittleEndian<T>(buffer.data() + 1 + i * sizeof(T)));
+
+    // Write into the unaligned buffer
+    std::vector<uint8_t> output(count * sizeof(T) + 1);
+    REQUIRE(Endian::WriteBigEndian(output.data() + 1, std::span<const T>(values)) == count * sizeof(T));
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(Endian::LoadBigEndian<T>(output.data() + 1 + i * sizeof(T)) == values[i]);
+    REQUIRE(Endian::WriteLittleEndian(output.data() + 1, std::span<const T>(values)) == count * sizeof(T));
+    REQUIRE(std::memcmp(output.data() + 1, buffer.data() + 1, count * sizeof(T)) == 0);
+
+    // Byte swap in place
+    std::vector<T> swapped = values;
+    Endian::ByteSwap(std::span<T>(swapped));
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(swapped[i] == Endian::ByteSwap(values[i]));
+}
+
+TEST_CASE("Endian batch conversion", "[CppCommon][Utility]")
+{
+    for (size_t count = 0; count < 100; ++count)
+    {
+        TestEndianBatch<uint8_t>(count);
+        TestEndianBatch<int16_t>(count);
+        TestEndianBatch<uint16_t>(count);
+        TestEndianBatch<int32_t>(count);
+        TestEndianBatch<uint32_t>(count);
+        TestEndianBatch<int64_t>(count);
+        TestEndianBatch<uint64_t>(count);
+    }
+}